@@ -50,11 +50,30 @@
 //#define USE_OLD_MARLIN_UI
 //#define USE_MKS_UI
 
+/* Talk to the host over the WiFi module UART ( USART6 ) as a second serial port */
+//#define FF_WIFI_SERIAL
+
+/* Install a raw firmware.bin uploaded to the SD card with 'M997 C<crc32>' ( no vendor tool ) */
+//#define FF_FIRMWARE_UPDATE
+
+/* Run the main loop, the UI and SD card detection as FreeRTOS tasks, so drawing never holds up the planner */
+//#define FF_RTOS_TASKS
+
 /* NX and 3D20 mostly same, but 3D20 does not have heated bed and chamber */
 #if ENABLED(FF_DREMEL_3D20_MACHINE)
   #define FF_DREAMER_NX_MACHINE
 #endif
 
+/* Level with UBL and a 10x10 mesh instead of the 3x3 Mesh Bed Leveling */
+//#define FF_UBL_MESH
+#if ENABLED(FF_UBL_MESH)
+  #if DISABLED(FF_DREAMER_NX_MACHINE)
+    #error FF_UBL_MESH works only with Dreamer NX, 3D20
+  #endif
+  #define AUTO_BED_LEVELING_UBL
+  #define UBL_CELL_PLANES
+#endif
+
 
 /**
  * Configuration.h
@@ -154,7 +173,11 @@
  * Currently Ethernet (-2) is only supported on Teensy 4.1 boards.
  * :[-2, -1, 0, 1, 2, 3, 4, 5, 6, 7]
  */
-//#define SERIAL_PORT_2 -1
+#if ENABLED(FF_WIFI_SERIAL)
+  #define SERIAL_PORT_2 6       // FlashForge WiFi module
+#else
+  //#define SERIAL_PORT_2 -1
+#endif
 //#define BAUDRATE_2 250000   // Enable to override BAUDRATE
 
 /**
@@ -727,6 +750,11 @@
   #define MPC_MIN_AMBIENT_CHANGE 1.0f                 // (K/s) Modeled ambient temperature rate of change, when correcting model inaccuracies.
   #define MPC_STEADYSTATE 0.5f                        // (K/s) Temperature change rate for steady state logic to be enforced.
 
+  //#define MPC_FEEDFORWARD                           // Add heater power ahead of a rise in flow, from the moves in the planner.
+  #if ENABLED(MPC_FEEDFORWARD)
+    #define MPC_FEEDFORWARD_TIME 2.0f                 // (s) How far ahead to look. About the time the heat block needs to respond.
+  #endif
+
   #define MPC_TUNING_POS { X_CENTER, Y_CENTER, 1.0f } // (mm) M306 Autotuning position, ideally bed center at first layer height.
   #define MPC_TUNING_END_Z 10.0f                      // (mm) M306 Autotuning final Z position.
 #endif
@@ -1120,6 +1148,12 @@
 // Enable this feature if all enabled endstop pins are interrupt-capable.
 // This will remove the need to poll the interrupt pins, saving many CPU cycles.
 //#define ENDSTOP_INTERRUPTS_FEATURE
+#if ENABLED(ENDSTOP_INTERRUPTS_FEATURE)
+  // STM32F4/F7: Only unmask the EXTI lines of the endstops each move heads toward, and
+  // none while endstops are off. Lets endstops on the same pin number of two ports
+  // (like PE2 and PF2) both use interrupts, polling only while both are needed.
+  //#define ENDSTOP_INTERRUPTS_BY_DIRECTION
+#endif
 
 /**
  * Endstop Noise Threshold
@@ -1259,7 +1293,7 @@
  *
  * See https://github.com/synthetos/TinyG/wiki/Jerk-Controlled-Motion-Explained
  */
-#if DISABLED(LIN_ADVANCE)
+#if DISABLED(LIN_ADVANCE) || ENABLED(LIN_ADVANCE_INTEGRATED)
   #define S_CURVE_ACCELERATION
 #endif
 
@@ -1532,6 +1566,22 @@
 //#define MULTIPLE_PROBING 2
 //#define EXTRA_PROBING    1
 
+/**
+ * Adaptive Probing
+ *
+ * Instead of a fixed number of probes, do two slow taps at each point and accept
+ * the point when most taps are within ADAPTIVE_PROBING_TOLERANCE of their median.
+ * Otherwise keep tapping, up to ADAPTIVE_PROBING_MAX. The taps that agree are
+ * averaged and the others are disregarded. With no agreement at the last tap the
+ * median is used and a warning is printed. 'G29 V3' and 'M48 V3' list the taps per point.
+ * Don't use with MULTIPLE_PROBING.
+ */
+//#define ADAPTIVE_PROBING
+#if ENABLED(ADAPTIVE_PROBING)
+  #define ADAPTIVE_PROBING_TOLERANCE 0.005 // (mm) Most taps within this of the median
+  #define ADAPTIVE_PROBING_MAX           6 // Most taps at a point (3-10)
+#endif
+
 /**
  * Z probes require clearance when deploying, stowing, and moving between
  * probe points to avoid hitting the bed and other hardware.
@@ -1553,12 +1603,41 @@
 
 #define Z_PROBE_LOW_POINT          -2 // Farthest distance below the trigger-point to go before stopping
 
+/**
+ * Probe a series of points, like the G29 grid, from just above the point before:
+ * raise only PROBE_FLYBY_CLEARANCE after each trigger, travel at that height and
+ * skip the fast first probe. If the probe is triggered after the travel the point
+ * is probed again from Z_CLEARANCE_BETWEEN_PROBES.
+ * Only for beds that rise less than PROBE_FLYBY_CLEARANCE between probe points.
+ */
+//#define PROBE_FLYBY
+#if ENABLED(PROBE_FLYBY)
+  #define PROBE_FLYBY_CLEARANCE 2 // (mm) Travel height over the last trigger point
+#endif
+
+/**
+ * Visit the G35 tramming points, the G34 stepper points and the 3-point ABL
+ * points in the order with the least travel from where the probe is now.
+ * The G29 grid keeps its serpentine or Hilbert order.
+ */
+//#define PROBE_TOUR
+
 // For M851 give a range for adjusting the Z probe offset
 #define Z_PROBE_OFFSET_RANGE_MIN -20
 #define Z_PROBE_OFFSET_RANGE_MAX 20
 
 // Enable the M48 repeatability test to test probe accuracy
 //#define Z_MIN_PROBE_REPEATABILITY_TEST
+#if ENABLED(Z_MIN_PROBE_REPEATABILITY_TEST)
+  /**
+   * M48 F: After the first probe stay at the point and only raise M48_TAP_RAISE
+   * between slow taps, with a single report at the end. Add D to list the samples.
+   */
+  //#define M48_FAST_TAPS
+  #if ENABLED(M48_FAST_TAPS)
+    #define M48_TAP_RAISE 0.5 // (mm) Raise above the trigger point before the next tap
+  #endif
+#endif
 
 // Before deploy/stow pause for user confirmation
 //#define PAUSE_BEFORE_DEPLOY_STOW
@@ -1840,6 +1919,11 @@
     // as the filament moves. (Be sure to set FILAMENT_RUNOUT_DISTANCE_MM
     // large enough to avoid false positives.)
     //#define FILAMENT_MOTION_SENSOR
+
+    // Count the E steps of completed blocks in the Stepper ISR and compare the
+    // length fed since the last sensor event in the main loop, leaving no float
+    // math in the ISR. A motion sensor edge marks the length when it's polled.
+    //#define FILAMENT_RUNOUT_COUNT_STEPS
   #endif
 #endif
 
@@ -1885,7 +1969,9 @@
 //#define AUTO_BED_LEVELING_LINEAR
 //#define AUTO_BED_LEVELING_BILINEAR
 //#define AUTO_BED_LEVELING_UBL
-#define MESH_BED_LEVELING
+#if DISABLED(FF_UBL_MESH)
+  #define MESH_BED_LEVELING
+#endif
 
 /**
  * Normally G28 leaves leveling disabled on completion. Enable one of
@@ -1943,6 +2029,9 @@
     #define G26_XY_FEEDRATE         20    // (mm/s) Feedrate for G26 XY moves.
     #define G26_XY_FEEDRATE_TRAVEL 100    // (mm/s) Feedrate for G26 XY travel moves.
     #define G26_RETRACT_MULTIPLIER   1.0  // G26 Q (retraction) used by default between mesh test elements.
+    //#define G26_STREAMED                // Queue the whole pattern without waiting after each circle.
+                                          // Arcs print at G26_XY_FEEDRATE, and a full-mesh pattern goes
+                                          // to the next circle nearest the nozzle.
   #endif
 
 #endif
@@ -1996,6 +2085,14 @@
 
   //#define UBL_MESH_WIZARD         // Run several commands in a row to get a complete mesh
 
+  /**
+   * Keep the bilinear patch of each cell, refit when the mesh changes, so
+   * leveled moves don't fetch and fit the cell corners over again. A dense
+   * mesh then costs no more per segment than a 3x3 one. Uses 16 bytes of RAM
+   * per cell (1.3K for 10x10). Undefined mesh points count as 0.
+   */
+  //#define UBL_CELL_PLANES
+
 #elif ENABLED(MESH_BED_LEVELING)
 
   //===========================================================================
@@ -2003,11 +2100,63 @@
   //===========================================================================
 
   #define MESH_INSET 10          // Set Mesh bounds as an inset region of the bed
-  #define GRID_MAX_POINTS_X 3    // Don't use more than 7 points per axis, implementation limited.
+  #define GRID_MAX_POINTS_X 3    // Don't use more than 7 points per axis (15 with MESH_BICUBIC), implementation limited.
   #define GRID_MAX_POINTS_Y GRID_MAX_POINTS_X
 
+  /**
+   * Bicubic interpolation between mesh points, for a smooth correction over a
+   * finer mesh. The 16 coefficients of each cell are computed whenever the mesh
+   * changes, so a correction costs one polynomial evaluation. Uses 64 bytes of
+   * RAM per cell (12.5K for 15x15). Outside the mesh the edge value is held.
+   */
+  //#define MESH_BICUBIC
+
+  /**
+   * Level planner moves from a fixed-point raster of the mesh correction, with a
+   * point every MESH_Z_RASTER_MM, rebuilt whenever the mesh changes. Each move then
+   * costs an index and a lerp instead of a cell lookup and a mesh interpolation.
+   * Uses 2 bytes per point, e.g. 20K for a 200x200mm mesh at 2mm.
+   * On the Cortex-M4 each lerp is one SIMD multiply-add. D213 compares the lookups.
+   */
+  //#define MESH_Z_RASTER
+  #if ENABLED(MESH_Z_RASTER)
+    #define MESH_Z_RASTER_MM 2   // (mm) Raster spacing. Raise to save RAM.
+  #endif
+
+  /**
+   * Keep several meshes on the SD card, e.g. one per build plate, outside of the
+   * settings. Each slot file holds the mesh and its bicubic and raster tables as
+   * they are in RAM, so a slot loads without re-probing or refitting.
+   *   M420 W<slot> ["name"]  Save the current mesh (names need GCODE_QUOTED_STRINGS)
+   *   M420 L<slot> [S1]      Load a mesh (and enable leveling)
+   *   M420 L                 List the slots
+   */
+  //#define MESH_SLOTS
+  #if ENABLED(MESH_SLOTS)
+    #define MESH_SLOT_COUNT    4 // Slots 0 to MESH_SLOT_COUNT-1
+    #define MESH_SLOT_NAME_LEN 15
+  #endif
+
+  /**
+   * Re-probe only part of a valid mesh with 'G29 S1 L<x> R<x> F<y> B<y>', e.g. the
+   * footprint of the next print. The mesh points around the region are moved half
+   * as much as their re-probed neighbours, to blend in the new points.
+   */
+  //#define MESH_REGION_PROBING
+
   //#define MESH_G28_REST_ORIGIN // After homing all axes ('G28' or 'G28 XYZ') rest Z at Z_MIN_POS
 
+  /**
+   * Only split moves (at mesh lines, or into segments with SEGMENT_LEVELED_MOVES) where
+   * the Z correction along the move strays from a straight line by more than
+   * MESH_SPLIT_TOLERANCE. Moves over flat parts of the mesh are queued as single blocks.
+   * Useful with a fine mesh.
+   */
+  //#define MESH_ADAPTIVE_SPLIT
+  #if ENABLED(MESH_ADAPTIVE_SPLIT)
+    #define MESH_SPLIT_TOLERANCE 0.005 // (mm)
+  #endif
+
 #endif // BED_LEVELING
 
 /**
@@ -2982,6 +3131,17 @@
   //#define EXTUI_LOCAL_BEEPER // Enables use of local Beeper pin with external display
 #endif
 
+/**
+ * ExtUI Change Events (EXTENSIBLE_UI and TFT_LVGL_UI)
+ * Before each UI update flag the temperatures, positions, fans, etc. that
+ * changed, so the UI only redraws those. Used by the MKS LVGL UI.
+ */
+//#define EXTUI_CHANGE_EVENTS
+#if ENABLED(EXTUI_CHANGE_EVENTS)
+  #define EXTUI_CHANGE_TEMP     0.1   // (°C) Smallest temperature change to report
+  #define EXTUI_CHANGE_POSITION 0.01  // (mm) Smallest position change to report
+#endif
+
 //=============================================================================
 //=============================== Graphical TFTs ==============================
 //=============================================================================
@@ -3119,6 +3279,32 @@
 
 #if ENABLED(TFT_LVGL_UI)
   //#define MKS_WIFI_MODULE  // MKS WiFi module
+
+  /**
+   * LVGL Performance Mode (STM32F4 FSMC displays)
+   * Two larger LVGL draw buffers. One is rendered while DMA flushes the other in the
+   * background, and the LVGL tasks run less often while a print is low on planned moves.
+   */
+  //#define LVGL_PERFORMANCE_MODE
+  #if ENABLED(LVGL_PERFORMANCE_MODE)
+    #define LVGL_VDB_LINES          20  // (8..40) Display rows in each of the two draw buffers
+    #define LVGL_MIN_PLANNED_MOVES   4  // Fewer planned moves than this holds the LVGL tasks...
+    #define LVGL_HOLD_MAX_MS       500  // ...for up to this many ms (ms)
+  #endif
+
+  /**
+   * LVGL Memory Pool
+   * Serve LVGL's small allocations (styles, labels, event data) from fixed-size
+   * blocks instead of its first-fit heap, so a long session doesn't fragment the
+   * heap. Larger requests, and any that find their size full, use the heap.
+   * Takes the sum of SIZES * BLOCKS bytes of RAM. With MARLIN_DEV_MODE D211
+   * reports the pools, heap fragmentation and allocation times.
+   */
+  //#define LVGL_MEM_POOL
+  #if ENABLED(LVGL_MEM_POOL)
+    #define LVGL_MEM_POOL_SIZES  { 16, 32, 64, 96 }  // (bytes) Ascending multiples of 8
+    #define LVGL_MEM_POOL_BLOCKS { 48, 48, 32, 16 }  // Blocks of each size
+  #endif
 #endif
 
 /**
@@ -3154,6 +3340,16 @@
 
   //#define TOUCH_IDLE_SLEEP 300 // (s) Turn off the TFT backlight if set (5mn)
 
+  /**
+   * Sample the XPT2046 from the temperature ISR while PENIRQ (TOUCH_INT_PIN)
+   * is low, one X/Y pair per tick, and post the median of each set. The UI
+   * only reads the latest point and never waits on the SPI bus.
+   */
+  //#define TOUCH_BACKGROUND_SAMPLING
+  #if ENABLED(TOUCH_BACKGROUND_SAMPLING)
+    #define TOUCH_BACKGROUND_SAMPLES 7  // Samples per point, odd (3..15)
+  #endif
+
   #define TOUCH_SCREEN_CALIBRATION
   //Invoke touchscreen calibration by default
   #define TOUCH_CALIBRATION_X    17114
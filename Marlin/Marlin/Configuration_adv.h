@@ -50,6 +50,58 @@
  */
 #define THERMOCOUPLE_MAX_ERRORS 15
 
+/**
+ * Convert bed and chamber thermistor readings with a table resampled at
+ * compile time to a uniform raw step, instead of searching the thermistor
+ * table for every sample. Costs 2 * (2^THERMISTOR_LUT_BITS + 1) bytes of
+ * flash per sensor.
+ */
+//#define THERMISTOR_DIRECT_LOOKUP
+#if ENABLED(THERMISTOR_DIRECT_LOOKUP)
+  #define THERMISTOR_LUT_BITS 10  // (6..10) log2 of the number of entries. 10 matches the tables exactly.
+#endif
+
+/**
+ * ADC Scan DMA (STM32F4)
+ * ADC1 continuously scans all enabled analog pins and DMA2 Stream4 keeps the last
+ * ADC_SCAN_DMA_SCANS results per pin in a circular buffer. The temperature ISR only
+ * averages buffered values instead of running a conversion for every reading, and
+ * Marlin's own oversampling is disabled. Not compatible with STEP_DMA.
+ */
+//#define ADC_SCAN_DMA
+#if ENABLED(ADC_SCAN_DMA)
+  #define ADC_SCAN_DMA_SCANS 16   // (1..64) Scans averaged per reading
+#endif
+
+/**
+ * CCM RAM Placement (STM32F4 with CCM)
+ * Put the planner block buffer, the Stepper ISR state and the CPU-only TFT queue and glyph
+ * cache in the 64K core coupled RAM, so the ISR hot path never waits on the bus matrix
+ * while DMA transfers to the display, SD card or ADC are using SRAM. The linker script must
+ * have a .ccmram section (_siccmram, _sccmram, _eccmram), as the FF_F407ZG variant does.
+ * DMA buffers always stay in SRAM because no DMA controller can reach CCM RAM.
+ */
+//#define CCMRAM_PLACEMENT
+
+/**
+ * ISR Code in RAM (STM32F4/F7)
+ * Run the Stepper ISR and its pulse and block phases, the Temperature ISR and the
+ * endstop checks from SRAM, so their timing doesn't depend on flash wait states or on
+ * what the UI and SD code left in the ART cache. The functions marked HOT_ISR_FUNC go
+ * into .RamFunc, which the linker script must copy with .data (as FF_F407ZG does).
+ * The build lists the functions placed in RAM and their total size.
+ */
+//#define ISR_CODE_IN_RAM
+
+/**
+ * Deferred Temperature Sensors (STM32)
+ * The Temperature ISR only runs the heater and fan PWM, babystepping, endstop polling
+ * and the planner tick. Sensor sampling, the ADC keypad and the LCD buttons run from a
+ * lowest priority interrupt (PendSV) that the ISR pends on every tick.
+ * With MARLIN_DEV_MODE, D203 reports the longest ISR and sensor task, preemption included.
+ */
+//#define DEFERRED_TEMP_SENSORS
+
 //
 // Custom Thermistor 1000 parameters
 //
@@ -154,6 +206,24 @@
 //#define MAX31865_WIRE_OHMS_0              0.95f // For 2-wire, set the wire resistances for more accurate readings.
 //#define MAX31865_WIRE_OHMS_1              0.0f
 
+/**
+ * ADS1118 Conversion Scheduler — for the FlashForge ADS1118 thermocouple ADC.
+ *
+ * By default the cold junction and both thermocouples take turns at 64 SPS.
+ * With this option the slow-moving cold junction is read once per interval and
+ * the active hotend's channel gets most of the conversions. While a hotend heats
+ * up or is tuned, the data rate goes up with a filter against the extra noise.
+ * The active hotend's reading updates several times as often for the same SPI use.
+ */
+//#define ADS1118_SCHEDULER
+#if ENABLED(ADS1118_SCHEDULER)
+  #define ADS1118_CJ_INTERVAL  1000   // (ms) Cold junction sample interval
+  #define ADS1118_ACTIVE_RATIO    3   // Active channel conversions per idle channel conversion
+  #define ADS1118_FAST_SPS      250   // Data rate while heating or tuning: 128, 250, 475 or 860
+  #define ADS1118_FAST_WINDOW    10   // (°C) Sample fast while a hotend is this far below its target
+  #define ADS1118_FAST_FILTER     2   // Fast rate filter. Each sample has a weight of 1/2^N.
+#endif
+
 /**
  * Hephestos 2 24V heated bed upgrade kit.
  * https://store.bq.com/en/heated-bed-kit-hephestos2
@@ -397,9 +467,75 @@
       #define DEFAULT_Kf 10                              // A constant value added to the PID-tuner
       #define PID_FAN_SCALING_MIN_SPEED 10               // Minimum fan speed at which to enable PID_FAN_SCALING
     #endif
+    //#define PID_FAN_SCALING_AUTOTUNE                   // M303 also learns Kf, tuning again with the part fan at full speed
   #endif
 #endif
 
+/**
+ * Parallel PID Autotune
+ *
+ * Add 'M303 A' to tune all PID hotends and the PID bed at the same time.
+ * It runs in the background from the temperature task, so M303 A returns
+ * right away and reports each cycle as it goes. When every heater has
+ * finished the results are applied and saved together (EEPROM_SETTINGS).
+ * Changing the target of a heater being tuned (e.g., M104 S0) stops it.
+ */
+#if EITHER(PIDTEMP, PIDTEMPBED)
+  //#define PID_AUTOTUNE_PARALLEL
+#endif
+
+/**
+ * Preheat Scheduler
+ *
+ * 'M104 S<temp> D<seconds>' has the hotend reach its target D seconds from now,
+ * so it can come up to temperature during homing and probing instead of sitting
+ * hot and oozing. Heating starts when the predicted heat-up time, plus a margin,
+ * is left. MPC predicts with its model. Otherwise the rate of the last scheduled
+ * heat-up is used. A later M104/M109 S or M109 R replaces the schedule.
+ */
+//#define PREHEAT_SCHEDULER
+#if ENABLED(PREHEAT_SCHEDULER)
+  #define PREHEAT_SCHEDULER_MARGIN 10   // (s) Extra lead time over the prediction
+  #if DISABLED(MPCTEMP)
+    #define PREHEAT_SCHEDULER_RATE 2.0  // (°C/s) Heat-up rate until one has been measured
+  #endif
+#endif
+
+/**
+ * Bed Cooldown
+ *
+ * 'M194' at the end of a job turns the bed off, parks the head and runs the
+ * part cooling and chamber fans until the bed is down to the temperature where
+ * the parts come off. The bed's cooling curve is fitted as it goes to report
+ * the time left. When done the fans are restored and the host and display are
+ * told the parts are ready. A new bed target cancels the cooldown.
+ */
+//#define BED_COOLDOWN
+#if ENABLED(BED_COOLDOWN)
+  #define BED_COOLDOWN_RELEASE    35    // (°C) Default part release temperature
+  #define BED_COOLDOWN_FAN_SPEED 255    // Fan speed while cooling down (0-255)
+  #define BED_COOLDOWN_AMBIENT    25    // (°C) Room temperature, used without a chamber sensor
+#endif
+
+/**
+ * Heater Power Budget
+ *
+ * Heat the bed and hotends at the same time when the PSU can't run them all at
+ * full power. Each heater's soft PWM on-time gets its own part of the PWM cycle,
+ * placed so the heaters that are on together never add up to more than
+ * POWER_BUDGET_WATTS. Heaters holding their temperature are served first, then
+ * the one with the longest heat-up left, estimated from the rates below.
+ * A heater that is held back has its heating watch restarted.
+ */
+//#define HEATER_POWER_BUDGET
+#if ENABLED(HEATER_POWER_BUDGET)
+  #define POWER_BUDGET_WATTS        240         // (W) Heater power the PSU can supply
+  #define POWER_BUDGET_HOTEND_WATTS { 40, 40 }  // (W) Each hotend heater at full power
+  #define POWER_BUDGET_BED_WATTS    200         // (W) Bed heater at full power
+  #define POWER_BUDGET_HOTEND_RATE  3.0         // (°C/s) Hotend heat-up rate at full power
+  #define POWER_BUDGET_BED_RATE     0.5         // (°C/s) Bed heat-up rate at full power
+#endif
+
 /**
  * Automatic Temperature Mode
  *
@@ -481,6 +617,22 @@
   #define HOTEND_IDLE_BED_TARGET      0     // (°C) Safe temperature for the bed after timeout
 #endif
 
+/**
+ * Hotend Standby Lookahead
+ * Read ahead in the SD print file for the next T command of each idle nozzle.
+ * A nozzle that won't be needed for a while drops to a standby temperature,
+ * and reheats at the modelled heating rate just in time for its next use,
+ * so tool-changes don't wait in M109 and idle nozzles don't ooze.
+ */
+//#define HOTEND_STANDBY_LOOKAHEAD
+#if ENABLED(HOTEND_STANDBY_LOOKAHEAD)
+  #define HOTEND_STANDBY_TEMP       150     // (°C) Temperature of a nozzle waiting for its next use
+  #define HOTEND_STANDBY_HEAT_RATE  1.5     // (°C/s) Heating rate used to time the reheat
+  #define HOTEND_STANDBY_MARGIN      15     // (seconds) Reheat this much sooner than modelled
+  #define HOTEND_STANDBY_MIN_IDLE    60     // (seconds) Keep a nozzle hot if it's needed again sooner
+  #define HOTEND_STANDBY_SCAN     32768     // (bytes) How far to read ahead for the next T command
+#endif
+
 // @section temperature
 
 // Calibration for AD595 / AD8495 sensor to adjust temperature measurements.
@@ -577,6 +729,18 @@
   #endif
 #endif
 
+/**
+ * Heater Hardware PWM (STM32)
+ * Drive each hotend, bed and chamber heater pin that has a timer channel from the timer,
+ * with the power copied to its compare register on every Temperature ISR tick. Heaters
+ * without a timer channel keep using soft PWM. A timer shared with a fan runs at the
+ * frequency set last. Leave FAN_SOFT_PWM disabled for hardware fan PWM as well.
+ */
+//#define HEATER_HW_PWM
+#if ENABLED(HEATER_HW_PWM)
+  #define HEATER_HW_PWM_FREQUENCY 16    // (Hz) Keep low for SSRs and slow MOSFET drivers
+#endif
+
 /**
  * Use one of the PWM fans as a redundant part-cooling fan
  */
@@ -838,6 +1002,20 @@
 #define HOMING_BUMP_MM      { 5, 5, 2 }       // (mm) Backoff from endstops after first bump
 #define HOMING_BUMP_DIVISOR { 4, 4, 4 }       // Re-Bump Speed Divisor (Divides the Homing Feedrate)
 
+/**
+ * Skip the slow re-bump of an axis once its fast and slow endstop triggers have
+ * kept the same distance (within HOMING_BUMP_SKIP_TOLERANCE) for HOMING_BUMP_SKIP_COUNT
+ * homings in a row. The fast trigger and the steps taken after it then give the
+ * position. The re-bump is still done every HOMING_BUMP_SKIP_CHECK homings.
+ * Use QUICK_HOME to also approach X and Y together.
+ */
+//#define HOMING_BUMP_SKIP
+#if ENABLED(HOMING_BUMP_SKIP)
+  #define HOMING_BUMP_SKIP_TOLERANCE 0.02 // (mm)
+  #define HOMING_BUMP_SKIP_COUNT      3
+  #define HOMING_BUMP_SKIP_CHECK     10
+#endif
+
 //#define HOMING_BACKOFF_POST_MM { 10, 10, 0 }  // (mm) Backoff from endstops after homing
 
 //#define QUICK_HOME                          // If G28 contains XY do a diagonal move first
@@ -1015,7 +1193,12 @@
 #define AXIS_RELATIVE_MODES { false, false, false, false }
 
 // Add a Duplicate option for well-separated conjoined nozzles
-//#define MULTI_NOZZLE_DUPLICATION
+// The two-nozzle FlashForge heads print two copies of a part with 'M605 S2', one nozzle
+// spacing (34mm) apart, so each part must be narrower than that. The range of X and Y
+// shrinks to keep the second nozzle over the bed and it follows the T0 temperature.
+#if ANY(FF_INVENTOR_MACHINE, FF_DREAMER_MACHINE)
+  #define MULTI_NOZZLE_DUPLICATION
+#endif
 
 // By default pololu step drivers require an active high signal. However, some high power drivers require an active low signal as step.
 #define INVERT_X_STEP_PIN false
@@ -1052,6 +1235,9 @@
 #define SLOWDOWN
 #if ENABLED(SLOWDOWN)
   #define SLOWDOWN_DIVISOR 2
+  // Slow down by the time the queued moves will take instead of by their count,
+  // smoothly down to half speed as it falls below this horizon. Ignores M205 B.
+  //#define SLOWDOWN_HORIZON_MS 150 // (ms)
 #endif
 
 /**
@@ -1131,6 +1317,11 @@
   #define CALIBRATION_FEEDRATE_FAST           1200    // mm/min
   #define CALIBRATION_FEEDRATE_TRAVEL         3000    // mm/min
 
+  // Measure each edge with one continuous move at the feedrate above instead
+  // of a series of CALIBRATION_MEASUREMENT_RESOLUTION steps, each ending in a
+  // full stop. The edge position is read back from the steppers.
+  //#define CALIBRATION_CONTINUOUS_SCAN
+
   // The following parameters refer to the conical section of the nozzle tip.
   #define CALIBRATION_NOZZLE_TIP_HEIGHT          1.0  // mm
   #define CALIBRATION_NOZZLE_OUTER_DIAMETER      2.0  // mm
@@ -1177,6 +1368,119 @@
  */
 //#define ADAPTIVE_STEP_SMOOTHING
 
+/**
+ * Adaptive Step Batching
+ * Replace the fixed 1/2/4/.../128 multi-stepping table with any count of steps per ISR,
+ * chosen from the Stepper ISR load measured with the CPU cycle counter (DWT). When the
+ * pulse-only ISRs can keep up, the steps of a batch are spread evenly by the step timer
+ * instead of being issued back-to-back, so only the acc/deceleration math is batched.
+ * Falls back to built-in cycle estimates on CPUs without a cycle counter. Requires a 32-bit MCU.
+ */
+//#define ADAPTIVE_STEP_BATCHING
+#if ENABLED(ADAPTIVE_STEP_BATCHING)
+  #define STEP_BATCHING_MAX_LOAD 60   // (%) Share of the CPU the Stepper ISR may use
+#endif
+
+/**
+ * Motion Profiles
+ * Switch print acceleration and junction deviation by the feature the slicer is printing,
+ * read from the ";TYPE:" comments PrusaSlicer, SuperSlicer and Cura put at each section.
+ * Infill and support can then print at a much higher acceleration than visible perimeters
+ * without the slicer adding M204 to the G-code. An unlisted type goes back to the M204/M205
+ * settings. Use M213 to select, change or report the profiles.
+ */
+//#define MOTION_PROFILES
+#if ENABLED(MOTION_PROFILES)
+  #define MOTION_PROFILE_TAGS  { "External perimeter", "Perimeter", "Internal infill", "Solid infill", "Support material" } // Text after ";TYPE:"
+  #define MOTION_PROFILE_ACCEL { 1000, 1500, 4000, 2500, 4000 } // (mm/s^2) Print acceleration of each profile
+  #define MOTION_PROFILE_JD    { 0.013, 0.013, 0.05, 0.02, 0.05 } // (mm) Junction deviation of each profile. Not used with CLASSIC_JERK.
+#endif
+
+/**
+ * Input Shaping -- EXPERIMENTAL
+ *
+ * Zero Vibration (ZV), ZV-Derivative (ZVD) and Modified ZV (MZV) input shaping for X and/or Y.
+ * Each Bresenham step on a shaped axis is split into 2 or 3 impulses that the Stepper ISR
+ * plays out after short delays, cancelling the frame's ringing at the given frequency.
+ * Find the frequency by printing a ringing tower and counting the ripples.
+ *
+ * Tune with 'M593 [X] [Y] F<frequency> D<damping> T<type>'. Use F0 to disable.
+ *   Types: 0 = ZV (shortest delay), 1 = ZVD (more robust), 2 = MZV (robust and short)
+ */
+//#define INPUT_SHAPING_X
+//#define INPUT_SHAPING_Y
+#if EITHER(INPUT_SHAPING_X, INPUT_SHAPING_Y)
+  #if ENABLED(INPUT_SHAPING_X)
+    #define SHAPING_FREQ_X  40          // (Hz) The default dominant resonant frequency on the X axis.
+    #define SHAPING_ZETA_X  0.15f       // Damping ratio of the X axis (range: 0.0 = no damping to 0.5).
+    #define SHAPING_TYPE_X  0           // 0:ZV 1:ZVD 2:MZV
+  #endif
+  #if ENABLED(INPUT_SHAPING_Y)
+    #define SHAPING_FREQ_Y  40          // (Hz) The default dominant resonant frequency on the Y axis.
+    #define SHAPING_ZETA_Y  0.15f       // Damping ratio of the Y axis (range: 0.0 = no damping to 0.5).
+    #define SHAPING_TYPE_Y  0           // 0:ZV 1:ZVD 2:MZV
+  #endif
+  //#define SHAPING_MIN_FREQ  20        // By default the minimum of the shaping frequencies. Override to affect SRAM usage.
+  //#define SHAPING_MAX_STEPRATE 10000  // By default the maximum step rate of a shaped axis. Override to affect SRAM usage.
+#endif
+
+/**
+ * Step DMA (STM32F4)
+ * Multi-step pulse phases fill a burst of GPIO BSRR words that TIM1 compare events copy
+ * to the step ports with DMA2, instead of the ISR busy-waiting out each pulse's high and
+ * low time. Uses TIM1 and DMA2 Streams 1, 2, 4 and 6, and needs the step pins to be on no
+ * more than 4 GPIO ports. Not for dual-stepper axes, IDEX, mixing or multiplexed extruders.
+ */
+//#define STEP_DMA
+
+/**
+ * Stepper ISR Variants
+ * Build a copy of the pulse phase step loop for each extruder, and for arc, direct
+ * stepping page or Step DMA blocks when those are enabled, and pick one as each block
+ * begins. Each copy has the active extruder's step pin and the block kind fixed, so
+ * the per-step tests for them are left out. Costs flash (and RAM on STM32, which runs
+ * the ISR from RAM) for every copy. Check the cycles with ISR_PROFILER and D206.
+ */
+//#define STEPPER_ISR_VARIANTS
+
+/**
+ * Block Execution Table
+ * When a block's trapezoid is finalized the planner also stores its rates, ramp step
+ * counts and (with S_CURVE_ACCELERATION) Bézier coefficients in a compact table that
+ * the Stepper ISR reads at block start, instead of deriving them from the larger block_t.
+ * Reduces block-start latency with many small segments. Requires a 32-bit MCU.
+ */
+//#define BLOCK_EXEC_TABLE
+
+/**
+ * Fixed-Point Planner Math
+ * Compute block trapezoids with integer math on whole steps and replace the square
+ * roots and divisions of the junction and recalculate passes with a reciprocal
+ * square root lookup table (relative error < 6e-6). Ramp lengths may differ from
+ * the float path by a step. With MARLIN_DEV_MODE, D200 S<blocks> compares the
+ * blocks per second of both paths. Requires a 32-bit MCU.
+ */
+//#define PLANNER_FIXED_POINT
+
+/**
+ * Lock-free Block Handoff
+ * The planner and the Stepper ISR pass blocks through the buffer as a single-producer,
+ * single-consumer ring with acquire/release ordering, and the planner no longer masks
+ * the Stepper interrupt to queue a block. Requires an MCU with atomic read-modify-write
+ * instructions (e.g., ARM Cortex-M3/M4/M7).
+ */
+//#define LOCKFREE_BLOCK_HANDOFF
+
+/**
+ * Fused Position Transform
+ * Combine skew correction and planar bed leveling into one affine map, and its
+ * inverse, computed whenever the skew factors or the bed level matrix change.
+ * Each move then takes a single 3x3 transform plus any mesh correction and
+ * retract offsets. Positions near the edges of the skew range use the
+ * separate transforms. Requires SKEW_CORRECTION or a planar bed leveling.
+ */
+//#define FUSED_POSITION_TRANSFORM
+
 /**
  * Custom Microstepping
  * Override as-needed for your setup. Up to 3 MS pins are supported.
@@ -1244,6 +1548,31 @@
   //#define DIGIPOT_I2C_ADDRESS_B 0x2D  // Unshifted slave address for second DIGIPOT
 #endif
 
+/**
+ * Queue the writes to DIGIPOT_MCP4018 and PCA9632_SOFT_I2C and bit-bang them from the
+ * Temperature ISR, half a clock per tick, so M907 and LED color changes return at once.
+ * Writes made before the ISR starts are sent right away. Replaces SlowSoftI2CMaster / SlowSoftWire.
+ */
+//#define SOFT_I2C_ASYNC
+#if ENABLED(SOFT_I2C_ASYNC)
+  #define SOFT_I2C_ASYNC_QUEUE 16     // Writes waiting to be sent. A newer write to the same register replaces one.
+#endif
+
+/**
+ * Scale the DIGIPOT_MCP4018 currents with the queued moves. A motor gets DIGIPOT_BOOST_PERCENT
+ * of its current (M907) while a move ahead accelerates its axis harder than DIGIPOT_BOOST_ACCEL,
+ * DIGIPOT_RUN_PERCENT for other moves, and DIGIPOT_HOLD_PERCENT once it stood still for
+ * DIGIPOT_HOLD_DELAY. Requires SOFT_I2C_ASYNC, so the updates don't hold up the planner.
+ */
+//#define DIGIPOT_DYNAMIC_CURRENT
+#if ENABLED(DIGIPOT_DYNAMIC_CURRENT)
+  #define DIGIPOT_BOOST_PERCENT 100   // Up to 150, never over DIGIPOT_A4988_MAX_CURRENT
+  #define DIGIPOT_RUN_PERCENT    85
+  #define DIGIPOT_HOLD_PERCENT   50
+  #define DIGIPOT_BOOST_ACCEL  1500   // (mm/s²) Axis acceleration that gets the boost
+  #define DIGIPOT_HOLD_DELAY   1000   // (ms) Standstill time before the hold current
+#endif
+
 //===========================================================================
 //=============================Additional Features===========================
 //===========================================================================
@@ -1347,6 +1676,19 @@
   // Apply a timeout to low-priority status messages
   //#define STATUS_MESSAGE_TIMEOUT_SEC 30 // (seconds)
 
+  /**
+   * Give motion priority over screen redraws. While printing, the next
+   * frame is held if fewer than UI_MIN_PLANNED_MOVES remain in the planner,
+   * or if the last frame cost more than UI_FRAME_BUDGET_MS and more than
+   * half of the time left in the queue. Set at runtime with M257.
+   */
+  //#define UI_MOTION_PRIORITY
+  #if ENABLED(UI_MOTION_PRIORITY)
+    #define UI_MIN_PLANNED_MOVES    4   // Hold frames while fewer moves are planned
+    #define UI_FRAME_BUDGET_MS     10   // (ms) Frames costing more need queue time to cover them
+    #define UI_FRAME_HOLD_MAX_MS 2000   // (ms) Draw a held frame anyway after this time
+  #endif
+
   // On the Info Screen, display XY with one decimal place when possible
   //#define LCD_DECIMAL_SMALL_XY
 
@@ -1422,6 +1764,16 @@
    */
   //#define SD_SPI_SPEED SPI_HALF_SPEED
 
+  /**
+   * Move SD blocks with the DMA streams of the card's hardware SPI (STM32F4)
+   * and run it at up to SD_SPI_DMA_CLOCK once the card is initialized.
+   * Falls back to polled transfers if the streams are already in use.
+   */
+  //#define SD_SPI_DMA
+  #if ENABLED(SD_SPI_DMA)
+    #define SD_SPI_DMA_CLOCK 25000000   // (Hz) Full speed limit. 25MHz is the SD default-speed maximum.
+  #endif
+
   // The standard SD detect circuit reads LOW when media is inserted and HIGH when empty.
   // Enable this option and set to HIGH if your SD cards are incorrectly detected.
   #define SD_DETECT_STATE LOW
@@ -1430,6 +1782,34 @@
   //#define SDCARD_READONLY                 // Read-only SD card (to save over 2K of flash)
 
   //#define GCODE_REPEAT_MARKERS            // Enable G-code M808 to set repeat markers and do looping
+  #if ENABLED(GCODE_REPEAT_MARKERS)
+    /**
+     * Keep the commands of the innermost M808 loop in RAM as they are read,
+     * already tokenized with GCODE_TOKEN_QUEUE, and replay them on the later
+     * passes instead of seeking back and reading the file again. A loop body
+     * that doesn't fit, or that has M25 or a canceled object seek, is read
+     * from the file every pass as usual.
+     */
+    //#define REPEAT_CACHE
+    #if ENABLED(REPEAT_CACHE)
+      #define REPEAT_CACHE_SIZE 4096        // (bytes) Around 30 bytes per line, 45 per token
+    #endif
+  #endif
+
+  /**
+   * Print Job Queue
+   * Add files with 'M36 /path/file.gco' and start with 'M36 S'. Each one starts
+   * as soon as the one before it is done, for a printer that clears its own bed.
+   * Near the end of a print the head of the next file is read to check it and
+   * to find its first hotend and bed temperatures.
+   */
+  //#define SD_JOB_QUEUE
+  #if ENABLED(SD_JOB_QUEUE)
+    #define SD_JOB_QUEUE_SIZE      8        // Files that can wait in the queue
+    #define SD_JOB_QUEUE_AHEAD 65536        // (bytes) Read the next file when this much of the print is left
+    #define SD_JOB_QUEUE_HEAD   8192        // (bytes) Most of the next file to read for its temperatures
+    #define SD_JOB_QUEUE_PREHEAT            // Heat to the next file's temperatures before its start G-code
+  #endif
 
   #define SD_PROCEDURE_DEPTH 1              // Increase if you need more nested M32 calls
 
@@ -1481,6 +1861,26 @@
     // especially with "vase mode" printing. Set too high and vases cannot be continued.
     #define POWER_LOSS_MIN_Z_CHANGE 0.05 // (mm) Minimum Z change before saving power-loss data
 
+    // Keep the full recovery data only when it changes, and save the position,
+    // temperatures and fans as small entries in a ring at the end of the file.
+    // Avoids rewriting the file on every save, for frequent saves while printing.
+    //#define POWER_LOSS_JOURNAL
+    #if ENABLED(POWER_LOSS_JOURNAL)
+      #define POWER_LOSS_JOURNAL_SIZE 32  // Entries in the ring
+    #endif
+
+    // Save the recovery data to the STM32F4/F7 backup SRAM instead of the SD card,
+    // after every move with E, so there are no SD writes while printing. It's written
+    // to the recovery file on the next boot, if it was kept by a battery on VBAT or the
+    // reset wasn't a power cut, and on an outage signaled by POWER_LOSS_PIN.
+    // (FlashForge boards can use EDETECT_PIN.) Not compatible with SRAM_EEPROM_EMULATION.
+    //#define POWER_LOSS_BACKUP_SRAM
+
+    // Resume sooner: heat the bed and hotends together, move once the nozzle has softened
+    // the print, skip homing XY if still trusted, and open and seek the file while heating.
+    // The hotends prime before the wait for the bed. Use HEATER_POWER_BUDGET for a small PSU.
+    //#define POWER_LOSS_FAST_RESUME
+
     // Enable if Z homing is needed for proper recovery. 99.9% of the time this should be disabled!
     //#define POWER_LOSS_RECOVER_ZHOME
     #if ENABLED(POWER_LOSS_RECOVER_ZHOME)
@@ -1526,6 +1926,58 @@
                                       // Note: Only affects SCROLL_LONG_FILENAMES with SDSORT_CACHE_NAMES but not SDSORT_DYNAMIC_RAM.
   #endif
 
+  /**
+   * Directory Index
+   * Remember where each item of the current folder starts in the directory,
+   * so the file browser and sorting read an item directly instead of scanning
+   * the folder from the top. The folder is indexed once, when it's entered,
+   * and again after a file is created or deleted. Uses 2 bytes per item.
+   */
+  //#define SD_DIR_INDEX
+  #if ENABLED(SD_DIR_INDEX)
+    #define SD_DIR_INDEX_SIZE 256     // Items to index. Later items are found by scanning.
+  #endif
+
+  /**
+   * Print Job Info
+   * Read the estimated time, filament used, layer count and thumbnail location
+   * that Cura, PrusaSlicer and OrcaSlicer write into G-code comments. The start
+   * and end of the file are scanned a block at a time in the background once
+   * the file is opened, and results are kept for recently opened files.
+   * With SHOW_REMAINING_TIME the slicer's estimate is used for the remaining time.
+   */
+  //#define SD_JOB_INFO
+  #if ENABLED(SD_JOB_INFO)
+    #define SD_JOB_INFO_HEAD  4096    // Bytes to scan at the start of the file
+    #define SD_JOB_INFO_TAIL 32768    // Bytes to scan at the end of the file
+    #define SD_JOB_INFO_CACHE    4    // Files to remember
+  #endif
+
+  /**
+   * Print Time Estimate
+   * For files without M73, time the G0/G1 moves in one block of each section
+   * of the print file in the background, then correct that by the print's own
+   * measured time. The result replaces the byte position for the progress and
+   * the SHOW_REMAINING_TIME estimate, and M27 reports it.
+   */
+  //#define PRINT_TIME_ESTIMATE
+  #if ENABLED(PRINT_TIME_ESTIMATE)
+    #define PRINT_TIME_SECTIONS 32    // Sections of the file to sample (4 bytes RAM each)
+  #endif
+
+  /**
+   * EEPROM Change Log (STM32 SDCARD_EEPROM_EMULATION)
+   * Append only the changed parts of the settings to a log file next to
+   * eeprom.dat instead of rewriting it on every M500. Each record has a CRC
+   * and sequence number so a write cut short by a reset is ignored. When the
+   * log is full, eeprom.dat is rewritten and the log is emptied.
+   */
+  //#define SDCARD_EEPROM_LOG
+  #if ENABLED(SDCARD_EEPROM_LOG)
+    #define SDCARD_EEPROM_LOG_CHUNK    16 // Bytes of settings per record (power of 2)
+    #define SDCARD_EEPROM_LOG_SIZE  16384 // Log size (bytes) that triggers a rewrite
+  #endif
+
   // Allow international symbols in long filenames. To display correctly, the
   // LCD's font must contain the characters. Check your selected LCD language.
   #define UTF_FILENAME_SUPPORT
@@ -1614,10 +2066,32 @@
   #define NO_CONFIGURATION_EMBEDDING_WARNING
   // Add an optimized binary file transfer mode, initiated with 'M28 B1'
   //#define BINARY_FILE_TRANSFER
+  #if ENABLED(FF_WIFI_SERIAL)
+    #define BINARY_FILE_TRANSFER  // Framed, checksummed uploads over WiFi
+  #endif
 
   #if ENABLED(BINARY_FILE_TRANSFER)
     // Include extra facilities (e.g., 'M20 F') supporting firmware upload via BINARY_FILE_TRANSFER
     //#define CUSTOM_FIRMWARE_UPLOAD
+
+    // Stream delta-coded moves from the host straight into the command queue,
+    // one acknowledgement per packet instead of per line. Requires GCODE_TOKEN_QUEUE.
+    //#define BINARY_MOTION_STREAM
+
+    // Queue a batch of G-code lines, sent in checksummed packets with a CRC
+    // over the whole batch, at once and with one acknowledgement. Commands
+    // in the batch send no "ok". A batch with any bad line queues nothing.
+    //#define BINARY_COMMAND_BATCH
+    #if ENABLED(BINARY_COMMAND_BATCH)
+      #define BINARY_COMMAND_BATCH_SIZE 512   // Bytes of G-code in one batch
+    #endif
+
+    // Start printing an upload begun with 'M28 B1 P<KB>' once that much has arrived,
+    // reading the file as it grows. 'P' alone uses SD_UPLOAD_PRINT_START_KB.
+    //#define SD_PRINT_WHILE_UPLOADING
+    #if ENABLED(SD_PRINT_WHILE_UPLOADING)
+      #define SD_UPLOAD_PRINT_START_KB 64
+    #endif
   #endif
 
   /**
@@ -1634,6 +2108,142 @@
   // Enable if SD detect is rendered useless (e.g., by using an SD extender)
   //#define NO_SD_DETECT
 
+  /**
+   * SDIO Read-Ahead (STM32)
+   * Read the onboard SDIO card in multi-block (CMD18) transfers into two
+   * buffers, one filling by DMA while the other is read. A file being
+   * printed then rarely waits on the card at a block boundary.
+   * Uses 2 x SDIO_READ_AHEAD_BLOCKS x 512 bytes of RAM.
+   */
+  //#define SDIO_READ_AHEAD
+  #if ENABLED(SDIO_READ_AHEAD)
+    #define SDIO_READ_AHEAD_BLOCKS 16 // Blocks per transfer (8-32)
+  #endif
+
+  /**
+   * SDIO High Speed (STM32F4)
+   * Switch cards that support it to high speed mode (CMD6) and run the
+   * bus at the fastest clock that reads back cleanly, up to 48MHz.
+   * CRC errors and timeouts step the clock down for the retry, but never
+   * below SDIO_CLOCK. The chosen clock is reported when the card mounts.
+   */
+  //#define SDIO_HIGH_SPEED
+
+  /**
+   * Cluster Extent Cache
+   * When a file is opened for printing, read its FAT cluster chain once and
+   * keep it as a list of contiguous runs. Reads and M26 seeks then find each
+   * cluster without reading FAT blocks between data blocks.
+   * Files too fragmented to fit the list are read through the FAT as usual.
+   */
+  //#define SD_EXTENT_CACHE
+  #if ENABLED(SD_EXTENT_CACHE)
+    #define SD_EXTENT_CACHE_SIZE 32   // Runs of contiguous clusters (8 bytes each)
+  #endif
+
+  /**
+   * Flash Job Cache
+   * Copy the whole file to the SPI flash chip (HAS_SPI_FLASH) when a print starts,
+   * check the copy, and read the print from flash. A slow or failing card can then
+   * neither stall nor end the job. Files too big for the cache print from the card.
+   * The copy takes several seconds per megabyte, mostly to erase the flash.
+   */
+  //#define SD_FLASH_JOB_CACHE
+  #if ENABLED(SD_FLASH_JOB_CACHE)
+    #define SD_FLASH_CACHE_ADDR 0x800000                                // Start of the cache, on a 64K boundary. Above MKS UI assets.
+    #define SD_FLASH_CACHE_SIZE (SPI_FLASH_SIZE - SD_FLASH_CACHE_ADDR)  // Bytes for the cached file
+  #endif
+
+  /**
+   * Stage to SDIO
+   * For boards with an internal SDIO card besides the SPI card (e.g. FF_MOTHERBOARD).
+   * When a print starts, copy the file to the SDIO card in the background and print
+   * the copy, starting once SD_STAGE_START_KB has been copied. If the copy fails the
+   * print reads on from the SPI card. Requires SD_PRINT_WHILE_UPLOADING.
+   */
+  //#define SD_STAGING
+  #if ENABLED(SD_STAGING)
+    #define SD_STAGE_FILENAME "STAGED.GCO"  // The copy, in the root of the SDIO card
+    #define SD_STAGE_START_KB   64          // Copied before the print starts
+    #define SD_STAGE_BLOCKS      8          // 512-byte blocks copied per run
+    #define SD_STAGE_INTERVAL   20          // (ms) Time between runs
+  #endif
+
+  /**
+   * Compressed G-code Files
+   * Print files packed by buildroot/share/scripts/gcz.py, known by their header
+   * whatever their name. The G-code is heatshrink coded in chunks that each start
+   * with a fresh decoder, so M26, M808 and power-loss recovery reach any position
+   * by decoding from the start of its chunk. Files take about half the space, so
+   * there's less to upload and to read from the card.
+   * Not for use with SD_STAGING, SD_PRINT_WHILE_UPLOADING, SD_FLASH_JOB_CACHE,
+   * SD_JOB_INFO or CANCEL_OBJECTS_SEEK, which read the file as it is stored.
+   */
+  //#define SD_COMPRESSED_FILES
+
+  /**
+   * Compiled Jobs
+   * "M37 /path/part.gco" parses a file once, in the background, into command
+   * records in PART.GCB beside it. A print of the file then reads the records,
+   * while they match the file's size and date, with no parsing and no reading
+   * of comments. An index of layer and object starts finds resume positions.
+   * The G-code stays the source: M27, M26, M808 and power-loss recovery use
+   * its positions. Requires GCODE_TOKEN_QUEUE. Not for use with SD_STAGING,
+   * SD_COMPRESSED_FILES, SD_FLASH_JOB_CACHE or CANCEL_OBJECTS_SEEK.
+   */
+  //#define SD_JOB_COMPILE
+  #if ENABLED(SD_JOB_COMPILE)
+    #define SD_JOB_COMPILE_AUTO           // Compile a file when a print of it ends
+    #define SD_JOB_COMPILE_INDEX 32       // Index entries. More for a quicker resume.
+  #endif
+
+  /**
+   * Write Buffer
+   * Collect data appended to a file being uploaded (M28 or BINARY_FILE_TRANSFER)
+   * and write it to the card in multi-block transfers instead of one block at a time.
+   * 'M28 S<bytes> file.gco' pre-allocates contiguous clusters for the upload.
+   */
+  //#define SD_WRITE_BUFFER
+  #if ENABLED(FF_WIFI_SERIAL)
+    #define SD_WRITE_BUFFER
+  #endif
+  #if ENABLED(SD_WRITE_BUFFER)
+    #define SD_WRITE_BUFFER_BLOCKS 8  // 512-byte blocks per write (2-64)
+  #endif
+
+  /**
+   * Block Cache
+   * Keep several recently used card blocks in RAM instead of one, so the print
+   * file, the power-loss recovery file, M928 logs and directory listings don't
+   * keep re-reading each other's FAT and data blocks. Changed blocks are written
+   * when pushed out or when a file is synced, so repeated changes to a FAT block
+   * cost one write. Uses 520 bytes of RAM per block, per volume.
+   */
+  //#define SD_BLOCK_CACHE
+  #if ENABLED(SD_BLOCK_CACHE)
+    #define SD_BLOCK_CACHE_BLOCKS 8   // Blocks to keep (2-16)
+  #endif
+
+  /**
+   * Line Spans
+   * Read SD print lines straight from the cached card block, copying each run
+   * of plain characters in one go and skipping comments to the line end, in
+   * place of one card read call per byte. Not used for files read through
+   * SD_COMPRESSED_FILES or SD_FLASH_JOB_CACHE.
+   */
+  //#define SD_LINE_SPANS
+
+  /**
+   * Log Buffer
+   * Collect the lines logged by M928 in RAM and write them to the card from idle()
+   * a sector at a time, so a slow card never holds up the commands being logged.
+   * Lines that don't fit are dropped and counted. M29 reports the count.
+   */
+  //#define SD_LOG_BUFFER
+  #if ENABLED(SD_LOG_BUFFER)
+    #define SD_LOG_BUFFER_SIZE 2048   // (bytes) Power of 2, at least 1024
+  #endif
+
   /**
    * Multiple volume support - EXPERIMENTAL.
    * Adds 'M21 Pm' / 'M21 S' / 'M21 U' to mount SD Card / USB Drive.
@@ -1931,6 +2541,100 @@
   //#define TFT_BTOKMENU_COLOR 0x145F // 00010 100010 11111 Cyan
 #endif
 
+//
+// Color UI Options
+//
+#if ENABLED(TFT_COLOR_UI)
+  /**
+   * Don't redraw screen areas that haven't changed. Each canvas (a status
+   * screen item, a menu line...) is hashed as it is queued, and dropped if the
+   * same area already shows the same content. This saves CPU time, TFT queue
+   * space and display bus time, mostly on the status screen. (~400 bytes RAM)
+   */
+  //#define TFT_SKIP_UNCHANGED
+  #if ENABLED(TFT_SKIP_UNCHANGED)
+    #define TFT_SKIP_UNCHANGED_AREAS 32   // Screen areas to remember (8..255)
+  #endif
+
+  /**
+   * Render the next canvas slice while DMA sends the previous one to the
+   * display, instead of waiting for each transfer. Doubles the TFT buffer,
+   * so it costs TFT_BUFFER_SIZE * 2 more bytes of RAM. FSMC displays only.
+   */
+  //#define TFT_DOUBLE_BUFFER
+
+  /**
+   * Find the fastest FSMC write timing the display takes reliably, instead of
+   * the conservative default for every panel. Settings load steps the data and
+   * address setup times down while MADCTL patterns still read back correctly,
+   * then adds a margin. The result is kept in EEPROM, so this runs only when it
+   * has no timing stored, or after M502. FSMC displays on STM32 only.
+   */
+  //#define TFT_FSMC_CALIBRATION
+  #if ENABLED(TFT_FSMC_CALIBRATION)
+    #define TFT_FSMC_CALIBRATION_MARGIN 2 // (HCLK cycles) Added to the fastest data setup time that passed
+  #endif
+
+  /**
+   * Keep recently drawn glyphs as runs of set pixels, so text is drawn as
+   * horizontal spans instead of decoding the font bit by bit on each redraw.
+   * Least recently used glyphs are replaced. Glyphs too big for a slot are
+   * drawn the old way. (ENTRIES * (SLOT + 8) bytes RAM)
+   */
+  //#define TFT_GLYPH_CACHE
+  #if ENABLED(TFT_GLYPH_CACHE)
+    #define TFT_GLYPH_CACHE_ENTRIES 20    // Glyphs to keep (4..255)
+    #define TFT_GLYPH_CACHE_SLOT   128    // Bytes per glyph (32..255)
+  #endif
+
+  /**
+   * Store the 16 bit images (boot screens, status background) run-length
+   * coded, and decode them into each canvas slice. Roughly halves their
+   * flash size, e.g. 300K to 120K for the 480x320 boot screen.
+   * Regenerate with buildroot/share/scripts/rle16-tft-image.py.
+   */
+  //#define TFT_IMAGE_RLE
+
+  /**
+   * Touch the print time on the status screen to preview the QOI thumbnail that
+   * PrusaSlicer and OrcaSlicer embed in the G-code ("; thumbnail_QOI begin").
+   * The base64 text is read from the print file in blocks and decoded into each
+   * canvas slice, so only ~800 bytes of RAM are used for any thumbnail size.
+   * Requires SD_JOB_INFO. Raise SD_JOB_INFO_HEAD if thumbnails aren't found.
+   */
+  //#define TFT_THUMBNAIL
+
+  /**
+   * Touch the progress bar while printing for a preview of the layer being
+   * parsed over the one before it. Each extruding G0/G1 is drawn into a 1-bit
+   * map of the bed as it is read, ahead of the planner, and the screen is only
+   * queued again when the map changes. (TFT_TOOLPATH_CELLS^2 / 4 bytes RAM)
+   */
+  //#define TFT_TOOLPATH_PREVIEW
+  #if ENABLED(TFT_TOOLPATH_PREVIEW)
+    #define TFT_TOOLPATH_CELLS 96     // Map cells per side, a multiple of 8. Scaled up to fit the screen.
+  #endif
+
+  /**
+   * Remember what each menu row shows and skip the rows that haven't changed,
+   * so scrolling a long menu or updating one value only lays out the rows that
+   * differ. Unlike TFT_SKIP_UNCHANGED, a row is dropped before its text is
+   * built and queued. (4 bytes RAM per menu line)
+   */
+  //#define TFT_MENU_ROW_CACHE
+
+  /**
+   * Count DWT cycles for each UI phase of every screen: layout (the screen
+   * handler), canvas render, DMA (sending to the display) and touch handling.
+   * With MARLIN_DEV_MODE, D204 reports the average and longest cost per frame.
+   */
+  //#define TFT_UI_PROFILER
+  #if ENABLED(TFT_UI_PROFILER)
+    #define TFT_UI_PROFILER_SCREENS 8   // Screens to track. Any others share the last slot.
+    //#define TFT_UI_PROFILER_OVERLAY   // Show the previous frame's cost (us) in the top right corner
+  #endif
+#endif
+
 //
 // ADC Button Debounce
 //
@@ -1966,6 +2670,10 @@
 //#define BABYSTEPPING
 #if ENABLED(BABYSTEPPING)
   //#define INTEGRATED_BABYSTEPPING         // EXPERIMENTAL integration of babystepping into the Stepper ISR
+  //#define BABYSTEP_PLANNER                // Blend Z babysteps into queued moves instead of pulsing Z between steps
+  #if ENABLED(BABYSTEP_PLANNER)
+    #define BABYSTEP_PLANNER_SLOPE 0.01     // (mm/mm) Most Z offset to take up per mm of XY travel
+  #endif
   //#define BABYSTEP_WITHOUT_HOMING
   //#define BABYSTEP_ALWAYS_AVAILABLE       // Allow babystepping at all times (not just during movement).
   //#define BABYSTEP_XY                     // Also enable X/Y Babystepping. Not supported on DELTA!
@@ -2017,6 +2725,18 @@
   //#define LA_DEBUG            // If enabled, this will generate debug information output over USB.
   //#define EXPERIMENTAL_SCURVE // Enable this option to permit S-Curve Acceleration
   //#define ALLOW_LOW_EJERK     // Allow a DEFAULT_EJERK value of <10. Recommended for direct drive hotends.
+
+  /**
+   * Compute the pressure lead in the main stepper ISR instead of a separate advance ISR.
+   * The lead follows K times the E velocity, low-pass filtered over LIN_ADVANCE_SMOOTH_TIME,
+   * and its steps are sent with the other axes, at most one per step event. This works with
+   * S_CURVE_ACCELERATION. Define it with LIN_ADVANCE on the build command line (marlin_builder.sh -i)
+   * so Configuration.h keeps S-Curve enabled.
+   */
+  //#define LIN_ADVANCE_INTEGRATED
+  #if ENABLED(LIN_ADVANCE_INTEGRATED)
+    #define LIN_ADVANCE_SMOOTH_TIME 40  // (ms) Time constant of the E velocity filter
+  #endif
 #endif
 
 // @section leveling
@@ -2127,6 +2847,18 @@
     #define PTC_BED_RES        5    // (°C)
     #define PTC_BED_COUNT     10
     #define PTC_BED_ZOFFS     { 0 } // (µm) Z adjustments per sample
+
+    /**
+     * Probe while the bed heats up. Preheat for probing only waits for the bed
+     * to reach PTC_BED_SOAK_MIN, and each point is corrected from the bed
+     * temperature at its probe time to the bed target temperature, so the
+     * mesh matches the bed once it is fully heated. Requires a G76 calibration
+     * covering the range from PTC_BED_SOAK_MIN up to the printing temperature.
+     */
+    //#define PTC_BED_SOAK
+    #if ENABLED(PTC_BED_SOAK)
+      #define PTC_BED_SOAK_MIN PTC_BED_START // (°C) Bed temperature to begin probing
+    #endif
   #endif
 
   #if ENABLED(PTC_HOTEND)
@@ -2175,11 +2907,37 @@
   #define N_ARC_CORRECTION       25   // Number of interpolated segments between corrections
   //#define ARC_P_CIRCLES             // Enable the 'P' parameter to specify complete circles
   //#define SF_ARC_FIX                // Enable only if using SkeinForge with "Arc Point" fillet procedure
+
+  /**
+   * Native Arcs
+   *
+   * Queue each XY arc as one planner block and let the Stepper ISR trace the
+   * circle step by step, instead of queueing hundreds of short chords. The
+   * arc is speed-limited by its curvature and joins its neighbors along its
+   * end tangents. Arcs that can't be traced this way (X and Y steps/mm differ,
+   * soft endstops would clip them, very small radii, other planes, etc.) are
+   * still split into segments. Requires a 32-bit CPU.
+   */
+  //#define NATIVE_ARCS
+  #if ENABLED(NATIVE_ARCS)
+    #define NATIVE_ARC_LEVEL_TOLERANCE 0.005 // (mm) Max leveling deviation from a straight Z ramp along the arc
+  #endif
 #endif
 
 // G5 Bézier Curve Support with XYZE destination and IJPQ offsets
 //#define BEZIER_CURVE_SUPPORT        // Requires ~2666 bytes
 
+/**
+ * G64 P<mm> Path Blending
+ * Round the corners between G0/G1 XY(E) moves with cubic Bézier curves that
+ * stay within P of the corner, so the head keeps speed through them.
+ * G64 P0 follows the exact path again. Requires BEZIER_CURVE_SUPPORT.
+ */
+//#define PATH_BLENDING
+#if ENABLED(PATH_BLENDING)
+  #define PATH_BLENDING_TOLERANCE 0   // (mm) Default G64 P. 0 for the exact path.
+#endif
+
 #if EITHER(ARC_SUPPORT, BEZIER_CURVE_SUPPORT)
   //#define CNC_WORKSPACE_PLANES      // Allow G2/G3/G5 to operate in XY, ZX, or YZ planes
 #endif
@@ -2193,6 +2951,29 @@
  * Preparing your G-code: https://github.com/colinrgodsey/step-daemon
  */
 //#define DIRECT_STEPPING
+#if ENABLED(DIRECT_STEPPING)
+  /**
+   * Page formats:
+   *   SP_4x4D_128  : 4 bits per axis for each of 128 segments of 7 steps, with direction
+   *   SP_4x2_256   : 2 bits per axis for each of 256 segments of 3 steps
+   *   SP_4x1_512   : 1 bit per axis for each of 512 steps
+   *   SP_4x4DP_128 : SP_4x4D_128 sent as run-length records holding only the axes that
+   *                  changed, so steady or single-axis moves need far fewer bytes.
+   *                  The page index is followed by a 16-bit size, low byte first.
+   */
+  //#define STEPPER_PAGE_FORMAT SP_4x2_256
+  //#define STEPPER_PAGES 16    // Pages in the pool, a multiple of 4 up to 256. 64 packed pages use 24K of RAM.
+#endif
+
+/**
+ * Host Block Stream
+ *
+ * Take trapezoid blocks planned by the host (steps per axis, entry, nominal and
+ * exit rates, acceleration) in binary frames straight into the planner buffer,
+ * with no G-code parsing or planning. Each block is checked against the axis
+ * feedrate and acceleration limits. See feature/host_blocks.h for the format.
+ */
+//#define HOST_BLOCK_STREAM
 
 /**
  * G38 Probe Target
@@ -2210,6 +2991,20 @@
 // Moves (or segments) with fewer steps than this will be joined with the next move
 #define MIN_STEPS_PER_SEGMENT 6
 
+/**
+ * Join runs of nearly collinear G0/G1 XY(E) moves into one planner block
+ * before they are planned. A move joins the run when all the dropped points
+ * stay within LINE_MERGE_DEVIATION of the joined line, its E per mm of travel
+ * matches the run within LINE_MERGE_E_TOLERANCE, and Z and the feedrate are
+ * unchanged. Fewer blocks per second, and the same BLOCK_BUFFER_SIZE looks further ahead.
+ */
+//#define LINE_MERGE
+#if ENABLED(LINE_MERGE)
+  #define LINE_MERGE_DEVIATION   0.005  // (mm) Farthest a dropped point may lie from the joined line
+  #define LINE_MERGE_E_TOLERANCE 0.02   // Largest relative change of E per mm of travel
+  #define LINE_MERGE_SEGMENTS    8      // Most moves joined into one block
+#endif
+
 /**
  * Minimum delay before and after setting the stepper DIR (in ns)
  *     0 : No delay (Expect at least 10µS since one Stepper ISR must transpire)
@@ -2264,9 +3059,56 @@
 
 // @section motion
 
+/**
+ * Deep Lookahead
+ * Boards with plenty of SRAM (e.g., STM32F407) can hold a much longer plan so
+ * junction speeds don't collapse on dense curved segments. Allows a BLOCK_BUFFER_SIZE
+ * of 64 to 256 and only re-plans the blocks changed since the last optimal block,
+ * so the cost of adding a block doesn't grow with the buffer depth.
+ */
+//#define PLANNER_DEEP_LOOKAHEAD
+
+/**
+ * Instant Feedrate Override
+ * Apply a new M220 / LCD feedrate percentage to the moves already in the planner,
+ * instead of only to those planned after it, so a deep buffer responds right away.
+ * Only G-code moves are re-timed, up to the axis feedrate limits.
+ * Requires Junction Deviation (no CLASSIC_JERK).
+ */
+//#define INSTANT_FEEDRATE_OVERRIDE
+
+/**
+ * Acceleration Torque Curve
+ * A stepper has the most torque at low speed, and DEFAULT_MAX_ACCELERATION
+ * must hold at the top speed. Give slower moves more acceleration, by axis,
+ * from percentages of the max acceleration at percentages of the max feedrate.
+ * Each move gets the acceleration its motors have at its own top speed.
+ * Use M214 to set the curve while tuning. It's not saved in EEPROM.
+ */
+//#define ACCEL_TORQUE_CURVE
+#if ENABLED(ACCEL_TORQUE_CURVE)
+  #define ACCEL_TORQUE_SPEEDS {   0,  25,  50,  75, 100 } // (% of max feedrate) Ascending, from 0 to 100
+  #define ACCEL_TORQUE_X      { 200, 180, 150, 120, 100 } // (% of max acceleration) At each speed
+  #define ACCEL_TORQUE_Y      { 200, 180, 150, 120, 100 }
+  #define ACCEL_TORQUE_Z      { 100, 100, 100, 100, 100 }
+#endif
+
+/**
+ * Planner Staging
+ * When the planner is full, go on with the next G-code instead of waiting for a
+ * free block. Its moves are transformed, leveled and split into segments while
+ * the planner is busy, then held so each is planned as soon as a block is free.
+ */
+//#define PLANNER_STAGING
+#if ENABLED(PLANNER_STAGING)
+  #define PLANNER_STAGING_SIZE 16 // Segments that can wait for a free block
+#endif
+
 // The number of linear moves that can be in the planner at once.
 // The value of BLOCK_BUFFER_SIZE must be a power of 2 (e.g., 8, 16, 32)
-#if BOTH(SDSUPPORT, DIRECT_STEPPING)
+#if ENABLED(PLANNER_DEEP_LOOKAHEAD)
+  #define BLOCK_BUFFER_SIZE 128 // :[64, 128, 256]
+#elif BOTH(SDSUPPORT, DIRECT_STEPPING)
   #define BLOCK_BUFFER_SIZE  8
 #elif ENABLED(SDSUPPORT)
   #define BLOCK_BUFFER_SIZE 16
@@ -2280,6 +3122,56 @@
 #define MAX_CMD_SIZE  128
 #define BUFSIZE       128
 
+/**
+ * Tokenized Command Queue
+ * Parse each command line once, as it's queued, into a compact record holding the
+ * command, its parameter letters, and their values already converted to float.
+ * Simple motion, temperature, and fan commands are dispatched from the record, so
+ * handlers don't scan the line or call strtof again. Other lines queue as text in
+ * a smaller pool, so the queue needs much less RAM than BUFSIZE lines of text.
+ * Requires FASTER_GCODE_PARSER.
+ */
+//#define GCODE_TOKEN_QUEUE
+#if ENABLED(GCODE_TOKEN_QUEUE)
+  #define GCODE_TOKEN_PARAMS  6   // Most parameter values in a tokenized command
+  #define GCODE_TEXT_SLOTS    8   // Command lines that can wait in the queue as text
+#endif
+
+/**
+ * Packed Command Queue
+ * Store the queued command lines end to end in GCODE_QUEUE_BYTES, each taking
+ * only its own length, instead of MAX_CMD_SIZE bytes for each of BUFSIZE lines.
+ * A typical move line is about 30 bytes, so the queue takes about a quarter of
+ * the RAM. Not for use with GCODE_TOKEN_QUEUE.
+ */
+//#define GCODE_PACKED_QUEUE
+#if ENABLED(GCODE_PACKED_QUEUE)
+  #define GCODE_QUEUE_BYTES 4096  // Bytes of queued command text. At least 4 * MAX_CMD_SIZE.
+#endif
+
+/**
+ * Serial Line Scan
+ * Store each received serial line as it comes and look for comments, quotes,
+ * escapes and backspaces once the line ends, 4 bytes at a time. A plain line
+ * is then ready as it is, so most bytes skip the per-character input state
+ * machine. Lines with those characters go through it from the first one.
+ */
+//#define SERIAL_LINE_SCAN
+
+/**
+ * Serial Port Scheduling
+ * Share the command queue between serial ports so a host polling one port
+ * (e.g., a WiFi monitor) can't hold up the print stream sent to another.
+ *  - Ports take turns adding lines to the queue.
+ *  - Each port may hold at most its quota of queued commands.
+ *  - M105 and M27 are answered on arrival when their port has nothing queued.
+ * Requires SERIAL_PORT_2.
+ */
+//#define SERIAL_PORT_SCHEDULING
+#if ENABLED(SERIAL_PORT_SCHEDULING)
+  #define SERIAL_PORT_QUOTAS { BUFSIZE, 8 } // Commands each port may queue, in order SERIAL_PORT, SERIAL_PORT_2, ...
+#endif
+
 // Transmission to Host Buffer Size
 // To save 386 bytes of flash (and TX_BUFFER_SIZE+3 bytes of RAM) set to 0.
 // To buffer a simple "ok" you need 4 bytes.
@@ -2311,12 +3203,71 @@
   //#define SERIAL_STATS_DROPPED_RX
 #endif
 
+/**
+ * Serial DMA
+ *
+ * Move hardware serial data with DMA streams instead of an interrupt for every byte.
+ * Input goes into the RX buffer through a circular stream, which can't drop bytes,
+ * so a full buffer overwrites the oldest unread data. Host flow control ("ok")
+ * normally prevents this. Output is sent in one transfer per line, and the
+ * Temperature ISR sends partial lines and checks input for the emergency parser.
+ * Ports without a free RX or TX stream keep using interrupts.
+ * NOTE: STM32F4 and STM32F7 only.
+ */
+//#define SERIAL_DMA
+#if ENABLED(FF_WIFI_SERIAL)
+  #define SERIAL_DMA    // Keep up with the WiFi link without an interrupt per byte
+#endif
+
 // Monitor RX buffer usage
 // Dump an error to the serial port if the serial receive buffer overflows.
 // If you see these errors, increase the RX_BUFFER_SIZE value.
 // Not supported on all platforms.
 //#define RX_BUFFER_MONITOR
 
+/**
+ * Serial Stream Statistics
+ * Measure bytes and lines received per second on each serial port, the time
+ * spent parsing each command, the delay from receiving a move until it is in
+ * the planner, and planner blocks added per second. Use to tell whether a
+ * stuttering print is limited by the host link, the parser, or the planner.
+ *
+ * M576      - Report statistics since the last report
+ * M576 S<s> - Auto-report every <s> seconds. S0 to disable.
+ */
+//#define STREAM_STATISTICS
+
+/**
+ * Host Stream Spool
+ * Cushion host stalls (USB resets, host pauses, WiFi drops) on host prints.
+ * Lines from the spooling port are acknowledged as soon as they are received
+ * and kept in a RAM spool, so the host streams as far ahead as the spool holds.
+ * They go into the command queue, in order, as it has room. A typical move is
+ * about 30 bytes, so 32768 bytes hold about 1000 moves. That is 10-30 seconds
+ * of a dense job, against about a second for BUFSIZE and RX_BUFFER_SIZE alone.
+ *
+ * M577 is run as soon as it is received, ahead of the spooled lines:
+ *   M577 S1 - Spool the lines from this port. S0 to stop.
+ *   M577 C  - Discard the spooled lines, e.g., to cancel the print.
+ *   M577    - Report the spool use.
+ *
+ * NOTE: Spooled lines get their 'ok' before they run. M400, M109 and other
+ *       waits don't hold back the host while spooling.
+ */
+//#define HOST_SPOOL
+#if ENABLED(HOST_SPOOL)
+  #define HOST_SPOOL_SIZE 32768   // (bytes) Command text held for the host. 4 * MAX_CMD_SIZE to 65535.
+#endif
+
+/**
+ * Status Report Cache
+ * Keep the formatted M105 and M114 replies and send them again unchanged
+ * until the temperatures are re-sampled or the position moves. Hosts that
+ * poll several times a second then cost a buffer copy instead of float
+ * formatting on each request.
+ */
+//#define REPORT_CACHE
+
 /**
  * Emergency Command Parser
  *
@@ -2349,6 +3300,23 @@
   //#define FULL_REPORT_TO_HOST_FEATURE   // Auto-report the machine status like Grbl CNC
 #endif
 
+/**
+ * Realtime Overrides (requires EMERGENCY_PARSER)
+ *
+ * Apply host overrides as soon as they are received, ahead of the
+ * commands waiting in the queue and planner. Prefix a command with '!':
+ *  !M220 S<percent> : Feedrate percentage
+ *  !M221 S<percent> : Flow percentage of the active extruder
+ *  !M106 S<0-255>   : Part cooling fan speed (fan 0)
+ *  !M107            : Part cooling fan off
+ *  !M290 Z<mm>      : Babystep Z (requires BABYSTEPPING)
+ *
+ * - Applied on the next idle() call, including while waiting for planner space.
+ * - The queued copy of the line only returns the 'ok'.
+ * - Numbered lines must have a good checksum. Not recognized in MeatPack streams.
+ */
+//#define REALTIME_OVERRIDES
+
 // Bad Serial-connections can miss a received command by sending an 'ok'
 // Therefore some clients abort after 30 seconds in a timeout.
 // Some other clients start sending commands while receiving a 'wait'.
@@ -2358,6 +3326,21 @@
 // Some clients will have this feature soon. This could make the NO_TIMEOUTS unnecessary.
 //#define ADVANCED_OK
 
+// Acknowledge a run of moves (G0-G3) with one "ok N<count>" instead of an "ok" for each.
+// The batch is sent when BATCHED_OK_MAX moves are done, before any other command runs,
+// and whenever the host stops sending. Only for hosts that report the BATCHED_OK capability.
+//#define BATCHED_OK
+#if ENABLED(BATCHED_OK)
+  #define BATCHED_OK_MAX 8  // Most moves in one acknowledgement
+#endif
+
+// Send the auto-reports (M154, M155, M27 S...) and the D207/D208 dumps to one serial port
+// instead of all of them, so a monitor on that port doesn't interleave its traffic with the
+// command stream and its 'ok's. 1 = SERIAL_PORT, 2 = SERIAL_PORT_2, 3 = SERIAL_PORT_3.
+// The STM32F4 USB FS device only has the endpoints for one CDC port, so pair the USB
+// port with a UART (e.g., the FF_WIFI_SERIAL port) for this.
+//#define TELEMETRY_SERIAL 2
+
 // Printrun may have trouble receiving long strings all at once.
 // This option inserts short delays between lines of serial output.
 #define SERIAL_OVERRUN_PROTECTION
@@ -2414,6 +3397,7 @@
   #define RETRACT_RECOVER_LENGTH_SWAP   0   // (mm) Default additional swap recover length (added to retract length on recover from toolchange)
   #define RETRACT_RECOVER_FEEDRATE      8   // (mm/s) Default feedrate for recovering from retraction
   #define RETRACT_RECOVER_FEEDRATE_SWAP 8   // (mm/s) Default feedrate for recovering from swap retraction
+  //#define RETRACT_HOP_BLEND               // Z hop in the same planner block as the retract, and Z drop with the recover
   #if ENABLED(MIXING_EXTRUDER)
     //#define RETRACT_SYNC_MIXING           // Retract and restore all mixing steppers simultaneously
   #endif
@@ -2432,6 +3416,13 @@
     //#define EVENT_GCODE_AFTER_TOOLCHANGE "G12X"   // Extra G-code to run after tool-change
   #endif
 
+  /**
+   * Queue tool-changes like any other moves instead of emptying the planner
+   * first. For fixed multi-nozzle heads (e.g., Dreamer and Inventor) the lift,
+   * retract, hotend offset shift, prime and return don't stop the print.
+   */
+  //#define TOOLCHANGE_STREAMING
+
   /**
    * Extra G-code to run while executing tool-change commands. Can be used to use an additional
    * stepper motor (I axis, see option LINEAR_AXES in Configuration.h) to drive the tool-changer.
@@ -2560,6 +3551,15 @@
   //#define FILAMENT_CHANGE_RESUME_ON_INSERT      // Automatically continue / load filament when runout sensor is triggered again.
   //#define PAUSE_REHEAT_FAST_RESUME              // Reduce number of waits by not prompting again post-timeout before continuing.
 
+  /**
+   * Queue the pause retract, the unload retract, the park and the purge and
+   * unload as planner chains instead of waiting after each move. The unload
+   * retract runs before the park so the filament cools while the nozzle
+   * travels, and slow and fast load run back to back. Heaters and the UI stay
+   * live while each chain runs.
+   */
+  //#define ADVANCED_PAUSE_PLANNED
+
   #define PARK_HEAD_ON_PAUSE                    // Park the nozzle during pause and filament change.
   //#define HOME_BEFORE_FILAMENT_CHANGE           // If needed, home before parking for filament change
 
@@ -3461,6 +4461,40 @@
   #endif
 #endif
 
+/**
+ * Layer Events
+ * Detect each layer change of a print once, and call the features that act on
+ * layers: power-loss recovery saves at each layer and TIMELAPSE takes a frame.
+ * A layer begins with the first extruding move at least LAYER_MIN_Z_CHANGE above
+ * the last layer, so Z hops don't count. M230 reports the current layer.
+ */
+//#define LAYER_EVENTS
+#if ENABLED(LAYER_EVENTS)
+  #define LAYER_MIN_Z_CHANGE     0.05 // (mm) Smallest rise that begins a layer (vase-mode-friendly)
+  #define LAYER_EVENT_SUBSCRIBERS   4 // Features and hooks that can subscribe to layer events
+  //#define LAYER_COMMENTS              // Take the layers from ";LAYER:<n>" or ";LAYER_CHANGE" slicer comments, when a print has them
+#endif
+
+/**
+ * Timelapse
+ * Park the head and trigger a camera on each layer change of a print. (M241)
+ * The layer changes come from LAYER_EVENTS. The park is planned behind the print
+ * moves and the trigger fires as the head arrives, so a frame costs only the park
+ * moves and the shutter time.
+ */
+//#define TIMELAPSE
+#if ENABLED(TIMELAPSE)
+  //#define TIMELAPSE_ENABLED_DEFAULT                                 // Take frames from boot (M241 S)
+  #define TIMELAPSE_PARK_POS        { X_MAX_POS - 10, Y_MAX_POS - 10 } // (mm) Where the camera sees the print
+  #define TIMELAPSE_PARK_FEEDRATE   200 // (mm/s) XY speed to and from the park position
+  #define TIMELAPSE_Z_RAISE         0.5 // (mm) Raise Z over the print while parked
+  #define TIMELAPSE_RETRACT_MM      1   // (mm) Retract while parked
+  #define TIMELAPSE_RETRACT_FEEDRATE 45 // (mm/s)
+  #define TIMELAPSE_SHUTTER_MS      100 // (ms) Hold still with the trigger on
+  //#define TIMELAPSE_TRIGGER_PIN    -1 // Pin set when the head arrives. Else only "//action:timelapse" is sent.
+  #define TIMELAPSE_TRIGGER_STATE  HIGH // State of the trigger pin for a photo
+#endif
+
 /**
  * Spindle & Laser control
  *
@@ -3751,11 +4785,35 @@
   //#define AUTO_REPORT_REDUNDANT // Include the "R" sensor in the auto-report
 #endif
 
+/**
+ * Temperature Telemetry
+ *
+ * Record every reading of each heater (time, temperature, target and power)
+ * in a RAM ring buffer. M155 B<ms> streams the readings in base64 "TLM:" lines,
+ * at the sensor rate instead of once a second, for PID tuning and for looking
+ * back at a thermal runaway. The first report includes the buffered history.
+ */
+#if ENABLED(AUTO_REPORT_TEMPERATURES)
+  //#define TEMP_TELEMETRY
+  #if ENABLED(TEMP_TELEMETRY)
+    #define TEMP_TELEMETRY_SAMPLES 64   // Readings to keep (power of 2, 8..256)
+  #endif
+#endif
+
 /**
  * Auto-report position with M154 S<seconds>
  */
 //#define AUTO_REPORT_POSITION
 
+/**
+ * Auto-report a compact status line with M408 S<seconds>
+ * One "ST:" line of integer key=value fields with heater temperatures,
+ * targets and power, position, media progress, print time, planner depth
+ * and error flags, for hosts that would otherwise poll M105, M114, M27 and M31.
+ * 'M408 S<seconds> C1' skips reports that wouldn't change.
+ */
+//#define AUTO_REPORT_STATUS
+
 /**
  * Include capabilities in M115 output
  */
@@ -3796,6 +4854,18 @@
      * A non-zero value activates Volume-based Extrusion Limiting.
      */
     #define DEFAULT_VOLUMETRIC_EXTRUDER_LIMIT 0.00      // (mm^3/sec)
+
+    /**
+     * Apply the limit to the flow averaged over the planner queue, the way the melt
+     * zone sees it, instead of to each block. Short segments may go above the limit
+     * (up to VOLUMETRIC_FLOW_PEAK times) while the average stays under it, so runs of
+     * alternating thin and thick segments keep a steady speed.
+     */
+    //#define VOLUMETRIC_FLOW_SMOOTHING
+    #if ENABLED(VOLUMETRIC_FLOW_SMOOTHING)
+      #define VOLUMETRIC_FLOW_SMOOTH_TIME 2.0   // (s) Time constant of the averaged flow
+      #define VOLUMETRIC_FLOW_PEAK        1.5   // Highest flow of a short segment, times the limit
+    #endif
   #endif
 #endif
 
@@ -3822,11 +4892,20 @@
 
 #if ENABLED(FASTER_GCODE_PARSER)
   //#define GCODE_QUOTED_STRINGS  // Support for quoted string parameters
+  //#define FAST_G0_G1_PARSER     // Decode plain G0/G1 lines with integer math, skipping the general parser. D202 to compare.
 #endif
 
 // Support for MeatPack G-code compression (https://github.com/scottmudge/OctoPrint-MeatPack)
 //#define MEATPACK_ON_SERIAL_PORT_1
 //#define MEATPACK_ON_SERIAL_PORT_2
+#if EITHER(MEATPACK_ON_SERIAL_PORT_1, MEATPACK_ON_SERIAL_PORT_2)
+  // A second packing mode with a host-supplied dictionary of multi-character symbols
+  // and coordinates sent as deltas. Hosts switch it on with the MeatPack command 0xF5.
+  //#define MEATPACK_DICTIONARY
+  #if ENABLED(MEATPACK_DICTIONARY)
+    #define MEATPACK_DICT_BYTES 128 // RAM per port for the dictionary text
+  #endif
+#endif
 
 //#define GCODE_CASE_INSENSITIVE  // Accept G-code sent to the firmware in lowercase
 
@@ -3854,6 +4933,30 @@
  */
 #define STARTUP_COMMANDS ""
 
+/**
+ * Staged Startup
+ *
+ * Bring up serial, heaters and steppers first and finish the slow parts
+ * of startup from idle() once setup() is done:
+ *  - With SDCARD_EEPROM_EMULATION, mount the media and load settings.
+ *    Defaults are used until then.
+ *  - End the boot screen when BOOTSCREEN_TIMEOUT has passed, instead of
+ *    waiting for it in setup().
+ * M115 reports the time (ms) each boot phase completed.
+ */
+//#define STAGED_STARTUP
+
+/**
+ * Settings Image
+ *
+ * M505 prints the stored settings as M506 lines, a hex copy of the EEPROM
+ * image with a CRC-32 over the whole transfer. Sending them to a printer
+ * with the same build stores them with a single write and loads them,
+ * instead of replaying and acknowledging all of M503 and then M500.
+ * The image must match the EEPROM version of the build.
+ */
+//#define SETTINGS_IMAGE
+
 /**
  * G-code Macros
  *
@@ -3864,6 +4967,16 @@
 #if ENABLED(GCODE_MACROS)
   #define GCODE_MACROS_SLOTS       5  // Up to 10 may be used
   #define GCODE_MACROS_SLOT_SIZE  50  // Maximum length of a single macro
+
+  /**
+   * Compile each macro into tokens when it's set, so running it skips the
+   * parser for every command GCODE_TOKEN_QUEUE can tokenize. All the macros
+   * share one arena instead of a fixed size for each slot.
+   */
+  //#define GCODE_MACROS_TOKENIZED
+  #if ENABLED(GCODE_MACROS_TOKENIZED)
+    #define GCODE_MACROS_ARENA_SIZE 512  // (bytes) For all macros together
+  #endif
 #endif
 
 /**
@@ -3981,6 +5094,23 @@
   //#define HOST_SHUTDOWN_MENU_ITEM       // Add a menu item that tells the host to shut down
 #endif
 
+/**
+ * Asynchronous User Wait
+ * M0/M1 reply at once and the command queue holds the commands after them until
+ * the user continues (LCD click, M108, or M876), with no busy loop in the command.
+ * Meanwhile status queries still run: M27 M31 M105 M114 M115 M119 M154 M155 M408.
+ */
+//#define ASYNC_USER_WAIT
+
+/**
+ * Idle Task Scheduler
+ * Run the periodic idle() tasks (UI, media, keepalive, auto-reports...) only when they are
+ * due, at most one per idle() call, earliest deadline first. Heaters, inactivity, runout,
+ * power-loss and other safety hooks still run on every call. The command queue gets its
+ * turn more often. With MARLIN_DEV_MODE, D205 reports the cost and lateness of each task.
+ */
+//#define IDLE_SCHEDULER
+
 /**
  * Cancel Objects
  *
@@ -3989,6 +5119,17 @@
 //#define CANCEL_OBJECTS
 #if ENABLED(CANCEL_OBJECTS)
   #define CANCEL_OBJECTS_REPORTING // Emit the current object as a status message
+
+  /**
+   * While an object is canceled, index its moves ahead of the SD print in the
+   * background. After its "M486 S<n>" the print seeks past them instead of
+   * reading, parsing and discarding each line, then sets the E position and
+   * feedrate they would have left. Anything but a move or G92 E ends a range.
+   */
+  //#define CANCEL_OBJECTS_SEEK
+  #if ENABLED(CANCEL_OBJECTS_SEEK)
+    #define CANCEL_OBJECTS_SEEK_RANGES 16 // Ranges indexed ahead of the print
+  #endif
 #endif
 
 /**
@@ -4310,15 +5451,56 @@
   //#define SERVICE_INTERVAL_2  200 // print hours
   //#define SERVICE_NAME_3      "Service 3"
   //#define SERVICE_INTERVAL_3    1 // print hours
+
+  // Count wear for maintenance: travel of each axis motor, stepper-on time, heater-on
+  // time of each hotend and the bed, part fan time, and tool changes. Shown with M78.
+  // Steps are added up as blocks complete and converted to mm with the time counters
+  // every 10s. Saved with the statistics, at the top of the EEPROM (where UBL leaves room).
+  //#define PRINTCOUNTER_WEAR
 #endif
 
 // @section develop
 
 //
 // M100 Free Memory Watcher to debug memory usage
+// Also reports the deepest idle() nesting. On STM32 the free memory is painted at
+// boot and M100 reports the heap size and the peak use of the main and task stacks.
 //
 //#define M100_FREE_MEMORY_WATCHER
 
+//
+// M101 Memory Budget
+//
+// Add up the big static buffers (planner, command queue, serial, TFT, EEPROM image...)
+// at compile time and fail the build if they don't fit MEMORY_BUDGET_BYTES.
+// M101 prints the breakdown and the free memory. PlatformIO builds also list the
+// largest RAM symbols of the linked firmware, including library buffers like the LVGL heap.
+//
+//#define MEMORY_BUDGET
+#if ENABLED(MEMORY_BUDGET)
+  #define MEMORY_BUDGET_BYTES 131072  // RAM for these buffers. F407: 128K main RAM + 64K CCM.
+  #define MEMORY_REPORT_SYMBOLS   20  // Largest symbols listed after linking (0 to skip)
+#endif
+
+//
+// M102 Memory Profiles
+//
+// Take the command queue text (GCODE_PACKED_QUEUE), the SD block cache (SD_BLOCK_CACHE)
+// and the TFT canvas buffer from one RAM arena, shared out by a profile. The arena is
+// as big as the largest profile. 'M102 P' picks the profile for the next boot; save it
+// with M500. The planner, serial and SDIO buffers keep their fixed sizes.
+//
+//#define MEMORY_PROFILES
+#if ENABLED(MEMORY_PROFILES)
+  // Bytes for { command text, SD cache, TFT canvas }. Shares for buffers that aren't built are ignored.
+  //  - Command text: 4 * MAX_CMD_SIZE to 32767.
+  //  - SD cache: 2 to SD_BLOCK_CACHE_BLOCKS blocks of 524 bytes.
+  //  - TFT canvas: 2 bytes per pixel, at least one display line (twice that with TFT_DOUBLE_BUFFER).
+  #define MEMORY_PROFILE_SD   {  2048, 4192, 16384 }  // P0: SD printing. Deep read cache.
+  #define MEMORY_PROFILE_HOST { 16384, 1048, 16384 }  // P1: Host streaming. Long command queue.
+  #define MEMORY_PROFILE_UI   {  2048, 1048, 38400 }  // P2: UI-rich. Big canvas, fewer redraw passes.
+#endif
+
 //
 // M42 - Set pin states
 //
@@ -4338,6 +5520,72 @@
    * To help diagnose print quality issues stemming from empty command buffers.
    */
   //#define BUFFER_MONITORING
+
+  /**
+   * D201 - Motion Benchmark
+   * Push synthetic moves through the planner with the steppers disabled, then
+   * report blocks per second, recalculate() time and a histogram of Stepper ISR
+   * durations. Timings need a DWT cycle counter (ARM Cortex-M3 and up).
+   */
+  //#define MOTION_BENCHMARK
+
+  /**
+   * D206 - ISR Profiler
+   * Time the Stepper and Temperature ISRs, the sensor task, SDIO and TFT DMA
+   * interrupts with the DWT cycle counter: self time min/avg/max and CPU load,
+   * plus the Stepper ISR latency from its timer compare. STM32 only.
+   */
+  //#define ISR_PROFILER
+
+  /**
+   * D207 - Step Capture
+   * Record the cycle count, step and DIR bits of each step event in RAM, then
+   * send them to the host in binary. buildroot/share/scripts/stepcap.py turns
+   * the dump into CSV position, velocity and acceleration for every axis.
+   * Needs a DWT cycle counter (ARM Cortex-M3 and up). 8 bytes of RAM per entry.
+   */
+  //#define STEP_CAPTURE
+  #if ENABLED(STEP_CAPTURE)
+    #define STEP_CAPTURE_SIZE 2048
+  #endif
+
+  /**
+   * D208 - Trace Events
+   * Record the begin and end of the G-code dispatch, buffer_line(), SD block
+   * reads, the UI update, the Temperature task and the TFT queue in a RAM ring,
+   * then send it to the host in binary. buildroot/share/scripts/trace2chrome.py
+   * writes a Chrome trace to view in chrome://tracing or ui.perfetto.dev.
+   * Needs a DWT cycle counter (ARM Cortex-M3 and up). 5 bytes of RAM per event.
+   */
+  //#define TRACE_EVENTS
+  #if ENABLED(TRACE_EVENTS)
+    #define TRACE_EVENTS_SIZE 2048      // Power of 2
+  #endif
+
+  /**
+   * D210 - SD Benchmark
+   * Qualify a card in the printer. 'D210 S<KB>' makes a contiguous BENCH.BIN
+   * and reports sequential write and read speed, random 512 B and 4 KB read
+   * latency, and a latency histogram of each test. The last test reads the
+   * file through the volume like a print does, so SDIO_READ_AHEAD is checked.
+   * 'D210 P1' tests the SD_STAGING card instead of the media.
+   */
+  //#define SD_BENCHMARK
+
+  /**
+   * D212 - Input Record / Replay
+   * 'D212 R' records the serial input, touch points and slow SD block reads to
+   * INPUT.REC on the media, each with its time. 'D212 P' plays the file back at
+   * the same times in place of the serial ports and touch screen, with DRYRUN so
+   * nothing heats or extrudes. Play it in NATIVE_SIM, or with the motors unplugged.
+   * Both report how often the planner and command queue ran dry in the print, so
+   * a stutter from the field can be reproduced and a fix checked. 'D212 S' stops.
+   */
+  //#define INPUT_REPLAY
+  #if ENABLED(INPUT_REPLAY)
+    #define INPUT_REPLAY_BUFFER 2048      // (bytes) Records held until written. Power of 2.
+    #define INPUT_REPLAY_SD_US  2000      // (µs) Record the SD block reads slower than this
+  #endif
 #endif
 
 /**
@@ -4346,6 +5594,20 @@
  * a crash from a remote location. Requires ~400 bytes of SRAM and 5Kb of flash.
  */
 //#define POSTMORTEM_DEBUGGING
+#if ENABLED(POSTMORTEM_DEBUGGING)
+  /**
+   * Keep the registers, backtrace, newest TRACE_EVENTS and planner / queue
+   * state of a fault, or of a main loop that stopped refreshing the watchdog,
+   * in RAM that survives the reset. The next boot writes it to crash_<n>.log
+   * on the SD card. Needs a .noinit section in the linker script (FF_F407ZG)
+   * and an MCU with the RNG interrupt (STM32F405/407 and up).
+   */
+  //#define CRASH_CAPTURE
+  #if ENABLED(CRASH_CAPTURE)
+    #define CRASH_CAPTURE_BACKTRACE 16    // Return addresses to keep
+    #define CRASH_CAPTURE_EVENTS    64    // Trace events to keep, with TRACE_EVENTS
+  #endif
+#endif
 
 /**
  * Software Reset options
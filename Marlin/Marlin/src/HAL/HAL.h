@@ -41,6 +41,16 @@ extern MarlinHAL hal;
   #define S_FMT "%s"
 #endif
 
+// Place CPU-only data in fast core coupled RAM, where the HAL has it
+#ifndef __ccmram
+  #define __ccmram
+#endif
+
+// Run hot ISR code from RAM, where the HAL has it
+#ifndef HOT_ISR_FUNC
+  #define HOT_ISR_FUNC
+#endif
+
 // String helper
 #ifndef PGMSTR
   #define PGMSTR(NAM,STR) const char NAM[] = STR
@@ -42,8 +42,10 @@ extern void loop();
 // simple stdout / stdin implementation for fake serial port
 void write_serial_thread() {
   for (;;) {
-    for (std::size_t i = usb_serial.transmit_buffer.available(); i > 0; i--) {
-      fputc(usb_serial.transmit_buffer.read(), stdout);
+    std::size_t i = usb_serial.transmit_buffer.available();
+    if (i) {
+      for (; i > 0; i--) fputc(usb_serial.transmit_buffer.read(), stdout);
+      fflush(stdout); // Don't hold replies back when stdout is a pipe
     }
     std::this_thread::yield();
   }
@@ -33,13 +33,13 @@
   DefaultSerial1 MSerialUSB(false, SerialUSB);
 #endif
 
-#if ENABLED(SRAM_EEPROM_EMULATION)
+#if EITHER(SRAM_EEPROM_EMULATION, POWER_LOSS_BACKUP_SRAM)
   #if STM32F7xx
     #include <stm32f7xx_ll_pwr.h>
   #elif STM32F4xx
     #include <stm32f4xx_ll_pwr.h>
   #else
-    #error "SRAM_EEPROM_EMULATION is currently only supported for STM32F4xx and STM32F7xx"
+    #error "SRAM_EEPROM_EMULATION and POWER_LOSS_BACKUP_SRAM are currently only supported for STM32F4xx and STM32F7xx"
   #endif
 #endif
 
@@ -48,12 +48,29 @@
   #include "usbd_cdc_if.h"
 #endif
 
+#if ENABLED(CRASH_CAPTURE)
+  #include "../../feature/crash_capture.h"
+#endif
+
 // ------------------------
 // Public Variables
 // ------------------------
 
 uint16_t MarlinHAL::adc_result;
 
+#if ENABLED(CCMRAM_PLACEMENT)
+
+  extern "C" uint32_t _siccmram, _sccmram, _eccmram;
+
+  // The core startup code only fills .data and .bss, so copy the .ccmram load
+  // image (zeros and initial values) before any static constructor runs.
+  __attribute__((constructor(101))) static void ccmram_init() {
+    const uint32_t *src = &_siccmram;
+    for (uint32_t *dst = &_sccmram; dst < &_eccmram;) *dst++ = *src++;
+  }
+
+#endif
+
 // ------------------------
 // Public functions
 // ------------------------
@@ -78,7 +95,7 @@ void MarlinHAL::init() {
     OUT_WRITE(LED_PIN, LOW);
   #endif
 
-  #if ENABLED(SRAM_EEPROM_EMULATION)
+  #if EITHER(SRAM_EEPROM_EMULATION, POWER_LOSS_BACKUP_SRAM)
     __HAL_RCC_PWR_CLK_ENABLE();
     HAL_PWR_EnableBkUpAccess();           // Enable access to backup SRAM
     __HAL_RCC_BKPSRAM_CLK_ENABLE();
@@ -156,6 +173,7 @@ void MarlinHAL::clear_reset_source() { __HAL_RCC_CLEAR_RESET_FLAGS(); }
 
   void MarlinHAL::watchdog_refresh() {
     IWatchdog.reload();
+    TERN_(CRASH_CAPTURE, crash_capture.watchdog_refreshed());
     #if DISABLED(PINS_DEBUGGING) && PIN_EXISTS(LED)
       TOGGLE(LED_PIN);  // heartbeat indicator
     #endif
@@ -167,6 +185,35 @@ extern "C" {
   extern unsigned int _ebss; // end of bss section
 }
 
+#ifdef HAL_CRC32_WORDS
+
+  /**
+   * The CRC unit shifts MSB first with no final XOR, so zlib's reflected CRC
+   * comes from reversing the bits of each word in and of the result out. It
+   * can't be loaded with a value, so a CRC is continued by first writing the
+   * word that takes the reset value to it, found by un-shifting the state.
+   */
+  bool MarlinHAL::crc32_words(uint32_t &crc, const uint32_t *words, uint32_t count) {
+    static volatile bool busy; // Interrupted in the middle of a CRC
+    if (busy) return false;
+    busy = true;
+
+    __HAL_RCC_CRC_CLK_ENABLE();
+    CRC->CR = CRC_CR_RESET;
+    if (crc) {
+      uint32_t s = __RBIT(~crc);
+      LOOP_L_N(i, 32) s = (s & 1) ? ((s ^ 0x04C11DB7UL) >> 1) | 0x80000000UL : s >> 1;
+      CRC->DR = ~s;
+    }
+    while (count--) CRC->DR = __RBIT(*words++);
+    crc = ~__RBIT(CRC->DR);
+
+    busy = false;
+    return true;
+  }
+
+#endif
+
 // Reset the system to initiate a firmware flash
 WEAK void flashFirmware(const int16_t) { hal.reboot(); }
 
@@ -161,6 +161,10 @@ typedef libServo hal_servo_t;
 
 #define HAL_ADC_VREF         3.3
 
+#if ENABLED(ADC_SCAN_DMA)
+  #define HAL_ADC_FILTERED     // Disable Marlin's oversampling. ADC values are averaged scans.
+#endif
+
 //
 // Pin Mapping for M42, M43, M226
 //
@@ -186,6 +190,10 @@ extern volatile uint32_t systick_uptime_millis;
 
 #define HAL_CAN_SET_PWM_FREQ   // This HAL supports PWM Frequency adjustment
 
+#if defined(STM32F4xx) || defined(STM32F7xx)
+  #define HAL_CRC32_WORDS        // The CRC unit can do zlib CRC-32 (libs/crc32.h)
+#endif
+
 // ------------------------
 // Class Utilities
 // ------------------------
@@ -193,6 +201,16 @@ extern volatile uint32_t systick_uptime_millis;
 // Memory related
 #define __bss_end __bss_end__
 
+// Core coupled RAM for CPU-only data. Never use it for DMA buffers.
+#if ENABLED(CCMRAM_PLACEMENT)
+  #define __ccmram __attribute__((section(".ccmram")))
+#endif
+
+// Hot ISR code, copied to SRAM with .data at startup. (CCM RAM can't run code.)
+#if ENABLED(ISR_CODE_IN_RAM)
+  #define HOT_ISR_FUNC __attribute__((section(".RamFunc"), noinline))
+#endif
+
 extern "C" char* _sbrk(int incr);
 
 #pragma GCC diagnostic push
@@ -242,22 +260,42 @@ public:
   // Free SRAM
   static int freeMemory() { return ::freeMemory(); }
 
+  #ifdef HAL_CRC32_WORDS
+    // Continue a zlib CRC-32 over whole words. Return false if the unit is in use.
+    static bool crc32_words(uint32_t &crc, const uint32_t *words, uint32_t count);
+  #endif
+
   //
   // ADC Methods
   //
 
   static uint16_t adc_result;
 
-  // Called by Temperature::init once at startup
-  static void adc_init() {
-    analogReadResolution(HAL_ADC_RESOLUTION);
-  }
+  #if ENABLED(ADC_SCAN_DMA)
 
-  // Called by Temperature::init for each sensor at startup
-  static void adc_enable(const pin_t pin) { pinMode(pin, INPUT); }
+    // Called by Temperature::init once at startup
+    static void adc_init();
 
-  // Begin ADC sampling on the given pin. Called from Temperature::isr!
-  static void adc_start(const pin_t pin) { adc_result = analogRead(pin); }
+    // Called by Temperature::init for each sensor at startup. Adds the pin to the ADC1 scan.
+    static void adc_enable(const pin_t pin);
+
+    // Average the scanned values for the given pin. Called from Temperature::isr!
+    static void adc_start(const pin_t pin);
+
+  #else
+
+    // Called by Temperature::init once at startup
+    static void adc_init() {
+      analogReadResolution(HAL_ADC_RESOLUTION);
+    }
+
+    // Called by Temperature::init for each sensor at startup
+    static void adc_enable(const pin_t pin) { pinMode(pin, INPUT); }
+
+    // Begin ADC sampling on the given pin. Called from Temperature::isr!
+    static void adc_start(const pin_t pin) { adc_result = analogRead(pin); }
+
+  #endif
 
   // Is the ADC ready for reading?
   static bool adc_ready() { return true; }
@@ -278,4 +316,19 @@ public:
    */
   static void set_pwm_frequency(const pin_t pin, const uint16_t f_desired);
 
+  #if ENABLED(HEATER_HW_PWM)
+    // A timer channel driven by writing its compare register directly, even from an ISR
+    typedef struct {
+      volatile uint32_t *ccr;               // nullptr when the pin has no usable timer channel
+      uint32_t top;                         // Compare value for 100% duty
+      void set(const uint8_t v, const uint8_t v_bits) { if (ccr) *ccr = (v * top) >> v_bits; }
+    } pwm_channel_t;
+
+    /**
+     * Start hardware PWM on the pin at the given frequency with 0% duty.
+     * Returns false for pins without a timer channel or on a timer used by Marlin.
+     */
+    static bool pwm_channel_start(pwm_channel_t &pc, const pin_t pin, const uint16_t frequency, const bool invert=false);
+  #endif
+
 };
@@ -138,6 +138,92 @@ static SPISettings spiConfig;
    * VGPV SPI speed start and PCLK2/2, by default 108/2 = 54Mhz
    */
 
+  #if ENABLED(SD_SPI_DMA)
+
+    #include "pinconfig.h"
+
+    /**
+     * SD block transfers on the RX and TX DMA streams of the card's SPI, polled
+     * to completion. The streams are taken by the first spiInit() unless another
+     * driver (e.g. SERIAL_DMA on USART3 or UART4) has already set them up.
+     */
+    struct spi_dma_stream_t {
+      DMA_Stream_TypeDef *stream;
+      volatile uint32_t *isr, *ifcr;
+      uint8_t shift, channel;        // Flag bits position in ISR/IFCR, request channel
+    };
+
+    typedef struct {
+      SPI_TypeDef *spi;
+      spi_dma_stream_t rx, tx;
+    } spi_dma_t;
+
+    #define _DMA_SHIFT(S) (((S) & 1) * 6 + ((S) & 2) * 8)
+    #define _DMA_STREAM(D,S,C) { DMA##D##_Stream##S, (S) < 4 ? &DMA##D->LISR : &DMA##D->HISR, (S) < 4 ? &DMA##D->LIFCR : &DMA##D->HIFCR, _DMA_SHIFT(S), C }
+
+    static const spi_dma_t spi_dma[] = {
+      { SPI1, _DMA_STREAM(2, 0, 3), _DMA_STREAM(2, 3, 3) },
+      { SPI2, _DMA_STREAM(1, 3, 0), _DMA_STREAM(1, 4, 0) },
+      #ifdef SPI3
+        { SPI3, _DMA_STREAM(1, 0, 0), _DMA_STREAM(1, 5, 0) },
+      #endif
+    };
+
+    static const spi_dma_t *sd_dma;   // nullptr for polled transfers
+    static bool sd_dma_claimed;       // = false
+    static uint8_t dma_ones = 0xFF, dma_sink;
+
+    static void sd_dma_claim() {
+      sd_dma_claimed = true;
+      SPI_TypeDef * const spi = (SPI_TypeDef *)pinmap_peripheral(digitalPinToPinName(SD_SCK_PIN), PinMap_SPI_SCLK);
+      LOOP_L_N(i, COUNT(spi_dma)) {
+        const spi_dma_t &d = spi_dma[i];
+        if (d.spi != spi) continue;
+        if (d.rx.ifcr == &DMA2->LIFCR) __HAL_RCC_DMA2_CLK_ENABLE(); else __HAL_RCC_DMA1_CLK_ENABLE();
+        if (d.rx.stream->CR || d.tx.stream->CR) return;   // Set up by another driver
+        sd_dma = &d;
+      }
+    }
+
+    // The DMA controllers can't reach core coupled RAM
+    static bool dma_can_reach(const void * const p) {
+      #ifdef CCMDATARAM_BASE
+        return !WITHIN(uint32_t(p), CCMDATARAM_BASE, CCMDATARAM_END);
+      #else
+        UNUSED(p);
+        return true;
+      #endif
+    }
+
+    static void dma_start(const spi_dma_stream_t &d, const void * const mem, const uint16_t n, const uint32_t mode) {
+      DMA_Stream_TypeDef * const s = d.stream;
+      *d.ifcr = 0x3DUL << d.shift;                  // Clear all stream flags
+      s->PAR = uint32_t(&sd_dma->spi->DR);
+      s->M0AR = uint32_t(mem);
+      s->NDTR = n;
+      s->FCR = 0;                                   // Direct mode
+      s->CR = (uint32_t(d.channel) << DMA_SxCR_CHSEL_Pos)
+            | DMA_SxCR_PL_1                         // High priority
+            | mode | DMA_SxCR_EN;
+    }
+
+    // Clock n bytes both ways. A null tx sends 0xFF and a null rx drops what comes back.
+    static void sd_dma_transfer(const uint8_t * const tx, uint8_t * const rx, const uint16_t n) {
+      SPI_TypeDef * const spi = sd_dma->spi;
+      while (!(spi->SR & SPI_SR_TXE) || (spi->SR & SPI_SR_BSY)) { /* nada */ }
+      (void)spi->DR;                                // Drop any stale byte
+      spi->CR1 |= SPI_CR1_SPE;
+      dma_start(sd_dma->rx, rx ?: &dma_sink, n, rx ? DMA_SxCR_MINC : 0);
+      spi->CR2 |= SPI_CR2_RXDMAEN;                  // RX first, so no byte is missed
+      dma_start(sd_dma->tx, tx ?: &dma_ones, n, DMA_SxCR_DIR_0 | (tx ? DMA_SxCR_MINC : 0));
+      spi->CR2 |= SPI_CR2_TXDMAEN;
+      const uint32_t tcif = DMA_LISR_TCIF0 << sd_dma->rx.shift;
+      while (!(*sd_dma->rx.isr & tcif)) { /* nada */ }
+      spi->CR2 &= ~(SPI_CR2_RXDMAEN | SPI_CR2_TXDMAEN);
+    }
+
+  #endif // SD_SPI_DMA
+
   /**
    * @brief  Begin SPI port setup
    *
@@ -156,7 +242,7 @@ static SPISettings spiConfig;
     // Use datarates Marlin uses
     uint32_t clock;
     switch (spiRate) {
-      case SPI_FULL_SPEED:    clock = 20000000; break; // 13.9mhz=20000000  6.75mhz=10000000  3.38mhz=5000000  .833mhz=1000000
+      case SPI_FULL_SPEED:    clock = TERN(SD_SPI_DMA, SD_SPI_DMA_CLOCK, 20000000); break; // 13.9mhz=20000000  6.75mhz=10000000  3.38mhz=5000000  .833mhz=1000000
       case SPI_HALF_SPEED:    clock =  5000000; break;
       case SPI_QUARTER_SPEED: clock =  2500000; break;
       case SPI_EIGHTH_SPEED:  clock =  1250000; break;
@@ -172,6 +258,11 @@ static SPISettings spiConfig;
     SPI.setSCLK(SD_SCK_PIN);
 
     SPI.begin();
+
+    #if ENABLED(SD_SPI_DMA)
+      SPI.beginTransaction(spiConfig);  // begin() alone keeps the library's default clock
+      if (!sd_dma_claimed) sd_dma_claim();
+    #endif
   }
 
   /**
@@ -197,6 +288,9 @@ static SPISettings spiConfig;
    */
   void spiRead(uint8_t *buf, uint16_t nbyte) {
     if (nbyte == 0) return;
+    #if ENABLED(SD_SPI_DMA)
+      if (sd_dma && nbyte >= 16 && dma_can_reach(buf)) return sd_dma_transfer(nullptr, buf, nbyte);
+    #endif
     memset(buf, 0xFF, nbyte);
     SPI.transfer(buf, nbyte);
   }
@@ -221,8 +315,11 @@ static SPISettings spiConfig;
    * @details Use DMA
    */
   void spiSendBlock(uint8_t token, const uint8_t *buf) {
-    uint8_t rxBuf[512];
     SPI.transfer(token);
+    #if ENABLED(SD_SPI_DMA)
+      if (sd_dma && dma_can_reach(buf)) return sd_dma_transfer(buf, nullptr, 512);
+    #endif
+    uint8_t rxBuf[512];
     SPI.transfer((uint8_t*)buf, &rxBuf, 512);
   }
 
@@ -79,6 +79,9 @@
 
 void MarlinSerial::begin(unsigned long baud, uint8_t config) {
   HardwareSerial::begin(baud, config);
+  #if ENABLED(SERIAL_DMA)
+    if (start_dma()) return;      // DMA fills the RX buffer with no interrupt per byte
+  #endif
   // Replace the IRQ callback with the one we have defined
   TERN_(EMERGENCY_PARSER, _serial.rx_callback = _rx_callback);
 }
@@ -107,4 +110,171 @@ void MarlinSerial::_rx_complete_irq(serial_t *obj) {
   }
 }
 
+#if ENABLED(SERIAL_DMA)
+
+  // USART RX and TX requests on STM32F4 / F7, with the flags clear register of each stream.
+  // A stream serves the first port to claim it. The other ports keep their interrupts.
+  struct dma_stream_t {
+    DMA_Stream_TypeDef *stream;
+    volatile uint32_t *ifcr;
+    uint32_t flags;
+    uint8_t channel;
+  };
+
+  typedef struct {
+    USART_TypeDef *uart;
+    dma_stream_t rx, tx;
+  } uart_dma_t;
+
+  #define _DMA_FLAGS(S) (0x3DUL << ((S) & 1) * 6 << ((S) & 2) * 8)
+  #define _DMA_STREAM(D,S,C) { DMA##D##_Stream##S, (S) < 4 ? &DMA##D->LIFCR : &DMA##D->HIFCR, _DMA_FLAGS(S), C }
+
+  static const uart_dma_t uart_dma[] = {
+    { USART1, _DMA_STREAM(2, 5, 4), _DMA_STREAM(2, 7, 4) },
+    { USART2, _DMA_STREAM(1, 5, 4), _DMA_STREAM(1, 6, 4) },
+    #ifdef USART3
+      { USART3, _DMA_STREAM(1, 1, 4), _DMA_STREAM(1, 3, 4) },
+    #endif
+    #ifdef UART4
+      { UART4,  _DMA_STREAM(1, 2, 4), _DMA_STREAM(1, 4, 4) },
+    #endif
+    #ifdef UART5
+      { UART5,  _DMA_STREAM(1, 0, 4), _DMA_STREAM(1, 7, 4) },
+    #endif
+    #if defined(USART6) && ENABLED(STEP_DMA)
+      { USART6, { nullptr }, _DMA_STREAM(2, 7, 5) },  // STEP_DMA takes both streams USART6 RX could use
+    #elif defined(USART6)
+      { USART6, _DMA_STREAM(2, 1, 5), _DMA_STREAM(2, 7, 5) },
+    #endif
+    #ifdef UART7
+      { UART7,  _DMA_STREAM(1, 3, 5), _DMA_STREAM(1, 1, 5) },
+    #endif
+    #ifdef UART8
+      { UART8,  _DMA_STREAM(1, 6, 5), _DMA_STREAM(1, 0, 5) },
+    #endif
+  };
+
+  static MarlinSerial *dma_port[COUNT(uart_dma)];
+  static uint8_t dma_port_count; // = 0
+  static DMA_Stream_TypeDef *claimed_stream[2 * COUNT(uart_dma)];
+  static uint8_t claimed_count; // = 0
+
+  // Claim a stream and set it up for byte transfers to or from a USART data register
+  static bool claim_stream(const dma_stream_t &d, USART_TypeDef * const uart, const uint32_t mode) {
+    DMA_Stream_TypeDef * const s = d.stream;
+    if (!s) return false;
+    LOOP_L_N(i, claimed_count) if (claimed_stream[i] == s) return false;
+    claimed_stream[claimed_count++] = s;
+
+    if (d.ifcr == &DMA2->LIFCR || d.ifcr == &DMA2->HIFCR) __HAL_RCC_DMA2_CLK_ENABLE(); else __HAL_RCC_DMA1_CLK_ENABLE();
+
+    s->CR = 0;
+    while (s->CR & DMA_SxCR_EN) { /* nada */ }
+    *d.ifcr = d.flags;                            // Clear all stream flags
+    #ifdef USART_RDR_RDR
+      s->PAR = uint32_t(mode & DMA_SxCR_DIR_0 ? &uart->TDR : &uart->RDR);
+    #else
+      s->PAR = uint32_t(&uart->DR);
+    #endif
+    s->FCR = 0;                                   // Direct mode
+    s->CR = (uint32_t(d.channel) << DMA_SxCR_CHSEL_Pos)
+          | DMA_SxCR_PL_1                         // High priority
+          | DMA_SxCR_MINC                         // Bytes, walking through memory
+          | mode;
+    return true;
+  }
+
+  bool MarlinSerial::start_dma() {
+    USART_TypeDef * const uart = (USART_TypeDef *)_serial.uart;
+    const uart_dma_t *d = nullptr;
+    LOOP_L_N(i, COUNT(uart_dma)) if (uart_dma[i].uart == uart) { d = &uart_dma[i]; break; }
+    if (!d) return false;
+
+    if (claim_stream(d->tx, uart, DMA_SxCR_DIR_0)) {  // Memory to peripheral, one chunk at a time
+      tx_dma = &d->tx;
+      tx_sending = 0;
+      uart->CR3 |= USART_CR3_DMAT;
+    }
+
+    if (claim_stream(d->rx, uart, DMA_SxCR_CIRC)) {   // Peripheral to memory, wrapping around the RX buffer
+      // Stop the byte-wise reception started by HardwareSerial::begin
+      HAL_UART_AbortReceive(&_serial.handle);
+      _serial.rx_head = _serial.rx_tail = 0;
+      DMA_Stream_TypeDef * const s = d->rx.stream;
+      s->M0AR = uint32_t(_serial.rx_buff);
+      s->NDTR = SERIAL_RX_BUFFER_SIZE;
+      uart->CR3 |= USART_CR3_DMAR;
+      s->CR |= DMA_SxCR_EN;
+      rx_stream = s;
+      TERN_(EMERGENCY_PARSER, rx_scanned = 0);
+    }
+
+    if (!rx_stream && !tx_dma) return false;
+    dma_port[dma_port_count++] = this;
+    return rx_stream;
+  }
+
+  int MarlinSerial::available() { update_rx_head(); return HardwareSerial::available(); }
+  int MarlinSerial::peek()      { update_rx_head(); return HardwareSerial::peek(); }
+  int MarlinSerial::read()      { update_rx_head(); return HardwareSerial::read(); }
+
+  // Retire the finished chunk and start the next one. Safe to call from the main loop and from the ISR.
+  void MarlinSerial::service_tx_dma() {
+    const uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    DMA_Stream_TypeDef * const s = tx_dma->stream;
+    if (!(s->CR & DMA_SxCR_EN)) {
+      _serial.tx_tail = (_serial.tx_tail + tx_sending) % SERIAL_TX_BUFFER_SIZE;
+      const tx_buffer_index_t head = _serial.tx_head, tail = _serial.tx_tail;
+      tx_sending = (head >= tail ? head : SERIAL_TX_BUFFER_SIZE) - tail;
+      if (tx_sending) {
+        *tx_dma->ifcr = tx_dma->flags;
+        s->M0AR = uint32_t(&_serial.tx_buff[tail]);
+        s->NDTR = tx_sending;
+        s->CR |= DMA_SxCR_EN;
+      }
+    }
+    __set_PRIMASK(primask);
+  }
+
+  // Buffer bytes and send whole lines in one DMA transfer. The Temperature ISR sends the rest.
+  size_t MarlinSerial::write(uint8_t c) {
+    if (!tx_dma) return HardwareSerial::write(c);
+    const tx_buffer_index_t i = (_serial.tx_head + 1) % SERIAL_TX_BUFFER_SIZE;
+    while (i == _serial.tx_tail) service_tx_dma();  // Wait for room
+    _serial.tx_buff[_serial.tx_head] = c;
+    _serial.tx_head = i;
+    if (c == '\n') service_tx_dma();
+    return 1;
+  }
+
+  size_t MarlinSerial::write(const uint8_t *buffer, size_t size) {
+    LOOP_L_N(i, size) write(buffer[i]);
+    return size;
+  }
+
+  void MarlinSerial::flush() {
+    if (!tx_dma) return HardwareSerial::flush();
+    while (tx_sending || _serial.tx_head != _serial.tx_tail) service_tx_dma();
+  }
+
+  // Called by the Temperature ISR (~1kHz). Send any partial line and let
+  // M108 / M112 / M410 / M876 act while the command queue is blocked.
+  void MarlinSerial::dma_poll() {
+    LOOP_L_N(p, dma_port_count) {
+      MarlinSerial &ser = *dma_port[p];
+      if (ser.tx_dma) ser.service_tx_dma();
+      #if ENABLED(EMERGENCY_PARSER)
+        if (!ser.rx_stream) continue;
+        const rx_buffer_index_t head = (SERIAL_RX_BUFFER_SIZE - ser.rx_stream->NDTR) % SERIAL_RX_BUFFER_SIZE;
+        while (ser.rx_scanned != head) {
+          emergency_parser.update(static_cast<MSerialT*>(&ser)->emergency_state, ser._serial.rx_buff[ser.rx_scanned]);
+          ser.rx_scanned = (ser.rx_scanned + 1) % SERIAL_RX_BUFFER_SIZE;
+        }
+      #endif
+    }
+  }
+
+#endif // SERIAL_DMA
+
 #endif // HAL_STM32
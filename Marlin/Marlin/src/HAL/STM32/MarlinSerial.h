@@ -31,6 +31,10 @@
 
 typedef void (*usart_rx_callback_t)(serial_t * obj);
 
+#if ENABLED(SERIAL_DMA)
+  struct dma_stream_t;
+#endif
+
 struct MarlinSerial : public HardwareSerial {
   MarlinSerial(void *peripheral, usart_rx_callback_t rx_callback) :
       HardwareSerial(peripheral), _rx_callback(rx_callback)
@@ -41,8 +45,38 @@ struct MarlinSerial : public HardwareSerial {
 
   void _rx_complete_irq(serial_t *obj);
 
+  #if ENABLED(SERIAL_DMA)
+    // Bring the RX head up to the DMA write position first
+    int available() override;
+    int peek() override;
+    int read() override;
+
+    // Send buffered output in DMA chunks
+    using HardwareSerial::write;
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t *buffer, size_t size) override;
+    void flush() override;
+
+    // Send pending output and feed new input to the emergency parser
+    static void dma_poll();
+  #endif
+
 protected:
   usart_rx_callback_t _rx_callback;
+
+  #if ENABLED(SERIAL_DMA)
+    DMA_Stream_TypeDef *rx_stream = nullptr;  // Circular RX stream, if this port has one
+    const dma_stream_t *tx_dma = nullptr;     // TX stream, if this port has one
+    volatile tx_buffer_index_t tx_sending = 0; // Bytes in the current TX transfer
+    bool start_dma();
+    void service_tx_dma();
+    void update_rx_head() {
+      if (rx_stream) _serial.rx_head = (SERIAL_RX_BUFFER_SIZE - rx_stream->NDTR) % SERIAL_RX_BUFFER_SIZE;
+    }
+    #if ENABLED(EMERGENCY_PARSER)
+      rx_buffer_index_t rx_scanned = 0;       // Bytes up to here were seen by the emergency parser
+    #endif
+  #endif
 };
 
 typedef Serial1Class<MarlinSerial> MSerialT;
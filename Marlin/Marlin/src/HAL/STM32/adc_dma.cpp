@@ -0,0 +1,116 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include "../platforms.h"
+
+#ifdef HAL_STM32
+
+#include "../../inc/MarlinConfig.h"
+#include "../shared/Delay.h"
+
+#if ENABLED(ADC_SCAN_DMA)
+
+/**
+ * Continuous ADC1 scan of all enabled analog pins (ADC_SCAN_DMA)
+ *
+ * ADC1 converts the enabled channels in a regular sequence, over and over,
+ * at a fixed sample time. DMA2 Stream4 (channel 0) copies the results into a
+ * circular buffer holding the last ADC_SCAN_DMA_SCANS scans, so adc_start()
+ * only averages buffered values and never waits for a conversion.
+ * Pins that ADC1 can't reach are still read with analogRead().
+ */
+
+#define ADC_SCAN_MAX_CHANNELS 16        // Length of the ADC1 regular sequence
+
+static pin_t scan_pin[ADC_SCAN_MAX_CHANNELS];
+static uint8_t scan_count; // = 0
+static volatile uint16_t scan_buffer[ADC_SCAN_DMA_SCANS * ADC_SCAN_MAX_CHANNELS];
+
+// Stop the scan, program the sequence for the current pins and start it again
+static void scan_restart() {
+  DMA_Stream_TypeDef * const s = DMA2_Stream4;
+
+  ADC1->CR2 = 0;
+  s->CR = 0;
+  while (s->CR & DMA_SxCR_EN) { /* nada */ }
+  DMA2->HIFCR = 0x3DUL;                          // Clear Stream4 flags
+
+  if (!scan_count) return;
+
+  // Regular sequence, six channels per SQR register starting from SQR3
+  ADC1->SQR1 = ADC1->SQR2 = ADC1->SQR3 = 0;
+  LOOP_L_N(i, scan_count) {
+    const uint32_t ch = STM_PIN_CHANNEL(pinmap_function(digitalPinToPinName(scan_pin[i]), PinMap_ADC));
+    volatile uint32_t * const sqr = i < 6 ? &ADC1->SQR3 : i < 12 ? &ADC1->SQR2 : &ADC1->SQR1;
+    *sqr |= ch << (5 * (i % 6));
+    // Longest sample time (480 cycles) for the high impedance thermistor dividers
+    if (ch < 10) ADC1->SMPR2 |= 7UL << (3 * ch); else ADC1->SMPR1 |= 7UL << (3 * (ch - 10));
+  }
+  ADC1->SQR1 |= uint32_t(scan_count - 1) << ADC_SQR1_L_Pos;
+
+  s->PAR = uint32_t(&ADC1->DR);
+  s->M0AR = uint32_t(scan_buffer);
+  s->NDTR = ADC_SCAN_DMA_SCANS * scan_count;
+  s->FCR = 0;                                    // Direct mode
+  s->CR = (0UL << DMA_SxCR_CHSEL_Pos)            // Channel 0: ADC1
+        | DMA_SxCR_PL_0                          // Medium priority
+        | DMA_SxCR_MSIZE_0 | DMA_SxCR_PSIZE_0    // 16-bit halfwords
+        | DMA_SxCR_MINC | DMA_SxCR_CIRC;         // Peripheral to memory, wrapping
+  s->CR |= DMA_SxCR_EN;
+
+  ADC1->CR1 = ADC_CR1_SCAN;                      // 12-bit, scan the sequence
+  ADC1->CR2 = ADC_CR2_ADON | ADC_CR2_CONT | ADC_CR2_DMA | ADC_CR2_DDS;
+  DELAY_US(3);                                   // ADC power-up time
+  ADC1->CR2 |= ADC_CR2_SWSTART;
+}
+
+void MarlinHAL::adc_init() {
+  analogReadResolution(HAL_ADC_RESOLUTION);
+  __HAL_RCC_ADC1_CLK_ENABLE();
+  __HAL_RCC_DMA2_CLK_ENABLE();
+  ADC->CCR = (ADC->CCR & ~ADC_CCR_ADCPRE) | ADC_CCR_ADCPRE_0;   // PCLK2 / 4
+  ADC1->SMPR1 = ADC1->SMPR2 = 0;
+}
+
+void MarlinHAL::adc_enable(const pin_t pin) {
+  const PinName pn = digitalPinToPinName(pin);
+  if (scan_count >= ADC_SCAN_MAX_CHANNELS || pinmap_peripheral(pn, PinMap_ADC) != ADC1) {
+    pinMode(pin, INPUT);
+    return;
+  }
+  LOOP_L_N(i, scan_count) if (scan_pin[i] == pin) return;
+  pinmap_pinout(pn, PinMap_ADC);
+  scan_pin[scan_count++] = pin;
+  scan_restart();
+}
+
+void MarlinHAL::adc_start(const pin_t pin) {
+  LOOP_L_N(i, scan_count) if (scan_pin[i] == pin) {
+    uint32_t sum = 0;
+    for (uint16_t n = i; n < ADC_SCAN_DMA_SCANS * scan_count; n += scan_count) sum += scan_buffer[n];
+    adc_result = (sum + (ADC_SCAN_DMA_SCANS) / 2) / (ADC_SCAN_DMA_SCANS);
+    return;
+  }
+  adc_result = analogRead(pin);
+}
+
+#endif // ADC_SCAN_DMA
+#endif // HAL_STM32
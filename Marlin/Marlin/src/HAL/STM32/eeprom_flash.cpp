@@ -198,7 +198,8 @@ bool PersistentStore::access_finish() {
 
       while (address < address_end) {
         memcpy(&data, ram_eeprom + offset, sizeof(uint32_t));
-        status = HAL_FLASH_Program(FLASH_TYPEPROGRAM_WORD, address, data);
+        // The slot is erased, so words left blank don't need programming
+        status = data == EMPTY_UINT32 ? HAL_OK : HAL_FLASH_Program(FLASH_TYPEPROGRAM_WORD, address, data);
         if (status == HAL_OK) {
           address += sizeof(uint32_t);
           offset += sizeof(uint32_t);
@@ -242,34 +243,43 @@ bool PersistentStore::access_finish() {
 }
 
 bool PersistentStore::write_data(int &pos, const uint8_t *value, size_t size, uint16_t *crc) {
-  while (size--) {
-    uint8_t v = *value;
-    #if ENABLED(FLASH_EEPROM_LEVELING)
-      if (v != ram_eeprom[pos]) {
-        ram_eeprom[pos] = v;
-        eeprom_data_written = true;
-      }
-    #else
+  #if ENABLED(FLASH_EEPROM_LEVELING)
+    // The image is directly addressable, so handle the whole field at once
+    if (memcmp(&ram_eeprom[pos], value, size)) {
+      memcpy(&ram_eeprom[pos], value, size);
+      eeprom_data_written = true;
+    }
+    crc16(crc, value, size);
+    pos += size;
+  #else
+    while (size--) {
+      uint8_t v = *value;
       if (v != eeprom_buffered_read_byte(pos)) {
         eeprom_buffered_write_byte(pos, v);
         eeprom_data_written = true;
       }
-    #endif
-    crc16(crc, &v, 1);
-    pos++;
-    value++;
-  }
+      crc16(crc, &v, 1);
+      pos++;
+      value++;
+    }
+  #endif
   return false;
 }
 
 bool PersistentStore::read_data(int &pos, uint8_t *value, size_t size, uint16_t *crc, const bool writing/*=true*/) {
-  do {
-    const uint8_t c = TERN(FLASH_EEPROM_LEVELING, ram_eeprom[pos], eeprom_buffered_read_byte(pos));
-    if (writing) *value = c;
-    crc16(crc, &c, 1);
-    pos++;
-    value++;
-  } while (--size);
+  #if ENABLED(FLASH_EEPROM_LEVELING)
+    if (writing) memcpy(value, &ram_eeprom[pos], size);
+    crc16(crc, &ram_eeprom[pos], size);
+    pos += size;
+  #else
+    do {
+      const uint8_t c = eeprom_buffered_read_byte(pos);
+      if (writing) *value = c;
+      crc16(crc, &c, 1);
+      pos++;
+      value++;
+    } while (--size);
+  #endif
   return false;
 }
 
@@ -45,36 +45,148 @@ size_t PersistentStore::capacity() { return MARLIN_EEPROM_SIZE; }
 #define _ALIGN(x) __attribute__ ((aligned(x)))
 static char _ALIGN(4) HAL_eeprom_data[MARLIN_EEPROM_SIZE];
 
+#if ENABLED(SDCARD_EEPROM_LOG)
+
+  /**
+   * Changes since the last full write of EEPROM_FILENAME are appended to
+   * EEPROM_LOGNAME as records holding one chunk of the image. A record is
+   * only applied if its CRC is good and its sequence number follows the one
+   * before, so a torn write at the end of the log is ignored. When the log
+   * fills up the image is written out in full and the log is emptied.
+   */
+  #define EEPROM_LOGNAME "eeprom.log"
+  #define EEPROM_CHUNK SDCARD_EEPROM_LOG_CHUNK
+  #define EEPROM_CHUNKS ((MARLIN_EEPROM_SIZE) / (EEPROM_CHUNK))
+
+  typedef struct {
+    uint16_t seq;                 // Counts up from 0 in each log
+    uint16_t chunk;               // Chunk index in the image
+    uint8_t data[EEPROM_CHUNK];
+    uint16_t crc;                 // CRC of all the fields above
+  } eeprom_record_t;
+
+  static uint8_t eeprom_dirty[(EEPROM_CHUNKS + 7) / 8];
+  static uint16_t eeprom_log_seq;   // Sequence number of the next record
+  static uint32_t eeprom_log_size;  // Bytes in the log
+  static bool eeprom_log_valid;     // False to write the whole image next time
+
+  static uint16_t record_crc(const eeprom_record_t &r) {
+    uint16_t crc = 0;
+    crc16(&crc, &r, offsetof(eeprom_record_t, crc));
+    return crc;
+  }
+
+  // Apply the valid records of the log
+  static void read_log(SdFile &root) {
+    eeprom_log_seq = 0;
+    eeprom_log_size = 0;
+    eeprom_log_valid = true;
+    SdFile log;
+    if (!log.open(&root, EEPROM_LOGNAME, O_RDONLY)) return;
+    eeprom_record_t r;
+    while (log.read(&r, sizeof(r)) == sizeof(r)) {
+      if (r.seq != eeprom_log_seq || r.chunk >= EEPROM_CHUNKS || r.crc != record_crc(r)) break;
+      memcpy(&HAL_eeprom_data[r.chunk * (EEPROM_CHUNK)], r.data, EEPROM_CHUNK);
+      eeprom_log_seq++;
+      eeprom_log_size += sizeof(r);
+    }
+    // Records after a bad one would be lost, so start over on the next write
+    eeprom_log_valid = eeprom_log_size == log.fileSize();
+    log.close();
+  }
+
+  // Write the whole image, then empty the log
+  static bool write_image(SdFile &root) {
+    SdFile file;
+    int bytes_written = 0;
+    if (file.open(&root, EEPROM_FILENAME, O_CREAT | O_WRITE | O_TRUNC)) {
+      bytes_written = file.write(HAL_eeprom_data, MARLIN_EEPROM_SIZE);
+      file.close();
+    }
+    if (bytes_written != MARLIN_EEPROM_SIZE) return false;
+    // Left over records are harmless, the image already includes them
+    if (file.open(&root, EEPROM_LOGNAME, O_WRITE | O_TRUNC)) file.close();
+    eeprom_log_seq = 0;
+    eeprom_log_size = 0;
+    eeprom_log_valid = true;
+    return true;
+  }
+
+  // Append a record for each changed chunk
+  static bool write_log(SdFile &root) {
+    SdFile log;
+    if (!log.open(&root, EEPROM_LOGNAME, O_CREAT | O_WRITE | O_APPEND)) return false;
+    eeprom_record_t r;
+    bool ok = true;
+    for (uint16_t i = 0; ok && i < EEPROM_CHUNKS; i++) {
+      if (!TEST(eeprom_dirty[i >> 3], i & 7)) continue;
+      r.seq = eeprom_log_seq;
+      r.chunk = i;
+      memcpy(r.data, &HAL_eeprom_data[i * (EEPROM_CHUNK)], EEPROM_CHUNK);
+      r.crc = record_crc(r);
+      ok = log.write(&r, sizeof(r)) == sizeof(r);
+      if (ok) { eeprom_log_seq++; eeprom_log_size += sizeof(r); }
+    }
+    if (!log.close()) ok = false;
+    if (!ok) eeprom_log_valid = false;  // Don't append after a torn record
+    return ok;
+  }
+
+#endif // SDCARD_EEPROM_LOG
+
 bool PersistentStore::access_start() {
   if (!card.isMounted()) return false;
 
   SdFile file, root = card.getroot();
-  if (!file.open(&root, EEPROM_FILENAME, O_RDONLY))
+  TERN_(SDCARD_EEPROM_LOG, ZERO(eeprom_dirty));
+  if (!file.open(&root, EEPROM_FILENAME, O_RDONLY)) {
+    TERN_(SDCARD_EEPROM_LOG, eeprom_log_valid = false); // Don't append to a stale log
     return true;
+  }
 
   int bytes_read = file.read(HAL_eeprom_data, MARLIN_EEPROM_SIZE);
   if (bytes_read < 0) return false;
   for (; bytes_read < MARLIN_EEPROM_SIZE; bytes_read++)
     HAL_eeprom_data[bytes_read] = 0xFF;
   file.close();
+  TERN_(SDCARD_EEPROM_LOG, read_log(root));
   return true;
 }
 
 bool PersistentStore::access_finish() {
   if (!card.isMounted()) return false;
 
-  SdFile file, root = card.getroot();
-  int bytes_written = 0;
-  if (file.open(&root, EEPROM_FILENAME, O_CREAT | O_WRITE | O_TRUNC)) {
-    bytes_written = file.write(HAL_eeprom_data, MARLIN_EEPROM_SIZE);
-    file.close();
-  }
-  return (bytes_written == MARLIN_EEPROM_SIZE);
+  SdFile root = card.getroot();
+
+  #if ENABLED(SDCARD_EEPROM_LOG)
+    uint16_t count = 0;
+    LOOP_L_N(i, EEPROM_CHUNKS) if (TEST(eeprom_dirty[i >> 3], i & 7)) count++;
+    if (!count && eeprom_log_valid) return true;
+    // Append the changes, unless the log is full or they're most of the image
+    if (eeprom_log_valid && count <= (EEPROM_CHUNKS) / 2 && eeprom_log_size + count * sizeof(eeprom_record_t) <= SDCARD_EEPROM_LOG_SIZE)
+      return write_log(root);
+    return write_image(root);
+  #else
+    SdFile file;
+    int bytes_written = 0;
+    if (file.open(&root, EEPROM_FILENAME, O_CREAT | O_WRITE | O_TRUNC)) {
+      bytes_written = file.write(HAL_eeprom_data, MARLIN_EEPROM_SIZE);
+      file.close();
+    }
+    return (bytes_written == MARLIN_EEPROM_SIZE);
+  #endif
 }
 
 bool PersistentStore::write_data(int &pos, const uint8_t *value, size_t size, uint16_t *crc) {
-  for (size_t i = 0; i < size; i++)
+  for (size_t i = 0; i < size; i++) {
+    #if ENABLED(SDCARD_EEPROM_LOG)
+      if (HAL_eeprom_data[pos + i] != char(value[i])) {
+        const uint16_t c = (pos + i) / (EEPROM_CHUNK);
+        SBI(eeprom_dirty[c >> 3], c & 7);
+      }
+    #endif
     HAL_eeprom_data[pos + i] = value[i];
+  }
   crc16(crc, value, size);
   pos += size;
   return false;
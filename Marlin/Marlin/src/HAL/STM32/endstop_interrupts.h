@@ -27,6 +27,10 @@
 // One ISR for all EXT-Interrupts
 void endstop_ISR() { endstops.update(); }
 
+#if ENABLED(ENDSTOP_INTERRUPTS_BY_DIRECTION)
+  static uint16_t endstop_exti_lines; // EXTI lines of all the endstop pins
+#endif
+
 void setup_endstop_interrupts() {
   #define _ATTACH(P) attachInterrupt(P, endstop_ISR, CHANGE)
   TERN_(HAS_X_MAX, _ATTACH(X_MAX_PIN));
@@ -52,4 +56,55 @@ void setup_endstop_interrupts() {
   TERN_(HAS_J_MIN, _ATTACH(J_MIN_PIN));
   TERN_(HAS_K_MAX, _ATTACH(K_MAX_PIN));
   TERN_(HAS_K_MIN, _ATTACH(K_MIN_PIN));
+
+  #if ENABLED(ENDSTOP_INTERRUPTS_BY_DIRECTION)
+    // Mask them all until a block selects some
+    #define _LINE(P) SBI(endstop_exti_lines, STM_PIN(digitalPinToPinName(P)))
+    TERN_(HAS_X_MAX, _LINE(X_MAX_PIN));
+    TERN_(HAS_X_MIN, _LINE(X_MIN_PIN));
+    TERN_(HAS_Y_MAX, _LINE(Y_MAX_PIN));
+    TERN_(HAS_Y_MIN, _LINE(Y_MIN_PIN));
+    TERN_(HAS_Z_MAX, _LINE(Z_MAX_PIN));
+    TERN_(HAS_Z_MIN, _LINE(Z_MIN_PIN));
+    TERN_(HAS_Z_MIN_PROBE_PIN, _LINE(Z_MIN_PROBE_PIN));
+    EXTI->IMR &= ~endstop_exti_lines;
+  #endif
 }
+
+#if ENABLED(ENDSTOP_INTERRUPTS_BY_DIRECTION)
+
+  /**
+   * Pins with the same number on different ports share one EXTI line, so give
+   * each line to the port of the endstop that needs it and unmask only those.
+   * Return false if two wanted endstops need the same line and must be polled.
+   */
+  bool endstop_interrupts_select(const Endstops::endstop_mask_t want) {
+    uint16_t lines = 0;
+    bool ok = true;
+
+    auto select = [&](const pin_t pin) {
+      const PinName pn = digitalPinToPinName(pin);
+      const uint8_t line = STM_PIN(pn), port = STM_PORT(pn), shift = (line & 3) * 4;
+      volatile uint32_t &cr = SYSCFG->EXTICR[line >> 2];
+      if (TEST(lines, line)) {
+        if (((cr >> shift) & 0xF) != port) ok = false;
+        return;
+      }
+      cr = (cr & ~(0xFUL << shift)) | (uint32_t(port) << shift);
+      SBI(lines, line);
+    };
+
+    #define _SELECT(E) if (TEST(want, E)) select(E##_PIN)
+    TERN_(HAS_X_MIN, _SELECT(X_MIN));
+    TERN_(HAS_X_MAX, _SELECT(X_MAX));
+    TERN_(HAS_Y_MIN, _SELECT(Y_MIN));
+    TERN_(HAS_Y_MAX, _SELECT(Y_MAX));
+    TERN_(HAS_Z_MIN, _SELECT(Z_MIN));
+    TERN_(HAS_Z_MAX, _SELECT(Z_MAX));
+    TERN_(USES_Z_MIN_PROBE_PIN, _SELECT(Z_MIN_PROBE));
+
+    EXTI->IMR = (EXTI->IMR & ~endstop_exti_lines) | lines;
+    return ok;
+  }
+
+#endif
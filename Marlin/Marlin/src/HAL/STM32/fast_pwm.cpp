@@ -85,4 +85,44 @@ void MarlinHAL::set_pwm_frequency(const pin_t pin, const uint16_t f_desired) {
   timer_freq[index] = f_desired; // Save the last frequency so duty will not set the default for this timer number.
 }
 
+#if ENABLED(HEATER_HW_PWM)
+
+  bool MarlinHAL::pwm_channel_start(pwm_channel_t &pc, const pin_t pin, const uint16_t frequency, const bool invert/*=false*/) {
+    pc.ccr = nullptr;
+    if (!PWM_PIN(pin)) return false;
+    const PinName pin_name = digitalPinToPinName(pin);
+    TIM_TypeDef * const Instance = (TIM_TypeDef *)pinmap_peripheral(pin_name, PinMap_PWM);
+    const timer_index_t index = get_timer_index(Instance);
+
+    // Protect used timers.
+    #ifdef STEP_TIMER
+      if (index == TIMER_INDEX(STEP_TIMER)) return false;
+    #endif
+    #ifdef TEMP_TIMER
+      if (index == TIMER_INDEX(TEMP_TIMER)) return false;
+    #endif
+    #if defined(PULSE_TIMER) && MF_TIMER_PULSE != MF_TIMER_STEP
+      if (index == TIMER_INDEX(PULSE_TIMER)) return false;
+    #endif
+
+    if (HardwareTimer_Handle[index] == nullptr)
+      HardwareTimer_Handle[index]->__this = new HardwareTimer(Instance);
+    HardwareTimer * const HT = (HardwareTimer *)(HardwareTimer_Handle[index]->__this);
+    const uint32_t channel = STM_PIN_CHANNEL(pinmap_function(pin_name, PinMap_PWM));
+
+    // PWM2 is high once the counter passes the compare value, giving an inverted output
+    HT->setMode(channel, invert ? TIMER_OUTPUT_COMPARE_PWM2 : TIMER_OUTPUT_COMPARE_PWM1, pin);
+    HT->setOverflow(frequency, HERTZ_FORMAT);
+    timer_freq[index] = frequency;
+    HT->setCaptureCompare(channel, 0, TICK_COMPARE_FORMAT);
+    pinmap_pinout(pin_name, PinMap_PWM);
+    HT->resume();
+
+    pc.top = Instance->ARR + 1;
+    pc.ccr = &Instance->CCR1 + (channel - 1);   // CCR1-CCR4 are consecutive
+    return true;
+  }
+
+#endif // HEATER_HW_PWM
+
 #endif // HAL_STM32
@@ -0,0 +1,180 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../platforms.h"
+
+#ifdef HAL_STM32
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(FF_FIRMWARE_UPDATE)
+
+#include "firmware_update.h"
+#include "../../MarlinCore.h"
+#include "../../sd/cardreader.h"
+#include "../../module/planner.h"
+#include "../../module/stepper.h"
+#include "../../module/temperature.h"
+#include "../../libs/crc32.h"
+
+#define APP_ADDR      0x08010000UL    // FLASH ORIGIN in the FF_F407ZG ldscript
+#define STAGING_ADDR  0x08080000UL
+#define STAGING_SIZE  0x00080000UL
+#define APP_MAX_SIZE  (STAGING_ADDR - APP_ADDR)
+
+static_assert(APP_MAX_SIZE <= STAGING_SIZE, "The staging sectors must hold the largest image.");
+
+extern "C" uint32_t _siccmram, _sccmram, _eccmram;  // The last load image in flash
+
+// Sector of a flash address: four of 16K, one of 64K, then 128K each
+static constexpr uint8_t flash_sector(const uint32_t addr) {
+  return addr < 0x08010000UL ? (addr - FLASH_BASE) / 0x4000
+       : addr < 0x08020000UL ? 4
+       : 5 + (addr - 0x08020000UL) / 0x20000;
+}
+
+//
+// Copy the staged image over the application and reset. It runs from RAM with
+// interrupts off, since it erases the code that called it, so it touches only
+// registers. The watchdog is fed while the flash is busy. If the copy doesn't
+// read back it's tried again, and the bootloader is never touched.
+//
+__attribute__((section(".RamFunc"), noinline, long_call))
+static void install_staged(const uint32_t words, const uint8_t first_sector, const uint8_t last_sector) {
+  #define FLASH_WAIT() do{ while (FLASH->SR & FLASH_SR_BSY) IWDG->KR = 0xAAAA; }while(0)
+  volatile uint32_t * const dst = (volatile uint32_t *)APP_ADDR;
+  const volatile uint32_t * const src = (const volatile uint32_t *)STAGING_ADDR;
+
+  for (uint8_t tries = 3; tries--;) {
+    for (uint8_t s = first_sector; s <= last_sector; s++) {
+      FLASH_WAIT();
+      FLASH->CR = FLASH_CR_PSIZE_1 | FLASH_CR_SER | (uint32_t(s) << FLASH_CR_SNB_Pos);
+      FLASH->CR |= FLASH_CR_STRT;
+    }
+    FLASH_WAIT();
+
+    FLASH->CR = FLASH_CR_PSIZE_1 | FLASH_CR_PG;
+    for (uint32_t i = 0; i < words; i++) { dst[i] = src[i]; FLASH_WAIT(); }
+    FLASH->CR = 0;
+
+    uint32_t i = 0;
+    while (i < words && dst[i] == src[i]) i++;
+    if (i == words) break;
+  }
+
+  __DSB();
+  SCB->AIRCR = (0x5FAUL << SCB_AIRCR_VECTKEY_Pos) | SCB_AIRCR_SYSRESETREQ_Msk;
+  __DSB();
+  for (;;) {}
+}
+
+//
+// Copy the image on the card to the staging sectors and check it there
+//
+bool FirmwareUpdate::stage(const uint32_t crc, uint32_t &size) {
+  SdFile root = card.getroot(), file;
+  if (!file.open(&root, FIRMWARE_UPDATE_FILE, O_RDONLY)) {
+    SERIAL_ERROR_MSG("Can't open " FIRMWARE_UPDATE_FILE);
+    return false;
+  }
+
+  size = file.fileSize();
+  uint32_t head[2];
+  const bool size_ok = size >= sizeof(head) && size <= APP_MAX_SIZE;
+  if (!size_ok || file.read(head, sizeof(head)) != sizeof(head)
+    || !WITHIN(head[0], 0x10000000UL, 0x20020000UL)             // Initial stack in CCM or RAM
+    || !WITHIN(head[1] & ~1UL, APP_ADDR, APP_ADDR + size - 1)     // Reset handler in the image
+  ) {
+    SERIAL_ERROR_MSG("Not a firmware image for this board");
+    file.close();
+    return false;
+  }
+
+  const uint32_t running_end = uint32_t(&_siccmram) + (uint32_t(&_eccmram) - uint32_t(&_sccmram));
+  if (running_end > STAGING_ADDR) {
+    SERIAL_ERROR_MSG("Running firmware overlaps the staging area");
+    file.close();
+    return false;
+  }
+
+  SERIAL_ECHO_MSG("Staging firmware, ", size, " bytes");
+
+  HAL_FLASH_Unlock();
+  __HAL_FLASH_CLEAR_FLAG(FLASH_FLAG_EOP | FLASH_FLAG_OPERR | FLASH_FLAG_WRPERR | FLASH_FLAG_PGAERR | FLASH_FLAG_PGPERR | FLASH_FLAG_PGSERR);
+
+  FLASH_EraseInitTypeDef erase;
+  erase.TypeErase = FLASH_TYPEERASE_SECTORS;
+  erase.VoltageRange = FLASH_VOLTAGE_RANGE_3;
+  erase.Sector = flash_sector(STAGING_ADDR);
+  erase.NbSectors = flash_sector(STAGING_ADDR + size - 1) - erase.Sector + 1;
+  uint32_t sector_error;
+  bool ok = HAL_FLASHEx_Erase(&erase, &sector_error) == HAL_OK;
+
+  // Program the staging sectors a word at a time, padding the last word
+  uint32_t file_crc = 0;
+  file.seekSet(0);
+  for (uint32_t addr = STAGING_ADDR; ok && addr < STAGING_ADDR + size;) {
+    uint32_t buf[64];
+    const int16_t n = file.read(buf, _MIN(uint32_t(sizeof(buf)), STAGING_ADDR + size - addr));
+    if (n <= 0) { ok = false; break; }
+    file_crc = crc32(file_crc, (uint8_t*)buf, n);
+    memset((uint8_t*)buf + n, 0xFF, sizeof(buf) - n);
+    for (int16_t i = 0; ok && i < n; i += 4, addr += 4)
+      ok = HAL_FLASH_Program(FLASH_TYPEPROGRAM_WORD, addr, buf[i / 4]) == HAL_OK;
+    hal.watchdog_refresh();
+  }
+  file.close();
+
+  // Check what's in flash, not just what was read
+  if (ok) ok = file_crc == crc && crc32(0, (const uint8_t*)STAGING_ADDR, size) == crc;
+  if (!ok) {
+    HAL_FLASH_Lock();
+    SERIAL_ERROR_MSG("Firmware staging failed or CRC mismatch");
+  }
+  return ok;
+}
+
+void FirmwareUpdate::install(const uint32_t crc) {
+  if (printingIsActive()) {
+    SERIAL_ERROR_MSG("Can't update while printing");
+    return;
+  }
+  if (!card.isMounted()) card.mount();
+  if (!card.isMounted()) return;
+
+  planner.synchronize();
+  thermalManager.disable_all_heaters();
+  stepper.disable_all_steppers();
+
+  uint32_t size;
+  if (!stage(crc, size)) return;
+
+  SERIAL_ECHO_MSG("Installing firmware. Don't power off.");
+  SERIAL_FLUSHTX();
+  safe_delay(100);
+
+  __disable_irq();
+  install_staged((size + 3) / 4, flash_sector(APP_ADDR), flash_sector(APP_ADDR + size - 1));
+}
+
+#endif // FF_FIRMWARE_UPDATE
+#endif // HAL_STM32
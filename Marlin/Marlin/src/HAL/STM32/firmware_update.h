@@ -0,0 +1,52 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * firmware_update.h - Install a firmware image from the SD card (FF_FIRMWARE_UPDATE)
+ *
+ * The raw image (firmware.bin, not the encrypted vendor file) is uploaded to the
+ * card, with M28 or BINARY_FILE_TRANSFER. 'M997 C<crc32>' copies it to the upper
+ * flash sectors and checks its size, vector table and CRC-32 (as zlib crc32).
+ * Only then is it copied over the application, by code running from RAM, and the
+ * board reset. Anything wrong up to that point leaves the running firmware alone.
+ *
+ * STM32F407 (1MB) layout:
+ *   0x08000000  Bootloader, 64K (sectors 0-3)
+ *   0x08010000  Application, 448K (sectors 4-7)
+ *   0x08080000  Staging, 512K (sectors 8-11)
+ */
+
+#include <stdint.h>
+
+#ifndef FIRMWARE_UPDATE_FILE
+  #define FIRMWARE_UPDATE_FILE "fwupdate.bin"
+#endif
+
+class FirmwareUpdate {
+public:
+  // Stage and check the image on the card, then install it and reset. Return only on failure.
+  static void install(const uint32_t crc);
+
+private:
+  static bool stage(const uint32_t crc, uint32_t &size);
+};
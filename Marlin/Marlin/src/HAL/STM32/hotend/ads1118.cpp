@@ -5,10 +5,12 @@
 
 #if HAS_SPI_ADS1118
 #include "ads1118.h"
-#include "thermocouple.h"
+#include "ktype.h"
 #include "pinconfig.h"
+#include "../shared_spi.h"
 
 static SPI_HandleTypeDef ads1118_spi = { 0 };
+volatile uint8_t SharedSPI::claims = 0;
 /* someone use DMA for transfer ? check if no active DMA transaction */
 static DMA_HandleTypeDef ads1118_dma_tx = { 0 };
 
@@ -56,7 +58,14 @@ static inline void spi_transfer_end( void )
 #define INTERNAL_T      ( 0x0072 | ENABLE_PULL_UP )
 
 #define MAX_CHANNELS    (2)
-#define USE_POLLING     0
+
+#if ENABLED( ADS1118_SCHEDULER )
+  /* Data rate field, bits 7:5. 64 SPS is what the configs above use. */
+  #define DR_MASK         ( 7 << 5 )
+  #define DR_CODE(SPS)    ( (SPS) >= 860 ? 7 : (SPS) >= 475 ? 6 : (SPS) >= 250 ? 5 : 4 )
+  #define FAST_DR         ( DR_CODE( ADS1118_FAST_SPS ) << 5 )
+  #define FAST_GATE_MS    _MAX( 900 / (ADS1118_FAST_SPS), 1 )
+#endif
 
 void ads1118_init( void )
 {
@@ -173,81 +182,192 @@ static int ads1118_adc_to_uv( uint16_t raw )
   /* negative unsupported */
   if( raw & 0x8000 )
     return 0;
-  /* (raw*256000)/32768 */
-  current_uv = (raw*1000)>>7;
+  /* (raw*256000)/32768, rounded */
+  current_uv = (raw*1000 + 64)>>7;
   /* open thermocouple ? 41276uV => 1000℃ */
   if( current_uv >= 41276 )
     return 0; /* show ambient only */
   return current_uv;
 }
 
-int ads1118_read_raw( int ch_id )
+/* Results from the sampler, converted on request */
+static volatile int raw_uv[MAX_CHANNELS] = { 0, 0 };
+static volatile int raw_it = 25000;
+static volatile bool raw_valid = false;
+
+#if ENABLED( ADS1118_SCHEDULER )
+
+  static volatile uint8_t active_ch = 0;
+  static volatile bool sample_fast = false;
+
+  /* Called with the new readings: the channel to favor and whether to go fast */
+  void ads1118_schedule( int ch_id, bool fast )
+  {
+    #if ENABLED( FF_EXTRUDER_SWAP )
+      ch_id ^= 1;
+    #endif
+    active_ch = ch_id & 1;
+    sample_fast = fast;
+  }
+
+  /* Keep the filter off open or shorted thermocouples, so they show at once */
+  static int ads1118_filter( int last_uv, int uv )
+  {
+    if( !sample_fast || !last_uv || !uv )
+      return uv;
+    return last_uv + ( ( uv - last_uv ) >> ( ADS1118_FAST_FILTER ) );
+  }
+
+#endif
+
+/*
+ * Called by the temperature ISR on every tick. Conversions are chained:
+ * each transaction reads the finished conversion and starts the next one
+ * (cold junction, channel 1, channel 2), so the ADC runs at its full rate.
+ * A conversion is read as soon as DOUT/DRDY goes low, instead of after a
+ * fixed delay from the main loop. Ticks that find the bus in use by touch
+ * or DMA are skipped.
+ *
+ * With ADS1118_SCHEDULER the cold junction is converted every
+ * ADS1118_CJ_INTERVAL, the idle channel once per ADS1118_ACTIVE_RATIO
+ * conversions of the active one, and everything at ADS1118_FAST_SPS
+ * while ads1118_schedule() asks for it.
+ */
+#if ENABLED( ADS1118_SCHEDULER )
+
+void ads1118_isr( void )
+{
+  /* The conversion in progress: 0 none, 1 cold junction, 2 channel 1, 3 channel 2 */
+  static uint8_t pending = 0, pending_gate = 14, slot = 0, valid = 0;
+  static millis_t start_ms = 0, cj_ms = 0;
+  int res = 0;
+
+  if( !ads1118_spi.Instance )
+    return;
+
+  if( spi_is_busy() || SharedSPI::busy() )
+    return;
+
+  const millis_t ms = millis();
+  if( pending && (ms-start_ms) < pending_gate )
+    return;
+
+  /* Pick the next conversion, counting the one in progress as read */
+  const uint8_t have = valid | ( pending ? 1 << (pending - 1) : 0 );
+  uint8_t next, next_slot = slot + 1;
+  if( !(have & 1) || (ms-cj_ms) >= ADS1118_CJ_INTERVAL )
+    next = 1;
+  else if( (have & 6) != 6 )
+    next = (have & 2) ? 3 : 2;
+  else if( next_slot > ADS1118_ACTIVE_RATIO )
+  {
+    next = 2 + ( active_ch ^ 1 );
+    next_slot = 0;
+  }
+  else
+    next = 2 + active_ch;
+
+  const bool fast = sample_fast;
+  uint16_t config = next == 1 ? INTERNAL_T : next == 2 ? CHANNEL_1_CFG : CHANNEL_2_CFG;
+  if( fast )
+    config = ( config & ~DR_MASK ) | FAST_DR;
+
+  res = ads1118_read_adc( config | START_SINGLE_SHOT, pending );
+  if( res < 0 )
+    return;
+
+  if( next == 1 )
+    cj_ms = ms;
+  else
+    slot = next_slot;
+
+  switch( pending )
+  {
+    case 1:
+      raw_it = ads1118_it_to_c( res & 0xFFFF );
+      break;
+    case 2:
+    case 3:
+      raw_uv[pending - 2] = ads1118_filter( raw_uv[pending - 2], ads1118_adc_to_uv( res & 0xFFFF ) );
+      break;
+  }
+  if( pending )
+  {
+    valid |= 1 << (pending - 1);
+    if( valid == 7 )
+      raw_valid = true;
+  }
+
+  pending = next;
+  pending_gate = fast ? FAST_GATE_MS : 14;
+  start_ms = ms;
+}
+
+#else // !ADS1118_SCHEDULER
+
+void ads1118_isr( void )
 {
-  static int16_t shadow_data[MAX_CHANNELS] = { 10, 10 };
   static int read_fsm = 0;
-  static int raw_it = 0, raw_ch = 0;
-#if ( USE_POLLING == 0 )
-  static millis_t delay_ms = 0;
-#endif
+  static millis_t start_ms = 0;
   int res;
 
-  #if ENABLED( FF_EXTRUDER_SWAP )
-    ch_id ^= 1;
-  #endif
-
   if( !ads1118_spi.Instance )
-    return shadow_data[ch_id];
+    return;
 
-  if( spi_is_busy() )
-    return shadow_data[ch_id];
+  if( spi_is_busy() || SharedSPI::busy() )
+    return;
 
-#if ( USE_POLLING == 0 )
-  /* 64 SPS, (15.625 + 10% + 0.020) ms */
-  if( (millis()-delay_ms) < 18u )
-    return shadow_data[ch_id];
-#endif
+  /* 64 SPS = 15.625ms, less the 10% oscillator tolerance */
+  if( read_fsm && (millis()-start_ms) < 14u )
+    return;
 
   switch( read_fsm )
   {
     default:
-      read_fsm = 0;
-    break;
     case 0:
       (void)ads1118_read_adc( INTERNAL_T | START_SINGLE_SHOT, 0 );
       read_fsm = 1;
       break;
     case 1:
-      res = ads1118_read_adc( CHANNEL_1_CFG | START_SINGLE_SHOT, USE_POLLING );
+      res = ads1118_read_adc( CHANNEL_1_CFG | START_SINGLE_SHOT, 1 );
       if( res < 0 )
-        break;
+        return;
       raw_it = ads1118_it_to_c( res & 0xFFFF );
       read_fsm = 2;
       break;
     case 2:
-      res = ads1118_read_adc( CHANNEL_2_CFG | START_SINGLE_SHOT, USE_POLLING );
+      res = ads1118_read_adc( CHANNEL_2_CFG | START_SINGLE_SHOT, 1 );
       if( res < 0 )
-        break;
-      raw_ch = ads1118_adc_to_uv( res & 0xFFFF );
-      res = thermocoupleConvertWithCJCompensation( raw_ch, raw_it ) / 100; /* in 0.1C */
-      shadow_data[0] = res;
+        return;
+      raw_uv[0] = ads1118_adc_to_uv( res & 0xFFFF );
       read_fsm = 3;
       break;
     case 3:
-      res = ads1118_read_adc( INTERNAL_T | START_SINGLE_SHOT, USE_POLLING );
+      res = ads1118_read_adc( INTERNAL_T | START_SINGLE_SHOT, 1 );
       if( res < 0 )
-        break;
-      raw_ch = ads1118_adc_to_uv( res & 0xFFFF );
-      res = thermocoupleConvertWithCJCompensation( raw_ch, raw_it ) / 100; /* in 0.1C */
-      shadow_data[1] = res;
+        return;
+      raw_uv[1] = ads1118_adc_to_uv( res & 0xFFFF );
+      raw_valid = true;
       read_fsm = 1;
       break;
   }
 
-#if ( USE_POLLING == 0 )
-  /* delay to next readout */
-  delay_ms = millis();
-#endif
-  return shadow_data[ch_id];
+  start_ms = millis();
+}
+
+#endif // !ADS1118_SCHEDULER
+
+int ads1118_read_raw( int ch_id )
+{
+  #if ENABLED( FF_EXTRUDER_SWAP )
+    ch_id ^= 1;
+  #endif
+
+  if( !raw_valid )
+    return 100;
+
+  /* in 0.01C, limited to the range of raw_adc_t (655.35C) */
+  return _MIN( KType::convert( raw_uv[ch_id], raw_it ), 65535L );
 }
 
 #endif
\ No newline at end of file
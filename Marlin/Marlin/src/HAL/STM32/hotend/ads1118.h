@@ -9,4 +9,8 @@
 #include "../../../inc/MarlinConfig.h"
 
 void ads1118_init( void );
+void ads1118_isr( void );
 int ads1118_read_raw( int ch_id );
+#if ENABLED( ADS1118_SCHEDULER )
+  void ads1118_schedule( int ch_id, bool fast );
+#endif
@@ -0,0 +1,107 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Type K thermocouple conversion with cold junction compensation
+ *
+ * Both directions are uniform-step tables built at compile time from the
+ * NIST ITS-90 polynomials, so a conversion is one shift to find the entry
+ * and one linear interpolation. Temperatures are in 0.01°C.
+ *
+ *  - KType::uv_to_c   thermocouple EMF (µV, 0..54886) to temperature
+ *  - KType::mc_to_uv  cold junction temperature (m°C, 0..127°C) to EMF
+ */
+
+#include <stdint.h>
+
+namespace KType {
+
+  // EMF table: one entry every 128µV (~3°C), interpolation error < 0.03°C
+  constexpr uint8_t  UV_SHIFT = 7;
+  constexpr int32_t  UV_MAX = 54886;     // 1372°C
+  constexpr uint16_t UV_ENTRIES = (UV_MAX >> UV_SHIFT) + 2;
+
+  // Cold junction table: one entry every 1.024°C, EMF in 0.01µV
+  constexpr uint8_t  MC_SHIFT = 10;
+  constexpr uint8_t  MC_ENTRIES = 125;
+  constexpr int32_t  MC_MAX = int32_t(MC_ENTRIES - 1) << MC_SHIFT;
+
+  // Inverse polynomial coefficients, E in µV, T in °C
+  constexpr double d_lo[] = { 0.0, 2.508355e-2, 7.860106e-8, -2.503131e-10, 8.315270e-14,
+                              -1.228034e-17, 9.804036e-22, -4.413030e-26, 1.057734e-30, -1.052755e-35 };
+  constexpr double d_hi[] = { -1.318058e2, 4.830222e-2, -1.646031e-6, 5.464731e-11, -9.650715e-16,
+                              8.802193e-21, -3.110810e-26 };
+
+  // Reference polynomial above 0°C, T in °C, E in mV
+  constexpr double c_ref[] = { -0.176004136860e-1, 0.389212049750e-1, 0.185587700320e-4, -0.994575928740e-7,
+                                0.318409457190e-9, -0.560728448890e-12, 0.560750590590e-15, -0.320207200030e-18,
+                                0.971511471520e-22, -0.121047212750e-25 };
+  constexpr double a0 = 0.118597600000e0, a1 = -0.118343200000e-3, a2 = 0.126968600000e3;
+
+  template<uint8_t N>
+  constexpr double poly(const double (&c)[N], const double x) {
+    double r = 0;
+    for (uint8_t i = N; i--;) r = r * x + c[i];
+    return r;
+  }
+
+  constexpr double taylor_exp(const double x) {
+    double r = 1, t = 1;
+    for (uint8_t i = 1; i < 40; i++) { t *= x / i; r += t; }
+    return r;
+  }
+
+  constexpr int32_t nearest(const double x) { return int32_t(x < 0 ? x - 0.5 : x + 0.5); }
+
+  constexpr double emf_to_c(const double uv) { return uv < 20644 ? poly(d_lo, uv) : poly(d_hi, uv); }
+  constexpr double c_to_emf(const double c) { return 1000 * (poly(c_ref, c) + a0 * taylor_exp(a1 * (c - a2) * (c - a2))); }
+
+  struct Tables {
+    int32_t c[UV_ENTRIES];    // 0.01°C at each (i << UV_SHIFT) µV
+    int32_t uv[MC_ENTRIES];   // 0.01µV at each (i << MC_SHIFT) m°C
+    constexpr Tables() : c(), uv() {
+      for (uint16_t i = 0; i < UV_ENTRIES; i++) c[i] = nearest(100 * emf_to_c(double(i) * (1 << UV_SHIFT)));
+      for (uint8_t i = 0; i < MC_ENTRIES; i++) uv[i] = nearest(100 * c_to_emf(double(i) * (1 << MC_SHIFT) / 1000));
+    }
+  };
+
+  constexpr Tables tables;
+
+  constexpr int32_t lerp(const int32_t * const t, const int32_t x, const uint8_t shift) {
+    return t[x >> shift] + (((t[(x >> shift) + 1] - t[x >> shift]) * (x & ((1L << shift) - 1))) >> shift);
+  }
+
+  // Thermocouple EMF in µV to 0.01°C
+  constexpr int32_t uv_to_c(const int32_t uv) {
+    return lerp(tables.c, uv < 0 ? 0 : uv > UV_MAX ? UV_MAX : uv, UV_SHIFT);
+  }
+
+  // Cold junction in m°C to the EMF it would produce, in µV
+  constexpr int32_t mc_to_uv(const int32_t mc) {
+    return (lerp(tables.uv, mc < 0 ? 0 : mc > MC_MAX - 1 ? MC_MAX - 1 : mc, MC_SHIFT) + 50) / 100;
+  }
+
+  // Measured EMF plus cold junction (m°C) to 0.01°C
+  constexpr int32_t convert(const int32_t uv, const int32_t cj_mc) { return uv_to_c(uv + mc_to_uv(cj_mc)); }
+
+}
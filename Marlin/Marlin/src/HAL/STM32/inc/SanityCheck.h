@@ -55,3 +55,77 @@
 #if ANY(TFT_COLOR_UI, TFT_LVGL_UI, TFT_CLASSIC_UI) && NOT_TARGET(STM32H7xx, STM32F4xx, STM32F1xx)
   #error "TFT_COLOR_UI, TFT_LVGL_UI and TFT_CLASSIC_UI are currently only supported on STM32H7, STM32F4 and STM32F1 hardware."
 #endif
+
+#if ENABLED(SDCARD_EEPROM_LOG)
+  #if DISABLED(SDCARD_EEPROM_EMULATION)
+    #error "SDCARD_EEPROM_LOG requires SDCARD_EEPROM_EMULATION."
+  #elif !WITHIN(SDCARD_EEPROM_LOG_CHUNK, 4, 256) || (SDCARD_EEPROM_LOG_CHUNK & (SDCARD_EEPROM_LOG_CHUNK - 1))
+    #error "SDCARD_EEPROM_LOG_CHUNK must be a power of 2 from 4 to 256."
+  #elif !WITHIN(SDCARD_EEPROM_LOG_SIZE, 512, 0x100000)
+    #error "SDCARD_EEPROM_LOG_SIZE must be from 512 to 1048576."
+  #endif
+#endif
+
+#if ENABLED(SDIO_READ_AHEAD)
+  #if DISABLED(SDIO_SUPPORT)
+    #error "SDIO_READ_AHEAD requires SDIO_SUPPORT."
+  #elif !WITHIN(SDIO_READ_AHEAD_BLOCKS, 8, 32)
+    #error "SDIO_READ_AHEAD_BLOCKS must be from 8 to 32."
+  #endif
+#endif
+
+#if ENABLED(SDIO_HIGH_SPEED)
+  #if NONE(SDIO_SUPPORT, SD_STAGING)
+    #error "SDIO_HIGH_SPEED requires SDIO_SUPPORT or SD_STAGING."
+  #elif !defined(STM32F4xx)
+    #error "SDIO_HIGH_SPEED requires an STM32F4 MCU."
+  #endif
+#endif
+
+#if ENABLED(ADC_SCAN_DMA)
+  #ifndef STM32F4xx
+    #error "ADC_SCAN_DMA requires an STM32F4 MCU."
+  #elif ENABLED(STEP_DMA)
+    #error "ADC_SCAN_DMA and STEP_DMA both need DMA2 Stream4."
+  #elif !WITHIN(ADC_SCAN_DMA_SCANS, 1, 64)
+    #error "ADC_SCAN_DMA_SCANS must be from 1 to 64."
+  #endif
+#endif
+
+#if ENABLED(SD_SPI_DMA)
+  #ifndef STM32F4xx
+    #error "SD_SPI_DMA requires an STM32F4 MCU."
+  #elif ANY(SOFTWARE_SPI, SDIO_SUPPORT)
+    #error "SD_SPI_DMA requires the SD card on a hardware SPI."
+  #elif !WITHIN(SD_SPI_DMA_CLOCK, 1000000, 25000000)
+    #error "SD_SPI_DMA_CLOCK must be from 1000000 to 25000000."
+  #endif
+#endif
+
+#if ENABLED(ENDSTOP_INTERRUPTS_BY_DIRECTION) && NOT_TARGET(STM32F4xx, STM32F7xx)
+  #error "ENDSTOP_INTERRUPTS_BY_DIRECTION requires an STM32F4 or STM32F7 MCU."
+#endif
+
+#if ENABLED(CCMRAM_PLACEMENT) && !defined(CCMDATARAM_BASE)
+  #error "CCMRAM_PLACEMENT requires an STM32 MCU with CCM RAM (e.g., STM32F405/407)."
+#endif
+
+#if ENABLED(ISR_CODE_IN_RAM) && NOT_TARGET(STM32F4xx, STM32F7xx)
+  #error "ISR_CODE_IN_RAM requires an STM32F4 or STM32F7 MCU."
+#endif
+
+#if ENABLED(LVGL_PERFORMANCE_MODE)
+  #if !(defined(STM32F4xx) && HAS_FSMC_TFT)
+    #error "LVGL_PERFORMANCE_MODE requires an STM32F4 MCU with an FSMC display."
+  #elif ENABLED(USE_SPI_DMA_TC)
+    #error "LVGL_PERFORMANCE_MODE is not compatible with USE_SPI_DMA_TC."
+  #endif
+#endif
+
+#if ENABLED(POWER_LOSS_BACKUP_SRAM)
+  #if NOT_TARGET(STM32F4xx, STM32F7xx)
+    #error "POWER_LOSS_BACKUP_SRAM requires an STM32F4 or STM32F7 MCU."
+  #elif ENABLED(SRAM_EEPROM_EMULATION)
+    #error "POWER_LOSS_BACKUP_SRAM and SRAM_EEPROM_EMULATION both use the backup SRAM."
+  #endif
+#endif
@@ -0,0 +1,96 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include "../platforms.h"
+
+#ifdef HAL_STM32
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(ISR_PROFILER)
+
+#include "isr_profiler.h"
+
+#define CYCLES_TO_US(C) uint32_t((C) / (F_CPU / 1000000UL))
+
+ISRProfiler::isr_stats_t ISRProfiler::stats[ISR_PROFILES];
+uint32_t ISRProfiler::nested; // = 0
+uint32_t ISRProfiler::latency_max; // = 0
+uint64_t ISRProfiler::latency_total; // = 0
+millis_t ISRProfiler::since; // = 0
+
+void ISRProfiler::enter(uint32_t &start, uint32_t &outer) {
+  CRITICAL_SECTION_START();
+  outer = nested;
+  nested = 0;
+  start = get_cycle_count();
+  CRITICAL_SECTION_END();
+}
+
+void ISRProfiler::leave(const ISRProfileID id, const uint32_t start, const uint32_t outer) {
+  CRITICAL_SECTION_START();
+  const uint32_t total = get_cycle_count() - start,
+                 self = total - nested;
+  nested = outer + total;         // The interrupted handler doesn't get this time
+  isr_stats_t &s = stats[id];
+  if (!s.count++ || self < s.min) s.min = self;
+  NOLESS(s.max, self);
+  s.self += self;
+  CRITICAL_SECTION_END();
+}
+
+void ISRProfiler::report() {
+  static const char * const isr_name[ISR_PROFILES] = { "stepper", "temp", "temptask", "sdio", "sdiodma", "tftdma" };
+
+  const millis_t ms = millis() - since;
+  SERIAL_ECHOLNPGM("ISR cycles min/avg/max and CPU load over ", ms, "ms");
+  CRITICAL_SECTION_START();
+  isr_stats_t copy[ISR_PROFILES];
+  COPY(copy, stats);
+  const uint32_t lat_max = latency_max;
+  const uint64_t lat_total = latency_total;
+  CRITICAL_SECTION_END();
+
+  LOOP_L_N(i, ISR_PROFILES) {
+    const isr_stats_t &s = copy[i];
+    if (!s.count) continue;
+    // Tenths of a percent of the CPU
+    const uint32_t load = ms ? uint32_t(CYCLES_TO_US(s.self) / ms) : 0;
+    SERIAL_ECHOLNPGM(" ", isr_name[i], " n:", s.count, " ", s.min, "/", uint32_t(s.self / s.count), "/", s.max,
+                     " (", CYCLES_TO_US(s.max), "us) load:", load / 10, ".", load % 10, "%");
+  }
+
+  const uint32_t n = copy[ISR_PROF_STEPPER].count,
+                 tick_cycles = (F_CPU) / (STEPPER_TIMER_RATE);
+  if (n) SERIAL_ECHOLNPGM(" stepper latency avg/max: ", uint32_t(lat_total / n) * tick_cycles, "/", lat_max * tick_cycles, " cycles");
+}
+
+void ISRProfiler::reset() {
+  CRITICAL_SECTION_START();
+  ZERO(stats);
+  latency_max = 0;
+  latency_total = 0;
+  since = millis();
+  CRITICAL_SECTION_END();
+}
+
+#endif // ISR_PROFILER
+#endif // HAL_STM32
@@ -0,0 +1,85 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * isr_profiler.h - Cycles spent in each interrupt handler (D206)
+ *
+ * ISR_PROFILE(id) at the top of a handler times it with the DWT cycle counter.
+ * Time spent in a higher priority handler that preempts it is charged only to
+ * that handler, so "self" is the time the handler itself kept the CPU.
+ *
+ * The Stepper ISR also records its latency: the step timer restarts from 0 at
+ * the compare match, so its count on entry is how long the ISR waited to start.
+ */
+
+#include "../../inc/MarlinConfigPre.h"
+#include "../shared/Delay.h"
+
+enum ISRProfileID : uint8_t {
+  ISR_PROF_STEPPER,
+  ISR_PROF_TEMP,
+  ISR_PROF_TEMP_TASK,   // PendSV sensor task (DEFERRED_TEMP_SENSORS)
+  ISR_PROF_SDIO,
+  ISR_PROF_SDIO_DMA,
+  ISR_PROF_TFT_DMA,
+  ISR_PROFILES
+};
+
+class ISRProfiler {
+public:
+  // Time a handler, from construction to the end of its scope
+  class Scope {
+  public:
+    Scope(const ISRProfileID id) : id(id) { enter(start, outer_nested); }
+    ~Scope() { leave(id, start, outer_nested); }
+  private:
+    const ISRProfileID id;
+    uint32_t start, outer_nested;
+  };
+
+  // Ticks of the step timer since its compare match
+  static void stepper_latency(const uint32_t ticks) {
+    NOLESS(latency_max, ticks);
+    latency_total += ticks;
+  }
+
+  static void report();
+  static void reset();
+
+private:
+  typedef struct {
+    uint32_t count, min, max;       // Calls, and shortest / longest self time
+    uint64_t self;                  // Cycles, without preempting handlers
+  } isr_stats_t;
+
+  static isr_stats_t stats[ISR_PROFILES];
+  static uint32_t nested;           // Cycles of handlers that preempted the current one
+  static uint32_t latency_max;      // Step timer ticks
+  static uint64_t latency_total;
+  static millis_t since;
+
+  static void enter(uint32_t &start, uint32_t &outer);
+  static void leave(const ISRProfileID id, const uint32_t start, const uint32_t outer);
+};
+
+#define ISR_PROFILE(ID) ISRProfiler::Scope _isr_profile(ID)
@@ -32,6 +32,9 @@
 
 #define BLOCK_SIZE 512
 #define PRODUCT_ID 0x29
+#define MSC_BOUNCE_BLOCKS 4
+
+alignas(4) static uint8_t bounce[MSC_BOUNCE_BLOCKS * BLOCK_SIZE];
 
 class Sd2CardUSBMscHandler : public USBMscHandler {
 public:
@@ -53,43 +56,32 @@ public:
     return true;
   }
 
+  // Blocks from the host go straight to the driver in one multi-block
+  // transfer. Buffers that DMA can't use are copied through a bounce buffer.
   bool Write(uint8_t *pBuf, uint32_t blkAddr, uint16_t blkLen) {
     auto sd2card = diskIODriver();
-    // single block
-    if (blkLen == 1) {
-      hal.watchdog_refresh();
-      sd2card->writeBlock(blkAddr, pBuf);
-      return true;
-    }
-
-    // multi block optimization
-    sd2card->writeStart(blkAddr, blkLen);
-    while (blkLen--) {
+    card.host_wrote();
+    while (blkLen) {
       hal.watchdog_refresh();
-      sd2card->writeData(pBuf);
-      pBuf += BLOCK_SIZE;
+      const bool aligned = !(uintptr_t(pBuf) & 3);
+      const uint8_t n = aligned ? _MIN(blkLen, 255U) : _MIN(blkLen, uint16_t(MSC_BOUNCE_BLOCKS));
+      if (!aligned) memcpy(bounce, pBuf, n * BLOCK_SIZE);
+      if (!sd2card->writeBlocks(blkAddr, aligned ? pBuf : bounce, n)) return false;
+      blkAddr += n; blkLen -= n; pBuf += n * BLOCK_SIZE;
     }
-    sd2card->writeStop();
     return true;
   }
 
   bool Read(uint8_t *pBuf, uint32_t blkAddr, uint16_t blkLen) {
     auto sd2card = diskIODriver();
-    // single block
-    if (blkLen == 1) {
-      hal.watchdog_refresh();
-      sd2card->readBlock(blkAddr, pBuf);
-      return true;
-    }
-
-    // multi block optimization
-    sd2card->readStart(blkAddr);
-    while (blkLen--) {
+    while (blkLen) {
       hal.watchdog_refresh();
-      sd2card->readData(pBuf);
-      pBuf += BLOCK_SIZE;
+      const bool aligned = !(uintptr_t(pBuf) & 3);
+      const uint8_t n = aligned ? _MIN(blkLen, 255U) : _MIN(blkLen, uint16_t(MSC_BOUNCE_BLOCKS));
+      if (!sd2card->readBlocks(blkAddr, aligned ? pBuf : bounce, n)) return false;
+      if (!aligned) memcpy(pBuf, bounce, n * BLOCK_SIZE);
+      blkAddr += n; blkLen -= n; pBuf += n * BLOCK_SIZE;
     }
-    sd2card->readStop();
     return true;
   }
 
@@ -0,0 +1,143 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include "../platforms.h"
+
+#ifdef HAL_STM32
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(FF_RTOS_TASKS)
+
+#include "rtos_tasks.h"
+#include "../../MarlinCore.h"
+#include "../../gcode/queue.h"
+#include "../../module/planner.h"
+
+#if ENABLED(SDSUPPORT)
+  #include "../../sd/cardreader.h"
+#endif
+
+#if HAS_GRAPHICAL_TFT
+  #include "../../lcd/tft/tft.h"
+#endif
+
+#include <STM32FreeRTOS.h>
+
+static SemaphoreHandle_t marlin_lock;
+static TaskHandle_t marlin_handle, ui_handle, io_handle;
+
+static inline void lock()   { xSemaphoreTake(marlin_lock, portMAX_DELAY); }
+static inline void unlock() { xSemaphoreGive(marlin_lock); }
+
+static void marlin_task(void*) {
+  lock();
+  setup();
+  for (;;) loop();
+}
+
+static void ui_task(void*) {
+  for (;;) {
+    lock();
+    const bool running = marlin_state != MF_INITIALIZING;
+    if (running) idle_ui_update();
+    unlock();
+
+    #if HAS_GRAPHICAL_TFT
+      // Draw the queued frame a slice at a time. Thumbnails read the SD card as they render.
+      while (tft.queue.busy()) {
+        TERN_(TFT_THUMBNAIL, lock());
+        tft.queue.async();
+        TERN_(TFT_THUMBNAIL, unlock());
+      }
+    #endif
+
+    vTaskDelay(pdMS_TO_TICKS(running ? 1 : 10));
+  }
+}
+
+static void io_task(void*) {
+  for (;;) {
+    vTaskDelay(pdMS_TO_TICKS(50));
+    lock();
+    if (marlin_state != MF_INITIALIZING) {
+      TERN_(SDSUPPORT, card.manage_media());
+      TERN_(SD_STAGING, card.stage_task());
+    }
+    unlock();
+  }
+}
+
+void RTOSTasks::start() {
+  marlin_lock = xSemaphoreCreateMutex();
+  if (marlin_lock
+    && xTaskCreate(marlin_task, "marlin", RTOS_MARLIN_STACK, nullptr, tskIDLE_PRIORITY + 3, &marlin_handle) == pdPASS
+    && xTaskCreate(ui_task,     "ui",     RTOS_UI_STACK,     nullptr, tskIDLE_PRIORITY + 2, &ui_handle) == pdPASS
+    && xTaskCreate(io_task,     "io",     RTOS_IO_STACK,     nullptr, tskIDLE_PRIORITY + 1, &io_handle) == pdPASS
+  ) {
+    vTaskStartScheduler();  // Doesn't return
+  }
+
+  // Out of heap. Carry on with the plain main loop.
+  if (ui_handle) vTaskDelete(ui_handle);
+  if (marlin_handle) vTaskDelete(marlin_handle);
+  if (marlin_lock) vSemaphoreDelete(marlin_lock);
+  marlin_handle = ui_handle = io_handle = nullptr;
+}
+
+bool RTOSTasks::started() { return xTaskGetSchedulerState() != taskSCHEDULER_NOT_STARTED; }
+
+bool RTOSTasks::in_ui_task() { return xTaskGetCurrentTaskHandle() == ui_handle; }
+
+void RTOSTasks::idle(const bool sleep/*=false*/) {
+  if (xTaskGetSchedulerState() != taskSCHEDULER_RUNNING || xTaskGetCurrentTaskHandle() != marlin_handle) return;
+
+  static millis_t next_sleep_ms; // = 0
+  const millis_t ms = millis();
+  const bool wait = sleep || planner.is_full() || !queue.has_commands_queued() || ELAPSED(ms, next_sleep_ms);
+
+  unlock();
+  if (wait) {
+    next_sleep_ms = ms + RTOS_MARLIN_BUSY_MS;
+    vTaskDelay(1);
+  }
+  lock();
+}
+
+void RTOSTasks::stop() { if (started()) vTaskSuspendAll(); }
+
+#if ENABLED(M100_FREE_MEMORY_WATCHER)
+
+  // FreeRTOS fills new task stacks, so the unused part is known
+  void RTOSTasks::report_stacks() {
+    if (!started()) return;
+    auto report = [](const char * const name, TaskHandle_t handle, const uint32_t words) {
+      if (handle) SERIAL_ECHOLNPGM("Task ", name, " stack peak: ", 4 * (words - uxTaskGetStackHighWaterMark(handle)), " of ", 4 * words, " bytes");
+    };
+    report("marlin", marlin_handle, RTOS_MARLIN_STACK);
+    report("ui", ui_handle, RTOS_UI_STACK);
+    report("io", io_handle, RTOS_IO_STACK);
+  }
+
+#endif
+
+#endif // FF_RTOS_TASKS
+#endif // HAL_STM32
@@ -0,0 +1,64 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * rtos_tasks.h - Run Marlin as FreeRTOS tasks (FF_RTOS_TASKS)
+ *
+ * Three tasks share one mutex, the Marlin lock, for everything but the display:
+ *   marlin  High    setup() and loop(): G-code queue, planner, heaters, serial
+ *   ui      Normal  ui.update() under the lock, then the TFT render and DMA without it
+ *   io      Low     SD card insert / remove
+ *
+ * The Marlin task only lets go of the lock in idle(), so the other tasks see the
+ * same state as the calls they replace. It sleeps a tick there when it can't move
+ * on (planner full, queue empty) or has been busy for RTOS_MARLIN_BUSY_MS. Once
+ * it's ready again it preempts the UI, even in the middle of drawing a frame.
+ * The Stepper and Temperature ISRs are not touched.
+ */
+
+#include "../../inc/MarlinConfigPre.h"
+
+#define RTOS_MARLIN_STACK   4096    // Words
+#define RTOS_UI_STACK       1536
+#define RTOS_IO_STACK        768
+#define RTOS_MARLIN_BUSY_MS   10    // Longest the UI waits for the lock while the queue keeps Marlin busy
+
+class RTOSTasks {
+public:
+  // Create the tasks and start the scheduler. Return only if a task couldn't be created.
+  static void start();
+  static bool started();
+
+  // Called at the end of idle(). Let the other tasks take the lock.
+  static void idle(const bool sleep=false);
+
+  static bool in_ui_task();
+
+  // Stop task switching, for kill()
+  static void stop();
+
+  #if ENABLED(M100_FREE_MEMORY_WATCHER)
+    // Report the peak stack use of each task
+    static void report_stacks();
+  #endif
+};
@@ -26,10 +26,14 @@
 
 #include "../../inc/MarlinConfig.h"
 
-#if ENABLED(SDIO_SUPPORT)
+#if EITHER(SDIO_SUPPORT, SD_STAGING)
 
 #include "sdio.h"
 
+#if ENABLED(ISR_PROFILER)
+  #include "isr_profiler.h"
+#endif
+
 #include <stdint.h>
 #include <stdbool.h>
 
@@ -66,6 +70,15 @@
 
 SD_HandleTypeDef hsd;  // SDIO structure
 
+#if ENABLED(SDIO_READ_AHEAD)
+  static void read_ahead_reset();
+#endif
+
+#if ENABLED(SDIO_HIGH_SPEED)
+  static void sdio_tune_clock();
+  static void sdio_step_down();
+#endif
+
 static uint32_t clock_to_divider(uint32_t clk) {
   #ifdef SDIO_FOR_STM32H7
     // SDMMC_CK frequency = sdmmc_ker_ck / [2 * CLKDIV].
@@ -107,7 +120,10 @@ void HAL_SD_MspInit(SD_HandleTypeDef *hsd) {
 
   #define SD_TIMEOUT              1000 // ms
 
-  extern "C" void SDMMC1_IRQHandler(void) { HAL_SD_IRQHandler(&hsd); }
+  extern "C" void SDMMC1_IRQHandler(void) {
+    TERN_(ISR_PROFILER, ISR_PROFILE(ISR_PROF_SDIO));
+    HAL_SD_IRQHandler(&hsd);
+  }
 
   uint8_t waitingRxCplt = 0, waitingTxCplt = 0;
   void HAL_SD_TxCpltCallback(SD_HandleTypeDef *hsdio) { waitingTxCplt = 0; }
@@ -118,9 +134,33 @@ void HAL_SD_MspInit(SD_HandleTypeDef *hsd) {
     __HAL_RCC_SDMMC1_RELEASE_RESET(); delay(10);
   }
 
+  #if ENABLED(SDIO_READ_AHEAD)
+
+    // Start reading blocks in the background
+    static bool SDIO_StartRead(uint32_t block, uint8_t *dst, uint32_t count) {
+      if (HAL_SD_GetCardState(&hsd) != HAL_SD_CARD_TRANSFER) return false;
+      waitingRxCplt = 1;
+      if (HAL_SD_ReadBlocks_DMA(&hsd, dst, block, count) == HAL_OK) return true;
+      waitingRxCplt = 0;
+      return false;
+    }
+
+    static bool SDIO_ReadDone() { return !waitingRxCplt; }
+
+    // Wait for a background read to complete
+    static bool SDIO_FinishRead() {
+      const uint32_t timeout = HAL_GetTick() + SD_TIMEOUT;
+      while (waitingRxCplt)
+        if (HAL_GetTick() >= timeout) { HAL_SD_Abort(&hsd); waitingRxCplt = 0; return false; }
+      return true;
+    }
+
+  #endif
+
   bool SDIO_Init() {
     HAL_StatusTypeDef sd_state = HAL_OK;
     if (hsd.Instance == SDMMC1) HAL_SD_DeInit(&hsd);
+    TERN_(SDIO_READ_AHEAD, read_ahead_reset());
 
     // HAL SD initialization
     hsd.Instance = SDMMC1;
@@ -160,8 +200,14 @@ void HAL_SD_MspInit(SD_HandleTypeDef *hsd) {
     #error "Unknown STM32 architecture."
   #endif
 
-  extern "C" void SDIO_IRQHandler(void) { HAL_SD_IRQHandler(&hsd); }
-  extern "C" void DMA_IRQ_HANDLER(void) { HAL_DMA_IRQHandler(&hdma_sdio); }
+  extern "C" void SDIO_IRQHandler(void) {
+    TERN_(ISR_PROFILER, ISR_PROFILE(ISR_PROF_SDIO));
+    HAL_SD_IRQHandler(&hsd);
+  }
+  extern "C" void DMA_IRQ_HANDLER(void) {
+    TERN_(ISR_PROFILER, ISR_PROFILE(ISR_PROF_SDIO_DMA));
+    HAL_DMA_IRQHandler(&hdma_sdio);
+  }
 
   /*
     SDIO_INIT_CLK_DIV is 118
@@ -179,7 +225,7 @@ void HAL_SD_MspInit(SD_HandleTypeDef *hsd) {
   void go_to_transfer_speed() {
     /* Default SDIO peripheral configuration for SD card initialization */
     hsd.Init.ClockEdge           = hsd.Init.ClockEdge;
-    hsd.Init.ClockBypass         = hsd.Init.ClockBypass;
+    hsd.Init.ClockBypass         = TERN(SDIO_HIGH_SPEED, SDIO_CLOCK_BYPASS_DISABLE, hsd.Init.ClockBypass); // Left on by a high speed card before a remount
     hsd.Init.ClockPowerSave      = hsd.Init.ClockPowerSave;
     hsd.Init.BusWide             = hsd.Init.BusWide;
     hsd.Init.HardwareFlowControl = hsd.Init.HardwareFlowControl;
@@ -273,6 +319,7 @@ void HAL_SD_MspInit(SD_HandleTypeDef *hsd) {
     bool status;
     hsd.Instance = SDIO;
     hsd.State = HAL_SD_STATE_RESET;
+    TERN_(SDIO_READ_AHEAD, read_ahead_reset());
 
     SD_LowLevel_Init();
 
@@ -307,20 +354,23 @@ void HAL_SD_MspInit(SD_HandleTypeDef *hsd) {
       }
     #endif
 
+    TERN_(SDIO_HIGH_SPEED, sdio_tune_clock());
+
     return true;
   }
 
   /**
-   * @brief Read or Write a block
-   * @details Read or Write a block with SDIO
+   * @brief Start a DMA transfer
+   * @details Start reading or writing blocks with SDIO
    *
-   * @param block The block index
+   * @param block The first block index
    * @param src The data buffer source for a write
    * @param dst The data buffer destination for a read
+   * @param count The number of blocks
    *
-   * @return true on success
+   * @return true if the transfer was started
    */
-  static bool SDIO_ReadWriteBlock_DMA(uint32_t block, const uint8_t *src, uint8_t *dst) {
+  static bool SDIO_StartTransfer_DMA(uint32_t block, const uint8_t *src, uint8_t *dst, uint32_t count) {
     if (HAL_SD_GetCardState(&hsd) != HAL_SD_CARD_TRANSFER) return false;
 
     hal.watchdog_refresh();
@@ -329,12 +379,12 @@ void HAL_SD_MspInit(SD_HandleTypeDef *hsd) {
     if (src) {
       hdma_sdio.Init.Direction = DMA_MEMORY_TO_PERIPH;
       HAL_DMA_Init(&hdma_sdio);
-      ret = HAL_SD_WriteBlocks_DMA(&hsd, (uint8_t*)src, block, 1);
+      ret = HAL_SD_WriteBlocks_DMA(&hsd, (uint8_t*)src, block, count);
     }
     else {
       hdma_sdio.Init.Direction = DMA_PERIPH_TO_MEMORY;
       HAL_DMA_Init(&hdma_sdio);
-      ret = HAL_SD_ReadBlocks_DMA(&hsd, (uint8_t*)dst, block, 1);
+      ret = HAL_SD_ReadBlocks_DMA(&hsd, (uint8_t*)dst, block, count);
     }
 
     if (ret != HAL_OK) {
@@ -343,12 +393,23 @@ void HAL_SD_MspInit(SD_HandleTypeDef *hsd) {
       return false;
     }
 
+    return true;
+  }
+
+  /**
+   * @brief Finish a DMA transfer
+   * @details Wait for the transfer started by SDIO_StartTransfer_DMA
+   *
+   * @return true on success
+   */
+  static bool SDIO_FinishTransfer_DMA() {
     millis_t timeout = millis() + SD_TIMEOUT;
     // Wait the transfer
     while (hsd.State != HAL_SD_STATE_READY) {
       if (ELAPSED(millis(), timeout)) {
         HAL_DMA_Abort_IT(&hdma_sdio);
         HAL_DMA_DeInit(&hdma_sdio);
+        hsd.ErrorCode |= HAL_SD_ERROR_DATA_TIMEOUT;
         return false;
       }
     }
@@ -365,8 +426,217 @@ void HAL_SD_MspInit(SD_HandleTypeDef *hsd) {
     return true;
   }
 
+  /**
+   * @brief Read or Write a block
+   * @details Read or Write a block with SDIO
+   *
+   * @param block The block index
+   * @param src The data buffer source for a write
+   * @param dst The data buffer destination for a read
+   *
+   * @return true on success
+   */
+  static bool SDIO_ReadWriteBlock_DMA(uint32_t block, const uint8_t *src, uint8_t *dst) {
+    return SDIO_StartTransfer_DMA(block, src, dst, 1) && SDIO_FinishTransfer_DMA();
+  }
+
+  #if ENABLED(SDIO_HIGH_SPEED)
+
+    /**
+     * The transfer clock starts as fast as the card allows and steps down on
+     * data errors, but never below the SDIO_CLOCK divider. Divider -1 is the
+     * 48MHz clock bypass, used only for a card switched to high speed.
+     */
+    static int8_t sdio_div, sdio_slow_div;
+    static bool sdio_high_speed;
+
+    #define SDIO_SPEED_ERRORS (HAL_SD_ERROR_DATA_CRC_FAIL | HAL_SD_ERROR_DATA_TIMEOUT | HAL_SD_ERROR_CMD_CRC_FAIL \
+                             | HAL_SD_ERROR_CMD_RSP_TIMEOUT | HAL_SD_ERROR_RX_OVERRUN | HAL_SD_ERROR_TX_UNDERRUN)
+
+    static uint32_t sdio_clock() { return sdio_div < 0 ? SDIOCLK : SDIOCLK / (sdio_div + 2); }
+
+    static void sdio_set_clock() {
+      hsd.Init.ClockBypass = sdio_div < 0 ? SDIO_CLOCK_BYPASS_ENABLE : SDIO_CLOCK_BYPASS_DISABLE;
+      hsd.Init.ClockDiv = _MAX(sdio_div, 0);
+      SDIO_Init(hsd.Instance, hsd.Init);
+    }
+
+    static void sdio_report_clock() {
+      SERIAL_ECHO_MSG("SDIO clock ", sdio_clock() / 1000, " kHz", sdio_high_speed ? " high speed" : "",
+                      hsd.Init.BusWide == SDIO_BUS_WIDE_4B ? " 4-bit" : " 1-bit");
+    }
+
+    // Send CMD6 and read the 64-byte switch status that it returns on the data lines
+    static bool sdio_switch(const uint32_t arg, uint8_t (&status)[64]) {
+      SDIO_TypeDef * const sdio = hsd.Instance;
+      if (SDMMC_CmdBlockLength(sdio, 64) != HAL_SD_ERROR_NONE) return false;
+
+      SDIO_DataInitTypeDef config;
+      config.DataTimeOut   = SDMMC_DATATIMEOUT;
+      config.DataLength    = 64;
+      config.DataBlockSize = SDIO_DATABLOCK_SIZE_64B;
+      config.TransferDir   = SDIO_TRANSFER_DIR_TO_SDIO;
+      config.TransferMode  = SDIO_TRANSFER_MODE_BLOCK;
+      config.DPSM          = SDIO_DPSM_ENABLE;
+      SDIO_ConfigData(sdio, &config);
+
+      bool ok = SDMMC_CmdSwitch(sdio, arg) == HAL_SD_ERROR_NONE;
+      uint32_t words[16];
+      uint8_t n = 0;
+      const millis_t timeout = millis() + SD_TIMEOUT;
+      while (ok && !__HAL_SD_GET_FLAG(&hsd, SDIO_FLAG_RXOVERR | SDIO_FLAG_DCRCFAIL | SDIO_FLAG_DTIMEOUT | SDIO_FLAG_DBCKEND)) {
+        if (__HAL_SD_GET_FLAG(&hsd, SDIO_FLAG_RXDAVL)) {
+          const uint32_t w = SDIO_ReadFIFO(sdio);
+          if (n < COUNT(words)) words[n++] = w;
+        }
+        if (ELAPSED(millis(), timeout)) ok = false;
+      }
+      while (ok && n < COUNT(words) && __HAL_SD_GET_FLAG(&hsd, SDIO_FLAG_RXDAVL)) words[n++] = SDIO_ReadFIFO(sdio);
+      if (__HAL_SD_GET_FLAG(&hsd, SDIO_FLAG_RXOVERR | SDIO_FLAG_DCRCFAIL | SDIO_FLAG_DTIMEOUT)) ok = false;
+      __HAL_SD_CLEAR_FLAG(&hsd, SDIO_STATIC_FLAGS);
+
+      SDMMC_CmdBlockLength(sdio, BLOCKSIZE);
+      if (!ok || n < COUNT(words)) return false;
+      memcpy(status, words, sizeof(status)); // The FIFO hands over the bytes in bus order
+      return true;
+    }
+
+    // Switch function group 1 to high speed, if the card has CMD6 and the mode
+    static bool sdio_switch_high_speed() {
+      HAL_SD_CardCSDTypeDef csd;
+      if (HAL_SD_GetCardCSD(&hsd, &csd) != HAL_OK || !TEST(csd.CardComdClasses, 10)) return false;
+      uint8_t status[64];
+      if (!sdio_switch(0x00FFFFF1, status) || !TEST(status[13], 1)) return false;    // Check: high speed supported
+      return sdio_switch(0x80FFFFF1, status) && (status[16] & 0x0F) == 1;             // Set: group 1 is now high speed
+    }
+
+    // A clock is kept if the first blocks of the card read back with good CRCs
+    static bool sdio_clock_stable() {
+      alignas(4) static uint8_t buf[512];
+      LOOP_L_N(b, 4) if (!SDIO_ReadWriteBlock_DMA(b, nullptr, buf)) return false;
+      return true;
+    }
+
+    static void sdio_tune_clock() {
+      hsd.Init.BusWide = hsd.Instance->CLKCR & SDIO_CLKCR_WIDBUS; // Set by the HAL without updating Init
+      sdio_slow_div = clock_to_divider(SDIO_CLOCK);
+      sdio_high_speed = sdio_switch_high_speed();
+      for (sdio_div = sdio_high_speed ? -1 : 0; sdio_div < sdio_slow_div; ++sdio_div) {
+        hal.watchdog_refresh();
+        sdio_set_clock();
+        if (sdio_clock_stable()) break;
+      }
+      if (sdio_div >= sdio_slow_div) {
+        sdio_div = sdio_slow_div;
+        sdio_set_clock();
+      }
+      sdio_report_clock();
+    }
+
+    // After a transfer error slow the clock one step for the retry
+    static void sdio_step_down() {
+      if (sdio_div >= sdio_slow_div || !(hsd.ErrorCode & SDIO_SPEED_ERRORS)) return;
+      ++sdio_div;
+      sdio_set_clock();
+      sdio_report_clock();
+    }
+
+  #endif // SDIO_HIGH_SPEED
+
+  #if ENABLED(SDIO_READ_AHEAD)
+    static bool SDIO_StartRead(uint32_t block, uint8_t *dst, uint32_t count) { return SDIO_StartTransfer_DMA(block, nullptr, dst, count); }
+    static bool SDIO_ReadDone() { return hsd.State == HAL_SD_STATE_READY; }
+    static bool SDIO_FinishRead() { return SDIO_FinishTransfer_DMA(); }
+  #endif
+
 #endif // !SDIO_FOR_STM32H7
 
+#if ENABLED(SDIO_READ_AHEAD)
+
+  /**
+   * Two buffers are filled with multi-block reads (CMD18). The card fills one
+   * while the other is being consumed, so a sequential reader (e.g., a file
+   * being printed) finds its next block already in RAM. Other reads, such as
+   * FAT and directory blocks, still go to the card one block at a time.
+   */
+  static struct ReadAheadBuffer {
+    enum : uint8_t { EMPTY, LOADING, READY } state;
+    uint32_t block;                                     // First block in the buffer
+    alignas(4) uint8_t data[SDIO_READ_AHEAD_BLOCKS * 512];
+    bool contains(const uint32_t b) const { return state != EMPTY && b - block < SDIO_READ_AHEAD_BLOCKS; }
+  } read_ahead[2];
+
+  static uint32_t read_ahead_next; // The block a sequential reader will ask for next
+
+  static void read_ahead_reset() {
+    read_ahead[0].state = read_ahead[1].state = ReadAheadBuffer::EMPTY;
+    read_ahead_next = UINT32_MAX;
+  }
+
+  // Wait for the background read, if any, so the DMA is free
+  static void read_ahead_wait() {
+    for (ReadAheadBuffer &buf : read_ahead)
+      if (buf.state == ReadAheadBuffer::LOADING)
+        buf.state = SDIO_FinishRead() ? ReadAheadBuffer::READY : ReadAheadBuffer::EMPTY;
+  }
+
+  static bool read_ahead_busy() {
+    return read_ahead[0].state == ReadAheadBuffer::LOADING || read_ahead[1].state == ReadAheadBuffer::LOADING;
+  }
+
+  // Start filling a buffer in the background
+  static void read_ahead_start(ReadAheadBuffer &buf, const uint32_t block) {
+    buf.state = ReadAheadBuffer::EMPTY;
+    if (block + SDIO_READ_AHEAD_BLOCKS > hsd.SdCard.LogBlockNbr) return;
+    buf.block = block;
+    if (SDIO_StartRead(block, buf.data, SDIO_READ_AHEAD_BLOCKS)) buf.state = ReadAheadBuffer::LOADING;
+  }
+
+  /**
+   * @brief Read a block from the read-ahead buffers
+   *
+   * @return false if the block must be read from the card
+   */
+  static bool read_ahead_block(const uint32_t block, uint8_t *dst) {
+    if (read_ahead_busy() && SDIO_ReadDone()) read_ahead_wait();
+
+    uint8_t i = read_ahead[0].contains(block) ? 0 : 1;
+    if (!read_ahead[i].contains(block)) {
+      // Start reading ahead on the second block in a row
+      const bool sequential = (block == read_ahead_next);
+      read_ahead_next = block + 1;
+      if (!sequential) return false;
+      read_ahead_wait();
+      i = 0;
+      read_ahead_start(read_ahead[i], block);
+    }
+
+    ReadAheadBuffer &buf = read_ahead[i];
+    if (buf.state == ReadAheadBuffer::LOADING) read_ahead_wait();
+    if (buf.state != ReadAheadBuffer::READY) return false;
+
+    memcpy(dst, &buf.data[(block - buf.block) * 512], 512);
+    read_ahead_next = block + 1;
+
+    // Fill the other buffer with the blocks that follow this one
+    ReadAheadBuffer &other = read_ahead[i ^ 1];
+    const uint32_t follow = buf.block + SDIO_READ_AHEAD_BLOCKS;
+    if (!read_ahead_busy() && !(other.state == ReadAheadBuffer::READY && other.block == follow))
+      read_ahead_start(other, follow);
+
+    return true;
+  }
+
+  // Drop buffered copies of blocks about to be written
+  static void read_ahead_written(const uint32_t block, const uint32_t count) {
+    read_ahead_wait();
+    for (ReadAheadBuffer &buf : read_ahead)
+      if (buf.state != ReadAheadBuffer::EMPTY && block < buf.block + SDIO_READ_AHEAD_BLOCKS && buf.block < block + count)
+        buf.state = ReadAheadBuffer::EMPTY;
+  }
+
+#endif // SDIO_READ_AHEAD
+
 /**
  * @brief Read a block
  * @details Read a block from media with SDIO
@@ -377,6 +647,11 @@ void HAL_SD_MspInit(SD_HandleTypeDef *hsd) {
  * @return true on success
  */
 bool SDIO_ReadBlock(uint32_t block, uint8_t *dst) {
+  #if ENABLED(SDIO_READ_AHEAD)
+    if (read_ahead_block(block, dst)) return true;
+    read_ahead_wait();
+  #endif
+
   #ifdef SDIO_FOR_STM32H7
 
     uint32_t timeout = HAL_GetTick() + SD_TIMEOUT;
@@ -397,22 +672,74 @@ bool SDIO_ReadBlock(uint32_t block, uint8_t *dst) {
   #else
 
     uint8_t retries = SDIO_READ_RETRIES;
-    while (retries--) if (SDIO_ReadWriteBlock_DMA(block, nullptr, dst)) return true;
+    while (retries--) {
+      if (SDIO_ReadWriteBlock_DMA(block, nullptr, dst)) return true;
+      TERN_(SDIO_HIGH_SPEED, sdio_step_down());
+    }
     return false;
 
   #endif
 }
 
 /**
- * @brief Write a block
- * @details Write a block to media with SDIO
+ * @brief Read blocks
+ * @details Read consecutive blocks from media with SDIO, using a
+ *          multi-block read (CMD18) for more than one block
  *
- * @param block The block index
+ * @param block The first block index
+ * @param dst The block buffer
+ * @param count The number of blocks
+ *
+ * @return true on success
+ */
+bool SDIO_ReadBlocks(uint32_t block, uint8_t *dst, uint32_t count) {
+  if (count == 1) return SDIO_ReadBlock(block, dst);
+
+  TERN_(SDIO_READ_AHEAD, read_ahead_wait());
+
+  #ifdef SDIO_FOR_STM32H7
+
+    uint32_t timeout = HAL_GetTick() + SD_TIMEOUT;
+
+    while (HAL_SD_GetCardState(&hsd) != HAL_SD_CARD_TRANSFER)
+      if (HAL_GetTick() >= timeout) return false;
+
+    waitingRxCplt = 1;
+    if (HAL_SD_ReadBlocks_DMA(&hsd, dst, block, count) != HAL_OK)
+      return false;
+
+    timeout = HAL_GetTick() + SD_TIMEOUT;
+    while (waitingRxCplt)
+      if (HAL_GetTick() >= timeout) return false;
+
+    return true;
+
+  #else
+
+    uint8_t retries = SDIO_READ_RETRIES;
+    while (retries--) {
+      if (SDIO_StartTransfer_DMA(block, nullptr, dst, count) && SDIO_FinishTransfer_DMA()) return true;
+      TERN_(SDIO_HIGH_SPEED, sdio_step_down());
+    }
+    return false;
+
+  #endif
+}
+
+/**
+ * @brief Write blocks
+ * @details Write consecutive blocks to media with SDIO, using a
+ *          multi-block write (CMD25) for more than one block
+ *
+ * @param block The first block index
  * @param src The block data
+ * @param count The number of blocks
  *
  * @return true on success
  */
-bool SDIO_WriteBlock(uint32_t block, const uint8_t *src) {
+bool SDIO_WriteBlocks(uint32_t block, const uint8_t *src, uint32_t count) {
+  TERN_(SDIO_READ_AHEAD, read_ahead_written(block, count));
+
   #ifdef SDIO_FOR_STM32H7
 
     uint32_t timeout = HAL_GetTick() + SD_TIMEOUT;
@@ -421,7 +748,7 @@ bool SDIO_WriteBlock(uint32_t block, const uint8_t *src) {
       if (HAL_GetTick() >= timeout) return false;
 
     waitingTxCplt = 1;
-    if (HAL_SD_WriteBlocks_DMA(&hsd, (uint8_t*)src, block, 1) != HAL_OK)
+    if (HAL_SD_WriteBlocks_DMA(&hsd, (uint8_t*)src, block, count) != HAL_OK)
       return false;
 
     timeout = HAL_GetTick() + SD_TIMEOUT;
@@ -433,12 +760,26 @@ bool SDIO_WriteBlock(uint32_t block, const uint8_t *src) {
   #else
 
     uint8_t retries = SDIO_READ_RETRIES;
-    while (retries--) if (SDIO_ReadWriteBlock_DMA(block, src, nullptr)) return true;
+    while (retries--) {
+      if (SDIO_StartTransfer_DMA(block, src, nullptr, count) && SDIO_FinishTransfer_DMA()) return true;
+      TERN_(SDIO_HIGH_SPEED, sdio_step_down());
+    }
     return false;
 
   #endif
 }
 
+/**
+ * @brief Write a block
+ * @details Write a block to media with SDIO
+ *
+ * @param block The block index
+ * @param src The block data
+ *
+ * @return true on success
+ */
+bool SDIO_WriteBlock(uint32_t block, const uint8_t *src) { return SDIO_WriteBlocks(block, src, 1); }
+
 bool SDIO_IsReady() {
   return hsd.State == HAL_SD_STATE_READY;
 }
@@ -447,5 +788,5 @@ uint32_t SDIO_GetCardSize() {
   return (uint32_t)(hsd.SdCard.BlockNbr) * (hsd.SdCard.BlockSize);
 }
 
-#endif // SDIO_SUPPORT
+#endif // SDIO_SUPPORT || SD_STAGING
 #endif // HAL_STM32
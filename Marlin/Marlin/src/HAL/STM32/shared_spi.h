@@ -0,0 +1,41 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Arbiter for an SPI bus shared by the main loop and an interrupt
+ *
+ * The ADS1118 is sampled from the temperature ISR on the same SPI pins
+ * as the XPT2046 touch controller. Touch claims the bus for the length of
+ * a transaction, and the ISR skips any tick that finds it claimed. The ISR
+ * always runs to completion, so the main loop never has to wait for it.
+ */
+
+#include <stdint.h>
+
+class SharedSPI {
+public:
+  static volatile uint8_t claims;
+  static void claim()   { claims++; }
+  static void release() { claims--; }
+  static bool busy()    { return claims != 0; }
+};
@@ -0,0 +1,133 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include "../platforms.h"
+
+#ifdef HAL_STM32
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(STEP_DMA)
+
+#include "step_dma.h"
+
+bool StepDMA::enabled; // = false
+uint8_t StepDMA::port_count; // = 0
+StepDMA::motor_t StepDMA::motors[STEP_DMA_MAX_MOTORS];
+uint32_t StepDMA::burst[STEP_DMA_MAX_PORTS][2 * STEP_DMA_MAX_EVENTS + 1];
+
+static GPIO_TypeDef *dma_gpio[STEP_DMA_MAX_PORTS];
+
+// DMA2 stream serving each TIM1 compare channel (DMA channel 6), with its flags clear register
+typedef struct {
+  DMA_Stream_TypeDef *stream;
+  volatile uint32_t *ifcr;
+  uint32_t flags;
+} dma_port_t;
+
+static const dma_port_t dma_port[STEP_DMA_MAX_PORTS] = {
+  { DMA2_Stream1, &DMA2->LIFCR, 0x3DUL <<  6 },   // TIM1_CH1
+  { DMA2_Stream2, &DMA2->LIFCR, 0x3DUL << 16 },   // TIM1_CH2
+  { DMA2_Stream6, &DMA2->HIFCR, 0x3DUL << 16 },   // TIM1_CH3
+  { DMA2_Stream4, &DMA2->HIFCR, 0x3DUL <<  0 }    // TIM1_CH4
+};
+
+void StepDMA::init(const uint32_t slot_ns) {
+  __HAL_RCC_TIM1_CLK_ENABLE();
+  __HAL_RCC_DMA2_CLK_ENABLE();
+
+  // TIM1 is on APB2 and runs at twice PCLK2 when APB2 is divided
+  uint32_t clk = HAL_RCC_GetPCLK2Freq();
+  if (RCC->CFGR & RCC_CFGR_PPRE2_2) clk *= 2;
+
+  // One timer period per edge slot. All compare events fire one tick into each slot,
+  // in frozen mode, so they only request DMA transfers and never drive a pin.
+  TIM1->CR1 = 0;
+  TIM1->PSC = 0;
+  TIM1->ARR = _MAX(2UL, (clk / 1000000UL) * slot_ns / 1000UL) - 1;
+  TIM1->CCMR1 = TIM1->CCMR2 = 0;
+  TIM1->CCR1 = TIM1->CCR2 = TIM1->CCR3 = TIM1->CCR4 = 1;
+  TIM1->DIER = TIM_DIER_CC1DE | TIM_DIER_CC2DE | TIM_DIER_CC3DE | TIM_DIER_CC4DE;
+  TIM1->EGR = TIM_EGR_UG;
+
+  LOOP_L_N(p, STEP_DMA_MAX_PORTS) {
+    DMA_Stream_TypeDef * const s = dma_port[p].stream;
+    s->CR = 0;
+    while (s->CR & DMA_SxCR_EN) { /* nada */ }
+    s->FCR = 0;                                   // Direct mode
+    s->CR = (6UL << DMA_SxCR_CHSEL_Pos)           // Channel 6: TIM1 compare requests
+          | DMA_SxCR_PL                           // Very high priority
+          | DMA_SxCR_MSIZE_1 | DMA_SxCR_PSIZE_1   // 32-bit words
+          | DMA_SxCR_MINC                         // Walk through the burst
+          | DMA_SxCR_DIR_0;                       // Memory to peripheral
+  }
+
+  port_count = 0;
+  enabled = true;
+}
+
+void StepDMA::add_motor(const uint8_t motor, const pin_t pin, const bool invert) {
+  const PinName pn = digitalPinToPinName(pin);
+  GPIO_TypeDef * const gpio = get_GPIO_Port(STM_PORT(pn));
+
+  uint8_t p = 0;
+  while (p < port_count && dma_gpio[p] != gpio) ++p;
+  if (p == port_count) {
+    if (port_count == STEP_DMA_MAX_PORTS) { enabled = false; return; }
+    dma_gpio[port_count++] = gpio;
+    dma_port[p].stream->PAR = uint32_t(&gpio->BSRR);
+  }
+
+  // BSRR sets a pin with the low half-word and resets it with the high half-word
+  const uint32_t set = _BV32(STM_PIN(pn)), reset = set << 16;
+  motors[motor].port = p;
+  motors[motor].active = invert ? reset : set;
+  motors[motor].idle = invert ? set : reset;
+}
+
+bool StepDMA::busy() {
+  LOOP_L_N(p, port_count) if (dma_port[p].stream->CR & DMA_SxCR_EN) return true;
+  return false;
+}
+
+void StepDMA::start(const uint8_t events) {
+  wait();
+
+  // Stop the slot timer so all ports play out in step
+  TIM1->CR1 = 0;
+  TIM1->CNT = 0;
+  TIM1->SR = 0;
+
+  LOOP_L_N(p, port_count) {
+    // A trailing empty slot keeps the stream busy until the last pulse has had its low time
+    burst[p][2 * events] = 0;
+    DMA_Stream_TypeDef * const s = dma_port[p].stream;
+    *dma_port[p].ifcr = dma_port[p].flags;
+    s->NDTR = 2 * events + 1;
+    s->M0AR = uint32_t(burst[p]);
+    s->CR |= DMA_SxCR_EN;
+  }
+
+  TIM1->CR1 = TIM_CR1_CEN;
+}
+
+#endif // STEP_DMA
+#endif // HAL_STM32
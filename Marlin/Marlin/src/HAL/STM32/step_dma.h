@@ -0,0 +1,81 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Timer-triggered DMA step pulse output for STM32F4 (STEP_DMA)
+ *
+ * The Stepper ISR fills a burst of GPIO BSRR words, two edge slots per step
+ * event and one word per step port, then starts the burst. TIM1 compare events
+ * at the slot rate trigger one DMA2 stream per port, so the CPU no longer waits
+ * out the high and low time of every pulse.
+ *
+ * TIM1 CH1-CH4 use DMA2 Streams 1, 2, 6 and 4 (channel 6), leaving Stream 0
+ * (FSMC TFT) and Stream 3 (SDIO, SPI1) alone. All step pins must be on at most
+ * STEP_DMA_MAX_PORTS GPIO ports, otherwise the Stepper steps pins directly.
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#define STEP_DMA_MAX_PORTS  4           // One TIM1 compare channel / DMA stream per port
+#define STEP_DMA_MAX_EVENTS 128         // Matches the largest multi-stepping factor
+#define STEP_DMA_MAX_MOTORS (LINEAR_AXES + E_STEPPERS)
+
+class StepDMA {
+public:
+  static bool enabled;                  // All step pins were mapped to a DMA port
+
+  // Set up TIM1 and the DMA streams for a given edge slot period
+  static void init(const uint32_t slot_ns);
+
+  // Map a motor to its step pin. Clears 'enabled' when the pin needs a port beyond the limit.
+  static void add_motor(const uint8_t motor, const pin_t pin, const bool invert);
+
+  // Start a burst with the step events of a pulse phase, waiting for the previous burst first
+  static void start(const uint8_t events);
+
+  // A burst is still being played out
+  static bool busy();
+  static void wait() { while (busy()) { /* nada */ } }
+
+  // Reset both edge slots of an event
+  FORCE_INLINE static void clear_event(const uint8_t e) {
+    LOOP_L_N(p, port_count) burst[p][2 * e] = burst[p][2 * e + 1] = 0;
+  }
+
+  // Add a step pulse for a motor to an event
+  FORCE_INLINE static void add_step(const uint8_t e, const uint8_t motor) {
+    const motor_t &m = motors[motor];
+    burst[m.port][2 * e]     |= m.active;
+    burst[m.port][2 * e + 1] |= m.idle;
+  }
+
+private:
+  typedef struct {
+    uint8_t port;                       // Index into the DMA ports
+    uint32_t active, idle;              // BSRR words to start and end a pulse
+  } motor_t;
+
+  static uint8_t port_count;
+  static motor_t motors[STEP_DMA_MAX_MOTORS];
+  static uint32_t burst[STEP_DMA_MAX_PORTS][2 * STEP_DMA_MAX_EVENTS + 1];
+};
@@ -31,10 +31,18 @@
 #include "tft_fsmc.h"
 #include "pinconfig.h"
 
+#if ENABLED(ISR_PROFILER)
+  #include "../isr_profiler.h"
+#endif
+
 SRAM_HandleTypeDef TFT_FSMC::SRAMx;
 DMA_HandleTypeDef TFT_FSMC::DMAtx;
 LCD_CONTROLLER_TypeDef *TFT_FSMC::LCD;
 
+// Write timing - can be decreased from 8-15-8 to 0-0-1 with risk of stability loss
+#define FSMC_WRITE_ADDSET 8
+#define FSMC_WRITE_DATAST 8
+
 void TFT_FSMC::Init() {
   uint32_t controllerAddress;
   FSMC_NORSRAM_TimingTypeDef Timing, ExtTiming;
@@ -71,10 +79,15 @@ void TFT_FSMC::Init() {
   Timing.DataLatency = 17;
   Timing.AccessMode = FSMC_ACCESS_MODE_A;
   // Write Timing
-  // Can be decreases from 8-15-8 to 0-0-1 with risk of stability loss
-  ExtTiming.AddressSetupTime = 8;
+  ExtTiming.AddressSetupTime = FSMC_WRITE_ADDSET;
   ExtTiming.AddressHoldTime = 15;
-  ExtTiming.DataSetupTime = 8;
+  ExtTiming.DataSetupTime = FSMC_WRITE_DATAST;
+  #if ENABLED(TFT_FSMC_CALIBRATION)
+    if (write_timing) {   // Keep the calibrated timing when the display is set up again
+      ExtTiming.AddressSetupTime = write_timing & 0xFF;
+      ExtTiming.DataSetupTime = write_timing >> 8;
+    }
+  #endif
   ExtTiming.BusTurnAroundDuration = 0;
   ExtTiming.CLKDivision = 16;
   ExtTiming.DataLatency = 17;
@@ -167,6 +180,71 @@ uint32_t TFT_FSMC::ReadID(tft_data_t Reg) {
   return id;
 }
 
+#if ENABLED(TFT_FSMC_CALIBRATION)
+
+  uint16_t TFT_FSMC::write_timing; // = 0
+
+  void TFT_FSMC::SetWriteTiming(const uint8_t addset, const uint8_t datast) {
+    FSMC_NORSRAM_TimingTypeDef ExtTiming;
+    ExtTiming.AddressSetupTime = addset;
+    ExtTiming.AddressHoldTime = 15;
+    ExtTiming.DataSetupTime = datast;
+    ExtTiming.BusTurnAroundDuration = 0;
+    ExtTiming.CLKDivision = 16;
+    ExtTiming.DataLatency = 17;
+    ExtTiming.AccessMode = FSMC_ACCESS_MODE_A;
+    FSMC_NORSRAM_Extended_Timing_Init(SRAMx.Extended, &ExtTiming, SRAMx.Init.NSBank, FSMC_EXTENDED_MODE_ENABLE);
+  }
+
+  /**
+   * Write patterns to MADCTL (DCS set_address_mode) at the given write timing
+   * and read each one back with get_address_mode at the slow read timing.
+   * D2-D0 are reserved on some controllers, so only D7-D3 are compared.
+   */
+  bool TFT_FSMC::WriteTimingWorks(const uint8_t addset, const uint8_t datast) {
+    static const uint8_t patterns[] = { 0xF8, 0x00, 0xA8, 0x50, 0x88, 0x70, 0xD8, 0x20 };
+    SetWriteTiming(addset, datast);
+    bool ok = true;
+    LOOP_L_N(n, 4) for (const uint8_t p : patterns) {
+      WriteReg(0x36); WriteData(p);
+      WriteReg(0x0B); (void)LCD->RAM;
+      if ((LCD->RAM & 0xF8) != p) { ok = false; break; }
+    }
+    return ok;
+  }
+
+  // Step DATAST down, then ADDSET, while the patterns pass. Return the result with the margin.
+  uint16_t TFT_FSMC::CalibrateWriteTiming() {
+    WriteReg(0x0B); (void)LCD->RAM;
+    const uint8_t madctl = LCD->RAM & 0xFF;
+
+    uint8_t addset = FSMC_WRITE_ADDSET, datast = FSMC_WRITE_DATAST;
+    if (WriteTimingWorks(addset, datast)) {             // Does the panel read back at all?
+      while (datast > 1 && WriteTimingWorks(addset, datast - 1)) datast--;
+      while (addset > 0 && WriteTimingWorks(addset - 1, datast)) addset--;
+      datast = _MIN(datast + (TFT_FSMC_CALIBRATION_MARGIN), FSMC_WRITE_DATAST);
+      addset = _MIN(addset + (TFT_FSMC_CALIBRATION_MARGIN + 1) / 2, FSMC_WRITE_ADDSET);
+      SERIAL_ECHOLNPGM("TFT FSMC write timing ADDSET:", addset, " DATAST:", datast);
+    }
+    else
+      SERIAL_ECHOLNPGM("TFT FSMC write timing can't be verified");
+
+    SetWriteTiming(FSMC_WRITE_ADDSET, FSMC_WRITE_DATAST);
+    WriteReg(0x36); WriteData(madctl);
+    return datast << 8 | addset;
+  }
+
+  // Called by settings load and reset. Calibrate if there's no stored timing.
+  void TFT_FSMC::ApplyWriteTiming() {
+    if (!LCD) return;                                   // Not set up yet
+    TERN_(LVGL_PERFORMANCE_MODE, WaitIT());
+    while (isBusy()) { /* nada */ }
+    if (!write_timing) write_timing = CalibrateWriteTiming();
+    SetWriteTiming(write_timing & 0xFF, write_timing >> 8);
+  }
+
+#endif // TFT_FSMC_CALIBRATION
+
 bool TFT_FSMC::isBusy() {
   #if defined(STM32F1xx)
     volatile bool dmaEnabled = (DMAtx.Instance->CCR & DMA_CCR_EN) != RESET;
@@ -183,6 +261,11 @@ bool TFT_FSMC::isBusy() {
 }
 
 void TFT_FSMC::TransmitDMA(uint32_t MemoryIncrease, uint16_t *Data, uint16_t Count) {
+  TERN_(LVGL_PERFORMANCE_MODE, WaitIT());
+  #if ENABLED(TFT_DOUBLE_BUFFER)
+    while (isBusy()) { /* nada */ }   // Let a background transfer finish
+    __HAL_DMA_CLEAR_FLAG(&DMAtx, __HAL_DMA_GET_TC_FLAG_INDEX(&DMAtx) | __HAL_DMA_GET_TE_FLAG_INDEX(&DMAtx));
+  #endif
   DMAtx.Init.PeriphInc = MemoryIncrease;
   HAL_DMA_Init(&DMAtx);
   DataTransferBegin();
@@ -191,5 +274,38 @@ void TFT_FSMC::TransmitDMA(uint32_t MemoryIncrease, uint16_t *Data, uint16_t Cou
   Abort();
 }
 
+#if ENABLED(TFT_DOUBLE_BUFFER)
+
+  // Start a transfer and return. isBusy() stops the stream when it completes.
+  void TFT_FSMC::TransmitDMA_Async(uint32_t MemoryIncrease, uint16_t *Data, uint16_t Count) {
+    while (isBusy()) { /* nada */ }
+    __HAL_DMA_CLEAR_FLAG(&DMAtx, __HAL_DMA_GET_TC_FLAG_INDEX(&DMAtx) | __HAL_DMA_GET_TE_FLAG_INDEX(&DMAtx));
+    DMAtx.Init.PeriphInc = MemoryIncrease;
+    HAL_DMA_Init(&DMAtx);
+    DataTransferBegin();
+    HAL_DMA_Start(&DMAtx, (uint32_t)Data, (uint32_t)&(LCD->RAM), Count);
+  }
+
+#endif
+
+#if ENABLED(LVGL_PERFORMANCE_MODE)
+
+  void TFT_FSMC::TransmitDMA_IT(uint32_t MemoryIncrease, uint16_t *Data, uint16_t Count) {
+    WaitIT();
+    DMAtx.Init.PeriphInc = MemoryIncrease;
+    HAL_DMA_Init(&DMAtx);
+    DataTransferBegin();
+    HAL_NVIC_SetPriority(DMA2_Stream0_IRQn, 5, 0);
+    HAL_NVIC_EnableIRQ(DMA2_Stream0_IRQn);
+    HAL_DMA_Start_IT(&DMAtx, (uint32_t)Data, (uint32_t)&(LCD->RAM), Count);
+  }
+
+  extern "C" void DMA2_Stream0_IRQHandler(void) {
+    TERN_(ISR_PROFILER, ISR_PROFILE(ISR_PROF_TFT_DMA));
+    HAL_DMA_IRQHandler(&TFT_FSMC::DMAtx);
+  }
+
+#endif
+
 #endif // HAS_FSMC_TFT
 #endif // HAL_STM32
@@ -53,17 +53,40 @@ typedef struct {
 class TFT_FSMC {
   private:
     static SRAM_HandleTypeDef SRAMx;
-    static DMA_HandleTypeDef DMAtx;
+    #if DISABLED(LVGL_PERFORMANCE_MODE)
+      static DMA_HandleTypeDef DMAtx;
+    #endif
 
     static LCD_CONTROLLER_TypeDef *LCD;
 
     static uint32_t ReadID(tft_data_t Reg);
-    static void Transmit(tft_data_t Data) { LCD->RAM = Data; __DSB(); }
+    #if ENABLED(TFT_FSMC_CALIBRATION)
+      static void SetWriteTiming(const uint8_t addset, const uint8_t datast);
+      static bool WriteTimingWorks(const uint8_t addset, const uint8_t datast);
+      static uint16_t CalibrateWriteTiming();
+    #endif
+    static void Transmit(tft_data_t Data) { TERN_(LVGL_PERFORMANCE_MODE, WaitIT()); LCD->RAM = Data; __DSB(); }
     static void TransmitDMA(uint32_t MemoryIncrease, uint16_t *Data, uint16_t Count);
+    #if ENABLED(TFT_DOUBLE_BUFFER)
+      static void TransmitDMA_Async(uint32_t MemoryIncrease, uint16_t *Data, uint16_t Count);
+    #endif
+    #if ENABLED(LVGL_PERFORMANCE_MODE)
+      static void TransmitDMA_IT(uint32_t MemoryIncrease, uint16_t *Data, uint16_t Count);
+    #endif
 
   public:
+    #if ENABLED(LVGL_PERFORMANCE_MODE)
+      static DMA_HandleTypeDef DMAtx;
+      // Wait for an interrupt driven transfer before touching the bus
+      static void WaitIT() { while (DMAtx.State == HAL_DMA_STATE_BUSY) { /* nada */ } }
+    #endif
+
     static void Init();
     static uint32_t GetID();
+    #if ENABLED(TFT_FSMC_CALIBRATION)
+      static uint16_t write_timing;             // DATAST << 8 | ADDSET, or 0 until calibrated
+      static void ApplyWriteTiming();
+    #endif
     static bool isBusy();
     static void Abort() { __HAL_DMA_DISABLE(&DMAtx); }
 
@@ -71,9 +94,16 @@ class TFT_FSMC {
     static void DataTransferEnd() {};
 
     static void WriteData(uint16_t Data) { Transmit(tft_data_t(Data)); }
-    static void WriteReg(uint16_t Reg) { LCD->REG = tft_data_t(Reg); __DSB(); }
+    static void WriteReg(uint16_t Reg) { TERN_(LVGL_PERFORMANCE_MODE, WaitIT()); LCD->REG = tft_data_t(Reg); __DSB(); }
 
     static void WriteSequence(uint16_t *Data, uint16_t Count) { TransmitDMA(DMA_PINC_ENABLE, Data, Count); }
+    #if ENABLED(TFT_DOUBLE_BUFFER)
+      static void WriteSequenceAsync(uint16_t *Data, uint16_t Count) { TransmitDMA_Async(DMA_PINC_ENABLE, Data, Count); }
+    #endif
+    #if ENABLED(LVGL_PERFORMANCE_MODE)
+      // Start a transfer and return. DMAtx.XferCpltCallback runs when it completes.
+      static void WriteSequenceIT(uint16_t *Data, uint16_t Count) { TransmitDMA_IT(DMA_PINC_ENABLE, Data, Count); }
+    #endif
     static void WriteMultiple(uint16_t Color, uint16_t Count) { static uint16_t Data; Data = Color; TransmitDMA(DMA_PINC_DISABLE, &Data, Count); }
     static void WriteMultiple(uint16_t Color, uint32_t Count) {
       static uint16_t Data; Data = Color;
@@ -31,6 +31,10 @@
 #include "tft_spi.h"
 #include "pinconfig.h"
 
+#if ENABLED(ISR_PROFILER)
+  #include "../isr_profiler.h"
+#endif
+
 SPI_HandleTypeDef TFT_SPI::SPIx;
 DMA_HandleTypeDef TFT_SPI::DMAtx;
 
@@ -262,7 +266,10 @@ void TFT_SPI::TransmitDMA(uint32_t MemoryIncrease, uint16_t *Data, uint16_t Coun
     SET_BIT(SPIx.Instance->CR2, SPI_CR2_TXDMAEN);   // Enable Tx DMA Request
   }
 
-  extern "C" void DMA2_Stream3_IRQHandler(void) { HAL_DMA_IRQHandler(&TFT_SPI::DMAtx); }
+  extern "C" void DMA2_Stream3_IRQHandler(void) {
+    TERN_(ISR_PROFILER, ISR_PROFILE(ISR_PROF_TFT_DMA));
+    HAL_DMA_IRQHandler(&TFT_SPI::DMAtx);
+  }
 
 #endif
 
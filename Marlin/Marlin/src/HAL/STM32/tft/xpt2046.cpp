@@ -94,6 +94,7 @@ void XPT2046::Init() {
   }
 
   getRawData(XPT2046_Z1);
+  TERN_(TOUCH_BACKGROUND_SAMPLING, ready = true);
 }
 
 bool XPT2046::isTouched() {
@@ -107,11 +108,20 @@ bool XPT2046::isTouched() {
 }
 
 bool XPT2046::getRawPoint(int16_t *x, int16_t *y) {
-  if (isBusy()) return false;
-  if (!isTouched()) return false;
-  *x = getRawData(XPT2046_X);
-  *y = getRawData(XPT2046_Y);
-  return isTouched();
+  #if ENABLED(TOUCH_BACKGROUND_SAMPLING)
+    // Only take what the temperature ISR has sampled. The bus is never touched here.
+    const uint32_t p = point;
+    if (!p) return false;
+    *x = p & 0xFFFF;
+    *y = p >> 16;
+    return true;
+  #else
+    if (isBusy()) return false;
+    if (!isTouched()) return false;
+    *x = getRawData(XPT2046_X);
+    *y = getRawData(XPT2046_Y);
+    return isTouched();
+  #endif
 }
 
 uint16_t XPT2046::getRawData(const XPTCoordinate coordinate) {
@@ -140,6 +150,58 @@ uint16_t XPT2046::getRawData(const XPTCoordinate coordinate) {
   return (data[0] + data[1]) >> 1;
 }
 
+#if ENABLED(TOUCH_BACKGROUND_SAMPLING)
+
+volatile uint32_t XPT2046::point; // = 0
+bool XPT2046::ready; // = false
+
+// One conversion, without claiming the shared bus. ISR only.
+uint16_t XPT2046::readAxis(const XPTCoordinate coordinate) {
+  if (SPIx.Instance) HAL_SPI_Init(&SPIx);
+  WRITE(TOUCH_CS_PIN, LOW);
+  IO(coordinate);
+  const uint16_t data = (IO() << 4) | (IO() >> 4);
+  WRITE(TOUCH_CS_PIN, HIGH);
+  return data;
+}
+
+static uint16_t median(uint16_t * const v) {
+  for (uint8_t i = 1; i < TOUCH_BACKGROUND_SAMPLES; i++)
+    for (uint8_t j = i; j && v[j - 1] > v[j]; j--) { const uint16_t t = v[j]; v[j] = v[j - 1]; v[j - 1] = t; }
+  return v[TOUCH_BACKGROUND_SAMPLES / 2];
+}
+
+/**
+ * Called by the temperature ISR on every tick, after the ADS1118 is done
+ * with the bus. While PENIRQ is low one X/Y pair is converted per tick, and
+ * every TOUCH_BACKGROUND_SAMPLES pairs the median point is posted for
+ * getRawPoint(). A release drops the point and any partial set.
+ */
+void XPT2046::sample_isr() {
+  static uint16_t sx[TOUCH_BACKGROUND_SAMPLES], sy[TOUCH_BACKGROUND_SAMPLES];
+  static uint8_t count = 0;
+
+  if (!ready) return;
+
+  if (READ(TOUCH_INT_PIN) != LOW) {
+    count = 0;
+    point = 0;
+    return;
+  }
+
+  TERN_(HAS_SPI_ADS1118, if (SharedSPI::busy()) return);
+
+  sx[count] = readAxis(XPT2046_X);
+  sy[count] = readAxis(XPT2046_Y);
+  if (++count < TOUCH_BACKGROUND_SAMPLES) return;
+  count = 0;
+
+  const uint16_t x = median(sx), y = median(sy);
+  point = (x && y) ? x | (uint32_t(y) << 16) : 0;
+}
+
+#endif // TOUCH_BACKGROUND_SAMPLING
+
 uint16_t XPT2046::HardwareIO(uint16_t data) {
   __HAL_SPI_ENABLE(&SPIx);
   while ((SPIx.Instance->SR & SPI_FLAG_TXE) != SPI_FLAG_TXE) {}
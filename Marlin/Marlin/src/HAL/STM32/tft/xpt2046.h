@@ -29,6 +29,10 @@
 
 #include "../../../inc/MarlinConfig.h"
 
+#if HAS_SPI_ADS1118
+  #include "../shared_spi.h"
+#endif
+
 // Not using regular SPI interface by default to avoid SPI mode conflicts with other SPI devices
 
 #if !PIN_EXISTS(TOUCH_MISO)
@@ -69,13 +73,22 @@ private:
   static uint16_t getRawData(const XPTCoordinate coordinate);
   static bool isTouched();
 
-  static void DataTransferBegin() { if (SPIx.Instance) { HAL_SPI_Init(&SPIx); } WRITE(TOUCH_CS_PIN, LOW); };
-  static void DataTransferEnd() { WRITE(TOUCH_CS_PIN, HIGH); };
+  static void DataTransferBegin() { TERN_(HAS_SPI_ADS1118, SharedSPI::claim()); if (SPIx.Instance) { HAL_SPI_Init(&SPIx); } WRITE(TOUCH_CS_PIN, LOW); };
+  static void DataTransferEnd() { WRITE(TOUCH_CS_PIN, HIGH); TERN_(HAS_SPI_ADS1118, SharedSPI::release()); };
   static uint16_t HardwareIO(uint16_t data);
   static uint16_t SoftwareIO(uint16_t data);
   static uint16_t IO(uint16_t data = 0) { return SPIx.Instance ? HardwareIO(data) : SoftwareIO(data); }
 
+  #if ENABLED(TOUCH_BACKGROUND_SAMPLING)
+    static volatile uint32_t point;   // Latest filtered point, x | y << 16. 0 when released.
+    static bool ready;
+    static uint16_t readAxis(const XPTCoordinate coordinate);
+  #endif
+
 public:
   static void Init();
   static bool getRawPoint(int16_t *x, int16_t *y);
+  #if ENABLED(TOUCH_BACKGROUND_SAMPLING)
+    static void sample_isr();
+  #endif
 };
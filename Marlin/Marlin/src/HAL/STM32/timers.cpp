@@ -44,6 +44,9 @@
 #ifndef TEMP_TIMER_IRQ_PRIO
   #define TEMP_TIMER_IRQ_PRIO TEMP_TIMER_IRQ_PRIO_DEFAULT
 #endif
+#ifndef TEMP_TASK_IRQ_PRIO
+  #define TEMP_TASK_IRQ_PRIO 15 // PendSV below the Temperature ISR, so it runs once the ISR returns
+#endif
 #if HAS_TMC_SW_SERIAL
   #include <SoftwareSerial.h>
   #ifndef SWSERIAL_TIMER_IRQ_PRIO
@@ -168,6 +171,7 @@ void HAL_timer_start(const uint8_t timer_num, const uint32_t frequency) {
         break;
       case MF_TIMER_TEMP:
         timer_instance[timer_num]->setInterruptPriority(TEMP_TIMER_IRQ_PRIO, 0);
+        TERN_(DEFERRED_TEMP_SENSORS, HAL_NVIC_SetPriority(PendSV_IRQn, TEMP_TASK_IRQ_PRIO, 0));
         break;
     }
   }
@@ -77,6 +77,10 @@ extern void Temp_Handler();
   #define HAL_TEMP_TIMER_ISR() void Temp_Handler()
 #endif
 
+// Lowest priority software interrupt that runs the work deferred by the Temperature ISR
+#define HAL_TEMP_TASK_ISR() extern "C" void PendSV_Handler()
+#define HAL_temp_task_pend() (SCB->ICSR = SCB_ICSR_PENDSVSET_Msk)
+
 // ------------------------
 // Public Variables
 // ------------------------
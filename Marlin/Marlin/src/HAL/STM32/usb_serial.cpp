@@ -31,7 +31,7 @@
 #include "usb_serial.h"
 #include "../../feature/e_parser.h"
 
-EmergencyParser::State emergency_state = EmergencyParser::State::EP_RESET;
+EmergencyParser::State emergency_state = EmergencyParser::EP_RESET;
 
 int8_t (*USBD_CDC_Receive_original) (uint8_t *Buf, uint32_t *Len) = nullptr;
 
@@ -49,3 +49,7 @@
 #if ENABLED(EMERGENCY_PARSER) && !defined(USE_USB_COMPOSITE) && ((SERIAL_PORT == -1 && !defined(SERIAL_PORT_2)) || (SERIAL_PORT_2 == -1 && !defined(SERIAL_PORT)))
   #error "EMERGENCY_PARSER is only supported by HardwareSerial or USBComposite in HAL/STM32F1."
 #endif
+
+#if ENABLED(TFT_DOUBLE_BUFFER)
+  #error "TFT_DOUBLE_BUFFER is not supported in HAL/STM32F1. Use HAL/STM32 (non-maple) instead."
+#endif
@@ -61,6 +61,8 @@
   // Pointer to asm function, calling the functions has a ~20 cycles overhead
   DelayImpl DelayCycleFnc = delay_asm;
 
+  bool cycle_counter_enabled; // = false
+
   void calibrate_delay_loop() {
     // Check if we have a working DWT implementation in the CPU (see https://developer.arm.com/documentation/ddi0439/b/Data-Watchpoint-and-Trace-Unit/DWT-Programmers-Model)
     if (!HW_REG(_DWT_CTRL)) {
@@ -103,6 +105,7 @@
 
       // Use safer DWT function
       DelayCycleFnc = delay_dwt;
+      cycle_counter_enabled = true;
     }
   }
 
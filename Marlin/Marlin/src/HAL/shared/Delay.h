@@ -102,6 +102,14 @@ void calibrate_delay_loop();
   // Teensy compiler is too old and does not accept smart delay compile-time / run-time selection correctly
   #define DELAY_US(x) DelayCycleFnc((x) * ((F_CPU) / 1000000UL))
 
+  // Free-running CPU cycle counter, started by calibrate_delay_loop() when the CPU has a DWT.
+  // Reads 0 without a DWT (e.g., Cortex-M0). Wraps every 2^32 cycles, so only time short spans.
+  #define HAS_CYCLE_COUNTER 1
+  extern bool cycle_counter_enabled;
+  FORCE_INLINE static uint32_t get_cycle_count() {
+    return cycle_counter_enabled ? *(volatile uint32_t *)0xE0001004 : 0;
+  }
+
 #elif defined(__AVR__)
   FORCE_INLINE static void __delay_up_to_3c(uint8_t cycles) {
     switch (cycles) {
@@ -172,6 +180,13 @@ void calibrate_delay_loop();
 
   // DELAY_CYCLES specified inside platform
 
+  #ifdef __PLAT_LINUX__
+    // The host clock, counting at F_CPU, so the cycle-based reports also work on a PC
+    #include "../LINUX/hardware/Clock.h"
+    #define HAS_CYCLE_COUNTER 1
+    FORCE_INLINE static uint32_t get_cycle_count() { return uint32_t(Clock::ticks()); }
+  #endif
+
   // Delay in microseconds
   #define DELAY_US(x) DELAY_CYCLES((x) * ((F_CPU) / 1000000UL))
 #else
@@ -180,6 +195,10 @@ void calibrate_delay_loop();
 
 #endif
 
+#ifndef HAS_CYCLE_COUNTER
+  FORCE_INLINE static uint32_t get_cycle_count() { return 0; } // No cycle counter on this platform
+#endif
+
 /**************************************************************
  *  Delay in nanoseconds. Requires the F_CPU macro.
  *  These macros follow avr-libc delay conventions.
@@ -171,6 +171,8 @@ static ContextSavedFrame savedFrame;
 static uint8_t           lastCause;
 bool resume_from_fault() {
   static const char* causestr[] = { "Thread", "Rsvd", "NMI", "Hard", "Mem", "Bus", "Usage", "7", "8", "9", "10", "SVC", "Dbg", "13", "PendSV", "SysTk", "IRQ" };
+  hook_save_fault(lastCause, (const uint32_t*)&savedFrame);
+
   // Reinit the serial link (might only work if implemented in each of your boards)
   MinSerial::init();
 
@@ -26,3 +26,4 @@ void * __attribute__((weak)) hook_get_memfault_vector_address(unsigned) { return
 void * __attribute__((weak)) hook_get_busfault_vector_address(unsigned) { return 0; }
 void * __attribute__((weak)) hook_get_usagefault_vector_address(unsigned) { return 0; }
 void __attribute__((weak)) hook_last_resort_func() {}
+void __attribute__((weak)) hook_save_fault(const uint8_t, const uint32_t[16]) {}
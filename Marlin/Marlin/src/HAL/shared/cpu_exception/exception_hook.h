@@ -21,6 +21,8 @@
  */
 #pragma once
 
+#include <stdint.h>
+
 /* Here is the expected behavior of a system producing a CPU exception with this hook installed:
    1. Before the system is crashed
      1.1 Upon validation (not done yet in this code, but we could be using DEBUG flags here to allow/disallow hooking)
@@ -52,3 +54,7 @@ void * __attribute__((weak)) hook_get_usagefault_vector_address(unsigned base_ad
 
 // Last resort function that can be called after the exception handler was called.
 void __attribute__((weak)) hook_last_resort_func();
+
+// Called with the exception number and the saved state (R0-R3, R12, LR, PC, xPSR, CFSR, HFSR, DFSR, AFSR, MMAR, BFAR, SP, EXC_RETURN)
+// before anything is sent, so the crash can be kept for later (CRASH_CAPTURE)
+void __attribute__((weak)) hook_save_fault(const uint8_t cause, const uint32_t regs[16]);
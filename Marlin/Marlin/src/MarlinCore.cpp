@@ -182,6 +182,14 @@
   #include "feature/powerloss.h"
 #endif
 
+#if ENABLED(TIMELAPSE)
+  #include "feature/timelapse.h"
+#endif
+
+#if ENABLED(INPUT_REPLAY)
+  #include "feature/input_replay.h"
+#endif
+
 #if ENABLED(CANCEL_OBJECTS)
   #include "feature/cancel_object.h"
 #endif
@@ -198,6 +206,46 @@
   #include "feature/hotend_idle.h"
 #endif
 
+#if ENABLED(HOTEND_STANDBY_LOOKAHEAD)
+  #include "feature/hotend_standby.h"
+#endif
+
+#if ENABLED(PRINT_TIME_ESTIMATE)
+  #include "feature/print_time.h"
+#endif
+
+#if ENABLED(SD_JOB_COMPILE)
+  #include "feature/job_cache.h"
+#endif
+
+#if ENABLED(MEMORY_PROFILES)
+  #include "feature/memory_profile.h"
+#endif
+
+#if ENABLED(LINE_MERGE)
+  #include "feature/line_merge.h"
+#endif
+
+#if ENABLED(IDLE_SCHEDULER)
+  #include "feature/idle_tasks.h"
+#endif
+
+#if ENABLED(DIGIPOT_DYNAMIC_CURRENT)
+  #include "feature/digipot/dynamic_current.h"
+#endif
+
+#if ENABLED(FF_RTOS_TASKS)
+  #include "HAL/STM32/rtos_tasks.h"
+#endif
+
+#if ENABLED(PATH_BLENDING)
+  #include "feature/path_blend.h"
+#endif
+
+#if ENABLED(CRASH_CAPTURE)
+  #include "feature/crash_capture.h"
+#endif
+
 #if ENABLED(TEMP_STAT_LEDS)
   #include "feature/leds/tempstat.h"
 #endif
@@ -216,6 +264,10 @@
   #include "feature/fancheck.h"
 #endif
 
+#if ENABLED(AUTO_REPORT_STATUS)
+  #include "feature/status_report.h"
+#endif
+
 #if ENABLED(USE_CONTROLLER_FAN)
   #include "feature/controllerfan.h"
 #endif
@@ -256,6 +308,34 @@ PGMSTR(M112_KILL_STR, "M112 Shutdown");
 
 MarlinState marlin_state = MF_INITIALIZING;
 
+#if ENABLED(STAGED_STARTUP)
+  millis_t boot_timeline[BOOT_PHASES]; // = { 0 }
+  #if BOTH(HAS_WIRED_LCD, SHOW_BOOTSCREEN)
+    static millis_t bootscreen_ms;
+  #endif
+
+  static void boot_phase_done(const BootPhase phase) { boot_timeline[phase] = _MAX(millis(), 1UL); }
+
+  /**
+   * Finish the phases of startup deferred by setup()
+   */
+  static void boot_task() {
+    if (!boot_timeline[BOOT_SETTINGS]) {
+      #if ENABLED(SDCARD_EEPROM_EMULATION)
+        if (IS_SD_INSERTED()) card.mount(); // Mount media with settings before first_load
+        settings.first_load();
+      #endif
+      boot_phase_done(BOOT_SETTINGS);
+    }
+    #if BOTH(HAS_WIRED_LCD, SHOW_BOOTSCREEN)
+      if (!boot_timeline[BOOT_UI] && ELAPSED(millis(), bootscreen_ms + (BOOTSCREEN_TIMEOUT))) {
+        ui.bootscreen_completion(BOOTSCREEN_TIMEOUT);
+        boot_phase_done(BOOT_UI);
+      }
+    #endif
+  }
+#endif
+
 // For M109 and M190, this flag may be cleared (by M108) to exit the wait loop
 bool wait_for_heatup = true;
 
@@ -358,6 +438,7 @@ void startOrResumeJob() {
 
   inline void abortSDPrinting() {
     IF_DISABLED(NO_SD_AUTOSTART, card.autofile_cancel());
+    TERN_(SD_JOB_QUEUE, card.job_queue_clear());
     card.abortFilePrintNow(TERN_(SD_RESORT, true));
 
     queue.clear();
@@ -750,9 +831,107 @@ inline void manage_inactivity(const bool no_stepper_sleep=false) {
   #endif
 }
 
+// Run i2c Position Encoders
+#if ENABLED(I2C_POSITION_ENCODERS)
+  inline void idle_i2c_encoders() {
+    static millis_t i2cpem_next_update_ms;
+    if (planner.has_blocks_queued()) {
+      const millis_t ms = millis();
+      if (ELAPSED(ms, i2cpem_next_update_ms)) {
+        I2CPEM.update();
+        i2cpem_next_update_ms = ms + I2CPE_MIN_UPD_TIME_MS;
+      }
+    }
+  }
+#endif
+
+// Auto-report Temperatures / SD Status
+#if HAS_AUTO_REPORTING
+  inline void idle_auto_report() {
+    if (!gcode.autoreport_paused) {
+      TERN_(AUTO_REPORT_TEMPERATURES, thermalManager.auto_reporter.tick());
+      TERN_(TEMP_TELEMETRY, thermalManager.telemetry_reporter.tick());
+      TERN_(AUTO_REPORT_FANS, fan_check.auto_reporter.tick());
+      TERN_(AUTO_REPORT_SD_STATUS, card.auto_reporter.tick());
+      TERN_(AUTO_REPORT_POSITION, position_auto_reporter.tick());
+      TERN_(AUTO_REPORT_STATUS, status_auto_reporter.tick());
+      TERN_(BUFFER_MONITORING, queue.auto_report_buffer_statistics());
+      TERN_(STREAM_STATISTICS, queue.stream_auto_reporter.tick());
+    }
+  }
+#endif
+
+// Handle UI input / draw events
+void idle_ui_update() {
+  if (TERN1(STAGED_STARTUP, boot_timeline[BOOT_UI]))  // Keep the boot screen up
+    TERN(DWIN_CREALITY_LCD, DWIN_Update(), ui.update());
+}
+
+#if ENABLED(IDLE_SCHEDULER)
+
+  /**
+   * Register the periodic idle() tasks. Most of them have their own interval or
+   * debounce inside, so the period only sets how often they get to look.
+   */
+  static void register_idle_tasks() {
+    //                 task                               name                period  deadline  priority
+    idle_scheduler.add(idle_ui_update,                    PSTR("ui"),              1,       10,  0);
+    #if ENABLED(SDSUPPORT)
+      idle_scheduler.add([]{ card.manage_media(); },      PSTR("media"),          50,      100,  1);
+    #endif
+    #if ENABLED(I2C_POSITION_ENCODERS)
+      idle_scheduler.add(idle_i2c_encoders,               PSTR("i2cpem"),  I2CPE_MIN_UPD_TIME_MS, 20, 2);
+    #endif
+    #if ENABLED(HOTEND_STANDBY_LOOKAHEAD)
+      idle_scheduler.add([]{ hotend_standby.task(); },    PSTR("standby"),        50,      100,  2);
+    #endif
+    #if ENABLED(PRINT_TIME_ESTIMATE)
+      idle_scheduler.add([]{ print_estimate.task(); },    PSTR("estimate"),      100,      500,  3);
+    #endif
+    #if ENABLED(DIGIPOT_DYNAMIC_CURRENT)
+      idle_scheduler.add([]{ dynamic_current.task(); },   PSTR("current"),        20,       50,  2);
+    #endif
+    #if HAS_ETHERNET
+      idle_scheduler.add([]{ ethernet.check(); },         PSTR("ethernet"),      100,      100,  3);
+    #endif
+    #if HAS_AUTO_REPORTING
+      idle_scheduler.add(idle_auto_report,                PSTR("report"),         50,      100,  3);
+    #endif
+    #if ENABLED(HOST_KEEPALIVE_FEATURE)
+      idle_scheduler.add([]{ gcode.host_keepalive(); },   PSTR("keepalive"),     100,     1000,  4);
+    #endif
+    #if ENABLED(PRINTCOUNTER)
+      idle_scheduler.add([]{ print_job_timer.tick(); },   PSTR("printtimer"),    100,      500,  4);
+    #endif
+    #if ENABLED(SD_JOB_INFO)
+      idle_scheduler.add([]{ card.job_info_task(); },     PSTR("jobinfo"),        10,      200,  5);
+    #endif
+    #if ENABLED(CANCEL_OBJECTS_SEEK)
+      idle_scheduler.add([]{ card.skip_scan_task(); },    PSTR("cancelseek"),      5,      100,  5);
+    #endif
+    #if ENABLED(SD_JOB_QUEUE)
+      idle_scheduler.add([]{ card.job_queue_task(); },    PSTR("jobqueue"),       10,      200,  5);
+    #endif
+    #if ENABLED(SD_LOG_BUFFER)
+      idle_scheduler.add([]{ card.log_task(); },          PSTR("sdlog"),          10,      100,  5);
+    #endif
+    #if ENABLED(SD_STAGING)
+      idle_scheduler.add([]{ card.stage_task(); },        PSTR("sdstage"),        10,      200,  5);
+    #endif
+    #if ENABLED(SD_JOB_COMPILE)
+      idle_scheduler.add([]{ job_cache.task(); },         PSTR("compile"),         5,      200,  5);
+    #endif
+    #if ENABLED(CRASH_CAPTURE)
+      idle_scheduler.add([]{ crash_capture.task(); },     PSTR("crashlog"),     1000,     1000,  5);
+    #endif
+  }
+
+#endif
+
 /**
  * Standard idle routine keeps the machine alive:
  *  - Core Marlin activities
+ *  - Apply realtime overrides
  *  - Manage heaters (and Watchdog)
  *  - Max7219 heartbeat, animation, etc.
  *
@@ -763,6 +942,7 @@ inline void manage_inactivity(const bool no_stepper_sleep=false) {
  *  - Run StallGuard endstop checks
  *  - Handle SD Card insert / remove
  *  - Handle USB Flash Drive insert / remove
+ *    (With IDLE_SCHEDULER only the most urgent due task below runs per call)
  *  - Announce Host Keepalive state (if any)
  *  - Update the Print Job Timer state
  *  - Update the Beeper queue
@@ -772,15 +952,35 @@ inline void manage_inactivity(const bool no_stepper_sleep=false) {
  *  - Update the Průša MMU2
  *  - Handle Joystick jogging
  */
+#if ENABLED(M100_FREE_MEMORY_WATCHER)
+  void M100_idle_watch(const uint16_t depth);
+#endif
+
 void idle(bool no_stepper_sleep/*=false*/) {
-  #if ENABLED(MARLIN_DEV_MODE)
+  #if EITHER(MARLIN_DEV_MODE, M100_FREE_MEMORY_WATCHER)
     static uint16_t idle_depth = 0;
-    if (++idle_depth > 5) SERIAL_ECHOLNPGM("idle() call depth: ", idle_depth);
+    ++idle_depth;
+    TERN_(MARLIN_DEV_MODE, if (idle_depth > 5) SERIAL_ECHOLNPGM("idle() call depth: ", idle_depth));
+    TERN_(M100_FREE_MEMORY_WATCHER, M100_idle_watch(idle_depth));
+  #endif
+
+  // Plan the held G0/G1 moves once no command follows them
+  #if EITHER(LINE_MERGE, PATH_BLENDING)
+    if (!queue.has_commands_queued()) {
+      TERN_(LINE_MERGE, line_merge.flush());
+      TERN_(PATH_BLENDING, path_blend.flush());
+    }
   #endif
 
+  // Plan the staged segments as blocks free up
+  TERN_(PLANNER_STAGING, planner.commit_staged());
+
   // Core Marlin activities
   manage_inactivity(no_stepper_sleep);
 
+  // Apply realtime overrides received by the emergency parser
+  TERN_(REALTIME_OVERRIDES, emergency_parser.apply_overrides());
+
   // Manage Heaters (and Watchdog)
   thermalManager.task();
 
@@ -790,6 +990,9 @@ void idle(bool no_stepper_sleep/*=false*/) {
   // Return if setup() isn't completed
   if (marlin_state == MF_INITIALIZING) goto IDLE_DONE;
 
+  // Finish startup
+  TERN_(STAGED_STARTUP, if (!boot_timeline[BOOT_UI]) boot_task());
+
   // TODO: Still causing errors
   (void)check_tool_sensor_stats(active_extruder, true);
 
@@ -802,9 +1005,6 @@ void idle(bool no_stepper_sleep/*=false*/) {
   // Run HAL idle tasks
   hal.idletask();
 
-  // Check network connection
-  TERN_(HAS_ETHERNET, ethernet.check());
-
   // Handle Power-Loss Recovery
   #if ENABLED(POWER_LOSS_RECOVERY) && PIN_EXISTS(POWER_LOSS)
     if (IS_SD_PRINTING()) recovery.outage();
@@ -816,47 +1016,55 @@ void idle(bool no_stepper_sleep/*=false*/) {
       LOOP_L_N(i, 4) if (endstops.tmc_spi_homing_check()) break; // Read SGT 4 times per idle loop
   #endif
 
-  // Handle SD Card insert / remove
-  TERN_(SDSUPPORT, card.manage_media());
-
   // Handle USB Flash Drive insert / remove
   TERN_(USB_FLASH_DRIVE_SUPPORT, card.diskIODriver()->idle());
 
-  // Announce Host Keepalive state (if any)
-  TERN_(HOST_KEEPALIVE_FEATURE, gcode.host_keepalive());
-
-  // Update the Print Job Timer state
-  TERN_(PRINTCOUNTER, print_job_timer.tick());
-
   // Update the Beeper queue
   TERN_(HAS_BEEPER, buzzer.tick());
 
-  // Handle UI input / draw events
-  TERN(DWIN_CREALITY_LCD, DWIN_Update(), ui.update());
+  // Write the input recording, or play it back
+  TERN_(INPUT_REPLAY, input_replay.task());
 
-  // Run i2c Position Encoders
-  #if ENABLED(I2C_POSITION_ENCODERS)
-  {
-    static millis_t i2cpem_next_update_ms;
-    if (planner.has_blocks_queued()) {
-      const millis_t ms = millis();
-      if (ELAPSED(ms, i2cpem_next_update_ms)) {
-        I2CPEM.update();
-        i2cpem_next_update_ms = ms + I2CPE_MIN_UPD_TIME_MS;
-      }
-    }
-  }
-  #endif
+  // Re-time the planned moves for a new feedrate override
+  TERN_(INSTANT_FEEDRATE_OVERRIDE, planner.apply_feedrate_override());
+
+  #if ENABLED(IDLE_SCHEDULER)
+
+    // Run the periodic task with the earliest deadline
+    idle_scheduler.run();
+
+  #else
+
+    // Check network connection
+    TERN_(HAS_ETHERNET, ethernet.check());
+
+    // Handle SD Card insert / remove (in the io task with FF_RTOS_TASKS)
+    TERN_(SDSUPPORT, IF_DISABLED(FF_RTOS_TASKS, card.manage_media()));
+    TERN_(SD_JOB_INFO, card.job_info_task());
+    TERN_(CANCEL_OBJECTS_SEEK, card.skip_scan_task());
+    TERN_(SD_JOB_QUEUE, card.job_queue_task());
+    TERN_(SD_LOG_BUFFER, card.log_task());
+    TERN_(SD_STAGING, IF_DISABLED(FF_RTOS_TASKS, card.stage_task()));
+    TERN_(SD_JOB_COMPILE, job_cache.task());
+    TERN_(CRASH_CAPTURE, crash_capture.task());
+    TERN_(HOTEND_STANDBY_LOOKAHEAD, hotend_standby.task());
+    TERN_(PRINT_TIME_ESTIMATE, print_estimate.task());
+
+    // Scale the motor currents for the queued moves
+    TERN_(DIGIPOT_DYNAMIC_CURRENT, dynamic_current.task());
+
+    // Announce Host Keepalive state (if any)
+    TERN_(HOST_KEEPALIVE_FEATURE, gcode.host_keepalive());
+
+    // Update the Print Job Timer state
+    TERN_(PRINTCOUNTER, print_job_timer.tick());
+
+    IF_DISABLED(FF_RTOS_TASKS, idle_ui_update()); // Else the ui task runs it
+
+    TERN_(I2C_POSITION_ENCODERS, idle_i2c_encoders());
+
+    TERN_(HAS_AUTO_REPORTING, idle_auto_report());
 
-  // Auto-report Temperatures / SD Status
-  #if HAS_AUTO_REPORTING
-    if (!gcode.autoreport_paused) {
-      TERN_(AUTO_REPORT_TEMPERATURES, thermalManager.auto_reporter.tick());
-      TERN_(AUTO_REPORT_FANS, fan_check.auto_reporter.tick());
-      TERN_(AUTO_REPORT_SD_STATUS, card.auto_reporter.tick());
-      TERN_(AUTO_REPORT_POSITION, position_auto_reporter.tick());
-      TERN_(BUFFER_MONITORING, queue.auto_report_buffer_statistics());
-    }
   #endif
 
   // Update the Průša MMU2
@@ -871,8 +1079,13 @@ void idle(bool no_stepper_sleep/*=false*/) {
   // Update the LVGL interface
   TERN_(HAS_TFT_LVGL_UI, LV_TASK_HANDLER());
 
+  // Let the ui and io tasks take the Marlin lock
+  TERN_(FF_RTOS_TASKS, RTOSTasks::idle());
+
   IDLE_DONE:
-  TERN_(MARLIN_DEV_MODE, idle_depth--);
+  #if EITHER(MARLIN_DEV_MODE, M100_FREE_MEMORY_WATCHER)
+    idle_depth--;
+  #endif
   return;
 }
 
@@ -883,6 +1096,8 @@ void idle(bool no_stepper_sleep/*=false*/) {
 void kill(FSTR_P const lcd_error/*=nullptr*/, FSTR_P const lcd_component/*=nullptr*/, const bool steppers_off/*=false*/) {
   thermalManager.disable_all_heaters();
 
+  TERN_(FF_RTOS_TASKS, RTOSTasks::stop()); // Keep the ui task off the display
+
   TERN_(HAS_CUTTER, cutter.kill()); // Full cutter shutdown including ISR control
 
   // Echo the LCD message to serial for extra context
@@ -1118,6 +1333,11 @@ inline void tmc_standby_setup() {
  *  - Set Marlin to RUNNING State
  */
 void setup() {
+  #if ENABLED(FF_RTOS_TASKS)
+    // Start the tasks. setup() then runs again, and loop() forever, in the marlin task.
+    if (!RTOSTasks::started()) RTOSTasks::start();
+  #endif
+
   #ifdef FASTIO_INIT
     FASTIO_INIT();
   #endif
@@ -1165,6 +1385,7 @@ void setup() {
     #endif
   #endif
   SERIAL_ECHOLNPGM("start");
+  TERN_(STAGED_STARTUP, boot_phase_done(BOOT_SERIAL));
 
   // Set up these pins early to prevent suicide
   #if HAS_KILL
@@ -1208,6 +1429,8 @@ void setup() {
 
   TERN_(DYNAMIC_VECTORTABLE, hook_cpu_exceptions()); // If supported, install Marlin exception handlers at runtime
 
+  TERN_(MEMORY_PROFILES, SETUP_RUN(memory_profile.init())); // Give the queue, SD cache and TFT their RAM
+
   SETUP_RUN(hal.init());
 
   // Init and disable SPI thermocouples; this is still needed
@@ -1265,6 +1488,10 @@ void setup() {
   if (mcu & RST_WATCHDOG)  SERIAL_ECHOLNPGM(STR_WATCHDOG_RESET);
   if (mcu & RST_SOFTWARE)  SERIAL_ECHOLNPGM(STR_SOFTWARE_RESET);
 
+  #if ENABLED(CRASH_CAPTURE)
+    SETUP_RUN(crash_capture.init());  // Report a crash from before the reset, watch the watchdog
+  #endif
+
   // Identify myself as Marlin x.x.x
   SERIAL_ECHOLNPGM("Marlin " SHORT_BUILD_VERSION);
   #if defined(STRING_DISTRIBUTION_DATE) && defined(STRING_CONFIG_H_AUTHOR)
@@ -1313,16 +1540,25 @@ void setup() {
     #endif
   #endif
 
-  #if BOTH(SDSUPPORT, SDCARD_EEPROM_EMULATION)
-    SETUP_RUN(card.mount());          // Mount media with settings before first_load
-  #endif
+  #if BOTH(STAGED_STARTUP, SDCARD_EEPROM_EMULATION)
+    SETUP_RUN(settings.reset());      // Use defaults until boot_task() loads settings from the media
+  #else
+    #if BOTH(SDSUPPORT, SDCARD_EEPROM_EMULATION)
+      SETUP_RUN(card.mount());        // Mount media with settings before first_load
+    #endif
 
-  SETUP_RUN(settings.first_load());   // Load data from EEPROM if available (or use defaults)
+    SETUP_RUN(settings.first_load()); // Load data from EEPROM if available (or use defaults)
                                       // This also updates variables in the planner, elsewhere
+    TERN_(MEMORY_PROFILES, SETUP_RUN(memory_profile.apply())); // Switch to the saved memory profile
+  #endif
 
   #if BOTH(HAS_WIRED_LCD, SHOW_BOOTSCREEN)
     SETUP_RUN(ui.show_bootscreen());
-    const millis_t bootscreen_ms = millis();
+    #if ENABLED(STAGED_STARTUP)
+      bootscreen_ms = millis();
+    #else
+      const millis_t bootscreen_ms = millis();
+    #endif
   #endif
 
   #if ENABLED(PROBE_TARE)
@@ -1365,6 +1601,14 @@ void setup() {
     OUT_WRITE(PHOTOGRAPH_PIN, LOW);
   #endif
 
+  #if HAS_TIMELAPSE_TRIGGER
+    OUT_WRITE(TIMELAPSE_TRIGGER_PIN, !(TIMELAPSE_TRIGGER_STATE));
+  #endif
+
+  #if ENABLED(TIMELAPSE)
+    SETUP_RUN(timelapse.init());      // Subscribe to layer events
+  #endif
+
   #if HAS_CUTTER
     SETUP_RUN(cutter.init());
   #endif
@@ -1603,7 +1847,7 @@ void setup() {
     SETUP_RUN(tft_lvgl_init());
   #endif
 
-  #if BOTH(HAS_WIRED_LCD, SHOW_BOOTSCREEN)
+  #if BOTH(HAS_WIRED_LCD, SHOW_BOOTSCREEN) && DISABLED(STAGED_STARTUP)
     const millis_t elapsed = millis() - bootscreen_ms;
     #if ENABLED(MARLIN_DEV_MODE)
       SERIAL_ECHOLNPGM("elapsed=", elapsed);
@@ -1627,8 +1871,16 @@ void setup() {
     SETUP_RUN(test_tmc_connection());
   #endif
 
+  TERN_(IDLE_SCHEDULER, register_idle_tasks());
+
   marlin_state = MF_RUNNING;
 
+  #if ENABLED(STAGED_STARTUP)
+    boot_phase_done(BOOT_CORE);
+    if (DISABLED(SDCARD_EEPROM_EMULATION)) boot_phase_done(BOOT_SETTINGS);
+    if (!BOTH(HAS_WIRED_LCD, SHOW_BOOTSCREEN)) boot_phase_done(BOOT_UI);
+  #endif
+
   SETUP_LOG("setup() completed.");
 }
 
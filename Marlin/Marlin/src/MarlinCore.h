@@ -33,6 +33,9 @@ void stop();
 void idle(bool no_stepper_sleep=false);
 inline void idle_no_sleep() { idle(true); }
 
+// Handle UI input / draw events, as idle() does
+void idle_ui_update();
+
 #if ENABLED(G38_PROBE_TARGET)
   extern uint8_t G38_move;          // Flag to tell the ISR that G38 is in progress, and the type
   extern bool G38_did_trigger;      // Flag from the ISR to indicate the endstop changed
@@ -56,6 +59,18 @@ extern MarlinState marlin_state;
 inline bool IsRunning() { return marlin_state >= MF_RUNNING; }
 inline bool IsStopped() { return marlin_state == MF_STOPPED; }
 
+#if ENABLED(STAGED_STARTUP)
+  // Boot phases, in the order they complete
+  enum BootPhase : uint8_t {
+    BOOT_SERIAL,    // Serial ports are up
+    BOOT_CORE,      // setup() is done. Heaters, steppers and G-code are ready.
+    BOOT_SETTINGS,  // Settings are loaded
+    BOOT_UI,        // The boot screen is done
+    BOOT_PHASES
+  };
+  extern millis_t boot_timeline[BOOT_PHASES]; // Time (ms) each phase completed, 0 until then
+#endif
+
 bool printingIsActive();
 bool printJobOngoing();
 bool printingIsPaused();
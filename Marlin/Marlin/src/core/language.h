@@ -172,6 +172,7 @@
 #define STR_SD_CANT_OPEN_SUBDIR             "Cannot open subdir "
 #define STR_SD_INIT_FAIL                    "No SD card"
 #define STR_SD_VOL_INIT_FAIL                "volume.init failed"
+#define STR_SD_VOL_EXFAT                    "exFAT volume. Format the card as FAT32."
 #define STR_SD_OPENROOT_FAIL                "openRoot failed"
 #define STR_SD_CARD_OK                      "SD card ok"
 #define STR_SD_WORKDIR_FAIL                 "workDir open failed"
@@ -312,6 +313,7 @@
 #define STR_LCD_CONTRAST                    "LCD Contrast"
 #define STR_LCD_BRIGHTNESS                  "LCD Brightness"
 #define STR_DISPLAY_SLEEP                   "Display Sleep"
+#define STR_UI_MOTION_PRIORITY              "Display Motion Priority"
 #define STR_UI_LANGUAGE                     "UI Language"
 #define STR_Z_PROBE_OFFSET                  "Z-Probe Offset"
 #define STR_TEMPERATURE_UNITS               "Temperature Units"
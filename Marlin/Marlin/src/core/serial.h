@@ -131,6 +131,13 @@ extern uint8_t marlin_debug_flags;
 #define PORT_RESTORE()     _PORT_RESTORE(1)
 #define SERIAL_PORTMASK(P) SerialMask::from(P)
 
+// Auto-reports and dumps go to the TELEMETRY_SERIAL port, or to all ports
+#if HAS_MULTI_SERIAL && defined(TELEMETRY_SERIAL)
+  #define TELEMETRY_PORTMASK SerialMask(_BV((TELEMETRY_SERIAL) - 1))
+#else
+  #define TELEMETRY_PORTMASK SerialMask::All
+#endif
+
 //
 // SERIAL_CHAR - Print one or more individual chars
 //
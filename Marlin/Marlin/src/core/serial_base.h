@@ -22,6 +22,7 @@
 #pragma once
 
 #include "../inc/MarlinConfigPre.h"
+#include "../libs/numtostr.h"
 
 #if ENABLED(EMERGENCY_PARSER)
   #include "../feature/e_parser.h"
@@ -91,7 +92,7 @@ struct SerialBase {
     const bool ep_enabled;
     EmergencyParser::State emergency_state;
     inline bool emergency_parser_enabled() { return ep_enabled; }
-    SerialBase(bool ep_capable) : ep_enabled(ep_capable), emergency_state(EmergencyParser::State::EP_RESET) {}
+    SerialBase(bool ep_capable) : ep_enabled(ep_capable), emergency_state(EmergencyParser::EP_RESET) {}
   #else
     SerialBase(const bool) {}
   #endif
@@ -199,7 +200,11 @@ struct SerialBase {
 
   // Print a number with the given base
   NO_INLINE void printNumber_unsigned(uint_fixed_print_t n, PrintBase base) {
-    if (n) {
+    if (base == PrintBase::Dec && n <= UINT32_MAX) {
+      char buf[10], * const end = append_uint(buf, n);
+      for (const char *c = buf; c < end; ++c) write(*c);
+    }
+    else if (n) {
       unsigned char buf[8 * sizeof(long)]; // Enough space for base 2
       int8_t i = 0;
       while (n) {
@@ -224,6 +229,16 @@ struct SerialBase {
 
   // Print a decimal number
   NO_INLINE void printFloat(double number, uint8_t digits) {
+    // Scale once and print as fixed point, when it fits in 32 bits
+    if (digits < 10) {
+      const double scaled = number * dec_pow10(digits) + (number < 0 ? -0.5 : 0.5);
+      if (WITHIN(scaled, -2147483647.0, 2147483647.0)) {
+        char buf[12], * const end = append_fixed(buf, int32_t(scaled), digits);
+        for (const char *c = buf; c < end; ++c) write(*c);
+        return;
+      }
+    }
+
     // Handle negative numbers
     if (number < 0.0) {
       write('-');
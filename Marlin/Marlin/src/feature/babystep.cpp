@@ -42,6 +42,27 @@ volatile int16_t Babystep::steps[BS_AXIS_IND(Z_AXIS) + 1];
 #endif
 int16_t Babystep::accum;
 
+#if ENABLED(BABYSTEP_PLANNER)
+
+  float Babystep::planned_z, Babystep::pending_z;
+
+  /**
+   * Move part of the pending Z offset into the planner, at most
+   * BABYSTEP_PLANNER_SLOPE per mm of XY travel, and return the
+   * total offset to add to the Z target of the new move.
+   */
+  float Babystep::blend_z(const_float_t xy_mm) {
+    if (pending_z) {
+      const float limit = xy_mm * (BABYSTEP_PLANNER_SLOPE),
+                  dz = constrain(pending_z, -limit, limit);
+      planned_z += dz;
+      pending_z -= dz;
+    }
+    return planned_z;
+  }
+
+#endif
+
 void Babystep::step_axis(const AxisEnum axis) {
   const int16_t curTodo = steps[BS_AXIS_IND(axis)]; // get rid of volatile for performance
   if (curTodo) {
@@ -58,9 +79,18 @@ void Babystep::add_steps(const AxisEnum axis, const int16_t distance) {
   if (DISABLED(BABYSTEP_WITHOUT_HOMING) && axes_should_home(_BV(axis))) return;
 
   accum += distance; // Count up babysteps for the UI
-  steps[BS_AXIS_IND(axis)] += distance;
   TERN_(BABYSTEP_DISPLAY_TOTAL, axis_total[BS_TOTAL_IND(axis)] += distance);
   TERN_(BABYSTEP_ALWAYS_AVAILABLE, gcode.reset_stepper_timeout());
+
+  #if ENABLED(BABYSTEP_PLANNER)
+    // With moves queued, let the planner ease Z into the coming blocks
+    if (axis == Z_AXIS && planner.has_blocks_queued()) {
+      pending_z += (BABYSTEP_INVERT_Z ? -distance : distance) * planner.mm_per_step[Z_AXIS];
+      return;
+    }
+  #endif
+
+  steps[BS_AXIS_IND(axis)] += distance;
   TERN_(INTEGRATED_BABYSTEPPING, if (has_steps()) stepper.initiateBabystepping());
 }
 
@@ -63,6 +63,13 @@ public:
   static void add_steps(const AxisEnum axis, const int16_t distance);
   static void add_mm(const AxisEnum axis, const_float_t mm);
 
+  #if ENABLED(BABYSTEP_PLANNER)
+    static float planned_z,                                 // (mm) Z offset included in planned moves
+                 pending_z;                                 // (mm) Z offset still to be blended in
+    static float blend_z(const_float_t xy_mm);
+    static void reset_planned() { planned_z = pending_z = 0; }
+  #endif
+
   static bool has_steps() {
     return steps[BS_AXIS_IND(X_AXIS)] || steps[BS_AXIS_IND(Y_AXIS)] || steps[BS_AXIS_IND(Z_AXIS)];
   }
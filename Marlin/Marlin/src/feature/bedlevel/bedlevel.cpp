@@ -74,6 +74,11 @@ void set_bed_leveling_enabled(const bool enable/*=true*/) {
     _report_leveling();
     planner.synchronize();
 
+    #if ENABLED(UBL_CELL_PLANES)
+      if (enable) bedlevel.refresh_bed_level(); // Catch any mesh edits made with leveling off
+    #endif
+    TERN_(FUSED_POSITION_TRANSFORM, planner.refresh_position_transform()); // Catch a new bed level matrix
+
     // Get the corrected leveled / unleveled position
     planner.apply_modifiers(current_position);    // Physical position with all modifiers
     planner.leveling_active ^= true;              // Toggle leveling between apply and unapply
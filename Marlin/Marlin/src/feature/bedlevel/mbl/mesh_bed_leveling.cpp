@@ -39,6 +39,13 @@
         mesh_bed_leveling::index_to_xpos[GRID_MAX_POINTS_X],
         mesh_bed_leveling::index_to_ypos[GRID_MAX_POINTS_Y];
 
+  #if ENABLED(MESH_BICUBIC)
+    __ccmram float mesh_bed_leveling::cell_coef[GRID_MAX_CELLS_X][GRID_MAX_CELLS_Y][4][4];
+  #endif
+  #if ENABLED(MESH_Z_RASTER)
+    __ccmram int16_t mesh_bed_leveling::z_raster[MESH_RASTER_Y][MESH_RASTER_X];
+  #endif
+
   mesh_bed_leveling::mesh_bed_leveling() {
     LOOP_L_N(i, GRID_MAX_POINTS_X)
       index_to_xpos[i] = MESH_MIN_X + i * (MESH_X_DIST);
@@ -50,18 +57,116 @@
   void mesh_bed_leveling::reset() {
     z_offset = 0;
     ZERO(z_values);
+    TERN_(MESH_BICUBIC, ZERO(cell_coef));
+    TERN_(MESH_Z_RASTER, ZERO(z_raster));
     #if ENABLED(EXTENSIBLE_UI)
       GRID_LOOP(x, y) ExtUI::onMeshUpdate(x, y, 0);
     #endif
   }
 
+  #if ENABLED(MESH_BICUBIC)
+
+    /**
+     * Fit a bicubic patch to each cell, matching the mesh values at its corners
+     * and the slopes there, from central differences (one-sided at the mesh edges).
+     * Neighboring patches share values and slopes along their edges, so the
+     * correction is smooth across mesh lines.
+     */
+    void mesh_bed_leveling::fit_cells() {
+      auto prev = [](const uint8_t i) -> uint8_t { return i ? i - 1 : 0; };
+      auto next = [](const uint8_t i, const uint8_t n) -> uint8_t { return i < n - 1 ? i + 1 : i; };
+
+      // Hermite basis, rows for f(0), f(1), f'(0), f'(1)
+      static constexpr int8_t M[4][4] = { { 1, 0, 0, 0 }, { 0, 0, 1, 0 }, { -3, 3, -2, -1 }, { 2, -2, 1, 1 } };
+
+      LOOP_L_N(cx, GRID_MAX_CELLS_X) LOOP_L_N(cy, GRID_MAX_CELLS_Y) {
+        // Corner values, then d/dx, d/dy and d2/dxdy per unit cell
+        float F[4][4];
+        LOOP_L_N(i, 2) LOOP_L_N(j, 2) {
+          const uint8_t x = cx + i, y = cy + j,
+                        x0 = prev(x), x1 = next(x, GRID_MAX_POINTS_X),
+                        y0 = prev(y), y1 = next(y, GRID_MAX_POINTS_Y);
+          F[i][j]         = z_values[x][y];
+          F[i + 2][j]     = (z_values[x1][y] - z_values[x0][y]) / (x1 - x0);
+          F[i][j + 2]     = (z_values[x][y1] - z_values[x][y0]) / (y1 - y0);
+          F[i + 2][j + 2] = (z_values[x1][y1] - z_values[x1][y0] - z_values[x0][y1] + z_values[x0][y0]) / ((x1 - x0) * (y1 - y0));
+        }
+
+        // a = M F M^T
+        float MF[4][4];
+        LOOP_L_N(i, 4) LOOP_L_N(j, 4) {
+          MF[i][j] = 0;
+          LOOP_L_N(k, 4) MF[i][j] += M[i][k] * F[k][j];
+        }
+        float (&a)[4][4] = cell_coef[cx][cy];
+        LOOP_L_N(i, 4) LOOP_L_N(j, 4) {
+          a[i][j] = 0;
+          LOOP_L_N(k, 4) a[i][j] += MF[i][k] * M[j][k];
+        }
+      }
+    }
+
+  #endif
+
+  #if EITHER(MESH_BICUBIC, MESH_Z_RASTER)
+
+    void mesh_bed_leveling::refresh_bed_level() {
+      TERN_(MESH_BICUBIC, fit_cells());
+
+      #if ENABLED(MESH_Z_RASTER)
+        // Sample the mesh correction, bilinear or bicubic, for the planner
+        LOOP_L_N(iy, MESH_RASTER_Y) LOOP_L_N(ix, MESH_RASTER_X) {
+          const xy_pos_t pos = { MESH_MIN_X + ix * (MESH_Z_RASTER_MM), MESH_MIN_Y + iy * (MESH_Z_RASTER_MM) };
+          const int32_t z = LROUND(get_z_correction(pos) * 1000);
+          z_raster[iy][ix] = constrain(z, -(MESH_RASTER_LIMIT), MESH_RASTER_LIMIT);
+        }
+      #endif
+    }
+
+  #endif
+
+  #if ENABLED(MESH_ADAPTIVE_SPLIT)
+
+    /**
+     * Does the Z correction along a move stay within MESH_SPLIT_TOLERANCE of the
+     * straight line the planner will follow between its end points? The bilinear
+     * correction bends at mesh lines and curves inside cells, so check it at every
+     * mesh line crossing and halfway through every crossed cell.
+     */
+    bool mesh_bed_leveling::is_flat_line(const xy_pos_t &start, const xy_pos_t &end) {
+      const xy_int8_t scel = cell_indexes(start), ecel = cell_indexes(end);
+      const xy_pos_t dist = end - start;
+      const float z_start = get_z_correction(start), z_dist = get_z_correction(end) - z_start;
+
+      auto near_line = [&](const_float_t t) {
+        if (!WITHIN(t, 0, 1)) return true;
+        const xy_pos_t p = start + dist * t;
+        return ABS(get_z_correction(p) - (z_start + z_dist * t)) <= (MESH_SPLIT_TOLERANCE);
+      };
+
+      // Mesh line crossings
+      for (int8_t cx = _MIN(scel.x, ecel.x) + 1; cx <= _MAX(scel.x, ecel.x); ++cx)
+        if (!near_line((index_to_xpos[cx] - start.x) / dist.x)) return false;
+      for (int8_t cy = _MIN(scel.y, ecel.y) + 1; cy <= _MAX(scel.y, ecel.y); ++cy)
+        if (!near_line((index_to_ypos[cy] - start.y) / dist.y)) return false;
+
+      // Cell middles, at twice the count of crossed cells
+      const uint8_t samples = 2 * (ABS(ecel.x - scel.x) + ABS(ecel.y - scel.y) + 1);
+      for (uint8_t i = 1; i < samples; i += 2)
+        if (!near_line(float(i) / samples)) return false;
+
+      return true;
+    }
+
+  #endif
+
   #if IS_CARTESIAN && DISABLED(SEGMENT_LEVELED_MOVES)
 
     /**
      * Prepare a mesh-leveled linear move in a Cartesian setup,
      * splitting the move where it crosses mesh borders.
      */
-    void mesh_bed_leveling::line_to_destination(const_feedRate_t scaled_fr_mm_s, uint8_t x_splits, uint8_t y_splits) {
+    void mesh_bed_leveling::line_to_destination(const_feedRate_t scaled_fr_mm_s, uint16_t x_splits, uint16_t y_splits) {
       // Get current and destination cells for this line
       xy_int8_t scel = cell_indexes(current_position), ecel = cell_indexes(destination);
       NOMORE(scel.x, GRID_MAX_CELLS_X - 1);
@@ -69,8 +174,8 @@
       NOMORE(ecel.x, GRID_MAX_CELLS_X - 1);
       NOMORE(ecel.y, GRID_MAX_CELLS_Y - 1);
 
-      // Start and end in the same cell? No split needed.
-      if (scel == ecel) {
+      // Start and end in the same cell, or flat enough in between? No split needed.
+      if (scel == ecel || TERN0(MESH_ADAPTIVE_SPLIT, is_flat_line(current_position, destination))) {
         current_position = destination;
         line_to_current_position(scaled_fr_mm_s);
         return;
@@ -128,4 +233,40 @@
     print_2d_array(GRID_MAX_POINTS_X, GRID_MAX_POINTS_Y, 5, z_values[0]);
   }
 
+  #if BOTH(MESH_Z_RASTER, MARLIN_DEV_MODE)
+
+    /**
+     * D213: Time the mesh interpolation and the raster lookup with the portable
+     * and the SIMD lerp, at points spread over the mesh. The two raster lookups
+     * must agree exactly.
+     */
+    void mesh_bed_leveling::bench_z_lookup(const uint32_t count) {
+      typedef float (*lookup_t)(const xy_pos_t&);
+      static const lookup_t lookup[] = { get_z_correction, get_z_raster<false>, get_z_raster<true> };
+      static PGM_P const name[] = { PSTR("Mesh"), PSTR("Raster"), PSTR("Raster SIMD") };
+      auto point = [](const uint32_t n) -> xy_pos_t {
+        return { MESH_MIN_X + float(n % 211) * (float(MESH_MAX_X - (MESH_MIN_X)) / 211),
+                 MESH_MIN_Y + float(n % 199) * (float(MESH_MAX_Y - (MESH_MIN_Y)) / 199) };
+      };
+
+      volatile float sink = 0;
+      LOOP_L_N(k, COUNT(lookup)) {
+        const millis_t start_ms = millis();
+        for (uint32_t n = 0; n < count; ++n) sink += lookup[k](point(n));
+        const millis_t ms = _MAX(millis() - start_ms, 1UL);
+        SERIAL_ECHOPGM_P(name[k]);
+        SERIAL_ECHOLNPGM(": ", uint32_t(uint64_t(count) * 1000UL / ms), "/s");
+      }
+
+      uint32_t differ = 0;
+      for (uint32_t n = 0; n < count; ++n) {
+        const xy_pos_t pos = point(n);
+        if (get_z_raster<false>(pos) != get_z_raster<true>(pos)) differ++;
+      }
+      SERIAL_ECHOLNPGM("SIMD ", TERN(__ARM_FEATURE_DSP, "on", "off"), ", differing lookups: ", differ);
+      UNUSED(sink);
+    }
+
+  #endif
+
 #endif // MESH_BED_LEVELING
@@ -23,6 +23,10 @@
 
 #include "../../../inc/MarlinConfig.h"
 
+#if ENABLED(MESH_Z_RASTER)
+  #include "../../../libs/dsp_math.h"
+#endif
+
 enum MeshLevelingState : char {
   MeshReport,     // G29 S0
   MeshStart,      // G29 S1
@@ -35,6 +39,12 @@ enum MeshLevelingState : char {
 #define MESH_X_DIST (float(MESH_MAX_X - (MESH_MIN_X)) / (GRID_MAX_CELLS_X))
 #define MESH_Y_DIST (float(MESH_MAX_Y - (MESH_MIN_Y)) / (GRID_MAX_CELLS_Y))
 
+#if ENABLED(MESH_Z_RASTER)
+  #define MESH_RASTER_X (uint16_t(float(MESH_MAX_X - (MESH_MIN_X)) / (MESH_Z_RASTER_MM)) + 2)
+  #define MESH_RASTER_Y (uint16_t(float(MESH_MAX_Y - (MESH_MIN_Y)) / (MESH_Z_RASTER_MM)) + 2)
+  #define MESH_RASTER_LIMIT 16383 // (microns) Keeps the fixed-point lerp within 32 bits
+#endif
+
 class mesh_bed_leveling {
 public:
   static float z_offset,
@@ -42,12 +52,29 @@ public:
                index_to_xpos[GRID_MAX_POINTS_X],
                index_to_ypos[GRID_MAX_POINTS_Y];
 
+  #if ENABLED(MESH_BICUBIC)
+    // Bicubic patch coefficients of each cell, a[i][j] for t^i u^j in cell units
+    static float cell_coef[GRID_MAX_CELLS_X][GRID_MAX_CELLS_Y][4][4];
+  #endif
+
+  #if ENABLED(MESH_Z_RASTER)
+    // Corrections in microns, sampled every MESH_Z_RASTER_MM from the mesh corner
+    static int16_t z_raster[MESH_RASTER_Y][MESH_RASTER_X];
+  #endif
+
   mesh_bed_leveling();
 
   static void report_mesh();
 
   static void reset();
 
+  // Call after changing z_values
+  #if EITHER(MESH_BICUBIC, MESH_Z_RASTER)
+    static void refresh_bed_level();
+  #else
+    static void refresh_bed_level() {}
+  #endif
+
   FORCE_INLINE static bool has_mesh() {
     GRID_LOOP(x, y) if (z_values[x][y]) return true;
     return false;
@@ -57,13 +84,13 @@ public:
 
   static void set_z(const int8_t px, const int8_t py, const_float_t z) { z_values[px][py] = z; }
 
-  static void zigzag(const int8_t index, int8_t &px, int8_t &py) {
+  static void zigzag(const uint8_t index, int8_t &px, int8_t &py) {
     px = index % (GRID_MAX_POINTS_X);
     py = index / (GRID_MAX_POINTS_X);
     if (py & 1) px = (GRID_MAX_POINTS_X) - 1 - px; // Zig zag
   }
 
-  static void set_zigzag_z(const int8_t index, const_float_t z) {
+  static void set_zigzag_z(const uint8_t index, const_float_t z) {
     int8_t px, py;
     zigzag(index, px, py);
     set_z(px, py, z);
@@ -73,11 +100,11 @@ public:
   static float get_mesh_y(const uint8_t i) { return index_to_ypos[i]; }
 
   static int8_t cell_index_x(const_float_t x) {
-    int8_t cx = (x - (MESH_MIN_X)) * RECIPROCAL(MESH_X_DIST);
+    int8_t cx = (x - float(MESH_MIN_X)) * RECIPROCAL(MESH_X_DIST);
     return constrain(cx, 0, GRID_MAX_CELLS_X - 1);
   }
   static int8_t cell_index_y(const_float_t y) {
-    int8_t cy = (y - (MESH_MIN_Y)) * RECIPROCAL(MESH_Y_DIST);
+    int8_t cy = (y - float(MESH_MIN_Y)) * RECIPROCAL(MESH_Y_DIST);
     return constrain(cy, 0, GRID_MAX_CELLS_Y - 1);
   }
   static xy_int8_t cell_indexes(const_float_t x, const_float_t y) {
@@ -86,11 +113,11 @@ public:
   static xy_int8_t cell_indexes(const xy_pos_t &xy) { return cell_indexes(xy.x, xy.y); }
 
   static int8_t probe_index_x(const_float_t x) {
-    int8_t px = (x - (MESH_MIN_X) + 0.5f * (MESH_X_DIST)) * RECIPROCAL(MESH_X_DIST);
+    int8_t px = (x - float(MESH_MIN_X) + 0.5f * float(MESH_X_DIST)) * RECIPROCAL(MESH_X_DIST);
     return WITHIN(px, 0, (GRID_MAX_POINTS_X) - 1) ? px : -1;
   }
   static int8_t probe_index_y(const_float_t y) {
-    int8_t py = (y - (MESH_MIN_Y) + 0.5f * (MESH_Y_DIST)) * RECIPROCAL(MESH_Y_DIST);
+    int8_t py = (y - float(MESH_MIN_Y) + 0.5f * float(MESH_Y_DIST)) * RECIPROCAL(MESH_Y_DIST);
     return WITHIN(py, 0, (GRID_MAX_POINTS_Y) - 1) ? py : -1;
   }
   static xy_int8_t probe_indexes(const_float_t x, const_float_t y) {
@@ -109,16 +136,58 @@ public:
   static float get_z_correction(const xy_pos_t &pos) {
     const xy_int8_t ind = cell_indexes(pos);
     const float x1 = index_to_xpos[ind.x], x2 = index_to_xpos[ind.x+1],
-                y1 = index_to_xpos[ind.y], y2 = index_to_xpos[ind.y+1],
-                z1 = calc_z0(pos.x, x1, z_values[ind.x][ind.y  ], x2, z_values[ind.x+1][ind.y  ]),
-                z2 = calc_z0(pos.x, x1, z_values[ind.x][ind.y+1], x2, z_values[ind.x+1][ind.y+1]),
-                zf = calc_z0(pos.y, y1, z1, y2, z2);
+                y1 = index_to_ypos[ind.y], y2 = index_to_ypos[ind.y+1];
+
+    #if ENABLED(MESH_BICUBIC)
+      // One polynomial evaluation in the cell. Outside the mesh hold the edge value.
+      const float t = constrain((pos.x - x1) * RECIPROCAL(MESH_X_DIST), 0.0f, 1.0f),
+                  u = constrain((pos.y - y1) * RECIPROCAL(MESH_Y_DIST), 0.0f, 1.0f);
+      const float (&a)[4][4] = cell_coef[ind.x][ind.y];
+      float zf = 0;
+      for (int8_t i = 3; i >= 0; --i)
+        zf = zf * t + ((a[i][3] * u + a[i][2]) * u + a[i][1]) * u + a[i][0];
+    #else
+      const float z1 = calc_z0(pos.x, x1, z_values[ind.x][ind.y  ], x2, z_values[ind.x+1][ind.y  ]),
+                  z2 = calc_z0(pos.x, x1, z_values[ind.x][ind.y+1], x2, z_values[ind.x+1][ind.y+1]),
+                  zf = calc_z0(pos.y, y1, z1, y2, z2);
+    #endif
 
     return zf;
   }
 
+  #if ENABLED(MESH_Z_RASTER)
+    // For the planner. Lerp between raster points in fixed point, or use the mesh outside the raster.
+    // SIMD=false uses the portable lerp, for D213 to compare.
+    template<bool SIMD=true>
+    static float get_z_raster(const xy_pos_t &pos) {
+      const int32_t rx = (pos.x - float(MESH_MIN_X)) * (256.0f / (MESH_Z_RASTER_MM)),  // 1/256 raster steps
+                    ry = (pos.y - float(MESH_MIN_Y)) * (256.0f / (MESH_Z_RASTER_MM));
+      if (!WITHIN(rx, 0, (MESH_RASTER_X - 1) * 256L - 1) || !WITHIN(ry, 0, (MESH_RASTER_Y - 1) * 256L - 1))
+        return get_z_correction(pos);
+
+      const uint8_t tx = rx & 0xFF, ty = ry & 0xFF;
+      const int16_t * const r0 = &z_raster[ry >> 8][rx >> 8], * const r1 = r0 + MESH_RASTER_X;
+      const int32_t z0 = SIMD ? dsp::lerp_q8(r0, tx) : dsp::lerp_q8_c(r0, tx),  // microns * 256
+                    z1 = SIMD ? dsp::lerp_q8(r1, tx) : dsp::lerp_q8_c(r1, tx);
+      return (z0 + (((z1 - z0) * ty) >> 8)) * (0.001f / 256);
+    }
+  #endif
+
   #if IS_CARTESIAN && DISABLED(SEGMENT_LEVELED_MOVES)
-    static void line_to_destination(const_feedRate_t scaled_fr_mm_s, uint8_t x_splits=0xFF, uint8_t y_splits=0xFF);
+    static void line_to_destination(const_feedRate_t scaled_fr_mm_s, uint16_t x_splits=0xFFFF, uint16_t y_splits=0xFFFF);
+  #endif
+
+  #if ENABLED(MESH_ADAPTIVE_SPLIT)
+    static bool is_flat_line(const xy_pos_t &start, const xy_pos_t &end);
+  #endif
+
+  #if BOTH(MESH_Z_RASTER, MARLIN_DEV_MODE)
+    static void bench_z_lookup(const uint32_t count);
+  #endif
+
+private:
+  #if ENABLED(MESH_BICUBIC)
+    static void fit_cells();
   #endif
 };
 
@@ -0,0 +1,187 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../../inc/MarlinConfig.h"
+
+#if ENABLED(MESH_SLOTS)
+
+#include "mesh_slots.h"
+#include "../bedlevel.h"
+#include "../../../sd/cardreader.h"
+#include "../../../libs/crc16.h"
+
+#if ENABLED(EXTENSIBLE_UI)
+  #include "../../../lcd/extui/ui_api.h"
+#endif
+
+#define MESH_SLOT_VERSION 1
+
+MeshSlots mesh_slots;
+
+int8_t MeshSlots::active = -1;
+
+// Everything a slot has to match for its tables to be used as they are
+typedef struct {
+  uint8_t version, points_x, points_y, tables;
+  float min_x, min_y, max_x, max_y, raster_mm;
+} mesh_slot_layout_t;
+
+typedef struct {
+  mesh_slot_layout_t layout;
+  char name[MESH_SLOT_NAME_LEN + 1];
+  uint16_t crc;                     // CRC of all the data after the header
+} mesh_slot_header_t;
+
+// The data of a slot in file order, straight from / into the leveling tables
+static const struct { void * const ptr; const size_t size; } slot_data[] = {
+  { &bedlevel.z_offset, sizeof(bedlevel.z_offset) },
+  { bedlevel.z_values,  sizeof(bedlevel.z_values) }
+  #if ENABLED(MESH_BICUBIC)
+    , { bedlevel.cell_coef, sizeof(bedlevel.cell_coef) }
+  #endif
+  #if ENABLED(MESH_Z_RASTER)
+    , { bedlevel.z_raster, sizeof(bedlevel.z_raster) }
+  #endif
+};
+
+static mesh_slot_layout_t current_layout() {
+  mesh_slot_layout_t l;
+  l.version = MESH_SLOT_VERSION;
+  l.points_x = GRID_MAX_POINTS_X;
+  l.points_y = GRID_MAX_POINTS_Y;
+  l.tables = TERN0(MESH_BICUBIC, _BV(0)) | TERN0(MESH_Z_RASTER, _BV(1));
+  l.min_x = MESH_MIN_X; l.min_y = MESH_MIN_Y;
+  l.max_x = MESH_MAX_X; l.max_y = MESH_MAX_Y;
+  l.raster_mm = TERN(MESH_Z_RASTER, MESH_Z_RASTER_MM, 0);
+  return l;
+}
+
+static void slot_filename(char (&fname)[13], const uint8_t slot) {
+  sprintf_P(fname, PSTR("MESH%u.BIN"), slot);
+}
+
+// Open a slot for reading and check that it fits this build
+static bool open_slot(SdFile &file, const uint8_t slot, mesh_slot_header_t &h) {
+  if (slot >= MESH_SLOT_COUNT || !card.isMounted()) return false;
+  char fname[13];
+  slot_filename(fname, slot);
+  SdFile root = card.getroot();
+  if (!file.open(&root, fname, O_READ)) return false;
+  const mesh_slot_layout_t l = current_layout();
+  if (file.read(&h, sizeof(h)) != sizeof(h) || memcmp(&h.layout, &l, sizeof(l))) {
+    file.close();
+    return false;
+  }
+  h.name[MESH_SLOT_NAME_LEN] = '\0';
+  return true;
+}
+
+// Read or write in pieces the SD file API can take
+static bool transfer(SdFile &file, void * const ptr, const size_t size, const bool writing, uint16_t &crc) {
+  uint8_t *p = (uint8_t*)ptr;
+  for (size_t left = size; left;) {
+    const uint16_t n = _MIN(left, size_t(512));
+    if (writing ? file.write(p, n) != n : file.read(p, n) != n) return false;
+    crc16(&crc, p, n);
+    p += n;
+    left -= n;
+  }
+  return true;
+}
+
+bool MeshSlots::save(const uint8_t slot, const char * const name/*=nullptr*/) {
+  if (slot >= MESH_SLOT_COUNT || !card.isMounted()) return false;
+
+  mesh_slot_header_t h;
+  SdFile file;
+
+  // Keep the old name unless a new one is given
+  const bool had_name = !name && open_slot(file, slot, h);
+  if (had_name) file.close();
+  else {
+    ZERO(h.name);
+    if (name) strncpy(h.name, name, MESH_SLOT_NAME_LEN);
+  }
+  h.layout = current_layout();
+
+  char fname[13];
+  slot_filename(fname, slot);
+  SdFile root = card.getroot();
+  if (!file.open(&root, fname, O_CREAT | O_WRITE | O_TRUNC)) return false;
+
+  // The header is written again once the CRC is known
+  h.crc = 0;
+  bool ok = file.write(&h, sizeof(h)) == sizeof(h);
+  uint16_t crc = 0;
+  for (auto &d : slot_data) if (ok) ok = transfer(file, d.ptr, d.size, true, crc);
+  if (ok) {
+    h.crc = crc;
+    ok = file.seekSet(0) && file.write(&h, sizeof(h)) == sizeof(h);
+  }
+  if (!file.close()) ok = false;
+
+  if (ok) active = slot;
+  return ok;
+}
+
+bool MeshSlots::load(const uint8_t slot) {
+  mesh_slot_header_t h;
+  SdFile file;
+  if (!open_slot(file, slot, h)) return false;
+
+  uint16_t crc = 0;
+  bool ok = true;
+  for (auto &d : slot_data) if (ok) ok = transfer(file, d.ptr, d.size, false, crc);
+  file.close();
+
+  // The tables were overwritten, so a bad slot leaves no mesh
+  if (!ok || crc != h.crc) {
+    bedlevel.reset();
+    active = -1;
+    return false;
+  }
+
+  #if ENABLED(EXTENSIBLE_UI)
+    GRID_LOOP(x, y) ExtUI::onMeshUpdate(x, y, bedlevel.z_values[x][y]);
+  #endif
+
+  active = slot;
+  return true;
+}
+
+void MeshSlots::report() {
+  LOOP_L_N(s, MESH_SLOT_COUNT) {
+    mesh_slot_header_t h;
+    SdFile file;
+    SERIAL_ECHOPGM("Mesh slot ", s);
+    if (open_slot(file, s, h)) {
+      file.close();
+      SERIAL_ECHOPGM(" \"", h.name, "\"");
+      if (s == active) SERIAL_ECHOPGM(" (active)");
+    }
+    else
+      SERIAL_ECHOPGM(" empty");
+    SERIAL_EOL();
+  }
+}
+
+#endif // MESH_SLOTS
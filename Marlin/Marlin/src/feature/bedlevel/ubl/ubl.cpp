@@ -67,6 +67,10 @@ int8_t unified_bed_leveling::storage_slot;
 
 float unified_bed_leveling::z_values[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
 
+#if ENABLED(UBL_CELL_PLANES)
+  __ccmram unified_bed_leveling::cell_plane_t unified_bed_leveling::cell_plane[GRID_MAX_CELLS_X][GRID_MAX_CELLS_Y];
+#endif
+
 #define _GRIDPOS(A,N) (MESH_MIN_##A + N * (MESH_##A##_DIST))
 
 const float
@@ -92,12 +96,34 @@ void unified_bed_leveling::reset() {
   set_bed_leveling_enabled(false);
   storage_slot = -1;
   ZERO(z_values);
+  TERN_(UBL_CELL_PLANES, refresh_bed_level());
   #if ENABLED(EXTENSIBLE_UI)
     GRID_LOOP(x, y) ExtUI::onMeshUpdate(x, y, 0);
   #endif
   if (was_enabled) report_current_position();
 }
 
+#if ENABLED(UBL_CELL_PLANES)
+
+  /**
+   * Get the patch of each cell from its corners, as leveled moves have used them.
+   * An undefined mesh point counts as 0.
+   */
+  void unified_bed_leveling::refresh_bed_level() {
+    auto zval = [](const uint8_t x, const uint8_t y) { const float z = z_values[x][y]; return isnan(z) ? 0.0f : z; };
+    LOOP_L_N(cx, GRID_MAX_CELLS_X) LOOP_L_N(cy, GRID_MAX_CELLS_Y) {
+      const float z00 = zval(cx, cy), z10 = zval(cx + 1, cy),
+                  z01 = zval(cx, cy + 1), z11 = zval(cx + 1, cy + 1);
+      cell_plane_t &p = cell_plane[cx][cy];
+      p.z0 = z00;
+      p.dx = (z10 - z00) * RECIPROCAL(MESH_X_DIST);
+      p.dy = (z01 - z00) * RECIPROCAL(MESH_Y_DIST);
+      p.dxy = (z11 - z10 - z01 + z00) * RECIPROCAL((MESH_X_DIST) * (MESH_Y_DIST));
+    }
+  }
+
+#endif
+
 void unified_bed_leveling::invalidate() {
   set_bed_leveling_enabled(false);
   set_all_mesh_points_to_value(NAN);
@@ -108,6 +134,7 @@ void unified_bed_leveling::set_all_mesh_points_to_value(const_float_t value) {
     z_values[x][y] = value;
     TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(x, y, value));
   }
+  TERN_(UBL_CELL_PLANES, refresh_bed_level());
 }
 
 #if ENABLED(OPTIMIZED_MESH_STORAGE)
@@ -120,6 +120,20 @@ public:
   static const float _mesh_index_to_xpos[GRID_MAX_POINTS_X],
                      _mesh_index_to_ypos[GRID_MAX_POINTS_Y];
 
+  #if ENABLED(UBL_CELL_PLANES)
+    // Bilinear patch of each cell, z = z0 + dx * x + dy * y + dxy * x * y in mm from its corner
+    typedef struct { float z0, dx, dy, dxy; } cell_plane_t;
+    static cell_plane_t cell_plane[GRID_MAX_CELLS_X][GRID_MAX_CELLS_Y];
+
+    // Call after changing z_values
+    static void refresh_bed_level();
+
+    static float cell_z(const xy_int8_t &ind, const xy_pos_t &d) {
+      const cell_plane_t &p = cell_plane[ind.x][ind.y];
+      return p.z0 + p.dx * d.x + (p.dy + p.dxy * d.x) * d.y;
+    }
+  #endif
+
   #if HAS_MARLINUI_MENU
     static bool lcd_map_control;
     static void steppers_were_disabled();
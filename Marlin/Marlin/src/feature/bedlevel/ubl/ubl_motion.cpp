@@ -84,14 +84,23 @@
         }
       #endif
 
-      // The distance is always MESH_X_DIST so multiply by the constant reciprocal.
-      const float xratio = (end.x - get_mesh_x(iend.x)) * RECIPROCAL(MESH_X_DIST),
-                  yratio = (end.y - get_mesh_y(iend.y)) * RECIPROCAL(MESH_Y_DIST),
-                  z1 = z_values[iend.x][iend.y    ] + xratio * (z_values[iend.x + 1][iend.y    ] - z_values[iend.x][iend.y    ]),
-                  z2 = z_values[iend.x][iend.y + 1] + xratio * (z_values[iend.x + 1][iend.y + 1] - z_values[iend.x][iend.y + 1]);
+      #if ENABLED(UBL_CELL_PLANES)
 
-      // X cell-fraction done. Interpolate the two Z offsets with the Y fraction for the final Z offset.
-      const float z0 = (z1 + (z2 - z1) * yratio) * planner.fade_scaling_factor_for_z(end.z);
+        const xy_pos_t cell = { end.x - get_mesh_x(iend.x), end.y - get_mesh_y(iend.y) };
+        const float z0 = cell_z(iend, cell) * planner.fade_scaling_factor_for_z(end.z);
+
+      #else
+
+        // The distance is always MESH_X_DIST so multiply by the constant reciprocal.
+        const float xratio = (end.x - get_mesh_x(iend.x)) * RECIPROCAL(MESH_X_DIST),
+                    yratio = (end.y - get_mesh_y(iend.y)) * RECIPROCAL(MESH_Y_DIST),
+                    z1 = z_values[iend.x][iend.y    ] + xratio * (z_values[iend.x + 1][iend.y    ] - z_values[iend.x][iend.y    ]),
+                    z2 = z_values[iend.x][iend.y + 1] + xratio * (z_values[iend.x + 1][iend.y + 1] - z_values[iend.x][iend.y + 1]);
+
+        // X cell-fraction done. Interpolate the two Z offsets with the Y fraction for the final Z offset.
+        const float z0 = (z1 + (z2 - z1) * yratio) * planner.fade_scaling_factor_for_z(end.z);
+
+      #endif
 
       // Undefined parts of the Mesh in z_values[][] are NAN.
       // Replace NAN corrections with 0.0 to prevent NAN propagation.
@@ -423,40 +432,57 @@
         int8_t((raw.x - (MESH_MIN_X)) * RECIPROCAL(MESH_X_DIST)),
         int8_t((raw.y - (MESH_MIN_Y)) * RECIPROCAL(MESH_Y_DIST))
       };
-      LIMIT(icell.x, 0, GRID_MAX_CELLS_X);
-      LIMIT(icell.y, 0, GRID_MAX_CELLS_Y);
+      LIMIT(icell.x, 0, GRID_MAX_CELLS_X - 1);
+      LIMIT(icell.y, 0, GRID_MAX_CELLS_Y - 1);
+
+      #if ENABLED(UBL_CELL_PLANES)
 
-      float z_x0y0 = z_values[icell.x  ][icell.y  ],  // z at lower left corner
-            z_x1y0 = z_values[icell.x+1][icell.y  ],  // z at upper left corner
-            z_x0y1 = z_values[icell.x  ][icell.y+1],  // z at lower right corner
-            z_x1y1 = z_values[icell.x+1][icell.y+1];  // z at upper right corner
+        // The cell's patch is ready-made, so only its intercept and slope at cell.x are needed
+        const cell_plane_t &p = cell_plane[icell.x][icell.y];
+        const xy_pos_t pos = { get_mesh_x(icell.x), get_mesh_y(icell.y) };
+        xy_pos_t cell = raw - pos;
 
-      if (isnan(z_x0y0)) z_x0y0 = 0;              // ideally activating planner.leveling_active (G29 A)
-      if (isnan(z_x1y0)) z_x1y0 = 0;              //   should refuse if any invalid mesh points
-      if (isnan(z_x0y1)) z_x0y1 = 0;              //   in order to avoid isnan tests per cell,
-      if (isnan(z_x1y1)) z_x1y1 = 0;              //   thus guessing zero for undefined points
+        float z_cxy0 = p.z0 + p.dx * cell.x,              // z height along y0 at cell.x
+              z_cxym = p.dy + p.dxy * cell.x;             // z slope per y at cell.x
 
-      const xy_pos_t pos = { get_mesh_x(icell.x), get_mesh_y(icell.y) };
-      xy_pos_t cell = raw - pos;
+        const float z_sxy0 = p.dx * diff.x,               // per-segment adjustment to z_cxy0
+                    z_sxym = p.dxy * diff.x;              // per-segment adjustment to z_cxym
 
-      const float z_xmy0 = (z_x1y0 - z_x0y0) * RECIPROCAL(MESH_X_DIST),   // z slope per x along y0 (lower left to lower right)
-                  z_xmy1 = (z_x1y1 - z_x0y1) * RECIPROCAL(MESH_X_DIST);   // z slope per x along y1 (upper left to upper right)
+      #else
 
-            float z_cxy0 = z_x0y0 + z_xmy0 * cell.x;        // z height along y0 at cell.x (changes for each cell.x in cell)
+        float z_x0y0 = z_values[icell.x  ][icell.y  ],  // z at lower left corner
+              z_x1y0 = z_values[icell.x+1][icell.y  ],  // z at upper left corner
+              z_x0y1 = z_values[icell.x  ][icell.y+1],  // z at lower right corner
+              z_x1y1 = z_values[icell.x+1][icell.y+1];  // z at upper right corner
 
-      const float z_cxy1 = z_x0y1 + z_xmy1 * cell.x,        // z height along y1 at cell.x
-                  z_cxyd = z_cxy1 - z_cxy0;                 // z height difference along cell.x from y0 to y1
+        if (isnan(z_x0y0)) z_x0y0 = 0;              // ideally activating planner.leveling_active (G29 A)
+        if (isnan(z_x1y0)) z_x1y0 = 0;              //   should refuse if any invalid mesh points
+        if (isnan(z_x0y1)) z_x0y1 = 0;              //   in order to avoid isnan tests per cell,
+        if (isnan(z_x1y1)) z_x1y1 = 0;              //   thus guessing zero for undefined points
 
-            float z_cxym = z_cxyd * RECIPROCAL(MESH_Y_DIST); // z slope per y along cell.x from pos.y to y1 (changes for each cell.x in cell)
+        const xy_pos_t pos = { get_mesh_x(icell.x), get_mesh_y(icell.y) };
+        xy_pos_t cell = raw - pos;
 
-      //    float z_cxcy = z_cxy0 + z_cxym * cell.y;        // interpolated mesh z height along cell.x at cell.y (do inside the segment loop)
+        const float z_xmy0 = (z_x1y0 - z_x0y0) * RECIPROCAL(MESH_X_DIST),   // z slope per x along y0 (lower left to lower right)
+                    z_xmy1 = (z_x1y1 - z_x0y1) * RECIPROCAL(MESH_X_DIST);   // z slope per x along y1 (upper left to upper right)
 
-      // As subsequent segments step through this cell, the z_cxy0 intercept will change
-      // and the z_cxym slope will change, both as a function of cell.x within the cell, and
-      // each change by a constant for fixed segment lengths.
+              float z_cxy0 = z_x0y0 + z_xmy0 * cell.x;        // z height along y0 at cell.x (changes for each cell.x in cell)
 
-      const float z_sxy0 = z_xmy0 * diff.x,                                       // per-segment adjustment to z_cxy0
-                  z_sxym = (z_xmy1 - z_xmy0) * RECIPROCAL(MESH_Y_DIST) * diff.x;  // per-segment adjustment to z_cxym
+        const float z_cxy1 = z_x0y1 + z_xmy1 * cell.x,        // z height along y1 at cell.x
+                    z_cxyd = z_cxy1 - z_cxy0;                 // z height difference along cell.x from y0 to y1
+
+              float z_cxym = z_cxyd * RECIPROCAL(MESH_Y_DIST); // z slope per y along cell.x from pos.y to y1 (changes for each cell.x in cell)
+
+        //    float z_cxcy = z_cxy0 + z_cxym * cell.y;        // interpolated mesh z height along cell.x at cell.y (do inside the segment loop)
+
+        // As subsequent segments step through this cell, the z_cxy0 intercept will change
+        // and the z_cxym slope will change, both as a function of cell.x within the cell, and
+        // each change by a constant for fixed segment lengths.
+
+        const float z_sxy0 = z_xmy0 * diff.x,                                       // per-segment adjustment to z_cxy0
+                    z_sxym = (z_xmy1 - z_xmy0) * RECIPROCAL(MESH_Y_DIST) * diff.x;  // per-segment adjustment to z_cxym
+
+      #endif
 
       for (;;) {  // for all segments within this mesh cell
 
@@ -31,6 +31,20 @@ char* SDFileTransferProtocol::Packet::Open::data = nullptr;
 size_t SDFileTransferProtocol::data_waiting, SDFileTransferProtocol::transfer_timeout, SDFileTransferProtocol::idle_timeout;
 bool SDFileTransferProtocol::transfer_active, SDFileTransferProtocol::dummy_transfer, SDFileTransferProtocol::compression;
 
+#if ENABLED(BINARY_MOTION_STREAM)
+  constexpr char MotionStreamProtocol::letters[];
+  int32_t MotionStreamProtocol::last[5];
+  uint16_t MotionStreamProtocol::offset;
+#endif
+
+#if ENABLED(BINARY_COMMAND_BATCH)
+  char CommandBatchProtocol::text[BINARY_COMMAND_BATCH_SIZE + 1];
+  uint16_t CommandBatchProtocol::length;
+  int16_t CommandBatchProtocol::lines = -1;
+  uint8_t CommandBatchProtocol::text_lines;
+  bool CommandBatchProtocol::overflow;
+#endif
+
 BinaryStream binaryStream[NUM_SERIAL];
 
 #endif
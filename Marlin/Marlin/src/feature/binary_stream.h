@@ -81,6 +81,16 @@ private:
           heatshrink_decoder_sink(&hsd, reinterpret_cast<uint8_t*>(&buffer[total_processed]), length - total_processed, &processed_count);
           total_processed += processed_count;
           do {
+            #if ENABLED(SD_WRITE_BUFFER)
+              // Decode straight into the card's write buffer
+              uint16_t size;
+              uint8_t * const space = (dummy_transfer || data_waiting) ? nullptr : card.writeSpace(size);
+              if (space) {
+                presult = heatshrink_decoder_poll(&hsd, space, size, &processed_count);
+                if (processed_count && card.write(space, processed_count) < 0) return false;
+                continue;
+              }
+            #endif
             presult = heatshrink_decoder_poll(&hsd, &decode_buffer[data_waiting], sizeof(decode_buffer) - data_waiting, &processed_count);
             data_waiting += processed_count;
             if (data_waiting == sizeof(decode_buffer)) {
@@ -107,8 +117,13 @@ private:
           data_waiting = 0;
         }
       #endif
-      card.closefile();
-      card.release();
+      #if ENABLED(SD_PRINT_WHILE_UPLOADING)
+        card.closeUpload();
+        if (!card.isFileOpen()) card.release();   // Keep the media for a print of the upload
+      #else
+        card.closefile();
+        card.release();
+      #endif
     }
     TERN_(BINARY_STREAM_COMPRESSION, heatshrink_decoder_finish(&hsd));
     transfer_active = false;
@@ -117,7 +132,13 @@ private:
 
   static void transfer_abort() {
     if (!dummy_transfer) {
-      card.closefile();
+      #if ENABLED(SD_PRINT_WHILE_UPLOADING)
+        card.upload_print_size = 0;
+        if (card.flag.growing) card.abortFilePrintSoon(); // Stop reading the file before it's deleted
+        card.closeUpload();
+      #else
+        card.closefile();
+      #endif
       card.removeFile(card.filename);
       card.release();
       TERN_(BINARY_STREAM_COMPRESSION, heatshrink_decoder_finish(&hsd));
@@ -142,6 +163,16 @@ public:
     }
   }
 
+  #if ENABLED(SD_WRITE_BUFFER)
+    // Space to receive the payload of an uncompressed WRITE packet in place, if the card has it
+    static char* receive_space(const uint8_t packet_type, const uint16_t length) {
+      if (static_cast<FileTransfer>(packet_type) != FileTransfer::WRITE || !transfer_active || dummy_transfer || compression) return nullptr;
+      uint16_t size;
+      char * const space = reinterpret_cast<char*>(card.writeSpace(size));
+      return space && size >= length ? space : nullptr;
+    }
+  #endif
+
   static void process(uint8_t packet_type, char *buffer, const uint16_t length) {
     transfer_timeout = millis() + TIMEOUT;
     switch (static_cast<FileTransfer>(packet_type)) {
@@ -197,9 +228,246 @@ public:
   static const uint16_t VERSION_MAJOR = 0, VERSION_MINOR = 1, VERSION_PATCH = 0, TIMEOUT = 10000, IDLE_PERIOD = 1000;
 };
 
+#if ENABLED(BINARY_MOTION_STREAM)
+
+#include "../gcode/queue.h"
+
+/**
+ * Host print streaming, straight into the command queue as tokens.
+ *
+ * Each record in a MOVES packet is a code byte (bits 0-4: E F X Y Z present,
+ * bit 5: G1 instead of G0) followed by a zigzag varint for each present letter.
+ * The varint is the change from the letter's last value, in thousandths.
+ * RESET sets all the last values to zero.
+ *
+ * A packet is acknowledged once all its moves are queued, so the host may keep
+ * as many packets in flight as QUERY reports for the window.
+ */
+class MotionStreamProtocol {
+private:
+  enum class MotionStream : uint8_t { QUERY, RESET, MOVES };
+
+  static constexpr char letters[] = "EFXYZ";  // Letter order, like the token values
+  static int32_t last[5];                     // Last values, in thousandths
+  static uint16_t offset;                     // Bytes of the current packet already queued
+
+  static bool read_varint(const uint8_t *&p, const uint8_t * const end, int32_t &v) {
+    uint32_t u = 0;
+    for (uint8_t shift = 0; shift < 35 && p < end; shift += 7) {
+      const uint8_t b = *p++;
+      u |= uint32_t(b & 0x7F) << shift;
+      if (!(b & 0x80)) { v = int32_t(u >> 1) ^ -int32_t(u & 1); return true; }
+    }
+    return false;
+  }
+
+  // Queue the moves that fit. Return false if some are left for later.
+  static bool queue_moves(const uint8_t * const buffer, const uint16_t length) {
+    const uint8_t * const end = buffer + length;
+    while (offset < length) {
+      if (queue.ring_buffer.full()) return false;
+
+      const uint8_t *p = buffer + offset;
+      const uint8_t code = *p++;
+      GCodeParser::token_t t;
+      t.letter = 'G';
+      t.codenum = TEST(code, 5);
+      TERN_(USE_GCODE_SUBCODES, t.subcode = 0);
+      TERN_(ADVANCED_OK, t.line_number = -1);
+      t.codebits = t.valbits = 0;
+
+      int32_t v[5];
+      uint8_t count = 0;
+      LOOP_L_N(i, 5) {
+        if (!TEST(code, i)) continue;
+        int32_t delta;
+        if (!read_varint(p, end, delta)) {
+          SERIAL_ECHOLNPGM("PMS:invalid");
+          offset = length;    // Drop the rest of the packet
+          return true;
+        }
+        v[i] = last[i] + delta;
+        t.value[count++] = v[i] * 0.001f;
+        SBI32(t.valbits, LETTER_BIT(letters[i]));
+      }
+      t.codebits = t.valbits;
+
+      queue.ring_buffer.enqueue(t);
+      LOOP_L_N(i, 5) if (TEST(code, i)) last[i] = v[i];
+      offset = p - buffer;
+    }
+    return true;
+  }
+
+public:
+
+  // Return false while the packet still has moves that don't fit in the queue
+  static bool process(const uint8_t packet_type, char *buffer, const uint16_t length, const uint16_t window) {
+    switch (static_cast<MotionStream>(packet_type)) {
+      case MotionStream::QUERY:
+        SERIAL_ECHOLNPGM("PMS:version:", VERSION_MAJOR, ".", VERSION_MINOR, ".", VERSION_PATCH, ":window:", window, ":scale:1000");
+        break;
+      case MotionStream::RESET:
+        ZERO(last);
+        break;
+      case MotionStream::MOVES:
+        if (!queue_moves(reinterpret_cast<uint8_t*>(buffer), length)) return false;
+        break;
+      default:
+        SERIAL_ECHOLNPGM("PMS:invalid");
+        break;
+    }
+    offset = 0;
+    return true;
+  }
+
+  static const uint16_t VERSION_MAJOR = 0, VERSION_MINOR = 1, VERSION_PATCH = 0;
+};
+
+#endif // BINARY_MOTION_STREAM
+
+#if ENABLED(BINARY_COMMAND_BATCH)
+
+#include "../gcode/queue.h"
+#include "../libs/crc16.h"
+
+/**
+ * Batches of G-code lines, queued together with one acknowledgement.
+ *
+ * BEGIN starts a batch. DATA packets add to its text, with lines ending in '\n'.
+ * END carries the CRC16 of the whole text. The END packet is acknowledged once
+ * all the lines are in the command queue, which they enter without an "ok".
+ * A batch with a bad CRC or any bad line queues nothing, and each bad line is
+ * reported in the summary.
+ */
+class CommandBatchProtocol {
+private:
+  enum class CommandBatch : uint8_t { QUERY, BEGIN, DATA, END };
+
+  static char text[BINARY_COMMAND_BATCH_SIZE + 1];
+  static uint16_t length;     // Bytes of text received
+  static int16_t lines;       // Checked commands waiting for room in the queue, or -1
+  static uint8_t text_lines;  // Commands that need a text slot (GCODE_TOKEN_QUEUE)
+  static bool overflow;
+
+  // Get the command on a line of the text, cut in place. Return nullptr for a blank line.
+  static char* trim_line(char * const line) {
+    char *p = line;
+    while (*p == ' ') ++p;
+    char * const comment = strchr(p, ';');
+    if (comment) *comment = '\0';
+    char *e = p + strlen(p);
+    while (e > p && (e[-1] == ' ' || e[-1] == '\r')) *--e = '\0';
+    return *p ? p : nullptr;
+  }
+
+  // Split the text into commands and count them. Return false if any are bad.
+  static bool check_lines() {
+    lines = 0;
+    text_lines = 0;
+    uint16_t errors = 0, line_number = 0;
+    text[length] = '\0';
+    for (char *line = text; line < text + length;) {
+      char * const eol = strchr(line, '\n');
+      if (eol) *eol = '\0';
+      line_number++;
+      const char * const cmd = trim_line(line);
+      line += strlen(line) + 1;
+      if (!cmd) continue;
+
+      if (strlen(cmd) >= MAX_CMD_SIZE) {
+        SERIAL_ECHOLNPGM("PCB:error:line:", line_number, ":too long");
+        errors++;
+        continue;
+      }
+      lines++;
+      #if ENABLED(GCODE_TOKEN_QUEUE)
+        GCodeParser::token_t t;
+        if (!parser.tokenize(cmd, t)) text_lines++;
+      #endif
+    }
+
+    if (lines > BUFSIZE || TERN0(GCODE_TOKEN_QUEUE, text_lines > GCODE_TEXT_SLOTS)) {
+      SERIAL_ECHOLNPGM("PCB:error:too many commands:", lines);
+      errors++;
+    }
+
+    if (errors) {
+      SERIAL_ECHOLNPGM("PCB:rejected:", errors);
+      lines = -1;
+      return false;
+    }
+    return true;
+  }
+
+  // Queue all the commands once there's room for them. Return false to wait.
+  static bool queue_lines() {
+    if (queue.ring_buffer.length + lines > BUFSIZE) return false;
+    #if ENABLED(GCODE_TOKEN_QUEUE)
+      if (queue.ring_buffer.text_length + text_lines > GCODE_TEXT_SLOTS) return false;
+    #elif ENABLED(GCODE_PACKED_QUEUE)
+      if (queue.ring_buffer.text_space(length + MAX_CMD_SIZE) < 0) return false;
+    #endif
+    for (char *line = text; line < text + length; line += strlen(line) + 1)
+      if (const char * const cmd = trim_line(line))
+        queue.ring_buffer.enqueue(cmd, true OPTARG(HAS_MULTI_SERIAL, card.transfer_port_index));
+    SERIAL_ECHOLNPGM("PCB:queued:", lines);
+    lines = -1;
+    return true;
+  }
+
+  static void end(const char * const buffer, const uint16_t size) {
+    uint16_t crc = 0;
+    crc16(&crc, text, length);
+    if (overflow)
+      SERIAL_ECHOLNPGM("PCB:error:batch over ", BINARY_COMMAND_BATCH_SIZE, " bytes");
+    else if (size != sizeof(crc) || crc != (uint16_t(uint8_t(buffer[1])) << 8 | uint8_t(buffer[0])))
+      SERIAL_ECHOLNPGM("PCB:error:crc");
+    else if (check_lines())
+      return;
+    lines = -1;
+  }
+
+public:
+
+  // Return false while a batch is waiting for room in the command queue
+  static bool process(const uint8_t packet_type, char *buffer, const uint16_t size) {
+    switch (static_cast<CommandBatch>(packet_type)) {
+      case CommandBatch::QUERY:
+        SERIAL_ECHOLNPGM("PCB:version:", VERSION_MAJOR, ".", VERSION_MINOR, ".", VERSION_PATCH, ":size:", BINARY_COMMAND_BATCH_SIZE);
+        break;
+      case CommandBatch::BEGIN:
+        length = 0;
+        overflow = false;
+        break;
+      case CommandBatch::DATA:
+        if (length + size > BINARY_COMMAND_BATCH_SIZE)
+          overflow = true;
+        else {
+          memcpy(&text[length], buffer, size);
+          length += size;
+        }
+        break;
+      case CommandBatch::END:
+        if (lines < 0) end(buffer, size);
+        if (lines >= 0 && !queue_lines()) return false;
+        length = 0;
+        break;
+      default:
+        SERIAL_ECHOLNPGM("PCB:invalid");
+        break;
+    }
+    return true;
+  }
+
+  static const uint16_t VERSION_MAJOR = 0, VERSION_MINOR = 1, VERSION_PATCH = 0;
+};
+
+#endif // BINARY_COMMAND_BATCH
+
 class BinaryStream {
 public:
-  enum class Protocol : uint8_t { CONTROL, FILE_TRANSFER };
+  enum class Protocol : uint8_t { CONTROL, FILE_TRANSFER, MOTION_STREAM, COMMAND_BATCH };
 
   enum class ProtocolControl : uint8_t { SYNC = 1, CLOSE };
 
@@ -332,6 +600,12 @@ public:
                 if (packet.header.size) {
                   stream_state = StreamState::PACKET_DATA;
                   packet.buffer = static_cast<char *>(&buffer[0]); // multipacket buffering not implemented, always allocate whole buffer to packet
+                  #if ENABLED(SD_WRITE_BUFFER)
+                    if (static_cast<Protocol>(packet.header.protocol()) == Protocol::FILE_TRANSFER) {
+                      char * const space = SDFileTransferProtocol::receive_space(packet.header.type(), packet.header.size);
+                      if (space) packet.buffer = space;
+                    }
+                  #endif
                 }
                 else
                   stream_state = StreamState::PACKET_PROCESS;
@@ -389,6 +663,18 @@ public:
           }
           break;
         case StreamState::PACKET_PROCESS:
+          #if ENABLED(BINARY_MOTION_STREAM)
+            // Hold the packet, unacknowledged, until the command queue takes all its moves
+            if (static_cast<Protocol>(packet.header.protocol()) == Protocol::MOTION_STREAM) {
+              constexpr uint16_t window = _MAX(1, (RX_BUFFER_SIZE) / (buffer_size + sizeof(Packet::Header) + sizeof(Packet::Footer)));
+              if (!MotionStreamProtocol::process(packet.header.type(), packet.buffer, packet.header.size, window)) return;
+            }
+          #endif
+          #if ENABLED(BINARY_COMMAND_BATCH)
+            // Hold the END of a batch, unacknowledged, until the command queue has room for all of it
+            if (static_cast<Protocol>(packet.header.protocol()) == Protocol::COMMAND_BATCH)
+              if (!CommandBatchProtocol::process(packet.header.type(), packet.buffer, packet.header.size)) return;
+          #endif
           sync++;
           packet_retries = 0;
           bytes_received += packet.header.size;
@@ -436,6 +722,12 @@ public:
       case Protocol::FILE_TRANSFER:
         SDFileTransferProtocol::process(packet.header.type(), packet.buffer, packet.header.size); // send user data to be processed
       break;
+      #if ENABLED(BINARY_MOTION_STREAM)
+        case Protocol::MOTION_STREAM: break;  // Already queued before the ack
+      #endif
+      #if ENABLED(BINARY_COMMAND_BATCH)
+        case Protocol::COMMAND_BATCH: break;  // Already queued before the ack
+      #endif
       default:
         SERIAL_ECHO_MSG("Unsupported Binary Protocol");
     }
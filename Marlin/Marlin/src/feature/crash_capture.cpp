@@ -0,0 +1,220 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(CRASH_CAPTURE)
+
+#include "crash_capture.h"
+#include "../HAL/shared/backtrace/unwinder.h"
+#include "../HAL/shared/backtrace/unwmemaccess.h"
+#include "../gcode/queue.h"
+#include "../module/planner.h"
+#include "../module/temperature.h"
+#include "../sd/cardreader.h"
+
+#if ENABLED(TRACE_EVENTS)
+  #include "trace_events.h"
+#endif
+
+#if !defined(RNG)
+  #error "CRASH_CAPTURE uses the RNG interrupt, found on STM32F405/407 and up."
+#endif
+
+// The RNG is unused, so its interrupt only comes when pended by watchdog_check()
+#define CRASH_IRQn          HASH_RNG_IRQn
+#define CRASH_IRQ_PRIO      15                  // Below the Temperature ISR
+#define CRASH_WATCHDOG_MS   (TERN(WATCHDOG_DURATION_8S, 8000, 4000) - 500)
+
+typedef struct {
+  uint32_t magic;
+  uint8_t cause,                                // Exception number
+          depth,                                // Backtrace entries
+          events;                               // Trace events
+  millis_t ms;
+  uint32_t regs[16];                            // As passed to hook_save_fault()
+  uint32_t backtrace[CRASH_CAPTURE_BACKTRACE];
+  #if ENABLED(TRACE_EVENTS)
+    uint32_t event_time[CRASH_CAPTURE_EVENTS];
+    uint8_t event[CRASH_CAPTURE_EVENTS];
+  #endif
+  uint8_t block_head, block_tail, commands;
+  bool sd_printing;
+  uint32_t sdpos;
+  int32_t steps[LOGICAL_AXES];                  // Planner position
+  int16_t hotend, bed;                          // °C
+  uint32_t check;
+} crash_record_t;
+
+// Not cleared by the startup code, so it's still there after a reset
+__attribute__((section(".noinit"))) static crash_record_t record;
+
+CrashCapture crash_capture;
+
+volatile millis_t CrashCapture::refresh_ms; // = 0
+bool CrashCapture::pending; // = false
+static bool watching; // = false
+
+static uint32_t record_check() {
+  uint32_t sum = 0;
+  const uint8_t *p = (const uint8_t*)&record;
+  for (size_t i = 0; i < offsetof(crash_record_t, check); i++) sum = (sum << 1 | sum >> 31) + p[i];
+  return sum;
+}
+
+void CrashCapture::init() {
+  if (record.magic == CRASH_CAPTURE_MAGIC && record.check == record_check()) {
+    pending = true;
+    SERIAL_ECHOLNPGM("Crash record found, exception ", record.cause);
+  }
+  else
+    record.magic = 0;
+
+  HAL_NVIC_SetPriority(CRASH_IRQn, CRASH_IRQ_PRIO, 0);
+  HAL_NVIC_EnableIRQ(CRASH_IRQn);
+  refresh_ms = millis();
+  watching = ENABLED(USE_WATCHDOG);
+}
+
+void CrashCapture::watchdog_check() {
+  if (watching && ELAPSED(millis(), refresh_ms + CRASH_WATCHDOG_MS)) {
+    watching = false;
+    NVIC_SetPendingIRQ(CRASH_IRQn);
+  }
+}
+
+// Go to the fault handler with the frame of the code the IRQ interrupted
+extern "C" __attribute__((naked)) void HASH_RNG_IRQHandler() {
+  __asm__ __volatile__ ("b CommonHandler_ASM\n");
+}
+
+static bool save_frame(void *ctx, const UnwReport *bte) {
+  uint8_t &depth = *(uint8_t*)ctx;
+  record.backtrace[depth++] = bte->address;
+  return depth < CRASH_CAPTURE_BACKTRACE;
+}
+
+void CrashCapture::save(const uint8_t cause, const uint32_t regs[16]) {
+  record.magic = 0;
+  record.cause = cause;
+  record.ms = millis();
+  LOOP_L_N(i, 16) record.regs[i] = regs[i];
+
+  static const UnwindCallbacks callbacks = {
+    save_frame, UnwReadW, UnwReadH, UnwReadB
+    #ifdef UNW_DEBUG
+      , nullptr
+    #endif
+  };
+  UnwindFrame btf;
+  btf.sp = regs[14] + 8 * 4;  // Above the exception frame
+  btf.fp = btf.sp;
+  btf.lr = regs[5];
+  btf.pc = regs[6] | 1;
+  record.depth = 0;
+  UnwindStart(&btf, &callbacks, &record.depth);
+
+  #if ENABLED(TRACE_EVENTS)
+    TraceEvents::stop();
+    record.events = TraceEvents::latest(record.event_time, record.event, CRASH_CAPTURE_EVENTS);
+  #else
+    record.events = 0;
+  #endif
+
+  record.block_head = planner.block_buffer_head;
+  record.block_tail = planner.block_buffer_tail;
+  record.commands = queue.ring_buffer.length;
+  record.sd_printing = IS_SD_PRINTING();
+  record.sdpos = card.getIndex();
+  LOOP_LOGICAL_AXES(a) record.steps[a] = planner.position[a];
+  record.hotend = TERN0(HAS_HOTEND, int16_t(thermalManager.degHotend(0)));
+  record.bed = TERN0(HAS_HEATED_BED, int16_t(thermalManager.degBed()));
+
+  record.check = record_check();
+  record.magic = CRASH_CAPTURE_MAGIC;
+}
+
+void hook_save_fault(const uint8_t cause, const uint32_t regs[16]) { crash_capture.save(cause, regs); }
+
+void CrashCapture::task() {
+  if (!pending || !card.isMounted() || card.isFileOpen()) return;
+  pending = false;    // One try per boot
+  if (write_log()) record.magic = 0;
+}
+
+bool CrashCapture::write_log() {
+  static const char reg_name[16][5] = {
+    "R0", "R1", "R2", "R3", "R12", "LR", "PC", "PSR", "CFSR", "HFSR", "DFSR", "AFSR", "MMAR", "BFAR", "SP", "EXC"
+  };
+
+  SdFile root = card.getroot(), file;
+  char fname[13], line[64];
+  uint8_t n = 0;
+  for (;;) {
+    sprintf_P(fname, PSTR("crash_%u.log"), n);
+    if (file.open(&root, fname, O_CREAT | O_EXCL | O_WRITE)) break;
+    if (++n > 99) return false;
+  }
+
+  #define LOG_LINE(V...) do{ sprintf_P(line, V); file.write(line); file.write("\n"); }while(0)
+
+  LOG_LINE(PSTR("Marlin " SHORT_BUILD_VERSION " crash capture"));
+  switch (record.cause) {
+    case 2:  LOG_LINE(PSTR("Cause: NMI"));        break;
+    case 3:  LOG_LINE(PSTR("Cause: HardFault"));  break;
+    case 4:  LOG_LINE(PSTR("Cause: MemManage"));  break;
+    case 5:  LOG_LINE(PSTR("Cause: BusFault"));   break;
+    case 6:  LOG_LINE(PSTR("Cause: UsageFault")); break;
+    case 16 + CRASH_IRQn: LOG_LINE(PSTR("Cause: Watchdog, no refresh for %u ms"), CRASH_WATCHDOG_MS); break;
+    default: LOG_LINE(PSTR("Cause: exception %u"), record.cause); break;
+  }
+  LOG_LINE(PSTR("Uptime: %lu ms"), (unsigned long)record.ms);
+  LOOP_L_N(i, 16) LOG_LINE(PSTR("%-5s: 0x%08lX"), reg_name[i], (unsigned long)record.regs[i]);
+
+  LOG_LINE(PSTR("Backtrace:"));
+  LOOP_L_N(i, record.depth) LOG_LINE(PSTR("#%u : PC 0x%08lX"), i + 1, (unsigned long)record.backtrace[i]);
+
+  LOG_LINE(PSTR("Planner: head %u tail %u"), record.block_head, record.block_tail);
+  LOG_LINE(PSTR("Queue: %u commands"), record.commands);
+  LOG_LINE(PSTR("SD: printing %u pos %lu"), record.sd_printing, (unsigned long)record.sdpos);
+  LOOP_LOGICAL_AXES(a) LOG_LINE(PSTR("%c: %ld steps"), axis_codes[a], (long)record.steps[a]);
+  LOG_LINE(PSTR("Hotend %d C Bed %d C"), record.hotend, record.bed);
+
+  #if ENABLED(TRACE_EVENTS)
+    LOG_LINE(PSTR("Trace: %u events, us before the last"), record.events);
+    LOOP_L_N(i, record.events) {
+      const uint8_t e = record.event[i];
+      LOG_LINE(PSTR("-%lu %s %s"),
+        (unsigned long)((record.event_time[record.events - 1] - record.event_time[i]) / (F_CPU / 1000000UL)),
+        TraceEvents::name(e), e & TraceEvents::TRACE_END ? "end" : "begin"
+      );
+    }
+  #endif
+
+  #undef LOG_LINE
+
+  const bool ok = file.close();
+  if (ok) SERIAL_ECHOLNPGM("Crash log saved to ", fname);
+  return ok;
+}
+
+#endif // CRASH_CAPTURE
@@ -0,0 +1,63 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * crash_capture.h - Keep the state of a crash or lockup for the next boot
+ *
+ * A CPU fault (through the POSTMORTEM_DEBUGGING handler) or a watchdog about
+ * to bite saves the registers, a backtrace, the newest trace events and the
+ * planner and queue state in RAM that is not cleared by a reset. After the
+ * reboot the record is written to crash_<n>.log in the root of the SD card.
+ *
+ * The Temperature ISR watches the watchdog refreshes. When they stop it pends
+ * a spare low priority IRQ that goes to the fault handler, so the backtrace
+ * starts at the code the main loop was stuck in.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#define CRASH_CAPTURE_MAGIC 0x43525348UL  // "CRSH"
+
+class CrashCapture {
+public:
+  // At boot: enable the watchdog IRQ and look for a record from before the reset
+  static void init();
+
+  // Write a pending record to the SD card once it's mounted
+  static void task();
+
+  // Called by the Temperature ISR
+  static void watchdog_check();
+  static void watchdog_refreshed() { refresh_ms = millis(); }
+
+  // Fill the record, from the fault handler
+  static void save(const uint8_t cause, const uint32_t regs[16]);
+
+private:
+  static volatile millis_t refresh_ms;
+  static bool pending;
+
+  static bool write_log();
+};
+
+extern CrashCapture crash_capture;
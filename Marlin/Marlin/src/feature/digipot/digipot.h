@@ -28,6 +28,9 @@ class DigipotI2C {
 public:
   static void init();
   static void set_current(const uint8_t channel, const float current);
+  #if ENABLED(DIGIPOT_DYNAMIC_CURRENT)
+    static void scale_current(const uint8_t channel, const uint8_t percent);
+  #endif
 };
 
 extern DigipotI2C digipot_i2c;
@@ -26,8 +26,12 @@
 
 #include "digipot.h"
 
-#include <Stream.h>
-#include <SlowSoftI2CMaster.h>  // https://github.com/felias-fogg/SlowSoftI2CMaster
+#if ENABLED(SOFT_I2C_ASYNC)
+  #include "../../libs/soft_i2c_async.h"
+#else
+  #include <Stream.h>
+  #include <SlowSoftI2CMaster.h>  // https://github.com/felias-fogg/SlowSoftI2CMaster
+#endif
 
 #if ENABLED(M907_PROTECTION)
   #include "../../MarlinCore.h"
@@ -60,6 +64,41 @@ static byte current_to_wiper(const float current) {
   return byte(constrain(value, 0, DIGIPOT_MCP4018_MAX_VALUE));
 }
 
+#if ENABLED(SOFT_I2C_ASYNC)
+
+static const pin_t pot_sda[DIGIPOT_I2C_NUM_CHANNELS] = {
+  DIGIPOTS_I2C_SDA_X
+  #if DIGIPOT_I2C_NUM_CHANNELS > 1
+    , DIGIPOTS_I2C_SDA_Y
+    #if DIGIPOT_I2C_NUM_CHANNELS > 2
+      , DIGIPOTS_I2C_SDA_Z
+      #if DIGIPOT_I2C_NUM_CHANNELS > 3
+        , DIGIPOTS_I2C_SDA_E0
+        #if DIGIPOT_I2C_NUM_CHANNELS > 4
+          , DIGIPOTS_I2C_SDA_E1
+          #if DIGIPOT_I2C_NUM_CHANNELS > 5
+            , DIGIPOTS_I2C_SDA_E2
+            #if DIGIPOT_I2C_NUM_CHANNELS > 6
+              , DIGIPOTS_I2C_SDA_E3
+              #if DIGIPOT_I2C_NUM_CHANNELS > 7
+                , DIGIPOTS_I2C_SDA_E4
+              #endif
+            #endif
+          #endif
+        #endif
+      #endif
+    #endif
+  #endif
+};
+
+// Queued, and clocked out by the Temperature ISR
+static void digipot_i2c_send(const uint8_t channel, const byte v) {
+  if (WITHIN(channel, 0, DIGIPOT_I2C_NUM_CHANNELS - 1))
+    soft_i2c.write(pot_sda[channel], DIGIPOTS_I2C_SCL, DIGIPOT_I2C_ADDRESS_A, &v, 1);
+}
+
+#else
+
 static SlowSoftI2CMaster pots[DIGIPOT_I2C_NUM_CHANNELS] = {
   SlowSoftI2CMaster(DIGIPOTS_I2C_SDA_X, DIGIPOTS_I2C_SCL, ENABLED(DIGIPOT_ENABLE_I2C_PULLUPS))
   #if DIGIPOT_I2C_NUM_CHANNELS > 1
@@ -93,14 +132,50 @@ static void digipot_i2c_send(const uint8_t channel, const byte v) {
   }
 }
 
+#endif // !SOFT_I2C_ASYNC
+
+#if ENABLED(DIGIPOT_DYNAMIC_CURRENT)
+
+  static float motor_current[DIGIPOT_I2C_NUM_CHANNELS];       // Set by M907 or the defaults
+  static uint8_t current_percent[DIGIPOT_I2C_NUM_CHANNELS];   // Applied by dynamic_current (0 = 100)
+  static int16_t last_wiper[DIGIPOT_I2C_NUM_CHANNELS];
+
+  // Send the scaled current if the wiper changes. A boost never goes over the limit.
+  static void send_scaled(const uint8_t channel) {
+    float c = motor_current[channel] * (current_percent[channel] ?: 100) / 100;
+    TERN(DIGIPOT_USE_RAW_VALUES,, NOMORE(c, _MAX(motor_current[channel], DIGIPOT_A4988_MAX_CURRENT)));
+    const byte w = current_to_wiper(c);
+    if (w == last_wiper[channel]) return;
+    last_wiper[channel] = w;
+    digipot_i2c_send(channel, w);
+  }
+
+  void DigipotI2C::scale_current(const uint8_t channel, const uint8_t percent) {
+    if (channel >= DIGIPOT_I2C_NUM_CHANNELS || percent == current_percent[channel]) return;
+    current_percent[channel] = percent;
+    send_scaled(channel);
+  }
+
+#endif
+
 // This is for the MCP4018 I2C based digipot
 void DigipotI2C::set_current(const uint8_t channel, const float current) {
   const float ival = _MIN(_MAX(current, 0), float(DIGIPOT_MCP4018_MAX_VALUE));
-  digipot_i2c_send(channel, current_to_wiper(ival));
+  #if ENABLED(DIGIPOT_DYNAMIC_CURRENT)
+    if (channel >= DIGIPOT_I2C_NUM_CHANNELS) return;
+    (void)current_to_wiper(ival); // Check the unscaled current (M907_PROTECTION)
+    motor_current[channel] = ival;
+    last_wiper[channel] = -1;
+    send_scaled(channel);
+  #else
+    digipot_i2c_send(channel, current_to_wiper(ival));
+  #endif
 }
 
 void DigipotI2C::init() {
-  LOOP_L_N(i, DIGIPOT_I2C_NUM_CHANNELS) pots[i].i2c_init();
+  #if DISABLED(SOFT_I2C_ASYNC)
+    LOOP_L_N(i, DIGIPOT_I2C_NUM_CHANNELS) pots[i].i2c_init();
+  #endif
 
   // Init currents according to Configuration_adv.h
   static const float digipot_motor_current[] PROGMEM =
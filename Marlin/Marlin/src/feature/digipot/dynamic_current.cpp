@@ -0,0 +1,78 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(DIGIPOT_DYNAMIC_CURRENT)
+
+#include "dynamic_current.h"
+#include "digipot.h"
+#include "../../module/planner.h"
+
+DynamicCurrent dynamic_current;
+
+millis_t DynamicCurrent::moved_ms[DIGIPOT_I2C_NUM_CHANNELS]; // = { 0 }
+
+enum CurrentLevel : uint8_t { LEVEL_IDLE, LEVEL_RUN, LEVEL_BOOST };
+
+void DynamicCurrent::task() {
+  static millis_t next_ms; // = 0
+  const millis_t ms = millis();
+  if (PENDING(ms, next_ms)) return;
+  next_ms = ms + 20;
+
+  // What the queued moves need from each motor. Channels are X Y Z (I J K) then E0 E1...
+  CurrentLevel level[DIGIPOT_I2C_NUM_CHANNELS] = { LEVEL_IDLE };
+  for (uint8_t b = planner.block_buffer_tail; b != planner.block_buffer_head; b = BLOCK_MOD(b + 1)) {
+    block_t * const block = &planner.block_buffer[b];
+    if (!block->is_move() || !block->step_event_count) continue;
+
+    // Only a block that speeds up or slows down can need the boost
+    const bool ramps = block->accelerate_until || block->decelerate_after < block->step_event_count;
+
+    LOOP_L_N(ch, DIGIPOT_I2C_NUM_CHANNELS) {
+      const bool is_e = ch >= LINEAR_AXES;
+      if (is_e && ch - LINEAR_AXES != block->extruder) continue;
+      const uint32_t steps = block->steps[is_e ? E_AXIS : AxisEnum(ch)];
+      if (!steps) continue;
+
+      CurrentLevel l = LEVEL_RUN;
+      if (ramps) {
+        // The share of the block acceleration on this axis, in mm/s²
+        const float accel = float(block->acceleration_steps_per_s2) * steps / block->step_event_count
+                          * planner.mm_per_step[is_e ? E_AXIS_N(block->extruder) : AxisEnum(ch)];
+        if (accel >= DIGIPOT_BOOST_ACCEL) l = LEVEL_BOOST;
+      }
+      NOLESS(level[ch], l);
+    }
+  }
+
+  LOOP_L_N(ch, DIGIPOT_I2C_NUM_CHANNELS) {
+    if (level[ch]) moved_ms[ch] = ms;
+    const uint8_t percent = level[ch] == LEVEL_BOOST ? DIGIPOT_BOOST_PERCENT
+                          : (level[ch] || PENDING(ms, moved_ms[ch] + DIGIPOT_HOLD_DELAY)) ? DIGIPOT_RUN_PERCENT
+                          : DIGIPOT_HOLD_PERCENT;
+    digipot_i2c.scale_current(ch, percent);
+  }
+}
+
+#endif // DIGIPOT_DYNAMIC_CURRENT
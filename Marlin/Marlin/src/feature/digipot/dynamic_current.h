@@ -0,0 +1,42 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * dynamic_current.h - Scale the digipot currents with the queued moves (DIGIPOT_DYNAMIC_CURRENT)
+ *
+ * Each digipot write takes tens of milliseconds on the soft I2C bus, far too slow
+ * to follow the trapezoid of one block. So the level of each motor comes from all
+ * the moves in the planner queue, and is raised ahead of the move that needs it.
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+class DynamicCurrent {
+public:
+  static void task();
+
+private:
+  static millis_t moved_ms[DIGIPOT_I2C_NUM_CHANNELS];   // Last time a queued move used the motor
+};
+
+extern DynamicCurrent dynamic_current;
@@ -57,8 +57,9 @@ namespace DirectStepping {
   template<typename Cfg>
   volatile bool SerialPageManager<Cfg>::page_states_dirty;
 
+  // Only the CPU copies into pages, so they may go in core coupled RAM
   template<typename Cfg>
-  uint8_t SerialPageManager<Cfg>::pages[Cfg::PAGE_COUNT][Cfg::PAGE_SIZE];
+  __ccmram uint8_t SerialPageManager<Cfg>::pages[Cfg::PAGE_COUNT][Cfg::PAGE_SIZE];
 
   template<typename Cfg>
   uint8_t SerialPageManager<Cfg>::checksum;
@@ -126,12 +127,22 @@ namespace DirectStepping {
 
         set_page_state(write_page_idx, PageState::WRITING);
 
-        state = Cfg::DIRECTIONAL ? State::COLLECT : State::SIZE;
+        state = (Cfg::DIRECTIONAL && !Cfg::PACKED_PAGE) ? State::COLLECT : State::SIZE;
 
         return true;
       case State::SIZE:
         // Zero means full page size
         write_page_size = c;
+        state = Cfg::PACKED_PAGE ? State::SIZE_HIGH : State::COLLECT;
+        return true;
+      case State::SIZE_HIGH:
+        // Packed pages have a 16-bit size, low byte first
+        write_page_size |= write_byte_idx_t(c) << 8;
+        if (!write_page_size || write_page_size > Cfg::PAGE_SIZE) {
+          fatal_error = true;
+          state = State::MONITOR;
+          return true;
+        }
         state = State::COLLECT;
         return true;
       case State::COLLECT:
@@ -139,7 +150,9 @@ namespace DirectStepping {
         checksum ^= c;
 
         // check if still collecting
-        if (Cfg::PAGE_SIZE == 256) {
+        if (Cfg::PACKED_PAGE) {
+          if (write_byte_idx < write_page_size) return true;
+        } else if (Cfg::PAGE_SIZE == 256) {
           // special case for 8-bit, check if rolled back to 0
           if (Cfg::DIRECTIONAL || !write_page_size) { // full 256 bytes
             if (write_byte_idx) return true;
@@ -226,7 +239,7 @@ DirectStepping::PageManager page_manager;
 
 const uint8_t segment_table[DirectStepping::Config::NUM_SEGMENTS][DirectStepping::Config::SEGMENT_STEPS] PROGMEM = {
 
-  #if STEPPER_PAGE_FORMAT == SP_4x4D_128
+  #if STEPPER_PAGE_FORMAT == SP_4x4D_128 || STEPPER_PAGE_FORMAT == SP_4x4DP_128
 
     { 1, 1, 1, 1, 1, 1, 1 }, //  0 = -7
     { 1, 1, 1, 0, 1, 1, 1 }, //  1 = -6
@@ -26,7 +26,7 @@
 namespace DirectStepping {
 
   enum State : char {
-    MONITOR, NEWLINE, ADDRESS, SIZE, COLLECT, CHECKSUM, UNFAIL
+    MONITOR, NEWLINE, ADDRESS, SIZE, SIZE_HIGH, COLLECT, CHECKSUM, UNFAIL
   };
 
   enum PageState : uint8_t {
@@ -41,6 +41,8 @@ namespace DirectStepping {
     uint16_t segment_idx;
     // Current steps within segment
     uint8_t segment_steps;
+    // Segments left in the current packed record
+    uint8_t run;
     // Segment delta
     xyze_uint8_t sd;
     // Block delta
@@ -83,7 +85,7 @@ namespace DirectStepping {
   template<bool b, typename T, typename F> struct TypeSelector { typedef T type;} ;
   template<typename T, typename F> struct TypeSelector<false, T, F> { typedef F type; };
 
-  template <int num_pages, int num_axes, int bits_segment, bool dir, int segments>
+  template <int num_pages, int num_axes, int bits_segment, bool dir, int segments, bool packed=false>
   struct config_t {
     static constexpr char CONTROL_CHAR  = '!';
 
@@ -92,11 +94,14 @@ namespace DirectStepping {
     static constexpr int BITS_SEGMENT   = bits_segment;
     static constexpr int DIRECTIONAL    = dir ? 1 : 0;
     static constexpr int SEGMENTS       = segments;
+    static constexpr bool PACKED_PAGE   = packed;
 
     static constexpr int NUM_SEGMENTS   = _BV(BITS_SEGMENT);
     static constexpr int SEGMENT_STEPS  = _BV(BITS_SEGMENT - DIRECTIONAL) - 1;
     static constexpr int TOTAL_STEPS    = SEGMENT_STEPS * SEGMENTS;
-    static constexpr int PAGE_SIZE      = (AXIS_COUNT * BITS_SEGMENT * SEGMENTS) / 8;
+    // A packed page holds up to one header byte and all axis values per segment
+    static constexpr int PAGE_SIZE      = PACKED_PAGE ? SEGMENTS * (1 + (AXIS_COUNT * BITS_SEGMENT + 7) / 8)
+                                                      : (AXIS_COUNT * BITS_SEGMENT * SEGMENTS) / 8;
 
     typedef typename TypeSelector<(PAGE_SIZE>256), uint16_t, uint8_t>::type write_byte_idx_t;
     typedef typename TypeSelector<(PAGE_COUNT>256), uint16_t, uint8_t>::type page_idx_t;
@@ -111,6 +116,12 @@ namespace DirectStepping {
   template <uint8_t num_pages>
   using SP_4x1_512  = config_t<num_pages, 4, 1, false, 512>;
 
+  // SP_4x4D_128 segments, packed as records of a header byte with the changed
+  // axes (XYZE in the high nibble) and the run length - 1 (low nibble), then
+  // the new 4-bit values of the changed axes. Pages start with all axes at rest.
+  template <uint8_t num_pages>
+  using SP_4x4DP_128 = config_t<num_pages, 4, 4, true, 128, true>;
+
   // configured types
   typedef STEPPER_PAGE_FORMAT<STEPPER_PAGES> Config;
 
@@ -123,6 +134,7 @@ namespace DirectStepping {
 //#define SP_4x2D_256 3
 #define SP_4x2_256 4
 #define SP_4x1_512 5
+#define SP_4x4DP_128 6
 
 typedef typename DirectStepping::Config::page_idx_t page_idx_t;
 
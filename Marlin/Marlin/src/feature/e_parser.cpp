@@ -42,4 +42,135 @@ bool EmergencyParser::killed_by_M112, // = false
 // Global instance
 EmergencyParser emergency_parser;
 
+#if ENABLED(REALTIME_OVERRIDES)
+
+  #include "../module/motion.h"
+  #include "../module/planner.h"
+  #include "../module/temperature.h"
+  #if ENABLED(BABYSTEPPING)
+    #include "babystep.h"
+  #endif
+
+  volatile uint8_t EmergencyParser::overrides_pending; // = 0
+  volatile int16_t EmergencyParser::override_feedrate,
+                   EmergencyParser::override_flow,
+                   EmergencyParser::override_fan;
+  volatile int32_t EmergencyParser::override_babystep;
+
+  /**
+   * Parse "[N<line>] !M<code> [S|Z<value>] [*<checksum>]" from the serial ISR.
+   * Numbered lines must carry a matching checksum, just as the command queue requires.
+   */
+  void EmergencyParser::update_override(State &state, const uint8_t c) {
+    // Has a whole M-code been read?
+    const bool have_code = state != EP_RT && (state != EP_RT_M || state.code >= 100);
+
+    if (ISEOL(c)) {
+      const bool valid = have_code
+                      && (!(state.flags & RT_NUMBERED) || ((state.flags & RT_STARRED) && state.check == state.sum));
+      if (valid) {
+        const bool digits = state.flags & RT_DIGITS;
+        int32_t v = state.value;
+        for (uint8_t f = state.frac; f < 3; ++f) v *= 10;
+        if (state.flags & RT_NEGATIVE) v = -v;
+        switch (state.code) {
+          case 220: if (digits) { override_feedrate = v / 1000; overrides_pending |= RT_FEEDRATE; } break;
+          case 221: if (digits) { override_flow = v / 1000; overrides_pending |= RT_FLOW; } break;
+          case 106: if (digits) { override_fan = v / 1000; overrides_pending |= RT_FAN; } break;
+          case 107: override_fan = 0; overrides_pending |= RT_FAN; break;
+          case 290: if (digits) { override_babystep += v; overrides_pending |= RT_BABYSTEP; } break;
+        }
+      }
+      state = EP_RESET;
+      return;
+    }
+
+    if (state != EP_RT_SUM) {
+      if (c == '*') {
+        // The line is complete except for its checksum
+        state = have_code ? EP_RT_SUM : EP_IGNORE;
+        state.flags |= RT_STARRED;
+        state.check = 0;
+        return;
+      }
+      state.sum ^= c;
+    }
+
+    switch (state) {
+      case EP_RT:
+        if (c == 'M') { state = EP_RT_M; state.code = 0; }
+        else if (c != ' ') state = EP_IGNORE;
+        break;
+
+      case EP_RT_M:
+        if (NUMERIC(c) && state.code < 100) { state.code = state.code * 10 + c - '0'; break; }
+        if (state.code < 100) { state = EP_IGNORE; break; }
+        state = EP_RT_P;
+        // fall through
+
+      case EP_RT_P:
+        if (c == 'S' || c == 'Z') { state = EP_RT_V; state.value = 0; state.frac = 0; }
+        else if (c != ' ') state = EP_IGNORE;
+        break;
+
+      case EP_RT_V:
+        if (NUMERIC(c)) {
+          if (!(state.flags & RT_POINT)) {
+            if (state.value > 99999) { state = EP_IGNORE; break; }
+            state.value = state.value * 10 + c - '0';
+          }
+          else if (state.frac < 3) {
+            state.value = state.value * 10 + c - '0';
+            state.frac++;
+          }
+          state.flags |= RT_DIGITS;
+        }
+        else if (c == '-' && !(state.flags & (RT_DIGITS | RT_POINT | RT_NEGATIVE))) state.flags |= RT_NEGATIVE;
+        else if (c == '.' && !(state.flags & RT_POINT)) state.flags |= RT_POINT;
+        else if (c == ' ') state = EP_RT_END;
+        else state = EP_IGNORE;
+        break;
+
+      case EP_RT_END:
+        if (c != ' ') state = EP_IGNORE;
+        break;
+
+      case EP_RT_SUM:
+        if (NUMERIC(c) && state.check < 256) state.check = state.check * 10 + c - '0';
+        else if (c != ' ') state = EP_IGNORE;
+        break;
+
+      default: break;
+    }
+  }
+
+  /**
+   * Apply the latest overrides from the main loop, where the planner and heaters may be touched.
+   */
+  void EmergencyParser::apply_overrides() {
+    if (!overrides_pending) return;
+
+    hal.isr_off();
+    const uint8_t pending = overrides_pending;
+    const int16_t feedrate = override_feedrate, flow = override_flow, fan = override_fan;
+    const int32_t babystep_um = override_babystep;
+    overrides_pending = 0;
+    override_babystep = 0;
+    hal.isr_on();
+
+    if (pending & RT_FEEDRATE) feedrate_percentage = _MAX(feedrate, 1);
+    #if HAS_EXTRUDERS
+      if (pending & RT_FLOW) planner.set_flow(active_extruder, _MAX(flow, 1));
+    #endif
+    #if HAS_FAN
+      if (pending & RT_FAN) thermalManager.set_fan_speed(0, constrain(fan, 0, 255));
+    #endif
+    #if ENABLED(BABYSTEPPING)
+      if (pending & RT_BABYSTEP) babystep.add_mm(Z_AXIS, constrain(babystep_um * 0.001f, -2.0f, 2.0f));
+    #endif
+    UNUSED(feedrate); UNUSED(flow); UNUSED(fan); UNUSED(babystep_um);
+  }
+
+#endif // REALTIME_OVERRIDES
+
 #endif // EMERGENCY_PARSER
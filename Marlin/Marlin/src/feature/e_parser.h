@@ -49,8 +49,8 @@ class EmergencyParser {
 
 public:
 
-  // Currently looking for: M108, M112, M410, M876 S[0-9], S000, P000, R000
-  enum State : uint8_t {
+  // Currently looking for: M108, M112, M410, M876 S[0-9], S000, P000, R000, !M<code> S/Z<value>
+  enum StateID : uint8_t {
     EP_RESET,
     EP_N,
     EP_M,
@@ -70,9 +70,39 @@ public:
       EP_ctrl,
       EP_K, EP_KI, EP_KIL, EP_KILL,
     #endif
+    #if ENABLED(REALTIME_OVERRIDES)
+      EP_RT, EP_RT_M, EP_RT_P, EP_RT_V, EP_RT_END, EP_RT_SUM,
+    #endif
     EP_IGNORE // to '\n'
   };
 
+  #if ENABLED(REALTIME_OVERRIDES)
+    // Each port tracks its own override line, so interleaved ports can't corrupt each other
+    struct State {
+      StateID id;
+      uint8_t sum,      // XOR of the line so far, to match its '*' checksum
+              flags,    // RT_ flags below
+              frac;     // Digits after the decimal point
+      uint16_t code,    // M-code number
+               check;   // Checksum sent after '*'
+      int32_t value;    // Parameter value in thousandths
+      State(const StateID s=EP_RESET) : id(s) {}
+      State& operator=(const StateID s) { id = s; return *this; }
+      operator StateID() const { return id; }
+    };
+    enum : uint8_t { RT_NUMBERED = _BV(0), RT_STARRED = _BV(1), RT_NEGATIVE = _BV(2), RT_POINT = _BV(3), RT_DIGITS = _BV(4) };
+
+    // Latest override of each kind, applied by apply_overrides() in idle()
+    enum : uint8_t { RT_FEEDRATE = _BV(0), RT_FLOW = _BV(1), RT_FAN = _BV(2), RT_BABYSTEP = _BV(3) };
+    static volatile uint8_t overrides_pending;
+    static volatile int16_t override_feedrate, override_flow, override_fan;
+    static volatile int32_t override_babystep;   // Accumulated microns
+
+    static void apply_overrides();
+  #else
+    typedef StateID State;
+  #endif
+
   static bool killed_by_M112;
   static bool quickstop_by_M410;
 
@@ -90,7 +120,12 @@ public:
       case EP_RESET:
         switch (c) {
           case ' ': case '\n': case '\r': break;
-          case 'N': state = EP_N; break;
+          #if ENABLED(REALTIME_OVERRIDES)
+            case 'N': state = EP_N; state.sum = c; state.flags = RT_NUMBERED; break;
+            case '!': state = EP_RT; state.sum = c; state.flags = 0; break;
+          #else
+            case 'N': state = EP_N; break;
+          #endif
           case 'M': state = EP_M; break;
           #if ENABLED(REALTIME_REPORTING_COMMANDS)
             case 'S': state = EP_S; break;
@@ -106,10 +141,14 @@ public:
         break;
 
       case EP_N:
+        TERN_(REALTIME_OVERRIDES, state.sum ^= c);
         switch (c) {
           case '0' ... '9':
           case '-': case ' ':     break;
           case 'M': state = EP_M; break;
+          #if ENABLED(REALTIME_OVERRIDES)
+            case '!': state = EP_RT; break;
+          #endif
           #if ENABLED(REALTIME_REPORTING_COMMANDS)
             case 'S': state = EP_S; break;
             case 'P': state = EP_P; break;
@@ -133,6 +172,10 @@ public:
         case EP_P00: state = (c == '0') ? EP_GRBL_PAUSE  : EP_IGNORE; break;
       #endif
 
+      #if ENABLED(REALTIME_OVERRIDES)
+        case EP_RT ... EP_RT_SUM: if (enabled) update_override(state, c); else if (ISEOL(c)) state = EP_RESET; break;
+      #endif
+
       #if ENABLED(SOFT_RESET_VIA_SERIAL)
         case EP_ctrl: state = (c == 'X') ? EP_KILL : EP_IGNORE; break;
         case EP_K:    state = (c == 'I') ? EP_KI   : EP_IGNORE; break;
@@ -220,6 +263,10 @@ public:
 
 private:
   static bool enabled;
+
+  #if ENABLED(REALTIME_OVERRIDES)
+    static void update_override(State &state, const uint8_t c);
+  #endif
 };
 
 extern EmergencyParser emergency_parser;
@@ -133,27 +133,52 @@ void FWRetract::retract(const bool retracting E_OPTARG(bool swapping/*=false*/))
   #endif
 
   const feedRate_t fr_max_z = planner.settings.max_feedrate_mm_s[Z_AXIS];
+
+  #if ENABLED(RETRACT_HOP_BLEND)
+    // Feedrate of a combined E and Z move, so neither axis goes faster than its own feedrate
+    auto hop_feedrate = [&](const float hop, const float e_length, const feedRate_t fr_e) {
+      return hop / _MAX(hop / fr_max_z, e_length / fr_e);
+    };
+  #endif
+
   if (retracting) {
+    const feedRate_t fr_retract = settings.retract_feedrate_mm_s * TERN1(RETRACT_SYNC_MIXING, (MIXING_STEPPERS));
+
     // Retract by moving from a faux E position back to the current E position
     current_retract[active_extruder] = base_retract;
-    prepare_internal_move_to_destination(                 // set current from destination
-      settings.retract_feedrate_mm_s * TERN1(RETRACT_SYNC_MIXING, (MIXING_STEPPERS))
-    );
 
     // Is a Z hop set, and has the hop not yet been done?
-    if (!current_hop && settings.retract_zraise > 0.01f) {  // Apply hop only once
-      current_hop += settings.retract_zraise;               // Add to the hop total (again, only once)
-      // Raise up, set_current_to_destination. Maximum Z feedrate
-      prepare_internal_move_to_destination(fr_max_z);
+    const bool hop = !current_hop && settings.retract_zraise > 0.01f;
+
+    #if ENABLED(RETRACT_HOP_BLEND)
+      if (hop) {
+        current_hop += settings.retract_zraise;             // Add to the hop total (only once)
+        // Retract and raise together, set_current_to_destination
+        prepare_internal_move_to_destination(hop_feedrate(settings.retract_zraise, base_retract, fr_retract));
+      }
+      else
+    #endif
+    {
+      prepare_internal_move_to_destination(fr_retract);   // set current from destination
+
+      if (hop) {                                            // Apply hop only once
+        current_hop += settings.retract_zraise;             // Add to the hop total (again, only once)
+        // Raise up, set_current_to_destination. Maximum Z feedrate
+        prepare_internal_move_to_destination(fr_max_z);
+      }
     }
   }
   else {
-    // If a hop was done and Z hasn't changed, undo the Z hop
-    if (current_hop) {
-      current_hop = 0;
-      // Lower Z, set_current_to_destination. Maximum Z feedrate
-      prepare_internal_move_to_destination(fr_max_z);
-    }
+    const float hop = current_hop;
+
+    #if DISABLED(RETRACT_HOP_BLEND)
+      // If a hop was done and Z hasn't changed, undo the Z hop
+      if (hop) {
+        current_hop = 0;
+        // Lower Z, set_current_to_destination. Maximum Z feedrate
+        prepare_internal_move_to_destination(fr_max_z);
+      }
+    #endif
 
     const float extra_recover = swapping ? settings.swap_retract_recover_extra : settings.retract_recover_extra;
     if (extra_recover) {
@@ -161,13 +186,25 @@ void FWRetract::retract(const bool retracting E_OPTARG(bool swapping/*=false*/))
       sync_plan_position_e();                             // Sync the planner position so the extra amount is recovered
     }
 
-    current_retract[active_extruder] = 0;
-
-    // Recover E, set_current_to_destination
-    prepare_internal_move_to_destination(
-      (swapping ? settings.swap_retract_recover_feedrate_mm_s : settings.retract_recover_feedrate_mm_s)
-      * TERN1(RETRACT_SYNC_MIXING, (MIXING_STEPPERS))
-    );
+    const feedRate_t fr_recover = (swapping ? settings.swap_retract_recover_feedrate_mm_s : settings.retract_recover_feedrate_mm_s)
+                                  * TERN1(RETRACT_SYNC_MIXING, (MIXING_STEPPERS));
+
+    #if ENABLED(RETRACT_HOP_BLEND)
+      if (hop) {
+        // Lower Z and recover together, set_current_to_destination
+        const float e_length = current_retract[active_extruder] + extra_recover;
+        current_hop = 0;
+        current_retract[active_extruder] = 0;
+        prepare_internal_move_to_destination(hop_feedrate(hop, e_length, fr_recover));
+      }
+      else
+    #endif
+    {
+      current_retract[active_extruder] = 0;
+
+      // Recover E, set_current_to_destination
+      prepare_internal_move_to_destination(fr_recover);
+    }
   }
 
   TERN_(RETRACT_SYNC_MIXING, mixer.T(old_mixing_tool));   // Restore original mixing tool
@@ -0,0 +1,76 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(HOST_BLOCK_STREAM)
+
+#include "host_blocks.h"
+#include "../module/planner.h"
+#include "../module/motion.h"
+
+HostBlockStream host_blocks;
+
+HostBlockStream::State HostBlockStream::state = NEWLINE;
+uint8_t HostBlockStream::index, HostBlockStream::checksum;
+HostBlockStream::frame_t HostBlockStream::frame;
+
+bool HostBlockStream::maybe_store_rxd_char(const uint8_t c) {
+  switch (state) {
+    default:
+    case MONITOR:
+      if (ISEOL(c)) state = NEWLINE;
+      return false;
+
+    case NEWLINE:
+      if (c == HOST_BLOCK_CONTROL_CHAR) {
+        state = COLLECT;
+        index = checksum = 0;
+        return true;
+      }
+      if (!ISEOL(c)) state = MONITOR;
+      return false;
+
+    case COLLECT:
+      frame.bytes[index++] = c;
+      checksum ^= c;
+      if (index == sizeof(host_block_t)) state = CHECKSUM;
+      return true;
+
+    case CHECKSUM:
+      state = MONITOR;
+      if (c != checksum)
+        SERIAL_ECHOLNPGM("#C");
+      else if (!planner.buffer_host_block(frame.block))
+        SERIAL_ECHOLNPGM("#L");
+      else {
+        // Follow the block, so G-code after the stream starts from its end
+        const host_block_t &b = frame.block;
+        LOOP_LINEAR_AXES(i) current_position[i] += b.steps[i] * planner.mm_per_step[i];
+        TERN_(HAS_EXTRUDERS, current_position.e += b.steps[3] * planner.mm_per_step[E_AXIS_N(active_extruder)]);
+        SERIAL_ECHOLNPGM("#A");
+      }
+      return true;
+  }
+}
+
+#endif // HOST_BLOCK_STREAM
@@ -0,0 +1,60 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+#pragma once
+
+/**
+ * host_blocks.h - Trapezoid blocks planned by the host
+ *
+ * A frame starts a line with HOST_BLOCK_CONTROL_CHAR, followed by a
+ * host_block_t (little-endian) and the XOR of its bytes. The block goes
+ * straight into the planner buffer, replied to with a line:
+ *   #A  Accepted
+ *   #C  Checksum mismatch, resend the block
+ *   #L  Over the machine limits, dropped
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#define HOST_BLOCK_CONTROL_CHAR '#'
+
+typedef struct {
+  int32_t steps[4];         // X, Y, Z, E steps, signed
+  uint32_t entry_rate,      // (steps/s) Rates of the axis with the most steps
+           nominal_rate,
+           exit_rate,
+           accel;           // (steps/s^2) Acceleration of the axis with the most steps
+} host_block_t;
+
+class HostBlockStream {
+public:
+  // Take a received byte that belongs to a frame. Call from the main loop.
+  static bool maybe_store_rxd_char(const uint8_t c);
+
+private:
+  enum State : uint8_t { MONITOR, NEWLINE, COLLECT, CHECKSUM };
+  static State state;
+  static uint8_t index, checksum;
+  static union frame_t { host_block_t block; uint8_t bytes[sizeof(host_block_t)]; } frame;
+};
+
+extern HostBlockStream host_blocks;
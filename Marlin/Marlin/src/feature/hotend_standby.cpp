@@ -0,0 +1,174 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * Hotend Standby Lookahead
+ *
+ * A copy of the print file is read ahead of the print for the next T command
+ * of each nozzle. The print's measured rate through the file converts the
+ * distance to that command into a time. An idle nozzle with enough time left
+ * goes to HOTEND_STANDBY_TEMP. It gets its temperature back when the time left
+ * is the time to reheat at HOTEND_STANDBY_HEAT_RATE, plus HOTEND_STANDBY_MARGIN.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(HOTEND_STANDBY_LOOKAHEAD)
+
+#include "hotend_standby.h"
+#include "../module/motion.h"
+#include "../module/temperature.h"
+#include "../sd/cardreader.h"
+
+#define RATE_INTERVAL_MS 10000UL
+
+HotendStandby hotend_standby;
+
+uint32_t HotendStandby::scan_from, HotendStandby::scan_pos, HotendStandby::next_use[HOTENDS];
+celsius_t HotendStandby::print_temp[HOTENDS];
+float HotendStandby::bytes_per_sec;
+uint8_t HotendStandby::standby, HotendStandby::due;
+
+// Line scanner state
+static uint8_t scan_state;    // 0: Line start, 1: In a T command, 2: Rest of line
+static int16_t scan_tool;     // Tool number being read, or -1
+static uint32_t scan_line;    // File offset of the current line
+
+void HotendStandby::reset() {
+  standby = due = 0;
+  bytes_per_sec = 0;
+  restart_scan(0);
+}
+
+void HotendStandby::restart_scan(const uint32_t pos) {
+  scan_from = scan_pos = scan_line = pos;
+  scan_state = 0;
+  ZERO(next_use);
+}
+
+// Read one block ahead of the print, up to HOTEND_STANDBY_SCAN bytes
+void HotendStandby::scan(const uint32_t pos) {
+  const uint32_t end = _MIN(card.getFileSize(), pos + (HOTEND_STANDBY_SCAN));
+  if (scan_pos >= end) return;
+
+  uint8_t buf[512];
+  const int16_t n = card.job_read(scan_pos, buf, _MIN(uint32_t(sizeof(buf)), end - scan_pos));
+  if (n <= 0) return;
+
+  auto found = [](){
+    if (WITHIN(scan_tool, 0, HOTENDS - 1) && !next_use[scan_tool])
+      next_use[scan_tool] = _MAX(scan_line, 1UL);
+  };
+
+  LOOP_L_N(i, n) {
+    const char c = buf[i];
+    if (c == '\n' || c == '\r') {
+      if (scan_state == 1) found();
+      scan_state = 0;
+      scan_line = scan_pos + i + 1;
+    }
+    else if (scan_state == 0) {
+      if (c == 'T') { scan_state = 1; scan_tool = -1; }
+      else if (c != ' ' && c != '\t') scan_state = 2;
+    }
+    else if (scan_state == 1) {
+      if (NUMERIC(c))
+        scan_tool = (scan_tool < 0 ? 0 : scan_tool * 10) + (c - '0');
+      else {
+        found();
+        scan_state = 2;
+      }
+    }
+  }
+  scan_pos += n;
+}
+
+// Average the print's progress through the file over RATE_INTERVAL_MS periods
+void HotendStandby::update_rate(const millis_t ms, const uint32_t pos) {
+  static millis_t last_ms;
+  static uint32_t last_pos;
+  if (!card.isPrinting()) { last_ms = 0; return; }
+  if (!last_ms || pos < last_pos) { last_ms = ms; last_pos = pos; return; }
+  if (PENDING(ms, last_ms + RATE_INTERVAL_MS)) return;
+  const float rate = (pos - last_pos) * 1000.0f / (ms - last_ms);
+  bytes_per_sec = bytes_per_sec ? bytes_per_sec + (rate - bytes_per_sec) * 0.25f : rate;
+  last_ms = ms;
+  last_pos = pos;
+}
+
+// Seconds until the next T command for a nozzle, a lower bound if none is in
+// the scanned part, or -1 if that can't be told yet
+int32_t HotendStandby::seconds_to_use(const uint8_t e, const uint32_t pos) {
+  if (!bytes_per_sec) return -1;
+  if (next_use[e]) return (next_use[e] - pos) / bytes_per_sec;
+  const uint32_t end = _MIN(card.getFileSize(), pos + (HOTEND_STANDBY_SCAN));
+  return scan_pos >= end ? int32_t((scan_pos - pos) / bytes_per_sec) : -1;
+}
+
+void HotendStandby::task() {
+  if (!card.isFileOpen()) { if (scan_from || standby || bytes_per_sec) reset(); return; }
+
+  const uint32_t pos = card.getIndex();
+
+  // A T command went into the queue, or the print moved back. Scan again from here.
+  bool passed = pos < scan_from;
+  HOTEND_LOOP() if (next_use[e] && next_use[e] <= pos) { SBI(due, e); passed = true; }
+  if (passed) restart_scan(pos);
+
+  scan(pos);
+
+  static millis_t next_ms;
+  const millis_t ms = millis();
+  if (PENDING(ms, next_ms)) return;
+  next_ms = ms + 1000UL;
+
+  update_rate(ms, pos);
+  if (!card.isPrinting()) return;
+
+  HOTEND_LOOP() {
+    if (e == active_extruder) CBI(due, e);
+
+    const celsius_t target = thermalManager.degTargetHotend(e);
+    if (TEST(standby, e)) {
+      // G-code set a new temperature, so leave it alone
+      if (target != (HOTEND_STANDBY_TEMP)) { CBI(standby, e); continue; }
+
+      const int32_t s = seconds_to_use(e, pos);
+      const float reheat = (print_temp[e] - thermalManager.degHotend(e)) / (HOTEND_STANDBY_HEAT_RATE) + (HOTEND_STANDBY_MARGIN);
+      if (e == active_extruder || TEST(due, e) || (s >= 0 && s <= reheat)) {
+        thermalManager.setTargetHotend(print_temp[e], e);
+        CBI(standby, e);
+      }
+    }
+    else if (e != active_extruder && !TEST(due, e) && target > (HOTEND_STANDBY_TEMP)) {
+      const int32_t s = seconds_to_use(e, pos);
+      const float cycle = (target - (HOTEND_STANDBY_TEMP)) / (HOTEND_STANDBY_HEAT_RATE) + (HOTEND_STANDBY_MARGIN) + (HOTEND_STANDBY_MIN_IDLE);
+      if (s >= 0 && s > cycle) {
+        print_temp[e] = target;
+        thermalManager.setTargetHotend(HOTEND_STANDBY_TEMP, e);
+        SBI(standby, e);
+      }
+    }
+  }
+}
+
+#endif // HOTEND_STANDBY_LOOKAHEAD
@@ -0,0 +1,50 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * hotend_standby.h - Standby temperatures for idle nozzles, timed by reading ahead
+ */
+
+#include "../inc/MarlinConfig.h"
+
+class HotendStandby {
+public:
+  static void task();   // Called from idle()
+
+private:
+  static uint32_t scan_from,              // Print position where the current scan began
+                  scan_pos,               // Next file offset to scan
+                  next_use[HOTENDS];      // Offset of each nozzle's next T command, or 0 if not found
+  static celsius_t print_temp[HOTENDS];   // Temperature to restore for a nozzle in standby
+  static float bytes_per_sec;             // Measured rate of the print through the file
+  static uint8_t standby,                 // Bits of the nozzles in standby
+                 due;                     // Bits of the nozzles whose T command has been read
+
+  static void reset();
+  static void restart_scan(const uint32_t pos);
+  static void scan(const uint32_t pos);
+  static void update_rate(const millis_t ms, const uint32_t pos);
+  static int32_t seconds_to_use(const uint8_t e, const uint32_t pos);
+};
+
+extern HotendStandby hotend_standby;
@@ -0,0 +1,121 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(IDLE_SCHEDULER)
+
+#include "idle_tasks.h"
+
+IdleScheduler idle_scheduler;
+
+IdleScheduler::task_t IdleScheduler::tasks[IDLE_TASKS_MAX];
+uint8_t IdleScheduler::count; // = 0
+
+bool IdleScheduler::add(const taskFunc_t func, PGM_P const name, const uint16_t period_ms, const uint16_t deadline_ms, const uint8_t priority) {
+  if (count >= IDLE_TASKS_MAX) return false;
+  task_t &t = tasks[count++];
+  memset(&t, 0, sizeof(t));
+  t.func = func;
+  t.name = name;
+  t.period_ms = period_ms;
+  t.deadline_ms = deadline_ms;
+  t.priority = priority;
+  t.due_ms = millis();
+  return true;
+}
+
+void IdleScheduler::run() {
+  const millis_t ms = millis();
+
+  // Earliest deadline first among the due tasks
+  task_t *next = nullptr;
+  millis_t next_deadline = 0;
+  LOOP_L_N(i, count) {
+    task_t &t = tasks[i];
+    if (PENDING(ms, t.due_ms)) continue;
+    const millis_t deadline = t.due_ms + t.deadline_ms;
+    if (!next || PENDING(deadline, next_deadline) || (deadline == next_deadline && t.priority < next->priority)) {
+      next = &t;
+      next_deadline = deadline;
+    }
+  }
+  if (!next) return;
+
+  task_t &t = *next;
+
+  #if ENABLED(MARLIN_DEV_MODE)
+    const uint32_t late = ms - t.due_ms;
+    if (t.depth == 0) {
+      NOLESS(t.late_ms, late);
+      if (late > t.deadline_ms) t.missed++;
+    }
+  #endif
+
+  // Set the next due time first so a re-entrant idle() only runs the task again once it's due
+  t.due_ms = ms + t.period_ms;
+
+  #if ENABLED(MARLIN_DEV_MODE)
+    const uint32_t start_us = micros();
+  #endif
+
+  t.depth++;
+  t.func();
+  t.depth--;
+
+  #if ENABLED(MARLIN_DEV_MODE)
+    // Only the outermost run is charged, which includes any nested ones
+    if (t.depth == 0) {
+      const uint32_t us = micros() - start_us;
+      t.runs++;
+      t.total_us += us;
+      NOLESS(t.peak_us, us);
+    }
+  #endif
+}
+
+#if ENABLED(MARLIN_DEV_MODE)
+
+  void IdleScheduler::report() {
+    SERIAL_ECHOLNPGM("Idle tasks, avg/max us, max late ms");
+    LOOP_L_N(i, count) {
+      const task_t &t = tasks[i];
+      SERIAL_ECHOPGM_P(t.name);
+      SERIAL_ECHOLNPGM(
+        " period:", t.period_ms, " runs:", t.runs,
+        " cost:", t.runs ? uint32_t(t.total_us / t.runs) : 0UL, "/", t.peak_us,
+        " late:", t.late_ms, " missed:", t.missed
+      );
+    }
+  }
+
+  void IdleScheduler::reset() {
+    LOOP_L_N(i, count) {
+      task_t &t = tasks[i];
+      t.runs = t.missed = t.peak_us = t.late_ms = 0;
+      t.total_us = 0;
+    }
+  }
+
+#endif
+
+#endif // IDLE_SCHEDULER
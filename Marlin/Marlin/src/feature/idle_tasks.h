@@ -0,0 +1,70 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * idle_tasks.h - Deadline scheduler for the periodic idle() tasks (D205)
+ *
+ * A task comes due every period_ms and should run within deadline_ms after.
+ * Each idle() call runs one due task, the one whose deadline comes first, so
+ * a task that waited long enough is never starved by a period 0 task.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#define IDLE_TASKS_MAX 12
+
+class IdleScheduler {
+public:
+  typedef void (*taskFunc_t)();
+
+  // Register a task at startup. On a tie the lower priority value runs first.
+  static bool add(const taskFunc_t func, PGM_P const name, const uint16_t period_ms, const uint16_t deadline_ms, const uint8_t priority);
+
+  // Run the due task with the earliest deadline, if any
+  static void run();
+
+  #if ENABLED(MARLIN_DEV_MODE)
+    static void report();
+    static void reset();
+  #endif
+
+private:
+  typedef struct {
+    taskFunc_t func;
+    PGM_P name;
+    uint16_t period_ms, deadline_ms;
+    uint8_t priority,
+            depth;                  // > 1 while a blocking loop in the task runs idle()
+    millis_t due_ms;
+    #if ENABLED(MARLIN_DEV_MODE)
+      uint32_t runs, missed,        // Runs, and runs past the deadline
+               peak_us, late_ms;    // Longest run, and longest wait past due
+      uint64_t total_us;
+    #endif
+  } task_t;
+
+  static task_t tasks[IDLE_TASKS_MAX];
+  static uint8_t count;
+};
+
+extern IdleScheduler idle_scheduler;
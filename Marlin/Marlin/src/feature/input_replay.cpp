@@ -0,0 +1,321 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(INPUT_REPLAY)
+
+#include "input_replay.h"
+#include "../MarlinCore.h"
+#include "../sd/cardreader.h"
+#include "../gcode/queue.h"
+#include "../module/planner.h"
+#include "../module/printcounter.h"
+
+#define REPLAY_FILE "INPUT.REC"
+#define RING_MASK (INPUT_REPLAY_BUFFER - 1)
+#define RECORD_HEADER 6
+
+static SdFile replay_file;
+static constexpr char replay_magic[5] = { 'I', 'R', 'E', 'C', 1 };
+
+InputReplay input_replay;
+
+volatile InputReplay::State InputReplay::state; // = IDLE
+millis_t InputReplay::start_ms, InputReplay::stop_ms;
+bool InputReplay::played;
+
+bool InputReplay::touched;
+int16_t InputReplay::touch_x, InputReplay::touch_y;
+
+uint8_t InputReplay::ring[INPUT_REPLAY_BUFFER];
+uint16_t InputReplay::head, InputReplay::tail, InputReplay::open_len;
+millis_t InputReplay::open_ms, InputReplay::write_ms;
+uint32_t InputReplay::records, InputReplay::dropped;
+uint8_t InputReplay::open_port;
+bool InputReplay::open;
+
+InputReplay::record_t InputReplay::rec;
+uint8_t InputReplay::rec_pos;
+bool InputReplay::rec_loaded, InputReplay::rec_due;
+millis_t InputReplay::late_ms;
+uint8_t InputReplay::saved_debug_flags;
+
+InputReplay::sd_read_t InputReplay::sd_due[8];
+uint8_t InputReplay::sd_next;
+
+InputReplay::dry_t InputReplay::planner_dry, InputReplay::queue_dry;
+
+void InputReplay::dry_t::update(const bool dry, const millis_t ms) {
+  if (dry == on) return;
+  on = dry;
+  if (dry) { count++; since = ms; }
+  else NOLESS(longest, ms - since);
+}
+
+static uint16_t ring_used(const uint16_t head, const uint16_t tail) { return (head - tail) & RING_MASK; }
+
+static bool open_replay_file(const uint8_t oflag) {
+  if (!card.isMounted()) { SERIAL_ECHOLNPGM("No media"); return false; }
+  SdFile root = card.getroot();
+  if (replay_file.open(&root, REPLAY_FILE, oflag)) return true;
+  SERIAL_ECHOLNPGM("Can't open " REPLAY_FILE);
+  return false;
+}
+
+//
+// Recording
+//
+
+void InputReplay::record() {
+  if (state != IDLE) stop();
+  if (!open_replay_file(O_CREAT | O_TRUNC | O_WRITE)) return;
+  replay_file.write(replay_magic, sizeof(replay_magic));
+  head = tail = 0;
+  open = false;
+  records = dropped = 0;
+  planner_dry = queue_dry = {};
+  played = false;
+  start_ms = write_ms = millis();
+  state = RECORDING;
+  SERIAL_ECHOLNPGM("Recording to " REPLAY_FILE);
+}
+
+// Copy to the ring. The caller checked for room.
+void InputReplay::put(const void * const data, const uint8_t len) {
+  const uint8_t *d = (const uint8_t*)data;
+  LOOP_L_N(i, len) { ring[head] = d[i]; head = (head + 1) & RING_MASK; }
+}
+
+bool InputReplay::begin_record(const uint8_t type, const uint8_t len) {
+  if (INPUT_REPLAY_BUFFER - 1 - ring_used(head, tail) < RECORD_HEADER + len) { dropped++; return false; }
+  const uint32_t ms = millis() - start_ms;
+  put(&ms, 4);
+  put(&type, 1);
+  put(&len, 1);
+  records++;
+  return true;
+}
+
+void InputReplay::add_serial(const uint8_t port, const uint8_t c) {
+  CRITICAL_SECTION_START();
+  const millis_t ms = millis() - start_ms;
+  if (open && port == open_port && ms == open_ms && ring[open_len] < 255 && ring_used(head, tail) < INPUT_REPLAY_BUFFER - 1) {
+    ring[open_len]++;                     // Another byte for the open record
+    put(&c, 1);
+  }
+  else if ((open = begin_record(REC_SERIAL + port, 1))) {
+    open_len = (head - 1) & RING_MASK;
+    open_port = port;
+    open_ms = ms;
+    put(&c, 1);
+  }
+  CRITICAL_SECTION_END();
+}
+
+bool InputReplay::touch(const bool is_touched, int16_t * const x, int16_t * const y) {
+  if (playing()) {
+    if (touched) { *x = touch_x; *y = touch_y; }
+    return touched;
+  }
+
+  if (recording() && (is_touched != touched || (is_touched && (*x != touch_x || *y != touch_y)))) {
+    CRITICAL_SECTION_START();
+    if (!is_touched)
+      begin_record(REC_RELEASE, 0);
+    else if (begin_record(REC_TOUCH, 4)) {
+      put(x, 2);
+      put(y, 2);
+    }
+    CRITICAL_SECTION_END();
+  }
+  touched = is_touched;
+  if (is_touched) { touch_x = *x; touch_y = *y; }
+  return is_touched;
+}
+
+void InputReplay::sd_read(const uint32_t pos, const uint32_t cycles) {
+  const uint32_t us = cycles / (F_CPU / 1000000UL);
+  if (recording()) {
+    if (us < INPUT_REPLAY_SD_US) return;
+    CRITICAL_SECTION_START();
+    if (begin_record(REC_SD_READ, 8)) {
+      put(&pos, 4);
+      put(&us, 4);
+    }
+    CRITICAL_SECTION_END();
+  }
+  else if (playing()) {
+    // Make a read that was slow in the recording as slow again
+    LOOP_L_N(i, COUNT(sd_due)) {
+      sd_read_t &r = sd_due[i];
+      if (r.us && r.pos == pos) {
+        if (r.us > us) DELAY_US(r.us - us);
+        r.us = 0;
+        break;
+      }
+    }
+  }
+}
+
+// Write the ring to the file, whole blocks unless all
+void InputReplay::write_ring(const bool all) {
+  CRITICAL_SECTION_START();
+  open = false;                           // The next byte begins a new record
+  const uint16_t end = head;
+  CRITICAL_SECTION_END();
+
+  uint16_t used = ring_used(end, tail);
+  if (!all && used < 512 && PENDING(millis(), write_ms + 1000UL)) return;
+  while (used) {
+    const uint16_t part = _MIN(used, uint16_t(INPUT_REPLAY_BUFFER - tail));
+    if (replay_file.write(&ring[tail], part) != int16_t(part)) {
+      SERIAL_ECHOLNPGM("Write to " REPLAY_FILE " failed");
+      replay_file.close();
+      state = IDLE;
+      return;
+    }
+    tail = (tail + part) & RING_MASK;
+    used -= part;
+  }
+  write_ms = millis();
+}
+
+//
+// Playback
+//
+
+void InputReplay::play() {
+  if (state != IDLE) stop();
+  if (!open_replay_file(O_READ)) return;
+  char magic[sizeof(replay_magic)];
+  if (replay_file.read(magic, sizeof(magic)) != int16_t(sizeof(magic)) || memcmp(magic, replay_magic, sizeof(magic))) {
+    SERIAL_ECHOLNPGM(REPLAY_FILE " is not a recording");
+    replay_file.close();
+    return;
+  }
+  rec_loaded = rec_due = false;
+  late_ms = 0;
+  records = 0;
+  ZERO(sd_due);
+  planner_dry = queue_dry = {};
+
+  // Plan the moves without heating or extruding
+  saved_debug_flags = marlin_debug_flags;
+  marlin_debug_flags |= MARLIN_DEBUG_DRYRUN;
+
+  played = true;
+  touched = false;
+  start_ms = millis();
+  state = PLAYING;
+  SERIAL_ECHOLNPGM("Playing " REPLAY_FILE);
+}
+
+bool InputReplay::load_record() {
+  uint8_t h[RECORD_HEADER];
+  if (replay_file.read(h, RECORD_HEADER) != RECORD_HEADER) return false;
+  memcpy(&rec.ms, h, 4);
+  rec.type = h[4];
+  rec.len = h[5];
+  if (rec.len && replay_file.read(rec.data, rec.len) != rec.len) return false;
+  rec_pos = 0;
+  rec_loaded = true;
+  rec_due = false;
+  return true;
+}
+
+// Apply the records that are due, up to a serial record not yet read
+void InputReplay::service() {
+  const millis_t now = millis() - start_ms;
+  for (;;) {
+    if (!rec_loaded && !load_record()) { stop(); return; }
+    if (now < rec.ms) return;
+    if (!rec_due) {
+      rec_due = true;
+      records++;
+      NOLESS(late_ms, now - rec.ms);
+    }
+    if (rec.type < REC_TOUCH) {
+      if (rec_pos < rec.len) return;      // The queue reads it
+    }
+    else if (rec.type == REC_TOUCH) {
+      memcpy(&touch_x, &rec.data[0], 2);
+      memcpy(&touch_y, &rec.data[2], 2);
+      touched = true;
+    }
+    else if (rec.type == REC_RELEASE)
+      touched = false;
+    else if (rec.type == REC_SD_READ) {
+      sd_read_t &r = sd_due[sd_next];
+      sd_next = (sd_next + 1) % COUNT(sd_due);
+      memcpy(&r.pos, &rec.data[0], 4);
+      memcpy(&r.us, &rec.data[4], 4);
+    }
+    rec_loaded = false;
+  }
+}
+
+int InputReplay::available(const uint8_t port) {
+  if (!playing()) return 0;
+  if (rec_loaded && rec_due && rec_pos >= rec.len) service();
+  return rec_loaded && rec_due && rec.type == REC_SERIAL + port ? rec.len - rec_pos : 0;
+}
+
+//
+// Both
+//
+
+void InputReplay::task() {
+  if (state == IDLE) return;
+
+  const millis_t ms = millis();
+  if (print_job_timer.isRunning() && !wait_for_heatup) {
+    planner_dry.update(!planner.movesplanned(), ms);
+    queue_dry.update(!queue.has_commands_queued(), ms);
+  }
+
+  if (recording()) write_ring(false); else service();
+}
+
+void InputReplay::stop() {
+  const State was = state;
+  if (was == IDLE) return;
+  if (was == RECORDING) write_ring(true);
+  state = IDLE;
+  replay_file.close();
+  if (was == PLAYING) marlin_debug_flags = saved_debug_flags;
+  const millis_t ms = stop_ms = millis();
+  planner_dry.update(false, ms);
+  queue_dry.update(false, ms);
+  report();
+}
+
+void InputReplay::report() {
+  SERIAL_ECHOPGM("Input ", played ? F("playback") : F("recording"), state == IDLE ? F(" stopped") : F(""));
+  SERIAL_ECHOLNPGM(" at ", ((state == IDLE ? stop_ms : millis()) - start_ms) / 1000UL, "s, ", records, " records");
+  if (played) SERIAL_ECHOLNPGM("Latest record ", late_ms, "ms late");
+  else SERIAL_ECHOLNPGM(dropped, " dropped, ", ring_used(head, tail), " bytes waiting");
+  SERIAL_ECHOLNPGM("Planner ran dry ", planner_dry.count, " times, longest ", planner_dry.longest, "ms");
+  SERIAL_ECHOLNPGM("Command queue ran dry ", queue_dry.count, " times, longest ", queue_dry.longest, "ms");
+}
+
+#endif // INPUT_REPLAY
@@ -0,0 +1,128 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * input_replay.h - Record the input of a session to the media and play it back (D212)
+ *
+ * Recording keeps each serial read, touch point change and slow SD block read
+ * with its time in a RAM ring, and idle() writes the ring to INPUT.REC. Playback
+ * feeds the file to the serial ports and touch screen at the recorded times, and
+ * makes SD block reads at least as slow as they were. Both count how often the
+ * planner and the command queue ran dry during the print, to compare the two.
+ *
+ * Each record is the time (ms, 4 bytes), a type, a length, and the data:
+ *   REC_SERIAL + port  The bytes read from the port within one ms
+ *   REC_TOUCH          x, y (2 + 2 bytes) of a new touch point
+ *   REC_RELEASE        The touch screen let go
+ *   REC_SD_READ        File position and duration (µs) of a block read (4 + 4 bytes)
+ */
+
+#include "../inc/MarlinConfig.h"
+#include "../HAL/shared/Delay.h"
+
+class InputReplay {
+public:
+  enum State : uint8_t { IDLE, RECORDING, PLAYING };
+  static volatile State state;
+
+  static bool recording() { return state == RECORDING; }
+  static bool playing() { return state == PLAYING; }
+
+  static void record();   // Record to INPUT.REC
+  static void play();     // Play INPUT.REC back
+  static void stop();     // Stop and report
+  static void task();     // Called by idle()
+  static void report();
+
+  // Called by GCodeQueue for each byte read from a serial port
+  static void serial_byte(const uint8_t port, const uint8_t c) { if (recording()) add_serial(port, c); }
+
+  // Take the place of the serial ports during playback
+  static int available(const uint8_t port);
+  static int read(const uint8_t port) { return available(port) ? rec.data[rec_pos++] : -1; }
+
+  // Called by Touch::get_point. Record the point, or replace it during playback.
+  static bool touch(const bool is_touched, int16_t * const x, int16_t * const y);
+
+  // Time a CardReader::get() that begins a block
+  class SDScope {
+  public:
+    SDScope(const uint32_t pos) : pos(pos), start(state != IDLE && !(pos & 0x1FF) ? get_cycle_count() | 1 : 0) {}
+    ~SDScope() { if (start) sd_read(pos, get_cycle_count() - start); }
+  private:
+    const uint32_t pos, start;            // start is 0 when not timed, so a timed start is made odd
+  };
+
+  enum : uint8_t { REC_SERIAL = 0x00, REC_TOUCH = 0x10, REC_RELEASE, REC_SD_READ };
+
+private:
+  static millis_t start_ms, stop_ms;
+  static bool played;                     // The last session was a playback
+
+  // The touch screen state, recorded or played
+  static bool touched;
+  static int16_t touch_x, touch_y;
+
+  // Recording
+  static uint8_t ring[INPUT_REPLAY_BUFFER];
+  static uint16_t head, tail, open_len;   // open_len: index of the length of a serial record still taking bytes
+  static millis_t open_ms, write_ms;
+  static uint32_t records, dropped;
+  static uint8_t open_port;
+  static bool open;
+
+  // Playback
+  typedef struct {
+    uint32_t ms;
+    uint8_t type, len;
+    uint8_t data[255];
+  } record_t;
+  static record_t rec;                    // Serial record being read, or the next one due
+  static uint8_t rec_pos;                 // Bytes of it read
+  static bool rec_loaded, rec_due;
+  static millis_t late_ms;                // Most a record came after its time
+  static uint8_t saved_debug_flags;
+
+  // Stalls of the print, in both modes
+  typedef struct {
+    bool on;
+    uint16_t count;
+    millis_t since, longest;
+    void update(const bool dry, const millis_t ms);
+  } dry_t;
+  static dry_t planner_dry, queue_dry;
+
+  typedef struct { uint32_t pos, us; } sd_read_t;
+  static sd_read_t sd_due[8];             // Recorded SD reads not yet repeated
+  static uint8_t sd_next;
+
+  static void add_serial(const uint8_t port, const uint8_t c);
+  static bool begin_record(const uint8_t type, const uint8_t len);
+  static void put(const void * const data, const uint8_t len);
+  static void write_ring(const bool all);
+  static bool load_record();
+  static void service();
+  static void sd_read(const uint32_t pos, const uint32_t cycles);
+};
+
+extern InputReplay input_replay;
@@ -0,0 +1,480 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * job_cache.cpp - Compile a G-code file to command records, and print from them
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(SD_JOB_COMPILE)
+
+#include "job_cache.h"
+#include "../gcode/queue.h"
+#include "../sd/cardreader.h"
+
+JobCache job_cache;
+
+//
+// A compiled file is a header, the records, then the index. Each record is
+// a type, the G-code bytes from its command to the next command (so the
+// comments in between are never read), and then:
+//  - Text:  The line with its terminator. The type is GCB_TEXT + its length - 1.
+//  - Token: Letter, codenum, [subcode], codebits, [valbits], the values, [N].
+//  - Gap:   Nothing. Type 0 covers more comment bytes than one length can.
+//
+#define GCB_TEXT        0x80
+#define GCB_TOKEN       0x01
+#define GCB_ALL_VALUES  0x02  // Every parameter has a value, so valbits is left out
+#define GCB_SUBCODE     0x04
+#define GCB_LINE        0x08
+
+#define GCB_VERSION 1
+#define GCB_TAGS (TERN0(MOTION_PROFILES, _BV(0)) | TERN0(LAYER_COMMENTS, _BV(1))) // The comments compiled to commands
+
+typedef struct {
+  char magic[4];                    // "GCB1", or "GCB0" until the compile is done
+  uint8_t version, tags;
+  uint16_t layers;                  // Layer starts (M230) in the records
+  uint32_t src_size, src_cluster;   // The G-code file that was compiled
+  uint16_t src_date, src_time;
+  uint32_t index_offset,            // File position of the index, after the records
+           commands;
+  uint16_t index_count, objects;    // Index entries, and 1 + the highest M486 S object
+} gcb_header_t;
+
+typedef struct {
+  uint32_t sdpos, offset;           // Where a record starts in the G-code and in the compiled file
+  int16_t layer, object;            // The layer and object there, or -1
+} gcb_index_t;
+
+static_assert(sizeof(gcb_header_t) == 32, "gcb_header_t must be 32 bytes.");
+static_assert(sizeof(gcb_index_t) == 12, "gcb_index_t must be 12 bytes.");
+
+// The biggest record, a token with every value and a line number, or the longest text
+constexpr uint8_t gcb_record_max = _MAX(3 + 1 + 2 + 1 + 4 + 4 + 4 * (GCODE_TOKEN_PARAMS) + 4, 3 + (MAX_CMD_SIZE));
+static_assert(gcb_record_max <= 128 + 3, "A compiled record must fit in 131 bytes.");
+
+SdFile JobCache::gcb;
+bool JobCache::playing, JobCache::compiling; // = false
+uint32_t JobCache::play_sdpos, JobCache::play_pos, JobCache::records_end;
+uint16_t JobCache::index_count, JobCache::play_len, JobCache::play_r;
+uint8_t JobCache::play_buf[256];
+
+#if ENABLED(SD_JOB_COMPILE_AUTO)
+  SdFile JobCache::print_dir;
+  bool JobCache::print_dir_valid; // = false
+#endif
+
+// Make "NAME.GCB" from the DOS name of a G-code file. A .GCB file has no compiled file.
+static bool gcb_name(char * const name) {
+  char *ext = strchr(name, '.');
+  if (ext) {
+    if (!strcmp_P(ext, PSTR(".GCB"))) return false;
+  }
+  else
+    ext = name + strlen(name);
+  strcpy_P(ext, PSTR(".GCB"));
+  return true;
+}
+
+static uint32_t first_cluster(const dir_t &d) { return uint32_t(d.firstClusterHigh) << 16 | d.firstClusterLow; }
+
+// The bytes of a record, from its type and the fields that follow
+static uint8_t record_size(const uint8_t * const r) {
+  const uint8_t type = r[0];
+  if (type & GCB_TEXT) return 4 + (type & 0x7F);
+  if (!type) return 3;
+  const uint8_t * const bits = r + 6 + ((type & GCB_SUBCODE) ? 1 : 0);
+  uint32_t valbits;
+  memcpy(&valbits, (type & GCB_ALL_VALUES) ? bits : bits + 4, sizeof(valbits));
+  return (bits - r) + ((type & GCB_ALL_VALUES) ? 4 : 8) + 4 * __builtin_popcountl(valbits) + ((type & GCB_LINE) ? 4 : 0);
+}
+
+//
+// Compile
+//
+
+static SdFile src, out;                 // The G-code being compiled, and its compiled file
+static gcb_header_t header;             // Of the compiled file
+static gcb_index_t comp_index[SD_JOB_COMPILE_INDEX];
+static uint16_t index_stride, index_events, since_entry;
+static int16_t comp_layer, comp_object;
+
+static uint8_t in_state;                // Line reading, as for a print
+static int in_count;
+static char in_line[MAX_CMD_SIZE];
+static uint32_t line_start,             // G-code position of the line being read
+                out_sdpos;              // G-code position reached by the records, or the start of the pending one
+
+static uint8_t rec[gcb_record_max], rec_len;  // The last record, written when the next command starts
+static uint8_t out_buf[512];
+static uint16_t out_len;
+static uint32_t out_offset;             // Compiled file position of out_buf
+static bool out_ok;
+
+static void flush_out() {
+  if (out_len && out.write(out_buf, out_len) != int16_t(out_len)) out_ok = false;
+  out_offset += out_len;
+  out_len = 0;
+}
+
+static void put(const void * const data, uint16_t n) {
+  const uint8_t *p = (const uint8_t*)data;
+  while (n--) {
+    out_buf[out_len++] = *p++;
+    if (out_len == sizeof(out_buf)) flush_out();
+  }
+}
+
+// Give the pending record its length up to 'pos', write it, and cover the rest with gaps
+static void advance_to(const uint32_t pos) {
+  uint32_t gap = pos - out_sdpos;
+  while (rec_len || gap) {
+    const uint16_t len = _MIN(gap, uint32_t(UINT16_MAX));
+    if (!rec_len) { rec[0] = 0; rec_len = 3; }
+    rec[1] = len & 0xFF;
+    rec[2] = len >> 8;
+    put(rec, rec_len);
+    rec_len = 0;
+    gap -= len;
+    out_sdpos += len;
+  }
+}
+
+// Index a layer or object start, or a command far from the last entry, so
+// any position is a short skip from an entry. When full keep every other.
+static void index_command(const uint32_t sdpos) {
+  since_entry = 0;
+  if (index_events++ % index_stride) return;
+  if (header.index_count == SD_JOB_COMPILE_INDEX) {
+    LOOP_L_N(i, SD_JOB_COMPILE_INDEX / 2) comp_index[i] = comp_index[i * 2];
+    header.index_count = SD_JOB_COMPILE_INDEX / 2;
+    index_stride *= 2;
+    if ((index_events - 1) % index_stride) return;
+  }
+  comp_index[header.index_count++] = { sdpos, out_offset + out_len, comp_layer, comp_object };
+}
+
+static void add_command(char * const line, const uint32_t sdpos) {
+  advance_to(sdpos);
+
+  bool mark = ++since_entry >= 1000;
+  if (!strncmp_P(line, PSTR("M230 L"), 6)) {
+    comp_layer = line[6] ? atoi(&line[6]) : comp_layer + 1;
+    header.layers++;
+    mark = true;
+  }
+  else if (!strncmp_P(line, PSTR("M486 S"), 6)) {
+    comp_object = atoi(&line[6]);
+    if (comp_object >= 0) NOLESS(header.objects, uint16_t(comp_object + 1));
+    mark = true;
+  }
+  if (mark) index_command(sdpos);
+
+  uint8_t *p = rec + 3;
+  GCodeParser::token_t t;
+  if (GCodeParser::tokenize(line, t)) {
+    uint8_t type = GCB_TOKEN;
+    *p++ = t.letter;
+    *p++ = t.codenum & 0xFF;
+    *p++ = t.codenum >> 8;
+    #if USE_GCODE_SUBCODES
+      if (t.subcode) { type |= GCB_SUBCODE; *p++ = t.subcode; }
+    #endif
+    memcpy(p, &t.codebits, 4); p += 4;
+    if (t.valbits == t.codebits)
+      type |= GCB_ALL_VALUES;
+    else {
+      memcpy(p, &t.valbits, 4); p += 4;
+    }
+    const uint8_t n = __builtin_popcountl(t.valbits) * sizeof(float);
+    memcpy(p, t.value, n); p += n;
+    #if ENABLED(ADVANCED_OK)
+      if (t.line_number >= 0) { type |= GCB_LINE; memcpy(p, &t.line_number, 4); p += 4; }
+    #endif
+    rec[0] = type;
+  }
+  else {
+    const uint8_t n = strlen(line) + 1;
+    rec[0] = GCB_TEXT | (n - 1);
+    memcpy(p, line, n); p += n;
+  }
+  rec_len = p - rec;
+  header.commands++;
+}
+
+bool JobCache::compile(SdFile * const dir, const char * const fname) {
+  // The compiled file being printed could be the one to write
+  if (compiling || playing) { SERIAL_ECHO_MSG("Job cache busy."); return false; }
+
+  char name[13];
+  dir_t d;
+  if (!src.open(dir, fname, O_READ) || !src.getDosName(name) || !src.dirEntry(&d)) {
+    src.close();
+    SERIAL_ECHO_MSG(STR_SD_OPEN_FILE_FAIL, fname, ".");
+    return false;
+  }
+  if (!gcb_name(name)) {
+    src.close();
+    SERIAL_ECHO_MSG("A .GCB file is already compiled.");
+    return false;
+  }
+
+  header = {};
+  memcpy(header.magic, "GCB0", 4);
+  header.version = GCB_VERSION;
+  header.tags = GCB_TAGS;
+  header.src_size = d.fileSize;
+  header.src_cluster = first_cluster(d);
+  header.src_date = d.lastWriteDate;
+  header.src_time = d.lastWriteTime;
+
+  out_ok = out.open(dir, name, O_CREAT | O_WRITE | O_TRUNC) && out.write(&header, sizeof(header)) == int16_t(sizeof(header));
+  if (!out_ok) {
+    out.close();
+    src.close();
+    SERIAL_ECHO_MSG(STR_SD_OPEN_FILE_FAIL, name, ".");
+    return false;
+  }
+
+  out_len = 0;
+  out_offset = sizeof(header);
+  out_sdpos = line_start = 0;
+  rec_len = 0;
+  in_state = 0;
+  in_count = 0;
+  comp_layer = comp_object = -1;
+  index_stride = 1;
+  index_events = since_entry = 0;
+  compiling = true;
+  SERIAL_ECHO_MSG("Compiling ", fname, " to ", name);
+  return true;
+}
+
+// Read and compile up to 512 bytes of G-code every few ms
+void JobCache::task() {
+  if (!compiling) return;
+  if (!card.isMounted()) return abort();
+  if (TERN0(HAS_SD_HOST_DRIVE, card.host_is_writing())) return;
+
+  static millis_t next_ms; // = 0
+  const millis_t ms = millis();
+  if (PENDING(ms, next_ms)) return;
+  next_ms = ms + 5;
+
+  uint8_t in[128];
+  LOOP_L_N(r, 512 / sizeof(in)) {
+    const uint32_t pos = src.curPosition();
+    const int16_t n = src.read(in, sizeof(in));
+    if (n < 0) return abort();
+    if (n == 0) {
+      // The last line may have no line ending
+      if (GCodeQueue::file_line_char('\n', in_state, in_line, in_count)) add_command(in_line, line_start);
+      return finish();
+    }
+    LOOP_L_N(i, n) {
+      const char c = in[i];
+      if (GCodeQueue::file_line_char(c, in_state, in_line, in_count)) add_command(in_line, line_start);
+      if (ISEOL(c)) line_start = pos + i + 1;
+    }
+  }
+  if (!out_ok) abort();
+}
+
+void JobCache::finish() {
+  advance_to(src.fileSize());
+  flush_out();
+  header.index_offset = out_offset;
+  put(comp_index, header.index_count * sizeof(gcb_index_t));
+  flush_out();
+  memcpy(header.magic, "GCB1", 4);
+  if (!out_ok || !out.seekSet(0) || out.write(&header, sizeof(header)) != int16_t(sizeof(header)) || !out.close())
+    return abort();
+
+  src.close();
+  compiling = false;
+  SERIAL_ECHO_MSG("Compiled ", header.commands, " commands, ", header.layers, " layers, ", header.objects, " objects.");
+}
+
+void JobCache::abort() {
+  out.remove();
+  src.close();
+  compiling = false;
+  SERIAL_ECHO_MSG("Compile failed.");
+}
+
+void JobCache::report() {
+  if (compiling)
+    SERIAL_ECHO_MSG("Compiling ", src.curPosition() / (src.fileSize() / 100 + 1), "%, ", header.commands, " commands");
+  else
+    SERIAL_ECHO_MSG("Not compiling.");
+  if (playing) SERIAL_ECHO_MSG("Printing from the compiled file.");
+}
+
+#if ENABLED(SD_JOB_COMPILE_AUTO)
+
+  void JobCache::print_done(SdFile &gcode) {
+    char name[13];
+    if (!playing && !compiling && print_dir_valid && gcode.getDosName(name)) compile(&print_dir, name);
+  }
+
+#endif
+
+//
+// Print
+//
+
+bool JobCache::open(SdFile * const dir, SdFile &gcode) {
+  close();
+  #if ENABLED(SD_JOB_COMPILE_AUTO)
+    print_dir = *dir;
+    print_dir_valid = true;
+  #endif
+
+  char name[13];
+  dir_t d;
+  if (!gcode.getDosName(name) || !gcb_name(name) || !gcode.dirEntry(&d) || !gcb.open(dir, name, O_READ)) return false;
+
+  // Only a finished compile of this version of the G-code
+  gcb_header_t h;
+  if (gcb.read(&h, sizeof(h)) != int16_t(sizeof(h))
+    || memcmp(h.magic, "GCB1", 4) || h.version != GCB_VERSION || h.tags != GCB_TAGS
+    || h.src_size != d.fileSize || h.src_cluster != first_cluster(d)
+    || h.src_date != d.lastWriteDate || h.src_time != d.lastWriteTime
+  ) {
+    gcb.close();
+    return false;
+  }
+
+  records_end = h.index_offset;
+  index_count = h.index_count;
+  play_sdpos = 0;
+  play_pos = sizeof(h);
+  play_len = play_r = 0;
+  playing = true;
+  SERIAL_ECHO_MSG("Printing from ", name);
+  return true;
+}
+
+// Keep at least a whole record in play_buf, up to the end of the records
+bool JobCache::fill() {
+  const uint16_t left = play_len - play_r;
+  if (left >= gcb_record_max || play_pos >= records_end) return true;
+  memmove(play_buf, &play_buf[play_r], left);
+  play_len = left;
+  play_r = 0;
+  const uint16_t n = _MIN(uint32_t(sizeof(play_buf) - left), records_end - play_pos);
+  if (gcb.read(&play_buf[left], n) != int16_t(n)) return false;
+  play_len += n;
+  play_pos += n;
+  return true;
+}
+
+// Go to the first record at or after a G-code position, from the index entry before it
+bool JobCache::seek(const uint32_t index) {
+  gcb_index_t e = { 0, sizeof(gcb_header_t), -1, -1 };
+  if (!gcb.seekSet(records_end)) return false;
+  LOOP_L_N(i, index_count) {
+    gcb_index_t f;
+    if (gcb.read(&f, sizeof(f)) != int16_t(sizeof(f))) return false;
+    if (f.sdpos > index) break;
+    e = f;
+  }
+
+  // Skip ahead from here if that's closer
+  if (index > play_sdpos && e.sdpos <= play_sdpos) {
+    if (!gcb.seekSet(play_pos)) return false;
+  }
+  else {
+    if (!gcb.seekSet(e.offset)) return false;
+    play_sdpos = e.sdpos;
+    play_pos = e.offset;
+    play_len = play_r = 0;
+  }
+
+  while (play_sdpos < index) {
+    if (!fill()) return false;
+    const uint16_t left = play_len - play_r;
+    if (!left) break;                             // Past the last command
+    const uint8_t * const r = &play_buf[play_r];
+    const uint8_t size = record_size(r);
+    if (size > left) return false;
+    play_r += size;
+    play_sdpos += r[1] | (r[2] << 8);
+  }
+  return true;
+}
+
+bool JobCache::next_command(compiled_command_t &c, const uint32_t index) {
+  // M26, M808, or recovery moved the G-code position
+  if (index != play_sdpos && !seek(index)) { close(); return false; }
+
+  for (;;) {
+    if (!fill()) { close(); return false; }
+    const uint16_t left = play_len - play_r;
+    if (!left) return false;                      // The end of the records
+
+    uint8_t * const r = &play_buf[play_r];
+    const uint8_t type = r[0], size = record_size(r);
+    if (size > left) { close(); return false; }
+    play_r += size;
+    c.sdpos = play_sdpos;
+    play_sdpos += r[1] | (r[2] << 8);
+    c.end = play_sdpos;
+    if (!type) continue;                          // A gap
+
+    if (type & GCB_TEXT) {
+      c.text = (char*)&r[3];
+      r[size - 1] = '\0';
+      return true;
+    }
+
+    GCodeParser::token_t &t = c.token;
+    const uint8_t *p = &r[3];
+    t.letter = *p++;
+    t.codenum = p[0] | (p[1] << 8);
+    p += 2;
+    #if USE_GCODE_SUBCODES
+      t.subcode = (type & GCB_SUBCODE) ? *p++ : 0;
+    #else
+      if (type & GCB_SUBCODE) { close(); return false; }
+    #endif
+    memcpy(&t.codebits, p, 4); p += 4;
+    if (type & GCB_ALL_VALUES)
+      t.valbits = t.codebits;
+    else {
+      memcpy(&t.valbits, p, 4); p += 4;
+    }
+    const uint8_t n = __builtin_popcountl(t.valbits);
+    if (n > GCODE_TOKEN_PARAMS) { close(); return false; }
+    memcpy(t.value, p, n * sizeof(float)); p += n * sizeof(float);
+    #if ENABLED(ADVANCED_OK)
+      t.line_number = -1;
+      if (type & GCB_LINE) memcpy(&t.line_number, p, 4);
+    #endif
+    c.text = nullptr;
+    return true;
+  }
+}
+
+#endif // SD_JOB_COMPILE
@@ -0,0 +1,89 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * job_cache.h - Compile a G-code file to command records, and print from them
+ *
+ * The records of PART.GCO go to PART.GCB in the same folder. Each one holds a
+ * command tokenized as the queue would tokenize it (or its text, for a command
+ * that stays text) and the number of G-code file bytes up to the next command,
+ * so comments are never read again. An index of layer and object starts, with
+ * the file positions of both files, finds any G-code position quickly.
+ *
+ * The G-code file stays the open print file, and its position follows the
+ * records, so M27, M26, M808 and power-loss recovery work as for the text.
+ */
+
+#include "../inc/MarlinConfig.h"
+#include "../gcode/parser.h"
+#include "../sd/SdFile.h"
+
+typedef struct {
+  char *text;                     // The command line, or nullptr for a token
+  GCodeParser::token_t token;     // The tokenized command
+  uint32_t sdpos, end;            // G-code file positions of the command and of the next one
+} compiled_command_t;
+
+class JobCache {
+public:
+  // Start compiling a file in the background. Return false if it can't be done now.
+  static bool compile(SdFile * const dir, const char * const fname);
+  static void task();
+  static void report();
+
+  // Print from the compiled file of a G-code file just opened, if it's up to date
+  static bool open(SdFile * const dir, SdFile &gcode);
+  static void close() { if (playing) { playing = false; gcb.close(); } }
+  static bool is_playing() { return playing; }
+
+  // The commands from the G-code file position 'index'. Return false at the end or on error.
+  static bool next_command(compiled_command_t &c, const uint32_t index);
+  static bool at_end() { return play_pos >= records_end && play_len == play_r; }
+
+  #if ENABLED(SD_JOB_COMPILE_AUTO)
+    // A print read the G-code file to the end. Compile it if it had no compiled file.
+    static void print_done(SdFile &gcode);
+  #endif
+
+private:
+  static SdFile gcb;              // The compiled file being printed
+  static bool playing, compiling;
+  static uint32_t play_sdpos,     // G-code position of the next record
+                  play_pos,       // Compiled file position after the bytes in play_buf
+                  records_end;    // Compiled file position of the index, after the records
+  static uint16_t index_count,    // Entries in the index
+                  play_len, play_r;
+  static uint8_t play_buf[256];   // Records read ahead
+
+  static bool fill();
+  static bool seek(const uint32_t index);
+  static void finish();
+  static void abort();
+
+  #if ENABLED(SD_JOB_COMPILE_AUTO)
+    static SdFile print_dir;      // Folder of the G-code file opened for print
+    static bool print_dir_valid;
+  #endif
+};
+
+extern JobCache job_cache;
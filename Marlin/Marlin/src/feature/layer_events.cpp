@@ -0,0 +1,118 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(LAYER_EVENTS)
+
+#include "layer_events.h"
+#include "../module/motion.h"
+#include "../module/printcounter.h"
+
+#if ENABLED(SDSUPPORT)
+  #include "../sd/cardreader.h"
+#endif
+
+#if ENABLED(POWER_LOSS_RECOVERY)
+  #include "powerloss.h"
+#endif
+
+// Never a move's Z, so the next move takes the slow path
+#define NO_MOVE_Z -9999.0f
+
+LayerEvents layer_events;
+
+layer_event_t LayerEvents::current = { -1, 0, 0 };
+float LayerEvents::move_z = NO_MOVE_Z;
+uint8_t LayerEvents::subscribers; // = 0
+layer_callback_t LayerEvents::callback[LAYER_EVENT_SUBSCRIBERS];
+
+#if ENABLED(LAYER_COMMENTS)
+  bool LayerEvents::from_comments, LayerEvents::comment_pending; // = false
+  int16_t LayerEvents::comment_layer; // = 0
+#endif
+
+bool LayerEvents::subscribe(const layer_callback_t cb) {
+  if (subscribers >= LAYER_EVENT_SUBSCRIBERS) return false;
+  callback[subscribers++] = cb;
+  return true;
+}
+
+void LayerEvents::z_changed() {
+  // Only an extruding move in XY begins a layer
+  if (destination.e <= current_position.e || (destination.x == current_position.x && destination.y == current_position.y))
+    return;
+
+  move_z = destination.z;
+
+  #if ENABLED(LAYER_COMMENTS)
+    if (from_comments) {
+      if (comment_pending) {
+        comment_pending = false;
+        publish(comment_layer);
+      }
+      return;
+    }
+  #endif
+
+  if (!print_job_timer.isRunning()) return;
+
+  // A lower Z is a new print, or a new object printed one at a time
+  if (move_z < current.z - 0.01f) current = { -1, 0, 0 };
+
+  if (move_z >= current.z + (LAYER_MIN_Z_CHANGE)) publish(current.layer + 1);
+}
+
+#if ENABLED(LAYER_COMMENTS)
+
+  void LayerEvents::comment(const int16_t layer) {
+    from_comments = comment_pending = true;
+    comment_layer = layer;
+    move_z = NO_MOVE_Z;
+  }
+
+#endif
+
+void LayerEvents::publish(const int16_t layer) {
+  current.layer = layer;
+  current.z = destination.z;
+  current.sdpos = 0;
+  #if ENABLED(SDSUPPORT)
+    if (IS_SD_PRINTING()) current.sdpos = TERN(POWER_LOSS_RECOVERY, recovery.command_sdpos(), card.getIndex());
+  #endif
+  LOOP_L_N(i, subscribers) callback[i](current);
+}
+
+// Called when a print is started from media
+void LayerEvents::reset() {
+  current = { -1, 0, 0 };
+  move_z = NO_MOVE_Z;
+  TERN_(LAYER_COMMENTS, from_comments = comment_pending = false);
+}
+
+void LayerEvents::report() {
+  SERIAL_ECHOPGM("Layer ", current.layer, " Z", current.z, " at ", current.sdpos);
+  TERN_(LAYER_COMMENTS, if (from_comments) SERIAL_ECHOPGM(" (comments)"));
+  SERIAL_EOL();
+}
+
+#endif // LAYER_EVENTS
@@ -0,0 +1,81 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * layer_events.h - Detect each layer change of a print once, for all features
+ *
+ * A layer begins with the first extruding move at least LAYER_MIN_Z_CHANGE
+ * above the last layer, so a Z hop during travel is not a layer change. With
+ * LAYER_COMMENTS the slicer's layer comments (queued as M230 L) mark the layers
+ * instead, and the event waits for the first extruding move after the comment.
+ *
+ * Either way subscribers are called before that move is planned, so G0/G1 pays
+ * one comparison per move however many features act on layers.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+extern xyze_pos_t destination;
+
+typedef struct {
+  int16_t layer;    // Layer number from 0, or the number in the slicer comment
+  float z;          // Z of the first extruding move
+  uint32_t sdpos;   // File position of that move, or 0 when not printing from media
+} layer_event_t;
+
+typedef void (*layer_callback_t)(const layer_event_t &e);
+
+class LayerEvents {
+public:
+  static layer_event_t current;   // The last published layer
+
+  static bool subscribe(const layer_callback_t cb);
+
+  // Called by G0/G1 before a move to destination is planned
+  static void check_move() {
+    if (destination.z != move_z) z_changed();
+  }
+
+  #if ENABLED(LAYER_COMMENTS)
+    static void comment(const int16_t layer);
+  #endif
+
+  static void reset();
+  static void report();
+
+private:
+  static float move_z;            // Z of the last extruding move
+  static uint8_t subscribers;
+  static layer_callback_t callback[LAYER_EVENT_SUBSCRIBERS];
+
+  #if ENABLED(LAYER_COMMENTS)
+    static bool from_comments,    // This print has layer comments
+                comment_pending;  // A comment is waiting for its first move
+    static int16_t comment_layer;
+  #endif
+
+  static void z_changed();
+  static void publish(const int16_t layer);
+};
+
+extern LayerEvents layer_events;
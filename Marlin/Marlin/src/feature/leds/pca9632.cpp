@@ -31,7 +31,10 @@
 
 #include "pca9632.h"
 #include "leds.h"
-#if ENABLED(PCA9632_SOFT_I2C)
+#if BOTH(PCA9632_SOFT_I2C, SOFT_I2C_ASYNC)
+#define PCA9632_ASYNC
+#include "../../libs/soft_i2c_async.h"
+#elif ENABLED(PCA9632_SOFT_I2C)
 #include <SlowSoftWire.h>
 SlowSoftWire Wire = SlowSoftWire(PCA9632_I2C_SDA, PCA9632_I2C_SCK, true);
 #else
@@ -92,11 +95,19 @@ SlowSoftWire Wire = SlowSoftWire(PCA9632_I2C_SDA, PCA9632_I2C_SCK, true);
 
 byte PCA_init = 0;
 
+static void PCA9632_Write(const byte addr, const uint8_t *data, const uint8_t len) {
+  #if ENABLED(PCA9632_ASYNC)
+    soft_i2c.write(PCA9632_I2C_SDA, PCA9632_I2C_SCK, addr, data, len);
+  #else
+    Wire.beginTransmission(I2C_ADDRESS(addr));
+    Wire.write(data, len);
+    Wire.endTransmission();
+  #endif
+}
+
 static void PCA9632_WriteRegister(const byte addr, const byte regadd, const byte value) {
-  Wire.beginTransmission(I2C_ADDRESS(addr));
-  Wire.write(regadd);
-  Wire.write(value);
-  Wire.endTransmission();
+  const uint8_t data[] = { regadd, value };
+  PCA9632_Write(addr, data, sizeof(data));
 }
 
 static void PCA9632_WriteAllRegisters(const byte addr, const byte regadd, const byte vr, const byte vg, const byte vb
@@ -108,9 +119,7 @@ static void PCA9632_WriteAllRegisters(const byte addr, const byte regadd, const
     data[1 + (PCA9632_RED >> 1)] = vr;
     data[1 + (PCA9632_GRN >> 1)] = vg;
     data[1 + (PCA9632_BLU >> 1)] = vb;
-    Wire.beginTransmission(I2C_ADDRESS(addr));
-    Wire.write(data, sizeof(data));
-    Wire.endTransmission();
+    PCA9632_Write(addr, data, sizeof(data));
   #else
     PCA9632_WriteRegister(addr, regadd + (PCA9632_RED >> 1), vr);
     PCA9632_WriteRegister(addr, regadd + (PCA9632_GRN >> 1), vg);
@@ -132,7 +141,7 @@ static void PCA9632_WriteAllRegisters(const byte addr, const byte regadd, const
 #endif
 
 void PCA9632_set_led_color(const LEDColor &color) {
-  Wire.begin();
+  IF_DISABLED(PCA9632_ASYNC, Wire.begin());
   if (!PCA_init) {
     PCA_init = 1;
     PCA9632_WriteRegister(PCA9632_ADDRESS,PCA9632_MODE1, PCA9632_MODE1_VALUE);
@@ -157,9 +166,10 @@ void PCA9632_set_led_color(const LEDColor &color) {
 
   void PCA9632_buzz(const long, const uint16_t) {
     uint8_t data[] = PCA9632_BUZZER_DATA;
-    Wire.beginTransmission(I2C_ADDRESS(PCA9632_ADDRESS));
-    Wire.write(data, sizeof(data));
-    Wire.endTransmission();
+    #if ENABLED(PCA9632_ASYNC)
+      static_assert(sizeof(data) < SOFT_I2C_ASYNC_MAX_BYTES, "PCA9632_BUZZER_DATA is too long for SOFT_I2C_ASYNC.");
+    #endif
+    PCA9632_Write(PCA9632_ADDRESS, data, sizeof(data));
   }
 
 #endif // PCA9632_BUZZER
@@ -0,0 +1,96 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(LINE_MERGE)
+
+#include "line_merge.h"
+#include "../module/motion.h"
+
+LineMerge line_merge;
+
+xyze_pos_t LineMerge::start;
+xy_pos_t LineMerge::point[LINE_MERGE_SEGMENTS];
+float LineMerge::xy_length, LineMerge::e_length;
+feedRate_t LineMerge::feedrate;
+uint8_t LineMerge::count; // = 0
+
+bool LineMerge::can_join(const_float_t len, const_float_t de) {
+  if (count >= LINE_MERGE_SEGMENTS || feedrate != feedrate_mm_s) return false;
+
+  // The same extrusion per mm of travel (also no E for travel moves)
+  if (ABS(de * xy_length - e_length * len) > (LINE_MERGE_E_TOLERANCE) * ABS(e_length) * len) return false;
+
+  // Every joined point must stay close to the new line, and between its ends
+  const xy_pos_t chord = xy_pos_t(destination) - xy_pos_t(start);
+  const float chord_sq = sq(chord.x) + sq(chord.y);
+  LOOP_L_N(i, count) {
+    const xy_pos_t v = point[i] - xy_pos_t(start);
+    const float dot = chord.x * v.x + chord.y * v.y;
+    if (dot <= 0 || dot >= chord_sq) return false;
+    if (sq(chord.x * v.y - chord.y * v.x) > sq(LINE_MERGE_DEVIATION) * chord_sq) return false;
+  }
+  return true;
+}
+
+bool LineMerge::add() {
+  const xy_pos_t d = xy_pos_t(destination) - xy_pos_t(current_position);
+  const float len = HYPOT(d.x, d.y), de = destination.e - current_position.e;
+
+  // Only moves in XY, with or without E, can join
+  bool plain = len > 0;
+  LOOP_S_L_N(a, Z_AXIS, LINEAR_AXES) if (destination[a] != current_position[a]) plain = false;
+  if (!plain) { flush(); return false; }
+
+  if (count && can_join(len, de)) {
+    xy_length += len;
+    e_length += de;
+  }
+  else {
+    flush();
+    start = current_position;
+    xy_length = len;
+    e_length = de;
+    feedrate = feedrate_mm_s;
+  }
+  point[count++] = destination;
+  current_position = destination;
+  return true;
+}
+
+void LineMerge::flush() {
+  if (!count) return;
+  count = 0;  // Planning may idle, which flushes again
+
+  // Plan from the start of the run to its end, where current_position already is
+  const xyze_pos_t old_destination = destination;
+  const feedRate_t old_feedrate = feedrate_mm_s;
+  destination = current_position;
+  current_position = start;
+  feedrate_mm_s = feedrate;
+  prepare_line_to_destination();
+  feedrate_mm_s = old_feedrate;
+  destination = old_destination;
+}
+
+#endif // LINE_MERGE
@@ -0,0 +1,57 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * line_merge.h - Join nearly collinear G0/G1 moves before they are planned
+ *
+ * The run being joined is held back from the planner. current_position is
+ * already at its end, so everything else must flush() it before it touches
+ * the planner: any other G-code, and idle() once the command queue is empty.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+class LineMerge {
+public:
+  // Take the move from current_position to destination into the run. False if it must be planned as is.
+  static bool add();
+
+  // Plan the held run
+  static void flush();
+
+  // Forget the held run, as when the planner queue is dropped
+  static void discard() { count = 0; }
+
+  static bool pending() { return count; }
+
+private:
+  static xyze_pos_t start;                      // Planned position where the run begins
+  static xy_pos_t point[LINE_MERGE_SEGMENTS];   // End of each joined move
+  static float xy_length, e_length;             // Totals of the run
+  static feedRate_t feedrate;
+  static uint8_t count;                         // Moves in the run
+
+  static bool can_join(const_float_t len, const_float_t de);
+};
+
+extern LineMerge line_merge;
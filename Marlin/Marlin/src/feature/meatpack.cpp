@@ -57,6 +57,13 @@ uint8_t meatPackLookupTable[16] = {
   '\0' // Unused. 0b1111 indicates a literal character
 };
 
+#if ENABLED(MEATPACK_DICTIONARY)
+  // Used until the host loads its own dictionary
+  static const char default_dictionary[] PROGMEM =
+    "G1 X\0" " Y\0" " Z\0" " E\0" " F\0" "G0 X\0" "G1 F\0" "G1 E\0" "G1 Z\0"
+    "G92 E0\0" "M106 S\0" "M204 S\0" "\0";
+#endif
+
 #if ENABLED(MP_DEBUG)
   uint8_t chars_decoded = 0;  // Log the first 64 bytes after each reset
 #endif
@@ -66,9 +73,100 @@ void MeatPack::reset_state() {
   cmd_is_next = false;
   second_char = 0;
   cmd_count = full_char_count = char_out_count = 0;
+  #if ENABLED(MEATPACK_DICTIONARY)
+    dict_entries = dict_loading = delta_axis = 0;
+    ZERO(last);
+  #endif
   TERN_(MP_DEBUG, chars_decoded = 0);
 }
 
+#if ENABLED(MEATPACK_DICTIONARY)
+
+  void MeatPack::load_default_dictionary() {
+    dict_entries = 0;
+    dict_start[0] = 0;
+    for (uint8_t i = 0; ; ++i) {
+      const char c = pgm_read_byte(&default_dictionary[i]);
+      dict[i] = c;
+      if (c) continue;
+      if (i == dict_start[dict_entries]) break;           // An empty entry ends the dictionary
+      dict_start[++dict_entries] = i + 1;
+    }
+  }
+
+  /**
+   * Store a byte of the dictionary sent by the host.
+   * Characters that don't fit are dropped.
+   */
+  void MeatPack::handle_dictionary_load(const uint8_t c) {
+    const uint8_t n = dict_loading - 1;                   // Bytes stored so far
+    const uint8_t start = dict_start[dict_entries];
+    if (c == '\0') {
+      if (n == start || dict_entries == kMaxEntries) {    // An empty entry ends the dictionary
+        dict_loading = 0;
+        report_state();
+        return;
+      }
+      dict[n] = '\0';
+      ++dict_loading;
+      dict_start[++dict_entries] = n + 1;
+    }
+    else if (dict_entries < kMaxEntries && n < MEATPACK_DICT_BYTES - 1 && n - start < kMaxEntryLength) {
+      dict[n] = c;
+      ++dict_loading;
+    }
+  }
+
+  /**
+   * Interpret a single character in dictionary mode
+   */
+  void MeatPack::handle_dictionary_char(const uint8_t c) {
+    if (delta_axis) {                                     // Receiving a change?
+      if (c & 0x80) {                                     // More digits follow
+        delta_value += (c & 0x7F) * delta_scale;
+        delta_scale *= 127;
+        return;
+      }
+      delta_value += c * delta_scale;
+      const uint8_t i = delta_axis - 1;
+      delta_axis = 0;
+      last[i] += int32_t(delta_value >> 1) ^ -int32_t(delta_value & 1);
+      output_value(last[i]);
+    }
+    else if (c < 0x80)                                    // A literal character
+      handle_output_char(c);
+    else if (c < kFirstDeltaCode) {                       // A dictionary entry
+      const uint8_t e = c - 0x80;
+      if (e < dict_entries)
+        for (const char *p = &dict[dict_start[e]]; *p; ++p) handle_output_char(*p);
+    }
+    else if (c < kFirstDeltaCode + kDeltaAxes) {          // A change to a coordinate follows
+      delta_axis = c - kFirstDeltaCode + 1;
+      delta_value = 0;
+      delta_scale = 1;
+    }
+  }
+
+  // Spell out a value in thousandths, without trailing zeros
+  void MeatPack::output_value(const int32_t v) {
+    if (v < 0) handle_output_char('-');
+    const uint32_t u = ABS(v);
+    char digits[7];
+    uint8_t n = 0;
+    for (uint32_t i = u / 1000; n == 0 || i; i /= 10) digits[n++] = '0' + i % 10;
+    while (n) handle_output_char(digits[--n]);
+    uint16_t frac = u % 1000;
+    if (frac) {
+      handle_output_char('.');
+      for (uint16_t d = 100; frac; d /= 10) {
+        handle_output_char('0' + frac / d);
+        frac %= d;
+      }
+    }
+  }
+
+#endif // MEATPACK_DICTIONARY
+
 /**
  * Unpack one or two characters from a packed byte into a buffer.
  * Return flags indicating whether any literal bytes follow.
@@ -100,6 +198,10 @@ uint8_t MeatPack::unpack_chars(const uint8_t pk, uint8_t* __restrict const chars
  * according to the current MeatPack state.
  */
 void MeatPack::handle_rx_char_inner(const uint8_t c) {
+  #if ENABLED(MEATPACK_DICTIONARY)
+    if (dict_loading) return handle_dictionary_load(c);
+    if (TEST(state, MPConfig_Bit_Dictionary)) return handle_dictionary_char(c);
+  #endif
   if (TEST(state, MPConfig_Bit_Active)) {                   // Is MeatPack active?
     if (!full_char_count) {                                 // No literal characters to fetch?
       uint8_t buf[2] = { 0, 0 };
@@ -161,6 +263,20 @@ void MeatPack::handle_command(const MeatPack_Command c) {
     case MPCommand_DisableNoSpaces:
       CBI(state, MPConfig_Bit_NoSpaces);
       meatPackLookupTable[kSpaceCharIdx] = ' ';                        DEBUG_ECHOLNPGM("[MPDBG] DIS NSP");   break;
+    #if ENABLED(MEATPACK_DICTIONARY)
+      case MPCommand_EnableDictionary:
+        if (!dict_entries) load_default_dictionary();
+        SBI(state, MPConfig_Bit_Dictionary);
+        delta_axis = 0;
+        ZERO(last);                                                    DEBUG_ECHOLNPGM("[MPDBG] ENA DIC");   break;
+      case MPCommand_DisableDictionary:
+        CBI(state, MPConfig_Bit_Dictionary);                           DEBUG_ECHOLNPGM("[MPDBG] DIS DIC");   break;
+      case MPCommand_LoadDictionary:
+        dict_entries = 0;
+        dict_start[0] = 0;
+        dict_loading = 1;                                              DEBUG_ECHOLNPGM("[MPDBG] LOAD DIC");
+        return;                                                        // Report once the dictionary is loaded
+    #endif
     default:                                                           DEBUG_ECHOLNPGM("[MPDBG] UNK CMD REC");
   }
   report_state();
@@ -171,7 +287,14 @@ void MeatPack::report_state() {
   // should not contain the "PV' substring, as this is used to indicate protocol version
   SERIAL_ECHOPGM("[MP] " MeatPack_ProtocolVersion " ");
   serialprint_onoff(TEST(state, MPConfig_Bit_Active));
-  SERIAL_ECHOF(TEST(state, MPConfig_Bit_NoSpaces) ? F(" NSP\n") : F(" ESP\n"));
+  #if ENABLED(MEATPACK_DICTIONARY)
+    SERIAL_ECHOF(TEST(state, MPConfig_Bit_NoSpaces) ? F(" NSP") : F(" ESP"));
+    SERIAL_ECHOF(TEST(state, MPConfig_Bit_Dictionary) ? F(" DIC ") : F(" NDC "));
+    SERIAL_ECHO(dict_entries);
+    SERIAL_CHAR('\n');
+  #else
+    SERIAL_ECHOF(TEST(state, MPConfig_Bit_NoSpaces) ? F(" NSP\n") : F(" ESP\n"));
+  #endif
 }
 
 /**
@@ -71,11 +71,17 @@ enum MeatPack_Command : uint8_t {
   MPCommand_QueryConfig     = 0xF8,
   MPCommand_EnableNoSpaces  = 0xF7,
   MPCommand_DisableNoSpaces = 0xF6
+  #if ENABLED(MEATPACK_DICTIONARY)
+    , MPCommand_EnableDictionary  = 0xF5
+    , MPCommand_DisableDictionary = 0xF4
+    , MPCommand_LoadDictionary    = 0xF3  // Followed by the entries, each ending with '\0', then another '\0'
+  #endif
 };
 
 enum MeatPack_ConfigStateBits : uint8_t {
-  MPConfig_Bit_Active   = 0,
-  MPConfig_Bit_NoSpaces = 1
+  MPConfig_Bit_Active     = 0,
+  MPConfig_Bit_NoSpaces   = 1,
+  MPConfig_Bit_Dictionary = 2
 };
 
 class MeatPack {
@@ -96,7 +102,38 @@ class MeatPack {
   uint8_t cmd_count,       // Counter of command bytes received (need 2)
           full_char_count, // Counter for full-width characters to be received
           char_out_count;  // Stores number of characters to be read out.
-  uint8_t char_out_buf[2]; // Output buffer for caching up to 2 characters
+
+  #if ENABLED(MEATPACK_DICTIONARY)
+    /**
+     * Dictionary mode: bytes below 0x80 are literal characters, 0x80-0xEF send
+     * a dictionary entry (e.g., "G1 X"), and 0xF0-0xF4 send the value of X Y Z E F
+     * as a change from the last value sent this way. The change is a zigzag number in thousandths, in base 127
+     * digits 0x80-0xFE (lowest first) ending with a 0x00-0x7F digit, so 0xFF never
+     * appears and the MeatPack commands still work.
+     */
+    static const uint8_t kFirstDeltaCode = 0xF0, kDeltaAxes = 5,
+                         kMaxEntries = kFirstDeltaCode - 0x80,
+                         kMaxEntryLength = 15;
+
+    char dict[MEATPACK_DICT_BYTES];     // The entries, each ending with '\0'
+    uint8_t dict_start[kMaxEntries + 1];  // Offset of each entry, and of the next one
+    uint8_t dict_entries;
+    uint16_t dict_loading;              // Loading the dictionary: 1 + bytes so far
+    uint8_t delta_axis;                 // Axis of the change being received: 1 + index
+    uint32_t delta_value, delta_scale;
+    int32_t last[kDeltaAxes];           // Last values in thousandths
+
+    void load_default_dictionary();
+    void handle_dictionary_load(const uint8_t c);
+    void handle_dictionary_char(const uint8_t c);
+    void output_value(const int32_t v);
+  #endif
+
+public:
+  static const uint8_t kOutputSize = TERN(MEATPACK_DICTIONARY, 16, 2);
+
+private:
+  uint8_t char_out_buf[kOutputSize]; // Output buffer for caching characters
 
 public:
   // Pass in a character rx'd by SD card or serial. Automatically parses command/ctrl sequences,
@@ -105,9 +142,9 @@ public:
 
   /**
    * After passing in rx'd char using above method, call this to get characters out.
-   * Can return from 0 to 2 characters at once.
+   * Can return from 0 to kOutputSize characters at once.
    * @param out [in] Output pointer for unpacked/processed data.
-   * @return Number of characters returned. Range from 0 to 2.
+   * @return Number of characters returned. Range from 0 to kOutputSize.
    */
   uint8_t get_result_char(char * const __restrict out);
 
@@ -118,7 +155,9 @@ public:
   void handle_output_char(const uint8_t c);
   void handle_rx_char_inner(const uint8_t c);
 
-  MeatPack() : cmd_is_next(false), state(0), second_char(0), cmd_count(0), full_char_count(0), char_out_count(0) {}
+  MeatPack() : cmd_is_next(false), state(0), second_char(0), cmd_count(0), full_char_count(0), char_out_count(0) {
+    TERN_(MEATPACK_DICTIONARY, dict_entries = dict_loading = delta_axis = 0);
+  }
 };
 
 // Implement the MeatPack serial class so it's transparent to rest of the code
@@ -129,7 +168,7 @@ struct MeatpackSerial : public SerialBase <MeatpackSerial < SerialT >> {
   SerialT & out;
   MeatPack meatpack;
 
-  char serialBuffer[2];
+  char serialBuffer[MeatPack::kOutputSize];
   uint8_t charCount;
   uint8_t readIndex;
 
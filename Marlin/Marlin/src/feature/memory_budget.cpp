@@ -0,0 +1,117 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(MEMORY_BUDGET)
+
+#include "memory_budget.h"
+#include "../module/planner.h"
+#include "../gcode/queue.h"
+
+#if HAS_GRAPHICAL_TFT
+  #include "../lcd/tft/tft.h"
+#endif
+#if ENABLED(BINARY_COMMAND_BATCH)
+  #include "binary_stream.h"
+#endif
+#if ENABLED(FF_RTOS_TASKS)
+  #include "../HAL/STM32/rtos_tasks.h"
+#endif
+#if ENABLED(SOFT_I2C_ASYNC)
+  #include "../libs/soft_i2c_async.h"
+#endif
+#if ENABLED(MEMORY_PROFILES)
+  #include "memory_profile.h"
+#endif
+
+// The STM32 core sizes each serial port from its build flags
+#if defined(SERIAL_RX_BUFFER_SIZE) && defined(SERIAL_TX_BUFFER_SIZE)
+  #define SERIAL_BUFFER_BYTES (SERIAL_RX_BUFFER_SIZE + SERIAL_TX_BUFFER_SIZE)
+#else
+  #ifndef RX_BUFFER_SIZE
+    #define RX_BUFFER_SIZE 0
+  #endif
+  #ifndef TX_BUFFER_SIZE
+    #define TX_BUFFER_SIZE 0
+  #endif
+  #define SERIAL_BUFFER_BYTES (RX_BUFFER_SIZE + TX_BUFFER_SIZE)
+#endif
+
+// As in eeprom_sdcard.cpp
+#if ENABLED(SDCARD_EEPROM_EMULATION)
+  #ifdef MARLIN_EEPROM_SIZE
+    #define EEPROM_IMAGE_BYTES MARLIN_EEPROM_SIZE
+  #else
+    #define EEPROM_IMAGE_BYTES 0x1000
+  #endif
+#else
+  #define EEPROM_IMAGE_BYTES 0
+#endif
+
+// With MEMORY_PROFILES the canvas buffer comes from the arena
+#define TFT_BUFFER_BYTES TERN0(HAS_GRAPHICAL_TFT, TERN(MEMORY_PROFILES, 0, sizeof(TFT::buffer)))
+
+// Task stacks come from the FreeRTOS heap, in 32-bit words
+#define RTOS_STACK_BYTES TERN0(FF_RTOS_TASKS, 4 * (RTOS_MARLIN_STACK + RTOS_UI_STACK + RTOS_IO_STACK))
+
+/**
+ * Name and size of each buffer. Disabled features add 0 bytes and
+ * are left out of the report. Add new entries at the end.
+ */
+#define MEMORY_ITEMS(ITEM) \
+  ITEM("planner", sizeof(Planner::block_buffer)) \
+  ITEM("queue", sizeof(GCodeQueue::ring_buffer) + sizeof(GCodeQueue::injected_commands)) \
+  ITEM("serial", uint32_t(NUM_SERIAL) * (SERIAL_BUFFER_BYTES)) \
+  ITEM("tft", TFT_BUFFER_BYTES) \
+  ITEM("tftqueue", TERN0(HAS_GRAPHICAL_TFT, TFT_QUEUE_SIZE)) \
+  ITEM("eeprom", EEPROM_IMAGE_BYTES) \
+  ITEM("batch", TERN0(BINARY_COMMAND_BATCH, BINARY_COMMAND_BATCH_SIZE + 1)) \
+  ITEM("i2cqueue", TERN0(SOFT_I2C_ASYNC, SOFT_I2C_ASYNC_QUEUE * (2 * sizeof(pin_t) + 1 + SOFT_I2C_ASYNC_MAX_BYTES))) \
+  ITEM("rtos", RTOS_STACK_BYTES) \
+  ITEM("arena", TERN0(MEMORY_PROFILES, MemoryProfile::arena_bytes))
+
+#define _MEM_NAME(N,B) N,
+#define _MEM_SIZE(N,B) uint32_t(B),
+#define _MEM_SUM(N,B) + uint32_t(B)
+
+static constexpr uint32_t memory_total = 0 MEMORY_ITEMS(_MEM_SUM);
+
+static_assert(memory_total <= (MEMORY_BUDGET_BYTES), "The static buffers need more RAM than MEMORY_BUDGET_BYTES. Reduce BUFSIZE, BLOCK_BUFFER_SIZE, TFT_QUEUE_SIZE...");
+
+static const char * const memory_name[] = { MEMORY_ITEMS(_MEM_NAME) };
+static constexpr uint32_t memory_size[] = { MEMORY_ITEMS(_MEM_SIZE) };
+
+MemoryBudget memory_budget;
+
+void MemoryBudget::report() {
+  SERIAL_ECHOLNPGM("Static buffers, bytes");
+  LOOP_L_N(i, COUNT(memory_size)) {
+    if (!memory_size[i]) continue;
+    SERIAL_ECHOLNPGM(" ", memory_name[i], ":", memory_size[i]);
+  }
+  SERIAL_ECHOLNPGM("Planner block:", sizeof(block_t), " Stepper part:", BLOCK_STEPPER_BYTES);
+  SERIAL_ECHOLNPGM("Total:", memory_total, " Budget:", MEMORY_BUDGET_BYTES, " Spare:", (MEMORY_BUDGET_BYTES) - memory_total);
+  SERIAL_ECHOLNPGM(STR_FREE_MEMORY, hal.freeMemory());
+}
+
+#endif // MEMORY_BUDGET
@@ -0,0 +1,42 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * memory_budget.h - Sizes of the big static buffers (M101)
+ *
+ * Each entry is the size of a buffer that some feature reserves at build time.
+ * The total is checked against MEMORY_BUDGET_BYTES when memory_budget.cpp is
+ * compiled, so a bigger queue or planner that doesn't fit breaks the build
+ * instead of the stack. Buffers that are private to their module are counted
+ * from the same options that size them.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+class MemoryBudget {
+public:
+  // Print each buffer, the total, the budget and the memory left
+  static void report();
+};
+
+extern MemoryBudget memory_budget;
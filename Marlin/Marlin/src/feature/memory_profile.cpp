@@ -0,0 +1,114 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(MEMORY_PROFILES)
+
+#include "memory_profile.h"
+
+#if ENABLED(GCODE_PACKED_QUEUE)
+  #include "../gcode/queue.h"
+#endif
+#if ENABLED(SD_BLOCK_CACHE)
+  #include "../sd/SdVolume.h"
+#endif
+#if HAS_GRAPHICAL_TFT
+  #include "../lcd/tft/tft.h"
+#endif
+
+static constexpr uint32_t profile_share[MemoryProfile::PROFILES][3] = { MEMORY_PROFILE_SD, MEMORY_PROFILE_HOST, MEMORY_PROFILE_UI };
+
+#define TFT_SHARE_PIXELS(B) ((B) / 2 / TERN(TFT_DOUBLE_BUFFER, 2, 1))
+
+// Check the shares of every profile for the buffers that are built
+#define CHECK_PROFILE(P) \
+  static_assert(DISABLED(GCODE_PACKED_QUEUE) || WITHIN(profile_share[P][0], 4 * (MAX_CMD_SIZE), 32767), \
+    "Each MEMORY_PROFILE_* command text share must be from 4 * MAX_CMD_SIZE to 32767 bytes."); \
+  static_assert(DISABLED(GCODE_PACKED_QUEUE) || DISABLED(BINARY_COMMAND_BATCH) || profile_share[P][0] > TERN0(BINARY_COMMAND_BATCH, BINARY_COMMAND_BATCH_SIZE) + MAX_CMD_SIZE, \
+    "Each MEMORY_PROFILE_* command text share must be more than BINARY_COMMAND_BATCH_SIZE + MAX_CMD_SIZE."); \
+  static_assert(DISABLED(SD_BLOCK_CACHE) || WITHIN(profile_share[P][1] / SD_SHARE_SLOT, 2, TERN(SD_BLOCK_CACHE, SD_BLOCK_CACHE_BLOCKS, 2)), \
+    "Each MEMORY_PROFILE_* SD cache share must hold from 2 to SD_BLOCK_CACHE_BLOCKS blocks."); \
+  static_assert(DISABLED(HAS_GRAPHICAL_TFT) || WITHIN(TFT_SHARE_PIXELS(profile_share[P][2]), TFT_SHARE_WIDTH, 65535), \
+    "Each MEMORY_PROFILE_* TFT share must hold from one display line to 65535 pixels (per half with TFT_DOUBLE_BUFFER).");
+
+#if ENABLED(SD_BLOCK_CACHE)
+  #define SD_SHARE_SLOT sizeof(cache_slot_t)
+#else
+  #define SD_SHARE_SLOT 1
+#endif
+#if HAS_GRAPHICAL_TFT
+  #define TFT_SHARE_WIDTH TFT_WIDTH
+#else
+  #define TFT_SHARE_WIDTH 0
+#endif
+
+CHECK_PROFILE(MemoryProfile::SD_PRINTING)
+CHECK_PROFILE(MemoryProfile::HOST_STREAMING)
+CHECK_PROFILE(MemoryProfile::UI_RICH)
+
+alignas(4) static uint8_t arena[MemoryProfile::arena_bytes];
+
+constexpr uint32_t MemoryProfile::arena_bytes;
+uint8_t MemoryProfile::active = MemoryProfile::PROFILES,
+        MemoryProfile::saved; // = SD_PRINTING
+
+MemoryProfile memory_profile;
+
+// Give each buffer its share of the arena. The buffers are empty or flushed first.
+void MemoryProfile::carve(const uint8_t p) {
+  const uint32_t (&s)[3] = profile_share[p];
+  uint8_t *at = arena;
+
+  #if ENABLED(GCODE_PACKED_QUEUE)
+    queue.ring_buffer.set_texts((char*)at, s[0]);
+    at += _MEM_ALIGN(s[0]);
+  #endif
+
+  #if ENABLED(SD_BLOCK_CACHE)
+    SdVolume::cacheSetSlots((cache_slot_t*)at, s[1] / sizeof(cache_slot_t));
+    at += _MEM_ALIGN(s[1]);
+  #endif
+
+  #if HAS_GRAPHICAL_TFT
+    if (active < PROFILES) while (TFT::is_busy()) { /* The last canvas is still on the bus */ }
+    TFT::set_buffer((uint16_t*)at, TFT_SHARE_PIXELS(s[2]));
+  #endif
+
+  UNUSED(s); UNUSED(at);
+  active = p;
+}
+
+void MemoryProfile::report() {
+  SERIAL_ECHOLNPGM("Memory profile:", active, " Next boot:", saved, " Arena:", arena_bytes);
+  LOOP_L_N(p, PROFILES) {
+    const uint32_t (&s)[3] = profile_share[p];
+    SERIAL_ECHOPGM(" P", p, p == active ? "*" : " ");
+    TERN_(GCODE_PACKED_QUEUE, SERIAL_ECHOPGM(" queue:", s[0]));
+    TERN_(SD_BLOCK_CACHE, SERIAL_ECHOPGM(" sdcache:", s[1] / sizeof(cache_slot_t), " blocks"));
+    TERN_(HAS_GRAPHICAL_TFT, SERIAL_ECHOPGM(" tft:", TFT_SHARE_PIXELS(s[2]), " px"));
+    SERIAL_EOL();
+    UNUSED(s);
+  }
+}
+
+#endif // MEMORY_PROFILES
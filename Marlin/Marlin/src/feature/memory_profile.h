@@ -0,0 +1,64 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * memory_profile.h - One RAM arena, shared out by a profile chosen with M102
+ *
+ * The command queue text (GCODE_PACKED_QUEUE), the SD block cache (SD_BLOCK_CACHE)
+ * and the TFT canvas buffer take their RAM from one arena instead of their own
+ * static buffers. Each profile gives them a different share, for the job source
+ * the printer mostly sees. The arena is as big as the largest profile.
+ *
+ * setup() carves the arena for profile 0 before anything uses it, then for the
+ * saved profile once the settings are loaded. M102 P picks a profile for the next
+ * boot. The buffers aren't resized while they're in use.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#define _MEM_ALIGN(B) ((uint32_t(B) + 3) & ~3UL)
+
+// The arena bytes for a profile's shares, counting only the buffers that are built
+constexpr uint32_t memory_profile_need(const uint32_t (&s)[3]) {
+  return TERN0(GCODE_PACKED_QUEUE, _MEM_ALIGN(s[0])) + TERN0(SD_BLOCK_CACHE, _MEM_ALIGN(s[1])) + TERN0(HAS_GRAPHICAL_TFT, _MEM_ALIGN(s[2]));
+}
+
+class MemoryProfile {
+public:
+  enum : uint8_t { SD_PRINTING, HOST_STREAMING, UI_RICH, PROFILES };
+
+  static constexpr uint32_t arena_bytes = _MAX(memory_profile_need(MEMORY_PROFILE_SD), memory_profile_need(MEMORY_PROFILE_HOST), memory_profile_need(MEMORY_PROFILE_UI));
+
+  static uint8_t active,          // The profile the buffers were given
+                 saved;           // The profile for the next boot (M102 P, saved with M500)
+
+  static void init() { carve(SD_PRINTING); }                  // Before anything uses the buffers
+  static void apply() { if (saved != active) carve(saved); }  // Once, after the settings load at boot
+
+  static void report();
+
+private:
+  static void carve(const uint8_t p);
+};
+
+extern MemoryProfile memory_profile;
@@ -0,0 +1,98 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(MOTION_BENCHMARK)
+
+#include "motion_bench.h"
+
+#include "../module/endstops.h"
+#include "../module/motion.h"
+#include "../module/planner.h"
+#include "../module/stepper.h"
+
+MotionBench motion_bench;
+
+bool MotionBench::active; // = false
+uint32_t MotionBench::recalc_count, MotionBench::recalc_max;
+uint64_t MotionBench::recalc_cycles;
+uint32_t MotionBench::isr_bins[MOTION_BENCH_BINS];
+
+void MotionBench::run(const uint32_t count, const_float_t length, const_float_t angle, const_feedRate_t fr_mm_s) {
+  planner.synchronize();
+  stepper.disable_all_steppers();
+
+  TemporaryGlobalEndstopsState unlock_endstops(false);
+
+  recalc_count = recalc_max = 0;
+  recalc_cycles = 0;
+  ZERO(isr_bins);
+
+  // Every other move turns by the angle, so the zigzag drifts along the sum of both vectors.
+  // Swing back whenever it drifts 20mm away from the start.
+  const float turn = RADIANS(angle);
+  const xy_float_t v0 = { length, 0 }, v1 = { length * cos(turn), length * sin(turn) }, drift = v0 + v1;
+  const float swing = 20 * HYPOT(drift.x, drift.y);
+  const xyze_pos_t start = current_position;
+  xyze_pos_t pos = start;
+  float sign = 1;
+
+  active = true;
+  const millis_t start_ms = millis();
+
+  uint32_t queued = 0;
+  for (; queued < count; ++queued) {
+    const xy_float_t &v = (queued & 1) ? v1 : v0;
+    pos.x += sign * v.x;
+    pos.y += sign * v.y;
+    if (!planner.buffer_line(pos, fr_mm_s)) break;
+    if (sign * ((pos.x - start.x) * drift.x + (pos.y - start.y) * drift.y) > swing) sign = -sign;
+  }
+
+  planner.synchronize();
+  const millis_t ms = _MAX(millis() - start_ms, 1UL);
+  active = false;
+
+  // The motors never moved
+  current_position = start;
+  sync_plan_position();
+
+  SERIAL_ECHOLNPGM("Blocks: ", queued, " in ", ms, "ms = ", uint32_t(uint64_t(queued) * 1000UL / ms), " blocks/s");
+
+  if (!recalc_count) {
+    SERIAL_ECHOLNPGM("No cycle counter for timings.");
+    return;
+  }
+
+  constexpr float cycles_per_us = float(F_CPU) / 1000000UL;
+  SERIAL_ECHOLNPGM("recalculate() us: mean ", float(recalc_cycles) / recalc_count / cycles_per_us, " max ", recalc_max / cycles_per_us);
+  SERIAL_ECHOLNPGM("Stepper ISR durations (cycles: count)");
+  LOOP_L_N(i, MOTION_BENCH_BINS) {
+    if (!isr_bins[i]) continue;
+    SERIAL_ECHOPGM("  ", i ? _BV32(i + 5) : 0UL);
+    if (i < MOTION_BENCH_BINS - 1) SERIAL_ECHOPGM("-", _BV32(i + 6) - 1); else SERIAL_ECHOPGM("+");
+    SERIAL_ECHOLNPGM(": ", isr_bins[i]);
+  }
+}
+
+#endif // MOTION_BENCHMARK
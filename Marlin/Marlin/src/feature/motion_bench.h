@@ -0,0 +1,66 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * motion_bench.h - Motion pipeline benchmark (D201)
+ *
+ * Synthetic moves go through Planner::buffer_line() while the steppers stay
+ * disabled. The planner and the Stepper ISR record their cycle counts for the
+ * report: blocks per second, recalculate() time and Stepper ISR durations.
+ */
+
+#include "../inc/MarlinConfig.h"
+#include "../HAL/shared/Delay.h"
+
+// Power-of-2 ISR duration bins, from under 64 cycles to 2^(5+N) cycles and longer
+#define MOTION_BENCH_BINS 14
+
+class MotionBench {
+public:
+  static bool active;                             // A benchmark is running
+
+  // Called from Planner after recalculate()
+  static void recalc_done(const uint32_t cycles) {
+    if (!active || !cycles) return;
+    recalc_count++;
+    recalc_cycles += cycles;
+    NOLESS(recalc_max, cycles);
+  }
+
+  // Called at the end of the Stepper ISR
+  FORCE_INLINE static void isr_done(const uint32_t cycles) {
+    if (!active || !cycles) return;
+    const uint8_t bin = cycles < 64 ? 0 : 26 - __builtin_clz(cycles);
+    isr_bins[_MIN(bin, MOTION_BENCH_BINS - 1)]++;
+  }
+
+  // Queue a zigzag of moves of the given length (mm), turning by the given angle (degrees)
+  static void run(const uint32_t count, const_float_t length, const_float_t angle, const_feedRate_t fr_mm_s);
+
+private:
+  static uint32_t recalc_count, recalc_max;
+  static uint64_t recalc_cycles;
+  static uint32_t isr_bins[MOTION_BENCH_BINS];
+};
+
+extern MotionBench motion_bench;
@@ -0,0 +1,108 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(PATH_BLENDING)
+
+#include "path_blend.h"
+#include "../module/motion.h"
+#include "../module/planner_bezier.h"
+
+PathBlend path_blend;
+
+float PathBlend::tolerance = PATH_BLENDING_TOLERANCE;
+bool PathBlend::held; // = false
+xyze_pos_t PathBlend::from;
+feedRate_t PathBlend::feedrate;
+
+// Plan a line from 'from' to the target
+void PathBlend::line_to(const xyze_pos_t &target, const_feedRate_t fr_mm_s) {
+  const xyze_pos_t old_current = current_position, old_destination = destination;
+  const feedRate_t old_feedrate = feedrate_mm_s;
+  current_position = from;
+  destination = target;
+  feedrate_mm_s = fr_mm_s;
+  prepare_line_to_destination();
+  feedrate_mm_s = old_feedrate;
+  destination = old_destination;
+  current_position = old_current;
+  from = target;
+}
+
+bool PathBlend::add() {
+  const xy_pos_t out = xy_pos_t(destination) - xy_pos_t(current_position);
+  const float len_out = HYPOT(out.x, out.y);
+
+  // Only moves in XY, with or without E, can be blended
+  bool plain = len_out > 0;
+  LOOP_S_L_N(a, Z_AXIS, LINEAR_AXES) if (destination[a] != current_position[a]) plain = false;
+  if (!plain) { flush(); return false; }
+
+  if (held) {
+    // The held move ends at current_position, the corner
+    const xyze_pos_t &corner = current_position;
+    const xy_pos_t in = xy_pos_t(corner) - xy_pos_t(from);
+    const float len_in = HYPOT(in.x, in.y);
+    const xy_pos_t u1 = in / len_in, u2 = out / len_out;
+    const float cos_turn = u1.x * u2.x + u1.y * u2.y;
+
+    // Nearly straight corners need no curve, and reversals can't have one
+    if (len_in > 0 && WITHIN(cos_turn, -0.95f, 0.9999f)) {
+      /**
+       * Trim both moves by d and join the ends with a Bézier whose control points lie
+       * 2/3 of the way to the corner. Its midpoint is d * sin(turn / 2) / 2 from the corner.
+       */
+      const float sin_half = SQRT(0.5f * (1.0f - cos_turn)),
+                  d = _MIN(2.0f * tolerance / sin_half, len_in, 0.5f * len_out);
+
+      xyze_pos_t a = corner, b = corner;
+      a.x -= u1.x * d; a.y -= u1.y * d;
+      a.e -= (corner.e - from.e) * d / len_in;
+      b.x += u2.x * d; b.y += u2.y * d;
+      b.e += (destination.e - corner.e) * d / len_out;
+
+      if (d < len_in) line_to(a, feedrate);
+
+      const xy_pos_t offsets[2] = { u1 * (d * 2.0f / 3.0f), u2 * (d * -2.0f / 3.0f) };
+      cubic_b_spline(a, b, offsets, MMS_SCALED(feedrate_mm_s), active_extruder);
+      from = b;
+    }
+    else
+      line_to(corner, feedrate);
+  }
+  else
+    from = current_position;
+
+  held = true;
+  feedrate = feedrate_mm_s;
+  current_position = destination;
+  return true;
+}
+
+void PathBlend::flush() {
+  if (!held) return;
+  held = false;   // Planning may idle, which flushes again
+  line_to(current_position, feedrate);
+}
+
+#endif // PATH_BLENDING
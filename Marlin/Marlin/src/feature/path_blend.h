@@ -0,0 +1,55 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * path_blend.h - Round G0/G1 corners with cubic Bézier curves (G64)
+ *
+ * The last move is held back from the planner until the next one shows how
+ * its corner turns. Like LINE_MERGE, anything else that plans moves must
+ * flush() it first.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+class PathBlend {
+public:
+  static float tolerance;         // (mm) G64 P. Largest distance of a curve from its corner.
+
+  // Take the move from current_position to destination. False if it must be planned as is.
+  static bool add();
+
+  // Plan the held move
+  static void flush();
+
+  // Forget the held move, as when the planner queue is dropped
+  static void discard() { held = false; }
+
+private:
+  static bool held;
+  static xyze_pos_t from;         // Start of the held move, after the last curve
+  static feedRate_t feedrate;     // Feedrate of the held move
+
+  static void line_to(const xyze_pos_t &target, const_feedRate_t fr_mm_s);
+};
+
+extern PathBlend path_blend;
@@ -91,6 +91,25 @@ static xyze_pos_t resume_position;
 
 fil_change_settings_t fc_settings[EXTRUDERS];
 
+#if ENABLED(ADVANCED_PAUSE_PLANNED)
+
+  static millis_t unload_cool_ms; // When a retract queued with the park will be done, else 0
+
+  // Queue an E move without waiting for it, as unscaled_e_move() does
+  static void plan_e_move(const_float_t length, const_feedRate_t fr_mm_s) {
+    TERN_(HAS_FILAMENT_SENSOR, runout.reset());
+    current_position.e += length / planner.e_factor[active_extruder];
+    line_to_current_position(fr_mm_s);
+  }
+
+  #define PAUSE_E_MOVE plan_e_move
+
+#else
+
+  #define PAUSE_E_MOVE unscaled_e_move
+
+#endif
+
 #if ENABLED(SDSUPPORT)
   #include "../sd/cardreader.h"
 #endif
@@ -235,7 +254,7 @@ bool load_filament(const_float_t slow_load_length/*=0*/, const_float_t fast_load
   TERN_(BELTPRINTER, do_blocking_move_to_xy(0.00, 50.00));
 
   // Slow Load filament
-  if (slow_load_length) unscaled_e_move(slow_load_length, FILAMENT_CHANGE_SLOW_LOAD_FEEDRATE);
+  if (slow_load_length) PAUSE_E_MOVE(slow_load_length, FILAMENT_CHANGE_SLOW_LOAD_FEEDRATE);
 
   // Fast Load Filament
   if (fast_load_length) {
@@ -244,13 +263,15 @@ bool load_filament(const_float_t slow_load_length/*=0*/, const_float_t fast_load
       planner.settings.retract_acceleration = FILAMENT_CHANGE_FAST_LOAD_ACCEL;
     #endif
 
-    unscaled_e_move(fast_load_length, FILAMENT_CHANGE_FAST_LOAD_FEEDRATE);
+    PAUSE_E_MOVE(fast_load_length, FILAMENT_CHANGE_FAST_LOAD_FEEDRATE);
 
     #if FILAMENT_CHANGE_FAST_LOAD_ACCEL > 0
       planner.settings.retract_acceleration = saved_acceleration;
     #endif
   }
 
+  TERN_(ADVANCED_PAUSE_PLANNED, planner.synchronize()); // Slow and fast load run as one chain
+
   #if ENABLED(DUAL_X_CARRIAGE)      // Tie the two extruders movement back together.
     set_duplication_enabled(saved_ext_dup_mode, saved_ext);
   #endif
@@ -342,21 +363,34 @@ bool unload_filament(const_float_t unload_length, const bool show_lcd/*=false*/,
   #endif
 
   if (!ensure_safe_temperature(false, mode)) {
+    TERN_(ADVANCED_PAUSE_PLANNED, planner.synchronize(); unload_cool_ms = 0);
     if (show_lcd) ui.pause_show_message(PAUSE_MESSAGE_STATUS);
     return false;
   }
 
   if (show_lcd) ui.pause_show_message(PAUSE_MESSAGE_UNLOAD, mode);
 
-  // Retract filament
-  unscaled_e_move(-(FILAMENT_UNLOAD_PURGE_RETRACT) * mix_multiplier, (PAUSE_PARK_RETRACT_FEEDRATE) * mix_multiplier);
+  #if ENABLED(ADVANCED_PAUSE_PLANNED)
+    if (unload_cool_ms) {
+      // The retract was queued ahead of the park, so the filament has been cooling on the way
+      planner.synchronize();
+      const millis_t cool_end_ms = unload_cool_ms + FILAMENT_UNLOAD_PURGE_DELAY;
+      if (PENDING(millis(), cool_end_ms)) safe_delay(cool_end_ms - millis());
+      unload_cool_ms = 0;
+    }
+    else
+  #endif
+  {
+    // Retract filament
+    unscaled_e_move(-(FILAMENT_UNLOAD_PURGE_RETRACT) * mix_multiplier, (PAUSE_PARK_RETRACT_FEEDRATE) * mix_multiplier);
 
-  // Wait for filament to cool
-  safe_delay(FILAMENT_UNLOAD_PURGE_DELAY);
+    // Wait for filament to cool
+    safe_delay(FILAMENT_UNLOAD_PURGE_DELAY);
+  }
 
   // Quickly purge
-  unscaled_e_move((FILAMENT_UNLOAD_PURGE_RETRACT + FILAMENT_UNLOAD_PURGE_LENGTH) * mix_multiplier,
-                  (FILAMENT_UNLOAD_PURGE_FEEDRATE) * mix_multiplier);
+  PAUSE_E_MOVE((FILAMENT_UNLOAD_PURGE_RETRACT + FILAMENT_UNLOAD_PURGE_LENGTH) * mix_multiplier,
+               (FILAMENT_UNLOAD_PURGE_FEEDRATE) * mix_multiplier);
 
   // Unload filament
   #if FILAMENT_CHANGE_UNLOAD_ACCEL > 0
@@ -364,12 +398,14 @@ bool unload_filament(const_float_t unload_length, const bool show_lcd/*=false*/,
     planner.settings.retract_acceleration = FILAMENT_CHANGE_UNLOAD_ACCEL;
   #endif
 
-  unscaled_e_move(unload_length * mix_multiplier, (FILAMENT_CHANGE_UNLOAD_FEEDRATE) * mix_multiplier);
+  PAUSE_E_MOVE(unload_length * mix_multiplier, (FILAMENT_CHANGE_UNLOAD_FEEDRATE) * mix_multiplier);
 
   #if FILAMENT_CHANGE_FAST_LOAD_ACCEL > 0
     planner.settings.retract_acceleration = saved_acceleration;
   #endif
 
+  TERN_(ADVANCED_PAUSE_PLANNED, planner.synchronize()); // Purge and unload run as one chain
+
   // Disable the Extruder for manual change
   disable_active_extruder();
 
@@ -454,13 +490,21 @@ bool pause_print(const_float_t retract, const xyz_pos_t &park_point, const bool
       set_bed_leveling_enabled(false);  // turn off leveling
     #endif
 
-    unscaled_e_move(retract, PAUSE_PARK_RETRACT_FEEDRATE);
+    PAUSE_E_MOVE(retract, PAUSE_PARK_RETRACT_FEEDRATE);
 
     TERN_(AUTO_BED_LEVELING_UBL, set_bed_leveling_enabled(leveling_was_enabled)); // restore leveling
   }
 
+  #if ENABLED(ADVANCED_PAUSE_PLANNED)
+    // Queue the unload retract before the park, so the filament cools while the nozzle travels
+    if (unload_length && thermalManager.hotEnoughToExtrude(active_extruder)) {
+      plan_e_move(-(FILAMENT_UNLOAD_PURGE_RETRACT), PAUSE_PARK_RETRACT_FEEDRATE);
+      unload_cool_ms = millis() + LROUND((ABS(retract) + FILAMENT_UNLOAD_PURGE_RETRACT) * 1000 / (PAUSE_PARK_RETRACT_FEEDRATE));
+    }
+  #endif
+
   // If axes don't need to home then the nozzle can park
-  if (do_park) nozzle.park(0, park_point); // Park the nozzle by doing a Minimum Z Raise followed by an XY Move
+  if (do_park) nozzle.park(0, park_point, DISABLED(ADVANCED_PAUSE_PLANNED)); // Park the nozzle by doing a Minimum Z Raise followed by an XY Move
 
   #if ENABLED(DUAL_X_CARRIAGE)
     const int8_t saved_ext        = active_extruder;
@@ -476,6 +520,8 @@ bool pause_print(const_float_t retract, const xyz_pos_t &park_point, const bool
     set_duplication_enabled(saved_ext_dup_mode, saved_ext);
   #endif
 
+  TERN_(ADVANCED_PAUSE_PLANNED, planner.synchronize()); // Park without an unload
+
   // Disable the Extruder for manual change
   disable_active_extruder();
 
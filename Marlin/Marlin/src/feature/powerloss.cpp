@@ -44,6 +44,15 @@ uint32_t PrintJobRecovery::cmd_sdpos, // = 0
   bool PrintJobRecovery::dwin_flag; // = false
 #endif
 
+#if ENABLED(POWER_LOSS_JOURNAL)
+  job_recovery_info_t PrintJobRecovery::journal_base;
+  uint32_t PrintJobRecovery::journal_seq; // = 0
+#endif
+
+#if ENABLED(POWER_LOSS_BACKUP_SRAM)
+  uint32_t PrintJobRecovery::backup_seq; // = 0
+#endif
+
 #include "../sd/cardreader.h"
 #include "../lcd/marlinui.h"
 #include "../gcode/queue.h"
@@ -62,6 +71,10 @@ uint32_t PrintJobRecovery::cmd_sdpos, // = 0
   #include "fwretract.h"
 #endif
 
+#if EITHER(POWER_LOSS_JOURNAL, POWER_LOSS_BACKUP_SRAM)
+  #include "../libs/crc32.h"
+#endif
+
 #define DEBUG_OUT ENABLED(DEBUG_POWER_LOSS_RECOVERY)
 #include "../core/debug_out.h"
 
@@ -81,7 +94,10 @@ PrintJobRecovery recovery;
 /**
  * Clear the recovery info
  */
-void PrintJobRecovery::init() { memset(&info, 0, sizeof(info)); }
+void PrintJobRecovery::init() {
+  memset(&info, 0, sizeof(info));
+  TERN_(POWER_LOSS_JOURNAL, journal_seq = 0);
+}
 
 /**
  * Enable or disable then call changed()
@@ -112,6 +128,7 @@ bool PrintJobRecovery::check() {
   //if (!card.isMounted()) card.mount();
   bool success = false;
   if (card.isMounted()) {
+    TERN_(POWER_LOSS_BACKUP_SRAM, commit_backup());
     load();
     success = valid();
     if (!success)
@@ -127,6 +144,7 @@ bool PrintJobRecovery::check() {
  */
 void PrintJobRecovery::purge() {
   init();
+  TERN_(POWER_LOSS_BACKUP_SRAM, clear_backup());
   card.removeJobRecoveryFile();
 }
 
@@ -137,6 +155,7 @@ void PrintJobRecovery::load() {
   if (exists()) {
     open(true);
     (void)file.read(&info, sizeof(info));
+    TERN_(POWER_LOSS_JOURNAL, load_journal());
     close();
   }
   debug(F("Load"));
@@ -172,8 +191,10 @@ void PrintJobRecovery::save(const bool force/*=false*/, const float zraise/*=POW
       #if SAVE_INFO_INTERVAL_MS > 0       // Save if interval is elapsed
         || ELAPSED(ms, next_save_ms)
       #endif
-      // Save if Z is above the last-saved position by some minimum height
-      || current_position.z > info.current_position.z + POWER_LOSS_MIN_Z_CHANGE
+      #if !HAS_POWER_LOSS_LAYER_SAVE      // Else saved by each layer event
+        // Save if Z is above the last-saved position by some minimum height
+        || current_position.z > info.current_position.z + POWER_LOSS_MIN_Z_CHANGE
+      #endif
     #endif
   ) {
 
@@ -303,7 +324,11 @@ void PrintJobRecovery::save(const bool force/*=false*/, const float zraise/*=POW
 
     // Save the current position, distance that Z was (or should be) raised,
     // and a flag whether the raise was already done here.
-    if (IS_SD_PRINTING()) save(true, zraise, ENABLED(BACKUP_POWER_SUPPLY));
+    if (IS_SD_PRINTING()) {
+      save(true, zraise, ENABLED(BACKUP_POWER_SUPPLY));
+      // The backup SRAM may not outlive the power, so try the file too
+      TERN_(POWER_LOSS_BACKUP_SRAM, write_file());
+    }
 
     // Disable all heaters to reduce power loss
     thermalManager.disable_all_heaters();
@@ -326,20 +351,229 @@ void PrintJobRecovery::save(const bool force/*=false*/, const float zraise/*=POW
 
 #endif // POWER_LOSS_PIN || DEBUG_POWER_LOSS_RECOVERY
 
+#if ENABLED(POWER_LOSS_JOURNAL)
+
+  void PrintJobRecovery::journal_fill(job_recovery_journal_t &j, const job_recovery_info_t &i) {
+    memset(&j, 0, sizeof(j));
+    j.sdpos = i.sdpos;
+    j.current_position = i.current_position;
+    j.feedrate = i.feedrate;
+    j.zraise = i.zraise;
+    j.raised = i.flag.raised;
+    j.print_job_elapsed = i.print_job_elapsed;
+    TERN_(HAS_HOTEND, COPY(j.target_temperature, i.target_temperature));
+    TERN_(HAS_HEATED_BED, j.target_temperature_bed = i.target_temperature_bed);
+    TERN_(HAS_FAN, COPY(j.fan_speed, i.fan_speed));
+  }
+
+  void PrintJobRecovery::journal_apply(job_recovery_info_t &i, const job_recovery_journal_t &j) {
+    i.sdpos = j.sdpos;
+    i.current_position = j.current_position;
+    i.feedrate = j.feedrate;
+    i.zraise = j.zraise;
+    i.flag.raised = j.raised;
+    i.print_job_elapsed = j.print_job_elapsed;
+    TERN_(HAS_HOTEND, COPY(i.target_temperature, j.target_temperature));
+    TERN_(HAS_HEATED_BED, i.target_temperature_bed = j.target_temperature_bed);
+    TERN_(HAS_FAN, COPY(i.fan_speed, j.fan_speed));
+  }
+
+  uint32_t PrintJobRecovery::journal_crc(const job_recovery_journal_t &j) {
+    return crc32(0, &j, offsetof(job_recovery_journal_t, crc));
+  }
+
+  /**
+   * Save only the changing fields, if nothing else changed since the last full save.
+   * The entry goes into a slot that the full save already allocated, so the write
+   * doesn't truncate the file, allocate clusters, or update the directory.
+   */
+  bool PrintJobRecovery::write_journal() {
+    if (!journal_seq) return false;
+
+    // Compare with the last full save, ignoring the journaled fields
+    job_recovery_info_t cmp;
+    memcpy(&cmp, &info, sizeof(cmp));
+    job_recovery_journal_t j;
+    journal_fill(j, journal_base);
+    journal_apply(cmp, j);
+    cmp.valid_head = journal_base.valid_head;
+    cmp.valid_foot = journal_base.valid_foot;
+    if (memcmp(&cmp, &journal_base, sizeof(cmp))) return false;
+
+    journal_fill(j, info);
+    j.seq = journal_seq;
+    j.valid_head = journal_base.valid_head;
+    j.crc = journal_crc(j);
+
+    open(false, true);
+    bool ok = file.isOpen()
+      && file.seekSet(sizeof(info) + ((journal_seq - 1) % (POWER_LOSS_JOURNAL_SIZE)) * sizeof(j))
+      && file.write(&j, sizeof(j)) == int16_t(sizeof(j));
+    if (!file.close()) ok = false;
+    if (ok) journal_seq++;
+    return ok;
+  }
+
+  /**
+   * Apply the newest good entry for the loaded full save
+   */
+  void PrintJobRecovery::load_journal() {
+    job_recovery_journal_t j, last;
+    last.seq = 0;
+    LOOP_L_N(n, POWER_LOSS_JOURNAL_SIZE) {
+      if (file.read(&j, sizeof(j)) != int16_t(sizeof(j))) break;
+      if (j.seq > last.seq && j.valid_head == info.valid_head && j.crc == journal_crc(j)) last = j;
+    }
+    if (last.seq) {
+      DEBUG_ECHOLNPGM("Journal entry ", last.seq);
+      journal_apply(info, last);
+    }
+  }
+
+#endif // POWER_LOSS_JOURNAL
+
+#if ENABLED(POWER_LOSS_BACKUP_SRAM)
+
+  #define PLR_BACKUP_MAGIC 0x424B504CUL // "PLBK"
+
+  /**
+   * The recovery info is kept in two slots at the start of the backup SRAM,
+   * written in turn, so an outage during a write leaves the previous one.
+   */
+  typedef struct {
+    uint32_t magic,                 // PLR_BACKUP_MAGIC once the slot is complete
+             seq;                   // Counts up from 1 after each purge
+    uint32_t crc;                   // CRC of info
+    job_recovery_info_t info;
+  } job_recovery_backup_t;
+
+  static_assert(2 * sizeof(job_recovery_backup_t) <= 0x1000, "job_recovery_info_t is too large for two slots in the 4K backup SRAM.");
+
+  #define PLR_BACKUP ((job_recovery_backup_t *)BKPSRAM_BASE)
+
+  static uint32_t backup_crc(const job_recovery_backup_t &b) { return crc32(0, &b.info, sizeof(b.info)); }
+
+  // The newest complete slot, if any
+  static const job_recovery_backup_t* backup_newest() {
+    const job_recovery_backup_t *newest = nullptr;
+    LOOP_L_N(s, 2) {
+      const job_recovery_backup_t &b = PLR_BACKUP[s];
+      if (b.magic == PLR_BACKUP_MAGIC && b.crc == backup_crc(b) && (!newest || b.seq > newest->seq))
+        newest = &b;
+    }
+    return newest;
+  }
+
+  // Save the recovery info at memory speed
+  void PrintJobRecovery::write_backup() {
+    if (!backup_seq) {
+      const job_recovery_backup_t * const newest = backup_newest();
+      backup_seq = newest ? newest->seq : 0;
+    }
+    job_recovery_backup_t &b = PLR_BACKUP[++backup_seq & 1];
+    b.magic = 0;
+    __atomic_signal_fence(__ATOMIC_SEQ_CST); // Invalidate the slot before changing it
+    b.seq = backup_seq;
+    memcpy(&b.info, &info, sizeof(info));
+    b.crc = backup_crc(b);
+    __atomic_signal_fence(__ATOMIC_SEQ_CST);
+    b.magic = PLR_BACKUP_MAGIC;
+  }
+
+  void PrintJobRecovery::clear_backup() {
+    PLR_BACKUP[0].magic = PLR_BACKUP[1].magic = 0;
+    backup_seq = 0;
+  }
+
+  /**
+   * At boot write the recovery info left in the backup SRAM to the recovery file.
+   * Keep it in the backup SRAM until the file is written.
+   */
+  bool PrintJobRecovery::commit_backup() {
+    const job_recovery_backup_t * const newest = backup_newest();
+    if (!newest) return false;
+    DEBUG_ECHOLNPGM("Backup SRAM entry ", newest->seq);
+    memcpy(&info, &newest->info, sizeof(info));
+    const bool ok = write_file();
+    if (ok) clear_backup();
+    return ok;
+  }
+
+#endif // POWER_LOSS_BACKUP_SRAM
+
 /**
- * Save the recovery info the recovery file
+ * Save the recovery info to the backup SRAM or the recovery file
  */
 void PrintJobRecovery::write() {
-
   debug(F("Write"));
+  TERN(POWER_LOSS_BACKUP_SRAM, write_backup(), (void)write_file());
+}
+
+/**
+ * Save the recovery info to the recovery file
+ */
+bool PrintJobRecovery::write_file() {
+
+  if (TERN0(POWER_LOSS_JOURNAL, write_journal())) return true;
 
   open(false);
   file.seekSet(0);
-  const int16_t ret = file.write(&info, sizeof(info));
+  int16_t ret = file.write(&info, sizeof(info));
+
+  #if ENABLED(POWER_LOSS_JOURNAL)
+    // Allocate the ring with empty entries
+    journal_seq = 0;
+    if (ret != -1) {
+      job_recovery_journal_t j;
+      memset(&j, 0, sizeof(j));
+      LOOP_L_N(n, POWER_LOSS_JOURNAL_SIZE) if (file.write(&j, sizeof(j)) == -1) { ret = -1; break; }
+    }
+  #endif
+
   if (ret == -1) DEBUG_ECHOLNPGM("Power-loss file write failed.");
-  if (!file.close()) DEBUG_ECHOLNPGM("Power-loss file close failed.");
+  if (!file.close()) {
+    DEBUG_ECHOLNPGM("Power-loss file close failed.");
+    return false;
+  }
+  #if ENABLED(POWER_LOSS_JOURNAL)
+    else if (ret != -1) { memcpy(&journal_base, &info, sizeof(info)); journal_seq = 1; }
+  #endif
+  return ret != -1;
 }
 
+#if ENABLED(POWER_LOSS_FAST_RESUME)
+
+  /**
+   * Wait for the hotends to get hot enough to free the nozzle from the
+   * print, while they go on heating to the print temperature.
+   */
+  static void wait_for_soft_hotends() {
+    #if DISABLED(BUSY_WHILE_HEATING) && ENABLED(HOST_KEEPALIVE_FEATURE)
+      KEEPALIVE_STATE(NOT_BUSY);
+    #endif
+    millis_t next_temp_ms = 0;
+    wait_for_heatup = true;
+    while (wait_for_heatup) {
+      bool soft = true;
+      HOTEND_LOOP() {
+        const celsius_t et = thermalManager.degTargetHotend(e);
+        if (et && thermalManager.degHotend(e) < _MIN(et, 180)) soft = false;
+      }
+      if (soft) break;
+      const millis_t ms = millis();
+      if (ELAPSED(ms, next_temp_ms)) {
+        next_temp_ms = ms + 1000UL;
+        thermalManager.print_heater_states(active_extruder);
+        SERIAL_EOL();
+      }
+      idle();
+      gcode.reset_stepper_timeout();
+    }
+    wait_for_heatup = false;
+  }
+
+#endif
+
 /**
  * Resume the saved print job
  */
@@ -362,6 +596,24 @@ void PrintJobRecovery::resume() {
 
   #if HAS_HEATED_BED
     const celsius_t bt = info.target_temperature_bed;
+  #endif
+
+  #if ENABLED(POWER_LOSS_FAST_RESUME)
+
+    // Start all the heaters at once. The bed comes up to temperature while homing.
+    TERN_(HAS_HEATED_BED, thermalManager.setTargetBed(bt));
+    HOTEND_LOOP() thermalManager.setTargetHotend(info.target_temperature[e], e);
+
+    // Open the file and seek to the resume point while heating
+    sprintf_P(cmd, M23_STR, info.sd_filename);
+    gcode.process_subcommands_now(cmd);
+    card.setIndex(resume_sdpos);
+
+    wait_for_soft_hotends();
+
+  #else
+
+  #if HAS_HEATED_BED
     if (bt) {
       // Restore the bed temperature
       sprintf_P(cmd, PSTR("M190S%i"), bt);
@@ -384,6 +636,8 @@ void PrintJobRecovery::resume() {
     }
   #endif
 
+  #endif // !POWER_LOSS_FAST_RESUME
+
   // Interpret the saved Z according to flags
   const float z_print = info.current_position.z,
               z_raised = z_print + info.zraise;
@@ -428,7 +682,10 @@ void PrintJobRecovery::resume() {
     }
 
     // Home XY with no Z raise
-    gcode.process_subcommands_now(F("G28R0XY")); // No raise during G28
+    #if ENABLED(POWER_LOSS_FAST_RESUME)
+      if (axes_should_home(_BV(X_AXIS) | _BV(Y_AXIS))) // Skip if XY are still trusted
+    #endif
+        gcode.process_subcommands_now(F("G28R0XY")); // No raise during G28
 
   #endif
 
@@ -544,6 +801,14 @@ void PrintJobRecovery::resume() {
     gcode.process_subcommands_now(F("G12"));
   #endif
 
+  #if BOTH(POWER_LOSS_FAST_RESUME, HAS_HEATED_BED)
+    // The hotends were primed without waiting for the bed
+    if (bt) {
+      sprintf_P(cmd, PSTR("M190S%i"), bt);
+      gcode.process_subcommands_now(cmd);
+    }
+  #endif
+
   // Move back over to the saved XY
   sprintf_P(cmd, PSTR("G1X%sY%sF3000"),
     dtostrf(info.current_position.x, 1, 3, str_1),
@@ -582,9 +847,11 @@ void PrintJobRecovery::resume() {
   enable(true);
 
   // Resume the SD file from the last position
-  char *fn = info.sd_filename;
-  sprintf_P(cmd, M23_STR, fn);
-  gcode.process_subcommands_now(cmd);
+  #if DISABLED(POWER_LOSS_FAST_RESUME)
+    char *fn = info.sd_filename;
+    sprintf_P(cmd, M23_STR, fn);
+    gcode.process_subcommands_now(cmd);
+  #endif
   sprintf_P(cmd, PSTR("M24S%ldT%ld"), resume_sdpos, info.print_job_elapsed);
   gcode.process_subcommands_now(cmd);
 
@@ -30,6 +30,10 @@
 
 #include "../inc/MarlinConfig.h"
 
+#if HAS_POWER_LOSS_LAYER_SAVE
+  #include "layer_events.h"
+#endif
+
 #if ENABLED(GCODE_REPEAT_MARKERS)
   #include "../feature/repeat.h"
 #endif
@@ -134,6 +138,36 @@ typedef struct {
 
 } job_recovery_info_t;
 
+#if ENABLED(POWER_LOSS_JOURNAL)
+
+  // The recovery data that changes during a print, saved after
+  // the full job_recovery_info_t without rewriting the rest.
+  typedef struct {
+    uint32_t seq;                 // Counts up from 1 after each full save
+    uint8_t valid_head;           // valid_head of the full save it belongs to
+
+    uint32_t sdpos;
+    xyze_pos_t current_position;
+    uint16_t feedrate;
+    float zraise;
+    bool raised;
+    millis_t print_job_elapsed;
+
+    #if HAS_HOTEND
+      celsius_t target_temperature[HOTENDS];
+    #endif
+    #if HAS_HEATED_BED
+      celsius_t target_temperature_bed;
+    #endif
+    #if HAS_FAN
+      uint8_t fan_speed[FAN_COUNT];
+    #endif
+
+    uint32_t crc;                 // CRC of the fields above
+  } job_recovery_journal_t;
+
+#endif
+
 class PrintJobRecovery {
   public:
     static const char filename[5];
@@ -162,6 +196,7 @@ class PrintJobRecovery {
           SET_INPUT(POWER_LOSS_PIN);
         #endif
       #endif
+      TERN_(HAS_POWER_LOSS_LAYER_SAVE, layer_events.subscribe(layer_changed));
     }
 
     // Track each command's file offsets
@@ -173,7 +208,7 @@ class PrintJobRecovery {
     static void changed();
 
     static bool exists() { return card.jobRecoverFileExists(); }
-    static void open(const bool read) { card.openJobRecoveryFile(read); }
+    static void open(const bool read OPTARG(POWER_LOSS_JOURNAL, const bool amend=false)) { card.openJobRecoveryFile(read OPTARG(POWER_LOSS_JOURNAL, amend)); }
     static void close() { file.close(); }
 
     static bool check();
@@ -183,7 +218,7 @@ class PrintJobRecovery {
     static void cancel() { purge(); }
 
     static void load();
-    static void save(const bool force=ENABLED(SAVE_EACH_CMD_MODE), const float zraise=POWER_LOSS_ZRAISE, const bool raised=false);
+    static void save(const bool force=EITHER(SAVE_EACH_CMD_MODE, POWER_LOSS_BACKUP_SRAM), const float zraise=POWER_LOSS_ZRAISE, const bool raised=false);
 
     #if PIN_EXISTS(POWER_LOSS)
       static void outage() {
@@ -211,6 +246,29 @@ class PrintJobRecovery {
 
   private:
     static void write();
+    static bool write_file();
+
+    #if HAS_POWER_LOSS_LAYER_SAVE
+      // Save at the start of each layer, instead of on each rise in Z
+      static void layer_changed(const layer_event_t&) { if (enabled && IS_SD_PRINTING()) save(true); }
+    #endif
+
+    #if ENABLED(POWER_LOSS_BACKUP_SRAM)
+      static uint32_t backup_seq;               //!< Sequence number of the last backup, 0 to look it up
+      static void write_backup();
+      static void clear_backup();
+      static bool commit_backup();
+    #endif
+
+    #if ENABLED(POWER_LOSS_JOURNAL)
+      static job_recovery_info_t journal_base;  //!< The last full save
+      static uint32_t journal_seq;              //!< Sequence number of the next entry, 0 for a full save next
+      static void journal_fill(job_recovery_journal_t &j, const job_recovery_info_t &i);
+      static void journal_apply(job_recovery_info_t &i, const job_recovery_journal_t &j);
+      static uint32_t journal_crc(const job_recovery_journal_t &j);
+      static bool write_journal();
+      static void load_journal();
+    #endif
 
     #if ENABLED(BACKUP_POWER_SUPPLY)
       static void retract_and_lift(const_float_t zraise);
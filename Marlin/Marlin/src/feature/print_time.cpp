@@ -0,0 +1,165 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * Print Time Estimate
+ *
+ * For a file without M73, one block of each of PRINT_TIME_SECTIONS equal
+ * sections of the print file is read in the background, and the G0/G1 moves
+ * in it are timed by length and feedrate. That gives the seconds per byte of
+ * each part of the file, so dense and sparse sections are told apart. The
+ * print's own elapsed time, measured against the sampled time of the part
+ * already printed, corrects for acceleration and anything else the samples
+ * can't see.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(PRINT_TIME_ESTIMATE)
+
+#include "print_time.h"
+#include "../module/printcounter.h"
+#include "../sd/cardreader.h"
+
+#define SCALE_MIN_SEC 60  // Sampled seconds to print before the measured scale is used
+
+PrintTimeEstimate print_estimate;
+
+float PrintTimeEstimate::density[PRINT_TIME_SECTIONS],
+      PrintTimeEstimate::total_est,
+      PrintTimeEstimate::scale,
+      PrintTimeEstimate::cal_sec, PrintTimeEstimate::cal_est;
+uint32_t PrintTimeEstimate::file_size;
+uint8_t PrintTimeEstimate::sampled;
+bool PrintTimeEstimate::measured;
+
+void PrintTimeEstimate::reset() {
+  ZERO(density);
+  total_est = cal_sec = cal_est = 0;
+  scale = 1;
+  file_size = card.isFileOpen() ? card.getFileSize() : 0;
+  sampled = 0;
+  measured = false;
+}
+
+// Seconds per byte of one block of the file, from the G0/G1 moves in it
+float PrintTimeEstimate::sample(const uint32_t pos, const uint32_t len) {
+  char buf[513];
+  const int16_t n = card.job_read(pos, buf, _MIN(len, uint32_t(sizeof(buf) - 1)));
+  if (n <= 0) return 0;
+  buf[n] = '\0';
+
+  // Start on a whole line, unless this is the start of the file
+  char *line = buf;
+  if (pos) { line = strchr(buf, '\n'); if (!line) return 0; line++; }
+  const char * const first = line;
+
+  xyz_pos_t p;
+  p.reset();
+  bool known = false;
+  float feedrate = 0, secs = 0;
+  while (char * const eol = strchr(line, '\n')) {
+    *eol = '\0';
+    while (*line == ' ') line++;
+    if (line[0] == 'G' && (line[1] == '0' || line[1] == '1') && !NUMERIC(line[2])) {
+      xyz_pos_t q = p;
+      bool moved = false;
+      for (char *w = line + 2; *w && *w != ';'; w++) {
+        switch (*w) {
+          case 'X': q.x = strtof(w + 1, &w); moved = true; w--; break;
+          case 'Y': q.y = strtof(w + 1, &w); moved = true; w--; break;
+          case 'Z': q.z = strtof(w + 1, &w); moved = true; w--; break;
+          case 'F': feedrate = strtof(w + 1, &w); w--; break;
+        }
+      }
+      // The first move of the block only gives the position to measure from
+      if (moved && known && feedrate > 0) secs += (q - p).magnitude() * 60 / feedrate;
+      if (moved) { p = q; known = true; }
+    }
+    line = eol + 1;
+  }
+  return line > first ? secs / (line - first) : 0;
+}
+
+// Sampled seconds from one file offset to another
+float PrintTimeEstimate::estimate(const uint32_t from, const uint32_t to) {
+  const float section = float(file_size) / (PRINT_TIME_SECTIONS);
+  float secs = 0;
+  LOOP_L_N(s, PRINT_TIME_SECTIONS) {
+    const float start = s * section, end = start + section,
+                a = _MAX(start, float(from)), b = _MIN(end, float(to));
+    if (b > a) secs += (b - a) * density[s];
+  }
+  return secs;
+}
+
+// Compare the time the print has taken with its sampled time
+void PrintTimeEstimate::update_scale(const uint32_t pos) {
+  const float elapsed = print_job_timer.duration(), est = estimate(0, pos);
+  if (!cal_est) {
+    // Measure from the first move, leaving out the heat-up before it
+    if (est > 0) { cal_sec = elapsed; cal_est = est; }
+    return;
+  }
+  if (est - cal_est >= SCALE_MIN_SEC) {
+    const float s = (elapsed - cal_sec) / (est - cal_est);
+    scale = measured ? scale + (s - scale) * 0.25f : s;
+    measured = true;
+  }
+}
+
+uint32_t PrintTimeEstimate::remaining() {
+  if (!ready() || !card.isFileOpen()) return 0;
+  return LROUND(estimate(card.getIndex(), file_size) * scale);
+}
+
+float PrintTimeEstimate::done() {
+  if (!ready() || !card.isFileOpen()) return 0;
+  return estimate(0, card.getIndex()) / total_est;
+}
+
+void PrintTimeEstimate::task() {
+  if (!card.isFileOpen()) { if (file_size) reset(); return; }
+  if (card.getFileSize() != file_size) reset();
+
+  // Sample one section per call until they are all done
+  if (sampled < PRINT_TIME_SECTIONS) {
+    const uint32_t start = uint64_t(file_size) * sampled / (PRINT_TIME_SECTIONS),
+                   end = uint64_t(file_size) * (sampled + 1) / (PRINT_TIME_SECTIONS);
+    density[sampled++] = sample(start, end - start);
+    if (sampled == PRINT_TIME_SECTIONS) total_est = estimate(0, file_size);
+    return;
+  }
+
+  static millis_t next_ms;
+  const millis_t ms = millis();
+  if (PENDING(ms, next_ms)) return;
+  next_ms = ms + 10000UL;
+  if (card.isPrinting()) update_scale(card.getIndex());
+}
+
+void PrintTimeEstimate::report() {
+  if (!ready()) return;
+  SERIAL_ECHOLNPGM("Print time left: ", remaining(), "s done: ", LROUND(done() * 100), "%");
+}
+
+#endif // PRINT_TIME_ESTIMATE
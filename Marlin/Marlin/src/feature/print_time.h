@@ -0,0 +1,54 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * print_time.h - Print time estimate from samples of the print file
+ */
+
+#include "../inc/MarlinConfig.h"
+
+class PrintTimeEstimate {
+public:
+  static void task();                     // Called from idle()
+  static void reset();                    // Start again for a newly opened file
+  static void report();                   // Append the estimate to M27
+
+  static bool ready() { return total_est > 0; }
+  static uint32_t remaining();            // Seconds left, 0 if not known
+  static float done();                    // Fraction of the print time that's done
+
+private:
+  static float density[PRINT_TIME_SECTIONS], // Seconds of motion per byte in each section
+               total_est,                 // Sampled seconds for the whole file
+               scale,                     // Measured seconds per sampled second
+               cal_sec, cal_est;          // Elapsed time and sampled seconds where measuring began
+  static uint32_t file_size;
+  static uint8_t sampled;                 // Sections sampled so far
+  static bool measured;                   // The scale has been measured
+
+  static float sample(const uint32_t pos, const uint32_t len);
+  static float estimate(const uint32_t from, const uint32_t to);
+  static void update_scale(const uint32_t pos);
+};
+
+extern PrintTimeEstimate print_estimate;
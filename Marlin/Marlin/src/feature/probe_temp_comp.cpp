@@ -173,12 +173,17 @@ bool ProbeTempComp::finish_calibration(const TempSensorID tsi) {
 
 void ProbeTempComp::apply_compensation(float &meas_z) {
   if (!enabled) return;
+  #if ENABLED(PTC_BED_SOAK)
+    // Refer the bed to its target, not PTC_BED_START, so points probed during heat-up agree
+    const celsius_t bed_target = thermalManager.degTargetBed();
+    if (bed_target) meas_z += get_offset(TSI_BED, bed_target) / 1000.0f;
+  #endif
   TERN_(PTC_BED,    compensate_measurement(TSI_BED,   thermalManager.degBed(),     meas_z));
   TERN_(PTC_PROBE,  compensate_measurement(TSI_PROBE, thermalManager.degProbe(),   meas_z));
   TERN_(PTC_HOTEND, compensate_measurement(TSI_EXT,   thermalManager.degHotend(0), meas_z));
 }
 
-void ProbeTempComp::compensate_measurement(const TempSensorID tsi, const celsius_t temp, float &meas_z) {
+float ProbeTempComp::get_offset(const TempSensorID tsi, const celsius_t temp) {
   const uint8_t measurements = cali_info[tsi].measurements;
   const celsius_t start_temp = cali_info[tsi].start_temp,
                   res_temp = cali_info[tsi].temp_resolution,
@@ -216,8 +221,12 @@ void ProbeTempComp::compensate_measurement(const TempSensorID tsi, const celsius
       offset = linear_interp(temp, tpoint(idx), tpoint(idx + 1));
     }
 
+  return offset;
+}
+
+void ProbeTempComp::compensate_measurement(const TempSensorID tsi, const celsius_t temp, float &meas_z) {
   // convert offset to mm and apply it
-  meas_z -= offset / 1000.0f;
+  meas_z -= get_offset(tsi, temp) / 1000.0f;
 }
 
 bool ProbeTempComp::linear_regression(const TempSensorID tsi, float &k, float &d) {
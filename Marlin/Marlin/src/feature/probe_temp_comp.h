@@ -110,6 +110,9 @@ class ProbeTempComp {
      */
     static bool linear_regression(const TempSensorID tsi, float &k, float &d);
 
+    // Interpolated Z offset (in µm) for a sensor temperature
+    static float get_offset(const TempSensorID tsi, const celsius_t temp);
+
     static void compensate_measurement(const TempSensorID tsi, const celsius_t temp, float &meas_z);
 };
 
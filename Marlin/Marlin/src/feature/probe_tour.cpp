@@ -0,0 +1,70 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(PROBE_TOUR)
+
+#include "probe_tour.h"
+
+static inline float travel(const xy_pos_t &a, const xy_pos_t &b) { return (b - a).magnitude(); }
+static inline void swap_index(uint8_t &a, uint8_t &b) { const uint8_t t = a; a = b; b = t; }
+
+void probe_tour(const xy_pos_t &start, const xy_pos_t pts[], uint8_t order[], const uint8_t count) {
+  LOOP_L_N(i, count) order[i] = i;
+
+  // Nearest neighbour from the start
+  xy_pos_t from = start;
+  LOOP_L_N(i, count) {
+    uint8_t best = i;
+    float best_d = travel(from, pts[order[i]]);
+    LOOP_S_L_N(j, i + 1, count) {
+      const float d = travel(from, pts[order[j]]);
+      if (d < best_d) { best_d = d; best = j; }
+    }
+    swap_index(order[i], order[best]);
+    from = pts[order[i]];
+  }
+
+  // 2-opt on the open path: reverse order[i..j] while that shortens the tour.
+  // Each reversal must gain at least 0.01mm so the loop always ends.
+  for (bool improved = count > 1; improved;) {
+    improved = false;
+    LOOP_L_N(i, count - 1) {
+      LOOP_S_L_N(j, i + 1, count) {
+        const xy_pos_t &a = i ? pts[order[i - 1]] : start, &b = pts[order[i]], &c = pts[order[j]];
+        float before = travel(a, b), after = travel(a, c);
+        if (j < count - 1) {
+          const xy_pos_t &d = pts[order[j + 1]];
+          before += travel(c, d);
+          after += travel(b, d);
+        }
+        if (after < before - 0.01f) {
+          for (uint8_t l = i, r = j; l < r; l++, r--) swap_index(order[l], order[r]);
+          improved = true;
+        }
+      }
+    }
+  }
+}
+
+#endif // PROBE_TOUR
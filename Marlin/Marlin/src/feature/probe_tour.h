@@ -0,0 +1,36 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * probe_tour.h - Order a set of probe points for the least XY travel
+ */
+
+#include "../inc/MarlinConfigPre.h"
+#include "../core/types.h"
+
+/**
+ * Fill order[] with the indexes of pts[] in visiting order, starting from the
+ * probe position 'start' (the nozzle position plus the probe XY offset).
+ * A nearest-neighbour tour is refined by 2-opt until no reversal shortens it.
+ */
+void probe_tour(const xy_pos_t &start, const xy_pos_t pts[], uint8_t order[], const uint8_t count);
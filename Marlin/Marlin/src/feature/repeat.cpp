@@ -37,12 +37,29 @@
 repeat_marker_t Repeat::marker[MAX_REPEAT_NESTING];
 uint8_t Repeat::index;
 
+#if ENABLED(REPEAT_CACHE)
+  uint8_t Repeat::cache[REPEAT_CACHE_SIZE];
+  uint16_t Repeat::cache_w, Repeat::cache_r;
+  uint32_t Repeat::cache_sdpos;
+  int8_t Repeat::cache_marker = -1;
+  bool Repeat::replaying; // = false
+
+  // Each entry is a size byte (0 for a token), the start sdpos, and the token or line
+  #define CACHE_HEADER (1 + sizeof(uint32_t))
+#endif
+
 void Repeat::add_marker(const uint32_t sdpos, const uint16_t count) {
   if (index >= MAX_REPEAT_NESTING)
     SERIAL_ECHO_MSG("!Too many markers.");
   else {
     marker[index].sdpos = sdpos;
     marker[index].counter = count ?: -1;
+    #if ENABLED(REPEAT_CACHE)
+      // Only the innermost loop is cached, so a nested marker starts over
+      cache_marker = index;
+      cache_w = 0;
+      cache_sdpos = sdpos;
+    #endif
     index++;
     DEBUG_ECHOLNPGM("Add Marker ", index, " at ", sdpos, " (", count, ")");
   }
@@ -56,9 +73,21 @@ void Repeat::loop() {
     if (!marker[ind].counter) {         // Did its counter run out?
       DEBUG_ECHOLNPGM("Pass Marker ", index);
       index--;                          //  Carry on. Previous marker on the next 'M808'.
+      TERN_(REPEAT_CACHE, drop_cache());
     }
     else {
-      card.setIndex(marker[ind].sdpos); // Loop back to the marker.
+      #if ENABLED(REPEAT_CACHE)
+        if (cache_marker == ind && cache_w) {
+          replaying = true;             // Replay the loop body from the cache.
+          cache_r = 0;                  // The file stays just after this 'M808'.
+        }
+        else {
+          drop_cache();
+          card.setIndex(marker[ind].sdpos);
+        }
+      #else
+        card.setIndex(marker[ind].sdpos); // Loop back to the marker.
+      #endif
       if (marker[ind].counter > 0)      // Ignore a negative (or zero) counter.
         --marker[ind].counter;          // Decrement the counter. If zero this 'M808' will be skipped next time.
       DEBUG_ECHOLNPGM("Goto Marker ", index, " at ", marker[ind].sdpos, " (", marker[ind].counter, ")");
@@ -66,6 +95,74 @@ void Repeat::loop() {
   }
 }
 
+#if ENABLED(REPEAT_CACHE)
+
+  void Repeat::cache_command(const char * const cmd
+    OPTARG(GCODE_TOKEN_QUEUE, const GCodeParser::token_t * const token)
+    , const uint32_t sdpos
+  ) {
+    if (cache_marker < 0 || replaying || is_command_M808((char*)cmd)) return;
+
+    #if ENABLED(GCODE_TOKEN_QUEUE)
+      const uint8_t size = token ? 0 : strlen(cmd) + 1;
+      const uint16_t bytes = CACHE_HEADER + (token ? sizeof(*token) : size);
+    #else
+      const uint8_t size = strlen(cmd) + 1;
+      const uint16_t bytes = CACHE_HEADER + size;
+    #endif
+
+    if (cache_w + bytes > REPEAT_CACHE_SIZE) {
+      DEBUG_ECHOLNPGM("Loop body too big to cache");
+      return drop_cache();
+    }
+
+    uint8_t *p = &cache[cache_w];
+    *p = size;
+    memcpy(p + 1, &cache_sdpos, sizeof(cache_sdpos));
+    #if ENABLED(GCODE_TOKEN_QUEUE)
+      if (token) memcpy(p + CACHE_HEADER, token, sizeof(*token)); else
+    #endif
+    memcpy(p + CACHE_HEADER, cmd, size);
+
+    cache_w += bytes;
+    cache_sdpos = sdpos;
+  }
+
+  bool Repeat::replay_command(cached_command_t &c) {
+    if (!replaying) return false;
+
+    // The end of the cached body acts as the closing 'M808'
+    if (cache_r >= cache_w) {
+      repeat_marker_t &m = marker[cache_marker];
+      if (!m.counter) {
+        DEBUG_ECHOLNPGM("Pass Cached Marker ", index);
+        index = cache_marker;
+        drop_cache();
+        return false;
+      }
+      if (m.counter > 0) --m.counter;
+      cache_r = 0;
+      DEBUG_ECHOLNPGM("Replay Marker ", index, " (", m.counter, ")");
+    }
+
+    const uint8_t *p = &cache[cache_r];
+    const uint8_t size = *p;
+    memcpy(&c.sdpos, p + 1, sizeof(c.sdpos));
+    #if ENABLED(GCODE_TOKEN_QUEUE)
+      if (!size) {
+        memcpy(&c.token, p + CACHE_HEADER, sizeof(c.token));
+        c.text = nullptr;
+        cache_r += CACHE_HEADER + sizeof(c.token);
+        return true;
+      }
+    #endif
+    c.text = (const char*)(p + CACHE_HEADER);
+    cache_r += CACHE_HEADER + size;
+    return true;
+  }
+
+#endif // REPEAT_CACHE
+
 void Repeat::cancel() { LOOP_L_N(i, index) marker[i].counter = 0; }
 
 void Repeat::early_parse_M808(char * const cmd) {
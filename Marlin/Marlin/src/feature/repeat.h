@@ -33,12 +33,31 @@ typedef struct {
   int16_t counter;  // The counter for looping
 } repeat_marker_t;
 
+#if ENABLED(REPEAT_CACHE)
+  typedef struct {
+    const char *text;               // The command line, or nullptr for a token
+    #if ENABLED(GCODE_TOKEN_QUEUE)
+      GCodeParser::token_t token;   // The tokenized command
+    #endif
+    uint32_t sdpos;                 // The file position of the command
+  } cached_command_t;
+#endif
+
 class Repeat {
 private:
   static repeat_marker_t marker[MAX_REPEAT_NESTING];
   static uint8_t index;
+
+  #if ENABLED(REPEAT_CACHE)
+    static uint8_t cache[REPEAT_CACHE_SIZE]; // Commands of the innermost loop body
+    static uint16_t cache_w, cache_r;        // Write and replay positions
+    static uint32_t cache_sdpos;             // File position after the last cached command
+    static int8_t cache_marker;              // The marker being cached, or -1
+    static bool replaying;                   // Commands come from the cache instead of the file
+  #endif
+
 public:
-  static void reset() { index = 0; }
+  static void reset() { index = 0; TERN_(REPEAT_CACHE, drop_cache()); }
   static bool is_active() {
     LOOP_L_N(i, index) if (marker[i].counter) return true;
     return false;
@@ -48,6 +67,20 @@ public:
   static void add_marker(const uint32_t sdpos, const uint16_t count);
   static void loop();
   static void cancel();
+
+  #if ENABLED(REPEAT_CACHE)
+    static bool is_replaying() { return replaying; }
+    static void drop_cache() { cache_marker = -1; replaying = false; }
+
+    // Keep a command read from the file, ending at 'sdpos'
+    static void cache_command(const char * const cmd
+      OPTARG(GCODE_TOKEN_QUEUE, const GCodeParser::token_t * const token)
+      , const uint32_t sdpos
+    );
+
+    // Get the next command of the loop body. Return false when the loop is done.
+    static bool replay_command(cached_command_t &c);
+  #endif
 };
 
 extern Repeat repeat;
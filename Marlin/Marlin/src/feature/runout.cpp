@@ -46,10 +46,16 @@ bool FilamentMonitorBase::enabled = true,
 #endif
 
 #if HAS_FILAMENT_RUNOUT_DISTANCE
-  float RunoutResponseDelayed::runout_distance_mm = FILAMENT_RUNOUT_DISTANCE_MM;
-  volatile float RunoutResponseDelayed::runout_mm_countdown[NUM_RUNOUT_SENSORS];
-  #if ENABLED(FILAMENT_MOTION_SENSOR)
-    uint8_t FilamentSensorEncoder::motion_detected;
+  #if ENABLED(FILAMENT_RUNOUT_COUNT_STEPS)
+    float RunoutResponseCounted::runout_distance_mm = FILAMENT_RUNOUT_DISTANCE_MM;
+    volatile uint32_t RunoutResponseCounted::e_steps[NUM_RUNOUT_SENSORS];
+    uint32_t RunoutResponseCounted::e_mark[NUM_RUNOUT_SENSORS];
+  #else
+    float RunoutResponseDelayed::runout_distance_mm = FILAMENT_RUNOUT_DISTANCE_MM;
+    volatile float RunoutResponseDelayed::runout_mm_countdown[NUM_RUNOUT_SENSORS];
+    #if ENABLED(FILAMENT_MOTION_SENSOR)
+      uint8_t FilamentSensorEncoder::motion_detected;
+    #endif
   #endif
 #else
   int8_t RunoutResponseDebounced::runout_count[NUM_RUNOUT_SENSORS]; // = 0
@@ -50,12 +50,13 @@ class TFilamentMonitor;
 class FilamentSensorEncoder;
 class FilamentSensorSwitch;
 class RunoutResponseDelayed;
+class RunoutResponseCounted;
 class RunoutResponseDebounced;
 
 /********************************* TEMPLATE SPECIALIZATION *********************************/
 
 typedef TFilamentMonitor<
-          TERN(HAS_FILAMENT_RUNOUT_DISTANCE, RunoutResponseDelayed, RunoutResponseDebounced),
+          TERN(HAS_FILAMENT_RUNOUT_DISTANCE, TERN(FILAMENT_RUNOUT_COUNT_STEPS, RunoutResponseCounted, RunoutResponseDelayed), RunoutResponseDebounced),
           TERN(FILAMENT_MOTION_SENSOR, FilamentSensorEncoder, FilamentSensorSwitch)
         > FilamentMonitor;
 
@@ -166,7 +167,8 @@ class FilamentSensorBase {
   protected:
     /**
      * Called by FilamentSensorSwitch::run when filament is detected.
-     * Called by FilamentSensorEncoder::block_completed when motion is detected.
+     * Called by FilamentSensorEncoder::block_completed when motion is detected,
+     * or by FilamentSensorEncoder::run with FILAMENT_RUNOUT_COUNT_STEPS.
      */
     static void filament_present(const uint8_t extruder) {
       runout.filament_present(extruder); // ...which calls response.filament_present(extruder)
@@ -252,7 +254,9 @@ class FilamentSensorBase {
    */
   class FilamentSensorEncoder : public FilamentSensorBase {
     private:
-      static uint8_t motion_detected;
+      #if DISABLED(FILAMENT_RUNOUT_COUNT_STEPS)
+        static uint8_t motion_detected;
+      #endif
 
       static void poll_motion_sensor() {
         static uint8_t old_state;
@@ -269,19 +273,28 @@ class FilamentSensorBase {
           }
         #endif
 
-        motion_detected |= change;
+        #if ENABLED(FILAMENT_RUNOUT_COUNT_STEPS)
+          // Mark the extruded length at the edge, without waiting for the block to end
+          LOOP_L_N(e, NUM_RUNOUT_SENSORS) if (TEST(change, e)) filament_present(e);
+        #else
+          motion_detected |= change;
+        #endif
       }
 
     public:
-      static void block_completed(const block_t * const b) {
-        // If the sensor wheel has moved since the last call to
-        // this method reset the runout counter for the extruder.
-        if (TEST(motion_detected, b->extruder))
-          filament_present(b->extruder);
-
-        // Clear motion triggers for next block
-        motion_detected = 0;
-      }
+      #if ENABLED(FILAMENT_RUNOUT_COUNT_STEPS)
+        static void block_completed(const block_t * const) {}
+      #else
+        static void block_completed(const block_t * const b) {
+          // If the sensor wheel has moved since the last call to
+          // this method reset the runout counter for the extruder.
+          if (TEST(motion_detected, b->extruder))
+            filament_present(b->extruder);
+
+          // Clear motion triggers for next block
+          motion_detected = 0;
+        }
+      #endif
 
       static void run() { poll_motion_sensor(); }
   };
@@ -378,6 +391,60 @@ class FilamentSensorBase {
       }
   };
 
+  #if ENABLED(FILAMENT_RUNOUT_COUNT_STEPS)
+
+    // RunoutResponseCounted is RunoutResponseDelayed with the work moved out
+    // of the Stepper ISR. Completed blocks only add their E steps to a running
+    // total, and filament_present marks the total. The length fed since the
+    // mark is converted and compared in the main loop.
+    class RunoutResponseCounted {
+      private:
+        static volatile uint32_t e_steps[NUM_RUNOUT_SENSORS];
+        static uint32_t e_mark[NUM_RUNOUT_SENSORS];
+
+        static float fed_mm(const uint8_t i) {
+          return int32_t(e_steps[i] - e_mark[i]) * planner.mm_per_step[E_AXIS_N(i)];
+        }
+
+      public:
+        static float runout_distance_mm;
+
+        static void reset() {
+          LOOP_L_N(i, NUM_RUNOUT_SENSORS) filament_present(i);
+        }
+
+        static void run() {
+          #if ENABLED(FILAMENT_RUNOUT_SENSOR_DEBUG)
+            static millis_t t = 0;
+            const millis_t ms = millis();
+            if (ELAPSED(ms, t)) {
+              t = millis() + 1000UL;
+              LOOP_L_N(i, NUM_RUNOUT_SENSORS)
+                SERIAL_ECHOF(i ? F(", ") : F("Remaining mm: "), runout_distance_mm - fed_mm(i));
+              SERIAL_EOL();
+            }
+          #endif
+        }
+
+        static uint8_t has_run_out() {
+          uint8_t runout_flags = 0;
+          LOOP_L_N(i, NUM_RUNOUT_SENSORS) if (fed_mm(i) > runout_distance_mm) SBI(runout_flags, i);
+          return runout_flags;
+        }
+
+        static void filament_present(const uint8_t extruder) {
+          e_mark[extruder] = e_steps[extruder];
+        }
+
+        static void block_completed(const block_t * const b) {
+          // Same move filter as RunoutResponseDelayed. Unsigned, so the total may wrap.
+          if (b->steps.x || b->steps.y || b->steps.z || did_pause_print)
+            e_steps[b->extruder] += TEST(b->direction_bits, E_AXIS) ? -b->steps.e : b->steps.e;
+        }
+    };
+
+  #endif
+
 #else // !HAS_FILAMENT_RUNOUT_DISTANCE
 
   // RunoutResponseDebounced triggers a runout event after a runout
@@ -0,0 +1,116 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(AUTO_REPORT_STATUS)
+
+#include "status_report.h"
+#include "../MarlinCore.h"
+#include "../module/temperature.h"
+#include "../module/motion.h"
+#include "../module/planner.h"
+#include "../module/endstops.h"
+#include "../module/printcounter.h"
+
+#if ENABLED(SDSUPPORT)
+  #include "../sd/cardreader.h"
+#endif
+
+#if HAS_FILAMENT_SENSOR
+  #include "runout.h"
+#endif
+
+#define STATUS_HEATERS (HOTENDS + ENABLED(HAS_HEATED_BED) + ENABLED(HAS_HEATED_CHAMBER))
+
+AutoReporter<StatusReport> status_auto_reporter;
+bool StatusReport::changes_only; // = false
+
+// All the fields as integers, so an unchanged machine compares equal
+typedef struct {
+  int16_t temp[_MAX(STATUS_HEATERS, 1)], target[_MAX(STATUS_HEATERS, 1)], power[_MAX(STATUS_HEATERS, 1)];
+  int32_t pos[LOGICAL_AXES];
+  uint16_t progress;
+  uint32_t print_time;
+  uint8_t print_state, moves, state, flags;
+} status_t;
+
+static status_t last_status;
+
+static void add_heater(status_t &s, uint8_t &h, const celsius_float_t temp, const celsius_t target, const heater_id_t id) {
+  s.temp[h] = int16_t(LROUND(temp * 10));
+  s.target[h] = int16_t(target * 10);
+  s.power[h] = thermalManager.getHeaterPower(id);
+  h++;
+}
+
+static void echo_heater(const status_t &s, const uint8_t h) {
+  SERIAL_ECHOPGM("=", s.temp[h], ",", s.target[h], ",", s.power[h]);
+}
+
+void StatusReport::report(const bool force/*=false*/) {
+  status_t s;
+  memset(&s, 0, sizeof(s));  // Clear the padding too
+
+  uint8_t h = 0;
+  HOTEND_LOOP() add_heater(s, h, thermalManager.degHotend(e), thermalManager.degTargetHotend(e), (heater_id_t)e);
+  TERN_(HAS_HEATED_BED, add_heater(s, h, thermalManager.degBed(), thermalManager.degTargetBed(), H_BED));
+  TERN_(HAS_HEATED_CHAMBER, add_heater(s, h, thermalManager.degChamber(), thermalManager.degTargetChamber(), H_CHAMBER));
+
+  const xyze_pos_t lpos = current_position.asLogical();
+  LOOP_LOGICAL_AXES(i) s.pos[i] = LROUND(lpos[i] * 1000);
+
+  #if ENABLED(SDSUPPORT)
+    s.progress = TERN(HAS_PRINT_PROGRESS_PERMYRIAD, card.permyriadDone(), card.percentDone() * 100U);
+  #endif
+  s.print_time = print_job_timer.duration();
+  s.print_state = print_job_timer.isRunning() ? 1 : print_job_timer.isPaused() ? 2 : 0;
+  s.moves = planner.movesplanned();
+  s.state = marlin_state;
+  s.flags = (wait_for_heatup ? 1 : 0)
+          | (TERN0(HAS_RESUME_CONTINUE, wait_for_user) ? 2 : 0)
+          | (endstops.trigger_state() ? 4 : 0)
+          | (TERN0(HAS_FILAMENT_SENSOR, runout.filament_ran_out) ? 8 : 0);
+
+  if (!force && changes_only && !memcmp(&s, &last_status, sizeof(s))) return;
+  last_status = s;
+
+  SERIAL_ECHOPGM("ST:");
+  h = 0;
+  HOTEND_LOOP() { SERIAL_ECHOPGM(" T", e); echo_heater(s, h++); }
+  #if HAS_HEATED_BED
+    SERIAL_ECHOPGM(" B"); echo_heater(s, h++);
+  #endif
+  #if HAS_HEATED_CHAMBER
+    SERIAL_ECHOPGM(" C"); echo_heater(s, h++);
+  #endif
+  LOOP_LOGICAL_AXES(i) SERIAL_ECHOPGM(" ", AS_CHAR(AXIS_CHAR(i)), "=", s.pos[i]);
+  #if ENABLED(SDSUPPORT)
+    SERIAL_ECHOPGM(" SD=", s.progress);
+  #endif
+  SERIAL_ECHOLNPGM(
+    " PT=", s.print_time, " PS=", s.print_state,
+    " Q=", s.moves, " M=", s.state, " F=", s.flags
+  );
+}
+
+#endif // AUTO_REPORT_STATUS
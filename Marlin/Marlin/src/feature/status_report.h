@@ -0,0 +1,46 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * status_report.h - Compact machine status line for print farm hosts (M408)
+ *
+ *  ST: T0=2151,2150,64 B=601,600,20 X=120000 Y=80000 Z=2400 E=1532100 SD=4512 PT=1834 PS=1 Q=14 M=3 F=0
+ *
+ *  Tn, B, C  Heater temperature and target in 0.1°C, and heater power
+ *  X Y Z E   Logical position in µm
+ *  SD        Media print progress in 0.01%
+ *  PT PS     Print job time in seconds, and state (0 idle, 1 running, 2 paused)
+ *  Q         Moves in the planner
+ *  M         Marlin state (MarlinState)
+ *  F         Flags (1 waiting for heatup, 2 waiting for user, 4 endstop hit, 8 filament runout)
+ */
+
+#include "../inc/MarlinConfig.h"
+#include "../libs/autoreport.h"
+
+struct StatusReport {
+  static bool changes_only;   // Skip auto-reports that would repeat the last line
+  static void report(const bool force=false);
+};
+
+extern AutoReporter<StatusReport> status_auto_reporter;
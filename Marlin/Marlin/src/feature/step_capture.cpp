@@ -0,0 +1,72 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(STEP_CAPTURE)
+
+#include "step_capture.h"
+#include "../MarlinCore.h" // for idle()
+
+StepCapture step_capture;
+
+volatile bool StepCapture::armed; // = false
+StepCapture::entry_t StepCapture::buffer[STEP_CAPTURE_SIZE];
+uint16_t StepCapture::head, StepCapture::count; // = 0
+uint32_t StepCapture::overwritten; // = 0
+bool StepCapture::ring; // = false
+
+void StepCapture::start(const bool in_ring) {
+  armed = false;
+  head = count = 0;
+  overwritten = 0;
+  ring = in_ring;
+  armed = true;
+}
+
+void StepCapture::report() {
+  SERIAL_ECHOLNPGM("Step capture ", armed ? (ring ? "ring" : "armed") : "stopped",
+                   " entries:", count, "/", STEP_CAPTURE_SIZE, " overwritten:", overwritten);
+}
+
+/**
+ * Send a text header, 6 bytes per entry and a text footer:
+ *   stepcap:begin:<entries>:<cycles per second>:<axis letters, by bit>
+ *   <uint32 cycles LE><uint8 steps><uint8 dirs> ...
+ *   stepcap:end
+ */
+void StepCapture::dump() {
+  stop();
+  SERIAL_ECHOPGM("stepcap:begin:", count, ":", uint32_t(F_CPU), ":");
+  LOOP_LOGICAL_AXES(a) SERIAL_CHAR(axis_codes[a]);
+  SERIAL_EOL();
+  const uint16_t first = (head + STEP_CAPTURE_SIZE - count) % (STEP_CAPTURE_SIZE);
+  for (uint16_t n = 0, i = first; n < count; n++) {
+    const entry_t &e = buffer[i];
+    SERIAL_CHAR(char(e.time), char(e.time >> 8), char(e.time >> 16), char(e.time >> 24), char(e.steps), char(e.dirs));
+    if (++i == STEP_CAPTURE_SIZE) i = 0;
+    if ((n & 0x3F) == 0x3F) idle();
+  }
+  SERIAL_ECHOLNPGM("\nstepcap:end");
+}
+
+#endif // STEP_CAPTURE
@@ -0,0 +1,77 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * step_capture.h - Record a time stamp for every step event (D207)
+ *
+ * Each entry holds the DWT cycle count, the axes that stepped and the DIR bits
+ * (set for reverse) when the Stepper ISR started the pulses. With STEP_DMA the
+ * pulses come out when the DMA burst plays, a little later than recorded.
+ *
+ * buildroot/share/scripts/stepcap.py reads the dump and writes the position,
+ * velocity and acceleration of each axis to CSV.
+ */
+
+#include "../inc/MarlinConfig.h"
+#include "../HAL/shared/Delay.h"
+
+class StepCapture {
+public:
+  static volatile bool armed;
+
+  // Clear the buffer and record the next steps. In a ring, keep the newest entries until stop().
+  static void start(const bool ring);
+  static void stop() { armed = false; }
+
+  // Called by the Stepper ISR for each step event
+  static void record(const uint8_t steps, const uint8_t dirs) {
+    if (!steps) return;
+    entry_t &e = buffer[head];
+    e.time = get_cycle_count();
+    e.steps = steps;
+    e.dirs = dirs;
+    if (++head == STEP_CAPTURE_SIZE) head = 0;
+    if (count < STEP_CAPTURE_SIZE)
+      count++;
+    else if (!ring)
+      armed = false;
+    else
+      overwritten++;
+  }
+
+  static void report();   // State and entry count
+  static void dump();     // Stop, then send the entries, oldest first
+
+private:
+  typedef struct {
+    uint32_t time;        // CPU cycles, wrapping
+    uint8_t steps, dirs;  // Axis bits
+  } entry_t;
+
+  static entry_t buffer[STEP_CAPTURE_SIZE];
+  static uint16_t head, count;
+  static uint32_t overwritten;
+  static bool ring;
+};
+
+extern StepCapture step_capture;
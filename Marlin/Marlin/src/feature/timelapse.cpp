@@ -0,0 +1,118 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(TIMELAPSE)
+
+#include "timelapse.h"
+#include "../module/motion.h"
+#include "../module/printcounter.h"
+#include "../module/temperature.h"
+
+#if ENABLED(LINE_MERGE)
+  #include "line_merge.h"
+#endif
+
+#if ENABLED(PATH_BLENDING)
+  #include "path_blend.h"
+#endif
+
+#if HAS_FILAMENT_SENSOR
+  #include "runout.h"
+#endif
+
+#if ENABLED(HOST_ACTION_COMMANDS)
+  #include "host_actions.h"
+#endif
+
+Timelapse timelapse;
+
+bool Timelapse::enabled = ENABLED(TIMELAPSE_ENABLED_DEFAULT);
+uint16_t Timelapse::frames; // = 0
+block_t * volatile Timelapse::park_block; // = nullptr
+
+// Called before the first move of a layer is planned
+void Timelapse::layer_changed(const layer_event_t&) {
+  if (enabled && print_job_timer.isRunning()) capture();
+}
+
+void Timelapse::capture() {
+  // Plan any held moves, so current_position is the planned position
+  TERN_(LINE_MERGE, line_merge.flush());
+  TERN_(PATH_BLENDING, path_blend.flush());
+
+  const xyze_pos_t resume = current_position;
+  const bool retract = TIMELAPSE_RETRACT_MM > 0 && thermalManager.hotEnoughToExtrude(active_extruder);
+
+  // Retract, raise, and park, all planned behind the current moves
+  if (retract) {
+    current_position.e -= (TIMELAPSE_RETRACT_MM) / planner.e_factor[active_extruder];
+    line_to_current_position(TIMELAPSE_RETRACT_FEEDRATE);
+  }
+  if (TIMELAPSE_Z_RAISE > 0) {
+    current_position.z = _MIN(current_position.z + (TIMELAPSE_Z_RAISE), Z_MAX_POS);
+    line_to_current_position(homing_feedrate(Z_AXIS));
+  }
+
+  constexpr xy_pos_t park_pos = TIMELAPSE_PARK_POS;
+  const uint8_t head = planner.block_buffer_head;
+  current_position.set(park_pos.x, park_pos.y);
+  line_to_current_position(TIMELAPSE_PARK_FEEDRATE);
+
+  // The ISR fires the trigger when the last park block completes
+  if (planner.block_buffer_head != head) {
+    park_block = &planner.block_buffer[BLOCK_MOD(planner.block_buffer_head - 1)];
+    planner.synchronize();
+    park_block = nullptr;             // If the park was dropped by a quick stop
+  }
+  else {
+    planner.synchronize();            // Already parked
+    TERN_(HAS_TIMELAPSE_TRIGGER, WRITE(TIMELAPSE_TRIGGER_PIN, TIMELAPSE_TRIGGER_STATE));
+  }
+
+  TERN_(HOST_ACTION_COMMANDS, hostui.action(F("timelapse")));
+  frames++;
+
+  // Hold still for the shutter, then end the pulse
+  safe_delay(TIMELAPSE_SHUTTER_MS);
+  TERN_(HAS_TIMELAPSE_TRIGGER, WRITE(TIMELAPSE_TRIGGER_PIN, !(TIMELAPSE_TRIGGER_STATE)));
+
+  // Return to the start of the layer and recover
+  current_position.set(resume.x, resume.y);
+  line_to_current_position(TIMELAPSE_PARK_FEEDRATE);
+  if (current_position.z != resume.z) {
+    current_position.z = resume.z;
+    line_to_current_position(homing_feedrate(Z_AXIS));
+  }
+  if (retract) {
+    TERN_(HAS_FILAMENT_SENSOR, runout.reset());
+    current_position.e = resume.e;
+    line_to_current_position(TIMELAPSE_RETRACT_FEEDRATE);
+  }
+}
+
+void Timelapse::report() {
+  SERIAL_ECHOLNPGM("Timelapse ", enabled ? F("on") : F("off"), " layer Z:", layer_events.current.z, " frames:", frames);
+}
+
+#endif // TIMELAPSE
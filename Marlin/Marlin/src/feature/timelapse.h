@@ -0,0 +1,60 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * timelapse.h - Park the head and trigger a camera on each layer change
+ *
+ * Layer changes come from LayerEvents. The park is planned after the moves
+ * before it, and the stepper ISR fires the trigger as the park block
+ * completes, when the head stops at the park position.
+ */
+
+#include "../inc/MarlinConfig.h"
+#include "../module/planner.h"
+#include "layer_events.h"
+
+class Timelapse {
+public:
+  static bool enabled;
+
+  static void init() { layer_events.subscribe(layer_changed); }
+
+  // Called by the stepper ISR as each block completes
+  static void block_completed(const block_t * const b) {
+    if (b == park_block) {
+      park_block = nullptr;
+      TERN_(HAS_TIMELAPSE_TRIGGER, WRITE(TIMELAPSE_TRIGGER_PIN, TIMELAPSE_TRIGGER_STATE));
+    }
+  }
+
+  static void report();
+
+private:
+  static uint16_t frames;                   // Frames taken since boot
+  static block_t * volatile park_block;     // The block that ends at the park position
+
+  static void layer_changed(const layer_event_t &e);
+  static void capture();
+};
+
+extern Timelapse timelapse;
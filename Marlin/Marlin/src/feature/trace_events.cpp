@@ -0,0 +1,90 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(TRACE_EVENTS)
+
+#include "trace_events.h"
+#include "../MarlinCore.h" // for idle()
+
+TraceEvents trace_events;
+
+volatile bool TraceEvents::armed; // = false
+uint32_t TraceEvents::time[TRACE_EVENTS_SIZE];
+uint8_t TraceEvents::events[TRACE_EVENTS_SIZE];
+uint32_t TraceEvents::head; // = 0
+
+static const char * const trace_name[TRACE_IDS] = {
+  "queue.advance", "planner.buffer_line", "card.get", "ui.update", "thermal.task", "tft_queue.async"
+};
+
+const char* TraceEvents::name(const uint8_t event) {
+  const uint8_t id = event & ~(TRACE_END | TRACE_UI_TASK);
+  return id < TRACE_IDS ? trace_name[id] : "?";
+}
+
+uint16_t TraceEvents::latest(uint32_t * const t, uint8_t * const e, const uint16_t n) {
+  const uint16_t count = _MIN(head, uint32_t(_MIN(n, TRACE_EVENTS_SIZE)));
+  for (uint16_t c = 0; c < count; c++) {
+    const uint32_t i = (head - count + c) & (TRACE_EVENTS_SIZE - 1);
+    t[c] = time[i];
+    e[c] = events[i];
+  }
+  return count;
+}
+
+void TraceEvents::start() {
+  armed = false;
+  head = 0;
+  armed = true;
+}
+
+void TraceEvents::report() {
+  SERIAL_ECHOLNPGM("Trace ", armed ? "recording" : "stopped", " events:", head, " kept:", _MIN(head, uint32_t(TRACE_EVENTS_SIZE)), "/", TRACE_EVENTS_SIZE);
+}
+
+/**
+ * Send a text header, 5 bytes per event and a text footer:
+ *   trace:begin:<events>:<cycles per second>:<name of each ID, comma separated>
+ *   <uint32 cycles LE><uint8 id | 0x40 ui task | 0x80 end> ...
+ *   trace:end
+ * The oldest events may be the ends of scopes that began before them.
+ */
+void TraceEvents::dump() {
+  stop();
+  const uint32_t count = _MIN(head, uint32_t(TRACE_EVENTS_SIZE));
+  SERIAL_ECHOPGM("trace:begin:", count, ":", uint32_t(F_CPU), ":");
+  LOOP_L_N(t, TRACE_IDS) {
+    if (t) SERIAL_CHAR(',');
+    SERIAL_ECHO(trace_name[t]);
+  }
+  SERIAL_EOL();
+  for (uint32_t n = 0, i = head - count; n < count; n++, i++) {
+    const uint32_t t = time[i & (TRACE_EVENTS_SIZE - 1)];
+    SERIAL_CHAR(char(t), char(t >> 8), char(t >> 16), char(t >> 24), char(events[i & (TRACE_EVENTS_SIZE - 1)]));
+    if ((n & 0x3F) == 0x3F) idle();
+  }
+  SERIAL_ECHOLNPGM("\ntrace:end");
+}
+
+#endif // TRACE_EVENTS
@@ -0,0 +1,97 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * trace_events.h - Time stamped begin / end events of the main subsystems (D208)
+ *
+ * TRACE_SCOPE(id) at the top of a function records a begin event there and an
+ * end event when the scope closes. Each event is the DWT cycle count and one
+ * byte of ID and flags, kept in a ring that always holds the newest events.
+ * A slot is claimed with one atomic add, so any task or ISR may record.
+ *
+ * buildroot/share/scripts/trace2chrome.py turns the dump into a Chrome trace
+ * (JSON) for chrome://tracing or https://ui.perfetto.dev
+ */
+
+#include "../inc/MarlinConfig.h"
+#include "../HAL/shared/Delay.h"
+
+#if ENABLED(FF_RTOS_TASKS)
+  #include "../HAL/STM32/rtos_tasks.h"
+#endif
+
+enum TraceID : uint8_t {
+  TRACE_QUEUE_ADVANCE,    // GCodeQueue::advance(), the dispatch of one command
+  TRACE_BUFFER_LINE,      // Planner::buffer_line()
+  TRACE_SD_READ,          // CardReader::get() calls that start a new block
+  TRACE_UI_UPDATE,        // MarlinUI::update()
+  TRACE_TEMP_TASK,        // Temperature::task()
+  TRACE_TFT_ASYNC,        // TFT_Queue::async(), the Color UI render and DMA
+  TRACE_IDS
+};
+
+class TraceEvents {
+public:
+  static volatile bool armed;
+
+  // Record a begin event now and an end event at the end of the scope
+  class Scope {
+  public:
+    Scope(const TraceID id, const bool on=true) : id(on ? id : TRACE_IDS) { if (on) add(id); }
+    ~Scope() { if (id != TRACE_IDS) add(id | TRACE_END); }
+  private:
+    const TraceID id;
+  };
+
+  static void add(uint8_t event) {
+    if (!armed) return;
+    TERN_(FF_RTOS_TASKS, if (RTOSTasks::in_ui_task()) event |= TRACE_UI_TASK);
+    const uint32_t now = get_cycle_count(),
+                   i = __atomic_fetch_add(&head, 1, __ATOMIC_RELAXED) & (TRACE_EVENTS_SIZE - 1);
+    time[i] = now;
+    events[i] = event;
+  }
+
+  // Clear the ring and start recording
+  static void start();
+  static void stop() { armed = false; }
+
+  static void report();   // State and event count
+  static void dump();     // Stop, then send the events, oldest first
+
+  // Copy up to n of the newest events, oldest first. Return the number copied.
+  static uint16_t latest(uint32_t * const t, uint8_t * const e, const uint16_t n);
+  static const char* name(const uint8_t event);
+
+  static constexpr uint8_t TRACE_END = 0x80,      // Event flags, above the ID
+                           TRACE_UI_TASK = 0x40;  // Recorded by the ui task
+
+private:
+  static uint32_t time[TRACE_EVENTS_SIZE];        // CPU cycles, wrapping
+  static uint8_t events[TRACE_EVENTS_SIZE];       // ID and flags
+  static uint32_t head;                           // Events recorded since start()
+};
+
+extern TraceEvents trace_events;
+
+#define TRACE_SCOPE(ID) TraceEvents::Scope _trace_scope(ID)
@@ -0,0 +1,76 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(ASYNC_USER_WAIT)
+
+#include "user_wait.h"
+#include "../MarlinCore.h"
+#include "../lcd/marlinui.h"
+
+UserWait user_wait;
+
+bool UserWait::waiting; // = false
+millis_t UserWait::expire_ms; // = 0
+UserWait::resumeFunc_t UserWait::resume_fn; // = nullptr
+
+void UserWait::start(const millis_t ms, const resumeFunc_t resume) {
+  wait_for_user = true;
+  expire_ms = ms ? millis() + ms : 0;
+  resume_fn = resume;
+  waiting = true;
+}
+
+bool UserWait::finished() {
+  if (wait_for_user && !(expire_ms && ELAPSED(millis(), expire_ms))) return false;
+
+  // Let a click go before the next command, as wait_for_user_response() does
+  if (TERN0(HAS_MARLINUI_MENU, ui.button_pressed())) return false;
+
+  wait_for_user = waiting = false;
+  if (resume_fn) resume_fn();
+  return true;
+}
+
+bool UserWait::can_run(const char *cmd) {
+  // Skip a line number
+  while (*cmd == ' ') cmd++;
+  if (*cmd == 'N') {
+    do cmd++; while (NUMERIC(*cmd));
+    while (*cmd == ' ') cmd++;
+  }
+  if (*cmd != 'M' || !NUMERIC(cmd[1])) return false;
+
+  switch (atoi(cmd + 1)) {
+    case 27: case 31:             // SD and print job status
+    case 105: case 114: case 115: // Temperature, position, firmware info
+    case 119: case 154: case 155: // Endstops, auto-reports
+    case 408:                     // Status report
+    case 108: case 112: case 410: // End the wait, kill, quickstop
+    case 876:                     // Host prompt response
+      return true;
+  }
+  return false;
+}
+
+#endif // ASYNC_USER_WAIT
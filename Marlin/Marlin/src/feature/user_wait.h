@@ -0,0 +1,55 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * user_wait.h - M0/M1 user wait without a busy loop in the command
+ *
+ * The waiting command returns at once and leaves a continuation. The queue
+ * holds the commands after it until the user continues, running only status
+ * queries and the commands that end a wait, and then calls the continuation.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+class UserWait {
+public:
+  typedef void (*resumeFunc_t)();
+
+  // Wait for the user, or for ms to pass if set, then call resume
+  static void start(const millis_t ms, const resumeFunc_t resume);
+
+  // True while the queue must hold its commands. Ends the wait when the user continues.
+  static bool holding() { return waiting && !finished(); }
+
+  // Commands that can run during a wait
+  static bool can_run(const char *cmd);
+
+private:
+  static bool waiting;
+  static millis_t expire_ms;                // Time to give up waiting, or 0
+  static resumeFunc_t resume_fn;
+
+  static bool finished();
+};
+
+extern UserWait user_wait;
@@ -652,6 +652,10 @@ void GcodeSuite::G26() {
     return;
   }
 
+  // For the whole mesh go to the circle nearest the nozzle, not the one
+  // nearest the start, so the pattern doesn't cross the bed in rings.
+  TERN_(G26_STREAMED, if (g26_repeats > GRID_MAX_POINTS) g26.continue_with_closest = true);
+
   // Set a position with 'X' and/or 'Y'. Default: current_position
   g26.xy_pos.set(parser.seenval('X') ? RAW_X_POSITION(parser.value_linear_units()) : current_position.x,
                  parser.seenval('Y') ? RAW_Y_POSITION(parser.value_linear_units()) : current_position.y);
@@ -789,7 +793,7 @@ void GcodeSuite::G26() {
 
         g26.recover_filament(destination);
 
-        { REMEMBER(fr, feedrate_mm_s, PLANNER_XY_FEEDRATE() * 0.1f);
+        { REMEMBER(fr, feedrate_mm_s, TERN(G26_STREAMED, feedRate_t(G26_XY_FEEDRATE), PLANNER_XY_FEEDRATE() * 0.1f));
           plan_arc(endpoint, arc_offset, false, 0);  // Draw a counter-clockwise arc
           destination = current_position;
         }
@@ -834,7 +838,7 @@ void GcodeSuite::G26() {
           #endif
 
           g26.print_line_from_here_to_there(p, q);
-          SERIAL_FLUSH();   // Prevent host M105 buffer overrun.
+          IF_DISABLED(G26_STREAMED, SERIAL_FLUSH());   // Prevent host M105 buffer overrun.
         }
 
       #endif // !ARC_SUPPORT
@@ -843,7 +847,7 @@ void GcodeSuite::G26() {
       g26.connect_neighbor_with_line(location.pos,  1,  0);
       g26.connect_neighbor_with_line(location.pos,  0, -1);
       g26.connect_neighbor_with_line(location.pos,  0,  1);
-      planner.synchronize();
+      IF_DISABLED(G26_STREAMED, planner.synchronize()); // Streamed, the next circle is queued behind this one
       TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(location.pos, ExtUI::G26_POINT_FINISH));
       if (TERN0(HAS_MARLINUI_MENU, user_canceled())) goto LEAVE;
     }
@@ -859,6 +863,7 @@ void GcodeSuite::G26() {
   g26.retract_filament(destination);
   destination.z = Z_CLEARANCE_BETWEEN_PROBES;
   move_to(destination, 0);                                   // Raise the nozzle
+  TERN_(G26_STREAMED, planner.synchronize());                // Finish the queued pattern before the heaters go off
 
   #if DISABLED(NO_VOLUMETRICS)
     parser.volumetric_enabled = volumetric_was_enabled;
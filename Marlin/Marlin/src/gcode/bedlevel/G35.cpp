@@ -37,6 +37,10 @@
   #include "../../feature/bltouch.h"
 #endif
 
+#if ENABLED(PROBE_TOUR)
+  #include "../../feature/probe_tour.h"
+#endif
+
 #define DEBUG_OUT ENABLED(DEBUG_LEVELING_FEATURE)
 #include "../../core/debug_out.h"
 
@@ -100,8 +104,14 @@ void GcodeSuite::G35() {
 
   bool err_break = false;
 
+  #if ENABLED(PROBE_TOUR)
+    uint8_t order[G35_PROBE_COUNT];
+    probe_tour(xy_pos_t(current_position) + probe.offset_xy, tramming_points, order, G35_PROBE_COUNT);
+  #endif
+
   // Probe all positions
-  LOOP_L_N(i, G35_PROBE_COUNT) {
+  LOOP_L_N(n, G35_PROBE_COUNT) {
+    const uint8_t i = TERN(PROBE_TOUR, order[n], n);
 
     // In BLTOUCH HS mode, the probe travels in a deployed state.
     // Users of G35 might have a badly misaligned bed, so raise Z by the
@@ -37,6 +37,10 @@
   #include "../../lcd/extui/ui_api.h"
 #endif
 
+#if ENABLED(MESH_SLOTS)
+  #include "../../feature/bedlevel/mbl/mesh_slots.h"
+#endif
+
 //#define M420_C_USE_MEAN
 
 /**
@@ -51,6 +55,11 @@
  *   L[index]  Load UBL mesh from index (0 is default)
  *   T[map]    0:Human-readable 1:CSV 2:"LCD" 4:Compact
  *
+ * With MESH_SLOTS only:
+ *
+ *   W[index]  Save the mesh to an SD card slot, with an optional "name"
+ *   L[index]  Load the mesh from an SD card slot. 'L' alone lists the slots.
+ *
  * With mesh-based leveling only:
  *
  *   C         Center mesh on the mean of the lowest and highest
@@ -77,7 +86,7 @@ void GcodeSuite::M420() {
         bedlevel.z_values[x][y] = 0.001 * random(-200, 200);
         TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(x, y, bedlevel.z_values[x][y]));
       }
-      TERN_(AUTO_BED_LEVELING_BILINEAR, bedlevel.refresh_bed_level());
+      TERN_(HAS_MESH_REFRESH, bedlevel.refresh_bed_level());
       SERIAL_ECHOPGM("Simulated " STRINGIFY(GRID_MAX_POINTS_X) "x" STRINGIFY(GRID_MAX_POINTS_Y) " mesh ");
       SERIAL_ECHOPGM(" (", x_min);
       SERIAL_CHAR(','); SERIAL_ECHO(y_min);
@@ -136,6 +145,31 @@ void GcodeSuite::M420() {
 
   #endif // AUTO_BED_LEVELING_UBL
 
+  #if ENABLED(MESH_SLOTS)
+
+    // W to save the mesh to a slot
+    if (parser.seenval('W')) {
+      const uint8_t slot = parser.value_byte();
+      if (!mesh_slots.save(slot, TERN(GCODE_QUOTED_STRINGS, parser.string_arg, nullptr)))
+        SERIAL_ECHOLNPGM("?Unable to save mesh slot ", slot);
+    }
+
+    // L to load a mesh from a slot, or list the slots
+    if (parser.seen('L')) {
+      if (parser.has_value()) {
+        set_bed_leveling_enabled(false);
+        const uint8_t slot = parser.value_byte();
+        if (!mesh_slots.load(slot)) {
+          SERIAL_ECHOLNPGM("?Unable to load mesh slot ", slot);
+          return;
+        }
+      }
+      else
+        mesh_slots.report();
+    }
+
+  #endif // MESH_SLOTS
+
   const bool seenV = parser.seen_test('V');
 
   #if HAS_MESH
@@ -181,7 +215,7 @@ void GcodeSuite::M420() {
               bedlevel.z_values[x][y] -= zmean;
               TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(x, y, bedlevel.z_values[x][y]));
             }
-            TERN_(AUTO_BED_LEVELING_BILINEAR, bedlevel.refresh_bed_level());
+            TERN_(HAS_MESH_REFRESH, bedlevel.refresh_bed_level());
           }
 
         #endif
@@ -43,6 +43,10 @@
   #include "../../../libs/vector_3.h"
 #endif
 
+#if BOTH(AUTO_BED_LEVELING_3POINT, PROBE_TOUR)
+  #include "../../../feature/probe_tour.h"
+#endif
+
 #include "../../../lcd/marlinui.h"
 #if ENABLED(EXTENSIBLE_UI)
   #include "../../../lcd/extui/ui_api.h"
@@ -708,9 +712,16 @@ G29_TYPE GcodeSuite::G29() {
 
       // Probe at 3 arbitrary points
 
-      LOOP_L_N(i, 3) {
-        if (abl.verbose_level) SERIAL_ECHOLNPGM("Probing point ", i + 1, "/3.");
-        TERN_(HAS_STATUS_MESSAGE, ui.status_printf(0, F(S_FMT " %i/3"), GET_TEXT(MSG_PROBING_POINT), int(i + 1)));
+      #if ENABLED(PROBE_TOUR)
+        const xy_pos_t tour_pts[3] = { xy_pos_t(points[0]), xy_pos_t(points[1]), xy_pos_t(points[2]) };
+        uint8_t order[3];
+        probe_tour(xy_pos_t(current_position) + probe.offset_xy, tour_pts, order, 3);
+      #endif
+
+      LOOP_L_N(n, 3) {
+        const uint8_t i = TERN(PROBE_TOUR, order[n], n);
+        if (abl.verbose_level) SERIAL_ECHOLNPGM("Probing point ", n + 1, "/3.");
+        TERN_(HAS_STATUS_MESSAGE, ui.status_printf(0, F(S_FMT " %i/3"), GET_TEXT(MSG_PROBING_POINT), int(n + 1)));
 
         // Retain the last probe position
         abl.probePos = xy_pos_t(points[i]);
@@ -889,6 +900,7 @@ G29_TYPE GcodeSuite::G29() {
 
       // Auto Bed Leveling is complete! Enable if possible.
       if (abl.reenable) {
+        TERN_(FUSED_POSITION_TRANSFORM, planner.refresh_position_transform());
         planner.leveling_active = true;
         sync_plan_position();
       }
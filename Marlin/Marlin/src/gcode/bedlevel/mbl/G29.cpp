@@ -50,6 +50,37 @@
 // Save 130 bytes with non-duplication of PSTR
 inline void echo_not_entered(const char c) { SERIAL_CHAR(c); SERIAL_ECHOLNPGM(" not entered."); }
 
+#if ENABLED(MESH_REGION_PROBING)
+
+  // Mesh points to probe. The whole mesh unless G29 S1 was given a region.
+  static xy_uint8_t region_min, region_max;
+
+  static bool in_region(const uint8_t x, const uint8_t y) {
+    return WITHIN(x, region_min.x, region_max.x) && WITHIN(y, region_min.y, region_max.y);
+  }
+
+  static bool in_region(const uint8_t index) {
+    int8_t x, y;
+    bedlevel.zigzag(index, x, y);
+    return in_region(x, y);
+  }
+
+  // Move each point next to the region by half the mean change of its neighbors in the region
+  static void blend_around(const int8_t px, const int8_t py, const_float_t dz) {
+    for (int8_t x = px - 1; x <= px + 1; x++) {
+      if (!WITHIN(x, 0, (GRID_MAX_POINTS_X) - 1)) continue;
+      for (int8_t y = py - 1; y <= py + 1; y++) {
+        if (!WITHIN(y, 0, (GRID_MAX_POINTS_Y) - 1) || in_region(x, y)) continue;
+        const uint8_t nx = _MIN(x + 1, region_max.x) - _MAX(x - 1, region_min.x) + 1,
+                      ny = _MIN(y + 1, region_max.y) - _MAX(y - 1, region_min.y) + 1;
+        bedlevel.z_values[x][y] += dz / (2 * nx * ny);
+        TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(x, y, bedlevel.z_values[x][y]));
+      }
+    }
+  }
+
+#endif
+
 /**
  * G29: Mesh-based Z probe, probes a grid and produces a
  *      mesh to compensate for variable bed height
@@ -58,6 +89,8 @@ inline void echo_not_entered(const char c) { SERIAL_CHAR(c); SERIAL_ECHOLNPGM("
  *
  *  S0              Report the current mesh values
  *  S1              Start probing mesh points
+ *     L R F B      With MESH_REGION_PROBING and a valid mesh, only re-probe the
+ *                  points covering this region (mm). Omitted sides are the mesh edges.
  *  S2              Probe the next mesh point
  *  S3 In Jn Zn.nn  Manually modify a single point
  *  S4 Zn.nn        Set z offset. Positive away from bed, negative closer to bed.
@@ -100,7 +133,25 @@ void GcodeSuite::G29() {
       break;
 
     case MeshStart:
-      bedlevel.reset();
+      #if ENABLED(MESH_REGION_PROBING)
+        region_min.reset();
+        region_max.set((GRID_MAX_POINTS_X) - 1, (GRID_MAX_POINTS_Y) - 1);
+        if (parser.seen("LRFB") && leveling_is_valid()) {
+          const float l = parser.linearval('L', MESH_MIN_X), r = parser.linearval('R', MESH_MAX_X),
+                      f = parser.linearval('F', MESH_MIN_Y), b = parser.linearval('B', MESH_MAX_Y);
+          if (l > r || f > b) {
+            SERIAL_ECHOLNPGM("?Bad region.");
+            return;
+          }
+          // The corner points of all the cells the region touches
+          region_min.set(bedlevel.cell_index_x(l), bedlevel.cell_index_y(f));
+          region_max.set(bedlevel.cell_index_x(r) + 1, bedlevel.cell_index_y(b) + 1);
+        }
+        else
+          bedlevel.reset();
+      #else
+        bedlevel.reset();
+      #endif
       mbl_probe_index = 0;
       if (!ui.wait_for_move) {
         queue.inject(parser.seen_test('N') ? F("G28" TERN(CAN_SET_LEVELING_AFTER_G28, "L0", "") "\nG29S2") : F("G29S2"));
@@ -128,11 +179,20 @@ void GcodeSuite::G29() {
       }
       else {
         // Save Z for the previous mesh position
+        #if ENABLED(MESH_REGION_PROBING)
+          int8_t px, py;
+          bedlevel.zigzag(mbl_probe_index - 1, px, py);
+          blend_around(px, py, current_position.z - bedlevel.z_values[px][py]);
+        #endif
         bedlevel.set_zigzag_z(mbl_probe_index - 1, current_position.z);
         TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(ix, iy, current_position.z));
         TERN_(DWIN_LCD_PROUI, DWIN_MeshUpdate(_MIN(mbl_probe_index, GRID_MAX_POINTS), int(GRID_MAX_POINTS), current_position.z));
         SET_SOFT_ENDSTOP_LOOSE(false);
       }
+      #if ENABLED(MESH_REGION_PROBING)
+        // Skip the points outside the region
+        while (mbl_probe_index < (GRID_MAX_POINTS) && !in_region(mbl_probe_index)) mbl_probe_index++;
+      #endif
       // If there's another point to sample, move there with optional lift.
       if (mbl_probe_index < (GRID_MAX_POINTS)) {
         // Disable software endstops to allow manual adjustment
@@ -155,6 +215,7 @@ void GcodeSuite::G29() {
 
         // After recording the last point, activate home and activate
         mbl_probe_index = -1;
+        bedlevel.refresh_bed_level();
         SERIAL_ECHOLNPGM("Mesh probing done.");
         TERN_(HAS_STATUS_MESSAGE, LCD_MESSAGE(MSG_MESH_DONE));
         OKAY_BUZZ();
@@ -196,6 +257,7 @@ void GcodeSuite::G29() {
 
       if (parser.seenval('Z')) {
         bedlevel.z_values[ix][iy] = parser.value_linear_units();
+        bedlevel.refresh_bed_level();
         TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(ix, iy, bedlevel.z_values[ix][iy]));
         TERN_(DWIN_LCD_PROUI, DWIN_MeshUpdate(ix, iy, bedlevel.z_values[ix][iy]));
       }
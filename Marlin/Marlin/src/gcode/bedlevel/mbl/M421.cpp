@@ -52,8 +52,10 @@ void GcodeSuite::M421() {
     SERIAL_ERROR_MSG(STR_ERR_M421_PARAMETERS);
   else if (ix < 0 || iy < 0)
     SERIAL_ERROR_MSG(STR_ERR_MESH_XY);
-  else
+  else {
     bedlevel.set_z(ix, iy, parser.value_linear_units() + (hasQ ? bedlevel.z_values[ix][iy] : 0));
+    bedlevel.refresh_bed_level();
+  }
 }
 
 #endif // MESH_BED_LEVELING
@@ -40,6 +40,7 @@ void GcodeSuite::G29() {
   TERN_(FULL_REPORT_TO_HOST_FEATURE, set_and_report_grblstate(M_PROBE));
 
   bedlevel.G29();
+  TERN_(UBL_CELL_PLANES, bedlevel.refresh_bed_level());
 
   TERN_(FULL_REPORT_TO_HOST_FEATURE, set_and_report_grblstate(M_IDLE));
 }
@@ -33,6 +33,10 @@
 #include "../../module/probe.h"
 #include "../../lcd/marlinui.h" // for LCD_MESSAGE
 
+#if ENABLED(PROBE_TOUR)
+  #include "../../feature/probe_tour.h"
+#endif
+
 #if HAS_LEVELING
   #include "../../feature/bedlevel/bedlevel.h"
 #endif
@@ -201,6 +205,13 @@ void GcodeSuite::G34() {
       float z_measured_min;
       uint8_t iteration = 0;
       bool err_break = false; // To break out of nested loops
+
+      #if ENABLED(PROBE_TOUR)
+        // Plan the tour once, then run it backward on odd iterations
+        uint8_t order[NUM_Z_STEPPERS];
+        probe_tour(xy_pos_t(current_position) + probe.offset_xy, z_stepper_align.xy, order, NUM_Z_STEPPERS);
+      #endif
+
       while (iteration < z_auto_align_iterations) {
         if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("> probing all positions.");
 
@@ -219,7 +230,8 @@ void GcodeSuite::G34() {
         // Probe all positions (one per Z-Stepper)
         LOOP_L_N(i, NUM_Z_STEPPERS) {
           // iteration odd/even --> downward / upward stepper sequence
-          const uint8_t iprobe = (iteration & 1) ? NUM_Z_STEPPERS - 1 - i : i;
+          const uint8_t n = (iteration & 1) ? NUM_Z_STEPPERS - 1 - i : i,
+                        iprobe = TERN(PROBE_TOUR, order[n], n);
 
           // Safe clearance even on an incline
           if ((iteration == 0 || i > 0) && z_probe > current_position.z) do_blocking_move_to_z(z_probe);
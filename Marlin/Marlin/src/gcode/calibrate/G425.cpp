@@ -37,6 +37,11 @@
 #include "../../module/endstops.h"
 #include "../../feature/bedlevel/bedlevel.h"
 
+#if ENABLED(CALIBRATION_CONTINUOUS_SCAN)
+  #include "../../module/stepper.h"
+  #include "../../module/temperature.h"
+#endif
+
 #if !AXIS_CAN_CALIBRATE(X)
   #undef CALIBRATION_MEASURE_LEFT
   #undef CALIBRATION_MEASURE_RIGHT
@@ -193,18 +198,48 @@ inline bool read_calibration_pin() {
  *   fast         in - Fast vs. precise measurement
  */
 float measuring_movement(const AxisEnum axis, const int dir, const bool stop_state, const bool fast) {
-  const float step     = fast ? 0.25 : CALIBRATION_MEASUREMENT_RESOLUTION;
   const feedRate_t mms = fast ? MMM_TO_MMS(CALIBRATION_FEEDRATE_FAST) : MMM_TO_MMS(CALIBRATION_FEEDRATE_SLOW);
   const float limit    = fast ? 50 : 5;
 
   destination = current_position;
-  for (float travel = 0; travel < limit; travel += step) {
-    destination[axis] += dir * step;
-    do_blocking_move_to((xyz_pos_t)destination, mms);
+
+  #if ENABLED(CALIBRATION_CONTINUOUS_SCAN)
+
+    // Sweep the whole range in one move and poll the pin while it runs. The
+    // edge is taken from the steppers, so the resolution is one step plus the
+    // distance moved during one pass through this loop.
     planner.synchronize();
-    if (read_calibration_pin() == stop_state) break;
-  }
-  return destination[axis];
+    destination[axis] += dir * limit;
+    prepare_internal_move_to_destination(mms);
+
+    float measured_pos = destination[axis];
+    while (planner.busy()) {
+      if (read_calibration_pin() == stop_state) {
+        measured_pos = planner.get_axis_position_mm(axis);
+        planner.quick_stop();
+        break;
+      }
+      thermalManager.task();
+      hal.watchdog_refresh();
+    }
+
+    planner.synchronize();
+    set_current_from_steppers_for_axis(ALL_AXES_ENUM);
+    sync_plan_position();
+    return measured_pos;
+
+  #else
+
+    const float step = fast ? 0.25 : CALIBRATION_MEASUREMENT_RESOLUTION;
+    for (float travel = 0; travel < limit; travel += step) {
+      destination[axis] += dir * step;
+      do_blocking_move_to((xyz_pos_t)destination, mms);
+      planner.synchronize();
+      if (read_calibration_pin() == stop_state) break;
+    }
+    return destination[axis];
+
+  #endif
 }
 
 /**
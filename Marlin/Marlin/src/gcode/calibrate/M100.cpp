@@ -30,6 +30,10 @@
 
 #include "../../MarlinCore.h" // for idle()
 
+#if ENABLED(FF_RTOS_TASKS)
+  #include "../../HAL/STM32/rtos_tasks.h"
+#endif
+
 /**
  * M100 Free Memory Watcher
  *
@@ -48,6 +52,10 @@
  * M100 C x Corrupts x locations within the free memory block. This is useful to check the
  *          correctness of the M100 F and M100 D commands.
  *
+ * Every M100 also reports the deepest idle() nesting and the stack it took. On STM32 the
+ * free memory block is painted at boot, and M100 reports the heap size, the peak of the main
+ * stack (used by the interrupts and, without FF_RTOS_TASKS, by Marlin), and the task stacks.
+ *
  * Also, there are two support functions that can be called from a developer's C code.
  *
  *    uint16_t check_for_free_memory_corruption(PGM_P const free_memory_start);
@@ -108,6 +116,19 @@
   char *free_memory_start = (char *)_sbrk(0) + 0x200,     //  Leave some heap space
        *free_memory_end = (char *)stacklimit - MEMORY_END_CORRECTION;
 
+#elif defined(HAL_STM32)
+
+  extern char _ebss, _end, _estack;   // _sbrk() is declared by the HAL
+
+  char *end_bss = &_ebss,
+       *stacklimit = 0,
+       *heaplimit = 0;
+
+  #define MEMORY_END_CORRECTION 0x100
+
+  // Set by the boot paint (below) and by M100 I
+  char *free_memory_start = 0, *free_memory_end = 0;
+
 #else
   #error "M100 - unsupported CPU"
 #endif
@@ -128,6 +149,43 @@ char *top_of_stack() {
 
 #pragma GCC diagnostic pop
 
+// Deepest idle() nesting, and the stack pointers of the outermost and deepest idle() calls
+static uint16_t idle_depth_max;
+static char *idle_outer_sp, *idle_deep_sp;
+
+void M100_idle_watch(const uint16_t depth) {
+  char * const sp = top_of_stack();
+  if (depth == 1) NOLESS(idle_outer_sp, sp);
+  if (depth > idle_depth_max) { idle_depth_max = depth; idle_deep_sp = sp; }
+  else if (depth == idle_depth_max) NOMORE(idle_deep_sp, sp);
+}
+
+#ifdef HAL_STM32
+
+  // The main stack in use, even when called from a FreeRTOS task
+  inline char* main_stack_pointer() { return (char*)__get_MSP(); }
+
+  // Paint the gap between the heap and the main stack before the static constructors
+  // run, so the high-water marks cover everything from boot on.
+  __attribute__((constructor(102))) static void paint_free_memory() {
+    free_memory_start = _sbrk(0) + 8;
+    free_memory_end = main_stack_pointer() - MEMORY_END_CORRECTION;
+    memset(free_memory_start, TEST_BYTE, free_memory_end - free_memory_start);
+  }
+
+  inline void report_memory_regions() {
+    // The heap only grows, so its top is its peak. The main stack reached down to the first used byte.
+    char * const heap_top = _sbrk(0);
+    char *low = _MAX(heap_top, free_memory_start);
+    while (low < free_memory_end && *low == TEST_BYTE) low++;
+    SERIAL_ECHOLNPGM("Heap: ", heap_top - &_end, " bytes");
+    SERIAL_ECHOLNPGM("Main stack peak: ", &_estack - low, " bytes");
+    SERIAL_ECHOLNPGM("Never used: ", low - heap_top, " bytes between them");
+    TERN_(FF_RTOS_TASKS, RTOSTasks::report_stacks());
+  }
+
+#endif
+
 // Count the number of test bytes at the specified location.
 inline int32_t count_test_bytes(const char * const start_free_memory) {
   for (uint32_t i = 0; i < 32000; i++)
@@ -349,11 +407,24 @@ void GcodeSuite::M100() {
                   SERIAL_ECHOPGM("\nMEMORY_END_CORRECTION : ", MEMORY_END_CORRECTION);
                   SERIAL_ECHOLNPGM("\nStack Pointer       : ", hex_address(sp));
 
-  // Always init on the first invocation of M100
-  static bool m100_not_initialized = true;
+  #ifdef HAL_STM32
+    report_memory_regions();
+  #endif
+  if (idle_depth_max)
+    SERIAL_ECHOLNPGM("Deepest idle() nesting: ", idle_depth_max, ", ", idle_outer_sp - idle_deep_sp, " bytes of stack below the outermost");
+
+  // Always init on the first invocation of M100. STM32 is painted at boot.
+  static bool m100_not_initialized = TERN(HAL_STM32, false, true);
   if (m100_not_initialized || parser.seen('I')) {
     m100_not_initialized = false;
+    #ifdef HAL_STM32
+      // Leave the heap grown since boot and the stack in use now
+      NOLESS(free_memory_start, _sbrk(0) + 8);
+      free_memory_end = main_stack_pointer() - MEMORY_END_CORRECTION;
+    #endif
     init_free_memory(free_memory_start, free_memory_end - free_memory_start);
+    idle_depth_max = 0;
+    idle_outer_sp = nullptr;
   }
 
   #if ENABLED(M100_FREE_MEMORY_DUMPER)
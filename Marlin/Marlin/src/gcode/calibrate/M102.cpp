@@ -0,0 +1,55 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(MEMORY_PROFILES)
+
+#include "../gcode.h"
+#include "../../feature/memory_profile.h"
+
+/**
+ * M102: Choose the memory profile for the next boot
+ *
+ *   P<profile> : 0 = SD printing, 1 = Host streaming, 2 = UI-rich
+ *
+ * The buffers take the new shares at the next boot, so save with M500 first.
+ * With no parameters, report the active and saved profiles and their shares.
+ */
+void GcodeSuite::M102() {
+  if (!parser.seen('P')) return memory_profile.report();
+
+  const uint8_t p = parser.value_byte();
+  if (p >= MemoryProfile::PROFILES) {
+    SERIAL_ERROR_MSG("Bad memory profile.");
+    return;
+  }
+  memory_profile.saved = p;
+  if (p != memory_profile.active) SERIAL_ECHOLNPGM("Memory profile ", p, " applies from the next boot. Use M500 to save it.");
+}
+
+void GcodeSuite::M102_report(const bool forReplay/*=true*/) {
+  report_heading_etc(forReplay, F("Memory profile (P0 SD printing, P1 Host streaming, P2 UI-rich)"));
+  SERIAL_ECHOLNPGM("  M102 P", memory_profile.saved);
+}
+
+#endif // MEMORY_PROFILES
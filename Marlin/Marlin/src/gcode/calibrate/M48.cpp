@@ -53,6 +53,11 @@
  *     S = Schizoid (Or Star if you prefer)
  *     C = Enable probe temperature compensation (0 or 1, default 1)
  *
+ *   With M48_FAST_TAPS:
+ *     F = Fast taps: raise only M48_TAP_RAISE between slow probes at the point,
+ *         with no legs and no per-sample report
+ *     D = With F, list all samples (microns) after the report
+ *
  * This function requires the machine to be homed before invocation.
  */
 
@@ -77,6 +82,16 @@ void GcodeSuite::M48() {
 
   const ProbePtRaise raise_after = parser.boolval('E') ? PROBE_PT_STOW : PROBE_PT_RAISE;
 
+  #if ENABLED(M48_FAST_TAPS)
+    const bool fast_taps = parser.boolval('F');
+    if (fast_taps && raise_after == PROBE_PT_STOW) {
+      SERIAL_ECHOLNPGM("?(E) can't be used with (F)ast taps.");
+      return;
+    }
+  #else
+    constexpr bool fast_taps = false;
+  #endif
+
   // Test at the current position by default, overridden by X and Y
   const xy_pos_t test_position = {
     parser.linearval('X', current_position.x + probe.offset_xy.x),  // If no X use the probe's current X position
@@ -121,8 +136,27 @@ void GcodeSuite::M48() {
   float mean = 0.0,     // The average of all points so far, used to calculate deviation
         sigma = 0.0,    // Standard deviation of all points so far
         min = 99999.9,  // Smallest value sampled so far
-        max = -99999.9, // Largest value sampled so far
-        sample_set[n_samples];  // Storage for sampled values
+        max = -99999.9; // Largest value sampled so far
+
+  #if ENABLED(M48_FAST_TAPS)
+    const bool dump = fast_taps && parser.boolval('D');
+    int16_t sample_um[n_samples]; // Samples to list, in microns
+  #endif
+
+  // Welford's running mean and variance over fixed point microns (1/256 um),
+  // so each sample costs the same and small deviations aren't lost in a float sum
+  struct {
+    uint8_t n = 0;
+    int32_t mean = 0;   // um << 8
+    int64_t m2 = 0;     // Sum of squared deviations, um^2 << 16
+    void add(const_float_t z) {
+      const int32_t x = LROUND(z * 256000.0f), d = x - mean;
+      mean += d / ++n;
+      m2 += int64_t(d) * (x - mean);
+    }
+    float get_mean() const { return mean / 256000.0f; }
+    float get_sigma() const { return n ? SQRT(float(m2 / n)) / 256000.0f : 0.0f; }
+  } stats;
 
   auto dev_report = [](const bool verbose, const_float_t mean, const_float_t sigma, const_float_t min, const_float_t max, const bool final=false) {
     if (verbose) {
@@ -140,14 +174,12 @@ void GcodeSuite::M48() {
   };
 
   // Move to the first point, deploy, and probe
-  const float t = probe.probe_at_point(test_position, raise_after, verbose_level);
+  const float t = probe.probe_at_point(test_position, fast_taps ? PROBE_PT_NONE : raise_after, verbose_level);
   bool probing_good = !isnan(t);
 
   if (probing_good) {
     randomSeed(millis());
 
-    float sample_sum = 0.0;
-
     LOOP_L_N(n, n_samples) {
       #if HAS_STATUS_MESSAGE
         // Display M48 progress in the status bar
@@ -155,7 +187,7 @@ void GcodeSuite::M48() {
       #endif
 
       // When there are "legs" of movement move around the point before probing
-      if (n_legs) {
+      if (n_legs && !fast_taps) {
 
         // Pick a random direction, starting angle, and radius
         const int dir = (random(0, 10) > 5.0) ? -1 : 1;  // clockwise or counter clockwise
@@ -222,31 +254,32 @@ void GcodeSuite::M48() {
         } // n_legs loop
       } // n_legs
 
-      // Probe a single point
-      const float pz = probe.probe_at_point(test_position, raise_after, 0);
+      // Probe a single point, or tap again where the first probe left off
+      const float pz =
+        #if ENABLED(M48_FAST_TAPS)
+          fast_taps ? probe.tap(M48_TAP_RAISE) :
+        #endif
+        probe.probe_at_point(test_position, raise_after, 0);
 
       // Break the loop if the probe fails
       probing_good = !isnan(pz);
       if (!probing_good) break;
 
-      // Store the new sample
-      sample_set[n] = pz;
-
       // Keep track of the largest and smallest samples
       NOMORE(min, pz);
       NOLESS(max, pz);
 
-      // Get the mean value of all samples thus far
-      sample_sum += pz;
-      mean = sample_sum / (n + 1);
-
-      // Calculate the standard deviation so far.
+      // Update the mean and standard deviation.
       // The value after the last sample will be the final output.
-      float dev_sum = 0.0;
-      LOOP_LE_N(j, n) dev_sum += sq(sample_set[j] - mean);
-      sigma = SQRT(dev_sum / (n + 1));
+      stats.add(pz);
+      mean = stats.get_mean();
+      sigma = stats.get_sigma();
+
+      #if ENABLED(M48_FAST_TAPS)
+        if (dump) sample_um[n] = LROUND(pz * 1000.0f);
+      #endif
 
-      if (verbose_level > 1) {
+      if (verbose_level > 1 && !fast_taps) {
         SERIAL_ECHO(n + 1);
         SERIAL_ECHOPGM(" of ", n_samples);
         SERIAL_ECHOPAIR_F(": z: ", pz, 3);
@@ -264,6 +297,14 @@ void GcodeSuite::M48() {
     SERIAL_ECHOLNPGM("Finished!");
     dev_report(verbose_level > 0, mean, sigma, min, max, true);
 
+    #if ENABLED(M48_FAST_TAPS)
+      if (dump) {
+        SERIAL_ECHOPGM("Samples (um):");
+        LOOP_L_N(n, n_samples) { SERIAL_CHAR(n ? ',' : ' '); SERIAL_ECHO(sample_um[n]); }
+        SERIAL_EOL();
+      }
+    #endif
+
     #if HAS_STATUS_MESSAGE
       // Display M48 results in the status bar
       char sigma_str[8];
@@ -85,6 +85,7 @@ void GcodeSuite::M852() {
 
   // When skew is changed the current position changes
   if (setval) {
+    TERN_(FUSED_POSITION_TRANSFORM, planner.refresh_position_transform());
     set_current_from_steppers_for_axis(ALL_AXES_ENUM);
     sync_plan_position();
     report_current_position();
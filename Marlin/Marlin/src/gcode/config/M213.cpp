@@ -0,0 +1,88 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(MOTION_PROFILES)
+
+#include "../gcode.h"
+#include "../../module/planner.h"
+
+/**
+ * M213: Select, set, or report the per-feature motion profiles
+ *
+ *   P<index> - Profile to select. 0 is the M204/M205 settings.
+ *              With A or J, the profile to set instead.
+ *   A<accel> - Print acceleration (mm/s^2)
+ *   J<mm>    - Junction deviation (Requires junction deviation)
+ *
+ * With no parameters report all profiles.
+ *
+ * Slicer ";TYPE:" comments matching MOTION_PROFILE_TAGS are queued as M213 P.
+ */
+void GcodeSuite::M213() {
+  if (!parser.seen('P')) return M213_report(false);
+
+  const uint8_t p = parser.value_byte();
+  if (p > MOTION_PROFILE_COUNT) {
+    SERIAL_ERROR_MSG("?P must be 0 to ", MOTION_PROFILE_COUNT);
+    return;
+  }
+
+  if (parser.seen("A" TERN_(HAS_JUNCTION_DEVIATION, "J"))) {
+    if (!p) {
+      SERIAL_ERROR_MSG("?Use M204/M205 to set profile 0");
+      return;
+    }
+    motion_profile_t &mp = planner.motion_profile[p - 1];
+    if (parser.seenval('A')) mp.acceleration = parser.value_linear_units();
+    #if HAS_JUNCTION_DEVIATION
+      if (parser.seenval('J')) {
+        const float jd = parser.value_linear_units();
+        if (WITHIN(jd, 0.01f, 0.3f))
+          mp.junction_deviation_mm = jd;
+        else
+          SERIAL_ERROR_MSG("?J out of range (0.01 to 0.3)");
+      }
+    #endif
+  }
+  else
+    planner.motion_profile_index = p;
+}
+
+void GcodeSuite::M213_report(const bool forReplay/*=true*/) {
+  report_heading_etc(forReplay, F("Motion profiles"));
+  LOOP_L_N(p, MOTION_PROFILE_COUNT) {
+    const motion_profile_t &mp = planner.motion_profile[p];
+    if (!forReplay) SERIAL_ECHO_START();
+    SERIAL_ECHOLNPGM(
+        "  M213 P", p + 1, " A", LINEAR_UNIT(mp.acceleration)
+      #if HAS_JUNCTION_DEVIATION
+        , " J", mp.junction_deviation_mm
+      #endif
+      , " ; ", motion_profile_tag[p]
+    );
+  }
+  if (!forReplay) SERIAL_ECHO_MSG("  Active profile: ", planner.motion_profile_index);
+}
+
+#endif // MOTION_PROFILES
@@ -0,0 +1,73 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(ACCEL_TORQUE_CURVE)
+
+#include "../gcode.h"
+#include "../../module/planner.h"
+
+/**
+ * M214: Set or report the acceleration torque curve
+ *
+ *   P<point> - Point of ACCEL_TORQUE_SPEEDS to set, from 0
+ *   X<%>     - X acceleration at that speed, in percent of the max acceleration
+ *   Y<%>     - Y acceleration at that speed
+ *   Z<%>     - Z acceleration at that speed
+ *
+ * With no parameters report the curve. Later moves use the new values.
+ */
+void GcodeSuite::M214() {
+  if (!parser.seen('P')) return M214_report(false);
+
+  const uint8_t p = parser.value_byte();
+  if (p >= ACCEL_TORQUE_POINTS) {
+    SERIAL_ERROR_MSG("?P must be 0 to ", ACCEL_TORQUE_POINTS - 1);
+    return;
+  }
+
+  LOOP_L_N(a, XYZ) {
+    if (!parser.seenval(AXIS_CHAR(a))) continue;
+    const uint16_t pct = parser.value_ushort();
+    if (WITHIN(pct, 10, 1000))
+      planner.accel_torque[a][p] = pct;
+    else
+      SERIAL_ERROR_MSG("?", AS_CHAR(AXIS_CHAR(a)), " out of range (10 to 1000)");
+  }
+}
+
+void GcodeSuite::M214_report(const bool forReplay/*=true*/) {
+  report_heading_etc(forReplay, F("Acceleration torque curve"));
+  LOOP_L_N(p, ACCEL_TORQUE_POINTS) {
+    if (!forReplay) SERIAL_ECHO_START();
+    SERIAL_ECHOLNPGM(
+        "  M214 P", p,
+        " X", planner.accel_torque[X_AXIS][p],
+        " Y", planner.accel_torque[Y_AXIS][p],
+        " Z", planner.accel_torque[Z_AXIS][p],
+        " ; ", accel_torque_speed[p], "% feedrate"
+    );
+  }
+}
+
+#endif // ACCEL_TORQUE_CURVE
@@ -28,11 +28,25 @@
   #include "../../lcd/e3v2/proui/dwin.h"
 #endif
 
+#if ENABLED(FF_FIRMWARE_UPDATE)
+  #include "../../HAL/STM32/firmware_update.h"
+#endif
+
 /**
  * M997: Perform in-application firmware update
+ *
+ * With FF_FIRMWARE_UPDATE:
+ *   C<crc32> - Install FIRMWARE_UPDATE_FILE from the card if it has this CRC-32
  */
 void GcodeSuite::M997() {
 
+  #if ENABLED(FF_FIRMWARE_UPDATE)
+    if (parser.seenval('C')) {
+      FirmwareUpdate::install(parser.value_ulong());
+      return;                 // Only on failure
+    }
+  #endif
+
   TERN_(DWIN_LCD_PROUI, DWIN_RebootScreen());
 
   flashFirmware(parser.intval('S'));
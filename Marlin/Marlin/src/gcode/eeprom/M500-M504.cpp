@@ -121,4 +121,23 @@ void GcodeSuite::M502() {
       SERIAL_ECHO_MSG("EEPROM OK");
   }
 
+  #if ENABLED(SETTINGS_IMAGE)
+
+    /**
+     * M505: Export the stored settings image as M506 lines
+     */
+    void GcodeSuite::M505() { settings.image_export(); }
+
+    /**
+     * M506: Import a settings image exported with M505
+     *
+     *   M506 D<offset> <hex>   Image bytes, in order
+     *   M506 W<size> <crc32>   Check, store and load the image
+     */
+    void GcodeSuite::M506() {
+      if (parser.string_arg) (void)settings.image_import(parser.string_arg);
+    }
+
+  #endif
+
 #endif
@@ -0,0 +1,44 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../../inc/MarlinConfig.h"
+
+#if ENABLED(TIMELAPSE)
+
+#include "../../gcode.h"
+#include "../../../feature/timelapse.h"
+
+/**
+ * M241: Timelapse
+ *
+ *  S<bool> - Park and take a frame on each layer change of a print
+ *
+ * With no parameters, report the state.
+ */
+void GcodeSuite::M241() {
+  if (parser.seen('S'))
+    timelapse.enabled = parser.value_bool();
+  else
+    timelapse.report();
+}
+
+#endif // TIMELAPSE
@@ -0,0 +1,100 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../../inc/MarlinConfig.h"
+
+#if HAS_SHAPING
+
+#include "../../gcode.h"
+#include "../../../module/stepper.h"
+
+void GcodeSuite::M593_report(const bool forReplay/*=true*/) {
+  report_heading_etc(forReplay, F("Input Shaping"));
+  #if ENABLED(INPUT_SHAPING_X)
+    SERIAL_ECHOLNPGM("  M593 X F", stepper.shaping_x.frequency, " D", stepper.shaping_x.zeta, " T", stepper.shaping_x.type);
+  #endif
+  #if ENABLED(INPUT_SHAPING_Y)
+    if (ENABLED(INPUT_SHAPING_X)) report_echo_start(forReplay);
+    SERIAL_ECHOLNPGM("  M593 Y F", stepper.shaping_y.frequency, " D", stepper.shaping_y.zeta, " T", stepper.shaping_y.type);
+  #endif
+}
+
+/**
+ * M593: Get or set input shaping parameters
+ *
+ *  X         Apply to the X axis
+ *  Y         Apply to the Y axis (Both shaped axes if neither is given)
+ *  F<hz>     Resonant frequency. Zero to disable shaping.
+ *  D<zeta>   Damping ratio (0 to 0.5)
+ *  T<type>   Shaper type: 0 = ZV, 1 = ZVD, 2 = MZV
+ *
+ * Type M593 without any arguments to show active values.
+ */
+void GcodeSuite::M593() {
+  if (!parser.seen("FDT")) return M593_report();
+
+  const bool seen_x = parser.seen_test('X'), seen_y = parser.seen_test('Y'),
+             for_x = TERN0(INPUT_SHAPING_X, seen_x || !seen_y),
+             for_y = TERN0(INPUT_SHAPING_Y, seen_y || !seen_x);
+
+  if (!(for_x || for_y)) {
+    SERIAL_ECHOLNPGM("?Axis is not shaped.");
+    return;
+  }
+
+  float freq = -1, zeta = -1;
+  int8_t type = -1;
+
+  if (parser.seenval('F')) {
+    freq = parser.value_float();
+    if (freq != 0 && freq < SHAPING_MIN_FREQ) {
+      SERIAL_ECHOLNPGM("?F must be 0 or at least ", SHAPING_MIN_FREQ, " Hz.");
+      return;
+    }
+  }
+  if (parser.seenval('D')) {
+    zeta = parser.value_float();
+    if (!WITHIN(zeta, 0, 0.5f)) {
+      SERIAL_ECHOLNPGM("?D out of range (0-0.5).");
+      return;
+    }
+  }
+  if (parser.seenval('T')) {
+    type = parser.value_byte();
+    if (!WITHIN(type, SHAPER_ZV, SHAPER_MZV)) {
+      SERIAL_ECHOLNPGM("?T out of range (0-2).");
+      return;
+    }
+  }
+
+  auto apply = [&](AxisShaper &s) {
+    if (freq >= 0) s.frequency = freq;
+    if (zeta >= 0) s.zeta = zeta;
+    if (type >= 0) s.type = ShaperType(type);
+  };
+  TERN_(INPUT_SHAPING_X, if (for_x) apply(stepper.shaping_x));
+  TERN_(INPUT_SHAPING_Y, if (for_y) apply(stepper.shaping_y));
+
+  stepper.refresh_shaping();
+}
+
+#endif // HAS_SHAPING
@@ -0,0 +1,47 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../../inc/MarlinConfig.h"
+
+#if ENABLED(LAYER_EVENTS)
+
+#include "../../gcode.h"
+#include "../../../feature/layer_events.h"
+
+/**
+ * M230: Layer change
+ *
+ *  L<layer> - Begin this layer with the next extruding move. (Requires LAYER_COMMENTS)
+ *             With no value, the layer after the current one.
+ *             The queue turns ";LAYER:<n>" and ";LAYER_CHANGE" comments into M230 L.
+ *
+ * With no parameters, report the current layer.
+ */
+void GcodeSuite::M230() {
+  #if ENABLED(LAYER_COMMENTS)
+    if (parser.seen('L'))
+      return layer_events.comment(parser.has_value() ? parser.value_int() : layer_events.current.layer + 1);
+  #endif
+  layer_events.report();
+}
+
+#endif // LAYER_EVENTS
@@ -28,7 +28,88 @@
 #include "../../queue.h"
 #include "../../parser.h"
 
-char gcode_macros[GCODE_MACROS_SLOTS][GCODE_MACROS_SLOT_SIZE + 1] = {{ 0 }};
+#if ENABLED(GCODE_MACROS_TOKENIZED)
+
+  /**
+   * The macros, one after another, compiled when they are set. Each command is
+   * a size byte (0 for a token) followed by the token, or by the text of a line
+   * that can't be tokenized.
+   */
+  static uint8_t macro_arena[GCODE_MACROS_ARENA_SIZE];
+  static uint16_t macro_end[GCODE_MACROS_SLOTS]; // End of each macro in the arena
+
+  static uint16_t macro_start(const uint8_t index) { return index ? macro_end[index - 1] : 0; }
+
+  // Compile one command into 'd', or just count its bytes for a null 'd'
+  static uint16_t compile_command(const char * const cmd, uint8_t * const d) {
+    GCodeParser::token_t t;
+    if (parser.tokenize(cmd, t)) {
+      if (d) { *d = 0; memcpy(d + 1, &t, sizeof(t)); }
+      return 1 + sizeof(t);
+    }
+    const uint8_t size = strlen(cmd) + 1;
+    if (d) { *d = size; memcpy(d + 1, cmd, size); }
+    return 1 + size;
+  }
+
+  // Compile all the commands, separated by '|', and return the total size
+  static uint16_t compile_macro(char * const cmds, uint8_t * const d) {
+    uint16_t size = 0;
+    for (char *s = cmds;;) {
+      char * const delim = strchr(s, '|');
+      if (delim) *delim = '\0';
+      if (*s) size += compile_command(s, d ? d + size : nullptr);
+      if (!delim) break;
+      *delim = '|';
+      s = delim + 1;
+    }
+    return size;
+  }
+
+  static void set_macro(const uint8_t index, char * const cmds) {
+    const uint16_t start = macro_start(index), old_size = macro_end[index] - start,
+                   size = compile_macro(cmds, nullptr);
+
+    if (macro_end[GCODE_MACROS_SLOTS - 1] - old_size + size > GCODE_MACROS_ARENA_SIZE) {
+      SERIAL_ERROR_MSG("Macro too long.");
+      return;
+    }
+
+    // Move the later macros before writing this one in place
+    memmove(&macro_arena[start + size], &macro_arena[start + old_size], macro_end[GCODE_MACROS_SLOTS - 1] - (start + old_size));
+    for (uint8_t i = index; i < GCODE_MACROS_SLOTS; ++i) macro_end[i] = macro_end[i] - old_size + size;
+    compile_macro(cmds, &macro_arena[start]);
+  }
+
+  // Run the commands straight from their records, like process_subcommands_now
+  static void run_macro(const uint8_t index) {
+    char * const saved_cmd = parser.command_ptr;
+    const GCodeParser::token_t * const saved_token = parser.token;
+    for (uint16_t r = macro_start(index); r < macro_end[index];) {
+      const uint8_t size = macro_arena[r++];
+      GCodeParser::token_t t;
+      char cmd[size + 1];
+      if (size) {
+        memcpy(cmd, &macro_arena[r], size);
+        parser.parse(cmd);
+        r += size;
+      }
+      else {
+        memcpy(&t, &macro_arena[r], sizeof(t));
+        parser.load(t);
+        r += sizeof(t);
+      }
+      gcode.process_parsed_command(true);
+    }
+    if (saved_token) return parser.load(*saved_token);
+    parser.parse(saved_cmd);
+  }
+
+#else
+
+  char gcode_macros[GCODE_MACROS_SLOTS][GCODE_MACROS_SLOT_SIZE + 1] = {{ 0 }};
+
+#endif
 
 /**
  * M810_819: Set/execute a G-code macro.
@@ -43,23 +124,34 @@ void GcodeSuite::M810_819() {
 
   const size_t len = strlen(parser.string_arg);
 
-  if (len) {
-    // Set a macro
-    if (len > GCODE_MACROS_SLOT_SIZE)
-      SERIAL_ERROR_MSG("Macro too long.");
+  #if ENABLED(GCODE_MACROS_TOKENIZED)
+
+    if (len)
+      set_macro(index, parser.string_arg);
+    else if (macro_end[index] > macro_start(index))
+      run_macro(index);
+
+  #else
+
+    if (len) {
+      // Set a macro
+      if (len > GCODE_MACROS_SLOT_SIZE)
+        SERIAL_ERROR_MSG("Macro too long.");
+      else {
+        char c, *s = parser.string_arg, *d = gcode_macros[index];
+        do {
+          c = *s++;
+          *d++ = c == '|' ? '\n' : c;
+        } while (c);
+      }
+    }
     else {
-      char c, *s = parser.string_arg, *d = gcode_macros[index];
-      do {
-        c = *s++;
-        *d++ = c == '|' ? '\n' : c;
-      } while (c);
+      // Execute a macro
+      char * const cmd = gcode_macros[index];
+      if (strlen(cmd)) process_subcommands_now(cmd);
     }
-  }
-  else {
-    // Execute a macro
-    char * const cmd = gcode_macros[index];
-    if (strlen(cmd)) process_subcommands_now(cmd);
-  }
+
+  #endif
 }
 
 #endif // GCODE_MACROS
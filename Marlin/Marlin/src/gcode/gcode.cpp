@@ -69,6 +69,19 @@ GcodeSuite gcode;
   #include "../feature/fancheck.h"
 #endif
 
+#if ENABLED(LINE_MERGE)
+  #include "../feature/line_merge.h"
+#endif
+
+#if ENABLED(PATH_BLENDING)
+  #include "../feature/path_blend.h"
+#endif
+
+#if ENABLED(STREAM_STATISTICS)
+  #include "../module/planner.h"
+  #include "../HAL/shared/Delay.h"
+#endif
+
 #include "../MarlinCore.h" // for idle, kill
 
 // Inactivity shutdown
@@ -201,7 +214,7 @@ void GcodeSuite::get_destination_from_command() {
       destination.e = current_position.e;
   #endif
 
-  #if ENABLED(POWER_LOSS_RECOVERY) && !PIN_EXISTS(POWER_LOSS)
+  #if ENABLED(POWER_LOSS_RECOVERY) && (ENABLED(POWER_LOSS_BACKUP_SRAM) || !PIN_EXISTS(POWER_LOSS))
     // Only update power loss recovery on moves with E
     if (recovery.enabled && IS_SD_PRINTING() && seen.e && (seen.x || seen.y))
       recovery.save();
@@ -325,6 +338,14 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
 
   KEEPALIVE_STATE(IN_HANDLER);
 
+  // Plan the held G0/G1 moves before anything else
+  #if EITHER(LINE_MERGE, PATH_BLENDING)
+    if (!parser.is_command('G', 0) && !parser.is_command('G', 1)) {
+      TERN_(LINE_MERGE, line_merge.flush());
+      TERN_(PATH_BLENDING, path_blend.flush());
+    }
+  #endif
+
  /**
   * Block all Gcodes except M511 Unlock Printer, if printer is locked
   * Will still block Gcodes if M511 is disabled, in which case the printer should be unlocked via LCD Menu
@@ -451,6 +472,10 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 61: G61(); break;                                    // G61:  Apply/restore saved coordinates.
       #endif
 
+      #if ENABLED(PATH_BLENDING)
+        case 64: G64(); break;                                    // G64: Set path blending tolerance
+      #endif
+
       #if BOTH(PTC_PROBE, PTC_BED)
         case 76: G76(); break;                                    // G76: Calibrate first layer compensation values
       #endif
@@ -541,6 +566,14 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
           case 34: M34(); break;                                  // M34: Set SD card sorting options
         #endif
 
+        #if ENABLED(SD_JOB_QUEUE)
+          case 36: M36(); break;                                  // M36: Queue files to print one after another
+        #endif
+
+        #if ENABLED(SD_JOB_COMPILE)
+          case 37: M37(); break;                                  // M37: Compile a file for printing without parsing
+        #endif
+
         case 928: M928(); break;                                  // M928: Start SD write
       #endif // SDSUPPORT
 
@@ -574,6 +607,14 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 100: M100(); break;                                  // M100: Free Memory Report
       #endif
 
+      #if ENABLED(MEMORY_BUDGET)
+        case 101: M101(); break;                                  // M101: Memory Budget Report
+      #endif
+
+      #if ENABLED(MEMORY_PROFILES)
+        case 102: M102(); break;                                  // M102: Memory Profile
+      #endif
+
       #if HAS_EXTRUDERS
         case 104: M104(); break;                                  // M104: Set hot end temperature
         case 109: M109(); break;                                  // M109: Wait for hotend temperature to reach target
@@ -627,6 +668,10 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 193: M193(); break;                                  // M193: Wait for cooler temperature to reach target
       #endif
 
+      #if ENABLED(BED_COOLDOWN)
+        case 194: M194(); break;                                  // M194: Cool the bed down for part release
+      #endif
+
       #if ENABLED(AUTO_REPORT_POSITION)
         case 154: M154(); break;                                  // M154: Set position auto-report interval
       #endif
@@ -730,6 +775,14 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 211: M211(); break;                                  // M211: Enable, Disable, and/or Report software endstops
       #endif
 
+      #if ENABLED(MOTION_PROFILES)
+        case 213: M213(); break;                                  // M213: Select, set, or report motion profiles
+      #endif
+
+      #if ENABLED(ACCEL_TORQUE_CURVE)
+        case 214: M214(); break;                                  // M214: Set or report the acceleration torque curve
+      #endif
+
       #if HAS_MULTI_EXTRUDER
         case 217: M217(); break;                                  // M217: Set filament swap parameters
       #endif
@@ -778,10 +831,18 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 309: M309(); break;                                  // M309: Set chamber PID parameters
       #endif
 
+      #if ENABLED(LAYER_EVENTS)
+        case 230: M230(); break;                                  // M230: Layer change
+      #endif
+
       #if ENABLED(PHOTO_GCODE)
         case 240: M240(); break;                                  // M240: Trigger a camera
       #endif
 
+      #if ENABLED(TIMELAPSE)
+        case 241: M241(); break;                                  // M241: Timelapse
+      #endif
+
       #if HAS_LCD_CONTRAST
         case 250: M250(); break;                                  // M250: Set LCD contrast
       #endif
@@ -790,6 +851,10 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 256: M256(); break;                                  // M256: Set LCD brightness
       #endif
 
+      #if ENABLED(UI_MOTION_PRIORITY)
+        case 257: M257(); break;                                  // M257: Set display motion priority
+      #endif
+
       #if ENABLED(EXPERIMENTAL_I2CBUS)
         case 260: M260(); break;                                  // M260: Send data to an i2c slave
         case 261: M261(); break;                                  // M261: Request data from an i2c slave
@@ -846,6 +911,10 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 407: M407(); break;                                  // M407: Display measured filament diameter
       #endif
 
+      #if ENABLED(AUTO_REPORT_STATUS)
+        case 408: M408(); break;                                  // M408: Report or auto-report the status line
+      #endif
+
       #if HAS_FILAMENT_SENSOR
         case 412: M412(); break;                                  // M412: Enable/Disable filament runout detection
       #endif
@@ -890,6 +959,10 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
       #endif
       #if ENABLED(EEPROM_SETTINGS)
         case 504: M504(); break;                                  // M504: Validate EEPROM contents
+        #if ENABLED(SETTINGS_IMAGE)
+          case 505: M505(); break;                                // M505: Export settings image
+          case 506: M506(); break;                                // M506: Import settings image
+        #endif
       #endif
 
       #if ENABLED(PASSWORD_FEATURE)
@@ -920,6 +993,14 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 575: M575(); break;                                  // M575: Set serial baudrate
       #endif
 
+      #if ENABLED(STREAM_STATISTICS)
+        case 576: M576(); break;                                  // M576: Report serial stream statistics
+      #endif
+
+      #if HAS_SHAPING
+        case 593: M593(); break;                                  // M593: Set input shaping parameters
+      #endif
+
       #if ENABLED(ADVANCED_PAUSE_FEATURE)
         case 600: M600(); break;                                  // M600: Pause for Filament Change
         case 603: M603(); break;                                  // M603: Configure Filament Change
@@ -1102,6 +1183,10 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
       case 'S': case 'P': case 'R': break;                        // Invalid S, P, R commands already filtered
     #endif
 
+    #if ENABLED(REALTIME_OVERRIDES)
+      case '!': break;                                            // !M220, !M221, !M106, !M107, !M290 already applied
+    #endif
+
     default:
       #if ENABLED(WIFI_CUSTOM_COMMAND)
         if (wifi_custom_command(parser.command_ptr)) break;
@@ -1131,16 +1216,40 @@ void GcodeSuite::process_next_command() {
 
   if (DEBUGGING(ECHO)) {
     SERIAL_ECHO_START();
-    SERIAL_ECHOLN(command.buffer);
+    SERIAL_ECHOLN(queue.ring_buffer.peek_next_command_string());
     #if ENABLED(M100_FREE_MEMORY_DUMPER)
       SERIAL_ECHOPGM("slot:", queue.ring_buffer.index_r);
       M100_dump_routine(F("   Command Queue:"), (const char*)&queue.ring_buffer, sizeof(queue.ring_buffer));
     #endif
   }
 
+  #if ENABLED(STREAM_STATISTICS)
+    const uint32_t parse_start = get_cycle_count();
+  #endif
+
   // Parse the next command in the queue
-  parser.parse(command.buffer);
-  process_parsed_command();
+  #if ENABLED(GCODE_TOKEN_QUEUE)
+    char * const line = command.text ? queue.ring_buffer.texts[queue.ring_buffer.text_r] : nullptr;
+    if (!line)
+      parser.load(command.token);
+    else
+  #else
+    char * const line = queue.ring_buffer.peek_next_command_string();
+  #endif
+  #if ENABLED(FAST_G0_G1_PARSER)
+    if (!parser.parse_linear_move(line))  // Plain G0/G1 lines skip the general parser
+  #endif
+      parser.parse(line);
+  TERN_(BATCHED_OK, queue.sync_batched_ok());
+
+  #if ENABLED(STREAM_STATISTICS)
+    queue.stream_stats.parsed_command(get_cycle_count() - parse_start);
+    const uint8_t head = planner.block_buffer_head;
+    process_parsed_command();
+    if (planner.block_buffer_head != head) queue.stream_stats.planned_move(queue.stream_stats.received[queue.ring_buffer.index_r]);
+  #else
+    process_parsed_command();
+  #endif
 }
 
 #pragma GCC diagnostic push
@@ -1155,6 +1264,7 @@ void GcodeSuite::process_next_command() {
 void GcodeSuite::process_subcommands_now(FSTR_P fgcode) {
   PGM_P pgcode = FTOP(fgcode);
   char * const saved_cmd = parser.command_ptr;        // Save the parser state
+  TERN_(HAS_GCODE_TOKENS, const GCodeParser::token_t * const saved_token = parser.token);
   for (;;) {
     PGM_P const delim = strchr_P(pgcode, '\n');       // Get address of next newline
     const size_t len = delim ? delim - pgcode : strlen_P(pgcode); // Get the command length
@@ -1166,6 +1276,9 @@ void GcodeSuite::process_subcommands_now(FSTR_P fgcode) {
     if (!delim) break;                                // Last command?
     pgcode = delim + 1;                               // Get the next command
   }
+  #if HAS_GCODE_TOKENS
+    if (saved_token) return parser.load(*saved_token); // Restore a tokenized command
+  #endif
   parser.parse(saved_cmd);                            // Restore the parser state
 }
 
@@ -1173,6 +1286,7 @@ void GcodeSuite::process_subcommands_now(FSTR_P fgcode) {
 
 void GcodeSuite::process_subcommands_now(char * gcode) {
   char * const saved_cmd = parser.command_ptr;        // Save the parser state
+  TERN_(HAS_GCODE_TOKENS, const GCodeParser::token_t * const saved_token = parser.token);
   for (;;) {
     char * const delim = strchr(gcode, '\n');         // Get address of next newline
     if (delim) *delim = '\0';                         // Replace with nul
@@ -1182,6 +1296,9 @@ void GcodeSuite::process_subcommands_now(char * gcode) {
     *delim = '\n';                                    // Put back the newline
     gcode = delim + 1;                                // Get the next command
   }
+  #if HAS_GCODE_TOKENS
+    if (saved_token) return parser.load(*saved_token); // Restore a tokenized command
+  #endif
   parser.parse(saved_cmd);                            // Restore the parser state
 }
 
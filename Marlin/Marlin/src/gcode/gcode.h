@@ -66,6 +66,7 @@
  * G42  - Coordinated move to a mesh point (Requires MESH_BED_LEVELING, AUTO_BED_LEVELING_BLINEAR, or AUTO_BED_LEVELING_UBL)
  * G60  - Save current position. (Requires SAVED_POSITIONS)
  * G61  - Apply/restore saved coordinates. (Requires SAVED_POSITIONS)
+ * G64  - Set the path blending tolerance. (Requires PATH_BLENDING)
  * G76  - Calibrate first layer temperature offsets. (Requires PTC_PROBE and PTC_BED)
  * G80  - Cancel current motion mode (Requires GCODE_MOTION_MODES)
  * G90  - Use Absolute Coordinates
@@ -100,7 +101,7 @@
  * M27  - Report SD print status. (Requires SDSUPPORT)
  *        OR, with 'S<seconds>' set the SD status auto-report interval. (Requires AUTO_REPORT_SD_STATUS)
  *        OR, with 'C' get the current filename.
- * M28  - Start SD write: "M28 /path/file.gco". (Requires SDSUPPORT)
+ * M28  - Start SD write: "M28 /path/file.gco". With SD_WRITE_BUFFER, "M28 S<bytes> /path/file.gco" pre-allocates the file. (Requires SDSUPPORT)
  * M29  - Stop SD write. (Requires SDSUPPORT)
  * M30  - Delete file from SD: "M30 /path/file.gco" (Requires SDSUPPORT)
  * M31  - Report time since last M109 or SD card start to serial.
@@ -109,6 +110,8 @@
  *        The '#' is necessary when calling from within sd files, as it stops buffer prereading
  * M33  - Get the longname version of a path. (Requires LONG_FILENAME_HOST_SUPPORT)
  * M34  - Set SD Card sorting options. (Requires SDCARD_SORT_ALPHA)
+ * M36  - Queue SD files to print one after another: "M36 /path/file.gco". 'S' to start, 'C' to clear. (Requires SD_JOB_QUEUE)
+ * M37  - Compile an SD file to command records in the background: "M37 /path/file.gco". Report with no file. (Requires SD_JOB_COMPILE)
  *
  * M42  - Change pin status via G-code: M42 P<pin> S<value>. LED pin assumed if P is omitted. (Requires DIRECT_PIN_CONTROL)
  * M43  - Display pin status, watch pins for changes, watch endstops & toggle LED, Z servo probe test, toggle pins (Requires PINS_DEBUGGING)
@@ -131,6 +134,8 @@
  * M92  - Set planner.settings.axis_steps_per_mm for one or more axes.
  *
  * M100 - Watch Free Memory (for debugging) (Requires M100_FREE_MEMORY_WATCHER)
+ * M101 - Report static buffer sizes and free memory. (Requires MEMORY_BUDGET)
+ * M102 - Choose the memory profile for the next boot. (Requires MEMORY_PROFILES)
  *
  * M104 - Set extruder target temp.
  * M105 - Report current temperatures.
@@ -179,6 +184,7 @@
  * M190 - Set bed target temperature and wait. R<temp> Set target temperature and wait. S<temp> Set, but only wait when heating. (Requires TEMP_SENSOR_BED)
  * M192 - Wait for probe to reach target temperature. (Requires TEMP_SENSOR_PROBE)
  * M193 - R<temp> Wait for cooler to reach target temp. ** Wait for cooling. **
+ * M194 - S<temp> Cool the bed down to the part release temperature. (Requires BED_COOLDOWN)
  * M200 - Set filament diameter, D<diameter>, setting E axis units to cubic. (Use S0 to revert to linear units.)
  * M201 - Set max acceleration in units/s^2 for print moves: "M201 X<accel> Y<accel> Z<accel> E<accel>"
  * M202 - Set max acceleration in units/s^2 for travel moves: "M202 X<accel> Y<accel> Z<accel> E<accel>" ** UNUSED IN MARLIN! **
@@ -194,16 +200,21 @@
  * M209 - Turn Automatic Retract Detection on/off: S<0|1> (For slicers that don't support G10/11). (Requires FWRETRACT_AUTORETRACT)
           Every normal extrude-only move will be classified as retract depending on the direction.
  * M211 - Enable, Disable, and/or Report software endstops: S<0|1> (Requires MIN_SOFTWARE_ENDSTOPS or MAX_SOFTWARE_ENDSTOPS)
+ * M213 - Select, set, or report per-feature motion profiles: "M213 P<profile> A<accel> J<mm>". (Requires MOTION_PROFILES)
+ * M214 - Set or report the acceleration torque curve: "M214 P<point> X<%> Y<%> Z<%>". (Requires ACCEL_TORQUE_CURVE)
  * M217 - Set filament swap parameters: "M217 S<length> P<feedrate> R<feedrate>". (Requires SINGLENOZZLE)
  * M218 - Set/get a tool offset: "M218 T<index> X<offset> Y<offset>". (Requires 2 or more extruders)
  * M220 - Set Feedrate Percentage: "M220 S<percent>" (i.e., "FR" on the LCD)
  *        Use "M220 B" to back up the Feedrate Percentage and "M220 R" to restore it. (Requires an MMU_MODEL version 2 or 2S)
  * M221 - Set Flow Percentage: "M221 S<percent>" (Requires an extruder)
  * M226 - Wait until a pin is in a given state: "M226 P<pin> S<state>" (Requires DIRECT_PIN_CONTROL)
+ * M230 - Report the current layer, or "M230 L<layer>" to begin a layer at the next extruding move. (Requires LAYER_EVENTS)
  * M240 - Trigger a camera to take a photograph. (Requires PHOTO_GCODE)
+ * M241 - Timelapse: "M241 S<bool>" to take a frame on each layer change. (Requires TIMELAPSE)
  * M250 - Set LCD contrast: "M250 C<contrast>" (0-63). (Requires LCD support)
  * M255 - Set LCD sleep time: "M255 S<minutes>" (0-99). (Requires an LCD with brightness or sleep/wake)
  * M256 - Set LCD brightness: "M256 B<brightness>" (0-255). (Requires an LCD with brightness control)
+ * M257 - Set how the display yields to motion: "M257 P<moves> B<ms> H<ms>". (Requires UI_MOTION_PRIORITY)
  * M260 - i2c Send Data (Requires EXPERIMENTAL_I2CBUS)
  * M261 - i2c Request Data (Requires EXPERIMENTAL_I2CBUS)
  * M280 - Set servo position absolute: "M280 P<index> S<angle|µs>". (Requires servos)
@@ -231,6 +242,7 @@
  * M405 - Enable Filament Sensor flow control. "M405 D<delay_cm>". (Requires FILAMENT_WIDTH_SENSOR)
  * M406 - Disable Filament Sensor flow control. (Requires FILAMENT_WIDTH_SENSOR)
  * M407 - Display measured filament diameter in millimeters. (Requires FILAMENT_WIDTH_SENSOR)
+ * M408 - Report a compact status line, or auto-report it every S<seconds>. (Requires AUTO_REPORT_STATUS)
  * M410 - Quickstop. Abort all planned moves.
  * M412 - Enable / Disable Filament Runout Detection. (Requires FILAMENT_RUNOUT_SENSOR)
  * M413 - Enable / Disable Power-Loss Recovery. (Requires POWER_LOSS_RECOVERY)
@@ -247,6 +259,8 @@
  * M502 - Revert to the default "factory settings". ** Does not write them to EEPROM! **
  * M503 - Print the current settings (in memory): "M503 S<verbose>". S0 specifies compact output.
  * M504 - Validate EEPROM contents. (Requires EEPROM_SETTINGS)
+ * M505 - Export the stored settings as an M506 image. (Requires SETTINGS_IMAGE)
+ * M506 - Import and store a settings image. (Requires SETTINGS_IMAGE)
  * M510 - Lock Printer (Requires PASSWORD_FEATURE)
  * M511 - Unlock Printer (Requires PASSWORD_UNLOCK_GCODE)
  * M512 - Set/Change/Remove Password (Requires PASSWORD_CHANGE_GCODE)
@@ -257,6 +271,9 @@
  * M554 - Get or set IP gateway. (Requires enabled Ethernet port)
  * M569 - Enable stealthChop on an axis. (Requires at least one _DRIVER_TYPE to be TMC2130/2160/2208/2209/5130/5160)
  * M575 - Change the serial baud rate. (Requires BAUD_RATE_GCODE)
+ * M576 - Report serial stream statistics, or auto-report them every S<seconds>. (Requires STREAM_STATISTICS)
+ * M577 - Spool host lines with S1, stop with S0, discard them with C. Run on receipt. (Requires HOST_SPOOL)
+ * M593 - Get or set input shaping parameters. (Requires INPUT_SHAPING_X or INPUT_SHAPING_Y)
  * M600 - Pause for filament change: "M600 X<pos> Y<pos> Z<raise> E<first_retract> L<later_retract>". (Requires ADVANCED_PAUSE_FEATURE)
  * M603 - Configure filament change: "M603 T<tool> U<unload_length> L<load_length>". (Requires ADVANCED_PAUSE_FEATURE)
  * M605 - Set Dual X-Carriage movement mode: "M605 S<mode> [X<x_offset>] [R<temp_offset>]". (Requires DUAL_X_CARRIAGE)
@@ -590,6 +607,10 @@ private:
     static void G61();
   #endif
 
+  #if ENABLED(PATH_BLENDING)
+    static void G64();
+  #endif
+
   #if ENABLED(GCODE_MOTION_MODES)
     static void G80();
   #endif
@@ -664,6 +685,12 @@ private:
     #if BOTH(SDCARD_SORT_ALPHA, SDSORT_GCODE)
       static void M34();
     #endif
+    #if ENABLED(SD_JOB_QUEUE)
+      static void M36();
+    #endif
+    #if ENABLED(SD_JOB_COMPILE)
+      static void M37();
+    #endif
   #endif
 
   #if ENABLED(DIRECT_PIN_CONTROL)
@@ -707,6 +734,15 @@ private:
     static void M100();
   #endif
 
+  #if ENABLED(MEMORY_BUDGET)
+    static void M101();
+  #endif
+
+  #if ENABLED(MEMORY_PROFILES)
+    static void M102();
+    static void M102_report(const bool forReplay=true);
+  #endif
+
   #if HAS_EXTRUDERS
     static void M104_M109(const bool isM109);
     FORCE_INLINE static void M104() { M104_M109(false); }
@@ -787,6 +823,10 @@ private:
     static void M193();
   #endif
 
+  #if ENABLED(BED_COOLDOWN)
+    static void M194();
+  #endif
+
   #if HAS_PREHEAT
     static void M145();
     static void M145_report(const bool forReplay=true);
@@ -857,6 +897,16 @@ private:
   static void M211();
   static void M211_report(const bool forReplay=true);
 
+  #if ENABLED(MOTION_PROFILES)
+    static void M213();
+    static void M213_report(const bool forReplay=true);
+  #endif
+
+  #if ENABLED(ACCEL_TORQUE_CURVE)
+    static void M214();
+    static void M214_report(const bool forReplay=true);
+  #endif
+
   #if HAS_MULTI_EXTRUDER
     static void M217();
     static void M217_report(const bool forReplay=true);
@@ -877,10 +927,18 @@ private:
     static void M226();
   #endif
 
+  #if ENABLED(LAYER_EVENTS)
+    static void M230();
+  #endif
+
   #if ENABLED(PHOTO_GCODE)
     static void M240();
   #endif
 
+  #if ENABLED(TIMELAPSE)
+    static void M241();
+  #endif
+
   #if HAS_LCD_CONTRAST
     static void M250();
     static void M250_report(const bool forReplay=true);
@@ -896,6 +954,11 @@ private:
     static void M256_report(const bool forReplay=true);
   #endif
 
+  #if ENABLED(UI_MOTION_PRIORITY)
+    static void M257();
+    static void M257_report(const bool forReplay=true);
+  #endif
+
   #if ENABLED(EXPERIMENTAL_I2CBUS)
     static void M260();
     static void M261();
@@ -996,6 +1059,10 @@ private:
     static void M407();
   #endif
 
+  #if ENABLED(AUTO_REPORT_STATUS)
+    static void M408();
+  #endif
+
   #if HAS_FILAMENT_SENSOR
     static void M412();
     static void M412_report(const bool forReplay=true);
@@ -1037,6 +1104,10 @@ private:
   #endif
   #if ENABLED(EEPROM_SETTINGS)
     static void M504();
+    #if ENABLED(SETTINGS_IMAGE)
+      static void M505();
+      static void M506();
+    #endif
   #endif
 
   #if ENABLED(PASSWORD_FEATURE)
@@ -1075,6 +1146,15 @@ private:
     static void M575();
   #endif
 
+  #if ENABLED(STREAM_STATISTICS)
+    static void M576();
+  #endif
+
+  #if HAS_SHAPING
+    static void M593();
+    static void M593_report(const bool forReplay=true);
+  #endif
+
   #if ENABLED(ADVANCED_PAUSE_FEATURE)
     static void M600();
     static void M603();
@@ -30,6 +30,46 @@
   #include "queue.h"
 #endif
 
+#if ENABLED(PLANNER_FIXED_POINT)
+  #include "../module/planner.h"
+#endif
+
+#if ENABLED(MOTION_BENCHMARK)
+  #include "../feature/motion_bench.h"
+#endif
+
+#if ENABLED(TFT_UI_PROFILER)
+  #include "../lcd/tft/ui_profiler.h"
+#endif
+
+#if ENABLED(LVGL_MEM_POOL)
+  #include "../lcd/extui/mks_ui/lv_mem_pool.h"
+#endif
+
+#if ENABLED(IDLE_SCHEDULER)
+  #include "../feature/idle_tasks.h"
+#endif
+
+#if ENABLED(ISR_PROFILER)
+  #include "../HAL/STM32/isr_profiler.h"
+#endif
+
+#if ENABLED(STEP_CAPTURE)
+  #include "../feature/step_capture.h"
+#endif
+
+#if ENABLED(TRACE_EVENTS)
+  #include "../feature/trace_events.h"
+#endif
+
+#if ENABLED(INPUT_REPLAY)
+  #include "../feature/input_replay.h"
+#endif
+
+#if ENABLED(MESH_Z_RASTER)
+  #include "../feature/bedlevel/bedlevel.h"
+#endif
+
 #include "../module/settings.h"
 #include "../module/temperature.h"
 #include "../libs/hex_print.h"
@@ -184,6 +224,142 @@ void GcodeSuite::D(const int16_t dcode) {
       SERIAL_ECHOLN(gtn(&SERIAL_IMPL));
       break;
 
+    #if ENABLED(PLANNER_FIXED_POINT)
+      case 200: // D200 Compare float and fixed-point planner math. S<blocks> (default 100000)
+        planner.bench_math(parser.ulongval('S', 100000));
+        break;
+    #endif
+
+    #if ENABLED(MOTION_BENCHMARK)
+      /**
+       * D201: Motion pipeline benchmark, with the steppers disabled. Rehome afterward.
+       *  C<count>   Number of moves (default 1000)
+       *  L<mm>      Length of each move (default 1)
+       *  A<degrees> Turn between moves (default 10)
+       *  F<mm/min>  Feedrate (default 6000)
+       */
+      case 201:
+        motion_bench.run(parser.ulongval('C', 1000), parser.floatval('L', 1), parser.floatval('A', 10),
+                         MMM_TO_MMS(parser.floatval('F', 6000)));
+        break;
+    #endif
+
+    #if ENABLED(DEFERRED_TEMP_SENSORS)
+      case 203: // D203 Report and reset the longest Temperature ISR and sensor task
+        thermalManager.report_isr_cost();
+        break;
+    #endif
+
+    #if ENABLED(FAST_G0_G1_PARSER)
+      case 202: // D202 Compare general and fast G0/G1 parsing in lines/s. S<lines> (default 100000)
+        parser.bench_linear_moves(parser.ulongval('S', 100000));
+        break;
+    #endif
+
+    #if ENABLED(TFT_UI_PROFILER)
+      case 204: // D204 Report the UI cost per screen. R to reset the counters.
+        ui_profiler.report();
+        if (parser.seen_test('R')) ui_profiler.reset();
+        break;
+    #endif
+
+    #if ENABLED(IDLE_SCHEDULER)
+      case 205: // D205 Report the run time and lateness of each idle() task. R to reset the counters.
+        idle_scheduler.report();
+        if (parser.seen_test('R')) idle_scheduler.reset();
+        break;
+    #endif
+
+    #if ENABLED(ISR_PROFILER)
+      case 206: // D206 Report the cycles and CPU load of each interrupt handler. R to reset the counters.
+        ISRProfiler::report();
+        if (parser.seen_test('R')) ISRProfiler::reset();
+        break;
+    #endif
+
+    #if ENABLED(STEP_CAPTURE)
+      /**
+       * D207: Step capture
+       *  S  Start. Stop when the buffer is full.
+       *  R  Start a ring that keeps the newest steps
+       *  P  Stop
+       *  D  Stop and dump the entries (binary, see step_capture.cpp)
+       * With no parameters report the state.
+       */
+      case 207:
+        if (parser.seen_test('S')) step_capture.start(false);
+        else if (parser.seen_test('R')) step_capture.start(true);
+        else if (parser.seen_test('P')) step_capture.stop();
+        if (parser.seen_test('D')) {
+          PORT_REDIRECT(TELEMETRY_PORTMASK);
+          step_capture.dump();
+          PORT_RESTORE();
+        }
+        else
+          step_capture.report();
+        break;
+    #endif
+
+    #if ENABLED(TRACE_EVENTS)
+      /**
+       * D208: Trace events
+       *  S  Clear the ring and start recording
+       *  P  Stop
+       *  D  Stop and dump the events (binary, see trace_events.cpp)
+       * With no parameters report the state.
+       */
+      case 208:
+        if (parser.seen_test('S')) trace_events.start();
+        else if (parser.seen_test('P')) trace_events.stop();
+        if (parser.seen_test('D')) {
+          PORT_REDIRECT(TELEMETRY_PORTMASK);
+          trace_events.dump();
+          PORT_RESTORE();
+        }
+        else
+          trace_events.report();
+        break;
+    #endif
+
+    #if ENABLED(SD_BENCHMARK)
+      case 210: // D210 Benchmark the media, or the staging card with P1. S<KB> size of the test file (default 1024)
+        card.benchmark(parser.byteval('P'), parser.ushortval('S', 1024));
+        break;
+    #endif
+
+    #if ENABLED(LVGL_MEM_POOL)
+      case 211: // D211 Report the LVGL pools, heap fragmentation and allocation times. R to reset the counters.
+        LVGLPool::report();
+        if (parser.seen_test('R')) LVGLPool::reset();
+        break;
+    #endif
+
+    #if ENABLED(INPUT_REPLAY)
+      /**
+       * D212: Input record / replay
+       *  R  Record the input to INPUT.REC
+       *  P  Play INPUT.REC back
+       *  S  Stop
+       * With no parameters report the state.
+       */
+      case 212:
+        if (parser.seen_test('R')) input_replay.record();
+        else if (parser.seen_test('P')) input_replay.play();
+        else if (parser.seen_test('S')) input_replay.stop();
+        else input_replay.report();
+        break;
+    #endif
+
+    #if ENABLED(MESH_Z_RASTER)
+      case 213: // D213 Compare the mesh, raster and SIMD raster Z lookups in lookups/s. S<count> (default 100000)
+        bedlevel.bench_z_lookup(parser.ulongval('S', 100000));
+        break;
+    #endif
+
+    case 209: // D209 Compare per-digit and table driven number formatting. S<count> (default 100000)
+      bench_numtostr(parser.ulongval('S', 100000));
+      break;
+
     case 100: { // D100 Disable heaters and attempt a hard hang (Watchdog Test)
       SERIAL_ECHOLNPGM("Disabling heaters and attempting to trigger Watchdog");
       SERIAL_ECHOLNPGM("(USE_WATCHDOG " TERN(USE_WATCHDOG, "ENABLED", "DISABLED") ")");
@@ -32,6 +32,10 @@
   #include "../../feature/caselight.h"
 #endif
 
+#if ENABLED(STAGED_STARTUP)
+  #include "../../MarlinCore.h"
+#endif
+
 //#define MINIMAL_CAP_LINES // Don't even mention the disabled capabilities
 
 #if ENABLED(EXTENDED_CAPABILITIES_REPORT)
@@ -73,6 +77,16 @@ void GcodeSuite::M115() {
     #endif
   );
 
+  #if ENABLED(STAGED_STARTUP)
+    SERIAL_ECHOLNPGM(
+      "BOOT_TIMELINE:"
+      "serial:", boot_timeline[BOOT_SERIAL], ","
+      "core:", boot_timeline[BOOT_CORE], ","
+      "settings:", boot_timeline[BOOT_SETTINGS], ","
+      "ui:", boot_timeline[BOOT_UI]
+    );
+  #endif
+
   #if ENABLED(EXTENDED_CAPABILITIES_REPORT)
 
     // The port that sent M115
@@ -90,6 +104,9 @@ void GcodeSuite::M115() {
     // BINARY_FILE_TRANSFER (M28 B1)
     cap_line(F("BINARY_FILE_TRANSFER"), ENABLED(BINARY_FILE_TRANSFER)); // TODO: Use SERIAL_IMPL.has_feature(port, SerialFeature::BinaryFileTransfer) once implemented
 
+    // BATCHED_OK ("ok N<count>" for a batch of moves)
+    cap_line(F("BATCHED_OK"), ENABLED(BATCHED_OK));
+
     // EEPROM (M500, M501)
     cap_line(F("EEPROM"), ENABLED(EEPROM_SETTINGS));
 
@@ -99,6 +116,9 @@ void GcodeSuite::M115() {
     // AUTOREPORT_POS (M154)
     cap_line(F("AUTOREPORT_POS"), ENABLED(AUTO_REPORT_POSITION));
 
+    // AUTOREPORT_STATUS (M408)
+    cap_line(F("AUTOREPORT_STATUS"), ENABLED(AUTO_REPORT_STATUS));
+
     // AUTOREPORT_TEMP (M155)
     cap_line(F("AUTOREPORT_TEMP"), ENABLED(AUTO_REPORT_TEMPERATURES));
 
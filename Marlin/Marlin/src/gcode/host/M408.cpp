@@ -0,0 +1,48 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfigPre.h"
+
+#if ENABLED(AUTO_REPORT_STATUS)
+
+#include "../gcode.h"
+#include "../../feature/status_report.h"
+
+/**
+ * M408: Report the compact status line, or set the auto-report interval.
+ *       M408 [S<seconds>] [C<0|1>]
+ *
+ *  S<seconds>  Auto-report interval. S0 to stop.
+ *  C1          Auto-report only when the line would change.
+ */
+void GcodeSuite::M408() {
+
+  if (parser.seen('C')) StatusReport::changes_only = parser.value_bool();
+
+  if (parser.seenval('S'))
+    status_auto_reporter.set_interval(parser.value_byte());
+  else
+    StatusReport::report(true);
+
+}
+
+#endif // AUTO_REPORT_STATUS
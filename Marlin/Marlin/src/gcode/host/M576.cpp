@@ -0,0 +1,43 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfigPre.h"
+
+#if ENABLED(STREAM_STATISTICS)
+
+#include "../gcode.h"
+#include "../queue.h"
+
+/**
+ * M576: Report serial stream statistics since the last report,
+ *       or set the auto-report interval. M576 [S<seconds>]
+ */
+void GcodeSuite::M576() {
+
+  if (parser.seenval('S'))
+    queue.stream_auto_reporter.set_interval(parser.value_byte());
+  else
+    GCodeQueue::StreamStats::report();
+
+}
+
+#endif // STREAM_STATISTICS
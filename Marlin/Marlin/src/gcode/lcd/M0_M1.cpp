@@ -44,6 +44,13 @@
   #include "../../feature/host_actions.h"
 #endif
 
+#if ENABLED(ASYNC_USER_WAIT)
+  #include "../../feature/user_wait.h"
+
+  // Finish M0/M1 once the user continues
+  static void resume_M0_M1() { TERN_(HAS_MARLINUI_MENU, ui.reset_status()); }
+#endif
+
 /**
  * M0: Unconditional stop - Wait for user button press on LCD
  * M1: Conditional stop   - Wait for user button press on LCD
@@ -87,9 +94,12 @@ void GcodeSuite::M0_M1() {
 
   TERN_(HOST_PROMPT_SUPPORT, hostui.prompt_do(PROMPT_USER_CONTINUE, parser.codenum ? F("M1 Stop") : F("M0 Stop"), FPSTR(CONTINUE_STR)));
 
-  TERN_(HAS_RESUME_CONTINUE, wait_for_user_response(ms));
-
-  TERN_(HAS_MARLINUI_MENU, ui.reset_status());
+  #if ENABLED(ASYNC_USER_WAIT)
+    user_wait.start(ms, resume_M0_M1);  // Reply now. The queue holds the next commands.
+  #else
+    wait_for_user_response(ms);
+    TERN_(HAS_MARLINUI_MENU, ui.reset_status());
+  #endif
 }
 
 #endif // HAS_RESUME_CONTINUE
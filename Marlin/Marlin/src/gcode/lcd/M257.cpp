@@ -0,0 +1,48 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(UI_MOTION_PRIORITY)
+
+#include "../gcode.h"
+#include "../../lcd/marlinui.h"
+
+/**
+ * M257: Set how the display yields to motion
+ *  P<moves> - Hold frames while fewer moves are planned (0 to only use the budget)
+ *  B<ms>    - Frame budget. Costlier frames need twice their time in queued moves.
+ *  H<ms>    - Longest hold before a frame is drawn anyway
+ */
+void GcodeSuite::M257() {
+  if (!parser.seen("PBH")) return M257_report();
+
+  if (parser.seenval('P')) ui.motion_min_moves = _MIN(parser.value_byte(), BLOCK_BUFFER_SIZE);
+  if (parser.seenval('B')) ui.frame_budget_ms = parser.value_byte();
+  if (parser.seenval('H')) ui.frame_hold_max_ms = parser.value_ushort();
+}
+
+void GcodeSuite::M257_report(const bool forReplay/*=true*/) {
+  report_heading_etc(forReplay, F(STR_UI_MOTION_PRIORITY));
+  SERIAL_ECHOLNPGM("  M257 P", ui.motion_min_moves, " B", ui.frame_budget_ms, " H", ui.frame_hold_max_ms);
+}
+
+#endif // UI_MOTION_PRIORITY
@@ -31,10 +31,26 @@
 
 #include "../../sd/cardreader.h"
 
-#if ENABLED(NANODLP_Z_SYNC)
+#if EITHER(NANODLP_Z_SYNC, INSTANT_FEEDRATE_OVERRIDE)
   #include "../../module/planner.h"
 #endif
 
+#if ENABLED(LINE_MERGE)
+  #include "../../feature/line_merge.h"
+#endif
+
+#if ENABLED(PATH_BLENDING)
+  #include "../../feature/path_blend.h"
+#endif
+
+#if ENABLED(LAYER_EVENTS)
+  #include "../../feature/layer_events.h"
+#endif
+
+#if ENABLED(TFT_TOOLPATH_PREVIEW)
+  #include "../../lcd/tft/tft_toolpath.h"
+#endif
+
 extern xyze_pos_t destination;
 
 #if ENABLED(VARIABLE_G0_FEEDRATE)
@@ -94,6 +110,8 @@ void GcodeSuite::G0_G1(TERN_(HAS_FAST_MOVES, const bool fast_move/*=false*/)) {
           const float echange = destination.e - current_position.e;
           // Is this a retract or recover move?
           if (WITHIN(ABS(echange), MIN_AUTORETRACT, MAX_AUTORETRACT) && fwretract.retracted[active_extruder] == (echange > 0.0)) {
+            TERN_(LINE_MERGE, line_merge.flush());    // Plan the held moves first
+            TERN_(PATH_BLENDING, path_blend.flush());
             current_position.e = destination.e;       // Hide a G1-based retract/recover from calculations
             sync_plan_position_e();                   // AND from the planner
             return fwretract.retract(echange < 0.0);  // Firmware-based retract/recover (double-retract ignored)
@@ -103,10 +121,22 @@ void GcodeSuite::G0_G1(TERN_(HAS_FAST_MOVES, const bool fast_move/*=false*/)) {
 
     #endif // FWRETRACT
 
+    TERN_(LAYER_EVENTS, layer_events.check_move()); // Publish a layer change before the first move of the layer
+
+    TERN_(TFT_TOOLPATH_PREVIEW, toolpath.add(current_position, destination)); // Draw the move into the layer preview
+
+    TERN_(INSTANT_FEEDRATE_OVERRIDE, REMEMBER(scaled, planner.override_scaled, true)); // Let M220 re-time these moves
+
     #if IS_SCARA
       fast_move ? prepare_fast_move_to_destination() : prepare_line_to_destination();
     #else
-      prepare_line_to_destination();
+      #if ENABLED(PATH_BLENDING)
+        if (path_blend.tolerance) {
+          if (!path_blend.add()) prepare_line_to_destination();
+        }
+        else
+      #endif
+      if (TERN1(LINE_MERGE, !line_merge.add())) prepare_line_to_destination();
     #endif
 
     #ifdef G0_FEEDRATE
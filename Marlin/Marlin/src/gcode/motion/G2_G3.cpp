@@ -28,6 +28,7 @@
 #include "../../module/motion.h"
 #include "../../module/planner.h"
 #include "../../module/temperature.h"
+#include "../../libs/math_fast.h"
 
 #if ENABLED(DELTA)
   #include "../../module/delta.h"
@@ -48,9 +49,74 @@
   #define MIN_ARC_SEGMENT_MM MAX_ARC_SEGMENT_MM
 #endif
 
+#if ENABLED(NATIVE_ARCS) && !defined(NATIVE_ARC_LEVEL_TOLERANCE)
+  #define NATIVE_ARC_LEVEL_TOLERANCE 0.005
+#endif
+
 #define ARC_LIJK_CODE(L,I,J,K)    CODE_N(SUB2(LINEAR_AXES),L,I,J,K)
 #define ARC_LIJKE_CODE(L,I,J,K,E) ARC_LIJK_CODE(L,I,J,K); CODE_ITEM_E(E)
 
+#if ENABLED(NATIVE_ARCS)
+
+  /**
+   * Queue an arc in the XY plane as a single block for the Stepper to trace.
+   * Return false to trace it with linear segments instead, such as when soft
+   * endstops would clip it or bed leveling doesn't ramp straight along it.
+   */
+  static bool buffer_native_arc(const xyze_pos_t &cart, const xy_pos_t &center, const_float_t radius, const_float_t angular_travel, const_float_t flat_mm, const_feedRate_t fr_mm_s) {
+
+    #if HAS_SOFTWARE_ENDSTOPS
+      // Only segments can be clipped, so the whole circle must be within bounds
+      xyz_pos_t lo = cart, hi = cart;
+      lo.x = center.x - radius; lo.y = center.y - radius;
+      hi.x = center.x + radius; hi.y = center.y + radius;
+      const xyz_pos_t lo_raw = lo, hi_raw = hi;
+      apply_motion_limits(lo);
+      apply_motion_limits(hi);
+      if (lo != lo_raw || hi != hi_raw) return false;
+    #endif
+
+    const xy_pos_t r_start = { current_position.x - center.x, current_position.y - center.y },
+                   r_end = { cart.x - center.x, cart.y - center.y };
+
+    #if HAS_LEVELING
+      // The planner levels the ends of the block, so leveling along the arc must ramp straight between them
+      if (planner.leveling_active) {
+        float z_offset[9];
+        LOOP_L_N(i, COUNT(z_offset)) {
+          const float t = i * 0.125f, a = angular_travel * t, c = fast_cosf(a), s = fast_sinf(a);
+          xyz_pos_t p = { center.x + r_start.x * c - r_start.y * s,
+                          center.y + r_start.x * s + r_start.y * c,
+                          current_position.z + (cart.z - current_position.z) * t };
+          const float z = p.z;
+          planner.apply_leveling(p);
+          z_offset[i] = p.z - z;
+        }
+        LOOP_S_L_N(i, 1, COUNT(z_offset) - 1) {
+          const float ramp = z_offset[0] + (z_offset[8] - z_offset[0]) * i * 0.125f;
+          if (ABS(z_offset[i] - ramp) > NATIVE_ARC_LEVEL_TOLERANCE) return false;
+        }
+      }
+    #endif
+
+    arc_move_t arc;
+    arc.center = center;
+    arc.angle = angular_travel;
+    arc.radius = radius;
+    arc.flat_mm = flat_mm;
+    arc.millimeters = HYPOT(flat_mm, cart.z - current_position.z);
+
+    // Tangents at both ends, scaled to the length of the move
+    const float tangent_scale = (angular_travel < 0 ? -flat_mm : flat_mm) / radius;
+    arc.start_dir = arc.end_dir = cart - current_position;
+    arc.start_dir.x = -r_start.y * tangent_scale; arc.start_dir.y = r_start.x * tangent_scale;
+    arc.end_dir.x   = -r_end.y * tangent_scale;   arc.end_dir.y   = r_end.x * tangent_scale;
+
+    return planner.buffer_arc(cart, arc, fr_mm_s);
+  }
+
+#endif // NATIVE_ARCS
+
 /**
  * Plan an arc in 2 dimensions, with linear motion in the other axes.
  * The arc is traced with many small linear segments according to the configuration.
@@ -104,7 +170,7 @@ void plan_arc(
   }
   else {
     // Calculate the angle
-    angular_travel = ATAN2(rvec.a * rt_Y - rvec.b * rt_X, rvec.a * rt_X + rvec.b * rt_Y);
+    angular_travel = fast_atan2f(rvec.a * rt_Y - rvec.b * rt_X, rvec.a * rt_X + rvec.b * rt_Y);
 
     // Angular travel too small to detect? Just return.
     if (!angular_travel) return;
@@ -173,6 +239,17 @@ void plan_arc(
 
   // Feedrate for the move, scaled by the feedrate multiplier
   const feedRate_t scaled_fr_mm_s = MMS_SCALED(feedrate_mm_s);
+  TERN_(INSTANT_FEEDRATE_OVERRIDE, REMEMBER(scaled, planner.override_scaled, true)); // Let M220 re-time the segments
+
+  #if ENABLED(NATIVE_ARCS)
+    // Let the Stepper trace the arc as a single block when it can
+    if (TERN1(CNC_WORKSPACE_PLANES, axis_p == X_AXIS)
+      && buffer_native_arc(cart, { center_P, center_Q }, radius, angular_travel, flat_mm, scaled_fr_mm_s)
+    ) {
+      current_position = cart;
+      return;
+    }
+  #endif
 
   // Get the ideal segment length for the move based on settings
   const float ideal_segment_mm = (
@@ -188,8 +265,8 @@ void plan_arc(
               nominal_segment_mm = flat_mm / nominal_segments;
 
   // The number of whole segments in the arc, with best attempt to honor MIN_ARC_SEGMENT_MM and MAX_ARC_SEGMENT_MM
-  const uint16_t segments = nominal_segment_mm > (MAX_ARC_SEGMENT_MM) ? CEIL(flat_mm / (MAX_ARC_SEGMENT_MM)) :
-                            nominal_segment_mm < (MIN_ARC_SEGMENT_MM) ? _MAX(1, FLOOR(flat_mm / (MIN_ARC_SEGMENT_MM))) :
+  const uint16_t segments = nominal_segment_mm > float(MAX_ARC_SEGMENT_MM) ? CEIL(flat_mm / float(MAX_ARC_SEGMENT_MM)) :
+                            nominal_segment_mm < float(MIN_ARC_SEGMENT_MM) ? _MAX(1, FLOOR(flat_mm / float(MIN_ARC_SEGMENT_MM))) :
                             nominal_segments;
 
   #if ENABLED(SCARA_FEEDRATE_SCALING)
@@ -286,7 +363,7 @@ void plan_arc(
         // Compute exact location by applying transformation matrix from initial radius vector(=-offset).
         // To reduce stuttering, the sin and cos could be computed at different times.
         // For now, compute both at the same time.
-        const float Ti = i * theta_per_segment, cos_Ti = cos(Ti), sin_Ti = sin(Ti);
+        const float Ti = i * theta_per_segment, cos_Ti = fast_cosf(Ti), sin_Ti = fast_sinf(Ti);
         rvec.a = -offset[0] * cos_Ti + offset[1] * sin_Ti;
         rvec.b = -offset[0] * sin_Ti - offset[1] * cos_Ti;
       }
@@ -31,6 +31,10 @@
 #include "../../module/motion.h"
 #include "../../module/planner_bezier.h"
 
+#if ENABLED(INSTANT_FEEDRATE_OVERRIDE)
+  #include "../../module/planner.h"
+#endif
+
 /**
  * Parameters interpreted according to:
  * https://linuxcnc.org/docs/2.7/html/gcode/g-code.html#gcode:g5
@@ -61,6 +65,7 @@ void GcodeSuite::G5() {
       { parser.linearval('P'), parser.linearval('Q') }
     };
 
+    TERN_(INSTANT_FEEDRATE_OVERRIDE, REMEMBER(scaled, planner.override_scaled, true)); // Let M220 re-time the segments
     cubic_b_spline(current_position, destination, offsets, MMS_SCALED(feedrate_mm_s), active_extruder);
     current_position = destination;
   }
@@ -0,0 +1,44 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(PATH_BLENDING)
+
+#include "../gcode.h"
+#include "../../feature/path_blend.h"
+
+/**
+ * G64: Set the path blending tolerance
+ *
+ *   P<linear> - Largest distance of a rounded corner from the programmed one. P0 for the exact path.
+ *
+ * With no parameters report the current tolerance.
+ */
+void GcodeSuite::G64() {
+  if (parser.seenval('P'))
+    path_blend.tolerance = _MAX(0.0f, parser.value_linear_units());
+  else
+    SERIAL_ECHOLNPGM("G64 P", LINEAR_UNIT(path_blend.tolerance));
+}
+
+#endif // PATH_BLENDING
@@ -66,6 +66,12 @@ uint16_t GCodeParser::codenum;
   char *GCodeParser::command_args; // start of parameters
 #endif
 
+#if HAS_GCODE_TOKENS
+  const GCodeParser::token_t *GCodeParser::token; // = nullptr
+  float GCodeParser::token_value;
+  static char token_command[1];    // Tokens have no command text
+#endif
+
 // Create a global instance of the GCode parser singleton
 GCodeParser parser;
 
@@ -80,6 +86,7 @@ void GCodeParser::reset() {
   command_letter = '?';                 // No command letter
   codenum = 0;                          // No command code
   TERN_(USE_GCODE_SUBCODES, subcode = 0); // No command sub-code
+  TERN_(HAS_GCODE_TOKENS, token = nullptr); // No token
   #if ENABLED(FASTER_GCODE_PARSER)
     codebits = 0;                       // No codes yet
     //ZERO(param);                      // No parameters (should be safe to comment out this line)
@@ -149,6 +156,11 @@ void GCodeParser::parse(char *p) {
     #define SIGNED_CODENUM 1
   #endif
 
+  #if ENABLED(REALTIME_OVERRIDES)
+    // Realtime overrides were applied by the emergency parser
+    if (letter == '!') { command_letter = letter; codenum = 0; return; }
+  #endif
+
   /**
    * Screen for good command letters.
    * With Realtime Reporting, commands S000, P000, and R000 are allowed.
@@ -270,6 +282,9 @@ void GCodeParser::parse(char *p) {
   if (letter == 'M') switch (codenum) {
     TERN_(GCODE_MACROS, case 810 ... 819:)
     TERN_(EXPECTED_PRINTER_CHECK, case 16:)
+    TERN_(SD_JOB_QUEUE, case 36:)
+    TERN_(SD_JOB_COMPILE, case 37:)
+    TERN_(SETTINGS_IMAGE, case 506:)
     case 23: case 28: case 30: case 117 ... 118: case 928:
       string_arg = unescape_string(p);
       return;
@@ -363,6 +378,238 @@ void GCodeParser::parse(char *p) {
   }
 }
 
+#if HAS_GCODE_TOKENS
+
+  // Add a parameter value to a token, keeping the values in letter order
+  static void add_token_value(GCodeParser::token_t &t, const uint8_t ind, const float v, uint8_t &count) {
+    const uint8_t at = __builtin_popcountl(t.valbits & (_BV32(ind) - 1));
+    for (uint8_t i = count++; i > at; --i) t.value[i] = t.value[i - 1];
+    t.value[at] = v;
+    SBI32(t.valbits, ind);
+  }
+
+  void GCodeParser::load(const token_t &t) {
+    reset();
+    token = &t;
+    command_ptr = token_command;
+    command_letter = t.letter;
+    codenum = t.codenum;
+    TERN_(USE_GCODE_SUBCODES, subcode = t.subcode);
+    codebits = t.codebits;
+
+    // Index the values by letter
+    uint8_t i = 0;
+    for (uint32_t bits = t.valbits; bits; bits &= bits - 1)
+      param[__builtin_ctzl(bits)] = ++i;
+
+    #if ENABLED(GCODE_MOTION_MODES)
+      if (command_letter == 'G' && codenum <= TERN(ARC_SUPPORT, 3, 1)) {
+        motion_mode_codenum = codenum;
+        TERN_(USE_GCODE_SUBCODES, motion_mode_subcode = subcode);
+      }
+    #endif
+  }
+
+#endif // HAS_GCODE_TOKENS
+
+#if ENABLED(GCODE_TOKEN_QUEUE)
+
+  /**
+   * Tokenize the commands that never use string_arg, value_string(), or command_ptr,
+   * and only when the line is plain: upper case, no quotes or comments, no repeated
+   * parameters, and no value too long to copy. Anything else is queued as text and
+   * goes through parse() when it's dispatched.
+   */
+  bool GCodeParser::tokenize(const char *p, token_t &t) {
+
+    while (*p == ' ') ++p;
+
+    // Skip N[-0-9] but keep the number for ADVANCED_OK
+    TERN_(ADVANCED_OK, t.line_number = -1);
+    if (*p == 'N' && NUMERIC_SIGNED(p[1])) {
+      TERN_(ADVANCED_OK, t.line_number = strtol(p + 1, nullptr, 10));
+      p += 2;
+      while (NUMERIC(*p)) ++p;
+      while (*p == ' ') ++p;
+    }
+
+    // A motion mode line without G depends on the state at dispatch, so it stays text
+    t.letter = *p++;
+    if (t.letter != 'G' && t.letter != 'M') return false;
+
+    while (*p == ' ') ++p;
+    if (!NUMERIC(*p)) return false;
+    t.codenum = 0;
+    do { t.codenum = t.codenum * 10 + *p++ - '0'; } while (NUMERIC(*p));
+
+    #if USE_GCODE_SUBCODES
+      t.subcode = 0;
+      if (*p == '.') {
+        p++;
+        while (NUMERIC(*p)) t.subcode = t.subcode * 10 + *p++ - '0';
+      }
+    #endif
+
+    if (t.letter == 'G') switch (t.codenum) {
+      case 0 ... 1: TERN_(ARC_SUPPORT, case 2 ... 3:) case 4: case 90 ... 92: break;
+      default: return false;
+    }
+    else switch (t.codenum) {
+      case 82 ... 83: case 104: case 106 ... 107: case 109: case 140: case 190: case 204: case 220 ... 221: break;
+      default: return false;
+    }
+
+    t.codebits = t.valbits = 0;
+    uint8_t count = 0;
+    for (;;) {
+      while (*p == ' ') ++p;
+      const char c = *p++;
+      if (c == '\0' || c == '*') return true;   // The checksum is already verified
+      if (!WITHIN(c, 'A', 'Z')) return false;
+      const uint8_t ind = LETTER_BIT(c);
+      if (TEST32(t.codebits, ind)) return false;
+      SBI32(t.codebits, ind);
+
+      while (*p == ' ') ++p;
+      if (!valid_float(p)) continue;
+      if (count >= GCODE_TOKEN_PARAMS) return false;
+
+      // Copy the value as value_float() would see it, with 'E' as the next parameter
+      char num[16];
+      uint8_t len = 0;
+      while (DECIMAL_SIGNED(*p)) {
+        if (len >= sizeof(num) - 1) return false;
+        num[len++] = *p++;
+      }
+      num[len] = '\0';
+
+      add_token_value(t, ind, strtof(num, nullptr), count);
+    }
+  }
+
+#endif // GCODE_TOKEN_QUEUE
+
+#if ENABLED(FAST_G0_G1_PARSER)
+
+  /**
+   * Read a plain decimal like 12.345 or -.5, with at most 7 significant digits and 10 decimal
+   * places. The digits and the power of ten are then both exact floats, so one division
+   * rounds the same way strtof() does. Return false for anything longer or fancier.
+   */
+  static bool scan_decimal(const char *&p, float &v) {
+    static const float pow10[] = { 1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f };
+    const bool neg = *p == '-';
+    if (neg || *p == '+') ++p;
+    uint32_t m = 0;
+    uint8_t digits = 0, places = 0;
+    bool point = false;
+    for (;; ++p) {
+      const char c = *p;
+      if (NUMERIC(c)) {
+        m = m * 10 + c - '0';
+        if (m >= _BV32(24) || places >= COUNT(pow10) - 1) return false;
+        digits++;
+        if (point) places++;
+      }
+      else if (c == '.' && !point)
+        point = true;
+      else
+        break;
+    }
+    if (!digits) return false;
+    if (digits == 1 && !m && !point && *p == 'X') return false;  // strtof() reads "0X..." as hex
+    v = float(m) / pow10[places];
+    if (neg) v = -v;
+    return true;
+  }
+
+  /**
+   * Plain G0/G1 lines are most of a print job. Decode their values with integer
+   * math into a token, and skip the letter scan and strtof() of parse().
+   * Anything unusual goes back to parse(): other commands, subcodes, lower case,
+   * parameters other than X Y Z E F, parameters without values, repeats, and long numbers.
+   */
+  bool GCodeParser::parse_linear_move(char * const line) {
+    static token_t t;
+
+    const char *p = line;
+    while (*p == ' ') ++p;
+
+    // Skip N[-0-9] if included in the command line
+    if (*p == 'N' && NUMERIC_SIGNED(p[1])) {
+      p += 2;
+      while (NUMERIC(*p)) ++p;
+      while (*p == ' ') ++p;
+    }
+
+    const char * const cmd = p;
+    if (*p++ != 'G') return false;
+    if (*p == '0' && NUMERIC(p[1])) ++p;      // G00, G01
+    const char code = *p++;
+    if ((code != '0' && code != '1') || DECIMAL(*p)) return false;
+
+    t.letter = 'G';
+    t.codenum = code - '0';
+    TERN_(USE_GCODE_SUBCODES, t.subcode = 0);
+    t.codebits = t.valbits = 0;
+
+    uint8_t count = 0;
+    for (;;) {
+      while (*p == ' ') ++p;
+      const char c = *p++;
+      if (c == '\0' || c == '*') break;
+      switch (c) {
+        case 'X': case 'Y': case 'Z': case 'E': case 'F': break;
+        default: return false;
+      }
+      const uint8_t ind = LETTER_BIT(c);
+      if (TEST32(t.codebits, ind) || count >= GCODE_TOKEN_PARAMS) return false;
+      SBI32(t.codebits, ind);
+      while (*p == ' ') ++p;
+      float v;
+      if (!scan_decimal(p, v)) return false;
+      add_token_value(t, ind, v, count);
+    }
+
+    load(t);
+    command_ptr = (char*)cmd;
+    return true;
+  }
+
+  #if ENABLED(MARLIN_DEV_MODE)
+
+    /**
+     * Compare the general parser and the fast path on some typical lines,
+     * reading all the values like get_destination_from_command() would.
+     */
+    void GCodeParser::bench_linear_moves(const uint32_t count) {
+      static const char lines[][40] PROGMEM = {
+        "G1 X102.345 Y87.912 E0.04211",
+        "G1 X103.1 Y88.457 E0.02873 F1800",
+        "G0 F9000 X110.5 Y95.25",
+        "G1 Z0.3 F600",
+        "N4521 G1 X98.77 Y90.013 E0.01977*87",
+        "G1 E-0.8 F2100"
+      };
+      char line[40];
+      volatile float sum = 0;
+      LOOP_L_N(fast, 2) {
+        const millis_t start_ms = millis();
+        for (uint32_t n = 0; n < count; ++n) {
+          strcpy_P(line, lines[n % COUNT(lines)]);
+          if (!fast || !parse_linear_move(line)) parse(line);
+          LOOP_L_N(i, 5) if (seenval("XYZEF"[i])) sum += value_float();
+        }
+        const millis_t ms = _MAX(millis() - start_ms, 1UL);
+        if (fast) SERIAL_ECHOPGM("Fast G0/G1"); else SERIAL_ECHOPGM("General parser");
+        SERIAL_ECHOLNPGM(": ", count, " lines in ", ms, "ms = ", uint32_t(uint64_t(count) * 1000UL / ms), " lines/s");
+      }
+    }
+
+  #endif
+
+#endif // FAST_G0_G1_PARSER
+
 #if ENABLED(CNC_COORDINATE_SYSTEMS)
 
   // Parse the next parameter as a new command
@@ -61,13 +61,53 @@ private:
 
   #if ENABLED(FASTER_GCODE_PARSER)
     static uint32_t codebits;       // Parameters pre-scanned
-    static uint8_t param[26];       // For A-Z, offsets into command args
+    static uint8_t param[26];       // For A-Z, offsets into command args (or token value index + 1)
   #else
     static char *command_args;      // Args start here, for slow scan
   #endif
 
 public:
 
+  #if HAS_GCODE_TOKENS
+    /**
+     * A command line tokenized as it was queued. Values are stored in letter order,
+     * already converted the same way value_float() would convert them.
+     */
+    typedef struct {
+      char letter;                          // G or M
+      #if USE_GCODE_SUBCODES
+        uint8_t subcode;                    // .1
+      #endif
+      uint16_t codenum;                     // 123
+      uint32_t codebits, valbits;           // Parameters seen, and those with a value
+      float value[GCODE_TOKEN_PARAMS];      // The values, lowest letter first
+      #if ENABLED(ADVANCED_OK)
+        int32_t line_number;                // N, or -1 for none
+      #endif
+    } token_t;
+
+    static const token_t *token;            // The loaded token, or nullptr for a parsed line
+    static float token_value;               // Set by seen, used to fetch the value
+
+    #if ENABLED(GCODE_TOKEN_QUEUE)
+      // Tokenize a command line without touching the parser state.
+      // Return false for a line that must stay text.
+      static bool tokenize(const char *p, token_t &t);
+    #endif
+
+    // Populate the command line state from a token
+    static void load(const token_t &t);
+  #endif
+
+  #if ENABLED(FAST_G0_G1_PARSER)
+    // Populate the command line state from a plain G0/G1 line with only X Y Z E F values.
+    // Return false without changing the state for any other line.
+    static bool parse_linear_move(char * const line);
+    #if ENABLED(MARLIN_DEV_MODE)
+      static void bench_linear_moves(const uint32_t count);
+    #endif
+  #endif
+
   // Global states for GCode-level units features
 
   static bool volumetric_enabled;
@@ -147,6 +187,15 @@ public:
       if (ind >= COUNT(param)) return false; // Only A-Z
       const bool b = TEST32(codebits, ind);
       if (b) {
+        #if HAS_GCODE_TOKENS
+          if (token) {
+            // The value was converted when the command was queued
+            const bool has_val = TEST32(token->valbits, ind);
+            if (has_val) token_value = token->value[param[ind] - 1];
+            value_ptr = has_val ? command_ptr : nullptr;
+            return true;
+          }
+        #endif
         if (param[ind]) {
           char * const ptr = command_ptr + param[ind];
           value_ptr = valid_number(ptr) ? ptr : nullptr;
@@ -256,6 +305,7 @@ public:
 
   // Float removes 'E' to prevent scientific notation interpretation
   static float value_float() {
+    TERN_(HAS_GCODE_TOKENS, if (token) return value_ptr ? token_value : 0);
     if (value_ptr) {
       char *e = value_ptr;
       for (;;) {
@@ -275,8 +325,14 @@ public:
   }
 
   // Code value as a long or ulong
-  static int32_t value_long() { return value_ptr ? strtol(value_ptr, nullptr, 10) : 0L; }
-  static uint32_t value_ulong() { return value_ptr ? strtoul(value_ptr, nullptr, 10) : 0UL; }
+  static int32_t value_long() {
+    TERN_(HAS_GCODE_TOKENS, if (token) return value_ptr ? int32_t(token_value) : 0L);
+    return value_ptr ? strtol(value_ptr, nullptr, 10) : 0L;
+  }
+  static uint32_t value_ulong() {
+    TERN_(HAS_GCODE_TOKENS, if (token) return value_ptr ? uint32_t(int32_t(token_value)) : 0UL);
+    return value_ptr ? strtoul(value_ptr, nullptr, 10) : 0UL;
+  }
 
   // Code value for use as time
   static millis_t value_millis() { return value_ulong(); }
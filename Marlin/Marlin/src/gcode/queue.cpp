@@ -57,6 +57,22 @@ GCodeQueue queue;
   #include "../feature/repeat.h"
 #endif
 
+#if ENABLED(SD_JOB_COMPILE)
+  #include "../feature/job_cache.h"
+#endif
+
+#if ENABLED(ASYNC_USER_WAIT)
+  #include "../feature/user_wait.h"
+#endif
+
+#if ENABLED(TRACE_EVENTS)
+  #include "../feature/trace_events.h"
+#endif
+
+#if ENABLED(INPUT_REPLAY)
+  #include "../feature/input_replay.h"
+#endif
+
 // Frequently used G-code strings
 PGMSTR(G28_STR, "G28");
 
@@ -67,6 +83,129 @@ GCodeQueue::RingBuffer GCodeQueue::ring_buffer = { 0 };
   static millis_t last_command_time = 0;
 #endif
 
+#if ENABLED(SERIAL_PORT_SCHEDULING)
+  static constexpr uint8_t port_quota[] = SERIAL_PORT_QUOTAS;
+  static_assert(COUNT(port_quota) == NUM_SERIAL, "SERIAL_PORT_QUOTAS must be an array NUM_SERIAL long.");
+  static_assert(port_quota[0] && port_quota[0] <= BUFSIZE && port_quota[NUM_SERIAL - 1] && port_quota[NUM_SERIAL - 1] <= BUFSIZE, "SERIAL_PORT_QUOTAS values must be 1 to BUFSIZE.");
+#endif
+
+#if ENABLED(STREAM_STATISTICS)
+  GCodeQueue::StreamStats GCodeQueue::stream_stats; // = { 0 }
+  AutoReporter<GCodeQueue::StreamStats> GCodeQueue::stream_auto_reporter;
+
+  void GCodeQueue::StreamStats::report() {
+    StreamStats &s = stream_stats;
+    const millis_t ms = millis();
+    const float per_sec = 1000.0f / _MAX(1UL, ms - s.since);
+    SERIAL_ECHOPGM("M576");
+    LOOP_L_N(p, NUM_SERIAL)
+      SERIAL_ECHOPGM(" P", p, " B", uint32_t(s.bytes[p] * per_sec), " L", uint32_t(s.lines[p] * per_sec));
+    SERIAL_ECHOLNPGM(
+      " C", s.parsed ? s.parse_cycles / s.parsed : 0, "/", s.parse_max,
+      " T", s.moves ? s.latency / s.moves : 0, "/", s.latency_max,
+      " N", uint32_t(s.blocks * per_sec),
+      " Q", planner.movesplanned()
+    );
+    ZERO(s.bytes); ZERO(s.lines);
+    s.parsed = s.parse_cycles = s.parse_max = s.moves = s.latency = s.latency_max = s.blocks = 0;
+    s.since = ms;
+  }
+#endif
+
+#if ENABLED(HOST_SPOOL)
+  GCodeQueue::HostSpool GCodeQueue::host_spool; // = { 0 }
+
+  void GCodeQueue::HostSpool::store(const char * const cmd) {
+    const uint16_t len = strlen(cmd) + 1;
+    if (index_w + len > HOST_SPOOL_SIZE) {          // Go to the start, leaving a gap
+      if (index_w < HOST_SPOOL_SIZE) texts[index_w] = '\0';
+      used += HOST_SPOOL_SIZE - index_w;
+      index_w = 0;
+    }
+    memcpy(&texts[index_w], cmd, len);
+    index_w += len;
+    used += len;
+    lines++;
+    NOLESS(peak, used);
+  }
+
+  // The oldest line. There must be one.
+  const char* GCodeQueue::HostSpool::next_line() {
+    if (index_r >= HOST_SPOOL_SIZE || !texts[index_r]) {  // Skip the gap at the end
+      used -= HOST_SPOOL_SIZE - index_r;
+      index_r = 0;
+    }
+    return &texts[index_r];
+  }
+
+  void GCodeQueue::HostSpool::release_line() {
+    const uint16_t len = strlen(&texts[index_r]) + 1;
+    index_r += len;
+    used -= len;
+    if (!--lines) clear();                          // Start over at the beginning
+  }
+
+  void GCodeQueue::unspool_commands() {
+    while (host_spool.lines && !ring_buffer.full()) {
+      // Already acknowledged, so no "ok" when they're done
+      ring_buffer.enqueue(host_spool.next_line(), true OPTARG(HAS_MULTI_SERIAL, host_spool.port));
+      TERN_(SERIAL_PORT_SCHEDULING, serial_state[host_spool.port.index].queued++);
+      host_spool.release_line();
+    }
+  }
+
+  FORCE_INLINE bool is_M577(const char * const cmd) {
+    const char * const m577 = strstr_P(cmd, PSTR("M577"));
+    return m577 && !NUMERIC(m577[4]);
+  }
+
+  // Acknowledge a spooled line on receipt
+  static void spool_ok(const serial_index_t p, const char *cmd) {
+    PORT_REDIRECT(SERIAL_PORTMASK(p));
+    SERIAL_ECHOPGM(STR_OK);
+    #if ENABLED(ADVANCED_OK)
+      while (*cmd == ' ') cmd++;
+      if (*cmd == 'N') {
+        SERIAL_CHAR(' ', *cmd++);
+        while (NUMERIC_SIGNED(*cmd)) SERIAL_CHAR(*cmd++);
+      }
+      SERIAL_ECHOPGM_P(SP_P_STR, planner.moves_free(), SP_B_STR, queue.host_spool.lines_free());
+    #else
+      UNUSED(cmd);
+    #endif
+    SERIAL_EOL();
+  }
+
+  /**
+   * M577: Host stream spool, run on receipt
+   *
+   *  S<bool> - Spool the lines from this port, or stop spooling. Spooled lines still run.
+   *  C       - Discard the spooled lines.
+   */
+  static void spool_command(const serial_index_t p, const char * const cmd) {
+    GCodeQueue::HostSpool &spool = queue.host_spool;
+    const char * const args = strstr_P(cmd, PSTR("M577")) + 4;
+    PORT_REDIRECT(SERIAL_PORTMASK(p));
+
+    if (strchr(args, 'C')) spool.clear();
+
+    const char * const s = strchr(args, 'S');
+    if (s) {
+      const bool on = strtol(s + 1, nullptr, 10);
+      if (on && spool.lines && spool.port.index != p.index)
+        SERIAL_ERROR_MSG("Spool in use by another port");
+      else if (on != spool.enabled || spool.port.index != p.index) {
+        spool.enabled = on;
+        spool.port = p;
+        spool.peak = spool.used;
+      }
+    }
+
+    SERIAL_ECHOLNPGM("Spool:", spool.enabled, " L", spool.lines, " B", spool.used, "/", HOST_SPOOL_SIZE, " M", spool.peak);
+    SERIAL_ECHOLNPGM(STR_OK);
+  }
+#endif
+
 /**
  * Track buffer underruns
  */
@@ -104,6 +243,7 @@ void GCodeQueue::RingBuffer::commit_command(bool skip_ok
 ) {
   commands[index_w].skip_ok = skip_ok;
   TERN_(HAS_MULTI_SERIAL, commands[index_w].port = serial_ind);
+  TERN_(STREAM_STATISTICS, stream_stats.received[index_w] = millis());
   TERN_(POWER_LOSS_RECOVERY, recovery.commit_sdpos(index_w));
   advance_pos(index_w, 1);
 }
@@ -116,12 +256,87 @@ void GCodeQueue::RingBuffer::commit_command(bool skip_ok
 bool GCodeQueue::RingBuffer::enqueue(const char *cmd, bool skip_ok/*=true*/
   OPTARG(HAS_MULTI_SERIAL, serial_index_t serial_ind/*=-1*/)
 ) {
-  if (*cmd == ';' || length >= BUFSIZE) return false;
-  strcpy(commands[index_w].buffer, cmd);
+  if (*cmd == ';' || full()) return false;
+  #if EITHER(GCODE_TOKEN_QUEUE, GCODE_PACKED_QUEUE)
+    store_line(cmd);
+  #else
+    strcpy(commands[index_w].buffer, cmd);
+  #endif
   commit_command(skip_ok OPTARG(HAS_MULTI_SERIAL, serial_ind));
   return true;
 }
 
+#if ENABLED(GCODE_PACKED_QUEUE)
+
+  /**
+   * Put a line at the next text position, which must have room for it,
+   * and give the position to the command at index_w.
+   */
+  void GCodeQueue::RingBuffer::store_line(const char * const cmd) {
+    char * const dst = &texts[text_space()];
+    if (cmd != dst) strcpy(dst, cmd);
+    commands[index_w].offset = dst - texts;
+    text_w = dst - texts + strlen(dst) + 1;
+  }
+
+#endif
+
+#if ENABLED(GCODE_TOKEN_QUEUE)
+
+  bool GCodeQueue::RingBuffer::enqueue(const GCodeParser::token_t &token) {
+    if (full()) return false;
+    CommandLine &command = commands[index_w];
+    command.token = token;
+    command.text = false;
+    commit_command(true);
+    return true;
+  }
+
+  /**
+   * Tokenize a line into the command at index_w. A line that can't
+   * be tokenized takes the next text slot, which must be free.
+   */
+  void GCodeQueue::RingBuffer::store_line(const char * const cmd) {
+    CommandLine &command = commands[index_w];
+    command.text = !parser.tokenize(cmd, command.token);
+    if (command.text) {
+      if (cmd != texts[text_w]) strcpy(texts[text_w], cmd);
+      advance_text(text_w, 1);
+    }
+  }
+
+  /**
+   * Get the text of the next command. A token is spelled out again
+   * for echo and for writing to SD, with its values rounded to 5 places.
+   */
+  char* GCodeQueue::RingBuffer::peek_next_command_string() {
+    const CommandLine &command = peek_next_command();
+    if (command.text) return texts[text_r];
+
+    static char line[MAX_CMD_SIZE];
+    const GCodeParser::token_t &t = command.token;
+    char *p = line + sprintf_P(line, PSTR("%c%u"), t.letter, t.codenum);
+    #if USE_GCODE_SUBCODES
+      if (t.subcode) p += sprintf_P(p, PSTR(".%u"), t.subcode);
+    #endif
+    uint8_t v = 0;
+    LOOP_L_N(i, 26) {
+      if (!TEST32(t.codebits, i)) continue;
+      *p++ = ' ';
+      *p++ = 'A' + i;
+      if (TEST32(t.valbits, i)) {
+        dtostrf(t.value[v++], 1, 5, p);
+        p += strlen(p);
+        while (p[-1] == '0') --p;   // Drop trailing zeros
+        if (p[-1] == '.') --p;
+      }
+    }
+    *p = '\0';
+    return line;
+  }
+
+#endif // GCODE_TOKEN_QUEUE
+
 /**
  * Enqueue with Serial Echo
  * Return true if the command was consumed
@@ -253,9 +468,21 @@ void GCodeQueue::RingBuffer::ok_to_send() {
     PORT_REDIRECT(SERIAL_PORTMASK(serial_ind));   // Reply to the serial port that sent the command
   #endif
   if (command.skip_ok) return;
+  #if ENABLED(BATCHED_OK)
+    if (batched_command()) {
+      if (++serial_state[command_port().index].batched_ok >= BATCHED_OK_MAX) send_batched_ok();
+      return;
+    }
+    send_batched_ok();
+  #endif
   SERIAL_ECHOPGM(STR_OK);
   #if ENABLED(ADVANCED_OK)
-    char* p = command.buffer;
+    #if ENABLED(GCODE_TOKEN_QUEUE)
+      if (!command.text && command.token.line_number >= 0) SERIAL_ECHOPGM(" N", command.token.line_number);
+      const char *p = command.text ? texts[text_r] : "";
+    #else
+      const char *p = peek_next_command_string();
+    #endif
     if (*p == 'N') {
       SERIAL_CHAR(' ', *p++);
       while (NUMERIC_SIGNED(*p))
@@ -266,6 +493,22 @@ void GCodeQueue::RingBuffer::ok_to_send() {
   SERIAL_EOL();
 }
 
+#if ENABLED(BATCHED_OK)
+
+  void GCodeQueue::send_batched_ok() {
+    LOOP_L_N(p, NUM_SERIAL) {
+      uint8_t &count = serial_state[p].batched_ok;
+      if (!count) continue;
+      PORT_REDIRECT(SERIAL_PORTMASK(p));
+      SERIAL_ECHOPGM(STR_OK);
+      if (count > 1) SERIAL_ECHOPGM(" N", count);
+      SERIAL_EOL();
+      count = 0;
+    }
+  }
+
+#endif
+
 /**
  * Send a "Resend: nnn" message to the host to
  * indicate that a command needs to be re-sent.
@@ -281,6 +524,13 @@ void GCodeQueue::flush_and_request_resend(const serial_index_t serial_ind) {
 }
 
 static bool serial_data_available(serial_index_t index) {
+  #if ENABLED(INPUT_REPLAY)
+    // The recording takes the place of the ports. Any real input ends it.
+    if (input_replay.playing()) {
+      if (SERIAL_IMPL.available(index) <= 0) return input_replay.available(index.index) > 0;
+      input_replay.stop();
+    }
+  #endif
   const int a = SERIAL_IMPL.available(index);
   #if ENABLED(RX_BUFFER_MONITOR) && RX_BUFFER_SIZE
     if (a > RX_BUFFER_SIZE - 2) {
@@ -301,7 +551,10 @@ static bool serial_data_available(serial_index_t index) {
   }
 #endif
 
-inline int read_serial(const serial_index_t index) { return SERIAL_IMPL.read(index); }
+inline int read_serial(const serial_index_t index) {
+  TERN_(INPUT_REPLAY, if (input_replay.playing()) return input_replay.read(index.index));
+  return SERIAL_IMPL.read(index);
+}
 
 void GCodeQueue::gcode_line_error(FSTR_P const ferr, const serial_index_t serial_ind) {
   PORT_REDIRECT(SERIAL_PORTMASK(serial_ind)); // Reply to the serial port that sent the command
@@ -322,11 +575,24 @@ FORCE_INLINE bool is_M29(const char * const cmd) {  // matches "M29" & "M29 ", b
 #define PS_QUOTED 2
 #define PS_PAREN  3
 #define PS_ESC    4
+#define PS_TAG    8
+#define PS_RAW   16   // Stored as received, to scan when the line ends (SERIAL_LINE_SCAN)
 
 inline void process_stream_char(const char c, uint8_t &sis, char (&buff)[MAX_CMD_SIZE], int &ind) {
 
   if (sis == PS_EOL) return;    // EOL comment or overflow
 
+  #if HAS_COMMENT_TAGS
+    else if (sis == PS_TAG) {   // Whole-line comment, kept for its ";TYPE:" or ";LAYER:"
+      buff[ind++] = c;
+      if (ind >= MAX_CMD_SIZE - 1) {
+        ind = 0;                // Too long for a feature tag
+        sis = PS_EOL;
+      }
+      return;
+    }
+  #endif
+
   #if ENABLED(PAREN_COMMENTS)
     else if (sis == PS_PAREN) { // Inline comment
       if (c == ')') sis = PS_NORMAL;
@@ -353,7 +619,7 @@ inline void process_stream_char(const char c, uint8_t &sis, char (&buff)[MAX_CMD
   #endif
 
   else if (c == ';') {          // Start end-of-line comment
-    sis = PS_EOL;
+    sis = TERN_(HAS_COMMENT_TAGS, ind == 0 ? PS_TAG :) PS_EOL;
     return;
   }
 
@@ -375,11 +641,52 @@ inline void process_stream_char(const char c, uint8_t &sis, char (&buff)[MAX_CMD
   }
 }
 
+#if ENABLED(MOTION_PROFILES)
+
+  /**
+   * Turn a ";TYPE:<feature>" comment into "M213 P<profile>" so the profile
+   * changes in order with the moves around it. An unlisted feature selects
+   * profile 0. Return the command length, or 0 to drop any other comment.
+   */
+  static int motion_profile_command(char (&buff)[MAX_CMD_SIZE], int ind) {
+    buff[ind] = '\0';
+    if (strncmp_P(buff, PSTR("TYPE:"), 5)) return 0;
+    while (ind > 5 && buff[ind - 1] == ' ') buff[--ind] = '\0';
+    uint8_t p = 0;
+    while (p < MOTION_PROFILE_COUNT && strcmp(&buff[5], motion_profile_tag[p])) p++;
+    return sprintf_P(buff, PSTR("M213 P%i"), p < MOTION_PROFILE_COUNT ? p + 1 : 0);
+  }
+
+#endif
+
+#if ENABLED(LAYER_COMMENTS)
+
+  /**
+   * Turn a ";LAYER:<n>" (Cura) or ";LAYER_CHANGE" (PrusaSlicer) comment into
+   * "M230 L", so the layer begins in order with the moves around it.
+   * Return the command length, or 0 to drop any other comment.
+   */
+  static int layer_comment_command(char (&buff)[MAX_CMD_SIZE], int ind) {
+    buff[ind] = '\0';
+    if (!strncmp_P(buff, PSTR("LAYER:"), 6)) return sprintf_P(buff, PSTR("M230 L%i"), atoi(&buff[6]));
+    if (!strncmp_P(buff, PSTR("LAYER_CHANGE"), 12)) return sprintf_P(buff, PSTR("M230 L"));
+    return 0;
+  }
+
+#endif
+
 /**
  * Handle a line being completed. For an empty line
  * keep sensor readings going and watchdog alive.
  */
 inline bool process_line_done(uint8_t &sis, char (&buff)[MAX_CMD_SIZE], int &ind) {
+  #if HAS_COMMENT_TAGS
+    if (sis == PS_TAG) {
+      const int tag = ind;
+      ind = TERN0(MOTION_PROFILES, motion_profile_command(buff, tag));
+      TERN_(LAYER_COMMENTS, if (!ind) ind = layer_comment_command(buff, tag));
+    }
+  #endif
   sis = PS_NORMAL;                    // "Normal" Serial Input State
   buff[ind] = '\0';                   // Of course, I'm a Terminator.
   const bool is_empty = (ind == 0);   // An empty line?
@@ -390,6 +697,93 @@ inline bool process_line_done(uint8_t &sis, char (&buff)[MAX_CMD_SIZE], int &ind
   return is_empty;                    // Inform the caller
 }
 
+#if ANY(SERIAL_LINE_SCAN, SD_LINE_SPANS)
+
+  // Does the word have a byte equal to B?
+  #define _WORD_HAS(W,B) (((((W) ^ (0x01010101UL * uint8_t(B))) - 0x01010101UL) & ~((W) ^ (0x01010101UL * uint8_t(B)))) & 0x80808080UL)
+
+  // EOL also stops a run in raw file data, where the line ends are still there
+  template<bool EOL>
+  FORCE_INLINE static bool is_special_char(const char c) {
+    return c == ';' || c == '\\' || c == 0x08 || TERN0(PAREN_COMMENTS, c == '(') || TERN0(GCODE_QUOTED_STRINGS, c == '"')
+        || (EOL && ISEOL(c));
+  }
+
+  /**
+   * Length of the run of plain characters at the start of the buffer, which the
+   * input state machine would keep as they are. Looks at 4 bytes at a time.
+   */
+  template<bool EOL=false>
+  static int plain_run(const char * const buff, const int len) {
+    int i = 0;
+    for (; i + 4 <= len; i += 4) {
+      uint32_t w;
+      memcpy(&w, &buff[i], sizeof(w));    // One word load
+      if (_WORD_HAS(w, ';') | _WORD_HAS(w, '\\') | _WORD_HAS(w, 0x08)
+        | TERN0(PAREN_COMMENTS, _WORD_HAS(w, '(')) | TERN0(GCODE_QUOTED_STRINGS, _WORD_HAS(w, '"'))
+        | (EOL ? _WORD_HAS(w, '\n') | _WORD_HAS(w, '\r') : 0)
+      ) break;
+    }
+    while (i < len && !is_special_char<EOL>(buff[i])) i++;
+    return i;
+  }
+
+#endif
+
+#if ENABLED(SERIAL_LINE_SCAN)
+
+  /**
+   * Put the raw characters of a serial line through the input state machine, in
+   * place, from the first special character. Then continue character by character.
+   */
+  static void scan_raw_line(uint8_t &sis, char (&buff)[MAX_CMD_SIZE], int &ind) {
+    const int len = ind;
+    int i = plain_run(buff, len);
+    ind = i;
+    sis = PS_NORMAL;
+    if (ind >= MAX_CMD_SIZE - 1) sis = PS_EOL;  // Skip the rest on overflow
+    for (; i < len && sis != PS_EOL; ++i) process_stream_char(buff[i], sis, buff, ind);
+  }
+
+  // Store a serial character of a raw line, or scan the line when it's full
+  FORCE_INLINE static void serial_line_char(const char c, uint8_t &sis, char (&buff)[MAX_CMD_SIZE], int &ind) {
+    if (sis == PS_RAW) {
+      if (ind < MAX_CMD_SIZE - 1) { buff[ind++] = c; return; }
+      scan_raw_line(sis, buff, ind);
+    }
+    process_stream_char(c, sis, buff, ind);
+  }
+
+#endif
+
+#if ENABLED(SD_JOB_COMPILE)
+
+  bool GCodeQueue::file_line_char(const char c, uint8_t &state, char (&line)[MAX_CMD_SIZE], int &count) {
+    if (ISEOL(c)) return !process_line_done(state, line, count);
+    process_stream_char(c, state, line, count);
+    return false;
+  }
+
+#endif
+
+#if ENABLED(SERIAL_PORT_SCHEDULING)
+
+  /**
+   * Is the line an M105 or M27 status query?
+   */
+  static bool is_status_query(const char *cmd) {
+    if (*cmd == 'N') {                        // Skip the line number
+      do ++cmd; while (NUMERIC_SIGNED(*cmd));
+      while (*cmd == ' ') ++cmd;
+    }
+    if (*cmd++ != 'M') return false;
+    const char *end = cmd[0] == '1' ? (cmd[1] == '0' && cmd[2] == '5' ? cmd + 3 : nullptr)
+                                    : (cmd[0] == '2' && cmd[1] == '7' ? cmd + 2 : nullptr);
+    return end && !NUMERIC(*end);
+  }
+
+#endif
+
 /**
  * Get all commands waiting on the serial port and queue them.
  * Exit when the buffer is full or when no more characters are
@@ -418,14 +812,28 @@ void GCodeQueue::get_serial_commands() {
     }
   #endif
 
+  #if ENABLED(SERIAL_PORT_SCHEDULING)
+    static uint8_t first_port; // = 0 (The port after the last one to queue a line)
+  #endif
+
   // Loop while serial characters are incoming and the queue is not full
   for (bool hadData = true; hadData;) {
     // Unless a serial port has data, this will exit on next iteration
     hadData = false;
 
-    LOOP_L_N(p, NUM_SERIAL) {
+    LOOP_L_N(i, NUM_SERIAL) {
+      const uint8_t p = TERN(SERIAL_PORT_SCHEDULING, (first_port + i) % NUM_SERIAL, i);
+
       // Check if the queue is full and exit if it is.
-      if (ring_buffer.full()) return;
+      #if ENABLED(HOST_SPOOL)
+        // (The spooling port only needs room in the spool.)
+        if (host_spool.spooling(p) ? !host_spool.has_room() : ring_buffer.full()) continue;
+      #else
+        if (ring_buffer.full()) return;
+      #endif
+
+      // Leave data in the RX buffer of a port that has used its share of the queue
+      if (TERN0(SERIAL_PORT_SCHEDULING, serial_state[p].queued >= port_quota[p])) continue;
 
       // No data for this port ? Skip it
       if (!serial_data_available(p)) continue;
@@ -443,15 +851,29 @@ void GCodeQueue::get_serial_commands() {
         SERIAL_FLUSH();
         continue;
       }
+      TERN_(STREAM_STATISTICS, stream_stats.bytes[p]++);
+      TERN_(INPUT_REPLAY, input_replay.serial_byte(p, c));
+
+      #if ENABLED(HOST_BLOCK_STREAM)
+        if (host_blocks.maybe_store_rxd_char(c)) continue;
+      #endif
+
+      #if ENABLED(DIRECT_STEPPING) && !defined(__AVR__)
+        // Other HALs have no page hook in the RX interrupt, so take pages here
+        if (page_manager.maybe_store_rxd_char(c)) continue;
+      #endif
 
       const char serial_char = (char)c;
       SerialState &serial = serial_state[p];
 
       if (ISEOL(serial_char)) {
 
+        TERN_(SERIAL_LINE_SCAN, if (serial.input_state == PS_RAW) scan_raw_line(serial.input_state, serial.line_buffer, serial.count));
+
         // Reset our state, continue if the line was empty
-        if (process_line_done(serial.input_state, serial.line_buffer, serial.count))
-          continue;
+        const bool is_empty = process_line_done(serial.input_state, serial.line_buffer, serial.count);
+        TERN_(SERIAL_LINE_SCAN, serial.input_state = PS_RAW);   // Store the next line as it comes
+        if (is_empty) continue;
 
         char* command = serial.line_buffer;
 
@@ -533,18 +955,99 @@ void GCodeQueue::get_serial_commands() {
           last_command_time = ms;
         #endif
 
+        TERN_(STREAM_STATISTICS, stream_stats.lines[p]++);
+
+        #if ENABLED(HOST_SPOOL)
+          // Control the spool right away, ahead of the lines in it
+          if (is_M577(command)) {
+            TERN_(BATCHED_OK, send_batched_ok());
+            spool_command(p, command);
+            continue;
+          }
+        #endif
+
+        #if ENABLED(SERIAL_PORT_SCHEDULING)
+          // Answer a status query now if its port has nothing ahead of it in the queue
+          if (!serial.queued && is_status_query(command)) {
+            TERN_(BATCHED_OK, send_batched_ok());
+            PORT_REDIRECT(SERIAL_PORTMASK(p));
+            parser.parse(command);
+            gcode.process_parsed_command(true);
+            if (parser.codenum != 105) SERIAL_ECHOLNPGM(STR_OK); // M105 says "ok" itself
+            continue;
+          }
+        #endif
+
+        #if ENABLED(HOST_SPOOL)
+          // Store the line and tell the host to send the next one
+          if (host_spool.spooling(p)) {
+            host_spool.store(serial.line_buffer);
+            spool_ok(p, serial.line_buffer);
+            continue;
+          }
+        #endif
+
         // Add the command to the queue
-        ring_buffer.enqueue(serial.line_buffer, false OPTARG(HAS_MULTI_SERIAL, p));
+        #if ENABLED(SERIAL_PORT_SCHEDULING)
+          if (ring_buffer.enqueue(serial.line_buffer, false, p)) {
+            serial.queued++;
+            first_port = (p + 1) % NUM_SERIAL;
+          }
+        #else
+          ring_buffer.enqueue(serial.line_buffer, false OPTARG(HAS_MULTI_SERIAL, p));
+        #endif
       }
       else
-        process_stream_char(serial_char, serial.input_state, serial.line_buffer, serial.count);
+        TERN(SERIAL_LINE_SCAN, serial_line_char, process_stream_char)(serial_char, serial.input_state, serial.line_buffer, serial.count);
 
     } // NUM_SERIAL loop
   } // queue has space, serial has data
+
+  // The hosts have sent all they can until they get an "ok"
+  TERN_(BATCHED_OK, send_batched_ok());
 }
 
 #if ENABLED(SDSUPPORT)
 
+  #if DISABLED(PARK_HEAD_ON_PAUSE)
+    // When M25 is non-blocking it can still suspend SD commands
+    // Otherwise the M125 handler needs to know SD printing is active
+    inline void pause_on_M25(const char * const cmd) {
+      if (cmd[0] == 'M' && cmd[1] == '2' && cmd[2] == '5' && !NUMERIC(cmd[3])) {
+        card.pauseSDPrint();
+        TERN_(REPEAT_CACHE, repeat.drop_cache()); // A replayed M25 wouldn't pause
+      }
+    }
+  #endif
+
+  #if ENABLED(SD_LINE_SPANS)
+
+    /**
+     * Take the plain characters at the read position straight from the cached
+     * block, up to the next line end or special character, in one copy. Skip a
+     * comment or an overflowed line up to its end the same way. Leave the last
+     * byte of the file to card.get() since it ends the line.
+     */
+    static void take_sd_span(uint8_t &sis, char (&buff)[MAX_CMD_SIZE], int &ind) {
+      if (sis != PS_NORMAL && sis != PS_EOL) return;
+      uint16_t len;
+      const char * const span = card.span(len);
+      if (!span) return;
+      if (card.getIndex() + len >= card.getFileSize()) --len;
+      uint16_t n = 0;
+      if (sis == PS_EOL)
+        while (n < len && !ISEOL(span[n])) n++;
+      else {
+        n = plain_run<true>(span, _MIN(len, uint16_t(MAX_CMD_SIZE - 1 - ind)));
+        memcpy(&buff[ind], span, n);
+        ind += n;
+        if (ind >= MAX_CMD_SIZE - 1) sis = PS_EOL;  // Skip the rest on overflow
+      }
+      card.skip(n);
+    }
+
+  #endif
+
   /**
    * Get lines from the SD Card until the command buffer is full
    * or until the end of the file is reached. Because this method
@@ -557,42 +1060,134 @@ void GCodeQueue::get_serial_commands() {
     // Get commands if there are more in the file
     if (!IS_SD_FETCHING()) return;
 
+    // Leave the media to the host while it's writing over USB
+    if (TERN0(HAS_SD_HOST_DRIVE, card.host_is_writing())) return;
+
+    #if ENABLED(REPEAT_CACHE)
+      // Replay a cached loop body with no reading or parsing of the file
+      if (repeat.is_replaying()) {
+        cached_command_t c;
+        while (!ring_buffer.full() && repeat.replay_command(c)) {
+          TERN_(POWER_LOSS_RECOVERY, recovery.cmd_sdpos = c.sdpos);
+          #if ENABLED(GCODE_TOKEN_QUEUE)
+            if (!c.text) ring_buffer.enqueue(c.token); else
+          #endif
+          ring_buffer.enqueue(c.text);
+          TERN_(POWER_LOSS_RECOVERY, recovery.cmd_sdpos = card.getIndex());
+        }
+        if (repeat.is_replaying()) return;
+        if (card.eof() && TERN1(SD_PRINT_WHILE_UPLOADING, !card.flag.growing))
+          return card.fileHasFinished();
+      }
+    #endif
+
+    #if ENABLED(SD_JOB_COMPILE)
+      // Queue the records of the compiled file, with the G-code position following along
+      if (job_cache.is_playing() && TERN1(SD_PRINT_WHILE_UPLOADING, !card.flag.growing)) {
+        compiled_command_t c;
+        while (!ring_buffer.full() && !card.eof() && job_cache.next_command(c, card.getIndex())) {
+          TERN_(POWER_LOSS_RECOVERY, recovery.cmd_sdpos = c.sdpos);
+          card.setIndex(c.end);
+          if (c.text) {
+            TERN_(GCODE_REPEAT_MARKERS, repeat.early_parse_M808(c.text));
+            IF_DISABLED(PARK_HEAD_ON_PAUSE, pause_on_M25(c.text));
+            ring_buffer.enqueue(c.text);
+          }
+          else
+            ring_buffer.enqueue(c.token);
+          TERN_(POWER_LOSS_RECOVERY, recovery.cmd_sdpos = card.getIndex());
+        }
+        if (job_cache.is_playing()) {
+          if (card.eof() || job_cache.at_end()) card.fileHasFinished();
+          return;
+        }
+        // Else read on from the G-code
+      }
+    #endif
+
+    #if ENABLED(SD_PRINT_WHILE_UPLOADING)
+      // Read up to the data uploaded so far. The upload may have ended at a line break.
+      if (card.flag.growing)
+        card.followUpload();
+      else if (card.eof())
+        return card.fileHasFinished();
+      uint32_t line_start = card.getIndex();
+    #endif
+
     int sd_count = 0;
-    while (!ring_buffer.full() && !card.eof()) {
+    while (!ring_buffer.full() && !card.eof() && !TERN0(REPEAT_CACHE, repeat.is_replaying())) {
+      TERN_(SD_LINE_SPANS, take_sd_span(sd_input_state, ring_buffer.next_line_buffer(), sd_count));
       const int16_t n = card.get();
       const bool card_eof = card.eof();
-      if (n < 0 && !card_eof) { SERIAL_ERROR_MSG(STR_SD_ERR_READ); continue; }
+      if (n < 0 && !card_eof) {
+        SERIAL_ERROR_MSG(STR_SD_ERR_READ);
+        if (card.flag.abort_sd_printing) return;      // The read error ended the print
+        continue;
+      }
 
-      CommandLine &command = ring_buffer.commands[ring_buffer.index_w];
+      char (&buffer)[MAX_CMD_SIZE] = ring_buffer.next_line_buffer();
       const char sd_char = (char)n;
       const bool is_eol = ISEOL(sd_char);
+
+      #if ENABLED(SD_PRINT_WHILE_UPLOADING)
+        // Come back for a line that's still being uploaded
+        if (card_eof && !is_eol && card.flag.growing) {
+          card.setIndex(line_start);
+          sd_input_state = PS_NORMAL;
+          return;
+        }
+      #endif
+
       if (is_eol || card_eof) {
 
         // Reset stream state, terminate the buffer, and commit a non-empty command
         if (!is_eol && sd_count) ++sd_count;          // End of file with no newline
-        if (!process_line_done(sd_input_state, command.buffer, sd_count)) {
+        if (!process_line_done(sd_input_state, buffer, sd_count)) {
 
           // M808 L saves the sdpos of the next line. M808 loops to a new sdpos.
-          TERN_(GCODE_REPEAT_MARKERS, repeat.early_parse_M808(command.buffer));
+          TERN_(GCODE_REPEAT_MARKERS, repeat.early_parse_M808(buffer));
 
-          #if DISABLED(PARK_HEAD_ON_PAUSE)
-            // When M25 is non-blocking it can still suspend SD commands
-            // Otherwise the M125 handler needs to know SD printing is active
-            if (command.buffer[0] == 'M' && command.buffer[1] == '2' && command.buffer[2] == '5' && !NUMERIC(command.buffer[3]))
-              card.pauseSDPrint();
-          #endif
+          IF_DISABLED(PARK_HEAD_ON_PAUSE, pause_on_M25(buffer));
 
           // Put the new command into the buffer (no "ok" sent)
+          #if EITHER(GCODE_TOKEN_QUEUE, GCODE_PACKED_QUEUE)
+            ring_buffer.store_line(buffer);
+          #endif
+
+          #if ENABLED(REPEAT_CACHE)
+            // Keep the command for the next pass of a loop
+            #if ENABLED(GCODE_TOKEN_QUEUE)
+              const GCodeQueue::CommandLine &command = ring_buffer.commands[ring_buffer.index_w];
+            #endif
+            repeat.cache_command(buffer OPTARG(GCODE_TOKEN_QUEUE, command.text ? nullptr : &command.token), card.getIndex());
+          #endif
+
           ring_buffer.commit_command(true);
 
           // Prime Power-Loss Recovery for the NEXT commit_command
           TERN_(POWER_LOSS_RECOVERY, recovery.cmd_sdpos = card.getIndex());
+
+          #if ENABLED(CANCEL_OBJECTS_SEEK)
+            // After "M486 S<n>" for a canceled object seek past its moves and
+            // queue the E position and feedrate they would have left
+            CardReader::skip_range_t skip;
+            if (!ring_buffer.full(3) && card.skip_canceled(skip)) {
+              TERN_(REPEAT_CACHE, repeat.drop_cache());   // The loop body is no longer contiguous
+              char cmd[24], num[16];
+              if (skip.has_e) { sprintf_P(cmd, PSTR("G92 E%s"), dtostrf(skip.e, 1, 5, num)); ring_buffer.enqueue(cmd); }
+              if (skip.has_f) { sprintf_P(cmd, PSTR("G1 F%s"), dtostrf(skip.f, 1, 1, num)); ring_buffer.enqueue(cmd); }
+              TERN_(POWER_LOSS_RECOVERY, recovery.cmd_sdpos = card.getIndex());
+            }
+          #endif
         }
 
-        if (card.eof()) card.fileHasFinished();         // Handle end of file reached
+        if (card.eof() && TERN1(SD_PRINT_WHILE_UPLOADING, !card.flag.growing) && !TERN0(REPEAT_CACHE, repeat.is_replaying()))
+          card.fileHasFinished();                       // Handle end of file reached
+
+        TERN_(SD_PRINT_WHILE_UPLOADING, line_start = card.getIndex());
       }
       else
-        process_stream_char(sd_char, sd_input_state, command.buffer, sd_count);
+        process_stream_char(sd_char, sd_input_state, buffer, sd_count);
     }
   }
 
@@ -605,7 +1200,10 @@ void GCodeQueue::get_serial_commands() {
  *  - The SD card file being actively printed
  */
 void GCodeQueue::get_available_commands() {
-  if (ring_buffer.full()) return;
+  TERN_(HOST_SPOOL, unspool_commands());
+
+  // With the queue full, only the spooling port can still take lines
+  if (ring_buffer.full() && !TERN0(HOST_SPOOL, host_spool.enabled)) return;
 
   get_serial_commands();
 
@@ -625,6 +1223,12 @@ void GCodeQueue::exhaust() {
  */
 void GCodeQueue::advance() {
 
+  #if ENABLED(ASYNC_USER_WAIT)
+    // While M0/M1 waits for the user hold everything but status queries
+    if (user_wait.holding() && (ring_buffer.empty() || !user_wait.can_run(ring_buffer.peek_next_command_string())))
+      return;
+  #endif
+
   // Process immediate commands
   if (process_injected_command_P() || process_injected_command()) return;
 
@@ -648,6 +1252,8 @@ void GCodeQueue::advance() {
     }
   #endif
 
+  TERN_(TRACE_EVENTS, TRACE_SCOPE(TRACE_QUEUE_ADVANCE));
+
   #if ENABLED(SDSUPPORT)
 
     if (card.flag.saving) {
@@ -687,6 +1293,11 @@ void GCodeQueue::advance() {
   #endif // SDSUPPORT
 
   // The queue may be reset by a command handler or by code invoked by idle() within a handler
+  TERN_(GCODE_TOKEN_QUEUE, ring_buffer.release_text());
+  #if ENABLED(SERIAL_PORT_SCHEDULING)
+    const serial_index_t port = ring_buffer.command_port();
+    if (port.valid() && port.index < NUM_SERIAL && serial_state[port.index].queued) serial_state[port.index].queued--;
+  #endif
   ring_buffer.advance_pos(ring_buffer.index_r, -1);
 }
 
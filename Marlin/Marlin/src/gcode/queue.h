@@ -28,6 +28,14 @@
 
 #include "../inc/MarlinConfig.h"
 
+#if EITHER(GCODE_TOKEN_QUEUE, BATCHED_OK)
+  #include "parser.h"
+#endif
+
+#if ENABLED(STREAM_STATISTICS)
+  #include "../libs/autoreport.h"
+#endif
+
 class GCodeQueue {
 public:
   /**
@@ -43,6 +51,12 @@ public:
     int count;                      //!< Number of characters read in the current line of serial input
     char line_buffer[MAX_CMD_SIZE]; //!< The current line accumulator
     uint8_t input_state;            //!< The input state
+    #if ENABLED(BATCHED_OK)
+      uint8_t batched_ok;           //!< Moves processed but not yet acknowledged
+    #endif
+    #if ENABLED(SERIAL_PORT_SCHEDULING)
+      uint8_t queued;               //!< Commands from this port in the queue
+    #endif
   };
 
   static SerialState serial_state[NUM_SERIAL]; //!< Serial states for each serial port
@@ -55,9 +69,22 @@ public:
    * (immediate, serial, sd card) and they are processed sequentially by
    * the main loop. The gcode.process_next_command method parses the next
    * command and hands off execution to individual handler functions.
+   *
+   * With GCODE_TOKEN_QUEUE most commands are tokenized as they are copied in,
+   * and only the lines that can't be tokenized go into a ring of text slots.
+   *
+   * With GCODE_PACKED_QUEUE the lines are stored end to end in a ring of
+   * GCODE_QUEUE_BYTES, each taking only its own length.
    */
   struct CommandLine {
-    char buffer[MAX_CMD_SIZE];      //!< The command buffer
+    #if ENABLED(GCODE_TOKEN_QUEUE)
+      GCodeParser::token_t token;   //!< The tokenized command
+      bool text;                    //!< The command is in the text ring instead
+    #elif ENABLED(GCODE_PACKED_QUEUE)
+      uint16_t offset;              //!< Start of the command in the text ring
+    #else
+      char buffer[MAX_CMD_SIZE];    //!< The command buffer
+    #endif
     bool skip_ok;                   //!< Skip sending ok when command is processed?
     #if HAS_MULTI_SERIAL
       serial_index_t port;          //!< Serial port the command was received on
@@ -73,9 +100,56 @@ public:
             index_w;                //!< Ring buffer's write position
     CommandLine commands[BUFSIZE];  //!< The ring buffer of commands
 
+    #if ENABLED(GCODE_TOKEN_QUEUE)
+      uint8_t text_length,          //!< Number of text lines in the queue
+              text_r,               //!< Text ring's read position
+              text_w;               //!< Text ring's write position
+      char texts[GCODE_TEXT_SLOTS][MAX_CMD_SIZE]; //!< Lines that couldn't be tokenized
+
+      void advance_text(uint8_t &p, const int inc) { if (++p >= GCODE_TEXT_SLOTS) p = 0; text_length += inc; }
+
+      // Tokenize a line into the next command, or copy it to the next text slot
+      void store_line(const char * const cmd);
+
+      // Release the text slot of the command being retired
+      void release_text() { if (commands[index_r].text && text_length) advance_text(text_r, -1); }
+
+    #elif ENABLED(GCODE_PACKED_QUEUE)
+
+      uint16_t text_w;              //!< Text ring's write position
+      #if ENABLED(MEMORY_PROFILES)
+        char *texts;                //!< Command lines, end to end, in the memory profile's share
+        uint16_t text_size;         //!< Bytes at texts
+
+        // Move the text ring to a new share of the arena, emptying the queue
+        void set_texts(char * const buf, const uint16_t size) { texts = buf; text_size = size; clear(); }
+      #else
+        char texts[GCODE_QUEUE_BYTES]; //!< Command lines, end to end, that begin at commands[].offset
+        static constexpr uint16_t text_size = GCODE_QUEUE_BYTES;
+      #endif
+
+      /**
+       * Where the next line goes, with 'need' bytes free after it, or -1 if there's no room.
+       * Lines don't wrap. If the end of the ring is too short the line goes to the start.
+       */
+      int16_t text_space(const uint16_t need=MAX_CMD_SIZE) const {
+        if (!length) return 0;
+        const uint16_t r = commands[index_r].offset;  // The oldest line still in use
+        if (text_w > r) return text_size - text_w >= need ? text_w : (r > need ? 0 : -1);
+        return r - text_w > need ? text_w : -1;
+      }
+
+      // Copy a line, if it's not already in place, to the next text position
+      void store_line(const char * const cmd);
+    #endif
+
     inline serial_index_t command_port() const { return TERN0(HAS_MULTI_SERIAL, commands[index_r].port); }
 
-    inline void clear() { length = index_r = index_w = 0; }
+    inline void clear() {
+      length = index_r = index_w = 0;
+      TERN_(GCODE_TOKEN_QUEUE, text_length = text_r = text_w = 0);
+      TERN_(GCODE_PACKED_QUEUE, text_w = 0);
+    }
 
     void advance_pos(uint8_t &p, const int inc) { if (++p >= BUFSIZE) p = 0; length += inc; }
 
@@ -87,9 +161,18 @@ public:
       OPTARG(HAS_MULTI_SERIAL, serial_index_t serial_ind = serial_index_t())
     );
 
+    #if ENABLED(GCODE_TOKEN_QUEUE)
+      // Queue a command that is already tokenized, with no "ok"
+      bool enqueue(const GCodeParser::token_t &token);
+    #endif
+
     void ok_to_send();
 
-    inline bool full(uint8_t cmdCount=1) const { return length > (BUFSIZE - cmdCount); }
+    inline bool full(uint8_t cmdCount=1) const {
+      return length > (BUFSIZE - cmdCount)
+        || TERN0(GCODE_TOKEN_QUEUE, text_length >= GCODE_TEXT_SLOTS)
+        || TERN0(GCODE_PACKED_QUEUE, text_space(cmdCount * MAX_CMD_SIZE) < 0);
+    }
 
     inline bool occupied() const { return length != 0; }
 
@@ -97,7 +180,25 @@ public:
 
     inline CommandLine& peek_next_command() { return commands[index_r]; }
 
-    inline char* peek_next_command_string() { return peek_next_command().buffer; }
+    #if ENABLED(GCODE_TOKEN_QUEUE)
+      // The text of the next command, spelled out again for a token
+      char* peek_next_command_string();
+    #elif ENABLED(GCODE_PACKED_QUEUE)
+      inline char* peek_next_command_string() { return &texts[peek_next_command().offset]; }
+    #else
+      inline char* peek_next_command_string() { return peek_next_command().buffer; }
+    #endif
+
+    // Space for the next line, for it to be read in place. The queue must not be full.
+    inline char (&next_line_buffer())[MAX_CMD_SIZE] {
+      #if ENABLED(GCODE_TOKEN_QUEUE)
+        return texts[text_w];
+      #elif ENABLED(GCODE_PACKED_QUEUE)
+        return *reinterpret_cast<char (*)[MAX_CMD_SIZE]>(&texts[text_space()]);
+      #else
+        return commands[index_w].buffer;
+      #endif
+    }
   };
 
   /**
@@ -108,7 +209,10 @@ public:
   /**
    * Clear the Marlin command queue
    */
-  static void clear() { ring_buffer.clear(); }
+  static void clear() {
+    ring_buffer.clear();
+    TERN_(SERIAL_PORT_SCHEDULING, LOOP_L_N(p, NUM_SERIAL) serial_state[p].queued = 0);
+  }
 
   /**
    * Next Injected Command (PROGMEM) pointer. (nullptr == empty)
@@ -195,6 +299,20 @@ public:
    */
   static void ok_to_send() { ring_buffer.ok_to_send(); }
 
+  #if ENABLED(BATCHED_OK)
+    /**
+     * Acknowledge the held-back moves of each serial port with
+     * one "ok N<count>" message, or a plain "ok" for one move.
+     */
+    static void send_batched_ok();
+
+    // Before running any other command, so replies keep their order
+    static void sync_batched_ok() { if (!batched_command()) send_batched_ok(); }
+
+    // Plain moves (G0-G3) are acknowledged in batches
+    static bool batched_command() { return parser.command_letter == 'G' && parser.codenum <= 3; }
+  #endif
+
   /**
    * Clear the serial line and request a resend of
    * the next expected line number.
@@ -206,6 +324,79 @@ public:
    */
   static void set_current_line_number(long n) { serial_state[ring_buffer.command_port().index].last_N = n; }
 
+  #if ENABLED(SD_JOB_COMPILE)
+    // Read a character of a G-code file into a line, as for a print. Return true when it ends a command.
+    static bool file_line_char(const char c, uint8_t &state, char (&line)[MAX_CMD_SIZE], int &count);
+  #endif
+
+  #if ENABLED(STREAM_STATISTICS)
+    /**
+     * Serial stream statistics, for telling serial-bound stalls from planner-bound ones.
+     * Reported by M576 and its auto-report with:
+     *  P<n> B<uint> L<uint>  Bytes and lines per second received on serial port n
+     *  C<avg>/<max>          Parse time per command in CPU cycles (0 without a cycle counter)
+     *  T<avg>/<max>          Milliseconds from receiving a line until its move was planned
+     *  N<uint>               Blocks added to the planner per second
+     *  Q<uint>               Moves in the planner
+     */
+    struct StreamStats {
+      uint32_t bytes[NUM_SERIAL], lines[NUM_SERIAL]; // Received in the current period
+      uint32_t parsed, parse_cycles, parse_max;      // Commands parsed and their parse time
+      uint32_t moves, latency, latency_max;          // Commands that planned a move, and their time since receipt
+      uint32_t blocks;                               // Blocks added to the planner
+      millis_t since;                                // Start of the current period
+      millis_t received[BUFSIZE];                    // Receipt time of each queued command
+
+      void parsed_command(const uint32_t cycles) { ++parsed; parse_cycles += cycles; NOLESS(parse_max, cycles); }
+      void planned_move(const millis_t received_ms) {
+        const uint32_t ms = millis() - received_ms;
+        ++moves; latency += ms; NOLESS(latency_max, ms);
+      }
+
+      // Report and start a new period
+      static void report();
+    };
+    static StreamStats stream_stats;
+    static AutoReporter<StreamStats> stream_auto_reporter;
+  #endif
+
+  #if ENABLED(HOST_SPOOL)
+    /**
+     * Host Stream Spool
+     * Lines from the spooling port, acknowledged on receipt, waiting for room in
+     * the queue. They are stored end to end and don't wrap. A line that doesn't
+     * fit at the end of the ring goes to the start, leaving a 0 byte behind it.
+     */
+    struct HostSpool {
+      bool enabled;                 //!< Spool the new lines from 'port'
+      serial_index_t port;          //!< The port being spooled
+      uint16_t index_r,             //!< Start of the oldest line
+               index_w,             //!< Where the next line goes
+               used,                //!< Bytes in use, including a gap left at the end
+               peak,                //!< The most bytes used since spooling was enabled
+               lines;               //!< Lines waiting for the queue
+      char texts[HOST_SPOOL_SIZE];
+
+      // Lines from the port go to the spool while it's enabled, and while it still has lines, to keep their order
+      bool spooling(const serial_index_t p) const { return (enabled || lines) && p.index == port.index; }
+
+      // Room for another line, with a gap at the end of the ring
+      bool has_room() const { return used <= HOST_SPOOL_SIZE - 2 * (MAX_CMD_SIZE); }
+
+      // Lines that surely fit, for ADVANCED_OK
+      uint16_t lines_free() const { return has_room() ? (HOST_SPOOL_SIZE - used) / (MAX_CMD_SIZE) - 1 : 0; }
+
+      void store(const char * const cmd);
+      const char* next_line();
+      void release_line();
+      void clear() { index_r = index_w = used = lines = 0; }
+    };
+    static HostSpool host_spool;
+
+    // Move spooled lines into the queue while it has room
+    static void unspool_commands();
+  #endif
+
   #if ENABLED(BUFFER_MONITORING)
 
     private:
@@ -92,6 +92,9 @@ void GcodeSuite::M1001() {
     SERIAL_ECHOLNPGM(STR_FILE_PRINTED);
   }
 
+  // Start the next queued file right away
+  if (TERN0(SD_JOB_QUEUE, card.job_queue_next())) return;
+
   // Update the status LED color
   #if HAS_LEDS_OFF_FLAG
     if (long_print) {
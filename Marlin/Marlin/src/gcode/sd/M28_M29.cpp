@@ -33,32 +33,50 @@
 
 /**
  * M28: Start SD Write
+ *
+ *  B<mode>   - Binary transfer mode (Requires BINARY_FILE_TRANSFER)
+ *  P<KB>     - With B1, print the next upload once this much has arrived (Requires SD_PRINT_WHILE_UPLOADING)
+ *  S<bytes>  - Expected file size, to pre-allocate the file (Requires SD_WRITE_BUFFER)
  */
 void GcodeSuite::M28() {
+  char *p = parser.string_arg;
 
   #if ENABLED(BINARY_FILE_TRANSFER)
 
     bool binary_mode = false;
-    char *p = parser.string_arg;
     if (p[0] == 'B' && NUMERIC(p[1])) {
       binary_mode = p[1] > '0';
       p += 2;
       while (*p == ' ') ++p;
     }
 
+    #if ENABLED(SD_PRINT_WHILE_UPLOADING)
+      card.upload_print_size = 0;
+      if (binary_mode && p[0] == 'P') {
+        const uint32_t kb = strtoul(p + 1, &p, 10);
+        card.upload_print_size = (kb ? kb : SD_UPLOAD_PRINT_START_KB) * 1024UL;
+        while (*p == ' ') ++p;
+      }
+    #endif
+
     // Binary transfer mode
     if ((card.flag.binary_mode = binary_mode)) {
       SERIAL_ECHO_MSG("Switching to Binary Protocol");
       TERN_(HAS_MULTI_SERIAL, card.transfer_port_index = queue.ring_buffer.command_port().index);
+      return;
     }
-    else
-      card.openFileWrite(p);
 
-  #else
-
-    card.openFileWrite(parser.string_arg);
+  #endif
 
+  #if ENABLED(SD_WRITE_BUFFER)
+    uint32_t size = 0;
+    if (p[0] == 'S' && NUMERIC(p[1])) {
+      size = strtoul(p + 1, &p, 10);
+      while (*p == ' ') ++p;
+    }
   #endif
+
+  card.openFileWrite(p OPTARG(SD_WRITE_BUFFER, size));
 }
 
 /**
@@ -0,0 +1,55 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(SD_JOB_QUEUE)
+
+#include "../gcode.h"
+#include "../../sd/cardreader.h"
+
+/**
+ * M36: Queue SD files to print one after another
+ *
+ *   M36 /path/file.gco   Add a file to the end of the queue
+ *   M36 S                Start the first queued file, if nothing is printing
+ *   M36 C                Clear the queue
+ *   M36                  Report the queue
+ *
+ * Each file starts when the one before it is done (M1001).
+ */
+void GcodeSuite::M36() {
+  const char * const arg = parser.string_arg;
+
+  if (!arg || !*arg)
+    card.job_queue_report();
+  else if (!strcmp_P(arg, PSTR("C")))
+    card.job_queue_clear();
+  else if (!strcmp_P(arg, PSTR("S"))) {
+    if (!IS_SD_FILE_OPEN() && !card.job_queue_next())
+      SERIAL_ECHO_MSG("!Job queue empty.");
+  }
+  else if (card.isMounted())
+    card.job_queue_add(arg);
+}
+
+#endif // SD_JOB_QUEUE
@@ -0,0 +1,53 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(SD_JOB_COMPILE)
+
+#include "../gcode.h"
+#include "../../sd/cardreader.h"
+#include "../../feature/job_cache.h"
+
+/**
+ * M37: Compile an SD file for printing without parsing
+ *
+ *   M37 /path/file.gco   Compile the file to FILE.GCB in the same folder, in the background
+ *   M37                  Report the compile, and whether the print is from a compiled file
+ *
+ * A print of the file uses FILE.GCB while it matches the file's size and date.
+ */
+void GcodeSuite::M37() {
+  const char * const arg = parser.string_arg;
+
+  if (!arg || !*arg)
+    job_cache.report();
+  else if (card.isMounted()) {
+    SdFile *dir;
+    const char * const fname = card.diveToFile(false, dir, arg);
+    if (fname) job_cache.compile(dir, fname);
+  }
+  else
+    SERIAL_ECHO_MSG(STR_NO_MEDIA);
+}
+
+#endif // SD_JOB_COMPILE
@@ -66,9 +66,16 @@
  * M109 Parameters
  *  R<target> : The target temperature in current units. Wait for heating and cooling.
  *
+ * With PREHEAT_SCHEDULER...
+ *  D<seconds> : M104 only. Start heating in time to reach the target this many seconds from now.
+ *
  * Examples
  *  M104 S100 : Set target to 100° and return.
  *  M109 R150 : Set target to 150°. Wait until the hotend gets close to 150°.
+ *  M104 S210 D90 : Have the hotend at 210° in 90 seconds, after homing and probing.
+ *
+ * With MULTI_NOZZLE_DUPLICATION (M605 S2) a T0 target also goes to the other duplicating
+ *  nozzles, and M109 waits for all of them.
  *
  * With PRINTJOB_TIMER_AUTOSTART turning on heaters will start the print job timer
  *  (used by printingIsActive, etc.) and turning off heaters will stop the timer.
@@ -109,6 +116,14 @@ void GcodeSuite::M104_M109(const bool isM109) {
       thermalManager.singlenozzle_temp[target_extruder] = temp;
       if (target_extruder != active_extruder) return;
     #endif
+
+    #if ENABLED(PREHEAT_SCHEDULER)
+      if (!isM109 && temp && parser.seenval('D')) {
+        thermalManager.schedule_hotend(temp, target_extruder, SEC_TO_MS(parser.value_ushort()));
+        return;
+      }
+    #endif
+
     thermalManager.setTargetHotend(temp, target_extruder);
 
     #if ENABLED(DUAL_X_CARRIAGE)
@@ -116,6 +131,12 @@ void GcodeSuite::M104_M109(const bool isM109) {
         thermalManager.setTargetHotend(temp ? temp + duplicate_extruder_temp_offset : 0, 1);
     #endif
 
+    #if ENABLED(MULTI_NOZZLE_DUPLICATION)
+      // The duplicating nozzles print the same part, so they follow T0
+      if (extruder_duplication_enabled && target_extruder == 0)
+        HOTEND_LOOP() if (e && TEST(duplication_e_mask, e)) thermalManager.setTargetHotend(temp, e);
+    #endif
+
     #if ENABLED(PRINTJOB_TIMER_AUTOSTART)
       /**
        * Use half EXTRUDE_MINTEMP to allow nozzles to be put into hot
@@ -131,8 +152,13 @@ void GcodeSuite::M104_M109(const bool isM109) {
 
   TERN_(AUTOTEMP, planner.autotemp_M104_M109());
 
-  if (isM109 && got_temp)
+  if (isM109 && got_temp) {
     (void)thermalManager.wait_for_hotend(target_extruder, no_wait_for_cooling);
+    #if ENABLED(MULTI_NOZZLE_DUPLICATION)
+      if (extruder_duplication_enabled && target_extruder == 0)
+        HOTEND_LOOP() if (e && TEST(duplication_e_mask, e)) (void)thermalManager.wait_for_hotend(e, no_wait_for_cooling);
+    #endif
+  }
 }
 
 #endif // EXTRUDERS
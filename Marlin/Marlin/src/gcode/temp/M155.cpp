@@ -29,12 +29,20 @@
 
 /**
  * M155: Set temperature auto-report interval. M155 S<seconds>
+ *
+ * With TEMP_TELEMETRY:
+ *  B<ms>  Interval to send the recorded readings in binary (0 to stop, max 2550)
  */
 void GcodeSuite::M155() {
 
   if (parser.seenval('S'))
     thermalManager.auto_reporter.set_interval(parser.value_byte());
 
+  #if ENABLED(TEMP_TELEMETRY)
+    if (parser.seenval('B'))
+      thermalManager.telemetry_reporter.set_interval(_MIN(parser.value_ushort(), 2550U) / 10, 255);
+  #endif
+
 }
 
 #endif // AUTO_REPORT_TEMPERATURES && HAS_TEMP_SENSOR
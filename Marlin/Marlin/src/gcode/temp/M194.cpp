@@ -0,0 +1,74 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * M194.cpp - Cool the bed down for part release
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(BED_COOLDOWN)
+
+#include "../gcode.h"
+#include "../../MarlinCore.h" // for idle, wait_for_heatup
+#include "../../module/temperature.h"
+#include "../../lcd/marlinui.h"
+
+#if ENABLED(NOZZLE_PARK_FEATURE)
+  #include "../../libs/nozzle.h"
+  #include "../../module/motion.h"
+#endif
+
+/**
+ * M194: Cool the bed down to the part release temperature
+ *
+ * Turns the bed off and runs the fans until the bed reaches the release
+ * temperature, reporting the predicted time left as it goes.
+ *
+ *  S<temp> - Release temperature. Default BED_COOLDOWN_RELEASE. S0 stops the cooldown.
+ *  P<bool> - Park the nozzle first (Requires NOZZLE_PARK_FEATURE). Default true.
+ *  W       - Wait for the cooldown to finish.
+ */
+void GcodeSuite::M194() {
+  if (DEBUGGING(DRYRUN)) return;
+
+  const celsius_t release = parser.celsiusval('S', BED_COOLDOWN_RELEASE);
+  if (!release) return thermalManager.end_cooldown(false);
+
+  #if ENABLED(NOZZLE_PARK_FEATURE)
+    if (parser.boolval('P', true) && all_axes_homed()) nozzle.park(0);
+  #endif
+
+  thermalManager.start_cooldown(release);
+  LCD_MESSAGE_F("Bed cooling");
+
+  if (parser.seen_test('W')) {
+    #if DISABLED(BUSY_WHILE_HEATING) && ENABLED(HOST_KEEPALIVE_FEATURE)
+      KEEPALIVE_STATE(NOT_BUSY);
+    #endif
+    wait_for_heatup = true;
+    while (wait_for_heatup && thermalManager.cooling_down()) idle();
+    wait_for_heatup = false;
+  }
+}
+
+#endif // BED_COOLDOWN
@@ -42,6 +42,11 @@
  *  C<cycles>       Number of times to repeat the procedure. (Minimum: 3, Default: 5)
  *  U<bool>         Flag to apply the result to the current PID values
  *
+ * With PID_AUTOTUNE_PARALLEL:
+ *  A               Tune all PID hotends and the PID bed at once, in the background.
+ *                  Uses S for the hotends and B<temperature> for the bed (0 to skip).
+ *                  The results are applied, and saved with EEPROM_SETTINGS.
+ *
  * With PID_DEBUG, PID_BED_DEBUG, or PID_CHAMBER_DEBUG:
  *  D               Toggle PID debugging and EXIT without further action.
  */
@@ -58,6 +63,18 @@ void GcodeSuite::M303() {
     }
   #endif
 
+  #if ENABLED(PID_AUTOTUNE_PARALLEL)
+    if (parser.seen_test('A')) {
+      const celsius_t hotend_temp = TERN0(PIDTEMP, parser.celsiusval('S', PREHEAT_1_TEMP_HOTEND)),
+                         bed_temp = TERN0(PIDTEMPBED, parser.celsiusval('B', PREHEAT_1_TEMP_BED));
+      if (!thermalManager.PID_autotune_all(hotend_temp, bed_temp, parser.intval('C', 5))) {
+        SERIAL_ECHOPGM(STR_PID_AUTOTUNE);
+        SERIAL_ECHOLNPGM(thermalManager.PID_autotune_running() ? " busy" : " failed! No heater to tune");
+      }
+      return;
+    }
+  #endif
+
   const heater_id_t hid = (heater_id_t)parser.intval('E');
   celsius_t default_temp;
   switch (hid) {
@@ -1157,6 +1157,9 @@
 #if ANY(AUTO_BED_LEVELING_BILINEAR, AUTO_BED_LEVELING_UBL, MESH_BED_LEVELING)
   #define HAS_MESH 1
 #endif
+#if EITHER(AUTO_BED_LEVELING_BILINEAR, MESH_BED_LEVELING) || BOTH(AUTO_BED_LEVELING_UBL, UBL_CELL_PLANES)
+  #define HAS_MESH_REFRESH 1  // bedlevel.refresh_bed_level() after changing z_values
+#endif
 #if EITHER(AUTO_BED_LEVELING_UBL, AUTO_BED_LEVELING_3POINT)
   #define NEEDS_THREE_PROBE_POINTS 1
 #endif
@@ -1498,7 +1501,7 @@
 
 #if X_HOME_DIR || (HAS_Y_AXIS && Y_HOME_DIR) || (HAS_Z_AXIS && Z_HOME_DIR) || (HAS_I_AXIS && I_HOME_DIR) || (HAS_J_AXIS && J_HOME_DIR) || (HAS_K_AXIS && K_HOME_DIR)
   #define HAS_ENDSTOPS 1
-  #define COORDINATE_OKAY(N,L,H) WITHIN(N,L,H)
+  #define COORDINATE_OKAY(N,L,H) WITHIN(N,float(L),float(H))
 #else
   #define COORDINATE_OKAY(N,L,H) true
 #endif
@@ -590,6 +590,15 @@
   #undef MENU_ADDAUTOSTART
 #endif
 
+#if ENABLED(SDCARD_EEPROM_LOG)
+  #ifndef SDCARD_EEPROM_LOG_CHUNK
+    #define SDCARD_EEPROM_LOG_CHUNK 16
+  #endif
+  #ifndef SDCARD_EEPROM_LOG_SIZE
+    #define SDCARD_EEPROM_LOG_SIZE 16384
+  #endif
+#endif
+
 #if EITHER(SDSUPPORT, LCD_SET_PROGRESS_MANUALLY)
   #define HAS_PRINT_PROGRESS 1
 #endif
@@ -1049,3 +1058,32 @@
 #if EITHER(SENSORLESS_HOMING, SENSORLESS_PROBING) && !defined(SENSORLESS_STALLGUARD_DELAY)
   #define SENSORLESS_STALLGUARD_DELAY 0
 #endif
+
+// Input Shaping
+#if EITHER(INPUT_SHAPING_X, INPUT_SHAPING_Y)
+  #define HAS_SHAPING 1
+  #ifndef SHAPING_MIN_FREQ
+    #define SHAPING_MIN_FREQ _MIN(TERN(INPUT_SHAPING_X, SHAPING_FREQ_X, 1000), TERN(INPUT_SHAPING_Y, SHAPING_FREQ_Y, 1000))
+  #endif
+  #ifndef SHAPING_MAX_STEPRATE
+    #define SHAPING_MAX_STEPRATE 10000
+  #endif
+#endif
+
+// Linear Advance stepping E in its own ISR phase
+#if ENABLED(LIN_ADVANCE) && DISABLED(LIN_ADVANCE_INTEGRATED)
+  #define HAS_ADVANCE_ISR 1
+#endif
+
+// Parser tokens, for the tokenized command queue and plain G0/G1 lines
+#if EITHER(GCODE_TOKEN_QUEUE, FAST_G0_G1_PARSER)
+  #define HAS_GCODE_TOKENS 1
+  #ifndef GCODE_TOKEN_PARAMS
+    #define GCODE_TOKEN_PARAMS 5  // X Y Z E F
+  #endif
+#endif
+
+// The Temperature ISR sends serial output and feeds the emergency parser for DMA ports
+#if ENABLED(SERIAL_DMA)
+  #define HAS_SERIAL_DMA_POLL 1
+#endif
@@ -2664,7 +2664,7 @@
 #if !HAS_TEMP_SENSOR
   #undef AUTO_REPORT_TEMPERATURES
 #endif
-#if ANY(AUTO_REPORT_TEMPERATURES, AUTO_REPORT_SD_STATUS, AUTO_REPORT_POSITION, AUTO_REPORT_FANS)
+#if ANY(AUTO_REPORT_TEMPERATURES, AUTO_REPORT_SD_STATUS, AUTO_REPORT_POSITION, AUTO_REPORT_FANS, STREAM_STATISTICS, AUTO_REPORT_STATUS)
   #define HAS_AUTO_REPORTING 1
 #endif
 
@@ -2852,6 +2852,15 @@
 #if PIN_EXISTS(PHOTOGRAPH)
   #define HAS_PHOTOGRAPH 1
 #endif
+#if ENABLED(TIMELAPSE) && PIN_EXISTS(TIMELAPSE_TRIGGER)
+  #define HAS_TIMELAPSE_TRIGGER 1
+#endif
+#if EITHER(MOTION_PROFILES, LAYER_COMMENTS)
+  #define HAS_COMMENT_TAGS 1
+#endif
+#if BOTH(LAYER_EVENTS, POWER_LOSS_RECOVERY) && (ENABLED(POWER_LOSS_BACKUP_SRAM) || !PIN_EXISTS(POWER_LOSS))
+  #define HAS_POWER_LOSS_LAYER_SAVE 1
+#endif
 
 // Digital control
 #if PIN_EXISTS(STEPPER_RESET)
@@ -706,6 +706,14 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
   #endif
 #endif // HAS_PTC
 
+#if ENABLED(PTC_BED_SOAK)
+  #if DISABLED(PTC_BED)
+    #error "PTC_BED_SOAK requires PTC_BED and a bed temperature sensor."
+  #elif PTC_BED_SOAK_MIN < PTC_BED_START && !PTC_LINEAR_EXTRAPOLATION
+    #error "PTC_BED_SOAK_MIN below PTC_BED_START requires PTC_LINEAR_EXTRAPOLATION."
+  #endif
+#endif
+
 /**
  * Marlin release, version and default string
  */
@@ -743,6 +751,13 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
     #error "SERIAL_PORT_3 cannot be the same as SERIAL_PORT_2."
   #endif
 #endif
+#ifdef TELEMETRY_SERIAL
+  #if !HAS_MULTI_SERIAL
+    #error "TELEMETRY_SERIAL requires SERIAL_PORT_2."
+  #elif !WITHIN(TELEMETRY_SERIAL, 1, NUM_SERIAL)
+    #error "TELEMETRY_SERIAL must be 1 (SERIAL_PORT) up to the number of serial ports."
+  #endif
+#endif
 #if !(defined(__AVR__) && defined(USBCON))
   #if ENABLED(SERIAL_XON_XOFF) && RX_BUFFER_SIZE < 1024
     #error "SERIAL_XON_XOFF requires RX_BUFFER_SIZE >= 1024 for reliable transfers without drops."
@@ -968,12 +983,17 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
     #error "BABYSTEPPING requires BABYSTEP_MULTIPLICATOR_Z."
   #elif ENABLED(BABYSTEP_XY) && !defined(BABYSTEP_MULTIPLICATOR_XY)
     #error "BABYSTEP_XY requires BABYSTEP_MULTIPLICATOR_XY."
+  #elif ENABLED(BABYSTEP_PLANNER) && (IS_KINEMATIC || CORE_IS_XZ || CORE_IS_YZ)
+    #error "BABYSTEP_PLANNER requires Z to be driven on its own."
   #elif ENABLED(BABYSTEP_MILLIMETER_UNITS)
     static_assert(BABYSTEP_MULTIPLICATOR_Z <= 0.1f, "BABYSTEP_MULTIPLICATOR_Z must be less or equal to 0.1mm.");
     #if ENABLED(BABYSTEP_XY)
       static_assert(BABYSTEP_MULTIPLICATOR_XY <= 0.25f, "BABYSTEP_MULTIPLICATOR_XY must be less than or equal to 0.25mm.");
     #endif
   #endif
+  #if ENABLED(BABYSTEP_PLANNER)
+    static_assert(BABYSTEP_PLANNER_SLOPE > 0, "BABYSTEP_PLANNER_SLOPE must be greater than 0.");
+  #endif
 #endif
 
 /**
@@ -1018,6 +1038,8 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
     #error "You can't enable FIL_RUNOUT8_PULLUP and FIL_RUNOUT8_PULLDOWN at the same time."
   #elif FILAMENT_RUNOUT_DISTANCE_MM < 0
     #error "FILAMENT_RUNOUT_DISTANCE_MM must be greater than or equal to zero."
+  #elif ENABLED(FILAMENT_RUNOUT_COUNT_STEPS) && !HAS_FILAMENT_RUNOUT_DISTANCE
+    #error "FILAMENT_RUNOUT_COUNT_STEPS requires FILAMENT_RUNOUT_DISTANCE_MM."
   #elif DISABLED(ADVANCED_PAUSE_FEATURE)
     static_assert(nullptr == strstr(FILAMENT_RUNOUT_SCRIPT, "M600"), "ADVANCED_PAUSE_FEATURE is required to use M600 with FILAMENT_RUNOUT_SENSOR.");
   #endif
@@ -1052,9 +1074,9 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
   constexpr float npp[] = NOZZLE_PARK_POINT;
   static_assert(COUNT(npp) == XYZ, "NOZZLE_PARK_POINT requires X, Y, and Z values.");
   constexpr xyz_pos_t npp_xyz = NOZZLE_PARK_POINT;
-  static_assert(WITHIN(npp_xyz.x, X_MIN_POS, X_MAX_POS), "NOZZLE_PARK_POINT.X is out of bounds (X_MIN_POS, X_MAX_POS).");
-  static_assert(WITHIN(npp_xyz.y, Y_MIN_POS, Y_MAX_POS), "NOZZLE_PARK_POINT.Y is out of bounds (Y_MIN_POS, Y_MAX_POS).");
-  static_assert(WITHIN(npp_xyz.z, Z_MIN_POS, Z_MAX_POS), "NOZZLE_PARK_POINT.Z is out of bounds (Z_MIN_POS, Z_MAX_POS).");
+  static_assert(WITHIN(npp_xyz.x, float(X_MIN_POS), float(X_MAX_POS)), "NOZZLE_PARK_POINT.X is out of bounds (X_MIN_POS, X_MAX_POS).");
+  static_assert(WITHIN(npp_xyz.y, float(Y_MIN_POS), float(Y_MAX_POS)), "NOZZLE_PARK_POINT.Y is out of bounds (Y_MIN_POS, Y_MAX_POS).");
+  static_assert(WITHIN(npp_xyz.z, float(Z_MIN_POS), float(Z_MAX_POS)), "NOZZLE_PARK_POINT.Z is out of bounds (Z_MIN_POS, Z_MAX_POS).");
 #endif
 
 /**
@@ -1285,13 +1307,24 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
     WITHIN(LIN_ADVANCE_K, 0, 10),
     "LIN_ADVANCE_K must be a value from 0 to 10 (Changed in LIN_ADVANCE v1.5, Marlin 1.1.9)."
   );
-  #if ENABLED(S_CURVE_ACCELERATION) && DISABLED(EXPERIMENTAL_SCURVE)
-    #error "LIN_ADVANCE and S_CURVE_ACCELERATION may not play well together! Enable EXPERIMENTAL_SCURVE to continue."
+  #if ENABLED(S_CURVE_ACCELERATION) && NONE(EXPERIMENTAL_SCURVE, LIN_ADVANCE_INTEGRATED)
+    #error "LIN_ADVANCE and S_CURVE_ACCELERATION may not play well together! Enable EXPERIMENTAL_SCURVE or LIN_ADVANCE_INTEGRATED to continue."
   #elif ENABLED(DIRECT_STEPPING)
     #error "DIRECT_STEPPING is incompatible with LIN_ADVANCE. Enable in external planner if possible."
   #elif NONE(HAS_JUNCTION_DEVIATION, ALLOW_LOW_EJERK) && defined(DEFAULT_EJERK)
     static_assert(DEFAULT_EJERK >= 10, "It is strongly recommended to set DEFAULT_EJERK >= 10 when using LIN_ADVANCE. Enable ALLOW_LOW_EJERK to bypass this alert (e.g., for direct drive).");
   #endif
+  #if ENABLED(LIN_ADVANCE_INTEGRATED)
+    #ifdef __AVR__
+      #error "LIN_ADVANCE_INTEGRATED requires a 32-bit MCU."
+    #elif ENABLED(MIXING_EXTRUDER)
+      #error "LIN_ADVANCE_INTEGRATED is not compatible with MIXING_EXTRUDER."
+    #elif ENABLED(STEP_DMA)
+      #error "LIN_ADVANCE_INTEGRATED is not compatible with STEP_DMA."
+    #elif !defined(LIN_ADVANCE_SMOOTH_TIME) || LIN_ADVANCE_SMOOTH_TIME < 1
+      #error "LIN_ADVANCE_SMOOTH_TIME must be 1 (ms) or more."
+    #endif
+  #endif
 #endif
 
 /**
@@ -1301,6 +1334,27 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
   #error "Please select only one of SINGLENOZZLE, DUAL_X_CARRIAGE, PARKING_EXTRUDER, MAGNETIC_PARKING_EXTRUDER, SWITCHING_TOOLHEAD, MAGNETIC_SWITCHING_TOOLHEAD, or ELECTROMAGNETIC_SWITCHING_TOOLHEAD."
 #endif
 
+/**
+ * Streaming tool-change requires plain fixed nozzles
+ */
+#if ENABLED(TOOLCHANGE_STREAMING)
+  #if !HAS_MULTI_EXTRUDER || HAS_PRUSA_MMU1 || HAS_PRUSA_MMU2
+    #error "TOOLCHANGE_STREAMING requires 2 or more EXTRUDERS, each with its own nozzle."
+  #elif ANY(SINGLENOZZLE, DUAL_X_CARRIAGE, PARKING_EXTRUDER, MAGNETIC_PARKING_EXTRUDER, SWITCHING_TOOLHEAD, MAGNETIC_SWITCHING_TOOLHEAD, ELECTROMAGNETIC_SWITCHING_TOOLHEAD, SWITCHING_NOZZLE, SWITCHING_EXTRUDER, MIXING_EXTRUDER)
+    #error "TOOLCHANGE_STREAMING is only for fixed nozzles, without a tool-changing mechanism."
+  #elif IS_KINEMATIC
+    #error "TOOLCHANGE_STREAMING is not supported for DELTA or SCARA."
+  #elif ANY(EXT_SOLENOID, TOOL_SENSOR, HAS_FANMUX)
+    #error "TOOLCHANGE_STREAMING can't be used with EXT_SOLENOID, TOOL_SENSOR, or FANMUX pins."
+  #elif defined(EVENT_GCODE_TOOLCHANGE_T0) || defined(EVENT_GCODE_TOOLCHANGE_T1) || defined(EVENT_GCODE_AFTER_TOOLCHANGE)
+    #error "TOOLCHANGE_STREAMING can't run EVENT_GCODE_TOOLCHANGE_* or EVENT_GCODE_AFTER_TOOLCHANGE."
+  #elif ENABLED(TOOLCHANGE_FILAMENT_SWAP) && TOOLCHANGE_FS_FAN >= 0
+    #error "TOOLCHANGE_STREAMING requires TOOLCHANGE_FS_FAN -1, since fan cooling is a timed wait."
+  #elif ENABLED(TOOLCHANGE_FS_SLOW_FIRST_PRIME)
+    #error "TOOLCHANGE_STREAMING doesn't support TOOLCHANGE_FS_SLOW_FIRST_PRIME."
+  #endif
+#endif
+
 /**
  * (Magnetic) Parking Extruder requirements
  */
@@ -1444,6 +1498,59 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
   #endif
 #endif
 
+#if ENABLED(PREHEAT_SCHEDULER)
+  #if !HAS_HOTEND
+    #error "PREHEAT_SCHEDULER requires a hotend."
+  #endif
+  static_assert(PREHEAT_SCHEDULER_MARGIN >= 0, "PREHEAT_SCHEDULER_MARGIN must be 0 or more.");
+  #if DISABLED(MPCTEMP)
+    static_assert(PREHEAT_SCHEDULER_RATE > 0, "PREHEAT_SCHEDULER_RATE must be greater than 0.");
+  #endif
+#endif
+
+#if ENABLED(HOST_SPOOL)
+  static_assert(WITHIN(HOST_SPOOL_SIZE, 4 * (MAX_CMD_SIZE), 65535), "HOST_SPOOL_SIZE must be from 4 * MAX_CMD_SIZE to 65535.");
+#endif
+
+#if ENABLED(ADS1118_SCHEDULER)
+  #if !HAS_ADS1118
+    #error "ADS1118_SCHEDULER requires an ADS1118 hotend sensor."
+  #elif ADS1118_FAST_SPS != 128 && ADS1118_FAST_SPS != 250 && ADS1118_FAST_SPS != 475 && ADS1118_FAST_SPS != 860
+    #error "ADS1118_FAST_SPS must be 128, 250, 475 or 860."
+  #endif
+  static_assert(ADS1118_CJ_INTERVAL >= 100, "ADS1118_CJ_INTERVAL must be 100 or more.");
+  static_assert(WITHIN(ADS1118_ACTIVE_RATIO, 1, 100), "ADS1118_ACTIVE_RATIO must be between 1 and 100.");
+  static_assert(WITHIN(ADS1118_FAST_FILTER, 0, 4), "ADS1118_FAST_FILTER must be between 0 and 4.");
+#endif
+
+#if ENABLED(BED_COOLDOWN)
+  #if !HAS_HEATED_BED
+    #error "BED_COOLDOWN requires a heated bed."
+  #endif
+  static_assert(WITHIN(BED_COOLDOWN_FAN_SPEED, 0, 255), "BED_COOLDOWN_FAN_SPEED must be between 0 and 255.");
+  #if !HAS_TEMP_CHAMBER
+    static_assert(BED_COOLDOWN_RELEASE > BED_COOLDOWN_AMBIENT, "BED_COOLDOWN_RELEASE must be above BED_COOLDOWN_AMBIENT.");
+  #endif
+#endif
+
+#if ENABLED(HEATER_POWER_BUDGET)
+  #if !HAS_HOTEND
+    #error "HEATER_POWER_BUDGET requires a hotend."
+  #elif ANY(SLOW_PWM_HEATERS, SOFT_PWM_DITHER, HEATER_HW_PWM)
+    #error "HEATER_POWER_BUDGET requires plain soft PWM heaters. Disable SLOW_PWM_HEATERS, SOFT_PWM_DITHER, and HEATER_HW_PWM."
+  #elif HAS_HEATED_BED && POWER_BUDGET_BED_WATTS > POWER_BUDGET_WATTS
+    #error "POWER_BUDGET_BED_WATTS can't be more than POWER_BUDGET_WATTS."
+  #endif
+  static_assert(POWER_BUDGET_HOTEND_RATE > 0, "POWER_BUDGET_HOTEND_RATE must be greater than 0.");
+  #if HAS_HEATED_BED
+    static_assert(POWER_BUDGET_BED_RATE > 0, "POWER_BUDGET_BED_RATE must be greater than 0.");
+  #endif
+#endif
+
+#if ENABLED(MPC_FEEDFORWARD)
+  static_assert(WITHIN(MPC_FEEDFORWARD_TIME, 0.1f, 10.0f), "MPC_FEEDFORWARD_TIME must be between 0.1 and 10 seconds.");
+#endif
+
 /**
  * Bed Heating Options - PID vs Limit Switching
  */
@@ -1761,10 +1868,22 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
     #endif
   #endif
 
+  #if ENABLED(ADAPTIVE_PROBING)
+    #if MULTIPLE_PROBING > 0
+      #error "ADAPTIVE_PROBING can't be used with MULTIPLE_PROBING."
+    #elif !WITHIN(ADAPTIVE_PROBING_MAX, 3, 10)
+      #error "ADAPTIVE_PROBING_MAX must be from 3 to 10."
+    #endif
+  #endif
+
   #if Z_PROBE_LOW_POINT > 0
     #error "Z_PROBE_LOW_POINT must be less than or equal to 0."
   #endif
 
+  #if ENABLED(PROBE_FLYBY) && !(PROBE_FLYBY_CLEARANCE > 0 && PROBE_FLYBY_CLEARANCE <= Z_CLEARANCE_BETWEEN_PROBES)
+    #error "PROBE_FLYBY_CLEARANCE must be greater than 0 and no more than Z_CLEARANCE_BETWEEN_PROBES."
+  #endif
+
   #if ENABLED(PROBE_ACTIVATION_SWITCH)
     #ifndef PROBE_ACTIVATION_SWITCH_STATE
       #error "PROBE_ACTIVATION_SWITCH_STATE is required for PROBE_ACTIVATION_SWITCH."
@@ -1782,6 +1901,14 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
     #error "Auto Bed Leveling requires either PROBE_MANUALLY, SENSORLESS_PROBING, or a real probe."
   #endif
 
+  #if ENABLED(PROBE_FLYBY)
+    #error "PROBE_FLYBY requires a real probe."
+  #endif
+
+  #if ENABLED(PROBE_TOUR)
+    #error "PROBE_TOUR requires a real probe."
+  #endif
+
   #if ENABLED(Z_MIN_PROBE_REPEATABILITY_TEST)
     #error "Z_MIN_PROBE_REPEATABILITY_TEST requires a real probe."
   #endif
@@ -1843,12 +1970,36 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
   // Mesh Bed Leveling
   #if ENABLED(DELTA)
     #error "MESH_BED_LEVELING is not compatible with DELTA printers."
-  #elif (GRID_MAX_POINTS_X) > 9 || (GRID_MAX_POINTS_Y) > 9
+  #elif ENABLED(MESH_BICUBIC) && ((GRID_MAX_POINTS_X) > 15 || (GRID_MAX_POINTS_Y) > 15)
+    #error "GRID_MAX_POINTS_X and GRID_MAX_POINTS_Y must be less than 16 for MESH_BICUBIC."
+  #elif DISABLED(MESH_BICUBIC) && ((GRID_MAX_POINTS_X) > 9 || (GRID_MAX_POINTS_Y) > 9)
     #error "GRID_MAX_POINTS_X and GRID_MAX_POINTS_Y must be less than 10 for MBL."
+  #elif ENABLED(MESH_Z_RASTER) && !defined(CPU_32_BIT)
+    #error "MESH_Z_RASTER requires a 32-bit MCU."
+  #elif ENABLED(MESH_ADAPTIVE_SPLIT) && !IS_CARTESIAN
+    #error "MESH_ADAPTIVE_SPLIT requires a Cartesian machine."
+  #elif ENABLED(MESH_SLOTS) && DISABLED(SDSUPPORT)
+    #error "MESH_SLOTS requires SDSUPPORT."
+  #endif
+  #if ENABLED(MESH_ADAPTIVE_SPLIT)
+    static_assert(MESH_SPLIT_TOLERANCE > 0, "MESH_SPLIT_TOLERANCE must be greater than 0.");
+  #endif
+  #if ENABLED(MESH_Z_RASTER)
+    static_assert(MESH_Z_RASTER_MM >= 0.5, "MESH_Z_RASTER_MM must be at least 0.5.");
+  #endif
+  #if ENABLED(MESH_SLOTS)
+    static_assert(WITHIN(MESH_SLOT_COUNT, 1, 100), "MESH_SLOT_COUNT must be from 1 to 100.");
   #endif
 
 #endif
 
+#if ENABLED(MESH_SLOTS) && DISABLED(MESH_BED_LEVELING)
+  #error "MESH_SLOTS requires MESH_BED_LEVELING."
+#endif
+#if ENABLED(MESH_REGION_PROBING) && DISABLED(MESH_BED_LEVELING)
+  #error "MESH_REGION_PROBING requires MESH_BED_LEVELING."
+#endif
+
 #if ALL(HAS_LEVELING, RESTORE_LEVELING_AFTER_G28, ENABLE_LEVELING_AFTER_G28)
   #error "Only enable RESTORE_LEVELING_AFTER_G28 or ENABLE_LEVELING_AFTER_G28, but not both."
 #endif
@@ -2005,6 +2156,39 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
   #elif MIN_STEPS_PER_SEGMENT > 1
     #error "VOLUMETRIC_EXTRUDER_LIMIT is not compatible with MIN_STEPS_PER_SEGMENT greater than 1."
   #endif
+  #if ENABLED(VOLUMETRIC_FLOW_SMOOTHING)
+    static_assert(VOLUMETRIC_FLOW_SMOOTH_TIME > 0, "VOLUMETRIC_FLOW_SMOOTH_TIME must be greater than 0.");
+    static_assert(VOLUMETRIC_FLOW_PEAK >= 1, "VOLUMETRIC_FLOW_PEAK must be 1 or more.");
+  #endif
+#endif
+
+/**
+ * G0/G1 line merging
+ */
+#if ENABLED(LINE_MERGE)
+  #if IS_KINEMATIC
+    #error "LINE_MERGE is not compatible with kinematic machines."
+  #elif HAS_CUTTER
+    #error "LINE_MERGE is not compatible with SPINDLE_FEATURE or LASER_FEATURE."
+  #elif !WITHIN(LINE_MERGE_SEGMENTS, 2, 255)
+    #error "LINE_MERGE_SEGMENTS must be from 2 to 255."
+  #endif
+  static_assert(LINE_MERGE_DEVIATION > 0, "LINE_MERGE_DEVIATION must be greater than 0.");
+  static_assert(LINE_MERGE_E_TOLERANCE >= 0, "LINE_MERGE_E_TOLERANCE must be 0 or more.");
+#endif
+
+/**
+ * G64 path blending
+ */
+#if ENABLED(PATH_BLENDING)
+  #if DISABLED(BEZIER_CURVE_SUPPORT)
+    #error "PATH_BLENDING requires BEZIER_CURVE_SUPPORT."
+  #elif IS_KINEMATIC
+    #error "PATH_BLENDING is not compatible with kinematic machines."
+  #elif HAS_CUTTER
+    #error "PATH_BLENDING is not compatible with SPINDLE_FEATURE or LASER_FEATURE."
+  #endif
+  static_assert(PATH_BLENDING_TOLERANCE >= 0, "PATH_BLENDING_TOLERANCE must be 0 or more.");
 #endif
 
 /**
@@ -2147,6 +2331,24 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
   #error "TEMP_SENSOR_REDUNDANT 1000 requires REDUNDANT_PULLUP_RESISTOR_OHMS, REDUNDANT_RESISTANCE_25C_OHMS and REDUNDANT_BETA in Configuration_adv.h."
 #endif
 
+#if ENABLED(THERMISTOR_DIRECT_LOOKUP) && !WITHIN(THERMISTOR_LUT_BITS, 6, 10)
+  #error "THERMISTOR_LUT_BITS must be from 6 to 10."
+#endif
+
+#if ENABLED(DEFERRED_TEMP_SENSORS) && !defined(HAL_TEMP_TASK_ISR)
+  #error "DEFERRED_TEMP_SENSORS is not supported on this platform."
+#endif
+
+#if ENABLED(HEATER_HW_PWM)
+  #ifndef HAL_STM32
+    #error "HEATER_HW_PWM requires an STM32 MCU."
+  #elif ENABLED(SLOW_PWM_HEATERS)
+    #error "HEATER_HW_PWM is not compatible with SLOW_PWM_HEATERS."
+  #elif !WITHIN(HEATER_HW_PWM_FREQUENCY, 1, 20000)
+    #error "HEATER_HW_PWM_FREQUENCY must be from 1 to 20000."
+  #endif
+#endif
+
 /**
  * Required MAX31865 settings
  */
@@ -2422,6 +2624,8 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
     #error "MULTI_NOZZLE_DUPLICATION is incompatible with SWITCHING_EXTRUDER."
   #elif HOTENDS < 2
     #error "MULTI_NOZZLE_DUPLICATION requires 2 or more hotends."
+  #elif ENABLED(STEP_DMA)
+    #error "MULTI_NOZZLE_DUPLICATION is incompatible with STEP_DMA."
   #endif
 #endif
 
@@ -2572,12 +2776,50 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
   #error "EMERGENCY_PARSER does not work on boards with AT90USB processors (USBCON)."
 #endif
 
+/**
+ * Tokenized Command Queue, Fast G0/G1 Parser, Packed Command Queue
+ */
+#if ENABLED(GCODE_TOKEN_QUEUE)
+  #if DISABLED(FASTER_GCODE_PARSER)
+    #error "GCODE_TOKEN_QUEUE requires FASTER_GCODE_PARSER."
+  #elif !WITHIN(GCODE_TOKEN_PARAMS, 1, 26)
+    #error "GCODE_TOKEN_PARAMS must be from 1 to 26."
+  #elif !WITHIN(GCODE_TEXT_SLOTS, 1, BUFSIZE)
+    #error "GCODE_TEXT_SLOTS must be from 1 to BUFSIZE."
+  #endif
+#endif
+#if ENABLED(FAST_G0_G1_PARSER) && DISABLED(FASTER_GCODE_PARSER)
+  #error "FAST_G0_G1_PARSER requires FASTER_GCODE_PARSER."
+#endif
+#if ENABLED(GCODE_PACKED_QUEUE)
+  #if ENABLED(GCODE_TOKEN_QUEUE)
+    #error "GCODE_PACKED_QUEUE and GCODE_TOKEN_QUEUE can't be used together."
+  #elif !WITHIN(GCODE_QUEUE_BYTES, 4 * (MAX_CMD_SIZE), 32767)
+    #error "GCODE_QUEUE_BYTES must be from 4 * MAX_CMD_SIZE to 32767."
+  #elif ENABLED(BINARY_COMMAND_BATCH) && BINARY_COMMAND_BATCH_SIZE + MAX_CMD_SIZE >= GCODE_QUEUE_BYTES
+    #error "GCODE_QUEUE_BYTES must be more than BINARY_COMMAND_BATCH_SIZE + MAX_CMD_SIZE."
+  #endif
+#endif
+#if ENABLED(MOTION_PROFILES)
+  #if !defined(MOTION_PROFILE_TAGS) || !defined(MOTION_PROFILE_ACCEL)
+    #error "MOTION_PROFILES requires MOTION_PROFILE_TAGS and MOTION_PROFILE_ACCEL."
+  #elif HAS_JUNCTION_DEVIATION && !defined(MOTION_PROFILE_JD)
+    #error "MOTION_PROFILES requires MOTION_PROFILE_JD with junction deviation."
+  #endif
+#endif
+
 /**
  * Software Reset options
  */
 #if ENABLED(SOFT_RESET_VIA_SERIAL) && DISABLED(EMERGENCY_PARSER)
   #error "EMERGENCY_PARSER is required to activate SOFT_RESET_VIA_SERIAL."
 #endif
+#if ENABLED(SERIAL_PORT_SCHEDULING) && !HAS_MULTI_SERIAL
+  #error "SERIAL_PORT_SCHEDULING requires SERIAL_PORT_2."
+#endif
+#if ENABLED(REALTIME_OVERRIDES) && DISABLED(EMERGENCY_PARSER)
+  #error "EMERGENCY_PARSER is required to activate REALTIME_OVERRIDES."
+#endif
 #if ENABLED(SOFT_RESET_ON_KILL) && !BUTTON_EXISTS(ENC)
   #error "An encoder button is required or SOFT_RESET_ON_KILL will reset the printer without notice!"
 #endif
@@ -2701,6 +2943,98 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
   #error "AUTO_REPORT_FANS requires one or more fans with a tachometer pin."
 #endif
 
+#if ENABLED(TFT_SKIP_UNCHANGED) && !WITHIN(TFT_SKIP_UNCHANGED_AREAS, 8, 255)
+  #error "TFT_SKIP_UNCHANGED_AREAS must be between 8 and 255."
+#endif
+
+#if ENABLED(TFT_DOUBLE_BUFFER) && !(ENABLED(TFT_COLOR_UI) && HAS_FSMC_TFT)
+  #error "TFT_DOUBLE_BUFFER requires TFT_COLOR_UI and an FSMC display."
+#endif
+
+#if ENABLED(TFT_FSMC_CALIBRATION)
+  #if !(ENABLED(TFT_COLOR_UI) && HAS_FSMC_TFT && defined(HAL_STM32))
+    #error "TFT_FSMC_CALIBRATION requires TFT_COLOR_UI and an FSMC display on HAL/STM32."
+  #elif DISABLED(EEPROM_SETTINGS)
+    #error "TFT_FSMC_CALIBRATION requires EEPROM_SETTINGS."
+  #elif !WITHIN(TFT_FSMC_CALIBRATION_MARGIN, 0, 8)
+    #error "TFT_FSMC_CALIBRATION_MARGIN must be between 0 and 8."
+  #endif
+#endif
+
+#if ENABLED(TFT_GLYPH_CACHE)
+  #if DISABLED(TFT_COLOR_UI)
+    #error "TFT_GLYPH_CACHE requires TFT_COLOR_UI."
+  #elif !WITHIN(TFT_GLYPH_CACHE_ENTRIES, 4, 255)
+    #error "TFT_GLYPH_CACHE_ENTRIES must be between 4 and 255."
+  #elif !WITHIN(TFT_GLYPH_CACHE_SLOT, 32, 255)
+    #error "TFT_GLYPH_CACHE_SLOT must be between 32 and 255."
+  #endif
+#endif
+
+#if ENABLED(TFT_IMAGE_RLE) && DISABLED(TFT_COLOR_UI)
+  #error "TFT_IMAGE_RLE requires TFT_COLOR_UI."
+#endif
+
+#if ENABLED(TFT_THUMBNAIL)
+  #if DISABLED(TFT_COLOR_UI) || !(HAS_UI_480x320 || HAS_UI_480x272)
+    #error "TFT_THUMBNAIL requires TFT_COLOR_UI with a 480x320 or 480x272 display."
+  #elif DISABLED(TOUCH_SCREEN)
+    #error "TFT_THUMBNAIL requires TOUCH_SCREEN."
+  #elif DISABLED(SD_JOB_INFO)
+    #error "TFT_THUMBNAIL requires SD_JOB_INFO."
+  #endif
+#endif
+
+#if ENABLED(TFT_TOOLPATH_PREVIEW)
+  #if DISABLED(TFT_COLOR_UI) || !(HAS_UI_480x320 || HAS_UI_480x272)
+    #error "TFT_TOOLPATH_PREVIEW requires TFT_COLOR_UI with a 480x320 or 480x272 display."
+  #elif DISABLED(TOUCH_SCREEN)
+    #error "TFT_TOOLPATH_PREVIEW requires TOUCH_SCREEN."
+  #elif TFT_TOOLPATH_CELLS % 8 || !WITHIN(TFT_TOOLPATH_CELLS, 8, 256)
+    #error "TFT_TOOLPATH_CELLS must be a multiple of 8 from 8 to 256."
+  #endif
+#endif
+
+#if ENABLED(TFT_UI_PROFILER)
+  #if DISABLED(TFT_COLOR_UI)
+    #error "TFT_UI_PROFILER requires TFT_COLOR_UI."
+  #elif !(defined(__arm__) || defined(__thumb__))
+    #error "TFT_UI_PROFILER requires an ARM MCU with a DWT cycle counter."
+  #elif !WITHIN(TFT_UI_PROFILER_SCREENS, 1, 32)
+    #error "TFT_UI_PROFILER_SCREENS must be from 1 to 32."
+  #endif
+#endif
+
+#if ENABLED(UI_MOTION_PRIORITY)
+  #if !HAS_WIRED_LCD
+    #error "UI_MOTION_PRIORITY requires a MarlinUI display."
+  #elif UI_MIN_PLANNED_MOVES > BLOCK_BUFFER_SIZE
+    #error "UI_MIN_PLANNED_MOVES can't exceed BLOCK_BUFFER_SIZE."
+  #elif !WITHIN(UI_FRAME_BUDGET_MS, 1, 255)
+    #error "UI_FRAME_BUDGET_MS must be from 1 to 255."
+  #endif
+#endif
+
+#if ENABLED(TOUCH_BACKGROUND_SAMPLING)
+  #ifndef HAL_STM32
+    #error "TOUCH_BACKGROUND_SAMPLING is only supported in HAL/STM32."
+  #elif !(HAS_TFT_XPT2046 || HAS_RES_TOUCH_BUTTONS)
+    #error "TOUCH_BACKGROUND_SAMPLING requires an XPT2046 touch screen."
+  #elif !PIN_EXISTS(TOUCH_INT)
+    #error "TOUCH_BACKGROUND_SAMPLING requires TOUCH_INT_PIN (PENIRQ)."
+  #elif !WITHIN(TOUCH_BACKGROUND_SAMPLES, 3, 15) || !(TOUCH_BACKGROUND_SAMPLES & 1)
+    #error "TOUCH_BACKGROUND_SAMPLES must be an odd number from 3 to 15."
+  #endif
+#endif
+
+#if ENABLED(TEMP_TELEMETRY)
+  #if DISABLED(AUTO_REPORT_TEMPERATURES)
+    #error "TEMP_TELEMETRY requires AUTO_REPORT_TEMPERATURES."
+  #elif !WITHIN(TEMP_TELEMETRY_SAMPLES, 8, 256) || !IS_POWER_OF_2(TEMP_TELEMETRY_SAMPLES)
+    #error "TEMP_TELEMETRY_SAMPLES must be a power of 2 from 8 to 256."
+  #endif
+#endif
+
 /**
  * Make sure only one EEPROM type is enabled
  */
@@ -2739,6 +3073,73 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
   #endif
 #endif
 
+#if ENABLED(SD_DIR_INDEX) && !WITHIN(SD_DIR_INDEX_SIZE, 1, 0xFFFE)
+  #error "SD_DIR_INDEX_SIZE must be from 1 to 65534."
+#endif
+
+#if ENABLED(SD_COMPRESSED_FILES) && ANY(SD_STAGING, SD_PRINT_WHILE_UPLOADING, SD_FLASH_JOB_CACHE, SD_JOB_INFO, CANCEL_OBJECTS_SEEK)
+  #error "SD_COMPRESSED_FILES is incompatible with SD_STAGING, SD_PRINT_WHILE_UPLOADING, SD_FLASH_JOB_CACHE, SD_JOB_INFO, and CANCEL_OBJECTS_SEEK."
+#endif
+
+#if ENABLED(SD_JOB_COMPILE)
+  #if DISABLED(GCODE_TOKEN_QUEUE)
+    #error "SD_JOB_COMPILE requires GCODE_TOKEN_QUEUE."
+  #elif ENABLED(SDCARD_READONLY)
+    #error "SD_JOB_COMPILE is incompatible with SDCARD_READONLY."
+  #elif ANY(SD_STAGING, SD_COMPRESSED_FILES, SD_FLASH_JOB_CACHE, CANCEL_OBJECTS_SEEK)
+    #error "SD_JOB_COMPILE is incompatible with SD_STAGING, SD_COMPRESSED_FILES, SD_FLASH_JOB_CACHE, and CANCEL_OBJECTS_SEEK."
+  #elif MAX_CMD_SIZE > 128
+    #error "SD_JOB_COMPILE requires a MAX_CMD_SIZE of 128 or less."
+  #elif !WITHIN(SD_JOB_COMPILE_INDEX, 2, 256) || (SD_JOB_COMPILE_INDEX & 1)
+    #error "SD_JOB_COMPILE_INDEX must be an even number from 2 to 256."
+  #endif
+#endif
+
+#if ENABLED(SD_JOB_INFO)
+  #if !WITHIN(SD_JOB_INFO_CACHE, 1, 255)
+    #error "SD_JOB_INFO_CACHE must be from 1 to 255."
+  #elif SD_JOB_INFO_HEAD < 512 || SD_JOB_INFO_TAIL < 0
+    #error "SD_JOB_INFO_HEAD must be at least 512 and SD_JOB_INFO_TAIL can't be negative."
+  #endif
+#endif
+
+#if ENABLED(HOTEND_STANDBY_LOOKAHEAD)
+  #if !HAS_MULTI_HOTEND
+    #error "HOTEND_STANDBY_LOOKAHEAD requires 2 or more HOTENDS."
+  #elif DISABLED(SDSUPPORT)
+    #error "HOTEND_STANDBY_LOOKAHEAD requires SDSUPPORT."
+  #elif HOTENDS > 8
+    #error "HOTEND_STANDBY_LOOKAHEAD supports up to 8 HOTENDS."
+  #elif HOTEND_STANDBY_SCAN < 512
+    #error "HOTEND_STANDBY_SCAN must be at least 512."
+  #endif
+  static_assert(HOTEND_STANDBY_HEAT_RATE > 0, "HOTEND_STANDBY_HEAT_RATE must be greater than 0.");
+#endif
+
+#if ENABLED(SD_EXTENT_CACHE) && !WITHIN(SD_EXTENT_CACHE_SIZE, 1, 255)
+  #error "SD_EXTENT_CACHE_SIZE must be from 1 to 255."
+#endif
+
+#if ENABLED(SD_WRITE_BUFFER)
+  #if ENABLED(SDCARD_READONLY)
+    #error "SD_WRITE_BUFFER is incompatible with SDCARD_READONLY."
+  #elif !WITHIN(SD_WRITE_BUFFER_BLOCKS, 2, 64)
+    #error "SD_WRITE_BUFFER_BLOCKS must be from 2 to 64."
+  #endif
+#endif
+
+#if ENABLED(SD_BLOCK_CACHE) && !WITHIN(SD_BLOCK_CACHE_BLOCKS, 2, 16)
+  #error "SD_BLOCK_CACHE_BLOCKS must be from 2 to 16."
+#endif
+
+#if ENABLED(SD_LOG_BUFFER)
+  #if ENABLED(SDCARD_READONLY)
+    #error "SD_LOG_BUFFER is incompatible with SDCARD_READONLY."
+  #elif !WITHIN(SD_LOG_BUFFER_SIZE, 1024, 32768) || (SD_LOG_BUFFER_SIZE & (SD_LOG_BUFFER_SIZE - 1))
+    #error "SD_LOG_BUFFER_SIZE must be a power of 2 from 1024 to 32768."
+  #endif
+#endif
+
 /**
  * Make sure only one display is enabled
  */
@@ -3482,10 +3883,349 @@ static_assert(_PLUS_TEST(4), "HOMING_FEEDRATE_MM_M values must be positive.");
   #error "CNC_COORDINATE_SYSTEMS is incompatible with NO_WORKSPACE_OFFSETS."
 #endif
 
+#if ENABLED(HOMING_BUMP_SKIP)
+  #if IS_KINEMATIC
+    #error "HOMING_BUMP_SKIP is not compatible with DELTA or SCARA."
+  #elif ENABLED(SENSORLESS_HOMING)
+    #error "HOMING_BUMP_SKIP requires endstop switches, not SENSORLESS_HOMING."
+  #elif !WITHIN(HOMING_BUMP_SKIP_COUNT, 2, 255)
+    #error "HOMING_BUMP_SKIP_COUNT must be from 2 to 255."
+  #elif !WITHIN(HOMING_BUMP_SKIP_CHECK, 2, 255)
+    #error "HOMING_BUMP_SKIP_CHECK must be from 2 to 255."
+  #endif
+  static_assert(HOMING_BUMP_SKIP_TOLERANCE > 0, "HOMING_BUMP_SKIP_TOLERANCE must be greater than 0.");
+#endif
+
+#if ENABLED(ENDSTOP_INTERRUPTS_BY_DIRECTION)
+  #if DISABLED(ENDSTOP_INTERRUPTS_FEATURE)
+    #error "ENDSTOP_INTERRUPTS_BY_DIRECTION requires ENDSTOP_INTERRUPTS_FEATURE."
+  #elif ANY(X_DUAL_ENDSTOPS, Y_DUAL_ENDSTOPS, Z_MULTI_ENDSTOPS, DUAL_X_CARRIAGE, SPI_ENDSTOPS, G38_PROBE_TARGET, DIRECT_STEPPING)
+    #error "ENDSTOP_INTERRUPTS_BY_DIRECTION is not compatible with multiple endstops per axis, SPI_ENDSTOPS, G38_PROBE_TARGET, or DIRECT_STEPPING."
+  #elif LINEAR_AXES > XYZ
+    #error "ENDSTOP_INTERRUPTS_BY_DIRECTION only supports the X, Y, and Z axes."
+  #endif
+#endif
+
+#if ENABLED(BLOCK_EXEC_TABLE)
+  #ifndef CPU_32_BIT
+    #error "BLOCK_EXEC_TABLE requires a 32-bit MCU."
+  #elif ENABLED(DIRECT_STEPPING)
+    #error "BLOCK_EXEC_TABLE is not compatible with DIRECT_STEPPING."
+  #endif
+#endif
+
+#if ENABLED(ADAPTIVE_STEP_BATCHING)
+  #ifndef CPU_32_BIT
+    #error "ADAPTIVE_STEP_BATCHING requires a 32-bit MCU."
+  #elif ENABLED(DISABLE_MULTI_STEPPING)
+    #error "ADAPTIVE_STEP_BATCHING is not compatible with DISABLE_MULTI_STEPPING."
+  #elif ENABLED(I2S_STEPPER_STREAM)
+    #error "ADAPTIVE_STEP_BATCHING is not compatible with I2S_STEPPER_STREAM."
+  #elif !WITHIN(STEP_BATCHING_MAX_LOAD, 10, 90)
+    #error "STEP_BATCHING_MAX_LOAD must be between 10 and 90."
+  #endif
+#endif
+
+#if ENABLED(STEP_DMA)
+  #ifndef STM32F4xx
+    #error "STEP_DMA requires an STM32F4 MCU."
+  #elif ANY(HAS_DUAL_X_STEPPERS, HAS_DUAL_Y_STEPPERS, DUAL_X_CARRIAGE) || NUM_Z_STEPPERS > 1
+    #error "STEP_DMA doesn't support axes with more than one stepper."
+  #elif ENABLED(MIXING_EXTRUDER) || (E_STEPPERS && E_STEPPERS != EXTRUDERS)
+    #error "STEP_DMA requires one stepper per extruder."
+  #elif ENABLED(DIRECT_STEPPING)
+    #error "STEP_DMA is not compatible with DIRECT_STEPPING."
+  #endif
+#endif
+
+#if ENABLED(SERIAL_DMA) && !(defined(HAL_STM32) && (defined(STM32F4xx) || defined(STM32F7xx)))
+  #error "SERIAL_DMA requires an STM32F4 or STM32F7 MCU."
+#endif
+
+#if ENABLED(FF_WIFI_SERIAL)
+  #if !MB(FF_MOTHERBOARD)
+    #error "FF_WIFI_SERIAL requires the FlashForge motherboard."
+  #elif ENABLED(MKS_WIFI_MODULE)
+    #error "FF_WIFI_SERIAL can't be used with MKS_WIFI_MODULE."
+  #endif
+#endif
+
+#if ENABLED(FF_FIRMWARE_UPDATE)
+  #if !MB(FF_MOTHERBOARD)
+    #error "FF_FIRMWARE_UPDATE requires the FlashForge motherboard."
+  #elif DISABLED(SDSUPPORT)
+    #error "FF_FIRMWARE_UPDATE requires SDSUPPORT."
+  #elif ENABLED(FLASH_EEPROM_EMULATION)
+    #error "FF_FIRMWARE_UPDATE uses the upper flash sectors needed by FLASH_EEPROM_EMULATION."
+  #endif
+#endif
+
+#if ENABLED(SOFT_I2C_ASYNC) && NONE(DIGIPOT_MCP4018, PCA9632_SOFT_I2C)
+  #error "SOFT_I2C_ASYNC requires DIGIPOT_MCP4018 or PCA9632_SOFT_I2C."
+#endif
+
+#if ENABLED(DIGIPOT_DYNAMIC_CURRENT)
+  #if !BOTH(DIGIPOT_MCP4018, SOFT_I2C_ASYNC)
+    #error "DIGIPOT_DYNAMIC_CURRENT requires DIGIPOT_MCP4018 and SOFT_I2C_ASYNC."
+  #elif !(0 < DIGIPOT_HOLD_PERCENT && DIGIPOT_HOLD_PERCENT <= DIGIPOT_RUN_PERCENT && DIGIPOT_RUN_PERCENT <= DIGIPOT_BOOST_PERCENT && DIGIPOT_BOOST_PERCENT <= 150)
+    #error "DIGIPOT_DYNAMIC_CURRENT needs 0 < DIGIPOT_HOLD_PERCENT <= DIGIPOT_RUN_PERCENT <= DIGIPOT_BOOST_PERCENT <= 150."
+  #endif
+#endif
+
+#if ENABLED(FF_RTOS_TASKS)
+  #if !MB(FF_MOTHERBOARD)
+    #error "FF_RTOS_TASKS requires the FlashForge motherboard."
+  #elif ANY(HAS_TFT_LVGL_UI, EXTENSIBLE_UI, HAS_DWIN_E3V2)
+    #error "FF_RTOS_TASKS requires a MarlinUI display, like TFT_COLOR_UI."
+  #elif ENABLED(IDLE_SCHEDULER)
+    #error "FF_RTOS_TASKS and IDLE_SCHEDULER can't be used together."
+  #endif
+#endif
+
+#if ENABLED(MEMORY_BUDGET) && !(defined(MEMORY_BUDGET_BYTES) && MEMORY_BUDGET_BYTES > 0)
+  #error "MEMORY_BUDGET requires MEMORY_BUDGET_BYTES greater than 0."
+#endif
+
+#if ENABLED(MEMORY_PROFILES)
+  #if NONE(GCODE_PACKED_QUEUE, SD_BLOCK_CACHE) && !HAS_GRAPHICAL_TFT
+    #error "MEMORY_PROFILES requires GCODE_PACKED_QUEUE, SD_BLOCK_CACHE, or a graphical TFT."
+  #elif BOTH(SD_BLOCK_CACHE, SD_STAGING)
+    #error "MEMORY_PROFILES can't share the SD_BLOCK_CACHE of SD_STAGING cards."
+  #elif BOTH(STAGED_STARTUP, SDCARD_EEPROM_EMULATION)
+    #error "MEMORY_PROFILES can't be used with STAGED_STARTUP and SDCARD_EEPROM_EMULATION, which load the settings after the UI starts."
+  #elif !(defined(MEMORY_PROFILE_SD) && defined(MEMORY_PROFILE_HOST) && defined(MEMORY_PROFILE_UI))
+    #error "MEMORY_PROFILES requires MEMORY_PROFILE_SD, MEMORY_PROFILE_HOST, and MEMORY_PROFILE_UI."
+  #endif
+#endif
+
+#if ENABLED(CCMRAM_PLACEMENT) && !defined(HAL_STM32)
+  #error "CCMRAM_PLACEMENT requires the STM32 HAL."
+#endif
+#if ENABLED(ISR_CODE_IN_RAM) && !defined(HAL_STM32)
+  #error "ISR_CODE_IN_RAM requires the STM32 HAL."
+#endif
+
+#if ENABLED(LVGL_PERFORMANCE_MODE)
+  #if DISABLED(TFT_LVGL_UI)
+    #error "LVGL_PERFORMANCE_MODE requires TFT_LVGL_UI."
+  #elif !defined(HAL_STM32)
+    #error "LVGL_PERFORMANCE_MODE requires the STM32 HAL."
+  #elif !WITHIN(LVGL_VDB_LINES, 8, 40)
+    #error "LVGL_VDB_LINES must be from 8 to 40."
+  #elif !WITHIN(LVGL_MIN_PLANNED_MOVES, 1, BLOCK_BUFFER_SIZE)
+    #error "LVGL_MIN_PLANNED_MOVES must be from 1 to BLOCK_BUFFER_SIZE."
+  #endif
+#endif
+
+#if ENABLED(LVGL_MEM_POOL) && DISABLED(TFT_LVGL_UI)
+  #error "LVGL_MEM_POOL requires TFT_LVGL_UI."
+#endif
+
+#if ENABLED(BATCHED_OK)
+  #if ENABLED(ADVANCED_OK)
+    #error "BATCHED_OK is not compatible with ADVANCED_OK."
+  #elif !WITHIN(BATCHED_OK_MAX, 2, 255)
+    #error "BATCHED_OK_MAX must be between 2 and 255."
+  #endif
+#endif
+
+#if ENABLED(LOCKFREE_BLOCK_HANDOFF) && (!defined(CPU_32_BIT) || defined(__ARM_ARCH_6M__))
+  #error "LOCKFREE_BLOCK_HANDOFF requires a 32-bit MCU with atomic instructions (not Cortex-M0)."
+#endif
+
+#if ENABLED(ISR_PROFILER) && !defined(HAL_STM32)
+  #error "ISR_PROFILER requires the STM32 HAL."
+#endif
+
+#if ENABLED(STEP_CAPTURE)
+  #if !defined(CPU_32_BIT)
+    #error "STEP_CAPTURE requires a 32-bit MCU."
+  #elif !WITHIN(STEP_CAPTURE_SIZE, 16, 65535)
+    #error "STEP_CAPTURE_SIZE must be from 16 to 65535."
+  #endif
+#endif
+
+#if ENABLED(SLOWDOWN) && defined(SLOWDOWN_HORIZON_MS) && !WITHIN(SLOWDOWN_HORIZON_MS, 10, 4000)
+  #error "SLOWDOWN_HORIZON_MS must be from 10 to 4000."
+#endif
+
+#if ENABLED(INSTANT_FEEDRATE_OVERRIDE) && HAS_CLASSIC_JERK
+  #error "INSTANT_FEEDRATE_OVERRIDE requires Junction Deviation. Disable CLASSIC_JERK."
+#endif
+
+#if ENABLED(ACCEL_TORQUE_CURVE) && LINEAR_AXES < 3
+  #error "ACCEL_TORQUE_CURVE requires LINEAR_AXES >= 3."
+#endif
+
+#if ENABLED(PLANNER_STAGING) && !WITHIN(PLANNER_STAGING_SIZE, 2, 255)
+  #error "PLANNER_STAGING_SIZE must be from 2 to 255."
+#endif
+
+#if ENABLED(CANCEL_OBJECTS_SEEK)
+  #if DISABLED(SDSUPPORT)
+    #error "CANCEL_OBJECTS_SEEK requires SDSUPPORT."
+  #elif !WITHIN(CANCEL_OBJECTS_SEEK_RANGES, 2, 255)
+    #error "CANCEL_OBJECTS_SEEK_RANGES must be from 2 to 255."
+  #endif
+#endif
+
+#if ENABLED(SD_JOB_QUEUE)
+  #if DISABLED(SDSUPPORT)
+    #error "SD_JOB_QUEUE requires SDSUPPORT."
+  #elif !WITHIN(SD_JOB_QUEUE_SIZE, 1, 32)
+    #error "SD_JOB_QUEUE_SIZE must be from 1 to 32."
+  #endif
+#endif
+
+#if ENABLED(REPEAT_CACHE)
+  #if DISABLED(GCODE_REPEAT_MARKERS)
+    #error "REPEAT_CACHE requires GCODE_REPEAT_MARKERS."
+  #elif !WITHIN(REPEAT_CACHE_SIZE, 256, 65000)
+    #error "REPEAT_CACHE_SIZE must be from 256 to 65000."
+  #endif
+#endif
+
+#if ENABLED(SETTINGS_IMAGE) && DISABLED(EEPROM_SETTINGS)
+  #error "SETTINGS_IMAGE requires EEPROM_SETTINGS."
+#endif
+
+#if ENABLED(EXTUI_CHANGE_EVENTS) && DISABLED(EXTENSIBLE_UI)
+  #error "EXTUI_CHANGE_EVENTS requires EXTENSIBLE_UI or TFT_LVGL_UI."
+#endif
+
+#if ENABLED(PRINT_TIME_ESTIMATE)
+  #if DISABLED(SDSUPPORT)
+    #error "PRINT_TIME_ESTIMATE requires SDSUPPORT."
+  #elif !WITHIN(PRINT_TIME_SECTIONS, 4, 255)
+    #error "PRINT_TIME_SECTIONS must be from 4 to 255."
+  #endif
+#endif
+
+#if ENABLED(ADVANCED_PAUSE_PLANNED)
+  #if DISABLED(ADVANCED_PAUSE_FEATURE)
+    #error "ADVANCED_PAUSE_PLANNED requires ADVANCED_PAUSE_FEATURE."
+  #elif ENABLED(DUAL_X_CARRIAGE)
+    #error "ADVANCED_PAUSE_PLANNED is not compatible with DUAL_X_CARRIAGE."
+  #endif
+#endif
+
+#if ENABLED(M48_FAST_TAPS)
+  #if DISABLED(Z_MIN_PROBE_REPEATABILITY_TEST)
+    #error "M48_FAST_TAPS requires Z_MIN_PROBE_REPEATABILITY_TEST."
+  #endif
+  static_assert(M48_TAP_RAISE > 0, "M48_TAP_RAISE must be greater than 0.");
+#endif
+
+#if ENABLED(DIRECT_STEPPING) && (STEPPER_PAGES > 256 || STEPPER_PAGES % 4)
+  #error "STEPPER_PAGES must be a multiple of 4, up to 256."
+#endif
+
+#if ENABLED(HOST_BLOCK_STREAM)
+  #if IS_KINEMATIC || IS_CORE || LINEAR_AXES != 3 || !HAS_EXTRUDERS
+    #error "HOST_BLOCK_STREAM requires a Cartesian XYZE machine."
+  #elif ANY(DIRECT_STEPPING, LIN_ADVANCE, HAS_CUTTER)
+    #error "HOST_BLOCK_STREAM is not compatible with DIRECT_STEPPING, LIN_ADVANCE, or a spindle/laser."
+  #endif
+#endif
+
+#if ENABLED(CRASH_CAPTURE)
+  #if !defined(HAL_STM32)
+    #error "CRASH_CAPTURE requires the STM32 HAL."
+  #elif DISABLED(SDSUPPORT)
+    #error "CRASH_CAPTURE requires SDSUPPORT to write the log."
+  #elif !WITHIN(CRASH_CAPTURE_BACKTRACE, 1, 64)
+    #error "CRASH_CAPTURE_BACKTRACE must be from 1 to 64."
+  #elif ENABLED(TRACE_EVENTS) && !WITHIN(CRASH_CAPTURE_EVENTS, 1, 255)
+    #error "CRASH_CAPTURE_EVENTS must be from 1 to 255."
+  #endif
+#endif
+
+#if ENABLED(TRACE_EVENTS)
+  #if !defined(CPU_32_BIT)
+    #error "TRACE_EVENTS requires a 32-bit MCU."
+  #elif TRACE_EVENTS_SIZE < 16 || (TRACE_EVENTS_SIZE & (TRACE_EVENTS_SIZE - 1))
+    #error "TRACE_EVENTS_SIZE must be a power of 2, 16 or more."
+  #endif
+#endif
+
+#if ENABLED(MOTION_BENCHMARK) && !defined(CPU_32_BIT)
+  #error "MOTION_BENCHMARK requires a 32-bit MCU."
+#endif
+
+#if ENABLED(SD_BENCHMARK) && DISABLED(SDSUPPORT)
+  #error "SD_BENCHMARK requires SDSUPPORT."
+#endif
+
+#if ENABLED(INPUT_REPLAY)
+  #if DISABLED(SDSUPPORT)
+    #error "INPUT_REPLAY requires SDSUPPORT."
+  #elif !WITHIN(INPUT_REPLAY_BUFFER, 1024, 32768) || (INPUT_REPLAY_BUFFER & (INPUT_REPLAY_BUFFER - 1))
+    #error "INPUT_REPLAY_BUFFER must be a power of 2 from 1024 to 32768."
+  #endif
+#endif
+
+#if ENABLED(PLANNER_FIXED_POINT) && !defined(CPU_32_BIT)
+  #error "PLANNER_FIXED_POINT requires a 32-bit MCU."
+#endif
+
+#if HAS_SHAPING
+  #if !defined(CPU_32_BIT)
+    #error "INPUT_SHAPING_X and INPUT_SHAPING_Y require a 32-bit MCU."
+  #elif ANY(IS_CORE, MARKFORGED_XY, MARKFORGED_YX, IS_KINEMATIC)
+    #error "INPUT_SHAPING_X and INPUT_SHAPING_Y are only supported on Cartesian machines."
+  #elif ENABLED(INPUT_SHAPING_X) && EITHER(HAS_DUAL_X_STEPPERS, DUAL_X_CARRIAGE)
+    #error "INPUT_SHAPING_X doesn't support dual X steppers."
+  #elif ENABLED(INPUT_SHAPING_Y) && HAS_DUAL_Y_STEPPERS
+    #error "INPUT_SHAPING_Y doesn't support dual Y steppers."
+  #elif ENABLED(DIRECT_STEPPING)
+    #error "Input Shaping is not compatible with DIRECT_STEPPING."
+  #elif ENABLED(STEP_DMA)
+    #error "Input Shaping is not compatible with STEP_DMA."
+  #elif ENABLED(INPUT_SHAPING_X) && !WITHIN(SHAPING_TYPE_X, 0, 2)
+    #error "SHAPING_TYPE_X must be 0 (ZV), 1 (ZVD) or 2 (MZV)."
+  #elif ENABLED(INPUT_SHAPING_Y) && !WITHIN(SHAPING_TYPE_Y, 0, 2)
+    #error "SHAPING_TYPE_Y must be 0 (ZV), 1 (ZVD) or 2 (MZV)."
+  #endif
+  static_assert(SHAPING_MIN_FREQ > 0, "SHAPING_MIN_FREQ must be greater than 0. Set it when a SHAPING_FREQ is 0.");
+  #if ENABLED(INPUT_SHAPING_X)
+    static_assert(SHAPING_FREQ_X == 0 || SHAPING_FREQ_X >= SHAPING_MIN_FREQ, "SHAPING_FREQ_X must be 0 or at least SHAPING_MIN_FREQ.");
+  #endif
+  #if ENABLED(INPUT_SHAPING_Y)
+    static_assert(SHAPING_FREQ_Y == 0 || SHAPING_FREQ_Y >= SHAPING_MIN_FREQ, "SHAPING_FREQ_Y must be 0 or at least SHAPING_MIN_FREQ.");
+  #endif
+#endif
+
+#if ENABLED(NATIVE_ARCS)
+  #if DISABLED(ARC_SUPPORT)
+    #error "NATIVE_ARCS requires ARC_SUPPORT."
+  #elif !defined(CPU_32_BIT)
+    #error "NATIVE_ARCS requires a 32-bit MCU."
+  #elif ANY(IS_CORE, MARKFORGED_XY, MARKFORGED_YX, IS_KINEMATIC)
+    #error "NATIVE_ARCS is only supported on Cartesian machines."
+  #elif HAS_CLASSIC_JERK
+    #error "NATIVE_ARCS requires Junction Deviation. Disable CLASSIC_JERK."
+  #elif ENABLED(BACKLASH_COMPENSATION)
+    #error "NATIVE_ARCS is not compatible with BACKLASH_COMPENSATION."
+  #elif ENABLED(SKEW_CORRECTION)
+    #error "NATIVE_ARCS is not compatible with SKEW_CORRECTION."
+  #elif EITHER(AUTO_BED_LEVELING_UBL, ABL_PLANAR)
+    #error "NATIVE_ARCS is not compatible with AUTO_BED_LEVELING_UBL, _3POINT or _LINEAR."
+  #endif
+  #ifdef NATIVE_ARC_LEVEL_TOLERANCE
+    static_assert(NATIVE_ARC_LEVEL_TOLERANCE > 0, "NATIVE_ARC_LEVEL_TOLERANCE must be greater than 0.");
+  #endif
+#endif
+
 #if !BLOCK_BUFFER_SIZE || !IS_POWER_OF_2(BLOCK_BUFFER_SIZE)
   #error "BLOCK_BUFFER_SIZE must be a power of 2."
+#elif ENABLED(PLANNER_DEEP_LOOKAHEAD)
+  #if BLOCK_BUFFER_SIZE < 64
+    #error "PLANNER_DEEP_LOOKAHEAD requires a BLOCK_BUFFER_SIZE of at least 64."
+  #elif BLOCK_BUFFER_SIZE > 256
+    #error "PLANNER_DEEP_LOOKAHEAD supports a BLOCK_BUFFER_SIZE of up to 256."
+  #endif
 #elif BLOCK_BUFFER_SIZE > 64
-  #error "A very large BLOCK_BUFFER_SIZE is not needed and takes longer to drain the buffer on pause / cancel."
+  #error "A very large BLOCK_BUFFER_SIZE is not needed and takes longer to drain the buffer on pause / cancel. Enable PLANNER_DEEP_LOOKAHEAD for more."
 #endif
 
 #if ENABLED(LED_CONTROL_MENU) && NONE(HAS_MARLINUI_MENU, DWIN_LCD_PROUI)
@@ -3510,6 +4250,10 @@ static_assert(_PLUS_TEST(4), "HOMING_FEEDRATE_MM_M values must be positive.");
   #endif
 #endif
 
+#if ENABLED(FUSED_POSITION_TRANSFORM) && !(ENABLED(SKEW_CORRECTION) || ABL_PLANAR)
+  #error "FUSED_POSITION_TRANSFORM requires SKEW_CORRECTION or AUTO_BED_LEVELING_3POINT / AUTO_BED_LEVELING_LINEAR."
+#endif
+
 #if BOTH(X_AXIS_TWIST_COMPENSATION, NOZZLE_AS_PROBE)
   #error "X_AXIS_TWIST_COMPENSATION is incompatible with NOZZLE_AS_PROBE."
 #endif
@@ -3523,6 +4267,10 @@ static_assert(_PLUS_TEST(4), "HOMING_FEEDRATE_MM_M values must be positive.");
     #error "POWER_LOSS_RECOVER_ZHOME is not needed on a machine that homes to ZMAX."
   #elif BOTH(IS_CARTESIAN, POWER_LOSS_RECOVER_ZHOME) && Z_HOME_TO_MIN && !defined(POWER_LOSS_ZHOME_POS)
     #error "POWER_LOSS_RECOVER_ZHOME requires POWER_LOSS_ZHOME_POS for a Cartesian that homes to ZMIN."
+  #elif ENABLED(POWER_LOSS_JOURNAL) && !WITHIN(POWER_LOSS_JOURNAL_SIZE, 2, 255)
+    #error "POWER_LOSS_JOURNAL_SIZE must be from 2 to 255."
+  #elif ENABLED(POWER_LOSS_BACKUP_SRAM) && !defined(HAL_STM32)
+    #error "POWER_LOSS_BACKUP_SRAM requires an STM32F4 or STM32F7 MCU."
   #endif
 #endif
 
@@ -3578,6 +4326,14 @@ static_assert(_PLUS_TEST(4), "HOMING_FEEDRATE_MM_M values must be positive.");
   #error "GCODE_MACROS_SLOTS must be a number from 1 to 10."
 #endif
 
+#if ENABLED(GCODE_MACROS_TOKENIZED)
+  #if DISABLED(GCODE_TOKEN_QUEUE)
+    #error "GCODE_MACROS_TOKENIZED requires GCODE_TOKEN_QUEUE."
+  #elif !WITHIN(GCODE_MACROS_ARENA_SIZE, 64, 65000)
+    #error "GCODE_MACROS_ARENA_SIZE must be from 64 to 65000."
+  #endif
+#endif
+
 #if ENABLED(BACKLASH_COMPENSATION)
   #ifndef BACKLASH_DISTANCE_MM
     #error "BACKLASH_COMPENSATION requires BACKLASH_DISTANCE_MM."
@@ -3617,6 +4373,38 @@ static_assert(_PLUS_TEST(4), "HOMING_FEEDRATE_MM_M values must be positive.");
   #endif
 #endif
 
+/**
+ * Asynchronous user wait requirements
+ */
+#if ENABLED(ASYNC_USER_WAIT) && !HAS_RESUME_CONTINUE
+  #error "ASYNC_USER_WAIT requires an LCD controller, EMERGENCY_PARSER, or EXTENSIBLE_UI to continue."
+#endif
+
+/**
+ * Layer Events requirements
+ */
+#if ENABLED(LAYER_EVENTS)
+  static_assert(LAYER_MIN_Z_CHANGE > 0, "LAYER_MIN_Z_CHANGE must be > 0.");
+  #if !WITHIN(LAYER_EVENT_SUBSCRIBERS, 1, 16)
+    #error "LAYER_EVENT_SUBSCRIBERS must be from 1 to 16."
+  #endif
+#endif
+
+/**
+ * Timelapse requirements
+ */
+#if ENABLED(TIMELAPSE)
+  #if DISABLED(LAYER_EVENTS)
+    #error "TIMELAPSE requires LAYER_EVENTS."
+  #elif !HAS_TIMELAPSE_TRIGGER && DISABLED(HOST_ACTION_COMMANDS)
+    #error "TIMELAPSE requires TIMELAPSE_TRIGGER_PIN or HOST_ACTION_COMMANDS."
+  #elif IS_KINEMATIC
+    #error "TIMELAPSE is not compatible with kinematic machines."
+  #endif
+  static_assert(TIMELAPSE_RETRACT_MM >= 0, "TIMELAPSE_RETRACT_MM must be >= 0.");
+  static_assert(TIMELAPSE_Z_RAISE >= 0, "TIMELAPSE_Z_RAISE must be >= 0.");
+#endif
+
 /**
  * Advanced PRINTCOUNTER settings
  */
@@ -3827,6 +4615,64 @@ static_assert(_PLUS_TEST(4), "HOMING_FEEDRATE_MM_M values must be positive.");
   #error "Either enable MEATPACK_ON_SERIAL_PORT_* or BINARY_FILE_TRANSFER, not both."
 #endif
 
+#if ENABLED(MEATPACK_DICTIONARY) && !WITHIN(MEATPACK_DICT_BYTES, 64, 255)
+  #error "MEATPACK_DICT_BYTES must be between 64 and 255."
+#endif
+
+#if ENABLED(BINARY_MOTION_STREAM)
+  #if DISABLED(BINARY_FILE_TRANSFER)
+    #error "BINARY_MOTION_STREAM requires BINARY_FILE_TRANSFER."
+  #elif DISABLED(GCODE_TOKEN_QUEUE)
+    #error "BINARY_MOTION_STREAM requires GCODE_TOKEN_QUEUE."
+  #elif GCODE_TOKEN_PARAMS < 5
+    #error "BINARY_MOTION_STREAM requires GCODE_TOKEN_PARAMS of 5 or more."
+  #endif
+#endif
+
+#if ENABLED(BINARY_COMMAND_BATCH)
+  #if DISABLED(BINARY_FILE_TRANSFER)
+    #error "BINARY_COMMAND_BATCH requires BINARY_FILE_TRANSFER."
+  #elif !WITHIN(BINARY_COMMAND_BATCH_SIZE, 64, 4096)
+    #error "BINARY_COMMAND_BATCH_SIZE must be from 64 to 4096."
+  #endif
+#endif
+
+#if ENABLED(SD_FLASH_JOB_CACHE)
+  #if !HAS_SPI_FLASH
+    #error "SD_FLASH_JOB_CACHE requires an SPI flash chip (HAS_SPI_FLASH)."
+  #elif SD_FLASH_CACHE_ADDR % 0x10000
+    #error "SD_FLASH_CACHE_ADDR must be on a 64K boundary."
+  #elif SD_FLASH_CACHE_ADDR + SD_FLASH_CACHE_SIZE > SPI_FLASH_SIZE
+    #error "SD_FLASH_CACHE_ADDR + SD_FLASH_CACHE_SIZE must fit in SPI_FLASH_SIZE."
+  #endif
+#endif
+
+#if ENABLED(SD_STAGING)
+  #ifndef HAL_STM32
+    #error "SD_STAGING requires an STM32 MCU with SDIO."
+  #elif ANY(SDIO_SUPPORT, USB_FLASH_DRIVE_SUPPORT)
+    #error "SD_STAGING copies from an SPI card, so SDIO_SUPPORT and USB_FLASH_DRIVE_SUPPORT must be disabled."
+  #elif DISABLED(SD_PRINT_WHILE_UPLOADING)
+    #error "SD_STAGING requires SD_PRINT_WHILE_UPLOADING."
+  #elif ENABLED(SD_FLASH_JOB_CACHE)
+    #error "SD_STAGING and SD_FLASH_JOB_CACHE can't be used together."
+  #elif ENABLED(SDCARD_READONLY)
+    #error "SD_STAGING is incompatible with SDCARD_READONLY."
+  #elif SD_STAGE_START_KB < 1
+    #error "SD_STAGE_START_KB must be 1 or more."
+  #elif !WITHIN(SD_STAGE_BLOCKS, 1, 64)
+    #error "SD_STAGE_BLOCKS must be from 1 to 64."
+  #endif
+#endif
+
+#if ENABLED(SD_PRINT_WHILE_UPLOADING)
+  #if DISABLED(BINARY_FILE_TRANSFER)
+    #error "SD_PRINT_WHILE_UPLOADING requires BINARY_FILE_TRANSFER."
+  #elif SD_UPLOAD_PRINT_START_KB < 1
+    #error "SD_UPLOAD_PRINT_START_KB must be 1 or more."
+  #endif
+#endif
+
 /**
  * Sanity Check for Slim LCD Menus and Probe Offset Wizard
  */
@@ -48,6 +48,10 @@
   #include "../../../feature/pause.h"
 #endif
 
+#if ENABLED(EXTUI_CHANGE_EVENTS)
+  #include "../ui_api.h"
+#endif
+
 #if ENABLED(TOUCH_SCREEN_CALIBRATION)
   #include "draw_touch_calibration.h"
 #endif
@@ -733,6 +737,16 @@ void print_time_run() {
   }
 }
 
+#if ENABLED(EXTUI_CHANGE_EVENTS)
+  // On each update tick only redraw the values that changed since the last one
+  #define TAKE_CHANGES() const ExtUI::change_mask_t changes = ExtUI::takeChanges()
+  #define CHANGED(M) (changes & (M))
+#else
+  #define TAKE_CHANGES() NOOP
+  #define CHANGED(M) true
+#endif
+#define TEMPS_CHANGED CHANGED(CHANGE_BIT(CHANGE_TEMP) | CHANGE_BIT(CHANGE_TARGET))
+
 void GUI_RefreshPage() {
   if ((systick_uptime_millis % 1000) == 0) temps_update_flag = true;
   if ((systick_uptime_millis % 3000) == 0) printing_rate_update_flag = true;
@@ -743,19 +757,22 @@ void GUI_RefreshPage() {
     case EXTRUSION_UI:
       if (temps_update_flag) {
         temps_update_flag = false;
-        disp_hotend_temp();
+        TAKE_CHANGES();
+        if (TEMPS_CHANGED) disp_hotend_temp();
       }
       break;
     case PREHEAT_UI:
       if (temps_update_flag) {
         temps_update_flag = false;
-        disp_desire_temp();
+        TAKE_CHANGES();
+        if (TEMPS_CHANGED) disp_desire_temp();
       }
       break;
     case PRINT_READY_UI:
       if (temps_update_flag) {
         temps_update_flag = false;
-        lv_temp_refr();
+        TAKE_CHANGES();
+        if (TEMPS_CHANGED) lv_temp_refr();
       }
       break;
 
@@ -764,11 +781,14 @@ void GUI_RefreshPage() {
     case PRINTING_UI:
       if (temps_update_flag) {
         temps_update_flag = false;
-        disp_ext_temp();
-        disp_bed_temp();
-        disp_fan_speed();
+        TAKE_CHANGES();
+        if (TEMPS_CHANGED) {
+          disp_ext_temp();
+          disp_bed_temp();
+        }
+        if (CHANGED(CHANGE_BIT(CHANGE_FAN))) disp_fan_speed();
         disp_print_time();
-        disp_fan_Zpos();
+        if (CHANGED(CHANGE_BIT(CHANGE_POSITION))) disp_fan_Zpos();
       }
       if (printing_rate_update_flag || marlin_state == MF_SD_COMPLETE) {
         printing_rate_update_flag = false;
@@ -783,7 +803,8 @@ void GUI_RefreshPage() {
     case FAN_UI:
       if (temps_update_flag) {
         temps_update_flag = false;
-        disp_fan_value();
+        TAKE_CHANGES();
+        if (CHANGED(CHANGE_BIT(CHANGE_FAN))) disp_fan_value();
       }
       break;
 
@@ -807,7 +828,8 @@ void GUI_RefreshPage() {
     case FILAMENTCHANGE_UI:
       if (temps_update_flag) {
         temps_update_flag = false;
-        disp_filament_temp();
+        TAKE_CHANGES();
+        if (TEMPS_CHANGED) disp_filament_temp();
       }
       break;
     case DIALOG_UI:
@@ -1374,8 +1396,18 @@ void print_time_count() {
 
 void LV_TASK_HANDLER() {
 
-  if (TERN1(USE_SPI_DMA_TC, !get_lcd_dma_lock()))
-    lv_task_handler();
+  #if ENABLED(LVGL_PERFORMANCE_MODE)
+    // While the planner is running low, redraw only once per LVGL_HOLD_MAX_MS
+    static millis_t next_lvgl_ms = 0;
+    const millis_t ms = millis();
+    if (!planner.has_blocks_queued() || planner.movesplanned() >= LVGL_MIN_PLANNED_MOVES || ELAPSED(ms, next_lvgl_ms)) {
+      next_lvgl_ms = ms + LVGL_HOLD_MAX_MS;
+      lv_task_handler();
+    }
+  #else
+    if (TERN1(USE_SPI_DMA_TC, !get_lcd_dma_lock()))
+      lv_task_handler();
+  #endif
 
   #if BOTH(MKS_TEST, SDSUPPORT)
     if (mks_test_flag == 0x1E) mks_hardware_test();
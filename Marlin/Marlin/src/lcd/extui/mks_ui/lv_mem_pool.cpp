@@ -0,0 +1,179 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../../inc/MarlinConfig.h"
+
+#if ENABLED(LVGL_MEM_POOL)
+
+#include "lv_mem_pool.h"
+#include "../../../HAL/shared/Delay.h"
+#include <lvgl.h>
+
+#define CYCLES_TO_US(C) uint32_t((C) / (F_CPU / 1000000UL))
+
+extern "C" {
+  void* __real_lv_mem_alloc(size_t size);
+  void __real_lv_mem_free(const void *data);
+  void* __real_lv_mem_realloc(void *data_p, size_t new_size);
+  uint32_t __real_lv_mem_get_size(const void *data);
+}
+
+static constexpr uint16_t pool_size[] = LVGL_MEM_POOL_SIZES,
+                          pool_blocks[] = LVGL_MEM_POOL_BLOCKS;
+static constexpr uint8_t POOL_CLASSES = COUNT(pool_size);
+
+static_assert(COUNT(pool_blocks) == POOL_CLASSES, "LVGL_MEM_POOL_SIZES and LVGL_MEM_POOL_BLOCKS must have the same number of items.");
+static_assert(WITHIN(POOL_CLASSES, 1, 8), "LVGL_MEM_POOL_SIZES must have from 1 to 8 items.");
+
+static constexpr uint32_t class_start(const uint8_t c) { return c ? class_start(c - 1) + uint32_t(pool_size[c - 1]) * pool_blocks[c - 1] : 0; }
+static constexpr bool sizes_ok(const uint8_t c) {
+  return c == POOL_CLASSES || (pool_size[c] >= 8 && pool_size[c] % 8 == 0 && (c == 0 || pool_size[c] > pool_size[c - 1]) && pool_blocks[c] > 0 && sizes_ok(c + 1));
+}
+static_assert(sizes_ok(0), "LVGL_MEM_POOL_SIZES must be ascending multiples of 8, each with some LVGL_MEM_POOL_BLOCKS.");
+
+static constexpr uint32_t POOL_BYTES = class_start(POOL_CLASSES);
+
+alignas(8) static uint8_t pool[POOL_BYTES];
+
+typedef struct free_block { free_block *next; } free_block_t;
+
+static struct {
+  free_block_t *free;     // The free list
+  uint16_t used, peak;    // Blocks in use, and the most since reset
+  uint32_t allocs, full;  // Blocks handed out, and requests sent to the heap because none were left
+} pools[POOL_CLASSES];
+
+static struct {
+  uint32_t allocs, cycles, max_cycles;
+} timing[2];              // [0] pool, [1] LVGL heap
+
+static bool pool_ready;
+
+// Thread every block onto its class' free list once, on the first allocation
+static void pool_init() {
+  LOOP_L_N(c, POOL_CLASSES) {
+    free_block_t *head = nullptr;
+    for (uint16_t b = pool_blocks[c]; b--;) {
+      free_block_t * const fb = (free_block_t*)&pool[class_start(c) + uint32_t(b) * pool_size[c]];
+      fb->next = head;
+      head = fb;
+    }
+    pools[c].free = head;
+  }
+  pool_ready = true;
+}
+
+// The class of a block in the pool, or -1 for LVGL heap memory
+static int8_t pool_class(const void * const p) {
+  const uint8_t *u = (const uint8_t*)p;
+  if (u < pool || u >= pool + POOL_BYTES) return -1;
+  const uint32_t ofs = u - pool;
+  int8_t c = POOL_CLASSES - 1;
+  while (ofs < class_start(c)) c--;
+  return c;
+}
+
+static void count_time(const bool heap, const uint32_t start) {
+  const uint32_t cycles = get_cycle_count() - start;
+  timing[heap].allocs++;
+  timing[heap].cycles += cycles;
+  NOLESS(timing[heap].max_cycles, cycles);
+}
+
+extern "C" {
+
+  void* __wrap_lv_mem_alloc(size_t size) {
+    const uint32_t start = get_cycle_count();
+    if (!pool_ready) pool_init();
+
+    if (size && size <= pool_size[POOL_CLASSES - 1]) {
+      uint8_t c = 0;
+      while (size > pool_size[c]) c++;
+      auto &pc = pools[c];
+      if (pc.free) {
+        free_block_t * const fb = pc.free;
+        pc.free = fb->next;
+        pc.allocs++;
+        NOLESS(pc.peak, ++pc.used);
+        count_time(false, start);
+        return fb;
+      }
+      pc.full++;
+    }
+
+    void * const p = __real_lv_mem_alloc(size);
+    count_time(true, start);
+    return p;
+  }
+
+  void __wrap_lv_mem_free(const void *data) {
+    const int8_t c = pool_class(data);
+    if (c < 0) return __real_lv_mem_free(data);
+    free_block_t * const fb = (free_block_t*)data;
+    fb->next = pools[c].free;
+    pools[c].free = fb;
+    pools[c].used--;
+  }
+
+  uint32_t __wrap_lv_mem_get_size(const void *data) {
+    const int8_t c = pool_class(data);
+    return c < 0 ? __real_lv_mem_get_size(data) : pool_size[c];
+  }
+
+  void* __wrap_lv_mem_realloc(void *data_p, size_t new_size) {
+    const int8_t c = pool_class(data_p);
+    if (c < 0) return __real_lv_mem_realloc(data_p, new_size);
+    if (new_size && new_size <= pool_size[c]) return data_p;  // Still fits the block
+    void * const p = __wrap_lv_mem_alloc(new_size);
+    if (p) {
+      memcpy(p, data_p, _MIN(new_size, size_t(pool_size[c])));
+      __wrap_lv_mem_free(data_p);
+    }
+    return p;
+  }
+
+}
+
+void LVGLPool::report() {
+  LOOP_L_N(c, POOL_CLASSES) {
+    const auto &pc = pools[c];
+    SERIAL_ECHOLNPGM("LVGL pool ", pool_size[c], "B: ", pc.used, "/", pool_blocks[c], " used, peak ", pc.peak, ", ", pc.allocs, " allocs, ", pc.full, " full");
+  }
+  FSTR_P const name[] = { F("pool"), F("heap") };
+  LOOP_L_N(h, 2) {
+    const auto &t = timing[h];
+    SERIAL_ECHOLNPGM("LVGL ", name[h], " allocs ", t.allocs, ", avg ", t.allocs ? CYCLES_TO_US(t.cycles / t.allocs) : 0, "us, max ", CYCLES_TO_US(t.max_cycles), "us");
+  }
+  lv_mem_monitor_t mon;
+  lv_mem_monitor(&mon);
+  SERIAL_ECHOLNPGM("LVGL heap ", mon.total_size, "B: ", mon.used_pct, "% used, ", mon.frag_pct, "% fragmented, biggest free ", mon.free_biggest_size, "B");
+}
+
+void LVGLPool::reset() {
+  LOOP_L_N(c, POOL_CLASSES) {
+    pools[c].allocs = pools[c].full = 0;
+    pools[c].peak = pools[c].used;
+  }
+  ZERO(timing);
+}
+
+#endif // LVGL_MEM_POOL
@@ -0,0 +1,39 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * lv_mem_pool.h - Fixed-size blocks for LVGL's small allocations (D211)
+ *
+ * The linker wraps lv_mem_alloc/free/realloc/get_size (see ini/features.ini),
+ * so every LVGL allocation comes here first. Requests that fit a size class
+ * take a block from its free list. Larger ones, and any that find their class
+ * empty, go on to LVGL's own heap.
+ */
+
+#include "../../../inc/MarlinConfig.h"
+
+class LVGLPool {
+public:
+  static void report();
+  static void reset();
+};
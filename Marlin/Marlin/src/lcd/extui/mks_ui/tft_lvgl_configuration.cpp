@@ -42,6 +42,10 @@
 #include "../../marlinui.h"
 XPT2046 touch;
 
+#if ENABLED(EXTUI_CHANGE_EVENTS)
+  #include "../ui_api.h"
+#endif
+
 #if ENABLED(POWER_LOSS_RECOVERY)
   #include "../../../feature/powerloss.h"
 #endif
@@ -85,6 +89,11 @@ uint16_t DeviceCode = 0x9488;
 extern uint8_t sel_id;
 
 uint8_t bmp_public_buf[14 * 1024];
+
+#if ENABLED(LVGL_PERFORMANCE_MODE)
+  // LVGL renders into one buffer while DMA flushes the other. Not in CCM RAM, which DMA can't reach.
+  static lv_color_t lvgl_vdb[2][LV_HOR_RES_MAX * LVGL_VDB_LINES];
+#endif
 uint8_t public_buf[513];
 
 extern bool flash_preview_begin, default_preview_flg, gcode_preview_over;
@@ -123,6 +132,8 @@ void tft_lvgl_init() {
 
   gCfgItems_init();
   ui_cfg_init();
+
+  TERN_(EXTUI_CHANGE_EVENTS, ExtUI::subscribeChanges(CHANGE_BIT(CHANGE_TEMP) | CHANGE_BIT(CHANGE_TARGET) | CHANGE_BIT(CHANGE_FAN) | CHANGE_BIT(CHANGE_POSITION)));
   disp_language_init();
 
   hal.watchdog_refresh();     // LVGL init takes time
@@ -163,7 +174,11 @@ void tft_lvgl_init() {
 
   lv_init();
 
-  lv_disp_buf_init(&disp_buf, bmp_public_buf, nullptr, LV_HOR_RES_MAX * 14); // Initialize the display buffer
+  #if ENABLED(LVGL_PERFORMANCE_MODE)
+    lv_disp_buf_init(&disp_buf, lvgl_vdb[0], lvgl_vdb[1], LV_HOR_RES_MAX * LVGL_VDB_LINES);
+  #else
+    lv_disp_buf_init(&disp_buf, bmp_public_buf, nullptr, LV_HOR_RES_MAX * 14); // Initialize the display buffer
+  #endif
 
   lv_disp_drv_t disp_drv;     // Descriptor of a display driver
   lv_disp_drv_init(&disp_drv);    // Basic initialization
@@ -258,7 +273,9 @@ static lv_disp_drv_t* disp_drv_p;
 #endif
 
 void dmc_tc_handler(struct __DMA_HandleTypeDef * hdma) {
-  #if ENABLED(USE_SPI_DMA_TC)
+  #if ENABLED(LVGL_PERFORMANCE_MODE)
+    lv_disp_flush_ready(disp_drv_p);
+  #elif ENABLED(USE_SPI_DMA_TC)
     lv_disp_flush_ready(disp_drv_p);
     lcd_dma_trans_lock = false;
     TFT_SPI::Abort();
@@ -273,7 +290,10 @@ void my_disp_flush(lv_disp_drv_t * disp, const lv_area_t * area, lv_color_t * co
 
   SPI_TFT.setWindow((uint16_t)area->x1, (uint16_t)area->y1, width, height);
 
-  #if ENABLED(USE_SPI_DMA_TC)
+  #if ENABLED(LVGL_PERFORMANCE_MODE)
+    TFT_FSMC::DMAtx.XferCpltCallback = dmc_tc_handler;
+    SPI_TFT.tftio.WriteSequenceIT((uint16_t*)color_p, width * height);
+  #elif ENABLED(USE_SPI_DMA_TC)
     lcd_dma_trans_lock = true;
     SPI_TFT.tftio.WriteSequenceIT((uint16_t*)color_p, width * height);
     TFT_SPI::DMAtx.XferCpltCallback = dmc_tc_handler;
@@ -895,6 +895,8 @@ namespace ExtUI {
         if (WITHIN(pos.x, 0, (GRID_MAX_POINTS_X) - 1) && WITHIN(pos.y, 0, (GRID_MAX_POINTS_Y) - 1)) {
           bedlevel.z_values[pos.x][pos.y] = zoff;
           TERN_(ABL_BILINEAR_SUBDIVISION, bed_level_virt_interpolate());
+          TERN_(MESH_BED_LEVELING, bedlevel.refresh_bed_level());
+          TERN_(UBL_CELL_PLANES, bedlevel.refresh_bed_level());
         }
       }
 
@@ -1151,13 +1153,75 @@ namespace ExtUI {
     #endif
   }
 
+  #if ENABLED(EXTUI_CHANGE_EVENTS)
+
+    static change_mask_t subscribed, pending;
+
+    void subscribeChanges(const change_mask_t mask) { subscribed = mask; pending = mask; }
+
+    change_mask_t takeChanges() {
+      const change_mask_t c = pending;
+      pending = 0;
+      return c;
+    }
+
+    static void publish(const change_t c, float &last, const_float_t now, const_float_t threshold) {
+      if (ABS(now - last) >= threshold) { last = now; SBI(pending, c); }
+    }
+
+    void publishChanges() {
+      if (subscribed & (CHANGE_BIT(CHANGE_TEMP) | CHANGE_BIT(CHANGE_TARGET))) {
+        static float last_temp[HOTENDS + 2], last_target[HOTENDS + 2];
+        uint8_t i = 0;
+        auto heater = [&](const heater_t h) {
+          if (TEST(subscribed, CHANGE_TEMP)) publish(CHANGE_TEMP, last_temp[i], getActualTemp_celsius(h), EXTUI_CHANGE_TEMP);
+          if (TEST(subscribed, CHANGE_TARGET)) publish(CHANGE_TARGET, last_target[i], getTargetTemp_celsius(h), 1);
+          i++;
+        };
+        HOTEND_LOOP() heater(heater_t(H0 + e));
+        TERN_(HAS_HEATED_BED, heater(BED));
+        TERN_(HAS_TEMP_CHAMBER, heater(CHAMBER));
+      }
+
+      if (TEST(subscribed, CHANGE_POSITION)) {
+        static xyz_pos_t last;
+        LOOP_LINEAR_AXES(a) publish(CHANGE_POSITION, last[a], current_position[a], EXTUI_CHANGE_POSITION);
+      }
+
+      #if HAS_FAN
+        if (TEST(subscribed, CHANGE_FAN)) {
+          static float last[FAN_COUNT];
+          FANS_LOOP(f) publish(CHANGE_FAN, last[f], thermalManager.fan_speed[f], 1);
+        }
+      #endif
+
+      if (TEST(subscribed, CHANGE_FEEDRATE)) {
+        static float last_feedrate;
+        publish(CHANGE_FEEDRATE, last_feedrate, feedrate_percentage, 1);
+        #if HAS_EXTRUDERS
+          static float last_flow[EXTRUDERS];
+          EXTRUDER_LOOP() publish(CHANGE_FEEDRATE, last_flow[e], planner.flow_percentage[e], 1);
+        #endif
+      }
+
+      if (TEST(subscribed, CHANGE_PROGRESS)) {
+        static float last;
+        publish(CHANGE_PROGRESS, last, getProgress_percent(), 1);
+      }
+    }
+
+  #endif // EXTUI_CHANGE_EVENTS
+
 } // namespace ExtUI
 
 // At the moment we hook into MarlinUI methods, but this could be cleaned up in the future
 
 void MarlinUI::init_lcd() { ExtUI::onStartup(); }
 
-void MarlinUI::update() { ExtUI::onIdle(); }
+void MarlinUI::update() {
+  TERN_(EXTUI_CHANGE_EVENTS, ExtUI::publishChanges());
+  ExtUI::onIdle();
+}
 
 void MarlinUI::kill_screen(FSTR_P const error, FSTR_P const component) {
   using namespace ExtUI;
@@ -391,6 +391,30 @@ namespace ExtUI {
       uint16_t count();
   };
 
+  #if ENABLED(EXTUI_CHANGE_EVENTS)
+    /**
+     * Change notification
+     *
+     * Before each onIdle() Marlin compares the subscribed values with those
+     * last published and flags the groups that moved past their threshold.
+     * The UI takes the flags and redraws only the widgets that need it.
+     */
+    enum change_t : uint8_t {
+      CHANGE_TEMP,      // A current temperature, by EXTUI_CHANGE_TEMP
+      CHANGE_TARGET,    // A target temperature
+      CHANGE_POSITION,  // An axis position, by EXTUI_CHANGE_POSITION
+      CHANGE_FAN,       // A fan speed
+      CHANGE_FEEDRATE,  // Feedrate or flow percentage
+      CHANGE_PROGRESS   // Print progress percentage
+    };
+    typedef uint8_t change_mask_t;
+    #define CHANGE_BIT(C) ExtUI::change_mask_t(_BV(ExtUI::C))
+
+    void subscribeChanges(const change_mask_t mask);
+    change_mask_t takeChanges();  // Subscribed groups changed since the last call
+    void publishChanges();        // Called by Marlin before onIdle()
+  #endif
+
   /**
    * Event callback routines
    *
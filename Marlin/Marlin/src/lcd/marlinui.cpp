@@ -53,6 +53,18 @@ MarlinUI ui;
   #include "e3v2/jyersui/dwin.h"
 #endif
 
+#if ENABLED(TFT_UI_PROFILER)
+  #include "tft/ui_profiler.h"
+#endif
+
+#if ENABLED(FF_RTOS_TASKS)
+  #include "../HAL/STM32/rtos_tasks.h"
+#endif
+
+#if ENABLED(TRACE_EVENTS)
+  #include "../feature/trace_events.h"
+#endif
+
 #if ENABLED(LCD_PROGRESS_BAR) && !IS_TFTGLCD_PANEL
   #define BASIC_PROGRESS_BAR 1
 #endif
@@ -915,8 +927,50 @@ void MarlinUI::init() {
     return !BUTTON_PRESSED(ENC_EN); // Update encoder only when ENC_EN is not LOW (pressed)
   }
 
+  #if ENABLED(UI_MOTION_PRIORITY)
+
+    uint8_t MarlinUI::motion_min_moves = UI_MIN_PLANNED_MOVES,
+            MarlinUI::frame_budget_ms = UI_FRAME_BUDGET_MS,
+            MarlinUI::frame_cost_ms; // = 0
+    uint16_t MarlinUI::frame_hold_max_ms = UI_FRAME_HOLD_MAX_MS;
+
+    /**
+     * Motion comes first. While moves are queued, hold the next frame if the
+     * planner is running low, or if the last frame cost more than the budget
+     * and more than half the time left in the queue. A frame that has been
+     * put off for frame_hold_max_ms is drawn anyway, so the screen still
+     * refreshes during long runs of tiny segments.
+     */
+    #if HAS_GRAPHICAL_TFT
+      static uint8_t tft_work_ms; // TFT queue time since the last frame
+    #endif
+
+    bool MarlinUI::hold_frame(const millis_t ms) {
+      static millis_t held_since_ms; // = 0
+
+      const uint8_t moves = planner.movesplanned();
+      const bool hold = moves && (
+           moves < motion_min_moves
+        || (frame_cost_ms > frame_budget_ms && planner.block_buffer_runtime() < 2U * frame_cost_ms)
+      );
+
+      if (!hold) { held_since_ms = 0; return false; }
+      if (!held_since_ms) held_since_ms = ms;
+      if (ELAPSED(ms, held_since_ms + frame_hold_max_ms)) { held_since_ms = 0; return false; }
+      return true;
+    }
+
+  #endif
+
   void MarlinUI::update() {
 
+    // Only the ui task draws. A loop elsewhere that wants the screen updated lets it run.
+    #if ENABLED(FF_RTOS_TASKS)
+      if (RTOSTasks::started() && !RTOSTasks::in_ui_task()) return RTOSTasks::idle(true);
+    #endif
+
+    TERN_(TRACE_EVENTS, TRACE_SCOPE(TRACE_UI_UPDATE));
+
     static uint16_t max_display_update_time = 0;
     millis_t ms = millis();
 
@@ -1106,7 +1160,7 @@ void MarlinUI::init() {
       // Then we want to use only 50% of the time
       const uint16_t bbr2 = planner.block_buffer_runtime() >> 1;
 
-      if ((should_draw() || drawing_screen) && (!bbr2 || bbr2 > max_display_update_time)) {
+      if ((should_draw() || drawing_screen) && (!bbr2 || bbr2 > max_display_update_time) && TERN1(UI_MOTION_PRIORITY, !hold_frame(ms))) {
 
         // Change state of drawing flag between screen updates
         if (!drawing_screen) switch (lcdDrawUpdate) {
@@ -1156,8 +1210,18 @@ void MarlinUI::init() {
 
         #else
 
+          #if ENABLED(TFT_UI_PROFILER)
+            ui_profiler.frame(currentScreen);
+            const uint32_t layout_start = get_cycle_count();
+          #endif
+
           run_current_screen();
 
+          #if ENABLED(TFT_UI_PROFILER)
+            ui_profiler.add(UI_PHASE_LAYOUT, get_cycle_count() - layout_start);
+            TERN_(TFT_UI_PROFILER_OVERLAY, ui_profiler.draw_overlay());
+          #endif
+
           // Apply all DWIN drawing after processing
           TERN_(IS_DWIN_MARLINUI, DWIN_UpdateLCD());
 
@@ -1165,9 +1229,15 @@ void MarlinUI::init() {
 
         TERN_(HAS_MARLINUI_MENU, lcd_clicked = false);
 
+        #if ENABLED(UI_MOTION_PRIORITY)
+          // The screen handler, plus the TFT queue time spent rendering the previous frame
+          frame_cost_ms = _MIN(millis() - ms + TERN0(HAS_GRAPHICAL_TFT, tft_work_ms), 255UL);
+          TERN_(HAS_GRAPHICAL_TFT, tft_work_ms = 0);
+        #endif
+
         // Keeping track of the longest time for an individual LCD update.
         // Used to do screen throttling when the planner starts to fill up.
-        if (on_status_screen())
+        if (on_status_screen() || TERN0(TFT_TOOLPATH_PREVIEW, currentScreen == toolpath_screen))
           NOLESS(max_display_update_time, millis() - ms);
       }
 
@@ -1203,7 +1273,13 @@ void MarlinUI::init() {
 
     } // ELAPSED(ms, next_lcd_update_ms)
 
-    TERN_(HAS_GRAPHICAL_TFT, tft_idle());
+    #if BOTH(UI_MOTION_PRIORITY, HAS_GRAPHICAL_TFT)
+      const millis_t tft_ms = millis();
+      tft_idle();
+      tft_work_ms = _MIN(tft_work_ms + millis() - tft_ms, 255UL);
+    #else
+      TERN_(HAS_GRAPHICAL_TFT, tft_idle());
+    #endif
   }
 
   #if HAS_ADC_BUTTONS
@@ -1687,6 +1763,9 @@ void MarlinUI::init() {
     MarlinUI::progress_t MarlinUI::_get_progress() {
       return (
         TERN0(LCD_SET_PROGRESS_MANUALLY, (progress_override & PROGRESS_MASK))
+        #if ENABLED(PRINT_TIME_ESTIMATE)
+          ?: progress_t(print_estimate.done() * 100 * (PROGRESS_SCALE))
+        #endif
         #if ENABLED(SDSUPPORT)
           ?: TERN(HAS_PRINT_PROGRESS_PERMYRIAD, card.permyriadDone(), card.percentDone())
         #endif
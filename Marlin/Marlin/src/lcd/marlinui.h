@@ -26,6 +26,10 @@
 #include "../module/motion.h"
 #include "../libs/buzzer.h"
 
+#if ENABLED(PRINT_TIME_ESTIMATE)
+  #include "../feature/print_time.h"
+#endif
+
 #include "buttons.h"
 
 #if ENABLED(TOUCH_SCREEN_CALIBRATION)
@@ -284,6 +288,14 @@ public:
     static void sleep_off();
   #endif
 
+  #if ENABLED(UI_MOTION_PRIORITY)
+    static uint8_t motion_min_moves;    // M257 P : Hold frames while fewer moves are planned
+    static uint8_t frame_budget_ms;     // M257 B : Frames costing more need queued time to cover them
+    static uint16_t frame_hold_max_ms;  // M257 H : Longest hold before a frame is forced
+    static uint8_t frame_cost_ms;       // Cost of the last frame that was drawn
+    static bool hold_frame(const millis_t ms);
+  #endif
+
   #if HAS_DWIN_E3V2_BASIC
     static void refresh();
   #else
@@ -312,6 +324,13 @@ public:
       static uint32_t _calculated_remaining_time() {
         const duration_t elapsed = print_job_timer.duration();
         const progress_t progress = _get_progress();
+        #if ENABLED(SD_JOB_INFO)
+          if (card.isFileOpen() && card.job_info.time)
+            return uint32_t(card.job_info.time * (1.0f - float(progress) / (100 * (PROGRESS_SCALE))));
+        #endif
+        #if ENABLED(PRINT_TIME_ESTIMATE)
+          if (print_estimate.ready()) return print_estimate.remaining();
+        #endif
         return progress ? elapsed.value * (100 * (PROGRESS_SCALE) - progress) / progress : 0;
       }
       #if ENABLED(USE_M73_REMAINING_TIME)
@@ -757,6 +776,12 @@ public:
 
   #if HAS_GRAPHICAL_TFT
     static void move_axis_screen();
+    #if ENABLED(TFT_THUMBNAIL)
+      static void thumbnail_screen();
+    #endif
+    #if ENABLED(TFT_TOOLPATH_PREVIEW)
+      static void toolpath_screen();
+    #endif
   #endif
 
 private:
@@ -29,23 +29,41 @@
 uint16_t CANVAS::width, CANVAS::height;
 uint16_t CANVAS::startLine, CANVAS::endLine;
 uint16_t *CANVAS::buffer = TFT::buffer;
+#if ENABLED(TFT_DOUBLE_BUFFER)
+  uint16_t CANVAS::x, CANVAS::y;
+#endif
 
 void CANVAS::New(uint16_t x, uint16_t y, uint16_t width, uint16_t height) {
   CANVAS::width = width;
   CANVAS::height = height;
   startLine = 0;
   endLine = 0;
+  // The memory profile may have moved the buffer
+  TERN_(MEMORY_PROFILES, if (buffer != TFT::buffer + TFT::buffer_size) buffer = TFT::buffer);
 
-  tft.set_window(x, y, x + width - 1, y + height - 1);
+  #if ENABLED(TFT_DOUBLE_BUFFER)
+    // The previous canvas may still be on the bus. Set the window in ToScreen.
+    CANVAS::x = x;
+    CANVAS::y = y;
+  #else
+    tft.set_window(x, y, x + width - 1, y + height - 1);
+  #endif
 }
 
 void CANVAS::Continue() {
   startLine = endLine;
-  endLine = TFT_BUFFER_SIZE < width * (height - startLine) ? startLine + TFT_BUFFER_SIZE / width : height;
+  endLine = TFT::buffer_size < width * (height - startLine) ? startLine + TFT::buffer_size / width : height;
 }
 
 bool CANVAS::ToScreen() {
-  tft.write_sequence(buffer, width * (endLine - startLine));
+  #if ENABLED(TFT_DOUBLE_BUFFER)
+    if (startLine == 0) tft.set_window(x, y, x + width - 1, y + height - 1);
+    tft.write_sequence_async(buffer, width * (endLine - startLine));
+    // Render the next slice in the other half while this one is sent
+    buffer = buffer == TFT::buffer ? TFT::buffer + TFT::buffer_size : TFT::buffer;
+  #else
+    tft.write_sequence(buffer, width * (endLine - startLine));
+  #endif
   return endLine == height;
 }
 
@@ -63,47 +81,103 @@ void CANVAS::SetBackground(uint16_t color) {
   while (count--) *pointer++ = two_pixels;
 }
 
-#if ENABLED( FF_RUSSIAN_FIX )
-#include "../fontutils.h"
-static uint8_t read_byte_c(const uint8_t *byte) { return *byte; }
-#endif
-
+// The queue stores text as glyph indices, with any UTF-8 already decoded
 void CANVAS::AddText(uint16_t x, uint16_t y, uint16_t color, uint8_t *string, uint16_t maxWidth) {
-#if ENABLED( FF_RUSSIAN_FIX )
-  uint8_t is_wchar = ( x & 0x8000 ) != 0;
-  x &= ~0x8000;
-#endif
   if (endLine < y || startLine > y + GetFontHeight()) return;
 
   if (maxWidth == 0) maxWidth = width - x;
 
   uint16_t stringWidth = 0;
-#if DISABLED( FF_RUSSIAN_FIX )
   for (uint16_t i = 0 ; *(string + i) ; i++) {
     glyph_t *glyph = Glyph(string + i);
-#else
-  lchar_t wchar = 0;
-  while( *string ) {
-    uint8_t ch;
-    if( is_wchar )
-    {
-      string = (uint8_t*)get_utf8_value_cb(string, read_byte_c, wchar);
-      ch = uint8_t(wchar & 0x00FF);
-    }
-    else
-    {
-      ch = *string++;
-    }
-    if( !ch )
-      break;
-    glyph_t *glyph = Glyph( &ch );
-#endif
     if (stringWidth + glyph->BBXWidth > maxWidth) break;
-    AddImage(x + stringWidth + glyph->BBXOffsetX, y + Font()->FontAscent - glyph->BBXHeight - glyph->BBXOffsetY, glyph->BBXWidth, glyph->BBXHeight, GREYSCALE1, ((uint8_t *)glyph) + sizeof(glyph_t), &color);
+    #if ENABLED(TFT_GLYPH_CACHE)
+      AddGlyph(x + stringWidth + glyph->BBXOffsetX, y + Font()->FontAscent - glyph->BBXHeight - glyph->BBXOffsetY, glyph, color);
+    #else
+      AddImage(x + stringWidth + glyph->BBXOffsetX, y + Font()->FontAscent - glyph->BBXHeight - glyph->BBXOffsetY, glyph->BBXWidth, glyph->BBXHeight, GREYSCALE1, ((uint8_t *)glyph) + sizeof(glyph_t), &color);
+    #endif
     stringWidth += glyph->DWidth;
   }
 }
 
+#if ENABLED(TFT_GLYPH_CACHE)
+
+__ccmram CANVAS::cachedGlyph_t CANVAS::glyphCache[TFT_GLYPH_CACHE_ENTRIES];
+uint32_t CANVAS::glyphClock; // = 0
+
+#define GLYPH_TOO_BIG 0xFF    // Runs didn't fit in a slot. Draw it bit by bit.
+
+// Convert a 1-bit glyph to runs. False if they don't fit in a slot.
+static bool glyph_to_runs(glyph_t *glyph, uint8_t *out) {
+  const uint8_t *data = ((uint8_t *)glyph) + sizeof(glyph_t);
+  const uint8_t * const end = out + TFT_GLYPH_CACHE_SLOT;
+  for (uint8_t i = 0; i < glyph->BBXHeight; i++) {
+    if (out >= end) return false;
+    uint8_t * const count = out++;
+    uint8_t start = 0;
+    bool inside = false;
+    *count = 0;
+    for (uint16_t j = 0; j <= glyph->BBXWidth; j++) {
+      const bool set = j < glyph->BBXWidth && TEST(data[j >> 3], 7 - (j & 7));
+      if (set && !inside) {
+        start = j;
+        inside = true;
+      }
+      else if (!set && inside) {
+        if (out + 2 > end) return false;
+        *out++ = start;
+        *out++ = j - start;
+        (*count)++;
+        inside = false;
+      }
+    }
+    data += (glyph->BBXWidth + 7) / 8;
+  }
+  return true;
+}
+
+// Find a glyph in the cache, or convert it into the least recently used slot
+const uint8_t *CANVAS::GlyphRuns(glyph_t *glyph) {
+  cachedGlyph_t *slot = &glyphCache[0];
+  for (cachedGlyph_t &entry : glyphCache) {
+    if (entry.glyph == glyph) { slot = &entry; break; }
+    if (entry.used < slot->used) slot = &entry;
+  }
+
+  if (slot->glyph != glyph) {
+    slot->glyph = glyph;
+    if (!glyph_to_runs(glyph, slot->runs)) slot->runs[0] = GLYPH_TOO_BIG;
+  }
+
+  slot->used = ++glyphClock;
+  return slot->runs[0] == GLYPH_TOO_BIG ? nullptr : slot->runs;
+}
+
+void CANVAS::AddGlyph(int16_t x, int16_t y, glyph_t *glyph, uint16_t color) {
+  if (y >= endLine || y + glyph->BBXHeight <= startLine) return;
+
+  const uint8_t *run = GlyphRuns(glyph);
+  if (!run) return AddImage(x, y, glyph->BBXWidth, glyph->BBXHeight, GREYSCALE1, ((uint8_t *)glyph) + sizeof(glyph_t), &color);
+
+  for (int16_t i = 0; i < glyph->BBXHeight; i++) {
+    const int16_t line = y + i;
+    uint8_t count = *run++;
+    if (line >= startLine && line < endLine) {
+      uint16_t * const row = buffer + (line - startLine) * width;
+      for (; count; count--, run += 2) {
+        int16_t from = x + run[0], to = from + run[1];
+        NOLESS(from, 0);
+        NOMORE(to, int16_t(width));
+        while (from < to) row[from++] = color;
+      }
+    }
+    else
+      run += count * 2;
+  }
+}
+
+#endif // TFT_GLYPH_CACHE
+
 void CANVAS::AddImage(int16_t x, int16_t y, MarlinImage image, uint16_t *colors) {
   uint16_t *data = (uint16_t *)Images[image].data;
   if (!data) return;
@@ -112,6 +186,11 @@ void CANVAS::AddImage(int16_t x, int16_t y, MarlinImage image, uint16_t *colors)
            image_height = Images[image].height;
   colorMode_t color_mode = Images[image].colorMode;
 
+  #if ENABLED(TFT_IMAGE_RLE)
+    if (color_mode == HIGHCOLOR_RLE)
+      return AddImageRLE(x, y, image_width, image_height, data);
+  #endif
+
   if (color_mode != HIGHCOLOR)
     return AddImage(x, y, image_width, image_height, color_mode, (uint8_t *)data, colors);
 
@@ -132,6 +211,76 @@ void CANVAS::AddImage(int16_t x, int16_t y, MarlinImage image, uint16_t *colors)
   }
 }
 
+#if ENABLED(TFT_IMAGE_RLE)
+
+// Decode the rows that fall in this slice. Runs never cross rows.
+void CANVAS::AddImageRLE(int16_t x, int16_t y, uint16_t image_width, uint16_t image_height, const uint16_t *data) {
+  if (y >= endLine || y + image_height <= startLine) return;
+
+  for (int16_t i = 0; i < image_height; i++) {
+    const int16_t line = y + i;
+    if (line >= endLine) break;
+    const bool visible = line >= startLine;
+    uint16_t * const row = buffer + (visible ? (line - startLine) * width : 0);
+    for (int16_t j = 0; j < image_width;) {
+      const uint16_t code = *data++, count = code & 0x7FFF;
+      if (visible) {
+        int16_t from = x + j, to = from + count;
+        const int16_t skip = from < 0 ? -from : 0;
+        NOLESS(from, 0);
+        NOMORE(to, int16_t(width));
+        if (code & 0x8000) {
+          const uint16_t color = ENDIAN_COLOR(*data);
+          while (from < to) row[from++] = color;
+        }
+        else
+          for (const uint16_t *pixel = data + skip; from < to;) row[from++] = ENDIAN_COLOR(*pixel++);
+      }
+      data += (code & 0x8000) ? 1 : count;
+      j += count;
+    }
+  }
+}
+
+#endif // TFT_IMAGE_RLE
+
+#if ENABLED(TFT_THUMBNAIL)
+
+#include "tft_thumbnail.h"
+
+// Decode the thumbnail rows that fall in this slice
+void CANVAS::AddThumbnail(int16_t x, int16_t y) {
+  const int16_t last = _MIN(int16_t(endLine), y + int16_t(TFT_Thumbnail::height));
+  for (int16_t line = _MAX(y, int16_t(startLine)); line < last; line++) {
+    if (!TFT_Thumbnail::seek(line - y)) return;
+    TFT_Thumbnail::decode_row(buffer + (line - startLine) * width, x, width);
+  }
+}
+
+#endif
+
+#if ENABLED(TFT_TOOLPATH_PREVIEW)
+
+#include "tft_toolpath.h"
+
+// Scale up the map rows that fall in this slice, the current layer over the last
+void CANVAS::AddToolpath(int16_t x, int16_t y, uint8_t scale, uint16_t color, uint16_t lastColor) {
+  const int16_t last = _MIN(int16_t(endLine), y + int16_t(TFT_TOOLPATH_CELLS) * scale);
+  for (int16_t line = _MAX(y, int16_t(startLine)); line < last; line++) {
+    const uint16_t row = (line - y) / scale;
+    uint16_t *pixel = buffer + (line - startLine) * width;
+    for (uint16_t c = 0; c < TFT_TOOLPATH_CELLS; c++) {
+      const int16_t px = x + c * scale;
+      if (px < 0 || px + scale > width) continue;
+      const bool now = toolpath.get(0, c, row);
+      if (!now && !toolpath.get(1, c, row)) continue;
+      LOOP_L_N(i, scale) pixel[px + i] = now ? color : lastColor;
+    }
+  }
+}
+
+#endif
+
 void CANVAS::AddImage(int16_t x, int16_t y, uint8_t image_width, uint8_t image_height, colorMode_t color_mode, uint8_t *data, uint16_t *colors) {
   uint8_t bitsPerPixel;
   switch (color_mode) {
@@ -33,6 +33,9 @@ class CANVAS {
     static uint16_t width, height;
     static uint16_t startLine, endLine;
     static uint16_t *buffer;
+    #if ENABLED(TFT_DOUBLE_BUFFER)
+      static uint16_t x, y;
+    #endif
 
     inline static font_t *Font() { return TFT_String::font(); }
     inline static glyph_t *Glyph(uint8_t *character) { return TFT_String::glyph(character); }
@@ -40,6 +43,18 @@ class CANVAS {
 
     static void AddImage(int16_t x, int16_t y, uint8_t image_width, uint8_t image_height, colorMode_t color_mode, uint8_t *data, uint16_t *colors);
     static void AddImage(uint16_t x, uint16_t y, uint16_t imageWidth, uint16_t imageHeight, uint16_t color, uint16_t bgColor, uint8_t *image);
+    #if ENABLED(TFT_IMAGE_RLE)
+      static void AddImageRLE(int16_t x, int16_t y, uint16_t image_width, uint16_t image_height, const uint16_t *data);
+    #endif
+
+    #if ENABLED(TFT_GLYPH_CACHE)
+      // A glyph converted to runs of set pixels: per row, a count then (start, length) pairs
+      typedef struct { glyph_t *glyph; uint32_t used; uint8_t runs[TFT_GLYPH_CACHE_SLOT]; } cachedGlyph_t;
+      static cachedGlyph_t glyphCache[TFT_GLYPH_CACHE_ENTRIES];
+      static uint32_t glyphClock;
+      static const uint8_t *GlyphRuns(glyph_t *glyph);
+      static void AddGlyph(int16_t x, int16_t y, glyph_t *glyph, uint16_t color);
+    #endif
 
   public:
     static void New(uint16_t x, uint16_t y, uint16_t width, uint16_t height);
@@ -49,6 +64,12 @@ class CANVAS {
     static void SetBackground(uint16_t color);
     static void AddText(uint16_t x, uint16_t y, uint16_t color, uint8_t *string, uint16_t maxWidth);
     static void AddImage(int16_t x, int16_t y, MarlinImage image, uint16_t *colors);
+    #if ENABLED(TFT_THUMBNAIL)
+      static void AddThumbnail(int16_t x, int16_t y);
+    #endif
+    #if ENABLED(TFT_TOOLPATH_PREVIEW)
+      static void AddToolpath(int16_t x, int16_t y, uint8_t scale, uint16_t color, uint16_t lastColor);
+    #endif
 
     static void AddRectangle(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint16_t color);
     static void AddBar(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint16_t color);
@@ -0,0 +1,259 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+// Generated by buildroot/share/scripts/rle16-tft-image.py. Do not edit.
+
+#include "../../../inc/MarlinConfigPre.h"
+
+#if HAS_GRAPHICAL_TFT && ENABLED(TFT_IMAGE_RLE)
+
+extern const uint16_t background_320x30x16_rle[3619] = {
+  0x0004, 0x10F2, 0x18D2, 0x18D2, 0x10D2, 0x8008, 0x18D2, 0x800C, 0x18F2, 0x0005, 0x18D2, 0x18F2, 0x18F2, 0x18D2, 0x18D2, 0x8014,
+  0x18F2, 0x8005, 0x18F3, 0x0004, 0x18F2, 0x18F3, 0x18F3, 0x20F2, 0x8006, 0x18F3, 0x8013, 0x20F3, 0x0001, 0x2112, 0x8004, 0x20F3,
+  0x0004, 0x2113, 0x20F2, 0x20F3, 0x20F2, 0x8010, 0x20F3, 0x0007, 0x2113, 0x28F3, 0x2113, 0x20F3, 0x2113, 0x28F3, 0x20F3, 0x8007,
+  0x2113, 0x0002, 0x28F3, 0x28F3, 0x8003, 0x2113, 0x800D, 0x2913, 0x0001, 0x2113, 0x8003, 0x2913, 0x0004, 0x2914, 0x2913, 0x2913,
+  0x28F3, 0x801D, 0x2913, 0x0001, 0x28F3, 0x801C, 0x2913, 0x0004, 0x28F3, 0x2913, 0x2913, 0x2914, 0x8003, 0x2913, 0x0001, 0x2113,
+  0x800D, 0x2913, 0x8003, 0x2113, 0x0002, 0x28F3, 0x28F3, 0x8007, 0x2113, 0x0007, 0x20F3, 0x28F3, 0x2113, 0x20F3, 0x2113, 0x28F3,
+  0x2113, 0x8010, 0x20F3, 0x0004, 0x20F2, 0x20F3, 0x20F2, 0x2113, 0x8004, 0x20F3, 0x0001, 0x2112, 0x8013, 0x20F3, 0x8006, 0x18F3,
+  0x0004, 0x20F2, 0x18F3, 0x18F3, 0x18F2, 0x8005, 0x18F3, 0x800F, 0x18F2, 0x800C, 0x1D7C, 0x8008, 0x1D9C, 0x8004, 0x1D9D, 0x0005,
+  0x259C, 0x1DBC, 0x1D9D, 0x259D, 0x1D9C, 0x8005, 0x259C, 0x800E, 0x25BD, 0x0005, 0x25DD, 0x25DD, 0x25BD, 0x25BD, 0x1DDD, 0x8003,
+  0x25DD, 0x0001, 0x25BD, 0x8009, 0x25DD, 0x800C, 0x25FD, 0x0001, 0x2DFD, 0x8004, 0x25FD, 0x8005, 0x2DFD, 0x0004, 0x25FD, 0x2DFE,
+  0x2DFD, 0x2DFD, 0x8012, 0x2E1D, 0x0001, 0x2E3E, 0x8004, 0x2E1D, 0x0002, 0x2E3D, 0x2E3D, 0x8003, 0x2E3E, 0x8014, 0x2E3D, 0x8003,
+  0x2E3E, 0x0001, 0x2E3D, 0x800C, 0x2E3E, 0x8010, 0x2E5E, 0x0001, 0x365E, 0x8003, 0x2E5E, 0x0002, 0x2E3E, 0x365E, 0x8003, 0x2E5E,
+  0x0001, 0x365E, 0x8010, 0x2E5E, 0x800C, 0x2E3E, 0x0001, 0x2E3D, 0x8003, 0x2E3E, 0x8014, 0x2E3D, 0x8003, 0x2E3E, 0x0002, 0x2E3D,
+  0x2E3D, 0x8004, 0x2E1D, 0x0001, 0x2E3E, 0x8012, 0x2E1D, 0x0004, 0x2DFD, 0x2DFD, 0x2DFE, 0x25FD, 0x8005, 0x2DFD, 0x8004, 0x25FD,
+  0x0001, 0x2DFD, 0x800C, 0x25FD, 0x8009, 0x25DD, 0x0001, 0x25BD, 0x8003, 0x25DD, 0x0005, 0x1DDD, 0x25BD, 0x25BD, 0x25DD, 0x25DD,
+  0x800E, 0x25BD, 0x8003, 0x1C7C, 0x0001, 0x1C7B, 0x8006, 0x1C7C, 0x800C, 0x1C9C, 0x0006, 0x249C, 0x1C9C, 0x1D9D, 0x1D7C, 0x1CFC,
+  0x1C9C, 0x8010, 0x1CBC, 0x0003, 0x24BC, 0x1CBC, 0x1CBC, 0x8003, 0x24BC, 0x0001, 0x1CBC, 0x8003, 0x24DC, 0x0006, 0x253D, 0x25BD,
+  0x253D, 0x24DD, 0x24BC, 0x24BC, 0x8010, 0x24DD, 0x000B, 0x24FD, 0x24DC, 0x24DC, 0x24FD, 0x24FD, 0x24FC, 0x24DD, 0x24FD, 0x251C,
+  0x25FD, 0x255D, 0x8004, 0x24FD, 0x0001, 0x24FC, 0x8008, 0x24FD, 0x8008, 0x2CFD, 0x000F, 0x251D, 0x24FD, 0x24FD, 0x251D, 0x2D1D,
+  0x24FD, 0x2CFD, 0x25BD, 0x25BD, 0x253C, 0x2CFC, 0x2D1D, 0x251D, 0x2CFD, 0x2CFD, 0x8015, 0x2D1D, 0x0003, 0x2D1C, 0x2D5D, 0x2DDE,
+  0x8009, 0x2D1D, 0x8010, 0x2D3D, 0x0005, 0x2D1D, 0x2D3D, 0x2D1D, 0x2D1D, 0x2E1D, 0x8003, 0x2D1D, 0x0002, 0x2D3D, 0x2D1D, 0x8010,
+  0x2D3D, 0x8009, 0x2D1D, 0x0003, 0x2DDE, 0x2D5D, 0x2D1C, 0x8015, 0x2D1D, 0x000F, 0x2CFD, 0x2CFD, 0x251D, 0x2D1D, 0x2CFC, 0x253C,
+  0x25BD, 0x25BD, 0x2CFD, 0x24FD, 0x2D1D, 0x251D, 0x24FD, 0x24FD, 0x251D, 0x8008, 0x2CFD, 0x8008, 0x24FD, 0x0001, 0x24FC, 0x8004,
+  0x24FD, 0x000B, 0x255D, 0x25FD, 0x251C, 0x24FD, 0x24DD, 0x24FC, 0x24FD, 0x24FD, 0x24DC, 0x24DC, 0x24FD, 0x8010, 0x24DD, 0x0006,
+  0x24BC, 0x24BC, 0x24DD, 0x253D, 0x25BD, 0x253D, 0x8003, 0x24DC, 0x0001, 0x1CBC, 0x8003, 0x24BC, 0x0003, 0x1CBC, 0x1CBC, 0x24BC,
+  0x800A, 0x1CBC, 0x8010, 0x1ABB, 0x8004, 0x1ADB, 0x0004, 0x1B3B, 0x1CFC, 0x157C, 0x1C1C, 0x8012, 0x1ADB, 0x0002, 0x22DB, 0x22DB,
+  0x8004, 0x1ADB, 0x000E, 0x22DB, 0x22DB, 0x22FB, 0x231C, 0x1D1C, 0x1D5C, 0x235B, 0x22DC, 0x22DB, 0x22DC, 0x22FB, 0x22FC, 0x22DC,
+  0x22DC, 0x8006, 0x22FC, 0x8004, 0x22FB, 0x8008, 0x22FC, 0x0008, 0x231B, 0x22FC, 0x233C, 0x253C, 0x1CFD, 0x22FC, 0x22FC, 0x22FB,
+  0x8010, 0x22FC, 0x8005, 0x231C, 0x000E, 0x2AFC, 0x2AFC, 0x231C, 0x2B1C, 0x2B1C, 0x259C, 0x247C, 0x231C, 0x231C, 0x2B1C, 0x231C,
+  0x231C, 0x2B1C, 0x231C, 0x8016, 0x2B1C, 0x0002, 0x25BD, 0x2BBC, 0x801A, 0x2B1C, 0x0004, 0x231C, 0x2B1C, 0x2B1C, 0x25DD, 0x8003,
+  0x2B1C, 0x0001, 0x231C, 0x801A, 0x2B1C, 0x0002, 0x2BBC, 0x25BD, 0x8016, 0x2B1C, 0x000E, 0x231C, 0x2B1C, 0x231C, 0x231C, 0x2B1C,
+  0x231C, 0x231C, 0x247C, 0x259C, 0x2B1C, 0x2B1C, 0x231C, 0x2AFC, 0x2AFC, 0x8005, 0x231C, 0x8010, 0x22FC, 0x0008, 0x22FB, 0x22FC,
+  0x22FC, 0x1CFD, 0x253C, 0x233C, 0x22FC, 0x231B, 0x8008, 0x22FC, 0x8004, 0x22FB, 0x8006, 0x22FC, 0x000E, 0x22DC, 0x22DC, 0x22FC,
+  0x22FB, 0x22DC, 0x22DB, 0x22DC, 0x235B, 0x1D5C, 0x1D1C, 0x231C, 0x22FB, 0x22DB, 0x22DB, 0x8004, 0x1ADB, 0x0002, 0x22DB, 0x22DB,
+  0x8008, 0x1ADB, 0x800B, 0x137B, 0x0004, 0x1B7B, 0x137B, 0x1B5B, 0x1B7B, 0x8003, 0x137B, 0x000C, 0x139B, 0x1BBB, 0x14FB, 0x153C,
+  0x13FB, 0x1B7B, 0x139B, 0x1B7B, 0x1B7C, 0x1B9B, 0x1B7B, 0x1B7B, 0x8007, 0x1B9B, 0x0001, 0x1B9C, 0x8003, 0x1B9B, 0x0001, 0x139C,
+  0x8007, 0x1B9B, 0x000B, 0x1B9C, 0x1B9B, 0x1D3C, 0x1D5C, 0x1BFB, 0x1B9C, 0x1BBB, 0x1B9B, 0x1BBC, 0x1B9B, 0x1B9B, 0x8008, 0x1BBB,
+  0x0012, 0x1BBC, 0x1BBB, 0x1BBB, 0x1BBC, 0x1BBB, 0x1BBC, 0x1BBB, 0x1BBB, 0x1BBC, 0x1BBB, 0x1BBC, 0x1BBB, 0x1BBC, 0x1BBB, 0x1CDC,
+  0x1D7D, 0x23FC, 0x1BDC, 0x8006, 0x1BBC, 0x8008, 0x23BC, 0x0002, 0x1BBC, 0x1BBC, 0x8006, 0x23DC, 0x0001, 0x23BC, 0x8004, 0x23DC,
+  0x0002, 0x247C, 0x1D9C, 0x801D, 0x23DC, 0x0002, 0x241C, 0x259D, 0x801E, 0x23DC, 0x0001, 0x1DBD, 0x801F, 0x23DC, 0x0002, 0x259D,
+  0x241C, 0x801D, 0x23DC, 0x0002, 0x1D9C, 0x247C, 0x8004, 0x23DC, 0x0001, 0x23BC, 0x8006, 0x23DC, 0x0002, 0x1BBC, 0x1BBC, 0x8008,
+  0x23BC, 0x8006, 0x1BBC, 0x0012, 0x1BDC, 0x23FC, 0x1D7D, 0x1CDC, 0x1BBB, 0x1BBC, 0x1BBB, 0x1BBC, 0x1BBB, 0x1BBC, 0x1BBB, 0x1BBB,
+  0x1BBC, 0x1BBB, 0x1BBC, 0x1BBB, 0x1BBB, 0x1BBC, 0x8008, 0x1BBB, 0x000B, 0x1B9B, 0x1B9B, 0x1BBC, 0x1B9B, 0x1BBB, 0x1B9C, 0x1BFB,
+  0x1D5C, 0x1D3C, 0x1B9B, 0x1B9C, 0x8007, 0x1B9B, 0x0001, 0x139C, 0x8003, 0x1B9B, 0x0001, 0x1B9C, 0x8003, 0x1B9B, 0x800A, 0x135B,
+  0x0010, 0x137B, 0x135A, 0x135A, 0x137B, 0x135A, 0x135B, 0x139B, 0x14BB, 0x14FB, 0x13FB, 0x137B, 0x137B, 0x135B, 0x137B, 0x137A,
+  0x137A, 0x800C, 0x137B, 0x0002, 0x1B7B, 0x1B7B, 0x8008, 0x137B, 0x000C, 0x1BBB, 0x153C, 0x151C, 0x1B7B, 0x139B, 0x137B, 0x139B,
+  0x139B, 0x1B9B, 0x139B, 0x1B9B, 0x1B9B, 0x8008, 0x139B, 0x8005, 0x1B9B, 0x000C, 0x13BB, 0x139B, 0x1B9B, 0x139B, 0x1B9B, 0x1B9B,
+  0x1B9C, 0x1C3B, 0x1D5C, 0x1C3C, 0x1B9B, 0x1BBB, 0x8007, 0x1B9B, 0x8008, 0x1BBB, 0x0001, 0x1B9B, 0x8008, 0x1BBB, 0x0005, 0x1BBC,
+  0x1BBB, 0x1BBB, 0x1C9C, 0x1D1C, 0x801A, 0x1BBB, 0x0001, 0x1BDB, 0x8003, 0x1BBB, 0x0004, 0x1CFC, 0x1C7C, 0x1BBB, 0x1BDB, 0x8018,
+  0x1BBC, 0x000A, 0x1BBB, 0x1BDC, 0x23BC, 0x1BBB, 0x1D7C, 0x1BBB, 0x1BBB, 0x23BC, 0x1BDC, 0x1BBB, 0x8018, 0x1BBC, 0x0004, 0x1BDB,
+  0x1BBB, 0x1C7C, 0x1CFC, 0x8003, 0x1BBB, 0x0001, 0x1BDB, 0x801A, 0x1BBB, 0x0005, 0x1D1C, 0x1C9C, 0x1BBB, 0x1BBB, 0x1BBC, 0x8008,
+  0x1BBB, 0x0001, 0x1B9B, 0x8008, 0x1BBB, 0x8007, 0x1B9B, 0x000C, 0x1BBB, 0x1B9B, 0x1C3C, 0x1D5C, 0x1C3B, 0x1B9C, 0x1B9B, 0x1B9B,
+  0x139B, 0x1B9B, 0x139B, 0x13BB, 0x8005, 0x1B9B, 0x8008, 0x139B, 0x000C, 0x1B9B, 0x1B9B, 0x139B, 0x1B9B, 0x139B, 0x139B, 0x137B,
+  0x139B, 0x1B7B, 0x151C, 0x153C, 0x1BBB, 0x8008, 0x137B, 0x0002, 0x1B7B, 0x1B7B, 0x8004, 0x137B, 0x8004, 0x0999, 0x0011, 0x1199,
+  0x11BA, 0x11BA, 0x11B9, 0x09B9, 0x11BA, 0x1199, 0x11BA, 0x11BA, 0x1199, 0x11DA, 0x0B3A, 0x0C9B, 0x0BFB, 0x127A, 0x11BA, 0x119A,
+  0x8006, 0x11BA, 0x0001, 0x119A, 0x800D, 0x11BA, 0x0001, 0x119A, 0x8005, 0x11BA, 0x0004, 0x12BA, 0x14BB, 0x13FB, 0x11DB, 0x8007,
+  0x11BA, 0x0001, 0x11DA, 0x800B, 0x11BA, 0x000E, 0x11BB, 0x11BA, 0x11DA, 0x11BA, 0x11DA, 0x11BA, 0x11BA, 0x11DA, 0x11BA, 0x127A,
+  0x14DB, 0x137B, 0x11DA, 0x19BA, 0x800D, 0x11DA, 0x8003, 0x19DA, 0x0001, 0x11DA, 0x8007, 0x11DB, 0x0008, 0x19DB, 0x11DA, 0x19DA,
+  0x1A3B, 0x14FB, 0x1AFB, 0x19DA, 0x11DB, 0x8010, 0x19DA, 0x8008, 0x19DB, 0x0008, 0x19DA, 0x19DB, 0x19DA, 0x1A1B, 0x153C, 0x1A3B,
+  0x19DA, 0x19DA, 0x8008, 0x19DB, 0x8010, 0x19DA, 0x000A, 0x19DB, 0x19DB, 0x19DA, 0x19DB, 0x153B, 0x19DB, 0x19DB, 0x19DA, 0x19DB,
+  0x19DB, 0x8010, 0x19DA, 0x8008, 0x19DB, 0x0008, 0x19DA, 0x19DA, 0x1A3B, 0x153C, 0x1A1B, 0x19DA, 0x19DB, 0x19DA, 0x8008, 0x19DB,
+  0x8010, 0x19DA, 0x0008, 0x11DB, 0x19DA, 0x1AFB, 0x14FB, 0x1A3B, 0x19DA, 0x11DA, 0x19DB, 0x8007, 0x11DB, 0x0001, 0x11DA, 0x8003,
+  0x19DA, 0x800D, 0x11DA, 0x000E, 0x19BA, 0x11DA, 0x137B, 0x14DB, 0x127A, 0x11BA, 0x11DA, 0x11BA, 0x11BA, 0x11DA, 0x11BA, 0x11DA,
+  0x11BA, 0x11BB, 0x800B, 0x11BA, 0x0001, 0x11DA, 0x8007, 0x11BA, 0x0004, 0x11DB, 0x13FB, 0x14BB, 0x12BA, 0x8005, 0x11BA, 0x0001,
+  0x119A, 0x8007, 0x11BA, 0x8004, 0x0AFA, 0x0010, 0x0B1A, 0x0B1A, 0x0AFA, 0x0AFA, 0x0B1A, 0x0AFA, 0x0B1A, 0x0AFA, 0x0B1A, 0x0B1A,
+  0x0C3A, 0x0C9A, 0x0BDA, 0x0B1A, 0x0AFA, 0x0AFA, 0x8013, 0x0B1A, 0x0004, 0x0B3A, 0x0B1A, 0x0B1A, 0x0B3A, 0x8003, 0x0B1A, 0x000E,
+  0x0BDB, 0x14BB, 0x0BFA, 0x0B1A, 0x0B1A, 0x0B3A, 0x0B3A, 0x0B1A, 0x0B1A, 0x0B3A, 0x0B3A, 0x131A, 0x0B3A, 0x0B1A, 0x8008, 0x0B3A,
+  0x0003, 0x133B, 0x133B, 0x133A, 0x8005, 0x0B3A, 0x0008, 0x133A, 0x0B3A, 0x137A, 0x0CDB, 0x0C5B, 0x133B, 0x133B, 0x0B3A, 0x8007,
+  0x133A, 0x800B, 0x133B, 0x8004, 0x135B, 0x000A, 0x133B, 0x133B, 0x135A, 0x0B5B, 0x133B, 0x143A, 0x147B, 0x135B, 0x135A, 0x133B,
+  0x8012, 0x135A, 0x8008, 0x135B, 0x0003, 0x135A, 0x13BB, 0x14DB, 0x801C, 0x135B, 0x0008, 0x135A, 0x135B, 0x133B, 0x14FB, 0x135A,
+  0x133B, 0x135B, 0x135A, 0x801C, 0x135B, 0x0003, 0x14DB, 0x13BB, 0x135A, 0x8008, 0x135B, 0x8012, 0x135A, 0x000A, 0x133B, 0x135A,
+  0x135B, 0x147B, 0x143A, 0x133B, 0x0B5B, 0x135A, 0x133B, 0x133B, 0x8004, 0x135B, 0x800B, 0x133B, 0x8007, 0x133A, 0x0008, 0x0B3A,
+  0x133B, 0x133B, 0x0C5B, 0x0CDB, 0x137A, 0x0B3A, 0x133A, 0x8005, 0x0B3A, 0x0003, 0x133A, 0x133B, 0x133B, 0x8008, 0x0B3A, 0x000E,
+  0x0B1A, 0x0B3A, 0x131A, 0x0B3A, 0x0B3A, 0x0B1A, 0x0B1A, 0x0B3A, 0x0B3A, 0x0B1A, 0x0B1A, 0x0BFA, 0x14BB, 0x0BDB, 0x8003, 0x0B1A,
+  0x0004, 0x0B3A, 0x0B1A, 0x0B1A, 0x0B3A, 0x8005, 0x0B1A, 0x8006, 0x02D9, 0x0012, 0x02F9, 0x02D9, 0x02DA, 0x0ADA, 0x0AFA, 0x0BFA,
+  0x0C5B, 0x0BFA, 0x0AD9, 0x02FA, 0x02F9, 0x02F9, 0x0AF9, 0x02F9, 0x0AF9, 0x02D9, 0x02F9, 0x0AF9, 0x8010, 0x0AFA, 0x0001, 0x0AF9,
+  0x8003, 0x0AFA, 0x0006, 0x0C1A, 0x0C7B, 0x0B5A, 0x0AFA, 0x0AF9, 0x0B1A, 0x8003, 0x0AFA, 0x0004, 0x0B1A, 0x0AFA, 0x0AFA, 0x0B1A,
+  0x8008, 0x0AFA, 0x8003, 0x0B1A, 0x0005, 0x031A, 0x0AFA, 0x0B1A, 0x0B1A, 0x0AFA, 0x8003, 0x0B1A, 0x0005, 0x0AFA, 0x0C3A, 0x0C5A,
+  0x0B1A, 0x0AFA, 0x801D, 0x0B1A, 0x0002, 0x0C5B, 0x0C1A, 0x801E, 0x0B1A, 0x0004, 0x0B3A, 0x0C7B, 0x0B7A, 0x0B3A, 0x801E, 0x0B1A,
+  0x0001, 0x0CBB, 0x801F, 0x0B1A, 0x0004, 0x0B3A, 0x0B7A, 0x0C7B, 0x0B3A, 0x801E, 0x0B1A, 0x0002, 0x0C1A, 0x0C5B, 0x801D, 0x0B1A,
+  0x0005, 0x0AFA, 0x0B1A, 0x0C5A, 0x0C3A, 0x0AFA, 0x8003, 0x0B1A, 0x0005, 0x0AFA, 0x0B1A, 0x0B1A, 0x0AFA, 0x031A, 0x8003, 0x0B1A,
+  0x8008, 0x0AFA, 0x0004, 0x0B1A, 0x0AFA, 0x0AFA, 0x0B1A, 0x8003, 0x0AFA, 0x0006, 0x0B1A, 0x0AF9, 0x0AFA, 0x0B5A, 0x0C7B, 0x0C1A,
+  0x8003, 0x0AFA, 0x0001, 0x0AF9, 0x8006, 0x0AFA, 0x8004, 0x0158, 0x0001, 0x0138, 0x8003, 0x0158, 0x0005, 0x0138, 0x0238, 0x03B9,
+  0x03DA, 0x0259, 0x8018, 0x0158, 0x000D, 0x0138, 0x0178, 0x0158, 0x0158, 0x0159, 0x01B9, 0x037A, 0x0BDA, 0x0218, 0x0958, 0x0159,
+  0x0159, 0x0958, 0x8004, 0x0158, 0x0006, 0x0958, 0x0959, 0x0158, 0x0159, 0x0179, 0x0158, 0x8004, 0x0159, 0x8004, 0x0158, 0x0010,
+  0x0979, 0x0179, 0x0958, 0x0979, 0x0159, 0x0178, 0x0159, 0x0958, 0x033A, 0x041A, 0x01F9, 0x0959, 0x0179, 0x0958, 0x0959, 0x0158,
+  0x8004, 0x0159, 0x8004, 0x0979, 0x8008, 0x0179, 0x0004, 0x0979, 0x0979, 0x0959, 0x0959, 0x8005, 0x0979, 0x0006, 0x0A79, 0x043A,
+  0x0199, 0x0959, 0x0179, 0x0179, 0x8011, 0x0979, 0x8008, 0x0179, 0x0008, 0x0979, 0x0179, 0x09B9, 0x0C3B, 0x0179, 0x0979, 0x0179,
+  0x0179, 0x8019, 0x0979, 0x0008, 0x0179, 0x0979, 0x0179, 0x0C7A, 0x0979, 0x0179, 0x0979, 0x0179, 0x8019, 0x0979, 0x0008, 0x0179,
+  0x0179, 0x0979, 0x0179, 0x0C3B, 0x09B9, 0x0179, 0x0979, 0x8008, 0x0179, 0x8011, 0x0979, 0x0006, 0x0179, 0x0179, 0x0959, 0x0199,
+  0x043A, 0x0A79, 0x8005, 0x0979, 0x0004, 0x0959, 0x0959, 0x0979, 0x0979, 0x8008, 0x0179, 0x8004, 0x0979, 0x8004, 0x0159, 0x0010,
+  0x0158, 0x0959, 0x0958, 0x0179, 0x0959, 0x01F9, 0x041A, 0x033A, 0x0958, 0x0159, 0x0178, 0x0159, 0x0979, 0x0958, 0x0179, 0x0979,
+  0x8004, 0x0158, 0x8004, 0x0159, 0x0006, 0x0158, 0x0179, 0x0159, 0x0158, 0x0959, 0x0958, 0x8004, 0x0158, 0x000D, 0x0958, 0x0159,
+  0x0159, 0x0958, 0x0218, 0x0BDA, 0x037A, 0x01B9, 0x0159, 0x0158, 0x0158, 0x0178, 0x0138, 0x8003, 0x0158, 0x8005, 0x0137, 0x000C,
+  0x0138, 0x0137, 0x01D8, 0x0339, 0x0399, 0x0238, 0x0137, 0x0137, 0x0138, 0x0138, 0x0137, 0x0137, 0x8005, 0x0138, 0x0005, 0x0137,
+  0x0137, 0x0138, 0x0138, 0x0137, 0x800C, 0x0138, 0x000D, 0x0157, 0x0138, 0x0278, 0x03D9, 0x02B9, 0x0178, 0x0158, 0x0138, 0x0138,
+  0x0158, 0x0138, 0x0137, 0x0137, 0x8005, 0x0138, 0x0002, 0x0137, 0x0158, 0x8006, 0x0138, 0x8003, 0x0158, 0x0003, 0x0138, 0x0138,
+  0x0938, 0x8003, 0x0158, 0x0004, 0x0178, 0x0339, 0x0399, 0x0178, 0x801E, 0x0158, 0x0003, 0x01D9, 0x03F9, 0x01F9, 0x801F, 0x0158,
+  0x0002, 0x02D9, 0x0319, 0x8003, 0x0158, 0x0001, 0x0159, 0x8018, 0x0158, 0x000A, 0x0959, 0x0158, 0x0158, 0x0159, 0x041A, 0x0959,
+  0x0159, 0x0158, 0x0158, 0x0959, 0x8018, 0x0158, 0x0001, 0x0159, 0x8003, 0x0158, 0x0002, 0x0319, 0x02D9, 0x801F, 0x0158, 0x0003,
+  0x01F9, 0x03F9, 0x01D9, 0x801E, 0x0158, 0x0004, 0x0178, 0x0399, 0x0339, 0x0178, 0x8003, 0x0158, 0x0003, 0x0938, 0x0138, 0x0138,
+  0x8003, 0x0158, 0x8006, 0x0138, 0x0002, 0x0158, 0x0137, 0x8005, 0x0138, 0x000D, 0x0137, 0x0137, 0x0138, 0x0158, 0x0138, 0x0138,
+  0x0158, 0x0178, 0x02B9, 0x03D9, 0x0278, 0x0138, 0x0157, 0x8005, 0x0138, 0x8005, 0x0117, 0x0004, 0x01D7, 0x0318, 0x0379, 0x0238,
+  0x800B, 0x0117, 0x0001, 0x0137, 0x8006, 0x0117, 0x0001, 0x0137, 0x8008, 0x0117, 0x0013, 0x0137, 0x0117, 0x0117, 0x0177, 0x0318,
+  0x0379, 0x01D7, 0x0137, 0x0117, 0x0137, 0x0117, 0x0137, 0x0136, 0x0117, 0x0117, 0x0137, 0x0137, 0x0117, 0x0117, 0x8003, 0x0137,
+  0x0001, 0x0117, 0x8003, 0x0137, 0x8003, 0x0117, 0x8005, 0x0137, 0x000C, 0x0138, 0x0137, 0x0117, 0x0157, 0x0359, 0x02F8, 0x0157,
+  0x0117, 0x0137, 0x0117, 0x0137, 0x0117, 0x8003, 0x0137, 0x800F, 0x0138, 0x8007, 0x0137, 0x0009, 0x0158, 0x0359, 0x0278, 0x0137,
+  0x0138, 0x0137, 0x0138, 0x0138, 0x0137, 0x8018, 0x0138, 0x0008, 0x0137, 0x0138, 0x03B9, 0x01B8, 0x0137, 0x0138, 0x0138, 0x0137,
+  0x8018, 0x0138, 0x8003, 0x0137, 0x0004, 0x0138, 0x03F9, 0x0137, 0x0138, 0x8003, 0x0137, 0x8018, 0x0138, 0x0008, 0x0137, 0x0138,
+  0x0138, 0x0137, 0x01B8, 0x03B9, 0x0138, 0x0137, 0x8018, 0x0138, 0x0009, 0x0137, 0x0138, 0x0138, 0x0137, 0x0138, 0x0137, 0x0278,
+  0x0359, 0x0158, 0x8007, 0x0137, 0x800F, 0x0138, 0x8003, 0x0137, 0x000C, 0x0117, 0x0137, 0x0117, 0x0137, 0x0117, 0x0157, 0x02F8,
+  0x0359, 0x0157, 0x0117, 0x0137, 0x0138, 0x8005, 0x0137, 0x8003, 0x0117, 0x8003, 0x0137, 0x0001, 0x0117, 0x8003, 0x0137, 0x0015,
+  0x0117, 0x0117, 0x0137, 0x0137, 0x0117, 0x0117, 0x0136, 0x0137, 0x0117, 0x0137, 0x0117, 0x0137, 0x01D7, 0x0379, 0x0318, 0x0177,
+  0x0117, 0x0117, 0x0137, 0x0117, 0x0117, 0x0008, 0x02D8, 0x02D8, 0x02D7, 0x02D7, 0x02F7, 0x0358, 0x0378, 0x02F7, 0x8003, 0x02D8,
+  0x8006, 0x02D7, 0x800E, 0x02D8, 0x8005, 0x02F8, 0x0007, 0x02D7, 0x02F8, 0x02F8, 0x0398, 0x0378, 0x02F8, 0x02D8, 0x801E, 0x02F8,
+  0x0002, 0x0378, 0x0398, 0x8019, 0x02F8, 0x0010, 0x0318, 0x02F8, 0x0318, 0x02F7, 0x02F8, 0x02F8, 0x0318, 0x0358, 0x0399, 0x0318,
+  0x02F8, 0x02F8, 0x0318, 0x0318, 0x02F8, 0x0318, 0x8008, 0x02F8, 0x8011, 0x0318, 0x0005, 0x0338, 0x03B8, 0x0318, 0x0318, 0x02F8,
+  0x801E, 0x0318, 0x0001, 0x03B8, 0x801F, 0x0318, 0x0005, 0x02F8, 0x0318, 0x0318, 0x03B8, 0x0338, 0x8011, 0x0318, 0x8008, 0x02F8,
+  0x0010, 0x0318, 0x02F8, 0x0318, 0x0318, 0x02F8, 0x02F8, 0x0318, 0x0399, 0x0358, 0x0318, 0x02F8, 0x02F8, 0x02F7, 0x0318, 0x02F8,
+  0x0318, 0x8019, 0x02F8, 0x0002, 0x0398, 0x0378, 0x801E, 0x02F8, 0x0009, 0x02D8, 0x02F8, 0x0378, 0x0398, 0x02F8, 0x02F8, 0x02D7,
+  0x02F8, 0x02F8, 0x0007, 0x0176, 0x01B6, 0x02F8, 0x0317, 0x0217, 0x0196, 0x0176, 0x8004, 0x0196, 0x0001, 0x0176, 0x8011, 0x0196,
+  0x0001, 0x0176, 0x8006, 0x0196, 0x0008, 0x01F7, 0x0337, 0x02D7, 0x01B6, 0x0197, 0x0196, 0x0196, 0x0176, 0x8012, 0x0196, 0x0001,
+  0x0197, 0x8008, 0x0196, 0x0003, 0x0237, 0x0358, 0x0217, 0x800A, 0x0196, 0x8010, 0x0197, 0x000A, 0x0196, 0x0196, 0x0197, 0x0197,
+  0x0196, 0x0196, 0x0277, 0x0318, 0x01B6, 0x0196, 0x8016, 0x0197, 0x0001, 0x01B7, 0x8007, 0x0197, 0x0007, 0x01B6, 0x02F7, 0x0257,
+  0x0197, 0x01B6, 0x01B7, 0x01B6, 0x801A, 0x0197, 0x0008, 0x01B7, 0x01B6, 0x01B7, 0x0378, 0x01B7, 0x01B7, 0x01B6, 0x01B7, 0x801A,
+  0x0197, 0x0007, 0x01B6, 0x01B7, 0x01B6, 0x0197, 0x0257, 0x02F7, 0x01B6, 0x8007, 0x0197, 0x0001, 0x01B7, 0x8016, 0x0197, 0x000A,
+  0x0196, 0x01B6, 0x0318, 0x0277, 0x0196, 0x0196, 0x0197, 0x0197, 0x0196, 0x0196, 0x8010, 0x0197, 0x800A, 0x0196, 0x0003, 0x0217,
+  0x0358, 0x0237, 0x8008, 0x0196, 0x0001, 0x0197, 0x8012, 0x0196, 0x000A, 0x0176, 0x0196, 0x0196, 0x0197, 0x01B6, 0x02D7, 0x0337,
+  0x01F7, 0x0196, 0x0196, 0x0004, 0x0236, 0x0317, 0x0256, 0x00F4, 0x8018, 0x00D5, 0x000B, 0x00F5, 0x00F5, 0x00D5, 0x00F5, 0x00D5,
+  0x00D5, 0x00F5, 0x01F6, 0x0317, 0x01F6, 0x00F5, 0x8004, 0x00D5, 0x0001, 0x00F5, 0x8011, 0x00D5, 0x0002, 0x00F5, 0x00F5, 0x8004,
+  0x00D5, 0x0006, 0x00F5, 0x00D5, 0x00F5, 0x01B6, 0x0337, 0x01B6, 0x8020, 0x00F5, 0x0005, 0x0155, 0x0337, 0x0156, 0x00D5, 0x00D5,
+  0x8003, 0x00F6, 0x0003, 0x00F5, 0x00D6, 0x00D6, 0x8008, 0x00F6, 0x8008, 0x00F5, 0x0004, 0x00F6, 0x00D5, 0x00F6, 0x00F6, 0x8003,
+  0x00F5, 0x0009, 0x00F6, 0x0115, 0x0338, 0x0115, 0x00F6, 0x00F5, 0x00F6, 0x00F5, 0x00D6, 0x8018, 0x00F5, 0x000A, 0x00D5, 0x00F6,
+  0x00D5, 0x00F5, 0x0357, 0x00F5, 0x00F5, 0x00D5, 0x00F6, 0x00D5, 0x8018, 0x00F5, 0x0009, 0x00D6, 0x00F5, 0x00F6, 0x00F5, 0x00F6,
+  0x0115, 0x0338, 0x0115, 0x00F6, 0x8003, 0x00F5, 0x0004, 0x00F6, 0x00F6, 0x00D5, 0x00F6, 0x8008, 0x00F5, 0x8008, 0x00F6, 0x0003,
+  0x00D6, 0x00D6, 0x00F5, 0x8003, 0x00F6, 0x0005, 0x00D5, 0x00D5, 0x0156, 0x0337, 0x0155, 0x8020, 0x00F5, 0x0006, 0x01B6, 0x0337,
+  0x01B6, 0x00F5, 0x00D5, 0x00F5, 0x8004, 0x00D5, 0x0002, 0x00F5, 0x00F5, 0x8011, 0x00D5, 0x0001, 0x00F5, 0x8004, 0x00D5, 0x0005,
+  0x00F5, 0x01F6, 0x0317, 0x01F6, 0x00F5, 0x0004, 0x01F4, 0x0113, 0x00B3, 0x00D3, 0x8007, 0x00B3, 0x0001, 0x00D3, 0x8009, 0x00B3,
+  0x0017, 0x00D3, 0x00B3, 0x00D3, 0x00D4, 0x00B3, 0x00B3, 0x00D4, 0x00B3, 0x00B3, 0x00D4, 0x00B3, 0x00D3, 0x0133, 0x0275, 0x0255,
+  0x0134, 0x00D3, 0x00B3, 0x00D3, 0x00D3, 0x00D4, 0x00D4, 0x00B4, 0x8012, 0x00D4, 0x000C, 0x00B4, 0x00D4, 0x00B4, 0x00D4, 0x00D4,
+  0x00B4, 0x00B4, 0x01D4, 0x02B5, 0x0134, 0x00D4, 0x00B4, 0x801E, 0x00D4, 0x0003, 0x00F4, 0x02B5, 0x01B5, 0x8021, 0x00D4, 0x0004,
+  0x01B5, 0x0255, 0x00D5, 0x00B4, 0x8020, 0x00D4, 0x0001, 0x02F6, 0x8021, 0x00D4, 0x0004, 0x00B4, 0x00D5, 0x0255, 0x01B5, 0x8021,
+  0x00D4, 0x0003, 0x01B5, 0x02B5, 0x00F4, 0x801E, 0x00D4, 0x000C, 0x00B4, 0x00D4, 0x0134, 0x02B5, 0x01D4, 0x00B4, 0x00B4, 0x00D4,
+  0x00D4, 0x00B4, 0x00D4, 0x00B4, 0x8012, 0x00D4, 0x000A, 0x00B4, 0x00D4, 0x00D4, 0x00D3, 0x00D3, 0x00B3, 0x00D3, 0x0134, 0x0255,
+  0x0275, 0x0001, 0x00B1, 0x8003, 0x0091, 0x0005, 0x00B1, 0x0091, 0x00B1, 0x00B1, 0x0091, 0x8014, 0x00B1, 0x000F, 0x0091, 0x0091,
+  0x00D2, 0x01B2, 0x0273, 0x0172, 0x00B1, 0x00B2, 0x00B1, 0x00B1, 0x00B2, 0x00B1, 0x00B1, 0x00B2, 0x00B1, 0x8010, 0x00B2, 0x0005,
+  0x00B1, 0x00B1, 0x00B2, 0x00B2, 0x00B1, 0x8003, 0x00B2, 0x0003, 0x01D3, 0x0253, 0x0112, 0x8021, 0x00B2, 0x0003, 0x0213, 0x01D3,
+  0x0092, 0x8021, 0x00B2, 0x0002, 0x0253, 0x0153, 0x8022, 0x00B2, 0x0001, 0x0294, 0x8023, 0x00B2, 0x0002, 0x0153, 0x0253, 0x8021,
+  0x00B2, 0x0003, 0x0092, 0x01D3, 0x0213, 0x8021, 0x00B2, 0x0003, 0x0112, 0x0253, 0x01D3, 0x8003, 0x00B2, 0x0005, 0x00B1, 0x00B2,
+  0x00B2, 0x00B1, 0x00B1, 0x8010, 0x00B2, 0x000A, 0x00B1, 0x00B2, 0x00B1, 0x00B1, 0x00B2, 0x00B1, 0x00B1, 0x00B2, 0x00B1, 0x0172,
+  0x0002, 0x0090, 0x0070, 0x801C, 0x0090, 0x0004, 0x0111, 0x0212, 0x01D1, 0x00D0, 0x8020, 0x0090, 0x0004, 0x00B0, 0x01D2, 0x01F2,
+  0x00B0, 0x801F, 0x0090, 0x0005, 0x00B0, 0x00B0, 0x0171, 0x0212, 0x00B0, 0x8006, 0x0090, 0x0004, 0x00B0, 0x00B0, 0x0090, 0x0090,
+  0x8010, 0x00B0, 0x8003, 0x0090, 0x000D, 0x00B0, 0x00B0, 0x0090, 0x0090, 0x00F1, 0x0252, 0x00B0, 0x0090, 0x00B0, 0x0090, 0x0090,
+  0x00B0, 0x00B0, 0x8018, 0x0090, 0x000A, 0x00B0, 0x00B0, 0x0090, 0x0090, 0x0272, 0x00B0, 0x0090, 0x0090, 0x00B0, 0x00B0, 0x8018,
+  0x0090, 0x000D, 0x00B0, 0x00B0, 0x0090, 0x0090, 0x00B0, 0x0090, 0x00B0, 0x0252, 0x00F1, 0x0090, 0x0090, 0x00B0, 0x00B0, 0x8003,
+  0x0090, 0x8010, 0x00B0, 0x0004, 0x0090, 0x0090, 0x00B0, 0x00B0, 0x8006, 0x0090, 0x0005, 0x00B0, 0x0212, 0x0171, 0x00B0, 0x00B0,
+  0x801F, 0x0090, 0x0004, 0x00B0, 0x01F2, 0x01D2, 0x00B0, 0x8020, 0x0090, 0x800B, 0x0090, 0x0001, 0x008F, 0x8010, 0x0090, 0x0004,
+  0x00B0, 0x0191, 0x0232, 0x0151, 0x800A, 0x0090, 0x0001, 0x00B0, 0x8016, 0x0090, 0x0004, 0x00B0, 0x01F2, 0x01D1, 0x00B0, 0x8021,
+  0x0090, 0x0003, 0x0110, 0x0252, 0x00D0, 0x8022, 0x0090, 0x0002, 0x01B1, 0x0191, 0x8020, 0x0090, 0x0004, 0x00B0, 0x0090, 0x0090,
+  0x0252, 0x8003, 0x0090, 0x0001, 0x00B0, 0x8020, 0x0090, 0x0002, 0x0191, 0x01B1, 0x8022, 0x0090, 0x0003, 0x00D0, 0x0252, 0x0110,
+  0x8021, 0x0090, 0x0004, 0x00B0, 0x01D1, 0x01F2, 0x00B0, 0x8016, 0x0090, 0x0001, 0x00B0, 0x8008, 0x0090, 0x8003, 0x008F, 0x8003,
+  0x0090, 0x8005, 0x008F, 0x8009, 0x0090, 0x0003, 0x008F, 0x008F, 0x0090, 0x8004, 0x008F, 0x0007, 0x00D0, 0x0212, 0x01D2, 0x00D0,
+  0x0090, 0x008F, 0x0090, 0x8007, 0x008F, 0x0003, 0x0090, 0x008F, 0x008F, 0x8011, 0x0090, 0x0006, 0x008F, 0x0090, 0x0090, 0x00F0,
+  0x0232, 0x01B1, 0x8004, 0x0090, 0x0002, 0x008F, 0x008F, 0x801D, 0x0090, 0x0002, 0x0232, 0x0130, 0x8022, 0x0090, 0x0003, 0x00B0,
+  0x0232, 0x00D0, 0x8005, 0x0090, 0x0002, 0x008F, 0x008F, 0x801C, 0x0090, 0x0001, 0x0252, 0x801D, 0x0090, 0x0002, 0x008F, 0x008F,
+  0x8005, 0x0090, 0x0003, 0x00D0, 0x0232, 0x00B0, 0x8022, 0x0090, 0x0002, 0x0130, 0x0232, 0x801D, 0x0090, 0x0002, 0x008F, 0x008F,
+  0x8004, 0x0090, 0x0006, 0x01B1, 0x0232, 0x00F0, 0x0090, 0x0090, 0x008F, 0x8011, 0x0090, 0x0003, 0x008F, 0x008F, 0x0090, 0x8007,
+  0x008F, 0x8010, 0x008F, 0x0001, 0x006F, 0x8004, 0x008F, 0x0001, 0x006F, 0x8004, 0x008F, 0x0008, 0x0171, 0x0232, 0x0151, 0x008F,
+  0x006F, 0x008F, 0x008F, 0x006F, 0x8014, 0x008F, 0x0002, 0x0070, 0x0090, 0x8004, 0x008F, 0x0007, 0x006F, 0x008F, 0x006F, 0x00F0,
+  0x0212, 0x0151, 0x006F, 0x8011, 0x008F, 0x8008, 0x0090, 0x0003, 0x008F, 0x008F, 0x0090, 0x8004, 0x008F, 0x0007, 0x0070, 0x0090,
+  0x01F1, 0x01B1, 0x0070, 0x008F, 0x008F, 0x801A, 0x0090, 0x8003, 0x008F, 0x0005, 0x0090, 0x008F, 0x008F, 0x0130, 0x01F1, 0x8004,
+  0x0090, 0x8020, 0x008F, 0x0001, 0x0252, 0x8021, 0x008F, 0x8004, 0x0090, 0x0005, 0x01F1, 0x0130, 0x008F, 0x008F, 0x0090, 0x8003,
+  0x008F, 0x801A, 0x0090, 0x0007, 0x008F, 0x008F, 0x0070, 0x01B1, 0x01F1, 0x0090, 0x0070, 0x8004, 0x008F, 0x0003, 0x0090, 0x008F,
+  0x008F, 0x8008, 0x0090, 0x8011, 0x008F, 0x0007, 0x006F, 0x0151, 0x0212, 0x00F0, 0x006F, 0x008F, 0x006F, 0x8004, 0x008F, 0x0002,
+  0x0090, 0x0070, 0x8014, 0x008F, 0x800E, 0x008F, 0x8006, 0x006F, 0x0008, 0x0070, 0x008F, 0x006F, 0x008F, 0x0110, 0x0232, 0x01B1,
+  0x00AF, 0x8005, 0x008F, 0x0001, 0x006F, 0x8013, 0x008F, 0x0003, 0x006F, 0x008F, 0x006F, 0x8005, 0x008F, 0x0006, 0x006F, 0x0110,
+  0x0252, 0x0130, 0x008F, 0x006F, 0x8020, 0x008F, 0x0003, 0x006F, 0x0170, 0x01F2, 0x8021, 0x008F, 0x0005, 0x006F, 0x008F, 0x008F,
+  0x01D2, 0x0130, 0x8021, 0x008F, 0x0004, 0x006F, 0x008F, 0x008F, 0x0252, 0x8003, 0x008F, 0x0001, 0x006F, 0x8021, 0x008F, 0x0005,
+  0x0130, 0x01D2, 0x008F, 0x008F, 0x006F, 0x8021, 0x008F, 0x0003, 0x01F2, 0x0170, 0x006F, 0x8020, 0x008F, 0x0006, 0x006F, 0x008F,
+  0x0130, 0x0252, 0x0110, 0x006F, 0x8005, 0x008F, 0x0003, 0x006F, 0x008F, 0x006F, 0x8013, 0x008F, 0x800C, 0x006F, 0x0002, 0x008F,
+  0x008F, 0x8003, 0x006F, 0x0001, 0x008F, 0x8004, 0x006F, 0x0005, 0x008F, 0x01B1, 0x0232, 0x010F, 0x008F, 0x8004, 0x006F, 0x0002,
+  0x008F, 0x008F, 0x8014, 0x006F, 0x0002, 0x008F, 0x008F, 0x8006, 0x006F, 0x0006, 0x0150, 0x0232, 0x00CF, 0x006F, 0x006F, 0x008E,
+  0x801E, 0x006F, 0x0007, 0x008F, 0x006F, 0x010F, 0x0212, 0x00AF, 0x006F, 0x008F, 0x801C, 0x006F, 0x0008, 0x008F, 0x008F, 0x006F,
+  0x006F, 0x008F, 0x00AF, 0x0212, 0x00AF, 0x8020, 0x006F, 0x0005, 0x008F, 0x008F, 0x006F, 0x006F, 0x0252, 0x8003, 0x006F, 0x0002,
+  0x008F, 0x008F, 0x8020, 0x006F, 0x0008, 0x00AF, 0x0212, 0x00AF, 0x008F, 0x006F, 0x006F, 0x008F, 0x008F, 0x801C, 0x006F, 0x0007,
+  0x008F, 0x006F, 0x00AF, 0x0212, 0x010F, 0x006F, 0x008F, 0x801E, 0x006F, 0x0006, 0x008E, 0x006F, 0x006F, 0x00CF, 0x0232, 0x0150,
+  0x8006, 0x006F, 0x0002, 0x008F, 0x008F, 0x8013, 0x006F, 0x8014, 0x006E, 0x000B, 0x008E, 0x0110, 0x0212, 0x01B1, 0x008F, 0x006F,
+  0x006E, 0x006F, 0x006F, 0x006E, 0x008F, 0x8003, 0x006E, 0x0002, 0x006F, 0x006F, 0x8010, 0x006E, 0x0010, 0x006F, 0x008F, 0x006E,
+  0x006E, 0x006F, 0x006F, 0x008E, 0x006E, 0x0191, 0x01F1, 0x00CF, 0x006F, 0x006F, 0x006E, 0x008F, 0x006E, 0x8019, 0x006F, 0x000E,
+  0x008F, 0x008F, 0x006E, 0x006E, 0x006F, 0x00CF, 0x0212, 0x0110, 0x008F, 0x006F, 0x006E, 0x008F, 0x006F, 0x006E, 0x801E, 0x006F,
+  0x0002, 0x0150, 0x0191, 0x8025, 0x006F, 0x0001, 0x0232, 0x8026, 0x006F, 0x0002, 0x0191, 0x0150, 0x801E, 0x006F, 0x000E, 0x006E,
+  0x006F, 0x008F, 0x006E, 0x006F, 0x008F, 0x0110, 0x0212, 0x00CF, 0x006F, 0x006E, 0x006E, 0x008F, 0x008F, 0x8019, 0x006F, 0x0010,
+  0x006E, 0x008F, 0x006E, 0x006F, 0x006F, 0x00CF, 0x01F1, 0x0191, 0x006E, 0x008E, 0x006F, 0x006F, 0x006E, 0x006E, 0x008F, 0x006F,
+  0x8010, 0x006E, 0x0002, 0x006F, 0x006F, 0x8013, 0x006E, 0x0004, 0x008E, 0x01B1, 0x0212, 0x00EF, 0x8003, 0x006E, 0x0001, 0x006F,
+  0x801C, 0x006E, 0x0008, 0x006F, 0x006E, 0x006E, 0x008E, 0x01D1, 0x01F1, 0x008F, 0x006F, 0x8022, 0x006E, 0x0004, 0x00AE, 0x01F1,
+  0x0170, 0x006F, 0x8003, 0x006E, 0x0004, 0x006F, 0x006E, 0x006E, 0x006F, 0x801D, 0x006E, 0x0003, 0x0211, 0x00CF, 0x008F, 0x8024,
+  0x006E, 0x0001, 0x0232, 0x8025, 0x006E, 0x0003, 0x008F, 0x00CF, 0x0211, 0x801D, 0x006E, 0x0004, 0x006F, 0x006E, 0x006E, 0x006F,
+  0x8003, 0x006E, 0x0004, 0x006F, 0x0170, 0x01F1, 0x00AE, 0x8022, 0x006E, 0x0008, 0x006F, 0x008F, 0x01F1, 0x01D1, 0x008E, 0x006E,
+  0x006E, 0x006F, 0x8015, 0x006E, 0x8012, 0x006E, 0x0004, 0x0130, 0x0212, 0x0170, 0x008E, 0x8005, 0x006E, 0x0001, 0x004E, 0x801D,
+  0x006E, 0x0004, 0x00AF, 0x01D1, 0x0190, 0x008E, 0x8024, 0x006E, 0x0002, 0x0190, 0x01F1, 0x8025, 0x006E, 0x0002, 0x00EF, 0x0211,
+  0x8026, 0x006E, 0x0001, 0x0232, 0x8027, 0x006E, 0x0002, 0x0211, 0x00EF, 0x8025, 0x006E, 0x0002, 0x01F1, 0x0190, 0x8024, 0x006E,
+  0x0004, 0x008E, 0x0190, 0x01D1, 0x00AF, 0x8017, 0x006E, 0x8010, 0x006E, 0x0004, 0x008E, 0x01B1, 0x01F2, 0x00CF, 0x8024, 0x006E,
+  0x0006, 0x00AF, 0x0212, 0x0191, 0x006E, 0x006E, 0x004E, 0x8003, 0x006E, 0x0002, 0x004E, 0x008E, 0x801D, 0x006E, 0x0006, 0x010F,
+  0x0212, 0x008E, 0x006E, 0x006E, 0x004E, 0x8022, 0x006E, 0x0002, 0x0190, 0x0150, 0x8026, 0x006E, 0x0001, 0x0232, 0x8027, 0x006E,
+  0x0002, 0x0150, 0x0190, 0x8022, 0x006E, 0x0006, 0x004E, 0x006E, 0x006E, 0x008E, 0x0212, 0x010F, 0x801D, 0x006E, 0x0002, 0x008E,
+  0x004E, 0x8003, 0x006E, 0x0006, 0x004E, 0x006E, 0x006E, 0x0191, 0x0212, 0x00AF, 0x8016, 0x006E, 0x800C, 0x006E, 0x0008, 0x004E,
+  0x004E, 0x004D, 0x0130, 0x01F2, 0x0150, 0x006D, 0x006D, 0x8005, 0x006E, 0x0001, 0x004E, 0x801C, 0x006E, 0x0007, 0x004E, 0x00EF,
+  0x0212, 0x010F, 0x004E, 0x006E, 0x004E, 0x8005, 0x006E, 0x0001, 0x004E, 0x801A, 0x006E, 0x0009, 0x004E, 0x004E, 0x00AF, 0x0212,
+  0x00CF, 0x004E, 0x006E, 0x004E, 0x004E, 0x8003, 0x006E, 0x0001, 0x004E, 0x801B, 0x006E, 0x0006, 0x004E, 0x006E, 0x008E, 0x0232,
+  0x008E, 0x004E, 0x8025, 0x006E, 0x0001, 0x0232, 0x8026, 0x006E, 0x0006, 0x004E, 0x008E, 0x0232, 0x008E, 0x006E, 0x004E, 0x801B,
+  0x006E, 0x0001, 0x004E, 0x8003, 0x006E, 0x0009, 0x004E, 0x004E, 0x006E, 0x004E, 0x00CF, 0x0212, 0x00AF, 0x004E, 0x004E, 0x801A,
+  0x006E, 0x0001, 0x004E, 0x8005, 0x006E, 0x0007, 0x004E, 0x006E, 0x004E, 0x010F, 0x0212, 0x00EF, 0x004E, 0x8014, 0x006E, 0x8004,
+  0x004D, 0x0010, 0x006E, 0x006D, 0x004D, 0x004D, 0x004E, 0x004D, 0x004D, 0x006D, 0x006D, 0x008E, 0x01B1, 0x01D1, 0x00CE, 0x006D,
+  0x004D, 0x004D, 0x801B, 0x006D, 0x000D, 0x004D, 0x006E, 0x004D, 0x006E, 0x006E, 0x004E, 0x006D, 0x010F, 0x0212, 0x00EF, 0x006D,
+  0x006E, 0x006E, 0x8008, 0x006D, 0x8008, 0x004D, 0x800A, 0x006E, 0x0002, 0x004D, 0x006D, 0x8003, 0x006E, 0x0006, 0x004D, 0x006E,
+  0x004D, 0x006E, 0x01D1, 0x0150, 0x8025, 0x006E, 0x0006, 0x004E, 0x0130, 0x0191, 0x006E, 0x006E, 0x004E, 0x8023, 0x006E, 0x0004,
+  0x004E, 0x0232, 0x004E, 0x004E, 0x8023, 0x006E, 0x0006, 0x004E, 0x006E, 0x006E, 0x0191, 0x0130, 0x004E, 0x8025, 0x006E, 0x0006,
+  0x0150, 0x01D1, 0x006E, 0x004D, 0x006E, 0x004D, 0x8003, 0x006E, 0x0002, 0x006D, 0x004D, 0x800A, 0x006E, 0x8008, 0x004D, 0x8008,
+  0x006D, 0x000D, 0x006E, 0x006E, 0x006D, 0x00EF, 0x0212, 0x010F, 0x006D, 0x004E, 0x006E, 0x006E, 0x004D, 0x006E, 0x004D, 0x800D,
+  0x006D, 0x8008, 0x004D, 0x0001, 0x006D, 0x8003, 0x004D, 0x0004, 0x0150, 0x01F1, 0x0150, 0x006D, 0x801F, 0x004D, 0x0003, 0x006D,
+  0x004D, 0x004E, 0x8003, 0x004D, 0x0004, 0x0150, 0x01F1, 0x00AE, 0x006D, 0x8003, 0x004D, 0x8019, 0x006D, 0x0006, 0x004D, 0x006D,
+  0x006D, 0x004D, 0x006D, 0x004D, 0x8003, 0x006D, 0x0005, 0x0170, 0x01B1, 0x006D, 0x006D, 0x004D, 0x8009, 0x006D, 0x8018, 0x006E,
+  0x0007, 0x006D, 0x004E, 0x006E, 0x01D1, 0x010F, 0x006D, 0x006D, 0x8021, 0x006E, 0x000A, 0x004D, 0x006D, 0x006E, 0x004E, 0x0212,
+  0x004D, 0x004E, 0x006E, 0x006D, 0x004D, 0x8021, 0x006E, 0x0007, 0x006D, 0x006D, 0x010F, 0x01D1, 0x006E, 0x004E, 0x006D, 0x8018,
+  0x006E, 0x8009, 0x006D, 0x0005, 0x004D, 0x006D, 0x006D, 0x01B1, 0x0170, 0x8003, 0x006D, 0x0006, 0x004D, 0x006D, 0x004D, 0x006D,
+  0x006D, 0x004D, 0x8019, 0x006D, 0x8003, 0x004D, 0x0004, 0x006D, 0x00AE, 0x01F1, 0x0150, 0x8003, 0x004D, 0x0003, 0x004E, 0x004D,
+  0x006D, 0x800D, 0x004D,
+};
+
+#endif // HAS_GRAPHICAL_TFT && TFT_IMAGE_RLE
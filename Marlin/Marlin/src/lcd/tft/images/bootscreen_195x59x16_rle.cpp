@@ -0,0 +1,457 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+// Generated by buildroot/share/scripts/rle16-tft-image.py. Do not edit.
+
+#include "../../../inc/MarlinConfigPre.h"
+
+#if HAS_GRAPHICAL_TFT && ENABLED(TFT_IMAGE_RLE)
+
+extern const uint16_t marlin_logo_195x59x16_rle[6791] = {
+  0x8003, 0x18AD, 0x0001, 0x18AE, 0x8003, 0x18AD, 0x0005, 0x20AD, 0x18AD, 0x310E, 0x7A32, 0xAAD3, 0x8003, 0xD395, 0x0001, 0xD375,
+  0x8004, 0xD395, 0x0001, 0xD396, 0x8080, 0xD395, 0x0001, 0xD396, 0x800C, 0xD395, 0x0002, 0xD375, 0xD396, 0x8013, 0xD395, 0x0001,
+  0xD396, 0x800B, 0xD395, 0x8003, 0x18AD, 0x0006, 0x20AD, 0x18AE, 0x20AD, 0x18AD, 0x496F, 0xAAD3, 0x8007, 0xD395, 0x0001, 0xD375,
+  0x8083, 0xD395, 0x0001, 0xD396, 0x8009, 0xD395, 0x0001, 0xD396, 0x8004, 0xD395, 0x0001, 0xD375, 0x801F, 0xD395, 0x0002, 0x18AD,
+  0x20AB, 0x8003, 0x18AD, 0x0003, 0x20EE, 0x8252, 0xD396, 0x800B, 0xD395, 0x0001, 0xD3B5, 0x808E, 0xD395, 0x0001, 0xDB95, 0x8016,
+  0xD395, 0x0001, 0xD396, 0x8009, 0xD395, 0x0006, 0x18AD, 0x20AD, 0x18AD, 0x18AD, 0x28EE, 0xB314, 0x8005, 0xD395, 0x000A, 0xD4F8,
+  0xD65C, 0xD6DD, 0xD6FD, 0xD7FF, 0xD7FF, 0xDFFF, 0xD7FF, 0xD7FF, 0xDFFF, 0x807B, 0xD7FF, 0x8007, 0xDFFF, 0x8007, 0xD7FF, 0x0002,
+  0xDFFF, 0xD539, 0x801A, 0xD395, 0x0001, 0xDB95, 0x8005, 0xD395, 0x0003, 0xD396, 0xD395, 0xD395, 0x000B, 0x18AD, 0x20AD, 0x18AE,
+  0x28EE, 0xCB55, 0xD375, 0xD395, 0xD395, 0xD3D6, 0xD5DB, 0xD7BF, 0x8085, 0xD7FF, 0x8003, 0xDFFF, 0x0001, 0xD7FF, 0x8005, 0xDFFF,
+  0x8006, 0xD7FF, 0x0002, 0xDFFF, 0xD539, 0x8022, 0xD395, 0x0004, 0x18AD, 0x18AD, 0x28EE, 0xB314, 0x8003, 0xD395, 0x0005, 0xD477,
+  0xD77E, 0xD7FF, 0xD7FF, 0xDFFF, 0x8004, 0xD7FF, 0x0001, 0xDFFF, 0x807F, 0xD7FF, 0x8004, 0xDFFF, 0x0002, 0xD7FF, 0xDFFF, 0x800B,
+  0xD7FF, 0x0001, 0xD539, 0x8021, 0xD395, 0x0008, 0x18AD, 0x18CD, 0x8252, 0xD395, 0xD395, 0xD396, 0xD4B8, 0xD7BF, 0x8089, 0xD7FF,
+  0x0005, 0xDFFF, 0xDFFF, 0xD7FF, 0xD7FF, 0xDFFF, 0x8009, 0xD7FF, 0x0004, 0xDFFF, 0xD7FF, 0xDFFF, 0xD539, 0x8015, 0xD395, 0x0002,
+  0xD396, 0xD396, 0x8009, 0xD395, 0x0002, 0x18AD, 0x496F, 0x8003, 0xD395, 0x0002, 0xD457, 0xD7BF, 0x8074, 0xD7FF, 0x0005, 0xD7DF,
+  0xD7FF, 0xCF3E, 0xC67C, 0xC53A, 0x8006, 0xACB8, 0x0002, 0xC53A, 0xC67C, 0x801B, 0xD7FF, 0x0003, 0xD65B, 0xD395, 0xD396, 0x8018,
+  0xD395, 0x0005, 0xD396, 0xD395, 0xD395, 0xD396, 0xD395, 0x000F, 0x20AE, 0xA2D3, 0xD395, 0xD395, 0xD3D6, 0xD75E, 0xCFFF, 0xCFFF,
+  0xD7FF, 0xD7FF, 0xCFFF, 0xCFFF, 0xD7FF, 0xD7FF, 0xD7DF, 0x8003, 0xD7FF, 0x002C, 0xD7DF, 0xD7FF, 0xD7FF, 0xCFDF, 0xCFFF, 0xD7FF,
+  0xD7DF, 0xD7FF, 0xCFFF, 0xD7FF, 0xD7DF, 0xD7FF, 0xCFFF, 0xD7DF, 0xCFFF, 0xCFFF, 0xD7FF, 0xD7FF, 0xCFFF, 0xD7FF, 0xCFFF, 0xD7FF,
+  0xD7DF, 0xD7DF, 0xCFFF, 0xD7DF, 0xCFFF, 0xD7FF, 0xD7FF, 0xCFFF, 0xD7FF, 0xCFFF, 0xD7FF, 0xD7DF, 0xD7FF, 0xD7FF, 0xCFFF, 0xCFFF,
+  0xD7FF, 0xCFFF, 0xD7DF, 0xCFFF, 0xD7FF, 0xD7DF, 0x8038, 0xD7FF, 0x000A, 0xCFFF, 0xD7FF, 0xCFDF, 0xD7DF, 0xCFDF, 0xCFFF, 0xD7DF,
+  0xACD8, 0x8191, 0x9151, 0x8003, 0x9931, 0x0001, 0x9911, 0x8003, 0x9931, 0x0001, 0xBE3B, 0x8004, 0xD7FF, 0x0002, 0xD7DF, 0xD7DF,
+  0x8003, 0xD7FF, 0x0002, 0xD7DF, 0xCFFF, 0x8006, 0xD7FF, 0x0002, 0xD7DF, 0xD7DF, 0x8004, 0xD7FF, 0x0006, 0xD7DF, 0xD7FF, 0xD7DF,
+  0xD7FF, 0xD7DF, 0xD65C, 0x801E, 0xD395, 0x0005, 0x310E, 0xD395, 0xD375, 0xD375, 0xD5BA, 0x8010, 0xCFDF, 0x0009, 0xC77E, 0xBE5B,
+  0xBE3C, 0xB57A, 0xACB8, 0xBDBB, 0xC63C, 0xBE3B, 0xC71E, 0x800C, 0xCFDF, 0x0009, 0xC77E, 0xBE5C, 0xB5DB, 0xACB8, 0xAC98, 0xBD5A,
+  0xBE3C, 0xC61C, 0xC69D, 0x804A, 0xCFDF, 0x0004, 0xACB9, 0x8191, 0x9151, 0x9911, 0x8004, 0x9931, 0x0003, 0x9911, 0xA111, 0xBE3B,
+  0x8004, 0xCFDF, 0x0008, 0xD7DF, 0xCFDF, 0xCF5E, 0xBE5C, 0xBE5C, 0xC63C, 0xC61C, 0xCEFD, 0x800F, 0xCFDF, 0x0007, 0xCFFF, 0xCFDF,
+  0xD63B, 0xD375, 0xD395, 0xD375, 0xD395, 0x8014, 0xD375, 0x0001, 0xD395, 0x8003, 0xD375, 0x0001, 0xD395, 0x0001, 0x79F1, 0x8003,
+  0xD355, 0x0006, 0xCF7E, 0xC7DF, 0xCFBF, 0xCFDF, 0xC7DF, 0xC7DF, 0x8004, 0xCFDF, 0x0009, 0xCFBF, 0xCFDF, 0xCFDF, 0xCFBF, 0xBEFD,
+  0xACB8, 0x8A52, 0x9151, 0x9131, 0x8006, 0x9931, 0x0021, 0x9911, 0xA192, 0xAB96, 0xBE7D, 0xCFDF, 0xC7DF, 0xCFBF, 0xC7DF, 0xCFDF,
+  0xCFBF, 0xC75E, 0xAD19, 0x92B4, 0x8971, 0x9151, 0x9931, 0x9931, 0x9911, 0x9911, 0xA111, 0x9931, 0xA111, 0x9911, 0xAB36, 0xBD5A,
+  0xC75E, 0xCFDF, 0xC7BF, 0xC7BF, 0xCFDF, 0xC7DF, 0xC7BF, 0xC7DF, 0x8039, 0xCFDF, 0x0028, 0xC7DF, 0xCFBF, 0xC7DF, 0xC7BF, 0xCFBF,
+  0xC7DF, 0xA4B8, 0x8191, 0x9151, 0x9931, 0x9911, 0x9931, 0x9931, 0x9911, 0x9931, 0x9912, 0xBE3B, 0xCFBF, 0xCFDF, 0xCFBF, 0xCFDF,
+  0xCFDF, 0xB5DA, 0x8A12, 0x8971, 0x9931, 0x9931, 0xA111, 0x9931, 0xAB35, 0xC75E, 0xCFBF, 0xCFDF, 0xC7DF, 0xC7DF, 0xCFDF, 0xCFDF,
+  0xCFBF, 0xC7DF, 0xC7DF, 0x8003, 0xCFDF, 0x0001, 0xC7DF, 0x8003, 0xCFDF, 0x0001, 0xCE1B, 0x801C, 0xD355, 0x0006, 0xA293, 0xD335,
+  0xD335, 0xCC98, 0xC7BF, 0xC7BE, 0x800A, 0xC7BF, 0x000B, 0xC75E, 0xA4B8, 0x8191, 0x9151, 0x9911, 0xA131, 0xA111, 0xA111, 0x9931,
+  0xA111, 0xA112, 0x8006, 0xA111, 0x000A, 0xAB35, 0xBEFE, 0xC7BF, 0xC7BE, 0xC7BF, 0xB5DB, 0x89F1, 0x8971, 0x9931, 0x9911, 0x8005,
+  0xA111, 0x0002, 0xA132, 0x9911, 0x8004, 0xA111, 0x0003, 0xA172, 0xBD3A, 0xC7BE, 0x8003, 0xC7BF, 0x0002, 0xC7BE, 0xC79F, 0x8038,
+  0xC7BF, 0x0001, 0xC79F, 0x8006, 0xC7BF, 0x000C, 0xAC98, 0x8191, 0x9151, 0x9931, 0xA111, 0xA131, 0xA111, 0xA131, 0xA111, 0x9931,
+  0xBE1B, 0xC79F, 0x8003, 0xC7BF, 0x0006, 0xBEFD, 0x89F2, 0x8991, 0x9931, 0xA112, 0xA131, 0x8003, 0xA111, 0x0004, 0xAB97, 0xC7BF,
+  0xC7BF, 0xC7BE, 0x800E, 0xC7BF, 0x0002, 0xC6DD, 0xD375, 0x8017, 0xD335, 0x0003, 0xD334, 0xD335, 0xD335, 0x0014, 0xD315, 0xD315,
+  0xD314, 0xC5FB, 0xC79F, 0xC79E, 0xC7BF, 0xC7BF, 0xC79E, 0xC79E, 0xC7BF, 0xC79F, 0xBF9E, 0xBFBF, 0xBFBE, 0xB67C, 0x8A53, 0x8971,
+  0xA131, 0xA112, 0x800B, 0xA111, 0x0009, 0xA112, 0xA111, 0xA111, 0xA172, 0xB539, 0xBF9F, 0x9BF6, 0x8191, 0x9151, 0x800D, 0xA111,
+  0x0009, 0xA112, 0xA111, 0xA111, 0xAB15, 0xBF3D, 0xC79F, 0xC7BE, 0xC79F, 0xC79F, 0x8038, 0xC79E, 0x000A, 0xC79F, 0xC79E, 0xC79F,
+  0xC79E, 0xC79E, 0xC7BF, 0xC79F, 0xA4B8, 0x8191, 0x9151, 0x8005, 0xA111, 0x000A, 0xA112, 0xA111, 0xBDFB, 0xC79F, 0xC79E, 0xC7BE,
+  0xC79F, 0xACF9, 0x8191, 0x9171, 0x8003, 0xA111, 0x0006, 0xA112, 0xA111, 0xA131, 0xA111, 0xBF3E, 0xBFBF, 0x8003, 0xC79E, 0x0001,
+  0xC7BF, 0x8003, 0xC79E, 0x0001, 0xBFBF, 0x8003, 0xC79E, 0x000A, 0xBF9E, 0xC79F, 0xC79E, 0xBFBE, 0xC79E, 0xC6BD, 0xD355, 0xD2F5,
+  0xD315, 0xCB14, 0x8012, 0xD314, 0x8003, 0xD315, 0x0001, 0xD314, 0x0004, 0xD2F4, 0xCAF4, 0xD2F4, 0xC65C, 0x8009, 0xBF9E, 0x0009,
+  0xBF7F, 0xB67C, 0x8A12, 0x8971, 0xA111, 0xA111, 0xA911, 0xA111, 0xA911, 0x8003, 0xA111, 0x0002, 0xA911, 0xA911, 0x8003, 0xA111,
+  0x0001, 0xA911, 0x8003, 0xA111, 0x0008, 0xA912, 0xA911, 0xA1F3, 0x8191, 0x9931, 0xA111, 0xA111, 0xA912, 0x8005, 0xA111, 0x8005,
+  0xA911, 0x8003, 0xA111, 0x0004, 0xA112, 0xA911, 0xAA54, 0xBF1D, 0x8040, 0xBF9E, 0x0006, 0xB79E, 0xBF9F, 0xA498, 0x8191, 0x9951,
+  0xA911, 0x8005, 0xA111, 0x0009, 0xA911, 0xB5FB, 0xBF9E, 0xBF9F, 0xBF9E, 0xBF9F, 0xA498, 0x8191, 0x9951, 0x8004, 0xA111, 0x0008,
+  0xA112, 0xA111, 0xA911, 0xB5FB, 0xBF7E, 0xBF9E, 0xBF9E, 0xBF9F, 0x800E, 0xBF9E, 0x0003, 0xBEBD, 0xD335, 0xCAF4, 0x8013, 0xD2F4,
+  0x0004, 0xCAF4, 0xD2F4, 0xD2F5, 0xCAF4, 0x8003, 0xD2D4, 0x0005, 0xBE5C, 0xB77E, 0xB79E, 0xB77E, 0xBF7E, 0x8003, 0xB77E, 0x0009,
+  0xB79E, 0xBF7E, 0xAE7B, 0x89F2, 0x8971, 0xA111, 0xA8F1, 0xA911, 0xA8F1, 0x8005, 0xA911, 0x0001, 0xA8F1, 0x8003, 0xA911, 0x0018,
+  0xA8F1, 0xA911, 0xA8F1, 0xA911, 0xA911, 0xA912, 0xA911, 0xA911, 0xA111, 0xA911, 0xA8F1, 0xA911, 0xA8F1, 0xA111, 0xA911, 0xA8F1,
+  0xA8F1, 0xA911, 0xA911, 0xA8F1, 0xA911, 0xA8F1, 0xA8F1, 0xA912, 0x8003, 0xA911, 0x0004, 0xA8F1, 0xA111, 0xAA34, 0xB71E, 0x803A,
+  0xBF7E, 0x000A, 0xB77E, 0xB77E, 0xBF7E, 0xB77E, 0xB77E, 0xBF7F, 0xB77E, 0x9C97, 0x8191, 0x9951, 0x8005, 0xA8F1, 0x0017, 0xA911,
+  0xA8F1, 0xB5DB, 0xBF7E, 0xB77E, 0xBF7E, 0xBF7E, 0xA478, 0x8191, 0x9951, 0xA911, 0xA8F1, 0xA8F1, 0xA911, 0xA911, 0xA8F1, 0xA911,
+  0xB5DB, 0xB77F, 0xB77E, 0xBF7E, 0xBF7E, 0xB77E, 0x8003, 0xBF7E, 0x000D, 0xB77E, 0xB77E, 0xBF7E, 0xB77E, 0xBF7E, 0xB77E, 0xBF7E,
+  0xBF7E, 0xB77E, 0xB77E, 0xBF7E, 0xBE9D, 0xCB75, 0x8016, 0xD2D4, 0x0001, 0xD2D5, 0x8003, 0xD2B4, 0x8009, 0xB77E, 0x0007, 0xB71D,
+  0x8A53, 0x8191, 0xA111, 0xA8F1, 0xB0F1, 0xA911, 0x8017, 0xA8F1, 0x0003, 0xA8F2, 0xA8F1, 0xB0F1, 0x800E, 0xA8F1, 0x0001, 0xB2F5,
+  0x8005, 0xB77E, 0x0001, 0xB75E, 0x8003, 0xB77E, 0x0007, 0xB75E, 0xB75E, 0xB77E, 0xB75E, 0xB77E, 0xB77E, 0xB75E, 0x800D, 0xB77E,
+  0x0002, 0xB75E, 0xB75E, 0x8015, 0xB77E, 0x0006, 0xB75E, 0xB77E, 0xB77E, 0xB75E, 0xB77E, 0xB75E, 0x8007, 0xB77E, 0x0003, 0x9C78,
+  0x8191, 0x9951, 0x8007, 0xA8F1, 0x0001, 0xB5DB, 0x8004, 0xB77E, 0x0003, 0x9C77, 0x8191, 0x9151, 0x8007, 0xA8F1, 0x0001, 0xB5DB,
+  0x8003, 0xB77E, 0x0003, 0xB75E, 0xB77E, 0xB75E, 0x8007, 0xB77E, 0x0001, 0xB75E, 0x8005, 0xB77E, 0x000C, 0xB75E, 0xB71D, 0xCB96,
+  0xD2B4, 0xD2B4, 0xCAB4, 0xD2B4, 0xCAB4, 0xD2B4, 0xCAB4, 0xD2B4, 0xCAB4, 0x8008, 0xD2B4, 0x0001, 0xCA94, 0x8003, 0xD2B4, 0x0001,
+  0xCAB4, 0x0003, 0xD294, 0xD294, 0xCA94, 0x8005, 0xAF5E, 0x000D, 0xB75E, 0xAF5E, 0xAF5E, 0xB75E, 0x9416, 0x8991, 0x9951, 0xB0F1,
+  0xA8F1, 0xB0F1, 0xA8F1, 0xB0F1, 0xA8F1, 0x8003, 0xB0F1, 0x0001, 0xA8F1, 0x800A, 0xB0F1, 0x0004, 0xA8F1, 0xA8F1, 0xB0F1, 0xA8F1,
+  0x8003, 0xB0F1, 0x000C, 0xB0D1, 0xB0F1, 0xB0F1, 0xB0F2, 0xA8F1, 0xB0F1, 0xB0F1, 0xB0D1, 0xB0F1, 0xB0F2, 0xA8F1, 0xB0F2, 0x8003,
+  0xB0F1, 0x0007, 0xA8F1, 0xB0F1, 0xB0F1, 0xACF9, 0xAF5E, 0xAF5E, 0xB75E, 0x8006, 0xAF5E, 0x0001, 0xAF7E, 0x8003, 0xAF5E, 0x8003,
+  0xB75E, 0x0004, 0xAF5E, 0xB75E, 0xAF5E, 0xB75E, 0x8004, 0xAF5E, 0x8003, 0xB75E, 0x8003, 0xAF5E, 0x0002, 0xB75E, 0xB75E, 0x800B,
+  0xAF5E, 0x0004, 0xB75E, 0xAF5E, 0xAF5E, 0xB75E, 0x8003, 0xAF5E, 0x0002, 0xB75E, 0xB75E, 0x8003, 0xAF5E, 0x0001, 0xB75E, 0x8004,
+  0xAF5E, 0x0007, 0xAF5D, 0xB75E, 0xAF5E, 0xAF5E, 0x9C77, 0x8191, 0x9951, 0x8007, 0xB0F1, 0x0001, 0xADBB, 0x8004, 0xB75E, 0x0003,
+  0x9C78, 0x8991, 0x9951, 0x8007, 0xB0F1, 0x0003, 0xB5BB, 0xB75E, 0xB75E, 0x8005, 0xAF5E, 0x0003, 0xB75E, 0xAF5E, 0xAF5E, 0x8003,
+  0xB75E, 0x0001, 0xAF5E, 0x8003, 0xB75E, 0x000E, 0xAF5E, 0xAF5E, 0xB75E, 0xAF5E, 0xAF1D, 0xCB75, 0xCA93, 0xD294, 0xCA74, 0xCA94,
+  0xCA74, 0xD274, 0xCA74, 0xD294, 0x8008, 0xCA94, 0x0005, 0xD294, 0xCA93, 0xCA94, 0xD293, 0xCA74, 0x000E, 0xD274, 0xD274, 0xCA53,
+  0xAF5E, 0xAF3E, 0xAF5E, 0xAF3E, 0xAF3D, 0xAF5D, 0xAF3D, 0xAF3E, 0xA69C, 0x8191, 0x8191, 0x8003, 0xB0F1, 0x0018, 0xB0D1, 0xB0F2,
+  0xB0D1, 0xB0D1, 0xB0F2, 0xB0F1, 0xB0F1, 0xAA13, 0xB418, 0xA438, 0x9AB4, 0x9931, 0xA8F1, 0xB0F1, 0xB0F2, 0xB0F1, 0xB0D1, 0xB0F1,
+  0xB0D1, 0xB0F1, 0xB0D1, 0xB0D1, 0xB0F1, 0xB0D1, 0x8004, 0xB0F1, 0x0010, 0xAA74, 0xAC78, 0xACF9, 0x9B35, 0x9931, 0xA8F1, 0xB0F1,
+  0xB0F2, 0xB0F1, 0xB0D1, 0xB0D1, 0xB0F1, 0xB0F2, 0xB0D1, 0xB0F1, 0xA9B3, 0x8004, 0xAF3E, 0x0004, 0xAF5E, 0xAF3E, 0xAF3E, 0xAF5E,
+  0x8003, 0xAF3E, 0x000E, 0xAF5E, 0xAF3E, 0xAF3E, 0xAF5E, 0xAF3E, 0xAF3E, 0xAF3D, 0xAF3D, 0xAF3E, 0xAF3E, 0xAF5E, 0xAF3E, 0xAF3D,
+  0xAF3D, 0x8004, 0xAF3E, 0x0004, 0xAF5E, 0xAF3E, 0xAF3E, 0xAF5E, 0x8008, 0xAF3E, 0x0002, 0xAF3D, 0xAF5E, 0x8004, 0xAF3E, 0x0001,
+  0xAF5E, 0x8003, 0xAF3E, 0x0001, 0xAF5E, 0x8005, 0xAF3E, 0x0003, 0xAF5E, 0xAF3E, 0xAF5E, 0x8004, 0xAF3E, 0x0005, 0x9C77, 0x8191,
+  0x9931, 0xB0F1, 0xB0D1, 0x8005, 0xB0F1, 0x000B, 0xADBB, 0xAF3E, 0xAF3E, 0xAF5D, 0xAF3E, 0x9477, 0x8191, 0x9951, 0xB0D1, 0xB0D1,
+  0xB0F1, 0x8004, 0xB0D1, 0x0005, 0xADBA, 0xAF3E, 0xAF5E, 0xAF3E, 0xAF5E, 0x8003, 0xAF3E, 0x0001, 0xAF3D, 0x8003, 0xAF5E, 0x0002,
+  0xAF3D, 0xAF3D, 0x8004, 0xAF3E, 0x0001, 0xAF5E, 0x8004, 0xAF3E, 0x0009, 0xAEFD, 0xCB56, 0xCA53, 0xCA74, 0xD253, 0xD274, 0xD274,
+  0xD273, 0xCA73, 0x8008, 0xD274, 0x0005, 0xD254, 0xCA74, 0xCA54, 0xCA54, 0xCA74, 0x8003, 0xCA53, 0x8004, 0xA73E, 0x8004, 0xA73D,
+  0x0006, 0x9457, 0x8191, 0x9931, 0xB8D1, 0xB0D1, 0xB8D1, 0x8003, 0xB0D1, 0x000E, 0xB0F1, 0xB0D1, 0xB1B3, 0xAD9A, 0xAF3D, 0xAF3D,
+  0xA73D, 0xA73D, 0x9DDA, 0x89D1, 0x9951, 0xB0F1, 0xB0D1, 0xB0F1, 0x8003, 0xB0D1, 0x0002, 0xB8D1, 0xB8D1, 0x8003, 0xB0D1, 0x0016,
+  0xB0F1, 0xB213, 0xAD9B, 0xA73E, 0xA73D, 0xAF3E, 0xAF3E, 0x9DDA, 0x81F2, 0x9171, 0xB0F1, 0xB0F1, 0xB0D1, 0xB0F1, 0xB0D1, 0xB0D1,
+  0xB8D1, 0xB8D2, 0xB0F1, 0xAD39, 0xA73D, 0xA73E, 0x8005, 0xA73D, 0x0001, 0xA73E, 0x8003, 0xA73D, 0x0001, 0xAF3D, 0x8003, 0xA73D,
+  0x0011, 0xA73E, 0xA73E, 0xA73D, 0xAF3D, 0xA73D, 0xA73D, 0xA73E, 0xAF3D, 0xA73E, 0xA73E, 0xA73D, 0xAF3D, 0xA73D, 0xA73D, 0xA73E,
+  0xAF3E, 0xAF1E, 0x8008, 0xA73E, 0x0005, 0xAF3E, 0xA73E, 0xA73D, 0xAF3E, 0xA73E, 0x8003, 0xA73D, 0x0001, 0xAF3D, 0x8003, 0xA73E,
+  0x000E, 0xA73D, 0xAF3D, 0xA73D, 0xAF3D, 0xA73E, 0xA73E, 0xAF3D, 0xA73E, 0xA73D, 0xA73D, 0xA73E, 0x9478, 0x8191, 0x9931, 0x8006,
+  0xB0D1, 0x0005, 0xB8D1, 0xAD9A, 0xA73E, 0xA73D, 0xA73E, 0x8003, 0xA73D, 0x0001, 0xAF3D, 0x8005, 0xA73D, 0x0001, 0xAF3D, 0x8003,
+  0xA73D, 0x0002, 0xAF3E, 0xA73E, 0x8003, 0xA73D, 0x0009, 0xAF3D, 0xAF3E, 0xA73D, 0xAF3D, 0xAF3E, 0xA73D, 0xA73D, 0xAF3D, 0xA73E,
+  0x8003, 0xAF3D, 0x0007, 0xA73E, 0xA73D, 0xA73D, 0xAF3D, 0xA73D, 0xAEDD, 0xC376, 0x8004, 0xCA53, 0x0001, 0xCA33, 0x8009, 0xCA53,
+  0x0005, 0xD233, 0xCA53, 0xD253, 0xCA53, 0xCA53, 0x0003, 0xCA13, 0xCA33, 0xCA13, 0x8005, 0xA71D, 0x8003, 0xA73D, 0x0003, 0x8A53,
+  0x8191, 0xA8F1, 0x8003, 0xB8D1, 0x0001, 0xB0D1, 0x8003, 0xB8D1, 0x0004, 0xB213, 0xA6BD, 0xA71D, 0xA73E, 0x8004, 0xA71D, 0x0004,
+  0x9E1B, 0x81F1, 0x9171, 0xB0F1, 0x8009, 0xB8D1, 0x0002, 0xB1F3, 0xA6BD, 0x8004, 0xA71D, 0x0005, 0xA73D, 0xA71D, 0x9E1B, 0x89F2,
+  0x8991, 0x8006, 0xB8D1, 0x0003, 0xB0D1, 0xB8D1, 0xB336, 0x800A, 0xA71D, 0x8003, 0xA73D, 0x0009, 0xA71D, 0xA71D, 0xA73D, 0xA71D,
+  0xA71E, 0xA71D, 0xA71D, 0xA73D, 0xA73E, 0x8003, 0xA71D, 0x0007, 0xA73E, 0xA71D, 0xA73E, 0xA73D, 0xA71D, 0xA71D, 0xA73D, 0x800A,
+  0xA71D, 0x8003, 0xA73D, 0x0004, 0xA73E, 0xA71D, 0xA73D, 0xA73D, 0x8006, 0xA71D, 0x000B, 0xA73D, 0xA71D, 0xA71D, 0xA73E, 0xA73D,
+  0xA73D, 0xA71D, 0xA71D, 0x9477, 0x8191, 0x9931, 0x8007, 0xB8D1, 0x0008, 0xA59A, 0xA71D, 0xA73D, 0xA73E, 0xA71D, 0xA71D, 0xA71E,
+  0xA73D, 0x8008, 0xA71D, 0x0007, 0xA73D, 0xA73D, 0xA71E, 0xA71D, 0xA73D, 0xA71D, 0xA73D, 0x8006, 0xA71D, 0x0007, 0xA73D, 0xA73D,
+  0xA71D, 0xA73D, 0xA73D, 0xA71D, 0xA73E, 0x8005, 0xA71D, 0x0004, 0xBBF7, 0xCA13, 0xCA33, 0xCA13, 0x800A, 0xCA33, 0x0005, 0xCA13,
+  0xCA13, 0xCA14, 0xD233, 0xCA33, 0x8003, 0xCA13, 0x000A, 0x9F1D, 0x9F1D, 0xA71D, 0x9F1D, 0x9F1D, 0xA71D, 0x9F1D, 0x9F1D, 0x8191,
+  0x8191, 0x8008, 0xB8D1, 0x0004, 0xA5DB, 0x9F1D, 0x9F1D, 0x9EFD, 0x8003, 0x9F1D, 0x0008, 0xA6FD, 0x9F1D, 0x94F9, 0x8191, 0x9931,
+  0xB8D1, 0xB8D1, 0xB8B1, 0x8005, 0xB8D1, 0x0002, 0xB8B1, 0xA5DB, 0x8004, 0x9F1D, 0x0001, 0xA6FD, 0x8003, 0x9F1D, 0x0003, 0x94F9,
+  0x8191, 0x9931, 0x8007, 0xB8D1, 0x0001, 0xB932, 0x8003, 0x9F1D, 0x0001, 0x9F1E, 0x8005, 0x9F1D, 0x0017, 0x9E1B, 0x9457, 0x92D4,
+  0xA1F3, 0xA911, 0xB0F1, 0xB0F1, 0xA911, 0xB274, 0xB254, 0xB254, 0xABF7, 0xA5DB, 0xA6FD, 0xA6FD, 0xA71D, 0xA71D, 0x9F1D, 0x9F1D,
+  0xA6FD, 0x9F1D, 0x9F1D, 0xA71D, 0x800B, 0x9F1D, 0x000D, 0x9E7C, 0x9498, 0x8B14, 0x9A13, 0xA131, 0xA912, 0xB0F1, 0xA8F1, 0xB255,
+  0xB274, 0xB254, 0xAB97, 0xAD1A, 0x8004, 0x9F1D, 0x0006, 0xA71D, 0x9F1D, 0xA71D, 0x9457, 0x8191, 0xA131, 0x8007, 0xB8D1, 0x0008,
+  0xA57A, 0x9F1D, 0xA71D, 0x9F1D, 0xA71D, 0x9E7C, 0x9DBA, 0xA59A, 0x8007, 0xA57A, 0x0001, 0xA69C, 0x8003, 0x9F1D, 0x0001, 0xA71D,
+  0x8007, 0x9F1D, 0x0011, 0x9E5C, 0x94B8, 0x8AF4, 0x9A13, 0xA131, 0xA8F1, 0xB0F1, 0xB0F1, 0xB932, 0xB274, 0xB254, 0xB336, 0xACB9,
+  0xA63C, 0x9F1D, 0xBBF7, 0xC9F3, 0x8003, 0xCA13, 0x8008, 0xC9F3, 0x8005, 0xCA13, 0x8003, 0xC9D3, 0x8007, 0x9EFD, 0x000B, 0x959A,
+  0x8191, 0x9151, 0xC0B1, 0xB8D1, 0xC0B1, 0xB8D1, 0xC0D1, 0xB8D1, 0xB8D1, 0xB2B5, 0x800A, 0x9EFD, 0x0002, 0x8252, 0x8191, 0x8004,
+  0xB8D1, 0x0005, 0xC0B1, 0xC0D1, 0xB8D1, 0xC0D1, 0xB1F3, 0x8005, 0x9EFD, 0x0001, 0x9F1D, 0x8004, 0x9EFD, 0x0005, 0x8A93, 0x8191,
+  0xB8D1, 0xB8D1, 0xC0D1, 0x8004, 0xB8D1, 0x0002, 0xC0B1, 0xA63C, 0x8006, 0x9EFD, 0x0004, 0x94F8, 0x8A53, 0x9171, 0xB0F1, 0x8003,
+  0xB8D1, 0x000A, 0xB8B1, 0xB8B1, 0xC0B1, 0xC0D1, 0xC0D1, 0xB8D1, 0xC0D1, 0xB8B1, 0xB992, 0xACB9, 0x8011, 0x9EFD, 0x0007, 0x9E5C,
+  0x8B96, 0x8991, 0xA131, 0xB8D1, 0xB8D1, 0xC0B1, 0x8006, 0xB8D1, 0x0005, 0xC0B1, 0xB8D1, 0xB932, 0xABF7, 0x9E9C, 0x8004, 0x9EFD,
+  0x000B, 0x9437, 0x8191, 0xA131, 0xB8D1, 0xC0B1, 0xB8D1, 0xC0B1, 0xC0B1, 0xB8D1, 0xB8D1, 0xA57A, 0x8004, 0x9EFD, 0x000B, 0x9437,
+  0x8191, 0xA131, 0xB8D1, 0xC0B1, 0xB8D1, 0xB8D1, 0xC0B1, 0xB8D1, 0xB8D1, 0xA57A, 0x8009, 0x9EFD, 0x0015, 0x9E9C, 0x8B96, 0x8971,
+  0xA131, 0xB8D1, 0xB8D1, 0xC0B1, 0xB8D1, 0xC0B1, 0xC0D1, 0xB8D1, 0xB8D1, 0xC0D1, 0xB8D1, 0xB8D1, 0xC0D1, 0xB335, 0xA63C, 0xBBD7,
+  0xC9D3, 0xC9F3, 0x8009, 0xC9D3, 0x0005, 0xC9F3, 0xC9D3, 0xC9D3, 0xC9F3, 0xC9D3, 0x8003, 0xC9B3, 0x000C, 0x9EDD, 0x96FD, 0x9EDD,
+  0x96FD, 0x9EFC, 0x96FD, 0x96FD, 0x9599, 0x8991, 0x9171, 0xC0B1, 0xC0D1, 0x8004, 0xC0B1, 0x0037, 0xC0D1, 0xABD7, 0x9EFC, 0x96FD,
+  0x96FD, 0x96DD, 0x96FD, 0x9EFD, 0x9EDD, 0x96FD, 0x9EDD, 0x9EFD, 0x8C37, 0x8191, 0xA111, 0xC0B1, 0xC0B1, 0xC0D1, 0xC0B1, 0xC0B1,
+  0xC0D1, 0xC0B1, 0xAB76, 0x9EDD, 0x9EFD, 0x9EFD, 0x9EDD, 0x9EDD, 0x96DD, 0x9EFD, 0x9EDD, 0x96FD, 0x9EDD, 0x8C37, 0x8191, 0xA131,
+  0xC0D1, 0xC0B1, 0xC0B1, 0xC0D1, 0xC0B1, 0xC0B1, 0xC0D1, 0xA55A, 0x96FD, 0x9EDD, 0x9EFD, 0x96FD, 0x963B, 0x8AF4, 0x8991, 0xA911,
+  0xC0B1, 0xC0B1, 0xC0D1, 0x8004, 0xC0B1, 0x0001, 0xC0D1, 0x8004, 0xC0B1, 0x000B, 0xC0D1, 0xC0B1, 0xC0B1, 0xB992, 0xA55A, 0x9EDD,
+  0x9EFC, 0x96FD, 0x9EDD, 0x96FD, 0x9EFD, 0x8008, 0x96FD, 0x000B, 0x94F9, 0x81F1, 0x9171, 0xB8D2, 0xC0B1, 0xC0D1, 0xC0D1, 0xC0B1,
+  0xC0D1, 0xC0B1, 0xC0D1, 0x8007, 0xC0B1, 0x0008, 0xB992, 0x9DBB, 0x96FD, 0x9EDD, 0x96FD, 0x8C37, 0x8191, 0xA131, 0x8007, 0xC0B1,
+  0x0008, 0xA55A, 0x9EDD, 0x96FD, 0x96FD, 0x9EFD, 0x8C37, 0x8191, 0xA131, 0x8007, 0xC0B1, 0x000D, 0xA55A, 0x96FD, 0x9EFD, 0x96FD,
+  0x9EFD, 0x9EFD, 0x96FD, 0x9EFD, 0x96FD, 0x9539, 0x81F1, 0x9171, 0xB0D1, 0x8003, 0xC0B1, 0x0004, 0xC0D1, 0xC0B1, 0xC0B1, 0xC0D1,
+  0x8006, 0xC0B1, 0x0004, 0xB8D1, 0xB911, 0xACFA, 0xB458, 0x800B, 0xC9B3, 0x0004, 0xC9D2, 0xC9D3, 0xC9D3, 0xC9B3, 0x0004, 0xC993,
+  0xC993, 0xC992, 0x96DC, 0x8006, 0x96DD, 0x0003, 0x8D79, 0x8191, 0x9151, 0x8007, 0xC0B1, 0x0001, 0xABD7, 0x800A, 0x96DD, 0x0003,
+  0x8C37, 0x8191, 0xA131, 0x8007, 0xC0B1, 0x0001, 0xABD7, 0x800A, 0x96DD, 0x0003, 0x8C37, 0x8191, 0xA131, 0x8007, 0xC0B1, 0x0001,
+  0x9D5A, 0x8003, 0x96DD, 0x0007, 0x95DA, 0x89F2, 0x8971, 0xB8D1, 0xC0B1, 0xC0B1, 0xC8B1, 0x800F, 0xC0B1, 0x0001, 0xA499, 0x8005,
+  0x96DD, 0x0001, 0x96DC, 0x8006, 0x96DD, 0x0003, 0x8C37, 0x8191, 0x9931, 0x800C, 0xC0B1, 0x0001, 0xC8B1, 0x8005, 0xC0B1, 0x0006,
+  0xA499, 0x96DC, 0x96DD, 0x8C37, 0x8191, 0xA111, 0x8007, 0xC0B1, 0x0001, 0x9D5A, 0x8004, 0x96DD, 0x0003, 0x8C37, 0x8191, 0xA131,
+  0x8007, 0xC0B1, 0x0001, 0x9D5A, 0x8007, 0x96DD, 0x0003, 0x8CD8, 0x8191, 0x9951, 0x8006, 0xC0B1, 0x0001, 0xC8B1, 0x8003, 0xC0B1,
+  0x0001, 0xC8B1, 0x8007, 0xC0B1, 0x0007, 0xAC79, 0xACF9, 0xC992, 0xC993, 0xC9B2, 0xC992, 0xC992, 0x8003, 0xC993, 0x8003, 0xC992,
+  0x8003, 0xC993, 0x8003, 0xC972, 0x0003, 0x8EBC, 0x8EBD, 0x8EBD, 0x8003, 0x8EBC, 0x0004, 0x8EBD, 0x8D7A, 0x8191, 0x9151, 0x8005,
+  0xC0B1, 0x0004, 0xC8B1, 0xC0B1, 0xABB7, 0x8EBD, 0x8008, 0x8EBC, 0x0006, 0x8EBD, 0x8C37, 0x8191, 0xA131, 0xC0B1, 0xC8B1, 0x8003,
+  0xC0B1, 0x0003, 0xC8B1, 0xC0B1, 0xABB7, 0x8003, 0x8EBC, 0x000A, 0x8EDC, 0x8EBC, 0x8EDD, 0x8EBC, 0x8EBC, 0x8EBD, 0x8EBC, 0x8C37,
+  0x8191, 0xA131, 0x8007, 0xC0B1, 0x0032, 0x9D39, 0x8EBD, 0x8EDD, 0x8DBA, 0x81F2, 0x9171, 0xC0B1, 0xC0B1, 0xC8B1, 0xC0B1, 0xC0D1,
+  0xC0B1, 0xC8B1, 0xC8B2, 0xC0B1, 0xC8B2, 0xC8B1, 0xC8B1, 0xC0D1, 0xC0B1, 0xC0D1, 0xC0D1, 0xC8B1, 0xC0B1, 0xC0B1, 0xC8B1, 0xC0B1,
+  0xA437, 0x8EBC, 0x8EDD, 0x8EBC, 0x8EBD, 0x8EBC, 0x8EBC, 0x8EBD, 0x8EBC, 0x8EBD, 0x8EBD, 0x8CD8, 0x8191, 0xA131, 0xC0B1, 0xC0B1,
+  0xC8B1, 0xC0B1, 0xC0B1, 0xC8B2, 0xC8B1, 0xC0B1, 0xC8B1, 0x8003, 0xC0B1, 0x0002, 0xC8B1, 0xC8B1, 0x8003, 0xC0B1, 0x000B, 0xC8B1,
+  0xC0B1, 0xC8B1, 0xA4D9, 0x8EBC, 0x8C37, 0x8191, 0xA131, 0xC0B1, 0xC8B1, 0xC0D1, 0x8003, 0xC0B1, 0x0002, 0xC8B1, 0x9D3A, 0x8004,
+  0x8EBC, 0x0003, 0x8C37, 0x8191, 0xA131, 0x8007, 0xC0B1, 0x0004, 0x9D5A, 0x8EBC, 0x8EBC, 0x8EDC, 0x8003, 0x8EBC, 0x000A, 0x8CD8,
+  0x8191, 0x9951, 0xC8B1, 0xC0B1, 0xC8B1, 0xC8B2, 0xC8B1, 0xC0B1, 0xC8B1, 0x8003, 0xC0B1, 0x0001, 0xC0D1, 0x8005, 0xC0B1, 0x8003,
+  0xC8B1, 0x0003, 0xC8D1, 0xA478, 0xA4D9, 0x800D, 0xC972, 0x8003, 0xC952, 0x8007, 0x8EBC, 0x0005, 0x8D59, 0x8191, 0x9171, 0xC8F2,
+  0xC8F1, 0x8003, 0xC8F2, 0x0003, 0xC8F1, 0xC8F2, 0xABD7, 0x800A, 0x8EBC, 0x0005, 0x8C36, 0x8191, 0xA931, 0xC8F2, 0xC8F1, 0x8004,
+  0xC8F2, 0x0002, 0xC0F2, 0xABB7, 0x800A, 0x8EBC, 0x0013, 0x8437, 0x8191, 0xA951, 0xC8F1, 0xC8F1, 0xC8F2, 0xC8F1, 0xC8F1, 0xC8F2,
+  0xC8F1, 0x9D3A, 0x8EBC, 0x8E1B, 0x81F2, 0x8971, 0xB912, 0xC8F1, 0xC8F1, 0xC8F2, 0x8003, 0xC8F1, 0x0003, 0xC8F2, 0xC8D1, 0xC112,
+  0x8003, 0xC8F2, 0x000B, 0xC8D1, 0xC8F2, 0xC8D1, 0xC8F2, 0xC0F1, 0xC8F1, 0xC8F2, 0xC8F1, 0xC8F2, 0xC0F1, 0xA498, 0x8008, 0x8EBC,
+  0x0012, 0x8DBA, 0x8991, 0x8991, 0xC0F1, 0xC8F2, 0xC0F2, 0xC8F1, 0xC8F2, 0xC8F1, 0xC0F1, 0xC8F2, 0xC8F1, 0xC8F2, 0xC0F2, 0xC8F1,
+  0xC0F1, 0xC8F2, 0xC8F1, 0x8003, 0xC8F2, 0x0008, 0xC8F1, 0xC8F1, 0xC0F2, 0xC132, 0x8E5C, 0x8C17, 0x8191, 0xA931, 0x8004, 0xC8F2,
+  0x0004, 0xC8F1, 0xC8F2, 0xC8F2, 0x9D59, 0x8004, 0x8EBC, 0x000B, 0x8C17, 0x8191, 0xA951, 0xC8F1, 0xC8F1, 0xC8F2, 0xC8F1, 0xC8F1,
+  0xC8F2, 0xC8F1, 0x9D5A, 0x8004, 0x8EBC, 0x0005, 0x8EBD, 0x8DBA, 0x81F2, 0x8991, 0xC111, 0x8003, 0xC8F1, 0x0015, 0xC0F2, 0xC8F1,
+  0xC8F1, 0xC0F2, 0xC8D2, 0xC8F1, 0xC8F2, 0xC0F1, 0xC0F1, 0xC8F2, 0xC0F1, 0xC8F1, 0xC8F2, 0xC8F2, 0xC8F1, 0xC8F1, 0xC8F2, 0xC152,
+  0x95FB, 0xA4B8, 0xC152, 0x8003, 0xC952, 0x0001, 0xC972, 0x8007, 0xC952, 0x8003, 0xC932, 0x8007, 0x8EBC, 0x000B, 0x8D79, 0x8191,
+  0x9171, 0xC132, 0xC131, 0xC912, 0xC912, 0xC132, 0xC911, 0xC912, 0xABF7, 0x8009, 0x8EBC, 0x000C, 0x96BC, 0x8C36, 0x8191, 0xA951,
+  0xC912, 0xC911, 0xC912, 0xC912, 0xC112, 0xC912, 0xC912, 0xABF7, 0x800A, 0x8EBC, 0x0003, 0x8C36, 0x8191, 0xA951, 0x8003, 0xC912,
+  0x000B, 0xC911, 0xC911, 0xC912, 0xC912, 0x9D59, 0x8EBC, 0x8AD4, 0x8191, 0xB152, 0xC912, 0xC131, 0x8006, 0xC912, 0x0001, 0xC932,
+  0x8004, 0xC912, 0x0030, 0xC911, 0xC112, 0xC932, 0xC912, 0xC912, 0xC932, 0xC911, 0xC912, 0xC912, 0xC932, 0xC131, 0x9DBA, 0x8EBC,
+  0x96BC, 0x8EBC, 0x8EDC, 0x96BB, 0x8EBC, 0x8EDC, 0x82D4, 0x8191, 0xB932, 0xC912, 0xC112, 0xC912, 0xC112, 0xC912, 0xC112, 0xC912,
+  0xC911, 0xC911, 0xC932, 0xC911, 0xC131, 0xC912, 0xC132, 0xC131, 0xC912, 0xC912, 0xC911, 0xC911, 0xC131, 0xC912, 0xC912, 0xB356,
+  0x8C36, 0x8191, 0xA151, 0x8006, 0xC912, 0x0009, 0xC112, 0x9D59, 0x8EBC, 0x96BC, 0x8EBC, 0x8EBC, 0x8C37, 0x8191, 0xA951, 0x8003,
+  0xC912, 0x0005, 0xC911, 0xC911, 0xC912, 0xC912, 0x9D59, 0x8003, 0x8EBC, 0x001F, 0x96BC, 0x8EBC, 0x82F4, 0x8991, 0xB151, 0xC912,
+  0xC912, 0xC932, 0xC912, 0xC912, 0xC131, 0xC932, 0xC912, 0xC911, 0xC911, 0xC932, 0xC911, 0xC912, 0xC911, 0xC932, 0xC932, 0xC112,
+  0xC911, 0xC132, 0xC912, 0xC912, 0xC932, 0xB336, 0x96BC, 0xA4F9, 0xC192, 0x800A, 0xC932, 0x8003, 0xC912, 0x8003, 0x9EDB, 0x0001,
+  0x9EDC, 0x8003, 0x9EDB, 0x0003, 0x9578, 0x8191, 0x9991, 0x8007, 0xC952, 0x0001, 0xB417, 0x800A, 0x9EDB, 0x0003, 0x9436, 0x8191,
+  0xA972, 0x8007, 0xC952, 0x0003, 0xA518, 0x9EDB, 0x96DB, 0x8008, 0x9EDB, 0x0003, 0x9436, 0x8191, 0xA171, 0x8007, 0xC952, 0x0004,
+  0xA579, 0x94D8, 0x8191, 0x9991, 0x8005, 0xC952, 0x0001, 0xC152, 0x8005, 0xC952, 0x0006, 0xC253, 0xC2B4, 0xB952, 0xC152, 0xC952,
+  0xC152, 0x8008, 0xC952, 0x0001, 0xBAB5, 0x8006, 0x9EDB, 0x0003, 0x9599, 0x8191, 0x91B1, 0x800A, 0xC952, 0x0004, 0xC1F3, 0xC2B5,
+  0xB952, 0xC152, 0x8005, 0xC952, 0x0008, 0xC972, 0xC952, 0xC952, 0xC972, 0xC1B2, 0x9436, 0x8191, 0xA972, 0x8007, 0xC952, 0x0001,
+  0xA579, 0x8004, 0x9EDB, 0x0003, 0x8C36, 0x8991, 0xA171, 0x8007, 0xC952, 0x0008, 0xA579, 0x9EDB, 0x9EDC, 0x9EDB, 0x9EDB, 0x9598,
+  0x8191, 0x9191, 0x8004, 0xC952, 0x0003, 0xC152, 0xC952, 0xC172, 0x8003, 0xC952, 0x0004, 0xC1F3, 0xC2B4, 0xB952, 0xC152, 0x800A,
+  0xC952, 0x000A, 0xA61A, 0x9EDC, 0xA5DA, 0xC172, 0xC912, 0xC911, 0xC911, 0xC912, 0xC912, 0xC111, 0x8003, 0xC912, 0x0011, 0xC8F1,
+  0xC8F1, 0xC8F2, 0xA6FB, 0xA6FA, 0xA6FA, 0xA6FB, 0xA6FA, 0xA6DA, 0xA6FA, 0x9D98, 0x8191, 0x9191, 0xC972, 0xC992, 0xC992, 0xC972,
+  0x8003, 0xC992, 0x0002, 0xB436, 0xA6FB, 0x8009, 0xA6FA, 0x0005, 0x9436, 0x8191, 0xA992, 0xC992, 0xC992, 0x8003, 0xC972, 0x0005,
+  0xC992, 0xC992, 0xAD98, 0xA6DA, 0xA6DA, 0x8008, 0xA6FA, 0x0004, 0x9436, 0x8191, 0xA992, 0xC993, 0x8006, 0xC992, 0x000A, 0xAD99,
+  0x8A32, 0x8991, 0xC192, 0xC992, 0xC992, 0xC972, 0xC992, 0xC992, 0xC973, 0x8003, 0xC992, 0x001A, 0xBC36, 0xA69A, 0xA6FA, 0xA6FA,
+  0xA69A, 0x9395, 0x8991, 0xB992, 0xC993, 0xC972, 0xC972, 0xC992, 0xC992, 0xC972, 0xC992, 0xC972, 0xC972, 0xAD98, 0xA6DB, 0xA6DA,
+  0xA6FA, 0xA6FB, 0xA6FA, 0x9395, 0x8191, 0xB192, 0x8003, 0xC992, 0x000E, 0xC993, 0xC972, 0xC972, 0xC992, 0xC972, 0xC233, 0xAD98,
+  0xA6FA, 0xA6FB, 0xA639, 0x8A93, 0x9992, 0xC192, 0xC972, 0x8003, 0xC992, 0x0007, 0xC972, 0xC992, 0xC972, 0xC972, 0x9A93, 0x8191,
+  0xA992, 0x8007, 0xC992, 0x0009, 0xAD98, 0xA6FA, 0xA6FB, 0xA6FA, 0xA6FA, 0x9436, 0x8191, 0xA992, 0xC993, 0x8006, 0xC992, 0x001A,
+  0xAD98, 0xA6DA, 0xA6DA, 0xA6FA, 0xA6DA, 0x8B95, 0x8191, 0xB192, 0xC972, 0xC992, 0xC972, 0xC992, 0xC992, 0xC972, 0xC992, 0xC972,
+  0xC294, 0xADF9, 0xA6FA, 0xA6DA, 0xA69A, 0x9334, 0x9191, 0xB992, 0xC992, 0xC993, 0x8006, 0xC992, 0x0008, 0xB497, 0xAEFB, 0xAEFB,
+  0xB5D9, 0xC952, 0xC8F1, 0xC8F2, 0xC0F1, 0x8005, 0xC8F1, 0x0003, 0xC0D1, 0xC0D1, 0xC8D2, 0x8003, 0xB71A, 0x000F, 0xAEFA, 0xB71A,
+  0xAF1A, 0xAEFA, 0xA598, 0x8191, 0x9191, 0xC9B3, 0xC9B3, 0xC9D3, 0xC9D3, 0xC9B2, 0xC9B3, 0xC9D3, 0xBC76, 0x800A, 0xB71A, 0x000F,
+  0x9C55, 0x8191, 0xA9B2, 0xC9D3, 0xC9D3, 0xC9B3, 0xC9B2, 0xC9B3, 0xC9D3, 0xC9D3, 0xB5B8, 0xB71A, 0xAF1A, 0xB71A, 0xB6FA, 0x8004,
+  0xB71A, 0x0005, 0xB6FA, 0xAF1A, 0x9C56, 0x8191, 0xA992, 0x8007, 0xC9B3, 0x0016, 0xA3B5, 0x8191, 0x9992, 0xC9B2, 0xC9B3, 0xC9D2,
+  0xC9B2, 0xC9B3, 0xC9B2, 0xC9B3, 0xC9D3, 0xCA13, 0xBDB8, 0xAEFA, 0xAF1A, 0xB71A, 0xB6FA, 0xAEFA, 0xAF19, 0xA4F7, 0x8991, 0xB1B2,
+  0x8005, 0xC9B3, 0x000C, 0xC9D2, 0xC9B3, 0xC9B3, 0xC314, 0xAF1A, 0xAF1A, 0xAEF9, 0xAF1A, 0xAF1A, 0x89F1, 0x8191, 0xC1B2, 0x8003,
+  0xC9B3, 0x000E, 0xC9B2, 0xC9B2, 0xC9D3, 0xC9B3, 0xCAB4, 0xB6B9, 0xAF1A, 0xB71A, 0xAEFA, 0xB71A, 0xB6B9, 0x8A93, 0x8991, 0xC1D2,
+  0x8004, 0xC9B3, 0x0009, 0xC9B2, 0xC9D3, 0xC9B2, 0xA992, 0x8191, 0xA9B2, 0xC9D3, 0xC9B3, 0xC9D3, 0x8003, 0xC9B2, 0x0009, 0xC9B3,
+  0xB5B8, 0xAF1A, 0xAEFA, 0xAF1A, 0xB71A, 0x9C56, 0x8191, 0xA992, 0x8007, 0xC9B3, 0x0021, 0xB5B8, 0xB6FA, 0xAF1A, 0xAF1A, 0xB6FA,
+  0x89F2, 0x8191, 0xC1B2, 0xC9B3, 0xC9B2, 0xC9D3, 0xC9B3, 0xC9B3, 0xC9B2, 0xC9D3, 0xCAB4, 0xB6B9, 0xAF1A, 0xB71A, 0xB71A, 0xB6FA,
+  0xB71A, 0x92F3, 0x89B1, 0xC1B2, 0xC9D3, 0xC9B3, 0xC9B3, 0xC9D3, 0xC9D3, 0xC9B3, 0xC9D3, 0xC315, 0x8003, 0xB71A, 0x0003, 0xBDD9,
+  0xC132, 0xC0D1, 0x8004, 0xC8D1, 0x0002, 0xC0D1, 0xC0D1, 0x0003, 0xC0B1, 0xC8B1, 0xC0B1, 0x8007, 0xBF19, 0x0003, 0xA4B5, 0x8191,
+  0xA1B2, 0x8006, 0xC9F3, 0x0002, 0xD1F3, 0xC496, 0x800A, 0xBF19, 0x0003, 0xA455, 0x8191, 0xA9D2, 0x8007, 0xC9F3, 0x0001, 0xBDD8,
+  0x8003, 0xBF19, 0x000A, 0xBF39, 0xBF19, 0xBF19, 0xBF39, 0xBF19, 0xBF39, 0xBF39, 0xA455, 0x8191, 0xA9D2, 0x8007, 0xC9F3, 0x0003,
+  0x99F2, 0x8991, 0xB1D2, 0x8007, 0xC9F3, 0x0005, 0xC9F2, 0xC577, 0xBF19, 0xBF39, 0xBF39, 0x8005, 0xBF19, 0x0006, 0x9BF5, 0x8191,
+  0xB1D2, 0xC9F3, 0xC9F3, 0xD1F3, 0x8005, 0xC9F3, 0x0001, 0xBE78, 0x8003, 0xBF19, 0x000C, 0xB6B9, 0x8191, 0x8991, 0xC9F3, 0xC9F3,
+  0xC9F2, 0xC9F3, 0xC9F3, 0xC9D3, 0xC9F3, 0xC9F3, 0xBED8, 0x8005, 0xBF19, 0x0006, 0xBF39, 0xAD57, 0x8191, 0x99B2, 0xC9F3, 0xC9F2,
+  0x8005, 0xC9F3, 0x0003, 0xB9D3, 0x8191, 0xA9B2, 0x8007, 0xC9F3, 0x0001, 0xBDD8, 0x8004, 0xBF19, 0x0003, 0x9C75, 0x8191, 0xA9D2,
+  0x8007, 0xC9F3, 0x0001, 0xBDD8, 0x8003, 0xBF19, 0x0003, 0xB6B8, 0x8191, 0x8191, 0x8008, 0xC9F3, 0x000A, 0xBE78, 0xBF19, 0xBF39,
+  0xBF19, 0xBF39, 0xBF19, 0xBF19, 0xADB7, 0x8191, 0x91B1, 0x8003, 0xC9F3, 0x0001, 0xC9F2, 0x8004, 0xC9F3, 0x000C, 0xC71A, 0xBF1A,
+  0xC73A, 0xBF3A, 0xC659, 0xC9D3, 0xC0B1, 0xC8B1, 0xC0B1, 0xC0B1, 0xC8B1, 0xC0B1, 0x8003, 0xC0B1, 0x8007, 0xC738, 0x000B, 0xA475,
+  0x8991, 0xA9D2, 0xCA13, 0xCA33, 0xCA33, 0xCA34, 0xCA13, 0xCA33, 0xCA33, 0xCCB6, 0x800A, 0xC738, 0x0006, 0xA455, 0x8191, 0xA9D2,
+  0xCA33, 0xCA33, 0xCA13, 0x8003, 0xCA33, 0x0002, 0xD213, 0xC5F7, 0x8004, 0xC738, 0x0001, 0xC739, 0x8005, 0xC738, 0x0004, 0xA475,
+  0x8191, 0xA9D2, 0xCA13, 0x8004, 0xCA33, 0x0005, 0xCA13, 0xCA33, 0x91B1, 0x8191, 0xCA13, 0x8004, 0xCA33, 0x0006, 0xCA13, 0xCA33,
+  0xCA13, 0xC455, 0xC738, 0xC739, 0x8004, 0xC738, 0x0001, 0xC739, 0x8003, 0xC738, 0x0003, 0x8A52, 0x8991, 0xC213, 0x8004, 0xCA13,
+  0x000A, 0xCA33, 0xCA13, 0xCA33, 0xCD56, 0xC738, 0xC738, 0xC739, 0xB5D7, 0x8191, 0x91B1, 0x8003, 0xCA13, 0x0001, 0xD233, 0x8003,
+  0xCA33, 0x0002, 0xCB55, 0xCF38, 0x8005, 0xC738, 0x0004, 0xC739, 0xC738, 0x8191, 0x8191, 0x8003, 0xCA13, 0x000F, 0xCA33, 0xCA13,
+  0xCA33, 0xD233, 0xCA13, 0x8191, 0xA9D2, 0xCA33, 0xCA33, 0xCA13, 0xCA13, 0xCA33, 0xCA13, 0xCA33, 0xCDF7, 0x8003, 0xC738, 0x0005,
+  0xC739, 0xA475, 0x8191, 0xA9D2, 0xCA13, 0x8004, 0xCA33, 0x0003, 0xCA13, 0xCA33, 0xC5F7, 0x8003, 0xC738, 0x0006, 0xB5D6, 0x8191,
+  0x99B2, 0xCA33, 0xCA33, 0xD213, 0x8004, 0xCA33, 0x0002, 0xCB74, 0xC739, 0x8004, 0xC738, 0x0014, 0xC739, 0xC738, 0xC738, 0x8AB2,
+  0x8191, 0xBA13, 0xCA13, 0xCA13, 0xCA33, 0xCA13, 0xCA33, 0xCA33, 0xCA13, 0xCF39, 0xC739, 0xC759, 0xCF3A, 0xCF39, 0xCED9, 0xC9F3,
+  0x8005, 0xC0B1, 0x8003, 0xC0B1, 0x000D, 0xCF57, 0xD758, 0xD758, 0xCF58, 0xD758, 0xCF58, 0xD758, 0xAC74, 0x8191, 0xA9F2, 0xCA53,
+  0xD253, 0xCA54, 0x8003, 0xCA53, 0x0003, 0xCA54, 0xCCD6, 0xCF58, 0x8008, 0xD758, 0x0007, 0xCF58, 0xAC75, 0x8191, 0xA9F2, 0xCA53,
+  0xCA53, 0xD253, 0x8003, 0xCA53, 0x0018, 0xD254, 0xCE17, 0xCF57, 0xD758, 0xCF58, 0xD758, 0xCF58, 0xD758, 0xD758, 0xCF58, 0xD758,
+  0xCF58, 0xAC74, 0x8191, 0xA9F2, 0xCA53, 0xCA54, 0xD253, 0xCA53, 0xCA53, 0xCA54, 0xCA53, 0x99D2, 0x89B1, 0x8004, 0xCA53, 0x0012,
+  0xD253, 0xCA53, 0xCA53, 0xCA54, 0xD6B7, 0xD758, 0xCF58, 0xCF57, 0xCF58, 0xD758, 0xD757, 0xD758, 0xD757, 0xD758, 0xCF58, 0xB535,
+  0x8191, 0xA1D2, 0x8003, 0xCA53, 0x004C, 0xD254, 0xCA73, 0xCA53, 0xCA53, 0xCC95, 0xD758, 0xD758, 0xCF58, 0xBDD6, 0x8191, 0x99D2,
+  0xCA53, 0xCA53, 0xCA54, 0xCA53, 0xCA53, 0xD254, 0xCA54, 0xD435, 0xD758, 0xD758, 0xCF58, 0xD758, 0xD758, 0xCF57, 0xD738, 0xCF58,
+  0x9AF3, 0x8991, 0xC213, 0xCA54, 0xCA53, 0xCA53, 0xD253, 0xCA53, 0xCA54, 0xCA73, 0x8191, 0xA9F2, 0xCA53, 0xD253, 0xD253, 0xCA54,
+  0xD253, 0xCA53, 0xCA54, 0xCE17, 0xCF58, 0xD758, 0xD758, 0xCF58, 0xAC74, 0x8191, 0xA9F2, 0xCA53, 0xCA54, 0xD253, 0xCA53, 0xCA53,
+  0xCA54, 0xCA53, 0xD617, 0xD758, 0xCF58, 0xCF58, 0xBDD6, 0x8191, 0x91B2, 0xCA53, 0xD254, 0xCA53, 0xCA53, 0xCA54, 0xD253, 0xD253,
+  0xCCD6, 0x8004, 0xD758, 0x0016, 0xCF57, 0xD757, 0xCF58, 0xD758, 0x9AF3, 0x8191, 0xBA33, 0xCA54, 0xCA53, 0xD253, 0xCA54, 0xCA53,
+  0xD253, 0xCA53, 0xD758, 0xD758, 0xDF59, 0xD779, 0xD759, 0xD759, 0xD6F9, 0xC1F2, 0x8004, 0xC0B1, 0x8003, 0xC0B1, 0x8007, 0xDF77,
+  0x0005, 0xB494, 0x8191, 0xAA12, 0xCA94, 0xCA74, 0x8004, 0xCA94, 0x0002, 0xD294, 0xD4F5, 0x800A, 0xDF77, 0x000E, 0xB474, 0x8191,
+  0xAA12, 0xCA94, 0xCA94, 0xD294, 0xCA94, 0xD294, 0xCA94, 0xD294, 0xDE36, 0xDF77, 0xDF77, 0xDF57, 0x8007, 0xDF77, 0x0004, 0xB494,
+  0x8191, 0xAA12, 0xCA94, 0x8006, 0xD294, 0x000A, 0x99D2, 0x91D2, 0xD294, 0xCA94, 0xD294, 0xCA94, 0xD294, 0xCA94, 0xCA94, 0xD3D4,
+  0x8003, 0xDF77, 0x0001, 0xDF76, 0x8005, 0xDF77, 0x0005, 0xDF57, 0xDF77, 0xDF77, 0x8191, 0x8992, 0x8003, 0xCA94, 0x0005, 0xD294,
+  0xCA94, 0xCA93, 0xCA94, 0xD3D5, 0x8003, 0xDF77, 0x000B, 0xC5F5, 0x8191, 0x99D2, 0xCA94, 0xCA94, 0xD273, 0xCA94, 0xD294, 0xCA94,
+  0xD294, 0xD515, 0x8008, 0xDF77, 0x000C, 0x9B12, 0x8191, 0xBA53, 0xCA94, 0xCA94, 0xD294, 0xCA94, 0xCA93, 0xD294, 0xCA94, 0x8191,
+  0xAA12, 0x8003, 0xD294, 0x000D, 0xCA94, 0xCA94, 0xD294, 0xD294, 0xDE36, 0xDF77, 0xDF77, 0xDF57, 0xDF77, 0xB474, 0x8191, 0xAA12,
+  0xCA94, 0x8006, 0xD294, 0x0001, 0xDE36, 0x8003, 0xDF77, 0x000B, 0xC5F5, 0x8191, 0x99D2, 0xD294, 0xCA94, 0xCA94, 0xD294, 0xCA94,
+  0xCA94, 0xCA93, 0xD4F5, 0x8008, 0xDF77, 0x000A, 0x9B12, 0x8191, 0xBA53, 0xD294, 0xCA94, 0xCA94, 0xD294, 0xCA94, 0xD294, 0xCA94,
+  0x8006, 0xDF78, 0x0002, 0xE779, 0xDF19, 0x8004, 0xC0B1, 0x0007, 0xB8D1, 0xB8D1, 0xC0D1, 0xE776, 0xE796, 0xE797, 0xE797, 0x8003,
+  0xE796, 0x0003, 0xB494, 0x8191, 0xAA33, 0x8003, 0xD2B4, 0x0006, 0xCAB4, 0xD2D4, 0xD2B4, 0xD2B4, 0xDD35, 0xE776, 0x8009, 0xE796,
+  0x0003, 0xB474, 0x8191, 0xAA33, 0x8003, 0xD2D4, 0x000C, 0xD2B4, 0xD2B4, 0xCAD4, 0xD2D4, 0xE656, 0xEF96, 0xE776, 0xE797, 0xE796,
+  0xE796, 0xE776, 0xE777, 0x8003, 0xE796, 0x0003, 0xB494, 0x8191, 0xAA33, 0x8007, 0xD2B4, 0x0011, 0x99D2, 0x99F2, 0xCAB4, 0xD2B4,
+  0xD2D4, 0xD2B4, 0xD2B4, 0xCAD4, 0xD2B4, 0xD3F5, 0xE777, 0xE797, 0xEF97, 0xE796, 0xE796, 0xE776, 0xE777, 0x8003, 0xE796, 0x000C,
+  0xE777, 0xEF97, 0x8191, 0x8191, 0xD2B4, 0xD2B4, 0xD2D4, 0xD2D4, 0xD2B4, 0xD2B4, 0xCAD4, 0xD3D5, 0x8003, 0xE796, 0x001F, 0xCE15,
+  0x8191, 0x99F2, 0xCAD4, 0xD2B4, 0xD2D4, 0xD2B4, 0xD2B4, 0xCAB4, 0xD2B4, 0xDD35, 0xE777, 0xEF76, 0xE796, 0xE797, 0xE797, 0xE776,
+  0xE796, 0xE776, 0xC534, 0xB494, 0xCC15, 0xD3F5, 0xDBF4, 0xDBF4, 0xDBF5, 0xD3F5, 0xD3F4, 0xCB34, 0x8191, 0xAA32, 0x8004, 0xD2B4,
+  0x000B, 0xD2D4, 0xD2B4, 0xCAB4, 0xE656, 0xE776, 0xE796, 0xE796, 0xE776, 0xB494, 0x8191, 0xAA33, 0x8007, 0xD2B4, 0x0001, 0xDE56,
+  0x8003, 0xE796, 0x0010, 0xCE15, 0x8191, 0x99F2, 0xD2B4, 0xD2B4, 0xD2D4, 0xD2B4, 0xD2D4, 0xCAD4, 0xCAD4, 0xDD15, 0xE796, 0xE796,
+  0xE776, 0xE796, 0xEF96, 0x8003, 0xE796, 0x0003, 0x9B13, 0x8191, 0xBA73, 0x8007, 0xD2B4, 0x0005, 0xE797, 0xEF97, 0xEF77, 0xEF97,
+  0xEF78, 0x8003, 0xEF98, 0x0004, 0xC992, 0xB8D1, 0xC0D1, 0xC0B1, 0x8003, 0xB8D1, 0x000A, 0xF796, 0xF7B6, 0xF796, 0xF795, 0xF795,
+  0xF796, 0xEFB6, 0xBC93, 0x8191, 0xAA52, 0x8003, 0xD2F4, 0x8003, 0xD2F5, 0x0002, 0xD2F4, 0xDD55, 0x8009, 0xF7B6, 0x0005, 0xEFB6,
+  0xBC93, 0x8191, 0xAA53, 0xD2F5, 0x8006, 0xD2F4, 0x0003, 0xE675, 0xF796, 0xF795, 0x8003, 0xF796, 0x0008, 0xF7B6, 0xF7B5, 0xF7B5,
+  0xEF96, 0xF796, 0xBC93, 0x8191, 0xAA33, 0x8007, 0xD2F4, 0x000A, 0x99F2, 0x99F2, 0xD2F5, 0xD2F4, 0xD2F4, 0xD2F5, 0xD2D4, 0xD2F4,
+  0xD2F4, 0xDC75, 0x8003, 0xF795, 0x0002, 0xF796, 0xF7B5, 0x8004, 0xF796, 0x0005, 0xEFB6, 0xF7B5, 0xF796, 0x8191, 0x8991, 0x8007,
+  0xD2F4, 0x0001, 0xDC15, 0x8003, 0xF796, 0x0003, 0xD615, 0x8191, 0x99F2, 0x8004, 0xD2F4, 0x0018, 0xD2F5, 0xD2F4, 0xD2F5, 0xE535,
+  0xF7B6, 0xF7B5, 0xF796, 0xEFB6, 0xF796, 0xF795, 0xF7B6, 0xF796, 0xF7B6, 0xF795, 0xF796, 0xF796, 0xF795, 0xF7B6, 0xF795, 0xF7B6,
+  0xF796, 0xBC93, 0x8191, 0xAA53, 0x8007, 0xD2F4, 0x0008, 0xEE75, 0xF796, 0xF796, 0xF7B5, 0xF796, 0xBC93, 0x8191, 0xAA33, 0x8007,
+  0xD2F4, 0x000A, 0xEE75, 0xF796, 0xF7B5, 0xF795, 0xD634, 0x8191, 0x99F2, 0xD2F4, 0xD2F5, 0xD2F4, 0x8003, 0xD2F5, 0x000D, 0xD2D4,
+  0xE555, 0xF796, 0xF7B5, 0xF7B6, 0xF7B6, 0xF795, 0xF7B6, 0xF796, 0xF7B6, 0xA311, 0x8191, 0xBA94, 0x8007, 0xD2F4, 0x0002, 0xF796,
+  0xF796, 0x8003, 0xF797, 0x0004, 0xF7B7, 0xF798, 0xF798, 0xD273, 0x8003, 0xB8D1, 0x8003, 0xB8D1, 0x0001, 0xFF94, 0x8004, 0xFFB5,
+  0x0006, 0xFFB4, 0xFFB5, 0xC493, 0x8191, 0xAA53, 0xD315, 0x8003, 0xD335, 0x0004, 0xD334, 0xD315, 0xD335, 0xE575, 0x800A, 0xFFB5,
+  0x0007, 0xC493, 0x8191, 0xAA53, 0xD335, 0xD335, 0xD314, 0xD315, 0x8003, 0xD335, 0x0005, 0xF675, 0xFFB5, 0xFFB4, 0xFFB5, 0xFFB5,
+  0x8003, 0xFFB4, 0x0006, 0xFFB5, 0xFFB5, 0xFF95, 0xC493, 0x8191, 0xAA53, 0x8004, 0xD335, 0x000D, 0xD315, 0xD315, 0xD335, 0x99F2,
+  0x99F2, 0xD335, 0xD314, 0xD315, 0xD335, 0xD335, 0xD315, 0xD335, 0xDC54, 0x8004, 0xFFB5, 0x0001, 0xFFB4, 0x8005, 0xFFB5, 0x0006,
+  0xFFB4, 0xFFB5, 0x8191, 0x8191, 0xD334, 0xD315, 0x8004, 0xD335, 0x0010, 0xD315, 0xDC34, 0xFFB4, 0xFFB5, 0xFFB5, 0xDE34, 0x8191,
+  0x99F2, 0xD314, 0xD335, 0xD315, 0xD334, 0xD334, 0xD335, 0xD335, 0xE574, 0x8007, 0xFFB5, 0x0004, 0xFFB4, 0xFFB4, 0xFFB5, 0xFFB4,
+  0x8003, 0xFFB5, 0x000A, 0xFFB4, 0xFFB5, 0xFFB5, 0xC4B3, 0x8191, 0xAA53, 0xD335, 0xD335, 0xD314, 0xD315, 0x8003, 0xD335, 0x0001,
+  0xEDF5, 0x8004, 0xFFB5, 0x0003, 0xC493, 0x8191, 0xAA53, 0x8004, 0xD335, 0x0004, 0xD315, 0xD315, 0xD335, 0xF694, 0x8003, 0xFFB5,
+  0x000B, 0xDE14, 0x8191, 0x99F2, 0xD335, 0xD335, 0xD314, 0xD334, 0xD314, 0xD334, 0xD315, 0xE555, 0x8003, 0xFFB5, 0x0001, 0xFFB4,
+  0x8004, 0xFFB5, 0x0003, 0xA332, 0x8191, 0xBAB4, 0x8003, 0xD335, 0x0005, 0xD315, 0xD334, 0xD335, 0xD335, 0xFFB5, 0x8005, 0xFFB6,
+  0x0006, 0xFFB7, 0xFFB8, 0xDBD4, 0xB8D2, 0xB8D1, 0xB8D1, 0x8003, 0xB8D1, 0x8005, 0xFE2E, 0x0005, 0xFE4E, 0xFE4E, 0xC3F0, 0x8191,
+  0xAA73, 0x8007, 0xD355, 0x0001, 0xECD1, 0x800A, 0xFE2E, 0x0003, 0xC3EF, 0x8191, 0xAA73, 0x8006, 0xD355, 0x0007, 0xD354, 0xF590,
+  0xFE4E, 0xFE4E, 0xFE2E, 0xFE2E, 0xFE4E, 0x8005, 0xFE2E, 0x0003, 0xC3EF, 0x8191, 0xAA73, 0x8007, 0xD355, 0x0004, 0x9A12, 0x91F2,
+  0xD355, 0xD354, 0x8005, 0xD355, 0x0002, 0xDBD4, 0xFE4E, 0x8004, 0xFE2E, 0x0003, 0xFE4E, 0xFE2E, 0xFE4E, 0x8003, 0xFE2E, 0x0003,
+  0xFE4E, 0x8191, 0x8191, 0x8007, 0xD355, 0x0007, 0xDC13, 0xFE4E, 0xFE2E, 0xFE2E, 0xE50F, 0x8191, 0x99F2, 0x8006, 0xD355, 0x0002,
+  0xD354, 0xECD1, 0x8008, 0xFE2E, 0x0001, 0xFE4E, 0x8004, 0xFE2E, 0x0007, 0xFE4E, 0xFE4E, 0xFE2E, 0xFE2E, 0xC3CF, 0x8191, 0xAA73,
+  0x8007, 0xD355, 0x0008, 0xE4D1, 0xFE4E, 0xFE2E, 0xFE2E, 0xFE4E, 0xC3D0, 0x8191, 0xAA73, 0x8007, 0xD355, 0x0007, 0xF590, 0xFE4E,
+  0xFE2E, 0xFE2E, 0xE50F, 0x8191, 0x9A12, 0x8007, 0xD355, 0x0004, 0xECD2, 0xFE2E, 0xFE4E, 0xFE2E, 0x8003, 0xFE4E, 0x0005, 0xFE4D,
+  0xFE2F, 0xA2B0, 0x8191, 0xC2F4, 0x8007, 0xD355, 0x0001, 0xFE2F, 0x8003, 0xFE50, 0x0008, 0xFE51, 0xFE51, 0xFE52, 0xFE52, 0xE3D2,
+  0xB8D2, 0xB8D1, 0xB8D1, 0x0007, 0xB8D1, 0xB0D1, 0xB0D2, 0xFC8D, 0xFC6D, 0xFC6D, 0xFC8D, 0x8003, 0xFC6D, 0x0003, 0xC30F, 0x81B1,
+  0xAA73, 0x8003, 0xD395, 0x0005, 0xD375, 0xD395, 0xD395, 0xD375, 0xEC11, 0x8009, 0xFC6D, 0x0019, 0xFC8D, 0xC30F, 0x8191, 0xAA93,
+  0xD375, 0xD375, 0xD395, 0xD395, 0xD375, 0xD395, 0xD396, 0xF42F, 0xFC6D, 0xFC6D, 0xFC8D, 0xFC6D, 0xFC6D, 0xFC8D, 0xFC8D, 0xFC6D,
+  0xFC6D, 0xFC8D, 0xC30F, 0x8191, 0xAA93, 0x8004, 0xD395, 0x0012, 0xD375, 0xD375, 0xD395, 0x9A12, 0x8191, 0xD395, 0xD395, 0xD396,
+  0xD395, 0xD395, 0xD375, 0xD395, 0xD395, 0xF44F, 0xFC8D, 0xFC6D, 0xFC6D, 0xFC8D, 0x8004, 0xFC6D, 0x0005, 0xFC8D, 0xFC8D, 0xFC6D,
+  0x8191, 0x8191, 0x8003, 0xD395, 0x000B, 0xD375, 0xD395, 0xD395, 0xD396, 0xDBD3, 0xFC8D, 0xFC6D, 0xFC6D, 0xE3CE, 0x8191, 0x9A12,
+  0x8003, 0xD395, 0x0001, 0xD376, 0x8003, 0xD395, 0x0001, 0xEC11, 0x8004, 0xFC6D, 0x0002, 0xFC8D, 0xFC8D, 0x8008, 0xFC6D, 0x0007,
+  0xFC8D, 0xFC6D, 0xFC8D, 0xC30F, 0x8191, 0xAA93, 0xD375, 0x8006, 0xD395, 0x0008, 0xEBF1, 0xFC8D, 0xFC6D, 0xFC8D, 0xFC6D, 0xC30F,
+  0x8191, 0xAA93, 0x8004, 0xD395, 0x0016, 0xD375, 0xD375, 0xD395, 0xF42F, 0xFC6D, 0xFC6D, 0xFC8D, 0xE3CE, 0x8191, 0x9A12, 0xD395,
+  0xD395, 0xD375, 0xD395, 0xD376, 0xD395, 0xD395, 0xEBF1, 0xFC8D, 0xFC6D, 0xFC6D, 0xFC8D, 0x8003, 0xFC6D, 0x0005, 0xFC8D, 0xA250,
+  0x8191, 0xC314, 0xD375, 0x8005, 0xD395, 0x0002, 0xD375, 0xFC8E, 0x8003, 0xFC8F, 0x0008, 0xFCB0, 0xFCB0, 0xFCB1, 0xFCB1, 0xF3B2,
+  0xB8D1, 0xB0F1, 0xB8D1, 0x0003, 0xB0F1, 0xB0F1, 0xB0D1, 0x8007, 0xFC8D, 0x0003, 0xC30F, 0x8191, 0xAA93, 0x8007, 0xD395, 0x0001,
+  0xEC11, 0x800A, 0xFC8D, 0x0003, 0xC30F, 0x8191, 0xAA93, 0x8007, 0xD395, 0x0001, 0xF44F, 0x800A, 0xFC8D, 0x0003, 0xC30F, 0x8191,
+  0xAA93, 0x8007, 0xD395, 0x0003, 0x9A12, 0x8191, 0xC334, 0x8007, 0xD395, 0x0002, 0xDBB4, 0xFC8E, 0x800A, 0xFC8D, 0x0002, 0x8191,
+  0x8191, 0x8006, 0xD395, 0x0002, 0xD375, 0xDBD3, 0x8003, 0xFC8D, 0x0003, 0xE3CE, 0x8191, 0x9A12, 0x8007, 0xD395, 0x0001, 0xEC11,
+  0x8011, 0xFC8D, 0x0003, 0xCB2F, 0x8191, 0xAA93, 0x8004, 0xD395, 0x0004, 0xD396, 0xD395, 0xD395, 0xEC11, 0x8004, 0xFC8D, 0x0003,
+  0xC30F, 0x8191, 0xAA93, 0x8007, 0xD395, 0x0001, 0xF44F, 0x8003, 0xFC8D, 0x0003, 0xCB6F, 0x8191, 0x9A32, 0x8007, 0xD395, 0x0001,
+  0xEC11, 0x8008, 0xFC8D, 0x0003, 0xA250, 0x8191, 0xC314, 0x8007, 0xD395, 0x0004, 0xFC8E, 0xFC8F, 0xFCAF, 0xFCAF, 0x8003, 0xFCB0,
+  0x0002, 0xFCB2, 0xF451, 0x8003, 0xB0D1, 0x0007, 0xB0F1, 0xB0F1, 0xB0D1, 0xFCAD, 0xFCCD, 0xFCAD, 0xFCAD, 0x8003, 0xFCCD, 0x0003,
+  0xCB4E, 0x8191, 0xAA73, 0x8007, 0xD395, 0x0002, 0xEC31, 0xFCAD, 0x8009, 0xFCCD, 0x0003, 0xC32F, 0x8991, 0xAA93, 0x8007, 0xD395,
+  0x0001, 0xF46F, 0x8003, 0xFCCD, 0x0001, 0xFCAD, 0x8003, 0xFCCD, 0x8003, 0xFCAD, 0x0003, 0xC32F, 0x8191, 0xAA93, 0x8007, 0xD395,
+  0x0004, 0xBB11, 0x8191, 0xAA73, 0xD396, 0x8003, 0xD395, 0x0001, 0xD396, 0x8003, 0xD395, 0x000D, 0xDBB4, 0xFCAE, 0xFCAD, 0xFCCD,
+  0xFCAD, 0xFCCD, 0xFCAD, 0xFCCD, 0xFCCD, 0xFCAD, 0xFCAD, 0x8191, 0x8191, 0x8006, 0xD395, 0x0008, 0xD375, 0xDBD3, 0xFCAD, 0xFCCD,
+  0xFCCD, 0xDBEE, 0x8191, 0x9A12, 0x8007, 0xD395, 0x0003, 0xEC31, 0xFCCD, 0xFCAD, 0x800B, 0xFCCD, 0x0007, 0xFCAD, 0xFCCD, 0xFCAD,
+  0xFCCD, 0xDBEE, 0x8191, 0x9A12, 0x8007, 0xD395, 0x0001, 0xDBD3, 0x8004, 0xFCCD, 0x0003, 0xC32F, 0x8191, 0xAA93, 0x8007, 0xD395,
+  0x0007, 0xF46F, 0xFCAD, 0xFCCD, 0xFCCD, 0xC32F, 0x8991, 0xAA94, 0x8007, 0xD395, 0x0005, 0xEC31, 0xFCCD, 0xFCCD, 0xFCAD, 0xFCCD,
+  0x8004, 0xFCAD, 0x0003, 0xA270, 0x8191, 0xC314, 0x8007, 0xD395, 0x000C, 0xFCCE, 0xFCCF, 0xFCCF, 0xFCEF, 0xFCD0, 0xFCF0, 0xFCF1,
+  0xFCF1, 0xFCF2, 0xB0F1, 0xB0F1, 0xB0F2, 0x0004, 0xB0F1, 0xA8F1, 0xB0F1, 0xFD0D, 0x8003, 0xFCED, 0x0006, 0xFD0D, 0xFCED, 0xFD0D,
+  0xE42E, 0x8191, 0x9A12, 0x8007, 0xD395, 0x0001, 0xEC51, 0x800A, 0xFCED, 0x0003, 0xC34F, 0x8191, 0xAA93, 0x8007, 0xD395, 0x0001,
+  0xF48F, 0x800A, 0xFCED, 0x0003, 0xC32F, 0x8191, 0xAA93, 0x8007, 0xD395, 0x0003, 0xEC6F, 0x91D1, 0x89D1, 0x8006, 0xD395, 0x0005,
+  0xD396, 0xD395, 0xD395, 0xDBB4, 0xEC70, 0x8005, 0xFCED, 0x0005, 0xFD0D, 0xFCED, 0xFCED, 0x8191, 0x8191, 0x8007, 0xD395, 0x0001,
+  0xDBF3, 0x8003, 0xFCED, 0x0003, 0xE42E, 0x8191, 0x9A12, 0x8007, 0xD395, 0x0001, 0xEC51, 0x800F, 0xFCED, 0x0005, 0xFD0D, 0xFCED,
+  0xEC6E, 0x8191, 0x91F2, 0x8005, 0xD395, 0x000A, 0xD376, 0xD395, 0xD395, 0xF4AF, 0xFD0D, 0xFCED, 0xFD0D, 0xC34F, 0x8191, 0xAA93,
+  0x8007, 0xD395, 0x0001, 0xF48F, 0x8003, 0xFCED, 0x0004, 0xC34F, 0x8191, 0xAA93, 0xD375, 0x8006, 0xD395, 0x0001, 0xEC51, 0x8008,
+  0xFCED, 0x0003, 0xA270, 0x8191, 0xC314, 0x8007, 0xD395, 0x0001, 0xFD0E, 0x8003, 0xFD0F, 0x0005, 0xFD10, 0xFD10, 0xFD31, 0xFD31,
+  0xFD32, 0x8003, 0xB0F1, 0x0003, 0xB0F1, 0xA8F1, 0xB0F1, 0x8007, 0xFD2D, 0x0003, 0xE44E, 0x8191, 0x9A12, 0x8007, 0xD395, 0x0001,
+  0xEC71, 0x800A, 0xFD2D, 0x0003, 0xC34F, 0x8191, 0xAA93, 0x8007, 0xD395, 0x0001, 0xF4CF, 0x800A, 0xFD2D, 0x0003, 0xC34F, 0x8191,
+  0xAA93, 0x8007, 0xD395, 0x0004, 0xF4CF, 0xC34F, 0x8191, 0xB2D4, 0x800A, 0xD395, 0x000A, 0xDBD4, 0xE431, 0xEC71, 0xEC71, 0xDBF0,
+  0xE450, 0xF4CF, 0xFD0E, 0x8191, 0x8191, 0x8007, 0xD395, 0x0009, 0xDBD4, 0xF4AF, 0xF4CF, 0xF4AF, 0xDC10, 0x9A12, 0xAA73, 0xD395,
+  0xD396, 0x8005, 0xD395, 0x0001, 0xEC71, 0x8010, 0xFD2D, 0x0007, 0xFD2C, 0xFD2C, 0x9211, 0x8191, 0xD375, 0xD395, 0xD396, 0x8006,
+  0xD395, 0x0006, 0xEC71, 0xFCEE, 0xFD2D, 0xC36F, 0x8191, 0xAA93, 0x8007, 0xD395, 0x0007, 0xDC10, 0xE44E, 0xDC2E, 0xE44E, 0xB2F0,
+  0x8191, 0xAA93, 0x8007, 0xD395, 0x0001, 0xEC71, 0x8008, 0xFD2D, 0x0003, 0xA270, 0x8191, 0xC314, 0x8007, 0xD395, 0x000C, 0xFD2E,
+  0xFD2F, 0xFD2F, 0xFD4F, 0xFD50, 0xFD50, 0xFD51, 0xFD51, 0xFD71, 0xA8F1, 0xB0F1, 0xB0F2, 0x0003, 0xA8F1, 0xA8F1, 0xA8F2, 0x8004,
+  0xFD6D, 0x0006, 0xFD4D, 0xFD6D, 0xFD6D, 0xE46E, 0x8191, 0x9212, 0x8007, 0xD395, 0x0001, 0xEC71, 0x800A, 0xFD6D, 0x0003, 0xC36F,
+  0x8191, 0xAA93, 0x8007, 0xD395, 0x0001, 0xF4EF, 0x800A, 0xFD6D, 0x0003, 0xC36F, 0x8191, 0xAA93, 0x8007, 0xD395, 0x0009, 0xF4EF,
+  0xFD2D, 0x9211, 0x89B2, 0xCB75, 0xD396, 0xD375, 0xD395, 0xD396, 0x800C, 0xD395, 0x0003, 0xEC91, 0x8191, 0x8191, 0x800C, 0xD395,
+  0x0001, 0xCB95, 0x8008, 0xD395, 0x0001, 0xEC71, 0x800D, 0xFD6D, 0x0001, 0xFD4D, 0x8004, 0xFD6D, 0x0003, 0xBB2F, 0x8191, 0xB2D4,
+  0x800B, 0xD395, 0x0003, 0xC314, 0x8191, 0xAA93, 0x800A, 0xD395, 0x0001, 0xD375, 0x800A, 0xD395, 0x0001, 0xEC71, 0x8008, 0xFD6D,
+  0x0003, 0xA290, 0x8191, 0xC314, 0x8007, 0xD395, 0x0009, 0xFD6E, 0xFD6F, 0xFD6F, 0xFD8F, 0xFD90, 0xFD90, 0xFD91, 0xFD91, 0xFD92,
+  0x8003, 0xA8F1, 0x8003, 0xA8F1, 0x0004, 0xEC6F, 0xFD8D, 0xFDAD, 0xFD8D, 0x8003, 0xFDAD, 0x0003, 0xE48E, 0x8191, 0x9A12, 0x8007,
+  0xD395, 0x0002, 0xEC91, 0xFDAD, 0x8009, 0xFD8D, 0x0003, 0xC38F, 0x8191, 0xAA93, 0x8007, 0xD395, 0x000E, 0xF52F, 0xFDAD, 0xFD8D,
+  0xFDAD, 0xFD8D, 0xFD8D, 0xFDAD, 0xFD8D, 0xFD8D, 0xFDAD, 0xFDAD, 0xC38F, 0x8191, 0xAA93, 0x8007, 0xD395, 0x0005, 0xF52F, 0xFD8D,
+  0xE4AE, 0x8991, 0x9A32, 0x8010, 0xD395, 0x0003, 0xE491, 0x8191, 0x8191, 0x8007, 0xD395, 0x0001, 0xD396, 0x800D, 0xD395, 0x0003,
+  0xEC91, 0xFDAD, 0xFDAD, 0x8008, 0xFD8D, 0x000B, 0xFDAD, 0xFDAD, 0xFD8D, 0xFD8D, 0xFDAD, 0xFDAD, 0xFD8D, 0xFDAD, 0xF52D, 0x8191,
+  0x91F2, 0x8004, 0xD395, 0x0004, 0xD376, 0xD395, 0xD395, 0xD396, 0x8003, 0xD395, 0x0003, 0xC314, 0x8191, 0xAA93, 0x8015, 0xD395,
+  0x0003, 0xEC91, 0xFD8D, 0xFD8D, 0x8005, 0xFDAD, 0x0004, 0xFD8D, 0xA290, 0x8191, 0xC314, 0x8007, 0xD395, 0x0002, 0xFDAF, 0xFDAF,
+  0x8003, 0xFDAD, 0x0004, 0xFD8D, 0xFDAD, 0xFD8D, 0xEC6F, 0x8003, 0xA8F1, 0x8003, 0xA911, 0x0003, 0xEC8E, 0xFDED, 0xFDED, 0x8003,
+  0xFDCD, 0x0004, 0xFDED, 0xE4CE, 0x8191, 0x9A12, 0x8007, 0xD395, 0x0001, 0xECB1, 0x800A, 0xFDCD, 0x0003, 0xC3AF, 0x8191, 0xAA93,
+  0x8007, 0xD395, 0x0004, 0xF54F, 0xFDCD, 0xFDCD, 0xFDED, 0x8005, 0xFDCD, 0x0005, 0xFDED, 0xFDCD, 0xC3AF, 0x8191, 0xAA93, 0x8007,
+  0xD395, 0x0006, 0xF54F, 0xFDED, 0xFDCD, 0xD44F, 0x8191, 0xB2B3, 0x800A, 0xD395, 0x0001, 0xD396, 0x8004, 0xD395, 0x0003, 0xECB1,
+  0x8991, 0x8191, 0x800C, 0xD395, 0x0001, 0xD396, 0x8008, 0xD395, 0x0001, 0xECB1, 0x8013, 0xFDCD, 0x0003, 0xBB6F, 0x8191, 0xBAF4,
+  0x8005, 0xD395, 0x0001, 0xD375, 0x8004, 0xD395, 0x0003, 0xC314, 0x8191, 0xAA93, 0x8015, 0xD395, 0x0005, 0xECB1, 0xFDED, 0xFDED,
+  0xFDCD, 0xFDCD, 0x8004, 0xFDED, 0x0003, 0xA2B0, 0x8191, 0xC314, 0x8006, 0xD395, 0x0004, 0xD375, 0xFDEE, 0xFDEF, 0xFDED, 0x8003,
+  0xFDCD, 0x0003, 0xFDED, 0xFDED, 0xEC8E, 0x8003, 0xA911, 0x0004, 0xA911, 0xA911, 0xA111, 0xE42E, 0x8006, 0xFE0D, 0x0003, 0xE4EE,
+  0x8191, 0x9A12, 0x8007, 0xD395, 0x0001, 0xECD1, 0x800A, 0xFE0D, 0x0003, 0xC3CF, 0x8191, 0xAA93, 0x8007, 0xD395, 0x0001, 0xF56F,
+  0x800A, 0xFE0D, 0x0003, 0xC3CF, 0x8191, 0xAA93, 0x8007, 0xD395, 0x0001, 0xF56F, 0x8003, 0xFE0D, 0x0003, 0xD44F, 0x8191, 0xBAD3,
+  0x8005, 0xD395, 0x0001, 0xD376, 0x8005, 0xD395, 0x0006, 0xD396, 0xD395, 0xD395, 0xECD1, 0x8191, 0x8191, 0x800F, 0xD395, 0x0001,
+  0xD375, 0x8005, 0xD395, 0x0001, 0xECD1, 0x8013, 0xFE0D, 0x0004, 0xF5AD, 0x9A70, 0x89B1, 0xD375, 0x8009, 0xD395, 0x0003, 0xC314,
+  0x8191, 0xAA93, 0x800D, 0xD395, 0x0001, 0xD396, 0x8007, 0xD395, 0x0001, 0xECD1, 0x8003, 0xFE0D, 0x0002, 0xFE0E, 0xFE0D, 0x8003,
+  0xFE0E, 0x0003, 0xA2B0, 0x8191, 0xC314, 0x8007, 0xD395, 0x0002, 0xFE0F, 0xFE0F, 0x8006, 0xFE0D, 0x0004, 0xE42E, 0xA111, 0xA911,
+  0xA911, 0x0004, 0x80F0, 0xA111, 0xA111, 0xC2B0, 0x8006, 0xFE4D, 0x0003, 0xE50E, 0x8191, 0x9A12, 0x8007, 0xD395, 0x0001, 0xECF1,
+  0x800A, 0xFE4D, 0x0003, 0xC3EF, 0x8991, 0xAA93, 0x8003, 0xD395, 0x0001, 0xD375, 0x8003, 0xD395, 0x0001, 0xF58F, 0x800A, 0xFE4D,
+  0x0005, 0xC3EF, 0x8191, 0xAA93, 0xD395, 0xD396, 0x8005, 0xD395, 0x0001, 0xF58F, 0x8004, 0xFE4D, 0x0004, 0xE50E, 0x89D1, 0xA253,
+  0xCB75, 0x8006, 0xD395, 0x0001, 0xD376, 0x8005, 0xD395, 0x0003, 0xECF1, 0x8191, 0x8191, 0x8015, 0xD395, 0x0001, 0xECF1, 0x8014,
+  0xFE4D, 0x0004, 0xF60E, 0x9A70, 0x91F2, 0xCB75, 0x8006, 0xD395, 0x000A, 0xD396, 0xD395, 0xC314, 0x8191, 0xAA93, 0xD395, 0xD396,
+  0xD395, 0xD395, 0xD375, 0x8010, 0xD395, 0x0001, 0xECF2, 0x8003, 0xFE4D, 0x000A, 0xFE4E, 0xFE4D, 0xFE4E, 0xFE4D, 0xFE4E, 0xA2D0,
+  0x8191, 0xC314, 0xD395, 0xD396, 0x8005, 0xD395, 0x0002, 0xFE4E, 0xFE4F, 0x8006, 0xFE4D, 0x0004, 0xC2B0, 0xA111, 0xA111, 0x80F0,
+  0x0005, 0x60EF, 0xA111, 0xA111, 0xA112, 0xFE2D, 0x8005, 0xFE8D, 0x0003, 0xE54E, 0x8191, 0x9A12, 0x8005, 0xD395, 0x0003, 0xD375,
+  0xD395, 0xED11, 0x8009, 0xFE6D, 0x0006, 0xFE8D, 0xC40F, 0x8191, 0xAA93, 0xD395, 0xD396, 0x8004, 0xD395, 0x0003, 0xD375, 0xF5CF,
+  0xFE6D, 0x8008, 0xFE8D, 0x0004, 0xFE6D, 0xC40F, 0x8191, 0xAA93, 0x8007, 0xD395, 0x000A, 0xF5CE, 0xFE6D, 0xFE6D, 0xFE8D, 0xFE6C,
+  0xFE8D, 0xF62D, 0xC40F, 0x9A12, 0xB2D4, 0x800B, 0xD395, 0x0003, 0xECF1, 0x8191, 0x8191, 0x8015, 0xD395, 0x0001, 0xED11, 0x800A,
+  0xFE6D, 0x0001, 0xFE8D, 0x8007, 0xFE6D, 0x0007, 0xFE6C, 0xFE8D, 0xFE6D, 0xFE2D, 0xBBCF, 0x89B1, 0xBAF4, 0x8003, 0xD395, 0x0007,
+  0xD375, 0xD395, 0xD395, 0xD396, 0xC314, 0x8191, 0xAA93, 0x8015, 0xD395, 0x0001, 0xED12, 0x8008, 0xFE8E, 0x0003, 0xA2D0, 0x8191,
+  0xC314, 0x8007, 0xD395, 0x0002, 0xFE8F, 0xFE8F, 0x8005, 0xFE8D, 0x0005, 0xFE2D, 0xA112, 0xA111, 0xA111, 0x60EF, 0x0001, 0x28CD,
+  0x8003, 0xA111, 0x0001, 0xCBCF, 0x8005, 0xFEAD, 0x0003, 0xF5ED, 0x89D1, 0x91D2, 0x8005, 0xD395, 0x0003, 0xD396, 0xD395, 0xED11,
+  0x800A, 0xFEAD, 0x0003, 0xC42F, 0x81B1, 0xAA93, 0x8007, 0xD395, 0x0001, 0xF5EF, 0x8008, 0xFEAD, 0x0008, 0xFECC, 0xFEAD, 0xC42F,
+  0x8191, 0xAA93, 0xD395, 0xD395, 0xD396, 0x8004, 0xD395, 0x000F, 0xF5EF, 0xFEAD, 0xFEAC, 0xFEAD, 0xFEAD, 0xFEAC, 0xFEAD, 0xFEAD,
+  0xF64D, 0xD4CE, 0xBBD0, 0xC3B2, 0xC314, 0xD395, 0xD375, 0x8006, 0xD395, 0x0003, 0xED12, 0x8191, 0x8191, 0x8011, 0xD395, 0x0001,
+  0xD375, 0x8003, 0xD395, 0x0003, 0xED31, 0xFEAC, 0xFEAC, 0x8015, 0xFEAD, 0x0005, 0xEE0D, 0xCC6F, 0xBB51, 0xBAD4, 0xCB55, 0x8004,
+  0xD395, 0x0003, 0xC334, 0x8191, 0xB294, 0x8013, 0xD395, 0x000E, 0xD375, 0xD395, 0xED11, 0xFEAE, 0xFECE, 0xFEAD, 0xFEAE, 0xFEAD,
+  0xFECE, 0xFEAE, 0xFEAE, 0xA2F0, 0x8191, 0xC314, 0x8006, 0xD395, 0x0003, 0xDC34, 0xFEAF, 0xFED0, 0x8005, 0xFEAD, 0x0001, 0xCBCF,
+  0x8003, 0xA111, 0x0001, 0x28CD, 0x0006, 0x18AD, 0x8110, 0x9911, 0xA111, 0xA171, 0xF5ED, 0x8006, 0xFEAD, 0x0009, 0xFEAC, 0xFE6D,
+  0xF5CF, 0xF5EF, 0xF5CF, 0xF5CF, 0xF5EF, 0xF5CF, 0xFE4D, 0x800C, 0xFEAD, 0x0005, 0xFE4E, 0xF5EF, 0xF5EF, 0xF5CF, 0xF5EE, 0x8003,
+  0xF5EF, 0x0001, 0xFE8D, 0x8004, 0xFEAC, 0x0002, 0xFEAD, 0xFE8D, 0x8003, 0xFEAD, 0x0008, 0xFEAC, 0xFEAC, 0xFEAD, 0xF64D, 0xF5EF,
+  0xF5CF, 0xF5EF, 0xF5CF, 0x8003, 0xF5EF, 0x0001, 0xFE6E, 0x8005, 0xFEAD, 0x0002, 0xFEAC, 0xFEAC, 0x8004, 0xFEAD, 0x000C, 0xFEAC,
+  0xFEAD, 0xFEAD, 0xF60E, 0xF5EF, 0xF5CF, 0xF5EF, 0xF5EF, 0xF5CF, 0xF64E, 0xFEAC, 0xFEAD, 0x8010, 0xF5EF, 0x0001, 0xF5CF, 0x8003,
+  0xF5EF, 0x0003, 0xF5CF, 0xFE4D, 0xFEAC, 0x8009, 0xFEAD, 0x0001, 0xFEAC, 0x8009, 0xFEAD, 0x0001, 0xFEAC, 0x8007, 0xFEAD, 0x000E,
+  0xFE6D, 0xF5EF, 0xF5EF, 0xF5CF, 0xF5CF, 0xFEAD, 0xF62E, 0xF5EF, 0xF5D0, 0xF5EF, 0xF5CF, 0xF5F0, 0xF5F0, 0xF5EF, 0x800C, 0xF5F0,
+  0x0004, 0xF5EF, 0xF5F0, 0xFE4F, 0xFECE, 0x8008, 0xFEAE, 0x0003, 0xFEAF, 0xF610, 0xF5D0, 0x8004, 0xF5F0, 0x0001, 0xF610, 0x8003,
+  0xFEAF, 0x8004, 0xFEAD, 0x0006, 0xF5ED, 0xA171, 0xA111, 0x9911, 0x8110, 0x18AD, 0x0002, 0x20AC, 0x38CE, 0x8003, 0x9931, 0x0004,
+  0xAA31, 0xFE2D, 0xFE8C, 0xFE8D, 0x8003, 0xFE8C, 0x000A, 0xFEAD, 0xFE8C, 0xFEAC, 0xFEAC, 0xFE8C, 0xFE8C, 0xFEAC, 0xFEAD, 0xFE8D,
+  0xFE8C, 0x8008, 0xFEAD, 0x0032, 0xFE8C, 0xFE8C, 0xFEAC, 0xFEAC, 0xFEAD, 0xFE8C, 0xFEAD, 0xFE8C, 0xFE8D, 0xFE8D, 0xFE8C, 0xFEAD,
+  0xFE8C, 0xFE8C, 0xFEAD, 0xFEAD, 0xFEAC, 0xFEAC, 0xFE8C, 0xFE8C, 0xFEAC, 0xFE8C, 0xFEAC, 0xFEAD, 0xFEAD, 0xFE8D, 0xFE8C, 0xFEAD,
+  0xFE8D, 0xFE8C, 0xFE8D, 0xFE8C, 0xFE8D, 0xFEAC, 0xFE8C, 0xFEAC, 0xFE8D, 0xFEAD, 0xFEAD, 0xFE8C, 0xFEAC, 0xFE8C, 0xFE8C, 0xFE8D,
+  0xFE8C, 0xFEAC, 0xFE8D, 0xFE8C, 0xFEAD, 0xFEAD, 0x8003, 0xFE8C, 0x0003, 0xFEAD, 0xFE8C, 0xFEAC, 0x8010, 0xFEAD, 0x0007, 0xFE8C,
+  0xFEAC, 0xFE8D, 0xFEAC, 0xFEAD, 0xFEAD, 0xFE8C, 0x8011, 0xFEAD, 0x0004, 0xFEAC, 0xFE8C, 0xFEAD, 0xFE8C, 0x8004, 0xFE8D, 0x8003,
+  0xFEAD, 0x0001, 0xFE8D, 0x8004, 0xFEAD, 0x0006, 0xFE8D, 0xFE8E, 0xFEAD, 0xFEAE, 0xFEAE, 0xFEAD, 0x800C, 0xFEAE, 0x0002, 0xFE8E,
+  0xFE8E, 0x8003, 0xFEAE, 0x0001, 0xFE8E, 0x8003, 0xFEAE, 0x0008, 0xFE8E, 0xFE8E, 0xFEAE, 0xFEAF, 0xFEAE, 0xFEAE, 0xFEAF, 0xFE8E,
+  0x8005, 0xFEAF, 0x0008, 0xFE8F, 0xFEB0, 0xFEAF, 0xFE8C, 0xFE8D, 0xFE8C, 0xFE2D, 0xAA31, 0x8003, 0x9931, 0x0002, 0x38CE, 0x20AC,
+  0x000A, 0x20AD, 0x20AC, 0x60EF, 0x9912, 0x9931, 0x9931, 0xB270, 0xF62D, 0xFE8C, 0xFE8C, 0x8003, 0xFE8D, 0x0002, 0xFE8C, 0xFE8D,
+  0x8004, 0xFE8C, 0x8003, 0xFE8D, 0x8009, 0xFE8C, 0x0003, 0xFE8D, 0xFE8C, 0xFE8C, 0x8003, 0xFE8D, 0x0003, 0xFE8C, 0xFE8D, 0xFE8C,
+  0x8004, 0xFE8D, 0x0001, 0xFE8C, 0x8009, 0xFE8D, 0x0002, 0xFE8C, 0xFE8D, 0x8004, 0xFE8C, 0x0001, 0xFE8D, 0x8003, 0xFE8C, 0x0002,
+  0xFE8D, 0xFE8D, 0x8003, 0xFE8C, 0x0005, 0xFE8D, 0xFE8D, 0xFE8C, 0xFE8C, 0xFE8D, 0x8004, 0xFE8C, 0x0004, 0xFE8D, 0xFE8D, 0xFE8C,
+  0xFE8D, 0x8003, 0xFE8C, 0x8013, 0xFE8D, 0x0006, 0xFE8C, 0xFE8C, 0xFE6D, 0xFE8D, 0xFE8C, 0xFE8D, 0x800B, 0xFE8C, 0x8005, 0xFE8D,
+  0x0001, 0xFE8C, 0x800A, 0xFE8D, 0x0001, 0xFE8E, 0x8005, 0xFE8D, 0x8011, 0xFE8E, 0x000B, 0xFE8F, 0xFE8E, 0xFE8E, 0xFE8F, 0xFE8F,
+  0xFE8E, 0xFE8F, 0xFE8F, 0xFE8E, 0xFE8F, 0xFE8E, 0x800B, 0xFE8F, 0x000D, 0xFE90, 0xFE90, 0xFEB0, 0xFE8C, 0xFE8C, 0xF62D, 0xB270,
+  0x9931, 0x9931, 0x9912, 0x60EF, 0x20AC, 0x20AD, 0x000A, 0x18AC, 0x20AC, 0x28AD, 0x8110, 0x9931, 0x9931, 0x9911, 0xAA31, 0xF5CD,
+  0xFE8C, 0x8016, 0xFE6C, 0x0004, 0xFE6D, 0xFE6C, 0xFE6C, 0xFE6D, 0x800F, 0xFE6C, 0x0001, 0xFE8C, 0x8005, 0xFE6C, 0x0006, 0xFE6D,
+  0xFE6C, 0xFE6C, 0xFE6D, 0xFE6C, 0xFE6D, 0x8004, 0xFE6C, 0x0001, 0xFE6D, 0x800B, 0xFE6C, 0x0001, 0xFE6D, 0x801A, 0xFE6C, 0x0003,
+  0xFE8C, 0xFE6D, 0xFE6D, 0x8012, 0xFE6C, 0x0004, 0xFE6D, 0xFE6C, 0xFE6D, 0xFE6C, 0x8004, 0xFE6D, 0x0001, 0xFE6C, 0x8003, 0xFE6D,
+  0x0005, 0xFE8E, 0xFE8D, 0xFE8D, 0xFE6E, 0xFE8D, 0x800B, 0xFE6E, 0x8004, 0xFE6F, 0x0002, 0xFE8F, 0xFE8F, 0x8003, 0xFE6F, 0x001F,
+  0xFE8F, 0xFE6F, 0xFE6F, 0xFE8F, 0xFE8F, 0xFE6F, 0xFE6F, 0xFE8F, 0xFE6F, 0xFE6F, 0xFE8F, 0xFE8F, 0xFE6F, 0xFE8F, 0xFE8F, 0xFE6F,
+  0xFE90, 0xFE8F, 0xFE8F, 0xFE90, 0xFE90, 0xFE8C, 0xF5CD, 0xAA31, 0x9911, 0x9931, 0x9931, 0x8110, 0x28AD, 0x20AC, 0x18AC, 0x0005,
+  0x20AC, 0x20AC, 0x18AC, 0x28AD, 0x9111, 0x8003, 0x9931, 0x0004, 0xA171, 0xCBCF, 0xF60D, 0xFE4D, 0x8009, 0xFE6D, 0x0001, 0xFE4D,
+  0x800D, 0xFE6D, 0x0003, 0xFE6C, 0xFE6D, 0xFE4D, 0x8005, 0xFE6D, 0x0001, 0xFE4D, 0x8005, 0xFE6D, 0x0003, 0xFE4D, 0xFE6D, 0xFE6C,
+  0x8008, 0xFE6D, 0x0001, 0xFE4D, 0x8003, 0xFE6D, 0x0001, 0xFE4D, 0x8006, 0xFE6D, 0x0003, 0xFE6C, 0xFE6D, 0xFE4D, 0x8009, 0xFE6D,
+  0x0001, 0xFE4D, 0x802D, 0xFE6D, 0x0001, 0xFE4D, 0x8003, 0xFE6D, 0x0005, 0xFE4D, 0xFE6E, 0xFE6E, 0xFE4E, 0xFE6D, 0x8005, 0xFE6E,
+  0x0003, 0xFE6F, 0xFE6E, 0xFE6E, 0x8012, 0xFE6F, 0x0003, 0xFE70, 0xFE70, 0xFE6F, 0x8009, 0xFE70, 0x0001, 0xFE90, 0x8004, 0xFE70,
+  0x8003, 0xFE71, 0x0003, 0xE471, 0xCBCF, 0xA171, 0x8003, 0x9931, 0x0005, 0x9111, 0x28AD, 0x18AC, 0x20AC, 0x20AC, 0x8003, 0x18AC,
+  0x0012, 0x20AC, 0x28CD, 0x8111, 0x9931, 0x9912, 0x9931, 0x9931, 0x9911, 0xBAB0, 0xDC6F, 0xE50F, 0xE50E, 0xFE4E, 0xFE6E, 0xFE4E,
+  0xFE6D, 0xFE4E, 0xFE4E, 0x8061, 0xFE4D, 0x0002, 0xFE4E, 0xFE4E, 0x8006, 0xFE4D, 0x8004, 0xFE4E, 0x0002, 0xFE6E, 0xFE6E, 0x8003,
+  0xFE4E, 0x0005, 0xFE6E, 0xFE6E, 0xFE4E, 0xFE6F, 0xFE6E, 0x8006, 0xFE6F, 0x0004, 0xFE4F, 0xFE6F, 0xFE70, 0xFE50, 0x8010, 0xFE70,
+  0x800D, 0xFE71, 0x0005, 0xF612, 0xE531, 0xE512, 0xD472, 0xB271, 0x8003, 0x9931, 0x0005, 0x9912, 0x9931, 0x8111, 0x28CD, 0x20AC,
+  0x8003, 0x18AC, 0x0008, 0x20AC, 0x20AC, 0x18AC, 0x20AC, 0x20AC, 0x28CC, 0x610F, 0x9911, 0x8008, 0x9931, 0x0001, 0x9932, 0x8076,
+  0x9931, 0x0001, 0x9912, 0x8004, 0x9931, 0x000A, 0x9911, 0x9931, 0x9911, 0x9931, 0x9931, 0x9911, 0x9911, 0x9931, 0x9931, 0x9911,
+  0x8018, 0x9931, 0x000A, 0x9911, 0x9911, 0x9931, 0x9932, 0x9931, 0x9931, 0x9911, 0x9931, 0x9931, 0x9912, 0x8003, 0x9931, 0x0008,
+  0x9911, 0x610F, 0x28CC, 0x20AC, 0x20AC, 0x18AC, 0x20AC, 0x20AC, 0x0002, 0x18AC, 0x18AC, 0x8004, 0x20AC, 0x0006, 0x18AC, 0x40CE,
+  0x7910, 0x9931, 0x9931, 0x9932, 0x8003, 0x9931, 0x0001, 0x9911, 0x80AA, 0x9931, 0x0003, 0x7910, 0x40CE, 0x18AC, 0x8004, 0x20AC,
+  0x0002, 0x18AC, 0x18AC, 0x8008, 0x20AC, 0x000E, 0x18AB, 0x30CC, 0x58CF, 0x7910, 0x9931, 0x9931, 0x9912, 0x9931, 0x9931, 0x9911,
+  0x9931, 0x9911, 0x9932, 0x9931, 0x8097, 0x9911, 0x000E, 0x9931, 0x9932, 0x9911, 0x9931, 0x9911, 0x9931, 0x9931, 0x9912, 0x9931,
+  0x9931, 0x7910, 0x58CF, 0x30CC, 0x18AB, 0x8008, 0x20AC,
+};
+
+#endif // HAS_GRAPHICAL_TFT && TFT_IMAGE_RLE
@@ -0,0 +1,2295 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+// Generated by buildroot/share/scripts/rle16-tft-image.py. Do not edit.
+
+#include "../../../inc/MarlinConfigPre.h"
+
+#if HAS_GRAPHICAL_TFT && ENABLED(TFT_IMAGE_RLE)
+
+extern const uint16_t marlin_logo_320x240x16_rle[36208] = {
+  0x8036, 0x18AD, 0x0002, 0x18AE, 0x18AE, 0x8019, 0x18AD, 0x0003, 0x20AD, 0x18AE, 0x20AD, 0x8012, 0x18AD, 0x0001, 0x18AE, 0x8003,
+  0x18AD, 0x0009, 0x18AE, 0x18AE, 0x18AD, 0x18AD, 0x0119, 0x011A, 0x18AD, 0x18AD, 0x18AE, 0x8006, 0x18AD, 0x0002, 0x0119, 0x0119,
+  0x800A, 0x18AD, 0x0003, 0x011A, 0x0119, 0x18AE, 0x8003, 0x18AD, 0x0001, 0x20AE, 0x8019, 0x18AD, 0x0002, 0x0119, 0x0119, 0x8005,
+  0x18AD, 0x0004, 0x20AD, 0x18AD, 0x18CE, 0x00F8, 0x8004, 0x0119, 0x0005, 0x08F7, 0x18CE, 0x18AD, 0x20AD, 0x18AE, 0x8004, 0x18AD,
+  0x0002, 0x18AE, 0x18AE, 0x8005, 0x18AD, 0x0004, 0x08D5, 0x011A, 0x0119, 0x10D2, 0x8005, 0x18AD, 0x0001, 0x18AE, 0x8005, 0x18AD,
+  0x0006, 0x18AE, 0x28EE, 0x8252, 0xCB54, 0x18AD, 0x18AE, 0x8003, 0x18AD, 0x0001, 0x18CD, 0x8003, 0x18AD, 0x0006, 0x0119, 0x011A,
+  0x10D2, 0x18AD, 0x18AD, 0x18AE, 0x801B, 0x18AD, 0x0002, 0x0119, 0x0119, 0x8006, 0x18AD, 0x0002, 0x0119, 0x0119, 0x8022, 0x18AD,
+  0x0002, 0x0119, 0x0119, 0x8005, 0x18AD, 0x0002, 0x0119, 0x0119, 0x8008, 0x18AD, 0x0002, 0x18AE, 0x18AE, 0x8009, 0x18AD, 0x0001,
+  0x18AE, 0x802B, 0x18AD, 0x0001, 0x18CD, 0x8016, 0x18AD, 0x0002, 0x18AE, 0x18AE, 0x8018, 0x18AD, 0x000A, 0x20AD, 0x18CD, 0x18CD,
+  0x18AE, 0x18AD, 0x18AD, 0x18AE, 0x18AD, 0x0119, 0x0119, 0x8003, 0x18AD, 0x0001, 0x18AE, 0x8005, 0x18AD, 0x0002, 0x0119, 0x0119,
+  0x8009, 0x18AD, 0x0003, 0x20AD, 0x0119, 0x0119, 0x801E, 0x18AD, 0x0002, 0x0119, 0x0119, 0x8007, 0x18AD, 0x000F, 0x08F5, 0x00F9,
+  0x0119, 0x00F7, 0x00F7, 0x0119, 0x0119, 0x08F5, 0x18AE, 0x18AD, 0x18AD, 0x18CD, 0x18AD, 0x18AE, 0x18AE, 0x8003, 0x18AD, 0x0008,
+  0x20AD, 0x18AD, 0x20AE, 0x08F5, 0x0119, 0x0119, 0x10D2, 0x18AE, 0x8004, 0x18AD, 0x0001, 0x20AE, 0x8003, 0x18AD, 0x0015, 0x18AE,
+  0x18AD, 0x20AD, 0x394F, 0xB313, 0xD395, 0x7211, 0x18AD, 0x18AD, 0x20CD, 0x18AD, 0x18AD, 0x20AD, 0x18AD, 0x18AD, 0x18AE, 0x0119,
+  0x00F9, 0x18AD, 0x18AD, 0x18AE, 0x8003, 0x18AD, 0x0001, 0x18AE, 0x8018, 0x18AD, 0x0002, 0x0119, 0x0119, 0x8006, 0x18AD, 0x0002,
+  0x0119, 0x0119, 0x8022, 0x18AD, 0x0002, 0x0119, 0x0119, 0x8005, 0x18AD, 0x0002, 0x0119, 0x0119, 0x800A, 0x18AD, 0x8038, 0x18AD,
+  0x0001, 0x18AE, 0x8030, 0x18AD, 0x0009, 0x18AE, 0x18AD, 0x18AE, 0x18AE, 0x18AD, 0x011A, 0x0119, 0x18AD, 0x18AE, 0x8007, 0x18AD,
+  0x0002, 0x0119, 0x0119, 0x8009, 0x18AD, 0x0006, 0x18AE, 0x0119, 0x011A, 0x18CD, 0x20AD, 0x18CD, 0x801B, 0x18AD, 0x0002, 0x0119,
+  0x0119, 0x8005, 0x18AD, 0x000A, 0x20AD, 0x18AE, 0x0119, 0x011A, 0x08F3, 0x18AD, 0x18AD, 0x08F4, 0x0119, 0x0119, 0x8009, 0x18AD,
+  0x0009, 0x20AD, 0x18AD, 0x18AE, 0x08F5, 0x0119, 0x00F9, 0x10D2, 0x18AD, 0x18AE, 0x8005, 0x18AD, 0x000A, 0x20AD, 0x18AD, 0x18CD,
+  0x18AD, 0x18AD, 0x496F, 0xCB55, 0xD395, 0xBB54, 0x28CE, 0x8003, 0x18AD, 0x0008, 0x20AD, 0x18AE, 0x18AD, 0x18AD, 0x18CD, 0x18AD,
+  0x011A, 0x0119, 0x8003, 0x18AD, 0x0006, 0x18CD, 0x18AD, 0x18AE, 0x18AD, 0x18AD, 0x18AE, 0x8016, 0x18AD, 0x0002, 0x0119, 0x0119,
+  0x8006, 0x18AD, 0x0002, 0x0119, 0x0119, 0x8022, 0x18AD, 0x0002, 0x0119, 0x0119, 0x8005, 0x18AD, 0x0002, 0x0119, 0x0119, 0x8008,
+  0x18AD, 0x0002, 0x20AD, 0x20AD, 0x8050, 0x18AD, 0x0001, 0x18AE, 0x8016, 0x18AD, 0x0001, 0x18AE, 0x8003, 0x18AD, 0x0008, 0x20AD,
+  0x18AD, 0x10D2, 0x011A, 0x0119, 0x10D2, 0x18AD, 0x208D, 0x8006, 0x18AD, 0x0002, 0x0119, 0x0119, 0x800A, 0x18AD, 0x0007, 0x00FA,
+  0x0119, 0x10D2, 0x20AD, 0x18AD, 0x20AD, 0x20AD, 0x8019, 0x18AD, 0x0002, 0x0119, 0x0119, 0x8006, 0x18AD, 0x0009, 0x18AF, 0x0119,
+  0x0119, 0x18D0, 0x18AD, 0x18AD, 0x10D0, 0x0119, 0x0119, 0x8004, 0x18AD, 0x0001, 0x18AE, 0x8005, 0x18AD, 0x0005, 0x18AE, 0x08F5,
+  0x0119, 0x0119, 0x10D2, 0x8007, 0x18AD, 0x0001, 0x18AE, 0x8003, 0x18AD, 0x0002, 0x18AE, 0x61D0, 0x8003, 0xD395, 0x0003, 0x69F1,
+  0x18AD, 0x18AE, 0x8003, 0x18AD, 0x0007, 0x20AD, 0x18AD, 0x18CD, 0x18AD, 0x18AD, 0x0119, 0x0119, 0x8003, 0x18AD, 0x0001, 0x18AE,
+  0x8003, 0x18AD, 0x0001, 0x18CD, 0x8017, 0x18AD, 0x0002, 0x0119, 0x0119, 0x8006, 0x18AD, 0x0002, 0x0119, 0x0119, 0x8022, 0x18AD,
+  0x0002, 0x0119, 0x0119, 0x8005, 0x18AD, 0x0002, 0x0119, 0x0119, 0x800A, 0x18AD, 0x8069, 0x18AD, 0x000A, 0x18AE, 0x18AD, 0x18CE,
+  0x00F7, 0x0119, 0x00F9, 0x011A, 0x011A, 0x00F7, 0x18CE, 0x8006, 0x18AD, 0x0002, 0x0119, 0x0119, 0x800A, 0x18AD, 0x0007, 0x10D2,
+  0x0119, 0x0119, 0x10D2, 0x18AD, 0x18AD, 0x18AE, 0x8019, 0x18AD, 0x0002, 0x0119, 0x0119, 0x8007, 0x18AD, 0x000E, 0x0119, 0x011A,
+  0x08F3, 0x18AD, 0x18AD, 0x10D3, 0x011A, 0x011A, 0x18AD, 0x18AE, 0x18AE, 0x18AD, 0x18AD, 0x18AE, 0x8003, 0x18AD, 0x0007, 0x20AE,
+  0x08F5, 0x0119, 0x00F9, 0x10D2, 0x20AD, 0x18AE, 0x8006, 0x18AD, 0x0001, 0x18AE, 0x8003, 0x18AD, 0x0006, 0x61D0, 0xD395, 0xD395,
+  0xD396, 0xD375, 0x310E, 0x8005, 0x18AD, 0x0007, 0x20AE, 0x18AD, 0x18AD, 0x20AD, 0x18CD, 0x011A, 0x00F9, 0x8006, 0x18AD, 0x0001,
+  0x18AE, 0x8018, 0x18AD, 0x0002, 0x0119, 0x0119, 0x8006, 0x18AD, 0x0002, 0x0119, 0x0119, 0x8022, 0x18AD, 0x0002, 0x0119, 0x0119,
+  0x8005, 0x18AD, 0x0002, 0x0119, 0x0119, 0x8007, 0x18AD, 0x0003, 0x18CD, 0x18AE, 0x18CE, 0x8038, 0x18AD, 0x0001, 0x18AE, 0x8015,
+  0x18AD, 0x0004, 0x18AE, 0x18AD, 0x18AD, 0x18AE, 0x8012, 0x18AD, 0x0004, 0x20AE, 0x18AD, 0x18AD, 0x20AD, 0x8003, 0x18AD, 0x0001,
+  0x08F5, 0x8006, 0x0119, 0x0001, 0x08F5, 0x8006, 0x18AD, 0x0002, 0x0119, 0x0119, 0x800B, 0x18AD, 0x0004, 0x08D4, 0x0119, 0x0119,
+  0x10D2, 0x801B, 0x18AD, 0x0002, 0x0119, 0x0119, 0x8007, 0x18AD, 0x0008, 0x08D5, 0x0119, 0x0119, 0x00F7, 0x0117, 0x0119, 0x0119,
+  0x08F5, 0x8009, 0x18AD, 0x0007, 0x08F5, 0x0119, 0x0119, 0x10D2, 0x20AD, 0x18CD, 0x18AE, 0x8003, 0x18AD, 0x0002, 0x18AE, 0x20AD,
+  0x8004, 0x18AD, 0x0003, 0x392F, 0xD395, 0xD396, 0x8003, 0xD395, 0x0001, 0x28CE, 0x8003, 0x18AD, 0x0001, 0x18AE, 0x8005, 0x18AD,
+  0x0005, 0x18AE, 0x0119, 0x0119, 0x18CD, 0x18AE, 0x801D, 0x18AD, 0x0002, 0x0119, 0x0119, 0x8006, 0x18AD, 0x0002, 0x0119, 0x0119,
+  0x8022, 0x18AD, 0x0002, 0x0119, 0x0119, 0x8005, 0x18AD, 0x0002, 0x0119, 0x0119, 0x8009, 0x18AD, 0x0001, 0x08F5, 0x8009, 0x18AD,
+  0x0001, 0x20AD, 0x8048, 0x18AD, 0x0004, 0x18AE, 0x18AD, 0x18AD, 0x18AE, 0x8004, 0x18AD, 0x0002, 0x18CD, 0x18AE, 0x8005, 0x18AD,
+  0x0001, 0x20AD, 0x8009, 0x18AD, 0x8006, 0x0119, 0x0005, 0x00F9, 0x0119, 0x18AE, 0x18AD, 0x18CD, 0x8003, 0x18AD, 0x0005, 0x0119,
+  0x011A, 0x18AE, 0x18AD, 0x20AD, 0x8005, 0x18AD, 0x0001, 0x20AD, 0x8003, 0x18AD, 0x0007, 0x08F5, 0x0119, 0x0119, 0x10D2, 0x20AD,
+  0x18AD, 0x18CD, 0x800F, 0x18AD, 0x0001, 0x18AE, 0x8004, 0x18AD, 0x0008, 0x20AD, 0x18AD, 0x10D2, 0x0119, 0x00F9, 0x10F2, 0x18AE,
+  0x20AD, 0x8004, 0x18AD, 0x0003, 0x18AE, 0x00F7, 0x011A, 0x8003, 0x0119, 0x0005, 0x00F7, 0x18CE, 0x18AD, 0x18AD, 0x18CD, 0x8003,
+  0x18AD, 0x0007, 0x20AD, 0x18AD, 0x08F5, 0x0119, 0x0119, 0x10D2, 0x18AE, 0x8003, 0x18AD, 0x0004, 0x20AE, 0x18AD, 0x18AD, 0x18AE,
+  0x8004, 0x18AD, 0x0002, 0x310E, 0xCB55, 0x8005, 0xD395, 0x0003, 0x8252, 0x20AD, 0x18AE, 0x8006, 0x18AD, 0x000C, 0x18CD, 0x10D2,
+  0x0119, 0x0119, 0x10D2, 0x18AD, 0x18CD, 0x18AD, 0x20AD, 0x18AD, 0x18CD, 0x18AE, 0x8017, 0x18AD, 0x0002, 0x0119, 0x0119, 0x8004,
+  0x18AD, 0x0007, 0x18AE, 0x10D2, 0x0119, 0x0119, 0x10D2, 0x18AD, 0x20AD, 0x8004, 0x18AD, 0x0001, 0x18AE, 0x8014, 0x18AD, 0x0001,
+  0x18AE, 0x8005, 0x18AD, 0x0002, 0x0119, 0x0119, 0x8005, 0x18AD, 0x0008, 0x0119, 0x011A, 0x18AD, 0x18CD, 0x18AD, 0x18AD, 0x20AD,
+  0x18AE, 0x8003, 0x18AD, 0x0001, 0x0119, 0x8009, 0x18AD, 0x0001, 0x20AD, 0x8047, 0x18AD, 0x0001, 0x18AE, 0x800D, 0x18AD, 0x000C,
+  0x18CE, 0x18AD, 0x18AD, 0x18CD, 0x18AD, 0x18AE, 0x18AE, 0x18AD, 0x18AD, 0x18AE, 0x18AD, 0x18AD, 0x8008, 0x0119, 0x8005, 0x18AD,
+  0x0004, 0x18AE, 0x0119, 0x0119, 0x10F2, 0x8004, 0x18AD, 0x0003, 0x18AE, 0x20AD, 0x20AD, 0x8004, 0x18AD, 0x0006, 0x20AE, 0x08F5,
+  0x0119, 0x00F9, 0x10D2, 0x18AE, 0x8005, 0x18AD, 0x0001, 0x18AE, 0x800F, 0x18AD, 0x0002, 0x18CE, 0x00F7, 0x8004, 0x0119, 0x000C,
+  0x00F7, 0x18CE, 0x18AD, 0x18AE, 0x18AD, 0x20AD, 0x18AD, 0x18AD, 0x10D2, 0x10D3, 0x08F3, 0x10D2, 0x8004, 0x18AD, 0x0002, 0x18AE,
+  0x18CD, 0x8003, 0x18AD, 0x0007, 0x08F5, 0x011A, 0x00F9, 0x10D2, 0x18AE, 0x18AD, 0x18CD, 0x8003, 0x18AD, 0x0001, 0x18AE, 0x8005,
+  0x18AD, 0x0002, 0x18AE, 0xB314, 0x8006, 0xD395, 0x0001, 0x5190, 0x8007, 0x18AD, 0x0008, 0x18CE, 0x00F7, 0x0119, 0x0119, 0x011A,
+  0x011A, 0x00F7, 0x18AE, 0x8003, 0x18AD, 0x0004, 0x18AE, 0x18AD, 0x20AD, 0x18AE, 0x8015, 0x18AD, 0x0002, 0x0119, 0x0119, 0x8003,
+  0x18AD, 0x0008, 0x18CE, 0x00F7, 0x0119, 0x011A, 0x0119, 0x0119, 0x00F7, 0x18CE, 0x8018, 0x18AD, 0x0001, 0x18AE, 0x8005, 0x18AD,
+  0x0003, 0x20AD, 0x00F9, 0x0119, 0x8004, 0x18AD, 0x0003, 0x18AE, 0x0119, 0x011A, 0x8005, 0x18AD, 0x0005, 0x18CD, 0x18AD, 0x18AD,
+  0x18AF, 0x0119, 0x8052, 0x18AD, 0x0004, 0x20AD, 0x18AD, 0x18AE, 0x18AE, 0x8003, 0x18AD, 0x0001, 0x18AE, 0x8007, 0x18AD, 0x0002,
+  0x20AD, 0x18EE, 0x8003, 0x18AD, 0x0001, 0x18AE, 0x8003, 0x18AD, 0x000C, 0x20AE, 0x011A, 0x011A, 0x0119, 0x0119, 0x00F9, 0x0119,
+  0x011A, 0x00F9, 0x18AE, 0x18AD, 0x18AE, 0x8003, 0x18AD, 0x000A, 0x10F2, 0x0119, 0x0119, 0x08F5, 0x18AD, 0x18AD, 0x18AE, 0x18AD,
+  0x18AD, 0x20AD, 0x8005, 0x18AD, 0x0006, 0x18AE, 0x08F5, 0x0119, 0x0119, 0x10D2, 0x18AE, 0x800E, 0x18AD, 0x0003, 0x18AE, 0x18AD,
+  0x18AE, 0x8003, 0x18AD, 0x000D, 0x08F5, 0x011A, 0x0119, 0x011A, 0x0119, 0x0119, 0x011A, 0x08D5, 0x18AD, 0x18AD, 0x18AE, 0x18AD,
+  0x18AE, 0x8006, 0x18AD, 0x0002, 0x20AD, 0x18AE, 0x8004, 0x18AD, 0x0006, 0x20AD, 0x08F5, 0x011A, 0x0119, 0x10D2, 0x18CD, 0x800C,
+  0x18AD, 0x0001, 0x8252, 0x8007, 0xD395, 0x0002, 0x412F, 0x20AD, 0x8006, 0x18AD, 0x0001, 0x08F5, 0x8004, 0x0119, 0x0003, 0x011A,
+  0x0119, 0x08D5, 0x801C, 0x18AD, 0x0002, 0x0119, 0x0119, 0x8003, 0x18AD, 0x0002, 0x08F5, 0x011A, 0x8004, 0x0119, 0x0002, 0x011A,
+  0x08F5, 0x8003, 0x18AD, 0x0003, 0x18AE, 0x18AD, 0x18AE, 0x8011, 0x18AD, 0x0002, 0x18AE, 0x18AE, 0x8005, 0x18AD, 0x000A, 0x08F4,
+  0x0119, 0x0119, 0x18AD, 0x18AD, 0x20AE, 0x20AD, 0x18AE, 0x0119, 0x0119, 0x8003, 0x18AD, 0x0002, 0x18CD, 0x18AE, 0x8004, 0x18AD,
+  0x0001, 0x011A, 0x804D, 0x18AD, 0x000D, 0x18AE, 0x18AD, 0x18AE, 0x20AD, 0x18AD, 0x18CD, 0x18AE, 0x18AD, 0x18AD, 0x18AE, 0x18CD,
+  0x18CD, 0x20AD, 0x8008, 0x18AD, 0x0004, 0x0355, 0x190F, 0x18AD, 0x20AD, 0x8004, 0x18AD, 0x0003, 0x18AE, 0x08F4, 0x011A, 0x8005,
+  0x0119, 0x0001, 0x08F5, 0x8004, 0x18AD, 0x000C, 0x20AD, 0x18AD, 0x20AE, 0x10D2, 0x0119, 0x011A, 0x08F5, 0x18AD, 0x18AD, 0x18AE,
+  0x18AD, 0x18AE, 0x8004, 0x18AD, 0x0009, 0x20AD, 0x18AD, 0x18AE, 0x08F5, 0x0119, 0x0119, 0x10D2, 0x18AD, 0x18AE, 0x800E, 0x18AD,
+  0x000C, 0x18AE, 0x18AD, 0x18AD, 0x18AE, 0x0119, 0x0119, 0x00F9, 0x0119, 0x0119, 0x011A, 0x0119, 0x0119, 0x8005, 0x18AD, 0x0004,
+  0x18CD, 0x18AD, 0x18AD, 0x208E, 0x8004, 0x18AD, 0x000A, 0x20AD, 0x18AD, 0x18AE, 0x18AD, 0x08F5, 0x0119, 0x00F9, 0x10D2, 0x18CD,
+  0x18AE, 0x8009, 0x18AD, 0x0003, 0x18AE, 0x18AD, 0x496F, 0x8006, 0xD395, 0x0004, 0xD396, 0xD395, 0x496F, 0x20AD, 0x8005, 0x18AD,
+  0x0001, 0x18AE, 0x8008, 0x0119, 0x801C, 0x18AD, 0x0002, 0x0119, 0x0119, 0x8003, 0x18AD, 0x0002, 0x00F9, 0x0119, 0x8003, 0x011A,
+  0x8003, 0x0119, 0x0004, 0x18AE, 0x18AD, 0x18AD, 0x18AE, 0x8012, 0x18AD, 0x0001, 0x18AE, 0x8003, 0x18AD, 0x0008, 0x20AD, 0x18AD,
+  0x20AE, 0x08F5, 0x0119, 0x0119, 0x10D2, 0x18AE, 0x8004, 0x18AD, 0x000C, 0x0119, 0x0119, 0x18AD, 0x20AD, 0x18AE, 0x18AE, 0x18AD,
+  0x18AD, 0x20AD, 0x18AD, 0x18AD, 0x08F5, 0x804E, 0x18AD, 0x0001, 0x18CD, 0x8005, 0x18AD, 0x0003, 0x18AE, 0x18AD, 0x18AE, 0x8005,
+  0x18AD, 0x0008, 0x20AD, 0x18AD, 0x20AD, 0x18AD, 0x18AD, 0x11D1, 0x03B7, 0x0A93, 0x8005, 0x18AD, 0x000A, 0x18AE, 0x18AD, 0x18AE,
+  0x00F7, 0x0119, 0x0119, 0x00F9, 0x011A, 0x00F7, 0x18CE, 0x8004, 0x18AD, 0x000E, 0x18AE, 0x18AD, 0x18AD, 0x20AE, 0x10D2, 0x011A,
+  0x0119, 0x08F5, 0x18AD, 0x18AD, 0x18AE, 0x18AD, 0x18AD, 0x18AE, 0x8003, 0x18AD, 0x0009, 0x20AD, 0x18AD, 0x20AE, 0x08F5, 0x0119,
+  0x00F9, 0x10D2, 0x18CD, 0x18AE, 0x8010, 0x18AD, 0x0001, 0x18AE, 0x8005, 0x0119, 0x0003, 0x011A, 0x0119, 0x0119, 0x8003, 0x18AD,
+  0x0005, 0x20AD, 0x18AD, 0x20AD, 0x18AD, 0x18CD, 0x8003, 0x18AD, 0x0001, 0x18AE, 0x8003, 0x18AD, 0x0007, 0x18AE, 0x08F5, 0x0119,
+  0x0119, 0x10D2, 0x18AD, 0x18AE, 0x8007, 0x18AD, 0x0006, 0x18AE, 0x18AD, 0x18AD, 0x20AD, 0x28EE, 0xBB34, 0x8008, 0xD395, 0x0001,
+  0x9AB3, 0x8007, 0x18AD, 0x8003, 0x0119, 0x0002, 0x00F9, 0x00F9, 0x8003, 0x0119, 0x0002, 0x18AD, 0x18AE, 0x8003, 0x18AD, 0x0001,
+  0x18AE, 0x8016, 0x18AD, 0x0007, 0x0119, 0x0119, 0x18AD, 0x18AD, 0x10AF, 0x0119, 0x011A, 0x8006, 0x0119, 0x0001, 0x18AE, 0x8018,
+  0x18AD, 0x0014, 0x20AD, 0x18AD, 0x18AE, 0x08F5, 0x0119, 0x0119, 0x10D2, 0x18AD, 0x18AE, 0x18AD, 0x18AD, 0x20AD, 0x18AD, 0x011A,
+  0x011A, 0x18AD, 0x18AE, 0x18AD, 0x18AD, 0x18AE, 0x8004, 0x18AD, 0x0001, 0x18CE, 0x804C, 0x18AD, 0x0009, 0x20AD, 0x208D, 0x18AD,
+  0x10D2, 0x08F3, 0x10D3, 0x10D2, 0x18AD, 0x20AD, 0x8003, 0x18AD, 0x0001, 0x18AE, 0x8008, 0x18AD, 0x0004, 0x0356, 0x03B7, 0x03B7,
+  0x190F, 0x8008, 0x18AD, 0x0004, 0x10D2, 0x08F3, 0x08D4, 0x10D2, 0x8004, 0x18AD, 0x0001, 0x18AE, 0x8006, 0x18AD, 0x0004, 0x10D2,
+  0x00F9, 0x0119, 0x08F5, 0x8005, 0x18AD, 0x0002, 0x18AE, 0x18AE, 0x8005, 0x18AD, 0x0005, 0x08F5, 0x011A, 0x0119, 0x10D2, 0x18CD,
+  0x800B, 0x18AD, 0x0009, 0x18AE, 0x20AD, 0x18AD, 0x20AD, 0x18AE, 0x18AD, 0x0119, 0x0119, 0x00FA, 0x8005, 0x0119, 0x8003, 0x18AD,
+  0x0001, 0x20AD, 0x8007, 0x18AD, 0x0001, 0x20AD, 0x8003, 0x18AD, 0x0005, 0x08F5, 0x0119, 0x0119, 0x10D2, 0x18AE, 0x8007, 0x18AD,
+  0x0014, 0x20AD, 0x18AE, 0x18AD, 0x18AE, 0x18AD, 0x18AD, 0x7A31, 0xD395, 0xD395, 0xD375, 0xDB95, 0xD395, 0xD395, 0xD396, 0xD395,
+  0xD395, 0xD396, 0x18AD, 0x18AD, 0x20AD, 0x8004, 0x18AD, 0x0003, 0x0119, 0x011A, 0x011A, 0x8004, 0x0119, 0x0002, 0x00F9, 0x18AE,
+  0x801B, 0x18AD, 0x000A, 0x0119, 0x0119, 0x18AD, 0x18AD, 0x18AE, 0x0119, 0x011A, 0x0119, 0x0119, 0x011A, 0x8003, 0x0119, 0x0006,
+  0x18AD, 0x18AE, 0x20AD, 0x18AD, 0x20AD, 0x18AE, 0x8014, 0x18AD, 0x0011, 0x18AE, 0x08F5, 0x0119, 0x0119, 0x10D2, 0x20AD, 0x18AD,
+  0x18AD, 0x18AE, 0x18AD, 0x18AD, 0x20AD, 0x0119, 0x0119, 0x18AD, 0x18AD, 0x20AD, 0x8007, 0x18AD, 0x8009, 0x18AD, 0x0001, 0x20AD,
+  0x8042, 0x18AD, 0x000B, 0x18AE, 0x18AE, 0x00F7, 0x0119, 0x00F9, 0x0119, 0x0119, 0x00F7, 0x18CE, 0x18AD, 0x18AE, 0x8008, 0x18AD,
+  0x0007, 0x18CE, 0x11D1, 0x03B8, 0x03B7, 0x03B8, 0x0A94, 0x20AE, 0x8005, 0x18AD, 0x0007, 0x18AE, 0x18AD, 0x20AD, 0x18AD, 0x18AD,
+  0x18CD, 0x18AE, 0x8004, 0x18AD, 0x0002, 0x20AD, 0x18AE, 0x8004, 0x18AD, 0x000B, 0x20AD, 0x10D2, 0x00F9, 0x0119, 0x08F5, 0x18AD,
+  0x18AD, 0x20AD, 0x18AD, 0x18AD, 0x18AE, 0x8006, 0x18AD, 0x0007, 0x08F5, 0x011A, 0x00F9, 0x10D2, 0x18AE, 0x18AD, 0x18CD, 0x8008,
+  0x18AD, 0x0015, 0x18AE, 0x18AD, 0x18AD, 0x18AE, 0x18AD, 0x20AD, 0x08F5, 0x00F9, 0x011A, 0x0119, 0x011A, 0x0119, 0x011A, 0x08F5,
+  0x20AE, 0x18AD, 0x18CD, 0x18AD, 0x18CD, 0x18AE, 0x18AE, 0x8007, 0x18AD, 0x0005, 0x08D5, 0x0119, 0x0119, 0x10D2, 0x18AE, 0x8005,
+  0x18AD, 0x0009, 0x18AE, 0x18AD, 0x20AE, 0x18AD, 0x18CD, 0x18AD, 0x20AD, 0x18AD, 0x310E, 0x8005, 0xD395, 0x0006, 0xD396, 0xD395,
+  0xD396, 0xD395, 0xD395, 0xB313, 0x8003, 0x18AD, 0x0001, 0x20AD, 0x8003, 0x18AD, 0x0003, 0x08F5, 0x011A, 0x0119, 0x8003, 0x011A,
+  0x0007, 0x0119, 0x08F5, 0x18AD, 0x20AD, 0x18AD, 0x18AD, 0x18AE, 0x8017, 0x18AD, 0x0002, 0x0119, 0x0119, 0x8003, 0x18AD, 0x0001,
+  0x08F5, 0x8005, 0x0119, 0x0008, 0x00F9, 0x08F5, 0x20AD, 0x18AD, 0x18AE, 0x18AD, 0x18AD, 0x18AE, 0x8013, 0x18AD, 0x0005, 0x20AE,
+  0x08F5, 0x0119, 0x00F9, 0x10D2, 0x8007, 0x18AD, 0x0004, 0x10D2, 0x0119, 0x011A, 0x10D2, 0x8003, 0x18AD, 0x0001, 0x18AE, 0x8005,
+  0x18AD, 0x804D, 0x18AD, 0x0008, 0x08F5, 0x011A, 0x0119, 0x011A, 0x011A, 0x0119, 0x0119, 0x08F5, 0x8003, 0x18AD, 0x0012, 0x20AD,
+  0x18AD, 0x18AD, 0x20AE, 0x18AD, 0x18AE, 0x18AD, 0x18AD, 0x0356, 0x03B7, 0x03B7, 0x03B8, 0x03B7, 0x190E, 0x18AE, 0x18AD, 0x18AD,
+  0x20AD, 0x8007, 0x18AD, 0x0001, 0x20AD, 0x800A, 0x18AD, 0x0006, 0x18CD, 0x20AD, 0x10D2, 0x011A, 0x011A, 0x08F5, 0x8005, 0x18AD,
+  0x0001, 0x18AE, 0x8004, 0x18AD, 0x0007, 0x20AD, 0x18AD, 0x08F5, 0x0119, 0x0119, 0x10D2, 0x18AE, 0x800A, 0x18AD, 0x0002, 0x18CD,
+  0x18AE, 0x8003, 0x18AD, 0x0008, 0x18AE, 0x0117, 0x0119, 0x011A, 0x0119, 0x0119, 0x00F7, 0x18AE, 0x800A, 0x18AD, 0x000A, 0x18AE,
+  0x18AD, 0x20AD, 0x08F5, 0x0119, 0x00F9, 0x10D2, 0x18AD, 0x18AD, 0x18CD, 0x8009, 0x18AD, 0x0004, 0x20AE, 0x18AD, 0x18AE, 0xA2D3,
+  0x8009, 0xD395, 0x0002, 0xD396, 0xA2D3, 0x8007, 0x18AD, 0x0002, 0x18AE, 0x0117, 0x8004, 0x0119, 0x0002, 0x0117, 0x18CE, 0x8003,
+  0x18AD, 0x0003, 0x18AE, 0x18AD, 0x20AD, 0x8016, 0x18AD, 0x0002, 0x0119, 0x0119, 0x8003, 0x18AD, 0x0008, 0x18AE, 0x0117, 0x00F9,
+  0x0119, 0x011A, 0x0119, 0x0117, 0x18AE, 0x8003, 0x18AD, 0x0002, 0x18AE, 0x18CD, 0x8014, 0x18AD, 0x0005, 0x08F5, 0x0119, 0x0119,
+  0x10D2, 0x20AD, 0x8003, 0x18AD, 0x000B, 0x20AD, 0x18AD, 0x18CE, 0x00F7, 0x011A, 0x011A, 0x0119, 0x0119, 0x00F7, 0x18AE, 0x18AE,
+  0x8004, 0x18AD, 0x0002, 0x20AE, 0x18AD, 0x804D, 0x18AD, 0x8008, 0x0119, 0x0003, 0x18CD, 0x18AD, 0x20AE, 0x8003, 0x18AD, 0x0001,
+  0x20AD, 0x8003, 0x18AD, 0x0002, 0x11D1, 0x03B8, 0x8004, 0x03B7, 0x0001, 0x0A94, 0x8004, 0x18AD, 0x0001, 0x20AE, 0x8003, 0x18AD,
+  0x0001, 0x20AE, 0x800E, 0x18AD, 0x0009, 0x18CD, 0x20AE, 0x10D2, 0x0119, 0x0119, 0x08F5, 0x18AD, 0x18AD, 0x20AD, 0x8005, 0x18AD,
+  0x0001, 0x20AD, 0x8003, 0x18AD, 0x0005, 0x08F5, 0x0119, 0x0119, 0x10D2, 0x20AD, 0x8010, 0x18AD, 0x0008, 0x10D2, 0x08D4, 0x08F3,
+  0x10D2, 0x18CD, 0x18AD, 0x18AD, 0x18CD, 0x800B, 0x18AD, 0x0003, 0x0119, 0x0119, 0x18B0, 0x800F, 0x18AD, 0x0001, 0x496F, 0x800B,
+  0xD395, 0x0001, 0xAAD3, 0x8005, 0x18AD, 0x0009, 0x18AE, 0x18AD, 0x18AD, 0x18CD, 0x10D1, 0x08F3, 0x08F3, 0x10D2, 0x18CD, 0x801D,
+  0x18AD, 0x000B, 0x0119, 0x0119, 0x18AD, 0x18CD, 0x18AD, 0x18AD, 0x18CD, 0x10D2, 0x08F3, 0x08D4, 0x10D2, 0x8011, 0x18AD, 0x0005,
+  0x20AD, 0x18AD, 0x18AE, 0x18AD, 0x18AE, 0x8004, 0x18AD, 0x0008, 0x08F4, 0x0119, 0x0119, 0x10D1, 0x18AD, 0x20AD, 0x18AD, 0x20AD,
+  0x8003, 0x18AD, 0x0002, 0x08F5, 0x00F9, 0x8005, 0x0119, 0x0004, 0x08F5, 0x18AD, 0x20AD, 0x18AE, 0x8004, 0x18AD, 0x800A, 0x18AD,
+  0x8044, 0x0119, 0x0007, 0x011A, 0x011A, 0x0119, 0x0119, 0x011A, 0x0119, 0x011A, 0x800A, 0x18AD, 0x0002, 0x0356, 0x03B8, 0x8005,
+  0x03B7, 0x0006, 0x190F, 0x18AD, 0x18AD, 0x20AD, 0x18AD, 0x18AE, 0x8003, 0x18AD, 0x0001, 0x18CD, 0x8010, 0x18AD, 0x0004, 0x10D2,
+  0x00F9, 0x0119, 0x08F5, 0x8004, 0x18AD, 0x0003, 0x18AE, 0x20AD, 0x20AD, 0x8004, 0x18AD, 0x0005, 0x20AE, 0x08F5, 0x0119, 0x00F9,
+  0x10D2, 0x8013, 0x18AD, 0x0001, 0x18AE, 0x800C, 0x18AD, 0x0008, 0x18CD, 0x18AD, 0x18AD, 0x011A, 0x0119, 0x18CE, 0x18AD, 0x18AE,
+  0x800A, 0x18AD, 0x0004, 0x18AE, 0x18AD, 0x18AD, 0xB314, 0x800C, 0xD395, 0x0003, 0x61D0, 0x18AD, 0x18CD, 0x8009, 0x18AD, 0x0001,
+  0x18AE, 0x801E, 0x18AD, 0x0002, 0x0119, 0x0119, 0x8005, 0x18AD, 0x0001, 0x18AE, 0x8016, 0x18AD, 0x0003, 0x18CD, 0x18CD, 0x20AD,
+  0x8003, 0x18AD, 0x0015, 0x08F5, 0x011A, 0x0119, 0x10D2, 0x18AE, 0x18AD, 0x18CD, 0x18AD, 0x18AD, 0x18CD, 0x18AE, 0x18AD, 0x0119,
+  0x0119, 0x011A, 0x0119, 0x0119, 0x011A, 0x0119, 0x0119, 0x18AE, 0x8006, 0x18AD, 0x800A, 0x18AD, 0x8044, 0x0119, 0x0003, 0x00F9,
+  0x0119, 0x011A, 0x8003, 0x0119, 0x0001, 0x00F9, 0x8005, 0x18AD, 0x0001, 0x18AE, 0x8004, 0x18AD, 0x0005, 0x20AD, 0x18AD, 0x0397,
+  0x03B8, 0x03B7, 0x8003, 0x18AD, 0x0004, 0x18AE, 0x18AE, 0x18AD, 0x20AE, 0x8003, 0x18AD, 0x0002, 0x20AE, 0x18CD, 0x8010, 0x18AD,
+  0x000B, 0x18AE, 0x10D2, 0x00F9, 0x0119, 0x08F5, 0x18AD, 0x18AD, 0x18AE, 0x18AD, 0x18AD, 0x20AD, 0x8005, 0x18AD, 0x0005, 0x18AE,
+  0x08F5, 0x0119, 0x0119, 0x10D2, 0x8003, 0x18AD, 0x0001, 0x20AD, 0x800B, 0x18AD, 0x0001, 0x18AE, 0x8003, 0x18AD, 0x0004, 0x18AE,
+  0x18AD, 0x18AD, 0x20AD, 0x800B, 0x18AD, 0x0002, 0x011A, 0x011A, 0x800D, 0x18AD, 0x0005, 0x18AE, 0x18AD, 0x59D0, 0xD395, 0xD375,
+  0x8009, 0xD395, 0x0009, 0xD396, 0xD395, 0xD396, 0x18AD, 0x18AD, 0x18AE, 0x18AD, 0x18AD, 0x18AE, 0x8004, 0x18AD, 0x0001, 0x18AE,
+  0x801F, 0x18AD, 0x0007, 0x0119, 0x0119, 0x18AD, 0x20AD, 0x18AD, 0x18AD, 0x18AE, 0x8003, 0x18AD, 0x0001, 0x18AE, 0x8018, 0x18AD,
+  0x0005, 0x08F4, 0x011A, 0x0119, 0x10D2, 0x20AD, 0x8005, 0x18AD, 0x0003, 0x18AE, 0x18AD, 0x18AD, 0x8004, 0x0119, 0x0004, 0x011A,
+  0x0119, 0x0119, 0x011A, 0x8007, 0x18AD, 0x804D, 0x18AD, 0x0003, 0x08F5, 0x0119, 0x011A, 0x8003, 0x0119, 0x0002, 0x011A, 0x08F5,
+  0x8003, 0x18AD, 0x8003, 0x20AD, 0x8004, 0x18AD, 0x0002, 0x18AE, 0x18AD, 0x8003, 0x03B7, 0x0010, 0x20AD, 0x18AD, 0x18AD, 0x20AD,
+  0x03B7, 0x03B7, 0x0397, 0x03B7, 0x03B8, 0x03B7, 0x03B7, 0x18AD, 0x18AD, 0x18AE, 0x20AD, 0x20AD, 0x800D, 0x18AD, 0x000A, 0x18AE,
+  0x10D2, 0x0119, 0x011A, 0x08F5, 0x18AD, 0x18AD, 0x18AE, 0x18AD, 0x18AE, 0x8004, 0x18AD, 0x0008, 0x20AD, 0x18AD, 0x18AE, 0x08F5,
+  0x0119, 0x011A, 0x10D1, 0x20AE, 0x8011, 0x18AD, 0x0001, 0x18AE, 0x800B, 0x18AD, 0x0005, 0x18AE, 0x18AD, 0x18AD, 0x0119, 0x0119,
+  0x800C, 0x18AD, 0x0004, 0x20AD, 0x18AD, 0x18AD, 0xBB34, 0x800D, 0xD395, 0x0004, 0xAAD3, 0x20AD, 0x18AD, 0x18AE, 0x8003, 0x18AD,
+  0x0001, 0x18AE, 0x8005, 0x18AD, 0x0001, 0x18AE, 0x801D, 0x18AD, 0x0002, 0x0119, 0x0119, 0x8004, 0x18AD, 0x0001, 0x18AE, 0x8018,
+  0x18AD, 0x000A, 0x20AE, 0x18AD, 0x18AD, 0x08F5, 0x0119, 0x00F9, 0x10D2, 0x18CD, 0x18AD, 0x20AD, 0x8007, 0x18AD, 0x0001, 0x011A,
+  0x8006, 0x0119, 0x0003, 0x011A, 0x18AD, 0x18AE, 0x8005, 0x18AD, 0x804D, 0x18AD, 0x000A, 0x18CE, 0x00F7, 0x0119, 0x0119, 0x011A,
+  0x0119, 0x00F7, 0x18CE, 0x18AD, 0x18AE, 0x8006, 0x18AD, 0x0004, 0x20AD, 0x18AD, 0x18AD, 0x20AD, 0x8003, 0x03B7, 0x0004, 0x18AE,
+  0x20AD, 0x18AD, 0x18AD, 0x8005, 0x03B7, 0x0005, 0x0397, 0x03B7, 0x18AD, 0x18AD, 0x18AE, 0x800B, 0x18AD, 0x0003, 0x18AE, 0x18AD,
+  0x20AE, 0x8003, 0x18AD, 0x000A, 0x10D2, 0x011A, 0x0119, 0x08F5, 0x18AD, 0x18AD, 0x18AE, 0x18AD, 0x18AD, 0x18AE, 0x8003, 0x18AD,
+  0x0009, 0x20AD, 0x18AD, 0x20AE, 0x08F5, 0x011A, 0x0119, 0x10D2, 0x18AD, 0x18AE, 0x801E, 0x18AD, 0x0003, 0x011A, 0x0119, 0x18AE,
+  0x800A, 0x18AD, 0x0007, 0x20AD, 0x18AD, 0x18AD, 0x61B1, 0xD395, 0xD395, 0xD375, 0x800B, 0xD395, 0x0001, 0x8A92, 0x802A, 0x18AD,
+  0x0002, 0x0119, 0x0119, 0x801B, 0x18AD, 0x0001, 0x20AD, 0x8003, 0x18AD, 0x0004, 0x08F5, 0x0119, 0x0119, 0x10D2, 0x8005, 0x18AD,
+  0x0001, 0x18AE, 0x8004, 0x18AD, 0x0005, 0x20AD, 0x08F5, 0x011A, 0x0119, 0x011A, 0x8003, 0x0119, 0x0001, 0x08F4, 0x8007, 0x18AD,
+  0x804C, 0x18AD, 0x0009, 0x20AD, 0x188D, 0x18AD, 0x10D2, 0x08F3, 0x08F3, 0x10D2, 0x18AD, 0x20AD, 0x8007, 0x18AD, 0x0005, 0x20AD,
+  0x18AD, 0x18AE, 0x18AD, 0x18AD, 0x8003, 0x03B7, 0x0007, 0x18AD, 0x18AD, 0x18CD, 0x20AD, 0x03B8, 0x03B7, 0x03B8, 0x8004, 0x03B7,
+  0x8004, 0x18AD, 0x0001, 0x18CD, 0x8009, 0x18AD, 0x0001, 0x20AD, 0x8005, 0x18AD, 0x0005, 0x20AE, 0x10D2, 0x00F9, 0x0119, 0x08F5,
+  0x8005, 0x18AD, 0x0002, 0x18AE, 0x18AE, 0x8005, 0x18AD, 0x0007, 0x08F5, 0x0119, 0x0119, 0x10D2, 0x18AD, 0x18CD, 0x20AD, 0x801C,
+  0x18AD, 0x0005, 0x0119, 0x0119, 0x18AD, 0x18AD, 0x18AE, 0x8009, 0x18AD, 0x0005, 0x20AE, 0x18AD, 0xAAD3, 0xD395, 0xD375, 0x800A,
+  0xD395, 0x0004, 0xD375, 0xD395, 0xD395, 0x310E, 0x8029, 0x18AD, 0x0002, 0x0119, 0x0119, 0x801D, 0x18AD, 0x0008, 0x18AE, 0x18AD,
+  0x0119, 0x0119, 0x10D1, 0x18AE, 0x18AD, 0x18AE, 0x8005, 0x18AD, 0x0001, 0x18AE, 0x8003, 0x18AD, 0x0002, 0x18CE, 0x00F7, 0x8004,
+  0x0119, 0x0005, 0x00F7, 0x18CE, 0x18AD, 0x18AD, 0x20AD, 0x8004, 0x18AD, 0x804E, 0x18AD, 0x0001, 0x18AE, 0x8005, 0x18AD, 0x0004,
+  0x18AE, 0x18AD, 0x18AD, 0x18AE, 0x8009, 0x18AD, 0x0003, 0x03D7, 0x0397, 0x03B7, 0x8004, 0x18AD, 0x000B, 0x03B7, 0x03B8, 0x0397,
+  0x03B7, 0x03B8, 0x03B7, 0x03B7, 0x18AD, 0x18AE, 0x18AD, 0x18CD, 0x800B, 0x18AD, 0x0002, 0x20AD, 0x18AE, 0x8003, 0x18AD, 0x000C,
+  0x18CD, 0x20AD, 0x10D2, 0x00F9, 0x0119, 0x08F5, 0x18AD, 0x18AD, 0x20AD, 0x18AD, 0x18AD, 0x18AE, 0x8005, 0x18AD, 0x0008, 0x18AE,
+  0x08F5, 0x0119, 0x0119, 0x10D0, 0x18AD, 0x18AD, 0x18CD, 0x800C, 0x18AD, 0x0001, 0x18AE, 0x800D, 0x18AD, 0x0003, 0x20AD, 0x0119,
+  0x011A, 0x800C, 0x18AD, 0x0002, 0x20AE, 0x496F, 0x800E, 0xD395, 0x0005, 0xD375, 0xD395, 0x7231, 0x18AD, 0x18AE, 0x8003, 0x18AD,
+  0x0003, 0x18AE, 0x18AD, 0x18AE, 0x8021, 0x18AD, 0x0002, 0x0119, 0x0119, 0x8004, 0x18AD, 0x0001, 0x18AE, 0x8015, 0x18AD, 0x0007,
+  0x18AE, 0x18CD, 0x18AE, 0x18AD, 0x18AD, 0x0119, 0x0119, 0x8004, 0x18AD, 0x0008, 0x20AD, 0x18AD, 0x18AE, 0x18AD, 0x18CD, 0x18AD,
+  0x20AD, 0x18AE, 0x8003, 0x18AD, 0x0007, 0x10D1, 0x10D3, 0x08D3, 0x10D2, 0x18AE, 0x18AD, 0x18AE, 0x8006, 0x18AD, 0x8052, 0x18AD,
+  0x0001, 0x20AE, 0x800E, 0x18AD, 0x0003, 0x03B7, 0x03B7, 0x03B8, 0x8004, 0x18AD, 0x8007, 0x03B7, 0x0005, 0x18AD, 0x18AD, 0x18CD,
+  0x18AD, 0x20AD, 0x8010, 0x18AD, 0x0006, 0x18CD, 0x20AD, 0x10D2, 0x011A, 0x011A, 0x08F5, 0x8005, 0x18AD, 0x0001, 0x18AE, 0x8005,
+  0x18AD, 0x0007, 0x20AD, 0x08F5, 0x0119, 0x0119, 0x18AD, 0x18AD, 0x20AD, 0x800C, 0x18AD, 0x0001, 0x18AE, 0x800D, 0x18AD, 0x0006,
+  0x20AD, 0x011A, 0x0119, 0x18AE, 0x18AD, 0x20AD, 0x8008, 0x18AD, 0x0003, 0x20CD, 0x20AE, 0x8A92, 0x8003, 0xD395, 0x0001, 0xD396,
+  0x800C, 0xD395, 0x0004, 0x7A31, 0x20AD, 0x18AD, 0x18CD, 0x8008, 0x18AD, 0x0001, 0x18AE, 0x801D, 0x18AD, 0x0002, 0x0119, 0x0119,
+  0x8004, 0x18AD, 0x0001, 0x18AE, 0x8015, 0x18AD, 0x0002, 0x18AE, 0x18AE, 0x8003, 0x18AD, 0x0005, 0x0119, 0x011A, 0x18AD, 0x18AD,
+  0x18AE, 0x8006, 0x18AD, 0x0001, 0x18AE, 0x8003, 0x18AD, 0x0003, 0x18AE, 0x18AD, 0x20AD, 0x8004, 0x18AD, 0x0004, 0x20AD, 0x18AD,
+  0x18AD, 0x18AE, 0x8004, 0x18AD, 0x8054, 0x18AD, 0x0001, 0x20AD, 0x8007, 0x18AD, 0x0001, 0x20AD, 0x8003, 0x18AD, 0x0001, 0x20AE,
+  0x8003, 0x03B7, 0x0007, 0x18AD, 0x18AD, 0x18CD, 0x18AD, 0x03B7, 0x03B7, 0x03B8, 0x8004, 0x03B7, 0x8003, 0x18AD, 0x0001, 0x20AD,
+  0x8012, 0x18AD, 0x0006, 0x18CD, 0x20AE, 0x10D2, 0x0119, 0x0119, 0x08F5, 0x8005, 0x18AD, 0x0001, 0x20AD, 0x8006, 0x18AD, 0x0002,
+  0x0119, 0x0119, 0x801E, 0x18AD, 0x0002, 0x0119, 0x0119, 0x8007, 0x18AD, 0x8004, 0x20AE, 0x0003, 0x20AD, 0x28EE, 0xC374, 0x8010,
+  0xD395, 0x0004, 0xA2D3, 0x18AD, 0x18AE, 0x20AD, 0x8023, 0x18AD, 0x0008, 0x20AD, 0x18AD, 0x18AD, 0x011A, 0x0119, 0x18AD, 0x18AD,
+  0x20AD, 0x8003, 0x18AD, 0x0001, 0x18AE, 0x8018, 0x18AD, 0x0002, 0x0119, 0x0119, 0x801C, 0x18AD, 0x8057, 0x18AD, 0x0011, 0x18AE,
+  0x20AD, 0x18AD, 0x18CE, 0x194F, 0x18AE, 0x20AD, 0x18AE, 0x18AD, 0x18AD, 0x03B7, 0x0397, 0x03B8, 0x18AD, 0x20AE, 0x20AD, 0x18AD,
+  0x8004, 0x03B7, 0x0005, 0x03B8, 0x03B7, 0x03B7, 0x18AE, 0x18CD, 0x8017, 0x18AD, 0x0006, 0x10D2, 0x00F9, 0x0119, 0x08F5, 0x18AD,
+  0x18AE, 0x8009, 0x18AD, 0x0002, 0x0119, 0x0119, 0x801E, 0x18AD, 0x0002, 0x0119, 0x0119, 0x8004, 0x18AD, 0x8004, 0x20AE, 0x0005,
+  0x20AD, 0x20AD, 0x20AE, 0x20AE, 0x61D1, 0x8010, 0xD395, 0x0005, 0xD396, 0xD395, 0x69F1, 0x20AD, 0x18AE, 0x8024, 0x18AD, 0x0005,
+  0x18CD, 0x10D2, 0x011A, 0x0119, 0x10D2, 0x801E, 0x18AD, 0x0002, 0x0119, 0x0119, 0x801A, 0x18AD, 0x0002, 0x18CE, 0x18AD, 0x8058,
+  0x18AD, 0x0006, 0x1930, 0x02F5, 0x03B7, 0x03B8, 0x0356, 0x114F, 0x8003, 0x18AD, 0x0003, 0x03B8, 0x03B7, 0x03B7, 0x8003, 0x18AD,
+  0x0008, 0x20AE, 0x18AD, 0x18AD, 0x03B7, 0x03B8, 0x03B7, 0x18AD, 0x20AD, 0x8019, 0x18AD, 0x0009, 0x18AE, 0x10D2, 0x00F9, 0x0119,
+  0x08F4, 0x18AD, 0x20AD, 0x18AD, 0x18AE, 0x8006, 0x18AD, 0x0002, 0x0119, 0x0119, 0x801E, 0x18AD, 0x0002, 0x0119, 0x0119, 0x8004,
+  0x18AD, 0x0002, 0x20AE, 0x20AE, 0x8004, 0x20AD, 0x0004, 0x20AE, 0x20AE, 0x9AB3, 0xD375, 0x800E, 0xD395, 0x0001, 0xD375, 0x8003,
+  0xD395, 0x0001, 0x412F, 0x8022, 0x18AD, 0x0004, 0x20AD, 0x18AD, 0x18CE, 0x00F8, 0x8004, 0x0119, 0x0005, 0x08F7, 0x18CE, 0x18AD,
+  0x20AD, 0x18AE, 0x8019, 0x18AD, 0x0002, 0x0119, 0x0119, 0x8010, 0x18AD, 0x0001, 0x18AE, 0x8004, 0x18AD, 0x0001, 0x18AE, 0x8004,
+  0x03B7, 0x0002, 0x0397, 0x03B7, 0x8054, 0x18AD, 0x0010, 0x18AE, 0x18AD, 0x18AD, 0x190F, 0x0377, 0x0397, 0x03B8, 0x0398, 0x0397,
+  0x0B77, 0x18CE, 0x18AD, 0x18AD, 0x03B7, 0x0397, 0x03B8, 0x8003, 0x18AD, 0x0006, 0x18AE, 0x18AD, 0x18AD, 0x03B7, 0x0BB7, 0x0398,
+  0x8006, 0x18AD, 0x0001, 0x20AD, 0x8015, 0x18AD, 0x0006, 0x18AE, 0x10D2, 0x0119, 0x0119, 0x08F5, 0x18AE, 0x8008, 0x18AD, 0x0002,
+  0x0119, 0x0119, 0x801E, 0x18AD, 0x0007, 0x0119, 0x0119, 0x18AD, 0x18AD, 0x20AE, 0x18AD, 0x20AD, 0x8006, 0x20AE, 0x0002, 0x20CE,
+  0xC355, 0x8013, 0xD395, 0x0001, 0x4970, 0x8024, 0x18AD, 0x000E, 0x08F5, 0x00F9, 0x0119, 0x00F7, 0x00F7, 0x0119, 0x0119, 0x08F5,
+  0x18AE, 0x18AD, 0x18AD, 0x18CD, 0x18AD, 0x18AE, 0x8016, 0x18AD, 0x0002, 0x0119, 0x0119, 0x8016, 0x18AD, 0x8004, 0x03B7, 0x0002,
+  0x03B8, 0x03B7, 0x8056, 0x18AD, 0x000E, 0x20AD, 0x1253, 0x0B78, 0x0B98, 0x0B78, 0x0B98, 0x0B98, 0x1378, 0x11F2, 0x18AD, 0x18AD,
+  0x0B98, 0x0B78, 0x0B78, 0x8006, 0x18AD, 0x0005, 0x0B98, 0x1378, 0x0B78, 0x18AD, 0x20AE, 0x8016, 0x18AD, 0x0003, 0x18AE, 0x18AD,
+  0x20AE, 0x8003, 0x18AD, 0x0008, 0x10D2, 0x0119, 0x011A, 0x08F5, 0x18AD, 0x20AD, 0x18AD, 0x20AE, 0x8004, 0x18AD, 0x0002, 0x0119,
+  0x0119, 0x801E, 0x18AD, 0x0006, 0x0119, 0x0119, 0x18AD, 0x18AD, 0x20AE, 0x20AD, 0x8006, 0x20AE, 0x0004, 0x20CE, 0x4970, 0xD395,
+  0xD375, 0x8011, 0xD395, 0x0002, 0xD375, 0x8252, 0x8003, 0x20AE, 0x801F, 0x18AD, 0x000A, 0x20AD, 0x18AE, 0x0119, 0x011A, 0x08F3,
+  0x18AD, 0x18AD, 0x08F4, 0x0119, 0x0119, 0x801C, 0x18AD, 0x0002, 0x0119, 0x0119, 0x8013, 0x18AD, 0x0004, 0x18CE, 0x18AD, 0x18AD,
+  0x03B8, 0x8005, 0x03B7, 0x8055, 0x18AD, 0x0015, 0x18AE, 0x18AD, 0x1AB5, 0x1B78, 0x1B58, 0x1358, 0x1B78, 0x1378, 0x1358, 0x1A13,
+  0x18AE, 0x18AE, 0x1358, 0x1358, 0x1378, 0x18AD, 0x18AE, 0x18AD, 0x18AD, 0x18AE, 0x18AD, 0x8003, 0x1358, 0x0001, 0x18AE, 0x8005,
+  0x18AD, 0x0001, 0x20AD, 0x8011, 0x18AD, 0x0001, 0x20AD, 0x8005, 0x18AD, 0x0006, 0x20AE, 0x10D2, 0x0119, 0x0119, 0x08F5, 0x18AE,
+  0x8006, 0x18AD, 0x0002, 0x0119, 0x0119, 0x801E, 0x18AD, 0x0005, 0x0119, 0x0119, 0x20AE, 0x20AE, 0x18AD, 0x8005, 0x20AE, 0x8003,
+  0x20CE, 0x0001, 0x7A32, 0x8010, 0xD395, 0x0007, 0xD375, 0xD395, 0xD375, 0xD395, 0xC354, 0x5990, 0x20AD, 0x8004, 0x20AE, 0x801D,
+  0x18AD, 0x0009, 0x18AF, 0x0119, 0x0119, 0x18D0, 0x18AD, 0x18AD, 0x10D0, 0x0119, 0x0119, 0x8004, 0x18AD, 0x0001, 0x18AE, 0x8017,
+  0x18AD, 0x0002, 0x0119, 0x0119, 0x8016, 0x18AD, 0x8006, 0x03B7, 0x8057, 0x18AD, 0x000E, 0x1A54, 0x1B38, 0x1B38, 0x2338, 0x1B38,
+  0x1B58, 0x2338, 0x21D2, 0x18AD, 0x18AD, 0x2338, 0x2338, 0x2358, 0x18AE, 0x8004, 0x18AD, 0x0006, 0x1930, 0x2339, 0x2358, 0x2338,
+  0x18AD, 0x20AD, 0x8017, 0x18AD, 0x0002, 0x20AD, 0x18AE, 0x8003, 0x18AD, 0x0008, 0x18CD, 0x18AD, 0x10D2, 0x0119, 0x0119, 0x08F5,
+  0x18AD, 0x18AE, 0x8004, 0x18AD, 0x0002, 0x0119, 0x0119, 0x801E, 0x18AD, 0x0002, 0x0119, 0x0119, 0x8005, 0x20AE, 0x8006, 0x20CE,
+  0x0001, 0xA2B3, 0x8005, 0xD395, 0x0001, 0xD375, 0x800C, 0xD395, 0x8004, 0xD375, 0x0001, 0x4970, 0x8006, 0x20AE, 0x801C, 0x18AD,
+  0x000E, 0x0119, 0x011A, 0x08F3, 0x18AD, 0x18AD, 0x10D3, 0x011A, 0x011A, 0x18AD, 0x18AE, 0x18AE, 0x18AD, 0x18AD, 0x18AE, 0x8016,
+  0x18AD, 0x0002, 0x0119, 0x0119, 0x8016, 0x18AD, 0x8004, 0x03B7, 0x0002, 0x18AE, 0x18AD, 0x8055, 0x18AD, 0x001A, 0x18AE, 0x18AD,
+  0x2150, 0x2B18, 0x2B39, 0x2B18, 0x2B19, 0x2B19, 0x2AF8, 0x18CE, 0x18AD, 0x18AD, 0x2B19, 0x2B18, 0x2B19, 0x18AD, 0x18CD, 0x18AE,
+  0x18AD, 0x2192, 0x2B19, 0x2B19, 0x2B18, 0x2338, 0x18AD, 0x18AE, 0x8003, 0x18AD, 0x0001, 0x18AE, 0x801B, 0x18AD, 0x0003, 0x10CF,
+  0x0119, 0x011A, 0x8006, 0x18AD, 0x0002, 0x0119, 0x0119, 0x801E, 0x18AD, 0x0003, 0x0119, 0x0119, 0x18AD, 0x8004, 0x20AE, 0x8006,
+  0x20CE, 0x0004, 0xBB34, 0xD395, 0xD395, 0xD396, 0x800C, 0xD395, 0x8007, 0xD375, 0x0002, 0x4970, 0x20CE, 0x8003, 0x20AE, 0x0004,
+  0x20AD, 0x18AD, 0x18AD, 0x20AE, 0x801A, 0x18AD, 0x0008, 0x08D5, 0x0119, 0x0119, 0x00F7, 0x0117, 0x0119, 0x0119, 0x08F5, 0x801C,
+  0x18AD, 0x0002, 0x0119, 0x0119, 0x8010, 0x18AD, 0x0001, 0x20AD, 0x8005, 0x18AD, 0x8005, 0x03B7, 0x0001, 0x03B8, 0x8004, 0x18AD,
+  0x0006, 0x10D2, 0x08F3, 0x10D3, 0x10D2, 0x18AD, 0x18AE, 0x801B, 0x18AD, 0x0004, 0x18AE, 0x18AD, 0x18AD, 0x18CD, 0x802E, 0x18AD,
+  0x000D, 0x20AD, 0x2192, 0x2B19, 0x3319, 0x32F9, 0x2A15, 0x18EF, 0x20AD, 0x18AD, 0x18AD, 0x32F9, 0x3319, 0x32F9, 0x8003, 0x18AD,
+  0x000A, 0x2191, 0x3319, 0x2AF9, 0x3319, 0x2AF9, 0x2A97, 0x18AD, 0x18AD, 0x18AE, 0x20AD, 0x801D, 0x18AD, 0x0003, 0x18AE, 0x0119,
+  0x0119, 0x8006, 0x18AD, 0x0002, 0x0119, 0x0119, 0x801C, 0x18AD, 0x0004, 0x20AD, 0x18AE, 0x0119, 0x0119, 0x8004, 0x20AE, 0x8003,
+  0x20CE, 0x8003, 0x20CF, 0x0001, 0x28CF, 0x8011, 0xD395, 0x8006, 0xD375, 0x0001, 0x71D1, 0x8006, 0x20AE, 0x0004, 0x20AD, 0x20CD,
+  0x20AE, 0x20AE, 0x8018, 0x18AD, 0x0003, 0x18AE, 0x00F7, 0x011A, 0x8003, 0x0119, 0x0006, 0x00F7, 0x18CE, 0x18AD, 0x18CD, 0x18AD,
+  0x18AE, 0x8018, 0x18AD, 0x0002, 0x0119, 0x0119, 0x8010, 0x18AD, 0x0001, 0x20AD, 0x8005, 0x18AD, 0x8005, 0x03B7, 0x0001, 0x03B8,
+  0x0004, 0x18AD, 0x18AE, 0x18CE, 0x00F7, 0x8004, 0x0119, 0x0002, 0x00F7, 0x18CE, 0x801F, 0x18AD, 0x0003, 0x18AE, 0x18AD, 0x20AD,
+  0x802C, 0x18AD, 0x0001, 0x18AE, 0x8003, 0x3AD9, 0x8003, 0x18AD, 0x0011, 0x18AE, 0x18AD, 0x3AF9, 0x3AD9, 0x3AD9, 0x18AD, 0x20AD,
+  0x3215, 0x3AD9, 0x3AF9, 0x3ADA, 0x3AD9, 0x3277, 0x18CE, 0x18AD, 0x18AE, 0x18AE, 0x801F, 0x18AD, 0x0002, 0x0119, 0x0119, 0x8006,
+  0x18AD, 0x0002, 0x0119, 0x0119, 0x801E, 0x18AD, 0x0005, 0x011A, 0x011A, 0x20CD, 0x20AE, 0x20AE, 0x8004, 0x20CE, 0x0004, 0x20CF,
+  0x28CF, 0x28CF, 0x4950, 0x8010, 0xD395, 0x8003, 0xD375, 0x000A, 0xD374, 0xD375, 0xD355, 0xD355, 0xAAB3, 0x20CE, 0x18CE, 0x20CE,
+  0x20AE, 0x20CE, 0x8007, 0x20AE, 0x8015, 0x18AD, 0x000C, 0x20AD, 0x18AD, 0x18AD, 0x10D2, 0x10D3, 0x08F3, 0x10D2, 0x18AD, 0x18AD,
+  0x18AE, 0x18AD, 0x20AD, 0x8019, 0x18AD, 0x0002, 0x0119, 0x0119, 0x8014, 0x18AD, 0x0002, 0x20AD, 0x18AD, 0x8004, 0x0398, 0x0002,
+  0x03B7, 0x0397, 0x000A, 0x18AD, 0x18AD, 0x08F5, 0x0139, 0x011A, 0x0117, 0x00F7, 0x011A, 0x011A, 0x08F5, 0x8020, 0x18AD, 0x0002,
+  0x20AE, 0x18AE, 0x802C, 0x18AD, 0x0004, 0x20AD, 0x42D9, 0x42B9, 0x42B9, 0x8004, 0x18AD, 0x0010, 0x18AE, 0x42B9, 0x42B9, 0x42BA,
+  0x18AE, 0x31F5, 0x42DA, 0x42D9, 0x42B9, 0x42D9, 0x3A77, 0x18CE, 0x18AD, 0x18AD, 0x18AE, 0x20AD, 0x801C, 0x18AD, 0x0005, 0x18CD,
+  0x18AD, 0x20AD, 0x0119, 0x011A, 0x8006, 0x18AD, 0x0002, 0x0119, 0x0119, 0x801D, 0x18AD, 0x0004, 0x20AD, 0x0119, 0x0119, 0x20AE,
+  0x8005, 0x20CE, 0x8004, 0x28CF, 0x0001, 0x5991, 0x800E, 0xD395, 0x8005, 0xD375, 0x0002, 0xD374, 0xD375, 0x8003, 0xD355, 0x0002,
+  0x9252, 0x30EF, 0x8004, 0x20CE, 0x8007, 0x20AE, 0x8013, 0x18AD, 0x0003, 0x18AE, 0x18AD, 0x18AE, 0x8008, 0x18AD, 0x0004, 0x20AD,
+  0x18AD, 0x18AD, 0x18AE, 0x8017, 0x18AD, 0x0002, 0x0119, 0x0119, 0x8014, 0x18AD, 0x0008, 0x20AD, 0x18AD, 0x2338, 0x2338, 0x2318,
+  0x2319, 0x2338, 0x2338, 0x000B, 0x18AD, 0x18AD, 0x00F9, 0x0119, 0x10D3, 0x18AD, 0x18AD, 0x10F3, 0x011A, 0x0119, 0x011A, 0x801A,
+  0x0119, 0x0003, 0x18B0, 0x18AD, 0x18AE, 0x8031, 0x18AD, 0x0003, 0x4A99, 0x4AB9, 0x4A9A, 0x8005, 0x18AD, 0x000F, 0x4ABA, 0x4ABA,
+  0x4A9A, 0x4257, 0x4A99, 0x4A9A, 0x4A9A, 0x4ABA, 0x4237, 0x20CE, 0x18AD, 0x18AE, 0x18AD, 0x20AD, 0x18CD, 0x801C, 0x18AD, 0x0005,
+  0x18AE, 0x18AD, 0x18CD, 0x011A, 0x0119, 0x8006, 0x18AD, 0x0002, 0x0119, 0x0119, 0x801B, 0x18AD, 0x0006, 0x20AD, 0x20AE, 0x20AE,
+  0x0119, 0x0119, 0x20AE, 0x8004, 0x20CE, 0x0001, 0x28CE, 0x8003, 0x28CF, 0x0002, 0x28EF, 0x69F1, 0x800E, 0xD395, 0x8004, 0xD375,
+  0x0002, 0xD355, 0xD375, 0x8003, 0xD355, 0x0009, 0xD335, 0xD355, 0xCB14, 0x4130, 0x20AF, 0x20CE, 0x20CE, 0x20AE, 0x20CE, 0x8004,
+  0x20AE, 0x0004, 0x20AD, 0x18AD, 0x20AE, 0x20AE, 0x8013, 0x18AD, 0x0004, 0x18CD, 0x20AD, 0x18AD, 0x208E, 0x8003, 0x18AD, 0x0001,
+  0x18AE, 0x801B, 0x18AD, 0x0002, 0x0119, 0x0119, 0x8013, 0x18AD, 0x0009, 0x20AD, 0x18AD, 0x18AD, 0x42B9, 0x4A99, 0x42B9, 0x42BA,
+  0x18AD, 0x18AD, 0x000B, 0x18AD, 0x18AF, 0x011A, 0x00F9, 0x10D0, 0x18AD, 0x20AD, 0x10D0, 0x0119, 0x0119, 0x011A, 0x801A, 0x0119,
+  0x0002, 0x0118, 0x10D0, 0x8032, 0x18AD, 0x8003, 0x527A, 0x0008, 0x20AD, 0x18AD, 0x18AD, 0x20AD, 0x18AE, 0x527A, 0x527A, 0x529A,
+  0x8004, 0x527A, 0x0006, 0x4A18, 0x20CE, 0x18AD, 0x18AD, 0x20AD, 0x20AD, 0x8020, 0x18AD, 0x0003, 0x18CD, 0x00F9, 0x0119, 0x8006,
+  0x18AD, 0x0002, 0x0119, 0x0119, 0x801B, 0x18AD, 0x000A, 0x18AE, 0x10D1, 0x0117, 0x0119, 0x0119, 0x0917, 0x18D2, 0x20CE, 0x20CF,
+  0x28CE, 0x8003, 0x28CF, 0x0003, 0x28EF, 0x30F0, 0x8253, 0x800D, 0xD395, 0x8005, 0xD375, 0x8006, 0xD355, 0x0004, 0xD354, 0xD355,
+  0x7A11, 0x20CF, 0x8003, 0x20CE, 0x0002, 0x20AE, 0x20CE, 0x8008, 0x20AE, 0x0002, 0x20AD, 0x20AD, 0x8010, 0x18AD, 0x0003, 0x20AD,
+  0x18AD, 0x18CD, 0x8009, 0x18AD, 0x0001, 0x18AE, 0x8016, 0x18AD, 0x0002, 0x0119, 0x0119, 0x8016, 0x18AD, 0x8003, 0x6A3B, 0x0003,
+  0x621A, 0x6A3B, 0x6A3B, 0x000C, 0x18AD, 0x18AD, 0x0119, 0x0119, 0x10D3, 0x18AD, 0x20AE, 0x08F3, 0x0119, 0x0119, 0x18CD, 0x18AE,
+  0x8018, 0x18AD, 0x0006, 0x08F5, 0x0119, 0x00F9, 0x18D0, 0x18AD, 0x18AE, 0x802B, 0x18AD, 0x000E, 0x20AE, 0x18AD, 0x18AD, 0x20AD,
+  0x5A5B, 0x5A5A, 0x5A7A, 0x2910, 0x18AD, 0x18AE, 0x18AD, 0x18AD, 0x5A5A, 0x5A7B, 0x8004, 0x5A5A, 0x0002, 0x4A18, 0x20CE, 0x8009,
+  0x18AD, 0x0001, 0x20AD, 0x801C, 0x18AD, 0x0005, 0x0119, 0x0119, 0x18AD, 0x18AD, 0x18AE, 0x8003, 0x18AD, 0x0002, 0x0119, 0x0119,
+  0x801B, 0x18AD, 0x0001, 0x10D1, 0x8004, 0x0119, 0x000B, 0x011A, 0x091A, 0x18F2, 0x28CF, 0x28CE, 0x28CF, 0x28CF, 0x28EF, 0x28F0,
+  0x30F0, 0x8232, 0x800C, 0xD395, 0x8005, 0xD375, 0x8005, 0xD355, 0x8004, 0xD335, 0x0002, 0xA293, 0x28CF, 0x8008, 0x20CE, 0x000A,
+  0x20AE, 0x20CE, 0x20AE, 0x20AE, 0x20AD, 0x20AD, 0x20AE, 0x20AD, 0x20AD, 0x20AE, 0x8013, 0x18AD, 0x0003, 0x18CD, 0x20AD, 0x18AE,
+  0x8003, 0x18AD, 0x0001, 0x18AE, 0x8016, 0x18AD, 0x0002, 0x0119, 0x0119, 0x8010, 0x18AD, 0x0001, 0x20AD, 0x8005, 0x18AD, 0x8003,
+  0x89BC, 0x0003, 0x91BC, 0x89BC, 0x899C, 0x000A, 0x18AD, 0x18AD, 0x08F5, 0x0119, 0x0119, 0x00F7, 0x0117, 0x0119, 0x0119, 0x08F5,
+  0x801A, 0x18AD, 0x0006, 0x18AE, 0x00F7, 0x0119, 0x00F9, 0x18D0, 0x18AE, 0x802F, 0x18AD, 0x000F, 0x623A, 0x623B, 0x625A, 0x621A,
+  0x2910, 0x18CD, 0x18AD, 0x18AD, 0x623B, 0x623A, 0x625A, 0x623B, 0x623B, 0x51F8, 0x20CE, 0x8003, 0x18AD, 0x0001, 0x18AE, 0x8022,
+  0x18AD, 0x0006, 0x10D2, 0x0119, 0x0119, 0x20AD, 0x18AD, 0x20AD, 0x8003, 0x18AD, 0x0002, 0x0119, 0x0119, 0x801B, 0x18AD, 0x0010,
+  0x0118, 0x0119, 0x0917, 0x18D2, 0x18D2, 0x0918, 0x091A, 0x0918, 0x28CF, 0x28CF, 0x28EF, 0x28EF, 0x30D0, 0x30F0, 0x30F0, 0x8252,
+  0x800A, 0xD395, 0x8007, 0xD375, 0x8004, 0xD355, 0x8004, 0xD335, 0x0006, 0xD315, 0xD335, 0x9253, 0x30EF, 0x28CF, 0x28CE, 0x8006,
+  0x20CE, 0x0003, 0x20AE, 0x20AE, 0x20CE, 0x8004, 0x20AE, 0x0001, 0x20AD, 0x8003, 0x20AE, 0x800A, 0x18AD, 0x0002, 0x18CD, 0x18AE,
+  0x8005, 0x18AD, 0x0005, 0x18AE, 0x18AD, 0x18AD, 0x18CD, 0x18AE, 0x8018, 0x18AD, 0x0002, 0x0119, 0x0119, 0x8016, 0x18AD, 0x8003,
+  0xA93D, 0x0003, 0xB13D, 0xA93D, 0xA93D, 0x000A, 0x18AD, 0x20AD, 0x18AE, 0x0117, 0x011A, 0x011A, 0x0119, 0x0119, 0x00F7, 0x18AE,
+  0x801A, 0x18AD, 0x0007, 0x18AE, 0x18AE, 0x00F7, 0x0119, 0x00F8, 0x18D0, 0x18AE, 0x802C, 0x18AD, 0x0003, 0x20AD, 0x18CD, 0x59D8,
+  0x8004, 0x6A1B, 0x0004, 0x4133, 0x18AD, 0x18AD, 0x6A3B, 0x8003, 0x6A1B, 0x0002, 0x51B6, 0x20CF, 0x8008, 0x18AD, 0x0001, 0x18AE,
+  0x801D, 0x18AD, 0x0005, 0x10D2, 0x0119, 0x00F9, 0x10D3, 0x20AD, 0x8005, 0x18AD, 0x0002, 0x0119, 0x0119, 0x801B, 0x18AD, 0x000B,
+  0x0119, 0x011A, 0x18D1, 0x20CE, 0x20CE, 0x18D1, 0x093A, 0x093A, 0x28EF, 0x28CF, 0x28CF, 0x8003, 0x30F0, 0x0002, 0x38F0, 0x9273,
+  0x800A, 0xD395, 0x8005, 0xD375, 0x8005, 0xD355, 0x0009, 0xD335, 0xD335, 0xD334, 0xD335, 0xD334, 0xD334, 0xD314, 0xD315, 0xAA93,
+  0x8003, 0x28CF, 0x8008, 0x20CE, 0x0003, 0x20AE, 0x20CE, 0x20CE, 0x8003, 0x20AE, 0x0003, 0x20AD, 0x20AD, 0x20AE, 0x8007, 0x18AD,
+  0x0001, 0x20AE, 0x800A, 0x18AD, 0x8003, 0x18AE, 0x8018, 0x18AD, 0x0002, 0x0119, 0x0119, 0x8013, 0x18AD, 0x0003, 0x20AD, 0x18AD,
+  0x18AD, 0x8006, 0xD0BE, 0x8004, 0x18AD, 0x0008, 0x10D2, 0x08D4, 0x08F3, 0x10D2, 0x18CD, 0x18AD, 0x18AD, 0x18CD, 0x800B, 0x18AD,
+  0x0001, 0x18AE, 0x800E, 0x18AD, 0x0006, 0x18CE, 0x00F7, 0x0119, 0x0119, 0x18D0, 0x18CD, 0x8003, 0x18AD, 0x0002, 0x18AE, 0x18CD,
+  0x8023, 0x18AD, 0x0014, 0x18AE, 0x18AD, 0x18AD, 0x20AD, 0x18AD, 0x20CE, 0x61B8, 0x721B, 0x71FB, 0x721B, 0x721B, 0x4133, 0x20AD,
+  0x71FB, 0x721B, 0x71FB, 0x4174, 0x20AD, 0x18AD, 0x18AE, 0x801D, 0x18AD, 0x0001, 0x18AE, 0x8006, 0x18AD, 0x0008, 0x10D2, 0x0119,
+  0x0119, 0x08F5, 0x18AD, 0x18AD, 0x18AE, 0x18AE, 0x8003, 0x18AD, 0x0002, 0x011A, 0x011A, 0x801A, 0x18AD, 0x0011, 0x20AE, 0x0119,
+  0x011A, 0x18D1, 0x20AE, 0x20CE, 0x20F1, 0x093A, 0x093A, 0x28CF, 0x28CF, 0x30EF, 0x30F0, 0x30F0, 0x38F0, 0x3911, 0xAAF4, 0x8009,
+  0xD395, 0x8005, 0xD375, 0x8006, 0xD355, 0x8006, 0xD335, 0x0005, 0xD314, 0xD314, 0xD315, 0x28EF, 0x28EF, 0x8003, 0x28CF, 0x0002,
+  0x28CE, 0x28CE, 0x8006, 0x20CE, 0x0003, 0x20AE, 0x20CE, 0x20CE, 0x8003, 0x20AE, 0x0017, 0x18AE, 0x20AD, 0x20AD, 0x20AE, 0x30EE,
+  0x6150, 0x81B1, 0xA1F2, 0xC233, 0xCA53, 0xCA54, 0xCA53, 0xC233, 0xA1F2, 0x8191, 0x512F, 0x18AD, 0x18AD, 0x18AE, 0x18AD, 0x18AD,
+  0x18CD, 0x18AE, 0x8017, 0x18AD, 0x0002, 0x0119, 0x0119, 0x8011, 0x18AD, 0x0005, 0x18AE, 0x18AD, 0x20AD, 0x18AD, 0x18AD, 0x8006,
+  0xF03F, 0x8007, 0x18AD, 0x0001, 0x18AE, 0x800F, 0x18AD, 0x0001, 0x18AE, 0x800F, 0x18AD, 0x0008, 0x18AE, 0x0117, 0x0119, 0x0119,
+  0x18D0, 0x18AD, 0x18AD, 0x18AE, 0x8003, 0x18AD, 0x0001, 0x18AE, 0x8022, 0x18AD, 0x0010, 0x18CD, 0x20AD, 0x18AE, 0x18AD, 0x18AD,
+  0x20CE, 0x69B9, 0x81FB, 0x79DB, 0x79DC, 0x81FC, 0x5976, 0x79DB, 0x79DC, 0x81DC, 0x20AD, 0x801F, 0x18AD, 0x0002, 0x18AE, 0x18CD,
+  0x8003, 0x18AD, 0x0006, 0x18AE, 0x18AD, 0x10D2, 0x0119, 0x0119, 0x08F5, 0x8007, 0x18AD, 0x0003, 0x18AE, 0x0119, 0x0119, 0x801A,
+  0x18AD, 0x0011, 0x20AE, 0x0918, 0x0119, 0x0917, 0x18D0, 0x20D0, 0x0917, 0x093A, 0x1138, 0x28CF, 0x30CF, 0x30EF, 0x30F0, 0x30F0,
+  0x3911, 0x3911, 0xAAD4, 0x8008, 0xD395, 0x8005, 0xD375, 0x8007, 0xD355, 0x8004, 0xD335, 0x0007, 0xD315, 0xD314, 0xD315, 0xD315,
+  0xD314, 0x69B2, 0x28EF, 0x8005, 0x28CF, 0x0002, 0x28CE, 0x28CE, 0x8008, 0x20CE, 0x000A, 0x20AE, 0x20CE, 0x410F, 0x6990, 0x99F2,
+  0xC253, 0xCA74, 0xD274, 0xCA74, 0xD253, 0x8003, 0xCA53, 0x0008, 0xD233, 0xD253, 0xCA53, 0xD233, 0xCA33, 0xC213, 0x8991, 0x410F,
+  0x801B, 0x18AD, 0x0002, 0x0119, 0x0119, 0x8014, 0x18AD, 0x0001, 0x18CD, 0x8005, 0x18AD, 0x0002, 0x18AE, 0x18CD, 0x8004, 0x18AD,
+  0x0001, 0x18AE, 0x8003, 0x18AD, 0x0004, 0x18AE, 0x18AD, 0x18AD, 0x20AD, 0x8018, 0x18AD, 0x000C, 0x18AE, 0x18AD, 0x18AD, 0x20AD,
+  0x18AE, 0x0917, 0x0119, 0x0119, 0x10CF, 0x18AD, 0x18AE, 0x18AE, 0x8029, 0x18AD, 0x0007, 0x18AE, 0x18AE, 0x20AE, 0x7199, 0x89DB,
+  0x89BC, 0x81BC, 0x8004, 0x89BC, 0x0003, 0x18AD, 0x18AD, 0x18AE, 0x801F, 0x18AD, 0x0001, 0x20AD, 0x8003, 0x18AD, 0x0004, 0x10D2,
+  0x0119, 0x0119, 0x08F5, 0x8007, 0x18AD, 0x0005, 0x18AE, 0x08F5, 0x011A, 0x0119, 0x18AE, 0x8019, 0x18AD, 0x0004, 0x20AD, 0x18D2,
+  0x0119, 0x0119, 0x8004, 0x093A, 0x0009, 0x20F2, 0x28CF, 0x28F0, 0x30F0, 0x30F0, 0x3111, 0x3911, 0x3911, 0xB2F5, 0x8006, 0xD395,
+  0x8006, 0xD375, 0x8007, 0xD355, 0x8004, 0xD335, 0x000B, 0xD315, 0xD315, 0xD314, 0xD314, 0xD2F4, 0xD2F5, 0xCAD4, 0x5971, 0x30F0,
+  0x30D0, 0x28EF, 0x8006, 0x28CF, 0x8004, 0x20CE, 0x0011, 0x28CE, 0x38EF, 0x79B1, 0xBA53, 0xCA94, 0xCA94, 0xCA74, 0xD273, 0xD273,
+  0xCA73, 0xCA54, 0xCA53, 0xCA54, 0xCA53, 0xCA33, 0xCA53, 0xCA53, 0x8003, 0xCA33, 0x0007, 0xD213, 0xCA13, 0xCA13, 0xA1B2, 0x490F,
+  0x18AD, 0x18AE, 0x8017, 0x18AD, 0x0002, 0x0119, 0x0119, 0x8010, 0x18AD, 0x0001, 0x18AE, 0x8004, 0x18AD, 0x0001, 0x18AE, 0x8005,
+  0x18AD, 0x0001, 0x20CD, 0x8008, 0x18AD, 0x0001, 0x18AE, 0x801D, 0x18AD, 0x000E, 0x18CD, 0x18AD, 0x18AD, 0x18AE, 0x0117, 0x0119,
+  0x00F9, 0x18B0, 0x18AD, 0x18AD, 0x18AE, 0x18AD, 0x18AD, 0x18CD, 0x8028, 0x18AD, 0x000C, 0x20CE, 0x7979, 0x919C, 0x919C, 0x91BC,
+  0x919C, 0x899C, 0x89BC, 0x18AE, 0x18AD, 0x18AD, 0x20AD, 0x801D, 0x18AD, 0x0008, 0x18AE, 0x18AD, 0x18AE, 0x18AD, 0x10D2, 0x0119,
+  0x0119, 0x08F5, 0x8005, 0x18AD, 0x0007, 0x18AE, 0x18AD, 0x18AD, 0x08F5, 0x011A, 0x0119, 0x10F2, 0x8018, 0x18AD, 0x000B, 0x20AD,
+  0x20AE, 0x20AE, 0x20CE, 0x18F2, 0x0919, 0x091A, 0x091A, 0x0919, 0x20F3, 0x28EF, 0x8003, 0x30F0, 0x0005, 0x3110, 0x3911, 0x3911,
+  0x4112, 0xB2F5, 0x8006, 0xD395, 0x8005, 0xD375, 0x8007, 0xD355, 0x8004, 0xD335, 0x0001, 0xD315, 0x8003, 0xD314, 0x0009, 0xD2F4,
+  0xD314, 0xD2F5, 0xD2F4, 0xD2F4, 0x4930, 0x30F0, 0x30EF, 0x28F0, 0x8003, 0x28CF, 0x0002, 0x28EF, 0x28CE, 0x8003, 0x28CF, 0x001C,
+  0x4130, 0x89F1, 0xD294, 0xD294, 0xCA93, 0xCA74, 0xD274, 0xCA74, 0xCA74, 0xCA53, 0xCA73, 0xD253, 0xD254, 0xCA53, 0xCA53, 0xCA54,
+  0xC274, 0x9B36, 0x83B8, 0x6419, 0x6C39, 0x6439, 0x6C1A, 0x8B57, 0xB295, 0xCA13, 0x9191, 0x28CE, 0x8017, 0x18AD, 0x0002, 0x0119,
+  0x0119, 0x8012, 0x18AD, 0x000A, 0x18AE, 0x20AD, 0x18AD, 0x18AD, 0x20AD, 0x18AD, 0x20AD, 0x18AE, 0x18AD, 0x18AD, 0x8017, 0x18AD,
+  0x0001, 0x18AE, 0x800C, 0x18AD, 0x0002, 0x18CD, 0x18AE, 0x8003, 0x18AD, 0x000B, 0x20AD, 0x18AE, 0x00F7, 0x0119, 0x0119, 0x18AF,
+  0x18AD, 0x18AD, 0x18AE, 0x18AD, 0x18AE, 0x8026, 0x18AD, 0x000A, 0x18AE, 0x18AD, 0x18AD, 0x28AE, 0x8159, 0x917C, 0x997C, 0x997C,
+  0x999C, 0x999C, 0x8004, 0x18AD, 0x0004, 0x18AE, 0x18AD, 0x18AD, 0x18AE, 0x801C, 0x18AD, 0x0004, 0x10D2, 0x0119, 0x0119, 0x08D5,
+  0x8004, 0x18AD, 0x0001, 0x18CD, 0x8003, 0x18AD, 0x0006, 0x08F4, 0x0119, 0x00F9, 0x10D2, 0x18AD, 0x18AE, 0x8016, 0x18AD, 0x0004,
+  0x20AD, 0x20AD, 0x20AE, 0x20AE, 0x8003, 0x20CE, 0x000D, 0x20D0, 0x20D1, 0x28CF, 0x28CF, 0x28EF, 0x30F0, 0x30F0, 0x3110, 0x3910,
+  0x4111, 0x4112, 0x4112, 0x9294, 0x8005, 0xD395, 0x8005, 0xD375, 0x8006, 0xD355, 0x8005, 0xD335, 0x000C, 0xD315, 0xD315, 0xD314,
+  0xD2F4, 0xD2F4, 0xD315, 0xD2F4, 0xD2F5, 0xD2F4, 0xD2D5, 0x79D2, 0x3110, 0x8003, 0x30F0, 0x000B, 0x28F0, 0x30D0, 0x28EF, 0x28F0,
+  0x28CF, 0x5150, 0xAA32, 0xD293, 0xD294, 0xD294, 0xCA93, 0x8004, 0xCA74, 0x0014, 0xD274, 0xD254, 0xCA53, 0xCA54, 0xB2D5, 0x83B8,
+  0x44FC, 0x1DBE, 0x063F, 0x0CDB, 0x0B76, 0x1377, 0x1377, 0x0B76, 0x1356, 0x0B76, 0x0B77, 0x23F8, 0x6991, 0x510F, 0x8017, 0x18AD,
+  0x0002, 0x0119, 0x0119, 0x8011, 0x18AD, 0x0001, 0x18CD, 0x8007, 0x18AD, 0x0003, 0x18AE, 0x18AD, 0x20AD, 0x8014, 0x18AD, 0x0004,
+  0x20AD, 0x18AD, 0x18AD, 0x18AE, 0x8003, 0x18AD, 0x0001, 0x18AE, 0x8008, 0x18AD, 0x0001, 0x20AD, 0x8003, 0x18AD, 0x000B, 0x18CD,
+  0x18AD, 0x18AD, 0x18CE, 0x00F7, 0x0119, 0x00F9, 0x18AF, 0x18AD, 0x18AD, 0x18AE, 0x8024, 0x18AD, 0x000D, 0x18AE, 0x18AD, 0x18AD,
+  0x20AD, 0x18AD, 0x18AE, 0x20AD, 0x20AE, 0x8939, 0xA17C, 0xA17C, 0xA15D, 0xA15D, 0x8007, 0x18AD, 0x0001, 0x20AD, 0x8019, 0x18AD,
+  0x0007, 0x18AE, 0x18AD, 0x10D2, 0x0119, 0x011A, 0x08F5, 0x18AE, 0x8005, 0x18AD, 0x0007, 0x20AE, 0x18AD, 0x08F5, 0x0119, 0x0119,
+  0x10D2, 0x20AD, 0x8017, 0x18AD, 0x8005, 0x20AE, 0x8003, 0x20CE, 0x0007, 0x28CE, 0x28CF, 0x28CF, 0x28EF, 0x28F0, 0x30F0, 0x3110,
+  0x8003, 0x3911, 0x0003, 0x4112, 0x4132, 0x8A54, 0x8004, 0xD395, 0x8005, 0xD375, 0x8007, 0xD355, 0x8003, 0xD335, 0x8003, 0xD315,
+  0x8003, 0xD314, 0x0009, 0xD2F4, 0xD2F4, 0xD2F5, 0xD2F4, 0xD2F4, 0xD2D4, 0xCAD4, 0x5951, 0x38F0, 0x8005, 0x30F0, 0x0009, 0x4130,
+  0x91F2, 0xD294, 0xD294, 0xCA94, 0xCA74, 0xCA94, 0xCA94, 0xCA74, 0x8003, 0xD274, 0x0011, 0xD253, 0xB2D5, 0x7419, 0x257D, 0x063F,
+  0x061F, 0x057D, 0x12B5, 0x190F, 0x18CE, 0x20AE, 0x20AD, 0x20AD, 0x18AD, 0x18AD, 0x20AD, 0x18AE, 0x801A, 0x18AD, 0x0002, 0x0119,
+  0x0119, 0x8016, 0x18AD, 0x0006, 0x18AE, 0x18AD, 0x18AD, 0x18CD, 0x18AD, 0x18AD, 0x8008, 0x18AD, 0x0001, 0x18AE, 0x800F, 0x18AD,
+  0x0001, 0x18AE, 0x800E, 0x18AD, 0x0001, 0x18AE, 0x8004, 0x18AD, 0x0008, 0x18CE, 0x0117, 0x0119, 0x0119, 0x18B0, 0x18AD, 0x18AD,
+  0x18AE, 0x802B, 0x18AD, 0x0005, 0x20CE, 0x913A, 0xA93D, 0xA95D, 0xA95C, 0x8022, 0x18AD, 0x0005, 0x10D2, 0x0119, 0x0119, 0x08F5,
+  0x20AD, 0x8004, 0x18AD, 0x000D, 0x18AE, 0x18AD, 0x18AD, 0x08F5, 0x0119, 0x0119, 0x10D2, 0x18AD, 0x18AD, 0x20AE, 0x18AE, 0x18CD,
+  0x18AE, 0x8013, 0x18AD, 0x8004, 0x20AE, 0x8003, 0x20CE, 0x0007, 0x20CF, 0x28CE, 0x28CF, 0x28EF, 0x28F0, 0x30F0, 0x30F0, 0x8003,
+  0x3911, 0x0006, 0x4132, 0x4132, 0x4932, 0x9255, 0xD395, 0xD395, 0x8006, 0xD375, 0x8006, 0xD355, 0x8004, 0xD335, 0x8003, 0xD315,
+  0x8003, 0xD314, 0x0002, 0xD2F4, 0xD2F5, 0x8004, 0xD2F4, 0x0017, 0xD2D4, 0xD2D4, 0xCAB4, 0x5172, 0x3911, 0x38F1, 0x38F0, 0x30F0,
+  0x81D2, 0xC294, 0xD294, 0xD293, 0xD294, 0xD294, 0xCA93, 0xCA93, 0xD274, 0xD274, 0xCA73, 0xD274, 0x83D8, 0x353D, 0x061F, 0x8003,
+  0x063F, 0x000F, 0x4C5A, 0x4970, 0x20AE, 0x20AE, 0x20AD, 0x18CD, 0x20AD, 0x20AD, 0x18AD, 0x20AD, 0x18AE, 0x18AD, 0x18AD, 0x18AE,
+  0x18AE, 0x8017, 0x18AD, 0x0002, 0x0119, 0x0119, 0x8011, 0x18AD, 0x0005, 0x18CD, 0x18AD, 0x18AD, 0x18AE, 0x18AE, 0x8005, 0x18AD,
+  0x0001, 0x20AD, 0x8008, 0x18AD, 0x0001, 0x18AE, 0x800B, 0x18AD, 0x0008, 0x18CD, 0x18AD, 0x18AD, 0x18CD, 0x10D2, 0x08F3, 0x08D4,
+  0x10D2, 0x8008, 0x18AD, 0x0006, 0x18AE, 0x18AD, 0x20AD, 0x18CD, 0x18AD, 0x18AE, 0x8003, 0x18AD, 0x0005, 0x18CE, 0x00F7, 0x0119,
+  0x00F9, 0x10CF, 0x802E, 0x18AD, 0x0001, 0x20AE, 0x8003, 0xB11D, 0x8004, 0x18AD, 0x0002, 0x18AE, 0x20AD, 0x801B, 0x18AD, 0x0008,
+  0x10D2, 0x0119, 0x0119, 0x08D5, 0x18AE, 0x18AD, 0x18AD, 0x18AE, 0x8004, 0x18AD, 0x0004, 0x08F5, 0x0119, 0x0119, 0x10D2, 0x8005,
+  0x18AD, 0x0001, 0x20AD, 0x8013, 0x18AD, 0x8003, 0x20AE, 0x8004, 0x20CE, 0x0011, 0x28CF, 0x20CF, 0x28CF, 0x28CF, 0x28EF, 0x30F0,
+  0x30F0, 0x38F0, 0x3911, 0x3911, 0x4112, 0x4132, 0x4932, 0x4953, 0x6B36, 0xD395, 0xD395, 0x8005, 0xD375, 0x8007, 0xD355, 0x8004,
+  0xD335, 0x0001, 0xD315, 0x8005, 0xD314, 0x8003, 0xD2F4, 0x0017, 0xD2F5, 0xD2D4, 0xD2D4, 0xD2D5, 0xD2D4, 0xCAD4, 0xCAB4, 0x5972,
+  0x3911, 0x5151, 0xB253, 0xCAB4, 0xD294, 0xCA94, 0xD294, 0xCA94, 0xD294, 0xCA94, 0xCA74, 0xD274, 0xC294, 0x645A, 0x1DBE, 0x8003,
+  0x063F, 0x0005, 0x1DBE, 0x6459, 0xC274, 0x99D2, 0x28CE, 0x8004, 0x20AE, 0x0006, 0x18CE, 0x18AD, 0x18AD, 0x20AE, 0x18AD, 0x20AD,
+  0x801A, 0x18AD, 0x0002, 0x0119, 0x0119, 0x8010, 0x18AD, 0x0001, 0x20AD, 0x8004, 0x18AD, 0x0001, 0x20AD, 0x8003, 0x18AD, 0x0003,
+  0x18AE, 0x18AD, 0x18AD, 0x8016, 0x18AD, 0x0002, 0x18AF, 0x0117, 0x8004, 0x0119, 0x0002, 0x0117, 0x18AE, 0x8003, 0x18AD, 0x0002,
+  0x18AE, 0x18CD, 0x800B, 0x18AD, 0x000C, 0x18CE, 0x00F7, 0x0119, 0x0119, 0x18D0, 0x18CD, 0x18AD, 0x18AD, 0x20AD, 0x18AE, 0x18CD,
+  0x18AE, 0x8018, 0x18AD, 0x0004, 0x18AE, 0x18AD, 0x18AD, 0x18AE, 0x8004, 0x18AD, 0x0004, 0x18CD, 0x18AE, 0x18AD, 0x20AD, 0x8003,
+  0x18AD, 0x0003, 0xB8FE, 0xB8FD, 0xB8FE, 0x8003, 0x18AD, 0x0004, 0x20AE, 0x18AD, 0x18AD, 0x18AE, 0x8019, 0x18AD, 0x0004, 0x10D0,
+  0x00F9, 0x0119, 0x08F5, 0x8004, 0x18AD, 0x0008, 0x18AE, 0x18AE, 0x18AD, 0x18AD, 0x08F5, 0x0119, 0x0119, 0x10D2, 0x8018, 0x18AD,
+  0x0002, 0x20AE, 0x20AD, 0x8004, 0x20AE, 0x8003, 0x20CE, 0x8003, 0x28CF, 0x0023, 0x28EF, 0x28F0, 0x30F0, 0x30F0, 0x3911, 0x3911,
+  0x4111, 0x4132, 0x4132, 0x4933, 0x4953, 0x253B, 0x465C, 0x6D7B, 0x6D9A, 0x6D9A, 0x6D7A, 0x84F9, 0x9C78, 0x9C77, 0x9C78, 0x9C78,
+  0x9C57, 0x9C78, 0x9C58, 0x9C58, 0xBBB6, 0xD334, 0xD315, 0xD334, 0xD315, 0xD314, 0xD315, 0xD2F4, 0xCAF4, 0x8003, 0xD2F4, 0x0016,
+  0xD2F5, 0xD2D4, 0xCAD4, 0xD2D4, 0xD2D4, 0xCAD4, 0xCAB4, 0xD2D4, 0x91F3, 0x5972, 0xCA74, 0xD2B4, 0xD2B4, 0xD294, 0xCA94, 0xD294,
+  0xD294, 0xCA94, 0xCA74, 0xC2B4, 0x6C5A, 0x0DFF, 0x8003, 0x063F, 0x0007, 0x353D, 0x83B8, 0xCA53, 0xCA33, 0x89B1, 0x20CE, 0x20CE,
+  0x8007, 0x20AE, 0x801A, 0x18AD, 0x0006, 0x20AD, 0x18AD, 0x18AE, 0x011A, 0x0119, 0x18CD, 0x801B, 0x18AD, 0x8016, 0x18AD, 0x0002,
+  0x08F5, 0x00F9, 0x8004, 0x0119, 0x0008, 0x00F9, 0x08F5, 0x20AD, 0x18AD, 0x18AE, 0x18AD, 0x18AD, 0x18AE, 0x800B, 0x18AD, 0x0006,
+  0x18AE, 0x0117, 0x0119, 0x0119, 0x18D0, 0x18AE, 0x8004, 0x18AD, 0x0001, 0x20AD, 0x8017, 0x18AD, 0x0001, 0x18AE, 0x800B, 0x18AD,
+  0x000D, 0x18AE, 0x18AD, 0x20AD, 0x18AE, 0xC0DE, 0xC0FE, 0xC0DD, 0x18AE, 0x18CD, 0x20AD, 0x18AD, 0x18AD, 0x20AD, 0x801A, 0x18AD,
+  0x000F, 0x00F9, 0x00FA, 0x08F4, 0x18AD, 0x18AE, 0x18AD, 0x20AE, 0x18AD, 0x18AD, 0x18CD, 0x18AD, 0x18AD, 0x0119, 0x0119, 0x10D2,
+  0x8017, 0x18AD, 0x8005, 0x20AE, 0x0002, 0x20CE, 0x20AE, 0x8003, 0x20CE, 0x8004, 0x28CF, 0x0010, 0x30EF, 0x30F0, 0x30F0, 0x3911,
+  0x38F1, 0x3911, 0x4112, 0x4132, 0x4932, 0x4953, 0x5153, 0x4D1A, 0x6D9A, 0x94B9, 0x9C98, 0x9C77, 0x8003, 0x9C78, 0x000D, 0x94B8,
+  0x6D7A, 0x6D7A, 0x6D7B, 0x367C, 0x367D, 0x1EFE, 0x077F, 0x075F, 0x1EDE, 0x363D, 0x6D3A, 0x9C17, 0x8005, 0xD2F4, 0x0001, 0xD2F5,
+  0x8004, 0xD2D4, 0x000B, 0xCAD4, 0xD2B4, 0xCAD4, 0xD2B3, 0xCAB4, 0xC294, 0xCAB4, 0xCA94, 0xCA94, 0xD294, 0xCA94, 0x8003, 0xCA74,
+  0x000C, 0x7BD8, 0x0DFF, 0x063F, 0x061F, 0x063F, 0x4CBB, 0x9B57, 0xD233, 0xCA33, 0xCA53, 0x6150, 0x28CF, 0x8004, 0x20CE, 0x8006,
+  0x20AE, 0x8017, 0x18AD, 0x0001, 0x20AD, 0x8004, 0x18AD, 0x0002, 0x0119, 0x0119, 0x8007, 0x18AD, 0x0001, 0x20AD, 0x8014, 0x18AD,
+  0x8014, 0x18AD, 0x0004, 0x18AE, 0x18AD, 0x0119, 0x0119, 0x8003, 0x011A, 0x8003, 0x0119, 0x0006, 0x18AD, 0x18AE, 0x20AD, 0x18AD,
+  0x20AD, 0x18AE, 0x8008, 0x18AD, 0x0009, 0x18AE, 0x18AD, 0x18AD, 0x20AD, 0x18AE, 0x0917, 0x0119, 0x0119, 0x18CF, 0x8005, 0x18AD,
+  0x0001, 0x20CD, 0x8017, 0x18AD, 0x0004, 0x20AD, 0x18AD, 0x18AE, 0x18AE, 0x8003, 0x18AD, 0x0001, 0x18AE, 0x8007, 0x18AD, 0x0005,
+  0xC8BE, 0xC8DE, 0xC8BE, 0x18AD, 0x18AD, 0x8003, 0x18AE, 0x0002, 0x18AD, 0x18AE, 0x8019, 0x18AD, 0x0006, 0x0119, 0x0119, 0x18AD,
+  0x18AD, 0x20AD, 0x18CD, 0x8006, 0x18AD, 0x0002, 0x0119, 0x011A, 0x8017, 0x18AD, 0x0001, 0x20AD, 0x8006, 0x20AE, 0x8003, 0x20CE,
+  0x8004, 0x28CF, 0x8003, 0x30F0, 0x0009, 0x38F0, 0x3911, 0x3911, 0x3912, 0x4132, 0x4132, 0x4933, 0x5153, 0xA2B5, 0x8005, 0xD375,
+  0x8004, 0xD355, 0x0003, 0xD335, 0xD355, 0xD334, 0x8004, 0xD335, 0x002A, 0xBB96, 0xA437, 0x74F9, 0x4DBC, 0x2E7E, 0x0EDF, 0x559B,
+  0x8498, 0xC335, 0xD2F4, 0xD2D4, 0xD2F5, 0xD2D4, 0xD2D4, 0xD2B5, 0xCAB4, 0xD2B4, 0xD2B4, 0xCAB4, 0xD2B4, 0xD2B4, 0xBAB4, 0xBAF6,
+  0xCA94, 0xD294, 0xCA94, 0xD273, 0x9B76, 0x1DBE, 0x061F, 0x063F, 0x0DDF, 0x643A, 0xB2D5, 0xCA54, 0xD253, 0xCA53, 0xC294, 0x59B1,
+  0x28CE, 0x28CF, 0x28CE, 0x8004, 0x20CE, 0x8007, 0x20AE, 0x8016, 0x18AD, 0x0009, 0x18CD, 0x18AD, 0x18AE, 0x18AD, 0x0119, 0x011A,
+  0x18AD, 0x18AD, 0x18AE, 0x8019, 0x18AD, 0x8016, 0x18AD, 0x0001, 0x011A, 0x8007, 0x0119, 0x0001, 0x18AE, 0x800F, 0x18AD, 0x000C,
+  0x18CD, 0x18AD, 0x18AD, 0x18AE, 0x0117, 0x0119, 0x00F9, 0x18AF, 0x18AE, 0x18AD, 0x18AD, 0x18AE, 0x8013, 0x18AD, 0x000D, 0x18AE,
+  0x18AD, 0x18AE, 0x20AD, 0x18AD, 0x18CD, 0x18AE, 0x18AD, 0x18AD, 0x18AE, 0x18CD, 0x18CD, 0x20AD, 0x8004, 0x18AD, 0x000C, 0x20AD,
+  0x40B0, 0xA09A, 0xD0BE, 0xD09E, 0xD0BE, 0xB89C, 0x78B5, 0x28AE, 0x18AD, 0x20AD, 0x18AE, 0x801A, 0x18AD, 0x0003, 0x0119, 0x0119,
+  0x18AE, 0x8004, 0x18AD, 0x0001, 0x18CD, 0x8003, 0x18AD, 0x0004, 0x18AE, 0x0119, 0x011A, 0x20AD, 0x8015, 0x18AD, 0x0002, 0x20AD,
+  0x20AD, 0x8004, 0x20AE, 0x8004, 0x20CE, 0x8004, 0x28CF, 0x000D, 0x30EF, 0x30F0, 0x30F0, 0x38F0, 0x3911, 0x3911, 0x4112, 0x4112,
+  0x4932, 0x4933, 0x5173, 0xBB15, 0xD395, 0x8003, 0xD375, 0x8006, 0xD355, 0x0015, 0xD335, 0xD355, 0xD335, 0xD335, 0xD314, 0xD314,
+  0xD335, 0xD315, 0xD314, 0xD315, 0xD2F5, 0xD2F5, 0xD2F4, 0x9BF7, 0x6D1A, 0x2E3D, 0x45BC, 0x9418, 0xD2D4, 0xCAD4, 0xD2D4, 0x8003,
+  0xD2B4, 0x0002, 0xCAB4, 0xD2B4, 0x8003, 0xD294, 0x0011, 0xC2D4, 0x4CDB, 0x7BD8, 0x9B57, 0x44FC, 0x063F, 0x063F, 0x1DBE, 0x83D8,
+  0xC294, 0xCA53, 0xCA54, 0xCA33, 0xCA53, 0xB2B5, 0x33B8, 0x28F0, 0x8003, 0x28CF, 0x0002, 0x20CF, 0x20CF, 0x8005, 0x20CE, 0x8004,
+  0x20AE, 0x8017, 0x18AD, 0x000D, 0x188E, 0x20CD, 0x10D1, 0x0119, 0x011A, 0x10D1, 0x20AE, 0x18AD, 0x18AE, 0x18AD, 0x18AD, 0x18AE,
+  0x20AD, 0x8014, 0x18AD, 0x8014, 0x18AD, 0x000E, 0x18CD, 0x18AD, 0x0119, 0x0119, 0x011A, 0x0119, 0x0119, 0x011A, 0x0119, 0x0119,
+  0x18AE, 0x18AD, 0x18AD, 0x18AE, 0x800A, 0x18AD, 0x0002, 0x18CD, 0x18AE, 0x8003, 0x18AD, 0x0007, 0x20AD, 0x18AE, 0x00F7, 0x0119,
+  0x0118, 0x10D0, 0x18AE, 0x8016, 0x18AD, 0x0001, 0x18CD, 0x8005, 0x18AD, 0x0003, 0x18AE, 0x18AD, 0x18AE, 0x8006, 0x18AD, 0x000E,
+  0x20AE, 0x40B0, 0xD07D, 0xD87E, 0xD89F, 0xD89F, 0xE07F, 0xD89E, 0xD89F, 0xB87B, 0x28AE, 0x20AD, 0x18AE, 0x18AE, 0x8019, 0x18AD,
+  0x0003, 0x0119, 0x0119, 0x20AD, 0x8003, 0x18AD, 0x0003, 0x18AE, 0x18AD, 0x18AE, 0x8003, 0x18AD, 0x0003, 0x011A, 0x0119, 0x20AD,
+  0x8013, 0x18AD, 0x0005, 0x20AE, 0x20AE, 0x20AD, 0x20AD, 0x20AE, 0x8006, 0x20CE, 0x0002, 0x28CF, 0x28CF, 0x8003, 0x28EF, 0x0003,
+  0x30F0, 0x30F0, 0x3110, 0x8003, 0x3911, 0x0005, 0x4132, 0x4132, 0x4933, 0x5174, 0xBB14, 0x8005, 0xD375, 0x8005, 0xD355, 0x0002,
+  0xD335, 0xD334, 0x8003, 0xD335, 0x0006, 0xD314, 0xD335, 0xD315, 0xD314, 0xD314, 0xD315, 0x8004, 0xD2F4, 0x0023, 0xD2F5, 0xD2D4,
+  0xC335, 0x8478, 0x4D7B, 0x4D5B, 0xAB96, 0xD2B4, 0xCAB4, 0xD2B4, 0xD2B4, 0xCA94, 0xCAB4, 0xD294, 0xD294, 0xD273, 0xC2B4, 0x5C9A,
+  0x061F, 0x061F, 0x063F, 0x7419, 0xD273, 0xD273, 0xCA53, 0xCA53, 0xD233, 0xCA53, 0xAAF6, 0x153C, 0x2951, 0x30F0, 0x30F0, 0x28EF,
+  0x28EF, 0x8003, 0x28CF, 0x8004, 0x20CE, 0x8005, 0x20AE, 0x8016, 0x18AD, 0x0002, 0x18AE, 0x0117, 0x8004, 0x0119, 0x0007, 0x0117,
+  0x18CE, 0x18AD, 0x18AD, 0x18AE, 0x18AE, 0x18CD, 0x8014, 0x18AD, 0x8016, 0x18AD, 0x0001, 0x08F6, 0x8005, 0x0119, 0x0002, 0x011A,
+  0x08F5, 0x8003, 0x18AD, 0x0003, 0x18AE, 0x18AD, 0x18AE, 0x8008, 0x18AD, 0x0001, 0x20AD, 0x8003, 0x18AD, 0x000B, 0x18CD, 0x18AD,
+  0x18AD, 0x18CE, 0x00F7, 0x0119, 0x0119, 0x10B0, 0x18AE, 0x18AD, 0x18AE, 0x8011, 0x18AD, 0x0009, 0x20AD, 0x208D, 0x18AD, 0x10D2,
+  0x08F3, 0x10D3, 0x10D2, 0x18AD, 0x20AD, 0x8003, 0x18AD, 0x0001, 0x18AE, 0x8005, 0x18AD, 0x000E, 0xB07A, 0xE85F, 0xE85F, 0xE07F,
+  0xE85F, 0xE87F, 0xE07F, 0xE85F, 0xE07F, 0x9898, 0x20AD, 0x18AD, 0x18CD, 0x20AD, 0x8018, 0x18AD, 0x0009, 0x011A, 0x0119, 0x18AD,
+  0x18AD, 0x18CD, 0x18AD, 0x18AD, 0x18AE, 0x18CD, 0x8003, 0x18AD, 0x0004, 0x0119, 0x011A, 0x18AD, 0x18AE, 0x8010, 0x18AD, 0x8008,
+  0x20AE, 0x8004, 0x20CE, 0x0001, 0x20CF, 0x8003, 0x28CF, 0x000D, 0x28EF, 0x30F0, 0x30F0, 0x3110, 0x3910, 0x3911, 0x3911, 0x4112,
+  0x4132, 0x4932, 0x5153, 0xBB15, 0xD395, 0x8005, 0xD375, 0x001F, 0xD355, 0xD355, 0xD354, 0xD355, 0xD335, 0xD355, 0xD335, 0xD335,
+  0xD315, 0xCB34, 0xD315, 0xD314, 0xD314, 0xD315, 0xD314, 0xD2F4, 0xD2F5, 0xD2F4, 0xCAF4, 0xD2F4, 0xD2D4, 0xD2D4, 0xD2D5, 0xD2D4,
+  0xD2D4, 0xBB55, 0x7499, 0x35DC, 0x8439, 0xC2F4, 0xD2B4, 0x8003, 0xD294, 0x0009, 0xCA93, 0xD294, 0xD274, 0xCA74, 0x9B76, 0x061F,
+  0x061F, 0x83D8, 0xC295, 0x8004, 0xCA53, 0x0007, 0x7BB8, 0x063F, 0x2A34, 0x30F0, 0x30F0, 0x30EF, 0x30F0, 0x8005, 0x28CF, 0x8005,
+  0x20CE, 0x8003, 0x20AE, 0x0003, 0x20AD, 0x20AE, 0x20AE, 0x8011, 0x18AD, 0x000A, 0x20AD, 0x18AD, 0x08F5, 0x0119, 0x0119, 0x011A,
+  0x0119, 0x011A, 0x00F9, 0x08D5, 0x8004, 0x18AD, 0x0001, 0x20AE, 0x8014, 0x18AD, 0x8015, 0x18AD, 0x0001, 0x10D2, 0x8005, 0x0119,
+  0x0003, 0x011A, 0x00F7, 0x18CE, 0x8011, 0x18AD, 0x0001, 0x18AE, 0x8004, 0x18AD, 0x0008, 0x18CE, 0x00F7, 0x0119, 0x0118, 0x18D0,
+  0x18AD, 0x18AD, 0x18AE, 0x8010, 0x18AD, 0x000B, 0x18AE, 0x18AE, 0x00F7, 0x0119, 0x00F9, 0x0119, 0x0119, 0x00F7, 0x18CE, 0x18AD,
+  0x18AE, 0x8006, 0x18AD, 0x0006, 0x38B0, 0xF05F, 0xE83F, 0xF03F, 0xF05F, 0xF05F, 0x8003, 0xF03F, 0x0005, 0xF05F, 0xE83F, 0x18AD,
+  0x18AD, 0x18AE, 0x8019, 0x18AD, 0x0009, 0x0119, 0x011A, 0x18AD, 0x18AD, 0x18AE, 0x18AE, 0x18AD, 0x18AD, 0x18AE, 0x8003, 0x18AD,
+  0x0002, 0x0119, 0x011A, 0x8012, 0x18AD, 0x8005, 0x20AE, 0x8005, 0x20CE, 0x8005, 0x28CF, 0x0001, 0x30EF, 0x8003, 0x30F0, 0x8003,
+  0x3911, 0x0006, 0x4112, 0x4132, 0x4933, 0x5173, 0xBB35, 0xD395, 0x8004, 0xD375, 0x8005, 0xD355, 0x8005, 0xD335, 0x0002, 0xCB35,
+  0xD315, 0x8004, 0xD314, 0x8003, 0xD2F4, 0x0022, 0xD2F5, 0xD2F5, 0xCAD4, 0xD2F4, 0xCAD4, 0xD2D4, 0xD2D4, 0xCAB4, 0xD2B4, 0xCAB4,
+  0xCAB4, 0x8BF8, 0x3D5C, 0x6499, 0xC2D4, 0xD294, 0xD294, 0xCA74, 0xCA74, 0xD274, 0xCA74, 0xCA74, 0x54BB, 0x5C9A, 0x353D, 0x1DBE,
+  0x4CBB, 0x9377, 0x9B36, 0x44FC, 0x061F, 0x1BF9, 0x3911, 0x3910, 0x8004, 0x30F0, 0x0001, 0x30EF, 0x8004, 0x28CF, 0x8005, 0x20CE,
+  0x8005, 0x20AE, 0x0001, 0x20AD, 0x8011, 0x18AD, 0x000E, 0x18AE, 0x0119, 0x0119, 0x011A, 0x011A, 0x0119, 0x011A, 0x0119, 0x0119,
+  0x18AD, 0x18AE, 0x18AD, 0x18AD, 0x18AE, 0x8014, 0x18AD, 0x8014, 0x18AD, 0x0001, 0x10D2, 0x8004, 0x0119, 0x0005, 0x08F4, 0x10F3,
+  0x10D2, 0x18AD, 0x20AD, 0x8004, 0x18AD, 0x0001, 0x18AE, 0x8009, 0x18AD, 0x000E, 0x18AE, 0x18AD, 0x20AD, 0x18CD, 0x18AD, 0x18AE,
+  0x18AD, 0x18AD, 0x18AE, 0x18AE, 0x00F7, 0x0119, 0x0118, 0x18CE, 0x8013, 0x18AD, 0x0008, 0x08F5, 0x011A, 0x0119, 0x011A, 0x011A,
+  0x0119, 0x0119, 0x08F5, 0x8003, 0x18AD, 0x0009, 0x20AD, 0x18AD, 0x18AD, 0x20AE, 0x18AD, 0x5092, 0xF83F, 0xF83F, 0xF03F, 0x8004,
+  0xF83F, 0x0004, 0xF81F, 0xF03F, 0xF83F, 0x5092, 0x801B, 0x18AD, 0x0002, 0x0119, 0x0119, 0x8007, 0x18AD, 0x0005, 0x18CD, 0x18AD,
+  0x18AD, 0x011A, 0x0119, 0x8011, 0x18AD, 0x8006, 0x20AE, 0x8004, 0x20CE, 0x8004, 0x28CF, 0x0001, 0x28EF, 0x8004, 0x30F0, 0x8003,
+  0x3911, 0x0005, 0x4112, 0x4132, 0x4932, 0x69B3, 0xC355, 0x8007, 0xD375, 0x8003, 0xD355, 0x8004, 0xD335, 0x0003, 0xD315, 0xD335,
+  0xD335, 0x8003, 0xD314, 0x0002, 0xD2F5, 0xD2F5, 0x8004, 0xD2F4, 0x8006, 0xD2D4, 0x0019, 0xCAD4, 0xCAB4, 0xD2B4, 0xD2B4, 0xCAB4,
+  0xD294, 0x9B97, 0x453C, 0x6C59, 0xC2B4, 0xCA74, 0xD274, 0xD273, 0xCA73, 0xD273, 0xC294, 0x6C39, 0xC294, 0xCA53, 0x8B98, 0x4CBB,
+  0x0DFF, 0x063F, 0x0D7E, 0x3972, 0x8003, 0x3911, 0x0001, 0x38F0, 0x8003, 0x30F0, 0x0001, 0x30EF, 0x8004, 0x28CF, 0x8004, 0x20CE,
+  0x0007, 0x20AE, 0x20CE, 0x20CE, 0x20AE, 0x20AE, 0x20AD, 0x20AD, 0x800F, 0x18AD, 0x0002, 0x20AD, 0x18AD, 0x8004, 0x0119, 0x0005,
+  0x011A, 0x011A, 0x0119, 0x011A, 0x20AD, 0x8018, 0x18AD, 0x800E, 0x18AD, 0x0006, 0x18AE, 0x18CD, 0x20AE, 0x18AD, 0x18AD, 0x10D2,
+  0x8003, 0x0119, 0x0002, 0x00F9, 0x10CF, 0x801D, 0x18AD, 0x0005, 0x18CE, 0x00F7, 0x011A, 0x0119, 0x011A, 0x8014, 0x0119, 0x0009,
+  0x011A, 0x0119, 0x0119, 0x011A, 0x0119, 0x0119, 0x18CD, 0x18AD, 0x20AE, 0x8003, 0x18AD, 0x0003, 0x20AD, 0x18AD, 0x5092, 0x800A,
+  0xF81F, 0x0001, 0x5092, 0x801B, 0x18AD, 0x0002, 0x0119, 0x0119, 0x8003, 0x18AD, 0x0002, 0x18AE, 0x20AD, 0x8005, 0x18AD, 0x0009,
+  0x011A, 0x0119, 0x18AD, 0x18AD, 0x18AE, 0x18AD, 0x18AD, 0x18AE, 0x20AD, 0x8005, 0x18AD, 0x0003, 0x20AE, 0x20AE, 0x20AD, 0x8005,
+  0x20AE, 0x8005, 0x20CE, 0x0002, 0x28CF, 0x28CE, 0x8004, 0x28CF, 0x8003, 0x30F0, 0x0009, 0x38F0, 0x3911, 0x3911, 0x4111, 0x4112,
+  0x4132, 0x4933, 0x9254, 0xD395, 0x8004, 0xD375, 0x0002, 0xD355, 0xD375, 0x8003, 0xD355, 0x0003, 0xD335, 0xD335, 0xD355, 0x8005,
+  0xD335, 0x8004, 0xD314, 0x8003, 0xD2F4, 0x000D, 0xD2F5, 0xD2F4, 0xD2D4, 0xD2D4, 0xCAD4, 0xD2D4, 0xCAD4, 0xD2D4, 0xD2B4, 0xCAB4,
+  0xD2B4, 0xD2B4, 0xCAB4, 0x8003, 0xD294, 0x0017, 0xCA94, 0x9B77, 0x44DC, 0x73F9, 0xCA73, 0xCA74, 0xD254, 0xCA73, 0xCA53, 0xC294,
+  0x351C, 0x6C3A, 0xC294, 0xD253, 0xCA34, 0x83B8, 0x5A55, 0x4132, 0x4132, 0x3912, 0x3911, 0x3911, 0x3910, 0x8003, 0x30F0, 0x0002,
+  0x28F0, 0x28EF, 0x8004, 0x28CF, 0x0001, 0x20CF, 0x8005, 0x20CE, 0x0004, 0x20AE, 0x18AD, 0x20AE, 0x20AE, 0x8010, 0x18AD, 0x8006,
+  0x0119, 0x0007, 0x011A, 0x0119, 0x18AD, 0x18AD, 0x18AE, 0x18AD, 0x20AD, 0x8014, 0x18AD, 0x8010, 0x18AD, 0x0008, 0x18AE, 0x18AD,
+  0x18B0, 0x0119, 0x011A, 0x0119, 0x00F8, 0x18D0, 0x801C, 0x18AD, 0x0008, 0x20AD, 0x18AD, 0x18AD, 0x18CE, 0x0117, 0x0119, 0x0119,
+  0x00F9, 0x8012, 0x0119, 0x0001, 0x011A, 0x8003, 0x0119, 0x0003, 0x011A, 0x0119, 0x011A, 0x8008, 0x18AD, 0x0001, 0x4090, 0x800A,
+  0xF81F, 0x0001, 0x28AF, 0x8018, 0x18AD, 0x0005, 0x18AE, 0x18AD, 0x18AD, 0x0119, 0x0119, 0x8005, 0x18AD, 0x000B, 0x20AE, 0x18AD,
+  0x18AD, 0x18CD, 0x20AD, 0x0119, 0x0119, 0x18AE, 0x18AD, 0x18AE, 0x20AD, 0x8009, 0x18AD, 0x0001, 0x20AD, 0x8005, 0x20AE, 0x8005,
+  0x20CE, 0x8003, 0x28CF, 0x0003, 0x28EF, 0x28EF, 0x28F0, 0x8003, 0x30F0, 0x000A, 0x38F0, 0x3911, 0x3911, 0x4112, 0x4132, 0x4132,
+  0x69D3, 0xC355, 0xD395, 0xD395, 0x8004, 0xD375, 0x8006, 0xD355, 0x0002, 0xD335, 0xCB55, 0x8003, 0xD335, 0x0001, 0xD315, 0x8004,
+  0xD314, 0x8005, 0xD2F4, 0x0004, 0xCAD4, 0xD2F4, 0xD2D4, 0xD2D4, 0x8003, 0xD2B4, 0x8003, 0xCAB4, 0x0002, 0xD2B4, 0xCAB4, 0x8003,
+  0xD294, 0x001E, 0xCA94, 0xD274, 0xCA74, 0x8B78, 0x447C, 0xA316, 0xD253, 0xD253, 0xCA54, 0xCA53, 0xC294, 0x257D, 0x0DDF, 0x83B8,
+  0xD233, 0xCA33, 0xCA33, 0xBA13, 0x7993, 0x4112, 0x4112, 0x4111, 0x3911, 0x3911, 0x38F0, 0x30F0, 0x28F0, 0x30D0, 0x30D0, 0x28EF,
+  0x8003, 0x28CF, 0x8006, 0x20CE, 0x0004, 0x20AE, 0x20AE, 0x18AD, 0x20AE, 0x800C, 0x18AD, 0x000B, 0x18AE, 0x18CD, 0x18AD, 0x08F5,
+  0x0119, 0x011A, 0x011A, 0x0119, 0x011A, 0x00F9, 0x08F5, 0x8019, 0x18AD, 0x800C, 0x18AD, 0x0001, 0x18AE, 0x8004, 0x18AD, 0x000A,
+  0x10CF, 0x0119, 0x00F9, 0x0119, 0x00F8, 0x18CF, 0x18AD, 0x18AE, 0x18CD, 0x18AE, 0x8032, 0x18AD, 0x0008, 0x00F9, 0x011A, 0x0119,
+  0x011A, 0x00F9, 0x0119, 0x0119, 0x00F9, 0x8005, 0x18AD, 0x0005, 0x18AE, 0x18AD, 0x18AE, 0x20AD, 0xD03C, 0x8008, 0xF81F, 0x0004,
+  0xD03C, 0x18AD, 0x20AD, 0x18AE, 0x8019, 0x18AD, 0x0002, 0x0119, 0x0119, 0x8004, 0x18AD, 0x0001, 0x18AE, 0x8005, 0x18AD, 0x0013,
+  0x00F9, 0x0119, 0x18AD, 0x20AD, 0x18AD, 0x18AD, 0x18AE, 0x18AE, 0x20AE, 0x20AD, 0x20AE, 0x20AE, 0x20AD, 0x20AD, 0x20AE, 0x20AE,
+  0x20CE, 0x20CE, 0x20AE, 0x8006, 0x20CE, 0x8005, 0x28CF, 0x8004, 0x30F0, 0x8003, 0x3911, 0x0006, 0x4111, 0x4112, 0x5193, 0xAAD4,
+  0xD375, 0xD395, 0x8005, 0xD375, 0x8006, 0xD355, 0x8003, 0xD335, 0x0003, 0xD314, 0xD314, 0xD315, 0x8004, 0xD314, 0x0001, 0xD315,
+  0x8004, 0xD2F4, 0x8003, 0xD2D4, 0x001D, 0xCAD4, 0xD2B4, 0xD2B4, 0xD2D4, 0xD2B4, 0xCAB4, 0xD2B4, 0xD2B4, 0xD294, 0xD2B4, 0xCA94,
+  0xCA94, 0xD294, 0xCA74, 0xCA73, 0xCA74, 0xD274, 0xC295, 0x6BB9, 0x6B99, 0xCA54, 0xCA53, 0xD254, 0xCA33, 0xC294, 0x24FD, 0x063F,
+  0x351D, 0xB295, 0x8003, 0xCA13, 0x000B, 0xB9F3, 0x7992, 0x4111, 0x4112, 0x38F1, 0x3911, 0x3911, 0x38F0, 0x30F0, 0x30F0, 0x30EF,
+  0x8003, 0x28CF, 0x0001, 0x20CF, 0x8006, 0x20CE, 0x8004, 0x20AE, 0x800C, 0x18AD, 0x0004, 0x18AE, 0x18AD, 0x18CF, 0x00F7, 0x8004,
+  0x0119, 0x0005, 0x0117, 0x18CE, 0x18AD, 0x18AD, 0x18AE, 0x8016, 0x18AD, 0x8010, 0x18AD, 0x000B, 0x18CF, 0x0118, 0x00F9, 0x0119,
+  0x00F9, 0x18D0, 0x18AD, 0x18AE, 0x18AD, 0x18AD, 0x18CD, 0x801A, 0x18AD, 0x0001, 0x18AE, 0x8005, 0x18AD, 0x0001, 0x18AE, 0x8011,
+  0x18AD, 0x0003, 0x08F5, 0x0119, 0x00F9, 0x8003, 0x0119, 0x0002, 0x00FA, 0x08F5, 0x8003, 0x18AD, 0x8003, 0x20AD, 0x0005, 0x18AD,
+  0x18AD, 0x20AD, 0x4090, 0xF03F, 0x8007, 0xF81F, 0x0003, 0x6073, 0x20AD, 0x20AE, 0x8014, 0x18AD, 0x0002, 0x18AE, 0x18AE, 0x8004,
+  0x18AD, 0x0011, 0x0119, 0x0119, 0x18AD, 0x18AE, 0x18AD, 0x18AD, 0x20AE, 0x18AD, 0x18AD, 0x20AD, 0x18AD, 0x18AD, 0x0119, 0x011A,
+  0x18AD, 0x18AD, 0x18AE, 0x8003, 0x18AD, 0x0005, 0x20AE, 0x20AE, 0x20CD, 0x20AE, 0x20AD, 0x8004, 0x20AE, 0x8006, 0x20CE, 0x0001,
+  0x28CE, 0x8004, 0x28CF, 0x0002, 0x30EF, 0x28F0, 0x8003, 0x30F0, 0x0009, 0x3910, 0x3911, 0x3912, 0x4112, 0x4112, 0x8233, 0xCB55,
+  0xD375, 0xD395, 0x8005, 0xD375, 0x8004, 0xD355, 0x8005, 0xD335, 0x0005, 0xD334, 0xD314, 0xD335, 0xD314, 0xD314, 0x8006, 0xD2F4,
+  0x8003, 0xD2D4, 0x0002, 0xCAD4, 0xD2D4, 0x8004, 0xD2B4, 0x0004, 0xCAB4, 0xD2B4, 0xD2B4, 0xCAB4, 0x8003, 0xD294, 0x8003, 0xCA74,
+  0x001F, 0xCA73, 0xCA73, 0xCA53, 0xCA53, 0xCA74, 0xAAB6, 0x5B7A, 0xBA74, 0xCA53, 0xCA33, 0xCA33, 0xC254, 0x4BFB, 0x059F, 0x0D7F,
+  0x8B57, 0xC9F3, 0xCA13, 0xC9F3, 0xC9F3, 0xA9B3, 0x5952, 0x4112, 0x3931, 0x3911, 0x3111, 0x3110, 0x30F0, 0x30F0, 0x28F0, 0x28EF,
+  0x8003, 0x28CF, 0x8006, 0x20CE, 0x8004, 0x20AE, 0x800E, 0x18AD, 0x0006, 0x20AD, 0x10D2, 0x08F3, 0x10D3, 0x10D2, 0x20AE, 0x8003,
+  0x18AD, 0x0001, 0x20AD, 0x8016, 0x18AD, 0x800E, 0x18AD, 0x000B, 0x18AE, 0x18D0, 0x00F9, 0x0119, 0x0119, 0x0118, 0x10CF, 0x18AD,
+  0x18AE, 0x18AD, 0x18AE, 0x801F, 0x18AD, 0x0001, 0x20AD, 0x8014, 0x18AD, 0x000A, 0x18CE, 0x00F7, 0x011A, 0x0119, 0x011A, 0x0119,
+  0x00F7, 0x18CE, 0x18AD, 0x18AE, 0x8008, 0x18AD, 0x0002, 0x4091, 0xE01D, 0x8005, 0xF81F, 0x0006, 0x7074, 0x18AD, 0x18AD, 0x18AE,
+  0x18AD, 0x18AE, 0x8012, 0x18AD, 0x0001, 0x18CD, 0x8005, 0x18AD, 0x0005, 0x0119, 0x011A, 0x08F3, 0x10D2, 0x20CD, 0x8003, 0x18AD,
+  0x000D, 0x20AE, 0x18AD, 0x20AD, 0x10D1, 0x0119, 0x0119, 0x10D2, 0x20AD, 0x18AD, 0x20AE, 0x18CD, 0x20AE, 0x20CD, 0x8006, 0x20AE,
+  0x8005, 0x20CE, 0x8004, 0x28CF, 0x0003, 0x28EF, 0x28CF, 0x28EF, 0x8004, 0x30F0, 0x0009, 0x3910, 0x3911, 0x3911, 0x3912, 0x4132,
+  0x4953, 0xB2F4, 0xD395, 0xDB95, 0x8006, 0xD375, 0x8005, 0xD355, 0x0006, 0xD335, 0xD335, 0xD334, 0x84F9, 0x467D, 0x1F5E, 0x8003,
+  0x07DF, 0x8009, 0x07BF, 0x0009, 0x079F, 0x1F1E, 0x367D, 0x367C, 0x4DDB, 0x653A, 0x8498, 0x9BF7, 0xC2F5, 0x8004, 0xD294, 0x0007,
+  0xCA94, 0xCA94, 0xCA74, 0xCA73, 0xD253, 0xD254, 0xCA74, 0x8003, 0xCA53, 0x000C, 0xD253, 0x72D9, 0xAA76, 0xCA33, 0xD233, 0xCA13,
+  0xCA33, 0x1C7E, 0x059F, 0x05FF, 0x5C7A, 0xCA13, 0x8003, 0xC9F3, 0x0003, 0xD1F3, 0x9193, 0x4911, 0x8003, 0x3911, 0x0001, 0x3110,
+  0x8003, 0x30F0, 0x0005, 0x28EF, 0x28EF, 0x28CF, 0x28CF, 0x28CE, 0x8003, 0x20CE, 0x8005, 0x20AE, 0x0001, 0x20AD, 0x800B, 0x18AD,
+  0x0009, 0x18AE, 0x20AD, 0x18AD, 0x18AE, 0x18AD, 0x18AD, 0x18AE, 0x18AD, 0x20AD, 0x8004, 0x18AD, 0x0001, 0x18AE, 0x8014, 0x18AD,
+  0x8012, 0x0119, 0x0005, 0x0118, 0x10B0, 0x18AD, 0x18AD, 0x18CD, 0x801F, 0x18AD, 0x0001, 0x20AD, 0x8003, 0x18AD, 0x0001, 0x18AE,
+  0x8011, 0x18AD, 0x0009, 0x18AE, 0x18AD, 0x18AD, 0x10D1, 0x08F3, 0x08F3, 0x10D2, 0x18AD, 0x20AD, 0x800C, 0x18AD, 0x0005, 0x7074,
+  0x9077, 0x8856, 0x8876, 0x388F, 0x8004, 0x18AD, 0x0002, 0x18AE, 0x18AE, 0x8012, 0x18AD, 0x000C, 0x20AE, 0x18AD, 0x18CD, 0x18AE,
+  0x18CE, 0x00F7, 0x0119, 0x011A, 0x0119, 0x0119, 0x00F7, 0x18AE, 0x8003, 0x18AD, 0x0009, 0x18CE, 0x08F7, 0x0119, 0x011A, 0x0119,
+  0x0119, 0x08F7, 0x18CE, 0x20AD, 0x8004, 0x20AE, 0x0002, 0x20CE, 0x20AE, 0x8006, 0x20CE, 0x8007, 0x28CF, 0x0001, 0x30EF, 0x8003,
+  0x30F0, 0x0009, 0x3111, 0x3111, 0x38F1, 0x3911, 0x4111, 0x4132, 0x6193, 0xC355, 0xD396, 0x8003, 0xD395, 0x8003, 0xD375, 0x8003,
+  0xD355, 0x000E, 0xD375, 0xD355, 0xD355, 0xD335, 0xD335, 0xB3D6, 0x271D, 0x07FF, 0x07FF, 0x07BF, 0x079F, 0x079F, 0x077F, 0x079F,
+  0x8007, 0x077F, 0x0001, 0x075F, 0x8007, 0x077F, 0x0006, 0x079F, 0x079F, 0x1EFE, 0x461C, 0x6D1A, 0x9BD6, 0x8003, 0xCA74, 0x001E,
+  0xCA73, 0xD274, 0xCA74, 0xCA53, 0xD254, 0xCA54, 0xD253, 0xCA53, 0xCA33, 0xA275, 0x9A76, 0xCA33, 0xCA13, 0xCA33, 0x9AD6, 0x04FF,
+  0x05BF, 0x063F, 0x357C, 0xC254, 0xC9F3, 0xD1F3, 0xC9F3, 0xC9F3, 0xB9D3, 0x6152, 0x4111, 0x3911, 0x3911, 0x38F0, 0x8003, 0x30F0,
+  0x0001, 0x28EF, 0x8003, 0x28CF, 0x8004, 0x20CE, 0x8004, 0x20AE, 0x0002, 0x20AD, 0x20AD, 0x8008, 0x18AD, 0x0002, 0x18AE, 0x18CD,
+  0x8008, 0x18AD, 0x0002, 0x20AD, 0x18AE, 0x8003, 0x18AD, 0x0001, 0x20AD, 0x8014, 0x18AD, 0x800D, 0x0119, 0x000B, 0x011A, 0x0119,
+  0x0119, 0x011A, 0x00F8, 0x10D0, 0x18AE, 0x18AD, 0x18AD, 0x18AE, 0x18CD, 0x801C, 0x18AD, 0x0001, 0x18AE, 0x801C, 0x18AD, 0x0007,
+  0x208E, 0x18AD, 0x18AD, 0x18AE, 0x18AD, 0x18AD, 0x18AE, 0x8007, 0x18AD, 0x0005, 0x18AE, 0x18AD, 0x18AD, 0x18CD, 0x20AE, 0x8005,
+  0x18AD, 0x0001, 0x18CD, 0x8018, 0x18AD, 0x0001, 0x08F5, 0x8004, 0x0119, 0x0011, 0x011A, 0x00F9, 0x08F5, 0x18AE, 0x20AD, 0x18AD,
+  0x08F4, 0x0119, 0x011A, 0x00F7, 0x0117, 0x0119, 0x011A, 0x08F5, 0x20AE, 0x20AE, 0x20AD, 0x8003, 0x20CE, 0x0001, 0x20CD, 0x8004,
+  0x20CE, 0x8007, 0x28CF, 0x0001, 0x30EF, 0x8003, 0x30F0, 0x0002, 0x38F0, 0x3910, 0x8003, 0x3911, 0x0008, 0x4112, 0x4132, 0x6193,
+  0xCB55, 0xD395, 0xD395, 0xD375, 0xD395, 0x8003, 0xD375, 0x0002, 0xD355, 0xD375, 0x8003, 0xD355, 0x000C, 0xCB55, 0xD334, 0xCB55,
+  0xAC17, 0x0FBF, 0x07FF, 0x07FF, 0x07BF, 0x07BF, 0x077F, 0x075F, 0x075F, 0x8011, 0x073F, 0x000C, 0x075F, 0x075F, 0x077F, 0x077F,
+  0x079F, 0x07BF, 0x365C, 0x74B9, 0xB315, 0xCA73, 0xCA54, 0xCA54, 0x8003, 0xCA53, 0x0018, 0xCA33, 0xD233, 0xCA33, 0xB235, 0xAA16,
+  0xCA33, 0xCA13, 0xCA13, 0x7B37, 0x055F, 0x05FF, 0x067F, 0x25DD, 0xA2F5, 0xD1D3, 0xC9F3, 0xC9D3, 0xC9D2, 0xC9D3, 0x9193, 0x4932,
+  0x4111, 0x3911, 0x38F0, 0x8003, 0x30F0, 0x0001, 0x28EF, 0x8003, 0x28CF, 0x0001, 0x20CF, 0x8003, 0x20CE, 0x8005, 0x20AE, 0x0001,
+  0x20AD, 0x8008, 0x18AD, 0x0001, 0x20AD, 0x8007, 0x18AD, 0x0001, 0x18CD, 0x8004, 0x18AD, 0x0001, 0x20AD, 0x8015, 0x18AD, 0x8011,
+  0x0119, 0x0001, 0x18B0, 0x8026, 0x18AD, 0x0003, 0x18AE, 0x18AD, 0x18CD, 0x8014, 0x18AD, 0x0001, 0x18AE, 0x8003, 0x18AD, 0x0001,
+  0x20AD, 0x800B, 0x18AD, 0x0001, 0x18AE, 0x8007, 0x18AD, 0x0002, 0x20AD, 0x18AE, 0x8017, 0x18AD, 0x000A, 0x18AE, 0x20AD, 0x0119,
+  0x00F9, 0x011A, 0x011A, 0x0119, 0x011A, 0x0119, 0x011A, 0x8003, 0x18AD, 0x000A, 0x0119, 0x0119, 0x10D3, 0x18CE, 0x20AD, 0x10F4,
+  0x011A, 0x0119, 0x20AE, 0x20AE, 0x8008, 0x20CE, 0x8006, 0x28CF, 0x0001, 0x30EF, 0x8004, 0x30F0, 0x0001, 0x38F0, 0x8003, 0x3911,
+  0x0005, 0x4111, 0x4132, 0x4132, 0x61B3, 0xCB75, 0x8003, 0xD395, 0x8005, 0xD375, 0x0002, 0xD355, 0xD375, 0x8003, 0xD355, 0x000C,
+  0xD335, 0xD335, 0x8CB8, 0x0FBF, 0x07FF, 0x07DF, 0x07BF, 0x079F, 0x077F, 0x075F, 0x073F, 0x071F, 0x8007, 0x06FF, 0x0002, 0x06DF,
+  0x06FF, 0x8003, 0x06DF, 0x8004, 0x06FF, 0x8003, 0x071F, 0x8004, 0x073F, 0x0008, 0x075F, 0x075F, 0x071F, 0x2DFD, 0x7419, 0xB2B5,
+  0xCA53, 0xCA53, 0x8004, 0xCA33, 0x0013, 0xD233, 0xCA14, 0xA215, 0xCA13, 0xCA13, 0xC9F3, 0x8338, 0x05BF, 0x063F, 0x06BF, 0x0E9F,
+  0xAAD5, 0xC9D3, 0xC9D2, 0xC9D3, 0xC9D3, 0xC9B2, 0xB1B2, 0x5931, 0x8003, 0x3911, 0x0007, 0x30F0, 0x30F0, 0x28F0, 0x28EF, 0x28EF,
+  0x28CF, 0x28CF, 0x8005, 0x20CE, 0x8003, 0x20AE, 0x0002, 0x20AD, 0x20AD, 0x8008, 0x18AD, 0x0001, 0x18AE, 0x8003, 0x18AD, 0x0006,
+  0x20AD, 0x18AD, 0x18AD, 0x18AE, 0x18AD, 0x20AD, 0x8003, 0x18AD, 0x0001, 0x20AD, 0x8014, 0x18AD, 0x807D, 0x18AD, 0x0002, 0x20AD,
+  0x18AE, 0x8003, 0x18AD, 0x8004, 0x0119, 0x0001, 0x011A, 0x8003, 0x0119, 0x000B, 0x18AD, 0x18AD, 0x18CF, 0x011A, 0x0119, 0x10D0,
+  0x18AD, 0x20AE, 0x18D0, 0x0119, 0x0119, 0x8007, 0x20CE, 0x0001, 0x20CF, 0x8005, 0x28CF, 0x0002, 0x28EF, 0x28EF, 0x8004, 0x30F0,
+  0x000A, 0x38F0, 0x3111, 0x38F1, 0x3911, 0x3911, 0x4112, 0x4112, 0x4132, 0x6193, 0xCB75, 0x8003, 0xD395, 0x8005, 0xD375, 0x8003,
+  0xD355, 0x0011, 0xD354, 0xD355, 0xD355, 0xC395, 0x5DFA, 0x07FF, 0x07DF, 0x07BF, 0x079F, 0x077F, 0x075F, 0x073F, 0x071F, 0x06FF,
+  0x06DF, 0x06BF, 0x06BF, 0x8004, 0x069F, 0x0002, 0x06BF, 0x06BF, 0x8007, 0x069F, 0x8003, 0x06BF, 0x0002, 0x06DF, 0x06DF, 0x8003,
+  0x06FF, 0x0008, 0x071F, 0x071F, 0x06FF, 0x06BF, 0x065F, 0x05BF, 0x443C, 0x8AF7, 0x8004, 0xCA33, 0x8003, 0xCA13, 0x0018, 0x99B6,
+  0xC9F3, 0xCA13, 0xC9F3, 0x4C3B, 0x061F, 0x069F, 0x06FF, 0x0EBE, 0xA2D5, 0xC9B3, 0xC9D3, 0xC9B2, 0xC9B3, 0xC9B2, 0xC1B3, 0x7152,
+  0x3911, 0x3911, 0x3110, 0x30F0, 0x30F0, 0x28F0, 0x30D0, 0x8003, 0x28CF, 0x0001, 0x20CF, 0x8003, 0x20CE, 0x0004, 0x20AE, 0x20AE,
+  0x20AD, 0x20AE, 0x8008, 0x18AD, 0x0002, 0x18CD, 0x18AE, 0x8003, 0x18AD, 0x0006, 0x18AE, 0x18AD, 0x18CE, 0x08F7, 0x0119, 0x011A,
+  0x8003, 0x0119, 0x0001, 0x011A, 0x8014, 0x0119, 0x8082, 0x18AD, 0x8004, 0x0119, 0x8003, 0x011A, 0x000E, 0x0119, 0x20AE, 0x20AD,
+  0x18CE, 0x0119, 0x0119, 0x10D3, 0x20CE, 0x20AE, 0x10F4, 0x0119, 0x011A, 0x20CE, 0x20AE, 0x8003, 0x20CE, 0x8004, 0x28CF, 0x0004,
+  0x28EF, 0x28CF, 0x28EF, 0x30EF, 0x8005, 0x30F0, 0x8003, 0x3911, 0x000A, 0x4112, 0x3912, 0x4112, 0x4132, 0x4133, 0x5153, 0xBB35,
+  0xD395, 0xD396, 0xD395, 0x8003, 0xD375, 0x0002, 0xD355, 0xD375, 0x8005, 0xD355, 0x000F, 0xBBD6, 0x5DFB, 0x0FBF, 0x07FF, 0x07DF,
+  0x07BF, 0x077F, 0x075F, 0x073F, 0x071F, 0x06FF, 0x06DF, 0x06BF, 0x069F, 0x069F, 0x8003, 0x067F, 0x800A, 0x065F, 0x0005, 0x067F,
+  0x065F, 0x065F, 0x067F, 0x067F, 0x8003, 0x069F, 0x000B, 0x06BF, 0x06BF, 0x06DF, 0x06BF, 0x069F, 0x065F, 0x05FF, 0x053F, 0x049F,
+  0x1BBE, 0x8298, 0x8005, 0xCA13, 0x000C, 0xD1F3, 0x99B6, 0xC9F3, 0xC9F3, 0xB254, 0x0D9F, 0x067F, 0x06DF, 0x06FF, 0x0EBF, 0xA2D5,
+  0xC9D2, 0x8003, 0xC9B3, 0x0003, 0xC9B2, 0xC9B3, 0x8152, 0x8003, 0x3911, 0x0007, 0x30F0, 0x30F0, 0x28F0, 0x30F0, 0x28EF, 0x28CF,
+  0x28CF, 0x8005, 0x20CE, 0x0002, 0x20AE, 0x20AE, 0x8007, 0x18AD, 0x0001, 0x18CD, 0x8006, 0x18AD, 0x0002, 0x18AE, 0x00F7, 0x8003,
+  0x0119, 0x0004, 0x00F9, 0x0119, 0x0119, 0x011A, 0x8014, 0x0119, 0x807D, 0x18AD, 0x0008, 0x18AE, 0x18AD, 0x18AD, 0x20AD, 0x18AE,
+  0x08F5, 0x0119, 0x011A, 0x8003, 0x0119, 0x0011, 0x011A, 0x08F5, 0x18AE, 0x20AE, 0x18AD, 0x08F5, 0x0119, 0x0119, 0x0918, 0x0917,
+  0x0139, 0x011A, 0x10F5, 0x20CE, 0x20CF, 0x28CF, 0x28CE, 0x8005, 0x28CF, 0x0002, 0x28EF, 0x30EF, 0x8003, 0x30F0, 0x0003, 0x3110,
+  0x30F0, 0x38F0, 0x8003, 0x3911, 0x000A, 0x4112, 0x4112, 0x4132, 0x4932, 0x4133, 0x4933, 0xBB35, 0xD395, 0xD396, 0xD395, 0x8006,
+  0xD375, 0x0015, 0xD355, 0xD355, 0xAC37, 0x6D9A, 0x2EFE, 0x07FF, 0x07FF, 0x07DF, 0x07BF, 0x079F, 0x075F, 0x073F, 0x071F, 0x06DF,
+  0x06BF, 0x069F, 0x067F, 0x065F, 0x065F, 0x063F, 0x063F, 0x8009, 0x061F, 0x0001, 0x05FF, 0x8006, 0x061F, 0x8003, 0x063F, 0x8004,
+  0x065F, 0x000A, 0x067F, 0x067F, 0x063F, 0x05DF, 0x055F, 0x04BF, 0x043F, 0x037F, 0x1ABE, 0x7A18, 0x8003, 0xCA13, 0x0016, 0xC9F3,
+  0xC1F4, 0x7178, 0xC9F2, 0xD1F3, 0x8338, 0x061F, 0x06BF, 0x06FF, 0x071F, 0x0EDF, 0xA2D5, 0xC9B3, 0xC9B3, 0xC9B2, 0xC992, 0xC992,
+  0xC993, 0x9172, 0x3911, 0x3910, 0x3110, 0x8003, 0x30F0, 0x0004, 0x28EF, 0x28EF, 0x28CF, 0x28CF, 0x8004, 0x20CE, 0x0004, 0x20AE,
+  0x20AD, 0x20AE, 0x20AE, 0x8005, 0x18AD, 0x0001, 0x18AE, 0x8005, 0x18AD, 0x000A, 0x18AE, 0x00F7, 0x0119, 0x011A, 0x0119, 0x011A,
+  0x0119, 0x011A, 0x0119, 0x0119, 0x8014, 0x011A, 0x807D, 0x18AD, 0x0003, 0x20AD, 0x18AD, 0x18AD, 0x8003, 0x18AE, 0x0014, 0x00F7,
+  0x011A, 0x0119, 0x0119, 0x011A, 0x00F7, 0x18CE, 0x20AD, 0x20AE, 0x20AE, 0x18CE, 0x0918, 0x011A, 0x011A, 0x0919, 0x011A, 0x0917,
+  0x20CF, 0x28AE, 0x20CF, 0x8003, 0x28CF, 0x8003, 0x28EF, 0x0001, 0x30EF, 0x8003, 0x30F0, 0x0002, 0x38F0, 0x38F0, 0x8004, 0x3911,
+  0x000A, 0x3912, 0x4112, 0x4132, 0x4932, 0x4933, 0x4933, 0x4953, 0xA2B4, 0xD395, 0xD395, 0x8003, 0xD375, 0x0007, 0xD355, 0xD375,
+  0xD355, 0xC3B6, 0x8519, 0x4E3C, 0x0F9F, 0x8004, 0x07FF, 0x000F, 0x07DF, 0x079F, 0x077F, 0x077F, 0x075F, 0x073F, 0x06FF, 0x06BF,
+  0x069F, 0x067F, 0x065F, 0x063F, 0x061F, 0x061F, 0x05FF, 0x8004, 0x05DF, 0x0004, 0x05BF, 0x05BF, 0x05DF, 0x05DF, 0x8006, 0x05BF,
+  0x8004, 0x05DF, 0x0002, 0x05FF, 0x05FF, 0x8006, 0x061F, 0x0027, 0x05DF, 0x057F, 0x04FF, 0x047F, 0x03DF, 0x031F, 0x025F, 0x19DE,
+  0x79B8, 0xC9F3, 0xCA13, 0xC9F3, 0xB9D3, 0xA1B5, 0xC9D3, 0xC9F3, 0x4C5B, 0x065F, 0x06DF, 0x071F, 0x071F, 0x0EDF, 0xA2B5, 0xC9B3,
+  0xC9B3, 0xC992, 0xC992, 0xC993, 0xC992, 0xB172, 0x4911, 0x3911, 0x38F0, 0x30F0, 0x30F0, 0x30EF, 0x28EF, 0x28EF, 0x28CF, 0x8003,
+  0x20CE, 0x0002, 0x20AE, 0x20CE, 0x8003, 0x20AE, 0x800A, 0x18AD, 0x0003, 0x18AE, 0x00F7, 0x011A, 0x8003, 0x0119, 0x0001, 0x011A,
+  0x8018, 0x0119, 0x8083, 0x18AD, 0x0009, 0x20AE, 0x10D2, 0x10F3, 0x10F3, 0x10D2, 0x20AE, 0x18AE, 0x20AE, 0x18CE, 0x8003, 0x20CE,
+  0x0006, 0x18F2, 0x10F4, 0x1114, 0x18F3, 0x20CF, 0x28CE, 0x8004, 0x28CF, 0x0003, 0x28EF, 0x28EF, 0x30EF, 0x8003, 0x30F0, 0x0002,
+  0x3110, 0x38F0, 0x8003, 0x3911, 0x0005, 0x3912, 0x3911, 0x4112, 0x4132, 0x4132, 0x8003, 0x4933, 0x0002, 0x4953, 0xA2B5, 0x8003,
+  0xD395, 0x8003, 0xD375, 0x0004, 0xC3B5, 0x7D59, 0x36BD, 0x07DF, 0x8006, 0x07FF, 0x0012, 0x07BF, 0x07BF, 0x079F, 0x079F, 0x077F,
+  0x077F, 0x071F, 0x06DE, 0x069E, 0x067E, 0x065E, 0x063F, 0x063F, 0x061E, 0x05FF, 0x05DF, 0x05BF, 0x05BF, 0x8003, 0x059F, 0x800C,
+  0x057F, 0x8003, 0x059F, 0x8003, 0x05BF, 0x8003, 0x05DF, 0x0018, 0x05BF, 0x057F, 0x04FF, 0x049F, 0x03FF, 0x037F, 0x02BF, 0x021F,
+  0x017F, 0x213D, 0x9996, 0xC9F3, 0xC9F3, 0xB9D4, 0x99B6, 0xC9D3, 0xC213, 0x0DBF, 0x069F, 0x06FF, 0x071F, 0x073F, 0x0EFF, 0xA2B5,
+  0x8004, 0xC992, 0x0009, 0xC972, 0xC972, 0xA972, 0x4911, 0x3911, 0x38F0, 0x30F0, 0x30F0, 0x28EF, 0x8003, 0x28CF, 0x8004, 0x20CE,
+  0x0004, 0x20AE, 0x20AE, 0x20AD, 0x20AD, 0x8008, 0x18AD, 0x0008, 0x18AE, 0x0117, 0x0119, 0x0119, 0x011A, 0x011A, 0x0119, 0x011A,
+  0x8018, 0x0119, 0x807E, 0x18AD, 0x0002, 0x20AE, 0x18AD, 0x8005, 0x20AD, 0x0008, 0x20AE, 0x18CE, 0x20AE, 0x20AD, 0x20AE, 0x20AE,
+  0x20CE, 0x20AE, 0x8004, 0x20CE, 0x0008, 0x20AF, 0x20CE, 0x28CE, 0x28CF, 0x28EF, 0x28CF, 0x28CF, 0x28EF, 0x8004, 0x30F0, 0x0002,
+  0x3110, 0x3910, 0x8004, 0x3911, 0x0011, 0x4111, 0x4131, 0x4112, 0x4132, 0x4913, 0x4933, 0x4933, 0x4953, 0x5154, 0xAAB5, 0xD375,
+  0xD395, 0xD375, 0xD395, 0xD375, 0x94D8, 0x467C, 0x8005, 0x07DF, 0x8003, 0x07FF, 0x0018, 0x07DF, 0x07DF, 0x07BF, 0x07BF, 0x079F,
+  0x079F, 0x077F, 0x077F, 0x06DE, 0x06BE, 0x067E, 0x067E, 0x065E, 0x063E, 0x061E, 0x05FE, 0x05DE, 0x05DE, 0x05BE, 0x059F, 0x057F,
+  0x057F, 0x055F, 0x055F, 0x800D, 0x053F, 0x8003, 0x055F, 0x8005, 0x057F, 0x0021, 0x055F, 0x04FF, 0x04BF, 0x041F, 0x039F, 0x031F,
+  0x025F, 0x01BF, 0x013F, 0x00BF, 0x40FB, 0xB1B5, 0xC9D2, 0xB1D5, 0xB1D4, 0xC9B3, 0x6399, 0x061F, 0x06DF, 0x071F, 0x073F, 0x073F,
+  0x0EFF, 0xA2B5, 0xC992, 0xC992, 0xC972, 0xC972, 0xC992, 0xC972, 0xB152, 0x4111, 0x3911, 0x8003, 0x30F0, 0x0001, 0x30EF, 0x8003,
+  0x28CF, 0x8004, 0x20CE, 0x0004, 0x20AE, 0x20AD, 0x20AD, 0x20AE, 0x8004, 0x18AD, 0x0006, 0x20AD, 0x18AD, 0x18AE, 0x0117, 0x011A,
+  0x011A, 0x8006, 0x0119, 0x0003, 0x011A, 0x0119, 0x011A, 0x8014, 0x0119, 0x807E, 0x18AD, 0x000D, 0x20AD, 0x18AD, 0x20AD, 0x18AD,
+  0x18AD, 0x20AE, 0x20AE, 0x18AD, 0x20AE, 0x20AE, 0x20CE, 0x20CD, 0x20AE, 0x8003, 0x20CE, 0x0003, 0x28CE, 0x20CF, 0x20CE, 0x8003,
+  0x28CF, 0x0008, 0x28EF, 0x30EF, 0x30D0, 0x28F0, 0x3110, 0x30F0, 0x30F0, 0x30F1, 0x8005, 0x3911, 0x0001, 0x4112, 0x8003, 0x4132,
+  0x0007, 0x4932, 0x4933, 0x4953, 0x4953, 0x5153, 0x4A16, 0xA2B5, 0x8003, 0xD395, 0x0005, 0xD375, 0x8539, 0x1F5E, 0x07FF, 0x07DF,
+  0x8008, 0x07FF, 0x8003, 0x07DF, 0x0017, 0x07BF, 0x07BF, 0x079F, 0x07BF, 0x075F, 0x06BE, 0x069D, 0x067D, 0x065D, 0x063D, 0x063D,
+  0x061D, 0x05FE, 0x05DE, 0x05DE, 0x05BE, 0x059E, 0x057E, 0x055F, 0x053F, 0x053F, 0x051F, 0x051F, 0x800B, 0x04FF, 0x8006, 0x051F,
+  0x0027, 0x053F, 0x053F, 0x051F, 0x04DF, 0x04BF, 0x043F, 0x03DF, 0x035F, 0x02BF, 0x021F, 0x017F, 0x00FF, 0x009F, 0x087F, 0x7119,
+  0xC9D3, 0xB1D4, 0xB9D3, 0xC9B3, 0x1CFE, 0x065F, 0x06FF, 0x071F, 0x073F, 0x073F, 0x1EBE, 0xB9F3, 0xC993, 0xC972, 0xC992, 0xC972,
+  0xC973, 0xC952, 0xB152, 0x4111, 0x3910, 0x38F0, 0x30F0, 0x30F0, 0x8004, 0x28CF, 0x8003, 0x20CE, 0x8003, 0x20AE, 0x0001, 0x20AD,
+  0x8005, 0x18AD, 0x0005, 0x18CE, 0x00F7, 0x0119, 0x011A, 0x0139, 0x8004, 0x0119, 0x0005, 0x00F7, 0x18AE, 0x18AD, 0x18AD, 0x18AE,
+  0x8014, 0x18AD, 0x807D, 0x18AD, 0x000D, 0x18AE, 0x20AD, 0x20AD, 0x18AD, 0x18AD, 0x20AE, 0x18AD, 0x20AD, 0x20CD, 0x20CE, 0x20AE,
+  0x20AE, 0x20CF, 0x8004, 0x20CE, 0x0002, 0x20CF, 0x20CF, 0x8003, 0x28CF, 0x0002, 0x28EF, 0x28CF, 0x8005, 0x30F0, 0x0001, 0x3910,
+  0x8004, 0x3911, 0x8003, 0x4132, 0x0001, 0x4932, 0x8003, 0x4933, 0x0005, 0x4953, 0x4A15, 0x3439, 0x16BD, 0x8519, 0x8003, 0xD395,
+  0x0004, 0x94D8, 0x1F5E, 0x07DF, 0x07DF, 0x8008, 0x07FF, 0x8005, 0x07DF, 0x8004, 0x07BF, 0x0014, 0x071E, 0x069D, 0x069D, 0x067D,
+  0x065D, 0x063D, 0x063D, 0x061D, 0x05FD, 0x05DD, 0x05BD, 0x059D, 0x059E, 0x057E, 0x055E, 0x053E, 0x051E, 0x04FF, 0x04FF, 0x04DF,
+  0x8003, 0x04BF, 0x8005, 0x049F, 0x8006, 0x04BF, 0x0002, 0x04DF, 0x04BF, 0x8003, 0x04DF, 0x0019, 0x04BF, 0x049F, 0x043F, 0x03DF,
+  0x035F, 0x02FF, 0x025F, 0x01BF, 0x013F, 0x00DF, 0x007F, 0x005F, 0x185E, 0x8957, 0x61B9, 0xC9D3, 0x9A96, 0x059F, 0x067F, 0x06FF,
+  0x071F, 0x073F, 0x075F, 0x267D, 0xB9D3, 0x8005, 0xC972, 0x0004, 0xC952, 0xB152, 0x4111, 0x38F1, 0x8003, 0x30F0, 0x8003, 0x28CF,
+  0x8004, 0x20CE, 0x000A, 0x20AE, 0x20AE, 0x20AD, 0x20AD, 0x18AD, 0x18AD, 0x20AD, 0x18CF, 0x00F7, 0x011A, 0x8003, 0x0119, 0x8003,
+  0x011A, 0x0004, 0x00F6, 0x18CE, 0x18AD, 0x20AE, 0x8016, 0x18AD, 0x8035, 0x18AD, 0x0004, 0x18AE, 0x18AD, 0x18AD, 0x18CD, 0x8005,
+  0x18AD, 0x0001, 0x18AE, 0x8042, 0x18AD, 0x8003, 0x20AE, 0x0001, 0x20AD, 0x8003, 0x20AE, 0x8004, 0x20CE, 0x0003, 0x20CF, 0x28CF,
+  0x20CF, 0x8004, 0x28CF, 0x8004, 0x30F0, 0x0017, 0x3110, 0x38F1, 0x38F1, 0x3911, 0x3911, 0x4111, 0x4112, 0x4132, 0x4112, 0x4932,
+  0x4932, 0x4933, 0x4933, 0x69B4, 0x6336, 0x6CD9, 0x4E5B, 0x07DF, 0x8539, 0xD395, 0xD395, 0xBC17, 0x3E9C, 0x8003, 0x07DF, 0x800B,
+  0x07FF, 0x0002, 0x07DF, 0x07FF, 0x8003, 0x07DF, 0x0018, 0x07BF, 0x07DF, 0x06BD, 0x069C, 0x069C, 0x067C, 0x065C, 0x065C, 0x063C,
+  0x061C, 0x05FC, 0x05DC, 0x05BC, 0x05BD, 0x059D, 0x057D, 0x055D, 0x053E, 0x051E, 0x04FE, 0x04DE, 0x04BE, 0x04BF, 0x049F, 0x8003,
+  0x047F, 0x8003, 0x045F, 0x800A, 0x047F, 0x001A, 0x049F, 0x047F, 0x045F, 0x041F, 0x03DF, 0x037F, 0x031F, 0x029F, 0x021F, 0x017F,
+  0x011F, 0x00BF, 0x005F, 0x001F, 0x001F, 0x00FF, 0x89B7, 0xC9B3, 0x447B, 0x065F, 0x06BF, 0x071F, 0x073F, 0x073F, 0x075F, 0x3D9B,
+  0x8004, 0xC972, 0x8003, 0xC952, 0x000A, 0xA132, 0x3911, 0x3911, 0x30F0, 0x30F0, 0x28EF, 0x28CF, 0x28CF, 0x20CE, 0x20CF, 0x8003,
+  0x20CE, 0x0007, 0x20AE, 0x20AD, 0x20AE, 0x20CD, 0x18AD, 0x18D0, 0x00F9, 0x8003, 0x0119, 0x0005, 0x00FA, 0x0119, 0x0119, 0x011A,
+  0x08F4, 0x8005, 0x18AD, 0x0001, 0x20AD, 0x8014, 0x18AD, 0x8038, 0x18AD, 0x0003, 0x20AD, 0x18CD, 0x18AE, 0x8003, 0x18AD, 0x0001,
+  0x18AE, 0x8042, 0x18AD, 0x8004, 0x20AE, 0x0002, 0x20CE, 0x20AE, 0x8005, 0x20CE, 0x0001, 0x28CE, 0x8004, 0x28CF, 0x000B, 0x28EF,
+  0x30F0, 0x30F0, 0x3110, 0x30F0, 0x38F0, 0x3911, 0x3911, 0x3931, 0x40F1, 0x4111, 0x8003, 0x4132, 0x0004, 0x61B3, 0x9274, 0xB2F5,
+  0xC355, 0x8003, 0xD395, 0x0007, 0xBC16, 0x469D, 0x8539, 0xD376, 0xD375, 0x6DBA, 0x0F9F, 0x8003, 0x07DF, 0x800E, 0x07FF, 0x8004,
+  0x07DF, 0x001B, 0x077F, 0x06BC, 0x06BB, 0x069B, 0x067B, 0x065B, 0x063B, 0x063B, 0x061B, 0x05FB, 0x05DB, 0x05BB, 0x059C, 0x059C,
+  0x057C, 0x055C, 0x053D, 0x051D, 0x04FD, 0x04DD, 0x04BE, 0x049E, 0x047F, 0x047F, 0x045F, 0x043F, 0x043F, 0x8005, 0x041F, 0x8009,
+  0x043F, 0x001B, 0x041F, 0x03FF, 0x03BF, 0x037F, 0x033F, 0x02BF, 0x023F, 0x01DF, 0x015F, 0x00DF, 0x009F, 0x005F, 0x001F, 0x005F,
+  0x097F, 0xB9B3, 0xB214, 0x0DBF, 0x06FF, 0x075F, 0x073F, 0x073F, 0x075F, 0x077F, 0x6479, 0xC972, 0xC972, 0x8004, 0xC952, 0x0009,
+  0xC932, 0x9132, 0x3911, 0x3111, 0x30F0, 0x28F0, 0x28EF, 0x28CF, 0x28CF, 0x8003, 0x20CE, 0x8003, 0x20AE, 0x0010, 0x20AD, 0x18AD,
+  0x18D0, 0x00F9, 0x0119, 0x00F9, 0x0119, 0x0119, 0x011A, 0x0119, 0x0119, 0x08F4, 0x20CD, 0x18AD, 0x18AD, 0x20AE, 0x8017, 0x18AD,
+  0x0002, 0x18AD, 0x18AE, 0x8032, 0x18AD, 0x0009, 0x20AD, 0x18AE, 0x18AD, 0x20AD, 0x18AD, 0x18AD, 0x18AE, 0x18AD, 0x18AE, 0x8045,
+  0x18AD, 0x0002, 0x20AE, 0x20AE, 0x8006, 0x20CE, 0x0001, 0x20CF, 0x8004, 0x28CF, 0x0010, 0x30EF, 0x30F0, 0x28F0, 0x30F0, 0x3110,
+  0x38F0, 0x38F1, 0x3911, 0x3911, 0x3912, 0x4111, 0x4132, 0x4132, 0x5152, 0x8234, 0xC335, 0x8004, 0xD395, 0x0008, 0xAC57, 0x7D7A,
+  0x469C, 0x0F9F, 0xA4B8, 0xD395, 0x8539, 0x1F5E, 0x8003, 0x07DF, 0x8011, 0x07FF, 0x0020, 0x07DF, 0x07FF, 0x07DF, 0x075D, 0x06BB,
+  0x06BB, 0x069A, 0x067A, 0x065A, 0x065A, 0x063A, 0x061A, 0x05FA, 0x05DA, 0x05DB, 0x05BB, 0x059B, 0x057B, 0x055B, 0x053C, 0x053C,
+  0x051C, 0x04FC, 0x04DD, 0x04BD, 0x047E, 0x047E, 0x045E, 0x043F, 0x041F, 0x03FF, 0x03FF, 0x800E, 0x03DF, 0x0018, 0x03BF, 0x035F,
+  0x031F, 0x02DF, 0x027F, 0x01FF, 0x019F, 0x011F, 0x00BF, 0x007F, 0x003F, 0x001F, 0x009F, 0x39DB, 0xC992, 0x6399, 0x069F, 0x079F,
+  0x07FF, 0x07DF, 0x07BF, 0x077F, 0x079F, 0x9AF6, 0x8006, 0xC952, 0x0009, 0xC932, 0x7112, 0x3110, 0x30F0, 0x30EF, 0x28F0, 0x28EF,
+  0x28CE, 0x28CF, 0x8003, 0x20CE, 0x0005, 0x20CD, 0x20CE, 0x20AE, 0x18CF, 0x00F9, 0x8003, 0x0119, 0x8003, 0x011A, 0x0002, 0x0119,
+  0x08F5, 0x8007, 0x18AD, 0x0001, 0x18AE, 0x8014, 0x18AD, 0x8035, 0x18AD, 0x0001, 0x18CD, 0x8005, 0x18AD, 0x0008, 0x10D2, 0x08F3,
+  0x08D3, 0x10D2, 0x20AD, 0x18AD, 0x18AE, 0x20AD, 0x803C, 0x18AD, 0x0004, 0x20AE, 0x20AE, 0x20AD, 0x20AE, 0x8006, 0x20CE, 0x0001,
+  0x20CF, 0x8004, 0x28CF, 0x0001, 0x28EF, 0x8004, 0x30F0, 0x0001, 0x38F0, 0x8003, 0x3911, 0x0006, 0x4112, 0x4132, 0x4132, 0x5193,
+  0x9274, 0xCB75, 0x8003, 0xD395, 0x000B, 0xC3D6, 0x6DBA, 0x1F7E, 0x07FF, 0x07FF, 0x36DD, 0xBC17, 0x8539, 0x1F5E, 0x07DF, 0x07DF,
+  0x8015, 0x07FF, 0x0022, 0x07DF, 0x07DF, 0x071B, 0x06DA, 0x06BA, 0x06BA, 0x0699, 0x0679, 0x0659, 0x0639, 0x0619, 0x0619, 0x05F9,
+  0x05DA, 0x05BA, 0x059A, 0x057A, 0x055A, 0x055B, 0x053B, 0x051B, 0x04FC, 0x04DC, 0x04BC, 0x049D, 0x047D, 0x045D, 0x043E, 0x041E,
+  0x03FE, 0x03DF, 0x03DF, 0x03BF, 0x03BF, 0x800B, 0x039F, 0x0013, 0x037F, 0x035F, 0x031F, 0x02DF, 0x027F, 0x023F, 0x01BF, 0x015F,
+  0x00FF, 0x009F, 0x005F, 0x001F, 0x003F, 0x011F, 0x99B6, 0xB9D3, 0x0D9F, 0x06DF, 0x07DF, 0x8004, 0x07FF, 0x0002, 0x0F7E, 0xB9B3,
+  0x8004, 0xC952, 0x000B, 0xC931, 0xC932, 0xC132, 0x6111, 0x38F0, 0x30F0, 0x28F0, 0x30EF, 0x28CF, 0x28CF, 0x20CF, 0x8003, 0x20CE,
+  0x0007, 0x20AE, 0x18CE, 0x08F5, 0x011A, 0x0119, 0x0119, 0x011A, 0x8003, 0x0119, 0x0003, 0x08F5, 0x18AD, 0x20AD, 0x8004, 0x18AD,
+  0x0001, 0x18AE, 0x8016, 0x18AD, 0x8003, 0x18AD, 0x0001, 0x18AE, 0x8035, 0x18AD, 0x0008, 0x18AE, 0x00F7, 0x0119, 0x00F9, 0x0119,
+  0x011A, 0x00F7, 0x18CE, 0x803E, 0x18AD, 0x8004, 0x20AE, 0x0002, 0x20CE, 0x20AE, 0x8004, 0x20CE, 0x8004, 0x28CF, 0x0001, 0x28EF,
+  0x8003, 0x30F0, 0x0019, 0x3110, 0x3910, 0x3911, 0x3911, 0x3912, 0x4132, 0x4132, 0x6173, 0xA2B4, 0xD395, 0xD375, 0xD395, 0xD395,
+  0xC3D6, 0x6DBA, 0x0FBF, 0x07FF, 0x07DF, 0x07FF, 0x07DF, 0x1F7E, 0x07DF, 0x07FF, 0x07FF, 0x07DF, 0x8017, 0x07FF, 0x0021, 0x07DF,
+  0x06F9, 0x06F9, 0x06D9, 0x06B8, 0x0698, 0x0698, 0x0678, 0x0658, 0x0638, 0x0638, 0x0618, 0x05F8, 0x05D8, 0x05B8, 0x0598, 0x0579,
+  0x0559, 0x0559, 0x051A, 0x04FA, 0x04DB, 0x04BB, 0x049C, 0x047C, 0x045D, 0x043D, 0x041E, 0x03FE, 0x03DE, 0x03BF, 0x039F, 0x039F,
+  0x8003, 0x037F, 0x8007, 0x035F, 0x0015, 0x033F, 0x033F, 0x031F, 0x02FF, 0x02BF, 0x027F, 0x023F, 0x01FF, 0x019F, 0x013F, 0x00BF,
+  0x007F, 0x003F, 0x001F, 0x005F, 0x197E, 0xB993, 0x6379, 0x063F, 0x073F, 0x07DF, 0x8004, 0x07FF, 0x0003, 0x3DFB, 0xC952, 0xC952,
+  0x8004, 0xC932, 0x0003, 0xC912, 0xB912, 0x4111, 0x8003, 0x30F0, 0x000B, 0x28EF, 0x28CF, 0x28CF, 0x28CE, 0x20CE, 0x20CE, 0x20AE,
+  0x20CE, 0x08F6, 0x0119, 0x011A, 0x8004, 0x0119, 0x0005, 0x08F5, 0x20AD, 0x18AD, 0x18AD, 0x20AE, 0x8004, 0x18AD, 0x0002, 0x18AE,
+  0x18CD, 0x8014, 0x18AD, 0x0004, 0x18AD, 0x18CD, 0x18AD, 0x18CD, 0x8031, 0x18AD, 0x000F, 0x18CD, 0x18AD, 0x18AE, 0x18AD, 0x08F5,
+  0x0119, 0x0119, 0x0117, 0x00F7, 0x0119, 0x0119, 0x08F4, 0x18AD, 0x18AD, 0x18AE, 0x803B, 0x18AD, 0x8003, 0x20AE, 0x8006, 0x20CE,
+  0x0009, 0x28CF, 0x28CF, 0x28EF, 0x28CF, 0x28EF, 0x30EF, 0x30F0, 0x30F0, 0x38F0, 0x8003, 0x3911, 0x0004, 0x4111, 0x4952, 0x79F3,
+  0xB2F4, 0x8005, 0xD395, 0x0002, 0x94F9, 0x0FBF, 0x8009, 0x07FF, 0x0001, 0x07DF, 0x8018, 0x07FF, 0x0025, 0x079D, 0x0719, 0x06F8,
+  0x06F8, 0x06D7, 0x06B7, 0x06B7, 0x0697, 0x0676, 0x0656, 0x0637, 0x0636, 0x0617, 0x05F7, 0x05D7, 0x05B7, 0x0597, 0x0578, 0x0578,
+  0x0538, 0x0519, 0x04F9, 0x04DA, 0x04BB, 0x049B, 0x047C, 0x043C, 0x041D, 0x041D, 0x03FE, 0x03DE, 0x03BE, 0x039E, 0x037F, 0x035F,
+  0x035F, 0x033F, 0x8004, 0x031F, 0x8004, 0x02FF, 0x0013, 0x02DF, 0x02BF, 0x029F, 0x027F, 0x023F, 0x01FF, 0x019F, 0x015F, 0x00FF,
+  0x009F, 0x005F, 0x003F, 0x001F, 0x00BF, 0x59BA, 0xB9B3, 0x0D3F, 0x06BF, 0x079F, 0x8005, 0x07FF, 0x0003, 0x7438, 0xC952, 0xC132,
+  0x8003, 0xC932, 0x0004, 0xC911, 0xC912, 0xA111, 0x3911, 0x8003, 0x30F0, 0x0003, 0x28CF, 0x28CF, 0x28CE, 0x8004, 0x20CE, 0x0008,
+  0x08F5, 0x011A, 0x0119, 0x00FA, 0x0119, 0x0119, 0x08F5, 0x18AE, 0x8005, 0x18AD, 0x0001, 0x18AE, 0x8018, 0x18AD, 0x8038, 0x18AD,
+  0x0009, 0x18AE, 0x0119, 0x011A, 0x08F3, 0x18AD, 0x18AD, 0x10D3, 0x011A, 0x00F9, 0x803D, 0x18AD, 0x8004, 0x20AE, 0x8005, 0x20CE,
+  0x0001, 0x20CF, 0x8003, 0x28CF, 0x0001, 0x28EF, 0x8004, 0x30F0, 0x0010, 0x3911, 0x3911, 0x5151, 0x79F3, 0xA2B4, 0xCB75, 0xD395,
+  0xD395, 0xD375, 0xD395, 0xD395, 0xC3D6, 0x469C, 0x07FF, 0x07DF, 0x07DF, 0x8007, 0x07FF, 0x0001, 0x07DF, 0x8018, 0x07FF, 0x002A,
+  0x07FE, 0xC335, 0x45D7, 0x0738, 0x0717, 0x06F6, 0x06F6, 0x06D6, 0x06B5, 0x06B5, 0x0695, 0x0675, 0x0655, 0x0635, 0x0615, 0x05F5,
+  0x05F5, 0x05D6, 0x05B6, 0x0597, 0x0557, 0x0538, 0x0518, 0x04F9, 0x04D9, 0x049A, 0x047B, 0x045B, 0x043C, 0x041C, 0x03DD, 0x03DD,
+  0x03BE, 0x039E, 0x037E, 0x035F, 0x033F, 0x033F, 0x031F, 0x02FF, 0x02DF, 0x02DF, 0x8004, 0x02BF, 0x0014, 0x029F, 0x029F, 0x027F,
+  0x025F, 0x021F, 0x01FF, 0x01BF, 0x017F, 0x011F, 0x00DF, 0x009F, 0x003F, 0x001F, 0x003F, 0x013F, 0xB174, 0x6339, 0x05FF, 0x071F,
+  0x07DF, 0x8004, 0x07FF, 0x0005, 0x0F9F, 0xB992, 0xC932, 0xC932, 0xC931, 0x8003, 0xC912, 0x0008, 0xC911, 0x8111, 0x30F0, 0x30F0,
+  0x28EF, 0x30EF, 0x28CF, 0x28CF, 0x8003, 0x20CE, 0x0002, 0x20AE, 0x20D0, 0x8003, 0x0119, 0x0005, 0x0139, 0x08F5, 0x18AD, 0x18AE,
+  0x18CD, 0x8005, 0x18AD, 0x0003, 0x18AE, 0x18AD, 0x20AD, 0x8015, 0x18AD, 0x0001, 0x10CF, 0x8037, 0x18AD, 0x0009, 0x18AF, 0x00F9,
+  0x0119, 0x18D0, 0x18CD, 0x18AD, 0x10D1, 0x0119, 0x0119, 0x803D, 0x18AD, 0x0004, 0x20AE, 0x18AD, 0x20AE, 0x20AE, 0x8005, 0x20CE,
+  0x0002, 0x20CF, 0x28CF, 0x8003, 0x28EF, 0x0006, 0x30F0, 0x30F0, 0x59B2, 0x7A13, 0x9A94, 0xBB55, 0x8004, 0xD395, 0x0001, 0xD375,
+  0x8003, 0xD395, 0x0002, 0xAC77, 0x2F1E, 0x8023, 0x07FF, 0x0043, 0x07BC, 0x0759, 0xABB5, 0xC314, 0x1E97, 0x0736, 0x0716, 0x0715,
+  0x06F4, 0x06F4, 0x06F3, 0x06D3, 0x06B3, 0x06B2, 0x0692, 0x0672, 0x0653, 0x0633, 0x0613, 0x05F4, 0x05D4, 0x0595, 0x0575, 0x0556,
+  0x0517, 0x04F8, 0x04B9, 0x0499, 0x045A, 0x043B, 0x041B, 0x03FC, 0x03DD, 0x03BD, 0x039D, 0x037E, 0x035E, 0x033E, 0x033F, 0x031F,
+  0x02FF, 0x02DF, 0x02BF, 0x02BF, 0x029F, 0x027F, 0x027F, 0x025F, 0x025F, 0x023F, 0x021F, 0x021F, 0x01DF, 0x019F, 0x017F, 0x013F,
+  0x00FF, 0x009F, 0x007F, 0x003F, 0x001F, 0x007F, 0x399B, 0xB993, 0x055F, 0x067F, 0x079F, 0x8005, 0x07FF, 0x000D, 0x45DB, 0xC132,
+  0xC932, 0xC912, 0xC132, 0xC912, 0xC912, 0xC911, 0xC912, 0x5111, 0x38F0, 0x30F0, 0x28EF, 0x8003, 0x28CF, 0x8003, 0x20CE, 0x000B,
+  0x20AE, 0x18CE, 0x10D3, 0x10F4, 0x18D0, 0x18AD, 0x18AE, 0x20CD, 0x18AD, 0x18AE, 0x20AD, 0x8003, 0x18AD, 0x0004, 0x18CD, 0x18AD,
+  0x18AD, 0x18CD, 0x8014, 0x18AD, 0x0003, 0x00F9, 0x10D0, 0x20AD, 0x8003, 0x18AD, 0x0002, 0x18CD, 0x18AE, 0x8031, 0x18AD, 0x0009,
+  0x0119, 0x0119, 0x08D4, 0x18AD, 0x18AD, 0x08F3, 0x0119, 0x0119, 0x20AD, 0x8016, 0x18AD, 0x0003, 0x20AE, 0x18AD, 0x20AD, 0x801F,
+  0x18AD, 0x0015, 0x20AD, 0x20AD, 0x18AD, 0x20CD, 0x20AE, 0x20AD, 0x20AE, 0x18CE, 0x20AE, 0x20CE, 0x20CE, 0x28AE, 0x20CE, 0x28EE,
+  0x5171, 0x69D2, 0x8232, 0xAAF4, 0xC334, 0xD375, 0xD3B5, 0x800A, 0xD395, 0x0002, 0x757A, 0x0FBF, 0x8022, 0x07FF, 0x0046, 0x07BD,
+  0x079B, 0x077A, 0x0779, 0x74D6, 0xD2D4, 0x9BF5, 0x0756, 0x0735, 0x0734, 0x0734, 0x0733, 0x0712, 0x0711, 0x0711, 0x06F0, 0x06F0,
+  0x06D0, 0x06AF, 0x06AF, 0x066F, 0x0650, 0x0631, 0x0611, 0x05D2, 0x0594, 0x0554, 0x0515, 0x04F7, 0x04B8, 0x0478, 0x0459, 0x043A,
+  0x03FB, 0x03BC, 0x03BC, 0x039D, 0x037D, 0x035E, 0x033E, 0x031F, 0x031F, 0x02FF, 0x02DF, 0x02BF, 0x02BF, 0x027F, 0x027F, 0x025F,
+  0x023F, 0x023F, 0x021F, 0x01FF, 0x01DF, 0x01BF, 0x019F, 0x017F, 0x013F, 0x011F, 0x00BF, 0x007F, 0x005F, 0x001F, 0x001F, 0x00DF,
+  0xA175, 0x33BC, 0x05DF, 0x06FF, 0x07DF, 0x8005, 0x07FF, 0x000F, 0x92D5, 0xC911, 0xC132, 0xC912, 0xC912, 0xC8F2, 0xC112, 0xC912,
+  0xA8F1, 0x3110, 0x30F0, 0x30EF, 0x28EF, 0x28CF, 0x28CE, 0x8004, 0x20CE, 0x0003, 0x20AE, 0x20CE, 0x20AD, 0x8022, 0x18AD, 0x0004,
+  0x0119, 0x0119, 0x10CF, 0x20AD, 0x8033, 0x18AD, 0x000C, 0x18AE, 0x20AD, 0x08F5, 0x0119, 0x0119, 0x00F7, 0x00F7, 0x011A, 0x011A,
+  0x08F5, 0x18AD, 0x18AE, 0x8011, 0x18AD, 0x0008, 0x18AE, 0x18AD, 0x20AD, 0x18AD, 0x18AD, 0x20AD, 0x18AD, 0x20AD, 0x8005, 0x18AD,
+  0x0005, 0x20AD, 0x18AE, 0x18AD, 0x18AD, 0x20AD, 0x8004, 0x18AD, 0x0001, 0x20AD, 0x800D, 0x18AD, 0x0001, 0x18CE, 0x8004, 0x18AD,
+  0x000A, 0x20AE, 0x20AE, 0x20AD, 0x390F, 0x4970, 0x59B0, 0x7A32, 0x9293, 0xAAD3, 0xCB55, 0x8004, 0xD395, 0x0001, 0xD375, 0x8008,
+  0xD395, 0x0005, 0xD375, 0xD395, 0xD395, 0x9CB8, 0x271D, 0x8021, 0x07FF, 0x0049, 0x07DE, 0x07DD, 0x07BC, 0x079B, 0x079A, 0x079A,
+  0x0779, 0x55B7, 0xD2B4, 0xD2B4, 0x4DB5, 0x0775, 0x0774, 0x0753, 0x0773, 0x0752, 0x0750, 0x0750, 0x074F, 0x074E, 0x074D, 0x074D,
+  0x074C, 0x072B, 0x072B, 0x072A, 0x070A, 0x06EA, 0x06AC, 0x064D, 0x05D0, 0x0573, 0x04F5, 0x04B6, 0x0478, 0x0438, 0x041A, 0x03FB,
+  0x03BC, 0x039C, 0x037C, 0x033D, 0x033D, 0x031E, 0x02FE, 0x02FF, 0x02DF, 0x02BF, 0x029F, 0x029F, 0x027F, 0x025F, 0x023F, 0x021F,
+  0x01FF, 0x01DF, 0x01BF, 0x019F, 0x017F, 0x015F, 0x013F, 0x011F, 0x00DF, 0x009F, 0x005F, 0x003F, 0x001F, 0x003F, 0x213D, 0x1B1E,
+  0x051F, 0x065F, 0x077F, 0x8005, 0x07FF, 0x0014, 0x1F3D, 0xC912, 0xC912, 0xC112, 0xC112, 0xC8F1, 0xC8F2, 0xC8F1, 0xC8F2, 0x80F1,
+  0x30F0, 0x30F0, 0x30EF, 0x28EF, 0x28CF, 0x28CE, 0x20CE, 0x20AE, 0x20CE, 0x20CE, 0x8003, 0x20AE, 0x8021, 0x18AD, 0x000A, 0x00F7,
+  0x00F9, 0x0119, 0x10D0, 0x18AD, 0x18AD, 0x18CD, 0x20AD, 0x18AD, 0x18AE, 0x802B, 0x18AD, 0x0006, 0x20AD, 0x18AD, 0x20AD, 0x10D0,
+  0x0119, 0x011A, 0x8004, 0x0119, 0x0002, 0x00F7, 0x18AE, 0x8013, 0x18AD, 0x0010, 0x392F, 0xD395, 0xC374, 0xA2D3, 0xAAD3, 0x7A31,
+  0x7A31, 0x7A11, 0x7231, 0x5190, 0x496F, 0x496F, 0x4970, 0x496F, 0x494F, 0x412F, 0x8004, 0x18AD, 0x0001, 0x18AE, 0x800B, 0x18AD,
+  0x000B, 0x4970, 0x494F, 0x496F, 0x496F, 0x69F1, 0x7A31, 0x7A31, 0x9272, 0xA2D3, 0xAAF3, 0xC355, 0x800E, 0xD395, 0x0001, 0xD375,
+  0x8004, 0xD395, 0x0005, 0xD396, 0xD375, 0xD395, 0xAC57, 0x565C, 0x8021, 0x07FF, 0x004C, 0x07DF, 0x07DE, 0x07BD, 0x07BC, 0x07BC,
+  0x07BB, 0x079A, 0x079A, 0x0799, 0x26B8, 0xCAD4, 0xD2B4, 0xC314, 0x0F35, 0x0794, 0x0794, 0x0792, 0x0792, 0x0791, 0x0790, 0x078F,
+  0x078E, 0x078E, 0x078D, 0x078C, 0x07AA, 0x07A9, 0x07A9, 0x07A8, 0x07C7, 0x07C5, 0x07C4, 0x07E4, 0x07A4, 0x0727, 0x068A, 0x05AF,
+  0x0496, 0x0438, 0x03F9, 0x03BA, 0x039B, 0x035C, 0x035D, 0x031D, 0x031D, 0x02FE, 0x02DF, 0x02BF, 0x02BF, 0x029F, 0x027F, 0x025F,
+  0x025F, 0x023F, 0x021F, 0x01FF, 0x01DF, 0x019F, 0x019F, 0x017F, 0x015F, 0x013F, 0x00FF, 0x00DF, 0x00BF, 0x007F, 0x005F, 0x001F,
+  0x001F, 0x007F, 0x023F, 0x041F, 0x05BF, 0x06FF, 0x07BF, 0x8005, 0x07FF, 0x0003, 0x6498, 0xC911, 0xC912, 0x8003, 0xC8F1, 0x000A,
+  0xC8F2, 0xC8F1, 0xC8D1, 0x50F1, 0x30F0, 0x30F0, 0x30EF, 0x28CF, 0x28CF, 0x28CE, 0x8003, 0x20CE, 0x0003, 0x20AE, 0x20AE, 0x20AD,
+  0x8021, 0x18AD, 0x0005, 0x18AE, 0x00F7, 0x0119, 0x00F9, 0x10CF, 0x802D, 0x18AD, 0x0002, 0x18AE, 0x18AE, 0x8003, 0x18AD, 0x000B,
+  0x10D0, 0x0119, 0x0119, 0x0117, 0x10D2, 0x08F3, 0x10D3, 0x10D2, 0x18CD, 0x18AE, 0x18AE, 0x8013, 0x18AD, 0x0002, 0x496F, 0xAAD3,
+  0x8005, 0xD395, 0x0001, 0xD375, 0x8035, 0xD395, 0x0003, 0xC3D6, 0x8539, 0x36DD, 0x8023, 0x07FF, 0x000A, 0x07DF, 0x07DE, 0x07BD,
+  0x07BD, 0x07BC, 0x07BC, 0x07BB, 0x07BA, 0x07BA, 0x07B9, 0x8003, 0xD2B4, 0x003F, 0x6535, 0x07B5, 0x07B5, 0x07B4, 0x07B3, 0x07B2,
+  0x07B1, 0x07B0, 0x07AF, 0x07CE, 0x07CD, 0x07CC, 0x07CB, 0x07CA, 0x07CA, 0x07C9, 0x07E8, 0x07E7, 0x07E6, 0x07E5, 0x07E5, 0x07E3,
+  0x07E3, 0x07E2, 0x07E1, 0x0726, 0x060C, 0x04B4, 0x03B9, 0x037B, 0x035C, 0x033D, 0x031D, 0x02DE, 0x02DF, 0x02BE, 0x029F, 0x029F,
+  0x027F, 0x025F, 0x023F, 0x023F, 0x021F, 0x01FF, 0x01DF, 0x019F, 0x019F, 0x015F, 0x015F, 0x013F, 0x00FF, 0x00DF, 0x00BF, 0x007F,
+  0x007F, 0x003F, 0x001F, 0x001F, 0x011F, 0x02FF, 0x04DF, 0x063F, 0x077F, 0x8005, 0x07FF, 0x000A, 0x0F9F, 0xB972, 0xC8F2, 0xC8F2,
+  0xC0F1, 0xC8F2, 0xC0F2, 0xC0F1, 0xC8D1, 0xA0F1, 0x8003, 0x30F0, 0x0004, 0x28EF, 0x28CF, 0x28CE, 0x20CF, 0x8003, 0x20CE, 0x0004,
+  0x20AE, 0x20AD, 0x18AD, 0x20AE, 0x801F, 0x18AD, 0x0008, 0x18AD, 0x18AE, 0x0117, 0x0119, 0x00F9, 0x18B0, 0x18AD, 0x18AE, 0x8003,
+  0x18AD, 0x0001, 0x18AE, 0x8029, 0x18AD, 0x0008, 0x18AE, 0x10D0, 0x00F9, 0x0119, 0x00F7, 0x18CE, 0x18AD, 0x18AE, 0x8004, 0x18AD,
+  0x0001, 0x18AE, 0x8014, 0x18AD, 0x0005, 0x18AE, 0x412F, 0x8A72, 0xC334, 0xD396, 0x8019, 0xD395, 0x0002, 0xD375, 0xD375, 0x8009,
+  0xD395, 0x0001, 0xD375, 0x800C, 0xD395, 0x0006, 0xD375, 0xD395, 0xD395, 0xD375, 0xAC57, 0x469C, 0x8017, 0x07FF, 0x0004, 0x467C,
+  0x8519, 0x8519, 0x36DD, 0x800B, 0x07FF, 0x8003, 0x07DE, 0x004A, 0x07DD, 0x07DC, 0x07DC, 0x07DB, 0x07DB, 0x07DA, 0x07DA, 0x9BF5,
+  0xD2B4, 0xD2B4, 0xC2F4, 0x0F77, 0x07D6, 0x07D5, 0x07D4, 0x07D4, 0x07D3, 0x07D2, 0x07D1, 0x07D0, 0x07EF, 0x07EE, 0x07ED, 0x07EC,
+  0x07EC, 0x07EA, 0x07E9, 0x07E9, 0x07E7, 0x07E6, 0x07E6, 0x07E5, 0x07E5, 0x07E4, 0x07E4, 0x07E3, 0x07E3, 0x07E2, 0x0785, 0x060C,
+  0x04D3, 0x035B, 0x031C, 0x02DE, 0x02DE, 0x02BE, 0x029F, 0x027F, 0x025F, 0x025F, 0x023F, 0x021F, 0x01FF, 0x01DF, 0x01BF, 0x019F,
+  0x019F, 0x017F, 0x015F, 0x013F, 0x011F, 0x00DF, 0x00BF, 0x009F, 0x007F, 0x005F, 0x001F, 0x001F, 0x003F, 0x01DF, 0x03BF, 0x059F,
+  0x06DF, 0x07BF, 0x8005, 0x07FF, 0x0010, 0x4D7A, 0xC111, 0xC0F1, 0xC8F1, 0xC8F2, 0xC8D1, 0xC8F2, 0xC0D1, 0xC8D1, 0x68F1, 0x30F0,
+  0x30F0, 0x28F0, 0x28EF, 0x28CF, 0x28CF, 0x8003, 0x20CE, 0x0004, 0x20AE, 0x20AE, 0x20AD, 0x20AE, 0x8015, 0x18AD, 0x0004, 0x10D2,
+  0x08F3, 0x08F3, 0x10D2, 0x8006, 0x18AD, 0x000C, 0x18CD, 0x18AD, 0x18CE, 0x00F7, 0x0119, 0x00F8, 0x18D0, 0x18AD, 0x18AD, 0x18CD,
+  0x18AD, 0x18CD, 0x8029, 0x18AD, 0x0005, 0x18D0, 0x0119, 0x0119, 0x00F7, 0x18CE, 0x8004, 0x18AD, 0x0001, 0x20AD, 0x8004, 0x18AD,
+  0x0001, 0x18AE, 0x8010, 0x18AD, 0x0003, 0x20AD, 0x18AD, 0x20AD, 0x8003, 0x18AD, 0x0005, 0x414F, 0x61D1, 0x8251, 0xA2D3, 0xBB34,
+  0x8005, 0xD395, 0x0001, 0xD375, 0x8004, 0xD395, 0x0002, 0xD375, 0xD375, 0x8003, 0xD395, 0x0001, 0xD375, 0x8004, 0xD395, 0x0001,
+  0xD375, 0x8016, 0xD395, 0x0001, 0xD375, 0x8005, 0xD395, 0x0005, 0xD375, 0xBC16, 0x8539, 0x469C, 0x17BF, 0x8013, 0x07FF, 0x0006,
+  0x8518, 0xD355, 0xD355, 0xD335, 0xD335, 0x84F8, 0x800A, 0x07FF, 0x0027, 0x07FE, 0x07DE, 0x07FE, 0x07DD, 0x07DD, 0x07BC, 0x07DC,
+  0x07DB, 0x07DB, 0x07DA, 0x8C56, 0xCAB4, 0xCAB4, 0xD294, 0x4DF7, 0x07D7, 0x07D7, 0x07D6, 0x07F5, 0x07D5, 0x07F3, 0x07F3, 0x07F2,
+  0x07F1, 0x07F0, 0x07EF, 0x07EE, 0x07ED, 0x07EC, 0x07EB, 0x07EB, 0x07EA, 0x07E9, 0x07E8, 0x07E8, 0x07E7, 0x07E7, 0x07E6, 0x07E6,
+  0x8004, 0x07E5, 0x0022, 0x07E4, 0x07A6, 0x060E, 0x03F8, 0x02DE, 0x02BE, 0x029F, 0x027F, 0x025F, 0x023F, 0x023F, 0x021F, 0x01FF,
+  0x01DF, 0x01BF, 0x019F, 0x019F, 0x017F, 0x015F, 0x013F, 0x011F, 0x00DF, 0x00BF, 0x009F, 0x007F, 0x005F, 0x003F, 0x001F, 0x001F,
+  0x00BF, 0x029F, 0x049F, 0x063F, 0x075F, 0x8006, 0x07FF, 0x0013, 0xB1D3, 0xC8F1, 0xC8F2, 0xC0F1, 0xC8D1, 0xC8D1, 0xC0F1, 0xC8D1,
+  0xB8D1, 0x40F0, 0x30F0, 0x28F0, 0x28EF, 0x28CF, 0x28CF, 0x20CE, 0x20CF, 0x20CE, 0x20CE, 0x8004, 0x20AE, 0x8012, 0x18AD, 0x0002,
+  0x18AE, 0x00F7, 0x8004, 0x0119, 0x0002, 0x00F7, 0x18AE, 0x8004, 0x18AD, 0x8003, 0x18AD, 0x0005, 0x18CE, 0x00F7, 0x0139, 0x00F8,
+  0x18B0, 0x8027, 0x18AD, 0x0001, 0x18AE, 0x8003, 0x18AD, 0x0006, 0x18AE, 0x10D0, 0x00F9, 0x0119, 0x00F7, 0x18AF, 0x8006, 0x18AD,
+  0x0001, 0x18AE, 0x8019, 0x18AD, 0x0003, 0x18AE, 0x18AD, 0x20AD, 0x8004, 0x18AD, 0x0009, 0x310E, 0x496F, 0x5990, 0x7A12, 0x7A32,
+  0x9272, 0xA2D3, 0xA2D3, 0xC375, 0x8015, 0xD395, 0x0002, 0xD375, 0xD375, 0x800B, 0xD395, 0x0001, 0xD375, 0x8009, 0xD395, 0x0003,
+  0xAC77, 0x757A, 0x36FD, 0x800F, 0x07FF, 0x0008, 0x4E3C, 0xD355, 0xD335, 0xD355, 0xD335, 0xD335, 0xD334, 0x7539, 0x800A, 0x07FF,
+  0x0002, 0x07FE, 0x07FE, 0x8003, 0x07DD, 0x001C, 0x07DC, 0x07FC, 0x07DC, 0x07DB, 0x6D38, 0xCAB4, 0xD294, 0xD294, 0xAB95, 0x07D8,
+  0x07D8, 0x07F7, 0x07F7, 0x07F6, 0x07F5, 0x07F5, 0x07F4, 0x07F3, 0x07F2, 0x07F1, 0x07F0, 0x07EF, 0x07EE, 0x07ED, 0x07ED, 0x07EC,
+  0x07EC, 0x07EB, 0x8003, 0x07EA, 0x0002, 0x07E9, 0x07E9, 0x8004, 0x07E8, 0x0023, 0x07E7, 0x07E7, 0x07E8, 0x07C8, 0x06EB, 0x0514,
+  0x033C, 0x027F, 0x025F, 0x023F, 0x021F, 0x01FF, 0x01DF, 0x01BF, 0x019F, 0x019F, 0x017F, 0x015F, 0x013F, 0x011F, 0x00FF, 0x00DF,
+  0x00BF, 0x009F, 0x009F, 0x005F, 0x005F, 0x003F, 0x001F, 0x001F, 0x015F, 0x037F, 0x057F, 0x06DF, 0x07BF, 0x8005, 0x07FF, 0x000D,
+  0x4D5A, 0xC8F1, 0xC8D1, 0xC0F1, 0xC8D1, 0xC8D1, 0xC0D1, 0xC0D1, 0xC8B1, 0x78D1, 0x3110, 0x30F0, 0x30EF, 0x8003, 0x28CF, 0x0003,
+  0x20CF, 0x20CE, 0x20CE, 0x8004, 0x20AE, 0x8012, 0x18AD, 0x0008, 0x08F5, 0x0119, 0x0119, 0x0117, 0x0117, 0x0119, 0x0119, 0x08F5,
+  0x8004, 0x18AD, 0x8004, 0x18AD, 0x0005, 0x18AE, 0x00F7, 0x0119, 0x00F9, 0x10CF, 0x8026, 0x18AD, 0x0009, 0x18AE, 0x18AD, 0x18AD,
+  0x18AE, 0x18AF, 0x0118, 0x0119, 0x00F7, 0x18CE, 0x8003, 0x18AD, 0x0001, 0x18AE, 0x8007, 0x18AD, 0x0001, 0x18AE, 0x8010, 0x18AD,
+  0x0001, 0x18AE, 0x8006, 0x18AD, 0x0001, 0x18AE, 0x800A, 0x18AD, 0x000E, 0x20AD, 0x18AD, 0x20AD, 0x18AD, 0x18AD, 0x496F, 0x496F,
+  0x4970, 0x7A12, 0x7A31, 0x8252, 0xAAD3, 0xA2D3, 0xBB34, 0x8024, 0xD395, 0x0004, 0xCBD6, 0x94F8, 0x565B, 0x0FBF, 0x800B, 0x07FF,
+  0x0004, 0xB3F6, 0xD335, 0xD335, 0xD334, 0x8003, 0xD335, 0x0002, 0xD334, 0x1F7E, 0x800A, 0x07FF, 0x0003, 0x07FE, 0x07DE, 0x07DD,
+  0x8003, 0x07FD, 0x0009, 0x07DD, 0x07DC, 0x6D38, 0xCAB4, 0xD294, 0xCA94, 0xD294, 0x1F39, 0x07F9, 0x8003, 0x07F8, 0x0017, 0x07F7,
+  0x07F7, 0x07F6, 0x07F5, 0x07F4, 0x07F3, 0x07F2, 0x07F2, 0x07F1, 0x07F0, 0x07EF, 0x07EF, 0x07EE, 0x07EE, 0x07ED, 0x07ED, 0x07EC,
+  0x07ED, 0x07EC, 0x07EB, 0x07EC, 0x07EB, 0x07EB, 0x8003, 0x07EA, 0x0020, 0x07CA, 0x07AB, 0x076C, 0x070D, 0x05B2, 0x039B, 0x023F,
+  0x021F, 0x01FF, 0x01DF, 0x01BF, 0x019F, 0x017F, 0x017F, 0x015F, 0x013F, 0x011F, 0x00FF, 0x00DF, 0x00DF, 0x009F, 0x009F, 0x007F,
+  0x005F, 0x003F, 0x003F, 0x001F, 0x60D9, 0x0A3F, 0x047F, 0x063F, 0x075F, 0x8006, 0x07FF, 0x000F, 0xA9D3, 0xC0D1, 0xC8D1, 0xC0F1,
+  0xC8B1, 0xC0D1, 0xC8B1, 0xC0B1, 0xB8B1, 0x48F1, 0x30F0, 0x30F0, 0x28EF, 0x28CF, 0x28CF, 0x8004, 0x20CE, 0x0004, 0x20AE, 0x20AD,
+  0x18AD, 0x20AE, 0x8011, 0x18AD, 0x0008, 0x0119, 0x0119, 0x08F3, 0x18AD, 0x18AD, 0x08F3, 0x0119, 0x0119, 0x8004, 0x18AD, 0x000B,
+  0x10D0, 0x18AD, 0x18AD, 0x20AD, 0x18AD, 0x18CE, 0x00F7, 0x0119, 0x00F9, 0x10D0, 0x20AD, 0x8003, 0x18AD, 0x0002, 0x18CD, 0x18AE,
+  0x801D, 0x18AD, 0x0001, 0x20AE, 0x8003, 0x18AD, 0x0006, 0x20AD, 0x18D0, 0x00F9, 0x0119, 0x00F7, 0x18AE, 0x8006, 0x18AD, 0x0005,
+  0x18CD, 0x20AD, 0x18CD, 0x20AD, 0x18CD, 0x8006, 0x18AD, 0x0004, 0x18AE, 0x20AD, 0x18AD, 0x18AE, 0x802A, 0x18AD, 0x000B, 0x4970,
+  0x4970, 0x5990, 0x7A31, 0x7231, 0x7A31, 0x7A31, 0x9AB3, 0xAAD4, 0xA2D4, 0xB314, 0x8006, 0xD395, 0x0001, 0xD396, 0x8007, 0xD395,
+  0x0001, 0xD396, 0x8009, 0xD395, 0x0005, 0xD396, 0xD395, 0xD395, 0x94F8, 0x565C, 0x8009, 0x07FF, 0x0002, 0xD335, 0xD334, 0x8004,
+  0xD335, 0x0003, 0xD314, 0xD315, 0x5DDB, 0x800B, 0x07FF, 0x8005, 0x07FE, 0x0019, 0x07FD, 0x07FD, 0x6D58, 0xD294, 0xD293, 0xCA94,
+  0xD274, 0x4DF8, 0x07FB, 0x07FA, 0x07FA, 0x07F9, 0x07F9, 0x07F8, 0x07F7, 0x07F6, 0x07F6, 0x07F5, 0x07F5, 0x07F4, 0x07F3, 0x07F3,
+  0x07F2, 0x07F1, 0x07F1, 0x8003, 0x07F0, 0x8005, 0x07EF, 0x8005, 0x07EE, 0x0021, 0x07ED, 0x07CD, 0x078E, 0x076E, 0x0710, 0x06B1,
+  0x0574, 0x037B, 0x01FF, 0x01DF, 0x01BF, 0x019F, 0x017F, 0x017F, 0x013F, 0x013F, 0x011F, 0x00FF, 0x00DF, 0x00BF, 0x009F, 0x009F,
+  0x007F, 0x005F, 0x003F, 0x003F, 0x001F, 0x88D6, 0x6159, 0x031F, 0x053F, 0x06DF, 0x07BF, 0x8005, 0x07FF, 0x000C, 0x4D5B, 0xC0D1,
+  0xC8D1, 0xC8D1, 0xC0B1, 0xC8B1, 0xC8B2, 0xC0B1, 0xC8B1, 0x90D1, 0x30F0, 0x30F0, 0x8003, 0x28CF, 0x0007, 0x20CF, 0x20CF, 0x20CE,
+  0x20AE, 0x20CE, 0x20AE, 0x20AE, 0x8010, 0x18AD, 0x0009, 0x18AE, 0x18AE, 0x0119, 0x011A, 0x10D1, 0x18AD, 0x18AD, 0x10D1, 0x011A,
+  0x8005, 0x0119, 0x0002, 0x00F8, 0x10D0, 0x8004, 0x18AD, 0x0006, 0x18CE, 0x0117, 0x0119, 0x0119, 0x10CF, 0x20AD, 0x8020, 0x18AD,
+  0x0001, 0x20AE, 0x8003, 0x18AD, 0x0019, 0x20AD, 0x18B0, 0x0119, 0x0119, 0x00F7, 0x18AE, 0x18AD, 0x18AD, 0x20AE, 0x18AD, 0x18AE,
+  0x20AD, 0x18AD, 0x18AD, 0x18AE, 0x18AD, 0x18AD, 0x18AE, 0x18CD, 0x18AD, 0x18AD, 0x10D2, 0x08F3, 0x08F3, 0x10D2, 0x802D, 0x18AD,
+  0x0019, 0x20AD, 0x18AD, 0x18AD, 0x20AD, 0x18AE, 0x18AE, 0x18AD, 0x18CE, 0x18AD, 0x20AE, 0x20AD, 0x20CE, 0x20CE, 0x290F, 0x5170,
+  0x5170, 0x69F1, 0x7A32, 0x8232, 0xAAF3, 0xAAF4, 0xCB75, 0xD395, 0xD396, 0xD375, 0x8007, 0xD395, 0x0002, 0xD396, 0xD396, 0x8004,
+  0xD395, 0x0005, 0xD375, 0xD375, 0xC3B6, 0x8539, 0x1F7F, 0x8006, 0x07FF, 0x8003, 0xD335, 0x0006, 0xD315, 0xD314, 0xD315, 0xD314,
+  0xD314, 0x659A, 0x800E, 0x07FF, 0x8004, 0x07FE, 0x0016, 0x6D39, 0xD294, 0xCA94, 0xD274, 0xCA74, 0x7C96, 0x07FC, 0x07FC, 0x07FB,
+  0x07FB, 0x07FA, 0x07FA, 0x07F9, 0x07F8, 0x07F8, 0x07F7, 0x07F7, 0x07F6, 0x07F6, 0x07F5, 0x07F4, 0x07F4, 0x8003, 0x07F3, 0x8007,
+  0x07F2, 0x8004, 0x07F1, 0x0021, 0x07F0, 0x07F1, 0x07D0, 0x0791, 0x0751, 0x0712, 0x0693, 0x0634, 0x0517, 0x02DD, 0x01BF, 0x019F,
+  0x017F, 0x015F, 0x015F, 0x013F, 0x011F, 0x00FF, 0x00DF, 0x00BF, 0x00BF, 0x007F, 0x005F, 0x005F, 0x003F, 0x003F, 0x001F, 0x60B8,
+  0xB8F3, 0x09BF, 0x041F, 0x061F, 0x073F, 0x8006, 0x07FF, 0x000C, 0xB1B3, 0xC0D1, 0xC0D1, 0xC0B1, 0xC0D1, 0xC0B1, 0xC0B1, 0xC8B1,
+  0xC0B1, 0x48F1, 0x30F0, 0x30F0, 0x8003, 0x28CF, 0x0001, 0x20CF, 0x8003, 0x20CE, 0x0004, 0x20AE, 0x20AE, 0x18AD, 0x20AE, 0x800E,
+  0x18AD, 0x0008, 0x18AE, 0x18AE, 0x0119, 0x0119, 0x08F3, 0x18AD, 0x18AD, 0x08F3, 0x8006, 0x0119, 0x0003, 0x011A, 0x0118, 0x10D0,
+  0x8004, 0x18AD, 0x000B, 0x18AE, 0x00F7, 0x00F9, 0x0119, 0x10D0, 0x18AD, 0x18AD, 0x18CD, 0x20AD, 0x18AD, 0x18AE, 0x801C, 0x18AD,
+  0x000D, 0x18AE, 0x18AD, 0x18AF, 0x0119, 0x0119, 0x00F7, 0x18AE, 0x20AE, 0x18AD, 0x18CD, 0x18AD, 0x18AD, 0x18AE, 0x8005, 0x18AD,
+  0x0005, 0x20AD, 0x18AD, 0x18CD, 0x18AE, 0x00F7, 0x8003, 0x011A, 0x0003, 0x0119, 0x0117, 0x18AE, 0x802A, 0x18AD, 0x0001, 0x20AD,
+  0x8004, 0x18AD, 0x0006, 0x20AD, 0x18AD, 0x18AD, 0x18AE, 0x20AE, 0x20AD, 0x8003, 0x20AE, 0x8003, 0x20CE, 0x0004, 0x28CE, 0x28CF,
+  0x28EF, 0x28EF, 0x8003, 0x30F0, 0x0005, 0x5172, 0x61B2, 0x8A54, 0x9A94, 0xB335, 0x8008, 0xD395, 0x8006, 0xD375, 0x0003, 0xD355,
+  0x9C97, 0x36DD, 0x8004, 0x07FF, 0x0009, 0xAC17, 0xD335, 0xD314, 0xD335, 0xD314, 0xD315, 0xD315, 0xD2F4, 0x467C, 0x8012, 0x07FF,
+  0x0007, 0x6D59, 0xD274, 0xCA94, 0xD274, 0xCA74, 0xB334, 0x07FE, 0x8003, 0x07FD, 0x0003, 0x07FC, 0x07FC, 0x07FB, 0x8003, 0x07FA,
+  0x0001, 0x07F9, 0x8003, 0x07F8, 0x0001, 0x07F7, 0x8003, 0x07F6, 0x800B, 0x07F5, 0x8003, 0x07F4, 0x0020, 0x07D3, 0x07B3, 0x0793,
+  0x0753, 0x0714, 0x06B5, 0x5516, 0x0538, 0x037C, 0x01FF, 0x017F, 0x015F, 0x013F, 0x011F, 0x011F, 0x00FF, 0x00DF, 0x00BF, 0x009F,
+  0x009F, 0x007F, 0x005F, 0x005F, 0x003F, 0x001F, 0x6099, 0xC911, 0x491A, 0x02DF, 0x051F, 0x06BF, 0x07BF, 0x8005, 0x07FF, 0x0004,
+  0x6459, 0xC8B1, 0xC0B1, 0xC8B1, 0x8005, 0xC0B1, 0x0007, 0x90D1, 0x30F1, 0x30F0, 0x30EF, 0x28EF, 0x28CF, 0x28CF, 0x8003, 0x20CE,
+  0x8004, 0x20AE, 0x8010, 0x18AD, 0x0008, 0x08F5, 0x011A, 0x0119, 0x00F7, 0x00F7, 0x0119, 0x011A, 0x08F5, 0x8004, 0x18AD, 0x000D,
+  0x00F7, 0x011A, 0x00F8, 0x10D0, 0x18AD, 0x18AD, 0x18CD, 0x18AD, 0x18AE, 0x00F7, 0x0119, 0x00F9, 0x10CF, 0x801D, 0x18AD, 0x0002,
+  0x18AE, 0x18AE, 0x8003, 0x18AD, 0x0005, 0x18B0, 0x0119, 0x0119, 0x00F7, 0x18CE, 0x8008, 0x18AD, 0x000F, 0x18AE, 0x18AD, 0x20AD,
+  0x18AD, 0x18AD, 0x20AD, 0x18AD, 0x08F5, 0x0119, 0x011A, 0x0119, 0x0119, 0x011A, 0x011A, 0x08F5, 0x802B, 0x18AD, 0x0008, 0x20AE,
+  0x18AD, 0x18AD, 0x18AE, 0x20AD, 0x18AD, 0x20AD, 0x20AD, 0x8004, 0x20AE, 0x8004, 0x20CE, 0x8003, 0x28CF, 0x0001, 0x28EF, 0x8003,
+  0x30F0, 0x000D, 0x3111, 0x3911, 0x3911, 0x4132, 0x4132, 0x5152, 0x69D3, 0x9274, 0xB2F5, 0xD395, 0xD395, 0xD375, 0xD395, 0x8006,
+  0xD375, 0x8003, 0xD355, 0x000C, 0xA478, 0x36DD, 0x07FF, 0x07FF, 0x563C, 0xD335, 0xD334, 0xD315, 0xD315, 0xD2F4, 0xCB15, 0xBB96,
+  0x8013, 0x07FF, 0x0006, 0x8498, 0xCA94, 0xCA94, 0xD274, 0xCA74, 0xCA74, 0x8004, 0x07FE, 0x0002, 0x07FD, 0x07FD, 0x8003, 0x07FC,
+  0x0006, 0x07FB, 0x07FB, 0x07FA, 0x07FA, 0x07F9, 0x07F9, 0x8004, 0x07F8, 0x800C, 0x07F7, 0x0017, 0x07F6, 0x07F6, 0x07D6, 0x07B6,
+  0x0796, 0x0756, 0x0716, 0xA456, 0xBBD6, 0x3479, 0x02FD, 0x023F, 0x019F, 0x015F, 0x011F, 0x00FF, 0x00FF, 0x00BF, 0x00BF, 0x009F,
+  0x009F, 0x007F, 0x005F, 0x8003, 0x003F, 0x0007, 0x78B7, 0xC111, 0xA114, 0x01FF, 0x041F, 0x05FF, 0x075F, 0x8005, 0x07FF, 0x0006,
+  0x0F9F, 0xC0B1, 0xC0D2, 0xC8B1, 0xC0B1, 0xC8B1, 0x8004, 0xC0B1, 0x0007, 0x48F1, 0x30F0, 0x30EF, 0x28F0, 0x28CF, 0x28CF, 0x20CF,
+  0x8003, 0x20CE, 0x8003, 0x20AE, 0x8010, 0x18AD, 0x0002, 0x18AE, 0x00F7, 0x8004, 0x0119, 0x0002, 0x00F7, 0x18AE, 0x8004, 0x18AD,
+  0x0010, 0x18CE, 0x08F7, 0x0119, 0x00F8, 0x10CF, 0x18AE, 0x18AD, 0x20AD, 0x18AD, 0x18AE, 0x0117, 0x0119, 0x00F9, 0x18B0, 0x18AD,
+  0x18AE, 0x8003, 0x18AD, 0x0001, 0x18AE, 0x8019, 0x18AD, 0x0006, 0x20AD, 0x18AF, 0x0119, 0x0119, 0x00F7, 0x18AE, 0x8006, 0x18AD,
+  0x0001, 0x18AE, 0x8004, 0x18AD, 0x0005, 0x18CD, 0x18AD, 0x18AD, 0x20AD, 0x18AD, 0x8007, 0x0119, 0x0002, 0x011A, 0x20AD, 0x802A,
+  0x18AD, 0x000B, 0x18AE, 0x18AD, 0x18AD, 0x18AE, 0x18AD, 0x18AD, 0x20AE, 0x20CD, 0x20CD, 0x20AE, 0x20AE, 0x8004, 0x20CE, 0x0002,
+  0x20CF, 0x28CE, 0x8003, 0x28CF, 0x0010, 0x28F0, 0x30F0, 0x30F0, 0x38F0, 0x3911, 0x3911, 0x4132, 0x4132, 0x4932, 0x4933, 0x4953,
+  0x5154, 0x5154, 0x71F4, 0x9A75, 0xB2F5, 0x8003, 0xD375, 0x0012, 0xD355, 0xD375, 0xD355, 0xD375, 0xD355, 0xD355, 0xD335, 0xD335,
+  0x9C78, 0x36DD, 0x07FF, 0x9C57, 0xD335, 0xD315, 0xD334, 0xD314, 0xC355, 0x271D, 0x8013, 0x07FF, 0x0007, 0x9BF7, 0xCA94, 0xD274,
+  0xCA73, 0xCA74, 0xD253, 0x2EFD, 0x8004, 0x07FF, 0x0002, 0x07FE, 0x07FE, 0x8003, 0x07FD, 0x0002, 0x07FC, 0x07FC, 0x8003, 0x07FB,
+  0x8003, 0x07FA, 0x8006, 0x07F9, 0x8006, 0x07FA, 0x8003, 0x07F9, 0x0020, 0x07F8, 0x07D8, 0x07B8, 0x0797, 0x0758, 0x0EF8, 0xBBF6,
+  0xD395, 0x6B99, 0x025F, 0x021F, 0x01BF, 0x013F, 0x011F, 0x00FF, 0x00DF, 0x00BF, 0x009F, 0x009F, 0x007F, 0x005F, 0x005F, 0x003F,
+  0x001F, 0x98D5, 0xC8F2, 0xC911, 0x195E, 0x033F, 0x053F, 0x06BF, 0x07BF, 0x8005, 0x07FF, 0x0001, 0x7B76, 0x8007, 0xC0B1, 0x0005,
+  0xC0D1, 0x88D1, 0x30F1, 0x30F0, 0x28F0, 0x8003, 0x28CF, 0x8003, 0x20CE, 0x8003, 0x20AE, 0x8012, 0x18AD, 0x0004, 0x10D2, 0x08F3,
+  0x08F3, 0x10D2, 0x8006, 0x18AD, 0x0014, 0x18AE, 0x18AE, 0x00F7, 0x011A, 0x00F9, 0x18CF, 0x18AD, 0x18AE, 0x18CD, 0x18AD, 0x18CE,
+  0x00F7, 0x0119, 0x00F8, 0x18D0, 0x18AD, 0x18AD, 0x18CD, 0x18AD, 0x18CD, 0x8018, 0x18AD, 0x0010, 0x20AD, 0x18B0, 0x0119, 0x0119,
+  0x00F7, 0x18AE, 0x18AD, 0x18AE, 0x18AD, 0x18AD, 0x18AE, 0x0117, 0x00F9, 0x0119, 0x0119, 0x011A, 0x8003, 0x0119, 0x0005, 0x011A,
+  0x0119, 0x011A, 0x00FA, 0x011A, 0x8003, 0x0119, 0x0001, 0x011A, 0x8003, 0x0119, 0x802E, 0x18AD, 0x0029, 0x18AE, 0x18AD, 0x18AE,
+  0x20AE, 0x20AE, 0x18AD, 0x20AE, 0x20AE, 0x20CE, 0x20AE, 0x20CE, 0x20CE, 0x20CF, 0x28CE, 0x28CF, 0x28CF, 0x28EF, 0x30EF, 0x30F0,
+  0x30F0, 0x3111, 0x3910, 0x3911, 0x4111, 0x4912, 0x4133, 0x4932, 0x4933, 0x5154, 0x5154, 0x5955, 0x5955, 0x5975, 0x6996, 0x8A16,
+  0xAAD5, 0xCB55, 0xD375, 0xD355, 0xD354, 0xD355, 0x8004, 0xD335, 0x0008, 0xCB35, 0x84F9, 0x0FBF, 0x5DDB, 0xA457, 0x9C58, 0x84D8,
+  0x1F5E, 0x8014, 0x07FF, 0x0001, 0x9BD6, 0x8005, 0xCA74, 0x0001, 0x369C, 0x8007, 0x07FF, 0x8003, 0x07FE, 0x8003, 0x07FD, 0x8003,
+  0x07FC, 0x8009, 0x07FB, 0x8004, 0x07FC, 0x8004, 0x07FB, 0x0011, 0x07DA, 0x07DA, 0x07BA, 0x079A, 0x0779, 0x2E99, 0xC3D6, 0xD395,
+  0x8339, 0x0A3E, 0x01DF, 0x019F, 0x015F, 0x011F, 0x00FF, 0x00BF, 0x009F, 0x8003, 0x007F, 0x8003, 0x003F, 0x0008, 0x90D5, 0xC912,
+  0xC0F1, 0x7117, 0x027F, 0x049F, 0x065F, 0x077F, 0x8005, 0x07FF, 0x0002, 0x269D, 0xC891, 0x8007, 0xC0B1, 0x0004, 0xB8B1, 0x3110,
+  0x30F0, 0x30F0, 0x8003, 0x28CF, 0x8003, 0x20CE, 0x8003, 0x20AE, 0x8010, 0x18AD, 0x0001, 0x20AD, 0x8006, 0x18AD, 0x0001, 0x20AD,
+  0x8004, 0x18AD, 0x0008, 0x18AE, 0x18AD, 0x18AE, 0x00F7, 0x0119, 0x00F9, 0x10CF, 0x18AE, 0x8003, 0x18AD, 0x0005, 0x18CE, 0x00F7,
+  0x0139, 0x00F8, 0x18B0, 0x8017, 0x18AD, 0x0001, 0x18AE, 0x8003, 0x18AD, 0x0006, 0x18AE, 0x18D0, 0x0119, 0x0119, 0x00F7, 0x18CE,
+  0x8004, 0x18AD, 0x0004, 0x18B0, 0x0119, 0x0119, 0x011A, 0x800E, 0x0119, 0x0005, 0x011A, 0x0119, 0x011A, 0x00F9, 0x20AE, 0x8028,
+  0x18AD, 0x0004, 0x20AE, 0x18AD, 0x18AE, 0x20AD, 0x8005, 0x18AD, 0x0007, 0x20CD, 0x18CE, 0x20AE, 0x20AE, 0x20CE, 0x20CE, 0x20AE,
+  0x8003, 0x20CE, 0x0019, 0x28EF, 0x28CF, 0x28EF, 0x28D0, 0x30F0, 0x30F0, 0x38F0, 0x3911, 0x3911, 0x3931, 0x4132, 0x4132, 0x4933,
+  0x5133, 0x5153, 0x5154, 0x5154, 0x5975, 0x6175, 0x6195, 0x9255, 0x8B14, 0x4AD3, 0x7A94, 0xAB14, 0x8003, 0xD355, 0x0007, 0xD335,
+  0xD335, 0xD315, 0xD314, 0xD335, 0xC355, 0x467C, 0x8018, 0x07FF, 0x0007, 0xC2D4, 0xCA74, 0xCA74, 0xD274, 0xCA74, 0xD253, 0x369C,
+  0x8009, 0x07FF, 0x8004, 0x07FE, 0x8005, 0x07FD, 0x8003, 0x07FC, 0x8006, 0x07FD, 0x8003, 0x07FE, 0x8003, 0x07FD, 0x0020, 0x07FC,
+  0x07FC, 0x07DB, 0x07BB, 0x07BB, 0x077B, 0x2EBA, 0xC3D6, 0xD395, 0xB337, 0x09DF, 0x01BF, 0x017F, 0x013F, 0x011F, 0x00DF, 0x009F,
+  0x009F, 0x007F, 0x005F, 0x005F, 0x003F, 0x003F, 0x7896, 0xC0F1, 0xC8F1, 0xA8F3, 0x01DF, 0x03DF, 0x05BF, 0x071F, 0x07DF, 0x8005,
+  0x07FF, 0x0001, 0xA214, 0x8005, 0xC0B1, 0x000A, 0xC0D1, 0xC0B1, 0xC0B1, 0x68F1, 0x30F0, 0x30F0, 0x30EF, 0x28CF, 0x28CF, 0x28CE,
+  0x8004, 0x20CE, 0x0002, 0x20AE, 0x20AE, 0x801B, 0x18AD, 0x8003, 0x18AD, 0x0005, 0x18AE, 0x0117, 0x0119, 0x00F9, 0x10CF, 0x8004,
+  0x18AD, 0x0005, 0x18AE, 0x00F7, 0x0119, 0x00F9, 0x10CF, 0x8016, 0x18AD, 0x0014, 0x18AE, 0x18AD, 0x18AD, 0x18AE, 0x18AF, 0x00F9,
+  0x0119, 0x00F7, 0x18CE, 0x18AD, 0x18AE, 0x18AD, 0x18AD, 0x18D0, 0x0119, 0x0119, 0x00F7, 0x18AE, 0x18AD, 0x20AD, 0x8006, 0x18AD,
+  0x0006, 0x18AE, 0x18AD, 0x08F5, 0x0119, 0x0119, 0x011A, 0x8003, 0x0119, 0x0001, 0x08F5, 0x8030, 0x18AD, 0x0007, 0x20AD, 0x18AD,
+  0x20AD, 0x18AD, 0x18AD, 0x20CE, 0x20AE, 0x8004, 0x20CE, 0x0025, 0x20EF, 0x28CF, 0x28CF, 0x28EF, 0x30F0, 0x30EF, 0x30F0, 0x30F0,
+  0x3911, 0x3911, 0x4111, 0x4132, 0x4932, 0x4933, 0x5133, 0x5153, 0x5154, 0x5954, 0x6195, 0x9A75, 0xCB55, 0xCB75, 0x5BB4, 0x3B34,
+  0x42B3, 0x4A33, 0x6253, 0x9AB4, 0xD335, 0xD335, 0xD315, 0xD334, 0xD314, 0xD315, 0xD314, 0xD314, 0x5DDB, 0x8016, 0x07FF, 0x0001,
+  0x1F5E, 0x8005, 0xD274, 0x0002, 0xCA53, 0x369D, 0x800D, 0x07FF, 0x800D, 0x07FE, 0x8006, 0x07FF, 0x8003, 0x07FE, 0x001E, 0x07FD,
+  0x07DD, 0x07DD, 0x07BD, 0x079C, 0x561A, 0xD395, 0xD395, 0xAB37, 0x099F, 0x015F, 0x013F, 0x011F, 0x00FF, 0x00BF, 0x009F, 0x007F,
+  0x007F, 0x005F, 0x003F, 0x003F, 0x305C, 0xC0F1, 0xC8F1, 0xC8D1, 0x215D, 0x033F, 0x051F, 0x06DF, 0x07DF, 0x8005, 0x07FF, 0x0001,
+  0x5CD9, 0x8003, 0xC0B1, 0x0001, 0xC8B1, 0x8004, 0xC0B1, 0x0007, 0x98D1, 0x38F0, 0x30F0, 0x30F0, 0x28CF, 0x28EF, 0x28CF, 0x8003,
+  0x20CE, 0x8004, 0x20AE, 0x8006, 0x18AD, 0x0001, 0x18AE, 0x8013, 0x18AD, 0x8004, 0x18AD, 0x000E, 0x18AE, 0x00F7, 0x011A, 0x00F8,
+  0x10D0, 0x18AD, 0x18AD, 0x20AD, 0x18AE, 0x18CE, 0x00F7, 0x0119, 0x00F8, 0x10CF, 0x8012, 0x18AD, 0x0002, 0x18CD, 0x18AE, 0x8004,
+  0x18AD, 0x0011, 0x18AE, 0x00F8, 0x011A, 0x00F7, 0x18AE, 0x20AE, 0x18AD, 0x18AD, 0x18CD, 0x18B0, 0x00F9, 0x0119, 0x00F7, 0x18CE,
+  0x18AD, 0x18AD, 0x18AE, 0x8007, 0x18AD, 0x0009, 0x18AE, 0x18AE, 0x0117, 0x0119, 0x0119, 0x011A, 0x0119, 0x00F7, 0x18CE, 0x8033,
+  0x18AD, 0x0004, 0x20AE, 0x18AD, 0x20AE, 0x20AE, 0x8005, 0x20CE, 0x8003, 0x28CF, 0x0001, 0x28EF, 0x8003, 0x30F0, 0x001E, 0x3911,
+  0x3911, 0x4111, 0x4131, 0x4132, 0x4933, 0x4933, 0x5154, 0x5974, 0x9255, 0xCB55, 0xD375, 0xBB95, 0x5474, 0x3C34, 0x3BB4, 0x4333,
+  0x42B3, 0x4A13, 0x49F3, 0x5A32, 0x9AB4, 0xD334, 0xD335, 0xD314, 0xD314, 0xD315, 0xD314, 0xD2F4, 0x84D8, 0x8015, 0x07FF, 0x0008,
+  0x4DDB, 0xD274, 0xCA74, 0xCA73, 0xD274, 0xCA54, 0xCA54, 0x369C, 0x8024, 0x07FF, 0x0012, 0x07FE, 0x07FE, 0x07DD, 0x07DE, 0x079D,
+  0x6D99, 0xD395, 0xD395, 0xAB17, 0x097F, 0x011F, 0x011F, 0x00FF, 0x00BF, 0x00BF, 0x009F, 0x007F, 0x007F, 0x8003, 0x003F, 0x0008,
+  0xC8F1, 0xC8F1, 0xC8D1, 0x5119, 0x02DF, 0x04FF, 0x06BF, 0x07BF, 0x8005, 0x07FF, 0x0001, 0x1F1E, 0x8009, 0xC0B1, 0x0009, 0x4910,
+  0x30F0, 0x30F0, 0x28EF, 0x28EF, 0x28CF, 0x20CF, 0x20CE, 0x20CE, 0x8003, 0x20AE, 0x0002, 0x20AD, 0x20AE, 0x800D, 0x18AD, 0x0008,
+  0x18AE, 0x18AD, 0x10D2, 0x08F3, 0x08F3, 0x10D2, 0x18AD, 0x18AE, 0x8004, 0x18AD, 0x8005, 0x18AD, 0x000F, 0x18AE, 0x00F7, 0x0119,
+  0x00F8, 0x10D0, 0x18AD, 0x18AD, 0x20AD, 0x18AD, 0x18AE, 0x00F7, 0x0119, 0x00F7, 0x18AE, 0x20AD, 0x8010, 0x18AD, 0x0013, 0x20AE,
+  0x18AD, 0x18AD, 0x18AE, 0x18AD, 0x18CE, 0x00F7, 0x0119, 0x00F7, 0x18AE, 0x20AE, 0x18AD, 0x18AD, 0x18AE, 0x10CF, 0x00F9, 0x0119,
+  0x00F7, 0x18CE, 0x800C, 0x18AD, 0x0007, 0x18AE, 0x20AE, 0x10D2, 0x08F3, 0x08F3, 0x10D2, 0x20AD, 0x8034, 0x18AD, 0x0004, 0x20AE,
+  0x18AD, 0x20AE, 0x20AE, 0x8005, 0x20CE, 0x8003, 0x28CF, 0x0001, 0x28EF, 0x8003, 0x30F0, 0x001F, 0x3910, 0x3911, 0x4112, 0x4132,
+  0x4132, 0x4933, 0x5133, 0x8214, 0xCB55, 0xD375, 0xD375, 0xB3D5, 0x3D55, 0x3515, 0x3495, 0x3C14, 0x3B94, 0x3B13, 0x4293, 0x4212,
+  0x49F3, 0x49F3, 0x5A13, 0x9AB4, 0xD314, 0xD315, 0xCB15, 0xD2F4, 0xD2F5, 0xD2F4, 0x7539, 0x8014, 0x07FF, 0x0008, 0x8C37, 0xCA74,
+  0xD273, 0xD253, 0xCA54, 0xCA53, 0xD253, 0x1F5E, 0x8027, 0x07FF, 0x0007, 0x07FE, 0x07DF, 0x07DF, 0x94D8, 0xD396, 0xD395, 0x8299,
+  0x8003, 0x00FF, 0x0010, 0x00BF, 0x00BF, 0x009F, 0x007F, 0x005F, 0x005F, 0x003F, 0x001F, 0xC8D1, 0xC0F1, 0xC0D1, 0xA0D4, 0x027F,
+  0x04BF, 0x069F, 0x07BF, 0x8006, 0x07FF, 0x0001, 0x8315, 0x8008, 0xC0B1, 0x0004, 0x70F1, 0x30F0, 0x30F0, 0x28EF, 0x8003, 0x28CF,
+  0x8003, 0x20CE, 0x0004, 0x20AE, 0x20AE, 0x20AD, 0x20AE, 0x800D, 0x18AD, 0x0002, 0x18AE, 0x00F7, 0x8004, 0x0119, 0x0002, 0x00F7,
+  0x18AE, 0x8004, 0x18AD, 0x8006, 0x18AD, 0x0007, 0x18AE, 0x08F7, 0x011A, 0x0118, 0x10D0, 0x18AD, 0x18AD, 0x8003, 0x18AE, 0x0004,
+  0x00F7, 0x011A, 0x0119, 0x0119, 0x8010, 0x011A, 0x8004, 0x0119, 0x0013, 0x00F9, 0x011A, 0x0119, 0x0117, 0x18AE, 0x20CD, 0x18AD,
+  0x18AE, 0x18AD, 0x18D0, 0x0119, 0x0119, 0x00F7, 0x18CE, 0x18AD, 0x18AD, 0x18AE, 0x18AD, 0x18AE, 0x8043, 0x18AD, 0x0004, 0x20AE,
+  0x20AD, 0x20AE, 0x20AE, 0x8004, 0x20CE, 0x0001, 0x28CE, 0x8003, 0x28CF, 0x0001, 0x28F0, 0x8003, 0x30F0, 0x0002, 0x3911, 0x3911,
+  0x8003, 0x4132, 0x0002, 0x5973, 0xB2F4, 0x8003, 0xD375, 0x0016, 0x9435, 0x3D55, 0x2D55, 0x2D75, 0x3515, 0x3C94, 0x3414, 0x3B94,
+  0x4313, 0x4293, 0x4A13, 0x41F3, 0x49F2, 0x4A13, 0x5A33, 0xA2B4, 0xD314, 0xD2F4, 0xD2F4, 0xD2D4, 0xD2F4, 0x4E1B, 0x8012, 0x07FF,
+  0x0004, 0x179F, 0xD274, 0xCA53, 0xCA73, 0x8003, 0xCA53, 0x0001, 0xD253, 0x800A, 0x07FF, 0x8005, 0x07DF, 0x800D, 0x07FF, 0x8008,
+  0x07DF, 0x8007, 0x07FF, 0x0005, 0x0F9E, 0xBC16, 0xD395, 0xD395, 0x725A, 0x8003, 0x00BF, 0x000F, 0x009F, 0x007F, 0x007F, 0x005F,
+  0x005F, 0x003F, 0x001F, 0x90B5, 0xC8D1, 0xC8D1, 0xC0D1, 0x123E, 0x047F, 0x067F, 0x07BF, 0x8006, 0x07FF, 0x0001, 0x54D9, 0x8006,
+  0xC0B1, 0x0009, 0xC0D1, 0xC0B1, 0x90D1, 0x38F1, 0x30F0, 0x30F0, 0x28EF, 0x28CF, 0x28CF, 0x8003, 0x20CE, 0x0004, 0x20AE, 0x20AE,
+  0x20AD, 0x20AE, 0x800D, 0x18AD, 0x0002, 0x08F5, 0x011A, 0x8004, 0x0119, 0x0002, 0x011A, 0x08F5, 0x8004, 0x18AD, 0x8006, 0x18AD,
+  0x000E, 0x18AE, 0x18CE, 0x00F7, 0x011A, 0x00F8, 0x10D0, 0x18AD, 0x18CD, 0x18AD, 0x18AD, 0x18CE, 0x00F7, 0x0119, 0x011A, 0x8012,
+  0x0119, 0x0001, 0x011A, 0x8003, 0x0119, 0x0011, 0x00F7, 0x18AE, 0x20AE, 0x18AD, 0x18AE, 0x18AD, 0x18D0, 0x00F9, 0x00F9, 0x00F7,
+  0x18CE, 0x18AD, 0x18AD, 0x20AD, 0x18AE, 0x18AD, 0x18AE, 0x8009, 0x18AD, 0x0001, 0x18CD, 0x8003, 0x18AD, 0x0001, 0x18AE, 0x8035,
+  0x18AD, 0x0004, 0x20AE, 0x20AD, 0x20AE, 0x20AE, 0x8004, 0x20CE, 0x8003, 0x28CF, 0x0026, 0x28EF, 0x28F0, 0x30F0, 0x38F0, 0x30F0,
+  0x3911, 0x3911, 0x4112, 0x4132, 0x8234, 0xCB55, 0xD375, 0xD375, 0xD355, 0x9435, 0x3575, 0x3575, 0x2D75, 0x3555, 0x3555, 0x3514,
+  0x3474, 0x3BF4, 0x3B73, 0x42F4, 0x4273, 0x4A13, 0x4213, 0x49F2, 0x49F3, 0x49F3, 0x6A33, 0xBAD4, 0xD2F5, 0xD2F4, 0xD2D4, 0xC335,
+  0x177E, 0x8011, 0x07FF, 0x0004, 0x5D9A, 0xCA54, 0xD273, 0xCA54, 0x8003, 0xCA53, 0x0001, 0x9BB6, 0x8006, 0x07FF, 0x8004, 0x07DF,
+  0x8003, 0x07BF, 0x0006, 0x079F, 0x077F, 0x077F, 0x077E, 0x07BF, 0x07DF, 0x8005, 0x07FF, 0x8008, 0x07DF, 0x0001, 0x07BF, 0x8005,
+  0x07DF, 0x8006, 0x07FF, 0x0001, 0x36DD, 0x8003, 0xD395, 0x0003, 0x51BC, 0x009F, 0x009F, 0x8003, 0x007F, 0x000C, 0x005F, 0x005F,
+  0x003F, 0x001F, 0x7077, 0xC0D2, 0xC8D1, 0xC0D1, 0x49FA, 0x049F, 0x069F, 0x07DF, 0x8006, 0x07FF, 0x0001, 0x1F1E, 0x8007, 0xC0B1,
+  0x0008, 0xC0D1, 0xC0B1, 0x3910, 0x30F0, 0x30F0, 0x30EF, 0x28CF, 0x28CF, 0x8003, 0x20CE, 0x8005, 0x20AE, 0x800C, 0x18AD, 0x0001,
+  0x011A, 0x8006, 0x0119, 0x0001, 0x011A, 0x8004, 0x18AD, 0x8005, 0x18AD, 0x000E, 0x20AD, 0x18AD, 0x20AD, 0x18CE, 0x08F7, 0x0119,
+  0x00F8, 0x18B0, 0x18AD, 0x18AD, 0x20AD, 0x18AD, 0x18AD, 0x20AD, 0x8014, 0x18AD, 0x0004, 0x20AE, 0x18AD, 0x18AD, 0x18AE, 0x8004,
+  0x18AD, 0x000A, 0x18B0, 0x0119, 0x0119, 0x0117, 0x18AE, 0x18AD, 0x18AD, 0x18AE, 0x18AE, 0x18CD, 0x800B, 0x18AD, 0x0001, 0x18AE,
+  0x8003, 0x18AD, 0x0001, 0x18AE, 0x8034, 0x18AD, 0x0005, 0x20AE, 0x20AE, 0x20AD, 0x20AE, 0x20AE, 0x8004, 0x20CE, 0x8003, 0x28CF,
+  0x0001, 0x28EF, 0x8003, 0x30F0, 0x0005, 0x38F0, 0x3911, 0x3911, 0x4952, 0xAAB4, 0x8003, 0xD375, 0x0004, 0xD355, 0x9435, 0x3575,
+  0x3575, 0x8003, 0x2D75, 0x0013, 0x3555, 0x54D5, 0x6475, 0x83B5, 0x8B74, 0x9B34, 0xAB14, 0xAAD4, 0xB2D4, 0xAAD4, 0xAAB4, 0xAAB4,
+  0xB2B4, 0x6B15, 0x8A94, 0xC2D4, 0xD2F4, 0xD2D4, 0x84B8, 0x8011, 0x07FF, 0x001F, 0xB315, 0xD274, 0xCA53, 0xCA54, 0xCA53, 0xCA53,
+  0xD253, 0x653A, 0x07FF, 0x07FF, 0x07DF, 0x07DF, 0x07FF, 0x07DF, 0x07DF, 0x07BF, 0x07BF, 0x079F, 0x079F, 0x077F, 0x075F, 0x075F,
+  0x073F, 0x073F, 0x071F, 0x071E, 0x071E, 0x073E, 0x079F, 0x07DF, 0x07FF, 0x8005, 0x07DF, 0x8009, 0x07BF, 0x8003, 0x07DF, 0x8005,
+  0x07FF, 0x0015, 0x7D7A, 0xD395, 0xD395, 0xC375, 0x28FE, 0x007F, 0x007F, 0x005F, 0x005F, 0x003F, 0x005F, 0x003F, 0x003F, 0x183E,
+  0xC0D1, 0xC0D1, 0xC0D2, 0x7996, 0x04BF, 0x067F, 0x07BF, 0x8007, 0x07FF, 0x0001, 0xA214, 0x8003, 0xC0B1, 0x0001, 0xC0D1, 0x8003,
+  0xC0B1, 0x0002, 0xC0D1, 0x58F1, 0x8003, 0x30F0, 0x0003, 0x28CF, 0x28EF, 0x28CF, 0x8003, 0x20CE, 0x8004, 0x20AE, 0x800C, 0x18AD,
+  0x0006, 0x0119, 0x0119, 0x011A, 0x0119, 0x0119, 0x011A, 0x8006, 0x0119, 0x8006, 0x18AD, 0x000E, 0x18CE, 0x18AD, 0x18AE, 0x18AE,
+  0x00F7, 0x011A, 0x00F8, 0x18D0, 0x18AD, 0x18AD, 0x20CD, 0x18AD, 0x18AD, 0x18AE, 0x8010, 0x18AD, 0x0010, 0x18AE, 0x18CD, 0x20AD,
+  0x18CD, 0x20AD, 0x18AE, 0x20AD, 0x18AD, 0x18AD, 0x18AE, 0x18D0, 0x00F9, 0x0119, 0x0117, 0x18CE, 0x18AE, 0x8005, 0x18AD, 0x0002,
+  0x18CD, 0x18AE, 0x800F, 0x18AD, 0x0002, 0x18AE, 0x18CD, 0x8031, 0x18AD, 0x0003, 0x20AE, 0x20AE, 0x20AD, 0x8003, 0x20AE, 0x8003,
+  0x20CE, 0x8003, 0x28CF, 0x0001, 0x28EF, 0x8003, 0x30F0, 0x0004, 0x38F0, 0x3911, 0x5972, 0xCB55, 0x8004, 0xD375, 0x001A, 0xABD5,
+  0x4515, 0x54F5, 0x7C75, 0x8C35, 0xABD5, 0xCB55, 0xD335, 0xD335, 0xD334, 0xD335, 0xD335, 0xD315, 0xD314, 0xD314, 0xC355, 0x9C37,
+  0x659A, 0x467C, 0x0FBF, 0x07FF, 0x07FF, 0x269D, 0x9C17, 0xD2D4, 0x9C17, 0x8010, 0x07FF, 0x0005, 0x5D9A, 0xD274, 0xCA53, 0xCA54,
+  0xCA53, 0x8003, 0xCA33, 0x0002, 0x26DD, 0x07FF, 0x8004, 0x07DF, 0x0015, 0x07BF, 0x079F, 0x079F, 0x077F, 0x077F, 0x075F, 0x073F,
+  0x071E, 0x071E, 0x06FE, 0x06FE, 0x06FF, 0x06DE, 0x06DE, 0x06BE, 0x06BE, 0x06DE, 0x073E, 0x079F, 0x07BF, 0x07BF, 0x8003, 0x079F,
+  0x0004, 0x077F, 0x079F, 0x079F, 0x077F, 0x8004, 0x079F, 0x0002, 0x07BF, 0x07BF, 0x8003, 0x07DF, 0x8003, 0x07FF, 0x0005, 0x0FBF,
+  0xC3F6, 0xD395, 0xD395, 0xAAF7, 0x8007, 0x003F, 0x0009, 0x001F, 0x001F, 0xA094, 0xC0D1, 0xC8B1, 0xA8F3, 0x04BF, 0x069F, 0x07DF,
+  0x8007, 0x07FF, 0x0002, 0x73D8, 0xB8B1, 0x8003, 0xC0B1, 0x0001, 0xC0D1, 0x8003, 0xC0B1, 0x0007, 0x78F1, 0x3911, 0x30F0, 0x30F0,
+  0x30EF, 0x28CF, 0x28CF, 0x8003, 0x20CE, 0x0004, 0x20AE, 0x20AE, 0x20AD, 0x20AE, 0x800C, 0x18AD, 0x8003, 0x0119, 0x0002, 0x011A,
+  0x011A, 0x8003, 0x0119, 0x8004, 0x011A, 0x8004, 0x18AD, 0x000B, 0x20AE, 0x18CD, 0x18AD, 0x20AD, 0x18AE, 0x18AD, 0x18AE, 0x00F7,
+  0x0119, 0x0118, 0x18D0, 0x8003, 0x18AD, 0x0001, 0x188D, 0x8011, 0x18AD, 0x000F, 0x18CD, 0x18AD, 0x18AD, 0x18AE, 0x18AD, 0x18AD,
+  0x18AE, 0x18AE, 0x18CD, 0x10CF, 0x0119, 0x00F9, 0x0117, 0x18CE, 0x188D, 0x8003, 0x18AD, 0x0004, 0x18AE, 0x18AE, 0x18AD, 0x18AE,
+  0x8043, 0x18AD, 0x0003, 0x20AE, 0x20AE, 0x20AD, 0x8003, 0x20AE, 0x8003, 0x20CE, 0x8003, 0x28CF, 0x0001, 0x28EF, 0x8003, 0x30F0,
+  0x0002, 0x3111, 0x71F2, 0x8005, 0xD375, 0x0010, 0xD355, 0xD375, 0xD355, 0xD355, 0xD335, 0xD335, 0xD355, 0xD335, 0xD335, 0xCB14,
+  0xD334, 0xD334, 0xAC16, 0x753A, 0x467D, 0x1F5E, 0x8009, 0x07FF, 0x0002, 0x369C, 0x4E1B, 0x800F, 0x07FF, 0x0002, 0x26FD, 0xC2B4,
+  0x8003, 0xCA53, 0x0016, 0xD253, 0xCA33, 0xCA33, 0xA356, 0x07FF, 0x07FF, 0x07DF, 0x07BF, 0x07BF, 0x079F, 0x077F, 0x077F, 0x075F,
+  0x073F, 0x071F, 0x071F, 0x06FF, 0x06FE, 0x06FE, 0x06DE, 0x06BE, 0x06BE, 0x8003, 0x069E, 0x0006, 0x067E, 0x067E, 0x065E, 0x065E,
+  0x06BE, 0x073E, 0x8008, 0x075F, 0x8004, 0x077F, 0x0003, 0x079F, 0x07BF, 0x07BF, 0x8003, 0x07DF, 0x000B, 0x07FF, 0x07DF, 0x6DDA,
+  0xD395, 0xD376, 0xD375, 0x79FA, 0x003F, 0x003F, 0x001F, 0x003F, 0x8004, 0x001F, 0x0007, 0x8896, 0xC0B1, 0xC0B1, 0xC8B1, 0x0C9F,
+  0x069F, 0x07BF, 0x8007, 0x07FF, 0x0001, 0x3DBB, 0x8003, 0xC0B1, 0x000C, 0xC0D1, 0xC0B1, 0xB8D1, 0xC0B1, 0xC0B1, 0x98D1, 0x3911,
+  0x30F0, 0x30F0, 0x30EF, 0x28CF, 0x28CF, 0x8003, 0x20CE, 0x0005, 0x20AE, 0x20CE, 0x20AD, 0x20AE, 0x20AE, 0x800B, 0x18AD, 0x0001,
+  0x08F5, 0x8006, 0x0119, 0x0001, 0x08F5, 0x8004, 0x18AD, 0x8005, 0x18AD, 0x0001, 0x20AE, 0x8005, 0x18AD, 0x0008, 0x18AE, 0x0117,
+  0x011A, 0x0119, 0x18B0, 0x18AD, 0x18AD, 0x18AE, 0x8011, 0x18AD, 0x0004, 0x20AD, 0x18AD, 0x18AD, 0x18AE, 0x8004, 0x18AD, 0x0006,
+  0x18B0, 0x00F9, 0x0119, 0x00F7, 0x18CE, 0x18AE, 0x8016, 0x18AD, 0x0004, 0x18AE, 0x18AD, 0x18AD, 0x18AE, 0x8031, 0x18AD, 0x8006,
+  0x20AE, 0x8003, 0x20CE, 0x8003, 0x28CF, 0x0001, 0x28EF, 0x8003, 0x30F0, 0x0001, 0x9A93, 0x8004, 0xD375, 0x8005, 0xD355, 0x0009,
+  0xD335, 0xD355, 0xD355, 0xD335, 0xD335, 0xC375, 0x84F9, 0x4E3C, 0x0FBF, 0x801D, 0x07FF, 0x0015, 0x0F9F, 0xAB75, 0xCA54, 0xD253,
+  0xCA53, 0xCA33, 0xCA33, 0xD233, 0xCA33, 0x4DBB, 0x07DF, 0x07BF, 0x07BF, 0x079F, 0x077F, 0x075F, 0x075F, 0x073F, 0x071F, 0x071F,
+  0x06FF, 0x8003, 0x06DE, 0x0003, 0x06BE, 0x06BE, 0x069E, 0x8003, 0x067E, 0x0009, 0x065E, 0x063E, 0x063E, 0x061E, 0x061E, 0x05FE,
+  0x05FD, 0x067D, 0x06DE, 0x8004, 0x06FE, 0x0001, 0x071E, 0x8003, 0x073F, 0x0010, 0x073E, 0x075F, 0x077F, 0x079F, 0x079F, 0x07BF,
+  0x07DF, 0x07DF, 0x07FF, 0x07FF, 0x0FBF, 0xC3D6, 0xD375, 0xD375, 0xD355, 0x30FD, 0x8004, 0x001F, 0x0004, 0x003F, 0x001F, 0x001F,
+  0x6058, 0x8003, 0xC0B1, 0x0003, 0x33FC, 0x06BF, 0x07BF, 0x8007, 0x07FF, 0x0002, 0x0F9E, 0xC0D1, 0x8003, 0xC0B1, 0x0009, 0xC0D1,
+  0xB8B1, 0xC0B1, 0xB8D1, 0xB8D1, 0x3911, 0x38F0, 0x30F0, 0x30F0, 0x8003, 0x28CF, 0x8004, 0x20CE, 0x0003, 0x20AD, 0x20AE, 0x20AE,
+  0x800B, 0x18AD, 0x0002, 0x18AE, 0x00F7, 0x8004, 0x0119, 0x0002, 0x00F7, 0x18AE, 0x8004, 0x18AD, 0x800C, 0x18AD, 0x0008, 0x18AE,
+  0x00F7, 0x0119, 0x0118, 0x18D0, 0x18AD, 0x18AD, 0x20AD, 0x8016, 0x18AD, 0x0006, 0x18AE, 0x18B0, 0x0119, 0x0119, 0x00F7, 0x18CE,
+  0x804C, 0x18AD, 0x0001, 0x20AD, 0x8003, 0x20AE, 0x8006, 0x20CE, 0x0007, 0x28CF, 0x28CF, 0x28EF, 0x28EF, 0x30F0, 0x3910, 0xAAF4,
+  0x8005, 0xD375, 0x8005, 0xD355, 0x0005, 0xD335, 0xD335, 0xB3D6, 0x7539, 0x271D, 0x8020, 0x07FF, 0x0018, 0x2EFD, 0xB315, 0xCA53,
+  0xCA54, 0xCA33, 0xCA53, 0xCA34, 0xCA34, 0xCA33, 0xA335, 0x07BF, 0x07BF, 0x079F, 0x077F, 0x075F, 0x073F, 0x073F, 0x071F, 0x06FF,
+  0x06FF, 0x06DF, 0x06DE, 0x06BF, 0x06BE, 0x8003, 0x069E, 0x0025, 0x067E, 0x065E, 0x065E, 0x063E, 0x061E, 0x061E, 0x05FE, 0x05DE,
+  0x05BD, 0x05BE, 0x059D, 0x055E, 0x055E, 0x05BE, 0x05FE, 0x061D, 0x067E, 0x06BE, 0x06FE, 0x06FE, 0x071F, 0x071E, 0x073F, 0x073F,
+  0x075F, 0x077F, 0x079F, 0x07BF, 0x07BF, 0x07DF, 0x07FF, 0x07FF, 0x8539, 0xD375, 0xD355, 0xD355, 0xBAF6, 0x8007, 0x001F, 0x0007,
+  0x403B, 0xC8B1, 0xC0B1, 0xC0B1, 0x6318, 0x06BF, 0x07BF, 0x8008, 0x07FF, 0x0001, 0xA9B3, 0x8006, 0xC0B1, 0x000B, 0xC0D1, 0xB8D1,
+  0x4910, 0x3910, 0x30F0, 0x30F0, 0x28CF, 0x28EF, 0x28CF, 0x20CF, 0x20CE, 0x8003, 0x20AE, 0x0005, 0x18AD, 0x20AE, 0x18AD, 0x20AD,
+  0x20AE, 0x800A, 0x18AD, 0x0004, 0x10D2, 0x10D3, 0x10D3, 0x10D2, 0x8006, 0x18AD, 0x800C, 0x18AD, 0x0006, 0x18AE, 0x18AE, 0x0117,
+  0x011A, 0x0119, 0x18AF, 0x8015, 0x18AD, 0x000A, 0x20AE, 0x18AD, 0x18AE, 0x18CF, 0x00F8, 0x0119, 0x00F7, 0x18AE, 0x18AD, 0x20AD,
+  0x8043, 0x18AD, 0x0001, 0x18AE, 0x8007, 0x18AD, 0x0001, 0x20AD, 0x8003, 0x20AE, 0x8004, 0x20CE, 0x0008, 0x20CF, 0x20CF, 0x28CF,
+  0x28CF, 0x28EF, 0x30CF, 0x3910, 0xB314, 0x8005, 0xD375, 0x0008, 0xD355, 0xD355, 0xD354, 0xD355, 0xD355, 0xCB96, 0x8518, 0x36DD,
+  0x8021, 0x07FF, 0x0007, 0x0FBE, 0x653A, 0xCA54, 0xCA53, 0xD253, 0xCA53, 0xCA53, 0x8004, 0xCA33, 0x0033, 0x2E9D, 0x077F, 0x077F,
+  0x075F, 0x073F, 0x073F, 0x071F, 0x06FF, 0x06FE, 0x06DF, 0x06DE, 0x06BF, 0x06BE, 0x06BF, 0x069E, 0x067E, 0x067E, 0x065E, 0x065E,
+  0x063E, 0x061E, 0x061E, 0x05FE, 0x05DE, 0x05BE, 0x05BE, 0x059E, 0x057E, 0x053E, 0x051E, 0x04FE, 0x04BE, 0x049E, 0x041E, 0x03DD,
+  0x04DE, 0x065E, 0x06BE, 0x06DE, 0x06DE, 0x06FE, 0x071F, 0x073E, 0x077F, 0x079F, 0x079F, 0x07BF, 0x07DF, 0x07DF, 0x07FF, 0x36DD,
+  0x8003, 0xD355, 0x0002, 0xD335, 0x699A, 0x8007, 0x001F, 0x0006, 0xB8B2, 0xC091, 0xC0B1, 0x7A96, 0x06BF, 0x079F, 0x8005, 0x07DF,
+  0x8003, 0x07FF, 0x0003, 0x82F5, 0xC0B1, 0xC0D1, 0x8003, 0xC0B1, 0x8003, 0xB8D1, 0x000A, 0x60F1, 0x3911, 0x30F0, 0x30F0, 0x28EF,
+  0x28EF, 0x28CF, 0x20CF, 0x20CE, 0x20CE, 0x8003, 0x20AE, 0x0001, 0x18CE, 0x8004, 0x18AD, 0x0001, 0x18AE, 0x8004, 0x18AD, 0x0001,
+  0x20AD, 0x800D, 0x18AD, 0x800E, 0x18AD, 0x0006, 0x18AE, 0x08F7, 0x0119, 0x08F7, 0x18CE, 0x20AE, 0x8012, 0x18AD, 0x0008, 0x18AE,
+  0x18AD, 0x18AD, 0x10D0, 0x0118, 0x0119, 0x00F7, 0x18CE, 0x8004, 0x18AD, 0x0002, 0x18AE, 0x18CD, 0x8044, 0x18AD, 0x0005, 0x18AE,
+  0x18AE, 0x18AD, 0x20AD, 0x20AD, 0x8003, 0x20AE, 0x8005, 0x20CE, 0x0007, 0x28CE, 0x20CF, 0x28CF, 0x28EF, 0x3910, 0xB314, 0xD395,
+  0x8004, 0xD375, 0x8004, 0xD355, 0x0003, 0xBBD6, 0x5DFB, 0x0FBF, 0x8021, 0x07FF, 0x0013, 0x0FBF, 0x5D9A, 0xB315, 0xD254, 0xCA53,
+  0xD254, 0xCA53, 0xCA53, 0xCA33, 0xD233, 0xCA33, 0xCA33, 0x64D9, 0x077F, 0x073F, 0x073F, 0x071F, 0x06FF, 0x06FF, 0x8003, 0x06DF,
+  0x0026, 0x06BF, 0x06BE, 0x069F, 0x069F, 0x067E, 0x065E, 0x065E, 0x063E, 0x063E, 0x061E, 0x05FE, 0x05FE, 0x05DE, 0x05BE, 0x059E,
+  0x059E, 0x055E, 0x055E, 0x051E, 0x04FE, 0x04DE, 0x049E, 0x043D, 0x03DE, 0x03BE, 0x039E, 0x037E, 0x03FE, 0x05FE, 0x069E, 0x069E,
+  0x06BE, 0x06FE, 0x071E, 0x073F, 0x075F, 0x079F, 0x079F, 0x8003, 0x07DF, 0x0007, 0x07FF, 0xBBF6, 0xD355, 0xD335, 0xD335, 0xC2F5,
+  0x083F, 0x8005, 0x001F, 0x000C, 0x003F, 0x9095, 0xC8B1, 0xC8B1, 0x91F5, 0x067F, 0x06FF, 0x073F, 0x075F, 0x077F, 0x07BF, 0x07DF,
+  0x8003, 0x07FF, 0x0001, 0x54D9, 0x8004, 0xC0B1, 0x001F, 0xB8D1, 0xC0D1, 0xB8D1, 0xB8D1, 0x80F2, 0x3911, 0x30F0, 0x30F0, 0x30EF,
+  0x28CF, 0x28CF, 0x20CE, 0x20CE, 0x20AE, 0x20AD, 0x20CD, 0x20AE, 0x18AD, 0x18AE, 0x20AE, 0x18AD, 0x18AE, 0x18AE, 0x18AD, 0x18AD,
+  0x18AE, 0x18AD, 0x18AE, 0x18AD, 0x20AD, 0x18AE, 0x8004, 0x18AD, 0x0002, 0x18AE, 0x20AD, 0x8004, 0x18AD, 0x800E, 0x18AD, 0x0004,
+  0x18AE, 0x18CE, 0x08F7, 0x011A, 0x8012, 0x0119, 0x0001, 0x00F9, 0x8006, 0x0119, 0x0008, 0x00F6, 0x18CE, 0x18AD, 0x18AD, 0x20AD,
+  0x18AE, 0x18AD, 0x18AE, 0x8044, 0x18AD, 0x0006, 0x18AE, 0x18AE, 0x18AD, 0x18AD, 0x18AE, 0x20AD, 0x8004, 0x20AE, 0x8003, 0x20CE,
+  0x0007, 0x20CF, 0x28CE, 0x28CF, 0x28CF, 0x3110, 0xB314, 0xD395, 0x8004, 0xD375, 0x8003, 0xD355, 0x0002, 0x9C77, 0x563B, 0x8004,
+  0x07FF, 0x0003, 0x1F7E, 0x65DB, 0x7CF9, 0x8004, 0x9C57, 0x8004, 0x9C37, 0x0008, 0x7539, 0x6D7A, 0x6579, 0x5DBB, 0x36BD, 0x36BD,
+  0x36BC, 0x2EFD, 0x8009, 0x07FF, 0x0015, 0x0FBF, 0x36BD, 0x5D9A, 0x8C37, 0xD274, 0xD273, 0xD254, 0xCA53, 0xD254, 0xD253, 0xCA33,
+  0xD233, 0xCA34, 0xCA13, 0xCA33, 0x8418, 0x075F, 0x073F, 0x071F, 0x06FF, 0x06FF, 0x8003, 0x06DF, 0x002D, 0x06BF, 0x06BF, 0x069E,
+  0x069F, 0x067E, 0x067E, 0x065E, 0x065E, 0x063E, 0x061E, 0x061E, 0x05FE, 0x05DE, 0x05DE, 0x05BE, 0x05BE, 0x057E, 0x055E, 0x051E,
+  0x051E, 0x04FE, 0x04BE, 0x045E, 0x03FE, 0x03BE, 0x039E, 0x037E, 0x037E, 0x035E, 0x033E, 0x035E, 0x061D, 0x067E, 0x067E, 0x069E,
+  0x06BE, 0x06FE, 0x073F, 0x075F, 0x077F, 0x079F, 0x07DF, 0x07DF, 0x07FF, 0x7D59, 0x8003, 0xD335, 0x0002, 0xD314, 0x699A, 0x8005,
+  0x001F, 0x000C, 0x007F, 0x60D8, 0xC0B1, 0xC0B1, 0xB8F2, 0x05DF, 0x061F, 0x065F, 0x06DF, 0x073F, 0x077F, 0x07DF, 0x8003, 0x07FF,
+  0x0001, 0x363C, 0x8004, 0xC0B1, 0x0006, 0xB8D1, 0xC0D1, 0xB8D1, 0xB8D1, 0x90D1, 0x3911, 0x8003, 0x30F0, 0x0003, 0x28CF, 0x28CF,
+  0x28CE, 0x8003, 0x20CE, 0x0009, 0x20AE, 0x20AD, 0x18AE, 0x18AD, 0x18AE, 0x20AD, 0x18AD, 0x18AD, 0x18AE, 0x8004, 0x18AD, 0x0007,
+  0x20AD, 0x18AD, 0x18AD, 0x18AE, 0x18AD, 0x18AD, 0x18AE, 0x8006, 0x18AD, 0x800C, 0x18AD, 0x0006, 0x18AE, 0x18AE, 0x18AD, 0x18AD,
+  0x18AE, 0x00F7, 0x8012, 0x0119, 0x0007, 0x011A, 0x0119, 0x00F9, 0x0119, 0x0119, 0x011A, 0x08D5, 0x8003, 0x18AD, 0x0003, 0x20AE,
+  0x18AE, 0x18CD, 0x8046, 0x18AD, 0x0005, 0x18AE, 0x18CD, 0x18AD, 0x20AD, 0x18AD, 0x8005, 0x20AE, 0x8003, 0x20CE, 0x0005, 0x20CF,
+  0x28CE, 0x28CE, 0x30EF, 0xB314, 0x8004, 0xD375, 0x0005, 0xD355, 0xD375, 0xD355, 0x9C77, 0x3EDD, 0x8005, 0x07FF, 0x0004, 0x659A,
+  0xD315, 0xD314, 0xD315, 0x8003, 0xD314, 0x8004, 0xD2F4, 0x0005, 0xD2D4, 0xD2D4, 0xD2F4, 0xCAD4, 0xD2D4, 0x8003, 0xD2B4, 0x0001,
+  0xCAB4, 0x8003, 0xD2B4, 0x0002, 0xD294, 0xD294, 0x8004, 0xCA94, 0x0005, 0xCA74, 0xCA74, 0xCA73, 0xCA73, 0xD274, 0x8006, 0xCA53,
+  0x8003, 0xCA33, 0x003D, 0xAB15, 0x0EDF, 0x06FF, 0x06FF, 0x06DF, 0x06DF, 0x06BF, 0x06BF, 0x06DF, 0x06BF, 0x069F, 0x069F, 0x067E,
+  0x067F, 0x067E, 0x065E, 0x063F, 0x061E, 0x061E, 0x05FE, 0x05FE, 0x05DE, 0x05BE, 0x059E, 0x059E, 0x055E, 0x053E, 0x051E, 0x04FE,
+  0x04DE, 0x049E, 0x043E, 0x03BE, 0x039E, 0x039E, 0x035E, 0x035E, 0x033E, 0x033E, 0x031E, 0x02FE, 0x037E, 0x05FE, 0x065E, 0x067E,
+  0x069E, 0x06DE, 0x06FE, 0x075F, 0x077F, 0x079F, 0x07BF, 0x07DF, 0x07FF, 0x271D, 0xD335, 0xD314, 0xD315, 0xD315, 0xC2D5, 0x083F,
+  0x8004, 0x001F, 0x000C, 0x009F, 0x60D8, 0xC0B1, 0xC0B2, 0xC0B1, 0x04BF, 0x053F, 0x05BF, 0x067F, 0x06DF, 0x075F, 0x079F, 0x8004,
+  0x07FF, 0x0002, 0xC0B1, 0xC0B1, 0x8004, 0xB8D1, 0x0007, 0xC0B1, 0xB8D1, 0x98D1, 0x3911, 0x38F0, 0x30F0, 0x30F0, 0x8003, 0x28CF,
+  0x8003, 0x20CE, 0x0007, 0x20AE, 0x20AE, 0x18CE, 0x20AD, 0x18AD, 0x20AD, 0x18AE, 0x8013, 0x18AD, 0x8011, 0x18AD, 0x0002, 0x20AE,
+  0x20AD, 0x8014, 0x18AD, 0x0001, 0x20AE, 0x8008, 0x18AD, 0x0003, 0x20AD, 0x18AD, 0x18AE, 0x8044, 0x18AD, 0x0009, 0x18CD, 0x18AD,
+  0x18AD, 0x20AD, 0x18AD, 0x20AE, 0x18AD, 0x20AE, 0x20AE, 0x8004, 0x20CE, 0x0004, 0x28CE, 0x20CE, 0x30EF, 0xB314, 0x8004, 0xD375,
+  0x0004, 0xD355, 0xD375, 0xAC37, 0x36DD, 0x8003, 0x07FF, 0x000B, 0x0EBD, 0x1D7B, 0x1C99, 0x32F5, 0x3A75, 0x6193, 0x69B3, 0x79F4,
+  0x8A14, 0xB294, 0xCAF4, 0x8004, 0xD2F4, 0x8004, 0xD2D4, 0x0007, 0xD2B4, 0xD2B4, 0xCAD4, 0xD2B4, 0xCAB4, 0xD2B4, 0xD2B4, 0x8004,
+  0xD294, 0x000C, 0xCA94, 0xCA94, 0xCA74, 0xCA74, 0xD274, 0xD274, 0xCA53, 0xCA54, 0xCA54, 0xCA53, 0xD253, 0xCA53, 0x8004, 0xCA33,
+  0x0012, 0x8B97, 0x35FD, 0x5D7B, 0x6D3A, 0x6D3A, 0x5D5B, 0x35FD, 0x06BF, 0x0E7E, 0x457C, 0x6C99, 0x6479, 0x6459, 0x4CBA, 0x0E1E,
+  0x063E, 0x063E, 0x061E, 0x8003, 0x05FE, 0x0012, 0x05DE, 0x05BE, 0x059E, 0x057E, 0x055E, 0x051E, 0x051E, 0x04FE, 0x04DE, 0x047E,
+  0x03DE, 0x03BE, 0x037E, 0x037F, 0x035E, 0x033E, 0x033E, 0x031E, 0x8003, 0x02FE, 0x0014, 0x02DE, 0x03FE, 0x05BE, 0x063E, 0x065E,
+  0x069E, 0x06DE, 0x071F, 0x073E, 0x077F, 0x079F, 0x07BF, 0x07DF, 0x07FF, 0xBBB6, 0xD314, 0xD315, 0xD2F4, 0xD2F4, 0x697A, 0x8003,
+  0x001F, 0x0003, 0x003F, 0x007F, 0x48FA, 0x8003, 0xC0B1, 0x0007, 0x331C, 0x047F, 0x053F, 0x05FF, 0x069F, 0x073F, 0x079F, 0x8004,
+  0x07FF, 0x0004, 0x9A14, 0xB8D1, 0xB8D1, 0xC0B1, 0x8004, 0xB8D1, 0x0005, 0xB0D1, 0x3911, 0x38F0, 0x30F0, 0x30F0, 0x8003, 0x28CF,
+  0x000E, 0x20CE, 0x20CF, 0x20AE, 0x18CF, 0x08F6, 0x011A, 0x0119, 0x0119, 0x08F4, 0x18CE, 0x18AD, 0x18AD, 0x20AD, 0x18AE, 0x800F,
+  0x18AD, 0x800D, 0x18AD, 0x0001, 0x20AD, 0x8005, 0x18AD, 0x0001, 0x20AE, 0x8011, 0x18AD, 0x0001, 0x20AD, 0x8008, 0x18AD, 0x0002,
+  0x18AE, 0x18AE, 0x8048, 0x18AD, 0x000A, 0x20AD, 0x18AD, 0x18AE, 0x20AD, 0x20AE, 0x18AD, 0x20AE, 0x20AE, 0x20CE, 0x20AE, 0x8003,
+  0x20CE, 0x0002, 0x28CF, 0x9273, 0x8005, 0xD375, 0x000A, 0xC3B6, 0x5DFB, 0x07FF, 0x0E3B, 0x1C98, 0x2AD5, 0x3911, 0x3911, 0x3912,
+  0x4111, 0x8003, 0x4112, 0x8004, 0x4132, 0x000B, 0x4933, 0x5173, 0x79D3, 0x9A54, 0xC294, 0xD2F4, 0xD2D5, 0xCAD4, 0xD2D4, 0xD2B4,
+  0xCAD4, 0x8004, 0xD2B4, 0x8004, 0xD294, 0x0002, 0xCA94, 0xCA94, 0x8003, 0xCA74, 0x0002, 0xCA73, 0xD253, 0x8005, 0xCA53, 0x8004,
+  0xCA33, 0x003F, 0x99D4, 0x6358, 0xD395, 0xD396, 0xD395, 0xD395, 0xD375, 0xD375, 0x06BF, 0x5CFA, 0xD2B4, 0xCA94, 0xCA33, 0xCA13,
+  0xC9D3, 0xB9D3, 0x4C5A, 0x061E, 0x061E, 0x05DE, 0x05DE, 0x05BE, 0x059E, 0x059E, 0x057E, 0x053E, 0x051E, 0x051D, 0x04DE, 0x04BE,
+  0x043E, 0x03BE, 0x03BE, 0x037F, 0x0B7E, 0x337C, 0x333C, 0x335C, 0x333C, 0x333C, 0x331C, 0x331C, 0x32FC, 0x32FC, 0x32DC, 0x2B7C,
+  0x05DE, 0x061E, 0x065E, 0x069E, 0x06DE, 0x071F, 0x073F, 0x077F, 0x07BF, 0x07DF, 0x07DF, 0x84F9, 0xD314, 0xCB14, 0xCAF4, 0xD2D5,
+  0xB275, 0x8004, 0x001F, 0x000C, 0x005F, 0x08DF, 0xB8D2, 0xC0B1, 0xC0B1, 0x3A7B, 0x03FF, 0x04DF, 0x05BF, 0x067F, 0x071F, 0x079F,
+  0x8004, 0x07FF, 0x0003, 0x7B77, 0xB8D1, 0xB8B1, 0x8006, 0xB8D1, 0x0004, 0x4111, 0x38F1, 0x30F0, 0x30F0, 0x8003, 0x28CF, 0x000A,
+  0x20CF, 0x20AE, 0x20CF, 0x0918, 0x013A, 0x011A, 0x0119, 0x011A, 0x0119, 0x08F6, 0x8003, 0x18AD, 0x0004, 0x20AD, 0x18AD, 0x18AD,
+  0x18CD, 0x800C, 0x18AD, 0x800D, 0x0119, 0x0003, 0x011A, 0x0119, 0x011A, 0x8003, 0x0119, 0x0001, 0x00F9, 0x8013, 0x0119, 0x0001,
+  0x011A, 0x804D, 0x0119, 0x000D, 0x011A, 0x0119, 0x011A, 0x0119, 0x0139, 0x00F9, 0x10D2, 0x20AE, 0x18AD, 0x20AE, 0x20AE, 0x20CE,
+  0x20AE, 0x8003, 0x20CE, 0x0001, 0x7A32, 0x8005, 0xD375, 0x0006, 0x9C78, 0x261B, 0x1B96, 0x3171, 0x30F0, 0x38F1, 0x8006, 0x3911,
+  0x0002, 0x4111, 0x3912, 0x8003, 0x4112, 0x0015, 0x4132, 0x4112, 0x4132, 0x4132, 0x4912, 0x4132, 0x6172, 0x81F3, 0xAA73, 0xCAD4,
+  0xD2B4, 0xCAB4, 0xD2B4, 0xD2B4, 0xCAB4, 0xCAB4, 0xCA94, 0xCA94, 0xD294, 0xCA94, 0xCA94, 0x8003, 0xCA74, 0x0003, 0xD274, 0xCA54,
+  0xD274, 0x8003, 0xCA53, 0x0008, 0xD233, 0xCA33, 0xCA33, 0xD233, 0xC234, 0x7994, 0x5975, 0xB315, 0x8004, 0xD395, 0x001D, 0xD375,
+  0xC375, 0x067F, 0x067F, 0x6C79, 0xCA33, 0xCA13, 0xC9D3, 0xC992, 0xC952, 0xC912, 0x34BB, 0x05FE, 0x05DE, 0x05BE, 0x059E, 0x055E,
+  0x055E, 0x053E, 0x051E, 0x04FE, 0x249D, 0x347B, 0x6BFA, 0x7B99, 0x9B98, 0xAB97, 0xDB95, 0xD396, 0x8009, 0xD395, 0x0010, 0xD396,
+  0xD395, 0xD396, 0xD395, 0xBBD6, 0x9C37, 0x8499, 0x6D1A, 0x363C, 0x1EDD, 0x079F, 0x07BF, 0x07DF, 0x4E1B, 0xD2F4, 0xD2F5, 0x8003,
+  0xD2D4, 0x0001, 0x40FC, 0x8003, 0x001F, 0x000C, 0x003F, 0x009F, 0x78D7, 0xC0B1, 0xC0B1, 0x61D8, 0x03BF, 0x049F, 0x057F, 0x065F,
+  0x071F, 0x07BF, 0x8004, 0x07FF, 0x0005, 0x54D9, 0xB8D1, 0xB8B1, 0xB8D1, 0xC0B1, 0x8004, 0xB8D1, 0x000D, 0x4111, 0x3911, 0x30F0,
+  0x30F0, 0x28EF, 0x28CF, 0x28CF, 0x20CF, 0x20AE, 0x10F3, 0x013A, 0x0119, 0x0139, 0x8003, 0x0119, 0x0002, 0x011A, 0x18D0, 0x8004,
+  0x18AD, 0x0001, 0x20AE, 0x800D, 0x18AD, 0x8008, 0x0119, 0x0003, 0x011A, 0x0119, 0x011A, 0x8003, 0x0119, 0x0004, 0x011A, 0x0119,
+  0x0119, 0x011A, 0x8068, 0x0119, 0x0005, 0x011A, 0x0119, 0x18AD, 0x20AE, 0x18AD, 0x8003, 0x20AE, 0x0004, 0x20CE, 0x20CE, 0x5170,
+  0xD395, 0x8003, 0xD375, 0x0003, 0xD355, 0x6519, 0x22B3, 0x8005, 0x30F0, 0x0001, 0x38F0, 0x800B, 0x3911, 0x8004, 0x4112, 0x0020,
+  0x4132, 0x4112, 0x4132, 0x4112, 0x4952, 0x79B3, 0xA233, 0xD2B4, 0xCAB4, 0xD294, 0xCA94, 0xD294, 0xCA94, 0xCA74, 0xCA94, 0xCA74,
+  0xCA74, 0xD274, 0xCA54, 0xD274, 0xD253, 0xCA54, 0xCA54, 0xCA33, 0xD233, 0xCA34, 0xCA33, 0xCA33, 0xA1D3, 0x5954, 0x5954, 0x79F5,
+  0x8003, 0xD395, 0x0016, 0xD375, 0xD375, 0xD335, 0x8C18, 0x067F, 0x065F, 0x063F, 0xA2D5, 0xC9D3, 0xC972, 0xC952, 0xC111, 0xC8D1,
+  0x8A55, 0x05DE, 0x05BE, 0x059E, 0x057E, 0x055E, 0x34DC, 0x6C5A, 0xA3F7, 0x8015, 0xD395, 0x0004, 0xD375, 0xD375, 0xD355, 0xD355,
+  0x8003, 0xD335, 0x0005, 0xBBB6, 0x84D9, 0x4E1B, 0x465C, 0xD2F5, 0x8003, 0xD2D4, 0x0002, 0xD2B4, 0x81D8, 0x8004, 0x001F, 0x000B,
+  0x005F, 0x6098, 0xC0B1, 0xC0D1, 0x59B8, 0x035F, 0x045F, 0x055F, 0x063F, 0x06FF, 0x079F, 0x8004, 0x07FF, 0x0004, 0x363C, 0xC0D1,
+  0xB8D1, 0xB8B1, 0x8005, 0xB8D1, 0x000F, 0x58F1, 0x3911, 0x30F0, 0x3110, 0x30CF, 0x28EF, 0x28CF, 0x28CF, 0x20CE, 0x08F6, 0x013A,
+  0x0119, 0x0119, 0x011A, 0x011A, 0x8004, 0x0119, 0x0003, 0x011A, 0x0119, 0x011A, 0x800E, 0x0119, 0x8005, 0x0119, 0x0001, 0x011A,
+  0x8004, 0x0119, 0x000A, 0x011A, 0x011A, 0x0119, 0x0119, 0x011A, 0x0119, 0x0119, 0x011A, 0x0119, 0x011A, 0x8060, 0x0119, 0x8004,
+  0x011A, 0x000D, 0x0119, 0x0119, 0x011A, 0x00F8, 0x18AD, 0x20AD, 0x18AD, 0x18AD, 0x20AE, 0x20CE, 0x20AE, 0x28EE, 0xCB55, 0x8003,
+  0xD375, 0x0004, 0xBB14, 0x34F9, 0x2930, 0x30EF, 0x8008, 0x30F0, 0x8010, 0x3911, 0x001D, 0x4112, 0x4111, 0x3931, 0x4112, 0x4111,
+  0x6993, 0x91F2, 0xC254, 0xCA93, 0xCA94, 0xCA94, 0xCA74, 0xCA74, 0xD274, 0xCA73, 0xD273, 0xCA73, 0xD254, 0xCA53, 0xCA53, 0xCA54,
+  0xCA33, 0xCA34, 0xA1F3, 0x6973, 0x4953, 0x5134, 0x5154, 0xAAF5, 0x8003, 0xD395, 0x0014, 0xD375, 0xD335, 0xD314, 0x5CDA, 0x065F,
+  0x063F, 0x063F, 0xB254, 0xC972, 0xC952, 0xC112, 0xC8D1, 0xC0B1, 0xC0B1, 0x05BE, 0x059E, 0x2D1C, 0x9438, 0xCBB6, 0xD396, 0x8016,
+  0xD395, 0x0002, 0xD396, 0xD375, 0x8003, 0xD355, 0x0007, 0xD335, 0xD335, 0xD314, 0xD314, 0xD315, 0xD2F4, 0xD2F5, 0x8003, 0xD2D4,
+  0x0005, 0xD2B4, 0xD2B4, 0xCA94, 0x087F, 0x003F, 0x8003, 0x001F, 0x000A, 0x385B, 0xC0B1, 0xC0B1, 0x9135, 0x031F, 0x043F, 0x053F,
+  0x063F, 0x071F, 0x079F, 0x8005, 0x07FF, 0x8003, 0xB8D1, 0x0012, 0xB8B1, 0xB8D1, 0xC0D1, 0xB8B1, 0xB8D1, 0x5911, 0x3911, 0x38F0,
+  0x30F0, 0x30CF, 0x28CF, 0x28CF, 0x20CF, 0x20CE, 0x0917, 0x011A, 0x0119, 0x011A, 0x8005, 0x0119, 0x0001, 0x011A, 0x8004, 0x0119,
+  0x0001, 0x00F9, 0x800C, 0x0119, 0x8005, 0x0119, 0x0004, 0x011A, 0x0119, 0x0119, 0x011A, 0x8003, 0x0119, 0x0003, 0x011A, 0x0119,
+  0x011A, 0x8065, 0x0119, 0x0010, 0x011A, 0x0119, 0x0118, 0x011A, 0x00F9, 0x0119, 0x00F9, 0x10D2, 0x20AD, 0x18CD, 0x20AE, 0x18AD,
+  0x20AE, 0x20CE, 0x20CE, 0x8252, 0x8003, 0xD375, 0x0008, 0x9A93, 0x30EF, 0x20CF, 0x28CF, 0x28CF, 0x28EF, 0x28EF, 0x28F0, 0x800A,
+  0x30F0, 0x0002, 0x38F0, 0x38F0, 0x800C, 0x3911, 0x0001, 0x38F1, 0x8004, 0x3911, 0x0010, 0x4111, 0x6972, 0x81D2, 0xAA13, 0xBA33,
+  0xCA54, 0xCA74, 0xCA53, 0xCA54, 0xCA53, 0xCA53, 0xB213, 0xA1F3, 0x8193, 0x5152, 0x4932, 0x8003, 0x4933, 0x0016, 0x5174, 0xD395,
+  0xD395, 0xD396, 0xD375, 0xD334, 0xD2F5, 0xD2B4, 0x2D9D, 0x063F, 0x063F, 0x061F, 0xC993, 0xC952, 0xC911, 0xC8F1, 0xC0B1, 0xC0B1,
+  0xB8D1, 0x059E, 0x057E, 0xABF7, 0x8005, 0xD395, 0x0004, 0xD375, 0xD395, 0xD395, 0xD375, 0x800B, 0xD395, 0x0001, 0xD396, 0x8003,
+  0xD395, 0x0002, 0xD375, 0xD375, 0x8003, 0xD355, 0x0007, 0xD335, 0xD335, 0xD315, 0xD335, 0xCB15, 0xD2F4, 0xD2F5, 0x8003, 0xD2D4,
+  0x0013, 0xD2B4, 0xD2B4, 0xD294, 0xD294, 0x411C, 0x003F, 0x003F, 0x001F, 0x001F, 0x203C, 0xC0B1, 0xC0B1, 0x9135, 0x02FF, 0x041F,
+  0x051F, 0x061F, 0x06FF, 0x07BF, 0x8005, 0x07FF, 0x0002, 0xA1B3, 0xB8B1, 0x8006, 0xB8D1, 0x0005, 0x68F1, 0x3911, 0x38F0, 0x30F0,
+  0x30EF, 0x8003, 0x28CF, 0x0002, 0x20CE, 0x10F3, 0x8003, 0x0119, 0x0001, 0x00FA, 0x8003, 0x0119, 0x0001, 0x10D0, 0x8004, 0x18AD,
+  0x0002, 0x18AE, 0x18AE, 0x800C, 0x18AD, 0x8008, 0x18AD, 0x0001, 0x18AE, 0x8070, 0x18AD, 0x000A, 0x20AD, 0x20AD, 0x18AE, 0x18AE,
+  0x18AD, 0x20AE, 0x18AD, 0x20AE, 0x20CE, 0x412F, 0x8003, 0xD375, 0x0007, 0x71D1, 0x20CE, 0x28CF, 0x20CF, 0x28CE, 0x28CF, 0x28CF,
+  0x8003, 0x28EF, 0x8013, 0x30F0, 0x0009, 0x3110, 0x3110, 0x38F0, 0x30F0, 0x3111, 0x3111, 0x38F1, 0x38F1, 0x38F0, 0x8003, 0x3910,
+  0x8003, 0x3911, 0x0004, 0x3910, 0x6152, 0x6152, 0x5131, 0x8003, 0x3911, 0x002E, 0x3912, 0x4112, 0x4132, 0x4112, 0x4932, 0x4932,
+  0x8A34, 0xD395, 0xD395, 0xD375, 0xD335, 0xD2F4, 0xCAD4, 0xB2F6, 0x065F, 0x061F, 0x061F, 0x34DC, 0xC952, 0xC912, 0xC8D2, 0xC0B1,
+  0xC0D1, 0xB8D1, 0x89B4, 0x2BBA, 0x4216, 0x5154, 0x5154, 0x4954, 0x5154, 0x6194, 0x71D4, 0x69F4, 0x71D3, 0x69D4, 0x71D3, 0x7A14,
+  0x8A75, 0x9274, 0x9254, 0x9254, 0x9A95, 0xB315, 0xBB14, 0xD396, 0x8005, 0xD395, 0x0002, 0xD375, 0xD375, 0x8003, 0xD355, 0x001E,
+  0xD335, 0xD335, 0xD314, 0xD315, 0xD2F4, 0xCB14, 0xD2F4, 0xD2F4, 0xD2D4, 0xCAD4, 0xCAB4, 0xD2B4, 0xCAB4, 0xCA94, 0xCA94, 0x81B8,
+  0x005F, 0x005F, 0x003F, 0x001F, 0x001F, 0xA8B3, 0xC0B1, 0xB0D2, 0x02DF, 0x03FF, 0x051F, 0x061F, 0x06FF, 0x07BF, 0x8005, 0x07FF,
+  0x0001, 0x8A95, 0x8007, 0xB8D1, 0x0018, 0x78F2, 0x3911, 0x38F0, 0x30F0, 0x28F0, 0x28CF, 0x28CF, 0x28CE, 0x20CE, 0x20CF, 0x0918,
+  0x0119, 0x0119, 0x011A, 0x00F9, 0x0119, 0x08F7, 0x18AE, 0x18AD, 0x18AD, 0x20AD, 0x18AD, 0x18AD, 0x18CD, 0x800C, 0x18AD, 0x800B,
+  0x18AD, 0x0001, 0x18AE, 0x8006, 0x18AD, 0x0001, 0x18AE, 0x8066, 0x18AD, 0x0010, 0x18AE, 0x18AD, 0x20AD, 0x18AD, 0x20AE, 0x20AE,
+  0x20CD, 0x20AE, 0x20CD, 0x9272, 0xD375, 0xC334, 0x61D1, 0x20CF, 0x20CE, 0x20CE, 0x8008, 0x28CF, 0x0003, 0x28EF, 0x28EF, 0x30EF,
+  0x8018, 0x30F0, 0x002B, 0x38F0, 0x30F0, 0x3110, 0x3110, 0x30F0, 0x3110, 0x38F0, 0x30F0, 0x38F0, 0x3111, 0x38F0, 0x3911, 0x38F1,
+  0x3911, 0x3911, 0x3912, 0x4111, 0x4132, 0x4132, 0xB2F5, 0xD395, 0xD375, 0xD355, 0xD2F4, 0xD2B4, 0xD274, 0x83B8, 0x063F, 0x061F,
+  0x061E, 0x6398, 0xC912, 0xC8D1, 0xC0B1, 0xC0B1, 0xB8B1, 0xB8D1, 0x7933, 0x5153, 0x5134, 0x5154, 0x5133, 0x4953, 0x8003, 0x4933,
+  0x0002, 0x4133, 0x4933, 0x8003, 0x4932, 0x8003, 0x4933, 0x0002, 0x4932, 0x4932, 0x8003, 0x4933, 0x0006, 0x61B3, 0x7A34, 0x9A95,
+  0xB2F5, 0xD375, 0xD375, 0x8003, 0xD355, 0x0005, 0xD335, 0xD335, 0xD314, 0xD314, 0xD315, 0x8003, 0xD2F4, 0x0017, 0xD2D4, 0xD2D4,
+  0xD2B4, 0xD2B4, 0xD294, 0xD294, 0xD274, 0xCA74, 0xC254, 0x007F, 0x005F, 0x005F, 0x003F, 0x001F, 0x5878, 0xB8D1, 0xC0B1, 0x02BF,
+  0x03BF, 0x04FF, 0x05FF, 0x06FF, 0x07BF, 0x8005, 0x07FF, 0x0001, 0x6478, 0x8007, 0xB8D1, 0x0017, 0x78F1, 0x3911, 0x38F0, 0x30F0,
+  0x30F0, 0x28CF, 0x28CF, 0x28CE, 0x20CE, 0x20CE, 0x20CF, 0x0917, 0x011A, 0x011A, 0x0119, 0x08F4, 0x18CE, 0x18AE, 0x18AD, 0x18AD,
+  0x18AE, 0x18AD, 0x18AE, 0x800D, 0x18AD, 0x8004, 0x18AD, 0x0001, 0x18AE, 0x800A, 0x18AD, 0x0001, 0x18AE, 0x8068, 0x18AD, 0x0002,
+  0x18AE, 0x18AE, 0x8003, 0x18AD, 0x0008, 0x20AD, 0x20CD, 0x18CE, 0x20AE, 0x390F, 0xD375, 0xCB35, 0x414F, 0x8005, 0x20CE, 0x800A,
+  0x28CF, 0x0001, 0x28EF, 0x8004, 0x28CF, 0x8003, 0x28EF, 0x8008, 0x30EF, 0x0002, 0x30F0, 0x28F0, 0x8003, 0x30F0, 0x0006, 0x28F0,
+  0x30F0, 0x30EF, 0x3110, 0x30F0, 0x30D0, 0x8005, 0x30F0, 0x001E, 0x30F1, 0x30F0, 0x30F0, 0x38F0, 0x3911, 0x3910, 0x3911, 0x38F1,
+  0x3911, 0x3912, 0x4952, 0xD395, 0xD375, 0xD335, 0xD2F4, 0xD2B4, 0xD274, 0xCA33, 0x4C9A, 0x05FF, 0x061F, 0x05FF, 0xA1F4, 0xC0D1,
+  0xC0B1, 0xC0B1, 0xB8D1, 0xB8D1, 0xA0F1, 0x5134, 0x8005, 0x4933, 0x8003, 0x4932, 0x8003, 0x4132, 0x8006, 0x4112, 0x8005, 0x4132,
+  0x000E, 0x4133, 0x4933, 0x4932, 0x4953, 0x6193, 0x8214, 0xA274, 0xC315, 0xD335, 0xD314, 0xD315, 0xD2F4, 0xD2F4, 0xD2F5, 0x8003,
+  0xD2D4, 0x0004, 0xD2B4, 0xCAB4, 0xCAB4, 0xCA94, 0x8003, 0xCA74, 0x000F, 0xCA54, 0x20FD, 0x009F, 0x007F, 0x005F, 0x003F, 0x105D,
+  0xC0B1, 0xC0D1, 0x029F, 0x03BF, 0x04DF, 0x05FF, 0x06FF, 0x07BF, 0x8005, 0x07FF, 0x0004, 0x54D9, 0xB8D1, 0xB8D1, 0xB8B1, 0x8004,
+  0xB8D1, 0x000A, 0x78F1, 0x3911, 0x38F0, 0x30F0, 0x30F0, 0x28CF, 0x28CF, 0x28CE, 0x20CF, 0x20CE, 0x8003, 0x20AE, 0x0004, 0x20AD,
+  0x18AD, 0x20AD, 0x20AD, 0x8013, 0x18AD, 0x8004, 0x18AD, 0x0004, 0x18AE, 0x18AD, 0x18AE, 0x18AE, 0x8075, 0x18AD, 0x0010, 0x20AE,
+  0x18AD, 0x20AD, 0x20AE, 0x61D0, 0xBB14, 0x412F, 0x20AE, 0x20AE, 0x20CE, 0x20AE, 0x20CE, 0x20CE, 0x28CE, 0x20CE, 0x20CF, 0x8019,
+  0x28CF, 0x000C, 0x28EF, 0x28EF, 0x28CF, 0x28F0, 0x30D0, 0x28EF, 0x28CF, 0x30CF, 0x30F0, 0x30D0, 0x30D0, 0x28F0, 0x8003, 0x30F0,
+  0x0001, 0x30D0, 0x8004, 0x30F0, 0x0001, 0x38F0, 0x8003, 0x3911, 0x0017, 0x61B2, 0xD375, 0xD335, 0xD2F4, 0xCAD4, 0xCA74, 0xD233,
+  0xCA13, 0x1D9D, 0x05FF, 0x05FF, 0x1D3D, 0xC0D1, 0xC0B1, 0xC0B1, 0xB8D1, 0xB8D1, 0xB0D1, 0x6132, 0x4933, 0x4933, 0x4932, 0x4132,
+  0x8003, 0x4112, 0x000E, 0x4132, 0x4112, 0x4111, 0x4111, 0x4112, 0x4112, 0x4111, 0x3911, 0x3911, 0x4111, 0x4112, 0x4112, 0x3912,
+  0x4132, 0x8003, 0x4112, 0x000C, 0x4912, 0x4132, 0x4132, 0x4932, 0x4933, 0x4953, 0x4933, 0x6173, 0x8A14, 0xAA74, 0xCAF4, 0xD2F5,
+  0x8003, 0xD2D4, 0x0017, 0xD2B4, 0xCAB4, 0xD2B4, 0xD294, 0xCA94, 0xCA73, 0xD274, 0xD253, 0xD254, 0x597A, 0x00BF, 0x00BF, 0x009F,
+  0x009F, 0x005F, 0xA8B3, 0xC0B1, 0x31FC, 0x039F, 0x04DF, 0x05DF, 0x06DF, 0x07BF, 0x8005, 0x07FF, 0x0001, 0x2E3C, 0x8004, 0xB8D1,
+  0x000B, 0xB8B1, 0xB8D1, 0xB8D1, 0x78F1, 0x3911, 0x30F0, 0x30F0, 0x28EF, 0x28EF, 0x28CF, 0x28CF, 0x8003, 0x20CE, 0x0005, 0x20AD,
+  0x20AE, 0x18CE, 0x18AD, 0x20AD, 0x8004, 0x18AD, 0x0003, 0x20AD, 0x18AD, 0x18AE, 0x800D, 0x18AD, 0x8005, 0x18AD, 0x0003, 0x18CD,
+  0x18AF, 0x18AF, 0x8009, 0x18AD, 0x0003, 0x18AE, 0x18AF, 0x18AF, 0x8064, 0x18AD, 0x000E, 0x20AD, 0x18AD, 0x18AD, 0x20AD, 0x18AD,
+  0x18AD, 0x18AE, 0x18AD, 0x20AE, 0x390F, 0x28CE, 0x20AE, 0x20CE, 0x20AE, 0x800B, 0x20CE, 0x801D, 0x28CF, 0x8003, 0x28EF, 0x0006,
+  0x28CF, 0x28EF, 0x28EF, 0x30EF, 0x28EF, 0x28EF, 0x8006, 0x30F0, 0x0009, 0x3911, 0x71F2, 0xD335, 0xD2F4, 0xD2B4, 0xCA74, 0xD233,
+  0xCA13, 0xA295, 0x8003, 0x05FF, 0x000A, 0x5399, 0xC0D1, 0xC0B1, 0xB8D1, 0xB8D1, 0xB0D1, 0x7912, 0x4952, 0x4132, 0x4112, 0x8003,
+  0x4132, 0x0001, 0x4112, 0x8004, 0x3911, 0x0001, 0x38F1, 0x800C, 0x3911, 0x0001, 0x4111, 0x8004, 0x4112, 0x0015, 0x4132, 0x4932,
+  0x4932, 0x4933, 0x4933, 0x5133, 0x6194, 0x9A34, 0xC2B4, 0xD2B5, 0xD2B3, 0xCAB4, 0xD294, 0xD294, 0xCA93, 0xD274, 0xD274, 0xCA53,
+  0xCA54, 0xCA53, 0x81D8, 0x8003, 0x00DF, 0x000A, 0x00BF, 0x00BF, 0x68B7, 0xB8D1, 0x31DC, 0x033F, 0x049F, 0x05DF, 0x06FF, 0x07BF,
+  0x8005, 0x07FF, 0x0001, 0x26BD, 0x8004, 0xB8D1, 0x000D, 0xB8D2, 0xB8D1, 0xB8D1, 0x78F1, 0x3911, 0x38F1, 0x30F0, 0x30EF, 0x28EF,
+  0x28CF, 0x28CF, 0x20CE, 0x20CE, 0x8003, 0x20AE, 0x8003, 0x18AD, 0x0002, 0x20AD, 0x18AE, 0x8012, 0x18AD, 0x8004, 0x18AD, 0x0006,
+  0x18B0, 0x0118, 0x0119, 0x0119, 0x00F6, 0x18AE, 0x8006, 0x18AD, 0x0006, 0x10CF, 0x00F8, 0x0119, 0x011A, 0x00F6, 0x18AE, 0x8003,
+  0x18AD, 0x0001, 0x18AE, 0x8024, 0x18AD, 0x0001, 0x18AE, 0x8003, 0x18AD, 0x0001, 0x18CD, 0x8007, 0x18AD, 0x0001, 0x18AE, 0x8039,
+  0x18AD, 0x8004, 0x20AE, 0x800C, 0x20CE, 0x8008, 0x20CF, 0x801C, 0x28CF, 0x0012, 0x28EF, 0x28F0, 0x28F0, 0x30F0, 0x30F0, 0x38F0,
+  0x8213, 0xD2F5, 0xCAD4, 0xD274, 0xCA53, 0xC9F3, 0xC9D2, 0x7398, 0x05FF, 0x05FF, 0x05DF, 0xA953, 0x8004, 0xB8D1, 0x0006, 0x98F2,
+  0x4132, 0x4132, 0x4112, 0x4111, 0x4111, 0x8008, 0x3911, 0x8004, 0x38F0, 0x0003, 0x3911, 0x38F0, 0x38F0, 0x8009, 0x3911, 0x8003,
+  0x4112, 0x0002, 0x4132, 0x4132, 0x8003, 0x4933, 0x0010, 0x5153, 0x5974, 0x9214, 0xCA94, 0xD294, 0xCA94, 0xD274, 0xCA74, 0xD274,
+  0xCA53, 0xCA54, 0xCA53, 0xCA34, 0x99F6, 0x011F, 0x011F, 0x8003, 0x00FF, 0x0008, 0x38DB, 0xC0B1, 0x28FC, 0x02DF, 0x047F, 0x059F,
+  0x06DF, 0x07BF, 0x8006, 0x07FF, 0x8007, 0xB8D1, 0x0008, 0x78F1, 0x3911, 0x38F0, 0x30F0, 0x30F0, 0x28EF, 0x28CF, 0x28CF, 0x8003,
+  0x20CE, 0x8004, 0x20AE, 0x8015, 0x18AD, 0x000A, 0x18CD, 0x18AD, 0x18AE, 0x18B0, 0x0119, 0x00F9, 0x0119, 0x00F9, 0x0119, 0x08F6,
+  0x8003, 0x18AD, 0x0009, 0x18AE, 0x18AD, 0x18D0, 0x00F9, 0x0119, 0x0119, 0x011A, 0x0119, 0x08F6, 0x802B, 0x18AD, 0x0001, 0x18AE,
+  0x8003, 0x18AD, 0x0005, 0x20AD, 0x18AD, 0x310E, 0x7A32, 0xAAD3, 0x8003, 0xD395, 0x0001, 0xD375, 0x8004, 0xD395, 0x0001, 0xD396,
+  0x8069, 0xD395, 0x0012, 0xD396, 0xD395, 0xD335, 0xD2B4, 0xCA94, 0xCA33, 0xD1F3, 0xC9D3, 0xC993, 0xC972, 0xC992, 0xC972, 0xC932,
+  0xC0D1, 0xC0B1, 0xB8D1, 0xB0D2, 0xB9F2, 0x8005, 0xD395, 0x0001, 0xD396, 0x800C, 0xD395, 0x0002, 0xD375, 0xD396, 0x8013, 0xD395,
+  0x0001, 0xD396, 0x800B, 0xD395, 0x0002, 0xCA13, 0x015F, 0x8003, 0x013F, 0x0009, 0x011F, 0x093F, 0xC0B1, 0x311C, 0x01BF, 0x03FF,
+  0x059F, 0x069F, 0x079F, 0x8006, 0x07FF, 0x0001, 0xB8B1, 0x8006, 0xB8D1, 0x0008, 0x78F1, 0x3911, 0x3911, 0x30F0, 0x30F0, 0x28EF,
+  0x28CF, 0x28CF, 0x8003, 0x20CE, 0x8004, 0x20AE, 0x8015, 0x18AD, 0x0003, 0x18AD, 0x18AE, 0x18B0, 0x8005, 0x0119, 0x000A, 0x011A,
+  0x011A, 0x18AD, 0x20AD, 0x18AD, 0x18AD, 0x10CF, 0x0118, 0x0119, 0x011A, 0x8004, 0x0119, 0x0003, 0x18AE, 0x18AD, 0x18AE, 0x8024,
+  0x18AD, 0x0001, 0x18CD, 0x8003, 0x18AD, 0x0006, 0x20AD, 0x18AE, 0x20AD, 0x18AD, 0x496F, 0xAAD3, 0x8007, 0xD395, 0x0001, 0xD375,
+  0x806F, 0xD395, 0x000F, 0xD2F4, 0xCA74, 0xCA33, 0xCA13, 0xC9D3, 0xC992, 0xC952, 0xC111, 0xC0D1, 0xC0B1, 0xC0D1, 0xB8B1, 0xB8D1,
+  0xB8D1, 0xCA53, 0x8005, 0xD395, 0x0001, 0xD396, 0x8009, 0xD395, 0x0001, 0xD396, 0x8004, 0xD395, 0x0001, 0xD375, 0x801F, 0xD395,
+  0x000E, 0xCA13, 0x097F, 0x017F, 0x015F, 0x017F, 0x015F, 0x015F, 0x88F5, 0x293C, 0x013F, 0x02DF, 0x053E, 0x067F, 0x077F, 0x8006,
+  0x07FF, 0x0001, 0x9234, 0x8006, 0xB8D1, 0x0008, 0x78F1, 0x3911, 0x3911, 0x30F0, 0x30F0, 0x28EF, 0x28CF, 0x28CF, 0x8003, 0x20CE,
+  0x8004, 0x20AE, 0x8015, 0x18AD, 0x000A, 0x18AE, 0x10D0, 0x0118, 0x0119, 0x011A, 0x011A, 0x0119, 0x011A, 0x0119, 0x011A, 0x8003,
+  0x18AD, 0x0002, 0x18D0, 0x00F8, 0x8004, 0x0119, 0x0003, 0x011A, 0x011A, 0x0119, 0x8004, 0x18AD, 0x0001, 0x18AE, 0x8021, 0x18AD,
+  0x0001, 0x18AE, 0x8006, 0x18AD, 0x0003, 0x20EE, 0x8252, 0xD396, 0x800B, 0xD395, 0x0001, 0xD3B5, 0x806C, 0xD395, 0x000E, 0xD2B4,
+  0xD233, 0xCA13, 0xC9B3, 0xC992, 0xC952, 0xC912, 0xC8D1, 0xC0B1, 0xC0B1, 0xB8B1, 0xB8D1, 0xB8D1, 0xC253, 0x8014, 0xD395, 0x0001,
+  0xDB95, 0x8016, 0xD395, 0x0001, 0xD396, 0x8009, 0xD395, 0x0003, 0xCA13, 0x31BC, 0x01BF, 0x8004, 0x019F, 0x0008, 0x5139, 0x315C,
+  0x017F, 0x01BF, 0x045E, 0x063E, 0x077F, 0x07FE, 0x8005, 0x07FF, 0x0001, 0x8A95, 0x8004, 0xB8D1, 0x000A, 0xB0D1, 0xB8D1, 0x78F1,
+  0x3911, 0x3911, 0x30F0, 0x30F0, 0x28EF, 0x28CF, 0x28CF, 0x8003, 0x20CE, 0x8004, 0x20AE, 0x8015, 0x18AD, 0x0002, 0x10D0, 0x0118,
+  0x8007, 0x0119, 0x000D, 0x08F5, 0x18AD, 0x18AD, 0x10D0, 0x00F9, 0x0119, 0x0119, 0x00FA, 0x0119, 0x0119, 0x011A, 0x0119, 0x08F5,
+  0x8027, 0x18AD, 0x0007, 0x20AE, 0x18AD, 0x20AD, 0x18AD, 0x18AD, 0x28EE, 0xB314, 0x8005, 0xD395, 0x000A, 0xD4F8, 0xD65C, 0xD6DD,
+  0xD6FD, 0xD7FF, 0xD7FF, 0xDFFF, 0xD7FF, 0xD7FF, 0xDFFF, 0x8069, 0xD7FF, 0x000B, 0xDFFF, 0xD7FF, 0xCB15, 0xCA13, 0xC9D3, 0xC992,
+  0xC932, 0xC911, 0xC0D1, 0xC0B1, 0xC0B1, 0x8003, 0xB8D1, 0x0001, 0xC397, 0x800A, 0xDFFF, 0x8007, 0xD7FF, 0x0002, 0xDFFF, 0xD539,
+  0x801A, 0xD395, 0x0001, 0xDB95, 0x8005, 0xD395, 0x0005, 0xD396, 0xD395, 0xD395, 0xC9F3, 0x31FC, 0x8005, 0x01DF, 0x0009, 0x01BF,
+  0x01DF, 0x01BF, 0x01BF, 0x02DF, 0x05FD, 0x073E, 0x07FE, 0x07FE, 0x8004, 0x07FF, 0x0001, 0x8AB5, 0x8004, 0xB8D1, 0x000A, 0xB0F1,
+  0xB8D1, 0x78F1, 0x3911, 0x3911, 0x30F0, 0x30F0, 0x28EF, 0x28CF, 0x28CF, 0x8003, 0x20CE, 0x8004, 0x20AE, 0x8015, 0x18AD, 0x0001,
+  0x00F9, 0x8006, 0x0119, 0x000F, 0x011A, 0x00F7, 0x18CE, 0x18AD, 0x10D0, 0x00F8, 0x0119, 0x011A, 0x0119, 0x011A, 0x011A, 0x0119,
+  0x0119, 0x00F7, 0x18CE, 0x8003, 0x18AE, 0x8026, 0x18AD, 0x000A, 0x20AD, 0x18AE, 0x28EE, 0xCB55, 0xD375, 0xD395, 0xD395, 0xD3D6,
+  0xD5DB, 0xD7BF, 0x8073, 0xD7FF, 0x0010, 0xDFFF, 0xDFFF, 0xCA13, 0xC9B3, 0xC992, 0xC952, 0xC912, 0xC0D1, 0xC0B1, 0xC0D1, 0xB8B1,
+  0xB8D1, 0xB0F1, 0xBA95, 0xDFFF, 0xD7FF, 0x8005, 0xDFFF, 0x0001, 0xD7FF, 0x8005, 0xDFFF, 0x8006, 0xD7FF, 0x0002, 0xDFFF, 0xD539,
+  0x8022, 0xD395, 0x0003, 0xC9F3, 0x31FD, 0x021F, 0x8007, 0x01FF, 0x0006, 0x01DF, 0x01FF, 0x051D, 0x071D, 0x07FD, 0x07FE, 0x8004,
+  0x07FF, 0x0001, 0x6BF7, 0x8005, 0xB8D1, 0x0009, 0xB0D1, 0x78F1, 0x3911, 0x3911, 0x30F0, 0x30F0, 0x28EF, 0x28CF, 0x28CF, 0x8003,
+  0x20CE, 0x8004, 0x20AE, 0x8015, 0x18AD, 0x8005, 0x0119, 0x0006, 0x011A, 0x0119, 0x00F7, 0x18CE, 0x18AD, 0x18CF, 0x8004, 0x0119,
+  0x0006, 0x011A, 0x0119, 0x011A, 0x011A, 0x00F7, 0x18CE, 0x802B, 0x18AD, 0x0002, 0x28EE, 0xB314, 0x8003, 0xD395, 0x0005, 0xD477,
+  0xD77E, 0xD7FF, 0xD7FF, 0xDFFF, 0x8004, 0xD7FF, 0x0001, 0xDFFF, 0x806F, 0xD7FF, 0x000C, 0xC9D3, 0xC992, 0xC952, 0xC912, 0xC8D1,
+  0xC0B1, 0xC0B1, 0xB8D1, 0xB8D1, 0xB0D1, 0xB152, 0xD79E, 0x8003, 0xDFFF, 0x0001, 0xD7FF, 0x8004, 0xDFFF, 0x0002, 0xD7FF, 0xDFFF,
+  0x800B, 0xD7FF, 0x0001, 0xD539, 0x8021, 0xD395, 0x0007, 0xC9D3, 0x323C, 0x023F, 0x023F, 0x021F, 0x023F, 0x023F, 0x8005, 0x021F,
+  0x0005, 0x037E, 0x06DC, 0x07FD, 0x07FD, 0x07FE, 0x8003, 0x07FF, 0x0001, 0x5C78, 0x8003, 0xB8D1, 0x000B, 0xB0D1, 0xB8D1, 0xB0F1,
+  0x7911, 0x3911, 0x3911, 0x30F0, 0x30F0, 0x28EF, 0x28CF, 0x28CF, 0x8003, 0x20CE, 0x8004, 0x20AE, 0x8015, 0x18AD, 0x0002, 0x011A,
+  0x00F9, 0x8003, 0x0119, 0x0006, 0x011A, 0x0117, 0x18AE, 0x18AD, 0x10D0, 0x00F9, 0x8007, 0x0119, 0x000A, 0x00F7, 0x18CE, 0x18AD,
+  0x18AD, 0x20AD, 0x18AD, 0x20AE, 0x18AD, 0x18AD, 0x18AE, 0x8020, 0x18AD, 0x000A, 0x18AE, 0x18AD, 0x18AD, 0x18CD, 0x8252, 0xD395,
+  0xD395, 0xD396, 0xD4B8, 0xD7BF, 0x8078, 0xD7FF, 0x0006, 0xC972, 0xC952, 0xC912, 0xC8D1, 0xC0B1, 0xC0B1, 0x8003, 0xB8D1, 0x000D,
+  0xB0F1, 0xD63C, 0xDFFF, 0xDFFF, 0xD7FF, 0xDFFF, 0xDFFF, 0xD7FF, 0xDFFF, 0xDFFF, 0xD7FF, 0xD7FF, 0xDFFF, 0x8009, 0xD7FF, 0x0004,
+  0xDFFF, 0xD7FF, 0xDFFF, 0xD539, 0x8015, 0xD395, 0x0002, 0xD396, 0xD396, 0x8009, 0xD395, 0x0003, 0xC9D3, 0x325C, 0x027F, 0x8003,
+  0x025F, 0x0003, 0x023F, 0x025F, 0x025F, 0x8003, 0x023F, 0x0005, 0x029F, 0x067C, 0x07FC, 0x07FC, 0x07FE, 0x8003, 0x07FF, 0x000F,
+  0x5C78, 0xB8D1, 0xB0D1, 0xB8D1, 0xB0D1, 0xB0D1, 0xB8D1, 0x70F1, 0x3911, 0x3911, 0x30F0, 0x30F0, 0x28EF, 0x28CF, 0x28CF, 0x8003,
+  0x20CE, 0x8004, 0x20AE, 0x8015, 0x18AD, 0x0002, 0x0119, 0x011A, 0x8003, 0x0119, 0x0008, 0x00F7, 0x18AE, 0x18AD, 0x10CF, 0x0119,
+  0x0119, 0x011A, 0x011A, 0x8003, 0x0119, 0x0003, 0x011A, 0x00F7, 0x18CE, 0x802C, 0x18AD, 0x0001, 0x496F, 0x8003, 0xD395, 0x0002,
+  0xD457, 0xD7BF, 0x8074, 0xD7FF, 0x000F, 0xD7DF, 0xD7FF, 0xCF3E, 0xC67C, 0xC53A, 0xC951, 0xC912, 0xC0D1, 0xC0B1, 0xC0B1, 0xB8D1,
+  0xB8D1, 0xB0D1, 0xB0F1, 0xBB97, 0x8019, 0xD7FF, 0x0003, 0xD65B, 0xD395, 0xD396, 0x8018, 0xD395, 0x0007, 0xD396, 0xD395, 0xD395,
+  0xD396, 0xD395, 0xC9B3, 0x327C, 0x8004, 0x029F, 0x8005, 0x027F, 0x0006, 0x025F, 0x027F, 0x05BC, 0x07DB, 0x07FC, 0x07FD, 0x8003,
+  0x07FF, 0x0003, 0x5C78, 0xB8D1, 0xB0D1, 0x8003, 0xB8D1, 0x0009, 0xB0D1, 0x58F1, 0x3911, 0x3111, 0x30F0, 0x28F0, 0x28F0, 0x28CF,
+  0x28CE, 0x8003, 0x20CE, 0x8004, 0x20AE, 0x8015, 0x18AD, 0x000B, 0x011A, 0x0119, 0x0119, 0x011A, 0x0117, 0x18CE, 0x18AE, 0x18D0,
+  0x0118, 0x00F9, 0x011A, 0x8005, 0x0119, 0x0002, 0x00F7, 0x18AE, 0x802C, 0x18AD, 0x000F, 0x20AE, 0xA2D3, 0xD395, 0xD395, 0xD3D6,
+  0xD75E, 0xCFFF, 0xCFFF, 0xD7FF, 0xD7FF, 0xCFFF, 0xCFFF, 0xD7FF, 0xD7FF, 0xD7DF, 0x8003, 0xD7FF, 0x002C, 0xD7DF, 0xD7FF, 0xD7FF,
+  0xCFDF, 0xCFFF, 0xD7FF, 0xD7DF, 0xD7FF, 0xCFFF, 0xD7FF, 0xD7DF, 0xD7FF, 0xCFFF, 0xD7DF, 0xCFFF, 0xCFFF, 0xD7FF, 0xD7FF, 0xCFFF,
+  0xD7FF, 0xCFFF, 0xD7FF, 0xD7DF, 0xD7DF, 0xCFFF, 0xD7DF, 0xCFFF, 0xD7FF, 0xD7FF, 0xCFFF, 0xD7FF, 0xCFFF, 0xD7FF, 0xD7DF, 0xD7FF,
+  0xD7FF, 0xCFFF, 0xCFFF, 0xD7FF, 0xCFFF, 0xD7DF, 0xCFFF, 0xD7FF, 0xD7DF, 0x8038, 0xD7FF, 0x000A, 0xCFFF, 0xD7FF, 0xCFDF, 0xD7DF,
+  0xCFDF, 0xCFFF, 0xD7DF, 0xACD8, 0x8191, 0x9151, 0x8003, 0x9931, 0x0001, 0x9911, 0x8003, 0x9931, 0x0007, 0xA8F1, 0xA972, 0xD77E,
+  0xD7FF, 0xD7FF, 0xD7DF, 0xD7DF, 0x8003, 0xD7FF, 0x0002, 0xD7DF, 0xCFFF, 0x8006, 0xD7FF, 0x0002, 0xD7DF, 0xD7DF, 0x8004, 0xD7FF,
+  0x0006, 0xD7DF, 0xD7FF, 0xD7DF, 0xD7FF, 0xD7DF, 0xD65C, 0x801E, 0xD395, 0x0004, 0xC193, 0x0A7F, 0x02FF, 0x02DF, 0x8003, 0x02BF,
+  0x8003, 0x029F, 0x0007, 0x027F, 0x029F, 0x027F, 0x04DD, 0x07BB, 0x07FB, 0x07FD, 0x8003, 0x07FF, 0x0004, 0x3DBB, 0xB8D1, 0xB8D1,
+  0xB0F1, 0x8003, 0xB0D1, 0x0008, 0x5911, 0x3911, 0x30F0, 0x30F0, 0x28F0, 0x28CF, 0x28CF, 0x20CF, 0x8004, 0x20CE, 0x8003, 0x20AE,
+  0x8015, 0x18AD, 0x000B, 0x00F9, 0x0119, 0x011A, 0x00F7, 0x18AE, 0x18AD, 0x18AF, 0x0118, 0x0119, 0x0119, 0x011A, 0x8003, 0x0119,
+  0x0003, 0x011A, 0x0117, 0x18AE, 0x802D, 0x18AD, 0x0005, 0x310E, 0xD395, 0xD375, 0xD375, 0xD5BA, 0x8010, 0xCFDF, 0x0009, 0xC77E,
+  0xBE5B, 0xBE3C, 0xB57A, 0xACB8, 0xBDBB, 0xC63C, 0xBE3B, 0xC71E, 0x800C, 0xCFDF, 0x0009, 0xC77E, 0xBE5C, 0xB5DB, 0xACB8, 0xAC98,
+  0xBD5A, 0xBE3C, 0xC61C, 0xC69D, 0x804A, 0xCFDF, 0x0004, 0xACB9, 0x8191, 0x9151, 0x9911, 0x8004, 0x9931, 0x0004, 0x9911, 0xA111,
+  0xA911, 0xBC78, 0x8003, 0xCFDF, 0x0008, 0xD7DF, 0xCFDF, 0xCF5E, 0xBE5C, 0xBE5C, 0xC63C, 0xC61C, 0xCEFD, 0x800F, 0xCFDF, 0x0007,
+  0xCFFF, 0xCFDF, 0xD63B, 0xD375, 0xD395, 0xD375, 0xD395, 0x8014, 0xD375, 0x0001, 0xD395, 0x8003, 0xD375, 0x0006, 0xD395, 0x089F,
+  0x011F, 0x031F, 0x02FF, 0x02FF, 0x8003, 0x02DF, 0x8005, 0x02BF, 0x0016, 0x03FD, 0x079A, 0x07FA, 0x07FC, 0x07FE, 0x07FF, 0x07FF,
+  0x2E5C, 0xB0D1, 0xB8D1, 0xB8D1, 0xB0F1, 0xB0D1, 0xB8D1, 0x5912, 0x3911, 0x38F1, 0x30F0, 0x28F0, 0x28EF, 0x28CF, 0x28CF, 0x8004,
+  0x20CE, 0x0002, 0x20AE, 0x20AE, 0x8016, 0x18AD, 0x000B, 0x0119, 0x0119, 0x0117, 0x18CE, 0x18AD, 0x18AD, 0x0118, 0x011A, 0x0119,
+  0x0119, 0x011A, 0x8003, 0x0119, 0x0002, 0x0117, 0x18AE, 0x802E, 0x18AD, 0x0001, 0x79F1, 0x8003, 0xD355, 0x0006, 0xCF7E, 0xC7DF,
+  0xCFBF, 0xCFDF, 0xC7DF, 0xC7DF, 0x8004, 0xCFDF, 0x0009, 0xCFBF, 0xCFDF, 0xCFDF, 0xCFBF, 0xBEFD, 0xACB8, 0x8A52, 0x9151, 0x9131,
+  0x8006, 0x9931, 0x0021, 0x9911, 0xA192, 0xAB96, 0xBE7D, 0xCFDF, 0xC7DF, 0xCFBF, 0xC7DF, 0xCFDF, 0xCFBF, 0xC75E, 0xAD19, 0x92B4,
+  0x8971, 0x9151, 0x9931, 0x9931, 0x9911, 0x9911, 0xA111, 0x9931, 0xA111, 0x9911, 0xAB36, 0xBD5A, 0xC75E, 0xCFDF, 0xC7BF, 0xC7BF,
+  0xCFDF, 0xC7DF, 0xC7BF, 0xC7DF, 0x8039, 0xCFDF, 0x0028, 0xC7DF, 0xCFBF, 0xC7DF, 0xC7BF, 0xCFBF, 0xC7DF, 0xA4B8, 0x8191, 0x9151,
+  0x9931, 0x9911, 0x9931, 0x9931, 0x9911, 0x9931, 0x9912, 0xBE3B, 0xCFBF, 0xCFDF, 0xCFBF, 0xCFDF, 0xCFDF, 0xB5DA, 0x8A12, 0x8971,
+  0x9931, 0x9931, 0xA111, 0x9931, 0xAB35, 0xC75E, 0xCFBF, 0xCFDF, 0xC7DF, 0xC7DF, 0xCFDF, 0xCFDF, 0xCFBF, 0xC7DF, 0xC7DF, 0x8003,
+  0xCFDF, 0x0001, 0xC7DF, 0x8003, 0xCFDF, 0x0001, 0xCE1B, 0x801C, 0xD355, 0x0004, 0x007F, 0x009E, 0x023F, 0x033F, 0x8003, 0x031F,
+  0x0003, 0x02FF, 0x031F, 0x02FF, 0x8003, 0x02DF, 0x0016, 0x039E, 0x075A, 0x07F9, 0x07FB, 0x07FD, 0x07FF, 0x07FF, 0x2E3C, 0xB8D2,
+  0xB8D1, 0xB0D1, 0xB8D1, 0xB0D1, 0xB0D1, 0x4911, 0x3911, 0x38F0, 0x30F0, 0x28F0, 0x28EF, 0x28CF, 0x28CE, 0x8003, 0x20CE, 0x8003,
+  0x20AE, 0x8016, 0x18AD, 0x0006, 0x011A, 0x00F7, 0x18CE, 0x18AD, 0x18AE, 0x18AD, 0x8003, 0x0119, 0x0006, 0x011A, 0x0119, 0x0119,
+  0x011A, 0x00F7, 0x18AE, 0x802E, 0x18AD, 0x0007, 0x20AD, 0xA293, 0xD335, 0xD335, 0xCC98, 0xC7BF, 0xC7BE, 0x800A, 0xC7BF, 0x000B,
+  0xC75E, 0xA4B8, 0x8191, 0x9151, 0x9911, 0xA131, 0xA111, 0xA111, 0x9931, 0xA111, 0xA112, 0x8006, 0xA111, 0x000A, 0xAB35, 0xBEFE,
+  0xC7BF, 0xC7BE, 0xC7BF, 0xB5DB, 0x89F1, 0x8971, 0x9931, 0x9911, 0x8005, 0xA111, 0x0002, 0xA132, 0x9911, 0x8004, 0xA111, 0x0003,
+  0xA172, 0xBD3A, 0xC7BE, 0x8003, 0xC7BF, 0x0002, 0xC7BE, 0xC79F, 0x8038, 0xC7BF, 0x0001, 0xC79F, 0x8006, 0xC7BF, 0x000C, 0xAC98,
+  0x8191, 0x9151, 0x9931, 0xA111, 0xA131, 0xA111, 0xA131, 0xA111, 0x9931, 0xBE1B, 0xC79F, 0x8003, 0xC7BF, 0x0006, 0xBEFD, 0x89F2,
+  0x8991, 0x9931, 0xA112, 0xA131, 0x8003, 0xA111, 0x0004, 0xAB97, 0xC7BF, 0xC7BF, 0xC7BE, 0x800E, 0xC7BF, 0x0002, 0xC6DD, 0xD375,
+  0x8017, 0xD335, 0x000A, 0xD334, 0xD335, 0xD335, 0x009F, 0x009F, 0x013F, 0x033F, 0x037F, 0x035F, 0x033F, 0x8004, 0x031F, 0x0018,
+  0x02FF, 0x02FF, 0x033F, 0x06F9, 0x07F9, 0x07FB, 0x07FD, 0x07FF, 0x07FF, 0x2E3C, 0xB8D2, 0xB0F1, 0xB8D1, 0xB0D1, 0xB0F1, 0xB0D1,
+  0x3911, 0x3911, 0x38F0, 0x30F0, 0x3110, 0x28CF, 0x28CF, 0x20CF, 0x8003, 0x20CE, 0x0003, 0x20AE, 0x20AD, 0x20AE, 0x8016, 0x18AD,
+  0x0002, 0x00F7, 0x18CE, 0x8004, 0x18AD, 0x0008, 0x00F9, 0x0119, 0x0119, 0x0139, 0x0119, 0x011A, 0x00F7, 0x18AE, 0x8004, 0x18AD,
+  0x0002, 0x20CD, 0x18AE, 0x8029, 0x18AD, 0x0015, 0x20AD, 0xD315, 0xD315, 0xD314, 0xC5FB, 0xC79F, 0xC79E, 0xC7BF, 0xC7BF, 0xC79E,
+  0xC79E, 0xC7BF, 0xC79F, 0xBF9E, 0xBFBF, 0xBFBE, 0xB67C, 0x8A53, 0x8971, 0xA131, 0xA112, 0x800B, 0xA111, 0x0009, 0xA112, 0xA111,
+  0xA111, 0xA172, 0xB539, 0xBF9F, 0x9BF6, 0x8191, 0x9151, 0x800D, 0xA111, 0x0009, 0xA112, 0xA111, 0xA111, 0xAB15, 0xBF3D, 0xC79F,
+  0xC7BE, 0xC79F, 0xC79F, 0x8038, 0xC79E, 0x000A, 0xC79F, 0xC79E, 0xC79F, 0xC79E, 0xC79E, 0xC7BF, 0xC79F, 0xA4B8, 0x8191, 0x9151,
+  0x8005, 0xA111, 0x000A, 0xA112, 0xA111, 0xBDFB, 0xC79F, 0xC79E, 0xC7BE, 0xC79F, 0xACF9, 0x8191, 0x9171, 0x8003, 0xA111, 0x0006,
+  0xA112, 0xA111, 0xA131, 0xA111, 0xBF3E, 0xBFBF, 0x8003, 0xC79E, 0x0001, 0xC7BF, 0x8003, 0xC79E, 0x0001, 0xBFBF, 0x8003, 0xC79E,
+  0x000A, 0xBF9E, 0xC79F, 0xC79E, 0xBFBE, 0xC79E, 0xC6BD, 0xD355, 0xD2F5, 0xD315, 0xCB14, 0x8012, 0xD314, 0x8003, 0xD315, 0x0024,
+  0xD314, 0x007F, 0x007F, 0x00FF, 0x027F, 0x039F, 0x039F, 0x037F, 0x231D, 0x5259, 0x5A3A, 0x033F, 0x033F, 0x031F, 0x031F, 0x0699,
+  0x07F8, 0x07FA, 0x07FD, 0x07FF, 0x07FF, 0x363C, 0xB0D1, 0xB0F1, 0xB0D1, 0xB8D1, 0xB0D1, 0xB0D1, 0x4112, 0x38F1, 0x3911, 0x30F0,
+  0x30EF, 0x28EF, 0x28CF, 0x28CF, 0x8003, 0x20CE, 0x0003, 0x20AE, 0x20AD, 0x20AE, 0x8016, 0x18AD, 0x0008, 0x18AE, 0x18AD, 0x18CD,
+  0x18AD, 0x18AD, 0x20AD, 0x0915, 0x00F9, 0x8003, 0x0119, 0x0002, 0x00F7, 0x18CE, 0x8004, 0x18AD, 0x0003, 0x20CD, 0x18AD, 0x18CD,
+  0x802A, 0x18AD, 0x0004, 0xD2F4, 0xCAF4, 0xD2F4, 0xC65C, 0x8009, 0xBF9E, 0x0009, 0xBF7F, 0xB67C, 0x8A12, 0x8971, 0xA111, 0xA111,
+  0xA911, 0xA111, 0xA911, 0x8003, 0xA111, 0x0002, 0xA911, 0xA911, 0x8003, 0xA111, 0x0001, 0xA911, 0x8003, 0xA111, 0x0008, 0xA912,
+  0xA911, 0xA1F3, 0x8191, 0x9931, 0xA111, 0xA111, 0xA912, 0x8005, 0xA111, 0x8005, 0xA911, 0x8003, 0xA111, 0x0004, 0xA112, 0xA911,
+  0xAA54, 0xBF1D, 0x8040, 0xBF9E, 0x0006, 0xB79E, 0xBF9F, 0xA498, 0x8191, 0x9951, 0xA911, 0x8005, 0xA111, 0x0009, 0xA911, 0xB5FB,
+  0xBF9E, 0xBF9F, 0xBF9E, 0xBF9F, 0xA498, 0x8191, 0x9951, 0x8004, 0xA111, 0x0008, 0xA112, 0xA111, 0xA911, 0xB5FB, 0xBF7E, 0xBF9E,
+  0xBF9E, 0xBF9F, 0x800E, 0xBF9E, 0x0003, 0xBEBD, 0xD335, 0xCAF4, 0x8013, 0xD2F4, 0x0026, 0xCAF4, 0xD2F4, 0xD2F5, 0xCAF4, 0x007F,
+  0x007F, 0x00BF, 0x021F, 0x2ABD, 0x7A36, 0xB953, 0xC112, 0xC911, 0xC912, 0x0B3F, 0x035F, 0x035F, 0x033F, 0x05FA, 0x07F7, 0x07F9,
+  0x07FC, 0x07FE, 0x07FF, 0x2E3C, 0xB0D1, 0xB0F1, 0xB0F1, 0xB0D1, 0xB0D1, 0xA0F1, 0x68F1, 0x4111, 0x30F0, 0x30F0, 0x28EF, 0x28EF,
+  0x28CF, 0x8004, 0x20CE, 0x0003, 0x20AE, 0x18AD, 0x20AE, 0x8016, 0x18AD, 0x8004, 0x18AD, 0x0008, 0x20AD, 0x18AE, 0x18AE, 0x08F5,
+  0x0119, 0x0119, 0x08F5, 0x18AE, 0x8005, 0x18AD, 0x0002, 0x18AE, 0x18CD, 0x802B, 0x18AD, 0x8003, 0xD2D4, 0x0005, 0xBE5C, 0xB77E,
+  0xB79E, 0xB77E, 0xBF7E, 0x8003, 0xB77E, 0x0009, 0xB79E, 0xBF7E, 0xAE7B, 0x89F2, 0x8971, 0xA111, 0xA8F1, 0xA911, 0xA8F1, 0x8005,
+  0xA911, 0x0001, 0xA8F1, 0x8003, 0xA911, 0x0018, 0xA8F1, 0xA911, 0xA8F1, 0xA911, 0xA911, 0xA912, 0xA911, 0xA911, 0xA111, 0xA911,
+  0xA8F1, 0xA911, 0xA8F1, 0xA111, 0xA911, 0xA8F1, 0xA8F1, 0xA911, 0xA911, 0xA8F1, 0xA911, 0xA8F1, 0xA8F1, 0xA912, 0x8003, 0xA911,
+  0x0004, 0xA8F1, 0xA111, 0xAA34, 0xB71E, 0x803A, 0xBF7E, 0x000A, 0xB77E, 0xB77E, 0xBF7E, 0xB77E, 0xB77E, 0xBF7F, 0xB77E, 0x9C97,
+  0x8191, 0x9951, 0x8005, 0xA8F1, 0x0017, 0xA911, 0xA8F1, 0xB5DB, 0xBF7E, 0xB77E, 0xBF7E, 0xBF7E, 0xA478, 0x8191, 0x9951, 0xA911,
+  0xA8F1, 0xA8F1, 0xA911, 0xA911, 0xA8F1, 0xA911, 0xB5DB, 0xB77F, 0xB77E, 0xBF7E, 0xBF7E, 0xB77E, 0x8003, 0xBF7E, 0x000D, 0xB77E,
+  0xB77E, 0xBF7E, 0xB77E, 0xBF7E, 0xB77E, 0xBF7E, 0xBF7E, 0xB77E, 0xB77E, 0xBF7E, 0xBE9D, 0xCB75, 0x8016, 0xD2D4, 0x000C, 0xD2D5,
+  0x007F, 0x007F, 0x30BB, 0x9955, 0xC931, 0xC932, 0xC932, 0xC912, 0xC0F2, 0xC8F2, 0x32FC, 0x8003, 0x037F, 0x0015, 0x059B, 0x07F7,
+  0x07F9, 0x07FC, 0x07FE, 0x07FF, 0x2E3C, 0xB8D1, 0xB0D1, 0xB0D2, 0xB0D1, 0xB0F1, 0x98F1, 0xB0F1, 0x88F1, 0x3110, 0x30F0, 0x30F0,
+  0x28CF, 0x28CF, 0x28CE, 0x8003, 0x20CE, 0x0003, 0x20AE, 0x18AD, 0x20AE, 0x8016, 0x18AD, 0x803E, 0x18AD, 0x8003, 0xD2B4, 0x8009,
+  0xB77E, 0x0007, 0xB71D, 0x8A53, 0x8191, 0xA111, 0xA8F1, 0xB0F1, 0xA911, 0x8017, 0xA8F1, 0x0003, 0xA8F2, 0xA8F1, 0xB0F1, 0x800E,
+  0xA8F1, 0x0001, 0xB2F5, 0x8005, 0xB77E, 0x0001, 0xB75E, 0x8003, 0xB77E, 0x0007, 0xB75E, 0xB75E, 0xB77E, 0xB75E, 0xB77E, 0xB77E,
+  0xB75E, 0x800D, 0xB77E, 0x0002, 0xB75E, 0xB75E, 0x8015, 0xB77E, 0x0006, 0xB75E, 0xB77E, 0xB77E, 0xB75E, 0xB77E, 0xB75E, 0x8007,
+  0xB77E, 0x0003, 0x9C78, 0x8191, 0x9951, 0x8007, 0xA8F1, 0x0001, 0xB5DB, 0x8004, 0xB77E, 0x0003, 0x9C77, 0x8191, 0x9151, 0x8007,
+  0xA8F1, 0x0001, 0xB5DB, 0x8003, 0xB77E, 0x0003, 0xB75E, 0xB77E, 0xB75E, 0x8007, 0xB77E, 0x0001, 0xB75E, 0x8005, 0xB77E, 0x000C,
+  0xB75E, 0xB71D, 0xCB96, 0xD2B4, 0xD2B4, 0xCAB4, 0xD2B4, 0xCAB4, 0xD2B4, 0xCAB4, 0xD2B4, 0xCAB4, 0x8008, 0xD2B4, 0x0001, 0xCA94,
+  0x8003, 0xD2B4, 0x0017, 0xCAB4, 0x087E, 0x70F8, 0xC952, 0xC932, 0xC912, 0xC932, 0xC111, 0xC8F1, 0xC8F1, 0xC8D1, 0x331C, 0x03BF,
+  0x039F, 0x039F, 0x051B, 0x07D6, 0x07F7, 0x07FB, 0x07FE, 0x07FF, 0x2E3C, 0xB8D1, 0x8004, 0xB0D1, 0x000D, 0xA0F1, 0xB0F1, 0xB0D1,
+  0x50F0, 0x30F0, 0x30EF, 0x28CF, 0x28CF, 0x20CF, 0x20CE, 0x20CE, 0x20AE, 0x20AE, 0x8018, 0x18AD, 0x803E, 0x18AD, 0x0003, 0xD294,
+  0xD294, 0xCA94, 0x8005, 0xAF5E, 0x000D, 0xB75E, 0xAF5E, 0xAF5E, 0xB75E, 0x9416, 0x8991, 0x9951, 0xB0F1, 0xA8F1, 0xB0F1, 0xA8F1,
+  0xB0F1, 0xA8F1, 0x8003, 0xB0F1, 0x0001, 0xA8F1, 0x800A, 0xB0F1, 0x0004, 0xA8F1, 0xA8F1, 0xB0F1, 0xA8F1, 0x8003, 0xB0F1, 0x000C,
+  0xB0D1, 0xB0F1, 0xB0F1, 0xB0F2, 0xA8F1, 0xB0F1, 0xB0F1, 0xB0D1, 0xB0F1, 0xB0F2, 0xA8F1, 0xB0F2, 0x8003, 0xB0F1, 0x0007, 0xA8F1,
+  0xB0F1, 0xB0F1, 0xACF9, 0xAF5E, 0xAF5E, 0xB75E, 0x8006, 0xAF5E, 0x0001, 0xAF7E, 0x8003, 0xAF5E, 0x8003, 0xB75E, 0x0004, 0xAF5E,
+  0xB75E, 0xAF5E, 0xB75E, 0x8004, 0xAF5E, 0x8003, 0xB75E, 0x8003, 0xAF5E, 0x0002, 0xB75E, 0xB75E, 0x800B, 0xAF5E, 0x0004, 0xB75E,
+  0xAF5E, 0xAF5E, 0xB75E, 0x8003, 0xAF5E, 0x0002, 0xB75E, 0xB75E, 0x8003, 0xAF5E, 0x0001, 0xB75E, 0x8004, 0xAF5E, 0x0007, 0xAF5D,
+  0xB75E, 0xAF5E, 0xAF5E, 0x9C77, 0x8191, 0x9951, 0x8007, 0xB0F1, 0x0001, 0xADBB, 0x8004, 0xB75E, 0x0003, 0x9C78, 0x8991, 0x9951,
+  0x8007, 0xB0F1, 0x0003, 0xB5BB, 0xB75E, 0xB75E, 0x8005, 0xAF5E, 0x0003, 0xB75E, 0xAF5E, 0xAF5E, 0x8003, 0xB75E, 0x0001, 0xAF5E,
+  0x8003, 0xB75E, 0x000E, 0xAF5E, 0xAF5E, 0xB75E, 0xAF5E, 0xAF1D, 0xCB75, 0xCA93, 0xD294, 0xCA74, 0xCA94, 0xCA74, 0xD274, 0xCA74,
+  0xD294, 0x8008, 0xCA94, 0x0006, 0xD294, 0xCA93, 0xCA94, 0xD293, 0xCA74, 0x9915, 0x8003, 0xC932, 0x0013, 0xC912, 0xC111, 0xC8F2,
+  0xC0F2, 0xC8D1, 0xC8D1, 0x333C, 0x03FF, 0x03DF, 0x03BF, 0x04DC, 0x07D6, 0x07F7, 0x07FB, 0x07FE, 0x07FF, 0x2E3C, 0xB0D1, 0xB0D1,
+  0x8003, 0xB0F1, 0x000D, 0xA8F1, 0xB0F1, 0xB0F1, 0x90F1, 0x30F0, 0x28F0, 0x28CF, 0x28CF, 0x20CF, 0x20CE, 0x20CE, 0x20AE, 0x20AE,
+  0x8018, 0x18AD, 0x803E, 0x18AD, 0x000E, 0xD274, 0xD274, 0xCA53, 0xAF5E, 0xAF3E, 0xAF5E, 0xAF3E, 0xAF3D, 0xAF5D, 0xAF3D, 0xAF3E,
+  0xA69C, 0x8191, 0x8191, 0x8003, 0xB0F1, 0x0018, 0xB0D1, 0xB0F2, 0xB0D1, 0xB0D1, 0xB0F2, 0xB0F1, 0xB0F1, 0xAA13, 0xB418, 0xA438,
+  0x9AB4, 0x9931, 0xA8F1, 0xB0F1, 0xB0F2, 0xB0F1, 0xB0D1, 0xB0F1, 0xB0D1, 0xB0F1, 0xB0D1, 0xB0D1, 0xB0F1, 0xB0D1, 0x8004, 0xB0F1,
+  0x0010, 0xAA74, 0xAC78, 0xACF9, 0x9B35, 0x9931, 0xA8F1, 0xB0F1, 0xB0F2, 0xB0F1, 0xB0D1, 0xB0D1, 0xB0F1, 0xB0F2, 0xB0D1, 0xB0F1,
+  0xA9B3, 0x8004, 0xAF3E, 0x0004, 0xAF5E, 0xAF3E, 0xAF3E, 0xAF5E, 0x8003, 0xAF3E, 0x000E, 0xAF5E, 0xAF3E, 0xAF3E, 0xAF5E, 0xAF3E,
+  0xAF3E, 0xAF3D, 0xAF3D, 0xAF3E, 0xAF3E, 0xAF5E, 0xAF3E, 0xAF3D, 0xAF3D, 0x8004, 0xAF3E, 0x0004, 0xAF5E, 0xAF3E, 0xAF3E, 0xAF5E,
+  0x8008, 0xAF3E, 0x0002, 0xAF3D, 0xAF5E, 0x8004, 0xAF3E, 0x0001, 0xAF5E, 0x8003, 0xAF3E, 0x0001, 0xAF5E, 0x8005, 0xAF3E, 0x0003,
+  0xAF5E, 0xAF3E, 0xAF5E, 0x8004, 0xAF3E, 0x0005, 0x9C77, 0x8191, 0x9931, 0xB0F1, 0xB0D1, 0x8005, 0xB0F1, 0x000B, 0xADBB, 0xAF3E,
+  0xAF3E, 0xAF5D, 0xAF3E, 0x9477, 0x8191, 0x9951, 0xB0D1, 0xB0D1, 0xB0F1, 0x8004, 0xB0D1, 0x0005, 0xADBA, 0xAF3E, 0xAF5E, 0xAF3E,
+  0xAF5E, 0x8003, 0xAF3E, 0x0001, 0xAF3D, 0x8003, 0xAF5E, 0x0002, 0xAF3D, 0xAF3D, 0x8004, 0xAF3E, 0x0001, 0xAF5E, 0x8004, 0xAF3E,
+  0x0009, 0xAEFD, 0xCB56, 0xCA53, 0xCA74, 0xD253, 0xD274, 0xD274, 0xD273, 0xCA73, 0x8008, 0xD274, 0x0005, 0xD254, 0xCA74, 0xCA54,
+  0xCA54, 0xCA74, 0x8003, 0xC932, 0x8003, 0xC912, 0x0001, 0xC0F1, 0x8003, 0xC8D1, 0x000D, 0x335C, 0x041F, 0x03FF, 0x03FF, 0x047D,
+  0x0795, 0x07F6, 0x07FA, 0x07FE, 0x07FF, 0x2E3C, 0xB0F1, 0xB0D1, 0x8003, 0xB0F1, 0x0008, 0xA8F1, 0xB0F1, 0xB0D1, 0xB0F1, 0x40F0,
+  0x28CF, 0x28EF, 0x28CE, 0x8003, 0x20CE, 0x0004, 0x20AE, 0x20AE, 0x18AD, 0x20AE, 0x8016, 0x18AD, 0x803E, 0x18AD, 0x8003, 0xCA53,
+  0x8004, 0xA73E, 0x8004, 0xA73D, 0x0006, 0x9457, 0x8191, 0x9931, 0xB8D1, 0xB0D1, 0xB8D1, 0x8003, 0xB0D1, 0x000E, 0xB0F1, 0xB0D1,
+  0xB1B3, 0xAD9A, 0xAF3D, 0xAF3D, 0xA73D, 0xA73D, 0x9DDA, 0x89D1, 0x9951, 0xB0F1, 0xB0D1, 0xB0F1, 0x8003, 0xB0D1, 0x0002, 0xB8D1,
+  0xB8D1, 0x8003, 0xB0D1, 0x0016, 0xB0F1, 0xB213, 0xAD9B, 0xA73E, 0xA73D, 0xAF3E, 0xAF3E, 0x9DDA, 0x81F2, 0x9171, 0xB0F1, 0xB0F1,
+  0xB0D1, 0xB0F1, 0xB0D1, 0xB0D1, 0xB8D1, 0xB8D2, 0xB0F1, 0xAD39, 0xA73D, 0xA73E, 0x8005, 0xA73D, 0x0001, 0xA73E, 0x8003, 0xA73D,
+  0x0001, 0xAF3D, 0x8003, 0xA73D, 0x0011, 0xA73E, 0xA73E, 0xA73D, 0xAF3D, 0xA73D, 0xA73D, 0xA73E, 0xAF3D, 0xA73E, 0xA73E, 0xA73D,
+  0xAF3D, 0xA73D, 0xA73D, 0xA73E, 0xAF3E, 0xAF1E, 0x8008, 0xA73E, 0x0005, 0xAF3E, 0xA73E, 0xA73D, 0xAF3E, 0xA73E, 0x8003, 0xA73D,
+  0x0001, 0xAF3D, 0x8003, 0xA73E, 0x000E, 0xA73D, 0xAF3D, 0xA73D, 0xAF3D, 0xA73E, 0xA73E, 0xAF3D, 0xA73E, 0xA73D, 0xA73D, 0xA73E,
+  0x9478, 0x8191, 0x9931, 0x8006, 0xB0D1, 0x0005, 0xB8D1, 0xAD9A, 0xA73E, 0xA73D, 0xA73E, 0x8003, 0xA73D, 0x0001, 0xAF3D, 0x8005,
+  0xA73D, 0x0001, 0xAF3D, 0x8003, 0xA73D, 0x0002, 0xAF3E, 0xA73E, 0x8003, 0xA73D, 0x0009, 0xAF3D, 0xAF3E, 0xA73D, 0xAF3D, 0xAF3E,
+  0xA73D, 0xA73D, 0xAF3D, 0xA73E, 0x8003, 0xAF3D, 0x0007, 0xA73E, 0xA73D, 0xA73D, 0xAF3D, 0xA73D, 0xAEDD, 0xC376, 0x8004, 0xCA53,
+  0x0001, 0xCA33, 0x8009, 0xCA53, 0x001A, 0xD233, 0xCA53, 0xD253, 0xCA53, 0xCA53, 0x309C, 0x005F, 0x58B9, 0xC912, 0xC111, 0xC8F1,
+  0xC8D1, 0xC8D1, 0xC0D1, 0xC0D1, 0x337C, 0x045F, 0x041F, 0x041F, 0x045E, 0x0775, 0x07F5, 0x07FA, 0x07FE, 0x07FF, 0x2E3C, 0x8003,
+  0xB0F1, 0x0011, 0xB0D1, 0xB0F1, 0xA8F1, 0xB0F1, 0xB0F1, 0xB0D1, 0x80F1, 0x28EF, 0x28CF, 0x28CF, 0x20CF, 0x20CE, 0x20CE, 0x20AE,
+  0x20AE, 0x18AD, 0x20AE, 0x8016, 0x18AD, 0x803E, 0x18AD, 0x0003, 0xCA13, 0xCA33, 0xCA13, 0x8005, 0xA71D, 0x8003, 0xA73D, 0x0003,
+  0x8A53, 0x8191, 0xA8F1, 0x8003, 0xB8D1, 0x0001, 0xB0D1, 0x8003, 0xB8D1, 0x0004, 0xB213, 0xA6BD, 0xA71D, 0xA73E, 0x8004, 0xA71D,
+  0x0004, 0x9E1B, 0x81F1, 0x9171, 0xB0F1, 0x8009, 0xB8D1, 0x0002, 0xB1F3, 0xA6BD, 0x8004, 0xA71D, 0x0005, 0xA73D, 0xA71D, 0x9E1B,
+  0x89F2, 0x8991, 0x8006, 0xB8D1, 0x0003, 0xB0D1, 0xB8D1, 0xB336, 0x800A, 0xA71D, 0x8003, 0xA73D, 0x0009, 0xA71D, 0xA71D, 0xA73D,
+  0xA71D, 0xA71E, 0xA71D, 0xA71D, 0xA73D, 0xA73E, 0x8003, 0xA71D, 0x0007, 0xA73E, 0xA71D, 0xA73E, 0xA73D, 0xA71D, 0xA71D, 0xA73D,
+  0x800A, 0xA71D, 0x8003, 0xA73D, 0x0004, 0xA73E, 0xA71D, 0xA73D, 0xA73D, 0x8006, 0xA71D, 0x000B, 0xA73D, 0xA71D, 0xA71D, 0xA73E,
+  0xA73D, 0xA73D, 0xA71D, 0xA71D, 0x9477, 0x8191, 0x9931, 0x8007, 0xB8D1, 0x0008, 0xA59A, 0xA71D, 0xA73D, 0xA73E, 0xA71D, 0xA71D,
+  0xA71E, 0xA73D, 0x8008, 0xA71D, 0x0007, 0xA73D, 0xA73D, 0xA71E, 0xA71D, 0xA73D, 0xA71D, 0xA73D, 0x8006, 0xA71D, 0x0007, 0xA73D,
+  0xA73D, 0xA71D, 0xA73D, 0xA73D, 0xA71D, 0xA73E, 0x8005, 0xA71D, 0x0004, 0xBBF7, 0xCA13, 0xCA33, 0xCA13, 0x800A, 0xCA33, 0x000B,
+  0xCA13, 0xCA13, 0xCA14, 0xD233, 0xCA33, 0x003F, 0x003F, 0x005F, 0x78D7, 0xC0F2, 0xC8F1, 0x8003, 0xC0D1, 0x000E, 0xC8B1, 0x4B1A,
+  0x047F, 0x045F, 0x043F, 0x045F, 0x0735, 0x07F4, 0x07F9, 0x07FE, 0x07FF, 0x2E3C, 0xB0D1, 0xB0F1, 0x8003, 0xB0D1, 0x0008, 0xA8F1,
+  0xB0F1, 0xB0D1, 0xB0F1, 0xA0F1, 0x28CF, 0x28EF, 0x28CF, 0x8003, 0x20CE, 0x0004, 0x20AE, 0x20AE, 0x18AD, 0x20AE, 0x8016, 0x18AD,
+  0x803E, 0x18AD, 0x8003, 0xCA13, 0x000A, 0x9F1D, 0x9F1D, 0xA71D, 0x9F1D, 0x9F1D, 0xA71D, 0x9F1D, 0x9F1D, 0x8191, 0x8191, 0x8008,
+  0xB8D1, 0x0004, 0xA5DB, 0x9F1D, 0x9F1D, 0x9EFD, 0x8003, 0x9F1D, 0x0008, 0xA6FD, 0x9F1D, 0x94F9, 0x8191, 0x9931, 0xB8D1, 0xB8D1,
+  0xB8B1, 0x8005, 0xB8D1, 0x0002, 0xB8B1, 0xA5DB, 0x8004, 0x9F1D, 0x0001, 0xA6FD, 0x8003, 0x9F1D, 0x0003, 0x94F9, 0x8191, 0x9931,
+  0x8007, 0xB8D1, 0x0001, 0xB932, 0x8003, 0x9F1D, 0x0001, 0x9F1E, 0x8005, 0x9F1D, 0x0017, 0x9E1B, 0x9457, 0x92D4, 0xA1F3, 0xA911,
+  0xB0F1, 0xB0F1, 0xA911, 0xB274, 0xB254, 0xB254, 0xABF7, 0xA5DB, 0xA6FD, 0xA6FD, 0xA71D, 0xA71D, 0x9F1D, 0x9F1D, 0xA6FD, 0x9F1D,
+  0x9F1D, 0xA71D, 0x800B, 0x9F1D, 0x000D, 0x9E7C, 0x9498, 0x8B14, 0x9A13, 0xA131, 0xA912, 0xB0F1, 0xA8F1, 0xB255, 0xB274, 0xB254,
+  0xAB97, 0xAD1A, 0x8004, 0x9F1D, 0x0006, 0xA71D, 0x9F1D, 0xA71D, 0x9457, 0x8191, 0xA131, 0x8007, 0xB8D1, 0x0008, 0xA57A, 0x9F1D,
+  0xA71D, 0x9F1D, 0xA71D, 0x9E7C, 0x9DBA, 0xA59A, 0x8007, 0xA57A, 0x0001, 0xA69C, 0x8003, 0x9F1D, 0x0001, 0xA71D, 0x8007, 0x9F1D,
+  0x0011, 0x9E5C, 0x94B8, 0x8AF4, 0x9A13, 0xA131, 0xA8F1, 0xB0F1, 0xB0F1, 0xB932, 0xB274, 0xB254, 0xB336, 0xACB9, 0xA63C, 0x9F1D,
+  0xBBF7, 0xC9F3, 0x8003, 0xCA13, 0x8008, 0xC9F3, 0x8005, 0xCA13, 0x001B, 0x003F, 0x003F, 0x005F, 0x58B9, 0xC0F1, 0xC0D1, 0xC8D1,
+  0xC8B2, 0xC0B1, 0xC0B1, 0x62B8, 0x04BF, 0x047F, 0x047F, 0x045F, 0x0715, 0x07F4, 0x07F9, 0x07FD, 0x07FF, 0x2E3C, 0xB0D1, 0xB0F1,
+  0xB0D1, 0xB0D1, 0xA8F1, 0xA8F1, 0x8004, 0xB0F1, 0x0003, 0x58F0, 0x28CF, 0x28CE, 0x8003, 0x20CE, 0x8004, 0x20AE, 0x8016, 0x18AD,
+  0x803E, 0x18AD, 0x8003, 0xC9D3, 0x8007, 0x9EFD, 0x000B, 0x959A, 0x8191, 0x9151, 0xC0B1, 0xB8D1, 0xC0B1, 0xB8D1, 0xC0D1, 0xB8D1,
+  0xB8D1, 0xB2B5, 0x800A, 0x9EFD, 0x0002, 0x8252, 0x8191, 0x8004, 0xB8D1, 0x0005, 0xC0B1, 0xC0D1, 0xB8D1, 0xC0D1, 0xB1F3, 0x8005,
+  0x9EFD, 0x0001, 0x9F1D, 0x8004, 0x9EFD, 0x0005, 0x8A93, 0x8191, 0xB8D1, 0xB8D1, 0xC0D1, 0x8004, 0xB8D1, 0x0002, 0xC0B1, 0xA63C,
+  0x8006, 0x9EFD, 0x0004, 0x94F8, 0x8A53, 0x9171, 0xB0F1, 0x8003, 0xB8D1, 0x000A, 0xB8B1, 0xB8B1, 0xC0B1, 0xC0D1, 0xC0D1, 0xB8D1,
+  0xC0D1, 0xB8B1, 0xB992, 0xACB9, 0x8011, 0x9EFD, 0x0007, 0x9E5C, 0x8B96, 0x8991, 0xA131, 0xB8D1, 0xB8D1, 0xC0B1, 0x8006, 0xB8D1,
+  0x0005, 0xC0B1, 0xB8D1, 0xB932, 0xABF7, 0x9E9C, 0x8004, 0x9EFD, 0x000B, 0x9437, 0x8191, 0xA131, 0xB8D1, 0xC0B1, 0xB8D1, 0xC0B1,
+  0xC0B1, 0xB8D1, 0xB8D1, 0xA57A, 0x8004, 0x9EFD, 0x000B, 0x9437, 0x8191, 0xA131, 0xB8D1, 0xC0B1, 0xB8D1, 0xB8D1, 0xC0B1, 0xB8D1,
+  0xB8D1, 0xA57A, 0x8009, 0x9EFD, 0x0015, 0x9E9C, 0x8B96, 0x8971, 0xA131, 0xB8D1, 0xB8D1, 0xC0B1, 0xB8D1, 0xC0B1, 0xC0D1, 0xB8D1,
+  0xB8D1, 0xC0D1, 0xB8D1, 0xB8D1, 0xC0D1, 0xB335, 0xA63C, 0xBBD7, 0xC9D3, 0xC9F3, 0x8009, 0xC9D3, 0x001A, 0xC9F3, 0xC9D3, 0xC9D3,
+  0xC9F3, 0xC9D3, 0x001F, 0x003F, 0x003F, 0x00DF, 0x88F6, 0xC8D1, 0xC0B1, 0xC8B1, 0xC0B1, 0xC8B1, 0x62D9, 0x04FF, 0x04BF, 0x049F,
+  0x047F, 0x06B6, 0x07F3, 0x07F8, 0x07FD, 0x07FF, 0x2E3C, 0x8003, 0xB0D1, 0x0002, 0xB0F1, 0x98F2, 0x8003, 0xB0F1, 0x0005, 0x78F0,
+  0x90F1, 0x80D1, 0x28CF, 0x28CE, 0x8003, 0x20CE, 0x8004, 0x20AE, 0x8016, 0x18AD, 0x803D, 0x18AD, 0x0001, 0x18AE, 0x8003, 0xC9B3,
+  0x000C, 0x9EDD, 0x96FD, 0x9EDD, 0x96FD, 0x9EFC, 0x96FD, 0x96FD, 0x9599, 0x8991, 0x9171, 0xC0B1, 0xC0D1, 0x8004, 0xC0B1, 0x0037,
+  0xC0D1, 0xABD7, 0x9EFC, 0x96FD, 0x96FD, 0x96DD, 0x96FD, 0x9EFD, 0x9EDD, 0x96FD, 0x9EDD, 0x9EFD, 0x8C37, 0x8191, 0xA111, 0xC0B1,
+  0xC0B1, 0xC0D1, 0xC0B1, 0xC0B1, 0xC0D1, 0xC0B1, 0xAB76, 0x9EDD, 0x9EFD, 0x9EFD, 0x9EDD, 0x9EDD, 0x96DD, 0x9EFD, 0x9EDD, 0x96FD,
+  0x9EDD, 0x8C37, 0x8191, 0xA131, 0xC0D1, 0xC0B1, 0xC0B1, 0xC0D1, 0xC0B1, 0xC0B1, 0xC0D1, 0xA55A, 0x96FD, 0x9EDD, 0x9EFD, 0x96FD,
+  0x963B, 0x8AF4, 0x8991, 0xA911, 0xC0B1, 0xC0B1, 0xC0D1, 0x8004, 0xC0B1, 0x0001, 0xC0D1, 0x8004, 0xC0B1, 0x000B, 0xC0D1, 0xC0B1,
+  0xC0B1, 0xB992, 0xA55A, 0x9EDD, 0x9EFC, 0x96FD, 0x9EDD, 0x96FD, 0x9EFD, 0x8008, 0x96FD, 0x000B, 0x94F9, 0x81F1, 0x9171, 0xB8D2,
+  0xC0B1, 0xC0D1, 0xC0D1, 0xC0B1, 0xC0D1, 0xC0B1, 0xC0D1, 0x8007, 0xC0B1, 0x0008, 0xB992, 0x9DBB, 0x96FD, 0x9EDD, 0x96FD, 0x8C37,
+  0x8191, 0xA131, 0x8007, 0xC0B1, 0x0008, 0xA55A, 0x9EDD, 0x96FD, 0x96FD, 0x9EFD, 0x8C37, 0x8191, 0xA131, 0x8007, 0xC0B1, 0x000D,
+  0xA55A, 0x96FD, 0x9EFD, 0x96FD, 0x9EFD, 0x9EFD, 0x96FD, 0x9EFD, 0x96FD, 0x9539, 0x81F1, 0x9171, 0xB0D1, 0x8003, 0xC0B1, 0x0004,
+  0xC0D1, 0xC0B1, 0xC0B1, 0xC0D1, 0x8006, 0xC0B1, 0x0004, 0xB8D1, 0xB911, 0xACFA, 0xB458, 0x800B, 0xC9B3, 0x000B, 0xC9D2, 0xC9D3,
+  0xC9D3, 0xC9B3, 0x001F, 0x003F, 0x003F, 0x00BF, 0x311C, 0xC0D1, 0xC8B1, 0x8003, 0xC0B1, 0x0018, 0x6278, 0x053F, 0x04FF, 0x04BF,
+  0x049F, 0x0696, 0x07F2, 0x07F7, 0x07FC, 0x07FF, 0x2E3C, 0xB0F1, 0xB0D1, 0xB0F1, 0xB0F1, 0x8912, 0xB0F1, 0xB0F1, 0xB0D1, 0x48F0,
+  0x28F0, 0x28EF, 0x28CF, 0x28CF, 0x8003, 0x20CE, 0x8004, 0x20AE, 0x8016, 0x18AD, 0x8017, 0x18AD, 0x0001, 0x18CD, 0x8012, 0x18AD,
+  0x0008, 0x18AE, 0x18AD, 0x18AD, 0x20AD, 0x18AD, 0x20AD, 0x18AD, 0x18AE, 0x800C, 0x18AD, 0x0004, 0xC993, 0xC993, 0xC992, 0x96DC,
+  0x8006, 0x96DD, 0x0003, 0x8D79, 0x8191, 0x9151, 0x8007, 0xC0B1, 0x0001, 0xABD7, 0x800A, 0x96DD, 0x0003, 0x8C37, 0x8191, 0xA131,
+  0x8007, 0xC0B1, 0x0001, 0xABD7, 0x800A, 0x96DD, 0x0003, 0x8C37, 0x8191, 0xA131, 0x8007, 0xC0B1, 0x0001, 0x9D5A, 0x8003, 0x96DD,
+  0x0007, 0x95DA, 0x89F2, 0x8971, 0xB8D1, 0xC0B1, 0xC0B1, 0xC8B1, 0x800F, 0xC0B1, 0x0001, 0xA499, 0x8005, 0x96DD, 0x0001, 0x96DC,
+  0x8006, 0x96DD, 0x0003, 0x8C37, 0x8191, 0x9931, 0x800C, 0xC0B1, 0x0001, 0xC8B1, 0x8005, 0xC0B1, 0x0006, 0xA499, 0x96DC, 0x96DD,
+  0x8C37, 0x8191, 0xA111, 0x8007, 0xC0B1, 0x0001, 0x9D5A, 0x8004, 0x96DD, 0x0003, 0x8C37, 0x8191, 0xA131, 0x8007, 0xC0B1, 0x0001,
+  0x9D5A, 0x8007, 0x96DD, 0x0003, 0x8CD8, 0x8191, 0x9951, 0x8006, 0xC0B1, 0x0001, 0xC8B1, 0x8003, 0xC0B1, 0x0001, 0xC8B1, 0x8007,
+  0xC0B1, 0x0007, 0xAC79, 0xACF9, 0xC992, 0xC993, 0xC9B2, 0xC992, 0xC992, 0x8003, 0xC993, 0x8003, 0xC992, 0x8003, 0xC993, 0x8003,
+  0x003F, 0x0004, 0x00BF, 0x011F, 0xC0B1, 0xC8B1, 0x8003, 0xC0B1, 0x0019, 0x79D6, 0x051F, 0x051F, 0x04FF, 0x04BF, 0x0638, 0x07F1,
+  0x07F7, 0x07FC, 0x07FF, 0x2E3C, 0xB0F1, 0xB0F2, 0xB0F1, 0xB0F1, 0x80F2, 0xB0F1, 0xB0F1, 0xB0F2, 0x3110, 0x30F0, 0x28CF, 0x28EF,
+  0x20CE, 0x28CF, 0x8003, 0x20CE, 0x0002, 0x20AD, 0x20AE, 0x8017, 0x18AD, 0x8014, 0x18AD, 0x0002, 0x18AE, 0x18CD, 0x8003, 0x18AD,
+  0x0001, 0x18CD, 0x800C, 0x18AD, 0x0007, 0x20AE, 0x18AD, 0x10D2, 0x08F3, 0x10F3, 0x10D2, 0x18CD, 0x8011, 0x18AD, 0x8003, 0xC972,
+  0x0003, 0x8EBC, 0x8EBD, 0x8EBD, 0x8003, 0x8EBC, 0x0004, 0x8EBD, 0x8D7A, 0x8191, 0x9151, 0x8005, 0xC0B1, 0x0004, 0xC8B1, 0xC0B1,
+  0xABB7, 0x8EBD, 0x8008, 0x8EBC, 0x0006, 0x8EBD, 0x8C37, 0x8191, 0xA131, 0xC0B1, 0xC8B1, 0x8003, 0xC0B1, 0x0003, 0xC8B1, 0xC0B1,
+  0xABB7, 0x8003, 0x8EBC, 0x000A, 0x8EDC, 0x8EBC, 0x8EDD, 0x8EBC, 0x8EBC, 0x8EBD, 0x8EBC, 0x8C37, 0x8191, 0xA131, 0x8007, 0xC0B1,
+  0x0032, 0x9D39, 0x8EBD, 0x8EDD, 0x8DBA, 0x81F2, 0x9171, 0xC0B1, 0xC0B1, 0xC8B1, 0xC0B1, 0xC0D1, 0xC0B1, 0xC8B1, 0xC8B2, 0xC0B1,
+  0xC8B2, 0xC8B1, 0xC8B1, 0xC0D1, 0xC0B1, 0xC0D1, 0xC0D1, 0xC8B1, 0xC0B1, 0xC0B1, 0xC8B1, 0xC0B1, 0xA437, 0x8EBC, 0x8EDD, 0x8EBC,
+  0x8EBD, 0x8EBC, 0x8EBC, 0x8EBD, 0x8EBC, 0x8EBD, 0x8EBD, 0x8CD8, 0x8191, 0xA131, 0xC0B1, 0xC0B1, 0xC8B1, 0xC0B1, 0xC0B1, 0xC8B2,
+  0xC8B1, 0xC0B1, 0xC8B1, 0x8003, 0xC0B1, 0x0002, 0xC8B1, 0xC8B1, 0x8003, 0xC0B1, 0x000B, 0xC8B1, 0xC0B1, 0xC8B1, 0xA4D9, 0x8EBC,
+  0x8C37, 0x8191, 0xA131, 0xC0B1, 0xC8B1, 0xC0D1, 0x8003, 0xC0B1, 0x0002, 0xC8B1, 0x9D3A, 0x8004, 0x8EBC, 0x0003, 0x8C37, 0x8191,
+  0xA131, 0x8007, 0xC0B1, 0x0004, 0x9D5A, 0x8EBC, 0x8EBC, 0x8EDC, 0x8003, 0x8EBC, 0x000A, 0x8CD8, 0x8191, 0x9951, 0xC8B1, 0xC0B1,
+  0xC8B1, 0xC8B2, 0xC8B1, 0xC0B1, 0xC8B1, 0x8003, 0xC0B1, 0x0001, 0xC0D1, 0x8005, 0xC0B1, 0x8003, 0xC8B1, 0x0003, 0xC8D1, 0xA478,
+  0xA4D9, 0x800D, 0xC972, 0x0005, 0x003F, 0x003F, 0x001F, 0x009F, 0x00DF, 0x8005, 0xC0B1, 0x0018, 0x9174, 0x049F, 0x057F, 0x051F,
+  0x04FF, 0x0619, 0x07F1, 0x07F6, 0x07FC, 0x07FF, 0x35BB, 0xB0F1, 0xB0D1, 0xB0F1, 0xB0F1, 0x6912, 0xB0F1, 0xB0F1, 0x98F1, 0x30F0,
+  0x30F0, 0x28EF, 0x28CF, 0x28EF, 0x8004, 0x20CE, 0x0002, 0x20AD, 0x20AE, 0x8017, 0x18AD, 0x801A, 0x18AD, 0x0001, 0x18AE, 0x800B,
+  0x18AD, 0x000E, 0x18AE, 0x00F7, 0x011A, 0x00FA, 0x011A, 0x0119, 0x08F7, 0x18CE, 0x18AD, 0x20AD, 0x18AE, 0x18AE, 0x18AD, 0x18AE,
+  0x8008, 0x18AD, 0x0002, 0x20AD, 0x18AD, 0x8003, 0xC952, 0x8007, 0x8EBC, 0x0005, 0x8D59, 0x8191, 0x9171, 0xC8F2, 0xC8F1, 0x8003,
+  0xC8F2, 0x0003, 0xC8F1, 0xC8F2, 0xABD7, 0x800A, 0x8EBC, 0x0005, 0x8C36, 0x8191, 0xA931, 0xC8F2, 0xC8F1, 0x8004, 0xC8F2, 0x0002,
+  0xC0F2, 0xABB7, 0x800A, 0x8EBC, 0x0013, 0x8437, 0x8191, 0xA951, 0xC8F1, 0xC8F1, 0xC8F2, 0xC8F1, 0xC8F1, 0xC8F2, 0xC8F1, 0x9D3A,
+  0x8EBC, 0x8E1B, 0x81F2, 0x8971, 0xB912, 0xC8F1, 0xC8F1, 0xC8F2, 0x8003, 0xC8F1, 0x0003, 0xC8F2, 0xC8D1, 0xC112, 0x8003, 0xC8F2,
+  0x000B, 0xC8D1, 0xC8F2, 0xC8D1, 0xC8F2, 0xC0F1, 0xC8F1, 0xC8F2, 0xC8F1, 0xC8F2, 0xC0F1, 0xA498, 0x8008, 0x8EBC, 0x0012, 0x8DBA,
+  0x8991, 0x8991, 0xC0F1, 0xC8F2, 0xC0F2, 0xC8F1, 0xC8F2, 0xC8F1, 0xC0F1, 0xC8F2, 0xC8F1, 0xC8F2, 0xC0F2, 0xC8F1, 0xC0F1, 0xC8F2,
+  0xC8F1, 0x8003, 0xC8F2, 0x0008, 0xC8F1, 0xC8F1, 0xC0F2, 0xC132, 0x8E5C, 0x8C17, 0x8191, 0xA931, 0x8004, 0xC8F2, 0x0004, 0xC8F1,
+  0xC8F2, 0xC8F2, 0x9D59, 0x8004, 0x8EBC, 0x000B, 0x8C17, 0x8191, 0xA951, 0xC8F1, 0xC8F1, 0xC8F2, 0xC8F1, 0xC8F1, 0xC8F2, 0xC8F1,
+  0x9D5A, 0x8004, 0x8EBC, 0x0005, 0x8EBD, 0x8DBA, 0x81F2, 0x8991, 0xC111, 0x8003, 0xC8F1, 0x0015, 0xC0F2, 0xC8F1, 0xC8F1, 0xC0F2,
+  0xC8D2, 0xC8F1, 0xC8F2, 0xC0F1, 0xC0F1, 0xC8F2, 0xC0F1, 0xC8F1, 0xC8F2, 0xC8F2, 0xC8F1, 0xC8F1, 0xC8F2, 0xC152, 0x95FB, 0xA4B8,
+  0xC152, 0x8003, 0xC952, 0x0001, 0xC972, 0x8007, 0xC952, 0x8003, 0x001F, 0x0003, 0x007F, 0x00DF, 0x68B7, 0x8004, 0xC0B1, 0x001E,
+  0xA8F3, 0x041F, 0x057F, 0x053F, 0x051F, 0x05F9, 0x07F0, 0x07F6, 0x07FC, 0x07FF, 0x5C78, 0xB0F1, 0xB0D1, 0xB0F1, 0xB0F1, 0x5912,
+  0xB0F1, 0xB0F1, 0x90F1, 0x30F0, 0x30EF, 0x30EF, 0x28CF, 0x28CE, 0x20CE, 0x20CE, 0x20AE, 0x20CE, 0x20AD, 0x20AE, 0x8017, 0x18AD,
+  0x8016, 0x18AD, 0x0001, 0x18AE, 0x800F, 0x18AD, 0x0009, 0x08F5, 0x0119, 0x0119, 0x0117, 0x00F7, 0x0119, 0x0119, 0x08F5, 0x18AE,
+  0x8004, 0x18AD, 0x0001, 0x18AE, 0x800A, 0x18AD, 0x8003, 0xC932, 0x8007, 0x8EBC, 0x000B, 0x8D79, 0x8191, 0x9171, 0xC132, 0xC131,
+  0xC912, 0xC912, 0xC132, 0xC911, 0xC912, 0xABF7, 0x8009, 0x8EBC, 0x000C, 0x96BC, 0x8C36, 0x8191, 0xA951, 0xC912, 0xC911, 0xC912,
+  0xC912, 0xC112, 0xC912, 0xC912, 0xABF7, 0x800A, 0x8EBC, 0x0003, 0x8C36, 0x8191, 0xA951, 0x8003, 0xC912, 0x000B, 0xC911, 0xC911,
+  0xC912, 0xC912, 0x9D59, 0x8EBC, 0x8AD4, 0x8191, 0xB152, 0xC912, 0xC131, 0x8006, 0xC912, 0x0001, 0xC932, 0x8004, 0xC912, 0x0030,
+  0xC911, 0xC112, 0xC932, 0xC912, 0xC912, 0xC932, 0xC911, 0xC912, 0xC912, 0xC932, 0xC131, 0x9DBA, 0x8EBC, 0x96BC, 0x8EBC, 0x8EDC,
+  0x96BB, 0x8EBC, 0x8EDC, 0x82D4, 0x8191, 0xB932, 0xC912, 0xC112, 0xC912, 0xC112, 0xC912, 0xC112, 0xC912, 0xC911, 0xC911, 0xC932,
+  0xC911, 0xC131, 0xC912, 0xC132, 0xC131, 0xC912, 0xC912, 0xC911, 0xC911, 0xC131, 0xC912, 0xC912, 0xB356, 0x8C36, 0x8191, 0xA151,
+  0x8006, 0xC912, 0x0009, 0xC112, 0x9D59, 0x8EBC, 0x96BC, 0x8EBC, 0x8EBC, 0x8C37, 0x8191, 0xA951, 0x8003, 0xC912, 0x0005, 0xC911,
+  0xC911, 0xC912, 0xC912, 0x9D59, 0x8003, 0x8EBC, 0x001F, 0x96BC, 0x8EBC, 0x82F4, 0x8991, 0xB151, 0xC912, 0xC912, 0xC932, 0xC912,
+  0xC912, 0xC131, 0xC932, 0xC912, 0xC911, 0xC911, 0xC932, 0xC911, 0xC912, 0xC911, 0xC932, 0xC932, 0xC112, 0xC911, 0xC132, 0xC912,
+  0xC912, 0xC932, 0xB336, 0x96BC, 0xA4F9, 0xC192, 0x800A, 0xC932, 0x8003, 0x001F, 0x0004, 0x007F, 0x00BF, 0x009F, 0x90B5, 0x8004,
+  0xC0B1, 0x0016, 0x0B9E, 0x053F, 0x057F, 0x053F, 0x05DA, 0x07EF, 0x07F5, 0x07FB, 0x07FF, 0x5478, 0xB0D1, 0xB0F1, 0xB0F1, 0x9111,
+  0x5912, 0xA8F1, 0xB0F1, 0x70F1, 0x30F0, 0x28EF, 0x20EF, 0x28CF, 0x8003, 0x20CE, 0x0004, 0x20AE, 0x20AE, 0x20AD, 0x20AE, 0x8017,
+  0x18AD, 0x8015, 0x18AD, 0x0004, 0x18AE, 0x18AD, 0x20AD, 0x20AD, 0x800C, 0x18AD, 0x0009, 0x20AD, 0x0119, 0x0119, 0x08F3, 0x18AD,
+  0x18AD, 0x08F3, 0x0119, 0x0119, 0x8010, 0x18AD, 0x8003, 0xC912, 0x8003, 0x9EDB, 0x0001, 0x9EDC, 0x8003, 0x9EDB, 0x0003, 0x9578,
+  0x8191, 0x9991, 0x8007, 0xC952, 0x0001, 0xB417, 0x800A, 0x9EDB, 0x0003, 0x9436, 0x8191, 0xA972, 0x8007, 0xC952, 0x0003, 0xA518,
+  0x9EDB, 0x96DB, 0x8008, 0x9EDB, 0x0003, 0x9436, 0x8191, 0xA171, 0x8007, 0xC952, 0x0004, 0xA579, 0x94D8, 0x8191, 0x9991, 0x8005,
+  0xC952, 0x0001, 0xC152, 0x8005, 0xC952, 0x0006, 0xC253, 0xC2B4, 0xB952, 0xC152, 0xC952, 0xC152, 0x8008, 0xC952, 0x0001, 0xBAB5,
+  0x8006, 0x9EDB, 0x0003, 0x9599, 0x8191, 0x91B1, 0x800A, 0xC952, 0x0004, 0xC1F3, 0xC2B5, 0xB952, 0xC152, 0x8005, 0xC952, 0x0008,
+  0xC972, 0xC952, 0xC952, 0xC972, 0xC1B2, 0x9436, 0x8191, 0xA972, 0x8007, 0xC952, 0x0001, 0xA579, 0x8004, 0x9EDB, 0x0003, 0x8C36,
+  0x8991, 0xA171, 0x8007, 0xC952, 0x0008, 0xA579, 0x9EDB, 0x9EDC, 0x9EDB, 0x9EDB, 0x9598, 0x8191, 0x9191, 0x8004, 0xC952, 0x0003,
+  0xC152, 0xC952, 0xC172, 0x8003, 0xC952, 0x0004, 0xC1F3, 0xC2B4, 0xB952, 0xC152, 0x800A, 0xC952, 0x000A, 0xA61A, 0x9EDC, 0xA5DA,
+  0xC172, 0xC912, 0xC911, 0xC911, 0xC912, 0xC912, 0xC111, 0x8003, 0xC912, 0x8003, 0x001F, 0x0012, 0x005F, 0x007F, 0x007F, 0x6098,
+  0xC0B1, 0xB8B1, 0xC0B1, 0xC0B1, 0x2AFC, 0x04FF, 0x05BF, 0x055F, 0x05FB, 0x07CF, 0x07F4, 0x07FC, 0x07FF, 0x5C79, 0x8003, 0xB0F1,
+  0x0010, 0x8112, 0x5912, 0xB0F1, 0xB0F1, 0x68F1, 0x30F0, 0x30EF, 0x30CF, 0x28CF, 0x20CF, 0x20CE, 0x20CE, 0x20AE, 0x20AE, 0x20AD,
+  0x20AE, 0x8017, 0x18AD, 0x8015, 0x18AD, 0x0002, 0x18CE, 0x00F7, 0x8010, 0x0119, 0x0007, 0x00F9, 0x18D0, 0x18AD, 0x18AD, 0x10D0,
+  0x0119, 0x0119, 0x8010, 0x18AD, 0x0011, 0xC8F1, 0xC8F1, 0xC8F2, 0xA6FB, 0xA6FA, 0xA6FA, 0xA6FB, 0xA6FA, 0xA6DA, 0xA6FA, 0x9D98,
+  0x8191, 0x9191, 0xC972, 0xC992, 0xC992, 0xC972, 0x8003, 0xC992, 0x0002, 0xB436, 0xA6FB, 0x8009, 0xA6FA, 0x0005, 0x9436, 0x8191,
+  0xA992, 0xC992, 0xC992, 0x8003, 0xC972, 0x0005, 0xC992, 0xC992, 0xAD98, 0xA6DA, 0xA6DA, 0x8008, 0xA6FA, 0x0004, 0x9436, 0x8191,
+  0xA992, 0xC993, 0x8006, 0xC992, 0x000A, 0xAD99, 0x8A32, 0x8991, 0xC192, 0xC992, 0xC992, 0xC972, 0xC992, 0xC992, 0xC973, 0x8003,
+  0xC992, 0x001A, 0xBC36, 0xA69A, 0xA6FA, 0xA6FA, 0xA69A, 0x9395, 0x8991, 0xB992, 0xC993, 0xC972, 0xC972, 0xC992, 0xC992, 0xC972,
+  0xC992, 0xC972, 0xC972, 0xAD98, 0xA6DB, 0xA6DA, 0xA6FA, 0xA6FB, 0xA6FA, 0x9395, 0x8191, 0xB192, 0x8003, 0xC992, 0x000E, 0xC993,
+  0xC972, 0xC972, 0xC992, 0xC972, 0xC233, 0xAD98, 0xA6FA, 0xA6FB, 0xA639, 0x8A93, 0x9992, 0xC192, 0xC972, 0x8003, 0xC992, 0x0007,
+  0xC972, 0xC992, 0xC972, 0xC972, 0x9A93, 0x8191, 0xA992, 0x8007, 0xC992, 0x0009, 0xAD98, 0xA6FA, 0xA6FB, 0xA6FA, 0xA6FA, 0x9436,
+  0x8191, 0xA992, 0xC993, 0x8006, 0xC992, 0x001A, 0xAD98, 0xA6DA, 0xA6DA, 0xA6FA, 0xA6DA, 0x8B95, 0x8191, 0xB192, 0xC972, 0xC992,
+  0xC972, 0xC992, 0xC992, 0xC972, 0xC992, 0xC972, 0xC294, 0xADF9, 0xA6FA, 0xA6DA, 0xA69A, 0x9334, 0x9191, 0xB992, 0xC992, 0xC993,
+  0x8006, 0xC992, 0x0008, 0xB497, 0xAEFB, 0xAEFB, 0xB5D9, 0xC952, 0xC8F1, 0xC8F2, 0xC0F1, 0x8005, 0xC8F1, 0x8003, 0x001F, 0x0012,
+  0x003F, 0x007F, 0x005F, 0x7897, 0xC0B1, 0xC0D1, 0xC0B1, 0xB8D1, 0x6238, 0x04DF, 0x05BF, 0x059F, 0x05FA, 0x07CE, 0x07F4, 0x07FC,
+  0x07FF, 0x5C78, 0x8003, 0xB0F1, 0x0007, 0x7112, 0x5912, 0xB0F1, 0xA8F1, 0x5110, 0x30F0, 0x30CF, 0x8003, 0x28CF, 0x0005, 0x20AE,
+  0x20CE, 0x20CE, 0x20AE, 0x20AD, 0x8018, 0x18AD, 0x8014, 0x18AD, 0x0002, 0x18CE, 0x00F7, 0x8005, 0x0119, 0x0001, 0x011A, 0x800C,
+  0x0119, 0x0006, 0x08F3, 0x18AD, 0x18AD, 0x08F3, 0x0119, 0x0119, 0x800E, 0x18AD, 0x0005, 0x18CD, 0x18AD, 0xC0D1, 0xC0D1, 0xC8D2,
+  0x8003, 0xB71A, 0x000F, 0xAEFA, 0xB71A, 0xAF1A, 0xAEFA, 0xA598, 0x8191, 0x9191, 0xC9B3, 0xC9B3, 0xC9D3, 0xC9D3, 0xC9B2, 0xC9B3,
+  0xC9D3, 0xBC76, 0x800A, 0xB71A, 0x000F, 0x9C55, 0x8191, 0xA9B2, 0xC9D3, 0xC9D3, 0xC9B3, 0xC9B2, 0xC9B3, 0xC9D3, 0xC9D3, 0xB5B8,
+  0xB71A, 0xAF1A, 0xB71A, 0xB6FA, 0x8004, 0xB71A, 0x0005, 0xB6FA, 0xAF1A, 0x9C56, 0x8191, 0xA992, 0x8007, 0xC9B3, 0x0016, 0xA3B5,
+  0x8191, 0x9992, 0xC9B2, 0xC9B3, 0xC9D2, 0xC9B2, 0xC9B3, 0xC9B2, 0xC9B3, 0xC9D3, 0xCA13, 0xBDB8, 0xAEFA, 0xAF1A, 0xB71A, 0xB6FA,
+  0xAEFA, 0xAF19, 0xA4F7, 0x8991, 0xB1B2, 0x8005, 0xC9B3, 0x000C, 0xC9D2, 0xC9B3, 0xC9B3, 0xC314, 0xAF1A, 0xAF1A, 0xAEF9, 0xAF1A,
+  0xAF1A, 0x89F1, 0x8191, 0xC1B2, 0x8003, 0xC9B3, 0x000E, 0xC9B2, 0xC9B2, 0xC9D3, 0xC9B3, 0xCAB4, 0xB6B9, 0xAF1A, 0xB71A, 0xAEFA,
+  0xB71A, 0xB6B9, 0x8A93, 0x8991, 0xC1D2, 0x8004, 0xC9B3, 0x0009, 0xC9B2, 0xC9D3, 0xC9B2, 0xA992, 0x8191, 0xA9B2, 0xC9D3, 0xC9B3,
+  0xC9D3, 0x8003, 0xC9B2, 0x0009, 0xC9B3, 0xB5B8, 0xAF1A, 0xAEFA, 0xAF1A, 0xB71A, 0x9C56, 0x8191, 0xA992, 0x8007, 0xC9B3, 0x0021,
+  0xB5B8, 0xB6FA, 0xAF1A, 0xAF1A, 0xB6FA, 0x89F2, 0x8191, 0xC1B2, 0xC9B3, 0xC9B2, 0xC9D3, 0xC9B3, 0xC9B3, 0xC9B2, 0xC9D3, 0xCAB4,
+  0xB6B9, 0xAF1A, 0xB71A, 0xB71A, 0xB6FA, 0xB71A, 0x92F3, 0x89B1, 0xC1B2, 0xC9D3, 0xC9B3, 0xC9B3, 0xC9D3, 0xC9D3, 0xC9B3, 0xC9D3,
+  0xC315, 0x8003, 0xB71A, 0x0003, 0xBDD9, 0xC132, 0xC0D1, 0x8004, 0xC8D1, 0x0002, 0xC0D1, 0xC0D1, 0x8003, 0x001F, 0x0012, 0x003F,
+  0x007F, 0x007F, 0x6878, 0xB8B1, 0xC0B1, 0xC0D1, 0xB8D1, 0x9954, 0x047F, 0x05BF, 0x05BF, 0x061A, 0x07CE, 0x07F2, 0x07FC, 0x07FF,
+  0x5C78, 0x8003, 0xB0F1, 0x000A, 0x6112, 0x5912, 0xA8F1, 0xA8F1, 0x60F0, 0x30F0, 0x28EF, 0x28CF, 0x28CF, 0x28CE, 0x8003, 0x20CE,
+  0x0002, 0x20AE, 0x20AD, 0x8018, 0x18AD, 0x8014, 0x18AD, 0x0004, 0x00F7, 0x0119, 0x00F7, 0x18AE, 0x800D, 0x18AD, 0x0009, 0x20AD,
+  0x08F5, 0x0119, 0x0119, 0x00F7, 0x00F7, 0x0119, 0x0119, 0x08F4, 0x800F, 0x18AD, 0x0004, 0x20AD, 0xC0B1, 0xC8B1, 0xC0B1, 0x8007,
+  0xBF19, 0x0003, 0xA4B5, 0x8191, 0xA1B2, 0x8006, 0xC9F3, 0x0002, 0xD1F3, 0xC496, 0x800A, 0xBF19, 0x0003, 0xA455, 0x8191, 0xA9D2,
+  0x8007, 0xC9F3, 0x0001, 0xBDD8, 0x8003, 0xBF19, 0x000A, 0xBF39, 0xBF19, 0xBF19, 0xBF39, 0xBF19, 0xBF39, 0xBF39, 0xA455, 0x8191,
+  0xA9D2, 0x8007, 0xC9F3, 0x0003, 0x99F2, 0x8991, 0xB1D2, 0x8007, 0xC9F3, 0x0005, 0xC9F2, 0xC577, 0xBF19, 0xBF39, 0xBF39, 0x8005,
+  0xBF19, 0x0006, 0x9BF5, 0x8191, 0xB1D2, 0xC9F3, 0xC9F3, 0xD1F3, 0x8005, 0xC9F3, 0x0001, 0xBE78, 0x8003, 0xBF19, 0x000C, 0xB6B9,
+  0x8191, 0x8991, 0xC9F3, 0xC9F3, 0xC9F2, 0xC9F3, 0xC9F3, 0xC9D3, 0xC9F3, 0xC9F3, 0xBED8, 0x8005, 0xBF19, 0x0006, 0xBF39, 0xAD57,
+  0x8191, 0x99B2, 0xC9F3, 0xC9F2, 0x8005, 0xC9F3, 0x0003, 0xB9D3, 0x8191, 0xA9B2, 0x8007, 0xC9F3, 0x0001, 0xBDD8, 0x8004, 0xBF19,
+  0x0003, 0x9C75, 0x8191, 0xA9D2, 0x8007, 0xC9F3, 0x0001, 0xBDD8, 0x8003, 0xBF19, 0x0003, 0xB6B8, 0x8191, 0x8191, 0x8008, 0xC9F3,
+  0x000A, 0xBE78, 0xBF19, 0xBF39, 0xBF19, 0xBF39, 0xBF19, 0xBF19, 0xADB7, 0x8191, 0x91B1, 0x8003, 0xC9F3, 0x0001, 0xC9F2, 0x8004,
+  0xC9F3, 0x000C, 0xC71A, 0xBF1A, 0xC73A, 0xBF3A, 0xC659, 0xC9D3, 0xC0B1, 0xC8B1, 0xC0B1, 0xC0B1, 0xC8B1, 0xC0B1, 0x8003, 0x001F,
+  0x0006, 0x003F, 0x005F, 0x003F, 0x001F, 0x7076, 0xC0D1, 0x8003, 0xB8D1, 0x0009, 0x0BFF, 0x05DF, 0x05BF, 0x0639, 0x07CD, 0x07F2,
+  0x07FC, 0x07FF, 0x63F7, 0x8003, 0xB0F1, 0x0009, 0x4132, 0x4111, 0xA0F1, 0xB0F1, 0x90F1, 0x30F0, 0x28EF, 0x28CE, 0x28CF, 0x8004,
+  0x20CE, 0x0002, 0x20AE, 0x20AD, 0x8018, 0x18AD, 0x8012, 0x18AD, 0x0008, 0x18AE, 0x00F7, 0x0119, 0x00F8, 0x10D0, 0x18AD, 0x18AD,
+  0x20AD, 0x800C, 0x18AD, 0x0002, 0x18CE, 0x00F7, 0x8004, 0x0119, 0x0008, 0x00F7, 0x18CE, 0x18AD, 0x18CD, 0x18AD, 0x18AD, 0x18CD,
+  0x18AE, 0x8009, 0x18AD, 0x0001, 0x20AE, 0x8003, 0xC0B1, 0x8007, 0xC738, 0x000B, 0xA475, 0x8991, 0xA9D2, 0xCA13, 0xCA33, 0xCA33,
+  0xCA34, 0xCA13, 0xCA33, 0xCA33, 0xCCB6, 0x800A, 0xC738, 0x0006, 0xA455, 0x8191, 0xA9D2, 0xCA33, 0xCA33, 0xCA13, 0x8003, 0xCA33,
+  0x0002, 0xD213, 0xC5F7, 0x8004, 0xC738, 0x0001, 0xC739, 0x8005, 0xC738, 0x0004, 0xA475, 0x8191, 0xA9D2, 0xCA13, 0x8004, 0xCA33,
+  0x0005, 0xCA13, 0xCA33, 0x91B1, 0x8191, 0xCA13, 0x8004, 0xCA33, 0x0006, 0xCA13, 0xCA33, 0xCA13, 0xC455, 0xC738, 0xC739, 0x8004,
+  0xC738, 0x0001, 0xC739, 0x8003, 0xC738, 0x0003, 0x8A52, 0x8991, 0xC213, 0x8004, 0xCA13, 0x000A, 0xCA33, 0xCA13, 0xCA33, 0xCD56,
+  0xC738, 0xC738, 0xC739, 0xB5D7, 0x8191, 0x91B1, 0x8003, 0xCA13, 0x0001, 0xD233, 0x8003, 0xCA33, 0x0002, 0xCB55, 0xCF38, 0x8005,
+  0xC738, 0x0004, 0xC739, 0xC738, 0x8191, 0x8191, 0x8003, 0xCA13, 0x000F, 0xCA33, 0xCA13, 0xCA33, 0xD233, 0xCA13, 0x8191, 0xA9D2,
+  0xCA33, 0xCA33, 0xCA13, 0xCA13, 0xCA33, 0xCA13, 0xCA33, 0xCDF7, 0x8003, 0xC738, 0x0005, 0xC739, 0xA475, 0x8191, 0xA9D2, 0xCA13,
+  0x8004, 0xCA33, 0x0003, 0xCA13, 0xCA33, 0xC5F7, 0x8003, 0xC738, 0x0006, 0xB5D6, 0x8191, 0x99B2, 0xCA33, 0xCA33, 0xD213, 0x8004,
+  0xCA33, 0x0002, 0xCB74, 0xC739, 0x8004, 0xC738, 0x0014, 0xC739, 0xC738, 0xC738, 0x8AB2, 0x8191, 0xBA13, 0xCA13, 0xCA13, 0xCA33,
+  0xCA13, 0xCA33, 0xCA33, 0xCA13, 0xCF39, 0xC739, 0xC759, 0xCF3A, 0xCF39, 0xCED9, 0xC9F3, 0x8005, 0xC0B1, 0x8004, 0x001F, 0x0005,
+  0x003F, 0x003F, 0x001F, 0x001F, 0x9894, 0x8003, 0xB8D1, 0x0015, 0x42DA, 0x059F, 0x05FF, 0x0678, 0x07CC, 0x07F1, 0x07FC, 0x07FF,
+  0x82B5, 0xA8F1, 0xB0F1, 0x98F2, 0x4132, 0x3912, 0x70F1, 0xA8F1, 0xA8F1, 0x50F0, 0x28CF, 0x28CF, 0x28CE, 0x8004, 0x20CE, 0x0002,
+  0x20AE, 0x20AE, 0x8018, 0x18AD, 0x8011, 0x18AD, 0x0005, 0x18AE, 0x00F7, 0x0119, 0x00F8, 0x10CF, 0x800F, 0x18AD, 0x0007, 0x20AD,
+  0x18AD, 0x18AD, 0x10D2, 0x10D3, 0x08F3, 0x10D2, 0x8004, 0x18AD, 0x0001, 0x20AD, 0x800B, 0x18AD, 0x0002, 0x20AD, 0x18AD, 0x8003,
+  0xC0B1, 0x000D, 0xCF57, 0xD758, 0xD758, 0xCF58, 0xD758, 0xCF58, 0xD758, 0xAC74, 0x8191, 0xA9F2, 0xCA53, 0xD253, 0xCA54, 0x8003,
+  0xCA53, 0x0003, 0xCA54, 0xCCD6, 0xCF58, 0x8008, 0xD758, 0x0007, 0xCF58, 0xAC75, 0x8191, 0xA9F2, 0xCA53, 0xCA53, 0xD253, 0x8003,
+  0xCA53, 0x0018, 0xD254, 0xCE17, 0xCF57, 0xD758, 0xCF58, 0xD758, 0xCF58, 0xD758, 0xD758, 0xCF58, 0xD758, 0xCF58, 0xAC74, 0x8191,
+  0xA9F2, 0xCA53, 0xCA54, 0xD253, 0xCA53, 0xCA53, 0xCA54, 0xCA53, 0x99D2, 0x89B1, 0x8004, 0xCA53, 0x0012, 0xD253, 0xCA53, 0xCA53,
+  0xCA54, 0xD6B7, 0xD758, 0xCF58, 0xCF57, 0xCF58, 0xD758, 0xD757, 0xD758, 0xD757, 0xD758, 0xCF58, 0xB535, 0x8191, 0xA1D2, 0x8003,
+  0xCA53, 0x004C, 0xD254, 0xCA73, 0xCA53, 0xCA53, 0xCC95, 0xD758, 0xD758, 0xCF58, 0xBDD6, 0x8191, 0x99D2, 0xCA53, 0xCA53, 0xCA54,
+  0xCA53, 0xCA53, 0xD254, 0xCA54, 0xD435, 0xD758, 0xD758, 0xCF58, 0xD758, 0xD758, 0xCF57, 0xD738, 0xCF58, 0x9AF3, 0x8991, 0xC213,
+  0xCA54, 0xCA53, 0xCA53, 0xD253, 0xCA53, 0xCA54, 0xCA73, 0x8191, 0xA9F2, 0xCA53, 0xD253, 0xD253, 0xCA54, 0xD253, 0xCA53, 0xCA54,
+  0xCE17, 0xCF58, 0xD758, 0xD758, 0xCF58, 0xAC74, 0x8191, 0xA9F2, 0xCA53, 0xCA54, 0xD253, 0xCA53, 0xCA53, 0xCA54, 0xCA53, 0xD617,
+  0xD758, 0xCF58, 0xCF58, 0xBDD6, 0x8191, 0x91B2, 0xCA53, 0xD254, 0xCA53, 0xCA53, 0xCA54, 0xD253, 0xD253, 0xCCD6, 0x8004, 0xD758,
+  0x0016, 0xCF57, 0xD757, 0xCF58, 0xD758, 0x9AF3, 0x8191, 0xBA33, 0xCA54, 0xCA53, 0xD253, 0xCA54, 0xCA53, 0xD253, 0xCA53, 0xD758,
+  0xD758, 0xDF59, 0xD779, 0xD759, 0xD759, 0xD6F9, 0xC1F2, 0x8004, 0xC0B1, 0x8003, 0x001F, 0x0001, 0x003F, 0x8004, 0x001F, 0x0019,
+  0x183E, 0xB0D2, 0xB8D1, 0xB8D1, 0x9974, 0x059F, 0x061F, 0x0698, 0x07CC, 0x07F0, 0x07FC, 0x07FF, 0x82B5, 0xB0F1, 0xB0F1, 0x88F1,
+  0x4132, 0x4111, 0x3910, 0x98F1, 0xA8F2, 0x88F1, 0x28EF, 0x28CF, 0x28CE, 0x8004, 0x20CE, 0x0002, 0x20AE, 0x20AE, 0x8018, 0x18AD,
+  0x8010, 0x18AD, 0x0007, 0x18AE, 0x0117, 0x0119, 0x0118, 0x10D0, 0x18AD, 0x18AE, 0x8003, 0x18AD, 0x0001, 0x20AD, 0x8009, 0x18AD,
+  0x0001, 0x18AE, 0x800A, 0x18AD, 0x0001, 0x20AD, 0x800C, 0x18AD, 0x0002, 0x20AD, 0x18AD, 0x8003, 0xC0B1, 0x8007, 0xDF77, 0x0005,
+  0xB494, 0x8191, 0xAA12, 0xCA94, 0xCA74, 0x8004, 0xCA94, 0x0002, 0xD294, 0xD4F5, 0x800A, 0xDF77, 0x000E, 0xB474, 0x8191, 0xAA12,
+  0xCA94, 0xCA94, 0xD294, 0xCA94, 0xD294, 0xCA94, 0xD294, 0xDE36, 0xDF77, 0xDF77, 0xDF57, 0x8007, 0xDF77, 0x0004, 0xB494, 0x8191,
+  0xAA12, 0xCA94, 0x8006, 0xD294, 0x000A, 0x99D2, 0x91D2, 0xD294, 0xCA94, 0xD294, 0xCA94, 0xD294, 0xCA94, 0xCA94, 0xD3D4, 0x8003,
+  0xDF77, 0x0001, 0xDF76, 0x8005, 0xDF77, 0x0005, 0xDF57, 0xDF77, 0xDF77, 0x8191, 0x8992, 0x8003, 0xCA94, 0x0005, 0xD294, 0xCA94,
+  0xCA93, 0xCA94, 0xD3D5, 0x8003, 0xDF77, 0x000B, 0xC5F5, 0x8191, 0x99D2, 0xCA94, 0xCA94, 0xD273, 0xCA94, 0xD294, 0xCA94, 0xD294,
+  0xD515, 0x8008, 0xDF77, 0x000C, 0x9B12, 0x8191, 0xBA53, 0xCA94, 0xCA94, 0xD294, 0xCA94, 0xCA93, 0xD294, 0xCA94, 0x8191, 0xAA12,
+  0x8003, 0xD294, 0x000D, 0xCA94, 0xCA94, 0xD294, 0xD294, 0xDE36, 0xDF77, 0xDF77, 0xDF57, 0xDF77, 0xB474, 0x8191, 0xAA12, 0xCA94,
+  0x8006, 0xD294, 0x0001, 0xDE36, 0x8003, 0xDF77, 0x000B, 0xC5F5, 0x8191, 0x99D2, 0xD294, 0xCA94, 0xCA94, 0xD294, 0xCA94, 0xCA94,
+  0xCA93, 0xD4F5, 0x8008, 0xDF77, 0x000A, 0x9B12, 0x8191, 0xBA53, 0xD294, 0xCA94, 0xCA94, 0xD294, 0xCA94, 0xD294, 0xCA94, 0x8006,
+  0xDF78, 0x0002, 0xE779, 0xDF19, 0x8004, 0xC0B1, 0x8009, 0x001F, 0x0001, 0x385B, 0x8003, 0xB8D1, 0x0014, 0x2C3C, 0x061F, 0x06B7,
+  0x07CB, 0x07F0, 0x07FB, 0x07FF, 0xB0F1, 0xB0F1, 0xA8F1, 0x7912, 0x4132, 0x4111, 0x3911, 0x4110, 0xA0F1, 0xA8F1, 0x48EF, 0x28CE,
+  0x28CE, 0x8004, 0x20CE, 0x0002, 0x20AD, 0x20AE, 0x8018, 0x18AD, 0x800F, 0x18AD, 0x0005, 0x18AE, 0x00F7, 0x0119, 0x0118, 0x10CF,
+  0x8013, 0x18AD, 0x0004, 0x18CD, 0x18AD, 0x18AD, 0x208E, 0x8003, 0x18AD, 0x0001, 0x20AD, 0x800F, 0x18AD, 0x0007, 0xB8D1, 0xB8D1,
+  0xC0D1, 0xE776, 0xE796, 0xE797, 0xE797, 0x8003, 0xE796, 0x0003, 0xB494, 0x8191, 0xAA33, 0x8003, 0xD2B4, 0x0006, 0xCAB4, 0xD2D4,
+  0xD2B4, 0xD2B4, 0xDD35, 0xE776, 0x8009, 0xE796, 0x0003, 0xB474, 0x8191, 0xAA33, 0x8003, 0xD2D4, 0x000C, 0xD2B4, 0xD2B4, 0xCAD4,
+  0xD2D4, 0xE656, 0xEF96, 0xE776, 0xE797, 0xE796, 0xE796, 0xE776, 0xE777, 0x8003, 0xE796, 0x0003, 0xB494, 0x8191, 0xAA33, 0x8007,
+  0xD2B4, 0x0011, 0x99D2, 0x99F2, 0xCAB4, 0xD2B4, 0xD2D4, 0xD2B4, 0xD2B4, 0xCAD4, 0xD2B4, 0xD3F5, 0xE777, 0xE797, 0xEF97, 0xE796,
+  0xE796, 0xE776, 0xE777, 0x8003, 0xE796, 0x000C, 0xE777, 0xEF97, 0x8191, 0x8191, 0xD2B4, 0xD2B4, 0xD2D4, 0xD2D4, 0xD2B4, 0xD2B4,
+  0xCAD4, 0xD3D5, 0x8003, 0xE796, 0x001F, 0xCE15, 0x8191, 0x99F2, 0xCAD4, 0xD2B4, 0xD2D4, 0xD2B4, 0xD2B4, 0xCAB4, 0xD2B4, 0xDD35,
+  0xE777, 0xEF76, 0xE796, 0xE797, 0xE797, 0xE776, 0xE796, 0xE776, 0xC534, 0xB494, 0xCC15, 0xD3F5, 0xDBF4, 0xDBF4, 0xDBF5, 0xD3F5,
+  0xD3F4, 0xCB34, 0x8191, 0xAA32, 0x8004, 0xD2B4, 0x000B, 0xD2D4, 0xD2B4, 0xCAB4, 0xE656, 0xE776, 0xE796, 0xE796, 0xE776, 0xB494,
+  0x8191, 0xAA33, 0x8007, 0xD2B4, 0x0001, 0xDE56, 0x8003, 0xE796, 0x0010, 0xCE15, 0x8191, 0x99F2, 0xD2B4, 0xD2B4, 0xD2D4, 0xD2B4,
+  0xD2D4, 0xCAD4, 0xCAD4, 0xDD15, 0xE796, 0xE796, 0xE776, 0xE796, 0xEF96, 0x8003, 0xE796, 0x0003, 0x9B13, 0x8191, 0xBA73, 0x8007,
+  0xD2B4, 0x0005, 0xE797, 0xEF97, 0xEF77, 0xEF97, 0xEF78, 0x8003, 0xEF98, 0x0004, 0xC992, 0xB8D1, 0xC0D1, 0xC0B1, 0x800A, 0x001F,
+  0x000A, 0x7096, 0xB8D1, 0xB8D1, 0x8A35, 0x063F, 0x06D6, 0x07EA, 0x07F1, 0x07FC, 0x07FF, 0x8003, 0xA8F1, 0x000A, 0x6132, 0x4132,
+  0x4111, 0x38F1, 0x3110, 0x48F0, 0xA8F1, 0x98F1, 0x30CF, 0x28CF, 0x8003, 0x20CE, 0x0003, 0x20AE, 0x20AD, 0x20AE, 0x8018, 0x18AD,
+  0x800E, 0x18AD, 0x0005, 0x18AE, 0x00F7, 0x0119, 0x0118, 0x18D0, 0x8012, 0x18AD, 0x000B, 0x20AD, 0x18AD, 0x20AD, 0x18AD, 0x18CD,
+  0x18AD, 0x18AD, 0x20AD, 0x18AD, 0x18AD, 0x18CD, 0x800E, 0x18AD, 0x8003, 0xB8D1, 0x000A, 0xF796, 0xF7B6, 0xF796, 0xF795, 0xF795,
+  0xF796, 0xEFB6, 0xBC93, 0x8191, 0xAA52, 0x8003, 0xD2F4, 0x8003, 0xD2F5, 0x0002, 0xD2F4, 0xDD55, 0x8009, 0xF7B6, 0x0005, 0xEFB6,
+  0xBC93, 0x8191, 0xAA53, 0xD2F5, 0x8006, 0xD2F4, 0x0003, 0xE675, 0xF796, 0xF795, 0x8003, 0xF796, 0x0008, 0xF7B6, 0xF7B5, 0xF7B5,
+  0xEF96, 0xF796, 0xBC93, 0x8191, 0xAA33, 0x8007, 0xD2F4, 0x000A, 0x99F2, 0x99F2, 0xD2F5, 0xD2F4, 0xD2F4, 0xD2F5, 0xD2D4, 0xD2F4,
+  0xD2F4, 0xDC75, 0x8003, 0xF795, 0x0002, 0xF796, 0xF7B5, 0x8004, 0xF796, 0x0005, 0xEFB6, 0xF7B5, 0xF796, 0x8191, 0x8991, 0x8007,
+  0xD2F4, 0x0001, 0xDC15, 0x8003, 0xF796, 0x0003, 0xD615, 0x8191, 0x99F2, 0x8004, 0xD2F4, 0x0018, 0xD2F5, 0xD2F4, 0xD2F5, 0xE535,
+  0xF7B6, 0xF7B5, 0xF796, 0xEFB6, 0xF796, 0xF795, 0xF7B6, 0xF796, 0xF7B6, 0xF795, 0xF796, 0xF796, 0xF795, 0xF7B6, 0xF795, 0xF7B6,
+  0xF796, 0xBC93, 0x8191, 0xAA53, 0x8007, 0xD2F4, 0x0008, 0xEE75, 0xF796, 0xF796, 0xF7B5, 0xF796, 0xBC93, 0x8191, 0xAA33, 0x8007,
+  0xD2F4, 0x000A, 0xEE75, 0xF796, 0xF7B5, 0xF795, 0xD634, 0x8191, 0x99F2, 0xD2F4, 0xD2F5, 0xD2F4, 0x8003, 0xD2F5, 0x000D, 0xD2D4,
+  0xE555, 0xF796, 0xF7B5, 0xF7B6, 0xF7B6, 0xF795, 0xF7B6, 0xF796, 0xF7B6, 0xA311, 0x8191, 0xBA94, 0x8007, 0xD2F4, 0x0002, 0xF796,
+  0xF796, 0x8003, 0xF797, 0x0004, 0xF7B7, 0xF798, 0xF798, 0xD273, 0x8003, 0xB8D1, 0x800B, 0x001F, 0x001C, 0x98B4, 0xB8D1, 0xB8D1,
+  0x3C9B, 0x06F5, 0x07E9, 0x07F1, 0x07FD, 0x26BD, 0xB0F1, 0xB0F2, 0xB0F1, 0x4932, 0x4132, 0x4111, 0x3911, 0x3110, 0x30F0, 0x60F0,
+  0xA911, 0x70F0, 0x20CE, 0x20CF, 0x20AE, 0x20CE, 0x20AE, 0x20AD, 0x20AD, 0x8018, 0x18AD, 0x800D, 0x18AD, 0x0008, 0x18AE, 0x0117,
+  0x0119, 0x0118, 0x18D0, 0x18AD, 0x18AD, 0x20AD, 0x8005, 0x18AD, 0x0001, 0x20AD, 0x800A, 0x18AD, 0x0001, 0x20AD, 0x8004, 0x18AD,
+  0x0001, 0x20AD, 0x8013, 0x18AD, 0x8003, 0xB8D1, 0x0001, 0xFF94, 0x8004, 0xFFB5, 0x0006, 0xFFB4, 0xFFB5, 0xC493, 0x8191, 0xAA53,
+  0xD315, 0x8003, 0xD335, 0x0004, 0xD334, 0xD315, 0xD335, 0xE575, 0x800A, 0xFFB5, 0x0007, 0xC493, 0x8191, 0xAA53, 0xD335, 0xD335,
+  0xD314, 0xD315, 0x8003, 0xD335, 0x0005, 0xF675, 0xFFB5, 0xFFB4, 0xFFB5, 0xFFB5, 0x8003, 0xFFB4, 0x0006, 0xFFB5, 0xFFB5, 0xFF95,
+  0xC493, 0x8191, 0xAA53, 0x8004, 0xD335, 0x000D, 0xD315, 0xD315, 0xD335, 0x99F2, 0x99F2, 0xD335, 0xD314, 0xD315, 0xD335, 0xD335,
+  0xD315, 0xD335, 0xDC54, 0x8004, 0xFFB5, 0x0001, 0xFFB4, 0x8005, 0xFFB5, 0x0006, 0xFFB4, 0xFFB5, 0x8191, 0x8191, 0xD334, 0xD315,
+  0x8004, 0xD335, 0x0010, 0xD315, 0xDC34, 0xFFB4, 0xFFB5, 0xFFB5, 0xDE34, 0x8191, 0x99F2, 0xD314, 0xD335, 0xD315, 0xD334, 0xD334,
+  0xD335, 0xD335, 0xE574, 0x8007, 0xFFB5, 0x0004, 0xFFB4, 0xFFB4, 0xFFB5, 0xFFB4, 0x8003, 0xFFB5, 0x000A, 0xFFB4, 0xFFB5, 0xFFB5,
+  0xC4B3, 0x8191, 0xAA53, 0xD335, 0xD335, 0xD314, 0xD315, 0x8003, 0xD335, 0x0001, 0xEDF5, 0x8004, 0xFFB5, 0x0003, 0xC493, 0x8191,
+  0xAA53, 0x8004, 0xD335, 0x0004, 0xD315, 0xD315, 0xD335, 0xF694, 0x8003, 0xFFB5, 0x000B, 0xDE14, 0x8191, 0x99F2, 0xD335, 0xD335,
+  0xD314, 0xD334, 0xD314, 0xD334, 0xD315, 0xE555, 0x8003, 0xFFB5, 0x0001, 0xFFB4, 0x8004, 0xFFB5, 0x0003, 0xA332, 0x8191, 0xBAB4,
+  0x8003, 0xD335, 0x0005, 0xD315, 0xD334, 0xD335, 0xD335, 0xFFB5, 0x8005, 0xFFB6, 0x0006, 0xFFB7, 0xFFB8, 0xDBD4, 0xB8D2, 0xB8D1,
+  0xB8D1, 0x800A, 0x001F, 0x001D, 0x003F, 0x083F, 0x70F7, 0xB8D1, 0xA952, 0x0E94, 0x07C9, 0x07F2, 0x07FD, 0x2E3C, 0xA8F1, 0xA8F1,
+  0x9911, 0x4132, 0x4132, 0x3911, 0x3910, 0x30F0, 0x30F0, 0x30EF, 0x58F0, 0xA8F1, 0x40CF, 0x20AE, 0x20CE, 0x20CE, 0x20AE, 0x20AD,
+  0x20AD, 0x8018, 0x18AD, 0x800C, 0x18AD, 0x0005, 0x18CD, 0x00F7, 0x00F9, 0x0118, 0x18CF, 0x8008, 0x18AD, 0x0001, 0x20AD, 0x8024,
+  0x18AD, 0x8003, 0xB8D1, 0x8005, 0xFE2E, 0x0005, 0xFE4E, 0xFE4E, 0xC3F0, 0x8191, 0xAA73, 0x8007, 0xD355, 0x0001, 0xECD1, 0x800A,
+  0xFE2E, 0x0003, 0xC3EF, 0x8191, 0xAA73, 0x8006, 0xD355, 0x0007, 0xD354, 0xF590, 0xFE4E, 0xFE4E, 0xFE2E, 0xFE2E, 0xFE4E, 0x8005,
+  0xFE2E, 0x0003, 0xC3EF, 0x8191, 0xAA73, 0x8007, 0xD355, 0x0004, 0x9A12, 0x91F2, 0xD355, 0xD354, 0x8005, 0xD355, 0x0002, 0xDBD4,
+  0xFE4E, 0x8004, 0xFE2E, 0x0003, 0xFE4E, 0xFE2E, 0xFE4E, 0x8003, 0xFE2E, 0x0003, 0xFE4E, 0x8191, 0x8191, 0x8007, 0xD355, 0x0007,
+  0xDC13, 0xFE4E, 0xFE2E, 0xFE2E, 0xE50F, 0x8191, 0x99F2, 0x8006, 0xD355, 0x0002, 0xD354, 0xECD1, 0x8008, 0xFE2E, 0x0001, 0xFE4E,
+  0x8004, 0xFE2E, 0x0007, 0xFE4E, 0xFE4E, 0xFE2E, 0xFE2E, 0xC3CF, 0x8191, 0xAA73, 0x8007, 0xD355, 0x0008, 0xE4D1, 0xFE4E, 0xFE2E,
+  0xFE2E, 0xFE4E, 0xC3D0, 0x8191, 0xAA73, 0x8007, 0xD355, 0x0007, 0xF590, 0xFE4E, 0xFE2E, 0xFE2E, 0xE50F, 0x8191, 0x9A12, 0x8007,
+  0xD355, 0x0004, 0xECD2, 0xFE2E, 0xFE4E, 0xFE2E, 0x8003, 0xFE4E, 0x0005, 0xFE4D, 0xFE2F, 0xA2B0, 0x8191, 0xC2F4, 0x8007, 0xD355,
+  0x0001, 0xFE2F, 0x8003, 0xFE50, 0x0008, 0xFE51, 0xFE51, 0xFE52, 0xFE52, 0xE3D2, 0xB8D2, 0xB8D1, 0xB8D1, 0x8009, 0x001F, 0x001E,
+  0x003F, 0x001F, 0x003F, 0x00DF, 0x59F8, 0xB8D1, 0x8291, 0x07C9, 0x07F2, 0x07FE, 0x455A, 0xB0F1, 0xA8F1, 0x8112, 0x4132, 0x4132,
+  0x3911, 0x38F0, 0x30F0, 0x30EF, 0x28EF, 0x28CF, 0x50CF, 0x48EF, 0x20AE, 0x20AE, 0x20CE, 0x20AE, 0x20AD, 0x20AD, 0x8018, 0x18AD,
+  0x800C, 0x18AD, 0x0004, 0x00F7, 0x0119, 0x00F8, 0x10CF, 0x800B, 0x18AD, 0x0001, 0x18AC, 0x8021, 0x18AD, 0x0008, 0x20AD, 0xB8D1,
+  0xB0D1, 0xB0D2, 0xFC8D, 0xFC6D, 0xFC6D, 0xFC8D, 0x8003, 0xFC6D, 0x0003, 0xC30F, 0x81B1, 0xAA73, 0x8003, 0xD395, 0x0005, 0xD375,
+  0xD395, 0xD395, 0xD375, 0xEC11, 0x8009, 0xFC6D, 0x0019, 0xFC8D, 0xC30F, 0x8191, 0xAA93, 0xD375, 0xD375, 0xD395, 0xD395, 0xD375,
+  0xD395, 0xD396, 0xF42F, 0xFC6D, 0xFC6D, 0xFC8D, 0xFC6D, 0xFC6D, 0xFC8D, 0xFC8D, 0xFC6D, 0xFC6D, 0xFC8D, 0xC30F, 0x8191, 0xAA93,
+  0x8004, 0xD395, 0x0012, 0xD375, 0xD375, 0xD395, 0x9A12, 0x8191, 0xD395, 0xD395, 0xD396, 0xD395, 0xD395, 0xD375, 0xD395, 0xD395,
+  0xF44F, 0xFC8D, 0xFC6D, 0xFC6D, 0xFC8D, 0x8004, 0xFC6D, 0x0005, 0xFC8D, 0xFC8D, 0xFC6D, 0x8191, 0x8191, 0x8003, 0xD395, 0x000B,
+  0xD375, 0xD395, 0xD395, 0xD396, 0xDBD3, 0xFC8D, 0xFC6D, 0xFC6D, 0xE3CE, 0x8191, 0x9A12, 0x8003, 0xD395, 0x0001, 0xD376, 0x8003,
+  0xD395, 0x0001, 0xEC11, 0x8004, 0xFC6D, 0x0002, 0xFC8D, 0xFC8D, 0x8008, 0xFC6D, 0x0007, 0xFC8D, 0xFC6D, 0xFC8D, 0xC30F, 0x8191,
+  0xAA93, 0xD375, 0x8006, 0xD395, 0x0008, 0xEBF1, 0xFC8D, 0xFC6D, 0xFC8D, 0xFC6D, 0xC30F, 0x8191, 0xAA93, 0x8004, 0xD395, 0x0016,
+  0xD375, 0xD375, 0xD395, 0xF42F, 0xFC6D, 0xFC6D, 0xFC8D, 0xE3CE, 0x8191, 0x9A12, 0xD395, 0xD395, 0xD375, 0xD395, 0xD376, 0xD395,
+  0xD395, 0xEBF1, 0xFC8D, 0xFC6D, 0xFC6D, 0xFC8D, 0x8003, 0xFC6D, 0x0005, 0xFC8D, 0xA250, 0x8191, 0xC314, 0xD375, 0x8005, 0xD395,
+  0x0002, 0xD375, 0xFC8E, 0x8003, 0xFC8F, 0x0008, 0xFCB0, 0xFCB0, 0xFCB1, 0xFCB1, 0xF3B2, 0xB8D1, 0xB0F1, 0xB8D1, 0x800A, 0x001F,
+  0x0015, 0x003F, 0x003F, 0x005F, 0x031F, 0x2D3B, 0x99B2, 0x454B, 0x07F3, 0x07FE, 0x5498, 0xB0F1, 0xA8F1, 0x6912, 0x4912, 0x4112,
+  0x3911, 0x3110, 0x30F0, 0x30EF, 0x30CF, 0x28CF, 0x8003, 0x20CE, 0x0005, 0x20CD, 0x20CE, 0x20AE, 0x20AD, 0x20AD, 0x8018, 0x18AD,
+  0x800A, 0x18AD, 0x000A, 0x18CD, 0x00F7, 0x0119, 0x00F8, 0x18CF, 0x18AD, 0x18AD, 0x20AD, 0x18AD, 0x20AD, 0x802A, 0x18AD, 0x0003,
+  0xB0F1, 0xB0F1, 0xB0D1, 0x8007, 0xFC8D, 0x0003, 0xC30F, 0x8191, 0xAA93, 0x8007, 0xD395, 0x0001, 0xEC11, 0x800A, 0xFC8D, 0x0003,
+  0xC30F, 0x8191, 0xAA93, 0x8007, 0xD395, 0x0001, 0xF44F, 0x800A, 0xFC8D, 0x0003, 0xC30F, 0x8191, 0xAA93, 0x8007, 0xD395, 0x0003,
+  0x9A12, 0x8191, 0xC334, 0x8007, 0xD395, 0x0002, 0xDBB4, 0xFC8E, 0x800A, 0xFC8D, 0x0002, 0x8191, 0x8191, 0x8006, 0xD395, 0x0002,
+  0xD375, 0xDBD3, 0x8003, 0xFC8D, 0x0003, 0xE3CE, 0x8191, 0x9A12, 0x8007, 0xD395, 0x0001, 0xEC11, 0x8011, 0xFC8D, 0x0003, 0xCB2F,
+  0x8191, 0xAA93, 0x8004, 0xD395, 0x0004, 0xD396, 0xD395, 0xD395, 0xEC11, 0x8004, 0xFC8D, 0x0003, 0xC30F, 0x8191, 0xAA93, 0x8007,
+  0xD395, 0x0001, 0xF44F, 0x8003, 0xFC8D, 0x0003, 0xCB6F, 0x8191, 0x9A32, 0x8007, 0xD395, 0x0001, 0xEC11, 0x8008, 0xFC8D, 0x0003,
+  0xA250, 0x8191, 0xC314, 0x8007, 0xD395, 0x0004, 0xFC8E, 0xFC8F, 0xFCAF, 0xFCAF, 0x8003, 0xFCB0, 0x0002, 0xFCB2, 0xF451, 0x8003,
+  0xB0D1, 0x8009, 0x001F, 0x8003, 0x003F, 0x0014, 0x005F, 0x025F, 0x06FD, 0x0770, 0x0F88, 0x07F4, 0x07FF, 0x5478, 0xA8F1, 0xA8F1,
+  0x5932, 0x4132, 0x4111, 0x3911, 0x3911, 0x30F0, 0x30F0, 0x30EF, 0x28CF, 0x28CE, 0x8004, 0x20CE, 0x8004, 0x20AD, 0x8017, 0x18AD,
+  0x8004, 0x18AD, 0x0002, 0x20AD, 0x18CD, 0x8003, 0x18AD, 0x0008, 0x18AE, 0x00F7, 0x0119, 0x00F8, 0x18CF, 0x18AD, 0x20AD, 0x20AD,
+  0x802D, 0x18AD, 0x0007, 0xB0F1, 0xB0F1, 0xB0D1, 0xFCAD, 0xFCCD, 0xFCAD, 0xFCAD, 0x8003, 0xFCCD, 0x0003, 0xCB4E, 0x8191, 0xAA73,
+  0x8007, 0xD395, 0x0002, 0xEC31, 0xFCAD, 0x8009, 0xFCCD, 0x0003, 0xC32F, 0x8991, 0xAA93, 0x8007, 0xD395, 0x0001, 0xF46F, 0x8003,
+  0xFCCD, 0x0001, 0xFCAD, 0x8003, 0xFCCD, 0x8003, 0xFCAD, 0x0003, 0xC32F, 0x8191, 0xAA93, 0x8007, 0xD395, 0x0004, 0xBB11, 0x8191,
+  0xAA73, 0xD396, 0x8003, 0xD395, 0x0001, 0xD396, 0x8003, 0xD395, 0x000D, 0xDBB4, 0xFCAE, 0xFCAD, 0xFCCD, 0xFCAD, 0xFCCD, 0xFCAD,
+  0xFCCD, 0xFCCD, 0xFCAD, 0xFCAD, 0x8191, 0x8191, 0x8006, 0xD395, 0x0008, 0xD375, 0xDBD3, 0xFCAD, 0xFCCD, 0xFCCD, 0xDBEE, 0x8191,
+  0x9A12, 0x8007, 0xD395, 0x0003, 0xEC31, 0xFCCD, 0xFCAD, 0x800B, 0xFCCD, 0x0007, 0xFCAD, 0xFCCD, 0xFCAD, 0xFCCD, 0xDBEE, 0x8191,
+  0x9A12, 0x8007, 0xD395, 0x0001, 0xDBD3, 0x8004, 0xFCCD, 0x0003, 0xC32F, 0x8191, 0xAA93, 0x8007, 0xD395, 0x0007, 0xF46F, 0xFCAD,
+  0xFCCD, 0xFCCD, 0xC32F, 0x8991, 0xAA94, 0x8007, 0xD395, 0x0005, 0xEC31, 0xFCCD, 0xFCCD, 0xFCAD, 0xFCCD, 0x8004, 0xFCAD, 0x0003,
+  0xA270, 0x8191, 0xC314, 0x8007, 0xD395, 0x000C, 0xFCCE, 0xFCCF, 0xFCCF, 0xFCEF, 0xFCD0, 0xFCF0, 0xFCF1, 0xFCF1, 0xFCF2, 0xB0F1,
+  0xB0F1, 0xB0F2, 0x8009, 0x001F, 0x0017, 0x003F, 0x003F, 0x005F, 0x007F, 0x021F, 0x06FC, 0x078D, 0x07E7, 0x07F6, 0x07FF, 0x82B5,
+  0xA8F1, 0xA111, 0x4932, 0x4132, 0x4111, 0x38F1, 0x38F0, 0x30F0, 0x30EF, 0x30EF, 0x28CF, 0x28CE, 0x8004, 0x20CE, 0x8004, 0x20AD,
+  0x8017, 0x18AD, 0x8004, 0x18AD, 0x000F, 0x20AD, 0x20AD, 0x18AD, 0x18AD, 0x18AE, 0x00F6, 0x0119, 0x0118, 0x18CF, 0x18AD, 0x18AD,
+  0x20AD, 0x18AD, 0x18AD, 0x20AD, 0x802B, 0x18AD, 0x0004, 0xB0F1, 0xA8F1, 0xB0F1, 0xFD0D, 0x8003, 0xFCED, 0x0006, 0xFD0D, 0xFCED,
+  0xFD0D, 0xE42E, 0x8191, 0x9A12, 0x8007, 0xD395, 0x0001, 0xEC51, 0x800A, 0xFCED, 0x0003, 0xC34F, 0x8191, 0xAA93, 0x8007, 0xD395,
+  0x0001, 0xF48F, 0x800A, 0xFCED, 0x0003, 0xC32F, 0x8191, 0xAA93, 0x8007, 0xD395, 0x0003, 0xEC6F, 0x91D1, 0x89D1, 0x8006, 0xD395,
+  0x0005, 0xD396, 0xD395, 0xD395, 0xDBB4, 0xEC70, 0x8005, 0xFCED, 0x0005, 0xFD0D, 0xFCED, 0xFCED, 0x8191, 0x8191, 0x8007, 0xD395,
+  0x0001, 0xDBF3, 0x8003, 0xFCED, 0x0003, 0xE42E, 0x8191, 0x9A12, 0x8007, 0xD395, 0x0001, 0xEC51, 0x800F, 0xFCED, 0x0005, 0xFD0D,
+  0xFCED, 0xEC6E, 0x8191, 0x91F2, 0x8005, 0xD395, 0x000A, 0xD376, 0xD395, 0xD395, 0xF4AF, 0xFD0D, 0xFCED, 0xFD0D, 0xC34F, 0x8191,
+  0xAA93, 0x8007, 0xD395, 0x0001, 0xF48F, 0x8003, 0xFCED, 0x0004, 0xC34F, 0x8191, 0xAA93, 0xD375, 0x8006, 0xD395, 0x0001, 0xEC51,
+  0x8008, 0xFCED, 0x0003, 0xA270, 0x8191, 0xC314, 0x8007, 0xD395, 0x0001, 0xFD0E, 0x8003, 0xFD0F, 0x0005, 0xFD10, 0xFD10, 0xFD31,
+  0xFD31, 0xFD32, 0x8003, 0xB0F1, 0x8009, 0x001F, 0x0001, 0x003F, 0x8003, 0x005F, 0x0013, 0x021F, 0x073B, 0x07AC, 0x07E7, 0x07F7,
+  0x07FF, 0x82B5, 0xA8F1, 0x8912, 0x4932, 0x4112, 0x3911, 0x3911, 0x3110, 0x30F0, 0x30EF, 0x28CF, 0x28CF, 0x28CE, 0x8003, 0x20CE,
+  0x0001, 0x20AE, 0x8004, 0x20AD, 0x8017, 0x18AD, 0x8007, 0x18AD, 0x0007, 0x18AE, 0x00F6, 0x0119, 0x0118, 0x10CF, 0x20AD, 0x20AD,
+  0x8030, 0x18AD, 0x0003, 0xB0F1, 0xA8F1, 0xB0F1, 0x8007, 0xFD2D, 0x0003, 0xE44E, 0x8191, 0x9A12, 0x8007, 0xD395, 0x0001, 0xEC71,
+  0x800A, 0xFD2D, 0x0003, 0xC34F, 0x8191, 0xAA93, 0x8007, 0xD395, 0x0001, 0xF4CF, 0x800A, 0xFD2D, 0x0003, 0xC34F, 0x8191, 0xAA93,
+  0x8007, 0xD395, 0x0004, 0xF4CF, 0xC34F, 0x8191, 0xB2D4, 0x800A, 0xD395, 0x000A, 0xDBD4, 0xE431, 0xEC71, 0xEC71, 0xDBF0, 0xE450,
+  0xF4CF, 0xFD0E, 0x8191, 0x8191, 0x8007, 0xD395, 0x0009, 0xDBD4, 0xF4AF, 0xF4CF, 0xF4AF, 0xDC10, 0x9A12, 0xAA73, 0xD395, 0xD396,
+  0x8005, 0xD395, 0x0001, 0xEC71, 0x8010, 0xFD2D, 0x0007, 0xFD2C, 0xFD2C, 0x9211, 0x8191, 0xD375, 0xD395, 0xD396, 0x8006, 0xD395,
+  0x0006, 0xEC71, 0xFCEE, 0xFD2D, 0xC36F, 0x8191, 0xAA93, 0x8007, 0xD395, 0x0007, 0xDC10, 0xE44E, 0xDC2E, 0xE44E, 0xB2F0, 0x8191,
+  0xAA93, 0x8007, 0xD395, 0x0001, 0xEC71, 0x8008, 0xFD2D, 0x0003, 0xA270, 0x8191, 0xC314, 0x8007, 0xD395, 0x000C, 0xFD2E, 0xFD2F,
+  0xFD2F, 0xFD4F, 0xFD50, 0xFD50, 0xFD51, 0xFD51, 0xFD71, 0xA8F1, 0xB0F1, 0xB0F2, 0x8008, 0x001F, 0x0018, 0x003F, 0x005F, 0x005F,
+  0x007F, 0x007F, 0x023F, 0x073B, 0x07AB, 0x07E8, 0x07F9, 0x07FF, 0xA152, 0xA8F1, 0x7132, 0x4132, 0x4131, 0x3911, 0x3910, 0x38F0,
+  0x30F0, 0x30EF, 0x28CF, 0x28CE, 0x28CE, 0x8003, 0x20CE, 0x8006, 0x20AD, 0x8016, 0x18AD, 0x8006, 0x18AD, 0x000E, 0x18AE, 0x00F6,
+  0x0119, 0x0118, 0x18CF, 0x18AD, 0x18AD, 0x20AD, 0x18AD, 0x18AD, 0x20AD, 0x18AD, 0x18AD, 0x18CD, 0x802A, 0x18AD, 0x0003, 0xA8F1,
+  0xA8F1, 0xA8F2, 0x8004, 0xFD6D, 0x0006, 0xFD4D, 0xFD6D, 0xFD6D, 0xE46E, 0x8191, 0x9212, 0x8007, 0xD395, 0x0001, 0xEC71, 0x800A,
+  0xFD6D, 0x0003, 0xC36F, 0x8191, 0xAA93, 0x8007, 0xD395, 0x0001, 0xF4EF, 0x800A, 0xFD6D, 0x0003, 0xC36F, 0x8191, 0xAA93, 0x8007,
+  0xD395, 0x0009, 0xF4EF, 0xFD2D, 0x9211, 0x89B2, 0xCB75, 0xD396, 0xD375, 0xD395, 0xD396, 0x800C, 0xD395, 0x0003, 0xEC91, 0x8191,
+  0x8191, 0x800C, 0xD395, 0x0001, 0xCB95, 0x8008, 0xD395, 0x0001, 0xEC71, 0x800D, 0xFD6D, 0x0001, 0xFD4D, 0x8004, 0xFD6D, 0x0003,
+  0xBB2F, 0x8191, 0xB2D4, 0x800B, 0xD395, 0x0003, 0xC314, 0x8191, 0xAA93, 0x800A, 0xD395, 0x0001, 0xD375, 0x800A, 0xD395, 0x0001,
+  0xEC71, 0x8008, 0xFD6D, 0x0003, 0xA290, 0x8191, 0xC314, 0x8007, 0xD395, 0x0009, 0xFD6E, 0xFD6F, 0xFD6F, 0xFD8F, 0xFD90, 0xFD90,
+  0xFD91, 0xFD91, 0xFD92, 0x8003, 0xA8F1, 0x8007, 0x001F, 0x001B, 0x003F, 0x003F, 0x005F, 0x005F, 0x007F, 0x009F, 0x023F, 0x0779,
+  0x07AA, 0x07E8, 0x07FB, 0x07FF, 0xA8F1, 0xA8F1, 0x5932, 0x4932, 0x4131, 0x3911, 0x3910, 0x38F0, 0x30EF, 0x30EF, 0x28CF, 0x28CE,
+  0x28CE, 0x20CE, 0x20CE, 0x8007, 0x20AD, 0x8016, 0x18AD, 0x8004, 0x18AD, 0x0009, 0x20AD, 0x18CD, 0x0116, 0x0119, 0x0118, 0x18CF,
+  0x18AD, 0x18AD, 0x20AD, 0x8004, 0x18AD, 0x0001, 0x20AD, 0x802B, 0x18AD, 0x0001, 0x20AD, 0x8003, 0xA8F1, 0x0004, 0xEC6F, 0xFD8D,
+  0xFDAD, 0xFD8D, 0x8003, 0xFDAD, 0x0003, 0xE48E, 0x8191, 0x9A12, 0x8007, 0xD395, 0x0002, 0xEC91, 0xFDAD, 0x8009, 0xFD8D, 0x0003,
+  0xC38F, 0x8191, 0xAA93, 0x8007, 0xD395, 0x000E, 0xF52F, 0xFDAD, 0xFD8D, 0xFDAD, 0xFD8D, 0xFD8D, 0xFDAD, 0xFD8D, 0xFD8D, 0xFDAD,
+  0xFDAD, 0xC38F, 0x8191, 0xAA93, 0x8007, 0xD395, 0x0005, 0xF52F, 0xFD8D, 0xE4AE, 0x8991, 0x9A32, 0x8010, 0xD395, 0x0003, 0xE491,
+  0x8191, 0x8191, 0x8007, 0xD395, 0x0001, 0xD396, 0x800D, 0xD395, 0x0003, 0xEC91, 0xFDAD, 0xFDAD, 0x8008, 0xFD8D, 0x000B, 0xFDAD,
+  0xFDAD, 0xFD8D, 0xFD8D, 0xFDAD, 0xFDAD, 0xFD8D, 0xFDAD, 0xF52D, 0x8191, 0x91F2, 0x8004, 0xD395, 0x0004, 0xD376, 0xD395, 0xD395,
+  0xD396, 0x8003, 0xD395, 0x0003, 0xC314, 0x8191, 0xAA93, 0x8015, 0xD395, 0x0003, 0xEC91, 0xFD8D, 0xFD8D, 0x8005, 0xFDAD, 0x0004,
+  0xFD8D, 0xA290, 0x8191, 0xC314, 0x8007, 0xD395, 0x8004, 0xFDAF, 0x0008, 0xFDB0, 0xFDB0, 0xFDB1, 0xFDD1, 0xE4B2, 0xA911, 0xA8F1,
+  0xA8F1, 0x8007, 0x001F, 0x001C, 0x003F, 0x005F, 0x005F, 0x007F, 0x007F, 0x009F, 0x02BF, 0x0778, 0x07C8, 0x07E9, 0x07FD, 0x173E,
+  0xA8F1, 0x9912, 0x4932, 0x4932, 0x4131, 0x4111, 0x3911, 0x38F0, 0x30EF, 0x30EF, 0x28CF, 0x28CE, 0x28CE, 0x20CE, 0x20CE, 0x20CD,
+  0x8005, 0x20AD, 0x0002, 0x18AD, 0x20AD, 0x8015, 0x18AD, 0x8004, 0x18AD, 0x0005, 0x18CD, 0x00F7, 0x0119, 0x0118, 0x18CF, 0x8003,
+  0x18AD, 0x0001, 0x18AC, 0x8005, 0x18AD, 0x0001, 0x18CD, 0x802B, 0x18AD, 0x8003, 0xA911, 0x0003, 0xEC8E, 0xFDED, 0xFDED, 0x8003,
+  0xFDCD, 0x0004, 0xFDED, 0xE4CE, 0x8191, 0x9A12, 0x8007, 0xD395, 0x0001, 0xECB1, 0x800A, 0xFDCD, 0x0003, 0xC3AF, 0x8191, 0xAA93,
+  0x8007, 0xD395, 0x0004, 0xF54F, 0xFDCD, 0xFDCD, 0xFDED, 0x8005, 0xFDCD, 0x0005, 0xFDED, 0xFDCD, 0xC3AF, 0x8191, 0xAA93, 0x8007,
+  0xD395, 0x0006, 0xF54F, 0xFDED, 0xFDCD, 0xD44F, 0x8191, 0xB2B3, 0x800A, 0xD395, 0x0001, 0xD396, 0x8004, 0xD395, 0x0003, 0xECB1,
+  0x8991, 0x8191, 0x800C, 0xD395, 0x0001, 0xD396, 0x8008, 0xD395, 0x0001, 0xECB1, 0x8013, 0xFDCD, 0x0003, 0xBB6F, 0x8191, 0xBAF4,
+  0x8005, 0xD395, 0x0001, 0xD375, 0x8004, 0xD395, 0x0003, 0xC314, 0x8191, 0xAA93, 0x8015, 0xD395, 0x0005, 0xECB1, 0xFDED, 0xFDED,
+  0xFDCD, 0xFDCD, 0x8004, 0xFDED, 0x0003, 0xA2B0, 0x8191, 0xC314, 0x8006, 0xD395, 0x0004, 0xD375, 0xFDEE, 0xFDEF, 0xFDEF, 0x8003,
+  0xFDF0, 0x0006, 0xFDF1, 0xFDF1, 0xECB1, 0xA0F1, 0xA911, 0xA911, 0x8007, 0x001F, 0x8003, 0x005F, 0x0013, 0x007F, 0x009F, 0x009F,
+  0x041F, 0x0797, 0x07C7, 0x07EB, 0x07FE, 0x2E5C, 0xA8F1, 0x7932, 0x4932, 0x4932, 0x4111, 0x3911, 0x3910, 0x38F0, 0x30EF, 0x30EF,
+  0x8003, 0x28CE, 0x0003, 0x20CE, 0x20CE, 0x20CD, 0x8005, 0x20AD, 0x8017, 0x18AD, 0x8004, 0x18AD, 0x0004, 0x00F7, 0x0118, 0x0117,
+  0x18CF, 0x8006, 0x18AD, 0x0001, 0x18AC, 0x8004, 0x18AD, 0x0001, 0x20AC, 0x802A, 0x18AD, 0x0004, 0xA911, 0xA911, 0xA111, 0xE42E,
+  0x8006, 0xFE0D, 0x0003, 0xE4EE, 0x8191, 0x9A12, 0x8007, 0xD395, 0x0001, 0xECD1, 0x800A, 0xFE0D, 0x0003, 0xC3CF, 0x8191, 0xAA93,
+  0x8007, 0xD395, 0x0001, 0xF56F, 0x800A, 0xFE0D, 0x0003, 0xC3CF, 0x8191, 0xAA93, 0x8007, 0xD395, 0x0001, 0xF56F, 0x8003, 0xFE0D,
+  0x0003, 0xD44F, 0x8191, 0xBAD3, 0x8005, 0xD395, 0x0001, 0xD376, 0x8005, 0xD395, 0x0006, 0xD396, 0xD395, 0xD395, 0xECD1, 0x8191,
+  0x8191, 0x800F, 0xD395, 0x0001, 0xD375, 0x8005, 0xD395, 0x0001, 0xECD1, 0x8013, 0xFE0D, 0x0004, 0xF5AD, 0x9A70, 0x89B1, 0xD375,
+  0x8009, 0xD395, 0x0003, 0xC314, 0x8191, 0xAA93, 0x800D, 0xD395, 0x0001, 0xD396, 0x8007, 0xD395, 0x0001, 0xECD1, 0x8003, 0xFE0D,
+  0x0002, 0xFE0E, 0xFE0D, 0x8003, 0xFE0E, 0x0003, 0xA2B0, 0x8191, 0xC314, 0x8007, 0xD395, 0x8003, 0xFE0F, 0x8003, 0xFE30, 0x0006,
+  0xFE31, 0xFE31, 0xDC32, 0xA111, 0xA911, 0xA111, 0x8007, 0x001F, 0x0018, 0x005F, 0x005F, 0x007F, 0x007F, 0x009F, 0x00BF, 0x043F,
+  0x0794, 0x07E6, 0x07EC, 0x07FE, 0x35DB, 0xA911, 0x5133, 0x4932, 0x4132, 0x4111, 0x4111, 0x3910, 0x30F0, 0x30EF, 0x30EF, 0x28CE,
+  0x28CE, 0x8003, 0x20CE, 0x0001, 0x20CD, 0x8005, 0x20AD, 0x8017, 0x18AD, 0x000C, 0x18AC, 0x18AD, 0x18AE, 0x00F6, 0x0119, 0x00F8,
+  0x18CF, 0x20AD, 0x18AD, 0x20AD, 0x18AC, 0x20AD, 0x8031, 0x18AD, 0x0005, 0x18AC, 0x80F0, 0xA111, 0xA111, 0xC2B0, 0x8006, 0xFE4D,
+  0x0003, 0xE50E, 0x8191, 0x9A12, 0x8007, 0xD395, 0x0001, 0xECF1, 0x800A, 0xFE4D, 0x0003, 0xC3EF, 0x8991, 0xAA93, 0x8003, 0xD395,
+  0x0001, 0xD375, 0x8003, 0xD395, 0x0001, 0xF58F, 0x800A, 0xFE4D, 0x0005, 0xC3EF, 0x8191, 0xAA93, 0xD395, 0xD396, 0x8005, 0xD395,
+  0x0001, 0xF58F, 0x8004, 0xFE4D, 0x0004, 0xE50E, 0x89D1, 0xA253, 0xCB75, 0x8006, 0xD395, 0x0001, 0xD376, 0x8005, 0xD395, 0x0003,
+  0xECF1, 0x8191, 0x8191, 0x8015, 0xD395, 0x0001, 0xECF1, 0x8014, 0xFE4D, 0x0004, 0xF60E, 0x9A70, 0x91F2, 0xCB75, 0x8006, 0xD395,
+  0x000A, 0xD396, 0xD395, 0xC314, 0x8191, 0xAA93, 0xD395, 0xD396, 0xD395, 0xD395, 0xD375, 0x8010, 0xD395, 0x0001, 0xECF2, 0x8003,
+  0xFE4D, 0x000A, 0xFE4E, 0xFE4D, 0xFE4E, 0xFE4D, 0xFE4E, 0xA2D0, 0x8191, 0xC314, 0xD395, 0xD396, 0x8005, 0xD395, 0x000C, 0xFE4E,
+  0xFE4F, 0xFE6F, 0xFE70, 0xFE50, 0xFE50, 0xFE71, 0xFE51, 0xBA52, 0xA111, 0xA111, 0x78D5, 0x8007, 0x001F, 0x0016, 0x005F, 0x007F,
+  0x007F, 0x009F, 0x00BF, 0x00BF, 0x043F, 0x07B3, 0x07C5, 0x07EE, 0x07FF, 0x5478, 0x6AD6, 0x4953, 0x4932, 0x4912, 0x4111, 0x3911,
+  0x3910, 0x30F0, 0x30EF, 0x28CF, 0x8003, 0x28CE, 0x0003, 0x20CE, 0x20CD, 0x20CD, 0x8005, 0x20AD, 0x8017, 0x18AD, 0x000C, 0x18AD,
+  0x18AD, 0x00F6, 0x0118, 0x00F8, 0x18CF, 0x18AC, 0x20AD, 0x20AD, 0x18AD, 0x18AD, 0x20AD, 0x8030, 0x18AD, 0x0007, 0x20AD, 0x18AC,
+  0x60EF, 0xA111, 0xA111, 0xA112, 0xFE2D, 0x8005, 0xFE8D, 0x0003, 0xE54E, 0x8191, 0x9A12, 0x8005, 0xD395, 0x0003, 0xD375, 0xD395,
+  0xED11, 0x8009, 0xFE6D, 0x0006, 0xFE8D, 0xC40F, 0x8191, 0xAA93, 0xD395, 0xD396, 0x8004, 0xD395, 0x0003, 0xD375, 0xF5CF, 0xFE6D,
+  0x8008, 0xFE8D, 0x0004, 0xFE6D, 0xC40F, 0x8191, 0xAA93, 0x8007, 0xD395, 0x000A, 0xF5CE, 0xFE6D, 0xFE6D, 0xFE8D, 0xFE6C, 0xFE8D,
+  0xF62D, 0xC40F, 0x9A12, 0xB2D4, 0x800B, 0xD395, 0x0003, 0xECF1, 0x8191, 0x8191, 0x8015, 0xD395, 0x0001, 0xED11, 0x800A, 0xFE6D,
+  0x0001, 0xFE8D, 0x8007, 0xFE6D, 0x0007, 0xFE6C, 0xFE8D, 0xFE6D, 0xFE2D, 0xBBCF, 0x89B1, 0xBAF4, 0x8003, 0xD395, 0x0007, 0xD375,
+  0xD395, 0xD395, 0xD396, 0xC314, 0x8191, 0xAA93, 0x8015, 0xD395, 0x0001, 0xED12, 0x8008, 0xFE8E, 0x0003, 0xA2D0, 0x8191, 0xC314,
+  0x8007, 0xD395, 0x8003, 0xFE8F, 0x8003, 0xFE90, 0x000A, 0xFE91, 0xE471, 0xA111, 0xA112, 0xA111, 0x60D5, 0x001F, 0x283C, 0x7097,
+  0x405A, 0x8003, 0x001F, 0x001C, 0x003F, 0x007F, 0x009F, 0x00BF, 0x00BF, 0x00DF, 0x045F, 0x07D2, 0x07E4, 0x07EF, 0x07FF, 0x2E3C,
+  0x2D1A, 0x5133, 0x4932, 0x4132, 0x3911, 0x3911, 0x38F0, 0x30F0, 0x30EF, 0x28CF, 0x28CE, 0x28CE, 0x20CE, 0x20CE, 0x20CD, 0x20CD,
+  0x8005, 0x20AD, 0x8017, 0x18AD, 0x000C, 0x18AD, 0x00F6, 0x0118, 0x00F7, 0x18CF, 0x18AD, 0x18AD, 0x20AD, 0x18AD, 0x18AD, 0x20AD,
+  0x18AC, 0x8032, 0x18AD, 0x0001, 0x28CD, 0x8003, 0xA111, 0x0001, 0xCBCF, 0x8005, 0xFEAD, 0x0003, 0xF5ED, 0x89D1, 0x91D2, 0x8005,
+  0xD395, 0x0003, 0xD396, 0xD395, 0xED11, 0x800A, 0xFEAD, 0x0003, 0xC42F, 0x81B1, 0xAA93, 0x8007, 0xD395, 0x0001, 0xF5EF, 0x8008,
+  0xFEAD, 0x0008, 0xFECC, 0xFEAD, 0xC42F, 0x8191, 0xAA93, 0xD395, 0xD395, 0xD396, 0x8004, 0xD395, 0x000F, 0xF5EF, 0xFEAD, 0xFEAC,
+  0xFEAD, 0xFEAD, 0xFEAC, 0xFEAD, 0xFEAD, 0xF64D, 0xD4CE, 0xBBD0, 0xC3B2, 0xC314, 0xD395, 0xD375, 0x8006, 0xD395, 0x0003, 0xED12,
+  0x8191, 0x8191, 0x8011, 0xD395, 0x0001, 0xD375, 0x8003, 0xD395, 0x0003, 0xED31, 0xFEAC, 0xFEAC, 0x8015, 0xFEAD, 0x0005, 0xEE0D,
+  0xCC6F, 0xBB51, 0xBAD4, 0xCB55, 0x8004, 0xD395, 0x0003, 0xC334, 0x8191, 0xB294, 0x8013, 0xD395, 0x000E, 0xD375, 0xD395, 0xED11,
+  0xFEAE, 0xFECE, 0xFEAD, 0xFEAE, 0xFEAD, 0xFECE, 0xFEAE, 0xFEAE, 0xA2F0, 0x8191, 0xC314, 0x8006, 0xD395, 0x0011, 0xDC34, 0xFEAF,
+  0xFED0, 0xFEAF, 0xFED0, 0xFEB0, 0xFED1, 0xE491, 0xA911, 0xA111, 0x9931, 0xA111, 0x58D6, 0x88B5, 0xB8D1, 0xB8D1, 0x5059, 0x8004,
+  0x001F, 0x001A, 0x007F, 0x009F, 0x00BF, 0x00FF, 0x00DF, 0x047F, 0x07D2, 0x07E3, 0x07F1, 0x07FF, 0x07FF, 0x2CBA, 0x4933, 0x4132,
+  0x4131, 0x4111, 0x38F0, 0x38F0, 0x30F0, 0x30EF, 0x28EF, 0x28CE, 0x28CE, 0x20CE, 0x20CD, 0x20CD, 0x8006, 0x20AD, 0x8017, 0x18AD,
+  0x000A, 0x00F6, 0x0118, 0x0118, 0x18CF, 0x20AD, 0x18AC, 0x18AC, 0x18AD, 0x18AD, 0x18AC, 0x8032, 0x18AD, 0x0008, 0x20AC, 0x20AD,
+  0x18AD, 0x8110, 0x9911, 0xA111, 0xA171, 0xF5ED, 0x8006, 0xFEAD, 0x0009, 0xFEAC, 0xFE6D, 0xF5CF, 0xF5EF, 0xF5CF, 0xF5CF, 0xF5EF,
+  0xF5CF, 0xFE4D, 0x800C, 0xFEAD, 0x0005, 0xFE4E, 0xF5EF, 0xF5EF, 0xF5CF, 0xF5EE, 0x8003, 0xF5EF, 0x0001, 0xFE8D, 0x8004, 0xFEAC,
+  0x0002, 0xFEAD, 0xFE8D, 0x8003, 0xFEAD, 0x0008, 0xFEAC, 0xFEAC, 0xFEAD, 0xF64D, 0xF5EF, 0xF5CF, 0xF5EF, 0xF5CF, 0x8003, 0xF5EF,
+  0x0001, 0xFE6E, 0x8005, 0xFEAD, 0x0002, 0xFEAC, 0xFEAC, 0x8004, 0xFEAD, 0x000C, 0xFEAC, 0xFEAD, 0xFEAD, 0xF60E, 0xF5EF, 0xF5CF,
+  0xF5EF, 0xF5EF, 0xF5CF, 0xF64E, 0xFEAC, 0xFEAD, 0x8010, 0xF5EF, 0x0001, 0xF5CF, 0x8003, 0xF5EF, 0x0003, 0xF5CF, 0xFE4D, 0xFEAC,
+  0x8009, 0xFEAD, 0x0001, 0xFEAC, 0x8009, 0xFEAD, 0x0001, 0xFEAC, 0x8007, 0xFEAD, 0x000E, 0xFE6D, 0xF5EF, 0xF5EF, 0xF5CF, 0xF5CF,
+  0xFEAD, 0xF62E, 0xF5EF, 0xF5D0, 0xF5EF, 0xF5CF, 0xF5F0, 0xF5F0, 0xF5EF, 0x800C, 0xF5F0, 0x0004, 0xF5EF, 0xF5F0, 0xFE4F, 0xFECE,
+  0x8008, 0xFEAE, 0x0003, 0xFEAF, 0xF610, 0xF5D0, 0x8004, 0xF5F0, 0x0001, 0xF610, 0x8003, 0xFEAF, 0x000E, 0xFED0, 0xFEB0, 0xFEB1,
+  0xE471, 0xB8D1, 0xA111, 0x9931, 0x9931, 0x9912, 0x6933, 0xB0F1, 0xB0D1, 0xB0D1, 0x283C, 0x8003, 0x001F, 0x001B, 0x003F, 0x007F,
+  0x00BF, 0x00DF, 0x00FF, 0x011F, 0x047F, 0x07D1, 0x07E3, 0x07F3, 0x07FF, 0x07FF, 0x3B77, 0x4932, 0x4932, 0x4131, 0x4111, 0x38F0,
+  0x38F0, 0x30EF, 0x30EF, 0x28EF, 0x28CE, 0x28CE, 0x20CE, 0x20CD, 0x20CD, 0x8004, 0x20AD, 0x8004, 0x18AD, 0x0001, 0x18AC, 0x8014,
+  0x18AD, 0x000B, 0x0118, 0x0117, 0x18CF, 0x18AD, 0x18AC, 0x18AC, 0x18AD, 0x18AC, 0x20AD, 0x18AC, 0x20AC, 0x8031, 0x18AC, 0x0004,
+  0x18CD, 0x18AC, 0x20AC, 0x38CE, 0x8003, 0x9931, 0x0004, 0xAA31, 0xFE2D, 0xFE8C, 0xFE8D, 0x8003, 0xFE8C, 0x000A, 0xFEAD, 0xFE8C,
+  0xFEAC, 0xFEAC, 0xFE8C, 0xFE8C, 0xFEAC, 0xFEAD, 0xFE8D, 0xFE8C, 0x8008, 0xFEAD, 0x0032, 0xFE8C, 0xFE8C, 0xFEAC, 0xFEAC, 0xFEAD,
+  0xFE8C, 0xFEAD, 0xFE8C, 0xFE8D, 0xFE8D, 0xFE8C, 0xFEAD, 0xFE8C, 0xFE8C, 0xFEAD, 0xFEAD, 0xFEAC, 0xFEAC, 0xFE8C, 0xFE8C, 0xFEAC,
+  0xFE8C, 0xFEAC, 0xFEAD, 0xFEAD, 0xFE8D, 0xFE8C, 0xFEAD, 0xFE8D, 0xFE8C, 0xFE8D, 0xFE8C, 0xFE8D, 0xFEAC, 0xFE8C, 0xFEAC, 0xFE8D,
+  0xFEAD, 0xFEAD, 0xFE8C, 0xFEAC, 0xFE8C, 0xFE8C, 0xFE8D, 0xFE8C, 0xFEAC, 0xFE8D, 0xFE8C, 0xFEAD, 0xFEAD, 0x8003, 0xFE8C, 0x0003,
+  0xFEAD, 0xFE8C, 0xFEAC, 0x8010, 0xFEAD, 0x0007, 0xFE8C, 0xFEAC, 0xFE8D, 0xFEAC, 0xFEAD, 0xFEAD, 0xFE8C, 0x8011, 0xFEAD, 0x0004,
+  0xFEAC, 0xFE8C, 0xFEAD, 0xFE8C, 0x8004, 0xFE8D, 0x8003, 0xFEAD, 0x0001, 0xFE8D, 0x8004, 0xFEAD, 0x0006, 0xFE8D, 0xFE8E, 0xFEAD,
+  0xFEAE, 0xFEAE, 0xFEAD, 0x800C, 0xFEAE, 0x0002, 0xFE8E, 0xFE8E, 0x8003, 0xFEAE, 0x0001, 0xFE8E, 0x8003, 0xFEAE, 0x0008, 0xFE8E,
+  0xFE8E, 0xFEAE, 0xFEAF, 0xFEAE, 0xFEAE, 0xFEAF, 0xFE8E, 0x8005, 0xFEAF, 0x0010, 0xFE8F, 0xFEB0, 0xFEAF, 0xFEB0, 0xFE90, 0xE471,
+  0xB8D2, 0xA111, 0x9911, 0x9931, 0x9931, 0x7132, 0x7133, 0xB0F1, 0xB0D1, 0xB0D2, 0x8005, 0x001F, 0x001A, 0x007F, 0x00DF, 0x00DF,
+  0x011F, 0x011F, 0x049F, 0x07F0, 0x07E2, 0x07F4, 0x07FF, 0x07FF, 0x3AF6, 0x4932, 0x4932, 0x4111, 0x3911, 0x3910, 0x38F0, 0x30EF,
+  0x30EF, 0x28EE, 0x28CE, 0x28CE, 0x20CE, 0x20CD, 0x20CD, 0x8003, 0x20AD, 0x0004, 0x18AC, 0x20AC, 0x18AD, 0x18AD, 0x8016, 0x18AC,
+  0x000B, 0x0117, 0x18CF, 0x20AC, 0x20AC, 0x20AD, 0x18AC, 0x18AC, 0x20AC, 0x20AC, 0x18AC, 0x20AC, 0x8033, 0x18AC, 0x000A, 0x20AD,
+  0x20AC, 0x60EF, 0x9912, 0x9931, 0x9931, 0xB270, 0xF62D, 0xFE8C, 0xFE8C, 0x8003, 0xFE8D, 0x0002, 0xFE8C, 0xFE8D, 0x8004, 0xFE8C,
+  0x8003, 0xFE8D, 0x8009, 0xFE8C, 0x0003, 0xFE8D, 0xFE8C, 0xFE8C, 0x8003, 0xFE8D, 0x0003, 0xFE8C, 0xFE8D, 0xFE8C, 0x8004, 0xFE8D,
+  0x0001, 0xFE8C, 0x8009, 0xFE8D, 0x0002, 0xFE8C, 0xFE8D, 0x8004, 0xFE8C, 0x0001, 0xFE8D, 0x8003, 0xFE8C, 0x0002, 0xFE8D, 0xFE8D,
+  0x8003, 0xFE8C, 0x0005, 0xFE8D, 0xFE8D, 0xFE8C, 0xFE8C, 0xFE8D, 0x8004, 0xFE8C, 0x0004, 0xFE8D, 0xFE8D, 0xFE8C, 0xFE8D, 0x8003,
+  0xFE8C, 0x8013, 0xFE8D, 0x0006, 0xFE8C, 0xFE8C, 0xFE6D, 0xFE8D, 0xFE8C, 0xFE8D, 0x800B, 0xFE8C, 0x8005, 0xFE8D, 0x0001, 0xFE8C,
+  0x800A, 0xFE8D, 0x0001, 0xFE8E, 0x8005, 0xFE8D, 0x8011, 0xFE8E, 0x000B, 0xFE8F, 0xFE8E, 0xFE8E, 0xFE8F, 0xFE8F, 0xFE8E, 0xFE8F,
+  0xFE8F, 0xFE8E, 0xFE8F, 0xFE8E, 0x800B, 0xFE8F, 0x0010, 0xFE90, 0xFE90, 0xFEB0, 0xFEB0, 0xE471, 0xB8D1, 0xA111, 0x9931, 0x9931,
+  0x9912, 0x8911, 0x5174, 0x6953, 0xB0F1, 0xB0D1, 0x90B4, 0x8004, 0x001F, 0x0015, 0x003F, 0x009F, 0x00DF, 0x00FF, 0x011F, 0x015F,
+  0x049F, 0x07F1, 0x07E2, 0x07F6, 0x07FF, 0x0F9F, 0x4A35, 0x4933, 0x4932, 0x4131, 0x3910, 0x3910, 0x38F0, 0x30EF, 0x30EF, 0x8003,
+  0x28CE, 0x8003, 0x20CD, 0x8003, 0x20AD, 0x0006, 0x18AC, 0x20AC, 0x20AC, 0x18AC, 0x18AC, 0x20AC, 0x8014, 0x18AC, 0x0006, 0x18CE,
+  0x18AC, 0x20CC, 0x20AC, 0x18AC, 0x18AC, 0x8003, 0x20AC, 0x0003, 0x20AD, 0x18CC, 0x20AD, 0x8032, 0x20AC, 0x000A, 0x18AC, 0x20AC,
+  0x28AD, 0x8110, 0x9931, 0x9931, 0x9911, 0xAA31, 0xF5CD, 0xFE8C, 0x8016, 0xFE6C, 0x0004, 0xFE6D, 0xFE6C, 0xFE6C, 0xFE6D, 0x800F,
+  0xFE6C, 0x0001, 0xFE8C, 0x8005, 0xFE6C, 0x0006, 0xFE6D, 0xFE6C, 0xFE6C, 0xFE6D, 0xFE6C, 0xFE6D, 0x8004, 0xFE6C, 0x0001, 0xFE6D,
+  0x800B, 0xFE6C, 0x0001, 0xFE6D, 0x801A, 0xFE6C, 0x0003, 0xFE8C, 0xFE6D, 0xFE6D, 0x8012, 0xFE6C, 0x0004, 0xFE6D, 0xFE6C, 0xFE6D,
+  0xFE6C, 0x8004, 0xFE6D, 0x0001, 0xFE6C, 0x8003, 0xFE6D, 0x0005, 0xFE8E, 0xFE8D, 0xFE8D, 0xFE6E, 0xFE8D, 0x800B, 0xFE6E, 0x8004,
+  0xFE6F, 0x0002, 0xFE8F, 0xFE8F, 0x8003, 0xFE6F, 0x0018, 0xFE8F, 0xFE6F, 0xFE6F, 0xFE8F, 0xFE8F, 0xFE6F, 0xFE6F, 0xFE8F, 0xFE6F,
+  0xFE6F, 0xFE8F, 0xFE8F, 0xFE6F, 0xFE8F, 0xFE8F, 0xFE6F, 0xFE90, 0xFE8F, 0xFE8F, 0xFE90, 0xFE90, 0xE471, 0xB0D1, 0xA111, 0x8003,
+  0x9931, 0x0007, 0x9912, 0x5953, 0x5153, 0x7133, 0xB0D1, 0xB0D1, 0x7896, 0x8003, 0x001F, 0x0013, 0x003F, 0x005F, 0x00BF, 0x011F,
+  0x011F, 0x013F, 0x017F, 0x04BF, 0x07F2, 0x07E2, 0x07F5, 0x07FF, 0x7336, 0x5153, 0x4933, 0x4932, 0x4131, 0x4110, 0x3910, 0x8003,
+  0x30EF, 0x0003, 0x28CE, 0x28CE, 0x28CD, 0x8003, 0x20CD, 0x8003, 0x20AD, 0x0005, 0x20AC, 0x20AC, 0x20AD, 0x18AC, 0x18AC, 0x8015,
+  0x20AC, 0x0005, 0x20AC, 0x20AC, 0x18AC, 0x18AC, 0x20AC, 0x8006, 0x18AC, 0x8031, 0x20AC, 0x0007, 0x18AC, 0x18AC, 0x20AC, 0x20AC,
+  0x18AC, 0x28AD, 0x9111, 0x8003, 0x9931, 0x0004, 0xA171, 0xCBCF, 0xF60D, 0xFE4D, 0x8009, 0xFE6D, 0x0001, 0xFE4D, 0x800D, 0xFE6D,
+  0x0003, 0xFE6C, 0xFE6D, 0xFE4D, 0x8005, 0xFE6D, 0x0001, 0xFE4D, 0x8005, 0xFE6D, 0x0003, 0xFE4D, 0xFE6D, 0xFE6C, 0x8008, 0xFE6D,
+  0x0001, 0xFE4D, 0x8003, 0xFE6D, 0x0001, 0xFE4D, 0x8006, 0xFE6D, 0x0003, 0xFE6C, 0xFE6D, 0xFE4D, 0x8009, 0xFE6D, 0x0001, 0xFE4D,
+  0x802D, 0xFE6D, 0x0001, 0xFE4D, 0x8003, 0xFE6D, 0x0005, 0xFE4D, 0xFE6E, 0xFE6E, 0xFE4E, 0xFE6D, 0x8005, 0xFE6E, 0x0003, 0xFE6F,
+  0xFE6E, 0xFE6E, 0x8012, 0xFE6F, 0x0003, 0xFE70, 0xFE70, 0xFE6F, 0x8009, 0xFE70, 0x0001, 0xFE90, 0x8004, 0xFE70, 0x8003, 0xFE71,
+  0x002A, 0xE471, 0xA8F1, 0xA111, 0x9931, 0x9932, 0x9931, 0x9931, 0x6933, 0x5153, 0x5953, 0x7153, 0xB0D1, 0xB0D1, 0x5878, 0x001F,
+  0x001F, 0x003F, 0x007F, 0x009F, 0x00FF, 0x013F, 0x013F, 0x017F, 0x019F, 0x033F, 0x07F3, 0x07E2, 0x07F3, 0x07FF, 0xA8F1, 0x6932,
+  0x4932, 0x4932, 0x4931, 0x4111, 0x3910, 0x3110, 0x30EF, 0x30EF, 0x28CE, 0x28CE, 0x28CD, 0x8003, 0x20CD, 0x8003, 0x20AD, 0x0003,
+  0x20AC, 0x20AC, 0x20AD, 0x8017, 0x20AC, 0x0004, 0x18CC, 0x18AC, 0x18AC, 0x20AC, 0x8039, 0x18AC, 0x0001, 0x20AC, 0x8003, 0x18AC,
+  0x0012, 0x20AC, 0x28CD, 0x8111, 0x9931, 0x9912, 0x9931, 0x9931, 0x9911, 0xBAB0, 0xDC6F, 0xE50F, 0xE50E, 0xFE4E, 0xFE6E, 0xFE4E,
+  0xFE6D, 0xFE4E, 0xFE4E, 0x8061, 0xFE4D, 0x0002, 0xFE4E, 0xFE4E, 0x8006, 0xFE4D, 0x8004, 0xFE4E, 0x0002, 0xFE6E, 0xFE6E, 0x8003,
+  0xFE4E, 0x0005, 0xFE6E, 0xFE6E, 0xFE4E, 0xFE6F, 0xFE6E, 0x8006, 0xFE6F, 0x0004, 0xFE4F, 0xFE6F, 0xFE70, 0xFE50, 0x8010, 0xFE70,
+  0x800D, 0xFE71, 0x0005, 0xF612, 0xE531, 0xE512, 0xD472, 0xB271, 0x8003, 0x9931, 0x0027, 0x9911, 0x9931, 0x9911, 0x6153, 0x5153,
+  0x5954, 0x5954, 0x7154, 0xB0F1, 0xB0F1, 0x285C, 0x003F, 0x005F, 0x007F, 0x00BF, 0x00FF, 0x013F, 0x015F, 0x017F, 0x019F, 0x01BF,
+  0x02FF, 0x07F4, 0x07E3, 0x07F1, 0x2E5C, 0xA911, 0x6932, 0x5132, 0x4931, 0x4132, 0x4110, 0x3910, 0x3910, 0x30EF, 0x30EE, 0x28CE,
+  0x28CE, 0x28CD, 0x8003, 0x20CD, 0x0003, 0x20AC, 0x20AD, 0x20AD, 0x8003, 0x20AC, 0x0003, 0x18AC, 0x18AC, 0x20AC, 0x8014, 0x18AC,
+  0x0004, 0x20AC, 0x18AC, 0x20AC, 0x18AC, 0x8038, 0x20AC, 0x0001, 0x18AC, 0x8003, 0x20AC, 0x0006, 0x18AC, 0x20AC, 0x20AC, 0x28CC,
+  0x610F, 0x9911, 0x8008, 0x9931, 0x0001, 0x9932, 0x8076, 0x9931, 0x0001, 0x9912, 0x8004, 0x9931, 0x000A, 0x9911, 0x9931, 0x9911,
+  0x9931, 0x9931, 0x9911, 0x9911, 0x9931, 0x9931, 0x9911, 0x8018, 0x9931, 0x000A, 0x9911, 0x9911, 0x9931, 0x9932, 0x9931, 0x9931,
+  0x9911, 0x9931, 0x9931, 0x9912, 0x8004, 0x9931, 0x000F, 0x8912, 0x5153, 0x5953, 0x5153, 0x5974, 0x5974, 0x7953, 0xB0F1, 0xB0D1,
+  0x087F, 0x009F, 0x00BF, 0x00DF, 0x011F, 0x015F, 0x8003, 0x019F, 0x0014, 0x01DF, 0x01DF, 0x01FF, 0x07F7, 0x07E3, 0x07EF, 0x5498,
+  0xA8F1, 0x7132, 0x4952, 0x4931, 0x4131, 0x4110, 0x3910, 0x30EF, 0x30EF, 0x30EE, 0x28CE, 0x28CE, 0x28CD, 0x8003, 0x20CD, 0x8006,
+  0x20AC, 0x0002, 0x18AC, 0x18AC, 0x8015, 0x20AC, 0x0004, 0x20AC, 0x18AC, 0x20AC, 0x18AC, 0x803A, 0x20AC, 0x0002, 0x18AC, 0x18AC,
+  0x8004, 0x20AC, 0x0006, 0x18AC, 0x40CE, 0x7910, 0x9931, 0x9931, 0x9932, 0x8003, 0x9931, 0x0001, 0x9911, 0x8079, 0x9931, 0x0005,
+  0x9911, 0x9931, 0x9931, 0xA111, 0x9911, 0x802C, 0x9931, 0x0002, 0x9912, 0x7132, 0x8003, 0x5153, 0x0026, 0x5974, 0x5974, 0x6174,
+  0x9113, 0xB0F1, 0x98F3, 0x00DF, 0x00FF, 0x011F, 0x013F, 0x017F, 0x01BF, 0x01BF, 0x01DF, 0x01DF, 0x01FF, 0x01FF, 0x021F, 0x06D9,
+  0x07E5, 0x07EC, 0x7355, 0xA8F1, 0x7932, 0x4932, 0x4931, 0x4131, 0x4110, 0x3910, 0x390F, 0x30EF, 0x30EE, 0x28CE, 0x28CE, 0x28CD,
+  0x28CD, 0x20CD, 0x20CD, 0x801D, 0x20AC, 0x803D, 0x20AC, 0x0001, 0x18AC, 0x8008, 0x20AC, 0x000E, 0x18AB, 0x30CC, 0x58CF, 0x7910,
+  0x9931, 0x9931, 0x9912, 0x9931, 0x9931, 0x9911, 0x9931, 0x9911, 0x9932, 0x9931, 0x8060, 0x9911, 0x8014, 0x9931, 0x0005, 0x9911,
+  0x9911, 0x9931, 0x9931, 0x9911, 0x8006, 0x9931, 0x0001, 0x9911, 0x8020, 0x9931, 0x0018, 0xA111, 0x9911, 0x8932, 0x6932, 0x5152,
+  0x5153, 0x5953, 0x5953, 0x5974, 0x6174, 0x6175, 0x7954, 0xA8F1, 0xB0F1, 0x80F5, 0x013F, 0x017F, 0x019F, 0x01BF, 0x01DF, 0x01FF,
+  0x01DF, 0x01FF, 0x021F, 0x8003, 0x023F, 0x000F, 0x057D, 0x07E8, 0x07E9, 0x82D5, 0xA0F1, 0x8132, 0x5132, 0x4931, 0x4131, 0x4110,
+  0x38F0, 0x38EF, 0x30EF, 0x30EE, 0x28CE, 0x8003, 0x28CD, 0x0002, 0x20CD, 0x20CD, 0x801D, 0x20AC, 0x0004, 0x18AC, 0x20AC, 0x20AC,
+  0x18AC, 0x8039, 0x20AC, 0x0001, 0x18CC, 0x800E, 0x20AC, 0x0001, 0x20AB, 0x8071, 0x20AC, 0x0004, 0x20CC, 0x20AD, 0x20CD, 0x20CD,
+  0x8005, 0x28CD, 0x0015, 0x28CE, 0x28EE, 0x28EE, 0x30EE, 0x30EF, 0x30EF, 0x30EE, 0x38EF, 0x5110, 0x6110, 0x5910, 0x6930, 0x7931,
+  0x8131, 0x8130, 0x9931, 0xA932, 0xA131, 0xB131, 0xC912, 0xC911, 0x8003, 0xC8F2, 0x0002, 0xC8D1, 0xC0D1, 0x800B, 0xC0B1, 0x0003,
+  0xC0D1, 0xB8B1, 0xC0D1, 0x8007, 0xB8D1, 0x0006, 0xB0D1, 0xB8D1, 0xB8D1, 0xB0D1, 0xB0D1, 0xB0F1, 0x8003, 0xB0D1, 0x8003, 0xB0F1,
+  0x0009, 0x5158, 0x01BF, 0x01DF, 0x01FF, 0x021F, 0x023F, 0x023F, 0x021F, 0x023F, 0x8004, 0x025F, 0x000F, 0x041F, 0x07ED, 0x07E4,
+  0x7AB4, 0xA911, 0x9112, 0x5132, 0x4931, 0x4111, 0x4110, 0x3910, 0x38EF, 0x30EF, 0x30EE, 0x30EE, 0x8003, 0x28CD, 0x0002, 0x20CD,
+  0x20CC, 0x801D, 0x20AC, 0x0003, 0x20CC, 0x20AC, 0x20AB, 0x803E, 0x20AC, 0x0001, 0x18AC, 0x8003, 0x20AC, 0x0004, 0x18AC, 0x20AC,
+  0x20AB, 0x18AC, 0x8006, 0x20AC, 0x0001, 0x20AB, 0x806E, 0x20AC, 0x0003, 0x20CC, 0x20CD, 0x20CD, 0x8004, 0x28CD, 0x0009, 0x28AD,
+  0x28CE, 0x30CE, 0x30CE, 0x30EE, 0x8151, 0xB192, 0xC9B3, 0xC9B2, 0x8003, 0xC992, 0x8003, 0xC972, 0x0002, 0xC952, 0xC952, 0x8003,
+  0xC932, 0x0008, 0xC912, 0xC912, 0xC111, 0xC8F1, 0xC8F1, 0xC8D1, 0xC0D1, 0xC8B1, 0x800B, 0xC0B1, 0x0002, 0xC0D1, 0xB8B1, 0x8007,
+  0xB8D1, 0x0001, 0xB0D2, 0x8003, 0xB8D1, 0x0001, 0xB0D1, 0x8007, 0xB0F1, 0x0009, 0xA8F1, 0x39BB, 0x021F, 0x023F, 0x025F, 0x027F,
+  0x027F, 0x025F, 0x025F, 0x8005, 0x027F, 0x000F, 0x029F, 0x07F3, 0x07E2, 0x9972, 0xA911, 0xA112, 0x4952, 0x4932, 0x4131, 0x4110,
+  0x3910, 0x38EF, 0x30EF, 0x30EE, 0x30EE, 0x8003, 0x28CD, 0x0002, 0x20CD, 0x20CC, 0x801D, 0x20AC, 0x0002, 0x20AB, 0x20AB, 0x803B,
+  0x20AC, 0x0017, 0x18AC, 0x20AC, 0x18CC, 0x18AC, 0x20AB, 0x20AC, 0x20AC, 0x20AB, 0x20AC, 0x20AC, 0x18AC, 0x20AB, 0x20AB, 0x20AC,
+  0x20AC, 0x20AB, 0x20AB, 0x20AC, 0x20AC, 0x20AB, 0x20AB, 0x20AC, 0x20AB, 0x806A, 0x20AC, 0x8003, 0x20CC, 0x8004, 0x28CD, 0x000B,
+  0x30CD, 0x28EE, 0x30EE, 0x490E, 0xA9B2, 0xC9D3, 0xC9D3, 0xC9B3, 0xC9B3, 0xC992, 0xC992, 0x8003, 0xC972, 0x8003, 0xC952, 0x0002,
+  0xC932, 0xC932, 0x8003, 0xC912, 0x0005, 0xC0F2, 0xC8D1, 0xC0D1, 0xC0D1, 0xC8B1, 0x800B, 0xC0B1, 0x800B, 0xB8D1, 0x0007, 0xB0D1,
+  0xB0D1, 0xB8D2, 0xB8D1, 0xB0F1, 0xB0D1, 0xB0F2, 0x8003, 0xB0F1, 0x0004, 0xA8F1, 0xA8F1, 0x123E, 0x029F, 0x8003, 0x02BF, 0x8003,
+  0x029F, 0x8003, 0x02BF, 0x0011, 0x029F, 0x029F, 0x02DF, 0x06B9, 0x07E3, 0xA111, 0xA911, 0xA111, 0x5932, 0x4931, 0x4911, 0x4110,
+  0x4110, 0x390F, 0x38EF, 0x30EE, 0x30EE, 0x8003, 0x28CD, 0x0002, 0x20CD, 0x20CC, 0x8007, 0x20AC, 0x0001, 0x20AB, 0x8015, 0x20AC,
+  0x0003, 0x20AB, 0x20AC, 0x20AB, 0x803A, 0x20AC, 0x000A, 0x20AB, 0x20AC, 0x20AB, 0x20AC, 0x20AC, 0x20AB, 0x20AB, 0x18AC, 0x20AC,
+  0x20AB, 0x8003, 0x20AC, 0x0004, 0x18AB, 0x20AB, 0x20AB, 0x20AC, 0x8006, 0x20AB, 0x806A, 0x20AC, 0x0002, 0x20CC, 0x20CD, 0x8006,
+  0x28CD, 0x0004, 0x30ED, 0x692F, 0xC9D3, 0xC9D3, 0x8003, 0xC9B3, 0x0002, 0xC992, 0xC992, 0x8003, 0xC972, 0x000C, 0xC952, 0xC952,
+  0xC932, 0xC932, 0xC132, 0xC912, 0xC912, 0xC8F2, 0xC8F1, 0xC8D1, 0xC0D1, 0xC0D1, 0x800B, 0xC0B1, 0x800A, 0xB8D1, 0x0007, 0xB0D1,
+  0xB8D1, 0xB0F1, 0xB0D1, 0xB0D1, 0xB0F1, 0xB0D1, 0x8006, 0xB0F1, 0x0008, 0xA8F1, 0x9933, 0x02DF, 0x02DF, 0x02FF, 0x02FF, 0x02DF,
+  0x02BF, 0x8005, 0x02DF, 0x0011, 0x02BF, 0x02BF, 0x02FF, 0x051E, 0x07E8, 0xA912, 0xA111, 0xA111, 0x6932, 0x4931, 0x4931, 0x4130,
+  0x410F, 0x390F, 0x38EE, 0x30EE, 0x30EE, 0x8003, 0x28CD, 0x0002, 0x20CD, 0x20CC, 0x8007, 0x20AC, 0x0002, 0x20AB, 0x20AB, 0x8014,
+  0x20AC, 0x80B9, 0x20AB, 0x8003, 0x20AC, 0x0002, 0x28AC, 0x20CC, 0x8003, 0x28CC, 0x002F, 0x28CD, 0x28CD, 0x28ED, 0x28CD, 0x30CD,
+  0x9191, 0xC9D3, 0xC9D3, 0xC9B3, 0xC9B3, 0xC992, 0xC9B3, 0xC992, 0xC992, 0xC972, 0xC972, 0xC952, 0xC952, 0xC932, 0xC932, 0xC912,
+  0xC932, 0xC912, 0xC112, 0xC8F2, 0xC8F2, 0xC8D1, 0xC8D1, 0x9095, 0x9095, 0x9075, 0x8875, 0x6078, 0x6059, 0x6059, 0x6058, 0x6058,
+  0x6078, 0x6078, 0x6059, 0x6078, 0x6078, 0x5878, 0x6078, 0x88B4, 0x88B5, 0x88B5, 0x8004, 0xB8D1, 0x0004, 0xB0F1, 0xB0F1, 0xB0D1,
+  0xB0D1, 0x8006, 0xB0F1, 0x8003, 0xA8F1, 0x0001, 0x69D6, 0x8003, 0x033F, 0x0001, 0x031F, 0x8007, 0x02FF, 0x0017, 0x02DF, 0x02FF,
+  0x035F, 0x03FF, 0x07F0, 0x8A4F, 0xA111, 0xA111, 0x8132, 0x4931, 0x4931, 0x4110, 0x410F, 0x390F, 0x30EE, 0x30EE, 0x30CD, 0x30CD,
+  0x28CD, 0x28CD, 0x28CC, 0x28CC, 0x20CC, 0x8003, 0x20AC, 0x8019, 0x20AB, 0x80BB, 0x20AB, 0x0002, 0x20CC, 0x20AC, 0x8003, 0x28CC,
+  0x000F, 0x20CC, 0x28CC, 0x28CC, 0x28CD, 0x40EE, 0xA9B2, 0xC9D3, 0xC9D3, 0xC9B3, 0xC9B2, 0xC9B3, 0xC992, 0xC992, 0xC972, 0xC972,
+  0x8003, 0xC952, 0x0009, 0xC932, 0xC932, 0x90D5, 0x88D6, 0x6098, 0x5879, 0x303C, 0x305C, 0x081E, 0x8011, 0x001F, 0x000B, 0x003F,
+  0x005F, 0x007F, 0x009F, 0x00BF, 0x00DF, 0x291C, 0x411A, 0x6118, 0x8915, 0xB0D1, 0x8007, 0xB0F1, 0x0008, 0xB0F2, 0xA8F1, 0xB0F1,
+  0x429A, 0x039F, 0x039F, 0x035F, 0x035F, 0x8006, 0x033F, 0x8003, 0x031F, 0x0016, 0x037F, 0x03FF, 0x06D7, 0x7ACF, 0xA111, 0xA111,
+  0x9912, 0x5131, 0x4931, 0x4110, 0x410F, 0x40EF, 0x38EE, 0x30EE, 0x30ED, 0x30CD, 0x28CD, 0x28CD, 0x28CC, 0x28CC, 0x20CC, 0x20CC,
+  0x801B, 0x20AB, 0x80BB, 0x20AB, 0x8003, 0x20CB, 0x8003, 0x28CC, 0x0006, 0x28CD, 0x28CC, 0x490E, 0xC1D3, 0xC9D3, 0xC9D3, 0x8004,
+  0xC9B3, 0x0008, 0xC992, 0xC992, 0xC972, 0xC952, 0x98F5, 0x60B8, 0x407B, 0x183E, 0x8017, 0x001F, 0x0013, 0x003F, 0x003F, 0x007F,
+  0x007F, 0x009F, 0x00BF, 0x00FF, 0x011F, 0x013F, 0x017F, 0x019F, 0x01DF, 0x021F, 0x21FD, 0x49D9, 0x7996, 0xA112, 0xA8F1, 0xB0F1,
+  0x8004, 0xA8F1, 0x0005, 0x139E, 0x03DF, 0x03BF, 0x039F, 0x039F, 0x8004, 0x037F, 0x0009, 0x035F, 0x035F, 0x033F, 0x033F, 0x035F,
+  0x03BF, 0x041F, 0x05DE, 0x7AD1, 0x8003, 0xA111, 0x0009, 0x5931, 0x4931, 0x4130, 0x4130, 0x40EF, 0x38EE, 0x30EE, 0x30ED, 0x30ED,
+  0x8004, 0x28CC, 0x0001, 0x20CB, 0x801C, 0x20AB, 0x80BC, 0x20AB, 0x0001, 0x20CB, 0x8005, 0x28CC, 0x000C, 0x692F, 0xC9F3, 0xC9D3,
+  0xC9D3, 0xC9B2, 0xC9B3, 0xC992, 0xC9B2, 0xC972, 0xB973, 0x80F7, 0x387B, 0x801A, 0x001F, 0x001D, 0x003F, 0x003F, 0x005F, 0x007F,
+  0x009F, 0x00BF, 0x00DF, 0x00FF, 0x013F, 0x015F, 0x019F, 0x01BF, 0x01FF, 0x023F, 0x025F, 0x029F, 0x02DF, 0x02FF, 0x033F, 0x2ADC,
+  0x5A58, 0x8994, 0xA8F1, 0xA8F1, 0x81D4, 0x041F, 0x041F, 0x03FF, 0x03DF, 0x8005, 0x03BF, 0x0015, 0x039F, 0x037F, 0x035F, 0x037F,
+  0x039F, 0x03FF, 0x047F, 0x04FF, 0x6375, 0xA112, 0xA111, 0xA111, 0x7111, 0x4931, 0x4110, 0x4110, 0x390F, 0x38EE, 0x30EE, 0x30ED,
+  0x30ED, 0x8004, 0x28CC, 0x801D, 0x20AB, 0x80BC, 0x20AB, 0x0002, 0x20CB, 0x28AC, 0x8003, 0x28CC, 0x000A, 0x692E, 0xC9F3, 0xC9D2,
+  0xC9D3, 0xC9B3, 0xC9B3, 0xC992, 0xC993, 0x80F7, 0x389B, 0x8006, 0x001F, 0x0005, 0x083C, 0x085B, 0x105B, 0x2078, 0x2098, 0x8005,
+  0x2097, 0x0004, 0x2098, 0x187A, 0x105B, 0x085D, 0x8009, 0x001F, 0x001D, 0x003F, 0x005F, 0x007F, 0x009F, 0x00DF, 0x00FF, 0x011F,
+  0x015F, 0x017F, 0x01BF, 0x01FF, 0x021F, 0x025F, 0x029F, 0x02DF, 0x02FF, 0x033F, 0x037F, 0x03BF, 0x03DF, 0x041F, 0x043F, 0x0C3F,
+  0x2BBC, 0x0C3F, 0x045F, 0x043F, 0x041F, 0x041F, 0x8003, 0x03FF, 0x000B, 0x03DF, 0x03DF, 0x03BF, 0x039F, 0x037F, 0x039F, 0x03DF,
+  0x043F, 0x04BF, 0x053F, 0x5398, 0x8003, 0xA111, 0x000A, 0x9111, 0x4931, 0x4910, 0x4110, 0x410F, 0x38EE, 0x38EE, 0x30ED, 0x30CD,
+  0x30CD, 0x8003, 0x28CC, 0x0001, 0x28CB, 0x801C, 0x20AB, 0x80B2, 0x20AA, 0x8009, 0x20AB, 0x0016, 0x20CB, 0x28CB, 0x28CB, 0x28CC,
+  0x28CB, 0x614E, 0xD1F3, 0xC9F3, 0xC9D3, 0xC9B2, 0xC9B3, 0xB173, 0x60D9, 0x081E, 0x003D, 0x083B, 0x1878, 0x1877, 0x28D2, 0x28D2,
+  0x40EE, 0x38EE, 0x8003, 0x390F, 0x0001, 0x410E, 0x8007, 0x410F, 0x0028, 0x4110, 0x410F, 0x4910, 0x4130, 0x38F3, 0x28B6, 0x189A,
+  0x003E, 0x001F, 0x001F, 0x003F, 0x005F, 0x005F, 0x007F, 0x00BF, 0x00DF, 0x00FF, 0x013F, 0x015F, 0x019F, 0x01DF, 0x021F, 0x023F,
+  0x027F, 0x029F, 0x02FF, 0x033F, 0x035F, 0x039F, 0x03DF, 0x041F, 0x045F, 0x047F, 0x04BF, 0x04DF, 0x04DF, 0x04BF, 0x04BF, 0x047F,
+  0x047F, 0x8003, 0x043F, 0x000C, 0x041F, 0x041F, 0x03FF, 0x03DF, 0x03BF, 0x03BF, 0x03DF, 0x043F, 0x047F, 0x04DF, 0x057F, 0x3C1A,
+  0x8004, 0xA111, 0x000E, 0x5931, 0x4910, 0x4110, 0x410F, 0x390E, 0x38EE, 0x30ED, 0x30ED, 0x30CC, 0x28CC, 0x28CC, 0x28CB, 0x28CB,
+  0x20CB, 0x8007, 0x20AB, 0x8014, 0x20AA, 0x80B6, 0x20AA, 0x8005, 0x20AB, 0x0005, 0x20CB, 0x28CB, 0x20CB, 0x28AB, 0x692E, 0x8003,
+  0xC9D3, 0x0008, 0xC9B3, 0xB1B2, 0x58F3, 0x1895, 0x28B2, 0x30ED, 0x38ED, 0x30ED, 0x8003, 0x38ED, 0x0005, 0x38EE, 0x390E, 0x390E,
+  0x38EE, 0x38EE, 0x8004, 0x390E, 0x0002, 0x410F, 0x390E, 0x8006, 0x410F, 0x0035, 0x4110, 0x410F, 0x492F, 0x4930, 0x4910, 0x38F3,
+  0x20B8, 0x087D, 0x007F, 0x009F, 0x00DF, 0x00FF, 0x011F, 0x015F, 0x017F, 0x019F, 0x01DF, 0x021F, 0x025F, 0x02BF, 0x02DF, 0x031F,
+  0x035F, 0x039F, 0x03DF, 0x041F, 0x045F, 0x049F, 0x04DF, 0x04FF, 0x051F, 0x051F, 0x053F, 0x04FF, 0x04DF, 0x04BF, 0x049F, 0x047F,
+  0x047F, 0x045F, 0x045F, 0x043F, 0x041F, 0x03FF, 0x03DF, 0x03FF, 0x043F, 0x045F, 0x04BF, 0x053F, 0x05BF, 0x2CDC, 0xA112, 0x8003,
+  0xA111, 0x000F, 0x7131, 0x4930, 0x4130, 0x410F, 0x390E, 0x38EE, 0x30ED, 0x30ED, 0x30CC, 0x28CC, 0x28CC, 0x28CB, 0x28CB, 0x28AB,
+  0x20CB, 0x8003, 0x20AB, 0x8017, 0x20AA, 0x80AC, 0x20AB, 0x8003, 0x20AA, 0x800C, 0x20AB, 0x000C, 0x28AB, 0x28CB, 0x28CB, 0x612E,
+  0xC9F3, 0xC9D3, 0xC9D3, 0xB992, 0x692E, 0x28CC, 0x28EC, 0x30CD, 0x8005, 0x30ED, 0x0005, 0x38ED, 0x30ED, 0x38ED, 0x38ED, 0x390E,
+  0x8003, 0x38EE, 0x0008, 0x390F, 0x38EE, 0x40EE, 0x40EE, 0x390F, 0x390E, 0x410E, 0x40EF, 0x8007, 0x410F, 0x0030, 0x412F, 0x4910,
+  0x4910, 0x4930, 0x4113, 0x28F8, 0x08FE, 0x013F, 0x015F, 0x019F, 0x01DF, 0x021F, 0x023F, 0x029F, 0x02BF, 0x031F, 0x035F, 0x039F,
+  0x03DF, 0x041F, 0x045F, 0x049F, 0x04DF, 0x051F, 0x053F, 0x057F, 0x059F, 0x057F, 0x055F, 0x053F, 0x04FF, 0x04FF, 0x04DF, 0x04BF,
+  0x049F, 0x049F, 0x047F, 0x045F, 0x043F, 0x041F, 0x041F, 0x043F, 0x045F, 0x04BF, 0x04FF, 0x055F, 0x05DF, 0x0E1F, 0x8003, 0xA111,
+  0x000A, 0xA112, 0x8931, 0x4930, 0x4130, 0x410F, 0x410E, 0x38EE, 0x30ED, 0x30ED, 0x30CC, 0x8003, 0x28CC, 0x0003, 0x28CB, 0x28CB,
+  0x20CB, 0x801A, 0x20AB, 0x80B2, 0x20AA, 0x0010, 0x20AB, 0x20AB, 0x20AA, 0x20AB, 0x20AB, 0x20CB, 0x20AB, 0x20AB, 0x20CB, 0x28AB,
+  0x20CB, 0x612E, 0xD1F3, 0xC9F3, 0xC1B2, 0x612E, 0x8004, 0x28CC, 0x0003, 0x30CC, 0x30CC, 0x30CD, 0x8006, 0x30ED, 0x0001, 0x38ED,
+  0x800A, 0x38EE, 0x0002, 0x390E, 0x38EE, 0x8003, 0x390E, 0x8006, 0x410F, 0x0016, 0x4130, 0x4930, 0x4930, 0x4931, 0x4930, 0x4133,
+  0x197A, 0x01DE, 0x021F, 0x027F, 0x02BF, 0x02FF, 0x033F, 0x037F, 0x03BF, 0x03FF, 0x045F, 0x049F, 0x04DF, 0x051F, 0x057F, 0x059F,
+  0x8003, 0x05DF, 0x0016, 0x05BF, 0x059F, 0x055F, 0x055F, 0x053F, 0x051F, 0x04FF, 0x04DF, 0x04DF, 0x04BF, 0x047F, 0x045F, 0x043F,
+  0x043F, 0x047F, 0x04BF, 0x04FF, 0x053F, 0x05BF, 0x061F, 0x069F, 0x9972, 0x8004, 0xA111, 0x0008, 0x5130, 0x4910, 0x410F, 0x390F,
+  0x390E, 0x38ED, 0x30ED, 0x30CD, 0x8003, 0x28CC, 0x0003, 0x28CB, 0x28CB, 0x20CB, 0x8004, 0x20AB, 0x0004, 0x20AA, 0x20AA, 0x20AB,
+  0x20AB, 0x8012, 0x20AA, 0x80B2, 0x20AA, 0x0010, 0x20AB, 0x20AB, 0x20AA, 0x20AB, 0x20AB, 0x20AA, 0x20AB, 0x20AB, 0x20CB, 0x28AB,
+  0x510D, 0xD1F3, 0xC9D2, 0x816F, 0x30CC, 0x28AC, 0x8005, 0x28CC, 0x0006, 0x30CC, 0x30CC, 0x30CD, 0x30ED, 0x30ED, 0x30CD, 0x8005,
+  0x30ED, 0x8004, 0x38ED, 0x8006, 0x38EE, 0x8005, 0x390E, 0x8004, 0x410F, 0x0003, 0x4110, 0x410F, 0x4910, 0x8003, 0x4930, 0x001E,
+  0x4931, 0x4932, 0x31B6, 0x0A9D, 0x02FF, 0x035F, 0x039F, 0x03FF, 0x043F, 0x047F, 0x04BF, 0x051F, 0x055F, 0x05BF, 0x05DF, 0x061F,
+  0x063F, 0x063F, 0x05FF, 0x05DF, 0x05BF, 0x059F, 0x059F, 0x057F, 0x055F, 0x053F, 0x051F, 0x04FF, 0x04DF, 0x04BF, 0x8003, 0x047F,
+  0x0008, 0x049F, 0x04DF, 0x053F, 0x057F, 0x05FF, 0x065F, 0x06DF, 0x7A95, 0x8004, 0xA111, 0x0008, 0x6911, 0x4930, 0x410F, 0x410F,
+  0x390E, 0x38EE, 0x30ED, 0x30CD, 0x8003, 0x28CC, 0x0003, 0x28CB, 0x28CB, 0x20CB, 0x8004, 0x20AB, 0x0004, 0x20AA, 0x20AA, 0x20AB,
+  0x20AB, 0x8012, 0x20AA, 0x80B2, 0x20AA, 0x8004, 0x20AB, 0x000A, 0x20AA, 0x20CB, 0x20CB, 0x20AB, 0x20AB, 0x40EC, 0xC1D2, 0xC1B3,
+  0x490D, 0x28CB, 0x8008, 0x28CC, 0x0005, 0x30CC, 0x30CC, 0x30EC, 0x30CD, 0x30CD, 0x800B, 0x30ED, 0x8004, 0x38ED, 0x8006, 0x38EE,
+  0x0003, 0x390E, 0x390E, 0x390F, 0x8004, 0x410F, 0x0020, 0x4910, 0x4910, 0x4930, 0x4931, 0x4951, 0x4951, 0x39D5, 0x131C, 0x041F,
+  0x047F, 0x04BF, 0x051F, 0x055F, 0x059F, 0x05DF, 0x061F, 0x067F, 0x069F, 0x069F, 0x067F, 0x065F, 0x061F, 0x05FF, 0x05FF, 0x05BF,
+  0x059F, 0x057F, 0x055F, 0x053F, 0x051F, 0x04FF, 0x04DF, 0x8003, 0x04BF, 0x0008, 0x04DF, 0x051F, 0x057F, 0x05BF, 0x063F, 0x069F,
+  0x071F, 0x5438, 0x8004, 0xA111, 0x000E, 0x8111, 0x4930, 0x410F, 0x410F, 0x390E, 0x38EE, 0x30ED, 0x30ED, 0x30CC, 0x28CC, 0x28CC,
+  0x28CB, 0x28CB, 0x20CB, 0x8004, 0x20AB, 0x0004, 0x20AA, 0x20AA, 0x20AB, 0x20AB, 0x8012, 0x20AA, 0x80B2, 0x20AA, 0x0003, 0x20AB,
+  0x20AB, 0x20AA, 0x8005, 0x20AB, 0x0004, 0x30CB, 0xA992, 0xA9B1, 0x30CB, 0x8004, 0x28CB, 0x8007, 0x28CC, 0x8004, 0x30CC, 0x0006,
+  0x30EC, 0x30EC, 0x30CD, 0x30ED, 0x30ED, 0x30CD, 0x8009, 0x30ED, 0x8004, 0x38ED, 0x8003, 0x38EE, 0x8003, 0x390E, 0x8005, 0x410F,
+  0x0029, 0x412F, 0x4930, 0x4930, 0x5130, 0x4931, 0x5131, 0x3A15, 0x237B, 0x053F, 0x059F, 0x5358, 0x349B, 0x0E1F, 0x06BF, 0x06FF,
+  0x06FF, 0x06DF, 0x06BF, 0x069F, 0x065F, 0x063F, 0x061F, 0x05FF, 0x05DF, 0x05BF, 0x059F, 0x057F, 0x055F, 0x051F, 0x04FF, 0x04DF,
+  0x04DF, 0x04FF, 0x051F, 0x055F, 0x059F, 0x05FF, 0x065F, 0x06DF, 0x073F, 0x359B, 0x8005, 0xA111, 0x000D, 0x4930, 0x4910, 0x412F,
+  0x390E, 0x38EE, 0x30ED, 0x30ED, 0x30CC, 0x28CC, 0x28CC, 0x28CB, 0x28CB, 0x20CB, 0x8005, 0x20AB, 0x0003, 0x20AA, 0x20AB, 0x20AB,
+  0x8012, 0x20AA, 0x80B2, 0x20AA, 0x0003, 0x20AB, 0x20AB, 0x20AA, 0x8005, 0x20AB, 0x0005, 0x692F, 0x816F, 0x20AB, 0x20CB, 0x20AB,
+  0x8003, 0x28CB, 0x0002, 0x28AB, 0x28CB, 0x800A, 0x28CC, 0x8003, 0x30CC, 0x8008, 0x30CD, 0x8008, 0x30ED, 0x0001, 0x38ED, 0x8004,
+  0x38EE, 0x0002, 0x390E, 0x390E, 0x8004, 0x410F, 0x0001, 0x412F, 0x8003, 0x4930, 0x0006, 0x4931, 0x4931, 0x5131, 0x49D4, 0x243A,
+  0xA132, 0x8003, 0xA8F1, 0x001B, 0x8295, 0x8295, 0x5418, 0x351B, 0x06DF, 0x069F, 0x067F, 0x065F, 0x063F, 0x05FF, 0x05FF, 0x05BF,
+  0x059F, 0x057F, 0x055F, 0x053F, 0x051F, 0x051F, 0x053F, 0x057F, 0x059F, 0x05DF, 0x063F, 0x069F, 0x06FF, 0x077F, 0x0F5F, 0x8004,
+  0xA111, 0x000B, 0x9931, 0x6911, 0x4930, 0x410F, 0x390E, 0x38EE, 0x30ED, 0x30ED, 0x30CD, 0x30CC, 0x28CC, 0x8003, 0x28CB, 0x0001,
+  0x20CB, 0x8004, 0x20AB, 0x0003, 0x20AA, 0x20AB, 0x20AB, 0x8012, 0x20AA, 0x80B2, 0x20AA, 0x8004, 0x20AB, 0x000C, 0x20AA, 0x20AA,
+  0x20CB, 0x20AB, 0x20AB, 0x20AA, 0x20AB, 0x20AB, 0x20CB, 0x20AB, 0x28CB, 0x28AB, 0x8004, 0x28CB, 0x800C, 0x28CC, 0x0002, 0x30CC,
+  0x30CC, 0x8004, 0x28CC, 0x8004, 0x30CC, 0x0002, 0x30CD, 0x30CD, 0x8006, 0x30ED, 0x0003, 0x30EE, 0x38ED, 0x38ED, 0x8003, 0x390E,
+  0x0001, 0x410E, 0x8004, 0x410F, 0x0001, 0x4130, 0x8003, 0x4930, 0x0007, 0x5131, 0x5131, 0x6992, 0xA8F1, 0xA911, 0xA8F1, 0xA911,
+  0x8003, 0xA8F1, 0x000B, 0xA172, 0x4C39, 0x2D5C, 0x069F, 0x065F, 0x063F, 0x061F, 0x05FF, 0x05DF, 0x059F, 0x057F, 0x8003, 0x055F,
+  0x0018, 0x057F, 0x059F, 0x05DF, 0x061F, 0x067F, 0x06DF, 0x073F, 0x079F, 0x07DF, 0x8254, 0xA111, 0xA131, 0xA111, 0x9911, 0x8131,
+  0x4910, 0x410F, 0x410E, 0x38EE, 0x38ED, 0x30ED, 0x30CD, 0x30CC, 0x28CC, 0x8003, 0x28CB, 0x0001, 0x20CB, 0x8007, 0x20AB, 0x8012,
+  0x20AA, 0x80B2, 0x20AA, 0x8004, 0x20AB, 0x0006, 0x20AA, 0x20AB, 0x20AA, 0x20AB, 0x20AB, 0x20CB, 0x8003, 0x20AB, 0x0004, 0x28AB,
+  0x28AB, 0x20CB, 0x20CB, 0x8007, 0x28CB, 0x8014, 0x28CC, 0x0003, 0x30CC, 0x30EC, 0x30EC, 0x8005, 0x30ED, 0x8005, 0x38EE, 0x0002,
+  0x390E, 0x390F, 0x8003, 0x410F, 0x0008, 0x412F, 0x4930, 0x4910, 0x4930, 0x5131, 0x5131, 0x6931, 0xA111, 0x8004, 0xA8F1, 0x001A,
+  0xA911, 0xA111, 0xA911, 0xA0F1, 0x9972, 0x4419, 0x067F, 0x065F, 0x061F, 0x05FF, 0x05DF, 0x05BF, 0x059F, 0x059F, 0x05BF, 0x05BF,
+  0x05DF, 0x061F, 0x065F, 0x06BF, 0x06FF, 0x075F, 0x07BF, 0x07FF, 0x5498, 0xA131, 0x8003, 0xA111, 0x000E, 0x9911, 0x4930, 0x410F,
+  0x410F, 0x38EE, 0x38EE, 0x30ED, 0x30CD, 0x30CC, 0x28CC, 0x28CC, 0x28CB, 0x28CB, 0x20CB, 0x8007, 0x20AB, 0x8012, 0x20AA, 0x80B2,
+  0x20AA, 0x0003, 0x20AB, 0x20AB, 0x20AA, 0x8003, 0x20AB, 0x0004, 0x20AA, 0x20AA, 0x20CA, 0x20AA, 0x8003, 0x20AB, 0x0005, 0x20CB,
+  0x20AB, 0x20AB, 0x28CB, 0x20CB, 0x8009, 0x28CB, 0x8013, 0x28CC, 0x8003, 0x30CC, 0x0003, 0x30EC, 0x30EC, 0x30CD, 0x8003, 0x30ED,
+  0x0002, 0x38ED, 0x38EE, 0x8003, 0x390E, 0x0010, 0x390F, 0x410F, 0x410F, 0x490F, 0x412F, 0x4910, 0x4930, 0x4931, 0x4931, 0x5931,
+  0x9111, 0xA8F1, 0xA8F1, 0xA911, 0xA8F1, 0xA8F1, 0x8003, 0xA911, 0x0006, 0xA111, 0x7A55, 0x34BB, 0x065F, 0x061F, 0x05FF, 0x8004,
+  0x05DF, 0x001D, 0x05FF, 0x063F, 0x065F, 0x069F, 0x06DF, 0x071F, 0x077F, 0x07BF, 0x07FF, 0x2E3C, 0x9911, 0xA111, 0xA111, 0x9931,
+  0x9931, 0x6910, 0x410F, 0x410F, 0x38EE, 0x38EE, 0x30ED, 0x30ED, 0x30CC, 0x28CC, 0x28CC, 0x28CB, 0x28CB, 0x20CB, 0x20CB, 0x8006,
+  0x20AB, 0x8012, 0x20AA, 0x80B4, 0x20AA, 0x8003, 0x20AB, 0x0001, 0x20AA, 0x8009, 0x20AB, 0x8004, 0x20CB, 0x8017, 0x28CB, 0x8008,
+  0x28CC, 0x0004, 0x30CC, 0x30CC, 0x30EC, 0x30CD, 0x8004, 0x30ED, 0x8004, 0x38EE, 0x0001, 0x390E, 0x8004, 0x410F, 0x0007, 0x4910,
+  0x4930, 0x4931, 0x5131, 0x7931, 0xA911, 0xA8F1, 0x8004, 0xA911, 0x0001, 0xA8F1, 0x8004, 0xA111, 0x001F, 0x91B3, 0x62F6, 0x347B,
+  0x061F, 0x061F, 0x063F, 0x063F, 0x065F, 0x067F, 0x06BF, 0x071F, 0x073F, 0x079F, 0x07DF, 0x07FF, 0x07FF, 0xA111, 0x9912, 0x9911,
+  0x9931, 0x9932, 0x8131, 0x4130, 0x410F, 0x410E, 0x38EE, 0x30EE, 0x30ED, 0x30CD, 0x28CC, 0x28CC, 0x8003, 0x28CB, 0x8004, 0x20AB,
+  0x0003, 0x20AA, 0x20AB, 0x20AB, 0x8012, 0x20AA, 0x80B4, 0x20AA, 0x8008, 0x20AB, 0x0002, 0x20CB, 0x20CB, 0x8005, 0x20AB, 0x0002,
+  0x20CB, 0x20AB, 0x8006, 0x28AB, 0x8015, 0x28CB, 0x8007, 0x28CC, 0x0003, 0x30CC, 0x30CC, 0x30CD, 0x8004, 0x30ED, 0x8004, 0x38EE,
+  0x0001, 0x390F, 0x8003, 0x410F, 0x0001, 0x4910, 0x8003, 0x4930, 0x0001, 0x7111, 0x8004, 0xA911, 0x0003, 0xA111, 0xA911, 0xA911,
+  0x8006, 0xA111, 0x000A, 0x91B3, 0x349B, 0x065F, 0x067F, 0x069F, 0x06BF, 0x06FF, 0x073F, 0x077F, 0x07BF, 0x8003, 0x07FF, 0x000F,
+  0x7AD4, 0xA111, 0x9911, 0xA111, 0x9931, 0x9931, 0x4930, 0x410F, 0x390E, 0x38EE, 0x30EE, 0x30ED, 0x30ED, 0x28CC, 0x28CC, 0x8003,
+  0x28CB, 0x8004, 0x20AB, 0x0003, 0x20AA, 0x20AB, 0x20AB, 0x8012, 0x20AA, 0x80B6, 0x20AA, 0x8008, 0x20AB, 0x0001, 0x20CB, 0x8009,
+  0x20AB, 0x8004, 0x28AB, 0x800C, 0x20CB, 0x0004, 0x28CB, 0x28CB, 0x20CB, 0x20CB, 0x8008, 0x28CB, 0x8005, 0x28CC, 0x0004, 0x30CC,
+  0x30CC, 0x30EC, 0x30CD, 0x8003, 0x30ED, 0x0017, 0x38ED, 0x38EE, 0x38EE, 0x390E, 0x390E, 0x410F, 0x410F, 0x4110, 0x4930, 0x4930,
+  0x5130, 0x8111, 0xA111, 0xA911, 0xA111, 0xA111, 0xA911, 0xA112, 0xA111, 0xA911, 0xA111, 0xA112, 0xA0F1, 0x8003, 0xA111, 0x0008,
+  0x7A75, 0x15FD, 0x06BF, 0x06FF, 0x071F, 0x075F, 0x079F, 0x07BF, 0x8003, 0x07FF, 0x0003, 0x5499, 0x9931, 0x9911, 0x8003, 0x9931,
+  0x000D, 0x6930, 0x410F, 0x390E, 0x390E, 0x38EE, 0x30ED, 0x30CD, 0x30CC, 0x28CC, 0x28CC, 0x28CB, 0x28CB, 0x20CB, 0x8006, 0x20AB,
+  0x8012, 0x20AA, 0x80B6, 0x20AA, 0x800A, 0x20AB, 0x0002, 0x20CB, 0x20CB, 0x8012, 0x20AB, 0x0006, 0x20CB, 0x20CB, 0x28AB, 0x20AB,
+  0x28AB, 0x28AB, 0x8005, 0x20CB, 0x8007, 0x28CB, 0x8006, 0x28CC, 0x0003, 0x30CC, 0x30EC, 0x30CD, 0x8003, 0x30ED, 0x0004, 0x38ED,
+  0x38EE, 0x38EE, 0x40EE, 0x8003, 0x410F, 0x0007, 0x4130, 0x4930, 0x4930, 0x5931, 0x90F1, 0xA911, 0xA912, 0x8003, 0xA111, 0x0004,
+  0xA911, 0xA911, 0xA111, 0xA112, 0x8004, 0xA111, 0x0007, 0x9972, 0x353B, 0x071F, 0x073F, 0x077F, 0x07BF, 0x07DF, 0x8003, 0x07FF,
+  0x0002, 0x2E3C, 0xA111, 0x8004, 0x9931, 0x000D, 0x8931, 0x410F, 0x410F, 0x38EE, 0x38EE, 0x30ED, 0x30ED, 0x30CC, 0x28CC, 0x28CC,
+  0x28CB, 0x28CB, 0x20CB, 0x8006, 0x20AB, 0x8012, 0x20AA, 0x80B7, 0x20AA, 0x8004, 0x20AB, 0x0001, 0x20AA, 0x8022, 0x20AB, 0x0003,
+  0x20CB, 0x20CB, 0x28AB, 0x8003, 0x20CB, 0x8005, 0x28CB, 0x8005, 0x28CC, 0x0003, 0x30CC, 0x30CD, 0x30CD, 0x8003, 0x30ED, 0x0001,
+  0x38EE, 0x8003, 0x390E, 0x0008, 0x410F, 0x410F, 0x412F, 0x4130, 0x4930, 0x4930, 0x8111, 0xA911, 0x8009, 0xA111, 0x0009, 0xA112,
+  0xA112, 0xA111, 0xA111, 0x4499, 0x077F, 0x079F, 0x07BF, 0x07DF, 0x8004, 0x07FF, 0x0002, 0x9931, 0xA111, 0x8004, 0x9931, 0x000C,
+  0x490F, 0x410F, 0x38EE, 0x30EE, 0x38ED, 0x30ED, 0x30CC, 0x28CC, 0x28CC, 0x28CB, 0x28CB, 0x20CB, 0x8006, 0x20AB, 0x8012, 0x20AA,
+  0x80B8, 0x20AA, 0x8003, 0x20AB, 0x0001, 0x20AA, 0x800E, 0x20AB, 0x0002, 0x20CB, 0x20CB, 0x8008, 0x20AB, 0x0002, 0x20CB, 0x20CB,
+  0x800C, 0x20AB, 0x0005, 0x20CB, 0x20CB, 0x28AB, 0x28AB, 0x20CB, 0x8004, 0x28CB, 0x8004, 0x28CC, 0x0019, 0x30CC, 0x30CC, 0x30CD,
+  0x30CD, 0x30ED, 0x30ED, 0x38ED, 0x310E, 0x38EE, 0x390E, 0x390E, 0x410F, 0x410F, 0x412F, 0x4930, 0x4930, 0x7131, 0xA111, 0xA111,
+  0xA112, 0xA111, 0xA0F1, 0xA111, 0xA111, 0xA112, 0x8005, 0xA111, 0x0004, 0xA131, 0x6397, 0x07BF, 0x07DF, 0x8005, 0x07FF, 0x0001,
+  0x7AD4, 0x8004, 0x9931, 0x000D, 0x9912, 0x7130, 0x390F, 0x38EE, 0x38EE, 0x38ED, 0x30ED, 0x30CC, 0x28CC, 0x28CC, 0x28CB, 0x28CB,
+  0x28AB, 0x8006, 0x20AB, 0x8012, 0x20AA, 0x80BA, 0x20AA, 0x8020, 0x20AB, 0x0002, 0x20CB, 0x20CB, 0x8009, 0x20AB, 0x8004, 0x20CB,
+  0x8004, 0x28CB, 0x8005, 0x28CC, 0x0012, 0x30CC, 0x30EC, 0x30EC, 0x30ED, 0x38EE, 0x30ED, 0x38ED, 0x390E, 0x38EE, 0x410E, 0x410F,
+  0x410F, 0x4930, 0x4930, 0x6931, 0xA111, 0xA111, 0xA112, 0x8008, 0xA111, 0x0004, 0xA112, 0x9931, 0x9911, 0x6397, 0x8005, 0x07FF,
+  0x0004, 0x07FE, 0x5C14, 0x9931, 0x9911, 0x8003, 0x9931, 0x000D, 0x9131, 0x410F, 0x390E, 0x390E, 0x30ED, 0x30ED, 0x30CC, 0x28CC,
+  0x28CC, 0x28CB, 0x28CB, 0x28AB, 0x20CB, 0x8005, 0x20AB, 0x8012, 0x20AA, 0x80BA, 0x20AA, 0x8007, 0x20AB, 0x8006, 0x20AA, 0x8020,
+  0x20AB, 0x8003, 0x20CB, 0x8006, 0x28CB, 0x8004, 0x28CC, 0x0010, 0x30CC, 0x30CD, 0x30ED, 0x30ED, 0x38ED, 0x30EE, 0x38EE, 0x390E,
+  0x390E, 0x410F, 0x410F, 0x4130, 0x4930, 0x5931, 0x7911, 0x9131, 0x8009, 0xA111, 0x0004, 0x9931, 0xA111, 0x9931, 0x5498, 0x8004,
+  0x07FF, 0x0002, 0x07FE, 0x35F5, 0x8006, 0x9931, 0x000C, 0x510F, 0x390E, 0x390E, 0x38ED, 0x30ED, 0x30CC, 0x30CC, 0x28CC, 0x28CB,
+  0x28CB, 0x28AB, 0x20CB, 0x8005, 0x20AB, 0x8012, 0x20AA, 0x0004, 0x20AA, 0x20AB, 0x20AA, 0x20AA, 0x8004, 0x20AB, 0x8011, 0x20AA,
+  0x0001, 0x20AB, 0x800D, 0x20AA, 0x8005, 0x20AB, 0x8008, 0x20AA, 0x0008, 0x20AB, 0x20AA, 0x20AA, 0x20AB, 0x20AB, 0x20AA, 0x20AB,
+  0x20AA, 0x8011, 0x20AB, 0x0005, 0x20AA, 0x20AB, 0x20AA, 0x20AA, 0x20AB, 0x8003, 0x20AA, 0x8005, 0x20AB, 0x0002, 0x20AA, 0x20AB,
+  0x8010, 0x20AA, 0x0001, 0x20AB, 0x8003, 0x20AA, 0x0002, 0x20AB, 0x20AB, 0x8005, 0x20AA, 0x8003, 0x20AB, 0x800A, 0x20AA, 0x8009,
+  0x20AB, 0x0006, 0x20AA, 0x20AA, 0x20AB, 0x20AA, 0x20AA, 0x20AB, 0x8019, 0x20AA, 0x0003, 0x20AB, 0x20AA, 0x20AB, 0x8003, 0x20AA,
+  0x0002, 0x20AB, 0x20AA, 0x8004, 0x20AB, 0x8004, 0x20AA, 0x8008, 0x20AB, 0x8009, 0x20AA, 0x8003, 0x20AB, 0x0003, 0x20AA, 0x20AB,
+  0x20AB, 0x8009, 0x20AA, 0x800E, 0x20AB, 0x0006, 0x20CB, 0x28AB, 0x28CB, 0x20CB, 0x28AB, 0x28CB, 0x8006, 0x28CC, 0x0010, 0x30CC,
+  0x30CD, 0x30ED, 0x30ED, 0x38ED, 0x38EE, 0x38EE, 0x390E, 0x410F, 0x410F, 0x412F, 0x4130, 0x4930, 0x4930, 0x6131, 0x8931, 0x8003,
+  0xA111, 0x0004, 0xA131, 0xA111, 0xA111, 0x9931, 0x8004, 0xA111, 0x0001, 0x3D7A, 0x8003, 0x07FF, 0x0003, 0x07FE, 0x07F6, 0x9911,
+  0x8005, 0x9931, 0x0015, 0x7911, 0x390E, 0x38EE, 0x30EE, 0x30ED, 0x30CD, 0x30CC, 0x28CC, 0x28CC, 0x28CB, 0x28AB, 0x28AB, 0x20AB,
+  0x20AB, 0x20CA, 0x20AB, 0x20AA, 0x20AB, 0x20AB, 0x20AA, 0x20AB, 0x800A, 0x20AA, 0x8004, 0x20AB, 0x8014, 0x20AA, 0x8003, 0x20AB,
+  0x0004, 0x20AA, 0x20CB, 0x20AA, 0x20AA, 0x8009, 0x20AB, 0x800F, 0x20AA, 0x0001, 0x20AB, 0x8005, 0x20AA, 0x0002, 0x20AB, 0x20AB,
+  0x8013, 0x20AA, 0x0006, 0x20AB, 0x20AA, 0x20AA, 0x20AB, 0x20AA, 0x20AB, 0x8006, 0x20AA, 0x0001, 0x20AB, 0x8014, 0x20AA, 0x0009,
+  0x20AB, 0x20AA, 0x20AB, 0x20AA, 0x20AA, 0x20AB, 0x20AA, 0x20AA, 0x20CA, 0x8003, 0x20AA, 0x0001, 0x20AB, 0x8010, 0x20AA, 0x0005,
+  0x20AB, 0x20AA, 0x18AA, 0x20AB, 0x20AA, 0x8003, 0x20AB, 0x8010, 0x20AA, 0x8009, 0x20AB, 0x8003, 0x20AA, 0x0002, 0x20AB, 0x20AB,
+  0x8012, 0x20AA, 0x8009, 0x20AB, 0x0006, 0x20AA, 0x20CA, 0x20AA, 0x20AA, 0x20AB, 0x20AA, 0x8009, 0x20AB, 0x800A, 0x20AA, 0x8006,
+  0x20AB, 0x0006, 0x28CB, 0x20AB, 0x20CB, 0x20CB, 0x28CB, 0x28CB, 0x8005, 0x28CC, 0x0002, 0x30CC, 0x30EC, 0x8003, 0x30ED, 0x0004,
+  0x38EE, 0x38EE, 0x390E, 0x390E, 0x8003, 0x410F, 0x0005, 0x4930, 0x4930, 0x5131, 0x6131, 0x9911, 0x8003, 0xA111, 0x0015, 0x9931,
+  0xA111, 0xA111, 0xA112, 0x9931, 0x9911, 0x9192, 0x1EBD, 0x07FF, 0x07FF, 0x07FE, 0x07F6, 0x7A71, 0x9931, 0x9931, 0x9932, 0x9931,
+  0x9931, 0x9111, 0x410E, 0x38EE, 0x8003, 0x30ED, 0x0006, 0x28CC, 0x28CC, 0x28CB, 0x28CB, 0x20AB, 0x28AB, 0x8003, 0x20AB, 0x0008,
+  0x20AA, 0x20AA, 0x20AB, 0x20AA, 0x20AA, 0x20AB, 0x20AA, 0x20AB, 0x800C, 0x20AA, 0x0003, 0x20AA, 0x20AB, 0x20AB, 0x800C, 0x20AA,
+  0x8005, 0x20AB, 0x0001, 0x20AA, 0x8003, 0x20AB, 0x0002, 0x20AA, 0x20AB, 0x8015, 0x20AA, 0x8005, 0x20AB, 0x0004, 0x20AA, 0x20AA,
+  0x20AB, 0x20AB, 0x8003, 0x20AA, 0x0001, 0x20AB, 0x8010, 0x20AA, 0x0001, 0x20AB, 0x8006, 0x20AA, 0x0009, 0x20CA, 0x20AA, 0x20AB,
+  0x20AA, 0x20AA, 0x20AB, 0x20AA, 0x20AA, 0x20AB, 0x8005, 0x20AA, 0x8005, 0x20AB, 0x8006, 0x20AA, 0x0007, 0x20AB, 0x20AA, 0x20AB,
+  0x20AA, 0x20AB, 0x20AA, 0x20AA, 0x8005, 0x20AB, 0x800C, 0x20AA, 0x8008, 0x20AB, 0x0007, 0x20AA, 0x20AB, 0x20AB, 0x20AA, 0x20CA,
+  0x20AA, 0x20AB, 0x8019, 0x20AA, 0x0005, 0x20AB, 0x20AA, 0x20AB, 0x20AB, 0x20AC, 0x801C, 0x20CD, 0x0001, 0x20CC, 0x8020, 0x20CD,
+  0x8004, 0x28CD, 0x0001, 0x20CD, 0x8003, 0x28CE, 0x0004, 0x28EE, 0x28CE, 0x28EE, 0x30EE, 0x8003, 0x30EF, 0x000C, 0x390F, 0x390F,
+  0x3910, 0x3910, 0x4110, 0x4131, 0x4931, 0x4931, 0x4932, 0x4952, 0x5152, 0x9132, 0x8003, 0xA111, 0x000F, 0x9912, 0x9931, 0x9931,
+  0x9911, 0x9931, 0x9912, 0x8274, 0x07FF, 0x07FF, 0x07FD, 0x07F6, 0x5C32, 0x9911, 0x9931, 0x9932, 0x8003, 0x9931, 0x001A, 0x5910,
+  0x390F, 0x30EF, 0x30EF, 0x30EE, 0x30CE, 0x28CD, 0x28EE, 0x28ED, 0x28CD, 0x20CD, 0x20AC, 0x20CD, 0x20CD, 0x20AD, 0x20CD, 0x20AD,
+  0x20CC, 0x20CC, 0x20AD, 0x20CC, 0x20AC, 0x20CC, 0x20CC, 0x20AC, 0x20AC, 0x8008, 0x20CC, 0x0003, 0x18D2, 0x10F2, 0x18D2, 0x8009,
+  0x10F2, 0x0002, 0x18D2, 0x18D2, 0x800C, 0x18F2, 0x0001, 0x18D2, 0x801A, 0x18F2, 0x0009, 0x18F3, 0x18F3, 0x18F2, 0x20F2, 0x18F2,
+  0x18F2, 0x20F2, 0x18F3, 0x18F3, 0x800F, 0x20F3, 0x0002, 0x20F2, 0x18F3, 0x8006, 0x20F3, 0x0007, 0x2113, 0x20F3, 0x20F3, 0x2113,
+  0x20F3, 0x20F3, 0x2113, 0x8006, 0x20F3, 0x0002, 0x2113, 0x2113, 0x8009, 0x20F3, 0x0002, 0x2113, 0x20F3, 0x8003, 0x2113, 0x0006,
+  0x28F3, 0x28F3, 0x2113, 0x28F3, 0x28F3, 0x2913, 0x8007, 0x2113, 0x8010, 0x2913, 0x0004, 0x2113, 0x2913, 0x2914, 0x2113, 0x8020,
+  0x2913, 0x0001, 0x2914, 0x8028, 0x2913, 0x8008, 0x2113, 0x0004, 0x2913, 0x2913, 0x28F3, 0x28F3, 0x8005, 0x2913, 0x0007, 0x28F3,
+  0x2913, 0x2113, 0x2913, 0x2914, 0x2913, 0x2913, 0x8005, 0x2914, 0x8005, 0x3134, 0x001B, 0x3934, 0x3934, 0x3935, 0x3955, 0x4155,
+  0x4155, 0x4176, 0x4176, 0x4976, 0x4977, 0x5176, 0x9132, 0xA111, 0xA111, 0x9931, 0x9911, 0xA111, 0x9931, 0x9931, 0x9912, 0x9931,
+  0x5C38, 0x07FF, 0x07FD, 0x07F6, 0x44F2, 0x9911, 0x8005, 0x9931, 0x0011, 0x7933, 0x3955, 0x3135, 0x3134, 0x3114, 0x2133, 0x2113,
+  0x2113, 0x20F3, 0x20F3, 0x2113, 0x1912, 0x18F2, 0x20F3, 0x18F2, 0x18F3, 0x18F2, 0x8003, 0x18F3, 0x800A, 0x18F2, 0x8004, 0x18D2,
+  0x0004, 0x10F2, 0x18D2, 0x18D2, 0x10D2, 0x8008, 0x18D2, 0x800C, 0x18F2, 0x0005, 0x18D2, 0x18F2, 0x18F2, 0x18D2, 0x18D2, 0x8014,
+  0x18F2, 0x8005, 0x18F3, 0x0004, 0x18F2, 0x18F3, 0x18F3, 0x20F2, 0x8006, 0x18F3, 0x8013, 0x20F3, 0x0001, 0x2112, 0x8004, 0x20F3,
+  0x0004, 0x2113, 0x20F2, 0x20F3, 0x20F2, 0x8010, 0x20F3, 0x0007, 0x2113, 0x28F3, 0x2113, 0x20F3, 0x2113, 0x28F3, 0x20F3, 0x8007,
+  0x2113, 0x0002, 0x28F3, 0x28F3, 0x8003, 0x2113, 0x800D, 0x2913, 0x0001, 0x2113, 0x8003, 0x2913, 0x0004, 0x2914, 0x2913, 0x2913,
+  0x28F3, 0x801D, 0x2913, 0x0001, 0x28F3, 0x801D, 0x2913, 0x0004, 0x2113, 0x2913, 0x2913, 0x2914, 0x8009, 0x2913, 0x800C, 0x2113,
+  0x000C, 0x2913, 0x28F3, 0x28F3, 0x2913, 0x2113, 0x2913, 0x2913, 0x2113, 0x2113, 0x28F3, 0x2913, 0x2113, 0x8008, 0x2914, 0x8003,
+  0x3134, 0x0019, 0x3135, 0x3935, 0x3935, 0x3955, 0x3955, 0x4155, 0x4156, 0x4176, 0x4976, 0x4956, 0x5176, 0x9132, 0xA111, 0xA112,
+  0xA111, 0x9931, 0x9931, 0x9911, 0x9932, 0x9931, 0x9911, 0x2E5C, 0x07FC, 0x07F6, 0x2E53, 0x8003, 0x9931, 0x0004, 0x9911, 0x9911,
+  0x9931, 0x9132, 0x8003, 0x3134, 0x000C, 0x2934, 0x2914, 0x2913, 0x2113, 0x2113, 0x20F3, 0x2112, 0x20F3, 0x20D3, 0x1912, 0x18F2,
+  0x18F3, 0x8003, 0x18F2, 0x0003, 0x18D2, 0x18F2, 0x20F2, 0x8008, 0x18F2, 0x8004, 0x18D2, 0x800C, 0x1D7C, 0x8008, 0x1D9C, 0x8004,
+  0x1D9D, 0x0005, 0x259C, 0x1DBC, 0x1D9D, 0x259D, 0x1D9C, 0x8005, 0x259C, 0x800E, 0x25BD, 0x0005, 0x25DD, 0x25DD, 0x25BD, 0x25BD,
+  0x1DDD, 0x8003, 0x25DD, 0x0001, 0x25BD, 0x8009, 0x25DD, 0x800C, 0x25FD, 0x0001, 0x2DFD, 0x8004, 0x25FD, 0x8005, 0x2DFD, 0x0004,
+  0x25FD, 0x2DFE, 0x2DFD, 0x2DFD, 0x8012, 0x2E1D, 0x0001, 0x2E3E, 0x8004, 0x2E1D, 0x0002, 0x2E3D, 0x2E3D, 0x8003, 0x2E3E, 0x8014,
+  0x2E3D, 0x8003, 0x2E3E, 0x0001, 0x2E3D, 0x800C, 0x2E3E, 0x8010, 0x2E5E, 0x0001, 0x365E, 0x8003, 0x2E5E, 0x0004, 0x2E3E, 0x365E,
+  0x365E, 0x2E5D, 0x800A, 0x2E5E, 0x800E, 0x2E3E, 0x8003, 0x2E3D, 0x0005, 0x2E3E, 0x2E3D, 0x2E3E, 0x2E3D, 0x363D, 0x8014, 0x2E3D,
+  0x8011, 0x2E1D, 0x8005, 0x361D, 0x8005, 0x3E1D, 0x0009, 0x3E1E, 0x461E, 0x461D, 0x4DFE, 0x4DFD, 0x4E3E, 0x4DFE, 0x55DD, 0x9214,
+  0x8003, 0x9931, 0x000D, 0x9932, 0x9931, 0x9911, 0x9911, 0x9931, 0x7A74, 0x07FB, 0x07F6, 0x07F6, 0x9931, 0x9931, 0x9911, 0x9932,
+  0x8003, 0x9931, 0x0004, 0x4CFB, 0x3DFE, 0x35DD, 0x35DD, 0x8004, 0x2DDD, 0x0008, 0x25DD, 0x25DD, 0x25BD, 0x25BD, 0x25DD, 0x25DD,
+  0x25BD, 0x25DC, 0x8003, 0x25BD, 0x0004, 0x1DBD, 0x25BC, 0x1DBD, 0x1DBD, 0x8006, 0x1DBC, 0x8004, 0x1D9D, 0x8003, 0x1C7C, 0x0001,
+  0x1C7B, 0x8006, 0x1C7C, 0x800C, 0x1C9C, 0x0006, 0x249C, 0x1C9C, 0x1D9D, 0x1D7C, 0x1CFC, 0x1C9C, 0x8010, 0x1CBC, 0x0003, 0x24BC,
+  0x1CBC, 0x1CBC, 0x8003, 0x24BC, 0x0001, 0x1CBC, 0x8003, 0x24DC, 0x0006, 0x253D, 0x25BD, 0x253D, 0x24DD, 0x24BC, 0x24BC, 0x8010,
+  0x24DD, 0x000B, 0x24FD, 0x24DC, 0x24DC, 0x24FD, 0x24FD, 0x24FC, 0x24DD, 0x24FD, 0x251C, 0x25FD, 0x255D, 0x8004, 0x24FD, 0x0001,
+  0x24FC, 0x8008, 0x24FD, 0x8008, 0x2CFD, 0x000F, 0x251D, 0x24FD, 0x24FD, 0x251D, 0x2D1D, 0x24FD, 0x2CFD, 0x25BD, 0x25BD, 0x253C,
+  0x2CFC, 0x2D1D, 0x251D, 0x2CFD, 0x2CFD, 0x8015, 0x2D1D, 0x0003, 0x2D1C, 0x2D5D, 0x2DDE, 0x8009, 0x2D1D, 0x8010, 0x2D3D, 0x0005,
+  0x2D1D, 0x2D3D, 0x2D1D, 0x2D1D, 0x2E1D, 0x8003, 0x2D1D, 0x8010, 0x2D3D, 0x800B, 0x2D1D, 0x0002, 0x2DDD, 0x2D5D, 0x8013, 0x2D1D,
+  0x8004, 0x2CFD, 0x0002, 0x2D1D, 0x2D1D, 0x8003, 0x2CFD, 0x0006, 0x2DBD, 0x2DBD, 0x2CFD, 0x2D1D, 0x251C, 0x251C, 0x8009, 0x2CFD,
+  0x8005, 0x34FD, 0x8004, 0x3CFD, 0x0001, 0x3D1D, 0x8003, 0x451D, 0x0006, 0x4D1D, 0x4D1D, 0x553D, 0x91B3, 0x9931, 0x9911, 0x8003,
+  0x9931, 0x001A, 0xA112, 0x9931, 0x9931, 0x5496, 0x07F7, 0x07F7, 0x8A13, 0xA111, 0x9931, 0x9931, 0x9912, 0x9932, 0x9911, 0x6318,
+  0x34DD, 0x34DD, 0x2CDD, 0x2CDC, 0x2CDD, 0x2CBC, 0x24DC, 0x24BC, 0x24BC, 0x253C, 0x25BD, 0x253C, 0x8003, 0x24BC, 0x0005, 0x1CBC,
+  0x24BC, 0x1CBC, 0x1CBC, 0x24BC, 0x8006, 0x1CBC, 0x8006, 0x1C9C, 0x8010, 0x1ABB, 0x8004, 0x1ADB, 0x0004, 0x1B3B, 0x1CFC, 0x157C,
+  0x1C1C, 0x8012, 0x1ADB, 0x0002, 0x22DB, 0x22DB, 0x8004, 0x1ADB, 0x000E, 0x22DB, 0x22DB, 0x22FB, 0x231C, 0x1D1C, 0x1D5C, 0x235B,
+  0x22DC, 0x22DB, 0x22DC, 0x22FB, 0x22FC, 0x22DC, 0x22DC, 0x8006, 0x22FC, 0x8004, 0x22FB, 0x8008, 0x22FC, 0x0008, 0x231B, 0x22FC,
+  0x233C, 0x253C, 0x1CFD, 0x22FC, 0x22FC, 0x22FB, 0x8010, 0x22FC, 0x8005, 0x231C, 0x000E, 0x2AFC, 0x2AFC, 0x231C, 0x2B1C, 0x2B1C,
+  0x259C, 0x247C, 0x231C, 0x231C, 0x2B1C, 0x231C, 0x231C, 0x2B1C, 0x231C, 0x8016, 0x2B1C, 0x0002, 0x25BD, 0x2BBC, 0x801A, 0x2B1C,
+  0x0004, 0x231C, 0x2B1C, 0x2B1C, 0x25DD, 0x801C, 0x2B1C, 0x0007, 0x231C, 0x2B1C, 0x2B7C, 0x259D, 0x2B1C, 0x2B1C, 0x231C, 0x8008,
+  0x2B1C, 0x8012, 0x231C, 0x0009, 0x245D, 0x259C, 0x22FC, 0x2AFC, 0x231C, 0x2AFC, 0x22FC, 0x231C, 0x231C, 0x8004, 0x2B1C, 0x0001,
+  0x2AFC, 0x8003, 0x2B1C, 0x8005, 0x331C, 0x0001, 0x3B1C, 0x8003, 0x3B3D, 0x0008, 0x433C, 0x433D, 0x4B3D, 0x435D, 0x5A9A, 0x9932,
+  0x9931, 0x9911, 0x8006, 0x9931, 0x0003, 0x1737, 0x07F9, 0x72D4, 0x8006, 0x9931, 0x0010, 0x8194, 0x331C, 0x32FC, 0x2AFB, 0x2AFC,
+  0x2AFB, 0x22FB, 0x22DC, 0x22DC, 0x22FB, 0x22DB, 0x22DB, 0x235C, 0x1D5C, 0x1D1D, 0x231B, 0x8003, 0x1ADB, 0x0002, 0x22DB, 0x1ABB,
+  0x8006, 0x1ADB, 0x0002, 0x1ABB, 0x1ABB, 0x8004, 0x1ADB, 0x800B, 0x137B, 0x0004, 0x1B7B, 0x137B, 0x1B5B, 0x1B7B, 0x8003, 0x137B,
+  0x000C, 0x139B, 0x1BBB, 0x14FB, 0x153C, 0x13FB, 0x1B7B, 0x139B, 0x1B7B, 0x1B7C, 0x1B9B, 0x1B7B, 0x1B7B, 0x8007, 0x1B9B, 0x0001,
+  0x1B9C, 0x8003, 0x1B9B, 0x0001, 0x139C, 0x8007, 0x1B9B, 0x000B, 0x1B9C, 0x1B9B, 0x1D3C, 0x1D5C, 0x1BFB, 0x1B9C, 0x1BBB, 0x1B9B,
+  0x1BBC, 0x1B9B, 0x1B9B, 0x8008, 0x1BBB, 0x0012, 0x1BBC, 0x1BBB, 0x1BBB, 0x1BBC, 0x1BBB, 0x1BBC, 0x1BBB, 0x1BBB, 0x1BBC, 0x1BBB,
+  0x1BBC, 0x1BBB, 0x1BBC, 0x1BBB, 0x1CDC, 0x1D7D, 0x23FC, 0x1BDC, 0x8006, 0x1BBC, 0x8008, 0x23BC, 0x0002, 0x1BBC, 0x1BBC, 0x8006,
+  0x23DC, 0x0001, 0x23BC, 0x8004, 0x23DC, 0x0002, 0x247C, 0x1D9C, 0x801D, 0x23DC, 0x0002, 0x241C, 0x259D, 0x801E, 0x23DC, 0x0001,
+  0x1DBD, 0x801F, 0x23DC, 0x0002, 0x1DBD, 0x243C, 0x801A, 0x23DC, 0x000B, 0x23BC, 0x23DC, 0x23DC, 0x259C, 0x247C, 0x23BC, 0x23BC,
+  0x23DC, 0x23BC, 0x23DC, 0x23DC, 0x8003, 0x23BC, 0x8004, 0x23DC, 0x8005, 0x2BDC, 0x8004, 0x33DC, 0x0007, 0x3BDC, 0x3BFC, 0x3BFC,
+  0x3BDC, 0x43FC, 0x43FD, 0x6B18, 0x8004, 0x9931, 0x000E, 0x9911, 0x9931, 0x9932, 0x9931, 0x6B53, 0x07FA, 0x5437, 0x9931, 0x9931,
+  0x9911, 0x9931, 0x9931, 0x9912, 0x9931, 0x8003, 0x2BBC, 0x0004, 0x2BBB, 0x23BB, 0x23BB, 0x239B, 0x8005, 0x1B9B, 0x0014, 0x1BDB,
+  0x1D5C, 0x1D1C, 0x1B9B, 0x1B9B, 0x139B, 0x139C, 0x1B9B, 0x1B7B, 0x1B7B, 0x139B, 0x1B9B, 0x1B9B, 0x1B7B, 0x1B9B, 0x139B, 0x1B7B,
+  0x1B7B, 0x1B9B, 0x1B9B, 0x800A, 0x135B, 0x0010, 0x137B, 0x135A, 0x135A, 0x137B, 0x135A, 0x135B, 0x139B, 0x14BB, 0x14FB, 0x13FB,
+  0x137B, 0x137B, 0x135B, 0x137B, 0x137A, 0x137A, 0x800C, 0x137B, 0x0002, 0x1B7B, 0x1B7B, 0x8008, 0x137B, 0x000C, 0x1BBB, 0x153C,
+  0x151C, 0x1B7B, 0x139B, 0x137B, 0x139B, 0x139B, 0x1B9B, 0x139B, 0x1B9B, 0x1B9B, 0x8008, 0x139B, 0x8005, 0x1B9B, 0x000C, 0x13BB,
+  0x139B, 0x1B9B, 0x139B, 0x1B9B, 0x1B9B, 0x1B9C, 0x1C3B, 0x1D5C, 0x1C3C, 0x1B9B, 0x1BBB, 0x8007, 0x1B9B, 0x8008, 0x1BBB, 0x0001,
+  0x1B9B, 0x8008, 0x1BBB, 0x0005, 0x1BBC, 0x1BBB, 0x1BBB, 0x1C9C, 0x1D1C, 0x801A, 0x1BBB, 0x0001, 0x1BDB, 0x8003, 0x1BBB, 0x0004,
+  0x1CFC, 0x1C7C, 0x1BBB, 0x1BDB, 0x8018, 0x1BBC, 0x0008, 0x1BBB, 0x1BDC, 0x23BC, 0x1BBB, 0x1D7C, 0x1BBB, 0x1BDC, 0x1BBB, 0x8010,
+  0x1BBC, 0x8008, 0x1BBB, 0x0006, 0x1BBC, 0x1B9C, 0x1BDC, 0x1BBB, 0x1C5B, 0x1CFB, 0x8012, 0x1BBB, 0x8008, 0x1BBC, 0x8003, 0x1BBB,
+  0x000F, 0x1B9B, 0x1D3C, 0x1CBC, 0x1BBB, 0x1BBB, 0x1B9B, 0x1B9C, 0x1B9C, 0x1B9B, 0x1B9B, 0x1BBB, 0x1B9C, 0x1B9B, 0x1BBB, 0x239B,
+  0x8005, 0x23BC, 0x8004, 0x2BBC, 0x0003, 0x33BC, 0x33BC, 0x33DC, 0x8004, 0x3BDC, 0x0001, 0x8194, 0x8003, 0x9931, 0x0007, 0x9911,
+  0x9931, 0x9931, 0x9911, 0x9931, 0x2659, 0x4C98, 0x8004, 0x9931, 0x0005, 0x9911, 0x9931, 0x9931, 0x4B19, 0x23BC, 0x8003, 0x239B,
+  0x8003, 0x1B9B, 0x8004, 0x1B7B, 0x8003, 0x137B, 0x0008, 0x14BB, 0x151B, 0x13DB, 0x137B, 0x137A, 0x137B, 0x137B, 0x137A, 0x8003,
+  0x137B, 0x0002, 0x135B, 0x137B, 0x8003, 0x135B, 0x0001, 0x137B, 0x8004, 0x0999, 0x0011, 0x1199, 0x11BA, 0x11BA, 0x11B9, 0x09B9,
+  0x11BA, 0x1199, 0x11BA, 0x11BA, 0x1199, 0x11DA, 0x0B3A, 0x0C9B, 0x0BFB, 0x127A, 0x11BA, 0x119A, 0x8006, 0x11BA, 0x0001, 0x119A,
+  0x800D, 0x11BA, 0x0001, 0x119A, 0x8005, 0x11BA, 0x0004, 0x12BA, 0x14BB, 0x13FB, 0x11DB, 0x8007, 0x11BA, 0x0001, 0x11DA, 0x800B,
+  0x11BA, 0x000E, 0x11BB, 0x11BA, 0x11DA, 0x11BA, 0x11DA, 0x11BA, 0x11BA, 0x11DA, 0x11BA, 0x127A, 0x14DB, 0x137B, 0x11DA, 0x19BA,
+  0x800D, 0x11DA, 0x8003, 0x19DA, 0x0001, 0x11DA, 0x8007, 0x11DB, 0x0008, 0x19DB, 0x11DA, 0x19DA, 0x1A3B, 0x14FB, 0x1AFB, 0x19DA,
+  0x11DB, 0x8010, 0x19DA, 0x8008, 0x19DB, 0x0008, 0x19DA, 0x19DB, 0x19DA, 0x1A1B, 0x153C, 0x1A3B, 0x19DA, 0x19DA, 0x8008, 0x19DB,
+  0x8010, 0x19DA, 0x0008, 0x19DB, 0x19DB, 0x19DA, 0x19DB, 0x153B, 0x19DB, 0x19DA, 0x19DB, 0x8018, 0x19DA, 0x0009, 0x11DB, 0x19DB,
+  0x19DA, 0x19DB, 0x19FB, 0x153C, 0x123A, 0x19DA, 0x19DA, 0x8005, 0x11DA, 0x0002, 0x19DA, 0x11DB, 0x800A, 0x19DB, 0x8006, 0x11BA,
+  0x0012, 0x19DB, 0x19BA, 0x11DA, 0x11BA, 0x1ABB, 0x14FB, 0x1A5B, 0x19BA, 0x19BA, 0x11DA, 0x11DA, 0x19DB, 0x19DB, 0x19DA, 0x19DB,
+  0x19BA, 0x19DA, 0x19DA, 0x8003, 0x19DB, 0x8003, 0x21DB, 0x0002, 0x21FB, 0x21FB, 0x8004, 0x29FB, 0x0006, 0x31FB, 0x321B, 0x31FB,
+  0x321B, 0x41FA, 0x9912, 0x8006, 0x9931, 0x0005, 0x9912, 0x72D4, 0x4C98, 0x9931, 0x9911, 0x8003, 0x9931, 0x0005, 0x9911, 0x9931,
+  0x5996, 0x21DB, 0x21DA, 0x8003, 0x19DA, 0x0002, 0x11DA, 0x11DA, 0x8007, 0x11BA, 0x000C, 0x11D9, 0x137A, 0x149B, 0x131A, 0x11BA,
+  0x119A, 0x11B9, 0x11BA, 0x11BA, 0x119A, 0x11BA, 0x119A, 0x8005, 0x11BA, 0x8004, 0x0AFA, 0x0010, 0x0B1A, 0x0B1A, 0x0AFA, 0x0AFA,
+  0x0B1A, 0x0AFA, 0x0B1A, 0x0AFA, 0x0B1A, 0x0B1A, 0x0C3A, 0x0C9A, 0x0BDA, 0x0B1A, 0x0AFA, 0x0AFA, 0x8013, 0x0B1A, 0x0004, 0x0B3A,
+  0x0B1A, 0x0B1A, 0x0B3A, 0x8003, 0x0B1A, 0x000E, 0x0BDB, 0x14BB, 0x0BFA, 0x0B1A, 0x0B1A, 0x0B3A, 0x0B3A, 0x0B1A, 0x0B1A, 0x0B3A,
+  0x0B3A, 0x131A, 0x0B3A, 0x0B1A, 0x8008, 0x0B3A, 0x0003, 0x133B, 0x133B, 0x133A, 0x8005, 0x0B3A, 0x0008, 0x133A, 0x0B3A, 0x137A,
+  0x0CDB, 0x0C5B, 0x133B, 0x133B, 0x0B3A, 0x8007, 0x133A, 0x800B, 0x133B, 0x8004, 0x135B, 0x000A, 0x133B, 0x133B, 0x135A, 0x0B5B,
+  0x133B, 0x143A, 0x147B, 0x135B, 0x135A, 0x133B, 0x8012, 0x135A, 0x8008, 0x135B, 0x0003, 0x135A, 0x13BB, 0x14DB, 0x801C, 0x135B,
+  0x0007, 0x135A, 0x135B, 0x133B, 0x14FB, 0x135A, 0x135B, 0x135A, 0x8010, 0x135B, 0x8008, 0x135A, 0x000A, 0x133A, 0x135B, 0x135A,
+  0x135B, 0x135B, 0x149B, 0x13FB, 0x133A, 0x135B, 0x135B, 0x8003, 0x135A, 0x8003, 0x135B, 0x8010, 0x133B, 0x0007, 0x133A, 0x133B,
+  0x133A, 0x135A, 0x133A, 0x143B, 0x147B, 0x8004, 0x133A, 0x0004, 0x133B, 0x133A, 0x133A, 0x133B, 0x8003, 0x133A, 0x0008, 0x135B,
+  0x133B, 0x133B, 0x1B3B, 0x1B5B, 0x1B5B, 0x1B3B, 0x1B5B, 0x8004, 0x235B, 0x0007, 0x2B5B, 0x2B5B, 0x2B7B, 0x2B7B, 0x335B, 0x7235,
+  0x9911, 0x8003, 0x9931, 0x0001, 0x9911, 0x8003, 0x9931, 0x0003, 0x72D5, 0x9932, 0x9932, 0x8005, 0x9931, 0x0006, 0x71B4, 0x1B3B,
+  0x1B3B, 0x133A, 0x133B, 0x133A, 0x8004, 0x131A, 0x8003, 0x0B1A, 0x0007, 0x0B3A, 0x0AFA, 0x0B1A, 0x0AFA, 0x0BDA, 0x0CBB, 0x0BDA,
+  0x800C, 0x0B1A, 0x8006, 0x02D9, 0x0012, 0x02F9, 0x02D9, 0x02DA, 0x0ADA, 0x0AFA, 0x0BFA, 0x0C5B, 0x0BFA, 0x0AD9, 0x02FA, 0x02F9,
+  0x02F9, 0x0AF9, 0x02F9, 0x0AF9, 0x02D9, 0x02F9, 0x0AF9, 0x8010, 0x0AFA, 0x0001, 0x0AF9, 0x8003, 0x0AFA, 0x0006, 0x0C1A, 0x0C7B,
+  0x0B5A, 0x0AFA, 0x0AF9, 0x0B1A, 0x8003, 0x0AFA, 0x0004, 0x0B1A, 0x0AFA, 0x0AFA, 0x0B1A, 0x8008, 0x0AFA, 0x8003, 0x0B1A, 0x0005,
+  0x031A, 0x0AFA, 0x0B1A, 0x0B1A, 0x0AFA, 0x8003, 0x0B1A, 0x0005, 0x0AFA, 0x0C3A, 0x0C5A, 0x0B1A, 0x0AFA, 0x801D, 0x0B1A, 0x0002,
+  0x0C5B, 0x0C1A, 0x801E, 0x0B1A, 0x0004, 0x0B3A, 0x0C7B, 0x0B7A, 0x0B3A, 0x801E, 0x0B1A, 0x0003, 0x0CBB, 0x0B1A, 0x0B3A, 0x801E,
+  0x0B1A, 0x0002, 0x0B7A, 0x0CBB, 0x801F, 0x0B1A, 0x0002, 0x0BDA, 0x0C7B, 0x800C, 0x0B1A, 0x8005, 0x131A, 0x0001, 0x1B1A, 0x8004,
+  0x1B3A, 0x0006, 0x233A, 0x233A, 0x233B, 0x2B3B, 0x2B5B, 0x3AD9, 0x8003, 0x9931, 0x0001, 0x9912, 0x8005, 0x9931, 0x0001, 0x9911,
+  0x8006, 0x9931, 0x0005, 0x8993, 0x1B1A, 0x131A, 0x131A, 0x12FA, 0x800C, 0x0AFA, 0x000A, 0x02FA, 0x0AFA, 0x035A, 0x045A, 0x0C3A,
+  0x0AFA, 0x02DA, 0x0AFA, 0x0AF9, 0x02F9, 0x8003, 0x0AFA, 0x0002, 0x02D9, 0x02D9, 0x8004, 0x0158, 0x0001, 0x0138, 0x8003, 0x0158,
+  0x0005, 0x0138, 0x0238, 0x03B9, 0x03DA, 0x0259, 0x8018, 0x0158, 0x000D, 0x0138, 0x0178, 0x0158, 0x0158, 0x0159, 0x01B9, 0x037A,
+  0x0BDA, 0x0218, 0x0958, 0x0159, 0x0159, 0x0958, 0x8004, 0x0158, 0x0006, 0x0958, 0x0959, 0x0158, 0x0159, 0x0179, 0x0158, 0x8004,
+  0x0159, 0x8004, 0x0158, 0x0010, 0x0979, 0x0179, 0x0958, 0x0979, 0x0159, 0x0178, 0x0159, 0x0958, 0x033A, 0x041A, 0x01F9, 0x0959,
+  0x0179, 0x0958, 0x0959, 0x0158, 0x8004, 0x0159, 0x8004, 0x0979, 0x8008, 0x0179, 0x0004, 0x0979, 0x0979, 0x0959, 0x0959, 0x8005,
+  0x0979, 0x0006, 0x0A79, 0x043A, 0x0199, 0x0959, 0x0179, 0x0179, 0x8011, 0x0979, 0x8008, 0x0179, 0x0008, 0x0979, 0x0179, 0x09B9,
+  0x0C3B, 0x0179, 0x0979, 0x0179, 0x0179, 0x8019, 0x0979, 0x0007, 0x0179, 0x0979, 0x0179, 0x0C7A, 0x0979, 0x0179, 0x0179, 0x8010,
+  0x0979, 0x800A, 0x0179, 0x8004, 0x0979, 0x0002, 0x0BFA, 0x0259, 0x8005, 0x0979, 0x0001, 0x0959, 0x8012, 0x0979, 0x0010, 0x0179,
+  0x0958, 0x0979, 0x0178, 0x0958, 0x0159, 0x0999, 0x0BDA, 0x02D9, 0x0159, 0x0959, 0x0159, 0x0979, 0x0959, 0x0979, 0x0959, 0x8008,
+  0x0979, 0x8005, 0x1179, 0x000A, 0x1999, 0x1999, 0x199A, 0x1999, 0x2199, 0x219A, 0x21BA, 0x7154, 0x9931, 0x9911, 0x8003, 0x9931,
+  0x0001, 0x9911, 0x8004, 0x9931, 0x0001, 0x9911, 0x8005, 0x9931, 0x8003, 0x1179, 0x0002, 0x0979, 0x0979, 0x8004, 0x0958, 0x8003,
+  0x0158, 0x0001, 0x0958, 0x8004, 0x0158, 0x000A, 0x0159, 0x0158, 0x01D8, 0x0399, 0x0399, 0x01D9, 0x0158, 0x0158, 0x0138, 0x0138,
+  0x8004, 0x0158, 0x8005, 0x0137, 0x000C, 0x0138, 0x0137, 0x01D8, 0x0339, 0x0399, 0x0238, 0x0137, 0x0137, 0x0138, 0x0138, 0x0137,
+  0x0137, 0x8005, 0x0138, 0x0005, 0x0137, 0x0137, 0x0138, 0x0138, 0x0137, 0x800C, 0x0138, 0x000D, 0x0157, 0x0138, 0x0278, 0x03D9,
+  0x02B9, 0x0178, 0x0158, 0x0138, 0x0138, 0x0158, 0x0138, 0x0137, 0x0137, 0x8005, 0x0138, 0x0002, 0x0137, 0x0158, 0x8006, 0x0138,
+  0x8003, 0x0158, 0x0003, 0x0138, 0x0138, 0x0938, 0x8003, 0x0158, 0x0004, 0x0178, 0x0339, 0x0399, 0x0178, 0x801E, 0x0158, 0x0003,
+  0x01D9, 0x03F9, 0x01F9, 0x801F, 0x0158, 0x0002, 0x02D9, 0x0319, 0x8003, 0x0158, 0x0001, 0x0159, 0x8018, 0x0158, 0x0006, 0x0959,
+  0x0158, 0x0158, 0x0159, 0x041A, 0x0959, 0x8020, 0x0158, 0x0006, 0x02B9, 0x0319, 0x0158, 0x0158, 0x0138, 0x0138, 0x8019, 0x0158,
+  0x0007, 0x0138, 0x0158, 0x01D8, 0x03F9, 0x01F8, 0x0138, 0x0138, 0x8008, 0x0158, 0x8005, 0x0958, 0x8003, 0x1158, 0x0002, 0x1178,
+  0x1179, 0x8004, 0x1979, 0x0003, 0x1999, 0x2179, 0x3178, 0x8005, 0x9931, 0x0003, 0x9911, 0x9931, 0x9911, 0x8008, 0x9931, 0x0005,
+  0x3157, 0x0958, 0x1158, 0x0958, 0x0958, 0x8004, 0x0938, 0x8005, 0x0138, 0x0002, 0x0137, 0x0137, 0x8005, 0x0138, 0x0005, 0x0298,
+  0x03F9, 0x0298, 0x0137, 0x0138, 0x8005, 0x0137, 0x8005, 0x0117, 0x0004, 0x01D7, 0x0318, 0x0379, 0x0238, 0x800B, 0x0117, 0x0001,
+  0x0137, 0x8006, 0x0117, 0x0001, 0x0137, 0x8008, 0x0117, 0x0013, 0x0137, 0x0117, 0x0117, 0x0177, 0x0318, 0x0379, 0x01D7, 0x0137,
+  0x0117, 0x0137, 0x0117, 0x0137, 0x0136, 0x0117, 0x0117, 0x0137, 0x0137, 0x0117, 0x0117, 0x8003, 0x0137, 0x0001, 0x0117, 0x8003,
+  0x0137, 0x8003, 0x0117, 0x8005, 0x0137, 0x000C, 0x0138, 0x0137, 0x0117, 0x0157, 0x0359, 0x02F8, 0x0157, 0x0117, 0x0137, 0x0117,
+  0x0137, 0x0117, 0x8003, 0x0137, 0x800F, 0x0138, 0x8007, 0x0137, 0x0009, 0x0158, 0x0359, 0x0278, 0x0137, 0x0138, 0x0137, 0x0138,
+  0x0138, 0x0137, 0x8018, 0x0138, 0x0008, 0x0137, 0x0138, 0x03B9, 0x01B8, 0x0137, 0x0138, 0x0138, 0x0137, 0x8018, 0x0138, 0x8003,
+  0x0137, 0x0005, 0x0138, 0x03F9, 0x0137, 0x0138, 0x0137, 0x8019, 0x0138, 0x000A, 0x0137, 0x0138, 0x0118, 0x0138, 0x0138, 0x0178,
+  0x03F9, 0x0158, 0x0137, 0x0137, 0x8015, 0x0138, 0x8003, 0x0137, 0x000E, 0x0138, 0x0138, 0x0137, 0x0137, 0x0118, 0x0238, 0x03B9,
+  0x0177, 0x0137, 0x0138, 0x0137, 0x0117, 0x0137, 0x0138, 0x8004, 0x0137, 0x0001, 0x0937, 0x8005, 0x0938, 0x0001, 0x0958, 0x8005,
+  0x1158, 0x0008, 0x1958, 0x1958, 0x1959, 0x1978, 0x6934, 0x9931, 0x9931, 0x9912, 0x8005, 0x9931, 0x0003, 0x9912, 0x9931, 0x9911,
+  0x8003, 0x9931, 0x0004, 0x9932, 0x4135, 0x0938, 0x0957, 0x8004, 0x0937, 0x8009, 0x0117, 0x0002, 0x0137, 0x0137, 0x8004, 0x0117,
+  0x0004, 0x0197, 0x0318, 0x0338, 0x01B7, 0x8005, 0x0117, 0x0008, 0x02D8, 0x02D8, 0x02D7, 0x02D7, 0x02F7, 0x0358, 0x0378, 0x02F7,
+  0x8003, 0x02D8, 0x8006, 0x02D7, 0x800E, 0x02D8, 0x8005, 0x02F8, 0x0007, 0x02D7, 0x02F8, 0x02F8, 0x0398, 0x0378, 0x02F8, 0x02D8,
+  0x801E, 0x02F8, 0x0002, 0x0378, 0x0398, 0x8019, 0x02F8, 0x0010, 0x0318, 0x02F8, 0x0318, 0x02F7, 0x02F8, 0x02F8, 0x0318, 0x0358,
+  0x0399, 0x0318, 0x02F8, 0x02F8, 0x0318, 0x0318, 0x02F8, 0x0318, 0x8008, 0x02F8, 0x8011, 0x0318, 0x0005, 0x0338, 0x03B8, 0x0318,
+  0x0318, 0x02F8, 0x801E, 0x0318, 0x0001, 0x03B8, 0x801D, 0x0318, 0x000C, 0x02F8, 0x0318, 0x0318, 0x02F8, 0x0318, 0x0378, 0x0338,
+  0x02F8, 0x02F8, 0x0318, 0x02F8, 0x0318, 0x8012, 0x02F8, 0x0002, 0x0318, 0x0318, 0x8007, 0x02F8, 0x0002, 0x0378, 0x0338, 0x800D,
+  0x02F8, 0x8004, 0x0AF8, 0x0003, 0x0B18, 0x0B18, 0x1318, 0x8005, 0x1319, 0x0002, 0x1B18, 0x2AF8, 0x8004, 0x9931, 0x0008, 0x9911,
+  0x9931, 0x9931, 0x9932, 0x9931, 0x9911, 0x9931, 0x9932, 0x8003, 0x9931, 0x0003, 0x5215, 0x0AF8, 0x0AF8, 0x8004, 0x02F8, 0x800E,
+  0x02D8, 0x000A, 0x02D7, 0x02D8, 0x02D8, 0x0378, 0x0378, 0x02D7, 0x02D8, 0x02D7, 0x02D7, 0x02D8, 0x0007, 0x0176, 0x01B6, 0x02F8,
+  0x0317, 0x0217, 0x0196, 0x0176, 0x8004, 0x0196, 0x0001, 0x0176, 0x8011, 0x0196, 0x0001, 0x0176, 0x8006, 0x0196, 0x0008, 0x01F7,
+  0x0337, 0x02D7, 0x01B6, 0x0197, 0x0196, 0x0196, 0x0176, 0x8012, 0x0196, 0x0001, 0x0197, 0x8008, 0x0196, 0x0003, 0x0237, 0x0358,
+  0x0217, 0x800A, 0x0196, 0x8010, 0x0197, 0x000A, 0x0196, 0x0196, 0x0197, 0x0197, 0x0196, 0x0196, 0x0277, 0x0318, 0x01B6, 0x0196,
+  0x8016, 0x0197, 0x0001, 0x01B7, 0x8007, 0x0197, 0x0007, 0x01B6, 0x02F7, 0x0257, 0x0197, 0x01B6, 0x01B7, 0x01B6, 0x801A, 0x0197,
+  0x0005, 0x01B7, 0x01B6, 0x01B7, 0x0378, 0x01B7, 0x8020, 0x0197, 0x000A, 0x01B6, 0x01F7, 0x0358, 0x0196, 0x0196, 0x01B6, 0x0196,
+  0x01B6, 0x0197, 0x0196, 0x8016, 0x0197, 0x0006, 0x0196, 0x0196, 0x0197, 0x0197, 0x02F7, 0x02F7, 0x8004, 0x0196, 0x0005, 0x0197,
+  0x0196, 0x0197, 0x01B6, 0x01B6, 0x8003, 0x0196, 0x8003, 0x0197, 0x0002, 0x09B7, 0x0997, 0x8003, 0x09B7, 0x0003, 0x11B7, 0x11B7,
+  0x11D7, 0x8003, 0x11B7, 0x0003, 0x7153, 0x9931, 0x9911, 0x800C, 0x9931, 0x0004, 0x6174, 0x09B6, 0x0196, 0x0197, 0x800F, 0x0196,
+  0x0001, 0x0176, 0x8004, 0x0196, 0x0007, 0x0177, 0x0196, 0x02B7, 0x0337, 0x0216, 0x0196, 0x0196, 0x0004, 0x0236, 0x0317, 0x0256,
+  0x00F4, 0x8018, 0x00D5, 0x000B, 0x00F5, 0x00F5, 0x00D5, 0x00F5, 0x00D5, 0x00D5, 0x00F5, 0x01F6, 0x0317, 0x01F6, 0x00F5, 0x8004,
+  0x00D5, 0x0001, 0x00F5, 0x8011, 0x00D5, 0x0002, 0x00F5, 0x00F5, 0x8004, 0x00D5, 0x0006, 0x00F5, 0x00D5, 0x00F5, 0x01B6, 0x0337,
+  0x01B6, 0x8020, 0x00F5, 0x0005, 0x0155, 0x0337, 0x0156, 0x00D5, 0x00D5, 0x8003, 0x00F6, 0x0003, 0x00F5, 0x00D6, 0x00D6, 0x8008,
+  0x00F6, 0x8008, 0x00F5, 0x0004, 0x00F6, 0x00D5, 0x00F6, 0x00F6, 0x8003, 0x00F5, 0x0009, 0x00F6, 0x0115, 0x0338, 0x0115, 0x00F6,
+  0x00F5, 0x00F6, 0x00F5, 0x00D6, 0x8018, 0x00F5, 0x0008, 0x00D5, 0x00F6, 0x00D5, 0x00F5, 0x0357, 0x00F5, 0x00F6, 0x00F6, 0x8018,
+  0x00F5, 0x000F, 0x00F6, 0x00F5, 0x00D5, 0x00D5, 0x00D6, 0x00D6, 0x00D5, 0x00F5, 0x02F7, 0x0176, 0x00F5, 0x00D5, 0x00F5, 0x00F6,
+  0x00F6, 0x8018, 0x00F5, 0x0009, 0x00D5, 0x00F5, 0x00D5, 0x0116, 0x02F7, 0x01D6, 0x00D6, 0x00D5, 0x00F5, 0x8005, 0x00D5, 0x0003,
+  0x00F5, 0x00D5, 0x00D5, 0x8005, 0x00F5, 0x8004, 0x08F6, 0x0006, 0x0916, 0x0916, 0x10F6, 0x1117, 0x1116, 0x3135, 0x8004, 0x9931,
+  0x0001, 0x9911, 0x8003, 0x9931, 0x0002, 0x9911, 0x9912, 0x8004, 0x9931, 0x0003, 0x7113, 0x08F5, 0x08F6, 0x8004, 0x00F5, 0x8010,
+  0x00D5, 0x0001, 0x00D4, 0x8003, 0x00D5, 0x0004, 0x01D6, 0x02F7, 0x0236, 0x0114, 0x0004, 0x01F4, 0x0113, 0x00B3, 0x00D3, 0x8007,
+  0x00B3, 0x0001, 0x00D3, 0x8009, 0x00B3, 0x0017, 0x00D3, 0x00B3, 0x00D3, 0x00D4, 0x00B3, 0x00B3, 0x00D4, 0x00B3, 0x00B3, 0x00D4,
+  0x00B3, 0x00D3, 0x0133, 0x0275, 0x0255, 0x0134, 0x00D3, 0x00B3, 0x00D3, 0x00D3, 0x00D4, 0x00D4, 0x00B4, 0x8012, 0x00D4, 0x000C,
+  0x00B4, 0x00D4, 0x00B4, 0x00D4, 0x00D4, 0x00B4, 0x00B4, 0x01D4, 0x02B5, 0x0134, 0x00D4, 0x00B4, 0x801E, 0x00D4, 0x0003, 0x00F4,
+  0x02B5, 0x01B5, 0x8021, 0x00D4, 0x0004, 0x01B5, 0x0255, 0x00D5, 0x00B4, 0x8020, 0x00D4, 0x0001, 0x02F6, 0x8023, 0x00D4, 0x0002,
+  0x01F5, 0x0235, 0x8017, 0x00D4, 0x8007, 0x00B4, 0x0009, 0x00D4, 0x00D4, 0x00B4, 0x0154, 0x02B5, 0x0134, 0x00D4, 0x00B4, 0x00B4,
+  0x8003, 0x00D4, 0x0001, 0x00B4, 0x8009, 0x00D4, 0x8003, 0x08D4, 0x8003, 0x08F4, 0x0004, 0x08F5, 0x10F4, 0x10D5, 0x7912, 0x8009,
+  0x9931, 0x0001, 0x9911, 0x8003, 0x9931, 0x0001, 0x8132, 0x8003, 0x00D4, 0x8005, 0x00D3, 0x0002, 0x00B3, 0x00D3, 0x800E, 0x00B3,
+  0x0006, 0x00B2, 0x00B3, 0x00D3, 0x00D3, 0x0214, 0x0295, 0x0001, 0x00B1, 0x8003, 0x0091, 0x0005, 0x00B1, 0x0091, 0x00B1, 0x00B1,
+  0x0091, 0x8014, 0x00B1, 0x000F, 0x0091, 0x0091, 0x00D2, 0x01B2, 0x0273, 0x0172, 0x00B1, 0x00B2, 0x00B1, 0x00B1, 0x00B2, 0x00B1,
+  0x00B1, 0x00B2, 0x00B1, 0x8010, 0x00B2, 0x0005, 0x00B1, 0x00B1, 0x00B2, 0x00B2, 0x00B1, 0x8003, 0x00B2, 0x0003, 0x01D3, 0x0253,
+  0x0112, 0x8021, 0x00B2, 0x0003, 0x0213, 0x01D3, 0x0092, 0x8021, 0x00B2, 0x0002, 0x0253, 0x0153, 0x8022, 0x00B2, 0x0001, 0x0294,
+  0x8023, 0x00B2, 0x0003, 0x00F2, 0x0293, 0x00D2, 0x801F, 0x00B2, 0x0006, 0x00B1, 0x00B2, 0x0172, 0x0253, 0x00B1, 0x00B1, 0x8005,
+  0x00B2, 0x8003, 0x00B1, 0x8007, 0x00B2, 0x8003, 0x08B2, 0x0007, 0x08D2, 0x08B2, 0x08D2, 0x08D3, 0x10D3, 0x40F2, 0x9911, 0x8007,
+  0x9931, 0x0001, 0x9911, 0x8004, 0x9931, 0x0003, 0x9911, 0x00D2, 0x00B2, 0x8011, 0x00B1, 0x0001, 0x0091, 0x8008, 0x00B1, 0x0002,
+  0x0091, 0x0131, 0x0002, 0x0090, 0x0070, 0x801C, 0x0090, 0x0004, 0x0111, 0x0212, 0x01D1, 0x00D0, 0x8020, 0x0090, 0x0004, 0x00B0,
+  0x01D2, 0x01F2, 0x00B0, 0x801F, 0x0090, 0x0005, 0x00B0, 0x00B0, 0x0171, 0x0212, 0x00B0, 0x8006, 0x0090, 0x0004, 0x00B0, 0x00B0,
+  0x0090, 0x0090, 0x8010, 0x00B0, 0x8003, 0x0090, 0x000D, 0x00B0, 0x00B0, 0x0090, 0x0090, 0x00F1, 0x0252, 0x00B0, 0x0090, 0x00B0,
+  0x0090, 0x0090, 0x00B0, 0x00B0, 0x8018, 0x0090, 0x0008, 0x00B0, 0x00B0, 0x0090, 0x0090, 0x0272, 0x00B0, 0x0090, 0x00B0, 0x8019,
+  0x0090, 0x8004, 0x00B0, 0x8004, 0x0090, 0x0005, 0x01D1, 0x0171, 0x0091, 0x00B0, 0x00B0, 0x801F, 0x0090, 0x0004, 0x01D1, 0x01D1,
+  0x0090, 0x00B0, 0x8003, 0x0090, 0x8003, 0x00B0, 0x8006, 0x0090, 0x8004, 0x0091, 0x8007, 0x08B1, 0x0001, 0x8912, 0x8005, 0x9931,
+  0x0001, 0x9911, 0x8003, 0x9931, 0x0005, 0x9911, 0x9911, 0x9912, 0x9931, 0x0091, 0x801D, 0x0090, 0x800B, 0x0090, 0x0001, 0x008F,
+  0x8010, 0x0090, 0x0004, 0x00B0, 0x0191, 0x0232, 0x0151, 0x800A, 0x0090, 0x0001, 0x00B0, 0x8016, 0x0090, 0x0004, 0x00B0, 0x01F2,
+  0x01D1, 0x00B0, 0x8021, 0x0090, 0x0003, 0x0110, 0x0252, 0x00D0, 0x8022, 0x0090, 0x0002, 0x01B1, 0x0191, 0x8020, 0x0090, 0x0004,
+  0x00B0, 0x0090, 0x0090, 0x0252, 0x8024, 0x0090, 0x0002, 0x0151, 0x0232, 0x8022, 0x0090, 0x0004, 0x00B0, 0x01F1, 0x0171, 0x00B0,
+  0x800F, 0x0090, 0x000C, 0x0091, 0x00B0, 0x00B0, 0x00B1, 0x08B1, 0x08B0, 0x08B1, 0x08B1, 0x50F1, 0x9931, 0x9931, 0x9911, 0x8004,
+  0x9931, 0x0006, 0x9911, 0x9931, 0x9911, 0x9931, 0x9911, 0x9931, 0x801B, 0x0090, 0x0003, 0x0070, 0x0090, 0x0090, 0x8003, 0x008F,
+  0x8003, 0x0090, 0x8005, 0x008F, 0x8009, 0x0090, 0x0003, 0x008F, 0x008F, 0x0090, 0x8004, 0x008F, 0x0007, 0x00D0, 0x0212, 0x01D2,
+  0x00D0, 0x0090, 0x008F, 0x0090, 0x8007, 0x008F, 0x0003, 0x0090, 0x008F, 0x008F, 0x8011, 0x0090, 0x0006, 0x008F, 0x0090, 0x0090,
+  0x00F0, 0x0232, 0x01B1, 0x8004, 0x0090, 0x0002, 0x008F, 0x008F, 0x801D, 0x0090, 0x0002, 0x0232, 0x0130, 0x8022, 0x0090, 0x0003,
+  0x00B0, 0x0232, 0x00D0, 0x8005, 0x0090, 0x0002, 0x008F, 0x008F, 0x801C, 0x0090, 0x0001, 0x0252, 0x8025, 0x0090, 0x0004, 0x0232,
+  0x00F0, 0x0090, 0x0070, 0x8020, 0x0090, 0x0008, 0x00F0, 0x0232, 0x00F1, 0x00B0, 0x008F, 0x008F, 0x0090, 0x008F, 0x800D, 0x0090,
+  0x0009, 0x00B0, 0x00B0, 0x0890, 0x08B0, 0x0891, 0x10B0, 0x9931, 0x9911, 0x9911, 0x8003, 0x9931, 0x0001, 0x9911, 0x8006, 0x9931,
+  0x8012, 0x0090, 0x0001, 0x008F, 0x8006, 0x0090, 0x8005, 0x008F, 0x8010, 0x008F, 0x0001, 0x006F, 0x8004, 0x008F, 0x0001, 0x006F,
+  0x8004, 0x008F, 0x0008, 0x0171, 0x0232, 0x0151, 0x008F, 0x006F, 0x008F, 0x008F, 0x006F, 0x8014, 0x008F, 0x0002, 0x0070, 0x0090,
+  0x8004, 0x008F, 0x0007, 0x006F, 0x008F, 0x006F, 0x00F0, 0x0212, 0x0151, 0x006F, 0x8011, 0x008F, 0x8008, 0x0090, 0x0003, 0x008F,
+  0x008F, 0x0090, 0x8004, 0x008F, 0x0007, 0x0070, 0x0090, 0x01F1, 0x01B1, 0x0070, 0x008F, 0x008F, 0x801A, 0x0090, 0x8003, 0x008F,
+  0x0005, 0x0090, 0x008F, 0x008F, 0x0130, 0x01F1, 0x8004, 0x0090, 0x8020, 0x008F, 0x0001, 0x0252, 0x801B, 0x008F, 0x8009, 0x0090,
+  0x0004, 0x008F, 0x0191, 0x01B1, 0x0090, 0x8003, 0x008F, 0x8018, 0x0090, 0x000B, 0x008F, 0x0090, 0x0090, 0x008F, 0x0090, 0x006F,
+  0x008F, 0x0131, 0x0232, 0x00D0, 0x0090, 0x8003, 0x008F, 0x0004, 0x0090, 0x0090, 0x008F, 0x008F, 0x800F, 0x0090, 0x0001, 0x60F1,
+  0x800C, 0x9931, 0x0001, 0x0150, 0x8003, 0x0090, 0x0006, 0x006F, 0x0090, 0x006F, 0x008F, 0x008F, 0x0070, 0x8014, 0x008F, 0x800E,
+  0x008F, 0x8006, 0x006F, 0x0008, 0x0070, 0x008F, 0x006F, 0x008F, 0x0110, 0x0232, 0x01B1, 0x00AF, 0x8005, 0x008F, 0x0001, 0x006F,
+  0x8013, 0x008F, 0x0003, 0x006F, 0x008F, 0x006F, 0x8005, 0x008F, 0x0006, 0x006F, 0x0110, 0x0252, 0x0130, 0x008F, 0x006F, 0x8020,
+  0x008F, 0x0003, 0x006F, 0x0170, 0x01F2, 0x8021, 0x008F, 0x0005, 0x006F, 0x008F, 0x008F, 0x01D2, 0x0130, 0x8021, 0x008F, 0x0004,
+  0x006F, 0x008F, 0x008F, 0x0252, 0x8025, 0x008F, 0x0003, 0x00CF, 0x0232, 0x00AF, 0x801C, 0x008F, 0x0003, 0x006F, 0x008F, 0x008F,
+  0x8003, 0x006F, 0x0008, 0x008F, 0x0191, 0x0212, 0x006F, 0x008F, 0x008F, 0x006F, 0x006F, 0x8009, 0x008F, 0x8008, 0x0090, 0x0005,
+  0x008F, 0x18AF, 0x9911, 0x9912, 0x9911, 0x8003, 0x9931, 0x000F, 0x9911, 0x9931, 0x9931, 0xA111, 0x9931, 0xA111, 0x29D2, 0x01B1,
+  0x008F, 0x006F, 0x008F, 0x006F, 0x008F, 0x008F, 0x006F, 0x8015, 0x008F, 0x800C, 0x006F, 0x0002, 0x008F, 0x008F, 0x8003, 0x006F,
+  0x0001, 0x008F, 0x8004, 0x006F, 0x0005, 0x008F, 0x01B1, 0x0232, 0x010F, 0x008F, 0x8004, 0x006F, 0x0002, 0x008F, 0x008F, 0x8014,
+  0x006F, 0x0002, 0x008F, 0x008F, 0x8006, 0x006F, 0x0006, 0x0150, 0x0232, 0x00CF, 0x006F, 0x006F, 0x008E, 0x801E, 0x006F, 0x0007,
+  0x008F, 0x006F, 0x010F, 0x0212, 0x00AF, 0x006F, 0x008F, 0x801C, 0x006F, 0x0008, 0x008F, 0x008F, 0x006F, 0x006F, 0x008F, 0x00AF,
+  0x0212, 0x00AF, 0x8020, 0x006F, 0x0007, 0x008F, 0x008F, 0x006F, 0x006F, 0x0252, 0x006F, 0x008F, 0x8021, 0x006F, 0x0007, 0x008F,
+  0x006F, 0x006F, 0x01D1, 0x0130, 0x008F, 0x008F, 0x801C, 0x006F, 0x0001, 0x008F, 0x8005, 0x006F, 0x0006, 0x01F1, 0x01B1, 0x008F,
+  0x006F, 0x006F, 0x008F, 0x8006, 0x006F, 0x800B, 0x008F, 0x0003, 0x006F, 0x0090, 0x8111, 0x8007, 0x9931, 0x0008, 0x9912, 0x9932,
+  0x9931, 0x9931, 0x28D0, 0x01F2, 0x01D1, 0x008F, 0x8004, 0x006F, 0x0002, 0x006E, 0x008F, 0x8014, 0x006F, 0x8014, 0x006E, 0x000B,
+  0x008E, 0x0110, 0x0212, 0x01B1, 0x008F, 0x006F, 0x006E, 0x006F, 0x006F, 0x006E, 0x008F, 0x8003, 0x006E, 0x0002, 0x006F, 0x006F,
+  0x8010, 0x006E, 0x0010, 0x006F, 0x008F, 0x006E, 0x006E, 0x006F, 0x006F, 0x008E, 0x006E, 0x0191, 0x01F1, 0x00CF, 0x006F, 0x006F,
+  0x006E, 0x008F, 0x006E, 0x8019, 0x006F, 0x000E, 0x008F, 0x008F, 0x006E, 0x006E, 0x006F, 0x00CF, 0x0212, 0x0110, 0x008F, 0x006F,
+  0x006E, 0x008F, 0x006F, 0x006E, 0x801E, 0x006F, 0x0002, 0x0150, 0x0191, 0x8025, 0x006F, 0x0001, 0x0232, 0x8026, 0x006F, 0x0004,
+  0x0110, 0x01F1, 0x008F, 0x006E, 0x8022, 0x006F, 0x0006, 0x00AF, 0x0212, 0x0110, 0x006F, 0x006F, 0x008F, 0x8009, 0x006F, 0x8004,
+  0x008F, 0x8006, 0x006F, 0x0004, 0x48D0, 0x9931, 0x9931, 0x9911, 0x8008, 0x9931, 0x000A, 0x008E, 0x008F, 0x01B1, 0x01F2, 0x00AF,
+  0x006F, 0x006E, 0x008F, 0x006E, 0x008F, 0x8014, 0x006E, 0x8013, 0x006E, 0x0004, 0x008E, 0x01B1, 0x0212, 0x00EF, 0x8003, 0x006E,
+  0x0001, 0x006F, 0x801C, 0x006E, 0x0008, 0x006F, 0x006E, 0x006E, 0x008E, 0x01D1, 0x01F1, 0x008F, 0x006F, 0x8022, 0x006E, 0x0004,
+  0x00AE, 0x01F1, 0x0170, 0x006F, 0x8003, 0x006E, 0x0004, 0x006F, 0x006E, 0x006E, 0x006F, 0x801D, 0x006E, 0x0003, 0x0211, 0x00CF,
+  0x008F, 0x8024, 0x006E, 0x0001, 0x0232, 0x8026, 0x006E, 0x0003, 0x008F, 0x0212, 0x00CF, 0x8024, 0x006E, 0x0003, 0x00EF, 0x0212,
+  0x00CF, 0x800B, 0x006E, 0x8009, 0x006F, 0x0003, 0x006E, 0x108F, 0x9911, 0x800A, 0x9931, 0x0006, 0x006E, 0x006F, 0x006E, 0x0190,
+  0x0212, 0x00CF, 0x8018, 0x006E, 0x8012, 0x006E, 0x0004, 0x0130, 0x0212, 0x0170, 0x008E, 0x8005, 0x006E, 0x0001, 0x004E, 0x801D,
+  0x006E, 0x0004, 0x00AF, 0x01D1, 0x0190, 0x008E, 0x8024, 0x006E, 0x0002, 0x0190, 0x01F1, 0x8025, 0x006E, 0x0002, 0x00EF, 0x0211,
+  0x8026, 0x006E, 0x0001, 0x0232, 0x8027, 0x006E, 0x0002, 0x0170, 0x0190, 0x8025, 0x006E, 0x0003, 0x0150, 0x01F1, 0x008E, 0x8015,
+  0x006E, 0x0004, 0x68F0, 0x9931, 0x9931, 0x9911, 0x8003, 0x9931, 0x0001, 0x9911, 0x8003, 0x9931, 0x8004, 0x006E, 0x0003, 0x010F,
+  0x0212, 0x00EF, 0x8017, 0x006E, 0x8010, 0x006E, 0x0004, 0x008E, 0x01B1, 0x01F2, 0x00CF, 0x8024, 0x006E, 0x0006, 0x00AF, 0x0212,
+  0x0191, 0x006E, 0x006E, 0x004E, 0x8003, 0x006E, 0x0002, 0x004E, 0x008E, 0x801D, 0x006E, 0x0006, 0x010F, 0x0212, 0x008E, 0x006E,
+  0x006E, 0x004E, 0x8022, 0x006E, 0x0002, 0x0190, 0x0150, 0x8026, 0x006E, 0x0001, 0x0232, 0x8027, 0x006E, 0x0003, 0x008E, 0x0211,
+  0x008E, 0x8025, 0x006E, 0x0002, 0x0190, 0x01B1, 0x8015, 0x006E, 0x0001, 0x38B0, 0x8007, 0x9931, 0x000B, 0x9911, 0x9931, 0x9912,
+  0x004E, 0x006E, 0x006E, 0x004E, 0x006E, 0x010F, 0x0212, 0x010F, 0x8016, 0x006E, 0x800C, 0x006E, 0x0008, 0x004E, 0x004E, 0x004D,
+  0x0130, 0x01F2, 0x0150, 0x006D, 0x006D, 0x8005, 0x006E, 0x0001, 0x004E, 0x801C, 0x006E, 0x0007, 0x004E, 0x00EF, 0x0212, 0x010F,
+  0x004E, 0x006E, 0x004E, 0x8005, 0x006E, 0x0001, 0x004E, 0x801A, 0x006E, 0x0009, 0x004E, 0x004E, 0x00AF, 0x0212, 0x00CF, 0x004E,
+  0x006E, 0x004E, 0x004E, 0x8003, 0x006E, 0x0001, 0x004E, 0x801B, 0x006E, 0x0006, 0x004E, 0x006E, 0x008E, 0x0232, 0x008E, 0x004E,
+  0x8025, 0x006E, 0x0001, 0x0232, 0x8023, 0x006E, 0x0007, 0x004E, 0x006E, 0x004E, 0x006E, 0x006E, 0x01D1, 0x010F, 0x801E, 0x006E,
+  0x000B, 0x004E, 0x006E, 0x006E, 0x004E, 0x006E, 0x004E, 0x006E, 0x008E, 0x01F1, 0x012F, 0x004E, 0x8010, 0x006E, 0x0005, 0x004E,
+  0x004E, 0x006E, 0x086E, 0x9911, 0x8004, 0x9931, 0x0007, 0x9912, 0x9931, 0x9931, 0x9911, 0x9931, 0x004E, 0x006D, 0x8004, 0x006E,
+  0x0004, 0x00AE, 0x0211, 0x0190, 0x004E, 0x8014, 0x006E, 0x8004, 0x004D, 0x0010, 0x006E, 0x006D, 0x004D, 0x004D, 0x004E, 0x004D,
+  0x004D, 0x006D, 0x006D, 0x008E, 0x01B1, 0x01D1, 0x00CE, 0x006D, 0x004D, 0x004D, 0x801B, 0x006D, 0x000D, 0x004D, 0x006E, 0x004D,
+  0x006E, 0x006E, 0x004E, 0x006D, 0x010F, 0x0212, 0x00EF, 0x006D, 0x006E, 0x006E, 0x8008, 0x006D, 0x8008, 0x004D, 0x800A, 0x006E,
+  0x0002, 0x004D, 0x006D, 0x8003, 0x006E, 0x0006, 0x004D, 0x006E, 0x004D, 0x006E, 0x01D1, 0x0150, 0x8025, 0x006E, 0x0006, 0x004E,
+  0x0130, 0x0191, 0x006E, 0x006E, 0x004E, 0x8023, 0x006E, 0x0003, 0x004E, 0x0232, 0x004E, 0x8022, 0x006E, 0x0007, 0x004E, 0x006E,
+  0x004D, 0x004D, 0x004E, 0x010F, 0x01D1, 0x8004, 0x006E, 0x0004, 0x006D, 0x004E, 0x004E, 0x004D, 0x801C, 0x006E, 0x0005, 0x006D,
+  0x006D, 0x00CE, 0x0212, 0x00CE, 0x8004, 0x006E, 0x0004, 0x006D, 0x004D, 0x004D, 0x006D, 0x800B, 0x006E, 0x000E, 0x004E, 0x70F0,
+  0x9932, 0x9931, 0x9931, 0x9911, 0x9931, 0x9911, 0x9931, 0x9931, 0x8110, 0x006E, 0x006E, 0x004D, 0x8004, 0x006D, 0x000D, 0x008E,
+  0x01D1, 0x0190, 0x006D, 0x006D, 0x004E, 0x006E, 0x006E, 0x004D, 0x006D, 0x006E, 0x004D, 0x004D, 0x8006, 0x006D, 0x8004, 0x004D,
+  0x8008, 0x004D, 0x0001, 0x006D, 0x8003, 0x004D, 0x0004, 0x0150, 0x01F1, 0x0150, 0x006D, 0x801F, 0x004D, 0x0003, 0x006D, 0x004D,
+  0x004E, 0x8003, 0x004D, 0x0004, 0x0150, 0x01F1, 0x00AE, 0x006D, 0x8003, 0x004D, 0x8019, 0x006D, 0x0006, 0x004D, 0x006D, 0x006D,
+  0x004D, 0x006D, 0x004D, 0x8003, 0x006D, 0x0005, 0x0170, 0x01B1, 0x006D, 0x006D, 0x004D, 0x8009, 0x006D, 0x8018, 0x006E, 0x0007,
+  0x006D, 0x004E, 0x006E, 0x01D1, 0x010F, 0x006D, 0x006D, 0x8021, 0x006E, 0x0007, 0x004D, 0x006D, 0x006E, 0x004E, 0x0212, 0x004D,
+  0x004D, 0x8022, 0x006E, 0x0001, 0x004D, 0x8003, 0x006D, 0x000A, 0x006E, 0x01F1, 0x008E, 0x006D, 0x006E, 0x004D, 0x004D, 0x006D,
+  0x006D, 0x004E, 0x8009, 0x006E, 0x8013, 0x006D, 0x0009, 0x004D, 0x006D, 0x004D, 0x010F, 0x01F1, 0x006D, 0x006D, 0x004D, 0x006E,
+  0x8003, 0x006D, 0x0001, 0x004D, 0x8008, 0x006D, 0x0005, 0x004E, 0x006D, 0x006D, 0x004D, 0x40CF, 0x8008, 0x9931, 0x000F, 0x70F0,
+  0x004D, 0x006D, 0x004D, 0x004D, 0x006D, 0x006D, 0x004D, 0x004D, 0x006D, 0x0191, 0x01B1, 0x006D, 0x004D, 0x006D, 0x8010, 0x004D,
+};
+
+#endif // HAS_GRAPHICAL_TFT && TFT_IMAGE_RLE
@@ -30,7 +30,12 @@
 #define DEBUG_OUT ENABLED(DEBUG_GRAPHICAL_TFT)
 #include "../../core/debug_out.h"
 
-uint16_t TFT::buffer[];
+#if ENABLED(MEMORY_PROFILES)
+  uint16_t *TFT::buffer;
+  uint16_t TFT::buffer_size;
+#else
+  uint16_t TFT::buffer[];
+#endif
 
 void TFT::init() {
   io.Init();
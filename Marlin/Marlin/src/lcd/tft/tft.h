@@ -78,7 +78,14 @@ class TFT {
   public:
     static TFT_Queue queue;
 
-    static uint16_t buffer[TFT_BUFFER_SIZE];
+    #if ENABLED(MEMORY_PROFILES)
+      static uint16_t *buffer;          // Canvas pixels, in the memory profile's share of the arena
+      static uint16_t buffer_size;      // Pixels in a canvas slice (in each half with TFT_DOUBLE_BUFFER)
+      static void set_buffer(uint16_t * const buf, const uint16_t size) { buffer = buf; buffer_size = size; }
+    #else
+      static uint16_t buffer[TFT_BUFFER_SIZE * TERN(TFT_DOUBLE_BUFFER, 2, 1)];
+      static constexpr uint16_t buffer_size = TFT_BUFFER_SIZE;
+    #endif
 
     static void init();
     static void set_font(const uint8_t *Font) { string.set_font(Font); }
@@ -88,6 +95,9 @@ class TFT {
     static void abort() { io.Abort(); }
     static void write_multiple(uint16_t Data, uint16_t Count) { io.WriteMultiple(Data, Count); }
     static void write_sequence(uint16_t *Data, uint16_t Count) { io.WriteSequence(Data, Count); }
+    #if ENABLED(TFT_DOUBLE_BUFFER)
+      static void write_sequence_async(uint16_t *Data, uint16_t Count) { io.WriteSequenceAsync(Data, Count); }
+    #endif
     static void set_window(uint16_t Xmin, uint16_t Ymin, uint16_t Xmax, uint16_t Ymax) { io.set_window(Xmin, Ymin, Xmax, Ymax); }
 
     static void fill(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint16_t color) { queue.fill(x, y, width, height, color); }
@@ -99,6 +109,12 @@ class TFT {
     static void add_image(int16_t x, int16_t y, MarlinImage image, uint16_t color_main = COLOR_WHITE, uint16_t color_background = COLOR_BACKGROUND, uint16_t color_shadow = COLOR_BLACK) { queue.add_image(x, y, image, color_main,  color_background, color_shadow); }
     static void add_bar(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint16_t color) { queue.add_bar(x, y, width, height, color); }
     static void add_rectangle(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint16_t color) { queue.add_rectangle(x, y, width, height, color); }
+    #if ENABLED(TFT_THUMBNAIL)
+      static void add_thumbnail(int16_t x, int16_t y) { queue.add_thumbnail(x, y); }
+    #endif
+    #if ENABLED(TFT_TOOLPATH_PREVIEW)
+      static void add_toolpath(int16_t x, int16_t y, uint8_t scale, uint16_t color, uint16_t lastColor) { queue.add_toolpath(x, y, scale, color, lastColor); }
+    #endif
     static void draw_edit_screen_buttons();
 };
 
@@ -130,6 +130,16 @@
   #define COLOR_PROGRESS_BG       COLOR_BLACK
 #endif
 
+#ifndef COLOR_TOOLPATH_LAYER
+  #define COLOR_TOOLPATH_LAYER    COLOR_YELLOW
+#endif
+#ifndef COLOR_TOOLPATH_LAST
+  #define COLOR_TOOLPATH_LAST     COLOR_DARKGREY
+#endif
+#ifndef COLOR_TOOLPATH_FRAME
+  #define COLOR_TOOLPATH_FRAME    COLOR_WHITE
+#endif
+
 #ifndef COLOR_STATUS_MESSAGE
   #define COLOR_STATUS_MESSAGE    COLOR_YELLOW
 #endif
@@ -27,17 +27,26 @@
 #include "tft_image.h"
 #include "ui_common.h"
 
+// 16 bit images are stored run-length coded with TFT_IMAGE_RLE
+#if ENABLED(TFT_IMAGE_RLE)
+  #define HIGHCOLOR_IMAGE(N) (void *)N##_rle
+  #define HIGHCOLOR_MODE     HIGHCOLOR_RLE
+#else
+  #define HIGHCOLOR_IMAGE(N) (void *)N
+  #define HIGHCOLOR_MODE     HIGHCOLOR
+#endif
+
 const tImage NoLogo                 = { nullptr, 0, 0, NOCOLORS };
 
 #if ENABLED(SHOW_BOOTSCREEN)
   const tImage MarlinLogo112x38x1   = { (void *)marlin_logo_112x38x1, 112, 38, GREYSCALE1 };
   const tImage MarlinLogo228x255x2  = { (void *)marlin_logo_228x255x2, 228, 255, GREYSCALE2 };
   const tImage MarlinLogo228x255x4  = { (void *)marlin_logo_228x255x4, 228, 255, GREYSCALE4 };
-  const tImage MarlinLogo195x59x16  = { (void *)marlin_logo_195x59x16,  195,  59, HIGHCOLOR };
-  const tImage MarlinLogo320x240x16 = { (void *)marlin_logo_320x240x16, 320, 240, HIGHCOLOR };
-  const tImage MarlinLogo480x320x16 = { (void *)marlin_logo_480x320x16, 480, 320, HIGHCOLOR };
+  const tImage MarlinLogo195x59x16  = { HIGHCOLOR_IMAGE(marlin_logo_195x59x16),  195,  59, HIGHCOLOR_MODE };
+  const tImage MarlinLogo320x240x16 = { HIGHCOLOR_IMAGE(marlin_logo_320x240x16), 320, 240, HIGHCOLOR_MODE };
+  const tImage MarlinLogo480x320x16 = { HIGHCOLOR_IMAGE(marlin_logo_480x320x16), 480, 320, HIGHCOLOR_MODE };
 #endif
-const tImage Background320x30x16    = { (void *)background_320x30x16, 320, 30, HIGHCOLOR };
+const tImage Background320x30x16    = { HIGHCOLOR_IMAGE(background_320x30x16), 320, 30, HIGHCOLOR_MODE };
 
 const tImage HotEnd_64x64x4         = { (void *)hotend_64x64x4, 64, 64, GREYSCALE4 };
 const tImage Bed_64x64x4            = { (void *)bed_64x64x4, 64, 64, GREYSCALE4 };
@@ -32,6 +32,12 @@ extern const uint16_t marlin_logo_195x59x16[];
 extern const uint16_t marlin_logo_320x240x16[];
 extern const uint16_t marlin_logo_480x320x16[];
 extern const uint16_t background_320x30x16[];
+#if ENABLED(TFT_IMAGE_RLE)
+  extern const uint16_t marlin_logo_195x59x16_rle[];
+  extern const uint16_t marlin_logo_320x240x16_rle[];
+  extern const uint16_t marlin_logo_480x320x16_rle[];
+  extern const uint16_t background_320x30x16_rle[];
+#endif
 
 extern const uint8_t hotend_64x64x4[];
 extern const uint8_t bed_64x64x4[], bed_heated_64x64x4[];
@@ -109,7 +115,8 @@ enum colorMode_t : uint8_t {
   GREYSCALE1 = 0x01,  // 1 bit per pixel
   GREYSCALE2,         // 2 bits per pixel
   GREYSCALE4,         // 4 bits per pixel
-  HIGHCOLOR           // 16 bits per pixel
+  HIGHCOLOR,          // 16 bits per pixel
+  HIGHCOLOR_RLE       // 16 bits per pixel, run-length coded rows (rle16-tft-image.py)
 };
 
 typedef colorMode_t ColorMode;
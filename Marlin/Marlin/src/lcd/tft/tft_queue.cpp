@@ -28,14 +28,37 @@
 #include "tft.h"
 #include "tft_image.h"
 
-uint8_t TFT_Queue::queue[];
+#if ENABLED(TFT_UI_PROFILER)
+  #include "ui_profiler.h"
+#endif
+
+#if ENABLED(TRACE_EVENTS)
+  #include "../../feature/trace_events.h"
+#endif
+
+#if ENABLED(FF_RUSSIAN_FIX)
+  #include "../fontutils.h"
+#endif
+
+__ccmram uint8_t TFT_Queue::queue[];
 uint8_t *TFT_Queue::end_of_queue = queue;
 uint8_t *TFT_Queue::current_task = nullptr;
 uint8_t *TFT_Queue::last_task = nullptr;
 uint8_t *TFT_Queue::last_parameter = nullptr;
 
+#if ENABLED(TFT_DOUBLE_BUFFER)
+  bool TFT_Queue::slice_ready; // = false
+#endif
+
+#if ENABLED(TFT_SKIP_UNCHANGED)
+  TFT_Queue::drawnArea_t TFT_Queue::drawn[TFT_SKIP_UNCHANGED_AREAS];
+  uint8_t TFT_Queue::next_drawn; // = 0
+  uint32_t TFT_Queue::sketch_hash;
+#endif
+
 void TFT_Queue::reset() {
   tft.abort();
+  TERN_(TFT_DOUBLE_BUFFER, slice_ready = false);
 
   end_of_queue = queue;
   current_task = nullptr;
@@ -45,10 +68,13 @@ void TFT_Queue::reset() {
 
 void TFT_Queue::async() {
   if (!current_task) return;
+  TERN_(TRACE_EVENTS, TRACE_SCOPE(TRACE_TFT_ASYNC));
   queueTask_t *task = (queueTask_t *)current_task;
 
   // Check IO busy status
-  if (tft.is_busy()) return;
+  #if DISABLED(TFT_DOUBLE_BUFFER)
+    if (tft.is_busy()) return;
+  #endif
 
   if (task->state == TASK_STATE_COMPLETED) {
     task = (queueTask_t *)task->nextTask;
@@ -57,6 +83,11 @@ void TFT_Queue::async() {
 
   finish_sketch();
 
+  #if ENABLED(TFT_DOUBLE_BUFFER)
+    // A canvas renders its next slice while the bus is busy. Anything else waits.
+    if (task->type != TASK_CANVAS && tft.is_busy()) return;
+  #endif
+
   switch (task->type) {
     case TASK_END_OF_QUEUE: reset();      break;
     case TASK_FILL:         fill(task);   break;
@@ -69,6 +100,16 @@ void TFT_Queue::finish_sketch() {
   queueTask_t *task = (queueTask_t *)last_task;
 
   if (task->state == TASK_STATE_SKETCH) {
+    #if ENABLED(TFT_SKIP_UNCHANGED)
+      // Drop a canvas identical to the one already on screen
+      if (sketch_unchanged((parametersCanvas_t *)(last_task + sizeof(queueTask_t)))) {
+        end_of_queue = last_task;
+        *end_of_queue = TASK_END_OF_QUEUE;
+        if (current_task == last_task) current_task = nullptr;
+        last_task = nullptr;
+        return;
+      }
+    #endif
     *end_of_queue = TASK_END_OF_QUEUE;
     task->nextTask = end_of_queue;
     task->state = TASK_STATE_READY;
@@ -96,7 +137,9 @@ void TFT_Queue::fill(queueTask_t *task) {
     task->state = TASK_STATE_COMPLETED;
   }
 
+  TERN_(TFT_UI_PROFILER, const uint32_t dma_start = get_cycle_count());
   tft.write_multiple(task_parameters->color, count);
+  TERN_(TFT_UI_PROFILER, ui_profiler.add(UI_PHASE_DMA, get_cycle_count() - dma_start));
 }
 
 void TFT_Queue::canvas(queueTask_t *task) {
@@ -109,6 +152,13 @@ void TFT_Queue::canvas(queueTask_t *task) {
     task->state = TASK_STATE_IN_PROGRESS;
     Canvas.New(task_parameters->x, task_parameters->y, task_parameters->width, task_parameters->height);
   }
+
+  #if ENABLED(TFT_DOUBLE_BUFFER)
+    if (!slice_ready) {
+  #endif
+
+  TERN_(TFT_UI_PROFILER, const uint32_t render_start = get_cycle_count());
+
   Canvas.Continue();
 
   for (i = 0; i < task_parameters->count; i++) {
@@ -135,15 +185,38 @@ void TFT_Queue::canvas(queueTask_t *task) {
       case CANVAS_ADD_RECTANGLE:
         Canvas.AddRectangle(((parametersCanvasRectangle_t *)item)->x, ((parametersCanvasRectangle_t *)item)->y, ((parametersCanvasRectangle_t *)item)->width, ((parametersCanvasRectangle_t *)item)->height, ((parametersCanvasRectangle_t *)item)->color);
         break;
+      #if ENABLED(TFT_THUMBNAIL)
+        case CANVAS_ADD_THUMBNAIL:
+          Canvas.AddThumbnail(((parametersCanvasThumbnail_t *)item)->x, ((parametersCanvasThumbnail_t *)item)->y);
+          break;
+      #endif
+      #if ENABLED(TFT_TOOLPATH_PREVIEW)
+        case CANVAS_ADD_TOOLPATH:
+          Canvas.AddToolpath(((parametersCanvasToolpath_t *)item)->x, ((parametersCanvasToolpath_t *)item)->y, ((parametersCanvasToolpath_t *)item)->scale, ((parametersCanvasToolpath_t *)item)->color, ((parametersCanvasToolpath_t *)item)->lastColor);
+          break;
+      #endif
     }
     item = ((parametersCanvasBackground_t *)item)->nextParameter;
   }
 
+  TERN_(TFT_UI_PROFILER, ui_profiler.add(UI_PHASE_RENDER, get_cycle_count() - render_start));
+
+  #if ENABLED(TFT_DOUBLE_BUFFER)
+      slice_ready = true;
+    }
+    // Send the slice once the previous one is out
+    if (tft.is_busy()) return;
+    slice_ready = false;
+  #endif
+
+  TERN_(TFT_UI_PROFILER, const uint32_t dma_start = get_cycle_count());
   if (Canvas.ToScreen()) task->state = TASK_STATE_COMPLETED;
+  TERN_(TFT_UI_PROFILER, ui_profiler.add(UI_PHASE_DMA, get_cycle_count() - dma_start));
 }
 
 void TFT_Queue::fill(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint16_t color) {
   finish_sketch();
+  TERN_(TFT_SKIP_UNCHANGED, forget_area(x, y, width, height));
 
   queueTask_t *task = (queueTask_t *)end_of_queue;
   last_task = (uint8_t *)task;
@@ -189,6 +262,8 @@ void TFT_Queue::canvas(uint16_t x, uint16_t y, uint16_t width, uint16_t height)
   task_parameters->height = height;
   task_parameters->count = 0;
 
+  TERN_(TFT_SKIP_UNCHANGED, sketch_hash = 2166136261UL);
+
   if (!current_task) current_task = (uint8_t *)task;
 }
 
@@ -204,6 +279,7 @@ void TFT_Queue::set_background(uint16_t color) {
   end_of_queue += sizeof(parametersCanvasBackground_t);
   task_parameters->count++;
   parameters->nextParameter = end_of_queue;
+  TERN_(TFT_SKIP_UNCHANGED, hash_parameter((uint8_t *)parameters));
 }
 
 #define QUEUE_SAFETY_FREE_SPACE 100
@@ -223,6 +299,12 @@ void TFT_Queue::add_text(uint16_t x, uint16_t y, uint16_t color, const uint8_t *
 
   const uint8_t *pointer = string;
 
+  #if ENABLED(FF_RUSSIAN_FIX)
+    // A UTF-8 string (x | 0x8000) is decoded here, once, instead of by each canvas slice
+    const bool is_utf8 = x & 0x8000;
+    x &= ~0x8000;
+  #endif
+
   parameters->type = CANVAS_ADD_TEXT;
   parameters->x = x;
   parameters->y = y;
@@ -233,11 +315,26 @@ void TFT_Queue::add_text(uint16_t x, uint16_t y, uint16_t color, const uint8_t *
   end_of_queue += sizeof(parametersCanvasText_t);
 
   /* TODO: Deal with maxWidth */
-  while ((*(end_of_queue++) = *pointer++) != 0x00);
+  uint8_t * const text = end_of_queue;
+  #if ENABLED(FF_RUSSIAN_FIX)
+    if (is_utf8) {
+      while (*pointer) {
+        lchar_t wchar;
+        pointer = get_utf8_value_cb(pointer, read_byte_ram, wchar);
+        const uint8_t ch = uint8_t(wchar);
+        if (!ch) break;
+        *end_of_queue++ = ch;
+      }
+      *end_of_queue++ = 0x00;
+    }
+    else
+  #endif
+      while ((*(end_of_queue++) = *pointer++) != 0x00);
 
   parameters->nextParameter = end_of_queue;
-  parameters->stringLength = pointer - string;
+  parameters->stringLength = end_of_queue - text;
   task_parameters->count++;
+  TERN_(TFT_SKIP_UNCHANGED, hash_parameter((uint8_t *)parameters));
 }
 
 void TFT_Queue::add_image(int16_t x, int16_t y, MarlinImage image, uint16_t *colors) {
@@ -257,7 +354,10 @@ void TFT_Queue::add_image(int16_t x, int16_t y, MarlinImage image, uint16_t *col
 
   colorMode_t color_mode = Images[image].colorMode;
 
-  if (color_mode == HIGHCOLOR) return;
+  if (color_mode == HIGHCOLOR || TERN0(TFT_IMAGE_RLE, color_mode == HIGHCOLOR_RLE)) {
+    TERN_(TFT_SKIP_UNCHANGED, hash_parameter((uint8_t *)parameters));
+    return;
+  }
 
   uint16_t *color = (uint16_t *)end_of_queue;
   uint8_t color_count = 0;
@@ -277,6 +377,7 @@ void TFT_Queue::add_image(int16_t x, int16_t y, MarlinImage image, uint16_t *col
 
   end_of_queue = (uint8_t *)color;
   parameters->nextParameter = end_of_queue;
+  TERN_(TFT_SKIP_UNCHANGED, hash_parameter((uint8_t *)parameters));
 }
 
 uint16_t gradient(uint16_t colorA, uint16_t colorB, uint16_t factor) {
@@ -331,6 +432,7 @@ void TFT_Queue::add_bar(uint16_t x, uint16_t y, uint16_t width, uint16_t height,
   end_of_queue += sizeof(parametersCanvasBar_t);
   task_parameters->count++;
   parameters->nextParameter = end_of_queue;
+  TERN_(TFT_SKIP_UNCHANGED, hash_parameter((uint8_t *)parameters));
 }
 
 void TFT_Queue::add_rectangle(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint16_t color) {
@@ -349,6 +451,99 @@ void TFT_Queue::add_rectangle(uint16_t x, uint16_t y, uint16_t width, uint16_t h
   end_of_queue += sizeof(parametersCanvasRectangle_t);
   task_parameters->count++;
   parameters->nextParameter = end_of_queue;
+  TERN_(TFT_SKIP_UNCHANGED, hash_parameter((uint8_t *)parameters));
 }
 
+#if ENABLED(TFT_THUMBNAIL)
+
+  void TFT_Queue::add_thumbnail(int16_t x, int16_t y) {
+    handle_queue_overflow(sizeof(parametersCanvasThumbnail_t));
+    parametersCanvas_t *task_parameters = (parametersCanvas_t *)(((uint8_t *)last_task) + sizeof(queueTask_t));
+    parametersCanvasThumbnail_t *parameters = (parametersCanvasThumbnail_t *)end_of_queue;
+    last_parameter = end_of_queue;
+
+    parameters->type = CANVAS_ADD_THUMBNAIL;
+    parameters->x = x;
+    parameters->y = y;
+
+    end_of_queue += sizeof(parametersCanvasThumbnail_t);
+    task_parameters->count++;
+    parameters->nextParameter = end_of_queue;
+    TERN_(TFT_SKIP_UNCHANGED, hash_parameter((uint8_t *)parameters));
+  }
+
+#endif
+
+#if ENABLED(TFT_TOOLPATH_PREVIEW)
+
+  void TFT_Queue::add_toolpath(int16_t x, int16_t y, uint8_t scale, uint16_t color, uint16_t lastColor) {
+    handle_queue_overflow(sizeof(parametersCanvasToolpath_t));
+    parametersCanvas_t *task_parameters = (parametersCanvas_t *)(((uint8_t *)last_task) + sizeof(queueTask_t));
+    parametersCanvasToolpath_t *parameters = (parametersCanvasToolpath_t *)end_of_queue;
+    last_parameter = end_of_queue;
+
+    parameters->type = CANVAS_ADD_TOOLPATH;
+    parameters->x = x;
+    parameters->y = y;
+    parameters->scale = scale;
+    parameters->color = ENDIAN_COLOR(color);
+    parameters->lastColor = ENDIAN_COLOR(lastColor);
+
+    end_of_queue += sizeof(parametersCanvasToolpath_t);
+    task_parameters->count++;
+    parameters->nextParameter = end_of_queue;
+    TERN_(TFT_SKIP_UNCHANGED, hash_parameter((uint8_t *)parameters));
+  }
+
+#endif
+
+#if ENABLED(TFT_SKIP_UNCHANGED)
+
+  // Add a canvas parameter to the FNV-1a hash of the sketch, skipping the queue pointer
+  void TFT_Queue::hash_parameter(const uint8_t *parameter) {
+    auto mix = [](const uint8_t b) { sketch_hash = (sketch_hash ^ b) * 16777619UL; };
+    mix(*parameter);
+    for (const uint8_t *b = parameter + 1 + sizeof(uint8_t *); b < end_of_queue; b++) mix(*b);
+  }
+
+  /**
+   * Check the finished sketch against the last canvas drawn in the same
+   * area, and remember it. Other areas it overlaps are forgotten, since
+   * it will be drawn over them.
+   */
+  bool TFT_Queue::sketch_unchanged(const parametersCanvas_t *canvas) {
+    drawnArea_t *area = nullptr;
+    LOOP_L_N(i, TFT_SKIP_UNCHANGED_AREAS) {
+      drawnArea_t &a = drawn[i];
+      if (a.width && a.x == canvas->x && a.y == canvas->y && a.width == canvas->width && a.height == canvas->height) {
+        if (a.hash == sketch_hash) return true;
+        area = &a;
+        break;
+      }
+    }
+
+    forget_area(canvas->x, canvas->y, canvas->width, canvas->height, area);
+
+    if (!area) {
+      LOOP_L_N(i, TFT_SKIP_UNCHANGED_AREAS) if (!drawn[i].width) { area = &drawn[i]; break; }
+      if (!area) {
+        area = &drawn[next_drawn];
+        next_drawn = (next_drawn + 1) % (TFT_SKIP_UNCHANGED_AREAS);
+      }
+    }
+
+    *area = { canvas->x, canvas->y, canvas->width, canvas->height, sketch_hash };
+    return false;
+  }
+
+  // Forget the areas overlapping a new drawing
+  void TFT_Queue::forget_area(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const drawnArea_t *keep/*=nullptr*/) {
+    LOOP_L_N(i, TFT_SKIP_UNCHANGED_AREAS) {
+      drawnArea_t &a = drawn[i];
+      if (&a != keep && a.x < x + width && x < a.x + a.width && a.y < y + height && y < a.y + a.height) a.width = 0;
+    }
+  }
+
+#endif // TFT_SKIP_UNCHANGED
+
 #endif // HAS_GRAPHICAL_TFT
@@ -48,6 +48,8 @@ enum CanvasSubtype : uint8_t {
   CANVAS_ADD_IMAGE,
   CANVAS_ADD_BAR,
   CANVAS_ADD_RECTANGLE,
+  CANVAS_ADD_THUMBNAIL,
+  CANVAS_ADD_TOOLPATH,
 };
 
 typedef struct __attribute__((__packed__)) {
@@ -118,6 +120,23 @@ typedef struct __attribute__((__packed__)) {
   uint16_t color;
 } parametersCanvasRectangle_t;
 
+typedef struct __attribute__((__packed__)) {
+  CanvasSubtype type;
+  uint8_t *nextParameter;
+  int16_t x;
+  int16_t y;
+} parametersCanvasThumbnail_t;
+
+typedef struct __attribute__((__packed__)) {
+  CanvasSubtype type;
+  uint8_t *nextParameter;
+  int16_t x;
+  int16_t y;
+  uint8_t scale;
+  uint16_t color;
+  uint16_t lastColor;
+} parametersCanvasToolpath_t;
+
 class TFT_Queue {
   private:
     static uint8_t queue[TFT_QUEUE_SIZE];
@@ -131,10 +150,26 @@ class TFT_Queue {
     static void canvas(queueTask_t *task);
     static void handle_queue_overflow(uint16_t sizeNeeded);
 
+    #if ENABLED(TFT_DOUBLE_BUFFER)
+      static bool slice_ready;    // The next canvas slice is rendered, waiting for the bus
+    #endif
+
+    #if ENABLED(TFT_SKIP_UNCHANGED)
+      // Screen areas last drawn by a canvas, with a hash of what was drawn
+      typedef struct { uint16_t x, y, width, height; uint32_t hash; } drawnArea_t;
+      static drawnArea_t drawn[TFT_SKIP_UNCHANGED_AREAS];
+      static uint8_t next_drawn;
+      static uint32_t sketch_hash;
+      static void hash_parameter(const uint8_t *parameter);
+      static bool sketch_unchanged(const parametersCanvas_t *canvas);
+      static void forget_area(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const drawnArea_t *keep=nullptr);
+    #endif
+
   public:
     static void reset();
     static void async();
     static void sync() { while (current_task != nullptr) async(); }
+    static bool busy() { return current_task != nullptr; }
 
     static void fill(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint16_t color);
     static void canvas(uint16_t x, uint16_t y, uint16_t width, uint16_t height);
@@ -148,5 +183,11 @@ class TFT_Queue {
     static void add_image(int16_t x, int16_t y, MarlinImage image, uint16_t color_main, uint16_t color_background, uint16_t color_shadow);
 
     static void add_bar(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint16_t color);
+    #if ENABLED(TFT_THUMBNAIL)
+      static void add_thumbnail(int16_t x, int16_t y);
+    #endif
+    #if ENABLED(TFT_TOOLPATH_PREVIEW)
+      static void add_toolpath(int16_t x, int16_t y, uint8_t scale, uint16_t color, uint16_t lastColor);
+    #endif
     static void add_rectangle(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint16_t color);
 };
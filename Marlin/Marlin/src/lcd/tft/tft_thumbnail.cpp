@@ -0,0 +1,168 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if HAS_GRAPHICAL_TFT && ENABLED(TFT_THUMBNAIL)
+
+#include "tft_thumbnail.h"
+#include "tft.h"
+#include "../../sd/cardreader.h"
+
+uint8_t TFT_Thumbnail::block[512];
+uint16_t TFT_Thumbnail::block_len, TFT_Thumbnail::block_pos;
+uint32_t TFT_Thumbnail::file_pos, TFT_Thumbnail::chars_left;
+bool TFT_Thumbnail::skip_line;
+uint16_t TFT_Thumbnail::bits;
+uint8_t TFT_Thumbnail::bit_count;
+TFT_Thumbnail::rgba_t TFT_Thumbnail::index[64], TFT_Thumbnail::px;
+uint8_t TFT_Thumbnail::run;
+uint16_t TFT_Thumbnail::row;
+bool TFT_Thumbnail::failed;
+uint16_t TFT_Thumbnail::width, TFT_Thumbnail::height;
+
+// The next base64 value, -1 at the end of the text
+int8_t TFT_Thumbnail::next_sextet() {
+  while (chars_left) {
+    if (block_pos >= block_len) {
+      // Read up to a block boundary, so the following reads are whole aligned blocks
+      const int16_t n = card.job_read(file_pos, block, sizeof(block) - (file_pos & (sizeof(block) - 1)));
+      if (n <= 0) break;
+      file_pos += n;
+      block_len = n;
+      block_pos = 0;
+    }
+    const char c = block[block_pos++];
+    if (skip_line) { skip_line = (c != '\n'); continue; }
+    int8_t v;
+    if (WITHIN(c, 'A', 'Z'))      v = c - 'A';
+    else if (WITHIN(c, 'a', 'z')) v = c - 'a' + 26;
+    else if (WITHIN(c, '0', '9')) v = c - '0' + 52;
+    else if (c == '+')            v = 62;
+    else if (c == '/')            v = 63;
+    else if (c == '=')            break;
+    else continue;                // "; " at the start of each line, line ends
+    chars_left--;
+    return v;
+  }
+  chars_left = 0;
+  return -1;
+}
+
+// The next decoded byte, -1 at the end of the text
+int16_t TFT_Thumbnail::next_byte() {
+  while (bit_count < 8) {
+    const int8_t v = next_sextet();
+    if (v < 0) return -1;
+    bits = (bits << 6) | v;
+    bit_count += 6;
+  }
+  bit_count -= 8;
+  return (bits >> bit_count) & 0xFF;
+}
+
+// Decode the next pixel into px
+void TFT_Thumbnail::next_pixel() {
+  if (run) { run--; return; }
+
+  const int16_t b1 = next_byte();
+  if (b1 < 0) { failed = true; return; }
+
+  if (b1 == 0xFE || b1 == 0xFF) {             // QOI_OP_RGB, QOI_OP_RGBA
+    int16_t c[4] = { px.r, px.g, px.b, px.a };
+    LOOP_L_N(i, b1 == 0xFF ? 4 : 3) if ((c[i] = next_byte()) < 0) { failed = true; return; }
+    px = { uint8_t(c[0]), uint8_t(c[1]), uint8_t(c[2]), uint8_t(c[3]) };
+  }
+  else switch (b1 & 0xC0) {
+    case 0x00: px = index[b1]; break;         // QOI_OP_INDEX
+    case 0x40:                                // QOI_OP_DIFF
+      px.r += ((b1 >> 4) & 0x03) - 2;
+      px.g += ((b1 >> 2) & 0x03) - 2;
+      px.b += (b1 & 0x03) - 2;
+      break;
+    case 0x80: {                              // QOI_OP_LUMA
+      const int16_t b2 = next_byte();
+      if (b2 < 0) { failed = true; return; }
+      const int8_t vg = (b1 & 0x3F) - 32;
+      px.r += vg - 8 + ((b2 >> 4) & 0x0F);
+      px.g += vg;
+      px.b += vg - 8 + (b2 & 0x0F);
+    } break;
+    case 0xC0: run = b1 & 0x3F; break;        // QOI_OP_RUN
+  }
+  index[(px.r * 3 + px.g * 5 + px.b * 7 + px.a * 11) & 0x3F] = px;
+}
+
+// Go to the start of the thumbnail and read the QOI header
+bool TFT_Thumbnail::begin() {
+  file_pos = card.job_info.thumbnail;
+  chars_left = card.job_info.thumbnail_size ? card.job_info.thumbnail_size : UINT32_MAX;
+  block_len = block_pos = 0;
+  skip_line = true;
+  bits = bit_count = 0;
+  ZERO(index);
+  px = { 0, 0, 0, 255 };
+  run = 0;
+  row = 0;
+  failed = false;
+
+  uint8_t header[14];                         // "qoif", width, height, channels, colorspace
+  for (uint8_t &b : header) {
+    const int16_t v = next_byte();
+    if (v < 0) return false;
+    b = v;
+  }
+  if (strncmp((char *)header, "qoif", 4)) return false;
+  const uint32_t w = uint32_t(header[4]) << 24 | uint32_t(header[5]) << 16 | header[6] << 8 | header[7],
+                 h = uint32_t(header[8]) << 24 | uint32_t(header[9]) << 16 | header[10] << 8 | header[11];
+  if (!w || !h || w > 0xFFFF || h > 0xFFFF) return false;
+  width = w;
+  height = h;
+  return true;
+}
+
+// Get the size of the print file's QOI thumbnail. False if there isn't one.
+bool TFT_Thumbnail::load() {
+  width = height = 0;
+  return card.isFileOpen() && card.job_info.thumbnail && card.job_info.thumbnail_qoi && begin();
+}
+
+// Decode rows up to row r, so decode_row gets row r next
+bool TFT_Thumbnail::seek(const uint16_t r) {
+  if (r >= height) return false;
+  if (r < row && !begin()) failed = true;
+  while (!failed && row < r) decode_row(nullptr, 0, 0);
+  return !failed;
+}
+
+// Decode the next row into a canvas line at x, skipping transparent pixels
+void TFT_Thumbnail::decode_row(uint16_t *line, const int16_t x, const uint16_t line_width) {
+  for (uint16_t i = 0; i < width && !failed; i++) {
+    next_pixel();
+    const int16_t col = x + i;
+    if (line && px.a >= 0x80 && col >= 0 && col < line_width)
+      line[col] = ENDIAN_COLOR(RGB(px.r, px.g, px.b));
+  }
+  row++;
+}
+
+#endif // HAS_GRAPHICAL_TFT && TFT_THUMBNAIL
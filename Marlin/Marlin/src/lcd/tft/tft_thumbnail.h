@@ -0,0 +1,64 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+#include "../../inc/MarlinConfig.h"
+
+/**
+ * Streaming decoder for the QOI thumbnail of the print file
+ *
+ * The base64 comment lines are read from the print file one SD block at a
+ * time and each row of pixels is decoded when a canvas slice needs it, so
+ * the whole image is never held in RAM. Rows must be requested in order.
+ * An earlier row restarts the decoder from the start of the thumbnail.
+ */
+
+class TFT_Thumbnail {
+  private:
+    typedef struct { uint8_t r, g, b, a; } rgba_t;
+
+    static uint8_t block[512];          // Base64 text from the print file
+    static uint16_t block_len, block_pos;
+    static uint32_t file_pos,           // File offset of the next read
+                    chars_left;         // Base64 characters still to read
+    static bool skip_line;              // Still on the "; thumbnail_QOI begin" line
+    static uint16_t bits;               // Base64 bits not yet returned as bytes
+    static uint8_t bit_count;
+
+    static rgba_t index[64], px;        // QOI state
+    static uint8_t run;
+
+    static uint16_t row;                // The next row to decode
+    static bool failed;
+
+    static int8_t next_sextet();
+    static int16_t next_byte();
+    static void next_pixel();
+    static bool begin();
+
+  public:
+    static uint16_t width, height;      // Zero if the print file has no usable thumbnail
+
+    static bool load();
+    static bool seek(const uint16_t r);
+    static void decode_row(uint16_t *line, const int16_t x, const uint16_t line_width);
+};
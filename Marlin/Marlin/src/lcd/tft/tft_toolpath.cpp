@@ -0,0 +1,78 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if HAS_GRAPHICAL_TFT && ENABLED(TFT_TOOLPATH_PREVIEW)
+
+#include "tft_toolpath.h"
+
+TFT_Toolpath toolpath;
+
+uint8_t TFT_Toolpath::map[2][TFT_TOOLPATH_CELLS][TOOLPATH_ROW_BYTES];
+uint8_t TFT_Toolpath::layer; // = 0
+float TFT_Toolpath::layer_z;
+uint16_t TFT_Toolpath::changes;
+
+void TFT_Toolpath::reset() {
+  ZERO(map);
+  layer_z = 0;
+  changes++;
+}
+
+// The map cell for a bed position, false if it's off the bed
+bool TFT_Toolpath::cell(const float pos, const float min_pos, const float max_pos, int16_t &c) {
+  if (!WITHIN(pos, min_pos, max_pos)) return false;
+  c = _MIN(int16_t((pos - min_pos) * (TFT_TOOLPATH_CELLS) / (max_pos - min_pos)), TFT_TOOLPATH_CELLS - 1);
+  return true;
+}
+
+void TFT_Toolpath::add(const xyze_pos_t &from, const xyze_pos_t &to) {
+  if (to.e <= from.e) return;             // Travel and retracts aren't drawn
+
+  if (to.z != layer_z) {
+    // Extruding at a new height starts a layer. The last one is kept to show under it.
+    layer ^= 1;
+    ZERO(map[layer]);
+    layer_z = to.z;
+  }
+
+  int16_t x0, y0, x1, y1;
+  if (!cell(from.x, X_MIN_POS, X_MAX_POS, x0) || !cell(from.y, Y_MIN_POS, Y_MAX_POS, y0)
+    || !cell(to.x, X_MIN_POS, X_MAX_POS, x1) || !cell(to.y, Y_MIN_POS, Y_MAX_POS, y1)
+  ) return;
+
+  // Integer Bresenham, stepping the major axis and accumulating the minor error
+  const int16_t dx = ABS(x1 - x0), dy = -ABS(y1 - y0),
+                sx = x0 < x1 ? 1 : -1, sy = y0 < y1 ? 1 : -1;
+  int16_t err = dx + dy;
+  for (;;) {
+    plot(x0, y0);
+    if (x0 == x1 && y0 == y1) break;
+    const int16_t e2 = err * 2;
+    if (e2 >= dy) { err += dy; x0 += sx; }
+    if (e2 <= dx) { err += dx; y0 += sy; }
+  }
+  changes++;
+}
+
+#endif // HAS_GRAPHICAL_TFT && TFT_TOOLPATH_PREVIEW
@@ -0,0 +1,58 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+#include "../../inc/MarlinConfig.h"
+
+/**
+ * Layer preview of the moves parsed from the print
+ *
+ * Each extruding G0/G1 move is drawn with Bresenham into a 1-bit map of the
+ * bed as it is parsed, ahead of the planner. Two maps are kept: the layer
+ * being parsed and the one before it. A move at a new Z swaps them, so RAM
+ * stays at two small bitmaps whatever the size of the print.
+ */
+
+#define TOOLPATH_ROW_BYTES (TFT_TOOLPATH_CELLS / 8)
+
+class TFT_Toolpath {
+  private:
+    static uint8_t map[2][TFT_TOOLPATH_CELLS][TOOLPATH_ROW_BYTES];
+    static uint8_t layer;               // The map being drawn into
+    static float layer_z;
+
+    static bool cell(const float pos, const float min_pos, const float max_pos, int16_t &c);
+    static void plot(const int16_t x, const int16_t y) { map[layer][y][x >> 3] |= 0x80 >> (x & 7); }
+
+  public:
+    static uint16_t changes;            // Bumped whenever the maps change
+
+    static void reset();
+    static void add(const xyze_pos_t &from, const xyze_pos_t &to);
+
+    // Bit x of row y for the current (0) or the previous (1) layer, row 0 at Y max
+    static bool get(const uint8_t which, const uint16_t x, const uint16_t y) {
+      return map[layer ^ which][TFT_TOOLPATH_CELLS - 1 - y][x >> 3] & (0x80 >> (x & 7));
+    }
+};
+
+extern TFT_Toolpath toolpath;
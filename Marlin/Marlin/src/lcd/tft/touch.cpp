@@ -38,6 +38,10 @@
 
 #include "tft.h"
 
+#if ENABLED(INPUT_REPLAY)
+  #include "../../feature/input_replay.h"
+#endif
+
 bool Touch::enabled = true;
 int16_t Touch::x, Touch::y;
 touch_control_t Touch::controls[];
@@ -275,6 +279,7 @@ bool Touch::get_point(int16_t *x, int16_t *y) {
   #elif ENABLED(TFT_TOUCH_DEVICE_GT911)
     bool is_touched = (TOUCH_ORIENTATION == TOUCH_PORTRAIT ? io.getPoint(y, x) : io.getPoint(x, y));
   #endif
+  TERN_(INPUT_REPLAY, is_touched = input_replay.touch(is_touched, x, y)); // Record the point, or play it back
   #if HAS_TOUCH_SLEEP
     if (is_touched)
       wakeUp();
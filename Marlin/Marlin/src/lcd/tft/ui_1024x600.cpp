@@ -57,7 +57,12 @@ void MarlinUI::tft_idle() {
   #endif
 
   tft.queue.async();
-  TERN_(TOUCH_SCREEN, touch.idle());
+
+  #if ENABLED(TOUCH_SCREEN)
+    TERN_(TFT_UI_PROFILER, const uint32_t touch_start = get_cycle_count());
+    touch.idle();
+    TERN_(TFT_UI_PROFILER, ui_profiler.add(UI_PHASE_TOUCH, get_cycle_count() - touch_start));
+  #endif
 }
 
 #if ENABLED(SHOW_BOOTSCREEN)
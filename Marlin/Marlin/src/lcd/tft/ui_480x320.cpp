@@ -36,6 +36,14 @@
 #include "../../module/planner.h"
 #include "../../module/motion.h"
 
+#if ENABLED(TFT_THUMBNAIL)
+  #include "tft_thumbnail.h"
+#endif
+
+#if ENABLED(TFT_TOOLPATH_PREVIEW)
+  #include "tft_toolpath.h"
+#endif
+
 #if DISABLED(LCD_PROGRESS_BAR) && BOTH(FILAMENT_LCD_DISPLAY, SDSUPPORT)
   #include "../../feature/filwidth.h"
   #include "../../gcode/parser.h"
@@ -57,7 +65,12 @@ void MarlinUI::tft_idle() {
   #endif
 
   tft.queue.async();
-  TERN_(TOUCH_SCREEN, touch.idle());
+
+  #if ENABLED(TOUCH_SCREEN)
+    TERN_(TFT_UI_PROFILER, const uint32_t touch_start = get_cycle_count());
+    touch.idle();
+    TERN_(TFT_UI_PROFILER, ui_profiler.add(UI_PHASE_TOUCH, get_cycle_count() - touch_start));
+  #endif
 }
 
 #if ENABLED(SHOW_BOOTSCREEN)
@@ -332,6 +345,10 @@ void MarlinUI::draw_status_screen() {
   tft.set_background(COLOR_BACKGROUND);
   tft_string.set(buffer);
   tft.add_text(tft_string.center(128), 0, COLOR_PRINT_TIME, tft_string);
+  #if ENABLED(TFT_THUMBNAIL)
+    if (card.isFileOpen() && card.job_info.thumbnail_qoi)
+      touch.add_control(MENU_SCREEN, (TFT_WIDTH - 128) / 2, y, 128, 29, (intptr_t)thumbnail_screen);
+  #endif
 
   y += TERN(HAS_UI_480x272, 28, 36);
   // progress bar
@@ -341,6 +358,9 @@ void MarlinUI::draw_status_screen() {
   tft.add_rectangle(0, 0, TFT_WIDTH - 8, 9, COLOR_PROGRESS_FRAME);
   if (progress)
     tft.add_bar(1, 1, ((TFT_WIDTH - 10) * progress) / 100, 7, COLOR_PROGRESS_BAR);
+  #if ENABLED(TFT_TOOLPATH_PREVIEW)
+    if (printingIsActive()) touch.add_control(MENU_SCREEN, 4, y - 8, TFT_WIDTH - 8, 25, (intptr_t)toolpath_screen);
+  #endif
 
   y += 20;
   // status message
@@ -919,4 +939,58 @@ void MarlinUI::move_axis_screen() {
   TERN_(HAS_TFT_XPT2046, add_control(TFT_WIDTH - X_MARGIN - BTN_WIDTH, y, BACK, imgBack));
 }
 
+#if ENABLED(TFT_THUMBNAIL)
+
+  // The QOI thumbnail of the print file, clipped to the screen above the Back button
+  void MarlinUI::thumbnail_screen() {
+    if (use_click()) return goto_previous_screen_no_defer();
+    defer_status_screen();
+    clear_lcd();
+    touch.clear();
+
+    if (TFT_Thumbnail::load()) {
+      const uint16_t w = _MIN(TFT_Thumbnail::width, TFT_WIDTH), h = _MIN(TFT_Thumbnail::height, TFT_HEIGHT - 40);
+      tft.canvas((TFT_WIDTH - w) / 2, (TFT_HEIGHT - 40 - h) / 2, w, h);
+      tft.set_background(COLOR_BACKGROUND);
+      tft.add_thumbnail(0, 0);
+    }
+
+    add_control(224, TFT_HEIGHT - 34, BACK, imgBack);
+  }
+
+#endif
+
+#if ENABLED(TFT_TOOLPATH_PREVIEW)
+
+  // The parsed layer over the one before it. Paced like the status screen and
+  // only queued again when a move has been drawn into the map.
+  void MarlinUI::toolpath_screen() {
+    constexpr uint8_t scale = _MAX(1, _MIN(TFT_WIDTH, TFT_HEIGHT - 40) / (TFT_TOOLPATH_CELLS));
+    constexpr uint16_t size = (TFT_TOOLPATH_CELLS) * scale;
+    static uint16_t shown;
+
+    if (use_click()) return goto_previous_screen_no_defer();
+    defer_status_screen();
+
+    if (screen_changed) {
+      clear_lcd();
+      touch.clear();
+      add_control(224, TFT_HEIGHT - 34, BACK, imgBack);
+      screen_changed = false;
+      shown = toolpath.changes - 1;
+    }
+
+    if (shown != toolpath.changes) {
+      shown = toolpath.changes;
+      tft.canvas((TFT_WIDTH - size) / 2, (TFT_HEIGHT - 40 - size) / 2, size, size);
+      tft.set_background(COLOR_BACKGROUND);
+      tft.add_rectangle(0, 0, size, size, COLOR_TOOLPATH_FRAME);
+      tft.add_toolpath(0, 0, scale, COLOR_TOOLPATH_LAYER, COLOR_TOOLPATH_LAST);
+    }
+
+    refresh(LCDVIEW_CALL_REDRAW_NEXT);    // Keep looking for new moves
+  }
+
+#endif
+
 #endif // HAS_UI_480x320
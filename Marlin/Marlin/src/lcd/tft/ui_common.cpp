@@ -58,25 +58,74 @@ static xy_uint_t cursor;
 
 #endif
 
+#if ENABLED(TFT_MENU_ROW_CACHE)
+
+  // A hash of what each row shows. Rows that still show the same thing are
+  // left on the display, so scrolling and value updates only draw the rows
+  // that changed. Cleared with the display.
+  static uint32_t row_key[LCD_HEIGHT];
+
+  static uint32_t key_add(const uint32_t h, const uint32_t v) { return (h ^ v) * 16777619UL; } // FNV-1a step
+  static uint32_t key_add(uint32_t h, const char *s) {
+    if (s) while (*s) h = key_add(h, uint8_t(*s++));
+    return key_add(h, 0x100UL);
+  }
+
+  // The label with its substitutions, the value and the highlight
+  static uint32_t item_key(const bool sel, FSTR_P const fstr, const char * const vstr=nullptr, const uint8_t style=0) {
+    uint32_t h = key_add(2166136261UL, uint32_t(uintptr_t(fstr)));
+    h = key_add(h, uint32_t(MenuItemBase::itemIndex) << 16 | style << 8 | sel);
+    h = key_add(h, uint32_t(uintptr_t(MenuItemBase::itemStringF)));
+    h = key_add(h, MenuItemBase::itemStringC);
+    return key_add(h, vstr);
+  }
+
+  #define ITEM_KEY(V...) item_key(V)
+  #define FORGET_ROW(R) do{ if ((R) < LCD_HEIGHT) row_key[R] = 0; }while(0)
+
+#else
+
+  #define ITEM_KEY(V...) 0
+  #define FORGET_ROW(R) NOOP
+
+#endif
+
 void menu_line(const uint8_t row, uint16_t color) {
+  FORGET_ROW(row);
   cursor.set(0, row);
   tft.canvas(0, TFT_TOP_LINE_Y + cursor.y * MENU_LINE_HEIGHT, TFT_WIDTH, MENU_ITEM_HEIGHT);
   tft.set_background(color);
 }
 
-void menu_item(const uint8_t row, bool sel ) {
+static void menu_item_controls(const uint8_t row, const bool sel) {
   #if ENABLED(TOUCH_SCREEN)
     if (row == 0) {
       touch.clear();
       draw_menu_navigation = TERN(ADVANCED_PAUSE_FEATURE, ui.currentScreen != menu_pause_option, true);
     }
+    const TouchControlType tct = TERN(SINGLE_TOUCH_NAVIGATION, true, sel) ? MENU_CLICK : MENU_ITEM;
+    touch.add_control(tct, 0, TFT_TOP_LINE_Y + row * MENU_LINE_HEIGHT, TFT_WIDTH, MENU_ITEM_HEIGHT, encoderTopLine + row);
+  #else
+    UNUSED(row); UNUSED(sel);
   #endif
+}
 
+void menu_item(const uint8_t row, bool sel ) {
+  menu_item_controls(row, sel);
   menu_line(row, sel ? COLOR_SELECTION_BG : COLOR_BACKGROUND);
-  #if ENABLED(TOUCH_SCREEN)
-    const TouchControlType tct = TERN(SINGLE_TOUCH_NAVIGATION, true, sel) ? MENU_CLICK : MENU_ITEM;
-    touch.add_control(tct, 0, TFT_TOP_LINE_Y + row * MENU_LINE_HEIGHT, TFT_WIDTH, MENU_ITEM_HEIGHT, encoderTopLine + row);
+}
+
+// Start a menu row, or return false if the display already shows it
+static bool menu_row(const uint8_t row, const bool sel, const uint32_t key) {
+  menu_item_controls(row, sel);
+  #if ENABLED(TFT_MENU_ROW_CACHE)
+    if (row < LCD_HEIGHT && row_key[row] == key) return false;
+  #else
+    UNUSED(key);
   #endif
+  menu_line(row, sel ? COLOR_SELECTION_BG : COLOR_BACKGROUND);
+  TERN_(TFT_MENU_ROW_CACHE, if (row < LCD_HEIGHT) row_key[row] = key);
+  return true;
 }
 
 //
@@ -88,6 +137,7 @@ void menu_item(const uint8_t row, bool sel ) {
 void lcd_gotopixel(const uint16_t x, const uint16_t y) {
   if (x >= TFT_WIDTH) return;
   cursor.set(x / (TFT_COL_WIDTH), y / MENU_LINE_HEIGHT);
+  FORGET_ROW(cursor.y);
   tft.canvas(x, TFT_TOP_LINE_Y + y, (TFT_WIDTH) - x, MENU_ITEM_HEIGHT);
   tft.set_background(COLOR_BACKGROUND);
 }
@@ -130,7 +180,7 @@ void lcd_put_int(const int i) {
 
 // Draw a generic menu item with pre_char (if selected) and post_char
 void MenuItemBase::_draw(const bool sel, const uint8_t row, FSTR_P const fstr, const char pre_char, const char post_char) {
-  menu_item(row, sel);
+  if (!menu_row(row, sel, ITEM_KEY(sel, fstr))) return;
 
   const char *string = FTOP(fstr);
   MarlinImage image = noImage;
@@ -153,7 +203,7 @@ void MenuItemBase::_draw(const bool sel, const uint8_t row, FSTR_P const fstr, c
 
 // Draw a menu item with a (potentially) editable value
 void MenuEditItemBase::draw(const bool sel, const uint8_t row, FSTR_P const fstr, const char * const inStr, const bool pgm) {
-  menu_item(row, sel);
+  if (!menu_row(row, sel, ITEM_KEY(sel, fstr, inStr))) return;
 
   tft_string.set(fstr, itemIndex, itemStringC, itemStringF);
   tft.add_text(MENU_TEXT_X_OFFSET, MENU_TEXT_Y_OFFSET, COLOR_MENU_TEXT, tft_string);
@@ -165,7 +215,7 @@ void MenuEditItemBase::draw(const bool sel, const uint8_t row, FSTR_P const fstr
 
 // Draw a static item with no left-right margin required. Centered by default.
 void MenuItem_static::draw(const uint8_t row, FSTR_P const fstr, const uint8_t style/*=SS_DEFAULT*/, const char * const vstr/*=nullptr*/) {
-  menu_item(row);
+  if (!menu_row(row, false, ITEM_KEY(false, fstr, vstr, style))) return;
   tft_string.set(fstr, itemIndex, itemStringC, itemStringF);
   if (vstr) tft_string.add(vstr);
   tft.add_text(tft_string.center(TFT_WIDTH), MENU_TEXT_Y_OFFSET, COLOR_YELLOW, tft_string);
@@ -211,6 +261,7 @@ void MarlinUI::clear_lcd() {
   tft.queue.reset();
   tft.fill(0, 0, TFT_WIDTH, TFT_HEIGHT, COLOR_BACKGROUND);
   cursor.set(0, 0);
+  TERN_(TFT_MENU_ROW_CACHE, ZERO(row_key));
 }
 
 #if HAS_LCD_BRIGHTNESS
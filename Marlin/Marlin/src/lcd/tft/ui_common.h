@@ -35,6 +35,10 @@
   extern bool draw_menu_navigation;
 #endif
 
+#if ENABLED(TFT_UI_PROFILER)
+  #include "ui_profiler.h"
+#endif
+
 #if HAS_UI_320x240
   #include "ui_320x240.h"
 #elif HAS_UI_480x320 || HAS_UI_480x272
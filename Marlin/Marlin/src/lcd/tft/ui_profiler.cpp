@@ -0,0 +1,99 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(TFT_UI_PROFILER)
+
+#include "ui_profiler.h"
+#include "../marlinui.h"
+#include "../../libs/hex_print.h"
+
+#if ENABLED(TFT_UI_PROFILER_OVERLAY)
+  #include "ui_common.h"
+#endif
+
+#define CYCLES_TO_US(C) uint32_t((C) / (F_CPU / 1000000UL))
+
+UIProfiler ui_profiler;
+
+UIProfiler::screen_stats_t UIProfiler::stats[TFT_UI_PROFILER_SCREENS];
+uint8_t UIProfiler::slot; // = 0
+uint32_t UIProfiler::last[UI_PHASES], UIProfiler::shown[UI_PHASES];
+
+void UIProfiler::frame(const screenFunc_t screen) {
+  // Find the screen, or claim a free slot. The last slot takes all the rest.
+  uint8_t s = 0;
+  while (s < TFT_UI_PROFILER_SCREENS - 1 && stats[s].screen && stats[s].screen != screen) s++;
+  if (!stats[s].screen) stats[s].screen = screen;
+  slot = s;
+  stats[s].frames++;
+
+  COPY(shown, last);
+  ZERO(last);
+}
+
+#if ENABLED(TFT_UI_PROFILER_OVERLAY)
+
+  void UIProfiler::draw_overlay() {
+    char line[40];
+    sprintf_P(line, PSTR("L%lu R%lu D%lu T%lu"),
+      CYCLES_TO_US(shown[UI_PHASE_LAYOUT]), CYCLES_TO_US(shown[UI_PHASE_RENDER]),
+      CYCLES_TO_US(shown[UI_PHASE_DMA]), CYCLES_TO_US(shown[UI_PHASE_TOUCH])
+    );
+    tft_string.set(line);
+    tft.canvas(TFT_WIDTH / 2, 0, TFT_WIDTH / 2, tft_string.font_height());
+    tft.set_background(COLOR_BACKGROUND);
+    tft.add_text(tft_string.width() < TFT_WIDTH / 2 ? TFT_WIDTH / 2 - tft_string.width() : 0, 0, COLOR_YELLOW, tft_string);
+  }
+
+#endif
+
+void UIProfiler::report() {
+  static const char * const phase_name[UI_PHASES] = { "layout", "render", "dma", "touch" };
+
+  SERIAL_ECHOLNPGM("UI cost per frame, avg/max us");
+  for (uint8_t s = 0; s < TFT_UI_PROFILER_SCREENS && stats[s].screen; s++) {
+    const screen_stats_t &st = stats[s];
+    SERIAL_ECHOPGM("Screen ", s);
+    if (st.screen == MarlinUI::status_screen)
+      SERIAL_ECHOPGM(" status");
+    else
+      SERIAL_ECHOPGM(" ", hex_address((const void *)st.screen));
+    if (s == TFT_UI_PROFILER_SCREENS - 1) SERIAL_ECHOPGM("+");
+    SERIAL_ECHOPGM(" frames:", st.frames);
+    LOOP_L_N(p, UI_PHASES) {
+      const uint32_t avg = st.frames ? CYCLES_TO_US(st.total[p] / st.frames) : 0;
+      SERIAL_ECHOPGM(" ", phase_name[p], ":", avg, "/", CYCLES_TO_US(st.peak[p]));
+    }
+    SERIAL_EOL();
+  }
+}
+
+void UIProfiler::reset() {
+  ZERO(stats);
+  ZERO(last);
+  ZERO(shown);
+  slot = 0;
+}
+
+#endif // TFT_UI_PROFILER
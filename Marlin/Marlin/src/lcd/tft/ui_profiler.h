@@ -0,0 +1,79 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * ui_profiler.h - Color UI cost counters (D204)
+ *
+ * Cycles are added to the screen that was current when its last frame was
+ * laid out, so the canvas render and DMA time of a frame, spread over many
+ * TFT_Queue::async() calls, is charged to the screen that queued it.
+ */
+
+#include "../../inc/MarlinConfig.h"
+#include "../../HAL/shared/Delay.h"
+
+enum UIPhase : uint8_t {
+  UI_PHASE_LAYOUT,    // The screen handler, filling the TFT queue
+  UI_PHASE_RENDER,    // Drawing canvas items into the slice buffer
+  UI_PHASE_DMA,       // Sending slices and fills to the display
+  UI_PHASE_TOUCH,     // Touch::idle(), including the actions it runs
+  UI_PHASES
+};
+
+class UIProfiler {
+public:
+  typedef void (*screenFunc_t)();
+
+  // Called before the screen handler runs
+  static void frame(const screenFunc_t screen);
+
+  static void add(const UIPhase phase, const uint32_t cycles) {
+    if (!cycles) return;
+    stats[slot].total[phase] += cycles;
+    NOLESS(stats[slot].peak[phase], cycles);
+    last[phase] += cycles;
+  }
+
+  #if ENABLED(TFT_UI_PROFILER_OVERLAY)
+    // Queue the cost of the previous frame in the top right corner
+    static void draw_overlay();
+  #endif
+
+  static void report();
+  static void reset();
+
+private:
+  typedef struct {
+    screenFunc_t screen;                  // nullptr for an unused slot
+    uint32_t frames;
+    uint64_t total[UI_PHASES];
+    uint32_t peak[UI_PHASES];
+  } screen_stats_t;
+
+  static screen_stats_t stats[TFT_UI_PROFILER_SCREENS];
+  static uint8_t slot;                    // Slot of the screen being charged
+  static uint32_t last[UI_PHASES],        // Cycles since the current frame began
+                  shown[UI_PHASES];       // Cycles spent on the previous frame
+};
+
+extern UIProfiler ui_profiler;
@@ -122,7 +122,11 @@ public:
 
   inline static void WriteSequence(uint16_t *Data, uint16_t Count) { io.WriteSequence(Data, Count); };
 
-  #if ENABLED(USE_SPI_DMA_TC)
+  #if ENABLED(TFT_DOUBLE_BUFFER)
+    inline static void WriteSequenceAsync(uint16_t *Data, uint16_t Count) { io.WriteSequenceAsync(Data, Count); };
+  #endif
+
+  #if EITHER(USE_SPI_DMA_TC, LVGL_PERFORMANCE_MODE)
     inline static void WriteSequenceIT(uint16_t *Data, uint16_t Count) { io.WriteSequenceIT(Data, Count); };
   #endif
 
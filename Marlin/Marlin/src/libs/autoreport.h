@@ -23,25 +23,26 @@
 
 #include "../inc/MarlinConfig.h"
 
-template <typename Helper>
+// The interval is counted in units of UNIT_MS, seconds by default
+template <typename Helper, uint16_t UNIT_MS=1000>
 struct AutoReporter {
   millis_t next_report_ms;
   uint8_t report_interval;
   #if HAS_MULTI_SERIAL
     SerialMask report_port_mask;
-    AutoReporter() : report_port_mask(SerialMask::All) {}
+    AutoReporter() : report_port_mask(TELEMETRY_PORTMASK) {}
   #endif
 
-  inline void set_interval(uint8_t seconds, const uint8_t limit=60) {
-    report_interval = _MIN(seconds, limit);
-    next_report_ms = millis() + SEC_TO_MS(seconds);
+  inline void set_interval(uint8_t interval, const uint8_t limit=60) {
+    report_interval = _MIN(interval, limit);
+    next_report_ms = millis() + millis_t(interval) * (UNIT_MS);
   }
 
   inline void tick() {
     if (!report_interval) return;
     const millis_t ms = millis();
     if (ELAPSED(ms, next_report_ms)) {
-      next_report_ms = ms + SEC_TO_MS(report_interval);
+      next_report_ms = ms + millis_t(report_interval) * (UNIT_MS);
       PORT_REDIRECT(report_port_mask);
       Helper::report();
       PORT_RESTORE();
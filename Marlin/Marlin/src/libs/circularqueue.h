@@ -22,110 +22,202 @@
 #pragma once
 
 #include <stdint.h>
+#include "../core/types.h"
 
 /**
  * @brief   Circular Queue class
- * @details Implementation of the classic ring buffer data structure
+ * @details Implementation of the classic ring buffer data structure, safe for
+ *          one producer and one consumer (e.g., an ISR and the main loop) with
+ *          no critical section. Each side writes only its own index, with release
+ *          ordering after the items, and reads the other side's with acquire
+ *          ordering. The indexes run freely and are masked on use, so there is
+ *          no shared count and no slot is left empty.
  */
-template<typename T, uint8_t N>
+template<typename T, uint32_t N>
 class CircularQueue {
+  static_assert(N >= 2 && N <= 65536 && !(N & (N - 1)), "CircularQueue size must be a power of 2 from 2 to 65536.");
+  #ifdef __AVR__
+    static_assert(N <= 128, "CircularQueue size must be 128 or less on AVR, where only a byte is read or written at once.");
+  #endif
+
+  public:
+    // The smallest index that can count to N
+    typedef typename IF<(N <= 128), uint8_t, typename IF<(N <= 32768), uint16_t, uint32_t>::type>::type index_t;
+
   private:
 
     /**
      * @brief   Buffer structure
      * @details This structure consolidates all the overhead required to handle
-     *          a circular queue such as the pointers and the buffer vector.
+     *          a circular queue such as the indexes and the buffer vector.
+     *          Only the consumer writes head and only the producer writes tail.
      */
     struct buffer_t {
-      uint8_t head;
-      uint8_t tail;
-      uint8_t count;
-      uint8_t size;
+      index_t head;
+      index_t tail;
       T queue[N];
     } buffer;
 
+    static constexpr index_t mask = N - 1;
+
+    index_t load_head() const { return __atomic_load_n(&buffer.head, __ATOMIC_ACQUIRE); }
+    index_t load_tail() const { return __atomic_load_n(&buffer.tail, __ATOMIC_ACQUIRE); }
+
   public:
     /**
      * @brief   Class constructor
      * @details This class requires two template parameters, T defines the type
      *          of item this queue will handle and N defines the maximum number of
-     *          items that can be stored on the queue.
+     *          items that can be stored on the queue, a power of 2.
      */
     CircularQueue<T, N>() {
-      buffer.size = N;
-      buffer.count = buffer.head = buffer.tail = 0;
+      buffer.head = buffer.tail = 0;
     }
 
     /**
      * @brief   Removes and returns a item from the queue
      * @details Removes the oldest item on the queue, pointed to by the
      *          buffer_t head field. The item is returned to the caller.
+     *          Consumer side.
      * @return  type T item
      */
     T dequeue() {
-      if (isEmpty()) return T();
-
-      uint8_t index = buffer.head;
-
-      --buffer.count;
-      if (++buffer.head == buffer.size)
-        buffer.head = 0;
-
-      return buffer.queue[index];
+      const index_t h = buffer.head;
+      if (h == load_tail()) return T();
+      const T item = buffer.queue[h & mask];
+      __atomic_store_n(&buffer.head, index_t(h + 1), __ATOMIC_RELEASE);
+      return item;
     }
 
     /**
      * @brief   Adds an item to the queue
      * @details Adds an item to the queue on the location pointed by the buffer_t
      *          tail variable. Returns false if no queue space is available.
+     *          Producer side.
      * @param   item Item to be added to the queue
      * @return  true if the operation was successful
      */
     bool enqueue(T const &item) {
-      if (isFull()) return false;
+      const index_t t = buffer.tail;
+      if (index_t(t - load_head()) == N) return false;
+      buffer.queue[t & mask] = item;
+      __atomic_store_n(&buffer.tail, index_t(t + 1), __ATOMIC_RELEASE);
+      return true;
+    }
 
-      buffer.queue[buffer.tail] = item;
+    /**
+     * @brief   Adds up to n items to the queue
+     * @details Copies as many of the items as there is space for, in one or two runs.
+     *          Producer side.
+     * @return  the number of items added
+     */
+    index_t push_n(const T * const items, const index_t n) {
+      T *span;
+      index_t done = 0;
+      while (done < n) {
+        const index_t run = write_span(span, n - done);
+        if (!run) break;
+        for (index_t i = 0; i < run; ++i) span[i] = items[done + i];
+        commit(run);
+        done += run;
+      }
+      return done;
+    }
 
-      ++buffer.count;
-      if (++buffer.tail == buffer.size)
-        buffer.tail = 0;
+    /**
+     * @brief   Removes up to n items from the queue
+     * @details Copies out as many items as are queued, up to n, oldest first.
+     *          Consumer side.
+     * @return  the number of items removed
+     */
+    index_t pop_n(T * const items, const index_t n) {
+      const T *span;
+      index_t done = 0;
+      while (done < n) {
+        const index_t run = read_span(span, n - done);
+        if (!run) break;
+        for (index_t i = 0; i < run; ++i) items[done + i] = span[i];
+        release(run);
+        done += run;
+      }
+      return done;
+    }
 
-      return true;
+    /**
+     * @brief   Gets the free space after the tail that doesn't wrap
+     * @details For the producer to fill in place (e.g., as a DMA target), then commit().
+     * @param   span Set to the first free slot
+     * @param   most The most slots wanted
+     * @return  the number of contiguous free slots, up to most
+     */
+    index_t write_span(T* &span, const index_t most=N) {
+      const index_t t = buffer.tail, i = t & mask;
+      index_t n = N - index_t(t - load_head());
+      if (n > N - i) n = N - i;
+      if (n > most) n = most;
+      span = &buffer.queue[i];
+      return n;
+    }
+
+    /**
+     * @brief   Adds n items filled in from write_span()
+     */
+    void commit(const index_t n) { __atomic_store_n(&buffer.tail, index_t(buffer.tail + n), __ATOMIC_RELEASE); }
+
+    /**
+     * @brief   Gets the queued items after the head that don't wrap
+     * @details For the consumer to use in place (e.g., as a DMA source), then release().
+     * @param   span Set to the oldest item
+     * @param   most The most items wanted
+     * @return  the number of contiguous items, up to most
+     */
+    index_t read_span(const T* &span, const index_t most=N) {
+      const index_t h = buffer.head, i = h & mask;
+      index_t n = load_tail() - h;
+      if (n > N - i) n = N - i;
+      if (n > most) n = most;
+      span = &buffer.queue[i];
+      return n;
     }
 
+    /**
+     * @brief   Removes n items used from read_span()
+     */
+    void release(const index_t n) { __atomic_store_n(&buffer.head, index_t(buffer.head + n), __ATOMIC_RELEASE); }
+
     /**
      * @brief   Checks if the queue has no items
      * @details Returns true if there are no items on the queue, false otherwise.
      * @return  true if queue is empty
      */
-    bool isEmpty() { return buffer.count == 0; }
+    bool isEmpty() const { return load_head() == load_tail(); }
 
     /**
      * @brief   Checks if the queue is full
      * @details Returns true if the queue is full, false otherwise.
      * @return  true if queue is full
      */
-    bool isFull() { return buffer.count == buffer.size; }
+    bool isFull() const { return count() == N; }
 
     /**
      * @brief   Gets the queue size
      * @details Returns the maximum number of items a queue can have.
      * @return  the queue size
      */
-    uint8_t size() { return buffer.size; }
+    index_t size() const { return N; }
 
     /**
      * @brief   Gets the next item from the queue without removing it
      * @details Returns the next item in the queue without removing it
-     *          or updating the pointers.
+     *          or updating the indexes. Consumer side.
      * @return  first item in the queue
      */
-    T peek() { return buffer.queue[buffer.head]; }
+    T peek() const { return buffer.queue[buffer.head & mask]; }
 
     /**
      * @brief Gets the number of items on the queue
      * @details Returns the current number of items stored on the queue.
      * @return number of items in the queue
      */
-    uint8_t count() { return buffer.count; }
+    index_t count() const { return index_t(load_tail() - load_head()); }
 };
@@ -0,0 +1,57 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+#include "crc32.h"
+
+// The reflected polynomial 0xEDB88320, four bits at a time
+static const uint32_t crc32_nibble[16] PROGMEM = {
+  0x00000000UL, 0x1DB71064UL, 0x3B6E20C8UL, 0x26D930ACUL, 0x76DC4190UL, 0x6B6B51F4UL, 0x4DB26158UL, 0x5005713CUL,
+  0xEDB88320UL, 0xF00F9344UL, 0xD6D6A3E8UL, 0xCB61B38CUL, 0x9B64C2B0UL, 0x86D3D2D4UL, 0xA00AE278UL, 0xBDBDF21CUL
+};
+
+static uint32_t crc32_bytes(uint32_t crc, const uint8_t *p, uint32_t len) {
+  crc = ~crc;
+  while (len--) {
+    crc ^= *p++;
+    crc = (crc >> 4) ^ pgm_read_dword(&crc32_nibble[crc & 0xF]);
+    crc = (crc >> 4) ^ pgm_read_dword(&crc32_nibble[crc & 0xF]);
+  }
+  return ~crc;
+}
+
+uint32_t crc32(uint32_t crc, const void * const data, uint32_t len) {
+  const uint8_t *p = (const uint8_t *)data;
+  #ifdef HAL_CRC32_WORDS
+    if (len >= 16) {
+      // Bytes up to a word boundary, then whole words in hardware
+      const uint8_t head = -uintptr_t(p) & 3;
+      crc = crc32_bytes(crc, p, head);
+      p += head; len -= head;
+      if (hal.crc32_words(crc, (const uint32_t *)p, len >> 2)) {
+        p += len & ~3UL;
+        len &= 3;
+      }
+    }
+  #endif
+  return crc32_bytes(crc, p, len);
+}
@@ -0,0 +1,58 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * dsp_math.h - Q15 kernels on the Cortex-M4 DSP extension, with portable versions
+ *
+ * Each kernel has a plain C++ version (_c) and one that uses the Cortex-M4 SIMD
+ * instructions when the compiler sets __ARM_FEATURE_DSP. Both give the same
+ * results, so D213 can compare them.
+ *
+ *   lerp_q8 : Lerp between two neighboring int16 values with a 1/256 step fraction,
+ *             (p[0] * (256 - t) + p[1] * t). One 32-bit load and one SMUAD.
+ */
+
+#include "../inc/MarlinConfigPre.h"
+#include <string.h>
+
+namespace dsp {
+
+  // (p[0] * (256 - t) + p[1] * t), which is p[0] + (p[1] - p[0]) * t / 256, times 256
+  FORCE_INLINE static int32_t lerp_q8_c(const int16_t * const p, const uint8_t t) {
+    return (int32_t(p[0]) << 8) + (p[1] - p[0]) * t;
+  }
+
+  FORCE_INLINE static int32_t lerp_q8(const int16_t * const p, const uint8_t t) {
+    #if defined(__ARM_FEATURE_DSP) && __ARM_FEATURE_DSP
+      uint32_t pair;
+      memcpy(&pair, p, sizeof(pair));             // LDR, unaligned is fine on the M4
+      const uint32_t w = (256U - t) | (uint32_t(t) << 16);
+      int32_t r;
+      __asm__ ("smuad %0, %1, %2" : "=r"(r) : "r"(pair), "r"(w));  // p0 * (256 - t) + p1 * t
+      return r;
+    #else
+      return lerp_q8_c(p, t);
+    #endif
+  }
+
+}
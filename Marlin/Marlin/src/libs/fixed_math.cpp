@@ -0,0 +1,69 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(PLANNER_FIXED_POINT)
+
+#include "fixed_math.h"
+
+/**
+ * 1/sqrt(v) at the middle of each table bucket
+ *  [  0-127] Odd exponent:  v = 2 * (1 + (m + 0.5) / 128)
+ *  [128-255] Even exponent: v = 1 + (m + 0.5) / 128
+ */
+const float rsqrt_lut[256] PROGMEM = {
+  0.70572975f, 0.70299964f, 0.70030098f, 0.69763315f, 0.69499559f, 0.69238772f, 0.68980898f, 0.68725885f,
+  0.68473679f, 0.68224229f, 0.67977486f, 0.67733401f, 0.67491926f, 0.67253016f, 0.67016625f, 0.66782710f,
+  0.66551226f, 0.66322134f, 0.66095391f, 0.65870958f, 0.65648795f, 0.65428866f, 0.65211132f, 0.64995557f,
+  0.64782106f, 0.64570745f, 0.64361439f, 0.64154155f, 0.63948861f, 0.63745526f, 0.63544118f, 0.63344607f,
+  0.63146963f, 0.62951158f, 0.62757163f, 0.62564951f, 0.62374494f, 0.62185766f, 0.61998741f, 0.61813393f,
+  0.61629697f, 0.61447630f, 0.61267166f, 0.61088284f, 0.60910959f, 0.60735169f, 0.60560893f, 0.60388108f,
+  0.60216794f, 0.60046930f, 0.59878495f, 0.59711470f, 0.59545834f, 0.59381570f, 0.59218657f, 0.59057078f,
+  0.58896814f, 0.58737848f, 0.58580162f, 0.58423739f, 0.58268563f, 0.58114617f, 0.57961884f, 0.57810350f,
+  0.57659998f, 0.57510812f, 0.57362779f, 0.57215883f, 0.57070110f, 0.56925445f, 0.56781875f, 0.56639386f,
+  0.56497964f, 0.56357596f, 0.56218270f, 0.56079971f, 0.55942688f, 0.55806409f, 0.55671120f, 0.55536811f,
+  0.55403469f, 0.55271083f, 0.55139641f, 0.55009133f, 0.54879547f, 0.54750873f, 0.54623099f, 0.54496216f,
+  0.54370213f, 0.54245080f, 0.54120807f, 0.53997385f, 0.53874802f, 0.53753051f, 0.53632122f, 0.53512005f,
+  0.53392692f, 0.53274173f, 0.53156440f, 0.53039484f, 0.52923296f, 0.52807869f, 0.52693194f, 0.52579262f,
+  0.52466067f, 0.52353599f, 0.52241852f, 0.52130817f, 0.52020487f, 0.51910855f, 0.51801913f, 0.51693654f,
+  0.51586070f, 0.51479156f, 0.51372904f, 0.51267307f, 0.51162358f, 0.51058052f, 0.50954380f, 0.50851338f,
+  0.50748918f, 0.50647115f, 0.50545922f, 0.50445333f, 0.50345342f, 0.50245943f, 0.50147131f, 0.50048900f,
+  0.99805258f, 0.99419163f, 0.99037514f, 0.98660227f, 0.98287219f, 0.97918410f, 0.97553722f, 0.97193078f,
+  0.96836405f, 0.96483630f, 0.96134683f, 0.95789494f, 0.95447998f, 0.95110128f, 0.94775820f, 0.94445014f,
+  0.94117647f, 0.93793661f, 0.93472998f, 0.93155602f, 0.92841417f, 0.92530389f, 0.92222467f, 0.91917598f,
+  0.91615733f, 0.91316823f, 0.91020820f, 0.90727676f, 0.90437347f, 0.90149787f, 0.89864953f, 0.89582802f,
+  0.89303292f, 0.89026381f, 0.88752031f, 0.88480202f, 0.88210855f, 0.87943954f, 0.87679460f, 0.87417338f,
+  0.87157554f, 0.86900071f, 0.86644858f, 0.86391880f, 0.86141104f, 0.85892500f, 0.85646036f, 0.85401682f,
+  0.85159407f, 0.84919183f, 0.84680980f, 0.84444770f, 0.84210526f, 0.83978221f, 0.83747828f, 0.83519320f,
+  0.83292673f, 0.83067861f, 0.82844860f, 0.82623645f, 0.82404192f, 0.82186480f, 0.81970483f, 0.81756181f,
+  0.81543551f, 0.81332571f, 0.81123220f, 0.80915478f, 0.80709324f, 0.80504737f, 0.80301698f, 0.80100188f,
+  0.79900187f, 0.79701677f, 0.79504639f, 0.79309056f, 0.79114908f, 0.78922180f, 0.78730853f, 0.78540911f,
+  0.78352337f, 0.78165115f, 0.77979229f, 0.77794662f, 0.77611400f, 0.77429427f, 0.77248728f, 0.77069288f,
+  0.76891093f, 0.76714128f, 0.76538380f, 0.76363834f, 0.76190476f, 0.76018294f, 0.75847274f, 0.75677403f,
+  0.75508669f, 0.75341057f, 0.75174558f, 0.75009157f, 0.74844843f, 0.74681604f, 0.74519429f, 0.74358306f,
+  0.74198223f, 0.74039170f, 0.73881135f, 0.73724108f, 0.73568078f, 0.73413035f, 0.73258967f, 0.73105866f,
+  0.72953720f, 0.72802521f, 0.72652257f, 0.72502921f, 0.72354501f, 0.72206989f, 0.72060376f, 0.71914652f,
+  0.71769809f, 0.71625837f, 0.71482728f, 0.71340474f, 0.71199066f, 0.71058495f, 0.70918753f, 0.70779833f
+};
+
+#endif // PLANNER_FIXED_POINT
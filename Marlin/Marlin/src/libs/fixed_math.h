@@ -0,0 +1,58 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * fixed_math.h - Fixed-point helpers for the planner hot loop (PLANNER_FIXED_POINT)
+ *
+ * fast_rsqrt() seeds 1/sqrt(x) from a 256-entry table indexed by the exponent
+ * parity and the top 7 mantissa bits, then refines it with one Newton step.
+ * The relative error is below 6e-6, replacing a square root and a division.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+extern const float rsqrt_lut[256];
+
+// 1/sqrt(x) for a positive, finite x
+FORCE_INLINE static float fast_rsqrt(const float x) {
+  union { float f; uint32_t i; } v = { x };
+  const uint32_t e = v.i >> 23;                           // Biased exponent (sign is 0)
+  v.f = pgm_read_float(&rsqrt_lut[((e & 1) << 7) | ((v.i >> 16) & 0x7F)]);
+  v.i -= uint32_t(int32_t(e - 127) >> 1) << 23;           // Scale by 2^-floor(exp/2)
+  return v.f * (1.5f - 0.5f * x * sq(v.f));
+}
+
+// sqrt(x) for a non-negative, finite x
+FORCE_INLINE static float fast_sqrt(const float x) { return x > 0 ? x * fast_rsqrt(x) : 0; }
+
+// 64/32 division, using the 32-bit hardware divider when the dividend fits
+FORCE_INLINE static uint32_t udiv_64_32(const uint64_t n, const uint32_t d) {
+  return (n >> 32) ? uint32_t(n / d) : uint32_t(n) / d;
+}
+
+// Steps to go from rate v0 to a higher rate v1 with 2a = twice the acceleration (steps/s^2)
+FORCE_INLINE static uint32_t ramp_steps(const uint32_t v0, const uint32_t v1, const uint32_t two_a, const bool round_up) {
+  if (v1 <= v0 || !two_a) return 0;
+  const uint64_t d = uint64_t(v1 - v0) * (v1 + v0);
+  return udiv_64_32(round_up ? d + two_a - 1 : d, two_a);
+}
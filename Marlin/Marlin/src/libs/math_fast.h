@@ -0,0 +1,64 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+#pragma once
+
+/**
+ * math_fast.h - Single precision approximations for arc and kinematics code
+ *
+ * The Cortex-M4F FPU only does single precision, so any double in a hot path
+ * becomes a soft-float library call. These stay in float from end to end:
+ *
+ *   fast_sinf / fast_cosf : Range reduced degree 7 polynomial. Error < 2e-6 for |x| < 20.
+ *   fast_atan2f           : Octant reduced degree 9 polynomial. Error < 1.2e-5 rad.
+ *
+ * SQRT() is sqrtf, a single VSQRT when built with -fno-math-errno, and
+ * fast_rsqrt() in fixed_math.h covers 1/sqrt for PLANNER_FIXED_POINT.
+ */
+
+#include "../inc/MarlinConfigPre.h"
+
+// sin(x) for x in radians
+FORCE_INLINE constexpr float fast_sinf(float x) {
+  constexpr float PI_F = float(M_PI);
+  const float k = x * (0.5f / PI_F);
+  x -= float(int32_t(k + (k < 0 ? -0.5f : 0.5f))) * (2 * PI_F);   // to [-pi, pi]
+  if (x > PI_F * 0.5f) x = PI_F - x;                              // to [-pi/2, pi/2]
+  else if (x < PI_F * -0.5f) x = -PI_F - x;
+  const float x2 = x * x;
+  return x * (0.99999660f + x2 * (-0.16664824f + x2 * (0.00830629f + x2 * -0.00018363f)));
+}
+
+// cos(x) for x in radians
+FORCE_INLINE constexpr float fast_cosf(const float x) { return fast_sinf(x + float(M_PI) * 0.5f); }
+
+// atan2(y, x) in radians, 0 at the origin
+FORCE_INLINE constexpr float fast_atan2f(const float y, const float x) {
+  const float ax = x < 0 ? -x : x, ay = y < 0 ? -y : y;
+  if (ax == 0 && ay == 0) return 0;
+  const bool swap = ay > ax;
+  const float t = swap ? ax / ay : ay / ax, t2 = t * t;
+  float a = t * (0.9998660f + t2 * (-0.3302995f + t2 * (0.1801410f + t2 * (-0.0851330f + t2 * 0.0208351f))));
+  if (swap) a = float(M_PI) * 0.5f - a;
+  if (x < 0) a = float(M_PI) - a;
+  return y < 0 ? -a : a;
+}
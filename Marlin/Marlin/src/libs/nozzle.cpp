@@ -30,6 +30,7 @@ Nozzle nozzle;
 
 #include "../MarlinCore.h"
 #include "../module/motion.h"
+#include "../module/planner.h"
 
 #if NOZZLE_CLEAN_MIN_TEMP > 20
   #include "../module/temperature.h"
@@ -37,6 +38,12 @@ Nozzle nozzle;
 
 #if ENABLED(NOZZLE_CLEAN_FEATURE)
 
+  // Patterns are only queued, so the strokes blend in the planner.
+  // Nozzle::clean() waits for the whole pattern to finish.
+  static void plan_move_to_x(const_float_t rx) { xyz_pos_t pos = current_position; pos.x = rx; plan_move_to(pos); }
+  static void plan_move_to_xy(const_float_t rx, const_float_t ry) { xyz_pos_t pos = current_position; pos.set(rx, ry); plan_move_to(pos); }
+  static void plan_move_to_xy(const xy_pos_t &raw) { plan_move_to_xy(raw.x, raw.y); }
+
   /**
    * @brief Stroke clean pattern
    * @details Wipes the nozzle back and forth in a linear movement
@@ -53,26 +60,26 @@ Nozzle nozzle;
     // Move to the starting point
     #if ENABLED(NOZZLE_CLEAN_NO_Z)
       #if ENABLED(NOZZLE_CLEAN_NO_Y)
-        do_blocking_move_to_x(start.x);
+        plan_move_to_x(start.x);
       #else
-        do_blocking_move_to_xy(start);
+        plan_move_to_xy(start);
       #endif
     #else
-      do_blocking_move_to(start);
+      plan_move_to(start);
     #endif
 
     // Start the stroke pattern
     LOOP_L_N(i, strokes >> 1) {
       #if ENABLED(NOZZLE_CLEAN_NO_Y)
-        do_blocking_move_to_x(end.x);
-        do_blocking_move_to_x(start.x);
+        plan_move_to_x(end.x);
+        plan_move_to_x(start.x);
       #else
-        do_blocking_move_to_xy(end);
-        do_blocking_move_to_xy(start);
+        plan_move_to_xy(end);
+        plan_move_to_xy(start);
       #endif
     }
 
-    TERN_(NOZZLE_CLEAN_GOBACK, do_blocking_move_to(oldpos));
+    TERN_(NOZZLE_CLEAN_GOBACK, plan_move_to(oldpos));
   }
 
   /**
@@ -93,9 +100,9 @@ Nozzle nozzle;
     #endif
 
     #if ENABLED(NOZZLE_CLEAN_NO_Z)
-      do_blocking_move_to_xy(start);
+      plan_move_to_xy(start);
     #else
-      do_blocking_move_to(start);
+      plan_move_to(start);
     #endif
 
     const uint8_t zigs = objects << 1;
@@ -106,20 +113,20 @@ Nozzle nozzle;
       for (int8_t i = 0; i < zigs; i++) {
         side = (i & 1) ? &end : &start;
         if (horiz)
-          do_blocking_move_to_xy(start.x + i * P, side->y);
+          plan_move_to_xy(start.x + i * P, side->y);
         else
-          do_blocking_move_to_xy(side->x, start.y + i * P);
+          plan_move_to_xy(side->x, start.y + i * P);
       }
       for (int8_t i = zigs; i >= 0; i--) {
         side = (i & 1) ? &end : &start;
         if (horiz)
-          do_blocking_move_to_xy(start.x + i * P, side->y);
+          plan_move_to_xy(start.x + i * P, side->y);
         else
-          do_blocking_move_to_xy(side->x, start.y + i * P);
+          plan_move_to_xy(side->x, start.y + i * P);
       }
     }
 
-    TERN_(NOZZLE_CLEAN_GOBACK, do_blocking_move_to(back));
+    TERN_(NOZZLE_CLEAN_GOBACK, plan_move_to(back));
   }
 
   /**
@@ -136,19 +143,19 @@ Nozzle nozzle;
     #if ENABLED(NOZZLE_CLEAN_GOBACK)
       const xyz_pos_t back = current_position;
     #endif
-    TERN(NOZZLE_CLEAN_NO_Z, do_blocking_move_to_xy, do_blocking_move_to)(start);
+    TERN(NOZZLE_CLEAN_NO_Z, plan_move_to_xy, plan_move_to)(start);
 
     LOOP_L_N(s, strokes)
       LOOP_L_N(i, NOZZLE_CLEAN_CIRCLE_FN)
-        do_blocking_move_to_xy(
+        plan_move_to_xy(
           middle.x + sin((RADIANS(360) / NOZZLE_CLEAN_CIRCLE_FN) * i) * radius,
           middle.y + cos((RADIANS(360) / NOZZLE_CLEAN_CIRCLE_FN) * i) * radius
         );
 
     // Let's be safe
-    do_blocking_move_to_xy(start);
+    plan_move_to_xy(start);
 
-    TERN_(NOZZLE_CLEAN_GOBACK, do_blocking_move_to(back));
+    TERN_(NOZZLE_CLEAN_GOBACK, plan_move_to(back));
   }
 
   /**
@@ -219,6 +226,8 @@ Nozzle nozzle;
        case 2: circle(start[arrPos], middle[arrPos], strokes, radius);  break;
       default: stroke(start[arrPos], end[arrPos], strokes);
     }
+
+    planner.synchronize();
   }
 
 #endif // NOZZLE_CLEAN_FEATURE
@@ -237,36 +246,42 @@ Nozzle nozzle;
     );
   }
 
-  void Nozzle::park(const uint8_t z_action, const xyz_pos_t &park/*=NOZZLE_PARK_POINT*/) {
+  void Nozzle::park(const uint8_t z_action, const xyz_pos_t &park/*=NOZZLE_PARK_POINT*/, const bool wait/*=true*/) {
     constexpr feedRate_t fr_xy = NOZZLE_PARK_XY_FEEDRATE, fr_z = NOZZLE_PARK_Z_FEEDRATE;
 
+    // Only queue the moves, so the Z raise runs straight into the XY move
+    xyz_pos_t pos = current_position;
+
     switch (z_action) {
       case 1: // Go to Z-park height
-        do_blocking_move_to_z(park.z, fr_z);
+        pos.z = park.z;
         break;
 
       case 2: // Raise by Z-park height
-        do_blocking_move_to_z(_MIN(current_position.z + park.z, Z_MAX_POS), fr_z);
+        pos.z = _MIN(current_position.z + park.z, Z_MAX_POS);
         break;
 
       default: // Raise by NOZZLE_PARK_Z_RAISE_MIN, use park.z as a minimum height
-        do_blocking_move_to_z(park_mode_0_height(park.z), fr_z);
+        pos.z = park_mode_0_height(park.z);
         break;
     }
+    plan_move_to(pos, fr_z);
 
     #ifndef NOZZLE_PARK_MOVE
       #define NOZZLE_PARK_MOVE 0
     #endif
+    auto move_x = [&]{ pos.x = park.x; plan_move_to(pos, fr_xy); };
+    auto move_y = [&]{ pos.y = park.y; plan_move_to(pos, fr_xy); };
     switch (NOZZLE_PARK_MOVE) {
-      case 0: do_blocking_move_to_xy(park, fr_xy); break;
-      case 1: do_blocking_move_to_x(park.x, fr_xy); break;
-      case 2: do_blocking_move_to_y(park.y, fr_xy); break;
-      case 3: do_blocking_move_to_x(park.x, fr_xy);
-              do_blocking_move_to_y(park.y, fr_xy); break;
-      case 4: do_blocking_move_to_y(park.y, fr_xy);
-              do_blocking_move_to_x(park.x, fr_xy); break;
+      case 0: pos.set(park.x, park.y); plan_move_to(pos, fr_xy); break;
+      case 1: move_x(); break;
+      case 2: move_y(); break;
+      case 3: move_x(); move_y(); break;
+      case 4: move_y(); move_x(); break;
     }
 
+    if (wait) planner.synchronize();
+
     report_current_position();
   }
 
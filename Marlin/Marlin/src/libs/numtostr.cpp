@@ -22,23 +22,88 @@
 
 #include "numtostr.h"
 
-#include "../inc/MarlinConfigPre.h"
+#include "../inc/MarlinConfig.h"
 #include "../core/utility.h"
 
 char conv[8] = { 0 };
 
 #define DIGIT(n) ('0' + (n))
-#define DIGIMOD(n, f) DIGIT((n)/(f) % 10)
-#define RJDIGIT(n, f) ((n) >= (f) ? DIGIMOD(n, f) : ' ')
-#define MINUSOR(n, alt) (n >= 0 ? (alt) : (n = -n, '-'))
-#define INTFLOAT(V,N) (((V) * 10 * pow(10, N) + ((V) < 0 ? -5: 5)) / 10)      // pow10?
+#define SCALE10(N) ((N) == 0 ? 1.0f : (N) == 1 ? 10.0f : (N) == 2 ? 100.0f : (N) == 3 ? 1000.0f : 10000.0f)
+#define INTFLOAT(V,N) scale_round(V, SCALE10(N))
 #define UINTFLOAT(V,N) INTFLOAT((V) < 0 ? -(V) : (V), N)
 
+// "00" to "99", so each division by 100 gives two digits
+static const char digit_pairs[] PROGMEM =
+  "0001020304050607080910111213141516171819"
+  "2021222324252627282930313233343536373839"
+  "4041424344454647484950515253545556575859"
+  "6061626364656667686970717273747576777879"
+  "8081828384858687888990919293949596979899";
+
+static const uint32_t pow10_table[10] PROGMEM = {
+  1UL, 10UL, 100UL, 1000UL, 10000UL, 100000UL, 1000000UL, 10000000UL, 100000000UL, 1000000000UL
+};
+
+// Scale to fixed point, rounding half away from zero. The integer part is split off
+// first, so the single precision multiply only has to round the fraction.
+static long scale_round(const_float_t v, const float scale) {
+  const long ip = long(v);
+  return ip * long(scale) + long((v - float(ip)) * scale + (v < 0 ? -0.5f : 0.5f));
+}
+
+uint32_t dec_pow10(const uint8_t n) { return pgm_read_dword(&pow10_table[n]); }
+
+// Write the low 'digits' digits of n, ending just before 'end'. Return the rest of n.
+static uint32_t put_digits(char *end, uint32_t n, uint8_t digits) {
+  for (; digits >= 2; digits -= 2) {
+    const uint8_t r = n % 100;
+    n /= 100;
+    *--end = pgm_read_byte(&digit_pairs[r * 2 + 1]);
+    *--end = pgm_read_byte(&digit_pairs[r * 2]);
+  }
+  if (digits) { *--end = DIGIT(n % 10); n /= 10; }
+  return n;
+}
+
+// Write n as 'idigits' integer digits, a point, and 'dec' decimals, ending just before 'end'
+static void put_fixed(char *end, uint32_t n, const uint8_t idigits, const uint8_t dec) {
+  n = put_digits(end, n, dec);
+  end[-dec - 1] = '.';
+  put_digits(end - dec - 1, n, idigits);
+}
+
+// Blank the leading zeros of the 'digits' digits at p showing n. The last digit always stays.
+static void rj_blank(char *p, uint8_t digits, const uint32_t n) {
+  while (--digits && n < dec_pow10(digits)) *p++ = ' ';
+}
+
+static uint8_t dec_digits(const uint32_t n) {
+  uint8_t digits = 1;
+  while (digits < 10 && n >= dec_pow10(digits)) digits++;
+  return digits;
+}
+
+char* append_uint(char *p, const uint32_t n) {
+  const uint8_t digits = dec_digits(n);
+  p += digits;
+  put_digits(p, n, digits);
+  return p;
+}
+
+char* append_fixed(char *p, const int32_t v, const uint8_t decimals) {
+  uint32_t n = v;
+  if (v < 0) { *p++ = '-'; n = -n; }
+  if (!decimals) return append_uint(p, n);
+  const uint8_t digits = dec_digits(n), idigits = digits > decimals ? digits - decimals : 1;
+  p += idigits + 1 + decimals;
+  put_fixed(p, n, idigits, decimals);
+  return p;
+}
+
 // Format uint8_t (0-100) as rj string with 123% / _12% / __1% format
 const char* pcttostrpctrj(const uint8_t i) {
-  conv[3] = RJDIGIT(i, 100);
-  conv[4] = RJDIGIT(i, 10);
-  conv[5] = DIGIMOD(i, 1);
+  put_digits(&conv[6], i, 3);
+  rj_blank(&conv[3], 3, i);
   conv[6] = '%';
   return &conv[3];
 }
@@ -50,26 +115,20 @@ const char* ui8tostr4pctrj(const uint8_t i) {
 
 // Convert unsigned 8bit int to string 123 format
 const char* ui8tostr3rj(const uint8_t i) {
-  conv[4] = RJDIGIT(i, 100);
-  conv[5] = RJDIGIT(i, 10);
-  conv[6] = DIGIMOD(i, 1);
+  put_digits(&conv[7], i, 3);
+  rj_blank(&conv[4], 3, i);
   return &conv[4];
 }
 
 // Convert uint8_t to string with 12 format
 const char* ui8tostr2(const uint8_t i) {
-  conv[5] = DIGIMOD(i, 10);
-  conv[6] = DIGIMOD(i, 1);
+  put_digits(&conv[7], i, 2);
   return &conv[5];
 }
 
 // Convert signed 8bit int to rj string with 123 or -12 format
 const char* i8tostr3rj(const int8_t x) {
-  int xx = x;
-  conv[4] = MINUSOR(xx, RJDIGIT(xx, 100));
-  conv[5] = RJDIGIT(xx, 10);
-  conv[6] = DIGIMOD(xx, 1);
-  return &conv[4];
+  return i16tostr3rj(x);
 }
 
 #if HAS_PRINT_PROGRESS_PERMYRIAD
@@ -78,23 +137,17 @@ const char* i8tostr3rj(const int8_t x) {
     if (xx >= 10000)
       return "100";
     else if (xx >= 1000) {
-      conv[3] = DIGIMOD(xx, 1000);
-      conv[4] = DIGIMOD(xx, 100);
-      conv[5] = '.';
-      conv[6] = DIGIMOD(xx, 10);
+      put_fixed(&conv[7], xx / 10, 2, 1);
       return &conv[3];
     }
     else if (xx % 100 == 0) {
       conv[4] = ' ';
-      conv[5] = RJDIGIT(xx, 1000);
-      conv[6] = DIGIMOD(xx, 100);
+      put_digits(&conv[7], xx / 100, 2);
+      rj_blank(&conv[5], 2, xx / 100);
       return &conv[4];
     }
     else {
-      conv[3] = DIGIMOD(xx, 100);
-      conv[4] = '.';
-      conv[5] = DIGIMOD(xx, 10);
-      conv[6] = RJDIGIT(xx, 1);
+      put_fixed(&conv[7], xx, 1, 2);
       return &conv[3];
     }
   }
@@ -102,168 +155,107 @@ const char* i8tostr3rj(const int8_t x) {
 
 // Convert unsigned 16bit int to string 12345 format
 const char* ui16tostr5rj(const uint16_t xx) {
-  conv[2] = RJDIGIT(xx, 10000);
-  conv[3] = RJDIGIT(xx, 1000);
-  conv[4] = RJDIGIT(xx, 100);
-  conv[5] = RJDIGIT(xx, 10);
-  conv[6] = DIGIMOD(xx, 1);
+  put_digits(&conv[7], xx, 5);
+  rj_blank(&conv[2], 5, xx);
   return &conv[2];
 }
 
 // Convert unsigned 16bit int to string 1234 format
 const char* ui16tostr4rj(const uint16_t xx) {
-  conv[3] = RJDIGIT(xx, 1000);
-  conv[4] = RJDIGIT(xx, 100);
-  conv[5] = RJDIGIT(xx, 10);
-  conv[6] = DIGIMOD(xx, 1);
+  put_digits(&conv[7], xx, 4);
+  rj_blank(&conv[3], 4, xx);
   return &conv[3];
 }
 
 // Convert unsigned 16bit int to string 123 format
 const char* ui16tostr3rj(const uint16_t xx) {
-  conv[4] = RJDIGIT(xx, 100);
-  conv[5] = RJDIGIT(xx, 10);
-  conv[6] = DIGIMOD(xx, 1);
+  put_digits(&conv[7], xx, 3);
+  rj_blank(&conv[4], 3, xx);
   return &conv[4];
 }
 
 // Convert signed 16bit int to rj string with 123 or -12 format
 const char* i16tostr3rj(const int16_t x) {
-  int xx = x;
-  conv[4] = MINUSOR(xx, RJDIGIT(xx, 100));
-  conv[5] = RJDIGIT(xx, 10);
-  conv[6] = DIGIMOD(xx, 1);
+  const uint16_t xx = x < 0 ? -x : x;
+  put_digits(&conv[7], xx, 3);
+  rj_blank(&conv[4], 3, xx);
+  if (x < 0) conv[4] = '-';
   return &conv[4];
 }
 
 // Convert unsigned 16bit int to lj string with 123 format
 const char* i16tostr3left(const int16_t i) {
-  char *str = &conv[6];
-  *str = DIGIMOD(i, 1);
-  if (i >= 10) {
-    *(--str) = DIGIMOD(i, 10);
-    if (i >= 100)
-      *(--str) = DIGIMOD(i, 100);
-  }
-  return str;
+  const uint8_t digits = i >= 100 ? 3 : i >= 10 ? 2 : 1;
+  put_digits(&conv[7], i, digits);
+  return &conv[7 - digits];
 }
 
 // Convert signed 16bit int to rj string with 1234, _123, -123, _-12, or __-1 format
 const char* i16tostr4signrj(const int16_t i) {
-  const bool neg = i < 0;
-  const int ii = neg ? -i : i;
-  if (i >= 1000) {
-    conv[3] = DIGIMOD(ii, 1000);
-    conv[4] = DIGIMOD(ii, 100);
-    conv[5] = DIGIMOD(ii, 10);
-  }
-  else if (ii >= 100) {
-    conv[3] = neg ? '-' : ' ';
-    conv[4] = DIGIMOD(ii, 100);
-    conv[5] = DIGIMOD(ii, 10);
-  }
-  else {
-    conv[3] = ' ';
-    conv[4] = ' ';
-    if (ii >= 10) {
-      conv[4] = neg ? '-' : ' ';
-      conv[5] = DIGIMOD(ii, 10);
-    }
-    else {
-      conv[5] = neg ? '-' : ' ';
-    }
-  }
-  conv[6] = DIGIMOD(ii, 1);
+  const uint16_t ii = i < 0 ? -i : i;
+  put_digits(&conv[7], ii, 4);
+  rj_blank(&conv[3], 4, ii);
+  if (i < 0) conv[ii >= 100 ? 3 : ii >= 10 ? 4 : 5] = '-';
   return &conv[3];
 }
 
 // Convert unsigned float to string with 1.1 format
 const char* ftostr11ns(const_float_t f) {
-  const long i = UINTFLOAT(f, 1);
-  conv[4] = DIGIMOD(i, 10);
-  conv[5] = '.';
-  conv[6] = DIGIMOD(i, 1);
+  put_fixed(&conv[7], UINTFLOAT(f, 1), 1, 1);
   return &conv[4];
 }
 
 // Convert unsigned float to string with 1.23 format
 const char* ftostr12ns(const_float_t f) {
-  const long i = UINTFLOAT(f, 2);
-  conv[3] = DIGIMOD(i, 100);
-  conv[4] = '.';
-  conv[5] = DIGIMOD(i, 10);
-  conv[6] = DIGIMOD(i, 1);
+  put_fixed(&conv[7], UINTFLOAT(f, 2), 1, 2);
   return &conv[3];
 }
 
 // Convert unsigned float to string with 12.3 format
 const char* ftostr31ns(const_float_t f) {
-  const long i = UINTFLOAT(f, 1);
-  conv[3] = DIGIMOD(i, 100);
-  conv[4] = DIGIMOD(i, 10);
-  conv[5] = '.';
-  conv[6] = DIGIMOD(i, 1);
+  put_fixed(&conv[7], UINTFLOAT(f, 1), 2, 1);
   return &conv[3];
 }
 
 // Convert unsigned float to string with 123.4 format
 const char* ftostr41ns(const_float_t f) {
-  const long i = UINTFLOAT(f, 1);
-  conv[2] = DIGIMOD(i, 1000);
-  conv[3] = DIGIMOD(i, 100);
-  conv[4] = DIGIMOD(i, 10);
-  conv[5] = '.';
-  conv[6] = DIGIMOD(i, 1);
+  put_fixed(&conv[7], UINTFLOAT(f, 1), 3, 1);
   return &conv[2];
 }
 
 // Convert signed float to fixed-length string with 12.34 / _2.34 / -2.34 or -23.45 / 123.45 format
 const char* ftostr42_52(const_float_t f) {
   if (f <= -10 || f >= 100) return ftostr52(f); // -23.45 / 123.45
-  long i = INTFLOAT(f, 2);
-  conv[2] = (f >= 0 && f < 10) ? ' ' : MINUSOR(i, DIGIMOD(i, 1000));
-  conv[3] = DIGIMOD(i, 100);
-  conv[4] = '.';
-  conv[5] = DIGIMOD(i, 10);
-  conv[6] = DIGIMOD(i, 1);
+  const long i = INTFLOAT(f, 2);
+  put_fixed(&conv[7], ABS(i), 2, 2);
+  if (f >= 0 && f < 10) conv[2] = ' ';
+  else if (i < 0) conv[2] = '-';
   return &conv[2];
 }
 
 // Convert signed float to fixed-length string with 023.45 / -23.45 format
 const char* ftostr52(const_float_t f) {
-  long i = INTFLOAT(f, 2);
-  conv[1] = MINUSOR(i, DIGIMOD(i, 10000));
-  conv[2] = DIGIMOD(i, 1000);
-  conv[3] = DIGIMOD(i, 100);
-  conv[4] = '.';
-  conv[5] = DIGIMOD(i, 10);
-  conv[6] = DIGIMOD(i, 1);
+  const long i = INTFLOAT(f, 2);
+  put_fixed(&conv[7], ABS(i), 3, 2);
+  if (i < 0) conv[1] = '-';
   return &conv[1];
 }
 
 // Convert signed float to fixed-length string with 12.345 / _2.345 / -2.345 or -23.45 / 123.45 format
 const char* ftostr53_63(const_float_t f) {
   if (f <= -10 || f >= 100) return ftostr63(f); // -23.456 / 123.456
-  long i = INTFLOAT(f, 3);
-  conv[1] = (f >= 0 && f < 10) ? ' ' : MINUSOR(i, DIGIMOD(i, 10000));
-  conv[2] = DIGIMOD(i, 1000);
-  conv[3] = '.';
-  conv[4] = DIGIMOD(i, 100);
-  conv[5] = DIGIMOD(i, 10);
-  conv[6] = DIGIMOD(i, 1);
+  const long i = INTFLOAT(f, 3);
+  put_fixed(&conv[7], ABS(i), 2, 3);
+  if (f >= 0 && f < 10) conv[1] = ' ';
+  else if (i < 0) conv[1] = '-';
   return &conv[1];
 }
 
 // Convert signed float to fixed-length string with 023.456 / -23.456 format
 const char* ftostr63(const_float_t f) {
-  long i = INTFLOAT(f, 3);
-  conv[0] = MINUSOR(i, DIGIMOD(i, 100000));
-  conv[1] = DIGIMOD(i, 10000);
-  conv[2] = DIGIMOD(i, 1000);
-  conv[3] = '.';
-  conv[4] = DIGIMOD(i, 100);
-  conv[5] = DIGIMOD(i, 10);
-  conv[6] = DIGIMOD(i, 1);
+  const long i = INTFLOAT(f, 3);
+  put_fixed(&conv[7], ABS(i), 3, 3);
+  if (i < 0) conv[0] = '-';
   return &conv[0];
 }
 
@@ -273,12 +265,10 @@ const char* ftostr63(const_float_t f) {
   const char* ftostr4sign(const_float_t f) {
     const int i = INTFLOAT(f, 1);
     if (!WITHIN(i, -99, 999)) return i16tostr4signrj((int)f);
-    const bool neg = i < 0;
-    const int ii = neg ? -i : i;
-    conv[3] = neg ? '-' : (ii >= 100 ? DIGIMOD(ii, 100) : ' ');
-    conv[4] = DIGIMOD(ii, 10);
-    conv[5] = '.';
-    conv[6] = DIGIMOD(ii, 1);
+    const int ii = ABS(i);
+    put_fixed(&conv[7], ii, 2, 1);
+    if (i < 0) conv[3] = '-';
+    else if (ii < 100) conv[3] = ' ';
     return &conv[3];
   }
 
@@ -286,49 +276,33 @@ const char* ftostr63(const_float_t f) {
 
 // Convert float to fixed-length string with +12.3 / -12.3 format
 const char* ftostr31sign(const_float_t f) {
-  int i = INTFLOAT(f, 1);
-  conv[2] = MINUSOR(i, '+');
-  conv[3] = DIGIMOD(i, 100);
-  conv[4] = DIGIMOD(i, 10);
-  conv[5] = '.';
-  conv[6] = DIGIMOD(i, 1);
+  const int i = INTFLOAT(f, 1);
+  put_fixed(&conv[7], ABS(i), 2, 1);
+  conv[2] = i < 0 ? '-' : '+';
   return &conv[2];
 }
 
 // Convert float to fixed-length string with +123.4 / -123.4 format
 const char* ftostr41sign(const_float_t f) {
-  int i = INTFLOAT(f, 1);
-  conv[1] = MINUSOR(i, '+');
-  conv[2] = DIGIMOD(i, 1000);
-  conv[3] = DIGIMOD(i, 100);
-  conv[4] = DIGIMOD(i, 10);
-  conv[5] = '.';
-  conv[6] = DIGIMOD(i, 1);
+  const int i = INTFLOAT(f, 1);
+  put_fixed(&conv[7], ABS(i), 3, 1);
+  conv[1] = i < 0 ? '-' : '+';
   return &conv[1];
 }
 
 // Convert signed float to string (6 digit) with -1.234 / _0.000 / +1.234 format
 const char* ftostr43sign(const_float_t f, char plus/*=' '*/) {
-  long i = INTFLOAT(f, 3);
-  conv[1] = i ? MINUSOR(i, plus) : ' ';
-  conv[2] = DIGIMOD(i, 1000);
-  conv[3] = '.';
-  conv[4] = DIGIMOD(i, 100);
-  conv[5] = DIGIMOD(i, 10);
-  conv[6] = DIGIMOD(i, 1);
+  const long i = INTFLOAT(f, 3);
+  put_fixed(&conv[7], ABS(i), 1, 3);
+  conv[1] = !i ? ' ' : i < 0 ? '-' : plus;
   return &conv[1];
 }
 
 // Convert signed float to string (5 digit) with -1.2345 / _0.0000 / +1.2345 format
 const char* ftostr54sign(const_float_t f, char plus/*=' '*/) {
-  long i = INTFLOAT(f, 4);
-  conv[0] = i ? MINUSOR(i, plus) : ' ';
-  conv[1] = DIGIMOD(i, 10000);
-  conv[2] = '.';
-  conv[3] = DIGIMOD(i, 1000);
-  conv[4] = DIGIMOD(i, 100);
-  conv[5] = DIGIMOD(i, 10);
-  conv[6] = DIGIMOD(i, 1);
+  const long i = INTFLOAT(f, 4);
+  put_fixed(&conv[7], ABS(i), 1, 4);
+  conv[0] = !i ? ' ' : i < 0 ? '-' : plus;
   return &conv[0];
 }
 
@@ -340,78 +314,120 @@ const char* ftostr5rj(const_float_t f) {
 
 // Convert signed float to string with +1234.5 format
 const char* ftostr51sign(const_float_t f) {
-  long i = INTFLOAT(f, 1);
-  conv[0] = MINUSOR(i, '+');
-  conv[1] = DIGIMOD(i, 10000);
-  conv[2] = DIGIMOD(i, 1000);
-  conv[3] = DIGIMOD(i, 100);
-  conv[4] = DIGIMOD(i, 10);
-  conv[5] = '.';
-  conv[6] = DIGIMOD(i, 1);
+  const long i = INTFLOAT(f, 1);
+  put_fixed(&conv[7], ABS(i), 4, 1);
+  conv[0] = i < 0 ? '-' : '+';
   return conv;
 }
 
 // Convert signed float to string with +123.45 format
 const char* ftostr52sign(const_float_t f) {
-  long i = INTFLOAT(f, 2);
-  conv[0] = MINUSOR(i, '+');
-  conv[1] = DIGIMOD(i, 10000);
-  conv[2] = DIGIMOD(i, 1000);
-  conv[3] = DIGIMOD(i, 100);
-  conv[4] = '.';
-  conv[5] = DIGIMOD(i, 10);
-  conv[6] = DIGIMOD(i, 1);
+  const long i = INTFLOAT(f, 2);
+  put_fixed(&conv[7], ABS(i), 3, 2);
+  conv[0] = i < 0 ? '-' : '+';
   return conv;
 }
 
 // Convert signed float to string with +12.345 format
 const char* ftostr53sign(const_float_t f) {
-  long i = INTFLOAT(f, 3);
-  conv[0] = MINUSOR(i, '+');
-  conv[1] = DIGIMOD(i, 10000);
-  conv[2] = DIGIMOD(i, 1000);
-  conv[3] = '.';
-  conv[4] = DIGIMOD(i, 100);
-  conv[5] = DIGIMOD(i, 10);
-  conv[6] = DIGIMOD(i, 1);
+  const long i = INTFLOAT(f, 3);
+  put_fixed(&conv[7], ABS(i), 2, 3);
+  conv[0] = i < 0 ? '-' : '+';
   return conv;
 }
 
 // Convert unsigned float to string with ____5.6, ___45.6, __345.6, _2345.6, 12345.6 format
 const char* ftostr61rj(const_float_t f) {
   const long i = UINTFLOAT(f, 1);
-  conv[0] = RJDIGIT(i, 100000);
-  conv[1] = RJDIGIT(i, 10000);
-  conv[2] = RJDIGIT(i, 1000);
-  conv[3] = RJDIGIT(i, 100);
-  conv[4] = DIGIMOD(i, 10);
-  conv[5] = '.';
-  conv[6] = DIGIMOD(i, 1);
+  put_fixed(&conv[7], i, 5, 1);
+  rj_blank(conv, 5, i / 10);
   return conv;
 }
 
 // Convert signed float to space-padded string with -_23.4_ format
 const char* ftostr52sp(const_float_t f) {
-  long i = INTFLOAT(f, 2);
-  uint8_t dig;
-  conv[0] = MINUSOR(i, ' ');
-  conv[1] = RJDIGIT(i, 10000);
-  conv[2] = RJDIGIT(i, 1000);
-  conv[3] = DIGIMOD(i, 100);
-
-  if ((dig = i % 10)) {          // second digit after decimal point?
-    conv[4] = '.';
-    conv[5] = DIGIMOD(i, 10);
-    conv[6] = DIGIT(dig);
-  }
-  else {
-    if ((dig = (i / 10) % 10)) { // first digit after decimal point?
-      conv[4] = '.';
-      conv[5] = DIGIT(dig);
-    }
-    else                          // nothing after decimal point
-      conv[4] = conv[5] = ' ';
+  const long i = INTFLOAT(f, 2), ii = ABS(i);
+  put_fixed(&conv[7], ii, 3, 2);
+  rj_blank(&conv[1], 3, ii / 100);
+  conv[0] = i < 0 ? '-' : ' ';
+  if (conv[6] == '0') {           // no second digit after the decimal point?
     conv[6] = ' ';
+    if (conv[5] == '0')           // nothing after the decimal point
+      conv[4] = conv[5] = ' ';
   }
   return conv;
 }
+
+#if ENABLED(MARLIN_DEV_MODE)
+
+  #include "../core/serial.h"
+
+  // The per-digit forms replaced above, kept to measure against
+  #define OLD_INTFLOAT(V,N) (((V) * 10 * pow(10, N) + ((V) < 0 ? -5: 5)) / 10)
+  #define OLD_DIGIMOD(n, f) DIGIT((n)/(f) % 10)
+
+  static const char* old_ftostr52(const_float_t f) {
+    long i = OLD_INTFLOAT(f, 2);
+    conv[1] = i >= 0 ? OLD_DIGIMOD(i, 10000) : (i = -i, '-');
+    conv[2] = OLD_DIGIMOD(i, 1000);
+    conv[3] = OLD_DIGIMOD(i, 100);
+    conv[4] = '.';
+    conv[5] = OLD_DIGIMOD(i, 10);
+    conv[6] = OLD_DIGIMOD(i, 1);
+    return &conv[1];
+  }
+
+  // SerialBase::printFloat as it was, into a buffer
+  static char* old_append_float(char *p, double number, uint8_t digits) {
+    if (number < 0.0) { *p++ = '-'; number = -number; }
+    double rounding = 0.5;
+    LOOP_L_N(i, digits) rounding *= 0.1;
+    number += rounding;
+    unsigned long int_part = (unsigned long)number;
+    double remainder = number - (double)int_part;
+    char buf[10];
+    int8_t n = 0;
+    do { buf[n++] = DIGIT(int_part % 10); int_part /= 10; } while (int_part);
+    while (n--) *p++ = buf[n];
+    if (digits) {
+      *p++ = '.';
+      while (digits--) {
+        remainder *= 10.0;
+        const uint8_t d = (uint8_t)remainder;
+        *p++ = DIGIT(d);
+        remainder -= d;
+      }
+    }
+    return p;
+  }
+
+  void bench_numtostr(const uint32_t count) {
+    char buf[16];
+    volatile char sink = 0;
+    LOOP_L_N(fast, 2) {
+      millis_t start_ms = millis();
+      for (uint32_t n = 0; n < count; ++n) {
+        const float f = float(n % 4000) * 0.37f - 500.0f;
+        sink += (fast ? ftostr52(f) : old_ftostr52(f))[3];
+      }
+      const millis_t lcd_ms = _MAX(millis() - start_ms, 1UL);
+
+      start_ms = millis();
+      for (uint32_t n = 0; n < count; ++n) {
+        const float f = float(n % 4000) * 0.37f - 500.0f;
+        if (fast) {
+          const double scaled = double(f) * 1000.0 + (f < 0 ? -0.5 : 0.5);
+          sink += *(append_fixed(buf, int32_t(scaled), 3) - 1);
+        }
+        else
+          sink += *(old_append_float(buf, f, 3) - 1);
+      }
+      const millis_t serial_ms = _MAX(millis() - start_ms, 1UL);
+
+      if (fast) SERIAL_ECHOPGM("Table driven"); else SERIAL_ECHOPGM("Per digit");
+      SERIAL_ECHOLNPGM(": ftostr52 ", uint32_t(uint64_t(count) * 1000UL / lcd_ms),
+                       "/s, print(f, 3) ", uint32_t(uint64_t(count) * 1000UL / serial_ms), "/s");
+    }
+  }
+
+#endif
@@ -24,6 +24,20 @@
 #include "../inc/MarlinConfigPre.h"
 #include "../core/types.h"
 
+// 10^n for n from 0 to 9
+uint32_t dec_pow10(const uint8_t n);
+
+// Append the digits of n to p without a terminator. Return the end.
+char* append_uint(char *p, const uint32_t n);
+
+// Append v / 10^decimals (0-9) as [-]int.frac to p without a terminator. Return the end.
+char* append_fixed(char *p, const int32_t v, const uint8_t decimals);
+
+#if ENABLED(MARLIN_DEV_MODE)
+  // Compare per-digit and table driven formatting (D209)
+  void bench_numtostr(const uint32_t count);
+#endif
+
 // Format uint8_t (0-100) as rj string with 123% / _12% / __1% format
 const char* pcttostrpctrj(const uint8_t i);
 
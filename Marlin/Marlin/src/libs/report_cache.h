@@ -0,0 +1,69 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+#include "../inc/MarlinConfig.h"
+
+/**
+ * The text of a status report, formatted once and replayed verbatim
+ * until the report's owner invalidates it. Formatting code that takes its
+ * output as a template parameter can write to this or to SERIAL_IMPL, so
+ * the cached text is exactly what would have been printed.
+ */
+struct ReportCache : public SerialBase<ReportCache> {
+  static constexpr uint8_t SIZE = 128;
+  char text[SIZE];
+  uint8_t length;
+  bool valid, overflow;
+
+  ReportCache() : SerialBase<ReportCache>(false), length(0), valid(false), overflow(false) {}
+
+  size_t write(uint8_t c) {
+    if (length < SIZE) text[length++] = c; else overflow = true;
+    return 1;
+  }
+  void msgDone() {}
+
+  inline void invalidate() { valid = false; }
+
+  // Start formatting a new report
+  inline void start() { length = 0; overflow = false; }
+
+  // Finish formatting. A report that didn't fit is printed directly instead.
+  inline bool finish() { return (valid = !overflow); }
+
+  inline void replay() { LOOP_L_N(i, length) SERIAL_CHAR(text[i]); }
+};
+
+// Print a PROGMEM string to a serial or a report cache
+template <class OUT>
+inline void report_print_P(OUT &out, PGM_P str) { while (const char c = pgm_read_byte(str++)) out.write(c); }
+
+// Print a float the way SERIAL_DECIMAL does
+template <class OUT>
+inline void report_decimal(OUT &out, const_float_t v) {
+  #if SERIAL_FLOAT_PRECISION
+    out.print(v, SERIAL_FLOAT_PRECISION);
+  #else
+    out.print(v, 2);
+  #endif
+}
@@ -0,0 +1,123 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(SOFT_I2C_ASYNC)
+
+#include "soft_i2c_async.h"
+#include "../HAL/shared/Delay.h"
+
+SoftI2CAsync soft_i2c;
+
+SoftI2CAsync::transfer_t SoftI2CAsync::queue[SOFT_I2C_ASYNC_QUEUE];
+volatile uint8_t SoftI2CAsync::head, SoftI2CAsync::tail; // = 0
+uint16_t SoftI2CAsync::phase; // = 0
+bool SoftI2CAsync::ticking; // = false
+uint16_t SoftI2CAsync::nacks; // = 0
+
+static void line_low(const pin_t pin) { extDigitalWrite(pin, LOW); pinMode(pin, OUTPUT); }
+static void line_release(const pin_t pin) { pinMode(pin, INPUT_PULLUP); }
+
+// Drive the bus to half clock 'n' of the transfer. Return true after the STOP.
+bool SoftI2CAsync::step(const transfer_t &t, uint16_t n) {
+  // Idle bus, then START: SDA falls while SCL is high
+  if (n == 0) { line_release(t.scl); line_release(t.sda); return false; }
+  if (n == 1) { line_low(t.sda); return false; }
+  n -= 2;
+
+  // Data bits, MSB first, then the ACK. SDA changes while SCL is low.
+  const uint16_t halves = t.len * 18U;
+  if (n < halves) {
+    const uint16_t bit = n >> 1;
+    const uint8_t b = bit / 9, k = bit % 9;
+    if (!(n & 1)) {
+      line_low(t.scl);
+      if (k < 8 && !TEST(t.data[b], 7 - k)) line_low(t.sda); else line_release(t.sda);
+    }
+    else {
+      line_release(t.scl);
+      if (k == 8 && extDigitalRead(t.sda)) nacks++;
+    }
+    return false;
+  }
+
+  // STOP: SDA rises while SCL is high
+  switch (n - halves) {
+    case 0: line_low(t.scl); line_low(t.sda); return false;
+    case 1: line_release(t.scl); return false;
+    default: line_release(t.sda); return true;
+  }
+}
+
+void SoftI2CAsync::write(const pin_t sda, const pin_t scl, const uint8_t addr, const uint8_t *data, const uint8_t len) {
+  if (len >= SOFT_I2C_ASYNC_MAX_BYTES) return;
+
+  transfer_t t;
+  t.sda = sda;
+  t.scl = scl;
+  t.len = len + 1;
+  t.data[0] = addr << 1;
+  memcpy(&t.data[1], data, len);
+
+  // No ISR yet. Send it now, at about 100kHz.
+  if (!ticking) {
+    for (uint16_t n = 0; !step(t, n); n++) DELAY_US(5);
+    return;
+  }
+
+  for (;;) {
+    CRITICAL_SECTION_START();
+
+    // Replace the data of a waiting write to the same register
+    for (uint8_t i = phase ? next(head) : head; i != tail; i = next(i)) {
+      transfer_t &q = queue[i];
+      if (q.sda == sda && q.scl == scl && q.len == t.len && q.data[0] == t.data[0] && (t.len == 2 || q.data[1] == t.data[1])) {
+        q = t;
+        CRITICAL_SECTION_END();
+        return;
+      }
+    }
+
+    const uint8_t n = next(tail);
+    if (n != head) {
+      queue[tail] = t;
+      tail = n;
+      CRITICAL_SECTION_END();
+      return;
+    }
+
+    CRITICAL_SECTION_END();
+    hal.watchdog_refresh();  // Full. Wait for the ISR.
+  }
+}
+
+void SoftI2CAsync::tick() {
+  ticking = true;
+  if (head == tail) return;
+  if (step(queue[head], phase++)) {
+    phase = 0;
+    head = next(head);
+  }
+}
+
+#endif // SOFT_I2C_ASYNC
@@ -0,0 +1,70 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * soft_i2c_async.h - Write-only I2C, queued and bit-banged from the Temperature ISR
+ *
+ * Each tick moves the bus on by half a clock, so a byte takes 18 ticks. Devices can
+ * share SCL with an SDA each, as the MCP4018 digipots do. The ones not addressed see
+ * the clock with their SDA high, never a START, and ignore it. Both lines are driven
+ * open-drain, with the pull-ups on.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#define SOFT_I2C_ASYNC_MAX_BYTES 8    // Address included
+
+class SoftI2CAsync {
+public:
+  /**
+   * Queue a write of 'len' bytes to the 7-bit address 'addr' and return.
+   * A write still waiting for the same device and register gets the new data instead.
+   * (For a single byte write the device is the register.) Wait only if the queue is full.
+   * Until the Temperature ISR runs, the write is sent at once.
+   */
+  static void write(const pin_t sda, const pin_t scl, const uint8_t addr, const uint8_t *data, const uint8_t len);
+
+  static bool busy() { return head != tail; }
+
+  // Called by the Temperature ISR
+  static void tick();
+
+  static uint16_t nacks;                  // Bytes not acknowledged
+
+private:
+  typedef struct {
+    pin_t sda, scl;
+    uint8_t len,                          // Bytes in data
+            data[SOFT_I2C_ASYNC_MAX_BYTES];  // Address (shifted, write) and payload
+  } transfer_t;
+
+  static transfer_t queue[SOFT_I2C_ASYNC_QUEUE];
+  static volatile uint8_t head, tail;     // Next to send, next free
+  static uint16_t phase;                  // Half clocks of queue[head] sent
+  static bool ticking;                    // The ISR has run
+
+  static uint8_t next(const uint8_t i) { return (i + 1) % (SOFT_I2C_ASYNC_QUEUE); }
+  static bool step(const transfer_t &t, uint16_t n);
+};
+
+extern SoftI2CAsync soft_i2c;
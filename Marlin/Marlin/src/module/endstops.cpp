@@ -68,6 +68,10 @@ Endstops::endstop_mask_t Endstops::live_state = 0;
   uint8_t Endstops::endstop_poll_count;
 #endif
 
+#if ENABLED(ENDSTOP_INTERRUPTS_BY_DIRECTION)
+  bool Endstops::exti_shared; // = false
+#endif
+
 #if HAS_BED_PROBE
   volatile bool Endstops::z_probe_enabled = false;
 #endif
@@ -362,6 +366,8 @@ void Endstops::poll() {
 
   #if DISABLED(ENDSTOP_INTERRUPTS_FEATURE)
     update();
+  #elif ENABLED(ENDSTOP_INTERRUPTS_BY_DIRECTION)
+    if (exti_shared || TERN0(ENDSTOP_NOISE_THRESHOLD, endstop_poll_count)) update();
   #elif ENDSTOP_NOISE_THRESHOLD
     if (endstop_poll_count) update();
   #endif
@@ -612,7 +618,7 @@ void __O2 Endstops::report_states() {
  * Read endstops to get their current states, register hits for all
  * axes moving in the direction of their endstops, and abort moves.
  */
-void Endstops::update() {
+HOT_ISR_FUNC void Endstops::update() {
 
   #if !ENDSTOP_NOISE_THRESHOLD      // If not debouncing...
     if (!abort_enabled()) return;   // ...and not enabled, exit.
@@ -1110,6 +1116,39 @@ void Endstops::update() {
   #endif
 } // Endstops::update()
 
+#if ENABLED(ENDSTOP_INTERRUPTS_BY_DIRECTION)
+
+  void Endstops::select_interrupts() {
+    static endstop_mask_t selected; // = 0, all masked by setup_endstop_interrupts()
+
+    endstop_mask_t want = 0;
+    if (abort_enabled()) {
+      if (stepper.axis_is_moving(X_AXIS)) {
+        if (stepper.motor_direction(X_AXIS_HEAD)) { TERN_(HAS_X_MIN, SBI(want, X_MIN)); }
+        else                                      { TERN_(HAS_X_MAX, SBI(want, X_MAX)); }
+      }
+      if (stepper.axis_is_moving(Y_AXIS)) {
+        if (stepper.motor_direction(Y_AXIS_HEAD)) { TERN_(HAS_Y_MIN, SBI(want, Y_MIN)); }
+        else                                      { TERN_(HAS_Y_MAX, SBI(want, Y_MAX)); }
+      }
+      if (stepper.axis_is_moving(Z_AXIS)) {
+        if (stepper.motor_direction(Z_AXIS_HEAD)) {
+          TERN_(HAS_Z_MIN, SBI(want, Z_MIN));
+          #if USES_Z_MIN_PROBE_PIN
+            if (z_probe_enabled) SBI(want, Z_MIN_PROBE);
+          #endif
+        }
+        else { TERN_(HAS_Z_MAX, SBI(want, Z_MAX)); }
+      }
+    }
+
+    if (want == selected) return;
+    selected = want;
+    exti_shared = !endstop_interrupts_select(want);
+  }
+
+#endif
+
 #if ENABLED(SPI_ENDSTOPS)
 
   // Called from idle() to read Trinamic stall states
@@ -131,6 +131,10 @@ class Endstops {
       static uint8_t endstop_poll_count;    // Countdown from threshold for polling
     #endif
 
+    #if ENABLED(ENDSTOP_INTERRUPTS_BY_DIRECTION)
+      static bool exti_shared;              // Two selected endstops share an EXTI line, so poll
+    #endif
+
   public:
     Endstops() {};
 
@@ -160,6 +164,14 @@ class Endstops {
      */
     static void update();
 
+    #if ENABLED(ENDSTOP_INTERRUPTS_BY_DIRECTION)
+      /**
+       * Unmask only the EXTI lines of the endstops the block moves toward,
+       * none when endstops are off. Called from the Stepper ISR at block start.
+       */
+      static void select_interrupts();
+    #endif
+
     /**
      * Get Endstop hit state.
      */
@@ -62,10 +62,12 @@
   #include "../feature/fwretract.h"
 #endif
 
-#if ENABLED(BABYSTEP_DISPLAY_TOTAL)
+#if EITHER(BABYSTEP_DISPLAY_TOTAL, BABYSTEP_PLANNER)
   #include "../feature/babystep.h"
 #endif
 
+#include "../libs/report_cache.h"
+
 #define DEBUG_OUT ENABLED(DEBUG_LEVELING_FEATURE)
 #include "../core/debug_out.h"
 
@@ -185,22 +187,25 @@ inline void report_more_positions() {
   TERN_(IS_SCARA, scara_report_positions());
 }
 
+// Print a logical position to a serial or a report cache
+template <class OUT>
+static void print_logical_position(OUT &out, const xyze_pos_t &lpos) {
+  #define _PRINT_POS(L,V) do{ report_print_P(out, L); report_decimal(out, V); }while(0)
+  LOGICAL_AXIS_CODE(
+    _PRINT_POS(SP_E_LBL, lpos.e),
+    _PRINT_POS(X_LBL, lpos.x),
+    _PRINT_POS(SP_Y_LBL, lpos.y),
+    _PRINT_POS(SP_Z_LBL, lpos.z),
+    _PRINT_POS(SP_I_LBL, lpos.i),
+    _PRINT_POS(SP_J_LBL, lpos.j),
+    _PRINT_POS(SP_K_LBL, lpos.k)
+  );
+  #undef _PRINT_POS
+}
+
 // Report the logical position for a given machine position
 inline void report_logical_position(const xyze_pos_t &rpos) {
-  const xyze_pos_t lpos = rpos.asLogical();
-  SERIAL_ECHOPGM_P(
-    LIST_N(DOUBLE(LINEAR_AXES),
-         X_LBL, lpos.x,
-      SP_Y_LBL, lpos.y,
-      SP_Z_LBL, lpos.z,
-      SP_I_LBL, lpos.i,
-      SP_J_LBL, lpos.j,
-      SP_K_LBL, lpos.k
-    )
-    #if HAS_EXTRUDERS
-      , SP_E_LBL, lpos.e
-    #endif
-  );
+  print_logical_position(SERIAL_IMPL, rpos.asLogical());
 }
 
 // Report the real current position according to the steppers.
@@ -232,6 +237,22 @@ void report_current_position() {
  * definitively interrupts the printing flow.
  */
 void report_current_position_projected() {
+  #if ENABLED(REPORT_CACHE)
+    // Format the report again only when a position has changed
+    static ReportCache report;
+    static xyze_pos_t reported_pos;
+    static xyze_long_t reported_steps;
+    const xyze_pos_t lpos = current_position.asLogical();
+    if (!report.valid || memcmp(&lpos, &reported_pos, sizeof(lpos)) || memcmp(&planner.position, &reported_steps, sizeof(reported_steps))) {
+      reported_pos = lpos;
+      reported_steps = planner.position;
+      report.start();
+      print_logical_position(report, lpos);
+      stepper.report_a_position(report, planner.position);
+      report.finish();
+    }
+    if (report.valid) return report.replay();
+  #endif
   report_logical_position(current_position);
   stepper.report_a_position(planner.position);
 }
@@ -346,14 +367,14 @@ void report_current_position_projected() {
 
   // Return true if the given position is within the machine bounds.
   bool position_is_reachable(const_float_t rx, const_float_t ry) {
-    if (!COORDINATE_OKAY(ry, Y_MIN_POS - fslop, Y_MAX_POS + fslop)) return false;
+    if (!COORDINATE_OKAY(ry, float(Y_MIN_POS) - fslop, float(Y_MAX_POS) + fslop)) return false;
     #if ENABLED(DUAL_X_CARRIAGE)
       if (active_extruder)
-        return COORDINATE_OKAY(rx, X2_MIN_POS - fslop, X2_MAX_POS + fslop);
+        return COORDINATE_OKAY(rx, float(X2_MIN_POS) - fslop, float(X2_MAX_POS) + fslop);
       else
-        return COORDINATE_OKAY(rx, X1_MIN_POS - fslop, X1_MAX_POS + fslop);
+        return COORDINATE_OKAY(rx, float(X1_MIN_POS) - fslop, float(X1_MAX_POS) + fslop);
     #else
-      return COORDINATE_OKAY(rx, X_MIN_POS - fslop, X_MAX_POS + fslop);
+      return COORDINATE_OKAY(rx, float(X_MIN_POS) - fslop, float(X_MAX_POS) + fslop);
     #endif
   }
 
@@ -510,6 +531,8 @@ void _internal_move_to_destination(const_feedRate_t fr_mm_s/*=0.0f*/
   const uint16_t old_pct = feedrate_percentage;
   feedrate_percentage = 100;
 
+  TERN_(INSTANT_FEEDRATE_OVERRIDE, REMEMBER(scaled, planner.override_scaled, false)); // Internal moves keep their speed
+
   #if HAS_EXTRUDERS
     const float old_fac = planner.e_factor[active_extruder];
     planner.e_factor[active_extruder] = 1.0f;
@@ -532,10 +555,10 @@ void _internal_move_to_destination(const_feedRate_t fr_mm_s/*=0.0f*/
  * - If Z is moving up, the Z move is done before XY, etc.
  * - If Z is moving down, the Z move is done after XY, etc.
  * - Delta may lower Z first to get into the free motion zone.
- * - Before returning, wait for the planner buffer to empty.
+ * - Return as soon as the moves are queued, so they can chain with the next.
  */
-void do_blocking_move_to(LINEAR_AXIS_ARGS(const float), const_feedRate_t fr_mm_s/*=0.0f*/) {
-  DEBUG_SECTION(log_move, "do_blocking_move_to", DEBUGGING(LEVELING));
+void plan_move_to(LINEAR_AXIS_ARGS(const float), const_feedRate_t fr_mm_s/*=0.0f*/) {
+  DEBUG_SECTION(log_move, "plan_move_to", DEBUGGING(LEVELING));
   if (DEBUGGING(LEVELING)) DEBUG_XYZ("> ", LINEAR_AXIS_ARGS());
 
   const feedRate_t xy_feedrate = fr_mm_s ?: feedRate_t(XY_PROBE_FEEDRATE_MM_S);
@@ -621,7 +644,16 @@ void do_blocking_move_to(LINEAR_AXIS_ARGS(const float), const_feedRate_t fr_mm_s
     #endif
 
   #endif
+}
+void plan_move_to(const xyz_pos_t &raw, const_feedRate_t fr_mm_s/*=0.0f*/) {
+  plan_move_to(LINEAR_AXIS_ELEM(raw), fr_mm_s);
+}
 
+/**
+ * As plan_move_to, then wait for the planner buffer to empty
+ */
+void do_blocking_move_to(LINEAR_AXIS_ARGS(const float), const_feedRate_t fr_mm_s/*=0.0f*/) {
+  plan_move_to(LINEAR_AXIS_ARGS(), fr_mm_s);
   planner.synchronize();
 }
 
@@ -814,6 +846,19 @@ void restore_feedrate_and_scaling() {
         const float offs = (axis == Z_AXIS) ? 0 : hotend_offset[active_extruder][axis];
         soft_endstop.min[axis] = base_min_pos(axis) + offs;
         soft_endstop.max[axis] = base_max_pos(axis) + offs;
+
+        #if ENABLED(MULTI_NOZZLE_DUPLICATION)
+          // The copies print at the nozzle spacing, so keep the other duplicating nozzles over the bed
+          if (extruder_duplication_enabled && (axis == X_AXIS || axis == Y_AXIS)) {
+            const float bed_min = axis == X_AXIS ? X_MIN_BED : Y_MIN_BED,
+                        bed_max = axis == X_AXIS ? X_MAX_BED : Y_MAX_BED;
+            HOTEND_LOOP() if (e != active_extruder && TEST(duplication_e_mask, e)) {
+              const float d = hotend_offset[e][axis] - offs;
+              NOLESS(soft_endstop.min[axis], bed_min - d);
+              NOMORE(soft_endstop.max[axis], bed_max - d);
+            }
+          }
+        #endif
       }
       else {
         const float diff = hotend_offset[new_tool_index][axis] - hotend_offset[old_tool_index][axis];
@@ -1095,17 +1140,47 @@ FORCE_INLINE void segment_idle(millis_t &next_idle_ms) {
       // Get the raw current position as starting point
       xyze_pos_t raw = current_position;
 
-      // Calculate and execute the segments
-      millis_t next_idle_ms = millis() + 200UL;
-      while (--segments) {
-        segment_idle(next_idle_ms);
-        raw += segment_distance;
-        if (!planner.buffer_line(raw, fr_mm_s, active_extruder, cartesian_segment_mm OPTARG(SCARA_FEEDRATE_SCALING, inv_duration))) break;
-      }
+      #if BOTH(MESH_BED_LEVELING, MESH_ADAPTIVE_SPLIT)
+
+        // Join segments for as long as the mesh stays flat from the start of the joined move
+        xy_pos_t join_start = raw;
+        uint16_t joined = 0;
+
+        millis_t next_idle_ms = millis() + 200UL;
+        while (--segments) {
+          segment_idle(next_idle_ms);
+          const xyze_pos_t next = raw + segment_distance;
+          if (joined && !bedlevel.is_flat_line(join_start, next)) {
+            if (!planner.buffer_line(raw, fr_mm_s, active_extruder, cartesian_segment_mm * joined)) break;
+            join_start = raw;
+            joined = 0;
+          }
+          raw = next;
+          joined++;
+        }
 
-      // Since segment_distance is only approximate,
-      // the final move must be to the exact destination.
-      planner.buffer_line(destination, fr_mm_s, active_extruder, cartesian_segment_mm OPTARG(SCARA_FEEDRATE_SCALING, inv_duration));
+        // The final move must be to the exact destination
+        if (joined && !bedlevel.is_flat_line(join_start, destination)) {
+          planner.buffer_line(raw, fr_mm_s, active_extruder, cartesian_segment_mm * joined);
+          joined = 0;
+        }
+        planner.buffer_line(destination, fr_mm_s, active_extruder, cartesian_segment_mm * (joined + 1));
+
+      #else
+
+        // Calculate and execute the segments
+        millis_t next_idle_ms = millis() + 200UL;
+        while (--segments) {
+          segment_idle(next_idle_ms);
+          raw += segment_distance;
+          if (!planner.buffer_line(raw, fr_mm_s, active_extruder, cartesian_segment_mm OPTARG(SCARA_FEEDRATE_SCALING, inv_duration))) break;
+        }
+
+        // Since segment_distance is only approximate,
+        // the final move must be to the exact destination.
+        planner.buffer_line(destination, fr_mm_s, active_extruder, cartesian_segment_mm OPTARG(SCARA_FEEDRATE_SCALING, inv_duration));
+
+      #endif
     }
 
   #endif // SEGMENT_LEVELED_MOVES && !AUTO_BED_LEVELING_UBL
@@ -1159,6 +1234,15 @@ FORCE_INLINE void segment_idle(millis_t &next_idle_ms) {
   bool extruder_duplication_enabled;
   #if ENABLED(MULTI_NOZZLE_DUPLICATION)
     uint8_t duplication_e_mask; // = 0
+
+    void set_duplication_enabled(const bool dupe) {
+      extruder_duplication_enabled = dupe;
+      #if HAS_SOFTWARE_ENDSTOPS
+        // Narrow or restore the XY range so every duplicating nozzle stays over the bed
+        update_software_endstops(X_AXIS);
+        update_software_endstops(Y_AXIS);
+      #endif
+    }
   #endif
 #endif
 
@@ -1778,6 +1862,15 @@ void prepare_line_to_destination() {
    * before updating the current position.
    */
 
+  #if ENABLED(HOMING_BUMP_SKIP)
+    // Fast vs. slow endstop trigger history of each axis
+    static struct {
+      uint8_t agreed,       // Homings in a row with a matching trigger distance
+              since_check;  // Homings since the last re-bump
+      float diff;           // (mm) Mean distance from the fast trigger to the slow one
+    } bump_history[LINEAR_AXES];
+  #endif
+
   void homeaxis(const AxisEnum axis) {
 
     #if EITHER(MORGAN_SCARA, MP_SCARA)
@@ -1845,6 +1938,13 @@ void prepare_line_to_destination() {
       use_probe_bump ? _MAX(TERN0(HOMING_Z_WITH_PROBE, Z_CLEARANCE_BETWEEN_PROBES), home_bump_mm(axis)) : home_bump_mm(axis)
     );
 
+    #if ENABLED(HOMING_BUMP_SKIP)
+      auto &history = bump_history[axis];
+      const bool skip_bump = bump && !use_probe_bump
+        && history.agreed >= HOMING_BUMP_SKIP_COUNT && history.since_check < (HOMING_BUMP_SKIP_CHECK) - 1;
+      float skip_offset = 0;
+    #endif
+
     //
     // Fast move towards endstop until triggered
     //
@@ -1852,12 +1952,18 @@ void prepare_line_to_destination() {
     if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("Home Fast: ", move_length, "mm");
     do_homing_move(axis, move_length, 0.0, !use_probe_bump);
 
+    #if ENABLED(HOMING_BUMP_SKIP)
+      // Both relative to the start of the fast move
+      const float fast_trigger = stepper.triggered_position(axis) * planner.mm_per_step[axis],
+                  fast_stop = planner.get_axis_position_mm(axis);
+    #endif
+
     #if BOTH(HOMING_Z_WITH_PROBE, BLTOUCH)
       if (axis == Z_AXIS && !bltouch.high_speed_mode) bltouch.stow(); // Intermediate STOW (in LOW SPEED MODE)
     #endif
 
     // If a second homing move is configured...
-    if (bump) {
+    if (bump TERN_(HOMING_BUMP_SKIP, && !skip_bump)) {
       // Move away from the endstop by the axis HOMING_BUMP_MM
       if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("Move Away: ", -bump, "mm");
       do_homing_move(axis, -bump, TERN(HOMING_Z_WITH_PROBE, (axis == Z_AXIS ? z_probe_fast_mm_s : 0), 0), false);
@@ -1900,10 +2006,35 @@ void prepare_line_to_destination() {
       if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("Re-bump: ", rebump, "mm");
       do_homing_move(axis, rebump, get_homing_bump_feedrate(axis), true);
 
+      #if ENABLED(HOMING_BUMP_SKIP)
+        if (!use_probe_bump) {
+          // Distance from the fast trigger to the slow one
+          const float diff = fast_stop - bump + stepper.triggered_position(axis) * planner.mm_per_step[axis] - fast_trigger;
+          if (history.agreed && ABS(diff - history.diff) <= HOMING_BUMP_SKIP_TOLERANCE) {
+            history.diff = (history.diff * history.agreed + diff) / (history.agreed + 1);
+            if (history.agreed < 255) history.agreed++;
+          }
+          else {
+            history.diff = diff;
+            history.agreed = 1;
+          }
+          history.since_check = 0;
+          if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("Bump diff: ", diff, " agreed: ", history.agreed);
+        }
+      #endif
+
       #if BOTH(HOMING_Z_WITH_PROBE, BLTOUCH)
         if (axis == Z_AXIS) bltouch.stow(); // The final STOW
       #endif
     }
+    #if ENABLED(HOMING_BUMP_SKIP)
+      else if (skip_bump) {
+        // Past the slow trigger point by the steps taken after the fast trigger, less the mean difference
+        skip_offset = fast_stop - fast_trigger - history.diff;
+        history.since_check++;
+        if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("Bump skipped: ", skip_offset, "mm");
+      }
+    #endif
 
     #if HAS_EXTRA_ENDSTOPS
       const bool pos_dir = axis_home_dir > 0;
@@ -2068,6 +2199,7 @@ void prepare_line_to_destination() {
     #else // CARTESIAN / CORE / MARKFORGED_XY / MARKFORGED_YX
 
       set_axis_is_at_home(axis);
+      TERN_(HOMING_BUMP_SKIP, current_position[axis] += skip_offset);
       sync_plan_position();
 
       destination[axis] = current_position[axis];
@@ -2175,6 +2307,7 @@ void set_axis_is_at_home(const AxisEnum axis) {
   TERN_(I2C_POSITION_ENCODERS, I2CPEM.homed(axis));
 
   TERN_(BABYSTEP_DISPLAY_TOTAL, babystep.reset_total(axis));
+  TERN_(BABYSTEP_PLANNER, if (axis == Z_AXIS) babystep.reset_planned());
 
   #if HAS_POSITION_SHIFT
     position_shift[axis] = 0;
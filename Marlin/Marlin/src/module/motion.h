@@ -320,6 +320,12 @@ inline void prepare_internal_move_to_destination(const_feedRate_t fr_mm_s=0.0f)
   }
 #endif
 
+/**
+ * Queued movement, returning without waiting for the moves to finish
+ */
+void plan_move_to(LINEAR_AXIS_ARGS(const float), const_feedRate_t fr_mm_s=0.0f);
+void plan_move_to(const xyz_pos_t &raw, const_feedRate_t fr_mm_s=0.0f);
+
 /**
  * Blocking movement and shorthand functions
  */
@@ -563,7 +569,7 @@ void home_if_needed(const bool keeplev=false);
   #if ENABLED(MULTI_NOZZLE_DUPLICATION)
     extern uint8_t duplication_e_mask;
     enum DualXMode : char { DXC_DUPLICATION_MODE = 2 };
-    FORCE_INLINE void set_duplication_enabled(const bool dupe) { extruder_duplication_enabled = dupe; }
+    void set_duplication_enabled(const bool dupe);
   #endif
 
   #define TOOL_X_HOME_DIR(T) X_HOME_DIR
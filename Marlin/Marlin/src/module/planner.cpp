@@ -107,6 +107,34 @@
   #include "../feature/spindle_laser.h"
 #endif
 
+#if ENABLED(PLANNER_FIXED_POINT)
+  #include "../libs/fixed_math.h"
+#endif
+
+#if ENABLED(MOTION_BENCHMARK)
+  #include "../feature/motion_bench.h"
+#endif
+
+#if ENABLED(STREAM_STATISTICS)
+  #include "../gcode/queue.h"
+#endif
+
+#if ENABLED(BABYSTEP_PLANNER)
+  #include "../feature/babystep.h"
+#endif
+
+#if ENABLED(LINE_MERGE)
+  #include "../feature/line_merge.h"
+#endif
+
+#if ENABLED(PATH_BLENDING)
+  #include "../feature/path_blend.h"
+#endif
+
+#if ENABLED(TRACE_EVENTS)
+  #include "../feature/trace_events.h"
+#endif
+
 // Delay for delivery of first block to the stepper ISR, if the queue contains 2 or
 // fewer movements. The delay is measured in milliseconds, and must be less than 250ms
 #define BLOCK_DELAY_FOR_1ST_MOVE 100
@@ -118,7 +146,7 @@ Planner planner;
 /**
  * A ring buffer of moves described in steps
  */
-block_t Planner::block_buffer[BLOCK_BUFFER_SIZE];
+__ccmram block_t Planner::block_buffer[BLOCK_BUFFER_SIZE];
 volatile uint8_t Planner::block_buffer_head,    // Index of the next block to be pushed
                  Planner::block_buffer_nonbusy, // Index of the first non-busy block
                  Planner::block_buffer_planned, // Index of the optimally planned block
@@ -126,6 +154,16 @@ volatile uint8_t Planner::block_buffer_head,    // Index of the next block to be
 uint16_t Planner::cleaning_buffer_counter;      // A counter to disable queuing of blocks
 uint8_t Planner::delay_before_delivering;       // This counter delays delivery of blocks when queue becomes empty to allow the opportunity of merging blocks
 
+#if ENABLED(PLANNER_STAGING)
+  staged_segment_t Planner::staged[PLANNER_STAGING_SIZE];
+  uint8_t Planner::staged_tail, Planner::staged_count;
+  bool Planner::committing; // = false
+#endif
+
+#if ENABLED(BLOCK_EXEC_TABLE)
+  block_exec_table_t Planner::exec_table;       // Trapezoid terms for the Stepper ISR
+#endif
+
 planner_settings_t Planner::settings;           // Initialized by settings.load()
 
 /**
@@ -148,6 +186,15 @@ float Planner::mm_per_step[DISTINCT_AXES];      // (mm) Millimeters per step
   #endif
 #endif
 
+#if ENABLED(MOTION_PROFILES)
+  motion_profile_t Planner::motion_profile[MOTION_PROFILE_COUNT];
+  uint8_t Planner::motion_profile_index; // = 0
+#endif
+
+#if ENABLED(ACCEL_TORQUE_CURVE)
+  uint16_t Planner::accel_torque[XYZ][ACCEL_TORQUE_POINTS];
+#endif
+
 #if HAS_CLASSIC_JERK
   TERN(HAS_LINEAR_E_JERK, xyz_pos_t, xyze_pos_t) Planner::max_jerk;
 #endif
@@ -156,6 +203,10 @@ float Planner::mm_per_step[DISTINCT_AXES];      // (mm) Millimeters per step
   bool Planner::abort_on_endstop_hit = false;
 #endif
 
+#if ENABLED(INSTANT_FEEDRATE_OVERRIDE)
+  bool Planner::override_scaled; // = false
+#endif
+
 #if ENABLED(DISTINCT_E_FACTORS)
   uint8_t Planner::last_extruder = 0;     // Respond to extruder change
 #endif
@@ -179,6 +230,9 @@ float Planner::mm_per_step[DISTINCT_AXES];      // (mm) Millimeters per step
 #if ENABLED(VOLUMETRIC_EXTRUDER_LIMIT)
   float Planner::volumetric_extruder_limit[EXTRUDERS],          // max mm^3/sec the extruder is able to handle
         Planner::volumetric_extruder_feedrate_limit[EXTRUDERS]; // pre calculated extruder feedrate limit based on volumetric_extruder_limit; pre-calculated to reduce computation in the planner
+  #if ENABLED(VOLUMETRIC_FLOW_SMOOTHING)
+    float Planner::flow_average[EXTRUDERS];               // E feedrate averaged over the queued blocks, in mm/s
+  #endif
 #endif
 
 #if HAS_LEVELING
@@ -197,6 +251,15 @@ float Planner::mm_per_step[DISTINCT_AXES];      // (mm) Millimeters per step
 
 skew_factor_t Planner::skew_factor; // Initialized by settings.load()
 
+#if HAS_TAIL_FAN_SPEED
+  uint8_t Planner::tail_fan_speed[FAN_COUNT] = ARRAY_N_1(FAN_COUNT, 13);
+#endif
+
+#if ENABLED(FUSED_POSITION_TRANSFORM)
+  affine_transform_t Planner::position_xform[1 + ENABLED(ABL_PLANAR)], Planner::position_unxform[1 + ENABLED(ABL_PLANAR)];
+  xyz_pos_t Planner::xform_min, Planner::xform_max;
+#endif
+
 #if ENABLED(AUTOTEMP)
   celsius_t Planner::autotemp_max = 250,
             Planner::autotemp_min = 210;
@@ -235,7 +298,7 @@ float Planner::previous_nominal_speed_sqr;
   xyze_pos_t Planner::position_cart;
 #endif
 
-#if HAS_WIRED_LCD
+#if HAS_BLOCK_RUNTIME
   volatile uint32_t Planner::block_buffer_runtime_us = 0;
 #endif
 
@@ -252,12 +315,34 @@ void Planner::init() {
   previous_speed.reset();
   previous_nominal_speed_sqr = 0;
   TERN_(ABL_PLANAR, bed_level_matrix.set_to_identity());
+  TERN_(FUSED_POSITION_TRANSFORM, refresh_position_transform());
   clear_block_buffer();
   delay_before_delivering = 0;
   #if ENABLED(DIRECT_STEPPING)
     last_page_step_rate = 0;
     last_page_dir.reset();
   #endif
+  #if ENABLED(MOTION_PROFILES)
+    #if HAS_JUNCTION_DEVIATION
+      constexpr float profile_jd[] = MOTION_PROFILE_JD;
+      static_assert(COUNT(profile_jd) == MOTION_PROFILE_COUNT, "MOTION_PROFILE_JD must have one value per MOTION_PROFILE_ACCEL.");
+    #endif
+    LOOP_L_N(p, MOTION_PROFILE_COUNT) {
+      motion_profile[p].acceleration = motion_profile_accel[p];
+      TERN_(HAS_JUNCTION_DEVIATION, motion_profile[p].junction_deviation_mm = profile_jd[p]);
+    }
+    motion_profile_index = 0;
+  #endif
+  #if ENABLED(ACCEL_TORQUE_CURVE)
+    constexpr uint16_t torque_x[] = ACCEL_TORQUE_X, torque_y[] = ACCEL_TORQUE_Y, torque_z[] = ACCEL_TORQUE_Z;
+    static_assert(COUNT(torque_x) == ACCEL_TORQUE_POINTS && COUNT(torque_y) == ACCEL_TORQUE_POINTS && COUNT(torque_z) == ACCEL_TORQUE_POINTS,
+      "ACCEL_TORQUE_X, ACCEL_TORQUE_Y, and ACCEL_TORQUE_Z must have one value per ACCEL_TORQUE_SPEEDS.");
+    LOOP_L_N(i, ACCEL_TORQUE_POINTS) {
+      accel_torque[X_AXIS][i] = torque_x[i];
+      accel_torque[Y_AXIS][i] = torque_y[i];
+      accel_torque[Z_AXIS][i] = torque_z[i];
+    }
+  #endif
 }
 
 #if ENABLED(S_CURVE_ACCELERATION)
@@ -745,9 +830,10 @@ block_t* Planner::get_current_block() {
 
     // No trapezoid calculated? Don't execute yet.
     if (block->flag.recalculate) return nullptr;
+    BLOCK_ACQUIRE(); // See the block as it was published
 
     // We can't be sure how long an active block will take, so don't count it.
-    TERN_(HAS_WIRED_LCD, block_buffer_runtime_us -= block->segment_time_us);
+    TERN_(HAS_BLOCK_RUNTIME, block_buffer_runtime_us -= block->segment_time_us);
 
     // As this block is busy, advance the nonbusy block pointer
     block_buffer_nonbusy = next_block_index(block_buffer_tail);
@@ -761,22 +847,15 @@ block_t* Planner::get_current_block() {
   }
 
   // The queue became empty
-  TERN_(HAS_WIRED_LCD, clear_block_buffer_runtime()); // paranoia. Buffer is empty now - so reset accumulated time to zero.
+  TERN_(HAS_BLOCK_RUNTIME, clear_block_buffer_runtime()); // paranoia. Buffer is empty now - so reset accumulated time to zero.
 
   return nullptr;
 }
 
 /**
- * Calculate trapezoid parameters, multiplying the entry- and exit-speeds
- * by the provided factors.
- **
- * ############ VERY IMPORTANT ############
- * NOTE that the PRECONDITION to call this function is that the block is
- * NOT BUSY and it is marked as RECALCULATE. That WARRANTIES the Stepper ISR
- * is not and will not use the block while we modify it, so it is safe to
- * alter its values.
+ * Calculate the trapezoid of a block in float math
  */
-void Planner::calculate_trapezoid_for_block(block_t * const block, const_float_t entry_factor, const_float_t exit_factor) {
+void Planner::trapezoid_float(trapezoid_t &t, const block_t * const block, const_float_t entry_factor, const_float_t exit_factor) {
 
   uint32_t initial_rate = CEIL(block->nominal_rate * entry_factor),
            final_rate = CEIL(block->nominal_rate * exit_factor); // (steps per second)
@@ -817,13 +896,161 @@ void Planner::calculate_trapezoid_for_block(block_t * const block, const_float_t
       cruise_rate = block->nominal_rate;
   #endif
 
+  t.initial_rate = initial_rate;
+  t.final_rate = final_rate;
+  t.accelerate_steps = accelerate_steps;
+  t.decelerate_steps = decelerate_steps;
   #if ENABLED(S_CURVE_ACCELERATION)
+    t.cruise_rate = cruise_rate;
     // Jerk controlled speed requires to express speed versus time, NOT steps
-    uint32_t acceleration_time = ((float)(cruise_rate - initial_rate) / accel) * (STEPPER_TIMER_RATE),
-             deceleration_time = ((float)(cruise_rate - final_rate) / accel) * (STEPPER_TIMER_RATE),
+    t.acceleration_time = ((float)(cruise_rate - initial_rate) / accel) * (STEPPER_TIMER_RATE);
+    t.deceleration_time = ((float)(cruise_rate - final_rate) / accel) * (STEPPER_TIMER_RATE);
+  #endif
+}
+
+#if ENABLED(PLANNER_FIXED_POINT)
+
+  /**
+   * The same trapezoid in integer math. Rates and accelerations are whole steps,
+   * so the ramp lengths are exact quotients of 64-bit products instead of float
+   * divisions. The entry and exit factors are taken as Q16.16.
+   */
+  void Planner::trapezoid_fixed(trapezoid_t &t, const block_t * const block, const_float_t entry_factor, const_float_t exit_factor) {
+    const uint32_t nominal_rate = block->nominal_rate,
+                   step_event_count = block->step_event_count,
+                   accel = block->acceleration_steps_per_s2,
+                   two_a = accel * 2;
+
+    // Round the rates up, like CEIL in the float path (steps per second)
+    uint32_t initial_rate = (uint64_t(nominal_rate) * uint32_t(entry_factor * 65536.0f) + 0xFFFF) >> 16,
+             final_rate = (uint64_t(nominal_rate) * uint32_t(exit_factor * 65536.0f) + 0xFFFF) >> 16;
+
+    // Limit minimal step rate (Otherwise the timer will overflow.)
+    NOLESS(initial_rate, uint32_t(MINIMAL_STEP_RATE));
+    NOLESS(final_rate, uint32_t(MINIMAL_STEP_RATE));
+
+    uint32_t accelerate_steps = ramp_steps(initial_rate, nominal_rate, two_a, true),
+             decelerate_steps = ramp_steps(final_rate, nominal_rate, two_a, false);
+
+    #if ENABLED(S_CURVE_ACCELERATION)
+      uint32_t cruise_rate = nominal_rate;
+    #endif
+
+    // No plateau? Brake at the intersection of the two ramps: (2a * n - vi^2 + vf^2) / 4a
+    if (accelerate_steps + decelerate_steps > step_event_count) {
+      const int64_t num = int64_t(two_a) * step_event_count - sq(int64_t(initial_rate)) + sq(int64_t(final_rate));
+      accelerate_steps = (num > 0 && accel) ? _MIN(udiv_64_32(num + two_a * 2 - 1, two_a * 2), step_event_count) : 0;
+      decelerate_steps = step_event_count - accelerate_steps;
+
+      #if ENABLED(S_CURVE_ACCELERATION)
+        // We won't reach the cruising rate. Let's calculate the speed we will reach
+        cruise_rate = fast_sqrt(float(sq(uint64_t(initial_rate)) + uint64_t(two_a) * accelerate_steps));
+      #endif
+    }
+
+    t.initial_rate = initial_rate;
+    t.final_rate = final_rate;
+    t.accelerate_steps = accelerate_steps;
+    t.decelerate_steps = decelerate_steps;
+    #if ENABLED(S_CURVE_ACCELERATION)
+      t.cruise_rate = cruise_rate;
+      // Ramp times in Stepper timer ticks
+      t.acceleration_time = accel ? udiv_64_32(uint64_t(cruise_rate - initial_rate) * (STEPPER_TIMER_RATE), accel) : 0;
+      t.deceleration_time = accel ? udiv_64_32(uint64_t(cruise_rate - final_rate) * (STEPPER_TIMER_RATE), accel) : 0;
+    #endif
+  }
+
+  #if ENABLED(MARLIN_DEV_MODE)
+
+    /**
+     * Time the per-block planner math of both paths on the same pseudo-random blocks:
+     * nominal and entry/exit speeds as in recalculate_trapezoids() plus the trapezoid.
+     * Report blocks per second for each path and the largest difference in ramp steps.
+     */
+    void Planner::bench_math(const uint32_t count) {
+      block_t b{0};
+      uint32_t seed;
+      auto rnd = [&](const uint32_t lo, const uint32_t hi) {
+        seed = seed * 1103515245UL + 12345UL;
+        return lo + (seed >> 8) % (hi - lo);
+      };
+
+      // Plan one random block with either path
+      auto plan = [&](trapezoid_t &t, const bool fixed) {
+        b.nominal_rate = rnd(1000, 50000);
+        b.acceleration_steps_per_s2 = rnd(1000, 100000);
+        b.step_event_count = rnd(10, 5000);
+        const float nominal_speed_sqr = sq(b.nominal_rate * 0.0125f),
+                    entry_speed_sqr = nominal_speed_sqr * rnd(1, 100) * 0.01f,
+                    exit_speed_sqr = nominal_speed_sqr * rnd(1, 100) * 0.01f;
+        if (fixed) {
+          const float nomr = fast_rsqrt(nominal_speed_sqr);
+          trapezoid_fixed(t, &b, fast_sqrt(entry_speed_sqr) * nomr, fast_sqrt(exit_speed_sqr) * nomr);
+        }
+        else {
+          const float nomr = 1.0f / SQRT(nominal_speed_sqr);
+          trapezoid_float(t, &b, SQRT(entry_speed_sqr) * nomr, SQRT(exit_speed_sqr) * nomr);
+        }
+      };
+
+      auto run = [&](const bool fixed) {
+        trapezoid_t t;
+        volatile uint32_t sink = 0;
+        seed = 1;
+        const millis_t start = millis();
+        LOOP_L_N(i, count) { plan(t, fixed); sink += t.accelerate_steps; }
+        const millis_t ms = _MAX(millis() - start, 1UL);
+        UNUSED(sink);
+        return uint32_t(uint64_t(count) * 1000UL / ms);
+      };
+
+      const uint32_t float_rate = run(false), fixed_rate = run(true);
+
+      uint32_t max_diff = 0;
+      LOOP_L_N(i, count) {
+        trapezoid_t tf, tx;
+        const uint32_t s = seed;
+        plan(tf, false);
+        seed = s;
+        plan(tx, true);
+        NOLESS(max_diff, uint32_t(ABS(int32_t(tf.accelerate_steps - tx.accelerate_steps))));
+        NOLESS(max_diff, uint32_t(ABS(int32_t(tf.decelerate_steps - tx.decelerate_steps))));
+      }
+
+      SERIAL_ECHOLNPGM("Float path: ", float_rate, " blocks/s");
+      SERIAL_ECHOLNPGM("Fixed path: ", fixed_rate, " blocks/s");
+      SERIAL_ECHOLNPGM("Max ramp difference: ", max_diff, " steps");
+    }
+
+  #endif // MARLIN_DEV_MODE
+
+#endif // PLANNER_FIXED_POINT
+
+/**
+ * Calculate trapezoid parameters, multiplying the entry- and exit-speeds
+ * by the provided factors.
+ **
+ * ############ VERY IMPORTANT ############
+ * NOTE that the PRECONDITION to call this function is that the block is
+ * NOT BUSY and it is marked as RECALCULATE. That WARRANTIES the Stepper ISR
+ * is not and will not use the block while we modify it, so it is safe to
+ * alter its values.
+ */
+void Planner::calculate_trapezoid_for_block(block_t * const block, const_float_t entry_factor, const_float_t exit_factor) {
+
+  trapezoid_t t;
+  TERN(PLANNER_FIXED_POINT, trapezoid_fixed, trapezoid_float)(t, block, entry_factor, exit_factor);
+
+  const uint32_t initial_rate = t.initial_rate, final_rate = t.final_rate,
+                 accelerate_steps = t.accelerate_steps, decelerate_steps = t.decelerate_steps;
+
+  #if ENABLED(S_CURVE_ACCELERATION)
+    const uint32_t cruise_rate = t.cruise_rate,
+                   acceleration_time = t.acceleration_time,
+                   deceleration_time = t.deceleration_time,
     // And to offload calculations from the ISR, we also calculate the inverse of those times here
-             acceleration_time_inverse = get_period_inverse(acceleration_time),
-             deceleration_time_inverse = get_period_inverse(deceleration_time);
+                   acceleration_time_inverse = get_period_inverse(acceleration_time),
+                   deceleration_time_inverse = get_period_inverse(deceleration_time);
   #endif
 
   // Store new block parameters
@@ -839,6 +1066,33 @@ void Planner::calculate_trapezoid_for_block(block_t * const block, const_float_t
   #endif
   block->final_rate = final_rate;
 
+  #if ENABLED(BLOCK_EXEC_TABLE)
+    // Publish the finalized trapezoid for the Stepper ISR
+    const uint8_t ei = block - block_buffer;
+    exec_table.accelerate_until[ei] = accelerate_steps;
+    exec_table.decelerate_after[ei] = block->step_event_count - decelerate_steps;
+    exec_table.initial_rate[ei] = initial_rate;
+    exec_table.nominal_rate[ei] = block->nominal_rate;
+    exec_table.final_rate[ei] = final_rate;
+    #if ENABLED(S_CURVE_ACCELERATION)
+      exec_table.cruise_rate[ei] = cruise_rate;
+      exec_table.acceleration_time[ei] = acceleration_time;
+      exec_table.deceleration_time[ei] = deceleration_time;
+      // Same coefficients as Stepper::_calc_bezier_curve_coeffs for 32-bit CPUs
+      auto store_bezier = [&](const uint8_t r, const int32_t v0, const int32_t v1, const uint32_t av) {
+        exec_table.bezier_A[r][ei] =  768 * (v1 - v0);
+        exec_table.bezier_B[r][ei] = 1920 * (v0 - v1);
+        exec_table.bezier_C[r][ei] = 1280 * (v1 - v0);
+        exec_table.bezier_F[r][ei] =  128 * v0;
+        exec_table.bezier_AV[r][ei] = av;
+      };
+      store_bezier(0, initial_rate, cruise_rate, acceleration_time_inverse);
+      store_bezier(1, cruise_rate, final_rate, deceleration_time_inverse);
+    #else
+      exec_table.acceleration_rate[ei] = block->acceleration_rate;
+    #endif
+  #endif
+
   #if ENABLED(LASER_POWER_TRAP)
     /**
      * Laser Trapezoid Calculations
@@ -978,6 +1232,7 @@ void Planner::reverse_pass_kernel(block_t * const current, const block_t * const
         // Need to recalculate the block speed - Mark it now, so the stepper
         // ISR does not consume the block before being recalculated
         current->flag.recalculate = true;
+        BLOCK_FENCE(); // Mark before checking
 
         // But there is an inherent race condition here, as the block may have
         // become BUSY just before being marked RECALCULATE, so check for that!
@@ -1064,6 +1319,7 @@ void Planner::forward_pass_kernel(const block_t * const previous, block_t * cons
         // Mark we need to recompute the trapezoidal shape, and do it now,
         // so the stepper ISR does not consume the block before being recalculated
         current->flag.recalculate = true;
+        BLOCK_FENCE(); // Mark before checking
 
         // But there is an inherent race condition here, as the block maybe
         // became BUSY, just before it was marked as RECALCULATE, so check
@@ -1137,10 +1393,13 @@ void Planner::forward_pass() {
  * Recalculate the trapezoid speed profiles for all blocks in the plan
  * according to the entry_factor for each junction. Must be called by
  * recalculate() after updating the blocks.
+ *
+ * The scan begins at start_index, which may be any block from the tail
+ * up to the block preceding the first block that may have been changed.
  */
-void Planner::recalculate_trapezoids() {
-  // The tail may be changed by the ISR so get a local copy.
-  uint8_t block_index = block_buffer_tail,
+void Planner::recalculate_trapezoids(const uint8_t start_index) {
+  // The tail may be changed by the ISR so the caller passes a local copy.
+  uint8_t block_index = start_index,
           head_block_index = block_buffer_head;
   // Since there could be a sync block in the head of the queue, and the
   // next loop must not recalculate the head block (as it needs to be
@@ -1169,12 +1428,12 @@ void Planner::recalculate_trapezoids() {
 
     // Only process movement blocks
     if (next->is_move()) {
-      next_entry_speed = SQRT(next->entry_speed_sqr);
+      next_entry_speed = TERN(PLANNER_FIXED_POINT, fast_sqrt, SQRT)(next->entry_speed_sqr);
 
       if (block) {
 
         // If the next block is marked to RECALCULATE, also mark the previously-fetched one
-        if (next->flag.recalculate) block->flag.recalculate = true;
+        if (next->flag.recalculate && !TERN0(HOST_BLOCK_STREAM, block->flag.host_planned)) { block->flag.recalculate = true; BLOCK_FENCE(); }
 
         // Recalculate if current block entry or exit junction speed has changed.
         if (block->flag.recalculate) {
@@ -1186,10 +1445,15 @@ void Planner::recalculate_trapezoids() {
             // Block is not BUSY, we won the race against the Stepper ISR:
 
             // NOTE: Entry and exit factors always > 0 by all previous logic operations.
-            const float current_nominal_speed = SQRT(block->nominal_speed_sqr),
-                        nomr = 1.0f / current_nominal_speed;
+            #if ENABLED(PLANNER_FIXED_POINT)
+              const float nomr = fast_rsqrt(block->nominal_speed_sqr),
+                          current_nominal_speed = block->nominal_speed_sqr * nomr;
+            #else
+              const float current_nominal_speed = SQRT(block->nominal_speed_sqr),
+                          nomr = 1.0f / current_nominal_speed;
+            #endif
             calculate_trapezoid_for_block(block, current_entry_speed * nomr, next_entry_speed * nomr);
-            #if ENABLED(LIN_ADVANCE)
+            #if HAS_ADVANCE_ISR
               if (block->use_advance_lead) {
                 const float comp = block->e_D_ratio * extruder_advance_K[active_extruder] * settings.axis_steps_per_mm[E_AXIS];
                 block->max_adv_steps = current_nominal_speed * comp;
@@ -1200,6 +1464,7 @@ void Planner::recalculate_trapezoids() {
 
           // Reset current only to ensure next trapezoid is computed - The
           // stepper is free to use the block from now on.
+          BLOCK_RELEASE();
           block->flag.recalculate = false;
         }
       }
@@ -1218,6 +1483,7 @@ void Planner::recalculate_trapezoids() {
     // As the last block is always recalculated here, there is a chance the block isn't
     // marked as RECALCULATE yet. That's the reason for the following line.
     block->flag.recalculate = true;
+    BLOCK_FENCE(); // Mark before checking
 
     // But there is an inherent race condition here, as the block maybe
     // became BUSY, just before it was marked as RECALCULATE, so check
@@ -1225,10 +1491,15 @@ void Planner::recalculate_trapezoids() {
     if (!stepper.is_block_busy(block)) {
       // Block is not BUSY, we won the race against the Stepper ISR:
 
-      const float next_nominal_speed = SQRT(next->nominal_speed_sqr),
-                  nomr = 1.0f / next_nominal_speed;
+      #if ENABLED(PLANNER_FIXED_POINT)
+        const float nomr = fast_rsqrt(next->nominal_speed_sqr),
+                    next_nominal_speed = next->nominal_speed_sqr * nomr;
+      #else
+        const float next_nominal_speed = SQRT(next->nominal_speed_sqr),
+                    nomr = 1.0f / next_nominal_speed;
+      #endif
       calculate_trapezoid_for_block(next, next_entry_speed * nomr, float(MINIMUM_PLANNER_SPEED) * nomr);
-      #if ENABLED(LIN_ADVANCE)
+      #if HAS_ADVANCE_ISR
         if (next->use_advance_lead) {
           const float comp = next->e_D_ratio * extruder_advance_K[active_extruder] * settings.axis_steps_per_mm[E_AXIS];
           next->max_adv_steps = next_nominal_speed * comp;
@@ -1239,11 +1510,23 @@ void Planner::recalculate_trapezoids() {
 
     // Reset next only to ensure its trapezoid is computed - The stepper is free to use
     // the block from now on.
+    BLOCK_RELEASE();
     next->flag.recalculate = false;
   }
 }
 
 void Planner::recalculate() {
+  #if ENABLED(PLANNER_DEEP_LOOKAHEAD)
+    // Blocks before the optimally planned block can't change, and neither can
+    // the exit speed of the block just before it. With a deep buffer, start the
+    // trapezoid pass there instead of at the tail to keep the cost per block O(1).
+    // The ISR may advance the planned block, which only causes a little extra work.
+    uint8_t trapezoid_index = block_buffer_planned;
+    if (trapezoid_index != block_buffer_tail) trapezoid_index = prev_block_index(trapezoid_index);
+  #else
+    const uint8_t trapezoid_index = block_buffer_tail;
+  #endif
+
   // Initialize block index to the last block in the planner buffer.
   const uint8_t block_index = prev_block_index(block_buffer_head);
   // If there is just one block, no planning can be done. Avoid it!
@@ -1251,9 +1534,126 @@ void Planner::recalculate() {
     reverse_pass();
     forward_pass();
   }
-  recalculate_trapezoids();
+  recalculate_trapezoids(trapezoid_index);
 }
 
+#if ENABLED(ACCEL_TORQUE_CURVE)
+
+  /**
+   * The part of an axis max acceleration its motor can give at a speed,
+   * interpolated from the torque curve by the percent of the max feedrate.
+   */
+  float Planner::accel_torque_factor(const AxisEnum axis, const_float_t speed) {
+    const float pct = speed * 100.0f / settings.max_feedrate_mm_s[axis];
+    uint8_t i = 1;
+    while (i < ACCEL_TORQUE_POINTS - 1 && pct > accel_torque_speed[i]) i++;
+    const uint16_t lo = accel_torque[axis][i - 1], hi = accel_torque[axis][i];
+    const float t = constrain((pct - accel_torque_speed[i - 1]) / (accel_torque_speed[i] - accel_torque_speed[i - 1]), 0.0f, 1.0f);
+    return (lo + t * (int16_t(hi - lo))) * 0.01f;
+  }
+
+  /**
+   * Limit a block acceleration (in step_events/s^2) by what each X, Y, Z motor
+   * can give at the speed of its own steps when the block cruises at 'speed'.
+   * Slower parts of the block ask no more, since the torque only rises there.
+   */
+  uint32_t Planner::torque_limit_accel(const block_t * const block, const_float_t speed, uint32_t accel) {
+    const float per_s = speed / block->millimeters;     // Block lengths per second
+    LOOP_L_N(a, XYZ) {
+      const uint32_t axis_steps = block->steps[a];
+      if (!axis_steps) continue;
+      const float axis_speed = axis_steps * per_s * mm_per_step[a],
+                  max_possible = float(max_acceleration_steps_per_s2[a]) * accel_torque_factor(AxisEnum(a), axis_speed)
+                               * float(block->step_event_count) / float(axis_steps);
+      NOMORE(accel, max_possible);
+    }
+    return accel;
+  }
+
+#endif // ACCEL_TORQUE_CURVE
+
+#if ENABLED(INSTANT_FEEDRATE_OVERRIDE)
+
+  /**
+   * Apply a new feedrate_percentage to the blocks already in the buffer.
+   * Called from idle(), which never runs while a block is being populated.
+   *
+   * The first non-busy block may be picked up by the Stepper ISR at any
+   * moment, so it keeps its timing and becomes the optimally planned block.
+   * Every later block taken from G-code gets the nominal speed of the new
+   * percentage, up to its axis limits, and is marked RECALCULATE so the
+   * reverse and forward passes plan from there and redo its trapezoid.
+   */
+  void Planner::apply_feedrate_override() {
+    static int16_t applied_percentage = 100;
+    if (feedrate_percentage == applied_percentage) return;
+    applied_percentage = feedrate_percentage;
+
+    // Move the optimal plan pointer back to the first non-busy block
+    const bool was_enabled = stepper.suspend();
+    const uint8_t first_index = block_buffer_nonbusy;
+    block_buffer_planned = first_index;
+    if (was_enabled) stepper.wake_up();
+
+    if (first_index == block_buffer_head) return;
+
+    const float scale_sqr = sq(applied_percentage * 0.01f);
+    block_t * const first = &block_buffer[first_index];
+    float prev_nominal_speed_sqr = first->is_move() ? first->nominal_speed_sqr : 0;
+    bool changed = false;
+
+    for (uint8_t b = next_block_index(first_index); b != block_buffer_head; b = next_block_index(b)) {
+      block_t * const block = &block_buffer[b];
+      if (!block->is_move()) continue;
+
+      if (block->override_speed_sqr) {
+        // Mark the block first, so the Stepper ISR doesn't run a block being changed
+        block->flag.recalculate = true;
+        BLOCK_FENCE(); // Mark before checking
+
+        if (stepper.is_block_busy(block))
+          block->flag.recalculate = false;
+        else {
+          const float nominal_speed_sqr = _MIN(block->override_speed_sqr * scale_sqr, block->max_nominal_speed_sqr);
+          block->nominal_speed_sqr = nominal_speed_sqr;
+          block->nominal_rate = CEIL(block->step_event_count * SQRT(nominal_speed_sqr) / block->millimeters);
+          #if ENABLED(ACCEL_TORQUE_CURVE)
+            // Take the acceleration the motors have at the new speed
+            if (block->torque_accel_cap) {
+              const uint32_t old_accel = block->acceleration_steps_per_s2,
+                             accel = torque_limit_accel(block, SQRT(nominal_speed_sqr), block->torque_accel_cap);
+              block->acceleration_steps_per_s2 = accel;
+              block->acceleration = accel * block->millimeters / block->step_event_count;
+              #if DISABLED(S_CURVE_ACCELERATION)
+                block->acceleration_rate = (uint32_t)(accel * (float(1UL << 24) / (STEPPER_TIMER_RATE)));
+              #endif
+              #if ENABLED(LIN_ADVANCE) && DISABLED(LIN_ADVANCE_INTEGRATED)
+                if (block->use_advance_lead) block->advance_speed = _MIN(uint64_t(block->advance_speed) * old_accel / accel, uint64_t(UINT16_MAX));
+              #else
+                UNUSED(old_accel);
+              #endif
+            }
+          #endif
+          if (block->max_junction_speed_sqr)
+            block->max_entry_speed_sqr = _MIN(block->max_junction_speed_sqr, nominal_speed_sqr, prev_nominal_speed_sqr);
+          const float v_allowable_sqr = max_allowable_speed_sqr(-block->acceleration, sq(float(MINIMUM_PLANNER_SPEED)), block->millimeters);
+          block->flag.set_nominal(nominal_speed_sqr <= v_allowable_sqr);
+          changed = true;
+        }
+      }
+      prev_nominal_speed_sqr = block->nominal_speed_sqr;
+    }
+
+    if (!changed) return;
+
+    // The next block joins the last one at its new speed
+    if (previous_nominal_speed_sqr) previous_nominal_speed_sqr = prev_nominal_speed_sqr;
+
+    recalculate();
+  }
+
+#endif // INSTANT_FEEDRATE_OVERRIDE
+
 /**
  * Apply fan speeds
  */
@@ -1314,9 +1714,7 @@ void Planner::check_axes_activity() {
     xyze_bool_t axis_active = { false };
   #endif
 
-  #if HAS_FAN && DISABLED(LASER_SYNCHRONOUS_M106_M107)
-    #define HAS_TAIL_FAN_SPEED 1
-    static uint8_t tail_fan_speed[FAN_COUNT] = ARRAY_N_1(FAN_COUNT, 13);
+  #if HAS_TAIL_FAN_SPEED
     bool fans_need_update = false;
   #endif
 
@@ -1471,13 +1869,39 @@ void Planner::check_axes_activity() {
 
     float t = autotemp_min + high * autotemp_factor;
     LIMIT(t, autotemp_min, autotemp_max);
-    if (t < oldt) t = t * (1.0f - (AUTOTEMP_OLDWEIGHT)) + oldt * (AUTOTEMP_OLDWEIGHT);
+    if (t < oldt) t = t * (1.0f - float(AUTOTEMP_OLDWEIGHT)) + oldt * float(AUTOTEMP_OLDWEIGHT);
     oldt = t;
     thermalManager.setTargetHotend(t, active_extruder);
   }
 
 #endif
 
+#if ENABLED(MPC_FEEDFORWARD)
+
+  /**
+   * Filament speed (mm/s) of the active extruder over the next 'window'
+   * seconds of queued moves, for MPC to heat ahead of a change in flow.
+   * Moves are timed at their nominal speed and retracts add no filament.
+   * The stepper ISR only advances the tail, so this is safe to call from
+   * the main loop, which is the only place blocks are added.
+   */
+  float Planner::e_speed_ahead(const_float_t window) {
+    float time = 0.0f, e_mm = 0.0f;
+    for (uint8_t b = block_buffer_tail; b != block_buffer_head && time < window; b = next_block_index(b)) {
+      block_t * const block = &block_buffer[b];
+      if (!block->is_move()) continue;
+      float t = block->millimeters / SQRT(block->nominal_speed_sqr);
+      float frac = 1.0f;
+      if (time + t > window) { frac = (window - time) / t; t = window - time; }
+      time += t;
+      if (block->extruder == active_extruder && !TEST(block->direction_bits, E_AXIS))
+        e_mm += block->steps.e * frac * mm_per_step[E_AXIS_N(block->extruder)];
+    }
+    return time > 0.0f ? e_mm / time : 0.0f;
+  }
+
+#endif
+
 #if DISABLED(NO_VOLUMETRICS)
 
   /**
@@ -1574,6 +1998,13 @@ void Planner::check_axes_activity() {
     TERN(Z_SAFE_HOMING, Z_SAFE_HOMING_Y_POINT, Y_HOME_POS)
   };
 
+  // The mesh correction, from the fixed-point raster with MESH_Z_RASTER
+  #if ENABLED(MESH_Z_RASTER)
+    #define PLANNER_Z_CORRECTION(P) bedlevel.get_z_raster(P)
+  #else
+    #define PLANNER_Z_CORRECTION(P) bedlevel.get_z_correction(P)
+  #endif
+
   /**
    * rx, ry, rz - Cartesian positions in mm
    *              Leveled XYZ on completion
@@ -1591,9 +2022,9 @@ void Planner::check_axes_activity() {
 
       #if ENABLED(ENABLE_LEVELING_FADE_HEIGHT)
         const float fade_scaling_factor = fade_scaling_factor_for_z(raw.z);
-        if (fade_scaling_factor) raw.z += fade_scaling_factor * bedlevel.get_z_correction(raw);
+        if (fade_scaling_factor) raw.z += fade_scaling_factor * PLANNER_Z_CORRECTION(raw);
       #else
-        raw.z += bedlevel.get_z_correction(raw);
+        raw.z += PLANNER_Z_CORRECTION(raw);
       #endif
 
       TERN_(MESH_BED_LEVELING, raw.z += bedlevel.get_z_offset());
@@ -1614,7 +2045,7 @@ void Planner::check_axes_activity() {
 
     #elif HAS_MESH
 
-      const float z_correction = bedlevel.get_z_correction(raw),
+      const float z_correction = PLANNER_Z_CORRECTION(raw),
                   z_full_fade = DIFF_TERN(MESH_BED_LEVELING, raw.z, bedlevel.get_z_offset()),
                   z_no_fade = z_full_fade - z_correction;
 
@@ -1650,6 +2081,64 @@ void Planner::check_axes_activity() {
 
 #endif
 
+#if ENABLED(FUSED_POSITION_TRANSFORM)
+
+  // The map that applies b, then a
+  static affine_transform_t affine_product(const affine_transform_t &a, const affine_transform_t &b) {
+    affine_transform_t r;
+    LOOP_L_N(i, 3) {
+      LOOP_L_N(j, 3) r.row[i][j] = a.row[i].x * b.row[0][j] + a.row[i].y * b.row[1][j] + a.row[i].z * b.row[2][j];
+      r.offset[i] = a.row[i].x * b.offset.x + a.row[i].y * b.offset.y + a.row[i].z * b.offset.z + a.offset[i];
+    }
+    return r;
+  }
+
+  /**
+   * Combine skew and planar leveling into a single map each way.
+   * Call whenever the skew factors or the bed level matrix change.
+   */
+  void Planner::refresh_position_transform() {
+    const float xy = skew_factor.xy, xz = skew_factor.xz, yz = skew_factor.yz,
+                k = xz - xy * yz;
+
+    affine_transform_t &skew = position_xform[0], &unskew = position_unxform[0];
+    skew.row[0].set(1, -xy, -k);  skew.row[1].set(0, 1, -yz);  skew.row[2].set(0, 0, 1);  skew.offset.reset();
+    unskew.row[0].set(1, xy, xz); unskew.row[1].set(0, 1, yz); unskew.row[2].set(0, 0, 1); unskew.offset.reset();
+
+    #if ABL_PLANAR
+      // Rotate about the fulcrum: R·(p - F) + F, and back with the transpose
+      affine_transform_t tilt, untilt;
+      LOOP_L_N(i, 3) LOOP_L_N(j, 3) {
+        tilt.row[i][j] = bed_level_matrix.vectors[j][i];
+        untilt.row[i][j] = bed_level_matrix.vectors[i][j];
+      }
+      LOOP_L_N(i, 3) {
+        tilt.offset[i]   = (i < 2 ? level_fulcrum[i] : 0) - tilt.row[i].x * level_fulcrum.x - tilt.row[i].y * level_fulcrum.y;
+        untilt.offset[i] = (i < 2 ? level_fulcrum[i] : 0) - untilt.row[i].x * level_fulcrum.x - untilt.row[i].y * level_fulcrum.y;
+      }
+      position_xform[1] = affine_product(tilt, skew);
+      position_unxform[1] = affine_product(unskew, untilt);
+    #endif
+
+    #if ENABLED(SKEW_CORRECTION)
+      // In this box skew's range checks all pass: its input is in range and the
+      // largest shift it makes can't carry the output out of range.
+      constexpr float ymax = _MAX(ABS(Y_MIN_POS), ABS(Y_MAX_POS)), zmax = _MAX(ABS(Z_MIN_POS), ABS(Z_MAX_POS));
+      const float mx = ABS(xy) * ymax + ABS(k) * zmax + 0.001f,
+                  my = ABS(yz) * zmax + 0.001f;
+      #if HAS_ENDSTOPS
+        xform_min.set(X_MIN_POS + 1 + mx, Y_MIN_POS + 1 + my, Z_MIN_POS);
+        xform_max.set(X_MAX_POS - mx, Y_MAX_POS - my, Z_MAX_POS);
+      #else
+        UNUSED(mx); UNUSED(my);
+        xform_min.set(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+        xform_max.set(FLT_MAX, FLT_MAX, FLT_MAX);
+      #endif
+    #endif
+  }
+
+#endif // FUSED_POSITION_TRANSFORM
+
 void Planner::quick_stop() {
 
   // Remove all the queued blocks. Note that this function is NOT
@@ -1662,12 +2151,15 @@ void Planner::quick_stop() {
 
   // Drop all queue entries
   block_buffer_nonbusy = block_buffer_planned = block_buffer_head = block_buffer_tail;
+  TERN_(PLANNER_STAGING, staged_count = 0);
+  TERN_(LINE_MERGE, line_merge.discard());
+  TERN_(PATH_BLENDING, path_blend.discard());
 
   // Restart the block delay for the first movement - As the queue was
   // forced to empty, there's no risk the ISR will touch this.
   delay_before_delivering = BLOCK_DELAY_FOR_1ST_MOVE;
 
-  TERN_(HAS_WIRED_LCD, clear_block_buffer_runtime()); // Clear the accumulated runtime
+  TERN_(HAS_BLOCK_RUNTIME, clear_block_buffer_runtime()); // Clear the accumulated runtime
 
   // Make sure to drop any attempt of queuing moves for 1 second
   cleaning_buffer_counter = TEMP_TIMER_FREQUENCY;
@@ -1708,7 +2200,9 @@ float Planner::triggered_position_mm(const AxisEnum axis) {
 }
 
 void Planner::finish_and_disable() {
+  TERN_(PLANNER_STAGING, flush_staged());
   while (has_blocks_queued() || cleaning_buffer_counter) idle();
+  TERN_(HAS_SHAPING, while (!stepper.shaping_idle()) idle()); // Let delayed steps finish
   stepper.disable_all_steppers();
 }
 
@@ -1762,13 +2256,20 @@ float Planner::get_axis_position_mm(const AxisEnum axis) {
 
   #endif
 
+  // Babysteps in the planner are physical, not part of the commanded position
+  TERN_(BABYSTEP_PLANNER, if (axis == Z_AXIS) return axis_steps * mm_per_step[axis] - babystep.planned_z);
+
   return axis_steps * mm_per_step[axis];
 }
 
 /**
  * Block until the planner is finished processing
  */
-void Planner::synchronize() { while (busy()) idle(); }
+void Planner::synchronize() {
+  TERN_(PLANNER_STAGING, flush_staged());
+  while (busy()) idle();
+  TERN_(HAS_SHAPING, while (!stepper.shaping_idle()) idle()); // Let delayed steps finish
+}
 
 /**
  * Planner::_buffer_steps
@@ -1780,6 +2281,7 @@ void Planner::synchronize() { while (busy()) idle(); }
  *  fr_mm_s       - (target) speed of the move
  *  extruder      - target extruder
  *  millimeters   - the length of the movement, if known
+ *  arc           - the arc to trace, if not a linear movement
  *
  * Returns true if movement was properly queued, false otherwise (if cleaning)
  */
@@ -1787,6 +2289,7 @@ bool Planner::_buffer_steps(const xyze_long_t &target
   OPTARG(HAS_POSITION_FLOAT, const xyze_pos_t &target_float)
   OPTARG(HAS_DIST_MM_ARG, const xyze_float_t &cart_dist_mm)
   , feedRate_t fr_mm_s, const uint8_t extruder, const_float_t millimeters
+  OPTARG(NATIVE_ARCS, const arc_move_t * const arc)
 ) {
 
   // Wait for the next available block
@@ -1803,6 +2306,7 @@ bool Planner::_buffer_steps(const xyze_long_t &target
         OPTARG(HAS_POSITION_FLOAT, target_float)
         OPTARG(HAS_DIST_MM_ARG, cart_dist_mm)
         , fr_mm_s, extruder, millimeters
+        OPTARG(NATIVE_ARCS, arc)
       )
   ) {
     // Movement was not queued, probably because it was too short.
@@ -1821,10 +2325,14 @@ bool Planner::_buffer_steps(const xyze_long_t &target
   }
 
   // Move buffer head
+  BLOCK_RELEASE();
   block_buffer_head = next_buffer_head;
+  TERN_(STREAM_STATISTICS, queue.stream_stats.blocks++);
 
   // Recalculate and optimize trapezoidal speed profiles
+  TERN_(MOTION_BENCHMARK, const uint32_t recalc_start = get_cycle_count());
   recalculate();
+  TERN_(MOTION_BENCHMARK, MotionBench::recalc_done(get_cycle_count() - recalc_start));
 
   // Movement successfully queued!
   return true;
@@ -1844,6 +2352,7 @@ bool Planner::_buffer_steps(const xyze_long_t &target
  * @param extruder      target extruder
  * @param millimeters   A pre-calculated linear distance for the move, in mm,
  *                      or 0.0 to have the distance calculated here.
+ * @param arc           The arc for the Stepper to trace, or nullptr for a linear movement
  *
  * @return  true if movement is acceptable, false otherwise
  */
@@ -1853,6 +2362,7 @@ bool Planner::_populate_block(
   OPTARG(HAS_POSITION_FLOAT, const xyze_pos_t &target_float)
   OPTARG(HAS_DIST_MM_ARG, const xyze_float_t &cart_dist_mm)
   , feedRate_t fr_mm_s, const uint8_t extruder, const_float_t millimeters/*=0.0*/
+  OPTARG(NATIVE_ARCS, const arc_move_t * const arc/*=nullptr*/)
 ) {
   int32_t LOGICAL_AXIS_LIST(
     de = target.e - position.e,
@@ -1967,6 +2477,14 @@ bool Planner::_populate_block(
     if (dk < 0) SBI(dm, K_AXIS)
   );
 
+  #if ENABLED(NATIVE_ARCS)
+    // An arc starts out along its tangent. The Stepper turns X and Y around as it goes.
+    if (arc) {
+      SET_BIT_TO(dm, X_AXIS, arc->start_dir.x < 0);
+      SET_BIT_TO(dm, Y_AXIS, arc->start_dir.y < 0);
+    }
+  #endif
+
   #if HAS_EXTRUDERS
     if (de < 0) SBI(dm, E_AXIS);
     const float esteps_float = de * e_factor[extruder];
@@ -1978,6 +2496,13 @@ bool Planner::_populate_block(
   // Clear all flags, including the "busy" bit
   block->flag.clear();
 
+  #if ENABLED(NATIVE_ARCS)
+    if (arc) {
+      block->flag.apply(BLOCK_BIT_ARC);
+      block->arc = arc->stepper;
+    }
+  #endif
+
   // Set direction bits
   block->direction_bits = dm;
 
@@ -2093,6 +2618,14 @@ bool Planner::_populate_block(
 
   TERN_(HAS_EXTRUDERS, steps_dist_mm.e = esteps_float * mm_per_step[E_AXIS_N(extruder)]);
 
+  #if ENABLED(NATIVE_ARCS)
+    // X or Y may each cover the whole length of the arc, so limit them both by it
+    if (arc) {
+      block->steps.x = block->steps.y = arc->steps;
+      steps_dist_mm.x = steps_dist_mm.y = arc->flat_mm;
+    }
+  #endif
+
   TERN_(LCD_SHOW_E_TOTAL, e_move_accumulator += steps_dist_mm.e);
 
   if (true LINEAR_AXIS_GANG(
@@ -2157,6 +2690,9 @@ bool Planner::_populate_block(
     esteps, block->steps.a, block->steps.b, block->steps.c, block->steps.i, block->steps.j, block->steps.k
   ));
 
+  // The arc was divided into its own count of step events
+  TERN_(NATIVE_ARCS, if (arc) block->step_event_count = arc->events);
+
   // Bail if this is a zero-length block
   if (block->step_event_count < MIN_STEPS_PER_SEGMENT) return false;
 
@@ -2267,6 +2803,12 @@ bool Planner::_populate_block(
   // Example: At 120mm/s a 60mm move takes 0.5s. So this will give 2.0.
   float inverse_secs = fr_mm_s * inverse_millimeters;
 
+  #if ENABLED(INSTANT_FEEDRATE_OVERRIDE)
+    // Keep the speed at 100% so a later feedrate override can re-time this block
+    block->override_speed_sqr = override_scaled && feedrate_percentage > 0 ? sq(fr_mm_s * 100 / feedrate_percentage) : 0;
+    block->max_junction_speed_sqr = 0;
+  #endif
+
   // Get the number of non busy movements in queue (non busy means that they can be altered)
   const uint8_t moves_queued = nonbusy_movesplanned();
 
@@ -2276,7 +2818,18 @@ bool Planner::_populate_block(
     int32_t segment_time_us = LROUND(1000000.0f / inverse_secs);
   #endif
 
-  #if ENABLED(SLOWDOWN)
+  #if ENABLED(SLOWDOWN) && defined(SLOWDOWN_HORIZON_MS)
+    if (moves_queued >= 2) {
+      const int32_t shortfall = int32_t((SLOWDOWN_HORIZON_MS) * 1000UL) - int32_t(block_buffer_runtime_us) - segment_time_us;
+      if (shortfall > 0) {
+        // The queued moves will run out within the horizon. Stretch the block by the part of
+        // the horizon that's missing, down to half speed when the buffer is all but empty.
+        const int32_t nst = segment_time_us + LROUND(float(segment_time_us) * shortfall / ((SLOWDOWN_HORIZON_MS) * 1000UL));
+        inverse_secs = 1000000.0f / nst;
+        segment_time_us = nst;
+      }
+    }
+  #elif ENABLED(SLOWDOWN)
     #ifndef SLOWDOWN_DIVISOR
       #define SLOWDOWN_DIVISOR 2
     #endif
@@ -2293,14 +2846,17 @@ bool Planner::_populate_block(
     }
   #endif
 
-  #if HAS_WIRED_LCD
-    // Protect the access to the position.
-    const bool was_enabled = stepper.suspend();
-
-    block_buffer_runtime_us += segment_time_us;
+  #if HAS_BLOCK_RUNTIME
     block->segment_time_us = segment_time_us;
-
-    if (was_enabled) stepper.wake_up();
+    #if ENABLED(LOCKFREE_BLOCK_HANDOFF)
+      // The Stepper ISR subtracts from the total, so add atomically
+      __atomic_fetch_add(&block_buffer_runtime_us, segment_time_us, __ATOMIC_RELAXED);
+    #else
+      // Protect the access to the position.
+      const bool was_enabled = stepper.suspend();
+      block_buffer_runtime_us += segment_time_us;
+      if (was_enabled) stepper.wake_up();
+    #endif
   #endif
 
   block->nominal_speed_sqr = sq(block->millimeters * inverse_secs);   // (mm/sec)^2 Always > 0
@@ -2348,16 +2904,37 @@ bool Planner::_populate_block(
 
         if (block->steps.a || block->steps.b || block->steps.c) {
 
-          if (max_vfr > 0 && cs > max_vfr) {
-            NOMORE(speed_factor, max_vfr / cs); // respect volumetric extruder limit (if any)
-            /* <-- add a slash to enable
-            SERIAL_ECHOPGM("volumetric extruder limit enforced: ", (cs * CIRCLE_AREA(filament_size[extruder] * 0.5f)));
-            SERIAL_ECHOPGM(" mm^3/s (", cs);
-            SERIAL_ECHOPGM(" mm/s) limited to ", (max_vfr * CIRCLE_AREA(filament_size[extruder] * 0.5f)));
-            SERIAL_ECHOPGM(" mm^3/s (", max_vfr);
-            SERIAL_ECHOLNPGM(" mm/s)");
-            //*/
-          }
+          #if ENABLED(VOLUMETRIC_FLOW_SMOOTHING)
+            // The melt zone recovers while the queue runs dry
+            if (!movesplanned()) flow_average[extruder] = 0;
+
+            if (max_vfr > 0 && cs > flow_average[extruder]) {
+              /**
+               * Find the speed factor s that keeps the averaged flow within the limit L:
+               *   avg + w * (cs * s - avg) <= L, where w = a / s is the weight of the block at speed
+               *   factor s and a = block time / smoothing time at the requested speed.
+               * Once w reaches 1 the block alone must stay under L.
+               */
+              const float a = 1.0f / (inverse_secs * (VOLUMETRIC_FLOW_SMOOTH_TIME)),
+                          avg = flow_average[extruder],
+                          over = avg + a * cs - max_vfr;
+              float vfr_factor = over > 0 ? a * avg / over : 1.0f;
+              if (vfr_factor < a) vfr_factor = max_vfr / cs;
+              NOMORE(vfr_factor, (VOLUMETRIC_FLOW_PEAK) * max_vfr / cs);
+              NOMORE(speed_factor, vfr_factor);
+            }
+          #else
+            if (max_vfr > 0 && cs > max_vfr) {
+              NOMORE(speed_factor, max_vfr / cs); // respect volumetric extruder limit (if any)
+              /* <-- add a slash to enable
+              SERIAL_ECHOPGM("volumetric extruder limit enforced: ", (cs * CIRCLE_AREA(filament_size[extruder] * 0.5f)));
+              SERIAL_ECHOPGM(" mm^3/s (", cs);
+              SERIAL_ECHOPGM(" mm/s) limited to ", (max_vfr * CIRCLE_AREA(filament_size[extruder] * 0.5f)));
+              SERIAL_ECHOPGM(" mm^3/s (", max_vfr);
+              SERIAL_ECHOLNPGM(" mm/s)");
+              //*/
+            }
+          #endif
         }
       #endif
     }
@@ -2402,6 +2979,14 @@ bool Planner::_populate_block(
     block->nominal_speed_sqr = block->nominal_speed_sqr * sq(speed_factor);
   }
 
+  #if ENABLED(VOLUMETRIC_FLOW_SMOOTHING)
+    // Add the flow of this block, at its final speed, to the queue average
+    if (block->steps.a || block->steps.b || block->steps.c) {
+      const float w = _MIN(1.0f, 1.0f / (inverse_secs * speed_factor * (VOLUMETRIC_FLOW_SMOOTH_TIME)));
+      flow_average[extruder] += (ABS(current_speed.e) - flow_average[extruder]) * w;
+    }
+  #endif
+
   // Compute and limit the acceleration rate for the trapezoid generator.
   const float steps_per_mm = block->step_event_count * inverse_millimeters;
   uint32_t accel;
@@ -2411,6 +2996,9 @@ bool Planner::_populate_block(
   ) {                                                             // Is this a retract / recover move?
     accel = CEIL(settings.retract_acceleration * steps_per_mm);   // Convert to: acceleration steps/sec^2
     TERN_(LIN_ADVANCE, block->use_advance_lead = false);          // No linear advance for simple retract/recover
+    #if BOTH(ACCEL_TORQUE_CURVE, INSTANT_FEEDRATE_OVERRIDE)
+      block->torque_accel_cap = 0;                                // No torque curve for E-only moves
+    #endif
   }
   else {
     #define LIMIT_ACCEL_LONG(AXIS,INDX) do{ \
@@ -2427,8 +3015,15 @@ bool Planner::_populate_block(
       } \
     }while(0)
 
+    // The torque curve limits X, Y, Z below, at the speed of the block
+    #if ENABLED(ACCEL_TORQUE_CURVE)
+      #define LIMIT_ACCEL_XYZ(T,AXIS) NOOP
+    #else
+      #define LIMIT_ACCEL_XYZ(T,AXIS) LIMIT_ACCEL_##T(AXIS, 0)
+    #endif
+
     // Start with print or travel acceleration
-    accel = CEIL((esteps ? settings.acceleration : settings.travel_acceleration) * steps_per_mm);
+    accel = CEIL((esteps ? print_acceleration() : settings.travel_acceleration) * steps_per_mm);
 
     #if ENABLED(LIN_ADVANCE)
       // Linear advance is currently not ready for HAS_I_AXIS
@@ -2452,9 +3047,10 @@ bool Planner::_populate_block(
           #if IS_KINEMATIC
             block->millimeters
           #else
-            SQRT(sq(target_float.x - position_float.x)
-               + sq(target_float.y - position_float.y)
-               + sq(target_float.z - position_float.z))
+            (TERN0(NATIVE_ARCS, arc) ? block->millimeters :
+             SQRT(sq(target_float.x - position_float.x)
+                + sq(target_float.y - position_float.y)
+                + sq(target_float.z - position_float.z)))
           #endif
         ;
 
@@ -2475,9 +3071,9 @@ bool Planner::_populate_block(
     if (block->step_event_count <= acceleration_long_cutoff) {
       LOGICAL_AXIS_CODE(
         LIMIT_ACCEL_LONG(E_AXIS, E_INDEX_N(extruder)),
-        LIMIT_ACCEL_LONG(A_AXIS, 0),
-        LIMIT_ACCEL_LONG(B_AXIS, 0),
-        LIMIT_ACCEL_LONG(C_AXIS, 0),
+        LIMIT_ACCEL_XYZ(LONG, A_AXIS),
+        LIMIT_ACCEL_XYZ(LONG, B_AXIS),
+        LIMIT_ACCEL_XYZ(LONG, C_AXIS),
         LIMIT_ACCEL_LONG(I_AXIS, 0),
         LIMIT_ACCEL_LONG(J_AXIS, 0),
         LIMIT_ACCEL_LONG(K_AXIS, 0)
@@ -2486,21 +3082,43 @@ bool Planner::_populate_block(
     else {
       LOGICAL_AXIS_CODE(
         LIMIT_ACCEL_FLOAT(E_AXIS, E_INDEX_N(extruder)),
-        LIMIT_ACCEL_FLOAT(A_AXIS, 0),
-        LIMIT_ACCEL_FLOAT(B_AXIS, 0),
-        LIMIT_ACCEL_FLOAT(C_AXIS, 0),
+        LIMIT_ACCEL_XYZ(FLOAT, A_AXIS),
+        LIMIT_ACCEL_XYZ(FLOAT, B_AXIS),
+        LIMIT_ACCEL_XYZ(FLOAT, C_AXIS),
         LIMIT_ACCEL_FLOAT(I_AXIS, 0),
         LIMIT_ACCEL_FLOAT(J_AXIS, 0),
         LIMIT_ACCEL_FLOAT(K_AXIS, 0)
       );
     }
+
+    #if ENABLED(ACCEL_TORQUE_CURVE)
+      TERN_(INSTANT_FEEDRATE_OVERRIDE, block->torque_accel_cap = accel);
+      accel = torque_limit_accel(block, SQRT(block->nominal_speed_sqr), accel);
+    #endif
   }
   block->acceleration_steps_per_s2 = accel;
   block->acceleration = accel / steps_per_mm;
+
+  #if ENABLED(NATIVE_ARCS)
+    // Limit the speed on the arc so its centripetal acceleration stays within the block acceleration
+    if (arc) {
+      const float max_speed_sqr = block->acceleration * arc->radius;
+      if (block->nominal_speed_sqr > max_speed_sqr) {
+        const float factor = SQRT(max_speed_sqr / block->nominal_speed_sqr);
+        current_speed *= factor;
+        block->nominal_rate *= factor;
+        block->nominal_speed_sqr = max_speed_sqr;
+      }
+    }
+  #endif
   #if DISABLED(S_CURVE_ACCELERATION)
     block->acceleration_rate = (uint32_t)(accel * (float(1UL << 24) / (STEPPER_TIMER_RATE)));
   #endif
-  #if ENABLED(LIN_ADVANCE)
+  #if ENABLED(LIN_ADVANCE_INTEGRATED)
+    // The lead is K times the E rate, which the Stepper gets from the step_event rate
+    if (block->use_advance_lead)
+      block->advance_gain = uint32_t(extruder_advance_K[active_extruder] * float(block->steps.e) / float(block->step_event_count) * float(_BV32(24)));
+  #elif ENABLED(LIN_ADVANCE)
     if (block->use_advance_lead) {
       block->advance_speed = (STEPPER_TIMER_RATE) / (extruder_advance_K[active_extruder] * block->e_D_ratio * block->acceleration * settings.axis_steps_per_mm[E_AXIS_N(extruder)]);
       #if ENABLED(LA_DEBUG)
@@ -2512,6 +3130,32 @@ bool Planner::_populate_block(
     }
   #endif
 
+  #if ENABLED(INSTANT_FEEDRATE_OVERRIDE)
+    // The fastest an override may make this block. A block that was already
+    // slowed by a limit, SLOWDOWN or its arc can only be made slower.
+    if (block->override_speed_sqr) {
+      float max_factor = 1.0f;
+      if (block->nominal_speed_sqr >= sq(fr_mm_s) * 0.999f) {
+        max_factor = __FLT_MAX__;
+        LOOP_LINEAR_AXES(i)
+          if (current_speed[i]) NOMORE(max_factor, settings.max_feedrate_mm_s[i] / ABS(current_speed[i]));
+        #if HAS_EXTRUDERS
+          if (current_speed.e) {
+            NOMORE(max_factor, settings.max_feedrate_mm_s[E_AXIS_N(extruder)] / ABS(current_speed.e));
+            #if ENABLED(VOLUMETRIC_EXTRUDER_LIMIT)
+              if (volumetric_extruder_feedrate_limit[extruder] > 0 && (block->steps.a || block->steps.b || block->steps.c))
+                NOMORE(max_factor, volumetric_extruder_feedrate_limit[extruder] / ABS(current_speed.e));
+            #endif
+          }
+        #endif
+        #ifdef XY_FREQUENCY_LIMIT
+          if (xy_freq_limit_hz) max_factor = 1.0f;
+        #endif
+      }
+      block->max_nominal_speed_sqr = block->nominal_speed_sqr * sq(max_factor);
+    }
+  #endif
+
   float vmax_junction_sqr; // Initial limit on the segment entry velocity (mm/s)^2
 
   #if HAS_JUNCTION_DEVIATION
@@ -2560,13 +3204,16 @@ bool Planner::_populate_block(
       #endif
     ;
 
+    // An arc joins its neighbors along its end tangents
+    TERN_(NATIVE_ARCS, if (arc) unit_vec = arc->start_dir);
+
     /**
      * On CoreXY the length of the vector [A,B] is SQRT(2) times the length of the head movement vector [X,Y].
      * So taking Z and E into account, we cannot scale to a unit vector with "inverse_millimeters".
      * => normalize the complete junction vector.
      * Elsewise, when needed JD will factor-in the E component
      */
-    if (ANY(IS_CORE, MARKFORGED_XY, MARKFORGED_YX) || esteps > 0)
+    if (ANY(IS_CORE, MARKFORGED_XY, MARKFORGED_YX) || esteps > 0 || TERN0(NATIVE_ARCS, arc))
       normalize_junction_vector(unit_vec);  // Normalize with XYZE components
     else
       unit_vec *= inverse_millimeters;      // Use pre-calculated (1 / SQRT(x^2 + y^2 + z^2))
@@ -2598,9 +3245,9 @@ bool Planner::_populate_block(
         normalize_junction_vector(junction_unit_vec);
 
         const float junction_acceleration = limit_value_by_axis_maximum(block->acceleration, junction_unit_vec),
-                    sin_theta_d2 = SQRT(0.5f * (1.0f - junction_cos_theta)); // Trig half angle identity. Always positive.
+                    sin_theta_d2 = TERN(PLANNER_FIXED_POINT, fast_sqrt, SQRT)(0.5f * (1.0f - junction_cos_theta)); // Trig half angle identity. Always positive.
 
-        vmax_junction_sqr = junction_acceleration * junction_deviation_mm * sin_theta_d2 / (1.0f - sin_theta_d2);
+        vmax_junction_sqr = junction_acceleration * junction_deviation() * sin_theta_d2 / (1.0f - sin_theta_d2);
 
         #if ENABLED(JD_HANDLE_SMALL_SEGMENTS)
 
@@ -2691,6 +3338,8 @@ bool Planner::_populate_block(
         #endif // JD_HANDLE_SMALL_SEGMENTS
       }
 
+      TERN_(INSTANT_FEEDRATE_OVERRIDE, block->max_junction_speed_sqr = vmax_junction_sqr);
+
       // Get the lowest speed
       vmax_junction_sqr = _MIN(vmax_junction_sqr, block->nominal_speed_sqr, previous_nominal_speed_sqr);
     }
@@ -2699,6 +3348,13 @@ bool Planner::_populate_block(
 
     prev_unit_vec = unit_vec;
 
+    #if ENABLED(NATIVE_ARCS)
+      if (arc) {
+        prev_unit_vec = arc->end_dir;
+        normalize_junction_vector(prev_unit_vec);
+      }
+    #endif
+
   #endif
 
   #ifdef USE_CACHED_SQRT
@@ -2856,6 +3512,8 @@ bool Planner::_populate_block(
 
 void Planner::buffer_sync_block(const BlockFlagBit sync_flag/*=BLOCK_BIT_SYNC_POSITION*/) {
 
+  TERN_(PLANNER_STAGING, flush_staged()); // Keep the staged segments ahead of it
+
   // Wait for the next available block
   uint8_t next_buffer_head;
   block_t * const block = get_next_free_block(next_buffer_head);
@@ -2889,6 +3547,7 @@ void Planner::buffer_sync_block(const BlockFlagBit sync_flag/*=BLOCK_BIT_SYNC_PO
     delay_before_delivering = BLOCK_DELAY_FOR_1ST_MOVE;
   }
 
+  BLOCK_RELEASE();
   block_buffer_head = next_buffer_head;
 
   stepper.wake_up();
@@ -2911,11 +3570,39 @@ void Planner::buffer_sync_block(const BlockFlagBit sync_flag/*=BLOCK_BIT_SYNC_PO
 bool Planner::buffer_segment(const abce_pos_t &abce
   OPTARG(HAS_DIST_MM_ARG, const xyze_float_t &cart_dist_mm)
   , const_feedRate_t fr_mm_s, const uint8_t extruder/*=active_extruder*/, const_float_t millimeters/*=0.0*/
+  OPTARG(NATIVE_ARCS, arc_move_t * const arc/*=nullptr*/)
 ) {
 
   // If we are cleaning, do not accept queuing of movements
   if (cleaning_buffer_counter) return false;
 
+  #if ENABLED(PLANNER_STAGING)
+    if (!committing) {
+      // An arc is traced from the planner state, so it can't wait in line
+      if (TERN0(NATIVE_ARCS, arc))
+        flush_staged();
+      else if (staged_count || !moves_free()) {
+        // Stage the segment and get back to parsing, instead of waiting here for a block
+        while (staged_count >= PLANNER_STAGING_SIZE) {
+          idle();
+          if (cleaning_buffer_counter) return false;
+        }
+        staged_segment_t &s = staged[(staged_tail + staged_count) % (PLANNER_STAGING_SIZE)];
+        s.abce = abce;
+        TERN_(HAS_DIST_MM_ARG, s.cart_dist_mm = cart_dist_mm);
+        s.fr_mm_s = fr_mm_s;
+        s.millimeters = millimeters;
+        s.extruder = extruder;
+        #if ENABLED(INSTANT_FEEDRATE_OVERRIDE)
+          s.override_scaled = override_scaled;
+          s.feedrate_percentage = feedrate_percentage;
+        #endif
+        staged_count++;
+        return true;
+      }
+    }
+  #endif
+
   // When changing extruders recalculate steps corresponding to the E position
   #if ENABLED(DISTINCT_E_FACTORS)
     if (last_extruder != extruder && settings.axis_steps_per_mm[E_AXIS_N(extruder)] != settings.axis_steps_per_mm[E_AXIS_N(last_extruder)]) {
@@ -2924,6 +3611,14 @@ bool Planner::buffer_segment(const abce_pos_t &abce
     }
   #endif
 
+  #if ENABLED(BABYSTEP_PLANNER)
+    // Z offset from babystepping, eased in along the XY length of this move
+    const float babystep_z = babystep.blend_z(HYPOT(
+      abce.a - position.a * mm_per_step[A_AXIS],
+      abce.b - position.b * mm_per_step[B_AXIS]
+    ));
+  #endif
+
   // The target position of the tool in absolute steps
   // Calculate target position in absolute steps
   const abce_long_t target = {
@@ -2931,7 +3626,7 @@ bool Planner::buffer_segment(const abce_pos_t &abce
       int32_t(LROUND(abce.e * settings.axis_steps_per_mm[E_AXIS_N(extruder)])),
       int32_t(LROUND(abce.a * settings.axis_steps_per_mm[A_AXIS])),
       int32_t(LROUND(abce.b * settings.axis_steps_per_mm[B_AXIS])),
-      int32_t(LROUND(abce.c * settings.axis_steps_per_mm[C_AXIS])),
+      int32_t(LROUND((abce.c + TERN0(BABYSTEP_PLANNER, babystep_z)) * settings.axis_steps_per_mm[C_AXIS])),
       int32_t(LROUND(abce.i * settings.axis_steps_per_mm[I_AXIS])),
       int32_t(LROUND(abce.j * settings.axis_steps_per_mm[J_AXIS])),
       int32_t(LROUND(abce.k * settings.axis_steps_per_mm[K_AXIS]))
@@ -2939,7 +3634,12 @@ bool Planner::buffer_segment(const abce_pos_t &abce
   };
 
   #if HAS_POSITION_FLOAT
-    const xyze_pos_t target_float = abce;
+    #if ENABLED(BABYSTEP_PLANNER)
+      xyze_pos_t target_float = abce;
+      target_float.z += babystep_z;
+    #else
+      const xyze_pos_t target_float = abce;
+    #endif
   #endif
 
   #if HAS_EXTRUDERS
@@ -2994,17 +3694,54 @@ bool Planner::buffer_segment(const abce_pos_t &abce
     #endif
   //*/
 
+  // An arc that can't be traced is left to the caller
+  TERN_(NATIVE_ARCS, if (arc && !prepare_arc(*arc, target, extruder)) return false);
+
   // Queue the movement. Return 'false' if the move was not queued.
   if (!_buffer_steps(target
       OPTARG(HAS_POSITION_FLOAT, target_float)
       OPTARG(HAS_DIST_MM_ARG, cart_dist_mm)
-      , fr_mm_s, extruder, millimeters)
+      , fr_mm_s, extruder, millimeters
+      OPTARG(NATIVE_ARCS, arc))
   ) return false;
 
   stepper.wake_up();
   return true;
 } // buffer_segment()
 
+#if ENABLED(PLANNER_STAGING)
+
+  /**
+   * Give the staged segments to buffer_segment in order, as the Stepper ISR
+   * frees blocks. Called from idle(), or with 'all' to wait for every one.
+   */
+  void Planner::commit_staged(const bool all/*=false*/) {
+    if (committing) return;
+    committing = true;
+    while (staged_count) {
+      if (cleaning_buffer_counter) { staged_count = 0; break; }
+      if (!moves_free()) {
+        if (!all) break;
+        idle();
+        continue;
+      }
+      const staged_segment_t &s = staged[staged_tail];
+      feedRate_t fr_mm_s = s.fr_mm_s;
+      #if ENABLED(INSTANT_FEEDRATE_OVERRIDE)
+        // Any M220 since the segment was staged applies to it too
+        if (s.override_scaled && s.feedrate_percentage > 0 && s.feedrate_percentage != feedrate_percentage)
+          fr_mm_s *= float(feedrate_percentage) / s.feedrate_percentage;
+        REMEMBER(scaled, override_scaled, s.override_scaled);
+      #endif
+      buffer_segment(s.abce OPTARG(HAS_DIST_MM_ARG, s.cart_dist_mm), fr_mm_s, s.extruder, s.millimeters);
+      staged_tail = (staged_tail + 1) % (PLANNER_STAGING_SIZE);
+      staged_count--;
+    }
+    committing = false;
+  }
+
+#endif
+
 /**
  * Add a new linear movement to the buffer.
  * The target is cartesian. It's translated to
@@ -3019,6 +3756,8 @@ bool Planner::buffer_segment(const abce_pos_t &abce
 bool Planner::buffer_line(const xyze_pos_t &cart, const_feedRate_t fr_mm_s, const uint8_t extruder/*=active_extruder*/, const float millimeters/*=0.0*/
   OPTARG(SCARA_FEEDRATE_SCALING, const_float_t inv_duration/*=0.0*/)
 ) {
+  TERN_(TRACE_EVENTS, TRACE_SCOPE(TRACE_BUFFER_LINE));
+
   xyze_pos_t machine = cart;
   TERN_(HAS_POSITION_MODIFIERS, apply_modifiers(machine));
 
@@ -3062,6 +3801,82 @@ bool Planner::buffer_line(const xyze_pos_t &cart, const_feedRate_t fr_mm_s, cons
   #endif
 } // buffer_line()
 
+#if ENABLED(NATIVE_ARCS)
+
+  /**
+   * Add an arc in the XY plane as a single block, traced by the Stepper ISR.
+   * Return 'false' if the arc can't be a block, leaving the caller to segment it.
+   */
+  bool Planner::buffer_arc(const xyze_pos_t &cart, const arc_move_t &arc, const_feedRate_t fr_mm_s, const uint8_t extruder/*=active_extruder*/) {
+    // A circle in steps needs the same resolution on X and Y
+    if (settings.axis_steps_per_mm[X_AXIS] != settings.axis_steps_per_mm[Y_AXIS]) return false;
+
+    // Keep the point on the arc well within the range of the Q12 math
+    const float radius_steps = arc.radius * settings.axis_steps_per_mm[X_AXIS];
+    if (!WITHIN(radius_steps, 2, float(_BV32(29 - ARC_FRACT_BITS)))) return false;
+
+    xyze_pos_t machine = cart;
+    TERN_(HAS_POSITION_MODIFIERS, apply_modifiers(machine));
+
+    arc_move_t move = arc;
+    return buffer_segment(machine, fr_mm_s, extruder, arc.millimeters, &move);
+  }
+
+  /**
+   * The Stepper rotates the point on the arc once per step event with Minsky's
+   * circle algorithm, using eps = 2 sin(theta / 2) to rotate by exactly theta.
+   * Its orbit is a slightly skewed ellipse, so work out where the last event
+   * lands and spread the difference from the target over all the events.
+   *
+   * With M the rotation of one event, M^n = cos(n theta) + sin(n theta) (M - cos(theta)) / sin(theta)
+   * where (M - cos(theta)) / sin(theta) = [ eps/2, -1 ; 1, -eps/2 ] / cos(theta / 2).
+   */
+  bool Planner::prepare_arc(arc_move_t &arc, const abce_long_t &target, const uint8_t extruder) {
+    const float steps_per_mm = settings.axis_steps_per_mm[X_AXIS];
+
+    // Stay under one step per event along X and Y, with room for the drift
+    arc.steps = CEIL(arc.flat_mm * steps_per_mm);
+    uint32_t min_events = arc.steps + (arc.steps >> 3) + 2;
+    LOOP_S_L_N(i, Z_AXIS, LINEAR_AXES) NOLESS(min_events, uint32_t(ABS(target[i] - position[i])));
+    TERN_(HAS_EXTRUDERS, NOLESS(min_events, uint32_t(ABS((target.e - position.e) * e_factor[extruder])) + 1));
+
+    // The rotation per event, as the Stepper will do it. Rounding eps toward zero
+    // and then fitting the count of events leaves less than half an event of angle.
+    const int32_t eps = 2.0f * sinf(arc.angle / min_events * 0.5f) * float(_BV32(30));
+    if (!eps) return false;
+    const float half_eps = 0.5f * eps / float(_BV32(30)),
+                theta = 2.0f * asinf(half_eps);
+    const uint32_t events = _MAX(min_events, uint32_t(LROUND(arc.angle / theta)));
+    arc.events = events;
+
+    const float total = theta * events,
+                cos_n = cosf(total),
+                sin_n = sinf(total) / cosf(0.5f * theta);
+
+    // Start and target relative to the center, in steps
+    const xy_pos_t center = arc.center * steps_per_mm,
+                   start = { position.x - center.x, position.y - center.y },
+                   end = { target.x - center.x, target.y - center.y },
+                   orbit = { cos_n * start.x + sin_n * (half_eps * start.x - start.y),
+                             cos_n * start.y + sin_n * (start.x - half_eps * start.y) },
+                   drift = end - orbit;
+
+    // The drift must stay small beside the motion of each event
+    if (ABS(drift.x) > events * 0.0625f || ABS(drift.y) > events * 0.0625f) return false;
+
+    const float drift_scale = float(1ULL << (ARC_FRACT_BITS + 32)) / events;
+    arc.stepper.x = LROUND(start.x * _BV32(ARC_FRACT_BITS));
+    arc.stepper.y = LROUND(start.y * _BV32(ARC_FRACT_BITS));
+    arc.stepper.eps = eps;
+    arc.stepper.drift_x = int64_t(drift.x * drift_scale);
+    arc.stepper.drift_y = int64_t(drift.y * drift_scale);
+    arc.stepper.end_x = target.x - position.x;
+    arc.stepper.end_y = target.y - position.y;
+    return true;
+  }
+
+#endif // NATIVE_ARCS
+
 #if ENABLED(DIRECT_STEPPING)
 
   void Planner::buffer_page(const page_idx_t page_idx, const uint8_t extruder, const uint16_t num_steps) {
@@ -3070,6 +3885,8 @@ bool Planner::buffer_line(const xyze_pos_t &cart, const_feedRate_t fr_mm_s, cons
       return;
     }
 
+    TERN_(PLANNER_STAGING, flush_staged());
+
     uint8_t next_buffer_head;
     block_t * const block = get_next_free_block(next_buffer_head);
 
@@ -3113,6 +3930,7 @@ bool Planner::buffer_line(const xyze_pos_t &cart, const_feedRate_t fr_mm_s, cons
     }
 
     // Move buffer head
+    BLOCK_RELEASE();
     block_buffer_head = next_buffer_head;
 
     stepper.enable_all_steppers();
@@ -3121,6 +3939,88 @@ bool Planner::buffer_line(const xyze_pos_t &cart, const_feedRate_t fr_mm_s, cons
 
 #endif // DIRECT_STEPPING
 
+#if ENABLED(HOST_BLOCK_STREAM)
+
+  bool Planner::buffer_host_block(const host_block_t &hb) {
+    const AxisEnum axis_index[4] = { X_AXIS, Y_AXIS, Z_AXIS, E_AXIS_N(active_extruder) };
+
+    uint32_t step_event_count = 0;
+    LOOP_L_N(i, 4) NOLESS(step_event_count, uint32_t(ABS(hb.steps[i])));
+    if (!step_event_count) return true;
+
+    if (!hb.nominal_rate || hb.entry_rate > hb.nominal_rate || hb.exit_rate > hb.nominal_rate || !hb.accel)
+      return false;
+
+    // Exit rates of the last host block, per axis. Moves start from rest.
+    static float exit_rate[4];
+    if (!has_blocks_queued()) ZERO(exit_rate);
+
+    // Each axis gets its share of the leading axis rates, so check every axis
+    // against its limits. The change in speed from the last block must be one
+    // that the axis could make within a single step at its top acceleration.
+    float entry_rate[4];
+    LOOP_L_N(i, 4) {
+      const AxisEnum a = axis_index[i];
+      const float ratio = float(hb.steps[i]) / step_event_count;
+      if (ABS(ratio) * hb.nominal_rate > settings.max_feedrate_mm_s[a] * settings.axis_steps_per_mm[a]) return false;
+      if (ABS(ratio) * hb.accel > max_acceleration_steps_per_s2[a]) return false;
+      entry_rate[i] = ratio * hb.entry_rate;
+      if (sq(entry_rate[i] - exit_rate[i]) > 2.0f * max_acceleration_steps_per_s2[a]) return false;
+    }
+
+    TERN_(PLANNER_STAGING, flush_staged());
+
+    uint8_t next_buffer_head;
+    block_t * const block = get_next_free_block(next_buffer_head);
+
+    memset(block, 0, sizeof(block_t));
+    block->flag.reset(BLOCK_BIT_HOST_PLANNED);
+
+    #if HAS_FAN
+      FANS_LOOP(i) block->fan_speed[i] = thermalManager.fan_speed[i];
+    #endif
+
+    E_TERN_(block->extruder = active_extruder);
+
+    // The record is in XYZE order, like the block
+    LOOP_L_N(i, 4) {
+      block->steps[i] = ABS(hb.steps[i]);
+      if (hb.steps[i] < 0) SBI(block->direction_bits, i);
+    }
+    block->step_event_count = step_event_count;
+
+    block->nominal_rate = hb.nominal_rate;
+    block->acceleration_steps_per_s2 = hb.accel;
+    #if DISABLED(S_CURVE_ACCELERATION)
+      block->acceleration_rate = (uint32_t)(hb.accel * (float(1UL << 24) / (STEPPER_TIMER_RATE)));
+    #endif
+    calculate_trapezoid_for_block(block, float(hb.entry_rate) / hb.nominal_rate, float(hb.exit_rate) / hb.nominal_rate);
+
+    LOOP_L_N(i, 4) exit_rate[i] = float(hb.steps[i]) / step_event_count * hb.exit_rate;
+
+    // Track the position, and start G-code after the stream from rest
+    LOOP_L_N(i, 4) {
+      position[i] += hb.steps[i];
+      TERN_(HAS_POSITION_FLOAT, position_float[i] += hb.steps[i] * mm_per_step[axis_index[i]]);
+    }
+    previous_nominal_speed_sqr = 0;
+    previous_speed.reset();
+
+    if (block_buffer_head == block_buffer_tail)
+      delay_before_delivering = BLOCK_DELAY_FOR_1ST_MOVE;
+
+    // Move buffer head. The planner passes never go back past this block.
+    BLOCK_RELEASE();
+    block_buffer_head = next_buffer_head;
+    block_buffer_planned = block_buffer_head;
+
+    stepper.enable_all_steppers();
+    stepper.wake_up();
+    return true;
+  }
+
+#endif // HOST_BLOCK_STREAM
+
 /**
  * Directly set the planner ABCE position (and stepper positions)
  * converting mm (or angles for SCARA) into steps.
@@ -3128,14 +4028,18 @@ bool Planner::buffer_line(const xyze_pos_t &cart, const_feedRate_t fr_mm_s, cons
  * The provided ABCE position is in machine units.
  */
 void Planner::set_machine_position_mm(const abce_pos_t &abce) {
+  TERN_(PLANNER_STAGING, flush_staged()); // Plan from the old position first
   TERN_(DISTINCT_E_FACTORS, last_extruder = active_extruder);
   TERN_(HAS_POSITION_FLOAT, position_float = abce);
+  #if BOTH(HAS_POSITION_FLOAT, BABYSTEP_PLANNER)
+    position_float.z += babystep.planned_z;
+  #endif
   position.set(
     LOGICAL_AXIS_LIST(
       LROUND(abce.e * settings.axis_steps_per_mm[E_AXIS_N(active_extruder)]),
       LROUND(abce.a * settings.axis_steps_per_mm[A_AXIS]),
       LROUND(abce.b * settings.axis_steps_per_mm[B_AXIS]),
-      LROUND(abce.c * settings.axis_steps_per_mm[C_AXIS]),
+      LROUND((abce.c + TERN0(BABYSTEP_PLANNER, babystep.planned_z)) * settings.axis_steps_per_mm[C_AXIS]),
       LROUND(abce.i * settings.axis_steps_per_mm[I_AXIS]),
       LROUND(abce.j * settings.axis_steps_per_mm[J_AXIS]),
       LROUND(abce.k * settings.axis_steps_per_mm[K_AXIS])
@@ -3177,6 +4081,7 @@ void Planner::set_position_mm(const xyze_pos_t &xyze) {
    * Setters for planner position (also setting stepper position).
    */
   void Planner::set_e_position_mm(const_float_t e) {
+    TERN_(PLANNER_STAGING, flush_staged()); // Plan from the old position first
     const uint8_t axis_index = E_AXIS_N(active_extruder);
     TERN_(DISTINCT_E_FACTORS, last_extruder = active_extruder);
 
@@ -3219,7 +4124,7 @@ void Planner::refresh_positioning() {
 inline void limit_and_warn(float &val, const AxisEnum axis, PGM_P const setting_name, const xyze_float_t &max_limit) {
   const uint8_t lim_axis = TERN_(HAS_EXTRUDERS, axis > E_AXIS ? E_AXIS :) axis;
   const float before = val;
-  LIMIT(val, 0.1, max_limit[lim_axis]);
+  LIMIT(val, 0.1f, max_limit[lim_axis]);
   if (before != val) {
     SERIAL_CHAR(AXIS_CHAR(lim_axis));
     SERIAL_ECHOPGM(" Max ");
@@ -3297,7 +4202,7 @@ void Planner::set_max_feedrate(const AxisEnum axis, float inMaxFeedrateMMS) {
 
 #endif
 
-#if HAS_WIRED_LCD
+#if HAS_BLOCK_RUNTIME
 
   uint16_t Planner::block_buffer_runtime() {
     #ifdef __AVR__
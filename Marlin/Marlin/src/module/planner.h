@@ -72,6 +72,10 @@
   #include "../feature/direct_stepping.h"
 #endif
 
+#if ENABLED(HOST_BLOCK_STREAM)
+  #include "../feature/host_blocks.h"
+#endif
+
 #if ENABLED(EXTERNAL_CLOSED_LOOP_CONTROLLER)
   #include "../feature/closedloop.h"
 #endif
@@ -109,12 +113,18 @@ enum BlockFlagBit {
   // Direct stepping page
   OPTARG(DIRECT_STEPPING, BLOCK_BIT_PAGE)
 
+  // Trapezoid planned by the host, never replanned
+  OPTARG(HOST_BLOCK_STREAM, BLOCK_BIT_HOST_PLANNED)
+
 
   // Sync the fan speeds from the block
   OPTARG(LASER_SYNCHRONOUS_M106_M107, BLOCK_BIT_SYNC_FANS)
 
   // Sync laser power from a queued block
   OPTARG(LASER_POWER_SYNC, BLOCK_BIT_LASER_PWR)
+
+  // The block traces an arc in the XY plane
+  OPTARG(NATIVE_ARCS, BLOCK_BIT_ARC)
 };
 
 /**
@@ -137,6 +147,10 @@ typedef struct {
         bool page:1;
       #endif
 
+      #if ENABLED(HOST_BLOCK_STREAM)
+        bool host_planned:1;
+      #endif
+
       #if ENABLED(LASER_SYNCHRONOUS_M106_M107)
         bool sync_fans:1;
       #endif
@@ -144,6 +158,10 @@ typedef struct {
       #if ENABLED(LASER_POWER_SYNC)
         bool sync_laser_pwr:1;
       #endif
+
+      #if ENABLED(NATIVE_ARCS)
+        bool arc:1;
+      #endif
     };
   };
 
@@ -155,6 +173,36 @@ typedef struct {
 
 } block_flags_t;
 
+#if ENABLED(NATIVE_ARCS)
+
+  #define ARC_FRACT_BITS 12                 // Fraction bits of the traced point, in steps
+
+  /**
+   * Stepper parameters of an arc block. Each step event rotates the point on the
+   * arc by Minsky's circle algorithm, which keeps the orbit closed in integer math.
+   * A small drift, spread over all the events, lands the last one on the target.
+   */
+  typedef struct {
+    int32_t x, y,                           // Start point relative to the center in steps (Q12)
+            eps;                            // Rotation per step event (Q30), negative for clockwise
+    int64_t drift_x, drift_y;               // Correction per step event (Q12 << 32)
+    int32_t end_x, end_y;                   // Target relative to the start in steps
+  } block_arc_t;
+
+  // An arc in the XY plane handed to Planner::buffer_arc
+  typedef struct {
+    xy_pos_t center;                        // (mm) Center of the arc
+    float angle,                            // (rad) Angular travel, negative for clockwise
+          radius,                           // (mm) Radius of the arc
+          flat_mm,                          // (mm) Length of the arc in the XY plane
+          millimeters;                      // (mm) Length of the whole move
+    xyze_float_t start_dir, end_dir;        // Tangents at both ends, scaled to the move length
+    uint32_t steps, events;                 // Arc length in XY steps and step events of the block
+    block_arc_t stepper;                    // Parameters for the Stepper ISR
+  } arc_move_t;
+
+#endif
+
 #if ENABLED(LASER_FEATURE)
 
   typedef struct {
@@ -178,6 +226,11 @@ typedef struct {
 
 #endif
 
+// Track the time the queued blocks will take, for the LCD and time-based SLOWDOWN
+#if HAS_WIRED_LCD || (ENABLED(SLOWDOWN) && defined(SLOWDOWN_HORIZON_MS))
+  #define HAS_BLOCK_RUNTIME 1
+#endif
+
 /**
  * struct block_t
  *
@@ -186,6 +239,10 @@ typedef struct {
  *
  * The "nominal" values are as-specified by G-code, and
  * may never actually be reached due to acceleration limits.
+ *
+ * Fields read by the Stepper ISR come first, then those only the planner
+ * uses. Small fields sit together to save padding. With MEMORY_BUDGET,
+ * M101 reports the size of a block and of its stepper part.
  */
 typedef struct block_t {
 
@@ -195,20 +252,10 @@ typedef struct block_t {
   volatile bool is_pwr_sync() { return TERN0(LASER_POWER_SYNC, flag.sync_laser_pwr); }
   volatile bool is_sync() { return flag.sync_position || is_fan_sync() || is_pwr_sync(); }
   volatile bool is_page() { return TERN0(DIRECT_STEPPING, flag.page); }
+  volatile bool is_arc() { return TERN0(NATIVE_ARCS, flag.arc); }
   volatile bool is_move() { return !(is_sync() || is_page()); }
 
-  // Fields used by the motion planner to manage acceleration
-  float nominal_speed_sqr,                  // The nominal speed for this block in (mm/sec)^2
-        entry_speed_sqr,                    // Entry speed at previous-current junction in (mm/sec)^2
-        max_entry_speed_sqr,                // Maximum allowable junction entry speed in (mm/sec)^2
-        millimeters,                        // The total travel of this block in mm
-        acceleration;                       // acceleration mm/sec^2
-
-  union {
-    abce_ulong_t steps;                     // Step count along each axis
-    abce_long_t position;                   // New position to force when this sync block is executed
-  };
-  uint32_t step_event_count;                // The number of step events required to complete this block
+  axis_bits_t direction_bits;               // The direction bit set for this block (refers to *_DIRECTION_BIT in config.h)
 
   #if HAS_MULTI_EXTRUDER
     uint8_t extruder;                       // The extruder to move (if E move)
@@ -216,10 +263,16 @@ typedef struct block_t {
     static constexpr uint8_t extruder = 0;
   #endif
 
-  #if ENABLED(MIXING_EXTRUDER)
-    mixer_comp_t b_color[MIXING_STEPPERS];  // Normalized color for the mixing steppers
+  #if ENABLED(LIN_ADVANCE)
+    bool use_advance_lead;
   #endif
 
+  union {
+    abce_ulong_t steps;                     // Step count along each axis
+    abce_long_t position;                   // New position to force when this sync block is executed
+  };
+  uint32_t step_event_count;                // The number of step events required to complete this block
+
   // Settings for the trapezoid generator
   uint32_t accelerate_until,                // The index of the step event on which to stop acceleration
            decelerate_after;                // The index of the step event on which to start decelerating
@@ -234,22 +287,21 @@ typedef struct block_t {
     uint32_t acceleration_rate;             // The acceleration rate used for acceleration calculation
   #endif
 
-  axis_bits_t direction_bits;               // The direction bit set for this block (refers to *_DIRECTION_BIT in config.h)
+  uint32_t nominal_rate,                    // The nominal step rate for this block in step_events/sec
+           initial_rate,                    // The jerk-adjusted step rate at start of block
+           final_rate;                      // The minimal rate at exit
 
   // Advance extrusion
   #if ENABLED(LIN_ADVANCE)
-    bool use_advance_lead;
-    uint16_t advance_speed,                 // STEP timer value for extruder speed offset ISR
-             max_adv_steps,                 // max. advance steps to get cruising speed pressure (not always nominal_speed!)
-             final_adv_steps;               // advance steps due to exit speed
-    float e_D_ratio;
+    #if ENABLED(LIN_ADVANCE_INTEGRATED)
+      uint32_t advance_gain;                // Pressure lead per step_event rate, Q24 E steps per step/s
+    #else
+      uint16_t advance_speed,               // STEP timer value for extruder speed offset ISR
+               max_adv_steps,               // max. advance steps to get cruising speed pressure (not always nominal_speed!)
+               final_adv_steps;             // advance steps due to exit speed
+    #endif
   #endif
 
-  uint32_t nominal_rate,                    // The nominal step rate for this block in step_events/sec
-           initial_rate,                    // The jerk-adjusted step rate at start of block
-           final_rate,                      // The minimal rate at exit
-           acceleration_steps_per_s2;       // acceleration steps/sec^2
-
   #if ENABLED(DIRECT_STEPPING)
     page_idx_t page_idx;                    // Page index used for direct stepping
   #endif
@@ -262,31 +314,108 @@ typedef struct block_t {
     uint8_t fan_speed[FAN_COUNT];
   #endif
 
-  #if ENABLED(BARICUDA)
-    uint8_t valve_pressure, e_to_p_pressure;
+  #if ENABLED(MIXING_EXTRUDER)
+    mixer_comp_t b_color[MIXING_STEPPERS];  // Normalized color for the mixing steppers
   #endif
 
-  #if HAS_WIRED_LCD
-    uint32_t segment_time_us;
+  #if ENABLED(NATIVE_ARCS)
+    block_arc_t arc;                        // Arc traced by the Stepper ISR
+  #endif
+
+  #if ENABLED(LASER_FEATURE)
+    block_laser_t laser;
   #endif
 
   #if ENABLED(POWER_LOSS_RECOVERY)
-    uint32_t sdpos;
+    uint32_t sdpos;                         // Copied to recovery.info as the block starts
     xyze_pos_t start_position;
   #endif
 
-  #if ENABLED(LASER_FEATURE)
-    block_laser_t laser;
+  // Fields used by the motion planner to manage acceleration
+  float nominal_speed_sqr,                  // The nominal speed for this block in (mm/sec)^2
+        entry_speed_sqr,                    // Entry speed at previous-current junction in (mm/sec)^2
+        max_entry_speed_sqr,                // Maximum allowable junction entry speed in (mm/sec)^2
+        millimeters,                        // The total travel of this block in mm
+        acceleration;                       // acceleration mm/sec^2
+
+  uint32_t acceleration_steps_per_s2;       // acceleration steps/sec^2
+
+  #if ENABLED(LIN_ADVANCE)
+    float e_D_ratio;
+  #endif
+
+  #if ENABLED(INSTANT_FEEDRATE_OVERRIDE)
+    float override_speed_sqr,               // Nominal speed at 100% feedrate, or 0 if feedrate_percentage doesn't apply
+          max_nominal_speed_sqr,            // The fastest the axis limits allow this block to go
+          max_junction_speed_sqr;           // Entry junction limit before the nominal speeds are applied
+    #if ENABLED(ACCEL_TORQUE_CURVE)
+      uint32_t torque_accel_cap;            // Acceleration before the torque curve, or 0 if it doesn't apply
+    #endif
+  #endif
+
+  #if HAS_BLOCK_RUNTIME
+    uint32_t segment_time_us;
+  #endif
+
+  #if ENABLED(BARICUDA)
+    uint8_t valve_pressure, e_to_p_pressure;
   #endif
 
 } block_t;
 
+// Bytes of a block_t the Stepper ISR reads, ahead of the planner-only fields
+#define BLOCK_STEPPER_BYTES offsetof(block_t, nominal_speed_sqr)
+
 #if ANY(LIN_ADVANCE, SCARA_FEEDRATE_SCALING, GRADIENT_MIX, LCD_SHOW_E_TOTAL, POWER_LOSS_RECOVERY)
   #define HAS_POSITION_FLOAT 1
 #endif
 
 #define BLOCK_MOD(n) ((n)&(BLOCK_BUFFER_SIZE-1))
 
+/**
+ * Ordering of the block buffer handoff. The planner is the only producer and the
+ * Stepper ISR the only consumer. A block is published by a release before the
+ * head moves (or before its RECALCULATE flag is cleared) and it's freed by a
+ * release before the tail moves. Each side acquires after reading the other's index.
+ */
+#if ENABLED(LOCKFREE_BLOCK_HANDOFF)
+  #define BLOCK_RELEASE() __atomic_thread_fence(__ATOMIC_RELEASE)
+  #define BLOCK_ACQUIRE() __atomic_thread_fence(__ATOMIC_ACQUIRE)
+  #define BLOCK_FENCE()   __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#else
+  #define BLOCK_RELEASE() NOOP
+  #define BLOCK_ACQUIRE() NOOP
+  #define BLOCK_FENCE()   NOOP
+#endif
+
+#if ENABLED(BLOCK_EXEC_TABLE)
+  /**
+   * Structure-of-Arrays "execution table" with one entry per block_buffer slot.
+   * Holds only what the Stepper ISR needs to run the trapezoid generator,
+   * written by the planner whenever a block's trapezoid is (re)calculated.
+   */
+  typedef struct {
+    uint32_t accelerate_until[BLOCK_BUFFER_SIZE],   // Step event on which to stop acceleration
+             decelerate_after[BLOCK_BUFFER_SIZE],   // Step event on which to start decelerating
+             initial_rate[BLOCK_BUFFER_SIZE],       // Entry step rate
+             nominal_rate[BLOCK_BUFFER_SIZE],       // Nominal step rate
+             final_rate[BLOCK_BUFFER_SIZE];         // Exit step rate
+    #if ENABLED(S_CURVE_ACCELERATION)
+      uint32_t cruise_rate[BLOCK_BUFFER_SIZE],      // Rate reached at the end of acceleration
+               acceleration_time[BLOCK_BUFFER_SIZE],// Ramp durations in STEP timer counts
+               deceleration_time[BLOCK_BUFFER_SIZE];
+      // Bézier speed curve coefficients for the acceleration [0] and deceleration [1] ramps
+      int32_t  bezier_A[2][BLOCK_BUFFER_SIZE],
+               bezier_B[2][BLOCK_BUFFER_SIZE],
+               bezier_C[2][BLOCK_BUFFER_SIZE];
+      uint32_t bezier_F[2][BLOCK_BUFFER_SIZE],
+               bezier_AV[2][BLOCK_BUFFER_SIZE];
+    #else
+      uint32_t acceleration_rate[BLOCK_BUFFER_SIZE];// Acceleration rate for the trapezoid
+    #endif
+  } block_exec_table_t;
+#endif
+
 #if ENABLED(LASER_FEATURE)
   typedef struct {
     /**
@@ -315,6 +444,31 @@ typedef struct {
             min_travel_feedrate_mm_s;           // (mm/s) M205 T - Minimum travel feedrate
 } planner_settings_t;
 
+#if ENABLED(MOTION_PROFILES)
+  constexpr const char *motion_profile_tag[] = MOTION_PROFILE_TAGS;
+  constexpr float motion_profile_accel[] = MOTION_PROFILE_ACCEL;
+  #define MOTION_PROFILE_COUNT COUNT(motion_profile_accel)
+  static_assert(COUNT(motion_profile_tag) == MOTION_PROFILE_COUNT, "MOTION_PROFILE_TAGS and MOTION_PROFILE_ACCEL must be the same size.");
+
+  typedef struct {
+    float acceleration;                         // (mm/s^2) M213 A - Print acceleration
+    #if HAS_JUNCTION_DEVIATION
+      float junction_deviation_mm;              // (mm) M213 J - Junction deviation
+    #endif
+  } motion_profile_t;
+#endif
+
+#if ENABLED(ACCEL_TORQUE_CURVE)
+  constexpr uint8_t accel_torque_speed[] = ACCEL_TORQUE_SPEEDS; // (% of max feedrate)
+  #define ACCEL_TORQUE_POINTS COUNT(accel_torque_speed)
+  constexpr bool accel_torque_ascending(const uint8_t i=1) {
+    return i >= ACCEL_TORQUE_POINTS || (accel_torque_speed[i - 1] < accel_torque_speed[i] && accel_torque_ascending(i + 1));
+  }
+  static_assert(ACCEL_TORQUE_POINTS >= 2, "ACCEL_TORQUE_SPEEDS needs at least 2 speeds.");
+  static_assert(accel_torque_speed[0] == 0 && accel_torque_speed[ACCEL_TORQUE_POINTS - 1] == 100 && accel_torque_ascending(),
+    "ACCEL_TORQUE_SPEEDS must be ascending, from 0 to 100.");
+#endif
+
 #if ENABLED(IMPROVE_HOMING_RELIABILITY)
   struct motion_state_t {
     TERN(DELTA, xyz_ulong_t, xy_ulong_t) acceleration;
@@ -344,10 +498,45 @@ typedef struct {
   #endif
 } skew_factor_t;
 
+#if ENABLED(FUSED_POSITION_TRANSFORM)
+  // An affine map of XYZ: out = row · in + offset
+  typedef struct {
+    xyz_float_t row[3], offset;
+    FORCE_INLINE void apply(xyz_pos_t &p) const {
+      const float x = p.x, y = p.y, z = p.z;
+      p.x = row[0].x * x + row[0].y * y + row[0].z * z + offset.x;
+      p.y = row[1].x * x + row[1].y * y + row[1].z * z + offset.y;
+      p.z = row[2].x * x + row[2].y * y + row[2].z * z + offset.z;
+    }
+  } affine_transform_t;
+#endif
+
+// Fans follow the blocks unless M106/M107 are synchronized
+#if HAS_FAN && DISABLED(LASER_SYNCHRONOUS_M106_M107)
+  #define HAS_TAIL_FAN_SPEED 1
+#endif
+
 #if ENABLED(DISABLE_INACTIVE_EXTRUDER)
   typedef IF<(BLOCK_BUFFER_SIZE > 64), uint16_t, uint8_t>::type last_move_t;
 #endif
 
+#if ENABLED(PLANNER_STAGING)
+  // A segment ready for buffer_segment, waiting for a free block
+  typedef struct {
+    abce_pos_t abce;
+    #if HAS_DIST_MM_ARG
+      xyze_float_t cart_dist_mm;
+    #endif
+    feedRate_t fr_mm_s;
+    float millimeters;
+    uint8_t extruder;
+    #if ENABLED(INSTANT_FEEDRATE_OVERRIDE)
+      bool override_scaled;
+      int16_t feedrate_percentage;             // The M220 factor already applied to fr_mm_s
+    #endif
+  } staged_segment_t;
+#endif
+
 class Planner {
   public:
 
@@ -370,8 +559,17 @@ class Planner {
                             block_buffer_planned,   // Index of the optimally planned block
                             block_buffer_tail;      // Index of the busy block, if any
     static uint16_t cleaning_buffer_counter;        // A counter to disable queuing of blocks
+    #if ENABLED(BLOCK_EXEC_TABLE)
+      static block_exec_table_t exec_table;         // Trapezoid terms for the Stepper ISR, indexed like block_buffer
+    #endif
     static uint8_t delay_before_delivering;         // This counter delays delivery of blocks when queue becomes empty to allow the opportunity of merging blocks
 
+    #if ENABLED(PLANNER_STAGING)
+      static staged_segment_t staged[PLANNER_STAGING_SIZE]; // Segments waiting for the planner, in order
+      static uint8_t staged_tail, staged_count;
+      static bool committing;                       // Segments go straight to the planner
+    #endif
+
 
     #if ENABLED(DISTINCT_E_FACTORS)
       static uint8_t last_extruder;                 // Respond to extruder change
@@ -397,6 +595,9 @@ class Planner {
     #if ENABLED(VOLUMETRIC_EXTRUDER_LIMIT)
       static float volumetric_extruder_limit[EXTRUDERS],          // Maximum mm^3/sec the extruder can handle
                    volumetric_extruder_feedrate_limit[EXTRUDERS]; // Feedrate limit (mm/s) calculated from volume limit
+      #if ENABLED(VOLUMETRIC_FLOW_SMOOTHING)
+        static float flow_average[EXTRUDERS];                   // E feedrate (mm/s) averaged over VOLUMETRIC_FLOW_SMOOTH_TIME
+      #endif
     #endif
 
     static planner_settings_t settings;
@@ -420,6 +621,15 @@ class Planner {
       static TERN(HAS_LINEAR_E_JERK, xyz_pos_t, xyze_pos_t) max_jerk;
     #endif
 
+    #if ENABLED(MOTION_PROFILES)
+      static motion_profile_t motion_profile[MOTION_PROFILE_COUNT]; // M213 - Per-feature print acceleration and junction deviation
+      static uint8_t motion_profile_index;          // 0 for the M204/M205 settings, else 1 + the active profile
+    #endif
+
+    #if ENABLED(ACCEL_TORQUE_CURVE)
+      static uint16_t accel_torque[XYZ][ACCEL_TORQUE_POINTS]; // M214 - (% of max acceleration) at each of accel_torque_speed
+    #endif
+
     #if HAS_LEVELING
       static bool leveling_active;          // Flag that bed leveling is enabled
       #if ABL_PLANAR
@@ -452,9 +662,22 @@ class Planner {
 
     static skew_factor_t skew_factor;
 
+    #if ENABLED(FUSED_POSITION_TRANSFORM)
+      // Skew and planar leveling as one map each way, [1] with the leveling
+      static affine_transform_t position_xform[1 + ENABLED(ABL_PLANAR)], position_unxform[1 + ENABLED(ABL_PLANAR)];
+      static xyz_pos_t xform_min, xform_max;  // Where skew is applied without its range checks
+    #endif
+
+    #if HAS_TAIL_FAN_SPEED
+      static uint8_t tail_fan_speed[FAN_COUNT];  // Fan speeds from the block being executed
+    #endif
+
     #if ENABLED(SD_ABORT_ON_ENDSTOP_HIT)
       static bool abort_on_endstop_hit;
     #endif
+    #if ENABLED(INSTANT_FEEDRATE_OVERRIDE)
+      static bool override_scaled;            // Moves being planned take their speed from feedrate_percentage
+    #endif
     #ifdef XY_FREQUENCY_LIMIT
       static int8_t xy_freq_limit_hz;         // Minimum XY frequency setting
       static float xy_freq_min_speed_factor;  // Minimum speed factor setting
@@ -499,7 +722,7 @@ class Planner {
       static last_move_t g_uc_extruder_last_move[E_STEPPERS];
     #endif
 
-    #if HAS_WIRED_LCD
+    #if HAS_BLOCK_RUNTIME
       volatile static uint32_t block_buffer_runtime_us; // Theoretical block buffer runtime in µs
     #endif
 
@@ -526,12 +749,21 @@ class Planner {
      */
     static void refresh_positioning();
 
+    #if ENABLED(FUSED_POSITION_TRANSFORM)
+      static void refresh_position_transform();
+    #endif
+
     // For an axis set the Maximum Acceleration in mm/s^2
     static void set_max_acceleration(const AxisEnum axis, float inMaxAccelMMS2);
 
     // For an axis set the Maximum Feedrate in mm/s
     static void set_max_feedrate(const AxisEnum axis, float inMaxFeedrateMMS);
 
+    #if ENABLED(INSTANT_FEEDRATE_OVERRIDE)
+      // Re-time the planned blocks when feedrate_percentage has changed
+      static void apply_feedrate_override();
+    #endif
+
     // For an axis set the Maximum Jerk (instant change) in mm/s
     #if HAS_CLASSIC_JERK
       static void set_max_jerk(const AxisEnum axis, float inMaxJerkMMS);
@@ -539,6 +771,16 @@ class Planner {
       static void set_max_jerk(const AxisEnum, const_float_t) {}
     #endif
 
+    // Print acceleration and junction deviation for new moves, from the active motion profile
+    FORCE_INLINE static float print_acceleration() {
+      return TERN_(MOTION_PROFILES, motion_profile_index ? motion_profile[motion_profile_index - 1].acceleration :) settings.acceleration;
+    }
+    #if HAS_JUNCTION_DEVIATION
+      FORCE_INLINE static float junction_deviation() {
+        return TERN_(MOTION_PROFILES, motion_profile_index ? motion_profile[motion_profile_index - 1].junction_deviation_mm :) junction_deviation_mm;
+      }
+    #endif
+
     #if HAS_EXTRUDERS
       FORCE_INLINE static void refresh_e_factor(const uint8_t e) {
         e_factor[e] = flow_percentage[e] * 0.01f * TERN(NO_VOLUMETRICS, 1.0f, volumetric_multiplier[e]);
@@ -592,7 +834,7 @@ class Planner {
 
       FORCE_INLINE static void set_filament_size(const uint8_t e, const_float_t v) {
         filament_size[e] = v;
-        if (v > 0) volumetric_area_nominal = CIRCLE_AREA(v * 0.5); //TODO: should it be per extruder
+        if (v > 0) volumetric_area_nominal = CIRCLE_AREA(v * 0.5f); //TODO: should it be per extruder
         // make sure all extruders have some sane value for the filament size
         LOOP_L_N(i, COUNT(filament_size))
           if (!filament_size[i]) filament_size[i] = DEFAULT_NOMINAL_FILAMENT_DIA;
@@ -698,17 +940,60 @@ class Planner {
     #endif
 
     #if HAS_POSITION_MODIFIERS
-      FORCE_INLINE static void apply_modifiers(xyze_pos_t &pos, bool leveling=ENABLED(PLANNER_LEVELING)) {
-        TERN_(SKEW_CORRECTION, skew(pos));
-        if (leveling) apply_leveling(pos);
-        TERN_(FWRETRACT, apply_retract(pos));
-      }
 
-      FORCE_INLINE static void unapply_modifiers(xyze_pos_t &pos, bool leveling=ENABLED(PLANNER_LEVELING)) {
-        TERN_(FWRETRACT, unapply_retract(pos));
-        if (leveling) unapply_leveling(pos);
-        TERN_(SKEW_CORRECTION, unskew(pos));
-      }
+      #if ENABLED(FUSED_POSITION_TRANSFORM)
+
+        FORCE_INLINE static bool xform_fits(const xyz_pos_t &p) {
+          return TERN1(SKEW_CORRECTION, WITHIN(p.x, xform_min.x, xform_max.x) && WITHIN(p.y, xform_min.y, xform_max.y) && WITHIN(p.z, xform_min.z, xform_max.z));
+        }
+
+        /**
+         * Skew and planar leveling are applied as one precomputed affine map, leaving
+         * only the mesh term and the retract offsets. Skew checks both ends of its
+         * range, so positions near the edges, where it might not apply, take
+         * the separate steps.
+         */
+        FORCE_INLINE static void apply_modifiers(xyze_pos_t &pos, bool leveling=ENABLED(PLANNER_LEVELING)) {
+          if (xform_fits(pos)) {
+            position_xform[TERN0(ABL_PLANAR, leveling && leveling_active)].apply(pos);
+            if (TERN0(HAS_MESH, leveling)) apply_leveling(pos);
+          }
+          else {
+            TERN_(SKEW_CORRECTION, skew(pos));
+            if (leveling) apply_leveling(pos);
+          }
+          TERN_(FWRETRACT, apply_retract(pos));
+        }
+
+        // The inverse map is exact wherever its result falls within the forward map's range
+        FORCE_INLINE static void unapply_modifiers(xyze_pos_t &pos, bool leveling=ENABLED(PLANNER_LEVELING)) {
+          TERN_(FWRETRACT, unapply_retract(pos));
+          if (TERN0(HAS_MESH, leveling)) unapply_leveling(pos);
+          const xyz_pos_t raw = pos;
+          position_unxform[TERN0(ABL_PLANAR, leveling && leveling_active)].apply(pos);
+          if (!xform_fits(pos)) {
+            pos = raw;
+            if (TERN0(ABL_PLANAR, leveling)) unapply_leveling(pos);
+            TERN_(SKEW_CORRECTION, unskew(pos));
+          }
+        }
+
+      #else
+
+        FORCE_INLINE static void apply_modifiers(xyze_pos_t &pos, bool leveling=ENABLED(PLANNER_LEVELING)) {
+          TERN_(SKEW_CORRECTION, skew(pos));
+          if (leveling) apply_leveling(pos);
+          TERN_(FWRETRACT, apply_retract(pos));
+        }
+
+        FORCE_INLINE static void unapply_modifiers(xyze_pos_t &pos, bool leveling=ENABLED(PLANNER_LEVELING)) {
+          TERN_(FWRETRACT, unapply_retract(pos));
+          if (leveling) unapply_leveling(pos);
+          TERN_(SKEW_CORRECTION, unskew(pos));
+        }
+
+      #endif
+
     #endif // HAS_POSITION_MODIFIERS
 
     // Number of moves currently in the planner including the busy block, if any
@@ -723,6 +1008,12 @@ class Planner {
     // Check if movement queue is full
     FORCE_INLINE static bool is_full() { return block_buffer_tail == next_block_index(block_buffer_head); }
 
+    #if ENABLED(PLANNER_STAGING)
+      // Give staged segments to the planner while it has room, or all of them
+      static void commit_staged(const bool all=false);
+      FORCE_INLINE static void flush_staged() { if (staged_count) commit_staged(true); }
+    #endif
+
     // Get count of movement slots free
     FORCE_INLINE static uint8_t moves_free() { return BLOCK_BUFFER_SIZE - 1 - movesplanned(); }
 
@@ -737,6 +1028,7 @@ class Planner {
 
       // Wait until there are enough slots free
       while (moves_free() < count) { idle(); }
+      BLOCK_ACQUIRE(); // The Stepper ISR is done with the freed blocks
 
       // Return the first available block
       next_buffer_head = next_block_index(block_buffer_head);
@@ -759,6 +1051,7 @@ class Planner {
       OPTARG(HAS_POSITION_FLOAT, const xyze_pos_t &target_float)
       OPTARG(HAS_DIST_MM_ARG, const xyze_float_t &cart_dist_mm)
       , feedRate_t fr_mm_s, const uint8_t extruder, const_float_t millimeters=0.0
+      OPTARG(NATIVE_ARCS, const arc_move_t * const arc=nullptr)
     );
 
     /**
@@ -782,8 +1075,14 @@ class Planner {
       OPTARG(HAS_POSITION_FLOAT, const xyze_pos_t &target_float)
       OPTARG(HAS_DIST_MM_ARG, const xyze_float_t &cart_dist_mm)
       , feedRate_t fr_mm_s, const uint8_t extruder, const_float_t millimeters=0.0
+      OPTARG(NATIVE_ARCS, const arc_move_t * const arc=nullptr)
     );
 
+    #if ENABLED(NATIVE_ARCS)
+      // Fill in the Stepper parameters of an arc ending at the given target. False if it can't be traced.
+      static bool prepare_arc(arc_move_t &arc, const abce_long_t &target, const uint8_t extruder);
+    #endif
+
     /**
      * Planner::buffer_sync_block
      * Add a block to the buffer that just updates the position
@@ -810,10 +1109,12 @@ class Planner {
      *  fr_mm_s     - (target) speed of the move
      *  extruder    - target extruder
      *  millimeters - the length of the movement, if known
+     *  arc         - the arc to trace, if not a linear movement
      */
     static bool buffer_segment(const abce_pos_t &abce
       OPTARG(HAS_DIST_MM_ARG, const xyze_float_t &cart_dist_mm)
       , const_feedRate_t fr_mm_s, const uint8_t extruder=active_extruder, const_float_t millimeters=0.0
+      OPTARG(NATIVE_ARCS, arc_move_t * const arc=nullptr)
     );
 
   public:
@@ -833,10 +1134,32 @@ class Planner {
       OPTARG(SCARA_FEEDRATE_SCALING, const_float_t inv_duration=0.0)
     );
 
+    #if ENABLED(NATIVE_ARCS)
+      /**
+       * Add an arc in the XY plane as a single block for the Stepper to trace.
+       * The target is cartesian. Return 'false' if the arc can't be a block,
+       * so the caller can fall back to linear segments.
+       *
+       *  cart     - target position in mm
+       *  arc      - center, angle and lengths of the arc
+       *  fr_mm_s  - (target) speed of the move (mm/s)
+       *  extruder - target extruder
+       */
+      static bool buffer_arc(const xyze_pos_t &cart, const arc_move_t &arc, const_feedRate_t fr_mm_s, const uint8_t extruder=active_extruder);
+    #endif
+
     #if ENABLED(DIRECT_STEPPING)
       static void buffer_page(const page_idx_t page_idx, const uint8_t extruder, const uint16_t num_steps);
     #endif
 
+    #if ENABLED(HOST_BLOCK_STREAM)
+      /**
+       * Add a block planned by the host, after checking it against the axis
+       * feedrate and acceleration limits. Return false if it was dropped.
+       */
+      static bool buffer_host_block(const host_block_t &hb);
+    #endif
+
     /**
      * Set the planner.position and individual stepper positions.
      * Used by G92, G28, G29, and other procedures.
@@ -938,11 +1261,13 @@ class Planner {
      * Called when the current block is no longer needed.
      */
     FORCE_INLINE static void release_current_block() {
-      if (has_blocks_queued())
+      if (has_blocks_queued()) {
+        BLOCK_RELEASE(); // Done reading the block
         block_buffer_tail = next_block_index(block_buffer_tail);
+      }
     }
 
-    #if HAS_WIRED_LCD
+    #if HAS_BLOCK_RUNTIME
       static uint16_t block_buffer_runtime();
       static void clear_block_buffer_runtime();
     #endif
@@ -956,6 +1281,15 @@ class Planner {
       static void autotemp_task();
     #endif
 
+    #if ENABLED(MPC_FEEDFORWARD)
+      static float e_speed_ahead(const_float_t window);
+    #endif
+
+    #if ENABLED(ACCEL_TORQUE_CURVE)
+      static float accel_torque_factor(const AxisEnum axis, const_float_t speed);
+      static uint32_t torque_limit_accel(const block_t * const block, const_float_t speed, uint32_t accel);
+    #endif
+
     #if HAS_LINEAR_E_JERK
       FORCE_INLINE static void recalculate_max_e_jerk() {
         const float prop = junction_deviation_mm * SQRT(0.5) / (1.0f - SQRT(0.5));
@@ -964,6 +1298,11 @@ class Planner {
       }
     #endif
 
+    #if BOTH(PLANNER_FIXED_POINT, MARLIN_DEV_MODE)
+      // Compare the float and fixed-point planner math on random blocks (D200)
+      static void bench_math(const uint32_t count);
+    #endif
+
   private:
 
     #if ENABLED(AUTOTEMP)
@@ -1020,6 +1359,20 @@ class Planner {
       }
     #endif
 
+    // Trapezoid of a block, as computed by the float or fixed-point path
+    typedef struct {
+      uint32_t initial_rate, final_rate,
+               accelerate_steps, decelerate_steps;
+      #if ENABLED(S_CURVE_ACCELERATION)
+        uint32_t cruise_rate, acceleration_time, deceleration_time;
+      #endif
+    } trapezoid_t;
+
+    static void trapezoid_float(trapezoid_t &t, const block_t * const block, const_float_t entry_factor, const_float_t exit_factor);
+    #if ENABLED(PLANNER_FIXED_POINT)
+      static void trapezoid_fixed(trapezoid_t &t, const block_t * const block, const_float_t entry_factor, const_float_t exit_factor);
+    #endif
+
     static void calculate_trapezoid_for_block(block_t * const block, const_float_t entry_factor, const_float_t exit_factor);
 
     static void reverse_pass_kernel(block_t * const current, const block_t * const next);
@@ -1028,7 +1381,7 @@ class Planner {
     static void reverse_pass();
     static void forward_pass();
 
-    static void recalculate_trapezoids();
+    static void recalculate_trapezoids(const uint8_t start_index);
 
     static void recalculate();
 
@@ -41,10 +41,15 @@ Stopwatch print_job_timer;      // Global Print Job Timer instance
   #include "../libs/buzzer.h"
 #endif
 
-#if PRINTCOUNTER_SYNC
+#if PRINTCOUNTER_SYNC || ENABLED(PRINTCOUNTER_WEAR)
   #include "../module/planner.h"
 #endif
 
+#if ENABLED(PRINTCOUNTER_WEAR)
+  #include "../module/stepper.h"
+  #include "../module/temperature.h"
+#endif
+
 // Service intervals
 #if HAS_SERVICE_INTERVALS
   #if SERVICE_INTERVAL_1 > 0
@@ -73,6 +78,46 @@ const PrintCounter::eeprom_address_t PrintCounter::address = STATS_EEPROM_ADDRES
 millis_t PrintCounter::lastDuration;
 bool PrintCounter::loaded = false;
 
+#if ENABLED(PRINTCOUNTER_WEAR)
+
+  printWear PrintCounter::wear;
+  volatile uint32_t PrintCounter::wear_steps[LINEAR_AXES];
+  uint32_t PrintCounter::wear_steps_seen[LINEAR_AXES];
+  float PrintCounter::wear_travel_mm[LINEAR_AXES];
+  millis_t PrintCounter::wear_ms;
+
+  // The wear counters and their magic byte take the top of the EEPROM
+  static_assert(sizeof(printWear) < 128, "PRINTCOUNTER_WEAR counters must fit in the top 128 bytes of the EEPROM.");
+  uint16_t PrintCounter::wearAddress() { return persistentStore.capacity() - 1 - sizeof(printWear); }
+
+  // Add the travel of blocks completed and the time since the last update
+  void PrintCounter::updateWear() {
+    LOOP_LINEAR_AXES(i) {
+      hal.isr_off();
+      const uint32_t steps = wear_steps[i];
+      hal.isr_on();
+      wear_travel_mm[i] += (steps - wear_steps_seen[i]) * planner.mm_per_step[i];
+      wear_steps_seen[i] = steps;
+      const uint32_t mm = wear_travel_mm[i];
+      wear.travel[i] += mm;
+      wear_travel_mm[i] -= mm;
+    }
+
+    const uint32_t sec = (millis() - wear_ms) / 1000UL;
+    wear_ms += sec * 1000UL;
+
+    if (stepper.axis_enabled.bits) wear.stepperTime += sec;
+    #if HAS_HOTEND
+      HOTEND_LOOP() if (thermalManager.degTargetHotend(e)) wear.heaterTime[e] += sec;
+    #endif
+    TERN_(HAS_HEATED_BED, if (thermalManager.degTargetBed()) wear.bedTime += sec);
+    #if HAS_FAN
+      FANS_LOOP(f) if (thermalManager.fan_speed[f]) { wear.fanTime += sec; break; }
+    #endif
+  }
+
+#endif // PRINTCOUNTER_WEAR
+
 millis_t PrintCounter::deltaDuration() {
   TERN_(DEBUG_PRINTCOUNTER, debug(PSTR("deltaDuration")));
   millis_t tmp = lastDuration;
@@ -113,9 +158,12 @@ void PrintCounter::initStats() {
     #endif
   };
 
+  TERN_(PRINTCOUNTER_WEAR, wear = {});
+
   saveStats();
   persistentStore.access_start();
   persistentStore.write_data(address, (uint8_t)0x16);
+  TERN_(PRINTCOUNTER_WEAR, persistentStore.write_data(wearAddress(), (uint8_t)0x57));
   persistentStore.access_finish();
 }
 
@@ -142,6 +190,20 @@ void PrintCounter::loadStats() {
     initStats();
   else
     persistentStore.read_data(address + sizeof(uint8_t), (uint8_t*)&data, sizeof(printStatistics));
+
+  #if ENABLED(PRINTCOUNTER_WEAR)
+    // Wear counters are kept apart, so enabling them keeps the statistics
+    persistentStore.read_data(wearAddress(), &value, sizeof(uint8_t));
+    if (value == 0x57)
+      persistentStore.read_data(wearAddress() + sizeof(uint8_t), (uint8_t*)&wear, sizeof(printWear));
+    else {
+      wear = {};
+      persistentStore.write_data(wearAddress(), (uint8_t)0x57);
+      persistentStore.write_data(wearAddress() + sizeof(uint8_t), (uint8_t*)&wear, sizeof(printWear));
+    }
+    wear_ms = millis();
+  #endif
+
   persistentStore.access_finish();
   loaded = true;
 
@@ -175,6 +237,7 @@ void PrintCounter::saveStats() {
   // Saves the struct to EEPROM
   persistentStore.access_start();
   persistentStore.write_data(address + sizeof(uint8_t), (uint8_t*)&data, sizeof(printStatistics));
+  TERN_(PRINTCOUNTER_WEAR, persistentStore.write_data(wearAddress() + sizeof(uint8_t), (uint8_t*)&wear, sizeof(printWear)));
   persistentStore.access_finish();
 
   TERN_(EXTENSIBLE_UI, ExtUI::onSettingsStored(true));
@@ -232,13 +295,39 @@ void PrintCounter::showStats() {
   #if SERVICE_INTERVAL_3 > 0
     _service_when(buffer, PSTR(SERVICE_NAME_3), data.nextService3);
   #endif
+
+  #if ENABLED(PRINTCOUNTER_WEAR)
+    SERIAL_ECHOPGM(STR_STATS "Travel (m):");
+    LOOP_LINEAR_AXES(i) SERIAL_ECHOPGM(" ", AS_CHAR(AXIS_CHAR(i)), ":", wear.travel[i] / 1000);
+    SERIAL_ECHOLNPGM(", Steppers on: ", duration_t(wear.stepperTime).toString(buffer));
+    #if HAS_HOTEND
+      HOTEND_LOOP() SERIAL_ECHOLNPGM(STR_STATS "Hotend ", e, " heating: ", duration_t(wear.heaterTime[e]).toString(buffer));
+    #endif
+    #if HAS_HEATED_BED
+      SERIAL_ECHOLNPGM(STR_STATS "Bed heating: ", duration_t(wear.bedTime).toString(buffer));
+    #endif
+    #if HAS_FAN
+      SERIAL_ECHOLNPGM(STR_STATS "Fans on: ", duration_t(wear.fanTime).toString(buffer));
+    #endif
+    #if HAS_MULTI_EXTRUDER
+      SERIAL_ECHOLNPGM(STR_STATS "Tool changes: ", wear.toolChanges);
+    #endif
+  #endif
 }
 
 void PrintCounter::tick() {
-  if (!isRunning()) return;
-
   millis_t now = millis();
 
+  #if ENABLED(PRINTCOUNTER_WEAR)
+    static millis_t wear_next; // = 0
+    if (isLoaded() && ELAPSED(now, wear_next)) {
+      wear_next = now + updateInterval;
+      updateWear();
+    }
+  #endif
+
+  if (!isRunning()) return;
+
   static millis_t update_next; // = 0
   if (ELAPSED(now, update_next)) {
     update_next = now + updateInterval;
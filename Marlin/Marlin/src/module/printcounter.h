@@ -31,6 +31,25 @@
 // Round up I2C / SPI address to next page boundary (assuming 32 byte pages)
 #define STATS_EEPROM_ADDRESS TERN(USE_WIRED_EEPROM, 0x40, 0x32)
 
+#if ENABLED(PRINTCOUNTER_WEAR)
+  struct printWear {
+    uint32_t travel[LINEAR_AXES];   // Motor travel of each axis in mm
+    uint32_t stepperTime;           // Seconds with any stepper enabled
+    #if HAS_HOTEND
+      uint32_t heaterTime[HOTENDS]; // Seconds with each hotend set to heat
+    #endif
+    #if HAS_HEATED_BED
+      uint32_t bedTime;             // Seconds with the bed set to heat
+    #endif
+    #if HAS_FAN
+      uint32_t fanTime;             // Seconds with any fan on
+    #endif
+    #if HAS_MULTI_EXTRUDER
+      uint32_t toolChanges;         // Tool changes
+    #endif
+  };
+#endif
+
 struct printStatistics {    // 16 bytes
   //const uint8_t magic;    // Magic header, it will always be 0x16
   uint16_t totalPrints;     // Number of prints
@@ -95,6 +114,15 @@ class PrintCounter: public Stopwatch {
      */
     static bool loaded;
 
+    #if ENABLED(PRINTCOUNTER_WEAR)
+      static printWear wear;
+      static uint32_t wear_steps_seen[LINEAR_AXES]; // wear_steps at the last update
+      static float wear_travel_mm[LINEAR_AXES];     // Travel not yet added to wear.travel
+      static millis_t wear_ms;                      // Time of the last wear update
+      static void updateWear();
+      static uint16_t wearAddress();
+    #endif
+
   protected:
     /**
      * @brief dT since the last call
@@ -163,6 +191,20 @@ class PrintCounter: public Stopwatch {
      */
     static printStatistics getStats() { return data; }
 
+    #if ENABLED(PRINTCOUNTER_WEAR)
+      // Steps of completed blocks, added by the Stepper ISR
+      static volatile uint32_t wear_steps[LINEAR_AXES];
+      static void block_completed(const abce_ulong_t &steps) {
+        LOOP_LINEAR_AXES(i) wear_steps[i] += steps[i];
+      }
+
+      #if HAS_MULTI_EXTRUDER
+        static void incToolChanges() { wear.toolChanges++; }
+      #endif
+
+      static printWear getWear() { return wear; }
+    #endif
+
     /**
      * @brief Loop function
      * @details This function should be called at loop, it will take care of
@@ -98,6 +98,15 @@ Probe probe;
 
 xyz_pos_t Probe::offset; // Initialized by settings.load()
 
+#if ENABLED(PROBE_FLYBY)
+  float Probe::flyby_z = NAN;
+#endif
+
+#if ENABLED(ADAPTIVE_PROBING)
+  static_assert(ADAPTIVE_PROBING_TOLERANCE > 0, "ADAPTIVE_PROBING_TOLERANCE must be greater than 0.");
+  uint8_t Probe::samples; // = 0
+#endif
+
 #if HAS_PROBE_XY_OFFSET
   const xy_pos_t &Probe::offset_xy = Probe::offset;
 #endif
@@ -410,7 +419,19 @@ FORCE_INLINE void probe_specific_action(const bool deploy) {
     DEBUG_EOL();
 
     TERN_(WAIT_FOR_NOZZLE_HEAT, if (hotend_temp > thermalManager.wholeDegHotend(0) + (TEMP_WINDOW)) thermalManager.wait_for_hotend(0));
-    TERN_(WAIT_FOR_BED_HEAT,    if (bed_temp    > thermalManager.wholeDegBed() + (TEMP_BED_WINDOW)) thermalManager.wait_for_bed_heating());
+    #if BOTH(WAIT_FOR_BED_HEAT, PTC_BED_SOAK)
+      // Probe through the rest of the heat-up. Bed compensation refers each point to the target.
+      const celsius_t bed_soak = _MIN(bed_temp, celsius_t(PTC_BED_SOAK_MIN));
+      if (bed_soak > thermalManager.wholeDegBed() && thermalManager.isHeatingBed()) {
+        LCD_MESSAGE(MSG_BED_HEATING);
+        wait_for_heatup = true;
+        while (wait_for_heatup && thermalManager.wholeDegBed() < bed_soak) idle();
+        wait_for_heatup = false;
+        ui.reset_status();
+      }
+    #else
+      TERN_(WAIT_FOR_BED_HEAT,  if (bed_temp    > thermalManager.wholeDegBed() + (TEMP_BED_WINDOW)) thermalManager.wait_for_bed_heating());
+    #endif
   }
 
 #endif
@@ -633,7 +654,7 @@ bool Probe::probe_down_to_z(const_float_t z, const_feedRate_t fr_mm_s) {
  *
  * @return The Z position of the bed at the current XY or NAN on error.
  */
-float Probe::run_z_probe(const bool sanity_check/*=true*/) {
+float Probe::run_z_probe(const bool sanity_check/*=true*/ OPTARG(PROBE_FLYBY, const bool flyby/*=false*/)) {
   DEBUG_SECTION(log_probe, "Probe::run_z_probe", DEBUGGING(LEVELING));
 
   auto try_to_probe = [&](PGM_P const plbl, const_float_t z_probe_low_point, const feedRate_t fr_mm_s, const bool scheck, const float clearance) -> bool {
@@ -667,15 +688,18 @@ float Probe::run_z_probe(const bool sanity_check/*=true*/) {
     // Attempt to tare the probe
     if (TERN0(PROBE_TARE, tare())) return NAN;
 
-    // Do a first probe at the fast speed
-    if (try_to_probe(PSTR("FAST"), z_probe_low_point, z_probe_fast_mm_s,
-                     sanity_check, Z_CLEARANCE_BETWEEN_PROBES) ) return NAN;
+    // Do a first probe at the fast speed, unless already just above the bed
+    float first_probe_z = NAN;
+    if (TERN1(PROBE_FLYBY, !flyby)) {
+      if (try_to_probe(PSTR("FAST"), z_probe_low_point, z_probe_fast_mm_s,
+                       sanity_check, Z_CLEARANCE_BETWEEN_PROBES) ) return NAN;
 
-    const float first_probe_z = DIFF_TERN(HAS_DELTA_SENSORLESS_PROBING, current_position.z, largest_sensorless_adj);
-    if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("1st Probe Z:", first_probe_z);
+      first_probe_z = DIFF_TERN(HAS_DELTA_SENSORLESS_PROBING, current_position.z, largest_sensorless_adj);
+      if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("1st Probe Z:", first_probe_z);
 
-    // Raise to give the probe clearance
-    do_blocking_move_to_z(current_position.z + Z_CLEARANCE_MULTI_PROBE, z_probe_fast_mm_s);
+      // Raise to give the probe clearance
+      do_blocking_move_to_z(current_position.z + Z_CLEARANCE_MULTI_PROBE, z_probe_fast_mm_s);
+    }
 
   #elif Z_PROBE_FEEDRATE_FAST != Z_PROBE_FEEDRATE_SLOW
 
@@ -689,23 +713,17 @@ float Probe::run_z_probe(const bool sanity_check/*=true*/) {
     }
   #endif
 
-  #if EXTRA_PROBING > 0
-    float probes[TOTAL_PROBING];
+  #if TOTAL_PROBING != 2
+    TERN_(PROBE_FLYBY, UNUSED(flyby)); // Only skips the fast probe of a double-probe
   #endif
 
-  #if TOTAL_PROBING > 2
-    float probes_z_sum = 0;
-    for (
-      #if EXTRA_PROBING > 0
-        uint8_t p = 0; p < TOTAL_PROBING; p++
-      #else
-        uint8_t p = TOTAL_PROBING; p--;
-      #endif
-    )
-  #endif
-    {
+  #if ENABLED(ADAPTIVE_PROBING)
+
+    // Tap until most of the taps agree on their median, or ADAPTIVE_PROBING_MAX is reached
+    float probes[ADAPTIVE_PROBING_MAX], measured_z;
+    for (uint8_t n = 0;;) {
       // If the probe won't tare, return
-      if (TERN0(PROBE_TARE, tare())) return true;
+      if (TERN0(PROBE_TARE, tare())) return NAN;
 
       // Probe downward slowly to find the bed
       if (try_to_probe(PSTR("SLOW"), z_probe_low_point, MMM_TO_MMS(Z_PROBE_FEEDRATE_SLOW),
@@ -714,67 +732,122 @@ float Probe::run_z_probe(const bool sanity_check/*=true*/) {
       TERN_(MEASURE_BACKLASH_WHEN_PROBING, backlash.measure_with_probe());
 
       const float z = DIFF_TERN(HAS_DELTA_SENSORLESS_PROBING, current_position.z, largest_sensorless_adj);
+      if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("Tap ", n + 1, " Z:", z);
 
-      #if EXTRA_PROBING > 0
-        // Insert Z measurement into probes[]. Keep it sorted ascending.
-        LOOP_LE_N(i, p) {                            // Iterate the saved Zs to insert the new Z
-          if (i == p || probes[i] > z) {                              // Last index or new Z is smaller than this Z
-            for (int8_t m = p; --m >= i;) probes[m + 1] = probes[m];  // Shift items down after the insertion point
-            probes[i] = z;                                            // Insert the new Z measurement
-            break;                                                    // Only one to insert. Done!
-          }
+      // Insert Z measurement into probes[]. Keep it sorted ascending.
+      uint8_t i = n++;
+      for (; i && probes[i - 1] > z; --i) probes[i] = probes[i - 1];
+      probes[i] = z;
+
+      if (n >= 2) {
+        const float median = (n & 1) ? probes[n / 2] : (probes[n / 2 - 1] + probes[n / 2]) * 0.5f;
+
+        // Average the taps near the median. Accept them if they're the majority.
+        float agree_sum = 0;
+        uint8_t agree = 0;
+        LOOP_L_N(j, n) if (ABS(probes[j] - median) <= float(ADAPTIVE_PROBING_TOLERANCE)) { agree_sum += probes[j]; agree++; }
+
+        if (agree >= 2 && agree * 2 > n) { measured_z = agree_sum / agree; samples = n; break; }
+        if (n == ADAPTIVE_PROBING_MAX) {
+          SERIAL_ECHOLNPGM("Probe taps disagree. Using the median of ", n, ".");
+          measured_z = median; samples = n; break;
         }
-      #elif TOTAL_PROBING > 2
-        probes_z_sum += z;
-      #else
-        UNUSED(z);
-      #endif
+      }
 
-      #if TOTAL_PROBING > 2
-        // Small Z raise after all but the last probe
-        if (p
-          #if EXTRA_PROBING > 0
-            < TOTAL_PROBING - 1
-          #endif
-        ) do_blocking_move_to_z(z + Z_CLEARANCE_MULTI_PROBE, z_probe_fast_mm_s);
-      #endif
+      // Small Z raise before the next tap
+      do_blocking_move_to_z(z + Z_CLEARANCE_MULTI_PROBE, z_probe_fast_mm_s);
     }
 
-  #if TOTAL_PROBING > 2
+  #else
 
     #if EXTRA_PROBING > 0
-      // Take the center value (or average the two middle values) as the median
-      static constexpr int PHALF = (TOTAL_PROBING - 1) / 2;
-      const float middle = probes[PHALF],
-                  median = ((TOTAL_PROBING) & 1) ? middle : (middle + probes[PHALF + 1]) * 0.5f;
+      float probes[TOTAL_PROBING];
+    #endif
 
-      // Remove values farthest from the median
-      uint8_t min_avg_idx = 0, max_avg_idx = TOTAL_PROBING - 1;
-      for (uint8_t i = EXTRA_PROBING; i--;)
-        if (ABS(probes[max_avg_idx] - median) > ABS(probes[min_avg_idx] - median))
-          max_avg_idx--; else min_avg_idx++;
+    #if TOTAL_PROBING > 2
+      float probes_z_sum = 0;
+      for (
+        #if EXTRA_PROBING > 0
+          uint8_t p = 0; p < TOTAL_PROBING; p++
+        #else
+          uint8_t p = TOTAL_PROBING; p--;
+        #endif
+      )
+    #endif
+      {
+        // If the probe won't tare, return
+        if (TERN0(PROBE_TARE, tare())) return true;
+
+        // Probe downward slowly to find the bed
+        if (try_to_probe(PSTR("SLOW"), z_probe_low_point, MMM_TO_MMS(Z_PROBE_FEEDRATE_SLOW),
+                         sanity_check, Z_CLEARANCE_MULTI_PROBE) ) return NAN;
+
+        TERN_(MEASURE_BACKLASH_WHEN_PROBING, backlash.measure_with_probe());
+
+        const float z = DIFF_TERN(HAS_DELTA_SENSORLESS_PROBING, current_position.z, largest_sensorless_adj);
+
+        #if EXTRA_PROBING > 0
+          // Insert Z measurement into probes[]. Keep it sorted ascending.
+          LOOP_LE_N(i, p) {                            // Iterate the saved Zs to insert the new Z
+            if (i == p || probes[i] > z) {                              // Last index or new Z is smaller than this Z
+              for (int8_t m = p; --m >= i;) probes[m + 1] = probes[m];  // Shift items down after the insertion point
+              probes[i] = z;                                            // Insert the new Z measurement
+              break;                                                    // Only one to insert. Done!
+            }
+          }
+        #elif TOTAL_PROBING > 2
+          probes_z_sum += z;
+        #else
+          UNUSED(z);
+        #endif
+
+        #if TOTAL_PROBING > 2
+          // Small Z raise after all but the last probe
+          if (p
+            #if EXTRA_PROBING > 0
+              < TOTAL_PROBING - 1
+            #endif
+          ) do_blocking_move_to_z(z + Z_CLEARANCE_MULTI_PROBE, z_probe_fast_mm_s);
+        #endif
+      }
 
-      // Return the average value of all remaining probes.
-      LOOP_S_LE_N(i, min_avg_idx, max_avg_idx)
-        probes_z_sum += probes[i];
+    #if TOTAL_PROBING > 2
 
-    #endif
+      #if EXTRA_PROBING > 0
+        // Take the center value (or average the two middle values) as the median
+        static constexpr int PHALF = (TOTAL_PROBING - 1) / 2;
+        const float middle = probes[PHALF],
+                    median = ((TOTAL_PROBING) & 1) ? middle : (middle + probes[PHALF + 1]) * 0.5f;
+
+        // Remove values farthest from the median
+        uint8_t min_avg_idx = 0, max_avg_idx = TOTAL_PROBING - 1;
+        for (uint8_t i = EXTRA_PROBING; i--;)
+          if (ABS(probes[max_avg_idx] - median) > ABS(probes[min_avg_idx] - median))
+            max_avg_idx--; else min_avg_idx++;
 
-    const float measured_z = probes_z_sum * RECIPROCAL(MULTIPLE_PROBING);
+        // Return the average value of all remaining probes.
+        LOOP_S_LE_N(i, min_avg_idx, max_avg_idx)
+          probes_z_sum += probes[i];
 
-  #elif TOTAL_PROBING == 2
+      #endif
 
-    const float z2 = DIFF_TERN(HAS_DELTA_SENSORLESS_PROBING, current_position.z, largest_sensorless_adj);
+      const float measured_z = probes_z_sum * RECIPROCAL(MULTIPLE_PROBING);
 
-    if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("2nd Probe Z:", z2, " Discrepancy:", first_probe_z - z2);
+    #elif TOTAL_PROBING == 2
 
-    // Return a weighted average of the fast and slow probes
-    const float measured_z = (z2 * 3.0 + first_probe_z * 2.0) * 0.2;
+      const float z2 = DIFF_TERN(HAS_DELTA_SENSORLESS_PROBING, current_position.z, largest_sensorless_adj);
 
-  #else
+      if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("2nd Probe Z:", z2, " Discrepancy:", first_probe_z - z2);
+
+      // Return a weighted average of the fast and slow probes, or the slow probe alone
+      const float measured_z = isnan(first_probe_z) ? z2 : (z2 * 3.0 + first_probe_z * 2.0) * 0.2;
+
+    #else
+
+      // Return the single probe result
+      const float measured_z = current_position.z;
 
-    // Return the single probe result
-    const float measured_z = current_position.z;
+    #endif
 
   #endif
 
@@ -819,24 +892,48 @@ float Probe::probe_at_point(const_float_t rx, const_float_t ry, const ProbePtRai
   }
   if (probe_relative) npos -= offset_xy;  // Get the nozzle position
 
+  #if ENABLED(PROBE_FLYBY)
+    // Still low after the last point? Then travel at that height.
+    bool flyby = !isnan(flyby_z) && NEAR(current_position.z, flyby_z + (PROBE_FLYBY_CLEARANCE));
+    flyby_z = NAN;
+  #endif
+
   // Move the probe to the starting XYZ
   do_blocking_move_to(npos, feedRate_t(XY_PROBE_FEEDRATE_MM_S));
 
   float measured_z = NAN;
   if (!deploy()) {
-    measured_z = run_z_probe(sanity_check) + offset.z;
+    #if ENABLED(PROBE_FLYBY)
+      // The bed rose into the probe during the travel. Probe from the usual clearance.
+      if (flyby && PROBE_TRIGGERED()) {
+        do_blocking_move_to_z(current_position.z + Z_CLEARANCE_BETWEEN_PROBES, z_probe_fast_mm_s);
+        flyby = false;
+      }
+    #endif
+    measured_z = run_z_probe(sanity_check OPTARG(PROBE_FLYBY, flyby)) + offset.z;
     TERN_(HAS_PTC, ptc.apply_compensation(measured_z));
     TERN_(X_AXIS_TWIST_COMPENSATION, measured_z += xatc.compensation(npos + offset_xy));
   }
   if (!isnan(measured_z)) {
     const bool big_raise = raise_after == PROBE_PT_BIG_RAISE;
+    #if ENABLED(PROBE_FLYBY)
+      if (raise_after == PROBE_PT_RAISE) {
+        // Stay low for the next point
+        flyby_z = current_position.z;
+        do_blocking_move_to_z(flyby_z + (PROBE_FLYBY_CLEARANCE), z_probe_fast_mm_s);
+      }
+      else
+    #endif
     if (big_raise || raise_after == PROBE_PT_RAISE)
       do_blocking_move_to_z(current_position.z + (big_raise ? 25 : Z_CLEARANCE_BETWEEN_PROBES), z_probe_fast_mm_s);
     else if (raise_after == PROBE_PT_STOW || raise_after == PROBE_PT_LAST_STOW)
       if (stow()) measured_z = NAN;   // Error on stow?
 
-    if (verbose_level > 2)
-      SERIAL_ECHOLNPGM("Bed X: ", LOGICAL_X_POSITION(rx), " Y: ", LOGICAL_Y_POSITION(ry), " Z: ", measured_z);
+    if (verbose_level > 2) {
+      SERIAL_ECHOPGM("Bed X: ", LOGICAL_X_POSITION(rx), " Y: ", LOGICAL_Y_POSITION(ry), " Z: ", measured_z);
+      TERN_(ADAPTIVE_PROBING, SERIAL_ECHOPGM(" Taps: ", samples));
+      SERIAL_EOL();
+    }
   }
 
   if (isnan(measured_z)) {
@@ -850,6 +947,32 @@ float Probe::probe_at_point(const_float_t rx, const_float_t ry, const ProbePtRai
   return measured_z;
 }
 
+#if ENABLED(M48_FAST_TAPS)
+
+  /**
+   * Raise the deployed probe a short way over the last trigger point and
+   * probe down once at the slow rate. Return the bed Z, or NAN on failure.
+   */
+  float Probe::tap(const_float_t raise) {
+    do_blocking_move_to_z(current_position.z + raise, z_probe_fast_mm_s);
+
+    if (TERN0(PROBE_TARE, tare())) return NAN;
+
+    const float z_probe_low_point = -offset.z + Z_PROBE_LOW_POINT;
+    if (probe_down_to_z(z_probe_low_point, MMM_TO_MMS(Z_PROBE_FEEDRATE_SLOW))) {
+      LCD_MESSAGE(MSG_LCD_PROBING_FAILED);
+      SERIAL_ERROR_MSG(STR_ERR_PROBING_FAILED);
+      return NAN;
+    }
+
+    float measured_z = DIFF_TERN(HAS_DELTA_SENSORLESS_PROBING, current_position.z, largest_sensorless_adj) + offset.z;
+    TERN_(HAS_PTC, ptc.apply_compensation(measured_z));
+    TERN_(X_AXIS_TWIST_COMPENSATION, measured_z += xatc.compensation(xy_pos_t(current_position) + offset_xy));
+    return measured_z;
+  }
+
+#endif
+
 #if HAS_Z_SERVO_PROBE
 
   void Probe::servo_probe_init() {
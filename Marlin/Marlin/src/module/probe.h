@@ -301,6 +301,11 @@ public:
     static bool tare();
   #endif
 
+  #if ENABLED(M48_FAST_TAPS)
+    // Raise a little and probe again slowly, staying at the current XY
+    static float tap(const_float_t raise);
+  #endif
+
   // Basic functions for Sensorless Homing and Probing
   #if USE_SENSORLESS
     static void enable_stallguard_diag1();
@@ -309,10 +314,18 @@ public:
     static void refresh_largest_sensorless_adj();
   #endif
 
+  #if ENABLED(ADAPTIVE_PROBING)
+    static uint8_t samples;     // Taps at the last probed point
+  #endif
+
 private:
   static bool probe_down_to_z(const_float_t z, const_feedRate_t fr_mm_s);
   static void do_z_raise(const float z_raise);
-  static float run_z_probe(const bool sanity_check=true);
+  static float run_z_probe(const bool sanity_check=true OPTARG(PROBE_FLYBY, const bool flyby=false));
+
+  #if ENABLED(PROBE_FLYBY)
+    static float flyby_z;       // Trigger Z of the last point, if the probe stayed low for the next
+  #endif
 };
 
 extern Probe probe;
@@ -153,6 +153,14 @@
   #include "../lcd/tft_io/touch_calibration.h"
 #endif
 
+#if ENABLED(TFT_FSMC_CALIBRATION)
+  #include "../lcd/tft_io/tft_io.h"
+#endif
+
+#if ENABLED(MEMORY_PROFILES)
+  #include "../feature/memory_profile.h"
+#endif
+
 #if HAS_ETHERNET
   #include "../feature/ethernet.h"
 #endif
@@ -407,6 +415,14 @@ typedef struct SettingsDataStruct {
     uint8_t sleep_timeout_minutes;                      // M255 S
   #endif
 
+  //
+  // Display Motion Priority
+  //
+  #if ENABLED(UI_MOTION_PRIORITY)
+    uint8_t ui_motion_min_moves, ui_frame_budget_ms;    // M257 P B
+    uint16_t ui_frame_hold_max_ms;                      // M257 H
+  #endif
+
   //
   // Controller fan settings
   //
@@ -528,6 +544,20 @@ typedef struct SettingsDataStruct {
     touch_calibration_t touch_calibration_data;
   #endif
 
+  //
+  // TFT_FSMC_CALIBRATION
+  //
+  #if ENABLED(TFT_FSMC_CALIBRATION)
+    uint16_t tft_fsmc_write_timing;
+  #endif
+
+  //
+  // MEMORY_PROFILES
+  //
+  #if ENABLED(MEMORY_PROFILES)
+    uint8_t memory_profile;                             // M102 P
+  #endif
+
   // Ethernet settings
   #if HAS_ETHERNET
     bool ethernet_hardware_enabled;                     // M552 S
@@ -572,6 +602,18 @@ typedef struct SettingsDataStruct {
     MPC_t mpc_constants[HOTENDS];                       // M306
   #endif
 
+  //
+  // Input Shaping
+  //
+  #if ENABLED(INPUT_SHAPING_X)
+    float shaping_x_frequency, shaping_x_zeta;          // M593 X F D
+    ShaperType shaping_x_type;                          // M593 X T
+  #endif
+  #if ENABLED(INPUT_SHAPING_Y)
+    float shaping_y_frequency, shaping_y_zeta;          // M593 Y F D
+    ShaperType shaping_y_type;                          // M593 Y T
+  #endif
+
 } SettingsData;
 
 //static_assert(sizeof(SettingsData) <= MARLIN_EEPROM_SIZE, "EEPROM too small to contain SettingsData!");
@@ -615,16 +657,22 @@ void MarlinSettings::postprocess() {
 
   TERN_(ENABLE_LEVELING_FADE_HEIGHT, set_z_fade_height(new_z_fade_height, false)); // false = no report
 
-  TERN_(AUTO_BED_LEVELING_BILINEAR, bedlevel.refresh_bed_level());
+  TERN_(HAS_MESH_REFRESH, bedlevel.refresh_bed_level());
+
+  TERN_(FUSED_POSITION_TRANSFORM, planner.refresh_position_transform());
 
   TERN_(HAS_MOTOR_CURRENT_PWM, stepper.refresh_motor_power());
 
+  TERN_(HAS_SHAPING, stepper.refresh_shaping());
+
   TERN_(FWRETRACT, fwretract.refresh_autoretract());
 
   TERN_(HAS_LINEAR_E_JERK, planner.recalculate_max_e_jerk());
 
   TERN_(CASELIGHT_USES_BRIGHTNESS, caselight.update_brightness());
 
+  TERN_(TFT_FSMC_CALIBRATION, TFT_IO::io.ApplyWriteTiming());
+
   TERN_(EXTENSIBLE_UI, ExtUI::onPostprocessSettings());
 
   // Refresh mm_per_step with the reciprocal of axis_steps_per_mm
@@ -1143,6 +1191,16 @@ void MarlinSettings::postprocess() {
       EEPROM_WRITE(ui.sleep_timeout_minutes);
     #endif
 
+    //
+    // Display Motion Priority
+    //
+    #if ENABLED(UI_MOTION_PRIORITY)
+      _FIELD_TEST(ui_motion_min_moves);
+      EEPROM_WRITE(ui.motion_min_moves);
+      EEPROM_WRITE(ui.frame_budget_ms);
+      EEPROM_WRITE(ui.frame_hold_max_ms);
+    #endif
+
     //
     // Controller Fan
     //
@@ -1516,6 +1574,20 @@ void MarlinSettings::postprocess() {
       EEPROM_WRITE(touch_calibration.calibration);
     #endif
 
+    //
+    // TFT_FSMC_CALIBRATION
+    //
+    #if ENABLED(TFT_FSMC_CALIBRATION)
+      EEPROM_WRITE(TFT_IO::io.write_timing);
+    #endif
+
+    //
+    // MEMORY_PROFILES
+    //
+    #if ENABLED(MEMORY_PROFILES)
+      EEPROM_WRITE(memory_profile.saved);
+    #endif
+
     //
     // Ethernet network info
     //
@@ -1574,6 +1646,20 @@ void MarlinSettings::postprocess() {
         EEPROM_WRITE(thermalManager.temp_hotend[e].constants);
     #endif
 
+    //
+    // Input Shaping
+    //
+    #if ENABLED(INPUT_SHAPING_X)
+      EEPROM_WRITE(stepper.shaping_x.frequency);
+      EEPROM_WRITE(stepper.shaping_x.zeta);
+      EEPROM_WRITE(stepper.shaping_x.type);
+    #endif
+    #if ENABLED(INPUT_SHAPING_Y)
+      EEPROM_WRITE(stepper.shaping_y.frequency);
+      EEPROM_WRITE(stepper.shaping_y.zeta);
+      EEPROM_WRITE(stepper.shaping_y.type);
+    #endif
+
     //
     // Report final CRC and Data Size
     //
@@ -2062,6 +2148,16 @@ void MarlinSettings::postprocess() {
         EEPROM_READ(ui.sleep_timeout_minutes);
       #endif
 
+      //
+      // Display Motion Priority
+      //
+      #if ENABLED(UI_MOTION_PRIORITY)
+        _FIELD_TEST(ui_motion_min_moves);
+        EEPROM_READ(ui.motion_min_moves);
+        EEPROM_READ(ui.frame_budget_ms);
+        EEPROM_READ(ui.frame_hold_max_ms);
+      #endif
+
       //
       // Controller Fan
       //
@@ -2460,6 +2556,26 @@ void MarlinSettings::postprocess() {
         EEPROM_READ(touch_calibration.calibration);
       #endif
 
+      //
+      // TFT_FSMC_CALIBRATION
+      //
+      #if ENABLED(TFT_FSMC_CALIBRATION)
+        _FIELD_TEST(tft_fsmc_write_timing);
+        EEPROM_READ(TFT_IO::io.write_timing);
+      #endif
+
+      //
+      // MEMORY_PROFILES
+      //
+      #if ENABLED(MEMORY_PROFILES)
+      {
+        _FIELD_TEST(memory_profile);
+        uint8_t profile;
+        EEPROM_READ(profile);
+        if (!validating) memory_profile.saved = profile < MemoryProfile::PROFILES ? profile : 0;
+      }
+      #endif
+
       //
       // Ethernet network info
       //
@@ -2522,6 +2638,26 @@ void MarlinSettings::postprocess() {
       }
       #endif
 
+      //
+      // Input Shaping
+      //
+      #if ENABLED(INPUT_SHAPING_X)
+      {
+        _FIELD_TEST(shaping_x_frequency);
+        EEPROM_READ(stepper.shaping_x.frequency);
+        EEPROM_READ(stepper.shaping_x.zeta);
+        EEPROM_READ(stepper.shaping_x.type);
+      }
+      #endif
+      #if ENABLED(INPUT_SHAPING_Y)
+      {
+        _FIELD_TEST(shaping_y_frequency);
+        EEPROM_READ(stepper.shaping_y.frequency);
+        EEPROM_READ(stepper.shaping_y.zeta);
+        EEPROM_READ(stepper.shaping_y.type);
+      }
+      #endif
+
       //
       // Validate Final Size and CRC
       //
@@ -2621,6 +2757,124 @@ void MarlinSettings::postprocess() {
     return false;
   }
 
+  #if ENABLED(SETTINGS_IMAGE)
+
+    #include "../libs/crc32.h"
+    #include "../libs/hex_print.h"
+
+    #define IMAGE_CHUNK 32  // Bytes per M506 line
+
+    static uint8_t settings_image[sizeof(SettingsData)];
+    static uint16_t image_received; // Bytes of the image imported so far
+
+    // The image must be for this build and carry a good data CRC
+    static bool image_check() {
+      if (memcmp(settings_image, version, 3)) {
+        SERIAL_ERROR_MSG("Settings image version mismatch (Marlin=" EEPROM_VERSION ")");
+        return false;
+      }
+      uint16_t stored_crc, crc = 0;
+      memcpy(&stored_crc, &settings_image[offsetof(SettingsData, crc)], sizeof(stored_crc));
+      constexpr uint16_t data_start = offsetof(SettingsData, e_factors);
+      crc16(&crc, &settings_image[data_start], sizeof(SettingsData) - data_start);
+      if (crc != stored_crc) {
+        SERIAL_ERROR_MSG("Settings image CRC mismatch");
+        return false;
+      }
+      return true;
+    }
+
+    /**
+     * M505 - Print the stored settings as M506 lines that can be sent back
+     * to this or another printer with the same build.
+     */
+    void MarlinSettings::image_export() {
+      if (!persistentStore.access_start()) { SERIAL_ECHO_MSG("No EEPROM."); return; }
+      const bool read_error = persistentStore.read_data(EEPROM_OFFSET, settings_image, sizeof(settings_image));
+      persistentStore.access_finish();
+      image_received = 0;
+      if (read_error || !image_check()) return;
+
+      for (uint16_t i = 0; i < sizeof(settings_image); i += IMAGE_CHUNK) {
+        SERIAL_ECHOPGM("M506 D", i, " ");
+        const uint16_t end = _MIN(i + IMAGE_CHUNK, uint16_t(sizeof(settings_image)));
+        for (uint16_t j = i; j < end; j++) SERIAL_ECHO(hex_byte(settings_image[j]));
+        SERIAL_EOL();
+      }
+      SERIAL_ECHOLNPGM("M506 W", sizeof(settings_image), " ", crc32(0, settings_image, sizeof(settings_image)));
+    }
+
+    static int8_t hex_value(const char c) {
+      if (NUMERIC(c)) return c - '0';
+      if (WITHIN(c, 'a', 'f')) return c - 'a' + 10;
+      if (WITHIN(c, 'A', 'F')) return c - 'A' + 10;
+      return -1;
+    }
+
+    /**
+     * M506 - Import a settings image line
+     *   D<offset> <hex>   Image bytes, in order. D0 starts a new image.
+     *   W<size> <crc32>   Check the whole image, store it, and load it
+     */
+    bool MarlinSettings::image_import(const char *arg) {
+      char *p;
+      switch (*arg) {
+        case 'D': {
+          const uint32_t offset = strtoul(arg + 1, &p, 10);
+          if (offset == 0) image_received = 0;
+          if (offset != image_received) {
+            SERIAL_ERROR_MSG("Settings image expected D", image_received);
+            return false;
+          }
+          while (*p == ' ') p++;
+          for (; p[0] && p[1]; p += 2) {
+            const int8_t hi = hex_value(p[0]), lo = hex_value(p[1]);
+            if (hi < 0 || lo < 0 || image_received >= sizeof(settings_image)) break;
+            settings_image[image_received++] = (hi << 4) | lo;
+          }
+          if (*p) {
+            image_received = 0;
+            SERIAL_ERROR_MSG("Bad settings image data");
+            return false;
+          }
+          return true;
+        }
+
+        case 'W': {
+          const uint32_t size = strtoul(arg + 1, &p, 10),
+                         crc = strtoul(p, nullptr, 10);
+          const bool complete = size == sizeof(settings_image) && image_received == size;
+          image_received = 0;
+          if (!complete) {
+            SERIAL_ERROR_MSG("Settings image size mismatch (expected ", sizeof(settings_image), ")");
+            return false;
+          }
+          if (crc32(0, settings_image, size) != crc) {
+            SERIAL_ERROR_MSG("Settings image transfer CRC mismatch");
+            return false;
+          }
+          if (!image_check()) return false;
+
+          // The boot reset only follows a new build, not a new image
+          #if ENABLED(EEPROM_INIT_NOW)
+            memcpy(&settings_image[offsetof(SettingsData, build_hash)], &build_hash, sizeof(build_hash));
+          #endif
+
+          if (!EEPROM_START(EEPROM_OFFSET)) return false;
+          eeprom_error = persistentStore.write_data(eeprom_index, settings_image, size, &working_crc);
+          EEPROM_FINISH();
+          if (eeprom_error) {
+            SERIAL_ERROR_MSG("Settings image write failed");
+            return false;
+          }
+          return load();
+        }
+      }
+      return false;
+    }
+
+  #endif // SETTINGS_IMAGE
+
   #if ENABLED(AUTO_BED_LEVELING_UBL)
 
     inline void ubl_invalid_slot(const int s) {
@@ -2863,6 +3117,16 @@ void MarlinSettings::reset() {
   //
   TERN_(TOUCH_SCREEN_CALIBRATION, touch_calibration.calibration_reset());
 
+  //
+  // TFT_FSMC_CALIBRATION
+  //
+  TERN_(TFT_FSMC_CALIBRATION, TFT_IO::io.write_timing = 0); // Calibrate again in postprocess
+
+  //
+  // MEMORY_PROFILES
+  //
+  TERN_(MEMORY_PROFILES, memory_profile.saved = MemoryProfile::SD_PRINTING); // From the next boot
+
   //
   // Buzzer enable/disable
   //
@@ -3113,6 +3377,15 @@ void MarlinSettings::reset() {
     ui.sleep_timeout_minutes = DISPLAY_SLEEP_MINUTES;
   #endif
 
+  //
+  // Display Motion Priority
+  //
+  #if ENABLED(UI_MOTION_PRIORITY)
+    ui.motion_min_moves = UI_MIN_PLANNED_MOVES;
+    ui.frame_budget_ms = UI_FRAME_BUDGET_MS;
+    ui.frame_hold_max_ms = UI_FRAME_HOLD_MAX_MS;
+  #endif
+
   //
   // Controller Fan
   //
@@ -3263,6 +3536,20 @@ void MarlinSettings::reset() {
     }
   #endif
 
+  //
+  // Input Shaping
+  //
+  #if ENABLED(INPUT_SHAPING_X)
+    stepper.shaping_x.frequency = SHAPING_FREQ_X;
+    stepper.shaping_x.zeta = SHAPING_ZETA_X;
+    stepper.shaping_x.type = ShaperType(SHAPING_TYPE_X);
+  #endif
+  #if ENABLED(INPUT_SHAPING_Y)
+    stepper.shaping_y.frequency = SHAPING_FREQ_Y;
+    stepper.shaping_y.zeta = SHAPING_ZETA_Y;
+    stepper.shaping_y.type = ShaperType(SHAPING_TYPE_Y);
+  #endif
+
   postprocess();
 
   #if EITHER(EEPROM_CHITCHAT, DEBUG_LEVELING_FEATURE)
@@ -3341,6 +3628,16 @@ void MarlinSettings::reset() {
     //
     gcode.M205_report(forReplay);
 
+    //
+    // M213 Motion Profiles
+    //
+    TERN_(MOTION_PROFILES, gcode.M213_report(forReplay));
+
+    //
+    // M214 Acceleration Torque Curve
+    //
+    TERN_(ACCEL_TORQUE_CURVE, gcode.M214_report(forReplay));
+
     //
     // M206 Home Offset
     //
@@ -3460,6 +3757,7 @@ void MarlinSettings::reset() {
     // LCD Brightness
     //
     TERN_(HAS_LCD_BRIGHTNESS, gcode.M256_report(forReplay));
+    TERN_(UI_MOTION_PRIORITY, gcode.M257_report(forReplay));
 
     //
     // Controller Fan
@@ -3559,6 +3857,16 @@ void MarlinSettings::reset() {
     // Model predictive control
     //
     TERN_(MPCTEMP, gcode.M306_report(forReplay));
+
+    //
+    // Input Shaping
+    //
+    TERN_(HAS_SHAPING, gcode.M593_report(forReplay));
+
+    //
+    // Memory Profile
+    //
+    TERN_(MEMORY_PROFILES, gcode.M102_report(forReplay));
   }
 
 #endif // !DISABLE_M503
@@ -59,6 +59,11 @@ class MarlinSettings {
       static bool load();      // Return 'true' if data was loaded ok
       static bool validate();  // Return 'true' if EEPROM data is ok
 
+      #if ENABLED(SETTINGS_IMAGE)
+        static void image_export();                 // M505
+        static bool image_import(const char *arg);  // M506
+      #endif
+
       static void first_load() {
         static bool loaded = false;
         if (!loaded && load()) loaded = true;
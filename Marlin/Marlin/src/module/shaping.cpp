@@ -0,0 +1,81 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if HAS_SHAPING
+
+#include "shaping.h"
+
+/**
+ * Impulse amplitudes and times (in damped periods) for each shaper type.
+ * With K = e^(-zeta * pi / sqrt(1 - zeta^2)):
+ *   ZV  : 1, K          at 0, 1/2
+ *   ZVD : 1, 2K, K^2    at 0, 1/2, 1
+ *   MZV : uses K^(3/4) and impulses at 0, 3/8, 3/4
+ */
+void AxisShaper::refresh() {
+  head = acc = 0;
+  LOOP_L_N(i, SHAPER_MAX_IMPULSES - 1) tail[i] = 0;
+
+  enabled = frequency > 0;
+  if (!enabled) { echoes = 1; return; }
+
+  const float z = constrain(zeta, 0.0f, 0.5f), s = SQRT(1.0f - sq(z)),
+              period = float(STEPPER_TIMER_RATE) / (frequency * s);  // Damped period in ticks
+
+  float a[SHAPER_MAX_IMPULSES], t[SHAPER_MAX_IMPULSES];
+  switch (type) {
+    default:
+    case SHAPER_ZV: {
+      const float K = expf(-z * float(M_PI) / s);
+      echoes = 1;
+      a[0] = 1; a[1] = K;
+      t[1] = 0.5f;
+    } break;
+    case SHAPER_ZVD: {
+      const float K = expf(-z * float(M_PI) / s);
+      echoes = 2;
+      a[0] = 1; a[1] = 2 * K; a[2] = sq(K);
+      t[1] = 0.5f; t[2] = 1;
+    } break;
+    case SHAPER_MZV: {
+      const float K = expf(-0.75f * z * float(M_PI) / s);
+      echoes = 2;
+      a[0] = 1.0f - float(M_SQRT1_2); a[1] = (float(M_SQRT2) - 1.0f) * K; a[2] = a[0] * sq(K);
+      t[1] = 0.375f; t[2] = 0.75f;
+    } break;
+  }
+
+  // Normalize to one Q16 step. The immediate impulse takes the rounding error.
+  float sum = 0;
+  LOOP_LE_N(i, echoes) sum += a[i];
+  int32_t rest = 65536;
+  for (uint8_t i = echoes; i; --i) {
+    amp[i] = LROUND(65536.0f * a[i] / sum);
+    rest -= amp[i];
+    delay[i - 1] = LROUND(period * t[i]);
+  }
+  amp[0] = rest;
+}
+
+#endif // HAS_SHAPING
@@ -0,0 +1,104 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * shaping.h - Step-domain input shaper for the Stepper ISR
+ *
+ * Every Bresenham step on a shaped axis adds the shaper's impulse amplitudes
+ * to an accumulator: the first right away and the others after their delays.
+ * An output step is taken whenever the accumulator reaches half a step, so
+ * the total step count stays exact. The amplitudes are Q16 fixed point and
+ * always add up to exactly one step.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if HAS_SHAPING
+
+enum ShaperType : uint8_t { SHAPER_ZV, SHAPER_ZVD, SHAPER_MZV };
+
+#define SHAPER_MAX_IMPULSES 3
+#define SHAPING_NEVER       UINT32_MAX
+
+// Room for the input steps within the longest delay (one damped period at SHAPING_MIN_FREQ, damping up to 0.5)
+#define SHAPING_BUFFER_SIZE ((SHAPING_MAX_STEPRATE) * 7 / (6 * (SHAPING_MIN_FREQ)) + 1)
+
+class AxisShaper {
+public:
+  float frequency;                    // (Hz) Zero to disable
+  float zeta;                         // Damping ratio
+  ShaperType type;
+
+  bool enabled;                       // New steps are shaped
+  bool forward;                       // Current state of the DIR pin
+
+  // Apply the settings above. Only call when idle().
+  void refresh();
+
+  // No echoes are pending and no step is owed
+  bool idle() const { return tail[echoes - 1] == head && WITHIN(acc, -32768, 32767); }
+
+  // Feed a Bresenham step taken at the given time
+  FORCE_INLINE void input(const uint32_t now, const bool fwd) {
+    const uint16_t next = head + 1 == SHAPING_BUFFER_SIZE ? 0 : head + 1;
+    if (next == tail[echoes - 1]) {   // Queue full? Take the whole step now.
+      acc += fwd ? 65536 : -65536;
+      return;
+    }
+    acc += fwd ? amp[0] : -amp[0];
+    times[head] = (now & ~1UL) | fwd; // Direction in bit 0
+    head = next;
+  }
+
+  // Add the echoes that are due. Return the ticks until the next one.
+  FORCE_INLINE uint32_t echo(const uint32_t now) {
+    uint32_t next = SHAPING_NEVER;
+    LOOP_L_N(i, echoes) {
+      while (tail[i] != head) {
+        const uint32_t t = times[tail[i]];
+        const int32_t due = int32_t((t & ~1UL) + delay[i] - now);
+        if (due > 0) { NOMORE(next, uint32_t(due)); break; }
+        acc += (t & 1) ? amp[i + 1] : -amp[i + 1];
+        if (++tail[i] == SHAPING_BUFFER_SIZE) tail[i] = 0;
+      }
+    }
+    return next;
+  }
+
+  // Take an output step: 1 = forward, -1 = reverse, 0 = none
+  FORCE_INLINE int8_t take_step() {
+    if (acc >= 32768) { acc -= 65536; return 1; }
+    if (acc < -32768) { acc += 65536; return -1; }
+    return 0;
+  }
+
+private:
+  uint8_t echoes = 1;                 // Count of delayed impulses
+  int32_t amp[SHAPER_MAX_IMPULSES];   // Q16 amplitudes, the first one is immediate
+  uint32_t delay[SHAPER_MAX_IMPULSES - 1]; // Delays of the other impulses in Stepper timer ticks
+  int32_t acc;                        // Owed steps in Q16
+  uint16_t head, tail[SHAPER_MAX_IMPULSES - 1];
+  uint32_t times[SHAPING_BUFFER_SIZE];
+};
+
+#endif // HAS_SHAPING
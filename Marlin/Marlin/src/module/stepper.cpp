@@ -96,6 +96,11 @@ Stepper stepper; // Singleton
 #include "../sd/cardreader.h"
 #include "../MarlinCore.h"
 #include "../HAL/shared/Delay.h"
+#include "../libs/report_cache.h"
+
+#if ENABLED(STEP_DMA)
+  #include "../HAL/STM32/step_dma.h"
+#endif
 
 #if ENABLED(INTEGRATED_BABYSTEPPING)
   #include "../feature/babystep.h"
@@ -117,6 +122,14 @@ Stepper stepper; // Singleton
   #include "../feature/runout.h"
 #endif
 
+#if ENABLED(PRINTCOUNTER_WEAR)
+  #include "printcounter.h"
+#endif
+
+#if ENABLED(TIMELAPSE)
+  #include "../feature/timelapse.h"
+#endif
+
 #if HAS_L64XX
   #include "../libs/L64XX/L64XX_Marlin.h"
   uint8_t L6470_buf[MAX_L64XX + 1];   // chip command sequence - element 0 not used
@@ -139,6 +152,18 @@ Stepper stepper; // Singleton
   #include "../lcd/extui/ui_api.h"
 #endif
 
+#if ENABLED(MOTION_BENCHMARK)
+  #include "../feature/motion_bench.h"
+#endif
+
+#if ENABLED(ISR_PROFILER)
+  #include "../HAL/STM32/isr_profiler.h"
+#endif
+
+#if ENABLED(STEP_CAPTURE)
+  #include "../feature/step_capture.h"
+#endif
+
 // public:
 
 #if EITHER(HAS_EXTRA_ENDSTOPS, Z_STEPPER_AUTO_ALIGN)
@@ -189,20 +214,55 @@ bool Stepper::abort_current_block;
 uint32_t Stepper::acceleration_time, Stepper::deceleration_time;
 uint8_t Stepper::steps_per_isr;
 
+#if ENABLED(INPUT_SHAPING_X)
+  AxisShaper Stepper::shaping_x;
+#endif
+#if ENABLED(INPUT_SHAPING_Y)
+  AxisShaper Stepper::shaping_y;
+#endif
+#if HAS_SHAPING
+  uint32_t Stepper::shaping_time; // = 0
+#endif
+
+#if ENABLED(ADAPTIVE_STEP_BATCHING)
+  // Cycles per second the Stepper ISR may use
+  #define BATCH_CYCLE_BUDGET (uint32_t(F_CPU) / 100 * (STEP_BATCHING_MAX_LOAD))
+  // Cost estimates used until the cycle counter is sampled, or without a cycle counter
+  #define BATCH_PULSE_CYCLES (ISR_BASE_CYCLES / 2 + ISR_LOOP_CYCLES + ISR_LA_LOOP_CYCLES)
+  #define BATCH_BLOCK_CYCLES (ISR_BASE_CYCLES / 2 + ISR_S_CURVE_CYCLES + ISR_LA_BASE_CYCLES)
+
+  bool Stepper::batch_spread; // = false
+  uint8_t Stepper::batch_pulses_left; // = 0
+  uint32_t Stepper::batch_spacing,
+           Stepper::batch_full_rate = BATCH_CYCLE_BUDGET / (BATCH_PULSE_CYCLES + BATCH_BLOCK_CYCLES),
+           Stepper::batch_pulse_rate = BATCH_CYCLE_BUDGET / (BATCH_PULSE_CYCLES),
+           Stepper::batch_block_ratio = 16 * (BATCH_BLOCK_CYCLES) / (BATCH_PULSE_CYCLES),
+           Stepper::isr_pulse_cycles = 16 * (BATCH_PULSE_CYCLES),
+           Stepper::isr_block_cycles = 16 * (BATCH_BLOCK_CYCLES);
+#endif
+
+#if ENABLED(BLOCK_EXEC_TABLE)
+  uint8_t Stepper::exec_index;
+  // Trapezoid terms come from the compact planner execution table
+  #define BLOCK_EXEC(F) planner.exec_table.F[exec_index]
+#else
+  #define BLOCK_EXEC(F) current_block->F
+#endif
+
 #if ENABLED(FREEZE_FEATURE)
   bool Stepper::frozen; // = false
 #endif
 
 IF_DISABLED(ADAPTIVE_STEP_SMOOTHING, constexpr) uint8_t Stepper::oversampling_factor;
 
-xyze_long_t Stepper::delta_error{0};
+__ccmram xyze_long_t Stepper::delta_error{0};
 
-xyze_ulong_t Stepper::advance_dividend{0};
-uint32_t Stepper::advance_divisor = 0,
-         Stepper::step_events_completed = 0, // The number of step events executed in the current block
-         Stepper::accelerate_until,          // The count at which to stop accelerating
-         Stepper::decelerate_after,          // The count at which to start decelerating
-         Stepper::step_event_count;          // The total event count for the current block
+__ccmram xyze_ulong_t Stepper::advance_dividend{0};
+__ccmram uint32_t Stepper::advance_divisor = 0,
+                  Stepper::step_events_completed = 0, // The number of step events executed in the current block
+                  Stepper::accelerate_until,          // The count at which to stop accelerating
+                  Stepper::decelerate_after,          // The count at which to start decelerating
+                  Stepper::step_event_count;          // The total event count for the current block
 
 #if EITHER(HAS_MULTI_EXTRUDER, MIXING_EXTRUDER)
   uint8_t Stepper::stepper_extruder;
@@ -222,7 +282,7 @@ uint32_t Stepper::advance_divisor = 0,
   bool Stepper::bezier_2nd_half;    // =false If Bézier curve has been initialized or not
 #endif
 
-#if ENABLED(LIN_ADVANCE)
+#if HAS_ADVANCE_ISR
 
   uint32_t Stepper::nextAdvanceISR = LA_ADV_NEVER,
            Stepper::LA_isr_rate = LA_ADV_NEVER;
@@ -234,6 +294,15 @@ uint32_t Stepper::advance_divisor = 0,
 
   bool Stepper::LA_use_advance_lead;
 
+#elif ENABLED(LIN_ADVANCE_INTEGRATED)
+
+  uint32_t Stepper::LA_gain;
+  int32_t  Stepper::LA_lead = 0,
+           Stepper::LA_lead_steps = 0;
+  int16_t  Stepper::LA_steps = 0;
+  bool     Stepper::LA_use_advance_lead,
+           Stepper::LA_forward = true;
+
 #endif // LIN_ADVANCE
 
 #if ENABLED(INTEGRATED_BABYSTEPPING)
@@ -244,14 +313,20 @@ uint32_t Stepper::advance_divisor = 0,
   page_step_state_t Stepper::page_step_state;
 #endif
 
+#if ENABLED(NATIVE_ARCS)
+  xy_long_t Stepper::arc_point, Stepper::arc_count;
+  XYval<int64_t> Stepper::arc_drift;
+  uint32_t Stepper::arc_events;
+#endif
+
 int32_t Stepper::ticks_nominal = -1;
 #if DISABLED(S_CURVE_ACCELERATION)
   uint32_t Stepper::acc_step_rate; // needed for deceleration start point
 #endif
 
 xyz_long_t Stepper::endstops_trigsteps;
-xyze_long_t Stepper::count_position{0};
-xyze_int8_t Stepper::count_direction{0};
+__ccmram xyze_long_t Stepper::count_position{0};
+__ccmram xyze_int8_t Stepper::count_direction{0};
 
 #define MINDIR(A) (count_direction[_AXIS(A)] < 0)
 #define MAXDIR(A) (count_direction[_AXIS(A)] > 0)
@@ -470,6 +545,7 @@ xyze_int8_t Stepper::count_direction{0};
 #endif
 
 void Stepper::enable_axis(const AxisEnum axis) {
+  if (TERN0(MOTION_BENCHMARK, MotionBench::active)) return; // Benchmark moves leave the motors off
   #define _CASE_ENABLE(N) case N##_AXIS: ENABLE_AXIS_##N(); break;
   switch (axis) {
     MAIN_AXIS_MAP(_CASE_ENABLE)
@@ -558,6 +634,9 @@ void Stepper::disable_all_steppers() {
  */
 void Stepper::set_directions() {
 
+  // Let queued pulses finish with the old directions
+  TERN_(STEP_DMA, StepDMA::wait());
+
   DIR_WAIT_BEFORE();
 
   #define SET_STEP_DIR(A)                       \
@@ -577,6 +656,10 @@ void Stepper::set_directions() {
   TERN_(HAS_J_DIR, SET_STEP_DIR(J));
   TERN_(HAS_K_DIR, SET_STEP_DIR(K));
 
+  // Shaped steps track the DIR pin state
+  TERN_(INPUT_SHAPING_X, shaping_x.forward = !motor_direction(X_AXIS));
+  TERN_(INPUT_SHAPING_Y, shaping_y.forward = !motor_direction(Y_AXIS));
+
   #if DISABLED(LIN_ADVANCE)
     #if ENABLED(MIXING_EXTRUDER)
        // Because this is valid for the whole block we don't know
@@ -1362,6 +1445,17 @@ void Stepper::set_directions() {
       bezier_AV = av;
     }
 
+    #if ENABLED(BLOCK_EXEC_TABLE)
+      // Load the coefficients precalculated by the planner for the acceleration (0) or deceleration (1) ramp
+      FORCE_INLINE void Stepper::_load_bezier_curve_coeffs(const uint8_t ramp) {
+        bezier_A = planner.exec_table.bezier_A[ramp][exec_index];
+        bezier_B = planner.exec_table.bezier_B[ramp][exec_index];
+        bezier_C = planner.exec_table.bezier_C[ramp][exec_index];
+        bezier_F = planner.exec_table.bezier_F[ramp][exec_index];
+        bezier_AV = planner.exec_table.bezier_AV[ramp][exec_index];
+      }
+    #endif
+
     FORCE_INLINE int32_t Stepper::_eval_bezier_curve(const uint32_t curr_step) {
       #if (defined(__arm__) || defined(__thumb__)) && !defined(STM32G0B1xx) // TODO: Test define STM32G0xx versus STM32G0B1xx
 
@@ -1437,6 +1531,8 @@ void Stepper::set_directions() {
  */
 
 HAL_STEP_TIMER_ISR() {
+  TERN_(ISR_PROFILER, ISRProfiler::stepper_latency(HAL_timer_get_count(MF_TIMER_STEP)));
+  TERN_(ISR_PROFILER, ISR_PROFILE(ISR_PROF_STEPPER));
   HAL_timer_isr_prologue(MF_TIMER_STEP);
 
   Stepper::isr();
@@ -1450,10 +1546,18 @@ HAL_STEP_TIMER_ISR() {
   #define STEP_MULTIPLY(A,B) MultiU24X32toH16(A, B)
 #endif
 
-void Stepper::isr() {
+HOT_ISR_FUNC void Stepper::isr() {
 
   static uint32_t nextMainISR = 0;  // Interval until the next main Stepper Pulse phase (0 = Now)
 
+  #if EITHER(ADAPTIVE_STEP_BATCHING, MOTION_BENCHMARK)
+    const uint32_t isr_start_cycles = get_cycle_count();
+  #endif
+  #if ENABLED(ADAPTIVE_STEP_BATCHING)
+    uint32_t block_cycles = 0;
+    uint8_t pulse_phases = 0;
+  #endif
+
   #ifndef __AVR__
     // Disable interrupts, to avoid ISR preemption while we reprogram the period
     // (AVR enters the ISR with global interrupts disabled, so no need to do it here)
@@ -1477,9 +1581,16 @@ void Stepper::isr() {
     // Enable ISRs to reduce USART processing latency
     hal.isr_on();
 
-    if (!nextMainISR) pulse_phase_isr();                    // 0 = Do coordinated axes Stepper pulses
+    if (!nextMainISR) {                                     // 0 = Do coordinated axes Stepper pulses
+      pulse_phase_isr();
+      TERN_(ADAPTIVE_STEP_BATCHING, ++pulse_phases);
+    }
+
+    #if HAS_SHAPING
+      const uint32_t nextShapingISR = shaping_isr();        // Step the due echoes of shaped axes
+    #endif
 
-    #if ENABLED(LIN_ADVANCE)
+    #if HAS_ADVANCE_ISR
       if (!nextAdvanceISR) nextAdvanceISR = advance_isr();  // 0 = Do Linear Advance E Stepper pulses
     #endif
 
@@ -1490,7 +1601,29 @@ void Stepper::isr() {
 
     // ^== Time critical. NOTHING besides pulse generation should be above here!!!
 
-    if (!nextMainISR) nextMainISR = block_phase_isr();  // Manage acc/deceleration, get next block
+    #if ENABLED(ADAPTIVE_STEP_BATCHING)
+      if (!nextMainISR) {
+        if (batch_pulses_left && current_block && step_events_completed < step_event_count) {
+          --batch_pulses_left;                          // Next spread pulse of the batch
+          nextMainISR = batch_spacing;
+        }
+        else {
+          const uint32_t block_start_cycles = get_cycle_count();
+          nextMainISR = block_phase_isr();              // Manage acc/deceleration, get next block
+          block_cycles = get_cycle_count() - block_start_cycles;
+
+          // Spread the steps of the batch evenly. The first interval takes the remainder.
+          batch_pulses_left = 0;
+          if (batch_spread && steps_per_isr > 1 && current_block) {
+            batch_pulses_left = steps_per_isr - 1;
+            batch_spacing = nextMainISR / steps_per_isr;
+            nextMainISR -= batch_spacing * batch_pulses_left;
+          }
+        }
+      }
+    #else
+      if (!nextMainISR) nextMainISR = block_phase_isr();  // Manage acc/deceleration, get next block
+    #endif
 
     #if ENABLED(INTEGRATED_BABYSTEPPING)
       if (is_babystep)                                  // Avoid ANY stepping too soon after baby-stepping
@@ -1504,8 +1637,9 @@ void Stepper::isr() {
     const uint32_t interval = _MIN(
       uint32_t(HAL_TIMER_TYPE_MAX),                     // Come back in a very long time
       nextMainISR                                       // Time until the next Pulse / Block phase
-      OPTARG(LIN_ADVANCE, nextAdvanceISR)               // Come back early for Linear Advance?
+      OPTARG(HAS_ADVANCE_ISR, nextAdvanceISR)           // Come back early for Linear Advance?
       OPTARG(INTEGRATED_BABYSTEPPING, nextBabystepISR)  // Come back early for Babystepping?
+      OPTARG(HAS_SHAPING, nextShapingISR)               // Come back early for Input Shaping?
     );
 
     //
@@ -1517,7 +1651,9 @@ void Stepper::isr() {
 
     nextMainISR -= interval;
 
-    #if ENABLED(LIN_ADVANCE)
+    TERN_(HAS_SHAPING, shaping_time += interval);
+
+    #if HAS_ADVANCE_ISR
       if (nextAdvanceISR != LA_ADV_NEVER) nextAdvanceISR -= interval;
     #endif
 
@@ -1593,10 +1729,59 @@ void Stepper::isr() {
   // Set the next ISR to fire at the proper time
   HAL_timer_set_compare(MF_TIMER_STEP, hal_timer_t(next_isr_ticks));
 
+  #if ENABLED(ADAPTIVE_STEP_BATCHING)
+    // Only single-pulse ISRs measure the pulse cost. Zero cycles means no cycle counter.
+    const uint32_t isr_cycles = get_cycle_count() - isr_start_cycles;
+    if (isr_cycles) {
+      const bool single_pulse = pulse_phases == 1 && (batch_spread || steps_per_isr == 1);
+      update_isr_load(single_pulse ? isr_cycles - block_cycles : 0, block_cycles);
+    }
+  #endif
+
+  TERN_(MOTION_BENCHMARK, MotionBench::isr_done(get_cycle_count() - isr_start_cycles));
+
   // Don't forget to finally reenable interrupts
   hal.isr_on();
 }
 
+#if ENABLED(ADAPTIVE_STEP_BATCHING)
+
+  /**
+   * Get the steps per ISR for a step rate, from the measured ISR load.
+   * With spreading each step costs a pulse-only ISR and only the block phase
+   * is shared by the batch, so the smallest N satisfying
+   *   R * pulse + (R / N) * block <= budget
+   * is used. Otherwise the batch is stepped back-to-back in one full ISR.
+   */
+  uint8_t Stepper::batch_steps(const uint32_t step_rate) {
+    uint32_t steps;
+    batch_spread = false;
+    if (step_rate <= batch_full_rate)
+      steps = 1;
+    else if (step_rate < batch_pulse_rate - batch_pulse_rate / 4) {
+      const uint32_t headroom = 16 * (batch_pulse_rate - step_rate);
+      steps = (step_rate * batch_block_ratio + headroom - 1) / headroom;
+      batch_spread = true;
+    }
+    else
+      steps = (step_rate + batch_full_rate - 1) / batch_full_rate;
+    return _MIN(steps, 128U);
+  }
+
+  // Update the moving averages of the ISR cost (about 16 samples) and the derived rate limits
+  void Stepper::update_isr_load(const uint32_t pulse_cycles, const uint32_t block_cycles) {
+    if (pulse_cycles) isr_pulse_cycles += pulse_cycles - (isr_pulse_cycles >> 4);
+    if (!block_cycles) return;
+    isr_block_cycles += block_cycles - (isr_block_cycles >> 4);
+
+    const uint32_t pc = _MAX(isr_pulse_cycles >> 4, 1U);
+    batch_pulse_rate = BATCH_CYCLE_BUDGET / pc;
+    batch_full_rate = _MAX(BATCH_CYCLE_BUDGET / (pc + (isr_block_cycles >> 4)), 1U);
+    batch_block_ratio = _MIN(isr_block_cycles / pc, 1000U);
+  }
+
+#endif // ADAPTIVE_STEP_BATCHING
+
 #if MINIMUM_STEPPER_PULSE || MAXIMUM_STEPPER_RATE
   #define ISR_PULSE_CONTROL 1
 #endif
@@ -1604,30 +1789,52 @@ void Stepper::isr() {
   #define ISR_MULTI_STEPS 1
 #endif
 
-/**
- * This phase of the ISR should ONLY create the pulses for the steppers.
- * This prevents jitter caused by the interval between the start of the
- * interrupt and the start of the pulses. DON'T add any logic ahead of the
- * call to this method that might cause variation in the timing. The aim
- * is to keep pulse timing as regular as possible.
- */
-void Stepper::pulse_phase_isr() {
+#if ENABLED(STEPPER_ISR_VARIANTS)
 
-  // If we must abort the current block, do so!
-  if (abort_current_block) {
-    abort_current_block = false;
-    if (current_block) discard_current_block();
+  /**
+   * Each variant of the step loop has the block's extruder and kind as
+   * constants: V = extruder * PULSE_MODES + the PULSE_* bits of the block.
+   * Those bits only count the block kinds that are enabled.
+   */
+  #define PULSE_ARC  TERN0(NATIVE_ARCS, 1)
+  #define PULSE_PAGE TERN0(DIRECT_STEPPING, _BV(ENABLED(NATIVE_ARCS)))
+  #define PULSE_DMA  TERN0(STEP_DMA, _BV(ENABLED(NATIVE_ARCS) + ENABLED(DIRECT_STEPPING)))
+  #define PULSE_MODES _BV(ENABLED(NATIVE_ARCS) + ENABLED(DIRECT_STEPPING) + ENABLED(STEP_DMA))
+  #define PULSE_VARIANTS ((EXTRUDERS) * (PULSE_MODES))
+
+  Stepper::pulse_events_t Stepper::block_pulse_events = &Stepper::pulse_events<0>;
+
+  // The variant for index v, found once per block
+  template<uint8_t V>
+  Stepper::pulse_events_t Stepper::pulse_variant(const uint8_t v) {
+    return v == V ? &pulse_events<V> : pulse_variant<V + 1>(v);
+  }
+  template<>
+  Stepper::pulse_events_t Stepper::pulse_variant<PULSE_VARIANTS>(const uint8_t) {
+    return &pulse_events<0>;
   }
 
-  // If there is no current block, do nothing
-  if (!current_block) return;
+  #define PULSE_EVENTS_FUNC HOT_ISR_FUNC
 
-  // Skipping step processing causes motion to freeze
-  if (TERN0(FREEZE_FEATURE, frozen)) return;
+#else
+
+  // A single variant, inlined into pulse_phase_isr
+  #define PULSE_EVENTS_FUNC FORCE_INLINE
+
+#endif
+
+template<uint8_t V>
+PULSE_EVENTS_FUNC void Stepper::pulse_events() {
+
+  #if ENABLED(STEPPER_ISR_VARIANTS)
+    // Shadow the extruder and block kind with constants so their tests fold away
+    constexpr uint8_t stepper_extruder = V / (PULSE_MODES), mode = V % (PULSE_MODES);
+    UNUSED(stepper_extruder); UNUSED(mode);
+  #endif
 
   // Count of pending loops and events for this iteration
   const uint32_t pending_events = step_event_count - step_events_completed;
-  uint8_t events_to_do = _MIN(pending_events, steps_per_isr);
+  uint8_t events_to_do = _MIN(pending_events, TERN(ADAPTIVE_STEP_BATCHING, batch_spread ? 1 : steps_per_isr, steps_per_isr));
 
   // Just update the value we will get at the end of the loop
   step_events_completed += events_to_do;
@@ -1639,6 +1846,23 @@ void Stepper::pulse_phase_isr() {
   #endif
   xyze_bool_t step_needed{0};
 
+  #if ENABLED(NATIVE_ARCS)
+    const bool is_arc = TERN(STEPPER_ISR_VARIANTS, bool(mode & PULSE_ARC), current_block->is_arc());
+  #endif
+
+  #if ENABLED(LIN_ADVANCE_INTEGRATED)
+    // Move the pressure lead one step toward the smoothed target
+    const int32_t lead_target = (LA_lead + _BV32(15)) >> 16;
+    if (lead_target > LA_lead_steps) { ++LA_lead_steps; ++LA_steps; }
+    else if (lead_target < LA_lead_steps) { --LA_lead_steps; --LA_steps; }
+  #endif
+
+  #if ENABLED(STEP_DMA)
+    // Queue the pulses in a DMA burst instead of timing them here. Arcs turn DIR pins around mid-block, so they step directly.
+    const bool use_dma = TERN(STEPPER_ISR_VARIANTS, bool(mode & PULSE_DMA), StepDMA::enabled && TERN1(NATIVE_ARCS, !is_arc));
+    uint8_t dma_events = 0;
+  #endif
+
   do {
     #define _APPLY_STEP(AXIS, INV, ALWAYS) AXIS ##_APPLY_STEP(INV, ALWAYS)
     #define _INVERT_STEP_PIN(AXIS) INVERT_## AXIS ##_STEP_PIN
@@ -1653,22 +1877,94 @@ void Stepper::pulse_phase_isr() {
       } \
     }while(0)
 
-    // Start an active pulse if needed
-    #define PULSE_START(AXIS) do{ \
-      if (step_needed[_AXIS(AXIS)]) { \
-        _APPLY_STEP(AXIS, !_INVERT_STEP_PIN(AXIS), 0); \
-      } \
-    }while(0)
+    #if ENABLED(STEP_DMA)
+
+      // Queue a pulse in the DMA burst (E uses the active extruder's stepper) or start it now
+      #define PULSE_START(AXIS) do{ \
+        if (step_needed[_AXIS(AXIS)]) { \
+          if (use_dma) \
+            StepDMA::add_step(dma_events, _AXIS(AXIS) + (_AXIS(AXIS) == E_AXIS ? stepper_extruder : 0)); \
+          else \
+            _APPLY_STEP(AXIS, !_INVERT_STEP_PIN(AXIS), 0); \
+        } \
+      }while(0)
+
+      // Queued pulses end by themselves
+      #define PULSE_STOP(AXIS) do { \
+        if (step_needed[_AXIS(AXIS)] && !use_dma) { \
+          _APPLY_STEP(AXIS, _INVERT_STEP_PIN(AXIS), 0); \
+        } \
+      }while(0)
 
-    // Stop an active pulse if needed
-    #define PULSE_STOP(AXIS) do { \
-      if (step_needed[_AXIS(AXIS)]) { \
-        _APPLY_STEP(AXIS, _INVERT_STEP_PIN(AXIS), 0); \
-      } \
-    }while(0)
+    #else
+
+      // Start an active pulse if needed
+      #define PULSE_START(AXIS) do{ \
+        if (step_needed[_AXIS(AXIS)]) { \
+          _APPLY_STEP(AXIS, !_INVERT_STEP_PIN(AXIS), 0); \
+        } \
+      }while(0)
+
+      // Stop an active pulse if needed
+      #define PULSE_STOP(AXIS) do { \
+        if (step_needed[_AXIS(AXIS)]) { \
+          _APPLY_STEP(AXIS, _INVERT_STEP_PIN(AXIS), 0); \
+        } \
+      }while(0)
+
+    #endif
+
+    #if HAS_SHAPING
+      // Point the DIR pin of a shaped axis the way of its next output step
+      #define SHAPED_DIR(A, a, FWD) do{ \
+        if (shaping_##a.forward != (FWD)) { \
+          shaping_##a.forward = (FWD); \
+          DIR_WAIT_BEFORE(); \
+          A##_APPLY_DIR((FWD) ? !INVERT_##A##_DIR : INVERT_##A##_DIR, false); \
+          DIR_WAIT_AFTER(); \
+        } \
+      }while(0)
+
+      // Feed the Bresenham step to the shaper and take its output step instead
+      #define SHAPED_PULSE_PREP(A, a) do{ \
+        if (shaping_##a.enabled) { \
+          if (step_needed[_AXIS(A)]) shaping_##a.input(shaping_time, !motor_direction(_AXIS(A))); \
+          const int8_t s = shaping_##a.take_step(); \
+          step_needed[_AXIS(A)] = s != 0; \
+          if (s) SHAPED_DIR(A, a, s > 0); \
+        } \
+      }while(0)
+    #endif
+
+    #if ENABLED(NATIVE_ARCS)
+      // The shaper drives the DIR pin of a shaped axis itself
+      #define ARC_SHAPED_X TERN0(INPUT_SHAPING_X, shaping_x.enabled)
+      #define ARC_SHAPED_Y TERN0(INPUT_SHAPING_Y, shaping_y.enabled)
+
+      // Step toward the rounded point on the arc, turning the axis around when needed
+      #define ARC_PULSE_PREP(A, a) do{ \
+        const int32_t want = arc_events ? (arc_point.a - current_block->arc.a + int32_t(arc_drift.a >> 32) + _BV32(ARC_FRACT_BITS - 1)) >> (ARC_FRACT_BITS) \
+                                        : current_block->arc.end_##a; \
+        step_needed[_AXIS(A)] = want != arc_count.a; \
+        if (step_needed[_AXIS(A)]) { \
+          const bool fwd = want > arc_count.a; \
+          if (fwd == motor_direction(_AXIS(A))) { \
+            TBI(last_direction_bits, _AXIS(A)); \
+            count_direction[_AXIS(A)] = fwd ? 1 : -1; \
+            if (!ARC_SHAPED_##A) { \
+              DIR_WAIT_BEFORE(); \
+              A##_APPLY_DIR(fwd ? !INVERT_##A##_DIR : INVERT_##A##_DIR, false); \
+              DIR_WAIT_AFTER(); \
+            } \
+          } \
+          arc_count.a += count_direction[_AXIS(A)]; \
+          count_position[_AXIS(A)] += count_direction[_AXIS(A)]; \
+        } \
+      }while(0)
+    #endif
 
     // Direct Stepping page?
-    const bool is_page = current_block->is_page();
+    const bool is_page = TERN(STEPPER_ISR_VARIANTS, bool(mode & PULSE_PAGE), current_block->is_page());
 
     #if ENABLED(DIRECT_STEPPING)
       // Direct stepping is currently not ready for HAS_I_AXIS
@@ -1718,6 +2014,68 @@ void Stepper::pulse_phase_isr() {
 
           page_step_state.segment_steps++;
 
+        #elif STEPPER_PAGE_FORMAT == SP_4x4DP_128
+
+          // Take the next 4-bit value for an axis flagged in the record header
+          #define PAGE_SEGMENT_UPDATE(AXIS, BIT) do{                                           \
+            if (TEST(head, BIT)) {                                                              \
+              const uint8_t v = (hi = !hi) ? (b = pg[page_step_state.segment_idx++]) >> 4 : b & 0xF; \
+                   if (v < 7) SBI(dm, _AXIS(AXIS));                                             \
+              else if (v > 7) CBI(dm, _AXIS(AXIS));                                             \
+              page_step_state.sd[_AXIS(AXIS)] = v;                                              \
+            }                                                                                   \
+          }while(0)
+
+          #define PAGE_SEGMENT_COUNT(AXIS) \
+            page_step_state.bd[_AXIS(AXIS)] += page_step_state.sd[_AXIS(AXIS)] - 7
+
+          #define PAGE_PULSE_PREP(AXIS) do{ \
+            step_needed[_AXIS(AXIS)] =      \
+              pgm_read_byte(&segment_table[page_step_state.sd[_AXIS(AXIS)]][page_step_state.segment_steps & 0x7]); \
+          }while(0)
+
+          switch (page_step_state.segment_steps) {
+            case DirectStepping::Config::SEGMENT_STEPS:
+              page_step_state.segment_steps = 0;
+              // fallthru
+            case 0: {
+              // Unchanged axes keep their values for the whole run
+              if (!page_step_state.run) {
+                const uint8_t * const pg = page_step_state.page,
+                              head = pg[page_step_state.segment_idx++];
+                page_step_state.run = (head & 0xF) + 1;
+
+                uint8_t b = 0;
+                bool hi = false;
+                axis_bits_t dm = last_direction_bits;
+
+                PAGE_SEGMENT_UPDATE(X, 7);
+                PAGE_SEGMENT_UPDATE(Y, 6);
+                PAGE_SEGMENT_UPDATE(Z, 5);
+                PAGE_SEGMENT_UPDATE(E, 4);
+
+                if (dm != last_direction_bits)
+                  set_directions(dm);
+              }
+              page_step_state.run--;
+
+              PAGE_SEGMENT_COUNT(X);
+              PAGE_SEGMENT_COUNT(Y);
+              PAGE_SEGMENT_COUNT(Z);
+              PAGE_SEGMENT_COUNT(E);
+
+            } break;
+
+            default: break;
+          }
+
+          PAGE_PULSE_PREP(X);
+          PAGE_PULSE_PREP(Y);
+          PAGE_PULSE_PREP(Z);
+          TERN_(HAS_EXTRUDERS, PAGE_PULSE_PREP(E));
+
+          page_step_state.segment_steps++;
+
         #elif STEPPER_PAGE_FORMAT == SP_4x2_256
 
           #define PAGE_SEGMENT_UPDATE(AXIS, VALUE) \
@@ -1778,12 +2136,26 @@ void Stepper::pulse_phase_isr() {
 
     if (!is_page) {
       // Determine if pulses are needed
-      #if HAS_X_STEP
-        PULSE_PREP(X);
-      #endif
-      #if HAS_Y_STEP
-        PULSE_PREP(Y);
+      #if ENABLED(NATIVE_ARCS)
+        if (is_arc) {
+          // Minsky's circle: rotating Y with the new X keeps the orbit closed
+          const int32_t eps = current_block->arc.eps;
+          arc_point.x -= int32_t((int64_t(arc_point.y) * eps + _BV32(29)) >> 30);
+          arc_point.y += int32_t((int64_t(arc_point.x) * eps + _BV32(29)) >> 30);
+          arc_drift.x += current_block->arc.drift_x;
+          arc_drift.y += current_block->arc.drift_y;
+          --arc_events;                   // The last event lands right on the target
+          ARC_PULSE_PREP(X, x);
+          ARC_PULSE_PREP(Y, y);
+        }
+        else
       #endif
+      {
+        TERN_(HAS_X_STEP, PULSE_PREP(X));
+        TERN_(HAS_Y_STEP, PULSE_PREP(Y));
+      }
+      TERN_(INPUT_SHAPING_X, SHAPED_PULSE_PREP(X, x));
+      TERN_(INPUT_SHAPING_Y, SHAPED_PULSE_PREP(Y, y));
       #if HAS_Z_STEP
         PULSE_PREP(Z);
       #endif
@@ -1812,15 +2184,46 @@ void Stepper::pulse_phase_isr() {
       #elif HAS_E0_STEP
         PULSE_PREP(E);
       #endif
+
+      #if ENABLED(LIN_ADVANCE_INTEGRATED)
+        // Send one of the waiting E steps with this event. Steps in opposite directions cancel out.
+        step_needed.e = LA_steps != 0;
+        if (step_needed.e) {
+          const bool fwd = LA_steps > 0;
+          if (fwd != LA_forward) {
+            LA_forward = fwd;
+            DIR_WAIT_BEFORE();
+            if (fwd) NORM_E_DIR(stepper_extruder); else REV_E_DIR(stepper_extruder);
+            count_direction.e = fwd ? 1 : -1;
+            DIR_WAIT_AFTER();
+          }
+          LA_steps += fwd ? -1 : 1;
+          count_position.e += count_direction.e;
+        }
+      #endif
     }
 
     #if ISR_MULTI_STEPS
       if (firstStep)
         firstStep = false;
-      else
+      else if (TERN1(STEP_DMA, !use_dma))
         AWAIT_LOW_PULSE();
     #endif
 
+    TERN_(STEP_DMA, if (use_dma) StepDMA::clear_event(dma_events));
+
+    #if ENABLED(STEP_CAPTURE)
+      if (StepCapture::armed) {
+        uint8_t steps = 0, dirs = last_direction_bits;
+        LOOP_LOGICAL_AXES(i) if (step_needed[i]) SBI(steps, i);
+        // Shaped axes and the pressure lead drive their own DIR pins
+        TERN_(INPUT_SHAPING_X, if (shaping_x.enabled) SET_BIT_TO(dirs, X_AXIS, !shaping_x.forward));
+        TERN_(INPUT_SHAPING_Y, if (shaping_y.enabled) SET_BIT_TO(dirs, Y_AXIS, !shaping_y.forward));
+        TERN_(LIN_ADVANCE_INTEGRATED, SET_BIT_TO(dirs, E_AXIS, !LA_forward));
+        StepCapture::record(steps, dirs);
+      }
+    #endif
+
     // Pulse start
     #if HAS_X_STEP
       PULSE_START(X);
@@ -1841,7 +2244,7 @@ void Stepper::pulse_phase_isr() {
       PULSE_START(K);
     #endif
 
-    #if DISABLED(LIN_ADVANCE)
+    #if !HAS_ADVANCE_ISR
       #if ENABLED(MIXING_EXTRUDER)
         if (step_needed.e) E_STEP_WRITE(mixer.get_next_stepper(), !INVERT_E_STEP_PIN);
       #elif HAS_E0_STEP
@@ -1853,8 +2256,10 @@ void Stepper::pulse_phase_isr() {
 
     // TODO: need to deal with MINIMUM_STEPPER_PULSE over i2s
     #if ISR_MULTI_STEPS
-      START_HIGH_PULSE();
-      AWAIT_HIGH_PULSE();
+      if (TERN1(STEP_DMA, !use_dma)) {
+        START_HIGH_PULSE();
+        AWAIT_HIGH_PULSE();
+      }
     #endif
 
     // Pulse stop
@@ -1877,7 +2282,7 @@ void Stepper::pulse_phase_isr() {
       PULSE_STOP(K);
     #endif
 
-    #if DISABLED(LIN_ADVANCE)
+    #if !HAS_ADVANCE_ISR
       #if ENABLED(MIXING_EXTRUDER)
         if (delta_error.e >= 0) {
           delta_error.e -= advance_divisor;
@@ -1888,18 +2293,116 @@ void Stepper::pulse_phase_isr() {
       #endif
     #endif
 
+    #if ENABLED(STEP_DMA)
+      if (use_dma) ++dma_events;
+    #endif
+
     #if ISR_MULTI_STEPS
-      if (events_to_do) START_LOW_PULSE();
+      if (events_to_do && TERN1(STEP_DMA, !use_dma)) START_LOW_PULSE();
     #endif
 
   } while (--events_to_do);
+
+  // Play out the queued pulses
+  TERN_(STEP_DMA, if (dma_events) StepDMA::start(dma_events));
+}
+
+/**
+ * This phase of the ISR should ONLY create the pulses for the steppers.
+ * This prevents jitter caused by the interval between the start of the
+ * interrupt and the start of the pulses. DON'T add any logic ahead of the
+ * call to this method that might cause variation in the timing. The aim
+ * is to keep pulse timing as regular as possible.
+ */
+HOT_ISR_FUNC void Stepper::pulse_phase_isr() {
+
+  // If we must abort the current block, do so!
+  if (abort_current_block) {
+    abort_current_block = false;
+    if (current_block) discard_current_block();
+  }
+
+  // If there is no current block, do nothing
+  if (!current_block) return;
+
+  // Skipping step processing causes motion to freeze
+  if (TERN0(FREEZE_FEATURE, frozen)) return;
+
+  TERN(STEPPER_ISR_VARIANTS, block_pulse_events(), pulse_events<0>());
 }
 
+#if HAS_SHAPING
+
+  /**
+   * Add the echoes that are due and give the shaped axes the steps they are owed,
+   * observing the minimum pulse timing. Return the ticks until the next echo.
+   */
+  uint32_t Stepper::shaping_isr() {
+    uint32_t interval = SHAPING_NEVER;
+    TERN_(INPUT_SHAPING_X, NOMORE(interval, shaping_x.echo(shaping_time)));
+    TERN_(INPUT_SHAPING_Y, NOMORE(interval, shaping_y.echo(shaping_time)));
+
+    #if ISR_MULTI_STEPS
+      USING_TIMED_PULSE();
+    #endif
+
+    for (uint8_t n = 0; n < 128; ++n) {
+      const int8_t sx = TERN0(INPUT_SHAPING_X, shaping_x.take_step()),
+                   sy = TERN0(INPUT_SHAPING_Y, shaping_y.take_step());
+      if (!sx && !sy) break;
+
+      #if ISR_MULTI_STEPS
+        if (n) AWAIT_LOW_PULSE();
+      #endif
+
+      #if ENABLED(INPUT_SHAPING_X)
+        if (sx) { SHAPED_DIR(X, x, sx > 0); X_APPLY_STEP(!INVERT_X_STEP_PIN, false); }
+      #endif
+      #if ENABLED(INPUT_SHAPING_Y)
+        if (sy) { SHAPED_DIR(Y, y, sy > 0); Y_APPLY_STEP(!INVERT_Y_STEP_PIN, false); }
+      #endif
+
+      #if ENABLED(STEP_CAPTURE)
+        if (StepCapture::armed)
+          StepCapture::record((sx ? _BV(X_AXIS) : 0) | (sy ? _BV(Y_AXIS) : 0),
+                              (sx < 0 ? _BV(X_AXIS) : 0) | (sy < 0 ? _BV(Y_AXIS) : 0));
+      #endif
+
+      #if ISR_MULTI_STEPS
+        START_HIGH_PULSE();
+        AWAIT_HIGH_PULSE();
+      #endif
+
+      #if ENABLED(INPUT_SHAPING_X)
+        if (sx) X_APPLY_STEP(INVERT_X_STEP_PIN, false);
+      #endif
+      #if ENABLED(INPUT_SHAPING_Y)
+        if (sy) Y_APPLY_STEP(INVERT_Y_STEP_PIN, false);
+      #endif
+
+      #if ISR_MULTI_STEPS
+        START_LOW_PULSE();
+      #endif
+    }
+
+    return interval;
+  }
+
+  void Stepper::refresh_shaping() {
+    planner.synchronize();
+    const bool was_enabled = suspend();
+    TERN_(INPUT_SHAPING_X, shaping_x.refresh());
+    TERN_(INPUT_SHAPING_Y, shaping_y.refresh());
+    if (was_enabled) wake_up();
+  }
+
+#endif // HAS_SHAPING
+
 // This is the last half of the stepper interrupt: This one processes and
 // properly schedules blocks from the planner. This is executed after creating
 // the step pulses, so it is not time critical, as pulses are already done.
 
-uint32_t Stepper::block_phase_isr() {
+HOT_ISR_FUNC uint32_t Stepper::block_phase_isr() {
 
   // If no queued movements, just wait 1ms for the next block
   uint32_t interval = (STEPPER_TIMER_RATE) / 1000UL;
@@ -1913,6 +2416,9 @@ uint32_t Stepper::block_phase_isr() {
         #if STEPPER_PAGE_FORMAT == SP_4x4D_128
           #define PAGE_SEGMENT_UPDATE_POS(AXIS) \
             count_position[_AXIS(AXIS)] += page_step_state.bd[_AXIS(AXIS)] - 128 * 7;
+        #elif STEPPER_PAGE_FORMAT == SP_4x4DP_128
+          #define PAGE_SEGMENT_UPDATE_POS(AXIS) \
+            count_position[_AXIS(AXIS)] += page_step_state.bd[_AXIS(AXIS)];
         #elif STEPPER_PAGE_FORMAT == SP_4x1_512 || STEPPER_PAGE_FORMAT == SP_4x2_256
           #define PAGE_SEGMENT_UPDATE_POS(AXIS) \
             count_position[_AXIS(AXIS)] += page_step_state.bd[_AXIS(AXIS)] * count_direction[_AXIS(AXIS)];
@@ -1926,6 +2432,8 @@ uint32_t Stepper::block_phase_isr() {
         }
       #endif
       TERN_(HAS_FILAMENT_RUNOUT_DISTANCE, runout.block_completed(current_block));
+      TERN_(PRINTCOUNTER_WEAR, print_job_timer.block_completed(current_block->steps));
+      TERN_(TIMELAPSE, timelapse.block_completed(current_block));
       discard_current_block();
     }
     else {
@@ -1936,12 +2444,12 @@ uint32_t Stepper::block_phase_isr() {
 
         #if ENABLED(S_CURVE_ACCELERATION)
           // Get the next speed to use (Jerk limited!)
-          uint32_t acc_step_rate = acceleration_time < current_block->acceleration_time
+          uint32_t acc_step_rate = acceleration_time < BLOCK_EXEC(acceleration_time)
                                    ? _eval_bezier_curve(acceleration_time)
-                                   : current_block->cruise_rate;
+                                   : BLOCK_EXEC(cruise_rate);
         #else
-          acc_step_rate = STEP_MULTIPLY(acceleration_time, current_block->acceleration_rate) + current_block->initial_rate;
-          NOMORE(acc_step_rate, current_block->nominal_rate);
+          acc_step_rate = STEP_MULTIPLY(acceleration_time, BLOCK_EXEC(acceleration_rate)) + BLOCK_EXEC(initial_rate);
+          NOMORE(acc_step_rate, BLOCK_EXEC(nominal_rate));
         #endif
 
         // acc_step_rate is in steps/second
@@ -1950,7 +2458,9 @@ uint32_t Stepper::block_phase_isr() {
         interval = calc_timer_interval(acc_step_rate, &steps_per_isr);
         acceleration_time += interval;
 
-        #if ENABLED(LIN_ADVANCE)
+        #if ENABLED(LIN_ADVANCE_INTEGRATED)
+          advance_update(acc_step_rate, interval);
+        #elif ENABLED(LIN_ADVANCE)
           if (LA_use_advance_lead) {
             // Fire ISR if final adv_rate is reached
             if (LA_steps && LA_isr_rate != current_block->advance_speed) nextAdvanceISR = 0;
@@ -1991,26 +2501,30 @@ uint32_t Stepper::block_phase_isr() {
           // If this is the 1st time we process the 2nd half of the trapezoid...
           if (!bezier_2nd_half) {
             // Initialize the Bézier speed curve
-            _calc_bezier_curve_coeffs(current_block->cruise_rate, current_block->final_rate, current_block->deceleration_time_inverse);
+            #if ENABLED(BLOCK_EXEC_TABLE)
+              _load_bezier_curve_coeffs(1);
+            #else
+              _calc_bezier_curve_coeffs(current_block->cruise_rate, current_block->final_rate, current_block->deceleration_time_inverse);
+            #endif
             bezier_2nd_half = true;
             // The first point starts at cruise rate. Just save evaluation of the Bézier curve
-            step_rate = current_block->cruise_rate;
+            step_rate = BLOCK_EXEC(cruise_rate);
           }
           else {
             // Calculate the next speed to use
-            step_rate = deceleration_time < current_block->deceleration_time
+            step_rate = deceleration_time < BLOCK_EXEC(deceleration_time)
               ? _eval_bezier_curve(deceleration_time)
-              : current_block->final_rate;
+              : BLOCK_EXEC(final_rate);
           }
         #else
           // Using the old trapezoidal control
-          step_rate = STEP_MULTIPLY(deceleration_time, current_block->acceleration_rate);
+          step_rate = STEP_MULTIPLY(deceleration_time, BLOCK_EXEC(acceleration_rate));
           if (step_rate < acc_step_rate) { // Still decelerating?
             step_rate = acc_step_rate - step_rate;
-            NOLESS(step_rate, current_block->final_rate);
+            NOLESS(step_rate, BLOCK_EXEC(final_rate));
           }
           else
-            step_rate = current_block->final_rate;
+            step_rate = BLOCK_EXEC(final_rate);
         #endif
 
         // step_rate is in steps/second
@@ -2019,7 +2533,9 @@ uint32_t Stepper::block_phase_isr() {
         interval = calc_timer_interval(step_rate, &steps_per_isr);
         deceleration_time += interval;
 
-        #if ENABLED(LIN_ADVANCE)
+        #if ENABLED(LIN_ADVANCE_INTEGRATED)
+          advance_update(step_rate, interval);
+        #elif ENABLED(LIN_ADVANCE)
           if (LA_use_advance_lead) {
             // Wake up eISR on first deceleration loop and fire ISR if final adv_rate is reached
             if (step_events_completed <= decelerate_after + steps_per_isr || (LA_steps && LA_isr_rate != current_block->advance_speed)) {
@@ -2050,7 +2566,7 @@ uint32_t Stepper::block_phase_isr() {
       }
       else {  // Must be in cruise phase otherwise
 
-        #if ENABLED(LIN_ADVANCE)
+        #if HAS_ADVANCE_ISR
           // If there are any esteps, fire the next advance_isr "now"
           if (LA_steps && LA_isr_rate != current_block->advance_speed) initiateLA();
         #endif
@@ -2058,11 +2574,13 @@ uint32_t Stepper::block_phase_isr() {
         // Calculate the ticks_nominal for this nominal speed, if not done yet
         if (ticks_nominal < 0) {
           // step_rate to timer interval and loops for the nominal speed
-          ticks_nominal = calc_timer_interval(current_block->nominal_rate, &steps_per_isr);
+          ticks_nominal = calc_timer_interval(BLOCK_EXEC(nominal_rate), &steps_per_isr);
         }
 
         // The timer interval is just the nominal value for the nominal speed
         interval = ticks_nominal;
+
+        TERN_(LIN_ADVANCE_INTEGRATED, advance_update(BLOCK_EXEC(nominal_rate), interval));
       }
 
       /* Adjust Laser Power - Cruise
@@ -2139,6 +2657,9 @@ uint32_t Stepper::block_phase_isr() {
           return interval; // No more queued movements!
       }
 
+      // Locate the block's entry in the planner execution table
+      TERN_(BLOCK_EXEC_TABLE, exec_index = current_block - planner.block_buffer);
+
       // For non-inline cutter, grossly apply power
       #if HAS_CUTTER
         if (cutter.cutter_mode == CUTTER_MODE_STANDARD) {
@@ -2157,6 +2678,10 @@ uint32_t Stepper::block_phase_isr() {
           page_step_state.segment_idx = 0;
           page_step_state.page = page_manager.get_page(current_block->page_idx);
           page_step_state.bd.reset();
+          #if STEPPER_PAGE_FORMAT == SP_4x4DP_128
+            page_step_state.run = 0;
+            LOOP_L_N(i, 4) page_step_state.sd[i] = 7; // At rest
+          #endif
 
           if (DirectStepping::Config::DIRECTIONAL)
             current_block->direction_bits = last_direction_bits;
@@ -2255,7 +2780,9 @@ uint32_t Stepper::block_phase_isr() {
       #if ENABLED(ADAPTIVE_STEP_SMOOTHING)
         uint8_t oversampling = 0;                           // Assume no axis smoothing (via oversampling)
         // Decide if axis smoothing is possible
-        uint32_t max_rate = current_block->nominal_rate;    // Get the step event rate
+        uint32_t max_rate = BLOCK_EXEC(nominal_rate);       // Get the step event rate
+        if (TERN0(NATIVE_ARCS, current_block->is_arc()))    // Arcs are planned per step event
+          max_rate = MIN_STEP_ISR_FREQUENCY;
         while (max_rate < MIN_STEP_ISR_FREQUENCY) {         // As long as more ISRs are possible...
           max_rate <<= 1;                                   // Try to double the rate
           if (max_rate < MIN_STEP_ISR_FREQUENCY)            // Don't exceed the estimated ISR limit
@@ -2279,16 +2806,46 @@ uint32_t Stepper::block_phase_isr() {
       // No step events completed so far
       step_events_completed = 0;
 
+      #if ENABLED(NATIVE_ARCS)
+        // Start tracing the arc
+        if (current_block->is_arc()) {
+          arc_point.set(current_block->arc.x, current_block->arc.y);
+          arc_count.reset();
+          arc_drift.reset();
+          arc_events = step_event_count;
+          TERN_(STEP_DMA, StepDMA::wait()); // Arcs step directly, so let a queued burst finish
+        }
+      #endif
+
       // Compute the acceleration and deceleration points
-      accelerate_until = current_block->accelerate_until << oversampling;
-      decelerate_after = current_block->decelerate_after << oversampling;
+      accelerate_until = BLOCK_EXEC(accelerate_until) << oversampling;
+      decelerate_after = BLOCK_EXEC(decelerate_after) << oversampling;
 
       TERN_(MIXING_EXTRUDER, mixer.stepper_setup(current_block->b_color));
 
       E_TERN_(stepper_extruder = current_block->extruder);
 
+      #if ENABLED(STEPPER_ISR_VARIANTS)
+        // Step this block with the loop built for its extruder and kind
+        block_pulse_events = pulse_variant<0>(stepper_extruder * (PULSE_MODES)
+          | TERN0(NATIVE_ARCS, current_block->is_arc() ? PULSE_ARC : 0)
+          | TERN0(DIRECT_STEPPING, current_block->is_page() ? PULSE_PAGE : 0)
+          | TERN0(STEP_DMA, StepDMA::enabled && TERN1(NATIVE_ARCS, !current_block->is_arc()) ? PULSE_DMA : 0)
+        );
+      #endif
+
       // Initialize the trapezoid generator from the current block.
-      #if ENABLED(LIN_ADVANCE)
+      #if ENABLED(LIN_ADVANCE_INTEGRATED)
+        #if E_STEPPERS > 1
+          if (stepper_extruder != last_moved_extruder) {
+            // The now active extruder has no pressure built up, and its DIR pin must be set
+            LA_lead = LA_lead_steps = 0;
+            if (LA_forward) NORM_E_DIR(stepper_extruder); else REV_E_DIR(stepper_extruder);
+          }
+        #endif
+        LA_use_advance_lead = current_block->use_advance_lead;
+        LA_gain = current_block->advance_gain;
+      #elif ENABLED(LIN_ADVANCE)
         #if DISABLED(MIXING_EXTRUDER) && E_STEPPERS > 1
           // If the now active extruder wasn't in use during the last move, its pressure is most likely gone.
           if (stepper_extruder != last_moved_extruder) LA_current_adv_steps = 0;
@@ -2330,6 +2887,9 @@ uint32_t Stepper::block_phase_isr() {
         }
       #endif // LASER_FEATURE
 
+      // Only interrupt on the endstops this block moves toward
+      TERN_(ENDSTOP_INTERRUPTS_BY_DIRECTION, endstops.select_interrupts());
+
       // If the endstop is already pressed, endstop interrupts won't invoke
       // endstop_triggered and the move will grind. So check here for a
       // triggered endstop, which marks the block for discard on the next ISR.
@@ -2347,16 +2907,20 @@ uint32_t Stepper::block_phase_isr() {
 
       #if ENABLED(S_CURVE_ACCELERATION)
         // Initialize the Bézier speed curve
-        _calc_bezier_curve_coeffs(current_block->initial_rate, current_block->cruise_rate, current_block->acceleration_time_inverse);
+        #if ENABLED(BLOCK_EXEC_TABLE)
+          _load_bezier_curve_coeffs(0);
+        #else
+          _calc_bezier_curve_coeffs(current_block->initial_rate, current_block->cruise_rate, current_block->acceleration_time_inverse);
+        #endif
         // We haven't started the 2nd half of the trapezoid
         bezier_2nd_half = false;
       #else
         // Set as deceleration point the initial rate of the block
-        acc_step_rate = current_block->initial_rate;
+        acc_step_rate = BLOCK_EXEC(initial_rate);
       #endif
 
       // Calculate the initial timer interval
-      interval = calc_timer_interval(current_block->initial_rate, &steps_per_isr);
+      interval = calc_timer_interval(BLOCK_EXEC(initial_rate), &steps_per_isr);
     }
   }
 
@@ -2364,10 +2928,29 @@ uint32_t Stepper::block_phase_isr() {
   return interval;
 }
 
-#if ENABLED(LIN_ADVANCE)
+#if ENABLED(LIN_ADVANCE_INTEGRATED)
+
+  /**
+   * The nozzle needs a lead of K times the E velocity, here the step rate times the
+   * block gain. Low-pass filter it over the time this step rate lasts, so S-Curve and
+   * trapezoid ramps alike give a smooth lead that pulse_phase_isr follows one step at a time.
+   */
+  void Stepper::advance_update(const uint32_t step_rate, const uint32_t interval) {
+    constexpr uint32_t smooth_ticks = uint32_t(STEPPER_TIMER_RATE / 1000UL * (LIN_ADVANCE_SMOOTH_TIME)),
+                       smooth_factor = _BV32(24) / smooth_ticks; // Q24 weight per timer tick
+    static_assert(smooth_factor, "LIN_ADVANCE_SMOOTH_TIME is too long for the stepper timer rate.");
+
+    uint64_t target = LA_use_advance_lead ? (uint64_t(step_rate) * LA_gain) >> 8 : 0; // Q16 steps
+    NOMORE(target, uint64_t(INT32_MAX));
+
+    const uint32_t weight = interval < smooth_ticks ? interval * smooth_factor : _BV32(24);
+    LA_lead += int32_t((int64_t(int32_t(target) - LA_lead) * weight) >> 24);
+  }
+
+#elif ENABLED(LIN_ADVANCE)
 
   // Timer interrupt for E. LA_steps is set in the main routine
-  uint32_t Stepper::advance_isr() {
+  HOT_ISR_FUNC uint32_t Stepper::advance_isr() {
     uint32_t interval;
 
     if (LA_use_advance_lead) {
@@ -2733,6 +3316,21 @@ void Stepper::init() {
     E_AXIS_INIT(7);
   #endif
 
+  #if ENABLED(STEP_DMA)
+    // Map the step pins to the DMA burst ports
+    StepDMA::init(_MAX(_MIN_PULSE_HIGH_NS, _MIN_PULSE_LOW_NS));
+    TERN_(HAS_X_STEP, StepDMA::add_motor(X_AXIS, X_STEP_PIN, INVERT_X_STEP_PIN));
+    TERN_(HAS_Y_STEP, StepDMA::add_motor(Y_AXIS, Y_STEP_PIN, INVERT_Y_STEP_PIN));
+    TERN_(HAS_Z_STEP, StepDMA::add_motor(Z_AXIS, Z_STEP_PIN, INVERT_Z_STEP_PIN));
+    TERN_(HAS_I_STEP, StepDMA::add_motor(I_AXIS, I_STEP_PIN, INVERT_I_STEP_PIN));
+    TERN_(HAS_J_STEP, StepDMA::add_motor(J_AXIS, J_STEP_PIN, INVERT_J_STEP_PIN));
+    TERN_(HAS_K_STEP, StepDMA::add_motor(K_AXIS, K_STEP_PIN, INVERT_K_STEP_PIN));
+    #if DISABLED(LIN_ADVANCE)
+      #define _DMA_E_MOTOR(N) StepDMA::add_motor(E_AXIS + N, E##N##_STEP_PIN, INVERT_E_STEP_PIN);
+      REPEAT(E_STEPPERS, _DMA_E_MOTOR)
+    #endif
+  #endif
+
   #if DISABLED(I2S_STEPPER_STREAM)
     HAL_timer_start(MF_TIMER_STEP, 122); // Init Stepper ISR to 122 Hz for quick starting
     wake_up();
@@ -2751,6 +3349,12 @@ void Stepper::init() {
     )
   );
 
+  #if ENABLED(LIN_ADVANCE_INTEGRATED)
+    // Match the E DIR pins to the cached forward state
+    LOOP_L_N(e, E_STEPPERS) NORM_E_DIR(e);
+    count_direction.e = 1;
+  #endif
+
   #if HAS_MOTOR_CURRENT_SPI || HAS_MOTOR_CURRENT_PWM
     initialized = true;
     digipot_init();
@@ -2896,19 +3500,27 @@ int32_t Stepper::triggered_position(const AxisEnum axis) {
   #define SAYS_C 1
 #endif
 
-void Stepper::report_a_position(const xyz_long_t &pos) {
-  SERIAL_ECHOLNPGM_P(
-    LIST_N(DOUBLE(LINEAR_AXES),
-      TERN(SAYS_A, PSTR(STR_COUNT_A), PSTR(STR_COUNT_X)), pos.x,
-      TERN(SAYS_B, PSTR("B:"), SP_Y_LBL), pos.y,
-      TERN(SAYS_C, PSTR("C:"), SP_Z_LBL), pos.z,
-      SP_I_LBL, pos.i,
-      SP_J_LBL, pos.j,
-      SP_K_LBL, pos.k
-    )
+template <class OUT>
+static void print_a_position(OUT &out, const xyz_long_t &pos) {
+  #define _PRINT_COUNT(L,V) do{ report_print_P(out, L); out.print(V); }while(0)
+  LINEAR_AXIS_CODE(
+    _PRINT_COUNT(TERN(SAYS_A, PSTR(STR_COUNT_A), PSTR(STR_COUNT_X)), pos.x),
+    _PRINT_COUNT(TERN(SAYS_B, PSTR("B:"), SP_Y_LBL), pos.y),
+    _PRINT_COUNT(TERN(SAYS_C, PSTR("C:"), SP_Z_LBL), pos.z),
+    _PRINT_COUNT(SP_I_LBL, pos.i),
+    _PRINT_COUNT(SP_J_LBL, pos.j),
+    _PRINT_COUNT(SP_K_LBL, pos.k)
   );
+  #undef _PRINT_COUNT
+  out.write('\n');
 }
 
+void Stepper::report_a_position(const xyz_long_t &pos) { print_a_position(SERIAL_IMPL, pos); }
+
+#if ENABLED(REPORT_CACHE)
+  void Stepper::report_a_position(ReportCache &out, const xyz_long_t &pos) { print_a_position(out, pos); }
+#endif
+
 void Stepper::report_positions() {
 
   #ifdef __AVR__
@@ -45,9 +45,15 @@
 
 #include "planner.h"
 #include "stepper/indirection.h"
+#if HAS_SHAPING
+  #include "shaping.h"
+#endif
 #ifdef __AVR__
   #include "stepper/speed_lookuptable.h"
 #endif
+#if ENABLED(REPORT_CACHE)
+  #include "../libs/report_cache.h"
+#endif
 
 // Disable multiple steps per ISR
 //#define DISABLE_MULTI_STEPPING
@@ -310,6 +316,13 @@ class Stepper {
       static bool separate_multi_axis;
     #endif
 
+    #if ENABLED(INPUT_SHAPING_X)
+      static AxisShaper shaping_x;        // M593 X
+    #endif
+    #if ENABLED(INPUT_SHAPING_Y)
+      static AxisShaper shaping_y;        // M593 Y
+    #endif
+
     #if HAS_MOTOR_CURRENT_SPI || HAS_MOTOR_CURRENT_PWM
       #if HAS_MOTOR_CURRENT_PWM
         #ifndef PWM_MOTOR_CURRENT
@@ -367,6 +380,25 @@ class Stepper {
     static uint32_t acceleration_time, deceleration_time; // time measured in Stepper Timer ticks
     static uint8_t steps_per_isr;         // Count of steps to perform per Stepper ISR call
 
+    #if ENABLED(BLOCK_EXEC_TABLE)
+      static uint8_t exec_index;          // Index of the current block in the planner execution table
+    #endif
+
+    #if HAS_SHAPING
+      static uint32_t shaping_time;       // Stepper timer ticks since start, for queued step times
+    #endif
+
+    #if ENABLED(ADAPTIVE_STEP_BATCHING)
+      static bool batch_spread;           // Spread the steps of each batch over the step period
+      static uint8_t batch_pulses_left;   // Spread pulses remaining before the next block phase
+      static uint32_t batch_spacing,      // Timer ticks between spread pulses
+                      batch_full_rate,    // Max ISR rate with a block phase in every ISR
+                      batch_pulse_rate,   // Max ISR rate with pulse phases only
+                      batch_block_ratio,  // Block phase cost relative to a pulse ISR (x16)
+                      isr_pulse_cycles,   // Measured cost of a pulse-only ISR (x16)
+                      isr_block_cycles;   // Measured cost of the block phase (x16)
+    #endif
+
     #if ENABLED(ADAPTIVE_STEP_SMOOTHING)
       static uint8_t oversampling_factor; // Oversampling factor (log2(multiplier)) to increase temporal resolution of axis
     #else
@@ -400,12 +432,19 @@ class Stepper {
       static bool bezier_2nd_half; // If Bézier curve has been initialized or not
     #endif
 
-    #if ENABLED(LIN_ADVANCE)
+    #if HAS_ADVANCE_ISR
       static constexpr uint32_t LA_ADV_NEVER = 0xFFFFFFFF;
       static uint32_t nextAdvanceISR, LA_isr_rate;
       static uint16_t LA_current_adv_steps, LA_final_adv_steps, LA_max_adv_steps; // Copy from current executed block. Needed because current_block is set to NULL "too early".
       static int8_t LA_steps;
       static bool LA_use_advance_lead;
+    #elif ENABLED(LIN_ADVANCE_INTEGRATED)
+      static uint32_t LA_gain;             // Lead per step rate of the current block, Q24 steps per step/s
+      static int32_t LA_lead,              // Smoothed pressure lead, Q16 steps
+                     LA_lead_steps;        // Lead steps sent to the extruder so far
+      static int16_t LA_steps;             // E steps waiting to be sent (Bresenham + lead)
+      static bool LA_use_advance_lead,
+                  LA_forward;              // Current state of the E DIR pin
     #endif
 
     #if ENABLED(INTEGRATED_BABYSTEPPING)
@@ -417,6 +456,13 @@ class Stepper {
       static page_step_state_t page_step_state;
     #endif
 
+    #if ENABLED(NATIVE_ARCS)
+      static xy_long_t arc_point,         // Point on the arc relative to its center (Q12 steps)
+                       arc_count;         // Steps taken along X and Y since the arc started
+      static XYval<int64_t> arc_drift;    // Correction toward the target so far (Q12 << 32)
+      static uint32_t arc_events;         // Step events left on the arc
+    #endif
+
     static int32_t ticks_nominal;
     #if DISABLED(S_CURVE_ACCELERATION)
       static uint32_t acc_step_rate; // needed for deceleration start point
@@ -458,10 +504,26 @@ class Stepper {
     // The stepper block processing ISR phase
     static uint32_t block_phase_isr();
 
-    #if ENABLED(LIN_ADVANCE)
+    #if HAS_ADVANCE_ISR
       // The Linear advance ISR phase
       static uint32_t advance_isr();
       FORCE_INLINE static void initiateLA() { nextAdvanceISR = 0; }
+    #elif ENABLED(LIN_ADVANCE_INTEGRATED)
+      // Filter the pressure lead toward the one needed at the new step rate
+      static void advance_update(const uint32_t step_rate, const uint32_t interval);
+    #endif
+
+    #if HAS_SHAPING
+      // The Input Shaping ISR phase
+      static uint32_t shaping_isr();
+
+      // No shaped steps are pending
+      static bool shaping_idle() {
+        return TERN1(INPUT_SHAPING_X, shaping_x.idle()) && TERN1(INPUT_SHAPING_Y, shaping_y.idle());
+      }
+
+      // Apply changed shaper settings once all moves are done
+      static void refresh_shaping();
     #endif
 
     #if ENABLED(INTEGRATED_BABYSTEPPING)
@@ -487,6 +549,9 @@ class Stepper {
 
     // Report the positions of the steppers, in steps
     static void report_a_position(const xyz_long_t &pos);
+    #if ENABLED(REPORT_CACHE)
+      static void report_a_position(ReportCache &out, const xyz_long_t &pos);
+    #endif
     static void report_positions();
 
     // Discard current block and free any resources
@@ -616,6 +681,16 @@ class Stepper {
     // Set the current position in steps
     static void _set_position(const abce_long_t &spos);
 
+    // The step events of a pulse phase. STEPPER_ISR_VARIANTS builds one for each
+    // extruder and kind of block, and picks the one to use as each block begins.
+    template<uint8_t V> static void pulse_events();
+
+    #if ENABLED(STEPPER_ISR_VARIANTS)
+      typedef void (*pulse_events_t)();
+      static pulse_events_t block_pulse_events;
+      template<uint8_t V> static pulse_events_t pulse_variant(const uint8_t v);
+    #endif
+
     FORCE_INLINE static uint32_t calc_timer_interval(uint32_t step_rate, uint8_t *loops) {
       uint32_t timer;
 
@@ -623,7 +698,9 @@ class Stepper {
       step_rate <<= oversampling_factor;
 
       uint8_t multistep = 1;
-      #if DISABLED(DISABLE_MULTI_STEPPING)
+      #if ENABLED(ADAPTIVE_STEP_BATCHING)
+        multistep = batch_steps(step_rate);
+      #elif DISABLED(DISABLE_MULTI_STEPPING)
 
         // The stepping frequency limits for each multistepping rate
         static const uint32_t limit[] PROGMEM = {
@@ -649,7 +726,12 @@ class Stepper {
       #endif
       *loops = multistep;
 
-      #ifdef CPU_32_BIT
+      #if ENABLED(ADAPTIVE_STEP_BATCHING)
+        // One ISR period covers the whole batch. Split the division to avoid overflow.
+        const uint32_t q = uint32_t(STEPPER_TIMER_RATE) / step_rate,
+                       r = uint32_t(STEPPER_TIMER_RATE) - q * step_rate;
+        timer = q * multistep + r * multistep / step_rate;
+      #elif defined(CPU_32_BIT)
         // In case of high-performance processor, it is able to calculate in real-time
         timer = uint32_t(STEPPER_TIMER_RATE) / step_rate;
       #else
@@ -676,9 +758,17 @@ class Stepper {
       return timer;
     }
 
+    #if ENABLED(ADAPTIVE_STEP_BATCHING)
+      static uint8_t batch_steps(const uint32_t step_rate);
+      static void update_isr_load(const uint32_t pulse_cycles, const uint32_t block_cycles);
+    #endif
+
     #if ENABLED(S_CURVE_ACCELERATION)
       static void _calc_bezier_curve_coeffs(const int32_t v0, const int32_t v1, const uint32_t av);
       static int32_t _eval_bezier_curve(const uint32_t curr_step);
+      #if ENABLED(BLOCK_EXEC_TABLE)
+        static void _load_bezier_curve_coeffs(const uint8_t ramp);
+      #endif
     #endif
 
     #if HAS_MOTOR_CURRENT_SPI || HAS_MOTOR_CURRENT_PWM
@@ -30,6 +30,7 @@
 #include "../MarlinCore.h"
 #include "../HAL/shared/Delay.h"
 #include "../lcd/marlinui.h"
+#include "../libs/report_cache.h"
 
 #include "temperature.h"
 #include "endstops.h"
@@ -67,6 +68,10 @@
   #include "../gcode/gcode.h"
 #endif
 
+#if BOTH(PID_AUTOTUNE_PARALLEL, EEPROM_SETTINGS)
+  #include "settings.h"
+#endif
+
 #if ENABLED(NOZZLE_PARK_FEATURE)
   #include "../libs/nozzle.h"
 #endif
@@ -149,6 +154,19 @@
 #include HAL_PATH( ../HAL, hotend/ads1118.h)
 #endif
 
+#if ENABLED(ADS1118_SCHEDULER)
+  // Have the ADS1118 sample fast for the life of a blocking autotune
+  static bool ads1118_tuning; // = false
+  struct ADS1118Tuning {
+    ADS1118Tuning(const bool on) { ads1118_tuning = on; }
+    ~ADS1118Tuning() { ads1118_tuning = false; }
+  };
+#endif
+
+#if ENABLED(TOUCH_BACKGROUND_SAMPLING)
+  #include HAL_PATH(../HAL, tft/xpt2046.h)
+#endif
+
 #if ENABLED(MPCTEMP)
   #include <math.h>
   #include "probe.h"
@@ -162,6 +180,22 @@
   #include "../feature/babystep.h"
 #endif
 
+#if ENABLED(SOFT_I2C_ASYNC)
+  #include "../libs/soft_i2c_async.h"
+#endif
+
+#if ENABLED(ISR_PROFILER)
+  #include "../HAL/STM32/isr_profiler.h"
+#endif
+
+#if ENABLED(TRACE_EVENTS)
+  #include "../feature/trace_events.h"
+#endif
+
+#if ENABLED(CRASH_CAPTURE)
+  #include "../feature/crash_capture.h"
+#endif
+
 #if ENABLED(FILAMENT_WIDTH_SENSOR)
   #include "../feature/filwidth.h"
 #endif
@@ -607,6 +641,18 @@ volatile bool Temperature::raw_temps_ready = false;
     const bool isbed = (heater_id == H_BED),
            ischamber = (heater_id == H_CHAMBER);
 
+    #if ENABLED(PID_FAN_SCALING_AUTOTUNE)
+      // After tuning, hotends tune again with the part fan on. The rise in bias is Kf.
+      const uint8_t tune_fan = (isbed || ischamber || heater_id >= FAN_COUNT) ? 0 : heater_id;
+      bool fan_phase = false;
+      long fan_off_bias = 0;
+      raw_pid_t fan_off_pid = { 0, 0, 0 };
+      auto _set_tune_fan = [&](const uint8_t speed) {
+        set_fan_speed(tune_fan, speed);
+        planner.sync_fan_speeds(fan_speed);
+      };
+    #endif
+
     #if ENABLED(PIDTEMPCHAMBER)
       #define C_TERN(T,A,B) ((T) ? (A) : (B))
     #else
@@ -676,6 +722,8 @@ volatile bool Temperature::raw_temps_ready = false;
 
     LCD_MESSAGE(MSG_HEATING);
 
+    TERN_(ADS1118_SCHEDULER, const ADS1118Tuning ads1118_fast(heater_id >= 0));
+
     // PID Tuning loop
     wait_for_heatup = true;
     while (wait_for_heatup) { // Can be interrupted with M108
@@ -793,6 +841,22 @@ volatile bool Temperature::raw_temps_ready = false;
       }
 
       if (cycles > ncycles && cycles > 2) {
+        #if ENABLED(PID_FAN_SCALING_AUTOTUNE)
+          if (!isbed && !ischamber) {
+            if (!fan_phase) {
+              fan_phase = true;
+              fan_off_bias = bias;
+              fan_off_pid = tune_pid;
+              _set_tune_fan(255);
+              cycles = 0;
+              SERIAL_ECHOPGM(STR_PID_AUTOTUNE);
+              SERIAL_ECHOLNPGM(" again with the part fan on");
+              continue;
+            }
+            tune_pid = fan_off_pid;
+          }
+        #endif
+
         SERIAL_ECHOPGM(STR_PID_AUTOTUNE);
         SERIAL_ECHOLNPGM(STR_PID_AUTOTUNE_FINISHED);
         TERN_(HOST_PROMPT_SUPPORT, hostui.notify(GET_TEXT_F(MSG_PID_AUTOTUNE_DONE)));
@@ -808,6 +872,14 @@ volatile bool Temperature::raw_temps_ready = false;
           say_default_(); SERIAL_ECHOLNPGM("Kd ", tune_pid.d);
         #endif
 
+        #if ENABLED(PID_FAN_SCALING_AUTOTUNE)
+          if (fan_phase) {
+            const float tune_kf = _MAX(float(bias - fan_off_bias) - (PID_FAN_SCALING_LIN_FACTOR) * 255, 0.0f);
+            say_default_(); SERIAL_ECHOLNPGM("Kf ", tune_kf);
+            if (set_result) SET_HOTEND_PID(Kf, heater_id, tune_kf);
+          }
+        #endif
+
         auto _set_hotend_pid = [](const uint8_t tool, const raw_pid_t &in_pid) {
           #if ENABLED(PIDTEMP)
             #if ENABLED(PID_PARAMS_PER_HOTEND)
@@ -861,9 +933,228 @@ volatile bool Temperature::raw_temps_ready = false;
 
     EXIT_M303:
       TERN_(NO_FAN_SLOWING_IN_PID_TUNING, adaptive_fan_slowing = true);
+      TERN_(PID_FAN_SCALING_AUTOTUNE, if (fan_phase) _set_tune_fan(0));
       return;
   }
 
+  #if ENABLED(PID_AUTOTUNE_PARALLEL)
+
+    /**
+     * Parallel PID Autotuning (M303 A)
+     *
+     * The same relay method as PID_autotune, with one state machine per
+     * heater. get_pid_output_hotend/bed hand the heater over to the relay
+     * while its slot is running, and the normal target, watch and runaway
+     * protection stay in place. task() checks for timeouts and overshoot,
+     * then applies and saves all the results when every slot is finished.
+     */
+
+    enum : uint8_t { PID_TUNE_IDLE, PID_TUNE_RUN, PID_TUNE_DONE, PID_TUNE_FAIL };
+
+    Temperature::pid_tune_t Temperature::pid_tune[PID_TUNE_COUNT];
+    int8_t Temperature::pid_tune_cycles;
+    bool Temperature::pid_tune_active; // = false
+
+    inline bool tune_is_bed(const uint8_t i) { return TERN0(PIDTEMPBED, i == PID_TUNE_BED); }
+
+    static celsius_float_t tune_temp(const uint8_t i) {
+      TERN_(PIDTEMPBED, if (tune_is_bed(i)) return thermalManager.degBed());
+      return TERN(PIDTEMP, thermalManager.degHotend(i), 0);
+    }
+
+    static celsius_t tune_target(const uint8_t i) {
+      TERN_(PIDTEMPBED, if (tune_is_bed(i)) return thermalManager.degTargetBed());
+      return TERN(PIDTEMP, thermalManager.degTargetHotend(i), 0);
+    }
+
+    static void tune_set_target(const uint8_t i, const celsius_t t) {
+      TERN_(PIDTEMPBED, if (tune_is_bed(i)) return thermalManager.setTargetBed(t));
+      TERN_(PIDTEMP, thermalManager.setTargetHotend(t, i));
+    }
+
+    static long tune_max_power(const uint8_t i) { return tune_is_bed(i) ? TERN(PIDTEMPBED, MAX_BED_POWER, 0) : PID_MAX; }
+
+    static void tune_label(const uint8_t i) {
+      SERIAL_ECHOPGM(STR_PID_AUTOTUNE);
+      if (tune_is_bed(i)) SERIAL_ECHOPGM(" B"); else SERIAL_ECHOPGM(" E", i);
+    }
+
+    bool Temperature::PID_autotune_all(const celsius_t hotend_temp, const celsius_t bed_temp, const int8_t ncycles) {
+      if (pid_tune_active) return false;
+
+      const millis_t ms = millis();
+      LOOP_L_N(i, PID_TUNE_COUNT) {
+        pid_tune_t &t = pid_tune[i];
+        t.state = PID_TUNE_IDLE;
+
+        const celsius_t target = tune_is_bed(i) ? bed_temp : hotend_temp;
+        if (!target) continue;
+
+        const celsius_t max_target = tune_is_bed(i) ? TERN(PIDTEMPBED, BED_MAX_TARGET, 0) : TERN(PIDTEMP, temp_range[i].maxtemp - (HOTEND_OVERSHOOT), 0);
+        if (target > max_target) {
+          tune_label(i);
+          SERIAL_ECHOLNPGM(STR_PID_TEMP_TOO_HIGH);
+          continue;
+        }
+
+        t.state = PID_TUNE_RUN;
+        t.heating = true;
+        t.cycles = 0;
+        t.target = target;
+        t.t1 = t.t2 = ms;
+        t.t_high = t.t_low = 0;
+        t.bias = t.d = tune_max_power(i) >> 1;
+        t.maxT = 0; t.minT = 10000;
+        t.pid = { 0, 0, 0 };
+        tune_set_target(i, target);
+
+        tune_label(i);
+        SERIAL_ECHOLNPGM(STR_PID_AUTOTUNE_START);
+        pid_tune_active = true;
+      }
+
+      if (pid_tune_active) {
+        pid_tune_cycles = _MAX(ncycles, 3);
+        TERN_(AUTO_POWER_CONTROL, powerManager.power_on());
+        TERN_(NO_FAN_SLOWING_IN_PID_TUNING, adaptive_fan_slowing = false);
+      }
+      return pid_tune_active;
+    }
+
+    // Relay output (0..max power) for a running slot, called with each new reading
+    float Temperature::pid_tune_output(const uint8_t i, const celsius_float_t current) {
+      pid_tune_t &t = pid_tune[i];
+      const millis_t ms = millis();
+
+      NOLESS(t.maxT, current);
+      NOMORE(t.minT, current);
+
+      if (t.heating && current > t.target && ELAPSED(ms, t.t2 + 5000UL)) {
+        t.heating = false;
+        t.t1 = ms;
+        t.t_high = t.t1 - t.t2;
+        t.maxT = t.target;
+      }
+
+      if (!t.heating && current < t.target && ELAPSED(ms, t.t1 + 5000UL)) {
+        t.heating = true;
+        t.t2 = ms;
+        t.t_low = t.t2 - t.t1;
+        if (t.cycles > 0) {
+          const long max_pow = tune_max_power(i);
+          t.bias += (t.d * (t.t_high - t.t_low)) / (t.t_low + t.t_high);
+          LIMIT(t.bias, 20, max_pow - 20);
+          t.d = (t.bias > max_pow >> 1) ? max_pow - 1 - t.bias : t.bias;
+
+          tune_label(i);
+          SERIAL_ECHOPGM(" ", t.cycles, "/", pid_tune_cycles, STR_BIAS, t.bias, STR_D_COLON, t.d, STR_T_MIN, t.minT, STR_T_MAX, t.maxT);
+          if (t.cycles > 2) {
+            const bool isbed = tune_is_bed(i);
+            const float Ku = (4.0f * t.d) / (float(M_PI) * (t.maxT - t.minT) * 0.5f),
+                        Tu = float(t.t_low + t.t_high) * 0.001f;
+            t.pid.p = Ku * (isbed ? 0.2f : 0.6f);
+            t.pid.i = t.pid.p * 2.0f / Tu;
+            t.pid.d = t.pid.p * Tu * (isbed ? 1.0f / 3.0f : 1.0f / 8.0f);
+            SERIAL_ECHOPGM(STR_KU, Ku, STR_TU, Tu, STR_KP, t.pid.p, STR_KI, t.pid.i, STR_KD, t.pid.d);
+          }
+          SERIAL_EOL();
+        }
+        t.cycles++;
+        t.minT = t.target;
+
+        if (t.cycles > pid_tune_cycles) {
+          t.state = PID_TUNE_DONE;
+          tune_set_target(i, 0);
+          return 0;
+        }
+      }
+
+      return t.heating ? t.bias + t.d : t.bias - t.d;
+    }
+
+    void Temperature::pid_tune_task(const millis_t &ms) {
+      if (!pid_tune_active) return;
+
+      bool running = false;
+      LOOP_L_N(i, PID_TUNE_COUNT) {
+        pid_tune_t &t = pid_tune[i];
+        if (t.state != PID_TUNE_RUN) continue;
+
+        FSTR_P fail = nullptr;
+        if (tune_target(i) != t.target)                                   // Changed by M104, M140, disable_all_heaters()...
+          fail = F(" aborted");
+        else if (tune_temp(i) > t.target + MAX_OVERSHOOT_PID_AUTOTUNE)
+          fail = F(STR_PID_TEMP_TOO_HIGH);
+        else if ((ms - _MIN(t.t1, t.t2)) > (MAX_CYCLE_TIME_PID_AUTOTUNE * 60L * 1000L))
+          fail = F(STR_PID_TIMEOUT);
+
+        if (fail) {
+          t.state = PID_TUNE_FAIL;
+          tune_set_target(i, 0);
+          tune_label(i);
+          SERIAL_ECHOLNF(fail);
+        }
+        else
+          running = true;
+      }
+
+      // Report heater states every 2 seconds until all are done
+      if (running) {
+        static millis_t next_report_ms; // = 0
+        if (ELAPSED(ms, next_report_ms)) {
+          next_report_ms = ms + 2000UL;
+          #if HAS_TEMP_SENSOR
+            print_heater_states(active_extruder);
+            SERIAL_EOL();
+          #endif
+        }
+        return;
+      }
+
+      pid_tune_active = false;
+      TERN_(NO_FAN_SLOWING_IN_PID_TUNING, adaptive_fan_slowing = true);
+
+      // Apply all the results, then save them together
+      bool tuned = false;
+      #if ENABLED(PIDTEMP) && DISABLED(PID_PARAMS_PER_HOTEND)
+        raw_pid_t sum = { 0, 0, 0 };
+        uint8_t hotends_tuned = 0;
+      #endif
+      LOOP_L_N(i, PID_TUNE_COUNT) {
+        const pid_tune_t &t = pid_tune[i];
+        if (t.state != PID_TUNE_DONE) continue;
+        tuned = true;
+        tune_label(i);
+        SERIAL_ECHOLNPGM(STR_KP, t.pid.p, STR_KI, t.pid.i, STR_KD, t.pid.d);
+        #if ENABLED(PIDTEMPBED)
+          if (tune_is_bed(i)) { temp_bed.pid.set(t.pid); continue; }
+        #endif
+        #if ENABLED(PID_PARAMS_PER_HOTEND)
+          temp_hotend[i].pid.set(t.pid);
+        #elif ENABLED(PIDTEMP)
+          sum.p += t.pid.p; sum.i += t.pid.i; sum.d += t.pid.d;
+          hotends_tuned++;
+        #endif
+      }
+
+      #if ENABLED(PIDTEMP)
+        #if DISABLED(PID_PARAMS_PER_HOTEND)
+          // All hotends share one set of constants, so use the average
+          if (hotends_tuned) HOTEND_LOOP() temp_hotend[e].pid.set(sum.p / hotends_tuned, sum.i / hotends_tuned, sum.d / hotends_tuned);
+        #endif
+        updatePID();
+      #endif
+
+      SERIAL_ECHOPGM(STR_PID_AUTOTUNE);
+      SERIAL_ECHOLNPGM(" finished");
+      if (tuned) {
+        TERN_(EEPROM_SETTINGS, (void)settings.save());
+        TERN_(HOST_PROMPT_SUPPORT, hostui.notify(GET_TEXT_F(MSG_PID_AUTOTUNE_DONE)));
+      }
+    }
+
+  #endif // PID_AUTOTUNE_PARALLEL
+
 #endif // HAS_PID_HEATING
 
 #if ENABLED(MPCTEMP)
@@ -915,6 +1206,7 @@ volatile bool Temperature::raw_temps_ready = false;
 
     SERIAL_ECHOPGM(STR_MPC_AUTOTUNE);
     SERIAL_ECHOLNPGM(STR_MPC_AUTOTUNE_START, active_extruder);
+    TERN_(ADS1118_SCHEDULER, const ADS1118Tuning ads1118_fast(true));
     MPCHeaterInfo &hotend = temp_hotend[active_extruder];
     MPC_t &constants = hotend.constants;
 
@@ -1146,7 +1438,7 @@ int16_t Temperature::getHeaterPower(const heater_id_t heater_id) {
     }
 
     #if HAS_AUTO_CHAMBER_FAN
-      if (temp_chamber.celsius >= CHAMBER_AUTO_FAN_TEMPERATURE)
+      if (temp_chamber.celsius >= CHAMBER_AUTO_FAN_TEMPERATURE || TERN0(BED_COOLDOWN, cooling_down()))
         SBI(fanState, pgm_read_byte(&fanBit[CHAMBER_FAN_INDEX]));
     #endif
 
@@ -1393,11 +1685,22 @@ void Temperature::min_temp_error(const heater_id_t heater_id) {
 
 #if HAS_HOTEND
 
+  #if EITHER(PID_FAN_SCALING, MPC_INCLUDE_FAN)
+    // Part fans change with the planner blocks, so use the speed of the block being executed
+    inline uint8_t cooling_fan_speed(const uint8_t fan) {
+      return TERN(HAS_TAIL_FAN_SPEED, planner.tail_fan_speed[fan], thermalManager.fan_speed[fan]);
+    }
+  #endif
+
   float Temperature::get_pid_output_hotend(const uint8_t E_NAME) {
     const uint8_t ee = HOTEND_INDEX;
 
     #if ENABLED(PIDTEMP)
 
+      #if ENABLED(PID_AUTOTUNE_PARALLEL)
+        if (pid_tune_active && pid_tune[ee].state == PID_TUNE_RUN) return pid_tune_output(ee, temp_hotend[ee].celsius);
+      #endif
+
       typedef PIDRunner<hotend_info_t, 0, PID_MAX> PIDRunnerHotend;
 
       static PIDRunnerHotend hotend_pid[HOTENDS] = {
@@ -1405,7 +1708,14 @@ void Temperature::min_temp_error(const heater_id_t heater_id) {
         REPEAT(HOTENDS, _HOTENDPID)
       };
 
-      const float pid_output = hotend_pid[ee].get_pid_output();
+      float pid_output = hotend_pid[ee].get_pid_output();
+
+      #if ENABLED(PID_FAN_SCALING)
+        // Feed forward the heat the part fan blows away
+        const uint8_t fs = cooling_fan_speed(ee < FAN_COUNT ? ee : 0);
+        if (pid_output > 0 && fs > (PID_FAN_SCALING_MIN_SPEED))
+          pid_output = _MIN(pid_output + temp_hotend[ee].pid.Kf + (PID_FAN_SCALING_LIN_FACTOR) * fs, PID_MAX);
+      #endif
 
       #if ENABLED(PID_DEBUG)
         if (ee == active_extruder)
@@ -1432,10 +1742,14 @@ void Temperature::min_temp_error(const heater_id_t heater_id) {
       float ambient_xfer_coeff = constants.ambient_xfer_coeff_fan0;
       #if ENABLED(MPC_INCLUDE_FAN)
         const uint8_t fan_index = EITHER(MPC_FAN_0_ACTIVE_HOTEND, MPC_FAN_0_ALL_HOTENDS) ? 0 : ee;
-        const float fan_fraction = TERN_(MPC_FAN_0_ACTIVE_HOTEND, !this_hotend ? 0.0f : ) fan_speed[fan_index] * RECIPROCAL(255);
+        const float fan_fraction = TERN_(MPC_FAN_0_ACTIVE_HOTEND, !this_hotend ? 0.0f : ) cooling_fan_speed(fan_index) * RECIPROCAL(255);
         ambient_xfer_coeff += fan_fraction * constants.fan255_adjustment;
       #endif
 
+      #if ENABLED(MPC_FEEDFORWARD)
+        float e_speed_rise = 0.0f;  // (mm/s) Increase in flow coming up in the planner
+      #endif
+
       if (this_hotend) {
         const int32_t e_position = stepper.position(E_AXIS);
         const float e_speed = (e_position - mpc_e_position) * planner.mm_per_step[E_AXIS] / MPC_dT;
@@ -1447,6 +1761,11 @@ void Temperature::min_temp_error(const heater_id_t heater_id) {
           ambient_xfer_coeff += e_speed * constants.filament_heat_capacity_permm;
           mpc_e_position = e_position;
         }
+
+        // Only a rise is fed forward, so a starved queue never takes power away
+        #if ENABLED(MPC_FEEDFORWARD)
+          e_speed_rise = _MAX(planner.e_speed_ahead(MPC_FEEDFORWARD_TIME) - _MAX(e_speed, 0.0f), 0.0f);
+        #endif
       }
 
       // Update the modeled temperatures
@@ -1472,6 +1791,8 @@ void Temperature::min_temp_error(const heater_id_t heater_id) {
         // Plan power level to get to target temperature in 2 seconds
         power = (hotend.target - hotend.modeled_block_temp) * constants.block_heat_capacity / 2.0f;
         power -= (hotend.modeled_ambient_temp - hotend.modeled_block_temp) * ambient_xfer_coeff;
+        // Heat for the extra filament, which comes in at ambient and leaves at target
+        TERN_(MPC_FEEDFORWARD, power += (hotend.target - hotend.modeled_ambient_temp) * e_speed_rise * constants.filament_heat_capacity_permm);
       }
 
       float pid_output = power * 254.0f / constants.heater_power + 1.0f;        // Ensure correct quantization into a range of 0 to 127
@@ -1507,6 +1828,9 @@ void Temperature::min_temp_error(const heater_id_t heater_id) {
 #if ENABLED(PIDTEMPBED)
 
   float Temperature::get_pid_output_bed() {
+    #if ENABLED(PID_AUTOTUNE_PARALLEL)
+      if (pid_tune_active && pid_tune[PID_TUNE_BED].state == PID_TUNE_RUN) return pid_tune_output(PID_TUNE_BED, temp_bed.celsius);
+    #endif
     static PIDRunner<bed_info_t, MIN_BED_POWER, MAX_BED_POWER> bed_pid(temp_bed);
     const float pid_output = bed_pid.get_pid_output();
     TERN_(PID_BED_DEBUG, bed_pid.debug(temp_bed.celsius, pid_output, F("(Bed)")));
@@ -1560,6 +1884,236 @@ void Temperature::min_temp_error(const heater_id_t heater_id) {
 
 #endif // HAS_HOTEND
 
+#if ENABLED(PREHEAT_SCHEDULER)
+
+  Temperature::preheat_t Temperature::preheat[HOTENDS]; // = { 0 }
+  #if DISABLED(MPCTEMP)
+    float Temperature::heatup_rate[HOTENDS] = ARRAY_N_1(HOTENDS, PREHEAT_SCHEDULER_RATE);
+  #endif
+
+  void Temperature::schedule_hotend(const celsius_t celsius, const uint8_t e, const millis_t ms) {
+    preheat[e].target = _MIN(celsius, hotend_max_target(e));
+    preheat[e].ready_ms = millis() + ms;
+    IF_DISABLED(MPCTEMP, preheat[e].learn_target = 0);
+  }
+
+  /**
+   * Predict the time to heat a hotend from one temperature to another.
+   * MPC runs its model at full power. Otherwise use the rate measured
+   * on the last scheduled heat-up, which includes the PID behavior.
+   */
+  millis_t Temperature::predict_heatup_ms(const uint8_t e, const celsius_float_t from, const celsius_t to) {
+    if (from >= to) return 0;
+    #if ENABLED(MPCTEMP)
+      const MPCHeaterInfo &hotend = temp_hotend[e];
+      const MPC_t &c = hotend.constants;
+      const float power = c.heater_power * (MPC_MAX) / 255.0f,
+                  ambient = isnan(hotend.modeled_ambient_temp) ? _MIN(30.0f, from) : hotend.modeled_ambient_temp;
+      float temp = from;
+      uint16_t s = 0;
+      for (; temp < to && s < 900; s++)   // One second steps, 15 minutes at most
+        temp += (power - (temp - ambient) * c.ambient_xfer_coeff_fan0) / c.block_heat_capacity;
+      return SEC_TO_MS(s + 1.0f / c.sensor_responsiveness);
+    #else
+      return (to - from) * 1000.0f / heatup_rate[e];
+    #endif
+  }
+
+  void Temperature::preheat_task(const millis_t &ms) {
+    static millis_t next_check_ms; // = 0
+    if (PENDING(ms, next_check_ms)) return;
+    next_check_ms = ms + 1000UL;
+
+    HOTEND_LOOP() {
+      preheat_t &p = preheat[e];
+      if (p.target) {
+        const millis_t lead_ms = predict_heatup_ms(e, degHotend(e), p.target) + SEC_TO_MS(PREHEAT_SCHEDULER_MARGIN);
+        if (ELAPSED(ms + lead_ms, p.ready_ms)) {
+          #if DISABLED(MPCTEMP)
+            p.learn_target = p.target;
+            p.learn_from = degHotend(e);
+            p.learn_ms = ms;
+          #endif
+          setTargetHotend(p.target, e);
+        }
+      }
+      #if DISABLED(MPCTEMP)
+        else if (p.learn_target) {
+          if (degTargetHotend(e) != p.learn_target)               // Target changed
+            p.learn_target = 0;
+          else if (degHotend(e) >= p.learn_target - (TEMP_WINDOW)) {
+            const float rise = degHotend(e) - p.learn_from;
+            if (rise >= 20 && ms != p.learn_ms) heatup_rate[e] = rise * 1000.0f / (ms - p.learn_ms);
+            p.learn_target = 0;
+          }
+        }
+      #endif
+    }
+  }
+
+#endif // PREHEAT_SCHEDULER
+
+#if ENABLED(BED_COOLDOWN)
+
+  Temperature::cooldown_t Temperature::bed_cooldown; // = { 0 }
+
+  void Temperature::start_cooldown(const celsius_t release) {
+    if (!cooling_down()) {
+      #if HAS_FAN
+        COPY(bed_cooldown.saved_fan_speed, fan_speed);
+        FANS_LOOP(f) set_fan_speed(f, BED_COOLDOWN_FAN_SPEED);
+      #endif
+      bed_cooldown.rate = 0;
+      bed_cooldown.fit_from = degBed();
+      bed_cooldown.fit_ms = bed_cooldown.report_ms = millis();
+    }
+    setTargetBed(0);
+    bed_cooldown.release = release;
+  }
+
+  // Put the fans back and say whether the parts can come off
+  void Temperature::end_cooldown(const bool done) {
+    if (!cooling_down()) return;
+    bed_cooldown.release = 0;
+    #if HAS_FAN
+      FANS_LOOP(f) set_fan_speed(f, bed_cooldown.saved_fan_speed[f]);
+    #endif
+    if (done) {
+      SERIAL_ECHOLNPGM("Bed cooldown done. Ready to remove the parts.");
+      LCD_MESSAGE_F("Ready to remove the parts");
+      TERN_(HOST_PROMPT_SUPPORT, hostui.notify(F("Ready to remove the parts")));
+    }
+  }
+
+  celsius_float_t Temperature::cooldown_ambient() {
+    return TERN(HAS_TEMP_CHAMBER, _MIN(degChamber(), degBed()), BED_COOLDOWN_AMBIENT);
+  }
+
+  /**
+   * Time left until the bed reaches the release temperature, from Newton's law
+   * of cooling with the fitted rate. 0 if there's no fit yet or the release
+   * temperature is not above the ambient.
+   */
+  millis_t Temperature::cooldown_left_ms() {
+    const float over = degBed() - cooldown_ambient(), release_over = bed_cooldown.release - cooldown_ambient();
+    if (!bed_cooldown.rate || release_over <= 0 || over <= release_over) return 0;
+    return SEC_TO_MS(logf(over / release_over) / bed_cooldown.rate);
+  }
+
+  void Temperature::cooldown_task(const millis_t &ms) {
+    if (!cooling_down()) return;
+
+    // A new bed target takes over, like the next job heating up
+    if (degTargetBed()) return end_cooldown(false);
+
+    if (wholeDegBed() <= bed_cooldown.release) return end_cooldown(true);
+
+    // Fit the cooling rate over each interval of 10s or more, smoothing between them
+    const float over = degBed() - cooldown_ambient(), from_over = bed_cooldown.fit_from - cooldown_ambient();
+    if (ELAPSED(ms, bed_cooldown.fit_ms + 10000UL) && over > 0.5f && from_over > over + 0.5f) {
+      const float k = logf(from_over / over) * 1000.0f / (ms - bed_cooldown.fit_ms);
+      bed_cooldown.rate = bed_cooldown.rate ? bed_cooldown.rate * 0.7f + k * 0.3f : k;
+      bed_cooldown.fit_from = degBed();
+      bed_cooldown.fit_ms = ms;
+    }
+
+    if (ELAPSED(ms, bed_cooldown.report_ms)) {
+      bed_cooldown.report_ms = ms + 30000UL;
+      const int16_t left_s = MS_TO_SEC(cooldown_left_ms());
+      SERIAL_ECHOPGM("Bed cooldown: ", wholeDegBed(), " release ", bed_cooldown.release);
+      if (left_s) SERIAL_ECHOPGM(" in ", left_s, "s");
+      SERIAL_EOL();
+      if (left_s) ui.status_printf(0, F("Bed cooling, %is"), left_s); else LCD_MESSAGE_F("Bed cooling");
+    }
+  }
+
+#endif // BED_COOLDOWN
+
+#if ENABLED(HEATER_POWER_BUDGET)
+
+  Temperature::power_window_t Temperature::power_window[POWER_BUDGET_HEATERS]; // = { 0 }
+  volatile bool Temperature::power_window_ready; // = false
+
+  /**
+   * Give the on-time each heater asks for a window of the 127-count soft PWM cycle,
+   * placed so the heaters that are on at any count never need more than the budget.
+   * Heaters holding their temperature go first, so they don't sag into a thermal
+   * runaway, then the heaters with the longest heat-up left. A window may wrap past
+   * the end of the cycle. A heater held back while it heats up has its watch restarted.
+   */
+  void Temperature::apply_power_budget() {
+    if (power_window_ready) return; // The ISR hasn't taken the last windows yet
+
+    static constexpr uint16_t hotend_watts[] = POWER_BUDGET_HOTEND_WATTS;
+    static_assert(COUNT(hotend_watts) >= HOTENDS, "POWER_BUDGET_HOTEND_WATTS must have an item for each hotend.");
+    struct fit { static constexpr bool all(const uint8_t n) { return !n || (hotend_watts[n - 1] <= POWER_BUDGET_WATTS && all(n - 1)); } };
+    static_assert(fit::all(HOTENDS), "POWER_BUDGET_HOTEND_WATTS can't be more than POWER_BUDGET_WATTS.");
+
+    uint16_t watts[POWER_BUDGET_HEATERS], total_watts = 0;
+    float priority[POWER_BUDGET_HEATERS];
+    uint8_t request[POWER_BUDGET_HEATERS], order[POWER_BUDGET_HEATERS];
+
+    LOOP_L_N(h, POWER_BUDGET_HEATERS) {
+      #if HAS_HEATED_BED
+        const bool isbed = h == HOTENDS;
+        const heater_info_t &hi = isbed ? static_cast<heater_info_t&>(temp_bed) : static_cast<heater_info_t&>(temp_hotend[h]);
+        watts[h] = isbed ? POWER_BUDGET_BED_WATTS : hotend_watts[h];
+      #else
+        constexpr bool isbed = false;
+        const heater_info_t &hi = temp_hotend[h];
+        watts[h] = hotend_watts[h];
+      #endif
+      request[h] = hi.soft_pwm_amount;
+      if (request[h]) total_watts += watts[h];
+
+      // Holding heaters first, then the most time left to reach the target
+      const float below = hi.target - hi.celsius;
+      priority[h] = below <= (isbed ? TEMP_BED_HYSTERESIS : TEMP_HYSTERESIS) ? 1e6f
+                  : below / (isbed ? POWER_BUDGET_BED_RATE : POWER_BUDGET_HOTEND_RATE);
+
+      // Insertion sort by priority
+      uint8_t i = h;
+      for (; i && priority[order[i - 1]] < priority[h]; --i) order[i] = order[i - 1];
+      order[i] = h;
+    }
+
+    // Everything on at once is within the budget
+    if (total_watts <= POWER_BUDGET_WATTS) {
+      LOOP_L_N(h, POWER_BUDGET_HEATERS) power_window[h] = { 0, request[h] };
+      power_window_ready = true;
+      return;
+    }
+
+    uint16_t load[127] = { 0 };
+    LOOP_L_N(i, POWER_BUDGET_HEATERS) {
+      const uint8_t h = order[i], want = _MIN(request[h], 127);
+      const uint16_t w = watts[h];
+
+      // Find the longest free run up to the wanted length. Starts inside a
+      // run that came up short would stop at the same busy count, so skip them.
+      uint8_t best_start = 0, best_len = 0;
+      for (uint8_t s = 0; s < 127 && best_len < want;) {
+        uint8_t len = 0;
+        while (len < want && load[(s + len) % 127] + w <= POWER_BUDGET_WATTS) len++;
+        if (len > best_len) { best_start = s; best_len = len; }
+        s += len + 1;
+      }
+      LOOP_L_N(n, best_len) load[(best_start + n) % 127] += w;
+      power_window[h] = { best_start, best_len };
+
+      // Time spent waiting for power doesn't count against the heating watch
+      if (best_len < want) {
+        #if HAS_HEATED_BED
+          if (h == HOTENDS) { start_watching_bed(); continue; }
+        #endif
+        TERN_(HAS_HOTEND, start_watching_hotend(TERN_(HAS_MULTI_HOTEND, h)));
+      }
+    }
+    power_window_ready = true;
+  }
+
+#endif // HEATER_POWER_BUDGET
+
 #if HAS_HEATED_BED
 
   void Temperature::manage_heated_bed(const millis_t &ms) {
@@ -1845,6 +2399,8 @@ void Temperature::task() {
   if (no_reentry) return;
   REMEMBER(mh, no_reentry, true);
 
+  TERN_(TRACE_EVENTS, TRACE_SCOPE(TRACE_TEMP_TASK));
+
   #if ENABLED(EMERGENCY_PARSER)
     if (emergency_parser.killed_by_M112) kill(FPSTR(M112_KILL_STR), nullptr, true);
 
@@ -1856,6 +2412,9 @@ void Temperature::task() {
 
   if (!updateTemperaturesIfReady()) return; // Will also reset the watchdog if temperatures are ready
 
+  TERN_(REPORT_CACHE, heater_report.invalidate()); // New readings, so M105 must be formatted again
+  TERN_(TEMP_TELEMETRY, telemetry_record());
+
   #if DISABLED(IGNORE_THERMOCOUPLE_ERRORS)
     #if TEMP_SENSOR_0_IS_MAX_TC
       if (degHotend(0) > _MIN(HEATER_0_MAXTEMP, TEMP_SENSOR_0_MAX_TC_TMAX - 1.0)) max_temp_error(H_E0);
@@ -1878,6 +2437,12 @@ void Temperature::task() {
   // Handle Hotend Temp Errors, Heating Watch, etc.
   TERN_(HAS_HOTEND, manage_hotends(ms));
 
+  // Start scheduled heat-ups that are due
+  TERN_(PREHEAT_SCHEDULER, preheat_task(ms));
+
+  // Track the bed down to the part release temperature
+  TERN_(BED_COOLDOWN, cooldown_task(ms));
+
   #if HAS_TEMP_REDUNDANT
     // Make sure measured temperatures are close together
     if (ABS(degRedundantTarget() - degRedundant()) > TEMP_SENSOR_REDUNDANT_MAX_DIFF)
@@ -1902,6 +2467,9 @@ void Temperature::task() {
   // Handle Cooler Temp Errors, Cooling Watch, etc.
   TERN_(HAS_COOLER, manage_cooler(ms));
 
+  // Check on the heaters being tuned by M303 A
+  TERN_(PID_AUTOTUNE_PARALLEL, pid_tune_task(ms));
+
   #if ENABLED(LASER_COOLANT_FLOW_METER)
     cooler.flowmeter_task(ms);
     #if ENABLED(FLOWMETER_SAFETY)
@@ -1941,6 +2509,15 @@ void Temperature::task() {
   }                                                                       \
 }while(0)
 
+#if ENABLED(THERMISTOR_DIRECT_LOOKUP)
+  #if HAS_HEATED_BED && TEMP_SENSOR_BED_IS_THERMISTOR
+    constexpr thermistor_lut_t bed_lut PROGMEM { TEMPTABLE_BED };
+  #endif
+  #if HAS_TEMP_CHAMBER && TEMP_SENSOR_CHAMBER_IS_THERMISTOR
+    constexpr thermistor_lut_t chamber_lut PROGMEM { TEMPTABLE_CHAMBER };
+  #endif
+#endif
+
 #if HAS_USER_THERMISTORS
 
   user_thermistor_t Temperature::user_thermistor[USER_THERMISTORS]; // Initialized by settings.load()
@@ -2087,7 +2664,7 @@ void Temperature::task() {
         #elif TEMP_SENSOR_0_IS_AD8495
           return TEMP_AD8495(raw);
         #elif TEMP_SENSOR_0_IS_ADS1118
-          return raw/10.0f;
+          return raw * 0.01f;
         #else
           break;
         #endif
@@ -2108,7 +2685,7 @@ void Temperature::task() {
         #elif TEMP_SENSOR_1_IS_AD8495
           return TEMP_AD8495(raw);
         #elif TEMP_SENSOR_1_IS_ADS1118
-          return raw/10.0f;
+          return raw * 0.01f;
         #else
           break;
         #endif
@@ -2191,7 +2768,11 @@ void Temperature::task() {
     #if TEMP_SENSOR_BED_IS_CUSTOM
       return user_thermistor_to_deg_c(CTI_BED, raw);
     #elif TEMP_SENSOR_BED_IS_THERMISTOR
-      SCAN_THERMISTOR_TABLE(TEMPTABLE_BED, TEMPTABLE_BED_LEN);
+      #if ENABLED(THERMISTOR_DIRECT_LOOKUP)
+        return bed_lut.get(raw);
+      #else
+        SCAN_THERMISTOR_TABLE(TEMPTABLE_BED, TEMPTABLE_BED_LEN);
+      #endif
     #elif TEMP_SENSOR_BED_IS_AD595
       return TEMP_AD595(raw);
     #elif TEMP_SENSOR_BED_IS_AD8495
@@ -2209,7 +2790,11 @@ void Temperature::task() {
     #if TEMP_SENSOR_CHAMBER_IS_CUSTOM
       return user_thermistor_to_deg_c(CTI_CHAMBER, raw);
     #elif TEMP_SENSOR_CHAMBER_IS_THERMISTOR
-      SCAN_THERMISTOR_TABLE(TEMPTABLE_CHAMBER, TEMPTABLE_CHAMBER_LEN);
+      #if ENABLED(THERMISTOR_DIRECT_LOOKUP)
+        return chamber_lut.get(raw);
+      #else
+        SCAN_THERMISTOR_TABLE(TEMPTABLE_CHAMBER, TEMPTABLE_CHAMBER_LEN);
+      #endif
     #elif TEMP_SENSOR_CHAMBER_IS_AD595
       return TEMP_AD595(raw);
     #elif TEMP_SENSOR_CHAMBER_IS_AD8495
@@ -2318,6 +2903,12 @@ void Temperature::updateTemperaturesFromRawValues() {
   TERN_(TEMP_SENSOR_REDUNDANT_IS_MAX_TC, temp_redundant.setraw(READ_MAX_TC(HEATER_ID(TEMP_SENSOR_REDUNDANT_SOURCE))));
   TERN_(TEMP_SENSOR_0_IS_ADS1118, temp_hotend[0].setraw(ads1118_read_raw(0)));
   TERN_(TEMP_SENSOR_1_IS_ADS1118, temp_hotend[1].setraw(ads1118_read_raw(1)));
+  #if ENABLED(ADS1118_SCHEDULER)
+    // Favor the active hotend, and go fast while a hotend heats up or is tuned
+    bool ads1118_fast = ads1118_tuning || TERN0(PID_AUTOTUNE_PARALLEL, pid_tune_active);
+    HOTEND_LOOP() if (temp_hotend[e].target >= temp_hotend[e].celsius + (ADS1118_FAST_WINDOW)) ads1118_fast = true;
+    ads1118_schedule(active_extruder, ads1118_fast);
+  #endif
   #if HAS_HOTEND
     HOTEND_LOOP() temp_hotend[e].celsius = analog_to_celsius_hotend(temp_hotend[e].getraw(), e);
   #endif
@@ -2538,6 +3129,16 @@ void Temperature::init() {
     OUT_WRITE(HEATER_CHAMBER_PIN, HEATER_CHAMBER_INVERTING);
   #endif
 
+  // Move heaters with a timer channel over to hardware PWM
+  #if ENABLED(HEATER_HW_PWM)
+    #define _HW_PWM_START(N) hal.pwm_channel_start(hotend_pwm[N], HEATER_##N##_PIN, HEATER_HW_PWM_FREQUENCY, HEATER_##N##_INVERTING);
+    #if HAS_HOTEND && DISABLED(HEATERS_PARALLEL)
+      REPEAT(HOTENDS, _HW_PWM_START);
+    #endif
+    TERN_(HAS_HEATED_BED, hal.pwm_channel_start(bed_pwm, HEATER_BED_PIN, HEATER_HW_PWM_FREQUENCY, HEATER_BED_INVERTING));
+    TERN_(HAS_HEATED_CHAMBER, hal.pwm_channel_start(chamber_pwm, HEATER_CHAMBER_PIN, HEATER_HW_PWM_FREQUENCY, HEATER_CHAMBER_INVERTING));
+  #endif
+
   #if HAS_COOLER
     OUT_WRITE(COOLER_PIN, COOLER_INVERTING);
   #endif
@@ -2877,6 +3478,29 @@ void Temperature::init() {
 
 #endif // HAS_THERMAL_PROTECTION
 
+#if ENABLED(HEATER_HW_PWM)
+
+  #if HAS_HOTEND
+    MarlinHAL::pwm_channel_t Temperature::hotend_pwm[HOTENDS];
+  #endif
+  #if HAS_HEATED_BED
+    MarlinHAL::pwm_channel_t Temperature::bed_pwm;
+  #endif
+  #if HAS_HEATED_CHAMBER
+    MarlinHAL::pwm_channel_t Temperature::chamber_pwm;
+  #endif
+
+  // Copy the heater power to the timer compare registers. Soft PWM writes to these pins have no effect.
+  void Temperature::update_hw_pwm() {
+    #if HAS_HOTEND
+      HOTEND_LOOP() hotend_pwm[e].set(temp_hotend[e].soft_pwm_amount, 7);
+    #endif
+    TERN_(HAS_HEATED_BED, bed_pwm.set(temp_bed.soft_pwm_amount, 7));
+    TERN_(HAS_HEATED_CHAMBER, chamber_pwm.set(temp_chamber.soft_pwm_amount, 7));
+  }
+
+#endif
+
 void Temperature::disable_all_heaters() {
 
   // Disable autotemp, unpause and reset everything
@@ -2912,6 +3536,9 @@ void Temperature::disable_all_heaters() {
     temp_cooler.soft_pwm_amount = 0;
     WRITE_HEATER_COOLER(LOW);
   #endif
+
+  // Don't wait for the ISR, which may already be stopped by kill()
+  TERN_(HEATER_HW_PWM, update_hw_pwm());
 }
 
 #if ENABLED(PRINTJOB_TIMER_AUTOSTART)
@@ -3224,8 +3851,11 @@ void Temperature::readings_ready() {
  *  - Call planner.isr to count down its "ignore" time
  */
 HAL_TEMP_TIMER_ISR() {
+  TERN_(ISR_PROFILER, ISR_PROFILE(ISR_PROF_TEMP));
   HAL_timer_isr_prologue(MF_TIMER_TEMP);
 
+  TERN_(CRASH_CAPTURE, crash_capture.watchdog_check());
+
   Temperature::isr();
 
   HAL_timer_isr_epilogue(MF_TIMER_TEMP);
@@ -3260,13 +3890,13 @@ public:
  * Handle various ~1kHz tasks associated with temperature
  *  - Check laser safety timeout
  *  - Heater PWM (~1kHz with scaler)
- *  - LCD Button polling (~500Hz)
- *  - Start / Read one ADC sensor
+ *  - Sensors and buttons (sensor_task)
  *  - Advance Babysteps
  *  - Endstop polling
  *  - Planner clean buffer
  */
-void Temperature::isr() {
+HOT_ISR_FUNC void Temperature::isr() {
+  TERN_(DEFERRED_TEMP_SENSORS, const uint32_t start_cycles = get_cycle_count());
 
   // Shut down the laser if steppers are inactive for > LASER_SAFETY_TIMEOUT_MS ms
   #if LASER_SAFETY_TIMEOUT_MS > 0
@@ -3276,18 +3906,13 @@ void Temperature::isr() {
     }
   #endif
 
-  static int8_t temp_count = -1;
-  static ADCSensorState adc_sensor_state = StartupDelay;
   static uint8_t pwm_count = _BV(SOFT_PWM_SCALE);
 
+  TERN_(HEATER_HW_PWM, update_hw_pwm());
+
   // Avoid multiple loads of pwm_count
   uint8_t pwm_count_tmp = pwm_count;
 
-  #if HAS_ADC_BUTTONS
-    static raw_adc_t raw_ADCKey_value = 0;
-    static bool ADCKey_pressed = false;
-  #endif
-
   #if HAS_HOTEND
     static SoftPWM soft_pwm_hotend[HOTENDS];
   #endif
@@ -3308,6 +3933,10 @@ void Temperature::isr() {
     static SoftPWM soft_pwm_controller;
   #endif
 
+  #if ENABLED(HEATER_POWER_BUDGET)
+    static power_window_t power_window_now[POWER_BUDGET_HEATERS];
+  #endif
+
   #define WRITE_FAN(n, v) WRITE(FAN##n##_PIN, (v) ^ FAN_INVERTING)
 
   #if DISABLED(SLOW_PWM_HEATERS)
@@ -3326,13 +3955,26 @@ void Temperature::isr() {
     if (pwm_count_tmp >= 127) {
       pwm_count_tmp -= 127;
 
-      #if HAS_HOTEND
-        #define _PWM_MOD_E(N) _PWM_MOD(N,soft_pwm_hotend[N],temp_hotend[N]);
-        REPEAT(HOTENDS, _PWM_MOD_E);
-      #endif
+      #if ENABLED(HEATER_POWER_BUDGET)
+        // Take the new windows, never more than the heater is set to now
+        if (power_window_ready) { COPY(power_window_now, power_window); power_window_ready = false; }
+        #define _PWM_TAKE(S,T,I) S.count = _MIN(power_window_now[I].count, T.soft_pwm_amount)
+        #if HAS_HOTEND
+          #define _PWM_TAKE_E(N) _PWM_TAKE(soft_pwm_hotend[N], temp_hotend[N], N);
+          REPEAT(HOTENDS, _PWM_TAKE_E);
+        #endif
+        #if HAS_HEATED_BED
+          _PWM_TAKE(soft_pwm_bed, temp_bed, HOTENDS);
+        #endif
+      #else
+        #if HAS_HOTEND
+          #define _PWM_MOD_E(N) _PWM_MOD(N,soft_pwm_hotend[N],temp_hotend[N]);
+          REPEAT(HOTENDS, _PWM_MOD_E);
+        #endif
 
-      #if HAS_HEATED_BED
-        _PWM_MOD(BED, soft_pwm_bed, temp_bed);
+        #if HAS_HEATED_BED
+          _PWM_MOD(BED, soft_pwm_bed, temp_bed);
+        #endif
       #endif
 
       #if HAS_HEATED_CHAMBER
@@ -3383,13 +4025,15 @@ void Temperature::isr() {
     }
     else {
       #define _PWM_LOW(N,S) do{ if (S.count <= pwm_count_tmp) WRITE_HEATER_##N(LOW); }while(0)
-      #if HAS_HOTEND
-        #define _PWM_LOW_E(N) _PWM_LOW(N, soft_pwm_hotend[N]);
-        REPEAT(HOTENDS, _PWM_LOW_E);
-      #endif
+      #if DISABLED(HEATER_POWER_BUDGET)
+        #if HAS_HOTEND
+          #define _PWM_LOW_E(N) _PWM_LOW(N, soft_pwm_hotend[N]);
+          REPEAT(HOTENDS, _PWM_LOW_E);
+        #endif
 
-      #if HAS_HEATED_BED
-        _PWM_LOW(BED, soft_pwm_bed);
+        #if HAS_HEATED_BED
+          _PWM_LOW(BED, soft_pwm_bed);
+        #endif
       #endif
 
       #if HAS_HEATED_CHAMBER
@@ -3431,6 +4075,18 @@ void Temperature::isr() {
       #endif
     }
 
+    #if ENABLED(HEATER_POWER_BUDGET)
+      // Each heater is on through its window, which may wrap past the end of the cycle
+      #define _PWM_WINDOW(N,S,I) WRITE_HEATER_##N((pwm_count_tmp + 127 - power_window_now[I].start) % 127 < S.count)
+      #if HAS_HOTEND
+        #define _PWM_WINDOW_E(N) _PWM_WINDOW(N, soft_pwm_hotend[N], N);
+        REPEAT(HOTENDS, _PWM_WINDOW_E);
+      #endif
+      #if HAS_HEATED_BED
+        _PWM_WINDOW(BED, soft_pwm_bed, HOTENDS);
+      #endif
+    #endif
+
     // SOFT_PWM_SCALE to frequency:
     //
     // 0: 16000000/64/256/128 =   7.6294 Hz
@@ -3576,6 +4232,66 @@ void Temperature::isr() {
 
   #endif // SLOW_PWM_HEATERS
 
+  // Sensors and buttons, here or from the deferred task
+  #if ENABLED(DEFERRED_TEMP_SENSORS)
+    HAL_temp_task_pend();
+  #else
+    sensor_task();
+  #endif
+
+  //
+  // Additional ~1kHz Tasks
+  //
+
+  #if ENABLED(BABYSTEPPING) && DISABLED(INTEGRATED_BABYSTEPPING)
+    babystep.task();
+  #endif
+
+  // Check fan tachometers
+  TERN_(HAS_FANCHECK, fan_check.update_tachometers());
+
+  // Clock the queued digipot / LED I2C writes
+  TERN_(SOFT_I2C_ASYNC, soft_i2c.tick());
+
+  // Poll endstops state, if required
+  endstops.poll();
+
+  // Send serial output and feed the emergency parser for DMA ports
+  TERN_(HAS_SERIAL_DMA_POLL, MarlinSerial::dma_poll());
+
+  // Periodically call the planner timer service routine
+  planner.isr();
+
+  TERN_(DEFERRED_TEMP_SENSORS, NOLESS(isr_max_cycles, get_cycle_count() - start_cycles));
+}
+
+/**
+ * Sample the sensors and poll the buttons
+ *  - LCD Button polling (~500Hz)
+ *  - Start / Read one ADC sensor
+ *  - Hand completed readings to the main loop
+ *
+ * Called at the end of every Temperature ISR or, with DEFERRED_TEMP_SENSORS,
+ * from the lowest priority interrupt that the ISR pends, so the heater PWM
+ * above stays short and of fixed cost.
+ */
+void Temperature::sensor_task() {
+  TERN_(DEFERRED_TEMP_SENSORS, const uint32_t start_cycles = get_cycle_count());
+
+  // Sample the ADS1118 at its own rate, as conversions complete
+  TERN_(HAS_ADS1118, ads1118_isr());
+
+  // Then touch, which has the bus to itself until the next tick
+  TERN_(TOUCH_BACKGROUND_SAMPLING, XPT2046::sample_isr());
+
+  static int8_t temp_count = -1;
+  static ADCSensorState adc_sensor_state = StartupDelay;
+
+  #if HAS_ADC_BUTTONS
+    static raw_adc_t raw_ADCKey_value = 0;
+    static bool ADCKey_pressed = false;
+  #endif
+
   //
   // Update lcd buttons 488 times per second
   //
@@ -3775,25 +4491,42 @@ void Temperature::isr() {
   // Go to the next state
   adc_sensor_state = next_sensor_state;
 
-  //
-  // Additional ~1kHz Tasks
-  //
+  TERN_(DEFERRED_TEMP_SENSORS, NOLESS(task_max_cycles, get_cycle_count() - start_cycles));
+}
 
-  #if ENABLED(BABYSTEPPING) && DISABLED(INTEGRATED_BABYSTEPPING)
-    babystep.task();
-  #endif
+#if ENABLED(DEFERRED_TEMP_SENSORS)
 
-  // Check fan tachometers
-  TERN_(HAS_FANCHECK, fan_check.update_tachometers());
+  uint32_t Temperature::isr_max_cycles, Temperature::task_max_cycles;
 
-  // Poll endstops state, if required
-  endstops.poll();
+  HAL_TEMP_TASK_ISR() {
+    TERN_(ISR_PROFILER, ISR_PROFILE(ISR_PROF_TEMP_TASK));
+    Temperature::sensor_task();
+  }
 
-  // Periodically call the planner timer service routine
-  planner.isr();
-}
+  /**
+   * Report the longest Temperature ISR and sensor task since the last report, in cycles
+   * and microseconds. Zero without a cycle counter.
+   */
+  void Temperature::report_isr_cost() {
+    SERIAL_ECHOLNPGM("Temperature ISR max: ", isr_max_cycles, " cycles (", isr_max_cycles / (F_CPU / 1000000UL),
+                     "us), sensor task max: ", task_max_cycles, " cycles (", task_max_cycles / (F_CPU / 1000000UL), "us)");
+    isr_max_cycles = task_max_cycles = 0;
+  }
+
+#endif
+
+#if ENABLED(REPORT_CACHE)
+  ReportCache Temperature::heater_report;
+#endif
 
 #if HAS_TEMP_SENSOR
+
+  // Give the serial TX buffer time to drain between heaters. Not needed when caching.
+  template <class OUT> inline void heater_state_gap(OUT&) { delay(2); }
+  #if ENABLED(REPORT_CACHE)
+    inline void heater_state_gap(ReportCache&) {}
+  #endif
+
   /**
    * Print a single heater state in the form:
    *        Bed: " B:nnn.nn /nnn.nn"
@@ -3804,7 +4537,8 @@ void Temperature::isr() {
    *   Extruder: " T0:nnn.nn /nnn.nn"
    *   With ADC: " T0:nnn.nn /nnn.nn (nnn.nn)"
    */
-  static void print_heater_state(const heater_id_t e, const_celsius_float_t c, const_celsius_float_t t
+  template <class OUT>
+  static void print_heater_state(OUT &out, const heater_id_t e, const_celsius_float_t c, const_celsius_float_t t
     OPTARG(SHOW_TEMP_ADC_VALUES, const float r)
   ) {
     char k;
@@ -3832,71 +4566,92 @@ void Temperature::isr() {
         case H_REDUNDANT: k = 'R'; break;
       #endif
     }
-    SERIAL_CHAR(' ', k);
+    out.write(' '); out.write(k);
     #if HAS_MULTI_HOTEND
-      if (e >= 0) SERIAL_CHAR('0' + e);
+      if (e >= 0) out.write('0' + e);
     #endif
     #ifdef SERIAL_FLOAT_PRECISION
       #define SFP _MIN(SERIAL_FLOAT_PRECISION, 2)
     #else
       #define SFP 2
     #endif
-    SERIAL_CHAR(':');
-    SERIAL_PRINT(c, SFP);
-    SERIAL_ECHOPGM(" /");
-    SERIAL_PRINT(t, SFP);
+    out.write(':');
+    out.print(c, SFP);
+    report_print_P(out, PSTR(" /"));
+    out.print(t, SFP);
     #if ENABLED(SHOW_TEMP_ADC_VALUES)
       // Temperature MAX SPI boards do not have an OVERSAMPLENR defined
-      SERIAL_ECHOPGM(" (", TERN(HAS_MAXTC_LIBRARIES, k == 'T', false) ? r : r * RECIPROCAL(OVERSAMPLENR));
-      SERIAL_CHAR(')');
+      report_print_P(out, PSTR(" ("));
+      report_decimal(out, TERN(HAS_MAXTC_LIBRARIES, k == 'T', false) ? r : r * RECIPROCAL(OVERSAMPLENR));
+      out.write(')');
     #endif
-    delay(2);
+    heater_state_gap(out);
   }
 
-  void Temperature::print_heater_states(const int8_t target_extruder
-    OPTARG(HAS_TEMP_REDUNDANT, const bool include_r/*=false*/)
+  template <class OUT>
+  static void format_heater_states(OUT &out, const int8_t target_extruder
+    OPTARG(HAS_TEMP_REDUNDANT, const bool include_r)
   ) {
     #if HAS_TEMP_HOTEND
-      print_heater_state(H_NONE, degHotend(target_extruder), degTargetHotend(target_extruder) OPTARG(SHOW_TEMP_ADC_VALUES, rawHotendTemp(target_extruder)));
+      print_heater_state(out, H_NONE, thermalManager.degHotend(target_extruder), thermalManager.degTargetHotend(target_extruder) OPTARG(SHOW_TEMP_ADC_VALUES, thermalManager.rawHotendTemp(target_extruder)));
     #endif
     #if HAS_HEATED_BED
-      print_heater_state(H_BED, degBed(), degTargetBed() OPTARG(SHOW_TEMP_ADC_VALUES, rawBedTemp()));
+      print_heater_state(out, H_BED, thermalManager.degBed(), thermalManager.degTargetBed() OPTARG(SHOW_TEMP_ADC_VALUES, thermalManager.rawBedTemp()));
     #endif
     #if HAS_TEMP_CHAMBER
-      print_heater_state(H_CHAMBER, degChamber(), TERN0(HAS_HEATED_CHAMBER, degTargetChamber()) OPTARG(SHOW_TEMP_ADC_VALUES, rawChamberTemp()));
+      print_heater_state(out, H_CHAMBER, thermalManager.degChamber(), TERN0(HAS_HEATED_CHAMBER, thermalManager.degTargetChamber()) OPTARG(SHOW_TEMP_ADC_VALUES, thermalManager.rawChamberTemp()));
     #endif
     #if HAS_TEMP_COOLER
-      print_heater_state(H_COOLER, degCooler(), TERN0(HAS_COOLER, degTargetCooler()) OPTARG(SHOW_TEMP_ADC_VALUES, rawCoolerTemp()));
+      print_heater_state(out, H_COOLER, thermalManager.degCooler(), TERN0(HAS_COOLER, thermalManager.degTargetCooler()) OPTARG(SHOW_TEMP_ADC_VALUES, thermalManager.rawCoolerTemp()));
     #endif
     #if HAS_TEMP_PROBE
-      print_heater_state(H_PROBE, degProbe(), 0 OPTARG(SHOW_TEMP_ADC_VALUES, rawProbeTemp()));
+      print_heater_state(out, H_PROBE, thermalManager.degProbe(), 0 OPTARG(SHOW_TEMP_ADC_VALUES, thermalManager.rawProbeTemp()));
     #endif
     #if HAS_TEMP_BOARD
-      print_heater_state(H_BOARD, degBoard(), 0 OPTARG(SHOW_TEMP_ADC_VALUES, rawBoardTemp()));
+      print_heater_state(out, H_BOARD, thermalManager.degBoard(), 0 OPTARG(SHOW_TEMP_ADC_VALUES, thermalManager.rawBoardTemp()));
     #endif
     #if HAS_TEMP_REDUNDANT
-      if (include_r) print_heater_state(H_REDUNDANT, degRedundant(), degRedundantTarget() OPTARG(SHOW_TEMP_ADC_VALUES, rawRedundantTemp()));
+      if (include_r) print_heater_state(out, H_REDUNDANT, thermalManager.degRedundant(), thermalManager.degRedundantTarget() OPTARG(SHOW_TEMP_ADC_VALUES, thermalManager.rawRedundantTemp()));
     #endif
     #if HAS_MULTI_HOTEND
-      HOTEND_LOOP() print_heater_state((heater_id_t)e, degHotend(e), degTargetHotend(e) OPTARG(SHOW_TEMP_ADC_VALUES, rawHotendTemp(e)));
+      HOTEND_LOOP() print_heater_state(out, (heater_id_t)e, thermalManager.degHotend(e), thermalManager.degTargetHotend(e) OPTARG(SHOW_TEMP_ADC_VALUES, thermalManager.rawHotendTemp(e)));
     #endif
-    SERIAL_ECHOPGM(" @:", getHeaterPower((heater_id_t)target_extruder));
+    report_print_P(out, PSTR(" @:")); out.print(thermalManager.getHeaterPower((heater_id_t)target_extruder));
     #if HAS_HEATED_BED
-      SERIAL_ECHOPGM(" B@:", getHeaterPower(H_BED));
+      report_print_P(out, PSTR(" B@:")); out.print(thermalManager.getHeaterPower(H_BED));
     #endif
     #if HAS_HEATED_CHAMBER
-      SERIAL_ECHOPGM(" C@:", getHeaterPower(H_CHAMBER));
+      report_print_P(out, PSTR(" C@:")); out.print(thermalManager.getHeaterPower(H_CHAMBER));
     #endif
     #if HAS_COOLER
-      SERIAL_ECHOPGM(" C@:", getHeaterPower(H_COOLER));
+      report_print_P(out, PSTR(" C@:")); out.print(thermalManager.getHeaterPower(H_COOLER));
     #endif
     #if HAS_MULTI_HOTEND
       HOTEND_LOOP() {
-        SERIAL_ECHOPGM(" @", e);
-        SERIAL_CHAR(':');
-        SERIAL_ECHO(getHeaterPower((heater_id_t)e));
+        report_print_P(out, PSTR(" @")); out.print(e);
+        out.write(':');
+        out.print(thermalManager.getHeaterPower((heater_id_t)e));
+      }
+    #endif
+  }
+
+  void Temperature::print_heater_states(const int8_t target_extruder
+    OPTARG(HAS_TEMP_REDUNDANT, const bool include_r/*=false*/)
+  ) {
+    #if ENABLED(REPORT_CACHE)
+      // Format the report again only after new readings or a target change
+      static int8_t reported_extruder;
+      TERN_(HAS_TEMP_REDUNDANT, static bool reported_r);
+      if (!heater_report.valid || reported_extruder != target_extruder || TERN0(HAS_TEMP_REDUNDANT, reported_r != include_r)) {
+        reported_extruder = target_extruder;
+        TERN_(HAS_TEMP_REDUNDANT, reported_r = include_r);
+        heater_report.start();
+        format_heater_states(heater_report, target_extruder OPTARG(HAS_TEMP_REDUNDANT, include_r));
+        heater_report.finish();
       }
+      if (heater_report.valid) return heater_report.replay();
     #endif
+    format_heater_states(SERIAL_IMPL, target_extruder OPTARG(HAS_TEMP_REDUNDANT, include_r));
   }
 
   #if ENABLED(AUTO_REPORT_TEMPERATURES)
@@ -3907,6 +4662,79 @@ void Temperature::isr() {
     }
   #endif
 
+  #if ENABLED(TEMP_TELEMETRY)
+
+    Temperature::telemetry_t Temperature::telemetry[TEMP_TELEMETRY_SAMPLES];
+    uint16_t Temperature::telemetry_head, // = 0
+             Temperature::telemetry_sent; // = 0
+    AutoReporter<Temperature::AutoReportTelemetry, 10> Temperature::telemetry_reporter;
+
+    // Keep every new reading, overwriting the oldest
+    void Temperature::telemetry_record() {
+      telemetry_t &rec = telemetry[telemetry_head % (TEMP_TELEMETRY_SAMPLES)];
+      uint8_t h = 0;
+      auto add = [&](const celsius_float_t celsius, const celsius_t target, const uint8_t pwm) {
+        rec.heater[h++] = { int16_t(LROUND(celsius * 10)), target, pwm };
+      };
+      rec.ms = millis();
+      HOTEND_LOOP() add(temp_hotend[e].celsius, temp_hotend[e].target, temp_hotend[e].soft_pwm_amount);
+      TERN_(HAS_HEATED_BED, add(temp_bed.celsius, temp_bed.target, temp_bed.soft_pwm_amount));
+      TERN_(HAS_HEATED_CHAMBER, add(temp_chamber.celsius, temp_chamber.target, temp_chamber.soft_pwm_amount));
+      telemetry_head++;
+    }
+
+    // Base64 encode bytes straight to the serial port
+    class Base64Out {
+      uint8_t buf[3], n = 0;
+      static char digit(const uint8_t v) {
+        return v < 26 ? 'A' + v : v < 52 ? 'a' + v - 26 : v < 62 ? '0' + v - 52 : v == 62 ? '+' : '/';
+      }
+      void emit() {
+        const uint32_t v = (uint32_t(buf[0]) << 16) | (uint32_t(n > 1 ? buf[1] : 0) << 8) | (n > 2 ? buf[2] : 0);
+        LOOP_L_N(i, 4) SERIAL_CHAR(i <= n ? digit((v >> (18 - 6 * i)) & 0x3F) : '=');
+        n = 0;
+      }
+    public:
+      void u8(const uint8_t b) { buf[n++] = b; if (n == 3) emit(); }
+      void u16(const uint16_t w) { u8(w & 0xFF); u8(w >> 8); }
+      void u32(const uint32_t l) { u16(l & 0xFFFF); u16(l >> 16); }
+      void flush() { if (n) emit(); }
+    };
+
+    /**
+     * Send the readings recorded since the last report as "TLM:<base64>" lines
+     * of up to 8 readings. Each line holds, little-endian:
+     *
+     *   uint16 sequence number of the first reading (gaps mean lost readings)
+     *   uint8  heater count: hotends, then bed and chamber if present
+     *   per reading: uint32 ms, then per heater int16 0.1°C, int16 target °C,
+     *                uint8 power (0-127)
+     */
+    void Temperature::AutoReportTelemetry::report() {
+      if (uint16_t(telemetry_head - telemetry_sent) > (TEMP_TELEMETRY_SAMPLES))
+        telemetry_sent = telemetry_head - (TEMP_TELEMETRY_SAMPLES);
+
+      while (telemetry_sent != telemetry_head) {
+        Base64Out out;
+        SERIAL_ECHOPGM("TLM:");
+        out.u16(telemetry_sent);
+        out.u8(TELEMETRY_HEATERS);
+        for (uint8_t n = 8; n-- && telemetry_sent != telemetry_head; telemetry_sent++) {
+          const telemetry_t &rec = telemetry[telemetry_sent % (TEMP_TELEMETRY_SAMPLES)];
+          out.u32(rec.ms);
+          LOOP_L_N(h, TELEMETRY_HEATERS) {
+            out.u16(rec.heater[h].celsius_x10);
+            out.u16(rec.heater[h].target);
+            out.u8(rec.heater[h].pwm);
+          }
+        }
+        out.flush();
+        SERIAL_EOL();
+      }
+    }
+
+  #endif // TEMP_TELEMETRY
+
   #if HAS_HOTEND && HAS_STATUS_MESSAGE
     void Temperature::set_heating_message(const uint8_t e, const bool isM104/*=false*/) {
       const bool heating = isHeatingHotend(e);
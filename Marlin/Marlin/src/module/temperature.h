@@ -37,6 +37,10 @@
   #include "../libs/autoreport.h"
 #endif
 
+#if ENABLED(REPORT_CACHE)
+  #include "../libs/report_cache.h"
+#endif
+
 #if HAS_FANCHECK
   #include "../feature/fancheck.h"
 #endif
@@ -781,8 +785,35 @@ class Temperature {
      * Called from the Temperature ISR
      */
     static void isr();
+    static void sensor_task();
     static void readings_ready();
 
+    #if ENABLED(DEFERRED_TEMP_SENSORS)
+      static uint32_t isr_max_cycles, task_max_cycles;
+      static void report_isr_cost();
+    #endif
+
+    #if ENABLED(HEATER_HW_PWM)
+      #if HAS_HOTEND
+        static MarlinHAL::pwm_channel_t hotend_pwm[HOTENDS];
+      #endif
+      #if HAS_HEATED_BED
+        static MarlinHAL::pwm_channel_t bed_pwm;
+      #endif
+      #if HAS_HEATED_CHAMBER
+        static MarlinHAL::pwm_channel_t chamber_pwm;
+      #endif
+      static void update_hw_pwm();
+    #endif
+
+    #if ENABLED(HEATER_POWER_BUDGET)
+      #define POWER_BUDGET_HEATERS (HOTENDS + ENABLED(HAS_HEATED_BED))
+      typedef struct { uint8_t start, count; } power_window_t; // On-time within the soft PWM cycle
+      static power_window_t power_window[POWER_BUDGET_HEATERS];
+      static volatile bool power_window_ready;  // Set for the ISR to take at the next cycle
+      static void apply_power_budget();
+    #endif
+
     /**
      * Call periodically to manage heaters and keep the watchdog fed
      */
@@ -839,9 +870,17 @@ class Temperature {
         #endif
         TERN_(AUTO_POWER_CONTROL, if (celsius) powerManager.power_on());
         temp_hotend[ee].target = _MIN(celsius, hotend_max_target(ee));
+        TERN_(PREHEAT_SCHEDULER, preheat[ee].target = 0); // Any new target replaces a scheduled one
+        TERN_(REPORT_CACHE, heater_report.invalidate());
         start_watching_hotend(ee);
       }
 
+      #if ENABLED(PREHEAT_SCHEDULER)
+        // Start heating just in time to reach the target 'ms' from now (M104 D)
+        static void schedule_hotend(const celsius_t celsius, const uint8_t e, const millis_t ms);
+        static millis_t predict_heatup_ms(const uint8_t e, const celsius_float_t from, const celsius_t to);
+      #endif
+
       static bool isHeatingHotend(const uint8_t E_NAME) {
         return temp_hotend[HOTEND_INDEX].target > temp_hotend[HOTEND_INDEX].celsius;
       }
@@ -900,6 +939,7 @@ class Temperature {
       static void setTargetBed(const celsius_t celsius) {
         TERN_(AUTO_POWER_CONTROL, if (celsius) powerManager.power_on());
         temp_bed.target = _MIN(celsius, BED_MAX_TARGET);
+        TERN_(REPORT_CACHE, heater_report.invalidate());
         start_watching_bed();
       }
 
@@ -911,6 +951,23 @@ class Temperature {
 
       static void manage_heated_bed(const millis_t &ms);
 
+      #if ENABLED(BED_COOLDOWN)
+        typedef struct {
+          celsius_t release;              // Release temperature, 0 when not cooling down
+          celsius_float_t fit_from;       // Bed temperature at the start of the fit interval
+          millis_t fit_ms, report_ms;
+          float rate;                     // (1/s) Fitted cooling constant, 0 until measured
+          #if HAS_FAN
+            uint8_t saved_fan_speed[FAN_COUNT];
+          #endif
+        } cooldown_t;
+        static cooldown_t bed_cooldown;
+        static bool cooling_down() { return bed_cooldown.release; }
+        static void start_cooldown(const celsius_t release);
+        static void end_cooldown(const bool done);
+        static millis_t cooldown_left_ms();
+      #endif
+
     #endif // HAS_HEATED_BED
 
     #if HAS_TEMP_PROBE
@@ -942,6 +999,7 @@ class Temperature {
     #if HAS_HEATED_CHAMBER
       static void setTargetChamber(const celsius_t celsius) {
         temp_chamber.target = _MIN(celsius, CHAMBER_MAX_TARGET);
+        TERN_(REPORT_CACHE, heater_report.invalidate());
         start_watching_chamber();
       }
       // Start watching the Chamber to make sure it's really heating up
@@ -984,6 +1042,7 @@ class Temperature {
     #if HAS_COOLER
       static void setTargetCooler(const celsius_t celsius) {
         temp_cooler.target = constrain(celsius, COOLER_MIN_TARGET, COOLER_MAX_TARGET);
+        TERN_(REPORT_CACHE, heater_report.invalidate());
         start_watching_cooler();
       }
       // Start watching the Cooler to make sure it's really cooling down
@@ -1027,6 +1086,12 @@ class Temperature {
 
       static void PID_autotune(const celsius_t target, const heater_id_t heater_id, const int8_t ncycles, const bool set_result=false);
 
+      #if ENABLED(PID_AUTOTUNE_PARALLEL)
+        // Tune all PID heaters at once in the background (M303 A)
+        static bool PID_autotune_all(const celsius_t hotend_temp, const celsius_t bed_temp, const int8_t ncycles);
+        static bool PID_autotune_running() { return pid_tune_active; }
+      #endif
+
       #if ENABLED(NO_FAN_SLOWING_IN_PID_TUNING)
         static bool adaptive_fan_slowing;
       #elif ENABLED(ADAPTIVE_FAN_SLOWING)
@@ -1080,6 +1145,15 @@ class Temperature {
         struct AutoReportTemp { static void report(); };
         static AutoReporter<AutoReportTemp> auto_reporter;
       #endif
+      #if ENABLED(TEMP_TELEMETRY)
+        // Stream the recorded readings every 10ms * interval (M155 B)
+        struct AutoReportTelemetry { static void report(); };
+        static AutoReporter<AutoReportTelemetry, 10> telemetry_reporter;
+      #endif
+    #endif
+
+    #if ENABLED(REPORT_CACHE)
+      static ReportCache heater_report; // M105 text since the last readings
     #endif
 
     #if HAS_HOTEND && HAS_STATUS_MESSAGE
@@ -1102,6 +1176,7 @@ class Temperature {
       if (!raw_temps_ready) return false;
       updateTemperaturesFromRawValues();
       raw_temps_ready = false;
+      TERN_(HEATER_POWER_BUDGET, apply_power_budget());
       return true;
     }
 
@@ -1134,6 +1209,59 @@ class Temperature {
       static float get_pid_output_chamber();
     #endif
 
+    #if ENABLED(PREHEAT_SCHEDULER)
+      typedef struct {
+        celsius_t target;                 // Scheduled target, 0 once heating has started
+        millis_t ready_ms;                // When the target should be reached
+        #if DISABLED(MPCTEMP)
+          celsius_t learn_target;         // Heat-up being timed, if any
+          celsius_float_t learn_from;
+          millis_t learn_ms;
+        #endif
+      } preheat_t;
+      static preheat_t preheat[HOTENDS];
+      #if DISABLED(MPCTEMP)
+        static float heatup_rate[HOTENDS]; // (°C/s) From the last scheduled heat-up
+      #endif
+      static void preheat_task(const millis_t &ms);
+    #endif
+
+    #if ENABLED(BED_COOLDOWN)
+      static celsius_float_t cooldown_ambient();
+      static void cooldown_task(const millis_t &ms);
+    #endif
+
+    #if ENABLED(TEMP_TELEMETRY)
+      #define TELEMETRY_HEATERS (HOTENDS + ENABLED(HAS_HEATED_BED) + ENABLED(HAS_HEATED_CHAMBER))
+      typedef struct {
+        millis_t ms;
+        struct { int16_t celsius_x10; celsius_t target; uint8_t pwm; } heater[TELEMETRY_HEATERS];
+      } telemetry_t;
+      static telemetry_t telemetry[TEMP_TELEMETRY_SAMPLES];
+      static uint16_t telemetry_head, telemetry_sent;
+      static void telemetry_record();
+    #endif
+
+    #if ENABLED(PID_AUTOTUNE_PARALLEL)
+      #define PID_TUNE_BED   TERN(PIDTEMP, HOTENDS, 0)
+      #define PID_TUNE_COUNT (PID_TUNE_BED + ENABLED(PIDTEMPBED))
+      typedef struct {
+        uint8_t state;                  // PID_TUNE_IDLE, _RUN, _DONE or _FAIL
+        bool heating;
+        int8_t cycles;
+        celsius_t target;
+        millis_t t1, t2;
+        long t_high, t_low, bias, d;
+        celsius_float_t maxT, minT;
+        raw_pid_t pid;
+      } pid_tune_t;
+      static pid_tune_t pid_tune[PID_TUNE_COUNT];
+      static int8_t pid_tune_cycles;
+      static bool pid_tune_active;
+      static float pid_tune_output(const uint8_t i, const celsius_float_t current);
+      static void pid_tune_task(const millis_t &ms);
+    #endif
+
     static void _temp_error(const heater_id_t e, FSTR_P const serial_msg, FSTR_P const lcd_msg);
     static void min_temp_error(const heater_id_t e);
     static void max_temp_error(const heater_id_t e);
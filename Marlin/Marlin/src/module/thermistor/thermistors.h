@@ -544,3 +544,49 @@ static_assert(255 > TEMPTABLE_0_LEN || 255 > TEMPTABLE_1_LEN || 255 > TEMPTABLE_
 #undef TT_REV
 #undef _TT_REVRAW
 #undef TT_REVRAW
+
+#if ENABLED(THERMISTOR_DIRECT_LOOKUP)
+
+  /**
+   * A thermistor table resampled at compile time to a uniform raw step.
+   * The entry is found with a shift and interpolated with one multiply-add,
+   * instead of searching the table and dividing in float for every sample.
+   * Temperatures are stored in 1/16 °C.
+   */
+  #define THERMISTOR_LUT_SIZE _BV(THERMISTOR_LUT_BITS)
+  #define THERMISTOR_LUT_FRAC 4
+
+  constexpr uint8_t thermistor_lut_shift(const uint32_t range, const uint8_t s=0) {
+    return (range >> s) > THERMISTOR_LUT_SIZE ? thermistor_lut_shift(range, s + 1) : s;
+  }
+  constexpr uint8_t THERMISTOR_LUT_SHIFT = thermistor_lut_shift(uint32_t(MAX_RAW_THERMISTOR_VALUE) + 1);
+
+  struct thermistor_lut_t {
+    int16_t t[THERMISTOR_LUT_SIZE + 1];
+
+    template<uint8_t L>
+    constexpr thermistor_lut_t(const temp_entry_t (&tbl)[L]) : t() {
+      for (uint16_t i = 0; i <= THERMISTOR_LUT_SIZE; i++)
+        t[i] = sample(tbl, uint32_t(i) << THERMISTOR_LUT_SHIFT);
+    }
+
+    // The same linear interpolation as SCAN_THERMISTOR_TABLE, done by the compiler
+    template<uint8_t L>
+    static constexpr int16_t sample(const temp_entry_t (&tbl)[L], const uint32_t raw) {
+      if (raw <= tbl[0].value) return tbl[0].celsius * _BV(THERMISTOR_LUT_FRAC);
+      for (uint8_t k = 1; k < L; k++) if (raw <= tbl[k].value) {
+        const float c = tbl[k - 1].celsius + float(raw - tbl[k - 1].value) * (tbl[k].celsius - tbl[k - 1].celsius) / (tbl[k].value - tbl[k - 1].value);
+        return int16_t(c * _BV(THERMISTOR_LUT_FRAC) + (c < 0 ? -0.5f : 0.5f));
+      }
+      return tbl[L - 1].celsius * _BV(THERMISTOR_LUT_FRAC);
+    }
+
+    celsius_float_t get(const raw_adc_t raw) const {
+      const uint16_t i = raw >> THERMISTOR_LUT_SHIFT;
+      const int16_t t0 = pgm_read_word(&t[i]), t1 = pgm_read_word(&t[i + 1]);
+      const int32_t f = raw & (_BV(THERMISTOR_LUT_SHIFT) - 1);
+      return (t0 + ((int32_t(t1 - t0) * f + (_BV(THERMISTOR_LUT_SHIFT) >> 1)) >> THERMISTOR_LUT_SHIFT)) * (1.0f / _BV(THERMISTOR_LUT_FRAC));
+    }
+  };
+
+#endif
@@ -97,6 +97,14 @@
   #include "../feature/pause.h"
 #endif
 
+#if BOTH(TOOLCHANGE_STREAMING, HAS_FILAMENT_SENSOR)
+  #include "../feature/runout.h"
+#endif
+
+#if ENABLED(PRINTCOUNTER_WEAR)
+  #include "printcounter.h"
+#endif
+
 #if ENABLED(TOOLCHANGE_FILAMENT_SWAP)
   #include "../gcode/gcode.h"
   #if TOOLCHANGE_FS_WIPE_RETRACT <= 0
@@ -1020,9 +1028,44 @@ void fast_line_to_current(const AxisEnum fr_axis) { _line_to_current(fr_axis, 0.
 
   }
 
+  #if ENABLED(TOOLCHANGE_STREAMING)
+
+    // Queue an E move without waiting for it, as unscaled_e_move() does
+    inline void stream_e_move(const_float_t length, const_feedRate_t fr_mm_s) {
+      TERN_(HAS_FILAMENT_SENSOR, runout.reset());
+      current_position.e += length / planner.e_factor[active_extruder];
+      line_to_current_position(fr_mm_s);
+    }
+
+    /**
+     * Queue the moves of extruder_prime() without waiting for any of them.
+     * TOOLCHANGE_STREAMING rules out the first-prime slowdown and fan cooling,
+     * so nothing here needs the planner to be empty.
+     */
+    inline void stream_extruder_prime() {
+      if (toolchange_settings.extra_prime >= 0) {
+        stream_e_move(toolchange_settings.swap_length, MMM_TO_MMS(toolchange_settings.unretract_speed));
+        if (toolchange_settings.extra_prime > 0)
+          stream_e_move(toolchange_settings.extra_prime, MMM_TO_MMS(toolchange_settings.prime_speed));
+      }
+      else
+        stream_e_move(toolchange_settings.swap_length + toolchange_settings.extra_prime, MMM_TO_MMS(toolchange_settings.unretract_speed));
+
+      extruder_was_primed.set(active_extruder);
+
+      #if TOOLCHANGE_FS_WIPE_RETRACT
+        stream_e_move(-(TOOLCHANGE_FS_WIPE_RETRACT), MMM_TO_MMS(toolchange_settings.retract_speed));
+      #endif
+    }
+
+  #endif
+
   /**
    * Sequence to Prime the currently selected extruder
    * Raise Z, move the ToolChange_Park if enabled, prime the extruder, move back.
+   *
+   * With TOOLCHANGE_STREAMING the whole sequence is queued at once and the
+   * planner blends it, waiting only for the final cutting recover.
    */
   void tool_change_prime() {
 
@@ -1044,7 +1087,7 @@ void fast_line_to_current(const AxisEnum fr_axis) { _line_to_current(fr_axis, 0.
         current_position.z += toolchange_settings.z_raise;
         TERN_(HAS_SOFTWARE_ENDSTOPS, NOMORE(current_position.z, soft_endstop.max.z));
         fast_line_to_current(Z_AXIS);
-        planner.synchronize();
+        IF_DISABLED(TOOLCHANGE_STREAMING, planner.synchronize());
       }
 
       // Park
@@ -1053,11 +1096,11 @@ void fast_line_to_current(const AxisEnum fr_axis) { _line_to_current(fr_axis, 0.
           IF_DISABLED(TOOLCHANGE_PARK_Y_ONLY, current_position.x = toolchange_settings.change_point.x);
           IF_DISABLED(TOOLCHANGE_PARK_X_ONLY, current_position.y = toolchange_settings.change_point.y);
           planner.buffer_line(current_position, MMM_TO_MMS(TOOLCHANGE_PARK_XY_FEEDRATE), active_extruder);
-          planner.synchronize();
+          IF_DISABLED(TOOLCHANGE_STREAMING, planner.synchronize());
         }
       #endif
 
-      extruder_prime();
+      TERN(TOOLCHANGE_STREAMING, stream_extruder_prime(), extruder_prime());
 
       // Move back
       #if ENABLED(TOOLCHANGE_PARK)
@@ -1080,6 +1123,105 @@ void fast_line_to_current(const AxisEnum fr_axis) { _line_to_current(fr_axis, 0.
 
 #endif // TOOLCHANGE_FILAMENT_SWAP
 
+#if ENABLED(TOOLCHANGE_STREAMING)
+
+  /**
+   * Swap fixed nozzles without emptying the planner. The lift, retract, hotend
+   * offset shift, prime and return are queued like any other moves. Each block
+   * carries its extruder, so the stepper takes up the new E driver at the first
+   * block of the new tool.
+   */
+  void streaming_tool_change(const uint8_t new_tool) {
+    const uint8_t old_tool = active_extruder;
+    destination = current_position;
+
+    auto raise_z = []{
+      if (TERN1(TOOLCHANGE_PARK, toolchange_settings.enable_park)) {
+        current_position.z += toolchange_settings.z_raise;
+        TERN_(HAS_SOFTWARE_ENDSTOPS, NOMORE(current_position.z, soft_endstop.max.z));
+        line_to_current_position(planner.settings.max_feedrate_mm_s[Z_AXIS]);
+      }
+    };
+
+    TERN_(TOOLCHANGE_ZRAISE_BEFORE_RETRACT, raise_z());
+
+    #if ENABLED(TOOLCHANGE_FILAMENT_SWAP)
+      const bool should_swap = toolchange_settings.swap_length;
+      if (should_swap && !too_cold(old_tool) && extruder_was_primed[old_tool])
+        stream_e_move(-toolchange_settings.swap_length, MMM_TO_MMS(toolchange_settings.retract_speed));
+    #endif
+
+    #if HAS_SOFTWARE_ENDSTOPS
+      update_software_endstops(X_AXIS OPTARG(HAS_HOTEND_OFFSET, old_tool, new_tool));
+      update_software_endstops(Y_AXIS OPTARG(HAS_HOTEND_OFFSET, old_tool, new_tool));
+      update_software_endstops(Z_AXIS OPTARG(HAS_HOTEND_OFFSET, old_tool, new_tool));
+    #endif
+
+    IF_DISABLED(TOOLCHANGE_ZRAISE_BEFORE_RETRACT, raise_z());
+
+    #if ENABLED(TOOLCHANGE_PARK)
+      if (toolchange_settings.enable_park) {
+        IF_DISABLED(TOOLCHANGE_PARK_Y_ONLY, current_position.x = toolchange_settings.change_point.x);
+        IF_DISABLED(TOOLCHANGE_PARK_X_ONLY, current_position.y = toolchange_settings.change_point.y);
+        line_to_current_position(MMM_TO_MMS(TOOLCHANGE_PARK_XY_FEEDRATE));
+      }
+    #endif
+
+    active_extruder = new_tool;
+
+    #if HAS_HOTEND_OFFSET
+      // Shift the physical position, leaving bed leveling on. The sync block
+      // moves the planner position without a stop.
+      const xyz_pos_t diff = hotend_offset[new_tool] - hotend_offset[old_tool];
+      DEBUG_ECHOLNPGM("Offset Tool XYZ by { ", diff.x, ", ", diff.y, ", ", diff.z, " }");
+      TERN_(HAS_POSITION_MODIFIERS, planner.apply_modifiers(current_position));
+      current_position += diff;
+      TERN_(HAS_POSITION_MODIFIERS, planner.unapply_modifiers(current_position));
+    #endif
+    sync_plan_position();
+
+    #if ENABLED(TOOLCHANGE_FILAMENT_SWAP)
+      const bool should_prime = should_swap && !too_cold(new_tool);
+      if (should_prime) stream_extruder_prime();
+    #endif
+
+    // Return to the old position with the new nozzle
+    apply_motion_limits(destination);
+    #if ENABLED(TOOLCHANGE_NO_RETURN)
+      if (TERN1(TOOLCHANGE_PARK, toolchange_settings.enable_park)) {
+        current_position.z = destination.z;
+        line_to_current_position(planner.settings.max_feedrate_mm_s[Z_AXIS]);
+      }
+    #else
+      current_position.set(destination.x, destination.y);
+      #if ENABLED(TOOLCHANGE_PARK)
+        if (toolchange_settings.enable_park) {
+          current_position.z = destination.z;
+          line_to_current_position(MMM_TO_MMS(TOOLCHANGE_PARK_XY_FEEDRATE));
+        }
+        else
+      #endif
+        {
+          line_to_current_position(planner.settings.max_feedrate_mm_s[X_AXIS]);
+          current_position.z = destination.z;
+          line_to_current_position(planner.settings.max_feedrate_mm_s[Z_AXIS]);
+        }
+    #endif
+
+    #if ENABLED(TOOLCHANGE_FILAMENT_SWAP)
+      if (should_prime) {
+        // Recover the cutting retraction and start the new tool at E0
+        stream_e_move(toolchange_settings.extra_resume + (TOOLCHANGE_FS_WIPE_RETRACT), MMM_TO_MMS(toolchange_settings.unretract_speed));
+        current_position.e = 0;
+        sync_plan_position_e();
+      }
+    #endif
+
+    SERIAL_ECHOLNPGM(STR_ACTIVE_EXTRUDER, active_extruder);
+  }
+
+#endif // TOOLCHANGE_STREAMING
+
 /**
  * Perform a tool-change, which may result in moving the
  * previous tool out of the way and the new tool into place.
@@ -1121,6 +1263,14 @@ void tool_change(const uint8_t new_tool, bool no_move/*=false*/) {
 
   #elif HAS_MULTI_EXTRUDER
 
+    TERN_(PRINTCOUNTER_WEAR, if (new_tool < EXTRUDERS && new_tool != active_extruder) print_job_timer.incToolChanges());
+
+    #if ENABLED(TOOLCHANGE_STREAMING)
+      // A nozzle swap in a print goes straight into the planner
+      if (new_tool < EXTRUDERS && new_tool != active_extruder && !no_move && !homing_needed() && IsRunning())
+        return streaming_tool_change(new_tool);
+    #endif
+
     planner.synchronize();
 
     #if ENABLED(DUAL_X_CARRIAGE)  // Only T0 allowed if the Printer is in DXC_DUPLICATION_MODE or DXC_MIRRORED_MODE
@@ -46,6 +46,7 @@ thermosensor K-couple ADS1118
 
 /* WARNING: NEW motherboard */
 #define EDETECT_PIN         PG8    /* OLD: WIFI_UART6_RTS */
+/* WiFi module on USART6 ( FF_WIFI_SERIAL ), no flow control */
 #define CAMERA_PWR_ON_PIN   PF15
 /* ........................ */
 
@@ -226,7 +227,7 @@ thermosensor K-couple ADS1118
 /* Servo pin for BLTouch */
 #define SERVO0_PIN                         -1
 
-/* external SPI(2) FLASH mod  ( MKS UI ONLY ) */
+/* external SPI(2) FLASH: MKS UI assets, SD_FLASH_JOB_CACHE */
 #if ENABLED( USE_MKS_UI )
 #define HAS_SPI_FLASH_FONT                   1
 #define HAS_GCODE_PREVIEW                    1
@@ -234,7 +235,9 @@ thermosensor K-couple ADS1118
 #define HAS_LANG_SELECT_SCREEN               1
 #define HAS_BAK_VIEW_IN_FLASH                1
 #define HAS_LOGO_IN_FLASH                    1
+#endif
 
+#if ENABLED( USE_MKS_UI ) || ENABLED( SD_FLASH_JOB_CACHE )
 #define HAS_SPI_FLASH     1
 #define SPI_FLASH_SIZE    0x1000000
 #define W25QXX_MISO_PIN   MISO_PIN
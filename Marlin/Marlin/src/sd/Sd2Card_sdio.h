@@ -28,7 +28,9 @@
 
 bool SDIO_Init();
 bool SDIO_ReadBlock(uint32_t block, uint8_t *dst);
+bool SDIO_ReadBlocks(uint32_t block, uint8_t *dst, uint32_t count);
 bool SDIO_WriteBlock(uint32_t block, const uint8_t *src);
+bool SDIO_WriteBlocks(uint32_t block, const uint8_t *src, uint32_t count);
 bool SDIO_IsReady();
 uint32_t SDIO_GetCardSize();
 
@@ -47,7 +49,9 @@ class DiskIODriver_SDIO : public DiskIODriver {
     bool writeStop()                                      override { curBlock = -1; return true; }
 
     bool readBlock(uint32_t block, uint8_t *dst)          override { return SDIO_ReadBlock(block, dst); }
+    bool readBlocks(uint32_t block, uint8_t *dst, const uint8_t count) override { return SDIO_ReadBlocks(block, dst, count); }
     bool writeBlock(uint32_t block, const uint8_t *src)   override { return SDIO_WriteBlock(block, src); }
+    bool writeBlocks(uint32_t block, const uint8_t *src, const uint8_t count) override { return SDIO_WriteBlocks(block, src, count); }
 
     uint32_t cardSize()                                   override { return SDIO_GetCardSize(); }
 
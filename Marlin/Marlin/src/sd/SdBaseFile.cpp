@@ -45,6 +45,19 @@ SdBaseFile *SdBaseFile::cwd_ = 0;   // Pointer to Current Working Directory
 // callback function for date/time
 void (*SdBaseFile::dateTime_)(uint16_t *date, uint16_t *time) = 0;
 
+#if ENABLED(SD_EXTENT_CACHE)
+  SdBaseFile *SdBaseFile::extentFile_ = nullptr;
+  SdBaseFile::extent_t SdBaseFile::extent_[SD_EXTENT_CACHE_SIZE];
+  uint8_t SdBaseFile::extentCount_;
+#endif
+
+#if ENABLED(SD_WRITE_BUFFER)
+  SdBaseFile *SdBaseFile::writeBufferFile_ = nullptr;
+  uint32_t SdBaseFile::writeBufferBlock_;
+  uint8_t SdBaseFile::writeBufferCount_;
+  alignas(4) uint8_t SdBaseFile::writeBuffer_[SD_WRITE_BUFFER_BLOCKS * 512];
+#endif
+
 // add a cluster to a file
 bool SdBaseFile::addCluster() {
   if (ENABLED(SDCARD_READONLY)) return false;
@@ -69,19 +82,19 @@ bool SdBaseFile::addDirCluster() {
   if (fileSize_ / sizeof(dir_t) >= 0xFFFF) return false;
 
   if (!addCluster()) return false;
-  if (!vol_->cacheFlush()) return false;
 
   block = vol_->clusterStartBlock(curCluster_);
 
   // set cache to first block of cluster
-  vol_->cacheSetBlockNumber(block, true);
+  if (!vol_->cacheNewBlock(block)) return false;
 
   // zero first block of cluster
-  memset(vol_->cacheBuffer_.data, 0, 512);
+  memset(vol_->cache()->data, 0, 512);
 
   // zero rest of cluster
   for (uint8_t i = 1; i < vol_->blocksPerCluster_; i++) {
-    if (!vol_->writeBlock(block + i, vol_->cacheBuffer_.data)) return false;
+    vol_->cacheDrop(block + i);
+    if (!vol_->writeBlock(block + i, vol_->cache()->data)) return false;
   }
   // Increase directory file size by cluster size
   fileSize_ += 512UL << vol_->clusterSizeShift_;
@@ -104,11 +117,196 @@ dir_t* SdBaseFile::cacheDirEntry(uint8_t action) {
  * Reasons for failure include no file is open or an I/O error.
  */
 bool SdBaseFile::close() {
-  bool rtn = sync();
+  #if ENABLED(SD_WRITE_BUFFER)
+    bool rtn = !(flags_ & F_FILE_PREALLOC) || freePreallocated();
+    rtn = sync() && rtn;
+    if (writeBufferFile_ == this) writeBufferFile_ = nullptr;
+  #else
+    bool rtn = sync();
+  #endif
   type_ = FAT_FILE_TYPE_CLOSED;
+  TERN_(SD_EXTENT_CACHE, if (extentFile_ == this) extentFile_ = nullptr);
   return rtn;
 }
 
+#if ENABLED(SD_WRITE_BUFFER)
+
+  /**
+   * Allocate contiguous clusters for an empty file about to be written, so
+   * the whole file can go to the card in multi-block writes. Clusters past
+   * the end of the data are freed when the file is closed.
+   *
+   * \param[in] size The expected file size, as given by the host.
+   *
+   * \return true if the clusters were allocated.
+   */
+  bool SdBaseFile::preAllocate(const uint32_t size) {
+    if (ENABLED(SDCARD_READONLY) || !isFile() || !(flags_ & O_WRITE) || firstCluster_ || !size) return false;
+    const uint32_t count = ((size - 1) >> (vol_->clusterSizeShift_ + 9)) + 1;
+    if (!vol_->allocContiguous(count, &firstCluster_)) return false;
+    flags_ |= F_FILE_DIR_DIRTY | F_FILE_PREALLOC;
+    return true;
+  }
+
+  // Free the pre-allocated clusters that hold no data
+  bool SdBaseFile::freePreallocated() {
+    flags_ &= ~F_FILE_PREALLOC;
+    if (fileSize_) return truncate(fileSize_);
+    if (!vol_->freeChain(firstCluster_)) return false;
+    firstCluster_ = 0;
+    flags_ |= F_FILE_DIR_DIRTY;
+    return true;
+  }
+
+  /**
+   * Check whether a write can go to the write buffer, claiming the buffer if
+   * no other file holds it. Only data appended at the end of a write-only
+   * file is buffered, since nothing will read it back before it's written.
+   */
+  bool SdBaseFile::canBufferWrite(const uint32_t block, const uint16_t offset) {
+    if ((flags_ & O_READ) || curPosition_ < fileSize_) return false;
+    if (!writeBufferFile_) { writeBufferFile_ = this; writeBufferCount_ = 0; }
+    if (writeBufferFile_ != this) return false;
+    // A new block, or more data for the last buffered block
+    return offset == 0 || (writeBufferCount_ && block == writeBufferBlock_ + writeBufferCount_ - 1);
+  }
+
+  /**
+   * Lend the write buffer space that the next bytes appended to this file will
+   * occupy, so a transport can receive data in place. Passing the filled space
+   * to write() commits it without a copy. Data that isn't committed is ignored.
+   *
+   * \param[out] size The number of bytes available at the returned address.
+   *
+   * \return The space, or nullptr if appends to this file can't be buffered.
+   */
+  uint8_t* SdBaseFile::writeSpace(uint16_t &size) {
+    if (!isFile() || (flags_ & (O_READ | O_WRITE)) != O_WRITE || curPosition_ < fileSize_) return nullptr;
+    if (!writeBufferFile_) { writeBufferFile_ = this; writeBufferCount_ = 0; }
+    if (writeBufferFile_ != this) return nullptr;
+    const uint16_t offset = curPosition_ & 0x1FF;
+    uint8_t i = writeBufferCount_;
+    if (offset) {
+      if (!i) return nullptr;   // The partial block went through the cache
+      i--;
+    }
+    else if (i == SD_WRITE_BUFFER_BLOCKS) {
+      if (!flushWriteBuffer()) return nullptr;
+      i = 0;
+    }
+    size = (SD_WRITE_BUFFER_BLOCKS - i) * 512U - offset;
+    return &writeBuffer_[i * 512U + offset];
+  }
+
+  // Copy data into the write buffer, writing out the buffer when it's full
+  bool SdBaseFile::bufferWrite(const uint32_t block, const uint16_t offset, const uint8_t *src, const uint16_t n) {
+    uint8_t i = writeBufferCount_;
+    if (i && block == writeBufferBlock_ + i - 1)
+      i--;
+    else {
+      // Blocks are written in one run, so a block that doesn't follow the last one starts a new run
+      if (i && (block != writeBufferBlock_ + i || i == SD_WRITE_BUFFER_BLOCKS)) {
+        if (!flushWriteBuffer()) return false;
+        i = 0;
+      }
+      if (!i) writeBufferBlock_ = block;
+      writeBufferCount_ = i + 1;
+      // The buffer now has the newer copy of the block
+      vol_->cacheDrop(block);
+    }
+    // Space from writeSpace() is already in place, unless a new run began
+    uint8_t * const dst = &writeBuffer_[i * 512U + offset];
+    if (dst != src) memmove(dst, src, n);
+    return (writeBufferCount_ < SD_WRITE_BUFFER_BLOCKS || offset + n < 512) || flushWriteBuffer();
+  }
+
+  bool SdBaseFile::flushWriteBuffer() {
+    const uint8_t count = writeBufferCount_;
+    if (!count) return true;
+    writeBufferCount_ = 0;
+    return vol_->writeBlocks(writeBufferBlock_, writeBuffer_, count);
+  }
+
+#endif // SD_WRITE_BUFFER
+
+#if ENABLED(SD_PRINT_WHILE_UPLOADING)
+
+  /**
+   * Hand the appending side of a file open for write to another SdBaseFile
+   * and make this one a reader at the start of the file, so the data can be
+   * read back while more is still being written.
+   *
+   * \param[out] writer The file to take over the writes.
+   */
+  void SdBaseFile::splitWriter(SdBaseFile &writer) {
+    writer = *this;
+    TERN_(SD_WRITE_BUFFER, if (writeBufferFile_ == this) writeBufferFile_ = &writer);
+    TERN_(SD_EXTENT_CACHE, if (extentFile_ == this) extentFile_ = nullptr);
+    flags_ = O_READ;
+    curPosition_ = curCluster_ = 0;
+    followWriter(writer);
+  }
+
+  // Let reads reach the data the writer has passed to the volume, but not data still in the write buffer
+  void SdBaseFile::followWriter(const SdBaseFile &writer) {
+    uint32_t size = writer.fileSize_;
+    #if ENABLED(SD_WRITE_BUFFER)
+      // Buffered blocks start on a block boundary and end at the end of the file
+      if (writeBufferFile_ == &writer && writeBufferCount_)
+        size -= (writeBufferCount_ - 1) * 512UL + (size & 0x1FF ? size & 0x1FF : 512U);
+    #endif
+    fileSize_ = size;
+  }
+
+#endif // SD_PRINT_WHILE_UPLOADING
+
+#if ENABLED(SD_EXTENT_CACHE)
+
+  /**
+   * Walk the cluster chain of a file opened for reading and keep it as a list
+   * of contiguous runs. Until the file is closed, read() and seekSet() find
+   * clusters in the list instead of reading the FAT. Only one file at a time
+   * is cached, so this replaces the list of any other file.
+   *
+   * \return true if the chain fits in SD_EXTENT_CACHE_SIZE runs.
+   * Otherwise the file keeps following the FAT.
+   */
+  bool SdBaseFile::cacheExtents() {
+    extentFile_ = nullptr;
+    if (!isFile() || (flags_ & O_WRITE) || !firstCluster_ || !fileSize_) return false;
+
+    // Clusters holding file data. Ignore any beyond the end of the file.
+    const uint32_t clusters = ((fileSize_ - 1) >> (vol_->clusterSizeShift_ + 9)) + 1;
+
+    uint8_t count = 0;
+    uint32_t c = firstCluster_;
+    for (uint32_t i = 0; i < clusters; i++) {
+      if (i) {
+        if (!vol_->fatGet(c, &c) || vol_->isEOC(c)) return false;
+        const extent_t &e = extent_[count - 1];
+        if (c == e.cluster + (i - e.index)) continue;
+      }
+      if (count == SD_EXTENT_CACHE_SIZE) return false;
+      extent_[count++] = { i, c };
+    }
+
+    extentCount_ = count;
+    extentFile_ = this;
+    return true;
+  }
+
+  // Binary search the extent list for the cluster at an index in the file
+  uint32_t SdBaseFile::extentCluster(const uint32_t index) {
+    uint8_t lo = 0, hi = extentCount_;
+    while (hi - lo > 1) {
+      const uint8_t mid = (lo + hi) / 2;
+      if (extent_[mid].index <= index) lo = mid; else hi = mid;
+    }
+    return extent_[lo].cluster + (index - extent_[lo].index);
+  }
+
+#endif // SD_EXTENT_CACHE
+
 /**
  * Check for contiguous file and return its raw block range.
  *
@@ -905,6 +1103,8 @@ bool SdBaseFile::openCachedEntry(uint8_t dirIndex, uint8_t oflag) {
     if (oflag & (O_WRITE | O_CREAT | O_TRUNC)) goto FAIL;
   #endif
 
+  TERN_(SD_EXTENT_CACHE, if (extentFile_ == this) extentFile_ = nullptr);
+
   // location of entry in cache
   p = &vol_->cache()->dir[dirIndex];
 
@@ -1205,7 +1405,7 @@ bool SdBaseFile::openParent(SdBaseFile *dir) {
   // first block of parent dir
   if (!vol_->cacheRawBlock(lbn, SdVolume::CACHE_FOR_READ)) return false;
 
-  dir_t *p = &vol_->cacheBuffer_.dir[1];
+  dir_t *p = &vol_->cache()->dir[1];
   // verify name for '../..'
   if (p->name[0] != '.' || p->name[1] != '.') return false;
   // '..' is pointer to first cluster of parent. open '../..' to find parent
@@ -1387,6 +1587,10 @@ int16_t SdBaseFile::read(void *buf, uint16_t nbyte) {
         // start of new cluster
         if (curPosition_ == 0)
           curCluster_ = firstCluster_;                      // use first cluster in file
+        #if ENABLED(SD_EXTENT_CACHE)
+          else if (extentFile_ == this)                     // get next cluster from the extent list
+            curCluster_ = extentCluster(curPosition_ >> (vol_->clusterSizeShift_ + 9));
+        #endif
         else if (!vol_->fatGet(curCluster_, &curCluster_))  // get next cluster from FAT
           return -1;
       }
@@ -1398,7 +1602,7 @@ int16_t SdBaseFile::read(void *buf, uint16_t nbyte) {
     NOMORE(n, 512 - offset);
 
     // no buffering needed if n == 512
-    if (n == 512 && block != vol_->cacheBlockNumber()) {
+    if (n == 512 && !vol_->cacheHolds(block)) {
       if (!vol_->readBlock(block, dst)) return -1;
     }
     else {
@@ -1414,6 +1618,34 @@ int16_t SdBaseFile::read(void *buf, uint16_t nbyte) {
   return nbyte;
 }
 
+#if ENABLED(SD_LINE_SPANS)
+
+  /**
+   * The bytes from the current position to the end of their block, read into
+   * the volume cache, for the caller to use in place and take with readSkip().
+   * The span is good until the next cache operation.
+   *
+   * \param[out] size The number of bytes in the span, up to the end of the file.
+   *
+   * \return A pointer to the bytes in the cache, or nullptr at the end of the
+   * file, at the start of a new cluster (leave that to read()) or on error.
+   */
+  const uint8_t* SdBaseFile::readSpan(uint16_t &size) {
+    if (!isFile() || !(flags_ & O_READ) || curPosition_ >= fileSize_) return nullptr;
+    const uint16_t offset = curPosition_ & 0x1FF;
+    const uint8_t blockOfCluster = vol_->blockOfCluster(curPosition_);
+    if (offset == 0 && blockOfCluster == 0) {
+      if (curPosition_) return nullptr;   // read() moves on to the next cluster
+      curCluster_ = firstCluster_;
+    }
+    if (!vol_->cacheRawBlock(vol_->clusterStartBlock(curCluster_) + blockOfCluster, SdVolume::CACHE_FOR_READ)) return nullptr;
+    size = 512 - offset;
+    NOMORE(size, fileSize_ - curPosition_);
+    return vol_->cache()->data + offset;
+  }
+
+#endif
+
 /**
  * Read the next entry in a directory.
  *
@@ -1598,6 +1830,7 @@ bool SdBaseFile::remove() {
 
   // set this file closed
   type_ = FAT_FILE_TYPE_CLOSED;
+  TERN_(SD_WRITE_BUFFER, if (writeBufferFile_ == this) writeBufferFile_ = nullptr);
 
   // write entry to SD
   #if DISABLED(LONG_FILENAME_WRITE_SUPPORT)
@@ -1894,6 +2127,14 @@ bool SdBaseFile::seekSet(const uint32_t pos) {
   nCur = (curPosition_ - 1) >> (vol_->clusterSizeShift_ + 9);
   nNew = (pos - 1) >> (vol_->clusterSizeShift_ + 9);
 
+  #if ENABLED(SD_EXTENT_CACHE)
+    if (extentFile_ == this) {
+      curCluster_ = extentCluster(nNew);
+      curPosition_ = pos;
+      return true;
+    }
+  #endif
+
   if (nNew < nCur || curPosition_ == 0)
     curCluster_ = firstCluster_;      // must follow chain from first cluster
   else
@@ -1923,6 +2164,10 @@ bool SdBaseFile::sync() {
   // only allow open files and directories
   if (ENABLED(SDCARD_READONLY) || !isOpen()) goto FAIL;
 
+  #if ENABLED(SD_WRITE_BUFFER)
+    if (writeBufferFile_ == this && !flushWriteBuffer()) goto FAIL;
+  #endif
+
   if (flags_ & F_FILE_DIR_DIRTY) {
     dir_t *d = cacheDirEntry(SdVolume::CACHE_FOR_WRITE);
     // check for deleted by another open file object
@@ -2084,6 +2329,11 @@ bool SdBaseFile::truncate(uint32_t length) {
   // fileSize and length are zero - nothing to do
   if (fileSize_ == 0) return true;
 
+  // write out buffered data before its clusters can be freed
+  #if ENABLED(SD_WRITE_BUFFER)
+    if (writeBufferFile_ == this && !flushWriteBuffer()) return false;
+  #endif
+
   // remember position for seek after truncation
   newPos = curPosition_ > length ? length : curPosition_;
 
@@ -2186,20 +2436,24 @@ int16_t SdBaseFile::write(const void *buf, uint16_t nbyte) {
 
     // block for data write
     uint32_t block = vol_->clusterStartBlock(curCluster_) + blockOfCluster;
+    #if ENABLED(SD_WRITE_BUFFER)
+      if (canBufferWrite(block, blockOffset)) {
+        if (!bufferWrite(block, blockOffset, src, n)) goto FAIL;
+      }
+      else if (writeBufferFile_ == this && !flushWriteBuffer()) goto FAIL;
+      else
+    #endif
     if (n == 512) {
       // full block - don't need to use cache
-      if (vol_->cacheBlockNumber() == block) {
-        // invalidate cache if block is in cache
-        vol_->cacheSetBlockNumber(0xFFFFFFFF, false);
-      }
+      // invalidate cache if block is in cache
+      vol_->cacheDrop(block);
       if (!vol_->writeBlock(block, src)) goto FAIL;
     }
     else {
       if (blockOffset == 0 && curPosition_ >= fileSize_) {
         // start of new block don't need to read into cache
-        if (!vol_->cacheFlush()) goto FAIL;
         // set cache dirty and SD address of block
-        vol_->cacheSetBlockNumber(block, true);
+        if (!vol_->cacheNewBlock(block)) goto FAIL;
       }
       else {
         // rewrite part of block
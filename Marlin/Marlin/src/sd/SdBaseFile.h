@@ -189,6 +189,17 @@ class SdBaseFile {
 
   bool close();
   bool contiguousRange(uint32_t *bgnBlock, uint32_t *endBlock);
+  #if ENABLED(SD_EXTENT_CACHE)
+    bool cacheExtents();
+  #endif
+  #if ENABLED(SD_WRITE_BUFFER)
+    bool preAllocate(const uint32_t size);
+    uint8_t* writeSpace(uint16_t &size);
+  #endif
+  #if ENABLED(SD_PRINT_WHILE_UPLOADING)
+    void splitWriter(SdBaseFile &writer);
+    void followWriter(const SdBaseFile &writer);
+  #endif
   bool createContiguous(SdBaseFile *dirFile,
                         const char *path, uint32_t size);
   /**
@@ -298,6 +309,10 @@ class SdBaseFile {
   bool printName();
   int16_t read();
   int16_t read(void *buf, uint16_t nbyte);
+  #if ENABLED(SD_LINE_SPANS)
+    const uint8_t* readSpan(uint16_t &size);
+    void readSkip(const uint16_t n) { curPosition_ += n; }  // Take n bytes of the span
+  #endif
   int8_t readDir(dir_t *dir, char *longFilename);
   static bool remove(SdBaseFile *dirFile, const char *path);
   bool remove();
@@ -352,6 +367,7 @@ class SdBaseFile {
 
   // bits defined in flags_
   static uint8_t const F_OFLAG = (O_ACCMODE | O_APPEND | O_SYNC),   // should be 0x0F
+                       F_FILE_PREALLOC = 0x40,                      // free clusters past the end on close
                        F_FILE_DIR_DIRTY = 0x80;                     // sync of directory entry required
 
   // private data
@@ -366,6 +382,26 @@ class SdBaseFile {
   uint32_t  firstCluster_;  // first cluster of file
   SdVolume  *vol_;          // volume where file is located
 
+  #if ENABLED(SD_EXTENT_CACHE)
+    // A run of contiguous clusters, up to the next extent's index
+    typedef struct { uint32_t index, cluster; } extent_t;
+    static SdBaseFile *extentFile_;           // file described by the extent list
+    static extent_t extent_[SD_EXTENT_CACHE_SIZE];
+    static uint8_t extentCount_;
+    uint32_t extentCluster(const uint32_t index);
+  #endif
+
+  #if ENABLED(SD_WRITE_BUFFER)
+    static SdBaseFile *writeBufferFile_;      // file appending through the write buffer
+    static uint32_t writeBufferBlock_;        // first block in the buffer
+    static uint8_t writeBufferCount_;         // blocks in the buffer
+    alignas(4) static uint8_t writeBuffer_[SD_WRITE_BUFFER_BLOCKS * 512];
+    bool canBufferWrite(const uint32_t block, const uint16_t offset);
+    bool bufferWrite(const uint32_t block, const uint16_t offset, const uint8_t *src, const uint16_t n);
+    bool flushWriteBuffer();
+    bool freePreallocated();
+  #endif
+
   /**
    * EXPERIMENTAL - Don't use!
    */
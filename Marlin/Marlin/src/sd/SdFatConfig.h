@@ -39,7 +39,7 @@
  *
  * Each card requires about 550 bytes of SRAM so use of a Mega is recommended.
  */
-#define USE_MULTIPLE_CARDS 0 //TODO? ENABLED(MULTI_VOLUME)
+#define USE_MULTIPLE_CARDS ENABLED(SD_STAGING) //TODO? ENABLED(MULTI_VOLUME)
 
 /**
  * Call flush for endl if ENDL_CALLS_FLUSH is nonzero
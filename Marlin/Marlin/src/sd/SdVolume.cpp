@@ -37,7 +37,19 @@
 
 #include "../MarlinCore.h"
 
-#if !USE_MULTIPLE_CARDS
+#if ENABLED(SD_BLOCK_CACHE)
+  #if !USE_MULTIPLE_CARDS
+    #if ENABLED(MEMORY_PROFILES)
+      cache_slot_t *SdVolume::cacheSlot_;     // caches in the memory arena
+      uint8_t       SdVolume::cacheSlots_;    // number of caches
+    #else
+      cache_slot_t  SdVolume::cacheSlot_[SD_BLOCK_CACHE_BLOCKS]; // 512 byte caches for Sd2Card
+    #endif
+    uint8_t       SdVolume::cacheOrder_[SD_BLOCK_CACHE_BLOCKS]; // cache indexes, most recently used first
+    cache_slot_t *SdVolume::cacheCur_;        // the cache most recently used
+    DiskIODriver *SdVolume::sdCard_;          // pointer to SD card object
+  #endif
+#elif !USE_MULTIPLE_CARDS
   // raw block cache
   uint32_t SdVolume::cacheBlockNumber_;  // current block number
   cache_t  SdVolume::cacheBuffer_;       // 512 byte cache for Sd2Card
@@ -120,6 +132,127 @@ bool SdVolume::allocContiguous(uint32_t count, uint32_t *curCluster) {
   return true;
 }
 
+#if ENABLED(SD_BLOCK_CACHE)
+
+// Forget every block and start the use order over
+void SdVolume::cacheReset() {
+  LOOP_L_N(i, cacheSlots_) {
+    cacheSlot_[i].block = 0xFFFFFFFF;
+    cacheSlot_[i].mirror = 0;
+    cacheSlot_[i].dirty = false;
+    cacheOrder_[i] = i;
+  }
+  cacheCur_ = &cacheSlot_[0];
+}
+
+#if ENABLED(MEMORY_PROFILES)
+  bool SdVolume::cacheSetSlots(cache_slot_t * const slots, const uint8_t count) {
+    const bool ok = cacheFlush();     // Before the old caches' RAM is given to others
+    cacheSlot_ = slots;
+    cacheSlots_ = count;
+    cacheReset();
+    return ok;
+  }
+#endif
+
+cache_t* SdVolume::cacheClear() {
+  if (!cacheFlush()) return 0;
+  cacheReset();
+  return &cacheCur_->buffer;
+}
+
+// Write every dirty block, lowest first, so the card sees one forward pass
+bool SdVolume::cacheFlush() {
+  #if DISABLED(SDCARD_READONLY)
+    for (;;) {
+      cache_slot_t *c = nullptr;
+      LOOP_L_N(i, cacheSlots_)
+        if (cacheSlot_[i].dirty && (!c || cacheSlot_[i].block < c->block)) c = &cacheSlot_[i];
+      if (!c) break;
+      if (!sdCard_->writeBlock(c->block, c->buffer.data)) return false;
+
+      // mirror FAT tables
+      if (c->mirror) {
+        if (!sdCard_->writeBlock(c->mirror, c->buffer.data)) return false;
+        c->mirror = 0;
+      }
+      c->dirty = false;
+    }
+  #endif
+  return true;
+}
+
+// Move a cache from one place in the use order to another
+void SdVolume::cacheMove(const uint8_t from, const uint8_t to) {
+  const uint8_t i = cacheOrder_[from];
+  if (from > to)
+    for (uint8_t n = from; n > to; --n) cacheOrder_[n] = cacheOrder_[n - 1];
+  else
+    for (uint8_t n = from; n < to; ++n) cacheOrder_[n] = cacheOrder_[n + 1];
+  cacheOrder_[to] = i;
+}
+
+// Free the least recently used cache, writing its block if dirty, and make it current
+bool SdVolume::cacheEvict() {
+  const uint8_t last = cacheSlots_ - 1;
+  cache_slot_t * const c = &cacheSlot_[cacheOrder_[last]];
+  #if DISABLED(SDCARD_READONLY)
+    if (c->dirty) {
+      if (!sdCard_->writeBlock(c->block, c->buffer.data)) return false;
+      if (c->mirror && !sdCard_->writeBlock(c->mirror, c->buffer.data)) return false;
+    }
+  #endif
+  c->block = 0xFFFFFFFF;
+  c->mirror = 0;
+  c->dirty = false;
+  cacheMove(last, cacheSlots_ / 2);
+  cacheCur_ = c;
+  return true;
+}
+
+bool SdVolume::cacheRawBlock(uint32_t blockNumber, bool dirty) {
+  if (cacheCur_->block != blockNumber) {
+    uint8_t n = 0;
+    while (n < cacheSlots_ && cacheSlot_[cacheOrder_[n]].block != blockNumber) ++n;
+    if (n < cacheSlots_) {
+      cacheCur_ = &cacheSlot_[cacheOrder_[n]];
+      cacheMove(n, 0);
+    }
+    else {
+      if (!cacheEvict()) return false;
+      if (!sdCard_->readBlock(blockNumber, cacheCur_->buffer.data)) return false;
+      cacheCur_->block = blockNumber;
+    }
+  }
+  if (dirty) cacheCur_->dirty = true;
+  return true;
+}
+
+// Put a block that will be written whole in the cache, without reading it
+bool SdVolume::cacheNewBlock(uint32_t blockNumber) {
+  cacheDrop(blockNumber);
+  if (!cacheEvict()) return false;
+  cacheCur_->block = blockNumber;
+  cacheCur_->dirty = true;
+  return true;
+}
+
+// Forget a block that is about to be written around the cache
+void SdVolume::cacheDrop(uint32_t blockNumber) {
+  LOOP_L_N(i, cacheSlots_) if (cacheSlot_[i].block == blockNumber) {
+    cacheSlot_[i].block = 0xFFFFFFFF;
+    cacheSlot_[i].mirror = 0;
+    cacheSlot_[i].dirty = false;
+  }
+}
+
+bool SdVolume::cacheHolds(uint32_t blockNumber) {
+  LOOP_L_N(i, cacheSlots_) if (cacheSlot_[i].block == blockNumber) return true;
+  return false;
+}
+
+#else // !SD_BLOCK_CACHE
+
 bool SdVolume::cacheFlush() {
   #if DISABLED(SDCARD_READONLY)
     if (cacheDirty_) {
@@ -148,6 +281,8 @@ bool SdVolume::cacheRawBlock(uint32_t blockNumber, bool dirty) {
   return true;
 }
 
+#endif // !SD_BLOCK_CACHE
+
 // return the size in bytes of a cluster chain
 bool SdVolume::chainSize(uint32_t cluster, uint32_t *size) {
   uint32_t s = 0;
@@ -169,13 +304,13 @@ bool SdVolume::fatGet(uint32_t cluster, uint32_t *value) {
     lba = fatStartBlock_ + (index >> 9);
     if (!cacheRawBlock(lba, CACHE_FOR_READ)) return false;
     index &= 0x1FF;
-    uint16_t tmp = cacheBuffer_.data[index];
+    uint16_t tmp = cache()->data[index];
     index++;
     if (index == 512) {
       if (!cacheRawBlock(lba + 1, CACHE_FOR_READ)) return false;
       index = 0;
     }
-    tmp |= cacheBuffer_.data[index] << 8;
+    tmp |= cache()->data[index] << 8;
     *value = cluster & 1 ? tmp >> 4 : tmp & 0xFFF;
     return true;
   }
@@ -187,10 +322,10 @@ bool SdVolume::fatGet(uint32_t cluster, uint32_t *value) {
   else
     return false;
 
-  if (lba != cacheBlockNumber_ && !cacheRawBlock(lba, CACHE_FOR_READ))
+  if (lba != cacheBlockNumber() && !cacheRawBlock(lba, CACHE_FOR_READ))
     return false;
 
-  *value = (fatType_ == 16) ? cacheBuffer_.fat16[cluster & 0xFF] : (cacheBuffer_.fat32[cluster & 0x7F] & FAT32MASK);
+  *value = (fatType_ == 16) ? cache()->fat16[cluster & 0xFF] : (cache()->fat32[cluster & 0x7F] & FAT32MASK);
   return true;
 }
 
@@ -211,26 +346,26 @@ bool SdVolume::fatPut(uint32_t cluster, uint32_t value) {
     lba = fatStartBlock_ + (index >> 9);
     if (!cacheRawBlock(lba, CACHE_FOR_WRITE)) return false;
     // mirror second FAT
-    if (fatCount_ > 1) cacheMirrorBlock_ = lba + blocksPerFat_;
+    if (fatCount_ > 1) cacheSetMirror(lba + blocksPerFat_);
     index &= 0x1FF;
     uint8_t tmp = value;
     if (cluster & 1) {
-      tmp = (cacheBuffer_.data[index] & 0xF) | tmp << 4;
+      tmp = (cache()->data[index] & 0xF) | tmp << 4;
     }
-    cacheBuffer_.data[index] = tmp;
+    cache()->data[index] = tmp;
     index++;
     if (index == 512) {
       lba++;
       index = 0;
       if (!cacheRawBlock(lba, CACHE_FOR_WRITE)) return false;
       // mirror second FAT
-      if (fatCount_ > 1) cacheMirrorBlock_ = lba + blocksPerFat_;
+      if (fatCount_ > 1) cacheSetMirror(lba + blocksPerFat_);
     }
     tmp = value >> 4;
     if (!(cluster & 1)) {
-      tmp = ((cacheBuffer_.data[index] & 0xF0)) | tmp >> 4;
+      tmp = ((cache()->data[index] & 0xF0)) | tmp >> 4;
     }
-    cacheBuffer_.data[index] = tmp;
+    cache()->data[index] = tmp;
     return true;
   }
 
@@ -245,12 +380,12 @@ bool SdVolume::fatPut(uint32_t cluster, uint32_t value) {
 
   // store entry
   if (fatType_ == 16)
-    cacheBuffer_.fat16[cluster & 0xFF] = value;
+    cache()->fat16[cluster & 0xFF] = value;
   else
-    cacheBuffer_.fat32[cluster & 0x7F] = value;
+    cache()->fat32[cluster & 0x7F] = value;
 
   // mirror second FAT
-  if (fatCount_ > 1) cacheMirrorBlock_ = lba + blocksPerFat_;
+  if (fatCount_ > 1) cacheSetMirror(lba + blocksPerFat_);
   return true;
 }
 
@@ -293,11 +428,11 @@ int32_t SdVolume::freeClusterCount() {
     NOMORE(n, todo);
     if (fatType_ == 16) {
       for (uint16_t i = 0; i < n; i++)
-        if (cacheBuffer_.fat16[i] == 0) free++;
+        if (cache()->fat16[i] == 0) free++;
     }
     else {
       for (uint16_t i = 0; i < n; i++)
-        if (cacheBuffer_.fat32[i] == 0) free++;
+        if (cache()->fat32[i] == 0) free++;
     }
     #ifdef ESP32
       // Needed to reset the idle task watchdog timer on ESP32 as reading the complete FAT may easily
@@ -333,22 +468,25 @@ bool SdVolume::init(DiskIODriver* dev, uint8_t part) {
   sdCard_ = dev;
   fatType_ = 0;
   allocSearchStart_ = 2;
-  cacheDirty_ = 0;  // cacheFlush() will write block if true
-  cacheMirrorBlock_ = 0;
-  cacheBlockNumber_ = 0xFFFFFFFF;
+  cacheReset();
 
   // if part == 0 assume super floppy with FAT boot sector in block zero
   // if part > 0 assume mbr volume with partition table
   if (part) {
     if (part > 4) return false;
     if (!cacheRawBlock(volumeStartBlock, CACHE_FOR_READ)) return false;
-    part_t *p = &cacheBuffer_.mbr.part[part - 1];
+    part_t *p = &cache()->mbr.part[part - 1];
     if ((p->boot & 0x7F) != 0  || p->totalSectors < 100 || p->firstSector == 0)
       return false; // not a valid partition
     volumeStartBlock = p->firstSector;
   }
   if (!cacheRawBlock(volumeStartBlock, CACHE_FOR_READ)) return false;
-  fbs = &cacheBuffer_.fbs32;
+  fbs = &cache()->fbs32;
+  if (!memcmp(fbs->oemId, "EXFAT   ", 8)) {
+    // exFAT has no FAT16/32 BPB and no 8.3 names, so it can't be used
+    exFAT_ = true;
+    return false;
+  }
   if (fbs->bytesPerSector != 512 ||
       fbs->fatCount == 0 ||
       fbs->reservedSectorCount == 0 ||
@@ -64,6 +64,18 @@ union cache_t {
   fat32_fsinfo_t  fsinfo;     // Used to access to a cached FAT32 FSINFO sector.
 };
 
+#if ENABLED(SD_BLOCK_CACHE)
+  /**
+   * \brief One of the SD_BLOCK_CACHE_BLOCKS caches for the volume
+   */
+  typedef struct {
+    cache_t buffer;             // 512 byte cache for a device block
+    uint32_t block;             // Logical number of the block in the cache
+    uint32_t mirror;            // block number for mirror FAT
+    bool dirty;                 // cacheFlush() will write block if true
+  } cache_slot_t;
+#endif
+
 /**
  * \class SdVolume
  * \brief Access FAT16 and FAT32 volumes on SD and SDHC cards.
@@ -71,17 +83,25 @@ union cache_t {
 class SdVolume {
  public:
   // Create an instance of SdVolume
-  SdVolume() : fatType_(0) {}
+  SdVolume() : fatType_(0), exFAT_(false) {}
   /**
    * Clear the cache and returns a pointer to the cache.  Used by the WaveRP
    * recorder to do raw write to the SD card.  Not for normal apps.
    * \return A pointer to the cache buffer or zero if an error occurs.
    */
-  cache_t* cacheClear() {
-    if (!cacheFlush()) return 0;
-    cacheBlockNumber_ = 0xFFFFFFFF;
-    return &cacheBuffer_;
-  }
+  #if ENABLED(SD_BLOCK_CACHE)
+    cache_t* cacheClear();
+    #if ENABLED(MEMORY_PROFILES)
+      // Write any changed blocks, then use 'count' caches at 'slots' (from MemoryProfile)
+      static bool cacheSetSlots(cache_slot_t * const slots, const uint8_t count);
+    #endif
+  #else
+    cache_t* cacheClear() {
+      if (!cacheFlush()) return 0;
+      cacheBlockNumber_ = 0xFFFFFFFF;
+      return &cacheBuffer_;
+    }
+  #endif
 
   /**
    * Initialize a FAT volume.  Try partition one first then try super
@@ -91,9 +111,10 @@ class SdVolume {
    *
    * \return true for success, false for failure.
    * Reasons for failure include not finding a valid partition, not finding
-   * a valid FAT file system or an I/O error.
+   * a valid FAT file system or an I/O error. exFAT() tells if an exFAT
+   * volume was found instead.
    */
-  bool init(DiskIODriver *dev) { return init(dev, 1) || init(dev, 0); }
+  bool init(DiskIODriver *dev) { exFAT_ = false; return init(dev, 1) || init(dev, 0); }
   bool init(DiskIODriver *dev, uint8_t part);
 
   // inline functions that return volume info
@@ -104,6 +125,7 @@ class SdVolume {
   uint32_t dataStartBlock() const { return dataStartBlock_; }    //> \return The logical block number for the start of file data.
   uint8_t fatCount() const { return fatCount_; }                 //> \return The number of FAT structures on the volume.
   uint32_t fatStartBlock() const { return fatStartBlock_; }      //> \return The logical block number for the start of the first FAT.
+  bool exFAT() const { return exFAT_; }                          //> \return true if the last init() failed on an exFAT volume.
   uint8_t fatType() const { return fatType_; }                   //> \return The FAT type of the volume. Values are 12, 16 or 32.
   int32_t freeClusterCount();
   uint32_t rootDirEntryCount() const { return rootDirEntryCount_; } /** \return The number of entries in the root directory for FAT16 volumes. */
@@ -138,7 +160,29 @@ class SdVolume {
   // value for dirty argument in cacheRawBlock to indicate write to cache
   static bool const CACHE_FOR_WRITE = true;
 
-  #if USE_MULTIPLE_CARDS
+  #if ENABLED(SD_BLOCK_CACHE)
+    // Blocks in use order, the most recent first. A block read in enters halfway
+    // down and only moves to the front when it's used again, so one pass over
+    // many blocks (a directory listing) can't push out the FAT and file blocks.
+    #if USE_MULTIPLE_CARDS
+      cache_slot_t cacheSlot_[SD_BLOCK_CACHE_BLOCKS];  // 512 byte caches for device blocks
+      static constexpr uint8_t cacheSlots_ = SD_BLOCK_CACHE_BLOCKS;
+      uint8_t cacheOrder_[SD_BLOCK_CACHE_BLOCKS];      // Cache indexes, in use order
+      cache_slot_t *cacheCur_;                         // The cache most recently used
+      DiskIODriver *sdCard_;                           // DiskIODriver object for cache
+    #else
+      #if ENABLED(MEMORY_PROFILES)
+        static cache_slot_t *cacheSlot_;                      // The memory profile's share of the arena
+        static uint8_t cacheSlots_;                           // Caches at cacheSlot_
+      #else
+        static cache_slot_t cacheSlot_[SD_BLOCK_CACHE_BLOCKS]; // 512 byte caches for device blocks
+        static constexpr uint8_t cacheSlots_ = SD_BLOCK_CACHE_BLOCKS;
+      #endif
+      static uint8_t cacheOrder_[SD_BLOCK_CACHE_BLOCKS];      // Cache indexes, in use order
+      static cache_slot_t *cacheCur_;                         // The cache most recently used
+      static DiskIODriver *sdCard_;                           // DiskIODriver object for cache
+    #endif
+  #elif USE_MULTIPLE_CARDS
     cache_t cacheBuffer_;        // 512 byte cache for device blocks
     uint32_t cacheBlockNumber_;  // Logical number of block in the cache
     DiskIODriver *sdCard_;       // DiskIODriver object for cache
@@ -161,6 +205,7 @@ class SdVolume {
   uint8_t fatCount_;            // number of FATs on volume
   uint32_t fatStartBlock_;      // start block for first FAT
   uint8_t fatType_;             // volume type (12, 16, OR 32)
+  bool exFAT_;                  // init() found an exFAT boot sector
   uint16_t rootDirEntryCount_;  // number of entries in FAT16 root dir
   uint32_t rootDirStart_;       // root start block for FAT16, cluster for FAT32
 
@@ -169,23 +214,69 @@ class SdVolume {
   uint32_t clusterStartBlock(uint32_t cluster) const { return dataStartBlock_ + ((cluster - 2) << clusterSizeShift_); }
   uint32_t blockNumber(uint32_t cluster, uint32_t position) const { return clusterStartBlock(cluster) + blockOfCluster(position); }
 
-  cache_t* cache() { return &cacheBuffer_; }
-  uint32_t cacheBlockNumber() const { return cacheBlockNumber_; }
+  #if ENABLED(SD_BLOCK_CACHE)
+
+    cache_t* cache() { return &cacheCur_->buffer; }
+    uint32_t cacheBlockNumber() const { return cacheCur_->block; }
+
+    #if USE_MULTIPLE_CARDS
+      bool cacheFlush();
+      bool cacheRawBlock(uint32_t blockNumber, bool dirty);
+      bool cacheNewBlock(uint32_t blockNumber);
+      void cacheDrop(uint32_t blockNumber);
+      bool cacheHolds(uint32_t blockNumber);
+      bool cacheEvict();
+      void cacheMove(uint8_t from, uint8_t to);
+      void cacheReset();
+    #else
+      static bool cacheFlush();
+      static bool cacheRawBlock(uint32_t blockNumber, bool dirty);
+      static bool cacheNewBlock(uint32_t blockNumber);
+      static void cacheDrop(uint32_t blockNumber);
+      static bool cacheHolds(uint32_t blockNumber);
+      static bool cacheEvict();
+      static void cacheMove(uint8_t from, uint8_t to);
+      static void cacheReset();
+    #endif
+
+    void cacheSetDirty() { cacheCur_->dirty = true; }
+    void cacheSetMirror(uint32_t blockNumber) { cacheCur_->mirror = blockNumber; }
 
-  #if USE_MULTIPLE_CARDS
-    bool cacheFlush();
-    bool cacheRawBlock(uint32_t blockNumber, bool dirty);
   #else
-    static bool cacheFlush();
-    static bool cacheRawBlock(uint32_t blockNumber, bool dirty);
+
+    cache_t* cache() { return &cacheBuffer_; }
+    uint32_t cacheBlockNumber() const { return cacheBlockNumber_; }
+
+    #if USE_MULTIPLE_CARDS
+      bool cacheFlush();
+      bool cacheRawBlock(uint32_t blockNumber, bool dirty);
+    #else
+      static bool cacheFlush();
+      static bool cacheRawBlock(uint32_t blockNumber, bool dirty);
+    #endif
+
+    // used by SdBaseFile write to assign cache to SD location
+    void cacheSetBlockNumber(uint32_t blockNumber, bool dirty) {
+      cacheDirty_ = dirty;
+      cacheBlockNumber_  = blockNumber;
+    }
+    // Put a block that will be written whole in the cache, without reading it
+    bool cacheNewBlock(uint32_t blockNumber) {
+      if (!cacheFlush()) return false;
+      cacheSetBlockNumber(blockNumber, true);
+      return true;
+    }
+    // Forget a block that is about to be written around the cache
+    void cacheDrop(uint32_t blockNumber) {
+      if (cacheBlockNumber_ == blockNumber) cacheSetBlockNumber(0xFFFFFFFF, false);
+    }
+    bool cacheHolds(uint32_t blockNumber) const { return cacheBlockNumber_ == blockNumber; }
+    void cacheReset() { cacheDirty_ = 0; cacheMirrorBlock_ = 0; cacheBlockNumber_ = 0xFFFFFFFF; }
+    void cacheSetDirty() { cacheDirty_ |= CACHE_FOR_WRITE; }
+    void cacheSetMirror(uint32_t blockNumber) { cacheMirrorBlock_ = blockNumber; }
+
   #endif
 
-  // used by SdBaseFile write to assign cache to SD location
-  void cacheSetBlockNumber(uint32_t blockNumber, bool dirty) {
-    cacheDirty_ = dirty;
-    cacheBlockNumber_  = blockNumber;
-  }
-  void cacheSetDirty() { cacheDirty_ |= CACHE_FOR_WRITE; }
   bool chainSize(uint32_t beginCluster, uint32_t *size);
   bool fatGet(uint32_t cluster, uint32_t *value);
   bool fatPut(uint32_t cluster, uint32_t value);
@@ -198,4 +289,5 @@ class SdVolume {
   }
   bool readBlock(uint32_t block, uint8_t *dst) { return sdCard_->readBlock(block, dst); }
   bool writeBlock(uint32_t block, const uint8_t *dst) { return sdCard_->writeBlock(block, dst); }
+  bool writeBlocks(uint32_t block, const uint8_t *src, const uint8_t count) { return sdCard_->writeBlocks(block, src, count); }
 };
@@ -55,6 +55,35 @@
   #include "../feature/pause.h"
 #endif
 
+#if ENABLED(SD_FLASH_JOB_CACHE)
+  #include "../libs/W25Qxx.h"
+#endif
+
+#if ENABLED(CANCEL_OBJECTS_SEEK)
+  #include "../feature/cancel_object.h"
+  #include "../gcode/gcode.h"
+#endif
+
+#if EITHER(SD_JOB_QUEUE_PREHEAT, SD_BENCHMARK)
+  #include "../module/temperature.h"
+#endif
+
+#if ENABLED(TFT_TOOLPATH_PREVIEW)
+  #include "../lcd/tft/tft_toolpath.h"
+#endif
+
+#if ENABLED(LAYER_EVENTS)
+  #include "../feature/layer_events.h"
+#endif
+
+#if ENABLED(PRINT_TIME_ESTIMATE)
+  #include "../feature/print_time.h"
+#endif
+
+#if ENABLED(SD_JOB_COMPILE)
+  #include "../feature/job_cache.h"
+#endif
+
 #define DEBUG_OUT EITHER(DEBUG_CARDREADER, MARLIN_DEV_MODE)
 #include "../core/debug_out.h"
 #include "../libs/hex_print.h"
@@ -76,11 +105,32 @@ IF_DISABLED(NO_SD_AUTOSTART, uint8_t CardReader::autofile_index); // = 0
   serial_index_t IF_DISABLED(HAS_MULTI_SERIAL, constexpr) CardReader::transfer_port_index;
 #endif
 
+#if ENABLED(SD_PRINT_WHILE_UPLOADING)
+  uint32_t CardReader::upload_print_size; // = 0
+  SdFile CardReader::upload;
+#endif
+
 // private:
 
 SdFile CardReader::root, CardReader::workDir, CardReader::workDirParents[MAX_DIR_DEPTH];
 uint8_t CardReader::workDirDepth;
 
+#if HAS_SD_HOST_DRIVE
+  volatile millis_t CardReader::host_write_ms; // = 0
+#endif
+
+#if ENABLED(SD_JOB_INFO)
+  CardReader::job_info_t CardReader::job_info;
+  CardReader::job_info_entry_t CardReader::job_info_cache[SD_JOB_INFO_CACHE];
+  uint8_t CardReader::job_info_next;
+#endif
+
+#if ENABLED(SD_DIR_INDEX)
+  uint16_t CardReader::dir_index[SD_DIR_INDEX_SIZE];
+  uint16_t CardReader::dir_index_count = 0xFFFF;
+  uint32_t CardReader::dir_index_cluster;
+#endif
+
 #if ENABLED(SDCARD_SORT_ALPHA)
 
   uint16_t CardReader::sort_count;
@@ -143,6 +193,16 @@ SdFile CardReader::file;
 
 uint32_t CardReader::filesize, CardReader::sdpos;
 
+#if ENABLED(SD_FLASH_JOB_CACHE)
+  uint8_t CardReader::flash_page[256];
+  uint32_t CardReader::flash_page_index = UINT32_MAX;
+#endif
+
+#if ENABLED(SD_COMPRESSED_FILES)
+  CardReader::gcz_state_t CardReader::gcz;
+  heatshrink_decoder CardReader::gcz_decoder;
+#endif
+
 CardReader::CardReader() {
   changeMedia(&
     #if HAS_USB_FLASH_DRIVE && !SHARED_VOLUME_IS(SD_ONBOARD)
@@ -240,6 +300,323 @@ int CardReader::countItems(SdFile dir) {
   return c;
 }
 
+#if ENABLED(SD_DIR_INDEX)
+
+  //
+  // Count the items in the working directory, noting where each one starts
+  // so it can be read again without scanning the directory from the top.
+  //
+  void CardReader::indexWorkDir() {
+    dir_t p;
+    uint16_t c = 0;
+    workDir.rewind();
+    for (uint32_t pos = 0; workDir.readDir(&p, longFilename) > 0; pos = workDir.curPosition())
+      if (is_visible_entity(p)) {
+        if (c < SD_DIR_INDEX_SIZE) dir_index[c] = pos >> 5;
+        c++;
+      }
+
+    dir_index_cluster = workDir.firstCluster();
+    dir_index_count = c;
+
+    #if ALL(SDCARD_SORT_ALPHA, SDSORT_USES_RAM, SDSORT_CACHE_NAMES)
+      nrFiles = c;
+    #endif
+  }
+
+#endif
+
+#if ENABLED(SD_JOB_INFO)
+
+  // The background scan reads its own copy of the print file
+  static SdFile job_scan;
+  static uint32_t job_scan_end,       // End of the part being scanned
+                  job_scan_tail,      // Start of the tail part
+                  job_scan_line_pos;  // File offset of the line being collected
+  static char job_scan_line[96];
+  static uint8_t job_scan_len;
+  static bool job_scan_skip;          // Skip a partial line at the start of the tail
+
+  void CardReader::job_info_flush() {
+    LOOP_L_N(i, SD_JOB_INFO_CACHE) job_info_cache[i].size = 0;
+    job_info = job_info_t();
+    if (job_scan.isOpen()) job_scan.close();
+  }
+
+  //
+  // Get the info for a newly opened print file from the cache, or start scanning it
+  //
+  void CardReader::job_info_start() {
+    if (job_scan.isOpen()) job_scan.close();
+    const uint32_t cluster = file.firstCluster(), size = file.fileSize();
+    LOOP_L_N(i, SD_JOB_INFO_CACHE) {
+      const job_info_entry_t &e = job_info_cache[i];
+      if (size && e.size == size && e.cluster == cluster) { job_info = e.info; return; }
+    }
+    job_info = job_info_t();
+    if (!size) return;
+
+    job_scan = file;
+    job_scan.rewind();
+    job_scan_end = _MIN(size, uint32_t(SD_JOB_INFO_HEAD));
+    job_scan_tail = size > uint32_t(SD_JOB_INFO_TAIL) ? (size - (SD_JOB_INFO_TAIL)) & ~0x1FFUL : 0;
+    NOLESS(job_scan_tail, job_scan_end);
+    job_scan_line_pos = job_scan_len = 0;
+    job_scan_skip = false;
+  }
+
+  // Parse a duration such as "1d 2h 3m 4s"
+  static uint32_t parse_duration(char *p) {
+    uint32_t t = 0;
+    for (;;) {
+      while (*p == ' ') p++;
+      if (!NUMERIC(*p)) return t;
+      uint32_t v = strtoul(p, &p, 10);
+      switch (*p) {
+        case 'd': v *= 86400UL; break;
+        case 'h': v *= 3600UL; break;
+        case 'm': v *= 60UL; break;
+        case 's': break;
+        default: return t + v;
+      }
+      t += v;
+      p++;
+    }
+  }
+
+  //
+  // Parse one comment line for metadata written by Cura, PrusaSlicer and OrcaSlicer
+  //
+  void CardReader::job_info_parse(char * const line, const uint32_t pos) {
+    if (line[0] != ';') return;
+    #define JOB_KEY(K) (strncmp_P(line, PSTR(K), sizeof(K) - 1) ? nullptr : line + sizeof(K) - 1)
+    char *v;
+    if ((v = JOB_KEY(";TIME:")))
+      job_info.time = strtoul(v, nullptr, 10);
+    else if ((v = JOB_KEY(";Filament used:")))
+      job_info.filament = atof(v) * 1000;                     // Meters
+    else if ((v = JOB_KEY(";LAYER_COUNT:")) || (v = JOB_KEY("; total layers count = ")) || (v = JOB_KEY("; total layer number: ")))
+      job_info.layers = strtoul(v, nullptr, 10);
+    else if ((v = JOB_KEY("; filament used [mm] = ")))
+      job_info.filament = atof(v);
+    else if ((v = JOB_KEY("; estimated printing time (normal mode) = ")))
+      job_info.time = parse_duration(v);
+    else if ((v = strstr_P(line, PSTR("total estimated time: "))))
+      job_info.time = parse_duration(v + 22);
+    else if (JOB_KEY("; thumbnail") && (v = strstr_P(line, PSTR(" begin ")))) {
+      // "; thumbnail begin WxH size", also thumbnail_PNG, thumbnail_QOI, etc.
+      // Keep the first one, unless a QOI or a bigger QOI thumbnail follows.
+      const bool qoi = JOB_KEY("; thumbnail_QOI ");
+      uint16_t w = strtoul(v + 7, &v, 10), h = 0;
+      if (*v == 'x') h = strtoul(v + 1, &v, 10);
+      if (!job_info.thumbnail || (qoi && (!job_info.thumbnail_qoi || uint32_t(w) * h > uint32_t(job_info.thumbnail_width) * job_info.thumbnail_height))) {
+        job_info.thumbnail_width = w;
+        job_info.thumbnail_height = h;
+        job_info.thumbnail_size = strtoul(v, nullptr, 10);
+        job_info.thumbnail_qoi = qoi;
+        job_info.thumbnail = pos;
+      }
+    }
+    #undef JOB_KEY
+  }
+
+  //
+  // Scan a block of the print file. Called from idle().
+  // Whole-block reads go straight to the caller's buffer, so the scan
+  // doesn't disturb the block cache used by a print in progress.
+  //
+  void CardReader::job_info_task() {
+    if (!job_scan.isOpen() || TERN0(HAS_SD_HOST_DRIVE, host_is_writing())) return;
+
+    // Stop if the print file was closed or replaced
+    if (!file.isOpen() || file.firstCluster() != job_scan.firstCluster()) { job_scan.close(); return; }
+
+    uint8_t buf[512];
+    const uint32_t pos = job_scan.curPosition();
+    const int16_t n = job_scan.read(buf, _MIN(uint32_t(sizeof(buf)), job_scan_end - pos));
+    if (n < 0) { job_scan.close(); return; }
+
+    LOOP_L_N(i, n) {
+      const char c = buf[i];
+      if (c == '\n' || c == '\r') {
+        if (job_scan_len && !job_scan_skip) {
+          job_scan_line[job_scan_len] = '\0';
+          job_info_parse(job_scan_line, job_scan_line_pos);
+        }
+        job_scan_len = 0;
+        job_scan_skip = false;
+        job_scan_line_pos = pos + i + 1;
+      }
+      else if (job_scan_len < sizeof(job_scan_line) - 1)
+        job_scan_line[job_scan_len++] = c;
+    }
+
+    if (job_scan.curPosition() < job_scan_end) return;
+
+    // At the end of the head go to the tail, unless the head had everything
+    const uint32_t size = job_scan.fileSize();
+    if (job_scan_end < size && !(job_info.time && job_info.filament)) {
+      if (job_scan_tail > job_scan_end) {
+        job_scan.seekSet(job_scan_tail);
+        job_scan_len = 0;
+        job_scan_skip = true;
+      }
+      job_scan_end = size;
+      return;
+    }
+
+    // Done. Remember the info for this file.
+    job_info_cache[job_info_next] = { job_scan.firstCluster(), size, job_info };
+    job_scan.close();
+    job_info_next = (job_info_next + 1) % (SD_JOB_INFO_CACHE);
+  }
+
+#endif // SD_JOB_INFO
+
+#if ENABLED(CANCEL_OBJECTS_SEEK)
+
+  // Like job_scan, the index reads its own copy of the print file
+  static SdFile skip_scan;
+  static CardReader::skip_range_t skip_ranges[CANCEL_OBJECTS_SEEK_RANGES], skip_open;
+  static uint8_t skip_head, skip_count;
+  static bool skip_in_range,          // skip_open is collecting moves
+              skip_e_relative;        // M83 / G91 in effect where the scan is
+  static uint32_t skip_mask,          // Objects canceled when the scan started
+                  skip_last_sdpos,    // Print position on the last task call
+                  skip_line_pos;      // File offset of the line being collected
+  static char skip_line[MAX_CMD_SIZE];
+  static uint8_t skip_len;
+
+  // Parse one scanned line. The range ends at anything that isn't a move or a
+  // G92 E, so only lines whose effect is the E position and feedrate are skipped.
+  static void skip_scan_line(char *p, const uint32_t pos, const uint32_t next) {
+    while (*p == ' ') p++;
+    if (*p == 'N') { do p++; while (NUMERIC(*p)); while (*p == ' ') p++; }
+    char * const comment = strchr(p, ';');
+    if (comment) *comment = '\0';
+    if (!*p) return;
+
+    const char code = p[0];
+    const int num = NUMERIC(p[1]) ? atoi(p + 1) : -1;
+    const bool is_move = code == 'G' && WITHIN(num, 0, 3),
+               is_g92 = code == 'G' && num == 92;
+
+    if (skip_in_range) {
+      bool ok = is_move || is_g92;
+      for (char *w = p + 1; ok && *w; w++) {
+        if (is_g92 && *w != 'E' && WITHIN(*w, 'A', 'Z')) ok = false;  // G92 of X, Y, Z...
+        else if (*w == 'E') {
+          const float v = strtof(w + 1, nullptr);
+          if (is_g92) { skip_open.e = v; skip_open.has_e = true; }
+          else if (!skip_e_relative) { skip_open.e = v; skip_open.has_e = true; }
+          else if (skip_open.has_e) skip_open.e += v;
+        }
+        else if (*w == 'F' && is_move) { skip_open.f = strtof(w + 1, nullptr); skip_open.has_f = true; }
+      }
+      if (ok) return;
+
+      skip_in_range = false;
+      if (pos > skip_open.start) {
+        skip_open.end = pos;
+        skip_ranges[(skip_head + skip_count) % (CANCEL_OBJECTS_SEEK_RANGES)] = skip_open;
+        skip_count++;
+      }
+    }
+
+    switch (code) {
+      case 'G': if (num == 90 || num == 91) skip_e_relative = num == 91; break;
+      case 'M':
+        if (num == 82 || num == 83) skip_e_relative = num == 83;
+        else if (num == 486) {
+          const char * const s = strchr(p, 'S');
+          const int obj = s ? atoi(s + 1) : -1;
+          if (WITHIN(obj, 0, 31) && TEST(skip_mask, obj)) {
+            skip_open = { next, next, 0, 0, false, false };
+            skip_in_range = true;
+          }
+        }
+        break;
+    }
+  }
+
+  //
+  // Index the moves of canceled objects ahead of the print position, a block per call.
+  // Called from idle() while an object is canceled.
+  //
+  void CardReader::skip_scan_task() {
+    if (!cancelable.canceled || !IS_SD_PRINTING() || TERN0(SD_PRINT_WHILE_UPLOADING, flag.growing) || TERN0(HAS_SD_HOST_DRIVE, host_is_writing())) {
+      if (skip_scan.isOpen()) skip_scan.close();
+      return;
+    }
+
+    // Start over at the print position for a new file, a new cancel, or a jump back (M808)
+    if (!skip_scan.isOpen() || skip_scan.firstCluster() != file.firstCluster() || skip_mask != cancelable.canceled || sdpos < skip_last_sdpos) {
+      skip_scan = file;
+      if (!skip_scan.seekSet(sdpos)) { skip_scan.close(); return; }
+      skip_mask = cancelable.canceled;
+      skip_head = skip_count = skip_len = 0;
+      skip_in_range = false;
+      skip_e_relative = gcode.axis_is_relative(E_AXIS);
+      skip_line_pos = sdpos;
+    }
+    skip_last_sdpos = sdpos;
+
+    // Drop ranges the print has passed, then wait for a free slot
+    while (skip_count && skip_ranges[skip_head].start < sdpos) { skip_head = (skip_head + 1) % (CANCEL_OBJECTS_SEEK_RANGES); skip_count--; }
+    if (skip_count == CANCEL_OBJECTS_SEEK_RANGES) return;
+
+    uint8_t buf[512];
+    const uint32_t pos = skip_scan.curPosition();
+    const int16_t n = skip_scan.read(buf, sizeof(buf));
+    if (n <= 0) { skip_scan.close(); return; }
+
+    LOOP_L_N(i, n) {
+      const char c = buf[i];
+      if (c == '\n' || c == '\r') {
+        const uint32_t next = pos + i + 1;
+        skip_line[skip_len] = '\0';
+        skip_scan_line(skip_line, skip_line_pos, next);
+        skip_len = 0;
+        skip_line_pos = next;
+        // With the index full, continue from the next line later
+        if (skip_count == CANCEL_OBJECTS_SEEK_RANGES) { skip_scan.seekSet(next); break; }
+      }
+      else if (skip_len < sizeof(skip_line) - 1)
+        skip_line[skip_len++] = c;
+    }
+  }
+
+  //
+  // Called after each line read for the print. If an indexed range starts here
+  // seek past it and return it, so its E position and feedrate can be applied.
+  //
+  bool CardReader::skip_canceled(skip_range_t &range) {
+    if (!skip_count || skip_ranges[skip_head].start != sdpos || skip_mask != cancelable.canceled) return false;
+    range = skip_ranges[skip_head];
+    skip_head = (skip_head + 1) % (CANCEL_OBJECTS_SEEK_RANGES);
+    skip_count--;
+    setIndex(range.end);
+    return true;
+  }
+
+#endif // CANCEL_OBJECTS_SEEK
+
+#if ANY(TFT_THUMBNAIL, HOTEND_STANDBY_LOOKAHEAD, PRINT_TIME_ESTIMATE)
+
+  //
+  // Read part of the print file through a copy of it, leaving the print position alone
+  //
+  int16_t CardReader::job_read(const uint32_t pos, void * const buf, const uint16_t len) {
+    static SdFile job_reader;
+    if (!file.isOpen() || TERN0(HAS_SD_HOST_DRIVE, host_is_writing())) return -1;
+    if (TERN0(SD_COMPRESSED_FILES, flag.compressed)) return -1; // Not G-code as stored
+    if (!job_reader.isOpen() || job_reader.firstCluster() != file.firstCluster()) job_reader = file;
+    if (job_reader.curPosition() != pos && !job_reader.seekSet(pos)) return -1;
+    return job_reader.read(buf, len);
+  }
+
+#endif
+
 //
 // Get file/folder info for an item by index
 //
@@ -439,14 +816,20 @@ void CardReader::printSelectedFilename() {
 void CardReader::mount() {
   flag.mounted = false;
   if (root.isOpen()) root.close();
+  TERN_(SD_DIR_INDEX, flush_dir_index());
+  TERN_(SD_JOB_INFO, job_info_flush());
 
   if (!driver->init(SD_SPI_SPEED, SDSS)
     #if defined(LCD_SDSS) && (LCD_SDSS != SDSS)
       && !driver->init(SD_SPI_SPEED, LCD_SDSS)
     #endif
   ) SERIAL_ECHO_MSG(STR_SD_INIT_FAIL);
-  else if (!volume.init(driver))
-    SERIAL_ERROR_MSG(STR_SD_VOL_INIT_FAIL);
+  else if (!volume.init(driver)) {
+    if (volume.exFAT())
+      SERIAL_ERROR_MSG(STR_SD_VOL_EXFAT);
+    else
+      SERIAL_ERROR_MSG(STR_SD_VOL_INIT_FAIL);
+  }
   else if (!root.openRoot(&volume))
     SERIAL_ERROR_MSG(STR_SD_OPENROOT_FAIL);
   else {
@@ -531,6 +914,8 @@ void CardReader::manage_media() {
  * Used by M22, "Release Media", manage_media.
  */
 void CardReader::release() {
+  TERN_(SD_JOB_QUEUE, job_queue_clear());
+
   // Card removed while printing? Abort!
   if (IS_SD_PRINTING())
     abortFilePrintSoon();
@@ -542,6 +927,7 @@ void CardReader::release() {
   #if ALL(SDCARD_SORT_ALPHA, SDSORT_USES_RAM, SDSORT_CACHE_NAMES)
     nrFiles = 0;
   #endif
+  TERN_(SD_DIR_INDEX, flush_dir_index());
 }
 
 /**
@@ -564,6 +950,14 @@ void CardReader::openAndPrintFile(const char *name) {
  */
 void CardReader::startOrResumeFilePrinting() {
   if (isMounted()) {
+    #if ENABLED(SD_FLASH_JOB_CACHE)
+      if (!flag.flash_cached && TERN1(SD_PRINT_WHILE_UPLOADING, !flag.growing) && TERN1(HAS_MEDIA_SUBCALLS, !file_subcall_ctr))
+        cacheToFlash();
+    #endif
+    #if ENABLED(SD_STAGING)
+      if (!flag.staged && !flag.growing && !sdpos && TERN1(HAS_MEDIA_SUBCALLS, !file_subcall_ctr))
+        stageFile();
+    #endif
     flag.sdprinting = true;
     flag.sdprintdone = false;
     TERN_(SD_RESORT, flush_presort());
@@ -577,6 +971,9 @@ void CardReader::endFilePrintNow(TERN_(SD_RESORT, const bool re_sort/*=false*/))
   TERN_(ADVANCED_PAUSE_FEATURE, did_pause_print = 0);
   TERN_(HAS_DWIN_E3V2_BASIC, HMI_flag.print_finish = flag.sdprinting);
   flag.abort_sd_printing = false;
+  TERN_(SD_FLASH_JOB_CACHE, flag.flash_cached = false);
+  TERN_(SD_STAGING, stageStop());
+  TERN_(SD_JOB_COMPILE, job_cache.close());
   if (isFileOpen()) file.close();
   TERN_(SD_RESORT, if (re_sort) presort());
 }
@@ -586,7 +983,24 @@ void CardReader::abortFilePrintNow(TERN_(SD_RESORT, const bool re_sort/*=false*/
   endFilePrintNow(TERN_(SD_RESORT, re_sort));
 }
 
+#if ENABLED(SD_LOG_BUFFER)
+
+  uint32_t CardReader::log_dropped; // = 0
+
+  // Logged lines wait here for log_task. Empty when log_head == log_tail.
+  static uint8_t log_ring[SD_LOG_BUFFER_SIZE];
+  static uint16_t log_head, log_tail;
+  static millis_t log_flush_ms;               // Write a partial sector after this
+
+  static uint16_t log_used() { return (log_head - log_tail) & (SD_LOG_BUFFER_SIZE - 1); }
+
+#endif
+
 void CardReader::openLogFile(const char * const path) {
+  #if ENABLED(SD_LOG_BUFFER)
+    log_head = log_tail = 0;
+    log_dropped = 0;
+  #endif
   flag.logging = DISABLED(SDCARD_READONLY);
   IF_DISABLED(SDCARD_READONLY, openFileWrite(path));
 }
@@ -639,6 +1053,8 @@ void announceOpen(const uint8_t doing, const char * const path) {
 void CardReader::openFileRead(const char * const path, const uint8_t subcall_type/*=0*/) {
   if (!isMounted()) return;
 
+  TERN_(SD_STAGING, stageStop()); // Sub-procedures read the source card
+
   switch (subcall_type) {
     case 0:      // Starting a new print. "Now fresh file: ..."
       announceOpen(2, path);
@@ -681,9 +1097,16 @@ void CardReader::openFileRead(const char * const path, const uint8_t subcall_typ
   const char * const fname = diveToFile(true, diveDir, path);
   if (!fname) return;
 
-  if (file.open(diveDir, fname, O_READ)) {
-    filesize = file.fileSize();
+  if (file.open(diveDir, fname, O_READ) && TERN1(SD_COMPRESSED_FILES, gczOpen())) {
+    if (!TERN0(SD_COMPRESSED_FILES, flag.compressed)) filesize = file.fileSize();
     sdpos = 0;
+    TERN_(SD_FLASH_JOB_CACHE, flag.flash_cached = false);
+    TERN_(SD_EXTENT_CACHE, file.cacheExtents());
+    TERN_(SD_JOB_INFO, if (!subcall_type) job_info_start());
+    TERN_(TFT_TOOLPATH_PREVIEW, if (!subcall_type) toolpath.reset());
+    TERN_(LAYER_EVENTS, if (!subcall_type) layer_events.reset());
+    TERN_(PRINT_TIME_ESTIMATE, if (!subcall_type) print_estimate.reset());
+    TERN_(SD_JOB_COMPILE, job_cache.open(diveDir, file));
 
     { // Don't remove this block, as the PORT_REDIRECT is a RAII
       PORT_REDIRECT(SerialMask::All);
@@ -705,7 +1128,7 @@ inline void echo_write_to_file(const char * const fname) {
 //
 // Open a file by DOS path for write
 //
-void CardReader::openFileWrite(const char * const path) {
+void CardReader::openFileWrite(const char * const path OPTARG(SD_WRITE_BUFFER, const uint32_t size/*=0*/)) {
   if (!isMounted()) return;
 
   announceOpen(2, path);
@@ -713,6 +1136,10 @@ void CardReader::openFileWrite(const char * const path) {
 
   abortFilePrintNow();
 
+  #if ENABLED(SD_PRINT_WHILE_UPLOADING)
+    if (flag.growing) { upload.close(); flag.growing = false; }
+  #endif
+
   SdFile *diveDir;
   const char * const fname = diveToFile(false, diveDir, path);
   if (!fname) return;
@@ -721,6 +1148,9 @@ void CardReader::openFileWrite(const char * const path) {
     openFailed(fname);
   #else
     if (file.open(diveDir, fname, O_CREAT | O_APPEND | O_WRITE | O_TRUNC)) {
+      TERN_(SD_DIR_INDEX, flush_dir_index());
+      TERN_(SD_JOB_INFO, job_info_flush());
+      TERN_(SD_WRITE_BUFFER, if (size) file.preAllocate(size));
       flag.saving = true;
       selectFileByName(fname);
       TERN_(EMERGENCY_PARSER, emergency_parser.disable());
@@ -776,6 +1206,8 @@ void CardReader::removeFile(const char * const name) {
     if (file.remove(itsDirPtr, fname)) {
       SERIAL_ECHOLNPGM("File deleted:", fname);
       sdpos = 0;
+      TERN_(SD_DIR_INDEX, flush_dir_index());
+      TERN_(SD_JOB_INFO, job_info_flush());
       TERN_(SDCARD_SORT_ALPHA, presort());
     }
     else
@@ -788,6 +1220,7 @@ void CardReader::report_status() {
     SERIAL_ECHOPGM(STR_SD_PRINTING_BYTE, sdpos);
     SERIAL_CHAR('/');
     SERIAL_ECHOLN(filesize);
+    TERN_(PRINT_TIME_ESTIMATE, print_estimate.report());
   }
   else
     SERIAL_ECHOLNPGM(STR_SD_NOT_PRINTING);
@@ -806,11 +1239,57 @@ void CardReader::write_command(char * const buf) {
   end[1] = '\r';
   end[2] = '\n';
   end[3] = '\0';
+
+  #if ENABLED(SD_LOG_BUFFER)
+    if (flag.logging) {
+      // Copy the line into the ring, or drop it whole if it doesn't fit
+      const uint16_t len = end + 3 - begin, used = log_used();
+      if (len >= SD_LOG_BUFFER_SIZE - used) { log_dropped++; return; }
+      if (!used) log_flush_ms = millis() + 1000UL;
+      const uint16_t part = _MIN(len, SD_LOG_BUFFER_SIZE - log_head);
+      memcpy(&log_ring[log_head], begin, part);
+      memcpy(log_ring, begin + part, len - part);
+      log_head = (log_head + len) & (SD_LOG_BUFFER_SIZE - 1);
+      return;
+    }
+  #endif
+
   file.write(begin);
 
   if (file.writeError) SERIAL_ERROR_MSG(STR_SD_ERR_WRITE_TO_FILE);
 }
 
+#if ENABLED(SD_LOG_BUFFER)
+
+  // Write the oldest n bytes of the ring to the log file
+  void CardReader::log_write(uint16_t n) {
+    file.writeError = false;
+    while (n) {
+      const uint16_t part = _MIN(n, SD_LOG_BUFFER_SIZE - log_tail);
+      file.write(&log_ring[log_tail], part);
+      log_tail = (log_tail + part) & (SD_LOG_BUFFER_SIZE - 1);
+      n -= part;
+    }
+    if (file.writeError) SERIAL_ERROR_MSG(STR_SD_ERR_WRITE_TO_FILE);
+  }
+
+  /**
+   * Write up to the next sector boundary of the log file, so the card only
+   * sees whole-sector writes. A partial sector waits until the log has held
+   * data for a second, so a slow trickle of commands still gets to the card.
+   */
+  void CardReader::log_task() {
+    if (!flag.logging || !flag.saving) return;
+    const uint16_t used = log_used();
+    if (!used) return;
+    const uint16_t room = 512 - (file.curPosition() & 511);
+    if (used < room && PENDING(millis(), log_flush_ms)) return;
+    log_write(_MIN(used, room));
+    if (log_used()) log_flush_ms = millis() + 1000UL;
+  }
+
+#endif
+
 #if DISABLED(NO_SD_AUTOSTART)
   /**
    * Run all the auto#.g files. Called:
@@ -854,10 +1333,150 @@ void CardReader::write_command(char * const buf) {
   }
 #endif
 
+#if ENABLED(SD_JOB_QUEUE)
+
+  char CardReader::job_queue[SD_JOB_QUEUE_SIZE][64 - 8];
+  uint8_t CardReader::job_queue_length; // = 0
+
+  // The head of the next queued file, read near the end of the current print
+  static SdFile job_ahead;
+  static uint32_t job_ahead_pos;              // Bytes of the head read so far
+  static bool job_ahead_done;                 // The head was read, or the file couldn't be opened
+  static char job_ahead_line[24];
+  static uint8_t job_ahead_len;
+  static celsius_t job_ahead_hotend, job_ahead_bed; // The first temperatures the file sets
+
+  static void job_ahead_reset() {
+    if (job_ahead.isOpen()) job_ahead.close();
+    job_ahead_done = false;
+    job_ahead_pos = job_ahead_len = 0;
+    job_ahead_hotend = job_ahead_bed = 0;
+  }
+
+  // Get the first M104/M109 and M140/M190 temperatures
+  static void job_ahead_parse(const char *p) {
+    while (*p == ' ') p++;
+    if (*p != 'M') return;
+    const int code = atoi(p + 1);
+    celsius_t * const t = (code == 104 || code == 109) ? &job_ahead_hotend
+                        : (code == 140 || code == 190) ? &job_ahead_bed
+                        : nullptr;
+    if (!t || *t) return;
+    const char * const v = strstr_P(p, PSTR(" S"));
+    if (v) *t = atoi(v + 2);
+  }
+
+  // Read one block of the next file's head
+  static void job_ahead_read(const char * const path) {
+    if (!job_ahead.isOpen()) {
+      SdFile *diveDir = nullptr;
+      const char * const fname = CardReader::diveToFile(false, diveDir, path);
+      if (!fname || !job_ahead.open(diveDir, fname, O_READ)) {
+        openFailed(path);
+        job_ahead_done = true;
+        return;
+      }
+    }
+
+    uint8_t buf[512];
+    const int16_t n = job_ahead.read(buf, sizeof(buf));
+    LOOP_L_N(i, n) {
+      const char c = buf[i];
+      if (c == '\n' || c == '\r') {
+        job_ahead_line[job_ahead_len] = '\0';
+        job_ahead_parse(job_ahead_line);
+        job_ahead_len = 0;
+      }
+      else if (job_ahead_len < sizeof(job_ahead_line) - 1)
+        job_ahead_line[job_ahead_len++] = c;
+    }
+    job_ahead_pos += _MAX(n, int16_t(0));
+
+    if (n <= 0 || job_ahead_pos >= uint32_t(SD_JOB_QUEUE_HEAD) || (job_ahead_hotend && job_ahead_bed)) {
+      job_ahead.close();
+      job_ahead_done = true;
+    }
+  }
+
+  // Add a file to the queue. The path is taken from the root folder, as the queue starts each file there.
+  bool CardReader::job_queue_add(const char * const path) {
+    char * const entry = job_queue[_MIN(job_queue_length, SD_JOB_QUEUE_SIZE - 1)];
+    const bool slash = path[0] == '/';
+    if (job_queue_length >= SD_JOB_QUEUE_SIZE)
+      SERIAL_ECHO_MSG("!Job queue full.");
+    else if (strlen(path) + !slash >= sizeof(job_queue[0]))
+      SERIAL_ECHO_MSG("!Path too long.");
+    else {
+      entry[0] = '/';
+      strcpy(entry + !slash, path);
+      if (fileExists(entry)) { job_queue_length++; return true; }
+      openFailed(entry);
+    }
+    return false;
+  }
+
+  void CardReader::job_queue_clear() {
+    job_queue_length = 0;
+    job_ahead_reset();
+  }
+
+  void CardReader::job_queue_report() {
+    SERIAL_ECHOLNPGM("Job queue: ", job_queue_length);
+    LOOP_L_N(i, job_queue_length) SERIAL_ECHOLNPGM(" ", i + 1, ": ", job_queue[i]);
+  }
+
+  //
+  // Read ahead into the next file once the print is close to its end.
+  // Called from idle().
+  //
+  void CardReader::job_queue_task() {
+    if (!job_queue_length || job_ahead_done || !isPrinting() || !isFileOpen()) return;
+    if (TERN0(HAS_SD_HOST_DRIVE, host_is_writing())) return;
+    if (getFileSize() - getIndex() > uint32_t(SD_JOB_QUEUE_AHEAD)) return;
+    job_ahead_read(job_queue[0]);
+  }
+
+  /**
+   * Start the next queued file, like the next auto#.g file. Called by M1001
+   * after the end of the previous print. With SD_JOB_QUEUE_PREHEAT the heaters
+   * are set to the next file's first temperatures before its start G-code
+   * runs, so the bed and hotend heat together even if it waits for each.
+   */
+  bool CardReader::job_queue_next() {
+    if (!job_queue_length || !isMounted()) return false;
+
+    char path[sizeof(job_queue[0])];
+    strcpy(path, job_queue[0]);
+
+    #if ENABLED(SD_JOB_QUEUE_PREHEAT)
+      while (!job_ahead_done) job_ahead_read(path); // A short print may have ended first
+      if (job_ahead_hotend) thermalManager.setTargetHotend(job_ahead_hotend, active_extruder);
+      TERN_(HAS_HEATED_BED, if (job_ahead_bed) thermalManager.setTargetBed(job_ahead_bed));
+    #endif
+    job_ahead_reset();
+
+    if (--job_queue_length) memmove(job_queue[0], job_queue[1], job_queue_length * sizeof(job_queue[0]));
+
+    cdroot();
+    openAndPrintFile(path);
+    return true;
+  }
+
+#endif // SD_JOB_QUEUE
+
 void CardReader::closefile(const bool store_location/*=false*/) {
+  #if ENABLED(SD_LOG_BUFFER)
+    if (flag.logging) {
+      log_write(log_used());
+      if (log_dropped) SERIAL_ECHOLNPGM("Log lines dropped: ", log_dropped);
+    }
+  #endif
   file.sync();
   file.close();
+  TERN_(SD_JOB_COMPILE, job_cache.close());
   flag.saving = flag.logging = false;
+  TERN_(SD_FLASH_JOB_CACHE, flag.flash_cached = false);
+  TERN_(SD_COMPRESSED_FILES, flag.compressed = false);
   sdpos = 0;
   TERN_(EMERGENCY_PARSER, emergency_parser.enable());
 
@@ -867,6 +1486,318 @@ void CardReader::closefile(const bool store_location/*=false*/) {
   }
 }
 
+#if ENABLED(SD_FLASH_JOB_CACHE)
+
+  //
+  // Copy the open file to SPI flash and read it back to check it.
+  // On success the print reads from flash and no more from the card.
+  //
+  bool CardReader::cacheToFlash() {
+    if (filesize > SD_FLASH_CACHE_SIZE) {
+      SERIAL_ECHO_MSG("Too big for the flash cache. Printing from media.");
+      return false;
+    }
+
+    SERIAL_ECHO_MSG("Caching to flash...");
+    ui.set_status(F("Caching to flash..."));
+
+    W25QXX.init(SPI_QUARTER_SPEED);
+    const uint32_t resume_index = sdpos;
+    file.seekSet(0);
+
+    uint8_t buf[sizeof(flash_page)];
+    bool ok = true;
+    for (uint32_t index = 0; ok && index < filesize; index += sizeof(buf)) {
+      const uint32_t addr = SD_FLASH_CACHE_ADDR + index;
+      if (!(index % 0x10000)) W25QXX.SPI_FLASH_BlockErase(addr);
+      if (!(index % SPI_FLASH_SectorSize)) {
+        idle();
+        if (flag.abort_sd_printing) ok = false;
+      }
+      const uint16_t n = _MIN(filesize - index, uint32_t(sizeof(buf)));
+      if (ok) ok = file.read(buf, n) == int16_t(n);
+      if (ok) {
+        W25QXX.SPI_FLASH_PageWrite(buf, addr, n);
+        W25QXX.SPI_FLASH_BufferRead(flash_page, addr, n);
+        ok = !memcmp(buf, flash_page, n);
+      }
+    }
+
+    flash_page_index = UINT32_MAX;
+    setIndex(resume_index);
+    ui.set_status(longFilename[0] ? longFilename : filename);
+
+    if (!ok) {
+      SERIAL_ERROR_MSG("Flash cache failed. Printing from media.");
+      return false;
+    }
+    flag.flash_cached = true;
+    return true;
+  }
+
+  int16_t CardReader::flashGet() {
+    if (sdpos >= filesize) return -1;
+    const uint32_t page = sdpos & ~uint32_t(sizeof(flash_page) - 1);
+    if (page != flash_page_index) {
+      W25QXX.SPI_FLASH_BufferRead(flash_page, SD_FLASH_CACHE_ADDR + page, sizeof(flash_page));
+      flash_page_index = page;
+    }
+    return flash_page[sdpos++ - page];
+  }
+
+#endif // SD_FLASH_JOB_CACHE
+
+#if ENABLED(SD_STAGING)
+
+  DiskIODriver_SDIO CardReader::media_driver_stage;
+  SdVolume CardReader::stage_volume;
+  SdFile CardReader::stage_root, CardReader::stage_src;
+
+  //
+  // Start copying the open file to the SDIO card and print the copy once
+  // SD_STAGE_START_KB has been copied, reading more as stage_task adds it.
+  // With no usable SDIO card the file prints from the source card.
+  //
+  bool CardReader::stageFile() {
+    if (!stageMount()) {
+      SERIAL_ECHO_MSG("No SDIO card to stage on. Printing from media.");
+      return false;
+    }
+
+    if (!upload.open(&stage_root, SD_STAGE_FILENAME, O_CREAT | O_APPEND | O_WRITE | O_TRUNC)) {
+      stage_root.close();             // Mount again next time
+      SERIAL_ECHO_MSG("Staging failed. Printing from media.");
+      return false;
+    }
+
+    SERIAL_ECHO_MSG("Staging to SDIO...");
+    TERN_(SD_WRITE_BUFFER, upload.preAllocate(filesize));
+
+    // Read the source from here on. 'file' goes back to it if staging fails.
+    stage_src = file;
+    file.close();
+    flag.staged = flag.growing = true;
+
+    for (uint32_t n = 0; n < SD_STAGE_START_KB * 2UL && stage_src.curPosition() < filesize; n += SD_STAGE_BLOCKS) {
+      if (!stageCopy(SD_STAGE_BLOCKS)) return false;
+      idle();
+      if (flag.abort_sd_printing) { stageStop(true); return false; }
+    }
+
+    // Print the copy, reading as far as it has been written
+    file = upload;
+    file.splitWriter(upload);
+    filesize = file.fileSize();
+    if (stage_src.curPosition() >= stage_src.fileSize()) {
+      stage_src.close();
+      closeUpload();
+    }
+    return true;
+  }
+
+  //
+  // Append up to the given number of blocks from the source to the copy.
+  // On a failure the print goes back to reading the source card.
+  //
+  bool CardReader::stageCopy(uint16_t blocks) {
+    alignas(4) static uint8_t buf[512];
+    while (blocks--) {
+      const int16_t n = stage_src.read(buf, sizeof(buf));
+      if (n <= 0 || upload.write(buf, n) != n) {
+        if (n == 0) return true;
+        SERIAL_ERROR_MSG("Staging failed. Printing from media.");
+        stageStop(true);
+        return false;
+      }
+    }
+    return true;
+  }
+
+  //
+  // Stop staging. With 'resume_from_source' the open print reads on from the
+  // source card at the same index, otherwise the source file is dropped.
+  //
+  void CardReader::stageStop(const bool resume_from_source/*=false*/) {
+    if (!flag.staged) return;
+    flag.staged = false;
+    if (flag.growing) { upload.close(); flag.growing = false; }
+    if (resume_from_source) {
+      if (file.isOpen()) file.close();
+      file = stage_src;
+      filesize = file.fileSize();
+      setIndex(sdpos);
+    }
+    else
+      stage_src.close();
+  }
+
+  void CardReader::stage_task() {
+    if (!flag.staged || !flag.growing || TERN0(HAS_SD_HOST_DRIVE, host_is_writing())) return;
+
+    static millis_t next_ms; // = 0
+    const millis_t ms = millis();
+    if (PENDING(ms, next_ms)) return;
+    next_ms = ms + SD_STAGE_INTERVAL;
+
+    if (stageCopy(SD_STAGE_BLOCKS) && stage_src.curPosition() >= stage_src.fileSize()) {
+      stage_src.close();
+      closeUpload();                  // The print reads to the end of the copy
+    }
+  }
+
+#endif // SD_STAGING
+
+#if ENABLED(SD_COMPRESSED_FILES)
+
+  //
+  // A compressed file has a header, the file index of each chunk and of the
+  // end of the data, then the chunks. Each chunk codes chunk_size bytes of the
+  // G-code (the last one the rest) with a fresh decoder, so any G-code index
+  // is reached by seeking to its chunk and decoding from there.
+  //
+  typedef struct {
+    char magic[4];                  // "GCZ1"
+    uint32_t size;                  // Bytes of G-code
+    uint16_t chunk_size;            // Bytes of G-code per chunk
+    uint8_t window_bits, lookahead_bits;
+    uint32_t chunk_count;
+  } gcz_header_t;
+
+  static_assert(sizeof(gcz_header_t) == 16, "gcz_header_t must be 16 bytes.");
+
+  //
+  // Check the file just opened for a compressed file header. Return false for
+  // a compressed file that can't be decoded, so it isn't printed as G-code.
+  //
+  bool CardReader::gczOpen() {
+    flag.compressed = false;
+    gcz_header_t h;
+    if (file.read(&h, sizeof(h)) != int16_t(sizeof(h)) || memcmp(h.magic, "GCZ1", 4)) {
+      file.seekSet(0);
+      return true;
+    }
+    if (h.window_bits != HEATSHRINK_STATIC_WINDOW_BITS || h.lookahead_bits != HEATSHRINK_STATIC_LOOKAHEAD_BITS
+      || !h.chunk_size || h.chunk_count != (h.size + h.chunk_size - 1) / h.chunk_size
+    ) {
+      SERIAL_ERROR_MSG("Bad compressed file header. Pack with window ", HEATSHRINK_STATIC_WINDOW_BITS, ", lookahead ", HEATSHRINK_STATIC_LOOKAHEAD_BITS, ".");
+      file.close();
+      return false;
+    }
+    flag.compressed = true;
+    filesize = h.size;
+    gcz.chunk_size = h.chunk_size;
+    gcz.chunk_end = 0;              // The first get() starts the first chunk
+    gcz.out_len = gcz.out_pos = 0;
+    return true;
+  }
+
+  //
+  // Start decoding the chunk that begins at sdpos
+  //
+  bool CardReader::gczStartChunk() {
+    const uint32_t chunk = sdpos / gcz.chunk_size;
+    uint32_t at[2];                 // File index of the chunk and of the next one
+    if (!file.seekSet(sizeof(gcz_header_t) + chunk * sizeof(uint32_t))
+      || file.read(at, sizeof(at)) != int16_t(sizeof(at))
+      || at[1] < at[0] || !file.seekSet(at[0])
+    ) return false;
+    gcz.raw_left = at[1] - at[0];
+    gcz.chunk_end = _MIN((chunk + 1) * gcz.chunk_size, filesize);
+    heatshrink_decoder_reset(&gcz_decoder);
+    return true;
+  }
+
+  //
+  // Decode the next bytes of the chunk, going on to the next chunk at its end
+  //
+  bool CardReader::gczFill() {
+    if (sdpos >= gcz.chunk_end && !gczStartChunk()) return false;
+    for (;;) {
+      size_t n;
+      heatshrink_decoder_poll(&gcz_decoder, gcz.out, _MIN(uint32_t(sizeof(gcz.out)), gcz.chunk_end - sdpos), &n);
+      if (n) {
+        gcz.out_len = n;
+        gcz.out_pos = 0;
+        return true;
+      }
+      if (gcz.raw_left) {
+        // The decoder has taken all its input, so it has room for a full buffer
+        uint8_t in[HEATSHRINK_STATIC_INPUT_BUFFER_SIZE];
+        const int16_t got = file.read(in, _MIN(gcz.raw_left, uint32_t(sizeof(in))));
+        if (got <= 0) return false;
+        gcz.raw_left -= got;
+        heatshrink_decoder_sink(&gcz_decoder, in, got, &n);
+      }
+      else if (heatshrink_decoder_finish(&gcz_decoder) == HSDR_FINISH_DONE)
+        return false;               // The chunk ended short
+    }
+  }
+
+  int16_t CardReader::gczGet() {
+    if (sdpos >= filesize) return -1;
+    if (gcz.out_pos >= gcz.out_len && !gczFill()) {
+      SERIAL_ERROR_MSG("Compressed file is damaged.");
+      flag.abort_sd_printing = true;
+      return -1;
+    }
+    sdpos++;
+    return gcz.out[gcz.out_pos++];
+  }
+
+  //
+  // Decode on to a G-code index ahead in the same chunk,
+  // otherwise decode from the start of the index's chunk.
+  //
+  void CardReader::gczSeek(const uint32_t index) {
+    if (index < sdpos || index >= gcz.chunk_end) {
+      sdpos = index - index % gcz.chunk_size;
+      gcz.chunk_end = sdpos;        // The next get() starts the chunk
+      gcz.out_len = gcz.out_pos = 0;
+    }
+    while (sdpos < index && gczGet() >= 0) { /* nada */ }
+  }
+
+#endif // SD_COMPRESSED_FILES
+
+#if ENABLED(SD_PRINT_WHILE_UPLOADING)
+
+  int16_t CardReader::write(void *buf, uint16_t nbyte) {
+    SdFile &f = writeFile();
+    if (!f.isOpen()) return -1;
+    const int16_t n = f.write(buf, nbyte);
+    if (upload_print_size && flag.saving && f.fileSize() >= upload_print_size) startUploadPrint();
+    return n;
+  }
+
+  //
+  // Give the rest of the upload to a second file and print the file
+  // with what's been written so far, reading more as it arrives.
+  //
+  void CardReader::startUploadPrint() {
+    upload_print_size = 0;
+    file.splitWriter(upload);
+    flag.saving = false;
+    flag.growing = true;
+    filesize = file.fileSize();
+    sdpos = 0;
+    queue.inject_P(M24_STR);
+  }
+
+  //
+  // Finish the upload, letting a print of it read to the end of the file.
+  // An upload that ends before reaching the print size is printed now.
+  //
+  void CardReader::closeUpload() {
+    if (upload_print_size && flag.saving) startUploadPrint();
+    if (!flag.growing) return closefile();
+    upload.close();
+    flag.growing = false;
+    if (file.isOpen()) followUpload();
+    TERN_(EMERGENCY_PARSER, emergency_parser.enable());
+  }
+
+#endif // SD_PRINT_WHILE_UPLOADING
+
 //
 // Get info for a file in the working directory by index
 //
@@ -880,6 +1811,15 @@ void CardReader::selectFileByIndex(const uint16_t nr) {
       return;
     }
   #endif
+  #if ENABLED(SD_DIR_INDEX)
+    if (dir_index_valid() && nr < _MIN(dir_index_count, SD_DIR_INDEX_SIZE)) {
+      // Read from the item's first entry. Skip any hidden file created there since indexing.
+      dir_t p;
+      workDir.seekSet(uint32_t(dir_index[nr]) << 5);
+      while (workDir.readDir(&p, longFilename) > 0)
+        if (is_visible_entity(p)) { createFilename(filename, p); return; }
+    }
+  #endif
   workDir.rewind();
   selectByIndex(workDir, nr);
 }
@@ -903,8 +1843,13 @@ void CardReader::selectFileByName(const char * const match) {
 }
 
 uint16_t CardReader::countFilesInWorkDir() {
-  workDir.rewind();
-  return countItems(workDir);
+  #if ENABLED(SD_DIR_INDEX)
+    if (!dir_index_valid()) indexWorkDir();
+    return dir_index_count;
+  #else
+    workDir.rewind();
+    return countItems(workDir);
+  #endif
 }
 
 /**
@@ -1292,7 +2237,10 @@ uint16_t CardReader::get_num_Files() {
 // Return from procedure or close out the Print Job
 //
 void CardReader::fileHasFinished() {
+  TERN_(SD_JOB_COMPILE_AUTO, job_cache.print_done(file));
+  TERN_(SD_JOB_COMPILE, job_cache.close());
   file.close();
+  TERN_(SD_COMPRESSED_FILES, flag.compressed = false);
   #if HAS_MEDIA_SUBCALLS
     if (file_subcall_ctr > 0) { // Resume calling file after closing procedure
       file_subcall_ctr--;
@@ -1309,6 +2257,133 @@ void CardReader::fileHasFinished() {
   marlin_state = MF_SD_COMPLETE;  // Tell Marlin to enqueue M1001 soon
 }
 
+#if ENABLED(SD_BENCHMARK)
+
+  #define SD_BENCH_BINS 12  // Power-of-2 latency bins, from under 64us to 64ms and longer
+
+  struct SDBenchStats {
+    uint32_t count, total_us, max_us, bins[SD_BENCH_BINS];
+    void add(const uint32_t us) {
+      count++; total_us += us; NOLESS(max_us, us);
+      const uint8_t bin = us < 64 ? 0 : 26 - __builtin_clz(us);
+      bins[_MIN(bin, SD_BENCH_BINS - 1)]++;
+    }
+    // With the bytes moved in elapsed_us, also report the speed
+    void report(FSTR_P const label, const uint32_t bytes=0, const uint32_t elapsed_us=0) const {
+      SERIAL_ECHOF(label);
+      if (!count) { SERIAL_ECHOLNPGM(" failed"); return; }
+      if (elapsed_us) SERIAL_ECHOPGM(" ", uint32_t(uint64_t(bytes) * 1000000UL / 1024 / elapsed_us), "KB/s");
+      SERIAL_ECHOLNPGM(" avg:", total_us / count, "us max:", max_us, "us");
+      SERIAL_ECHOPGM("  us");
+      LOOP_L_N(b, SD_BENCH_BINS) if (bins[b]) {
+        if (b < SD_BENCH_BINS - 1) SERIAL_ECHOPGM(" <", 64UL << b, ":", bins[b]);
+        else                       SERIAL_ECHOPGM(" >=", 32UL << b, ":", bins[b]);
+      }
+      SERIAL_EOL();
+    }
+  };
+
+  /**
+   * Create a contiguous test file and time the driver on its blocks, so the
+   * rest of the card is never written. Heaters are managed between the timed
+   * calls. The device is 0 for the media or 1 for the SD_STAGING card.
+   */
+  void CardReader::benchmark(const uint8_t device, const uint16_t size_kb) {
+    if (isFileOpen()) { SERIAL_ECHO_MSG("Close the open file first."); return; }
+
+    const bool staging = TERN0(SD_STAGING, device == 1);
+    DiskIODriver *drv = driver;
+    SdFile *dir = &root;
+    bool ok = flag.mounted;
+    #if ENABLED(SD_STAGING)
+      if (staging) { drv = &media_driver_stage; dir = &stage_root; ok = stageMount(); }
+    #else
+      UNUSED(device);
+    #endif
+    if (!ok) { SERIAL_ECHO_MSG(STR_NO_MEDIA); return; }
+
+    static const char bench_name[] = "BENCH.BIN";
+    SdFile bench;
+    uint32_t bgn, end;
+    SdBaseFile::remove(dir, bench_name);
+    if (!bench.createContiguous(dir, bench_name, _MAX(size_kb, 64U) * 1024UL) || !bench.contiguousRange(&bgn, &end)) {
+      SERIAL_ECHO_MSG("Can't create ", bench_name);
+      return;
+    }
+    const uint32_t blocks = end - bgn + 1;
+
+    SERIAL_ECHOPGM("SD benchmark, ");
+    SERIAL_ECHOF(staging ? F("staging card") : F("media"));
+    SERIAL_ECHOLNPGM(", ", blocks / 2, "KB");
+    #if ENABLED(SDIO_READ_AHEAD)
+      SERIAL_ECHOLNPGM("SDIO_READ_AHEAD_BLOCKS ", SDIO_READ_AHEAD_BLOCKS);
+    #endif
+
+    alignas(4) uint8_t buf[512];
+    uint32_t errors = 0, seed = 1, t0, t;
+    SDBenchStats st;
+
+    // Time one call, with the heaters managed before it. False if it failed.
+    #define BENCH_TIMED(OP) (thermalManager.task(), t = micros(), (OP) ? (st.add(micros() - t), true) : (errors++, false))
+    #define BENCH_START() do{ st = SDBenchStats(); t0 = micros(); }while(0)
+
+    // Sequential write, each block tagged with its number
+    LOOP_L_N(i, sizeof(buf)) buf[i] = i;
+    BENCH_START();
+    if (drv->writeStart(bgn, blocks)) {
+      for (uint32_t b = bgn; b <= end; ++b) {
+        *(uint32_t*)buf = b;
+        if (!BENCH_TIMED(drv->writeData(buf))) break;
+      }
+      if (!drv->writeStop()) errors++;
+    }
+    st.report(F("Write"), st.count * 512UL, micros() - t0);
+
+    // Sequential multi-block read, checking the tags
+    BENCH_START();
+    if (drv->readStart(bgn)) {
+      for (uint32_t b = bgn; b <= end; ++b) {
+        if (!BENCH_TIMED(drv->readData(buf))) break;
+        if (*(uint32_t*)buf != b) errors++;
+      }
+      if (!drv->readStop()) errors++;
+    }
+    st.report(F("Read"), st.count * 512UL, micros() - t0);
+
+    // Sequential readBlock, as the volume cache reads
+    BENCH_START();
+    for (uint32_t b = bgn; b <= end; ++b) if (!BENCH_TIMED(drv->readBlock(b, buf))) break;
+    st.report(F("readBlock"), st.count * 512UL, micros() - t0);
+
+    // Random single blocks and 4 KB runs
+    auto next_random = [&seed](const uint32_t range) { seed = seed * 1103515245UL + 12345UL; return (seed >> 8) % range; };
+    st = SDBenchStats();
+    LOOP_L_N(n, 256) BENCH_TIMED(drv->readBlock(bgn + next_random(blocks), buf));
+    st.report(F("Random 512B"));
+
+    st = SDBenchStats();
+    LOOP_L_N(n, 128) {
+      const uint32_t b = bgn + next_random(blocks / 8) * 8;
+      BENCH_TIMED(drv->readStart(b) && drv->readData(buf) && drv->readData(buf) && drv->readData(buf) && drv->readData(buf)
+                  && drv->readData(buf) && drv->readData(buf) && drv->readData(buf) && drv->readData(buf) && drv->readStop());
+    }
+    st.report(F("Random 4KB"));
+
+    // Read the file through the volume in small pieces, as a print does
+    bench.close();
+    BENCH_START();
+    if (bench.open(dir, bench_name, O_READ)) {
+      for (int16_t n = 1; n > 0;) if (!BENCH_TIMED((n = bench.read(buf, 64)) >= 0)) break;
+      bench.close();
+    }
+    st.report(F("File read"), blocks * 512UL, micros() - t0);
+
+    SdBaseFile::remove(dir, bench_name);
+    if (errors) SERIAL_ECHOLNPGM("Errors: ", errors);
+  }
+
+#endif // SD_BENCHMARK
+
 #if ENABLED(AUTO_REPORT_SD_STATUS)
   AutoReporter<CardReader::AutoReportSD> CardReader::auto_reporter;
 #endif
@@ -1321,9 +2396,16 @@ void CardReader::fileHasFinished() {
     return exists;
   }
 
-  void CardReader::openJobRecoveryFile(const bool read) {
+  void CardReader::openJobRecoveryFile(const bool read OPTARG(POWER_LOSS_JOURNAL, const bool amend/*=false*/)) {
     if (!isMounted()) return;
     if (recovery.file.isOpen()) return;
+    #if ENABLED(POWER_LOSS_JOURNAL)
+      // Update the existing file in place
+      if (amend) {
+        if (!recovery.file.open(&root, recovery.filename, O_WRITE | O_SYNC)) openFailed(recovery.filename);
+        return;
+      }
+    #endif
     if (!recovery.file.open(&root, recovery.filename, read ? O_READ : O_CREAT | O_WRITE | O_TRUNC | O_SYNC))
       openFailed(recovery.filename);
     else if (!read)
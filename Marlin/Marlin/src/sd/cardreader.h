@@ -59,6 +59,14 @@ extern const char M23_STR[], M24_STR[];
   #include "Sd2Card.h"
 #endif
 
+#if ENABLED(SD_STAGING)
+  #include "Sd2Card_sdio.h"
+#endif
+
+#if ENABLED(SD_COMPRESSED_FILES)
+  #include "../libs/heatshrink/heatshrink_decoder.h"
+#endif
+
 #if ENABLED(MULTI_VOLUME)
   #define SV_SD_ONBOARD      1
   #define SV_USB_FLASH_DRIVE 2
@@ -86,6 +94,18 @@ typedef struct {
        #if ENABLED(BINARY_FILE_TRANSFER)
          , binary_mode:1
        #endif
+       #if ENABLED(SD_PRINT_WHILE_UPLOADING)
+         , growing:1      // The file being printed is still being uploaded
+       #endif
+       #if ENABLED(SD_FLASH_JOB_CACHE)
+         , flash_cached:1 // The file being printed is read from its copy in SPI flash
+       #endif
+       #if ENABLED(SD_STAGING)
+         , staged:1       // The file being printed is read from its copy on the SDIO card
+       #endif
+       #if ENABLED(SD_COMPRESSED_FILES)
+         , compressed:1   // The file being printed is heatshrink coded, read through gczGet
+       #endif
     ;
 } card_flags_t;
 
@@ -93,6 +113,14 @@ typedef struct {
   #include "../libs/autoreport.h"
 #endif
 
+#if ENABLED(TRACE_EVENTS)
+  #include "../feature/trace_events.h"
+#endif
+
+#if ENABLED(INPUT_REPLAY)
+  #include "../feature/input_replay.h"
+#endif
+
 class CardReader {
 public:
   static card_flags_t flag;                         // Flags (above)
@@ -108,6 +136,12 @@ public:
     #endif
   #endif
 
+  #if ENABLED(SD_PRINT_WHILE_UPLOADING)
+    static uint32_t upload_print_size;  // Start printing the upload at this size, if set by 'M28 B1 P'
+    static void closeUpload();
+    static void followUpload()          { file.followWriter(upload); filesize = file.fileSize(); }
+  #endif
+
   // // // Methods // // //
 
   CardReader();
@@ -120,12 +154,31 @@ public:
   static void release();
   static bool isMounted() { return flag.mounted; }
 
+  #if HAS_SD_HOST_DRIVE
+    // Called by the USB drive on each host write. Firmware-side
+    // reads wait until the host has been quiet for a while.
+    #ifndef SD_HOST_WRITE_HOLDOFF
+      #define SD_HOST_WRITE_HOLDOFF 500 // (ms)
+    #endif
+    static volatile millis_t host_write_ms;
+    static void host_wrote() { host_write_ms = _MAX(millis(), 1UL); }
+    static bool host_is_writing() { return host_write_ms && PENDING(millis(), host_write_ms + (SD_HOST_WRITE_HOLDOFF)); }
+  #endif
+
   // Handle media insert/remove
   static void manage_media();
 
   // SD Card Logging
   static void openLogFile(const char * const path);
   static void write_command(char * const buf);
+  #if ENABLED(SD_LOG_BUFFER)
+    static uint32_t log_dropped;    // Lines that didn't fit in the log buffer
+    static void log_task();         // Write the buffered log a sector at a time
+  #endif
+
+  #if ENABLED(SD_STAGING)
+    static void stage_task();       // Copy more of the printing file to the SDIO card
+  #endif
 
   #if DISABLED(NO_SD_AUTOSTART)     // Auto-Start auto#.g file handling
     static uint8_t autofile_index;  // Next auto#.g index to run, plus one. Ignored by autofile_check when zero.
@@ -134,14 +187,51 @@ public:
     static void autofile_cancel() { autofile_index = 0; }
   #endif
 
+  #if ENABLED(SD_JOB_QUEUE)         // Print queued files back to back (M36)
+    static bool job_queue_add(const char * const path);
+    static void job_queue_clear();
+    static void job_queue_report();
+    static bool job_queue_next();   // Start the next queued file. Called by M1001.
+    static void job_queue_task();   // Read ahead into the next file near the end of a print
+    static uint8_t job_queue_count() { return job_queue_length; }
+  #endif
+
   // Basic file ops
   static void openFileRead(const char * const path, const uint8_t subcall=0);
-  static void openFileWrite(const char * const path);
+  static void openFileWrite(const char * const path OPTARG(SD_WRITE_BUFFER, const uint32_t size=0));
   static void closefile(const bool store_location=false);
   static bool fileExists(const char * const name);
   static void removeFile(const char * const name);
 
   static char* longest_filename() { return longFilename[0] ? longFilename : filename; }
+
+  #if ENABLED(SD_JOB_INFO)
+    // Slicer metadata of the file opened for printing. Zero where unknown.
+    typedef struct {
+      uint32_t time;              // Estimated print time (s)
+      uint32_t filament;          // Filament used (mm)
+      uint16_t layers;            // Layer count
+      uint32_t thumbnail;         // Offset of the first "; thumbnail begin" line
+      uint16_t thumbnail_width, thumbnail_height;
+      uint32_t thumbnail_size;    // Encoded size of the thumbnail
+      bool thumbnail_qoi;         // The thumbnail is QOI, preferred over other formats
+    } job_info_t;
+    static job_info_t job_info;
+    static void job_info_task();  // Scan the file in the background
+  #endif
+  #if ENABLED(CANCEL_OBJECTS_SEEK)
+    // The moves that follow "M486 S<n>" for a canceled object
+    typedef struct {
+      uint32_t start, end;        // File offsets of the first line, and past the last
+      float e, f;                 // E position and feedrate after the moves
+      bool has_e, has_f;
+    } skip_range_t;
+    static void skip_scan_task(); // Index the ranges ahead of the print in the background
+    static bool skip_canceled(skip_range_t &range); // Seek past the range that starts here, if indexed
+  #endif
+  #if ANY(TFT_THUMBNAIL, HOTEND_STANDBY_LOOKAHEAD, PRINT_TIME_ESTIMATE)
+    static int16_t job_read(const uint32_t pos, void * const buf, const uint16_t len);
+  #endif
   #if ENABLED(LONG_FILENAME_HOST_SUPPORT)
     static void printLongPath(char * const path);   // Used by M33
   #endif
@@ -217,7 +307,7 @@ public:
 
   #if ENABLED(POWER_LOSS_RECOVERY)
     static bool jobRecoverFileExists();
-    static void openJobRecoveryFile(const bool read);
+    static void openJobRecoveryFile(const bool read OPTARG(POWER_LOSS_JOURNAL, const bool amend=false));
     static void removeJobRecoveryFile();
   #endif
 
@@ -236,14 +326,54 @@ public:
   static bool eof()              { return getIndex() >= getFileSize(); }
 
   // File data operations
-  static int16_t get()                            { int16_t out = (int16_t)file.read(); sdpos = file.curPosition(); return out; }
+  static int16_t get() {
+    #if ENABLED(TRACE_EVENTS)
+      // Only the bytes that begin a block read the card
+      TraceEvents::Scope _trace_scope(TRACE_SD_READ, !(sdpos & 0x1FF));
+    #endif
+    #if ENABLED(INPUT_REPLAY)
+      InputReplay::SDScope _replay_scope(sdpos);  // Record or repeat the slow block reads
+    #endif
+    TERN_(SD_FLASH_JOB_CACHE, if (flag.flash_cached) return flashGet());
+    TERN_(SD_COMPRESSED_FILES, if (flag.compressed) return gczGet());
+    int16_t out = (int16_t)file.read(); sdpos = file.curPosition(); return out;
+  }
   static int16_t read(void *buf, uint16_t nbyte)  { return file.isOpen() ? file.read(buf, nbyte) : -1; }
-  static int16_t write(void *buf, uint16_t nbyte) { return file.isOpen() ? file.write(buf, nbyte) : -1; }
-  static void setIndex(const uint32_t index)      { file.seekSet((sdpos = index)); }
+  #if ENABLED(SD_LINE_SPANS)
+    // The bytes at sdpos to the end of their block, in place. Take them with skip().
+    static const char* span(uint16_t &size) {
+      #if ENABLED(TRACE_EVENTS)
+        TraceEvents::Scope _trace_scope(TRACE_SD_READ, !(sdpos & 0x1FF));
+      #endif
+      #if ENABLED(INPUT_REPLAY)
+        InputReplay::SDScope _replay_scope(sdpos);
+      #endif
+      if (TERN0(SD_FLASH_JOB_CACHE, flag.flash_cached) || TERN0(SD_COMPRESSED_FILES, flag.compressed)) return nullptr;
+      return (const char*)file.readSpan(size);
+    }
+    static void skip(const uint16_t n) { file.readSkip(n); sdpos += n; }
+  #endif
+  #if ENABLED(SD_PRINT_WHILE_UPLOADING)
+    static int16_t write(void *buf, uint16_t nbyte);
+  #else
+    static int16_t write(void *buf, uint16_t nbyte) { return file.isOpen() ? file.write(buf, nbyte) : -1; }
+  #endif
+  #if ENABLED(SD_WRITE_BUFFER)
+    // Space to receive the next data for the open file in place. Commit it with write().
+    static uint8_t* writeSpace(uint16_t &size) { SdFile &f = writeFile(); return f.isOpen() ? f.writeSpace(size) : nullptr; }
+  #endif
+  static void setIndex(const uint32_t index) {
+    TERN_(SD_COMPRESSED_FILES, if (flag.compressed) return gczSeek(index));
+    file.seekSet((sdpos = index));
+  }
 
   // TODO: rename to diskIODriver()
   static DiskIODriver* diskIODriver() { return driver; }
 
+  #if ENABLED(SD_BENCHMARK)
+    static void benchmark(const uint8_t device, const uint16_t size_kb);
+  #endif
+
   #if ENABLED(AUTO_REPORT_SD_STATUS)
     //
     // SD Auto Reporting
@@ -325,10 +455,83 @@ private:
 
   #endif // SDCARD_SORT_ALPHA
 
+  //
+  // Directory entry index of each item in the working directory
+  //
+  #if ENABLED(SD_JOB_QUEUE)
+    // Paths must fit "M23 <path>\nM24" in queue.injected_commands
+    static char job_queue[SD_JOB_QUEUE_SIZE][64 - 8];
+    static uint8_t job_queue_length;
+  #endif
+
+  #if ENABLED(SD_LOG_BUFFER)
+    static void log_write(uint16_t n);
+  #endif
+
+  #if ENABLED(SD_JOB_INFO)
+    typedef struct { uint32_t cluster, size; job_info_t info; } job_info_entry_t;
+    static job_info_entry_t job_info_cache[SD_JOB_INFO_CACHE];
+    static uint8_t job_info_next;
+    static void job_info_start();
+    static void job_info_flush();
+    static void job_info_parse(char * const line, const uint32_t pos);
+  #endif
+
+  #if ENABLED(SD_DIR_INDEX)
+    static uint16_t dir_index[SD_DIR_INDEX_SIZE];
+    static uint16_t dir_index_count;    // Items in the indexed directory, or 0xFFFF for none
+    static uint32_t dir_index_cluster;  // First cluster of the indexed directory
+    static bool dir_index_valid() { return dir_index_count != 0xFFFF && dir_index_cluster == workDir.firstCluster(); }
+    static void flush_dir_index() { dir_index_count = 0xFFFF; }
+    static void indexWorkDir();
+  #endif
+
   static DiskIODriver *driver;
   static SdVolume volume;
   static SdFile file;
 
+  #if ENABLED(SD_PRINT_WHILE_UPLOADING)
+    static SdFile upload;               // Appends to the file while 'file' reads it for printing
+    static void startUploadPrint();
+  #endif
+  static SdFile& writeFile() { return TERN(SD_PRINT_WHILE_UPLOADING, flag.growing ? upload : file, file); }
+
+  #if ENABLED(SD_FLASH_JOB_CACHE)
+    static uint8_t flash_page[256];     // One SPI flash page of the cached file
+    static uint32_t flash_page_index;   // File index of flash_page, or UINT32_MAX
+    static bool cacheToFlash();
+    static int16_t flashGet();
+  #endif
+
+  #if ENABLED(SD_STAGING)
+    static DiskIODriver_SDIO media_driver_stage;  // The SDIO card that holds the copy
+    static SdVolume stage_volume;
+    static SdFile stage_root, stage_src;          // Root of the SDIO card, file being copied
+    static bool stageMount() {
+      return stage_root.isOpen() || (media_driver_stage.init() && stage_volume.init(&media_driver_stage) && stage_root.openRoot(&stage_volume));
+    }
+    static bool stageFile();
+    static bool stageCopy(uint16_t blocks);
+    static void stageStop(const bool resume_from_source=false);
+  #endif
+
+  #if ENABLED(SD_COMPRESSED_FILES)
+    typedef struct {
+      uint32_t chunk_end,               // G-code index where the chunk being decoded ends
+               raw_left;                // Coded bytes of the chunk not yet sunk into the decoder
+      uint16_t chunk_size;              // G-code bytes per chunk, from the file header
+      uint8_t out_len, out_pos,         // Decoded bytes in 'out', and the next to get
+              out[64];
+    } gcz_state_t;
+    static gcz_state_t gcz;
+    static heatshrink_decoder gcz_decoder;
+    static bool gczOpen();
+    static bool gczStartChunk();
+    static bool gczFill();
+    static int16_t gczGet();
+    static void gczSeek(const uint32_t index);
+  #endif
+
   static uint32_t filesize, // Total size of the current file, in bytes
                   sdpos;    // Index most recently read (one behind file.getPos)
 
@@ -59,6 +59,26 @@ public:
   virtual bool readBlock(uint32_t block, uint8_t* dst) = 0;
   virtual bool writeBlock(uint32_t blockNumber, const uint8_t* src) = 0;
 
+  /**
+   * Read consecutive blocks. Drivers that can do this in one transfer
+   * should override this default, which goes through readStart/readData.
+   */
+  virtual bool readBlocks(uint32_t block, uint8_t* dst, const uint8_t count) {
+    if (!readStart(block)) return false;
+    for (uint8_t i = 0; i < count; ++i, dst += 512) if (!readData(dst)) return false;
+    return readStop();
+  }
+
+  /**
+   * Write consecutive blocks. Drivers that can do this in one transfer
+   * should override this default, which goes through writeStart/writeData.
+   */
+  virtual bool writeBlocks(uint32_t block, const uint8_t* src, const uint8_t count) {
+    if (!writeStart(block, count)) return false;
+    for (uint8_t i = 0; i < count; ++i, src += 512) if (!writeData(src)) return false;
+    return writeStop();
+  }
+
   virtual uint32_t cardSize() = 0;
 
   virtual bool isReady() = 0;
@@ -0,0 +1,9 @@
+#
+# lvgl_mem_wrap.py
+# Added by LVGL_MEM_POOL to send LVGL's allocations through lv_mem_pool.cpp
+#
+import pioutil
+if pioutil.is_pio_build():
+	Import("env")
+	funcs = ("lv_mem_alloc", "lv_mem_free", "lv_mem_realloc", "lv_mem_get_size")
+	env.Append(LINKFLAGS=["-Wl," + ",".join("--wrap=" + f for f in funcs)])
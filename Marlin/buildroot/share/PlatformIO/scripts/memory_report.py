@@ -0,0 +1,44 @@
+#
+# memory_report.py
+# Added by MEMORY_BUDGET to list the largest RAM symbols after linking
+#
+import pioutil
+if pioutil.is_pio_build():
+	Import("env")
+	import subprocess
+	from os.path import join
+
+	mf = env.get("MARLIN_FEATURES", {})
+	count = int(mf.get("MEMORY_REPORT_SYMBOLS", "20"))
+
+	# Sizes of the .data and .bss symbols, biggest first
+	def memory_report(source, target, env):
+		nm = env.subst("$CC").replace("gcc", "nm")
+		elf = target[0].path
+		try:
+			out = subprocess.check_output([nm, "--size-sort", "--reverse-sort", "--print-size", "--demangle", elf]).decode()
+		except Exception as e:
+			print("Memory report: can't run %s (%s)" % (nm, e))
+			return
+
+		syms = []
+		for line in out.splitlines():
+			f = line.split(None, 3)
+			if len(f) == 4 and f[2] in "bBdD":
+				syms.append((int(f[1], 16), f[3]))
+
+		print("RAM %d bytes in %d symbols. Largest:" % (sum(s[0] for s in syms), len(syms)))
+		for size, name in syms[:count]:
+			print("%8d  %s" % (size, name))
+
+		# The planner buffer holds BLOCK_BUFFER_SIZE blocks
+		try:
+			blocks = int(mf.get("BLOCK_BUFFER_SIZE", "0"), 0)
+		except ValueError:
+			blocks = 0
+		for size, name in syms:
+			if blocks and name == "Planner::block_buffer":
+				print("Planner block_t %d bytes (%d blocks)" % (size // blocks, blocks))
+
+	if count > 0:
+		env.AddPostAction(join("$BUILD_DIR", "${PROGNAME}.elf"), memory_report)
@@ -0,0 +1,54 @@
+#
+# opt_profile.py
+# Compile listed sources at their own optimization level
+#
+#  custom_opt_speed       = Source patterns built for speed
+#  custom_opt_speed_flags = Flags for them (default -O3)
+#  custom_opt_size        = Source patterns built for size
+#  custom_opt_size_flags  = Flags for them (default -Os)
+#
+# Patterns are relative to Marlin/src. After linking the text size of each
+# group is listed so the flash cost of the fast code can be seen.
+#
+import pioutil
+if pioutil.is_pio_build():
+	Import("env")
+	import subprocess
+	from os.path import join
+
+	groups = []
+	for name, dflt in (("speed", "-O3"), ("size", "-Os")):
+		pats = env.GetProjectOption("custom_opt_" + name, "").split()
+		flags = env.GetProjectOption("custom_opt_%s_flags" % name, dflt).split()
+		if pats: groups.append((name, pats, flags, []))
+
+	def add_group(name, pats, flags, objs):
+		def middleware(env, node):
+			# Drop the env level -O so the group flags are the only ones
+			ccflags = [f for f in env["CCFLAGS"] if not f.startswith("-O")] + flags
+			obj = env.Object(node, CCFLAGS=ccflags)
+			objs.extend(obj)
+			return obj
+		for p in pats:
+			env.AddBuildMiddleware(middleware, "*Marlin/src/" + p)
+
+	for g in groups: add_group(*g)
+
+	# Text and data of each group's objects, to weigh against the speedup
+	def opt_report(source, target, env):
+		size = env.subst("$CC").replace("gcc", "size")
+		for name, pats, flags, objs in groups:
+			if not objs: continue
+			try:
+				out = subprocess.check_output([size] + [o.path for o in objs]).decode()
+			except Exception as e:
+				print("Optimization report: can't run %s (%s)" % (size, e))
+				return
+			text = data = 0
+			for line in out.splitlines()[1:]:
+				f = line.split()
+				text += int(f[0]); data += int(f[1])
+			print("%s (%s): %d files, text %d, data %d" % (name, " ".join(flags), len(objs), text, data))
+
+	if groups:
+		env.AddPostAction(join("$BUILD_DIR", "${PROGNAME}.elf"), opt_report)
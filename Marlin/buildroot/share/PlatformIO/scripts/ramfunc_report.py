@@ -0,0 +1,33 @@
+#
+# ramfunc_report.py
+# Added by ISR_CODE_IN_RAM to list the functions that run from RAM after linking
+#
+import pioutil
+if pioutil.is_pio_build():
+	Import("env")
+	import subprocess
+	from os.path import join
+
+	# Code symbols with an SRAM address were placed in .RamFunc
+	def ramfunc_report(source, target, env):
+		nm = env.subst("$CC").replace("gcc", "nm")
+		elf = target[0].path
+		try:
+			out = subprocess.check_output([nm, "--size-sort", "--reverse-sort", "--print-size", "--demangle", elf]).decode()
+		except Exception as e:
+			print("RAM function report: can't run %s (%s)" % (nm, e))
+			return
+
+		funcs = []
+		for line in out.splitlines():
+			f = line.split(None, 3)
+			if len(f) == 4 and f[2] in "tTwW" and 0x20000000 <= int(f[0], 16) < 0x30000000:
+				funcs.append((int(f[1], 16), f[3]))
+
+		print("Hot ISR code in RAM: %d bytes in %d functions" % (sum(s[0] for s in funcs), len(funcs)))
+		for size, name in funcs:
+			print("%8d  %s" % (size, name))
+		if not funcs:
+			print("No functions in RAM. Does the linker script put .RamFunc in .data?")
+
+	env.AddPostAction(join("$BUILD_DIR", "${PROGNAME}.elf"), ramfunc_report)
@@ -0,0 +1,152 @@
+#!/usr/bin/env python3
+#
+# ff_bench.py
+# Replay G-code files through a Linux build of the FlashForge configuration.
+# Build and run with buildroot/bin/ff_bench, which applies the bench options.
+#
+#   ff_bench.py <program> <file.gcode>... [--reference DIR] [--save-reference DIR]
+#
+# Each file is streamed with "ok" flow control, then the firmware reports:
+#   lines/s    Lines received per second (M576 L)
+#   parse/s    Lines the parser could take per second, from its cycle cost (M576 C)
+#   blocks/s   Planner blocks per second (M576 N)
+# The first STEP_CAPTURE_SIZE step events of each file (D207) are compared to a
+# saved reference run: the largest and RMS position difference in steps over
+# 1ms windows. Save references from a known good build with --save-reference.
+#
+import argparse, os, re, subprocess, sys, threading, time, queue
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import stepcap
+
+F_CPU = 100000000  # Linux HAL
+
+class Firmware:
+	def __init__(self, program):
+		program = os.path.abspath(program)
+		self.proc = subprocess.Popen([program], stdin=subprocess.PIPE, stdout=subprocess.PIPE, cwd=os.path.dirname(program))
+		self.lines, self.raw = queue.Queue(), queue.Queue()
+		self.capture = None
+		threading.Thread(target=self.reader, daemon=True).start()
+
+	def reader(self):
+		buf = b""
+		while True:
+			chunk = self.proc.stdout.read1(65536)
+			if not chunk: break
+			buf += chunk
+			if self.capture is not None:
+				# Hand the whole dump over once its footer arrives
+				if b"stepcap:end" in buf:
+					end = buf.index(b"stepcap:end") + len(b"stepcap:end")
+					self.raw.put(buf[:end]); buf = buf[end:]
+					self.capture = None
+				continue
+			while b"\n" in buf:
+				line, buf = buf.split(b"\n", 1)
+				if line.startswith(b"stepcap:begin"):
+					self.capture = True
+					buf = line + b"\n" + buf
+					break
+				self.lines.put(line.decode(errors="replace").strip())
+
+	def send(self, line):
+		self.proc.stdin.write((line + "\n").encode())
+		self.proc.stdin.flush()
+
+	def wait_for(self, pattern, timeout=60):
+		end = time.time() + timeout
+		while time.time() < end:
+			try:
+				line = self.lines.get(timeout=end - time.time())
+			except queue.Empty:
+				break
+			m = re.search(pattern, line)
+			if m: return m
+		sys.exit("Timed out waiting for %r" % pattern)
+
+	def command(self, line):
+		self.send(line)
+		self.wait_for(r"^ok")
+
+	def stop(self):
+		self.proc.kill()
+
+def gcode_lines(path):
+	for line in open(path, errors="replace"):
+		line = line.split(";", 1)[0].strip()
+		if line: yield line
+
+def replay(fw, path, inflight=4):
+	fw.command("M576")        # Start a new statistics period
+	fw.command("D207 S")      # Capture from the first step
+	sent = acked = 0
+	start = time.time()
+	for line in gcode_lines(path):
+		fw.send(line); sent += 1
+		while sent - acked >= inflight:
+			fw.wait_for(r"^ok"); acked += 1
+	while acked < sent:
+		fw.wait_for(r"^ok"); acked += 1
+	fw.command("M400")
+	secs = time.time() - start
+
+	fw.send("M576")
+	m = fw.wait_for(r"M576 P0 B(\d+) L(\d+).* C(\d+)/(\d+) T\S+ N(\d+)")
+	fw.wait_for(r"^ok")
+	fw.send("D207 D")
+	dump = fw.raw.get(timeout=60)
+	fw.wait_for(r"^ok")
+
+	cycles = int(m.group(3))
+	return {
+		"lines": sent, "seconds": secs,
+		"lines/s": int(m.group(2)),
+		"parse/s": F_CPU // cycles if cycles else 0,
+		"blocks/s": int(m.group(5)),
+	}, dump
+
+def deviation(dump, ref):
+	rate, axes, run = stepcap.read_dump(dump)
+	_, _, base = stepcap.read_dump(ref)
+	a, b = stepcap.motion(rate, axes, run, 1), stepcap.motion(rate, axes, base, 1)
+	n = min(len(a), len(b))
+	if not n: return 0, 0.0
+	diffs = [abs(a[i][1][x] - b[i][1][x]) for i in range(n) for x in range(len(axes))]
+	return max(diffs), (sum(d * d for d in diffs) / len(diffs)) ** 0.5
+
+def main():
+	ap = argparse.ArgumentParser(description="Benchmark G-code replay on the Linux build")
+	ap.add_argument("program")
+	ap.add_argument("gcode", nargs="+")
+	ap.add_argument("--reference", help="folder with reference step dumps")
+	ap.add_argument("--save-reference", help="save the step dumps to this folder")
+	args = ap.parse_args()
+
+	fw = Firmware(args.program)
+	fw.wait_for(r"^start|Initialized")
+	time.sleep(1)
+	fw.command("M111 S0")
+	fw.command("G28")
+
+	for path in args.gcode:
+		name = os.path.basename(path)
+		stats, dump = replay(fw, path)
+		out = "%-24s %6d lines %7.2fs  lines/s:%d parse/s:%d blocks/s:%d" % (
+			name, stats["lines"], stats["seconds"], stats["lines/s"], stats["parse/s"], stats["blocks/s"])
+		if args.reference:
+			ref = os.path.join(args.reference, name + ".stepcap")
+			if os.path.exists(ref):
+				worst, rms = deviation(dump, open(ref, "rb").read())
+				out += "  deviation max:%d rms:%.2f steps" % (worst, rms)
+			else:
+				out += "  (no reference)"
+		if args.save_reference:
+			os.makedirs(args.save_reference, exist_ok=True)
+			open(os.path.join(args.save_reference, name + ".stepcap"), "wb").write(dump)
+		print(out)
+
+	fw.stop()
+
+if __name__ == "__main__":
+	main()
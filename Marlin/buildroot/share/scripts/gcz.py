@@ -0,0 +1,115 @@
+#!/usr/bin/env python3
+#
+# gcz.py
+# Pack a G-code file for SD_COMPRESSED_FILES, or unpack one to check it
+#
+#   gcz.py part.gcode [-o PART.GCZ] [-c 4096]
+#   gcz.py -d PART.GCZ [-o part.gcode]
+#
+# The G-code is heatshrink coded in chunks of -c bytes, each with a fresh
+# coder, so the printer can seek by decoding from the start of a chunk.
+# The window and lookahead match the firmware's heatshrink_config.h.
+#
+import argparse, os, struct, sys
+
+WINDOW_BITS, LOOKAHEAD_BITS = 8, 4
+HEADER = struct.Struct("<4sIHBBI")
+
+class BitWriter:
+	def __init__(self):
+		self.out, self.acc, self.bits = bytearray(), 0, 0
+
+	def put(self, value, count):
+		self.acc = (self.acc << count) | value
+		self.bits += count
+		while self.bits >= 8:
+			self.bits -= 8
+			self.out.append((self.acc >> self.bits) & 0xFF)
+		self.acc &= (1 << self.bits) - 1
+
+	def finish(self):
+		if self.bits: self.out.append((self.acc << (8 - self.bits)) & 0xFF)
+		return bytes(self.out)
+
+def encode(data):
+	window, lookahead = 1 << WINDOW_BITS, 1 << LOOKAHEAD_BITS
+	bw, i = BitWriter(), 0
+	while i < len(data):
+		# Longest match that starts in the window. It may run on into the bytes it makes.
+		best_len, best_pos, start = 0, 0, max(0, i - window)
+		for n in range(2, min(lookahead, len(data) - i) + 1):
+			pos = data.rfind(data[i:i + n], start, i - 1 + n)
+			if pos < 0: break
+			best_len, best_pos = n, pos
+		if best_len >= 2:
+			bw.put(0, 1)
+			bw.put(i - best_pos - 1, WINDOW_BITS)
+			bw.put(best_len - 1, LOOKAHEAD_BITS)
+			i += best_len
+		else:
+			bw.put(1, 1)
+			bw.put(data[i], 8)
+			i += 1
+	return bw.finish()
+
+def decode(data, size):
+	window, out, pos, bit = 1 << WINDOW_BITS, bytearray(), 0, 0
+	def get(count):
+		nonlocal pos, bit
+		v = 0
+		for _ in range(count):
+			v = (v << 1) | ((data[pos] >> (7 - bit)) & 1)
+			bit += 1
+			if bit == 8: pos, bit = pos + 1, 0
+		return v
+	while len(out) < size:
+		if get(1):
+			out.append(get(8))
+		else:
+			back, count = get(WINDOW_BITS) + 1, get(LOOKAHEAD_BITS) + 1
+			if back > min(len(out), window): sys.exit("Bad back-reference at %d" % len(out))
+			for _ in range(count): out.append(out[-back])
+	return bytes(out[:size])
+
+def pack(gcode, chunk_size):
+	chunks = [encode(gcode[i:i + chunk_size]) for i in range(0, len(gcode), chunk_size)]
+	at = HEADER.size + 4 * (len(chunks) + 1)
+	index = []
+	for c in chunks:
+		index.append(at)
+		at += len(c)
+	index.append(at)
+	head = HEADER.pack(b"GCZ1", len(gcode), chunk_size, WINDOW_BITS, LOOKAHEAD_BITS, len(chunks))
+	return head + struct.pack("<%dI" % len(index), *index) + b"".join(chunks)
+
+def unpack(packed):
+	magic, size, chunk_size, wbits, lbits, count = HEADER.unpack_from(packed)
+	if magic != b"GCZ1": sys.exit("Not a compressed G-code file")
+	if (wbits, lbits) != (WINDOW_BITS, LOOKAHEAD_BITS): sys.exit("Packed with window %d, lookahead %d" % (wbits, lbits))
+	index = struct.unpack_from("<%dI" % (count + 1), packed, HEADER.size)
+	out = b""
+	for c in range(count):
+		out += decode(packed[index[c]:index[c + 1]], min(chunk_size, size - c * chunk_size))
+	return out
+
+def main():
+	ap = argparse.ArgumentParser(description="Pack G-code for SD_COMPRESSED_FILES")
+	ap.add_argument("file")
+	ap.add_argument("-o", "--output", help="Output file (default: the input with .gcz or .gcode)")
+	ap.add_argument("-c", "--chunk", type=int, default=4096, help="G-code bytes per chunk (default 4096)")
+	ap.add_argument("-d", "--decode", action="store_true", help="Unpack a compressed file")
+	args = ap.parse_args()
+	if not 256 <= args.chunk <= 65535: sys.exit("The chunk size must be from 256 to 65535")
+
+	data = open(args.file, "rb").read()
+	base = os.path.splitext(args.file)[0]
+	if args.decode:
+		out, name = unpack(data), args.output or base + ".gcode"
+	else:
+		out, name = pack(data, args.chunk), args.output or base + ".gcz"
+		if unpack(out) != data: sys.exit("The packed file doesn't unpack to the input")
+	open(name, "wb").write(out)
+	print("%s: %d bytes -> %s: %d bytes (%.1f%%)" % (args.file, len(data), name, len(out), 100.0 * len(out) / max(1, len(data))))
+
+if __name__ == "__main__":
+	main()
@@ -0,0 +1,118 @@
+#!/usr/bin/env python3
+#
+# Marlin 3D Printer Firmware
+# Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+#
+# Based on Sprinter and grbl.
+# Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <https://www.gnu.org/licenses/>.
+#
+
+# Convert a 16 bit Marlin TFT image to the HIGHCOLOR_RLE format used with TFT_IMAGE_RLE
+#
+# Each row is a list of 16 bit codes:
+#   0x8000 | N, color   N pixels of one color
+#   N, color * N        N literal pixels
+# Runs never cross rows, so rows above a canvas slice can be skipped quickly.
+
+import sys,re,os
+
+def rle_row(row):
+	out, literal, i = [], [], 0
+	while i < len(row):
+		j = i
+		while j < len(row) and row[j] == row[i] and j - i < 0x7FFF: j += 1
+		if j - i >= 3:
+			if literal: out += [len(literal)] + literal; literal = []
+			out += [0x8000 | (j - i), row[i]]
+			i = j
+		else:
+			literal.append(row[i])
+			i += 1
+			if len(literal) == 0x7FFF: out += [len(literal)] + literal; literal = []
+	if literal: out += [len(literal)] + literal
+	return out
+
+def read_cpp(path):
+	src = open(path).read()
+	name = re.search(r'uint16_t\s+(\w+)\s*\[', src).group(1)
+	body = src[src.index('{', src.index(name)) + 1:src.rindex('}')]
+	return name, [int(v, 16) for v in re.findall(r'0x[0-9A-Fa-f]{4}', body)]
+
+def read_image(path):
+	from PIL import Image
+	image = Image.open(path).convert('RGB')
+	pixs = image.load()
+	name = re.sub(r'\W', '_', os.path.splitext(os.path.basename(path))[0])
+	return name, image.size[0], [ ((pixs[x, y][0] >> 3) << 11) | ((pixs[x, y][1] >> 2) << 5) | (pixs[x, y][2] >> 3)
+	                              for y in range(image.size[1]) for x in range(image.size[0]) ]
+
+if len(sys.argv) != 4 and len(sys.argv) != 3:
+	print("Utility to run-length code a Marlin TFT 16 bit image for TFT_IMAGE_RLE.")
+	print("Usage: rle16-tft-image.py INPUT.cpp WIDTH OUTPUT.cpp")
+	print("       rle16-tft-image.py INPUT.(png|bmp|jpg) OUTPUT.cpp")
+	exit(1)
+
+if len(sys.argv) == 4:
+	name, pixels = read_cpp(sys.argv[1])
+	width = int(sys.argv[2])
+else:
+	name, width, pixels = read_image(sys.argv[1])
+
+if len(pixels) % width:
+	print("Pixel count %d is not a multiple of the width %d" % (len(pixels), width))
+	exit(1)
+
+codes = []
+for y in range(len(pixels) // width):
+	codes += rle_row(pixels[y * width:(y + 1) * width])
+
+f = open(sys.argv[-1], 'wt')
+f.write("""/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+// Generated by buildroot/share/scripts/rle16-tft-image.py. Do not edit.
+
+#include "../../../inc/MarlinConfigPre.h"
+
+#if HAS_GRAPHICAL_TFT && ENABLED(TFT_IMAGE_RLE)
+
+""")
+f.write("extern const uint16_t %s_rle[%d] = {\n" % (name, len(codes)))
+for i in range(0, len(codes), 16):
+	f.write("  " + ", ".join('0x{0:04X}'.format(c) for c in codes[i:i + 16]) + ",\n")
+f.write("};\n\n#endif // HAS_GRAPHICAL_TFT && TFT_IMAGE_RLE\n")
+f.close()
+
+print("%s: %d pixels, %d bytes -> %d bytes" % (name, len(pixels), len(pixels) * 2, len(codes) * 2))
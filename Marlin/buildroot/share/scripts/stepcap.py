@@ -0,0 +1,85 @@
+#!/usr/bin/env python3
+#
+# stepcap.py
+# Fetch a STEP_CAPTURE dump (D207 D) and write the motion of each axis as CSV.
+#
+#   stepcap.py /dev/ttyACM0 [-b 250000] [-w 1] [-o steps.csv]
+#   stepcap.py dump.bin -o steps.csv       A saved serial log of "D207 D"
+#
+# Columns: time (s), then position (steps), velocity (steps/s) and
+# acceleration (steps/s^2) of each axis, averaged over windows of -w ms.
+#
+import argparse, struct, sys
+
+def read_dump(data):
+	start = data.find(b"stepcap:begin:")
+	if start < 0: sys.exit("No stepcap:begin in the data")
+	eol = data.index(b"\n", start)
+	_, _, count, rate, axes = data[start:eol].decode().strip().split(":")
+	count, rate = int(count), int(rate)
+	body = data[eol + 1:eol + 1 + 6 * count]
+	if len(body) < 6 * count: sys.exit("The dump is short: %d of %d entries" % (len(body) // 6, count))
+	return rate, axes, [struct.unpack_from("<IBB", body, 6 * i) for i in range(count)]
+
+def fetch(port, baud):
+	import serial
+	s = serial.Serial(port, baud, timeout=2)
+	s.reset_input_buffer()
+	s.write(b"D207 D\n")
+	data = b""
+	while not b"stepcap:end" in data:
+		chunk = s.read(4096)
+		if not chunk: sys.exit("Timed out waiting for the dump")
+		data += chunk
+	return data
+
+def motion(rate, axes, entries, window_ms):
+	# Unwrap the 32-bit cycle count and step each axis
+	rows, pos, t, last = [], [0] * len(axes), 0, None
+	for cycles, steps, dirs in entries:
+		if last is not None: t += (cycles - last) & 0xFFFFFFFF
+		last = cycles
+		for a in range(len(axes)):
+			if steps & (1 << a): pos[a] += -1 if dirs & (1 << a) else 1
+		rows.append((t / rate, list(pos)))
+
+	# Sample the position at the end of each window
+	window, samples, i = window_ms / 1000, [], 0
+	if not rows: return samples
+	w = 0
+	while i < len(rows):
+		end = (w + 1) * window
+		while i < len(rows) and rows[i][0] < end: i += 1
+		samples.append((end, rows[i - 1][1] if i else [0] * len(axes)))
+		w += 1
+
+	out, vel = [], [0] * len(axes)
+	for n, (t, p) in enumerate(samples):
+		prev = samples[n - 1][1] if n else p
+		v = [(p[a] - prev[a]) / window for a in range(len(axes))]
+		acc = [(v[a] - vel[a]) / window for a in range(len(axes))]
+		vel = v
+		out.append((t, p, v, acc))
+	return out
+
+def main():
+	ap = argparse.ArgumentParser(description="Convert a Marlin STEP_CAPTURE dump to CSV")
+	ap.add_argument("source", help="serial port, or a file holding the dump")
+	ap.add_argument("-b", "--baud", type=int, default=250000)
+	ap.add_argument("-w", "--window", type=float, default=1.0, help="averaging window in ms")
+	ap.add_argument("-o", "--output", help="CSV file (default stdout)")
+	args = ap.parse_args()
+
+	try:
+		data = open(args.source, "rb").read() if not args.source.startswith(("/dev/", "COM")) else fetch(args.source, args.baud)
+	except OSError as e:
+		sys.exit(str(e))
+
+	rate, axes, entries = read_dump(data)
+	out = open(args.output, "w") if args.output else sys.stdout
+	out.write("t," + ",".join("%s,v%s,a%s" % (a, a, a) for a in axes) + "\n")
+	for t, p, v, acc in motion(rate, axes, entries, args.window):
+		out.write("%.6f," % t + ",".join("%d,%.1f,%.0f" % (p[a], v[a], acc[a]) for a in range(len(axes))) + "\n")
+
+if __name__ == "__main__":
+	main()
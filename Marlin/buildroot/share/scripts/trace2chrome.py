@@ -0,0 +1,75 @@
+#!/usr/bin/env python3
+#
+# trace2chrome.py
+# Fetch a TRACE_EVENTS dump (D208 D) and write it as a Chrome trace (JSON)
+# to open in chrome://tracing or https://ui.perfetto.dev
+#
+#   trace2chrome.py /dev/ttyACM0 [-b 250000] [-o trace.json]
+#   trace2chrome.py dump.bin -o trace.json     A saved serial log of "D208 D"
+#
+import argparse, json, struct, sys
+
+TRACE_UI_TASK, TRACE_END = 0x40, 0x80
+
+def read_dump(data):
+	start = data.find(b"trace:begin:")
+	if start < 0: sys.exit("No trace:begin in the data")
+	eol = data.index(b"\n", start)
+	_, _, count, rate, names = data[start:eol].decode().strip().split(":")
+	count, rate = int(count), int(rate)
+	body = data[eol + 1:eol + 1 + 5 * count]
+	if len(body) < 5 * count: sys.exit("The dump is short: %d of %d events" % (len(body) // 5, count))
+	return rate, names.split(","), [struct.unpack_from("<IB", body, 5 * i) for i in range(count)]
+
+def fetch(port, baud):
+	import serial
+	s = serial.Serial(port, baud, timeout=2)
+	s.reset_input_buffer()
+	s.write(b"D208 D\n")
+	data = b""
+	while not b"trace:end" in data:
+		chunk = s.read(4096)
+		if not chunk: sys.exit("Timed out waiting for the dump")
+		data += chunk
+	return data
+
+def chrome_trace(rate, names, events):
+	# Unwrap the 32-bit cycle count. Drop the ends of scopes that began before the ring.
+	out = [
+		{ "name": "thread_name", "ph": "M", "pid": 1, "tid": 1, "args": { "name": "marlin" } },
+		{ "name": "thread_name", "ph": "M", "pid": 1, "tid": 2, "args": { "name": "ui" } }
+	]
+	open_scopes, t, last = { 1: [], 2: [] }, 0, None
+	for cycles, event in events:
+		if last is not None: t += (cycles - last) & 0xFFFFFFFF
+		last = cycles
+		ident, tid = event & 0x3F, 2 if event & TRACE_UI_TASK else 1
+		name = names[ident] if ident < len(names) else "id%d" % ident
+		stack = open_scopes[tid]
+		if event & TRACE_END:
+			if name not in stack: continue
+			while stack.pop() != name: pass
+		else:
+			stack.append(name)
+		out.append({ "name": name, "ph": "E" if event & TRACE_END else "B", "ts": t * 1e6 / rate, "pid": 1, "tid": tid })
+	return { "traceEvents": out, "displayTimeUnit": "ns" }
+
+def main():
+	ap = argparse.ArgumentParser(description="Convert a Marlin TRACE_EVENTS dump to a Chrome trace")
+	ap.add_argument("source", help="serial port, or a file holding the dump")
+	ap.add_argument("-b", "--baud", type=int, default=250000)
+	ap.add_argument("-o", "--output", help="JSON file (default stdout)")
+	args = ap.parse_args()
+
+	try:
+		data = open(args.source, "rb").read() if not args.source.startswith(("/dev/", "COM")) else fetch(args.source, args.baud)
+	except OSError as e:
+		sys.exit(str(e))
+
+	rate, names, events = read_dump(data)
+	out = open(args.output, "w") if args.output else sys.stdout
+	json.dump(chrome_trace(rate, names, events), out)
+	if out is not sys.stdout: out.close()
+
+if __name__ == "__main__":
+	main()
@@ -15,7 +15,7 @@ function usage()
 {
    cat << usage_info
 
-   Usage: $(basename $0) -m <machine> [-s] [-l]
+   Usage: $(basename $0) -m <machine> [-s] [-l|-i] [-w]
 
    arguments:
      -h           show this help message and exit
@@ -23,8 +23,10 @@ function usage()
      -s           swap extruders ( for dreamer and inventor machines )
      -o           use Dreamer old motherboard ( swap extruder DIR )
      -l           enable linear advance ( pressure control algo )
+     -i           enable linear advance in the step loop ( keeps S-curve acceleration )
      -u           old style GUI
      -g           MKS GUI
+     -w           host serial port on the WiFi module UART
      -v           verbose build
      
    example:
@@ -55,7 +57,7 @@ then
    fi
 fi
 
-while getopts "m:slohvug" opt
+while getopts "m:sloihvugw" opt
 do
    case "$opt" in
       m ) machine="$OPTARG" ;;
@@ -65,6 +67,9 @@ do
       l ) flags+="-DLIN_ADVANCE "
           name_postfix+="_la"
          ;;
+      i ) flags+="-DLIN_ADVANCE -DLIN_ADVANCE_INTEGRATED "
+          name_postfix+="_lai"
+         ;;
       u ) flags+="-DUSE_OLD_MARLIN_UI "
           name_postfix+="_classic"
          ;;
@@ -74,6 +79,9 @@ do
       g ) flags+="-DUSE_MKS_UI "
           name_postfix+="_mks"
          ;;
+      w ) flags+="-DFF_WIFI_SERIAL "
+          name_postfix+="_wifi"
+         ;;
       v ) build_silent="" ;;
       ? | h ) usage; exit ;;
    esac